@@ -0,0 +1,85 @@
+// bench_compare.cpp
+// Benchmark regression check against a stored baseline
+//
+// Compares two result files written by BenchReport (NFX_BENCH_JSON=path or
+// --json=path on a benchmark that reports JSON) and fails when any case
+// got slower than its noise allows:
+//
+//   median_ns, cycles_per_msg   max(--tolerance, --noise x relative IQR)
+//   p99_ns                      twice that
+//   instructions_per_msg        --instructions (default 2%)
+//   cache_misses_per_msg        25%, when either run has >= 0.05 per message
+//
+// Cases missing from the current run are reported but do not fail the
+// check; new cases are listed for the next baseline.
+//
+// Usage:
+//   bench_compare <baseline.json> <current.json> [--tolerance=0.05] [--noise=3]
+//                 [--instructions=0.02]
+//
+// Exit status: 0 no regression, 1 regression, 2 bad arguments or files.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "benchmark_utils.hpp"
+
+using namespace nfx::bench;
+
+int main(int argc, char* argv[]) {
+    CompareOptions options;
+    std::string files[2];
+    int file_count = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const auto value = [&](std::string_view prefix) { return std::stod(std::string{arg.substr(prefix.size())}); };
+        if (arg.starts_with("--tolerance=")) options.min_tolerance = value("--tolerance=");
+        else if (arg.starts_with("--noise=")) options.noise_factor = value("--noise=");
+        else if (arg.starts_with("--instructions=")) options.instruction_tolerance = value("--instructions=");
+        else if (!arg.starts_with("--") && file_count < 2) files[file_count++] = arg;
+        else file_count = 3;
+    }
+    if (file_count != 2) {
+        std::cerr << "usage: " << argv[0] << " <baseline.json> <current.json>"
+                  << " [--tolerance=0.05] [--noise=3] [--instructions=0.02]\n";
+        return 2;
+    }
+
+    const auto baseline = BenchReport::load(files[0]);
+    const auto current = BenchReport::load(files[1]);
+    if (!baseline || !current) {
+        std::cerr << "Cannot read " << (baseline ? files[1] : files[0]) << " as benchmark results\n";
+        return 2;
+    }
+
+    std::cout << "Baseline: " << files[0] << " (" << baseline->suite() << ", "
+              << baseline->results().size() << " cases)\n";
+    std::cout << "Current:  " << files[1] << " (" << current->suite() << ", "
+              << current->results().size() << " cases)\n\n";
+
+    const auto comparisons = compare_reports(*baseline, *current, options);
+    size_t regressions = 0;
+    std::string last_case;
+    for (const MetricComparison& m : comparisons) {
+        if (m.name != last_case) {
+            std::cout << m.name << "\n";
+            last_case = m.name;
+        }
+        if (m.verdict == CompareVerdict::Missing || m.verdict == CompareVerdict::Added) {
+            std::cout << "    " << verdict_name(m.verdict) << "\n";
+            continue;
+        }
+        std::cout << "    " << std::left << std::setw(22) << m.metric << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(12) << m.baseline << " -> " << std::setw(12) << m.current
+                  << std::showpos << std::setprecision(1) << std::setw(9) << m.change * 100.0 << "%"
+                  << std::noshowpos << "  (+/-" << m.tolerance * 100.0 << "%)  " << verdict_name(m.verdict)
+                  << "\n";
+        if (m.verdict == CompareVerdict::Regressed) ++regressions;
+    }
+
+    std::cout << "\n" << (regressions ? std::to_string(regressions) + " regression(s)" : std::string{"No regressions"})
+              << "\n";
+    return regressions ? 1 : 0;
+}
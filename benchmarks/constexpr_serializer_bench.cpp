@@ -9,9 +9,13 @@
 #include <algorithm>
 #include <numeric>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
 
 #include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/serializer/order_template.hpp"
+#include "nexusfix/serializer/decimal_serializer.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/util/cpu_affinity.hpp"
 
@@ -52,6 +56,37 @@ T percentile(std::vector<T>& data, double p) {
     return data[idx];
 }
 
+// Previous digit-at-a-time integer formatting, for comparison
+size_t digit_loop_u64(char* buf, uint64_t value) {
+    size_t digits = 1;
+    for (uint64_t temp = value; temp >= 10; temp /= 10) ++digits;
+    size_t pos = digits;
+    do {
+        buf[--pos] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value > 0);
+    return digits;
+}
+
+// Median ns per call of fn(i), timed in batches so rdtscp does not dominate
+template<typename Fn>
+double median_ns(Fn&& fn, double cpu_freq_ghz) {
+    constexpr int BATCH = 64;
+    constexpr int SAMPLES = BENCHMARK_ITERATIONS / BATCH;
+    std::vector<uint64_t> latencies;
+    latencies.reserve(SAMPLES);
+    for (int s = 0; s < SAMPLES; ++s) {
+        uint64_t start = rdtsc();
+        for (int i = 0; i < BATCH; ++i) {
+            fn(s * BATCH + i);
+        }
+        uint64_t end = rdtsc();
+        latencies.push_back(end - start);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return static_cast<double>(latencies[SAMPLES / 2]) / BATCH / cpu_freq_ghz;
+}
+
 // Escape SOH for display
 std::string escape_soh(std::string_view msg) {
     std::string result;
@@ -236,6 +271,148 @@ int main() {
     std::cout << "  P99:    " << runtime_p99 << " ns\n";
     std::cout << "  Size:   " << header_builder.size() << " bytes\n";
 
+    // ========================================================================
+    // OrderTemplate vs NewOrderSingle::Builder
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  NewOrderSingle: OrderTemplate (patched) vs Builder\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    OrderTemplateFields order_fields;
+    order_fields.begin_string = BEGIN_STRING;
+    order_fields.sender_comp_id = SENDER;
+    order_fields.target_comp_id = TARGET;
+    order_fields.symbol = "AAPL";
+    order_fields.cl_ord_id_prefix = "NFX";
+    OrderTemplate<> order_template{order_fields};
+
+    std::vector<uint64_t> template_latencies;
+    template_latencies.reserve(BENCHMARK_ITERATIONS);
+    size_t template_size = 0;
+
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        const auto n = static_cast<uint32_t>(i);
+        uint64_t start = rdtsc();
+        auto msg = order_template.render(n + 1, n, FixedPrice{15025000000LL + n},
+                                         Qty::from_int(100 + (i & 63)), SENDING_TIME);
+        uint64_t end = rdtsc();
+
+        asm volatile("" : : "r"(msg.data()) : "memory");
+        template_size = msg.size();
+        template_latencies.push_back(end - start);
+    }
+
+    std::vector<uint64_t> builder_latencies;
+    builder_latencies.reserve(BENCHMARK_ITERATIONS);
+    MessageAssembler order_assembler;
+    size_t builder_size = 0;
+
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        const auto n = static_cast<uint32_t>(i);
+        char cl_ord_id[24];
+        int id_len = std::snprintf(cl_ord_id, sizeof(cl_ord_id), "NFX%012u", n);
+
+        uint64_t start = rdtsc();
+        auto msg = fix44::NewOrderSingle::Builder{}
+            .sender_comp_id(SENDER)
+            .target_comp_id(TARGET)
+            .msg_seq_num(n + 1)
+            .sending_time(SENDING_TIME)
+            .cl_ord_id(std::string_view{cl_ord_id, static_cast<size_t>(id_len)})
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time(SENDING_TIME)
+            .order_qty(Qty::from_int(100 + (i & 63)))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice{15025000000LL + n})
+            .build(order_assembler);
+        uint64_t end = rdtsc();
+
+        asm volatile("" : : "r"(msg.data()) : "memory");
+        builder_size = msg.size();
+        builder_latencies.push_back(end - start);
+    }
+
+    std::sort(template_latencies.begin(), template_latencies.end());
+    std::sort(builder_latencies.begin(), builder_latencies.end());
+
+    double template_median = static_cast<double>(template_latencies[BENCHMARK_ITERATIONS / 2]) / cpu_freq_ghz;
+    double template_p99 = static_cast<double>(percentile(template_latencies, 0.99)) / cpu_freq_ghz;
+    double builder_median = static_cast<double>(builder_latencies[BENCHMARK_ITERATIONS / 2]) / cpu_freq_ghz;
+    double builder_p99 = static_cast<double>(percentile(builder_latencies, 0.99)) / cpu_freq_ghz;
+
+    std::cout << "  OrderTemplate  Median: " << std::fixed << std::setprecision(1) << template_median
+              << " ns  P99: " << template_p99 << " ns  (" << template_size << " bytes)\n";
+    std::cout << "  Builder        Median: " << builder_median
+              << " ns  P99: " << builder_p99 << " ns  (" << builder_size << " bytes)\n";
+    std::cout << "  Speedup:       " << std::setprecision(2) << (builder_median / template_median) << "x\n";
+
+    // ========================================================================
+    // Integer and Price Formatting
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Integer / Price Formatting (digit loop vs LUT";
+#if defined(NFX_SSE2_DIGITS)
+    std::cout << " + SSE2";
+#endif
+    std::cout << ")\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    // Sequence numbers, order ids and prices of realistic magnitudes
+    std::vector<uint64_t> int_values(1024);
+    std::vector<int64_t> price_values(1024);
+    for (size_t i = 0; i < int_values.size(); ++i) {
+        const uint64_t x = (i + 1) * 0x9E3779B97F4A7C15ULL;
+        int_values[i] = x >> (24 + (i % 40));
+        price_values[i] = static_cast<int64_t>((x >> 28) % 100000000000ULL);  // 0 - 1000.0
+    }
+    char fmt_buf[64];
+
+    auto report = [](const char* name, double old_ns, double new_ns) {
+        std::cout << "  " << std::left << std::setw(22) << name << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(8) << old_ns << " ns"
+                  << std::setw(8) << new_ns << " ns" << std::setw(8) << std::setprecision(2)
+                  << (old_ns / new_ns) << "x\n";
+    };
+    std::cout << "                            before     after  speedup\n";
+
+    double loop_ns = median_ns([&](int i) {
+        size_t n = digit_loop_u64(fmt_buf, int_values[i & 1023]);
+        asm volatile("" : : "r"(fmt_buf), "r"(n) : "memory");
+    }, cpu_freq_ghz);
+    double u64_ns = median_ns([&](int i) {
+        size_t n = write_u64(fmt_buf, int_values[i & 1023]);
+        asm volatile("" : : "r"(fmt_buf), "r"(n) : "memory");
+    }, cpu_freq_ghz);
+    report("uint64 (variable)", loop_ns, u64_ns);
+
+    double fixed_loop_ns = median_ns([&](int i) {
+        uint64_t v = int_values[i & 1023] % 1000000000000ULL;
+        for (size_t d = 12; d > 0; --d) {
+            fmt_buf[d - 1] = static_cast<char>('0' + (v % 10));
+            v /= 10;
+        }
+        asm volatile("" : : "r"(fmt_buf) : "memory");
+    }, cpu_freq_ghz);
+    double fixed_ns = median_ns([&](int i) {
+        write_fixed_digits(fmt_buf, int_values[i & 1023] % 1000000000000ULL, 12);
+        asm volatile("" : : "r"(fmt_buf) : "memory");
+    }, cpu_freq_ghz);
+    report("uint64 (12 fixed)", fixed_loop_ns, fixed_ns);
+
+    double snprintf_ns = median_ns([&](int i) {
+        int n = std::snprintf(fmt_buf, sizeof(fmt_buf), "%.8g",
+                              FixedPrice{price_values[i & 1023]}.to_double());
+        asm volatile("" : : "r"(fmt_buf), "r"(n) : "memory");
+    }, cpu_freq_ghz);
+    double price_ns = median_ns([&](int i) {
+        size_t n = write_decimal<FixedPrice::DECIMAL_PLACES>(fmt_buf, price_values[i & 1023]);
+        asm volatile("" : : "r"(fmt_buf), "r"(n) : "memory");
+    }, cpu_freq_ghz);
+    report("FixedPrice (snprintf)", snprintf_ns, price_ns);
+
     // ========================================================================
     // Comparison Summary
     // ========================================================================
@@ -289,6 +466,7 @@ int main() {
     std::cout << "  2. TagString<Tag> - Pre-computed tag strings (e.g., \"35=\")\n";
     std::cout << "  3. FastMessageBuilder - Zero-overhead message building\n";
     std::cout << "  4. FastIntSerializer - Branch-free integer formatting\n";
+    std::cout << "     write_u64 / write_decimal - 8-digit blocks, exact prices\n";
     std::cout << "  5. MessageFactory - Complete message templates\n";
     std::cout << "  6. LogonBuilder, HeartbeatBuilder - Typed builders\n";
 
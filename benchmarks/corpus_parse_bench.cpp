@@ -0,0 +1,440 @@
+// corpus_parse_bench.cpp
+// Parser benchmark over a corpus of real traffic
+//
+// parse_benchmark parses a handful of hand-written messages over and over:
+// they stay in L1 and the branch predictor learns them. This benchmark
+// parses a corpus - mixed message types, sizes and venues, in capture
+// order - laid out back to back in memory the way receive buffers hold
+// them:
+//
+//   warm  the corpus is replayed after one untimed pass; larger corpora
+//         still stream from L2/LLC, branches see the real type mix
+//   cold  every message's bytes are flushed from all cache levels
+//         (clflush) before it is parsed, as if the NIC had just DMA'd it
+//
+// and reports per-MsgType latency and throughput (messages/s and MB/s of
+// parse time) plus whole-corpus throughput without per-message timing.
+//
+// Corpus sources, in any mix:
+//   pcap / pcapng       TCP payloads reassembled per flow (PcapReplaySource);
+//                       messages enter the corpus in arrival order
+//   *.nfxlog            util::BinaryLogger files (BinaryLogReplaySource)
+//   anything else       FIX log / drop-copy text, messages back to back or
+//                       one per line, '|' accepted for SOH
+// Messages that do not parse (e.g. a log that rewrote the checksum) are
+// dropped and counted. Without files a synthetic corpus of mixed venues
+// and types is generated.
+//
+// Usage:
+//   corpus_parse_bench [--mode=warm|cold|both] [--parser=parse|structural]
+//                      [--passes=N] [--synthetic=N] [--json=PATH] [file ...]
+//
+// Results go to PATH (or $NFX_BENCH_JSON) as a BenchReport for bench_compare.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <emmintrin.h>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/session/session_replay.hpp"
+#include "benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+namespace {
+
+// ============================================================================
+// Corpus
+// ============================================================================
+
+struct CorpusMessage {
+    size_t offset;
+    uint32_t size;
+    uint16_t type;                 // Index into Corpus::types
+};
+
+/// Messages back to back in one buffer (SIMD_PADDING zero bytes at the end)
+struct Corpus {
+    std::string data;
+    std::vector<CorpusMessage> messages;
+    std::vector<std::string> types;
+    size_t rejected{0};            // Framed but failed to parse
+
+    [[nodiscard]] std::span<const char> message(size_t i) const noexcept {
+        return {data.data() + messages[i].offset, messages[i].size};
+    }
+
+    /// Append msg if it parses
+    void add(std::string_view msg) {
+        if (!ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()})) {
+            ++rejected;
+            return;
+        }
+        const size_t at = msg.find("\x01" "35=");
+        const std::string_view rest = msg.substr(at + 4);
+        const std::string type{rest.substr(0, rest.find(fix::SOH))};
+        auto it = std::find(types.begin(), types.end(), type);
+        if (it == types.end()) it = types.insert(types.end(), type);
+        messages.push_back({data.size(), static_cast<uint32_t>(msg.size()),
+                            static_cast<uint16_t>(it - types.begin())});
+        data.append(msg);
+    }
+
+    void finish() { data.append(simd::SIMD_PADDING, '\0'); }
+};
+
+/// Pulls complete FIX messages out of a byte stream that arrives in pieces
+class StreamExtractor {
+public:
+    void append(std::string_view bytes, Corpus& corpus) {
+        buffer_.append(bytes);
+        size_t cursor = 0;
+        while (true) {
+            const size_t start = buffer_.find("8=FIX", cursor);
+            if (start == std::string::npos) {
+                cursor = buffer_.size() > 4 ? buffer_.size() - 4 : 0;   // May hold the next "8=FI"
+                break;
+            }
+            const std::span<const char> data{buffer_.data(), buffer_.size()};
+            const simd::MessageBoundary b = nfx::detail::frame_message(data, start);
+            if (!b.complete) {
+                cursor = start;
+                break;
+            }
+            corpus.add(std::string_view{buffer_}.substr(b.start, b.end - b.start));
+            cursor = b.end;
+        }
+        buffer_.erase(0, cursor);
+    }
+
+private:
+    std::string buffer_;
+};
+
+// ============================================================================
+// Text Logs
+// ============================================================================
+
+void load_log(const std::string& raw, Corpus& corpus) {
+    std::string data;
+    data.reserve(raw.size());
+    for (char c : raw) {
+        if (c == '\r') continue;
+        data.push_back(c == '|' ? fix::SOH : c);
+    }
+    StreamExtractor extractor;
+    extractor.append(data, corpus);
+}
+
+// ============================================================================
+// Recorded Sessions
+// ============================================================================
+
+template <ReplaySource Source>
+void load_recording(Source& source, Corpus& corpus) {
+    ReplayMessage msg;
+    while (source.next(msg)) corpus.add({msg.bytes.data(), msg.bytes.size()});
+}
+
+/// Binary log or packet capture (session_replay.hpp); false if path is neither
+bool load_recording(const std::string& path, Corpus& corpus, const char*& kind) {
+    if (auto log = BinaryLogReplaySource::open(path.c_str())) {
+        kind = "binary log";
+        load_recording(*log, corpus);
+        return true;
+    }
+    if (auto capture = PcapReplaySource::open(path.c_str())) {
+        kind = "capture";
+        load_recording(*capture, corpus);
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// Synthetic Corpus
+// ============================================================================
+
+/// Drop-copy-like mix from four venues with different CompIDs and custom tags
+void synthesize(Corpus& corpus, size_t count) {
+    struct Venue { const char* sender; const char* target; const char* extra; };
+    constexpr std::array<Venue, 4> venues{{
+        {"NYSE", "DESK1", ""},
+        {"ARCA", "DESK1", "9730=B\x01"},
+        {"BATS", "DESK2", "9303=R\x01" "9882=A\x01"},
+        {"IEX", "DESK3", "5001=PRIMARY\x01" "5002=20240102\x01"},
+    }};
+    constexpr std::array<const char*, 8> symbols{"AAPL", "MSFT", "NVDA", "AMZN", "GOOGL", "META", "TSLA", "SPY"};
+
+    std::mt19937_64 rng{42};
+    std::discrete_distribution<int> pick{40, 30, 10, 8, 4, 3, 5};   // 8 X W D F G 0
+    std::uniform_int_distribution<int> venue_of{0, 3};
+    std::uniform_int_distribution<int> symbol_of{0, 7};
+    std::uniform_int_distribution<int> levels{1, 20};
+    std::uniform_int_distribution<int> updates{1, 10};
+    std::array<uint32_t, venues.size()> seq{};
+    seq.fill(1);
+
+    auto px = [&](int cents) { return std::to_string(100 + cents / 100) + "." + std::to_string(10 + cents % 90); };
+    for (size_t i = 0; i < count; ++i) {
+        const int v = venue_of(rng);
+        const std::string sym = symbols[static_cast<size_t>(symbol_of(rng))];
+        const std::string id = std::to_string(i);
+        std::string type;
+        std::string body;
+        switch (pick(rng)) {
+            case 0: {
+                type = "8";
+                const bool fill = rng() % 3 == 0;
+                body = "37=O" + id + "\x01" "11=C" + id + "\x01" "17=E" + id + "\x01" +
+                       (fill ? "150=F\x01" "39=2\x01" : "150=0\x01" "39=0\x01") + "55=" + sym +
+                       "\x01" "54=1\x01" "38=100\x01" "44=" + px(static_cast<int>(i % 5000)) + "\x01" +
+                       (fill ? "32=100\x01" "31=" + px(static_cast<int>(i % 5000)) + "\x01" "151=0\x01" "14=100\x01"
+                             : std::string{"151=100\x01" "14=0\x01"}) + "6=0\x01" "60=20240102-09:30:00.123\x01";
+                break;
+            }
+            case 1: {
+                type = "X";
+                const int n = updates(rng);
+                body = "268=" + std::to_string(n) + "\x01";
+                for (int k = 0; k < n; ++k) {
+                    body += "279=" + std::to_string(k % 3) + "\x01" "269=" + std::to_string(k % 2) + "\x01"
+                            "55=" + sym + "\x01" "270=" + px(static_cast<int>(i + static_cast<size_t>(k)) % 5000) +
+                            "\x01" "271=" + std::to_string(100 * (k + 1)) + "\x01";
+                }
+                break;
+            }
+            case 2: {
+                type = "W";
+                const int n = levels(rng);
+                body = "262=MD" + id + "\x01" "55=" + sym + "\x01" "268=" + std::to_string(2 * n) + "\x01";
+                for (int k = 0; k < n; ++k) {
+                    body += "269=0\x01" "270=" + px(4000 - k) + "\x01" "271=" + std::to_string(100 + k) + "\x01"
+                            "269=1\x01" "270=" + px(4001 + k) + "\x01" "271=" + std::to_string(200 + k) + "\x01";
+                }
+                break;
+            }
+            case 3:
+                type = "D";
+                body = "11=C" + id + "\x01" "55=" + sym + "\x01" "54=2\x01" "60=20240102-09:30:00.123\x01"
+                       "38=500\x01" "40=2\x01" "44=" + px(static_cast<int>(i % 5000)) + "\x01" "59=0\x01";
+                break;
+            case 4:
+                type = "F";
+                body = "41=C" + id + "\x01" "11=X" + id + "\x01" "55=" + sym + "\x01" "54=2\x01"
+                       "60=20240102-09:30:00.123\x01" "38=500\x01";
+                break;
+            case 5:
+                type = "G";
+                body = "41=C" + id + "\x01" "11=R" + id + "\x01" "55=" + sym + "\x01" "54=2\x01"
+                       "60=20240102-09:30:00.123\x01" "38=400\x01" "40=2\x01" "44=" + px(static_cast<int>(i % 5000)) +
+                       "\x01";
+                break;
+            default:
+                type = "0";
+                break;
+        }
+        const Venue& venue = venues[static_cast<size_t>(v)];
+        const std::string fields = "35=" + type + "\x01" "49=" + venue.sender + "\x01" "56=" + venue.target +
+                                   "\x01" "34=" + std::to_string(seq[static_cast<size_t>(v)]++) +
+                                   "\x01" "52=20240102-09:30:00.123\x01" + venue.extra + body;
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(fields.size()) + "\x01" + fields;
+        const auto cs = fix::format_checksum(fix::calculate_checksum(std::span<const char>{msg.data(), msg.size()}));
+        msg += "10=" + std::string{cs.data(), 3} + "\x01";
+        corpus.add(msg);
+    }
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+enum class Parser : uint8_t { Parse, Structural };
+
+[[nodiscard]] NFX_FORCE_INLINE bool parse_one(Parser parser, std::span<const char> msg) noexcept {
+    auto result = parser == Parser::Parse ? ParsedMessage::parse(msg) : ParsedMessage::parse_structural(msg);
+    asm volatile("" :: "r"(&result) : "memory");
+    return result.has_value();
+}
+
+/// Evict a message's bytes from every cache level
+NFX_FORCE_INLINE void flush(std::span<const char> msg) noexcept {
+    const auto begin = reinterpret_cast<uintptr_t>(msg.data()) & ~uintptr_t{63};
+    const auto end = reinterpret_cast<uintptr_t>(msg.data() + msg.size());
+    for (uintptr_t line = begin; line < end; line += 64) _mm_clflush(reinterpret_cast<const void*>(line));
+    _mm_mfence();
+}
+
+struct TypeStats {
+    std::vector<double> ns;
+    uint64_t bytes{0};
+};
+
+/// Per-message timing of passes over the corpus, grouped by MsgType
+void run_mode(const Corpus& corpus, Parser parser, bool cold, size_t passes, double freq_ghz,
+              BenchReport& report) {
+    const char* mode = cold ? "cold" : "warm";
+    for (size_t i = 0; i < corpus.messages.size(); ++i) (void)parse_one(parser, corpus.message(i));
+
+    std::vector<TypeStats> by_type(corpus.types.size());
+    for (auto& t : by_type) t.ns.reserve(corpus.messages.size() * passes / corpus.types.size() + 1);
+    std::vector<double> all;
+    all.reserve(corpus.messages.size() * passes);
+
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t i = 0; i < corpus.messages.size(); ++i) {
+            const std::span<const char> msg = corpus.message(i);
+            if (cold) flush(msg);
+            const uint64_t start = rdtsc_vm_safe();
+            (void)parse_one(parser, msg);
+            const uint64_t end = rdtsc_vm_safe();
+            const double ns = cycles_to_ns(end - start, freq_ghz);
+            TypeStats& t = by_type[corpus.messages[i].type];
+            t.ns.push_back(ns);
+            t.bytes += msg.size();
+            all.push_back(ns);
+        }
+    }
+
+    // Whole corpus, no per-message timestamps
+    const uint64_t start = rdtsc_vm_safe();
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (size_t i = 0; i < corpus.messages.size(); ++i) {
+            const std::span<const char> msg = corpus.message(i);
+            if (cold) flush(msg);
+            (void)parse_one(parser, msg);
+        }
+    }
+    const double total_sec = cycles_to_ns(rdtsc_vm_safe() - start, freq_ghz) / 1e9;
+    const double total_msgs = static_cast<double>(corpus.messages.size() * passes);
+
+    std::cout << "\n=== " << mode << " cache ===\n";
+    std::cout << std::right << std::setw(6) << "type" << std::setw(10) << "msgs" << std::setw(10) << "avg B"
+              << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << std::setw(12) << "Mmsg/s"
+              << std::setw(10) << "MB/s" << "\n";
+    std::vector<size_t> order(corpus.types.size());
+    for (size_t t = 0; t < order.size(); ++t) order[t] = t;
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return by_type[a].ns.size() > by_type[b].ns.size(); });
+    for (size_t t : order) {
+        TypeStats& s = by_type[t];
+        if (s.ns.empty()) continue;
+        const double busy_sec = std::accumulate(s.ns.begin(), s.ns.end(), 0.0) / 1e9;
+        const size_t n = s.ns.size();
+        BenchResult& r = report.add(BenchResult::from_samples(std::string{mode} + " 35=" + corpus.types[t], s.ns));
+        std::cout << std::setw(6) << corpus.types[t] << std::setw(10) << n << std::fixed << std::setprecision(0)
+                  << std::setw(10) << static_cast<double>(s.bytes) / static_cast<double>(n)
+                  << std::setw(10) << r.median_ns << std::setw(10) << r.p99_ns << std::setprecision(2)
+                  << std::setw(12) << static_cast<double>(n) / busy_sec / 1e6 << std::setprecision(0)
+                  << std::setw(10) << static_cast<double>(s.bytes) / busy_sec / 1e6 << "\n";
+    }
+
+    BenchResult& overall = report.add(BenchResult::from_samples(std::string{mode} + " all", all));
+    MessageCounters counters;
+    size_t next = 0;
+    counters.count(overall, corpus.messages.size(), [&] {
+        const std::span<const char> msg = corpus.message(next++);
+        if (cold) flush(msg);
+        (void)parse_one(parser, msg);
+    });
+    std::cout << std::setw(6) << "all" << std::setw(10) << static_cast<size_t>(total_msgs)
+              << std::setw(10) << static_cast<double>(corpus.data.size() - simd::SIMD_PADDING) /
+                                   static_cast<double>(corpus.messages.size())
+              << std::setw(10) << overall.median_ns << std::setw(10) << overall.p99_ns << std::setprecision(2)
+              << std::setw(12) << total_msgs / total_sec / 1e6 << std::setprecision(0)
+              << std::setw(10) << static_cast<double>(corpus.data.size() - simd::SIMD_PADDING) *
+                                   static_cast<double>(passes) / total_sec / 1e6
+              << "   (whole corpus, untimed loop)\n";
+    if (overall.instructions_per_msg >= 0) {
+        std::cout << std::setprecision(1) << "  per message: " << overall.cycles_per_msg << " cycles, "
+                  << overall.instructions_per_msg << " instructions, " << std::setprecision(3)
+                  << overall.cache_misses_per_msg << " cache misses\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string mode = "both";
+    std::string parser_name = "parse";
+    size_t passes = 5;
+    size_t synthetic = 100'000;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        if (arg.starts_with("--mode=")) mode = arg.substr(7);
+        else if (arg.starts_with("--parser=")) parser_name = arg.substr(9);
+        else if (arg.starts_with("--passes=")) passes = std::max<size_t>(1, std::stoul(std::string{arg.substr(9)}));
+        else if (arg.starts_with("--synthetic=")) synthetic = std::stoul(std::string{arg.substr(12)});
+        else if (arg.starts_with("--json=")) continue;     // BenchReport::write_if_requested()
+        else files.emplace_back(arg);
+    }
+    if ((mode != "warm" && mode != "cold" && mode != "both") ||
+        (parser_name != "parse" && parser_name != "structural")) {
+        std::cerr << "usage: " << argv[0] << " [--mode=warm|cold|both] [--parser=parse|structural]"
+                  << " [--passes=N] [--synthetic=N] [--json=PATH] [file ...]\n";
+        return 2;
+    }
+    const Parser parser = parser_name == "parse" ? Parser::Parse : Parser::Structural;
+
+    std::cout << "NexusFIX Corpus Parse Benchmark\n";
+    std::cout << "===============================\n";
+
+    Corpus corpus;
+    for (const std::string& path : files) {
+        const size_t before = corpus.messages.size();
+        const char* kind = "log";
+        if (!load_recording(path, corpus, kind)) {
+            std::ifstream in(path, std::ios::binary);
+            if (!in) {
+                std::cerr << "Cannot read " << path << "\n";
+                return 1;
+            }
+            std::ostringstream ss;
+            ss << in.rdbuf();
+            load_log(ss.str(), corpus);
+        }
+        std::cout << "  " << path << ": " << corpus.messages.size() - before << " messages ("
+                  << kind << ")\n";
+    }
+    if (files.empty()) {
+        synthesize(corpus, synthetic);
+        std::cout << "  synthetic: 4 venues, mixed 8/X/W/D/F/G/0\n";
+    }
+    corpus.finish();
+    if (corpus.messages.empty()) {
+        std::cerr << "No FIX messages in the corpus\n";
+        return 1;
+    }
+
+    std::cout << "  Messages:    " << corpus.messages.size() << " (" << corpus.types.size() << " types, "
+              << corpus.rejected << " rejected)\n";
+    std::cout << "  Bytes:       " << corpus.data.size() - simd::SIMD_PADDING << "\n";
+    std::cout << "  Parser:      ParsedMessage::" << parser_name << "\n";
+    std::cout << "  Passes:      " << passes << "\n";
+
+    const double freq_ghz = estimate_cpu_freq_ghz_busy();
+    std::cout << "  CPU:         " << std::fixed << std::setprecision(3) << freq_ghz << " GHz\n";
+
+    BenchReport report{"corpus_parse_bench"};
+    if (mode != "cold") run_mode(corpus, parser, false, passes, freq_ghz, report);
+    if (mode != "warm") run_mode(corpus, parser, true, passes, freq_ghz, report);
+
+    std::cout << "\nMmsg/s and MB/s per type are over parse time only; \"all\" is the whole\n"
+                 "corpus in a loop without timestamps.\n";
+    return report.write_if_requested(argc, argv) ? 0 : 1;
+}
@@ -1,5 +1,7 @@
 // Benchmark: Deferred Processor Hot Path Latency
-// Compares inline processing vs deferred processing
+// Compares inline processing vs deferred processing, then fixed 4 KB slots
+// (DeferredProcessor) vs the variable-length byte ring (DeferredByteProcessor)
+// on a FIX message size mix: memory reserved, submit latency, throughput
 //
 // Build: cmake --build build && ./build/bin/benchmarks/deferred_processor_bench
 
@@ -12,9 +14,11 @@
 #include <thread>
 #include <chrono>
 #include <memory>
+#include <array>
 #include <atomic>
 
 #include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/deferred_processor.hpp"
 #include "nexusfix/memory/spsc_queue.hpp"
 
 // Benchmark configuration
@@ -23,6 +27,13 @@ constexpr int BENCHMARK_ITERATIONS = 100000;
 constexpr int NUM_RUNS = 5;
 constexpr size_t MESSAGE_SIZE = 256;
 
+// Fixed slots vs byte ring
+constexpr int MIX_MESSAGES = 1000000;
+constexpr size_t FIXED_SLOTS = 8192;                  // 8192 x 4 KB slots
+constexpr size_t BYTE_RING_BYTES = 2 * 1024 * 1024;   // 2 MiB ring
+// Heartbeat, cancel, new order, execution report
+constexpr std::array<size_t, 4> MIX_SIZES{90, 180, 250, 420};
+
 // RDTSC for precise timing
 inline uint64_t rdtsc() {
     uint64_t lo, hi;
@@ -99,6 +110,39 @@ void expensive_processing(const char* data, size_t size) {
     asm volatile("" ::: "memory");
 }
 
+struct MixResult {
+    size_t reserved_bytes;
+    double submit_mean_ns;
+    double submit_p99_ns;
+    double msgs_per_sec;
+};
+
+/// Submit MIX_MESSAGES through a started processor (callback counts into
+/// processed) and time each submit plus the whole run until drained
+template <typename Processor>
+MixResult run_mix(Processor& processor, std::atomic<uint64_t>& processed,
+                  const char* payload, size_t reserved_bytes, double cpu_freq_ghz) {
+    std::vector<uint64_t> latencies;
+    latencies.reserve(MIX_MESSAGES);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < MIX_MESSAGES; ++i) {
+        std::span<const char> msg{payload, MIX_SIZES[i % MIX_SIZES.size()]};
+        uint64_t t0 = rdtsc();
+        while (!processor.submit(msg, t0)) {
+            std::this_thread::yield();
+        }
+        latencies.push_back(rdtsc() - t0);
+    }
+    while (processed.load(std::memory_order_relaxed) < static_cast<uint64_t>(MIX_MESSAGES)) {
+        std::this_thread::yield();
+    }
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    BenchmarkResult stats = calculate_stats(latencies, cpu_freq_ghz);
+    return MixResult{reserved_bytes, stats.mean_ns, stats.p99_ns, MIX_MESSAGES / elapsed_s};
+}
+
 void print_result(const char* name, const BenchmarkResult& r) {
     std::cout << std::setw(25) << std::left << name
               << std::setw(10) << std::fixed << std::setprecision(1) << r.mean_ns
@@ -360,6 +404,68 @@ int main() {
 
     print_result("Queue Push Only", queue_avg);
 
+    // ========================================================================
+    // Benchmark 4: Fixed Slots vs Byte Ring (memory/throughput tradeoff)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Fixed 4 KB Slots vs Byte Ring (mix 90/180/250/420 bytes)\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    std::array<char, 4096> mix_payload;
+    std::memset(mix_payload.data(), 'F', mix_payload.size());
+
+    using FixedProcessor = DeferredProcessor<DeferredMessageBuffer<4096>, FIXED_SLOTS>;
+    MixResult fixed_mix{};
+    {
+        auto fixed = std::make_unique<FixedProcessor>();
+        std::atomic<uint64_t> done{0};
+        (void)fixed->start([&](const DeferredMessageBuffer<4096>& buffer) {
+            expensive_processing(buffer.data, buffer.size);
+            done.fetch_add(1, std::memory_order_relaxed);
+        });
+        fixed_mix = run_mix(*fixed, done, mix_payload.data(),
+                            sizeof(DeferredMessageBuffer<4096>) * FIXED_SLOTS, cpu_freq_ghz);
+        fixed->stop();
+    }
+
+    MixResult ring_mix{};
+    {
+        DeferredByteProcessor ring{BYTE_RING_BYTES};
+        std::atomic<uint64_t> done{0};
+        (void)ring.start([&](const DeferredRecordView& record) {
+            expensive_processing(record.data, record.size);
+            done.fetch_add(1, std::memory_order_relaxed);
+        });
+        ring_mix = run_mix(ring, done, mix_payload.data(), ring.ring_capacity(), cpu_freq_ghz);
+        ring.stop();
+    }
+
+    size_t mix_record_bytes = 0;
+    for (size_t size : MIX_SIZES) {
+        mix_record_bytes += DeferredByteRing::record_size(size);
+    }
+    const size_t ring_messages = BYTE_RING_BYTES / (mix_record_bytes / MIX_SIZES.size());
+
+    std::cout << std::setw(25) << std::left << "Mode"
+              << std::setw(12) << "Reserved"
+              << std::setw(12) << "Messages"
+              << std::setw(12) << "Submit"
+              << std::setw(12) << "P99"
+              << std::setw(12) << "Msgs/sec" << "\n";
+    std::cout << std::string(85, '-') << "\n";
+    auto print_mix = [](const char* name, const MixResult& r, size_t messages) {
+        std::cout << std::setw(25) << std::left << name
+                  << std::setw(12) << (std::to_string(r.reserved_bytes / (1024 * 1024)) + " MiB")
+                  << std::setw(12) << messages
+                  << std::setw(12) << std::fixed << std::setprecision(1) << r.submit_mean_ns
+                  << std::setw(12) << r.submit_p99_ns
+                  << std::setw(12) << std::setprecision(0) << r.msgs_per_sec << "\n";
+    };
+    print_mix("Fixed slots (4 KB)", fixed_mix, FIXED_SLOTS);
+    print_mix("Byte ring", ring_mix, ring_messages);
+    std::cout << "  Messages = queue depth before backpressure at this mix\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
@@ -33,6 +33,7 @@ namespace old_impl {
         case nfx::ParseErrorCode::UnterminatedField:  return "Unterminated field";
         case nfx::ParseErrorCode::InvalidMsgType:     return "Invalid MsgType";
         case nfx::ParseErrorCode::GarbledMessage:     return "Garbled message";
+        case nfx::ParseErrorCode::TooManyFields:      return "Too many fields";
     }
     return "Unknown error";
 }
@@ -48,6 +49,9 @@ namespace old_impl {
         case nfx::SessionErrorCode::SequenceGap:     return "Sequence gap detected";
         case nfx::SessionErrorCode::InvalidState:    return "Invalid session state";
         case nfx::SessionErrorCode::Disconnected:    return "Disconnected";
+        case nfx::SessionErrorCode::Throttled:       return "Outbound rate limit reached";
+        case nfx::SessionErrorCode::RiskRejected:    return "Pre-trade risk check failed";
+        case nfx::SessionErrorCode::MalformedMessage: return "Malformed message";
     }
     return "Unknown error";
 }
@@ -74,6 +78,8 @@ namespace old_impl {
         case nfx::TransportErrorCode::WinsockInitFailed: return "Winsock initialization failed";
         case nfx::TransportErrorCode::IocpError:      return "IOCP operation failed";
         case nfx::TransportErrorCode::KqueueError:    return "kqueue operation failed";
+        case nfx::TransportErrorCode::TlsHandshakeFailed: return "TLS handshake failed";
+        case nfx::TransportErrorCode::TlsOffloadUnavailable: return "Kernel TLS offload unavailable";
     }
     return "Unknown error";
 }
@@ -114,7 +120,7 @@ inline void do_not_optimize(T&& value) {
 // Test data
 // ============================================================================
 
-constexpr std::array<nfx::ParseErrorCode, 12> ALL_PARSE_ERRORS = {
+constexpr std::array<nfx::ParseErrorCode, 13> ALL_PARSE_ERRORS = {
     nfx::ParseErrorCode::None,
     nfx::ParseErrorCode::BufferTooShort,
     nfx::ParseErrorCode::InvalidBeginString,
@@ -126,10 +132,11 @@ constexpr std::array<nfx::ParseErrorCode, 12> ALL_PARSE_ERRORS = {
     nfx::ParseErrorCode::DuplicateTag,
     nfx::ParseErrorCode::UnterminatedField,
     nfx::ParseErrorCode::InvalidMsgType,
-    nfx::ParseErrorCode::GarbledMessage
+    nfx::ParseErrorCode::GarbledMessage,
+    nfx::ParseErrorCode::TooManyFields
 };
 
-constexpr std::array<nfx::SessionErrorCode, 9> ALL_SESSION_ERRORS = {
+constexpr std::array<nfx::SessionErrorCode, 12> ALL_SESSION_ERRORS = {
     nfx::SessionErrorCode::None,
     nfx::SessionErrorCode::NotConnected,
     nfx::SessionErrorCode::AlreadyConnected,
@@ -138,7 +145,10 @@ constexpr std::array<nfx::SessionErrorCode, 9> ALL_SESSION_ERRORS = {
     nfx::SessionErrorCode::HeartbeatTimeout,
     nfx::SessionErrorCode::SequenceGap,
     nfx::SessionErrorCode::InvalidState,
-    nfx::SessionErrorCode::Disconnected
+    nfx::SessionErrorCode::Disconnected,
+    nfx::SessionErrorCode::Throttled,
+    nfx::SessionErrorCode::RiskRejected,
+    nfx::SessionErrorCode::MalformedMessage
 };
 
 constexpr std::array<nfx::TransportErrorCode, 20> ALL_TRANSPORT_ERRORS = {
@@ -192,7 +202,7 @@ int main() {
     // Benchmark 1: ParseError message()
     // ========================================================================
 
-    std::cout << "--- ParseError (12 codes, " << ITERATIONS << " iterations) ---\n\n";
+    std::cout << "--- ParseError (13 codes, " << ITERATIONS << " iterations) ---\n\n";
 
     // Warmup
     for (int i = 0; i < WARMUP; ++i) {
@@ -389,7 +399,7 @@ int main() {
     std::cout << "|------------------|--------------|--------------|-------------|\n";
     std::cout << "| Average          |              |              | " << avg_improvement << "% |\n";
 
-    std::cout << "\nTotal switch cases eliminated: 50 (12 + 9 + 20 + 9)\n";
+    std::cout << "\nTotal switch cases eliminated: 51 (13 + 9 + 20 + 9)\n";
 
     return 0;
 }
@@ -0,0 +1,283 @@
+// fast_decode_bench.cpp
+// FAST market data decode benchmark
+//
+// 1. Stop-bit integers: byte-at-a-time loop vs FastReader (SSE2 stop-byte
+//    search + PEXT / SWAR group assembly)
+// 2. MDIncrementalRefresh with 10 entries per message:
+//    FIX tag-value (parse + decode_md_entries) vs FAST (Decoder + MDEntrySink)
+//    into the same MDEntryColumns
+//
+// Usage:
+//   fast_decode_bench [iterations]
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/fast/decoder.hpp"
+#include "nexusfix/fast/md_entry_decode.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+// ============================================================================
+// FAST Encoding (input generation)
+// ============================================================================
+
+namespace {
+
+void put_uint(std::string& out, uint64_t v) {
+    char groups[10];
+    size_t n = 0;
+    do {
+        groups[n++] = static_cast<char>(v & 0x7F);
+        v >>= 7;
+    } while (v != 0);
+    for (size_t i = n; i-- > 0;) out.push_back(static_cast<char>(groups[i] | (i == 0 ? 0x80 : 0)));
+}
+
+void put_int(std::string& out, int64_t v) {
+    char groups[10];
+    size_t n = 0;
+    for (;;) {
+        groups[n++] = static_cast<char>(v & 0x7F);
+        const bool sign = (v & 0x40) != 0;
+        v >>= 7;
+        if ((v == 0 && !sign) || (v == -1 && sign)) break;
+    }
+    for (size_t i = n; i-- > 0;) out.push_back(static_cast<char>(groups[i] | (i == 0 ? 0x80 : 0)));
+}
+
+void put_ascii(std::string& out, std::string_view s) {
+    out.append(s.substr(0, s.size() - 1));
+    out.push_back(static_cast<char>(s.back() | 0x80));
+}
+
+using IncRefresh = fast::Template<32,
+    fast::Ascii<35, fast::Op::Constant, fast::Presence::Mandatory, "X">,
+    fast::UInt32<34, fast::Op::Increment>,
+    fast::UInt64<52, fast::Op::Delta>,
+    fast::Sequence<fast::UInt32<268>,
+        fast::UInt32<279, fast::Op::Copy>,
+        fast::Ascii<269, fast::Op::Copy>,
+        fast::Ascii<55, fast::Op::Copy>,
+        fast::UInt32<83, fast::Op::Increment>,
+        fast::Decimal<270, fast::Op::Delta>,
+        fast::Int64<271, fast::Op::Delta>>>;
+
+constexpr size_t ENTRIES = 10;
+constexpr std::array<std::string_view, 4> SYMBOLS{"ESZ5", "NQZ5", "CLF6", "GCG6"};
+
+struct Entry {
+    int action;
+    char type;
+    size_t symbol;
+    uint32_t rpt_seq;
+    int64_t price;   // 10^-2
+    int64_t size;
+};
+
+struct Corpus {
+    std::vector<std::string> fast;
+    std::vector<std::string> fix;
+};
+
+Corpus build_corpus(size_t messages) {
+    std::mt19937 rng{42};
+    Corpus corpus;
+    int64_t prev_price = 0;
+    int64_t prev_size = 0;
+    size_t prev_symbol = SIZE_MAX;
+    int prev_action = -1;
+    char prev_type = '\0';
+    std::array<uint32_t, SYMBOLS.size()> rpt{};
+    uint32_t prev_rpt = UINT32_MAX;   // Undefined: the first RptSeq is sent
+
+    for (size_t m = 0; m < messages; ++m) {
+        std::string f;
+        // pmap: template ID and MsgSeqNum on the first message, then incremented
+        if (m == 0) {
+            f.push_back(static_cast<char>(0xE0));
+            put_uint(f, 32);
+            put_uint(f, 1);
+        } else {
+            f.push_back(static_cast<char>(0x80));
+        }
+        put_int(f, m == 0 ? 1'700'000'000'000 : 137);
+        put_uint(f, ENTRIES);
+
+        std::string body = "268=" + std::to_string(ENTRIES) + "|";
+        for (size_t e = 0; e < ENTRIES; ++e) {
+            Entry en{};
+            en.action = static_cast<int>(rng() % 3 == 0);
+            en.type = rng() % 2 ? '1' : '0';
+            en.symbol = rng() % 8 == 0 || prev_symbol == SIZE_MAX ? rng() % 4 : prev_symbol;
+            en.price = 450000 + static_cast<int64_t>(rng() % 200);
+            en.size = 1 + static_cast<int64_t>(rng() % 50);
+            en.rpt_seq = ++rpt[en.symbol];
+
+            // Element pmap: 279, 269, 55, 83
+            const bool b279 = en.action != prev_action;
+            const bool b269 = en.type != prev_type;
+            const bool b55 = en.symbol != prev_symbol;
+            const bool b83 = en.rpt_seq != prev_rpt + 1;
+            f.push_back(static_cast<char>(0x80 | (b279 << 6) | (b269 << 5) | (b55 << 4) | (b83 << 3)));
+            if (b279) put_uint(f, static_cast<uint64_t>(en.action));
+            if (b269) put_ascii(f, std::string_view{&en.type, 1});
+            if (b55) put_ascii(f, SYMBOLS[en.symbol]);
+            if (b83) put_uint(f, en.rpt_seq);
+            put_int(f, m == 0 && e == 0 ? -2 : 0);
+            put_int(f, en.price - prev_price);
+            put_int(f, en.size - prev_size);
+
+            prev_action = en.action;
+            prev_type = en.type;
+            prev_symbol = en.symbol;
+            prev_rpt = en.rpt_seq;
+            prev_price = en.price;
+            prev_size = en.size;
+
+            body += "279=" + std::to_string(en.action) + "|269=" + en.type +
+                    "|55=" + std::string{SYMBOLS[en.symbol]} +
+                    "|83=" + std::to_string(en.rpt_seq) +
+                    "|270=" + std::to_string(en.price / 100) + (en.price % 100 < 10 ? ".0" : ".") +
+                    std::to_string(en.price % 100) +
+                    "|271=" + std::to_string(en.size) + "|";
+        }
+        corpus.fast.push_back(std::move(f));
+
+        std::string fields = "35=X|49=FEED|56=CLIENT|34=" + std::to_string(m + 1) +
+                             "|52=20260122-10:00:00.000|" + body;
+        std::string msg = "8=FIX.4.4|9=" + std::to_string(fields.size()) + "|" + fields;
+        for (char& c : msg) {
+            if (c == '|') c = fix::SOH;
+        }
+        auto cs = fix::format_checksum(fix::calculate_checksum(std::span<const char>{msg.data(), msg.size()}));
+        msg += "10=" + std::string{cs.data(), 3} + fix::SOH;
+        corpus.fix.push_back(std::move(msg));
+    }
+    return corpus;
+}
+
+uint64_t loop_uint(const uint8_t*& p) {
+    uint64_t v = 0;
+    for (;;) {
+        const uint8_t b = *p++;
+        v = (v << 7) | (b & 0x7F);
+        if (b & 0x80) return v;
+    }
+}
+
+void print_stats(const char* label, const LatencyStats& s) {
+    std::cout << "  " << std::left << std::setw(36) << label << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << s.p50_ns << " ns P50"
+              << std::setw(10) << s.p99_ns << " ns P99\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = argc > 1 ? std::stoul(argv[1]) : 20000;
+    const double freq_ghz = estimate_cpu_freq_ghz();
+
+    std::cout << "==========================================================\n";
+    std::cout << "  FAST Decode Benchmark (" << iterations << " iterations)\n";
+    std::cout << "==========================================================\n";
+
+    // ========================================================================
+    // Stop-Bit Integers
+    // ========================================================================
+
+    constexpr size_t INTS = 256;
+    std::mt19937_64 rng{7};
+    std::string ints;
+    for (size_t i = 0; i < INTS; ++i) put_uint(ints, rng() >> (rng() % 57));   // 1-10 bytes
+    ints.append(16, '\0');
+
+    std::vector<uint64_t> loop_cycles;
+    std::vector<uint64_t> reader_cycles;
+    uint64_t sink = 0;
+    for (size_t it = 0; it < iterations; ++it) {
+        const auto* p = reinterpret_cast<const uint8_t*>(ints.data());
+        uint64_t t0 = rdtsc_vm_safe();
+        for (size_t i = 0; i < INTS; ++i) sink += loop_uint(p);
+        loop_cycles.push_back(rdtsc_vm_safe() - t0);
+
+        fast::FastReader r{ints.data(), ints.size()};
+        t0 = rdtsc_vm_safe();
+        for (size_t i = 0; i < INTS; ++i) sink += r.uint64();
+        reader_cycles.push_back(rdtsc_vm_safe() - t0);
+    }
+    LatencyStats loop_stats;
+    LatencyStats reader_stats;
+    loop_stats.compute(loop_cycles, freq_ghz);
+    reader_stats.compute(reader_cycles, freq_ghz);
+
+    std::cout << "\n  Stop-bit integers (" << INTS << " per sample)\n";
+    print_stats("Byte loop", loop_stats);
+    print_stats("FastReader", reader_stats);
+    print_comparison_header("Loop", "FastReader");
+    print_comparison("P50", loop_stats.p50_ns, reader_stats.p50_ns);
+
+    // ========================================================================
+    // Market Data Messages
+    // ========================================================================
+
+    constexpr size_t MESSAGES = 1000;
+    const Corpus corpus = build_corpus(MESSAGES);
+    MDEntryColumns<> cols;
+
+    std::vector<uint64_t> fix_cycles;
+    std::vector<uint64_t> fast_cycles;
+    const size_t rounds = std::max<size_t>(1, iterations / MESSAGES);
+    size_t rows = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        for (const auto& raw : corpus.fix) {
+            const uint64_t t0 = rdtsc_vm_safe();
+            auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+            if (msg) {
+                rows += parser::decode_md_entries(msg->raw(), tag::MDUpdateAction::value, ENTRIES, cols);
+            }
+            fix_cycles.push_back(rdtsc_vm_safe() - t0);
+        }
+
+        // Dictionaries restart with the stream, as after a FAST reset
+        fast::Decoder<IncRefresh> decoder;
+        fast::MDEntrySink md{cols};
+        for (const auto& raw : corpus.fast) {
+            const uint64_t t0 = rdtsc_vm_safe();
+            fast::FastReader r{raw.data(), raw.size()};
+            if (decoder.decode_message(r, md)) rows += cols.count;
+            fast_cycles.push_back(rdtsc_vm_safe() - t0);
+        }
+    }
+    LatencyStats fix_stats;
+    LatencyStats fast_stats;
+    fix_stats.compute(fix_cycles, freq_ghz);
+    fast_stats.compute(fast_cycles, freq_ghz);
+
+    size_t fix_bytes = 0;
+    size_t fast_bytes = 0;
+    for (size_t i = 0; i < MESSAGES; ++i) {
+        fix_bytes += corpus.fix[i].size();
+        fast_bytes += corpus.fast[i].size();
+    }
+
+    std::cout << "\n  MDIncrementalRefresh, " << ENTRIES << " entries -> MDEntryColumns\n";
+    std::cout << "  Average size: FIX " << fix_bytes / MESSAGES << " bytes, FAST "
+              << fast_bytes / MESSAGES << " bytes\n";
+    print_stats("FIX parse + decode_md_entries", fix_stats);
+    print_stats("FAST Decoder + MDEntrySink", fast_stats);
+    print_comparison_header("FIX", "FAST");
+    print_comparison("P50", fix_stats.p50_ns, fast_stats.p50_ns);
+    print_comparison("P99", fix_stats.p99_ns, fast_stats.p99_ns);
+
+    std::cout << "\n  (checksum " << (sink + rows) % 1000 << ")\n";
+    return 0;
+}
@@ -11,6 +11,10 @@
 
 // Include the new implementation
 #include "nexusfix/types/field_types.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
+#include "nexusfix/parser/decimal_decoder.hpp"
+#include <vector>
+#include <string>
 
 // ============================================================================
 // OLD Implementation (switch-based) - for comparison
@@ -386,6 +390,124 @@ int main() {
     std::cout << "  NEW (lookup):     " << new_rand_cpop << " cycles/op\n";
     std::cout << "  Improvement:      " << rand_improvement << "%\n\n";
 
+    // ========================================================================
+    // Benchmark 7: Tag number decoding (scalar vs SWAR vs SSE4.1)
+    // ========================================================================
+
+    std::cout << "--- decode_tag() (ExecutionReport tag mix, " << ITERATIONS << " iterations) ---\n\n";
+
+    // Tag bytes as they appear in the wire buffer: "<tag>=" for each field
+    constexpr std::string_view TAG_BUFFER =
+        "8=9=35=49=56=34=52=37=17=150=39=55=54=38=44=151=14=6=5001=9030=10=";
+    constexpr std::span<const char> tag_buf{TAG_BUFFER.data(), TAG_BUFFER.size()};
+    std::array<std::pair<size_t, size_t>, 21> tag_ranges{};
+    {
+        size_t n = 0, start = 0;
+        for (size_t i = 0; i < TAG_BUFFER.size(); ++i) {
+            if (TAG_BUFFER[i] == '=') {
+                tag_ranges[n++] = {start, i - start};
+                start = i + 1;
+            }
+        }
+    }
+    const double tag_ops = static_cast<double>(ITERATIONS) * tag_ranges.size();
+
+    auto time_decoder = [&](auto&& decode) {
+        uint64_t start_cycles = rdtsc();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (auto [start, len] : tag_ranges) {
+                do_not_optimize(decode(start, len));
+            }
+        }
+        return static_cast<double>(rdtsc() - start_cycles) / tag_ops;
+    };
+
+    double scalar_tag_cpop = time_decoder([&](size_t start, size_t len) {
+        return nfx::parser::decode_tag_scalar(tag_buf.data() + start, len);
+    });
+    double swar_tag_cpop = time_decoder([&](size_t start, size_t len) {
+        return nfx::parser::decode_tag_swar(tag_buf, start, len);
+    });
+    double dispatch_tag_cpop = time_decoder([&](size_t start, size_t len) {
+        return nfx::parser::decode_tag(tag_buf, start, len);
+    });
+
+    std::cout << "  Scalar (loop):    " << scalar_tag_cpop << " cycles/op\n";
+    std::cout << "  SWAR (64-bit):    " << swar_tag_cpop << " cycles/op\n";
+#if defined(NFX_SSE41_TAG_DECODE)
+    double sse_tag_cpop = time_decoder([&](size_t start, size_t len) {
+        return nfx::parser::decode_tag_sse41(tag_buf, start, len);
+    });
+    std::cout << "  SSE4.1 (madd):    " << sse_tag_cpop << " cycles/op\n";
+#endif
+    std::cout << "  decode_tag():     " << dispatch_tag_cpop << " cycles/op\n\n";
+
+    // ========================================================================
+    // Benchmark 8: Price / quantity decoding (per-field vs batch)
+    // ========================================================================
+
+    constexpr int DECIMAL_ITERATIONS = ITERATIONS / 100;
+    constexpr size_t BOOK_LEVELS = 256;
+
+    std::cout << "--- decode_prices()/decode_qtys() (" << BOOK_LEVELS
+              << " snapshot levels, " << DECIMAL_ITERATIONS << " iterations) ---\n\n";
+
+    // Snapshot-like values laid out in one wire buffer
+    std::string decimal_wire;
+    std::vector<std::pair<size_t, size_t>> px_ranges, qty_ranges;
+    {
+        std::uniform_int_distribution<int> px_ticks(0, 99999);
+        std::uniform_int_distribution<int> qty_lots(1, 5000);
+        for (size_t i = 0; i < BOOK_LEVELS; ++i) {
+            std::string px = std::to_string(4000 + px_ticks(rng) / 100) + "." +
+                             std::to_string(10 + px_ticks(rng) % 90);
+            std::string qty = std::to_string(qty_lots(rng));
+            if (i % 4 == 0) qty += ".5";
+            px_ranges.emplace_back(decimal_wire.size() + 4, px.size());
+            decimal_wire += "270=" + px + '\x01';
+            qty_ranges.emplace_back(decimal_wire.size() + 4, qty.size());
+            decimal_wire += "271=" + qty + '\x01';
+        }
+    }
+    std::vector<nfx::FieldView> px_fields, qty_fields;
+    for (auto [start, len] : px_ranges) px_fields.emplace_back(270, decimal_wire.data() + start, len);
+    for (auto [start, len] : qty_ranges) qty_fields.emplace_back(271, decimal_wire.data() + start, len);
+
+    std::vector<nfx::FixedPrice> px_out(BOOK_LEVELS);
+    std::vector<nfx::Qty> qty_out(BOOK_LEVELS);
+    const double decimal_ops = static_cast<double>(DECIMAL_ITERATIONS) * BOOK_LEVELS * 2;
+
+    uint64_t scalar_dec_start = rdtsc();
+    for (int i = 0; i < DECIMAL_ITERATIONS; ++i) {
+        for (size_t k = 0; k < BOOK_LEVELS; ++k) {
+            px_out[k] = px_fields[k].as_price();
+            qty_out[k] = qty_fields[k].as_qty();
+        }
+        do_not_optimize(px_out.data());
+        do_not_optimize(qty_out.data());
+    }
+    double scalar_dec_cpop = static_cast<double>(rdtsc() - scalar_dec_start) / decimal_ops;
+
+    uint64_t batch_dec_start = rdtsc();
+    for (int i = 0; i < DECIMAL_ITERATIONS; ++i) {
+        do_not_optimize(nfx::parser::decode_prices(px_fields, px_out));
+        do_not_optimize(nfx::parser::decode_qtys(qty_fields, qty_out));
+        do_not_optimize(px_out.data());
+        do_not_optimize(qty_out.data());
+    }
+    double batch_dec_cpop = static_cast<double>(rdtsc() - batch_dec_start) / decimal_ops;
+
+    bool decimal_match = true;
+    for (size_t k = 0; k < BOOK_LEVELS; ++k) {
+        decimal_match &= px_out[k] == px_fields[k].as_price();
+        decimal_match &= qty_out[k] == qty_fields[k].as_qty();
+    }
+
+    std::cout << "  as_price()/as_qty(): " << scalar_dec_cpop << " cycles/value\n";
+    std::cout << "  Batch decode:        " << batch_dec_cpop << " cycles/value\n";
+    std::cout << "  Speedup:             " << scalar_dec_cpop / batch_dec_cpop << "x"
+              << (decimal_match ? "" : "  (MISMATCH)") << "\n\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
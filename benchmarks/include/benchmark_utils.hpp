@@ -6,19 +6,43 @@
     - CPU core affinity binding
     - Real-time scheduling
     - Latency statistics
+    - Machine-readable results (JSON) and baseline comparison
+
+    Results as JSON: a benchmark adds one BenchResult per case to a
+    BenchReport and calls write_if_requested(); nothing changes unless
+    NFX_BENCH_JSON=<path> is set (or --json=<path> is passed). bench_compare
+    then checks a run against a stored baseline:
+
+        NFX_BENCH_JSON=baseline.json ./parse_benchmark     # Known-good build
+        NFX_BENCH_JSON=current.json  ./parse_benchmark     # Candidate build
+        ./bench_compare baseline.json current.json         # Exit 1 on regression
+
+    Latency tolerances widen with the measured noise (interquartile range
+    of either run); instructions/msg is near-deterministic and held to a
+    tight fixed tolerance, which is what catches an extra copy that hides
+    inside timing noise.
 */
 
 #pragma once
 
+#include <cctype>
 #include <cstdint>
+#include <cstdlib>
 #include <vector>
 #include <algorithm>
 #include <numeric>
 #include <cmath>
 #include <chrono>
 #include <thread>
+#include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "perf_counters.hpp"
 
 #ifdef __linux__
 #include <sched.h>
@@ -369,4 +393,377 @@ inline void print_comparison_header(const char* before_label = "Before",
     std::cout << std::string(66, '-') << "\n";
 }
 
+// ============================================================================
+// Machine-Readable Results
+// ============================================================================
+
+/// One benchmark case: latency distribution (ns per message) and hardware
+/// counters per message (< 0 when perf_event_open is not available)
+struct BenchResult {
+    std::string name;
+    size_t samples{0};
+    double min_ns{0};
+    double p25_ns{0};
+    double median_ns{0};
+    double p75_ns{0};
+    double p90_ns{0};
+    double p99_ns{0};
+    double p999_ns{0};
+    double max_ns{0};
+    double mean_ns{0};
+    double cycles_per_msg{-1};
+    double instructions_per_msg{-1};
+    double cache_misses_per_msg{-1};
+
+    /// Build from per-message latencies in ns (sorted in place)
+    [[nodiscard]] static BenchResult from_samples(std::string name, std::vector<double>& ns) {
+        BenchResult r;
+        r.name = std::move(name);
+        r.samples = ns.size();
+        if (ns.empty()) return r;
+        std::sort(ns.begin(), ns.end());
+        auto at = [&](double p) {
+            return ns[std::min(static_cast<size_t>(p * static_cast<double>(ns.size())), ns.size() - 1)];
+        };
+        r.min_ns = ns.front();
+        r.p25_ns = at(0.25);
+        r.median_ns = at(0.50);
+        r.p75_ns = at(0.75);
+        r.p90_ns = at(0.90);
+        r.p99_ns = at(0.99);
+        r.p999_ns = at(0.999);
+        r.max_ns = ns.back();
+        r.mean_ns = std::accumulate(ns.begin(), ns.end(), 0.0) / static_cast<double>(ns.size());
+        return r;
+    }
+
+    /// Interquartile range relative to the median: the run's own noise
+    [[nodiscard]] double relative_spread() const noexcept {
+        return median_ns > 0 ? (p75_ns - p25_ns) / median_ns : 0.0;
+    }
+};
+
+/// Cycles, instructions and cache misses over a loop, divided per message
+/// Count a separate, untimed pass so the timestamp reads are not included.
+class MessageCounters {
+public:
+    MessageCounters() {
+        valid_ = group_.add(PerfEvent::CpuCycles) &&
+                 group_.add(PerfEvent::Instructions) &&
+                 group_.add(PerfEvent::CacheMisses);
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return valid_; }
+
+    /// Run fn() messages times under the counters and store the rates in r
+    template <typename Fn>
+    void count(BenchResult& r, size_t messages, Fn&& fn) {
+        if (!valid_ || messages == 0) return;
+        group_.start();
+        for (size_t i = 0; i < messages; ++i) {
+            fn();
+            compiler_barrier();
+        }
+        group_.stop();
+        const auto values = group_.read();
+        if (values.size() != 3 || !values[0].valid || !values[1].valid || !values[2].valid) return;
+        const auto n = static_cast<double>(messages);
+        r.cycles_per_msg = static_cast<double>(values[0].value) / n;
+        r.instructions_per_msg = static_cast<double>(values[1].value) / n;
+        r.cache_misses_per_msg = static_cast<double>(values[2].value) / n;
+    }
+
+private:
+    PerfCounterGroup group_;
+    bool valid_{false};
+};
+
+/// Time fn() per call and count its hardware events
+/// @return Result with latency percentiles and (when available) counters
+template <typename Fn>
+[[nodiscard]] BenchResult measure(std::string name, size_t iterations, double freq_ghz, Fn&& fn,
+                                  size_t warmup = 1000) {
+    for (size_t i = 0; i < warmup; ++i) fn();
+
+    std::vector<double> ns;
+    ns.reserve(iterations);
+    for (size_t i = 0; i < iterations; ++i) {
+        const uint64_t start = rdtsc_vm_safe();
+        fn();
+        const uint64_t end = rdtsc_vm_safe();
+        ns.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+    BenchResult r = BenchResult::from_samples(std::move(name), ns);
+    MessageCounters counters;
+    counters.count(r, iterations, fn);
+    return r;
+}
+
+/// Results of one benchmark executable
+class BenchReport {
+public:
+    explicit BenchReport(std::string suite = {}) : suite_{std::move(suite)} {}
+
+    BenchResult& add(BenchResult r) { return results_.emplace_back(std::move(r)); }
+
+    [[nodiscard]] const std::string& suite() const noexcept { return suite_; }
+    [[nodiscard]] const std::vector<BenchResult>& results() const noexcept { return results_; }
+
+    [[nodiscard]] const BenchResult* find(std::string_view name) const noexcept {
+        for (const auto& r : results_) {
+            if (r.name == name) return &r;
+        }
+        return nullptr;
+    }
+
+    void write_json(std::ostream& out) const {
+        out << "{\"suite\":";
+        write_string(out, suite_);
+        out << ",\"results\":[";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const BenchResult& r = results_[i];
+            out << (i ? ",\n  " : "\n  ") << "{\"name\":";
+            write_string(out, r.name);
+            out << ",\"samples\":" << r.samples;
+            write_number(out, "min_ns", r.min_ns);
+            write_number(out, "p25_ns", r.p25_ns);
+            write_number(out, "median_ns", r.median_ns);
+            write_number(out, "p75_ns", r.p75_ns);
+            write_number(out, "p90_ns", r.p90_ns);
+            write_number(out, "p99_ns", r.p99_ns);
+            write_number(out, "p999_ns", r.p999_ns);
+            write_number(out, "max_ns", r.max_ns);
+            write_number(out, "mean_ns", r.mean_ns);
+            write_number(out, "cycles_per_msg", r.cycles_per_msg);
+            write_number(out, "instructions_per_msg", r.instructions_per_msg);
+            write_number(out, "cache_misses_per_msg", r.cache_misses_per_msg);
+            out << "}";
+        }
+        out << "\n]}\n";
+    }
+
+    /// Write to --json=PATH (if in argv) or $NFX_BENCH_JSON; no-op when neither is set
+    /// @return false only if a path was given and could not be written
+    bool write_if_requested(int argc = 0, char** argv = nullptr) const {
+        std::string path;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg{argv[i]};
+            if (arg.starts_with("--json=")) path = arg.substr(7);
+        }
+        if (path.empty()) {
+            if (const char* env = std::getenv("NFX_BENCH_JSON")) path = env;
+        }
+        if (path.empty()) return true;
+
+        std::ofstream out{path};
+        if (out) write_json(out);
+        if (!out) {
+            std::cerr << "Could not write benchmark results to " << path << "\n";
+            return false;
+        }
+        std::cout << "Results written to " << path << "\n";
+        return true;
+    }
+
+    /// Read a file written by write_json()
+    [[nodiscard]] static std::optional<BenchReport> load(const std::string& path) {
+        std::ifstream in{path};
+        if (!in) return std::nullopt;
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return parse(ss.str());
+    }
+
+    /// Parse the output of write_json() (only that shape is understood)
+    [[nodiscard]] static std::optional<BenchReport> parse(std::string_view json) {
+        JsonCursor c{json};
+        BenchReport report;
+        if (!c.expect('{')) return std::nullopt;
+        while (!c.consume('}')) {
+            std::string key;
+            if (!c.string(key) || !c.expect(':')) return std::nullopt;
+            if (key == "suite") {
+                if (!c.string(report.suite_)) return std::nullopt;
+            } else if (key == "results") {
+                if (!c.expect('[')) return std::nullopt;
+                while (!c.consume(']')) {
+                    BenchResult r;
+                    if (!parse_result(c, r)) return std::nullopt;
+                    report.results_.push_back(std::move(r));
+                    (void)c.consume(',');
+                }
+            } else {
+                return std::nullopt;
+            }
+            (void)c.consume(',');
+        }
+        return report;
+    }
+
+private:
+    /// Minimal reader for the flat objects write_json() emits
+    struct JsonCursor {
+        std::string_view s;
+        size_t pos{0};
+
+        void skip_ws() noexcept {
+            while (pos < s.size() && std::isspace(static_cast<unsigned char>(s[pos]))) ++pos;
+        }
+        bool consume(char ch) noexcept {
+            skip_ws();
+            if (pos < s.size() && s[pos] == ch) { ++pos; return true; }
+            return false;
+        }
+        bool expect(char ch) noexcept { return consume(ch); }
+        bool string(std::string& out) {
+            if (!consume('"')) return false;
+            out.clear();
+            while (pos < s.size() && s[pos] != '"') {
+                if (s[pos] == '\\' && pos + 1 < s.size()) ++pos;
+                out.push_back(s[pos++]);
+            }
+            return pos++ < s.size();
+        }
+        /// Number, or null (returned as -1)
+        bool number(double& out) {
+            skip_ws();
+            if (s.substr(pos, 4) == "null") { pos += 4; out = -1; return true; }
+            const size_t start = pos;
+            while (pos < s.size() && (std::isdigit(static_cast<unsigned char>(s[pos])) ||
+                                      s[pos] == '-' || s[pos] == '+' || s[pos] == '.' ||
+                                      s[pos] == 'e' || s[pos] == 'E')) ++pos;
+            if (pos == start) return false;
+            out = std::strtod(std::string{s.substr(start, pos - start)}.c_str(), nullptr);
+            return true;
+        }
+    };
+
+    static bool parse_result(JsonCursor& c, BenchResult& r) {
+        if (!c.expect('{')) return false;
+        while (!c.consume('}')) {
+            std::string key;
+            if (!c.string(key) || !c.expect(':')) return false;
+            if (key == "name") {
+                if (!c.string(r.name)) return false;
+            } else {
+                double v = 0;
+                if (!c.number(v)) return false;
+                if (key == "samples") r.samples = static_cast<size_t>(v);
+                else if (key == "min_ns") r.min_ns = v;
+                else if (key == "p25_ns") r.p25_ns = v;
+                else if (key == "median_ns") r.median_ns = v;
+                else if (key == "p75_ns") r.p75_ns = v;
+                else if (key == "p90_ns") r.p90_ns = v;
+                else if (key == "p99_ns") r.p99_ns = v;
+                else if (key == "p999_ns") r.p999_ns = v;
+                else if (key == "max_ns") r.max_ns = v;
+                else if (key == "mean_ns") r.mean_ns = v;
+                else if (key == "cycles_per_msg") r.cycles_per_msg = v;
+                else if (key == "instructions_per_msg") r.instructions_per_msg = v;
+                else if (key == "cache_misses_per_msg") r.cache_misses_per_msg = v;
+            }
+            (void)c.consume(',');
+        }
+        return true;
+    }
+
+    static void write_string(std::ostream& out, std::string_view v) {
+        out << '"';
+        for (char ch : v) {
+            if (ch == '"' || ch == '\\') out << '\\';
+            out << ch;
+        }
+        out << '"';
+    }
+
+    static void write_number(std::ostream& out, const char* key, double v) {
+        out << ",\"" << key << "\":";
+        if (v < 0 || !std::isfinite(v)) out << "null";
+        else out << std::fixed << std::setprecision(3) << v;
+    }
+
+    std::string suite_;
+    std::vector<BenchResult> results_;
+};
+
+// ============================================================================
+// Baseline Comparison
+// ============================================================================
+
+struct CompareOptions {
+    double min_tolerance{0.05};        // Latency / cycles: never tighter than 5%
+    double noise_factor{3.0};          // ... widened to 3x the larger relative IQR
+    double tail_factor{2.0};           // p99 gets this multiple of the median's tolerance
+    double instruction_tolerance{0.02};// Instructions/msg (near-deterministic)
+    double cache_miss_tolerance{0.25};
+    double cache_miss_floor{0.05};     // Ignore cache misses below this per message
+};
+
+enum class CompareVerdict : uint8_t { Unchanged, Improved, Regressed, Missing, Added };
+
+[[nodiscard]] inline const char* verdict_name(CompareVerdict v) noexcept {
+    switch (v) {
+        case CompareVerdict::Unchanged: return "ok";
+        case CompareVerdict::Improved:  return "improved";
+        case CompareVerdict::Regressed: return "REGRESSED";
+        case CompareVerdict::Missing:   return "missing";
+        case CompareVerdict::Added:     return "new";
+    }
+    return "?";
+}
+
+/// One metric of one case, baseline vs current
+struct MetricComparison {
+    std::string name;              // Benchmark case
+    const char* metric{""};
+    double baseline{0};
+    double current{0};
+    double change{0};              // (current - baseline) / baseline
+    double tolerance{0};           // Relative change accepted as noise
+    CompareVerdict verdict{CompareVerdict::Unchanged};
+};
+
+namespace detail {
+
+inline void compare_metric(std::vector<MetricComparison>& out, const std::string& name,
+                           const char* metric, double baseline, double current, double tolerance) {
+    if (baseline <= 0 || current < 0) return;     // Not measured in one of the runs
+    MetricComparison m{name, metric, baseline, current, (current - baseline) / baseline, tolerance};
+    if (m.change > tolerance) m.verdict = CompareVerdict::Regressed;
+    else if (m.change < -tolerance) m.verdict = CompareVerdict::Improved;
+    out.push_back(m);
+}
+
+} // namespace detail
+
+/// Compare every case of current against baseline
+/// Cases only in one of the reports are listed as Missing / Added.
+[[nodiscard]] inline std::vector<MetricComparison> compare_reports(
+    const BenchReport& baseline, const BenchReport& current, const CompareOptions& o = {}) {
+    std::vector<MetricComparison> out;
+    for (const BenchResult& base : baseline.results()) {
+        const BenchResult* cur = current.find(base.name);
+        if (!cur) {
+            out.push_back({base.name, "", 0, 0, 0, 0, CompareVerdict::Missing});
+            continue;
+        }
+        const double noise = std::max(base.relative_spread(), cur->relative_spread());
+        const double latency_tol = std::max(o.min_tolerance, o.noise_factor * noise);
+        detail::compare_metric(out, base.name, "median_ns", base.median_ns, cur->median_ns, latency_tol);
+        detail::compare_metric(out, base.name, "p99_ns", base.p99_ns, cur->p99_ns, o.tail_factor * latency_tol);
+        detail::compare_metric(out, base.name, "cycles_per_msg", base.cycles_per_msg, cur->cycles_per_msg,
+                               latency_tol);
+        detail::compare_metric(out, base.name, "instructions_per_msg", base.instructions_per_msg,
+                               cur->instructions_per_msg, o.instruction_tolerance);
+        if (std::max(base.cache_misses_per_msg, cur->cache_misses_per_msg) >= o.cache_miss_floor) {
+            detail::compare_metric(out, base.name, "cache_misses_per_msg", base.cache_misses_per_msg,
+                                   cur->cache_misses_per_msg, o.cache_miss_tolerance);
+        }
+    }
+    for (const BenchResult& cur : current.results()) {
+        if (!baseline.find(cur.name)) out.push_back({cur.name, "", 0, 0, 0, 0, CompareVerdict::Added});
+    }
+    return out;
+}
+
 } // namespace nfx::bench
@@ -0,0 +1,279 @@
+/*
+    NexusFIX Loopback Venue (benchmarks)
+
+    In-process FIX acceptor for end-to-end benchmarks: accepts a number of
+    TCP connections on an ephemeral port and runs an acceptor
+    SessionManager for each on one busy-polling thread. Every order
+    message is acknowledged with an ExecutionReport echoing its ClOrdID:
+
+        35=D  ->  35=8 150=0 (New)
+        35=F  ->  35=8 150=4 (Canceled)
+        35=G  ->  35=8 150=5 (Replaced)
+
+    Other application messages are accepted and ignored. The venue takes
+    its TargetCompID from each connection's Logon, so any number of
+    initiators with distinct SenderCompIDs can log on.
+
+    BasicVenueSession<Socket> serves one connection on any socket with
+    try_receive() and send() (ShmTransport for the shared-memory round
+    trip); LoopbackVenue runs VenueSessions over TCP.
+
+    SessionReader is the receive side both ends use: SessionManager
+    handles one message per on_data_received() call, so a read holding
+    several messages (or part of one) is framed by a MessageReassembler
+    first.
+
+    Usage:
+        nfx::bench::LoopbackVenue venue;
+        const uint16_t port = venue.start(sessions, core);
+        // ... connect initiators to 127.0.0.1:port ...
+        venue.stop();
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/parser/message_reassembler.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+namespace nfx::bench {
+
+// ============================================================================
+// Session Reader
+// ============================================================================
+
+/// Reads a socket and feeds a session one complete message at a time
+/// Reads alternate between two buffers: a partial message left pinned in
+/// one stays intact while the next read lands in the other.
+class SessionReader {
+public:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    SessionReader() : buffers_{std::make_unique<char[]>(2 * BUFFER_SIZE)} {}
+
+    /// Read what the socket has; false once the peer is gone
+    template <typename Socket, typename Session>
+    bool poll(Socket& socket, Session& session) noexcept {
+        char* buffer = buffers_.get() + next_ * BUFFER_SIZE;
+        auto received = socket.try_receive({buffer, BUFFER_SIZE});
+        if (!received) return false;
+        if (*received == 0) return true;
+
+        const auto id = static_cast<uint16_t>(next_);
+        next_ ^= 1;
+        (void)reassembler_.feed(id, {buffer, *received},
+            [&](std::span<const char> msg) { session.on_data_received(msg); },
+            [](uint16_t) {});
+        session.end_receive_batch();
+        return true;
+    }
+
+private:
+    std::unique_ptr<char[]> buffers_;
+    MessageReassembler<> reassembler_;
+    size_t next_{0};
+};
+
+// ============================================================================
+// Loopback Venue
+// ============================================================================
+
+template <typename Socket>
+class BasicVenueSession;
+
+template <typename Socket>
+struct VenueHandler : NullSessionHandler {
+    BasicVenueSession<Socket>* venue{nullptr};
+    Socket* socket{nullptr};
+
+    bool on_send(std::span<const char> data) noexcept {
+        while (!data.empty()) {
+            auto sent = socket->send(data);
+            if (!sent) return false;
+            data = data.subspan(*sent);
+        }
+        return true;
+    }
+
+    void on_message(MsgTypeTag<'D'>, const ParsedMessage& msg) noexcept {
+        venue->ack(msg, ExecType::New, OrdStatus::New);
+    }
+
+    void on_message(MsgTypeTag<'F'>, const ParsedMessage& msg) noexcept {
+        venue->ack(msg, ExecType::Canceled, OrdStatus::Canceled);
+    }
+
+    void on_message(MsgTypeTag<'G'>, const ParsedMessage& msg) noexcept {
+        venue->ack(msg, ExecType::Replaced, OrdStatus::New);
+    }
+};
+
+/// One accepted connection; the session is created from its Logon
+/// @tparam Socket Connection with try_receive() and send(), built from args
+template <typename Socket>
+class BasicVenueSession {
+public:
+    template <typename... Args>
+    explicit BasicVenueSession(std::string_view sender_comp_id, Args&&... args)
+        : sender_comp_id_{sender_comp_id}, socket_{std::forward<Args>(args)...} {}
+
+    BasicVenueSession(const BasicVenueSession&) = delete;
+    BasicVenueSession& operator=(const BasicVenueSession&) = delete;
+
+    /// Read and handle what the socket has; false once the peer is gone
+    bool poll() noexcept {
+        if (!session_) return open();
+        if (!reader_.poll(socket_, *session_)) {
+            session_->on_disconnect();
+            return false;
+        }
+        return true;
+    }
+
+    void ack(const ParsedMessage& order, ExecType exec_type, OrdStatus status) noexcept {
+        exec_id_.assign("E");
+        exec_id_.append(std::to_string(++exec_count_));
+        const char side = order.get_char(54);
+        fix44::ExecutionReport::Builder report;
+        report.order_id(exec_id_)
+            .exec_id(exec_id_)
+            .exec_type(exec_type)
+            .ord_status(status)
+            .cl_ord_id(order.get_string(11))
+            .symbol(order.get_string(55))
+            .side(side ? static_cast<Side>(side) : Side::Buy)
+            .order_qty(order.get_qty(38))
+            .leaves_qty(status == OrdStatus::Canceled ? Qty::from_int(0) : order.get_qty(38))
+            .cum_qty(Qty::from_int(0))
+            .avg_px(FixedPrice::from_double(0.0));
+        (void)session_->send_app_message(report);
+    }
+
+    [[nodiscard]] uint64_t acks() const noexcept { return exec_count_; }
+    [[nodiscard]] Socket& socket() noexcept { return socket_; }
+
+private:
+    /// Answer as sender_comp_id_ to whoever sends the Logon
+    /// The initiator waits for our reply, so its first read is the whole Logon.
+    bool open() noexcept {
+        std::array<char, 1024> logon;
+        auto received = socket_.try_receive(logon);
+        if (!received) return false;
+        if (*received == 0) return true;
+
+        const std::span<const char> data{logon.data(), *received};
+        const std::string_view raw{data.data(), data.size()};
+        const size_t at = raw.find("\x01" "49=");
+        if (at == std::string_view::npos) return false;
+        const size_t begin = at + 4;
+        const size_t end = raw.find('\x01', begin);
+        if (end == std::string_view::npos) return false;
+        target_comp_id_.assign(raw.substr(begin, end - begin));
+
+        SessionConfig config;
+        config.sender_comp_id = sender_comp_id_;
+        config.target_comp_id = target_comp_id_;
+        session_.emplace(config, VenueHandler<Socket>{{}, this, &socket_});
+        session_->on_connect();
+        session_->on_data_received(data);
+        session_->end_receive_batch();
+        return true;
+    }
+
+    std::string_view sender_comp_id_;
+    std::string target_comp_id_;
+    Socket socket_;
+    SessionReader reader_;
+    std::optional<SessionManager<VenueHandler<Socket>>> session_;
+    std::string exec_id_;
+    uint64_t exec_count_{0};
+};
+
+using VenueSession = BasicVenueSession<TcpSocket>;
+
+/// Accepts `sessions` connections and serves them on one thread
+class LoopbackVenue {
+public:
+    explicit LoopbackVenue(std::string_view sender_comp_id = "VENUE")
+        : sender_comp_id_{sender_comp_id} {}
+
+    ~LoopbackVenue() { stop(); }
+
+    LoopbackVenue(const LoopbackVenue&) = delete;
+    LoopbackVenue& operator=(const LoopbackVenue&) = delete;
+
+    /// Listen and start the venue thread (pinned to core unless -1)
+    /// @return Port to connect to, 0 if listen failed
+    uint16_t start(size_t sessions, int core = -1) {
+        if (!acceptor_.listen(0)) return 0;
+        thread_ = std::thread{[this, sessions, core] { run(sessions, core); }};
+        return acceptor_.local_port();
+    }
+
+    /// Stop serving and join (connections not yet accepted are dropped)
+    void stop() {
+        stop_.store(true, std::memory_order_relaxed);
+        if (thread_.joinable()) thread_.join();
+    }
+
+    /// ExecutionReports sent (valid after stop())
+    [[nodiscard]] uint64_t acks() const noexcept { return acks_; }
+
+private:
+    void run(size_t sessions, int core) {
+        if (core >= 0) (void)util::CpuAffinity::pin_to_core(core);
+
+        std::vector<std::unique_ptr<VenueSession>> venues;
+        std::vector<bool> alive;
+        venues.reserve(sessions);
+        size_t open = 0;
+        while (!stop_.load(std::memory_order_relaxed)) {
+            // Keep serving the sessions already logged on while the rest connect
+            if (venues.size() < sessions) {
+                pollfd pfd{acceptor_.fd(), POLLIN, 0};
+                if (::poll(&pfd, 1, venues.empty() ? 10 : 0) > 0) {
+                    if (auto fd = acceptor_.accept()) {
+                        TcpSocket socket;
+                        socket.adopt(*fd);
+                        (void)socket.set_nodelay(true);
+                        venues.push_back(std::make_unique<VenueSession>(sender_comp_id_, std::move(socket)));
+                        alive.push_back(true);
+                        ++open;
+                    }
+                }
+            } else if (open == 0) {
+                break;
+            }
+            for (size_t i = 0; i < venues.size(); ++i) {
+                if (alive[i] && !venues[i]->poll()) {
+                    alive[i] = false;
+                    --open;
+                }
+            }
+        }
+        for (const auto& v : venues) acks_ += v->acks();
+    }
+
+    std::string_view sender_comp_id_;
+    TcpAcceptor acceptor_;
+    std::thread thread_;
+    std::atomic<bool> stop_{false};
+    uint64_t acks_{0};
+};
+
+} // namespace nfx::bench
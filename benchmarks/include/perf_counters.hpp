@@ -7,10 +7,15 @@
     - Cache misses (L1, LLC)
     - Branch misses
     - TLB misses
+
+    Event definitions live in nexusfix/util/perf_counters.hpp, which also
+    provides the rdpmc-based per-thread groups used at runtime.
 */
 
 #pragma once
 
+#include "nexusfix/util/perf_counters.hpp"
+
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -28,51 +33,11 @@
 namespace nfx::bench {
 
 // ============================================================================
-// Performance Event Types
+// Performance Event Types (shared with the runtime counters)
 // ============================================================================
 
-enum class PerfEvent : uint32_t {
-    // Hardware events
-    CpuCycles,
-    Instructions,
-    CacheReferences,
-    CacheMisses,
-    BranchInstructions,
-    BranchMisses,
-
-    // Cache events
-    L1dReadMiss,
-    L1dWriteMiss,
-    L1iReadMiss,
-    LLCReadMiss,
-    LLCWriteMiss,
-
-    // TLB events
-    DTlbReadMiss,
-    DTlbWriteMiss,
-    ITlbReadMiss
-};
-
-/// Get human-readable name for event
-[[nodiscard]] inline const char* event_name(PerfEvent event) noexcept {
-    switch (event) {
-        case PerfEvent::CpuCycles:          return "cpu-cycles";
-        case PerfEvent::Instructions:       return "instructions";
-        case PerfEvent::CacheReferences:    return "cache-references";
-        case PerfEvent::CacheMisses:        return "cache-misses";
-        case PerfEvent::BranchInstructions: return "branch-instructions";
-        case PerfEvent::BranchMisses:       return "branch-misses";
-        case PerfEvent::L1dReadMiss:        return "L1-dcache-read-misses";
-        case PerfEvent::L1dWriteMiss:       return "L1-dcache-write-misses";
-        case PerfEvent::L1iReadMiss:        return "L1-icache-read-misses";
-        case PerfEvent::LLCReadMiss:        return "LLC-read-misses";
-        case PerfEvent::LLCWriteMiss:       return "LLC-write-misses";
-        case PerfEvent::DTlbReadMiss:       return "dTLB-read-misses";
-        case PerfEvent::DTlbWriteMiss:      return "dTLB-write-misses";
-        case PerfEvent::ITlbReadMiss:       return "iTLB-read-misses";
-    }
-    return "unknown";
-}
+using util::PerfEvent;
+using util::event_name;
 
 // ============================================================================
 // Performance Counter Results
@@ -214,83 +179,7 @@ public:
 
 private:
     bool configure_event(PerfEvent event, perf_event_attr& attr) {
-        switch (event) {
-            case PerfEvent::CpuCycles:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_CPU_CYCLES;
-                break;
-            case PerfEvent::Instructions:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
-                break;
-            case PerfEvent::CacheReferences:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_CACHE_REFERENCES;
-                break;
-            case PerfEvent::CacheMisses:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_CACHE_MISSES;
-                break;
-            case PerfEvent::BranchInstructions:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
-                break;
-            case PerfEvent::BranchMisses:
-                attr.type = PERF_TYPE_HARDWARE;
-                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
-                break;
-            case PerfEvent::L1dReadMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_L1D |
-                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::L1dWriteMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_L1D |
-                             (PERF_COUNT_HW_CACHE_OP_WRITE << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::L1iReadMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_L1I |
-                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::LLCReadMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_LL |
-                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::LLCWriteMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_LL |
-                             (PERF_COUNT_HW_CACHE_OP_WRITE << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::DTlbReadMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_DTLB |
-                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::DTlbWriteMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_DTLB |
-                             (PERF_COUNT_HW_CACHE_OP_WRITE << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            case PerfEvent::ITlbReadMiss:
-                attr.type = PERF_TYPE_HW_CACHE;
-                attr.config = PERF_COUNT_HW_CACHE_ITLB |
-                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
-                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
-                break;
-            default:
-                return false;
-        }
-        return true;
+        return util::detail::configure_perf_event(event, attr);
     }
 
     std::vector<int> fds_;
@@ -0,0 +1,146 @@
+// Benchmark: io_uring Reactor
+// Many ping-pong sessions multiplexed on one ring and one thread
+//
+// Build: cmake --build build && ./build/bin/benchmarks/io_uring_reactor_bench [sessions]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "nexusfix/transport/io_uring_reactor.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#if !NFX_IO_URING_AVAILABLE
+
+int main() {
+    std::cout << "io_uring not available on this system.\n";
+    return 0;
+}
+
+#else
+
+constexpr int ROUND_TRIPS_PER_SESSION = 2000;
+constexpr uint32_t TIMER_INTERVAL_MS = 10;
+
+std::string make_heartbeat() {
+    std::string body = "35=0\x01" "49=CLIENT\x01" "56=BROKER\x01" "34=1\x01"
+                       "52=20240102-09:30:00.000\x01";
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+    auto cs = nfx::fix::format_checksum(nfx::fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+/// Sends a message, waits for the echo, repeats
+struct PingSession final : nfx::IReactorHandler {
+    nfx::IoUringReactor* reactor{nullptr};
+    nfx::IoUringReactor::ChannelId id{nfx::IoUringReactor::INVALID_CHANNEL};
+    const std::string* message{nullptr};
+    int remaining{ROUND_TRIPS_PER_SESSION};
+    int* sessions_done{nullptr};
+    uint64_t timer_fires{0};
+
+    void on_connected() noexcept override {}
+    void on_message(std::span<const char>) noexcept override {
+        if (--remaining == 0) {
+            ++*sessions_done;
+            return;
+        }
+        ping();
+    }
+    void on_timer() noexcept override { ++timer_fires; }
+    void on_closed(const nfx::TransportError&) noexcept override {}
+
+    void ping() noexcept {
+        (void)reactor->send(id, std::span<const char>{message->data(), message->size()});
+    }
+};
+
+/// Echoes every message back
+struct EchoSession final : nfx::IReactorHandler {
+    nfx::IoUringReactor* reactor{nullptr};
+    nfx::IoUringReactor::ChannelId id{nfx::IoUringReactor::INVALID_CHANNEL};
+
+    void on_connected() noexcept override {}
+    void on_message(std::span<const char> message) noexcept override {
+        (void)reactor->send(id, message);
+    }
+    void on_timer() noexcept override {}
+    void on_closed(const nfx::TransportError&) noexcept override {}
+};
+
+int main(int argc, char** argv) {
+    const int num_sessions = argc > 1 ? std::atoi(argv[1]) : 200;
+    (void)nfx::util::CpuAffinity::pin_to_core(1);
+
+    nfx::IoUringReactorConfig config;
+    config.max_channels = static_cast<uint32_t>(num_sessions * 2);
+    config.queue_depth = 4096;
+    config.num_recv_buffers = 4096;
+    nfx::IoUringReactor reactor{config};
+    if (auto result = reactor.init(); !result) {
+        std::cout << "Reactor init failed (errno " << result.error().system_errno << ")\n";
+        return 1;
+    }
+
+    const std::string message = make_heartbeat();
+    int sessions_done = 0;
+    std::vector<std::unique_ptr<PingSession>> pings;
+    std::vector<std::unique_ptr<EchoSession>> echoes;
+
+    for (int i = 0; i < num_sessions; ++i) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0) return 1;
+
+        auto ping = std::make_unique<PingSession>();
+        ping->reactor = &reactor;
+        ping->message = &message;
+        ping->sessions_done = &sessions_done;
+        auto echo = std::make_unique<EchoSession>();
+        echo->reactor = &reactor;
+
+        auto ping_id = reactor.attach(fds[0], *ping);
+        auto echo_id = reactor.attach(fds[1], *echo);
+        if (!ping_id || !echo_id) return 1;
+        ping->id = *ping_id;
+        echo->id = *echo_id;
+        reactor.set_timer(ping->id, TIMER_INTERVAL_MS);
+
+        pings.push_back(std::move(ping));
+        echoes.push_back(std::move(echo));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto& ping : pings) ping->ping();
+    while (sessions_done < num_sessions) (void)reactor.run_once(100);
+    auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double round_trips = static_cast<double>(num_sessions) * ROUND_TRIPS_PER_SESSION;
+    uint64_t timer_fires = 0;
+    for (const auto& ping : pings) timer_fires += ping->timer_fires;
+    const auto& stats = reactor.stats();
+
+    std::cout << "=== io_uring Reactor: " << num_sessions << " sessions, one thread ===\n"
+              << std::fixed << std::setprecision(2)
+              << "  Round trips:      " << round_trips / seconds << " /sec\n"
+              << "  Messages:         " << stats.messages / seconds << " /sec\n"
+              << "  Completions/msg:  "
+              << static_cast<double>(stats.completions) / static_cast<double>(stats.messages) << "\n"
+              << "  Timer fires:      " << timer_fires << " (" << TIMER_INTERVAL_MS << " ms interval)\n"
+              << "  Stale CQEs:       " << stats.stale_completions << "\n";
+
+    for (auto& ping : pings) reactor.close(ping->id);
+    for (auto& echo : echoes) reactor.close(echo->id);
+    while (reactor.channel_count() > 0) (void)reactor.run_once(100);
+    return 0;
+}
+
+#endif  // NFX_IO_URING_AVAILABLE
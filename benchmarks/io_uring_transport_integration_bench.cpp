@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <numeric>
@@ -375,6 +376,43 @@ BenchmarkStats bench_batched_fixed(nfx::IoUringContext& ctx, nfx::RegisteredBuff
     return compute_stats(latencies, cpu_freq_ghz);
 }
 
+// Submit latency: cost of handing one write to the kernel (submit() alone),
+// and the full write round trip including its completion
+struct SubmitStats {
+    BenchmarkStats submit;
+    BenchmarkStats round_trip;
+};
+
+SubmitStats bench_submit_latency(nfx::IoUringContext& ctx, int efd, double cpu_freq_ghz) {
+    std::vector<uint64_t> submit_latencies;
+    std::vector<uint64_t> round_trips;
+    submit_latencies.reserve(BENCHMARK_ITERATIONS);
+    round_trips.reserve(BENCHMARK_ITERATIONS);
+
+    uint64_t write_val = 1;
+    uint64_t drain = 0;
+    for (int i = 0; i < WARMUP_ITERATIONS + BENCHMARK_ITERATIONS; ++i) {
+        uint64_t start = rdtsc();
+        auto* sqe = ctx.get_sqe();
+        io_uring_prep_write(sqe, efd, &write_val, sizeof(write_val), 0);
+        ctx.submit();
+        uint64_t submitted = rdtsc();
+
+        struct io_uring_cqe* cqe;
+        ctx.wait(&cqe);
+        ctx.seen(cqe);
+        uint64_t end = rdtsc();
+
+        (void)::read(efd, &drain, sizeof(drain));
+        if (i >= WARMUP_ITERATIONS) {
+            submit_latencies.push_back(submitted - start);
+            round_trips.push_back(end - start);
+        }
+    }
+
+    return {compute_stats(submit_latencies, cpu_freq_ghz), compute_stats(round_trips, cpu_freq_ghz)};
+}
+
 int main() {
     using namespace nfx;
 
@@ -417,7 +455,7 @@ int main() {
     }
 
     // Create eventfd for testing
-    int efd = eventfd(0, EFD_NONBLOCK);
+    int efd = eventfd(0, EFD_NONBLOCK | EFD_SEMAPHORE);
     if (efd < 0) {
         std::cerr << "Failed to create eventfd\n";
         return 1;
@@ -479,6 +517,34 @@ int main() {
                   << std::fixed << std::setprecision(1) << batch_improvement << "%\n";
     }
 
+    // ========================================================================
+    // SQPOLL vs DEFER_TASKRUN
+    // ========================================================================
+
+    std::cout << "\n  " << std::string(80, '-') << "\n";
+    std::cout << "  Submit latency: SQPOLL vs DEFER_TASKRUN\n";
+    std::cout << "  " << std::string(80, '-') << "\n";
+
+    // Poller on a reserved core, away from this thread's core 2
+    auto affinity = util::CpuAffinityConfig::default_config();
+    std::erase(affinity.allowed_cores, 2);
+    const SqPollConfig sqpoll{.enabled = true, .cpu = affinity.reserve_core(), .idle_ms = 2000};
+
+    IoUringContext ctx_sqpoll;
+    if (ctx_sqpoll.init(IoUringContext::QUEUE_DEPTH, sqpoll).has_value() && ctx_sqpoll.is_sqpoll()) {
+        auto taskrun = bench_submit_latency(ctx, efd, cpu_freq_ghz);
+        auto polled = bench_submit_latency(ctx_sqpoll, efd, cpu_freq_ghz);
+        print_stats(ctx.is_optimized() ? "DEFER_TASKRUN submit" : "Default submit", taskrun.submit);
+        print_stats("SQPOLL submit", polled.submit);
+        print_stats(ctx.is_optimized() ? "DEFER_TASKRUN write RTT" : "Default write RTT",
+                    taskrun.round_trip);
+        print_stats("SQPOLL write RTT", polled.round_trip);
+        std::cout << "\n  SQPOLL poller core: "
+                  << (sqpoll.cpu >= 0 ? std::to_string(sqpoll.cpu) : std::string{"unpinned"}) << "\n";
+    } else {
+        std::cout << "  SQPOLL unavailable (kernel or permissions); skipped\n";
+    }
+
     // ========================================================================
     // IoUringTransport Integration Test
     // ========================================================================
@@ -0,0 +1,667 @@
+// jitter_bench.cpp
+// Tail-latency jitter with OS noise attribution
+//
+// The p99.99 of a tight hot loop is rarely the code: it is the timer tick,
+// a device interrupt routed to the core, an SMI, a page fault, the
+// scheduler, or a frequency change. This benchmark runs a parse + build
+// loop (ExecutionReport parse, OrderTemplate render) pinned to one core
+// and timestamps every iteration back to back, so no stall goes unseen.
+// Iterations slower than a threshold are kept as outliers.
+//
+// A monitor thread on another core samples, every window:
+//   /proc/interrupts                 per-line counts for the measured core
+//   /proc/self/task/<tid>/stat       minor/major page faults of the loop
+//   /proc/self/task/<tid>/status     voluntary/involuntary context switches
+//   /dev/cpu/N/msr (0x34)            SMI count (root and the msr module)
+//   cpufreq/scaling_cur_freq         core frequency
+// and every outlier is attributed to what changed in the windows it
+// overlaps. The lift column compares outlier windows with all windows: a
+// cause present in every window (e.g. the local timer without nohz_full)
+// has lift 1 and explains little on its own; a large lift is a culprit.
+//
+// The setup section reports what cpu_affinity.hpp / memory_lock.hpp
+// settings are in force (pinning, isolcpus, nohz_full, governor, mlockall,
+// SCHED_FIFO) so a run doubles as a check of the host tuning.
+//
+// Usage:
+//   jitter_bench [--core=N] [--monitor-core=N] [--seconds=10] [--threshold-ns=2000]
+//                [--window-us=1000] [--lock] [--fifo] [--top=20] [--json=PATH]
+//
+// --lock calls util::lock_all_memory() and --fifo SCHED_FIFO 50 for the loop.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/serializer/order_template.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/memory_lock.hpp"
+#include "benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+namespace {
+
+// ============================================================================
+// Host Counters
+// ============================================================================
+
+/// Whole file through a descriptor kept open (pread from 0 re-reads /proc)
+class ProcFile {
+public:
+    explicit ProcFile(const std::string& path) noexcept
+        : fd_{::open(path.c_str(), O_RDONLY | O_CLOEXEC)} {}
+
+    ~ProcFile() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    ProcFile(const ProcFile&) = delete;
+    ProcFile& operator=(const ProcFile&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+    /// Contents into buffer (resized to fit); empty on error
+    std::string_view read(std::string& buffer) noexcept {
+        if (fd_ < 0) return {};
+        size_t total = 0;
+        while (true) {
+            const ssize_t n = ::pread(fd_, buffer.data() + total, buffer.size() - total,
+                                      static_cast<off_t>(total));
+            if (n <= 0) break;
+            total += static_cast<size_t>(n);
+            if (total == buffer.size()) buffer.resize(buffer.size() * 2);
+        }
+        return {buffer.data(), total};
+    }
+
+    /// Eight bytes at offset (MSR reads)
+    [[nodiscard]] bool read_u64(off_t offset, uint64_t& value) const noexcept {
+        return fd_ >= 0 && ::pread(fd_, &value, sizeof(value), offset) == sizeof(value);
+    }
+
+private:
+    int fd_;
+};
+
+[[nodiscard]] std::string read_text(const std::string& path) {
+    ProcFile file{path};
+    std::string buffer(4096, '\0');
+    std::string text{file.read(buffer)};
+    while (!text.empty() && (text.back() == '\n' || text.back() == ' ')) text.pop_back();
+    return text;
+}
+
+[[nodiscard]] uint64_t parse_u64(std::string_view s) noexcept {
+    uint64_t value = 0;
+    for (char c : s) {
+        if (c < '0' || c > '9') break;
+        value = value * 10 + static_cast<uint64_t>(c - '0');
+    }
+    return value;
+}
+
+/// Per-line interrupt counts of one CPU from /proc/interrupts
+class InterruptTable {
+public:
+    explicit InterruptTable(int cpu) : file_{"/proc/interrupts"}, buffer_(256 * 1024, '\0') {
+        const std::string_view text = file_.read(buffer_);
+        const std::string_view header = text.substr(0, text.find('\n'));
+        const std::string name = "CPU" + std::to_string(cpu);
+        size_t column = 0;
+        for (size_t at = 0; (at = header.find("CPU", at)) != std::string_view::npos; ++column) {
+            size_t end = at + 3;
+            while (end < header.size() && header[end] >= '0' && header[end] <= '9') ++end;
+            if (header.substr(at, end - at) == name) {
+                column_ = static_cast<int>(column);
+                break;
+            }
+            at = end;
+        }
+        if (column_ < 0) return;
+        parse(text, [&](std::string_view name, std::string_view what, uint64_t) {
+            std::string label{name};
+            if (!what.empty()) label.append(" ").append(what);
+            labels_.push_back(std::move(label));
+        });
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return column_ >= 0 && !labels_.empty(); }
+    [[nodiscard]] const std::vector<std::string>& labels() const noexcept { return labels_; }
+
+    /// Current counts, in labels() order, into out
+    void sample(uint64_t* out) {
+        size_t i = 0;
+        parse(file_.read(buffer_), [&](std::string_view, std::string_view, uint64_t count) {
+            if (i < labels_.size()) out[i++] = count;
+        });
+        while (i < labels_.size()) out[i++] = 0;
+    }
+
+private:
+    /// fn(name, description, count) per line with a count for the CPU column
+    template <typename Fn>
+    void parse(std::string_view text, Fn&& fn) const {
+        size_t line_start = text.find('\n');
+        while (line_start != std::string_view::npos && line_start + 1 < text.size()) {
+            const size_t line_end = std::min(text.find('\n', line_start + 1), text.size());
+            std::string_view line = text.substr(line_start + 1, line_end - line_start - 1);
+            line_start = line_end < text.size() ? line_end : std::string_view::npos;
+
+            const size_t colon = line.find(':');
+            if (colon == std::string_view::npos) continue;
+            std::string_view name = line.substr(0, colon);
+            name.remove_prefix(std::min(name.find_first_not_of(' '), name.size()));
+            std::string_view rest = line.substr(colon + 1);
+
+            uint64_t count = 0;
+            bool found = false;
+            for (int column = 0; column <= column_; ++column) {
+                rest.remove_prefix(std::min(rest.find_first_not_of(' '), rest.size()));
+                if (rest.empty() || rest[0] < '0' || rest[0] > '9') break;
+                const size_t end = std::min(rest.find(' '), rest.size());
+                if (column == column_) {
+                    count = parse_u64(rest.substr(0, end));
+                    found = true;
+                }
+                rest.remove_prefix(end);
+            }
+            if (!found) continue;
+
+            // Label: "LOC Local timer interrupts", "42 eth0-rx-3"
+            while (!rest.empty() && (rest[0] == ' ' || (rest[0] >= '0' && rest[0] <= '9'))) rest.remove_prefix(1);
+            std::string_view what = rest;
+            if (!name.empty() && name[0] >= '0' && name[0] <= '9') {
+                what = rest.substr(rest.find_last_of(' ') == std::string_view::npos ? 0 : rest.find_last_of(' ') + 1);
+            }
+            fn(name, what, count);
+        }
+    }
+
+    ProcFile file_;
+    std::string buffer_;
+    int column_{-1};
+    std::vector<std::string> labels_;
+};
+
+/// Fault and context switch counts of one thread
+class ThreadCounters {
+public:
+    explicit ThreadCounters(long tid)
+        : stat_{"/proc/self/task/" + std::to_string(tid) + "/stat"},
+          status_{"/proc/self/task/" + std::to_string(tid) + "/status"},
+          buffer_(4096, '\0') {}
+
+    struct Values {
+        uint64_t minor_faults{0};
+        uint64_t major_faults{0};
+        uint64_t voluntary_switches{0};
+        uint64_t involuntary_switches{0};
+    };
+
+    void sample(Values& out) {
+        const std::string_view stat = stat_.read(buffer_);
+        // Fields after "(comm)": state(3) ppid pgrp session tty tpgid flags minflt(10) cminflt majflt(12)
+        const size_t paren = stat.rfind(')');
+        if (paren != std::string_view::npos) {
+            std::string_view rest = stat.substr(paren + 2);
+            for (int field = 3; field <= 12 && !rest.empty(); ++field) {
+                const size_t end = std::min(rest.find(' '), rest.size());
+                if (field == 10) out.minor_faults = parse_u64(rest.substr(0, end));
+                if (field == 12) out.major_faults = parse_u64(rest.substr(0, end));
+                rest.remove_prefix(std::min(end + 1, rest.size()));
+            }
+        }
+        const std::string_view status = status_.read(buffer_);
+        out.voluntary_switches = field(status, "\nvoluntary_ctxt_switches:");
+        out.involuntary_switches = field(status, "\nnonvoluntary_ctxt_switches:");
+    }
+
+private:
+    [[nodiscard]] static uint64_t field(std::string_view text, std::string_view key) noexcept {
+        const size_t at = text.find(key);
+        if (at == std::string_view::npos) return 0;
+        std::string_view value = text.substr(at + key.size());
+        value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+        return parse_u64(value);
+    }
+
+    ProcFile stat_;
+    ProcFile status_;
+    std::string buffer_;
+};
+
+// ============================================================================
+// Samples
+// ============================================================================
+
+/// Monitor sample: host counters at tsc
+struct WindowSample {
+    uint64_t tsc;
+    ThreadCounters::Values thread;
+    uint64_t smi;
+    uint64_t freq_khz;
+};
+
+/// Iteration slower than the threshold (covers [start, start + cycles])
+struct Outlier {
+    uint64_t start;
+    uint64_t cycles;
+};
+
+enum Cause : uint8_t {
+    CAUSE_SMI, CAUSE_CONTEXT_SWITCH, CAUSE_MAJOR_FAULT, CAUSE_MINOR_FAULT,
+    CAUSE_INTERRUPT, CAUSE_FREQUENCY, CAUSE_COUNT
+};
+
+constexpr std::array<const char*, CAUSE_COUNT> CAUSE_NAMES{
+    "SMI", "context switch", "major page fault", "minor page fault", "interrupt", "frequency change"};
+
+/// What changed between two monitor samples
+struct WindowDelta {
+    std::array<uint64_t, CAUSE_COUNT> causes{};
+    std::vector<std::pair<size_t, uint64_t>> interrupts;   // (line, count)
+};
+
+struct Options {
+    int core{-1};
+    int monitor_core{-1};
+    double seconds{10.0};
+    double threshold_ns{2000.0};
+    double window_us{1000.0};
+    bool lock{false};
+    bool fifo{false};
+    size_t top{20};
+};
+
+[[nodiscard]] long current_tid() noexcept { return ::syscall(SYS_gettid); }
+
+// ============================================================================
+// Setup Report
+// ============================================================================
+
+[[nodiscard]] bool core_in_list(const std::string& list, int core) {
+    std::vector<int> cores;
+    util::CpuAffinity::parse_cpu_list(list, cores);
+    return std::find(cores.begin(), cores.end(), core) != cores.end();
+}
+
+void print_setup(const Options& opt, bool pinned, bool fifo_ok, const std::string& lock_result) {
+    const std::string cpu = "/sys/devices/system/cpu/";
+    const std::string isolated = read_text(cpu + "isolated");
+    const std::string nohz = read_text(cpu + "nohz_full");
+    const std::string governor = read_text(cpu + "cpu" + std::to_string(opt.core) + "/cpufreq/scaling_governor");
+    const std::string thp = read_text("/sys/kernel/mm/transparent_hugepage/enabled");
+
+    std::cout << "\n=== Setup ===\n";
+    std::cout << "  Measured core:   " << opt.core << (pinned ? " (pinned)" : " (NOT pinned)") << "\n";
+    std::cout << "  Monitor core:    " << opt.monitor_core
+              << (opt.monitor_core == opt.core ? "  (same core: monitor reads preempt the loop)" : "") << "\n";
+    std::cout << "  isolcpus:        " << (isolated.empty() ? "none" : isolated)
+              << (core_in_list(isolated, opt.core) ? "  (measured core isolated)" : "  (measured core shared with the scheduler)")
+              << "\n";
+    std::cout << "  nohz_full:       " << (nohz.empty() ? "none" : nohz)
+              << (core_in_list(nohz, opt.core) ? "" : "  (timer tick still runs on the measured core)") << "\n";
+    std::cout << "  Governor:        " << (governor.empty() ? "n/a" : governor) << "\n";
+    std::cout << "  Scheduling:      " << (opt.fifo ? (fifo_ok ? "SCHED_FIFO 50" : "SCHED_FIFO failed (needs CAP_SYS_NICE)")
+                                                    : "default (--fifo for SCHED_FIFO)") << "\n";
+    std::cout << "  Memory lock:     " << lock_result << " (RLIMIT_MEMLOCK "
+              << (util::get_memlock_limit() == RLIM_INFINITY ? std::string{"unlimited"}
+                                                             : std::to_string(util::get_memlock_limit() / 1024) + " KiB")
+              << ")\n";
+    std::cout << "  THP:             " << (thp.empty() ? "n/a" : thp) << "\n";
+}
+
+// ============================================================================
+// Hot Loop
+// ============================================================================
+
+struct LoopResult {
+    LatencyHistogram histogram;
+    uint64_t min_cycles{UINT64_MAX};
+    uint64_t outliers_dropped{0};
+    uint64_t first_tsc{0};
+    uint64_t last_tsc{0};
+};
+
+/// Parse + build until stop; every iteration timed back to back
+void hot_loop(const std::atomic<bool>& stop, uint64_t threshold_cycles,
+              std::vector<Outlier>& outliers, LoopResult& result) {
+    std::string exec = "8=FIX.4.4\x01" "9=000\x01" "35=8\x01" "49=BROKER\x01" "56=CLIENT\x01" "34=42\x01"
+                       "52=20240102-09:30:00.123\x01" "37=O1\x01" "11=C1\x01" "17=E1\x01" "150=F\x01" "39=2\x01"
+                       "55=AAPL\x01" "54=1\x01" "38=100\x01" "44=150.25\x01" "32=100\x01" "31=150.25\x01"
+                       "151=0\x01" "14=100\x01" "6=150.25\x01" "60=20240102-09:30:00.123\x01";
+    const size_t body_start = exec.find("35=");
+    const std::string body_len = std::to_string(exec.size() - body_start);
+    exec.replace(exec.find("9=000") + 2, 3, std::string(3 - body_len.size(), '0') + body_len);
+    const auto cs = fix::format_checksum(fix::calculate_checksum(std::span<const char>{exec.data(), exec.size()}));
+    exec += "10=" + std::string{cs.data(), 3} + "\x01";
+    const std::span<const char> inbound{exec.data(), exec.size()};
+
+    serializer::OrderTemplateFields fields;
+    fields.sender_comp_id = "CLIENT";
+    fields.target_comp_id = "BROKER";
+    fields.symbol = "AAPL";
+    fields.cl_ord_id_prefix = "NFX";
+    serializer::OrderTemplate<> order{fields};
+
+    uint32_t seq = 1;
+    uint64_t prev = rdtsc();
+    result.first_tsc = prev;
+    while (!stop.load(std::memory_order_relaxed)) {
+        auto parsed = ParsedMessage::parse(inbound);
+        asm volatile("" :: "r"(&parsed) : "memory");
+        auto out = order.render(seq, seq, FixedPrice{15025000000LL + (seq & 1023)}, Qty::from_int(100),
+                                "20240102-09:30:00.123");
+        asm volatile("" :: "r"(out.data()) : "memory");
+        ++seq;
+
+        const uint64_t now = rdtsc();
+        const uint64_t cycles = now - prev;
+        result.histogram.record(cycles);
+        if (cycles < result.min_cycles) result.min_cycles = cycles;
+        if (cycles > threshold_cycles) [[unlikely]] {
+            if (outliers.size() < outliers.capacity()) outliers.push_back({prev, cycles});
+            else ++result.outliers_dropped;
+        }
+        prev = now;
+    }
+    result.last_tsc = prev;
+}
+
+// ============================================================================
+// Attribution
+// ============================================================================
+
+[[nodiscard]] WindowDelta window_delta(const std::vector<WindowSample>& windows,
+                                       const std::vector<uint64_t>& irq_counts, size_t lines,
+                                       size_t first, size_t last, uint64_t base_freq) {
+    WindowDelta d;
+    const WindowSample& a = windows[first];
+    const WindowSample& b = windows[last];
+    d.causes[CAUSE_SMI] = b.smi - a.smi;
+    d.causes[CAUSE_CONTEXT_SWITCH] = (b.thread.voluntary_switches - a.thread.voluntary_switches) +
+                                     (b.thread.involuntary_switches - a.thread.involuntary_switches);
+    d.causes[CAUSE_MAJOR_FAULT] = b.thread.major_faults - a.thread.major_faults;
+    d.causes[CAUSE_MINOR_FAULT] = b.thread.minor_faults - a.thread.minor_faults;
+    for (size_t line = 0; line < lines; ++line) {
+        const uint64_t n = irq_counts[last * lines + line] - irq_counts[first * lines + line];
+        if (n) {
+            d.interrupts.emplace_back(line, n);
+            d.causes[CAUSE_INTERRUPT] += n;
+        }
+    }
+    for (size_t w = first; w <= last; ++w) {
+        const uint64_t f = windows[w].freq_khz;
+        if (base_freq && f && (f * 100 < base_freq * 98 || f * 100 > base_freq * 102)) d.causes[CAUSE_FREQUENCY] = 1;
+    }
+    return d;
+}
+
+[[nodiscard]] std::string describe(const WindowDelta& d, const std::vector<std::string>& labels) {
+    std::ostringstream out;
+    for (size_t c = 0; c < CAUSE_COUNT; ++c) {
+        if (!d.causes[c] || c == CAUSE_INTERRUPT) continue;
+        out << CAUSE_NAMES[c];
+        if (c != CAUSE_FREQUENCY) out << " x" << d.causes[c];
+        out << "; ";
+    }
+    for (const auto& [line, n] : d.interrupts) out << labels[line] << " x" << n << "; ";
+    std::string text = out.str();
+    return text.empty() ? "unattributed" : text.substr(0, text.size() - 2);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const auto value = [&](std::string_view prefix) { return std::string{arg.substr(prefix.size())}; };
+        if (arg.starts_with("--core=")) opt.core = std::stoi(value("--core="));
+        else if (arg.starts_with("--monitor-core=")) opt.monitor_core = std::stoi(value("--monitor-core="));
+        else if (arg.starts_with("--seconds=")) opt.seconds = std::stod(value("--seconds="));
+        else if (arg.starts_with("--threshold-ns=")) opt.threshold_ns = std::stod(value("--threshold-ns="));
+        else if (arg.starts_with("--window-us=")) opt.window_us = std::max(10.0, std::stod(value("--window-us=")));
+        else if (arg.starts_with("--top=")) opt.top = std::stoul(value("--top="));
+        else if (arg == "--lock") opt.lock = true;
+        else if (arg == "--fifo") opt.fifo = true;
+        else if (arg.starts_with("--json=")) continue;     // BenchReport::write_if_requested()
+        else {
+            std::cerr << "usage: " << argv[0] << " [--core=N] [--monitor-core=N] [--seconds=10]"
+                      << " [--threshold-ns=2000] [--window-us=1000] [--lock] [--fifo] [--top=20] [--json=PATH]\n";
+            return 2;
+        }
+    }
+
+    const std::vector<int> allowed = util::CpuAffinity::get_affinity();
+    if (opt.core < 0) opt.core = allowed.empty() ? 0 : allowed.back();
+    if (opt.monitor_core < 0) {
+        opt.monitor_core = opt.core;
+        for (int c : allowed) {
+            if (c != opt.core) {
+                opt.monitor_core = c;
+                break;
+            }
+        }
+    }
+
+    std::cout << "NexusFIX Jitter Benchmark\n";
+    std::cout << "=========================\n";
+    const double ghz = estimate_cpu_freq_ghz_busy();
+    const auto threshold_cycles = static_cast<uint64_t>(opt.threshold_ns * ghz);
+    std::cout << "  Loop:            ExecutionReport parse + OrderTemplate render\n";
+    std::cout << "  Duration:        " << opt.seconds << " s, window " << opt.window_us << " us\n";
+    std::cout << "  Threshold:       " << opt.threshold_ns << " ns (" << threshold_cycles << " cycles at "
+              << std::fixed << std::setprecision(3) << ghz << " GHz)\n";
+
+    std::string lock_result = "not requested (--lock)";
+    if (opt.lock) {
+        auto locked = util::lock_all_memory();
+        lock_result = locked ? std::string{"mlockall ok"} : "mlockall failed: " + std::string{locked.error().message()};
+    }
+
+    // Monitor state, sized up front so sampling never allocates
+    InterruptTable irqs{opt.core};
+    const size_t lines = irqs.valid() ? irqs.labels().size() : 0;
+    const auto max_windows = static_cast<size_t>(opt.seconds * 1e6 / opt.window_us) + 16;
+    std::vector<WindowSample> windows;
+    windows.reserve(max_windows);
+    std::vector<uint64_t> irq_counts(max_windows * lines);
+    ProcFile msr{"/dev/cpu/" + std::to_string(opt.core) + "/msr"};
+    ProcFile freq{"/sys/devices/system/cpu/cpu" + std::to_string(opt.core) + "/cpufreq/scaling_cur_freq"};
+    std::string freq_buffer(64, '\0');
+
+    std::vector<Outlier> outliers;
+    outliers.reserve(1 << 20);
+    util::prefault_memory_write(outliers.data(), outliers.capacity() * sizeof(Outlier));
+
+    std::atomic<bool> stop{false};
+    std::atomic<long> loop_tid{0};
+    bool pinned = false;
+    bool fifo_ok = false;
+    auto result = std::make_unique<LoopResult>();
+
+    std::thread loop{[&] {
+        pinned = util::CpuAffinity::pin_to_core(opt.core).success;
+        if (opt.fifo) fifo_ok = util::CpuAffinity::set_realtime_priority(50);
+        loop_tid.store(current_tid(), std::memory_order_release);
+        hot_loop(stop, threshold_cycles, outliers, *result);
+    }};
+    (void)util::CpuAffinity::pin_to_core(opt.monitor_core);
+    while (loop_tid.load(std::memory_order_acquire) == 0) std::this_thread::yield();
+    ThreadCounters thread_counters{loop_tid.load()};
+
+    const auto window = std::chrono::nanoseconds{static_cast<int64_t>(opt.window_us * 1000.0)};
+    const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds{static_cast<int64_t>(opt.seconds * 1e9)};
+    auto next = std::chrono::steady_clock::now();
+    while (windows.size() < max_windows) {
+        WindowSample s{};
+        s.tsc = rdtsc();
+        if (lines) irqs.sample(irq_counts.data() + windows.size() * lines);
+        thread_counters.sample(s.thread);
+        (void)msr.read_u64(0x34, s.smi);
+        s.freq_khz = parse_u64(freq.read(freq_buffer));
+        windows.push_back(s);
+
+        if (std::chrono::steady_clock::now() >= end) break;
+        next += window;
+        std::this_thread::sleep_until(next);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    loop.join();
+
+    print_setup(opt, pinned, fifo_ok, lock_result);
+    std::cout << "  Counters:        " << (lines ? std::to_string(lines) + " interrupt lines" : "no /proc/interrupts")
+              << ", SMI " << (msr.is_open() ? "yes" : "n/a (needs root + msr module)")
+              << ", frequency " << (freq.is_open() ? "yes" : "n/a") << "\n";
+
+    // ========================================================================
+    // Distribution
+    // ========================================================================
+
+    const LatencyHistogram& h = result->histogram;
+    const auto ns = [&](uint64_t cycles) { return static_cast<double>(cycles) / ghz; };
+    const double run_sec = ns(result->last_tsc - result->first_tsc) / 1e9;
+    std::cout << "\n=== Iteration latency (ns) ===\n";
+    std::cout << "  Iterations:  " << h.count() << " (" << std::setprecision(2)
+              << static_cast<double>(h.count()) / run_sec / 1e6 << " M/s)\n";
+    std::cout << std::setprecision(0);
+    std::cout << "  min " << ns(result->min_cycles) << "  p50 " << ns(h.percentile(50)) << "  p99 "
+              << ns(h.percentile(99)) << "  p99.9 " << ns(h.percentile(99.9)) << "  p99.99 "
+              << ns(h.percentile(99.99)) << "  max " << ns(h.max()) << "\n";
+
+    BenchResult r;
+    r.name = "parse+build iteration";
+    r.samples = h.count();
+    r.min_ns = ns(result->min_cycles);
+    r.p25_ns = ns(h.percentile(25));
+    r.median_ns = ns(h.percentile(50));
+    r.p75_ns = ns(h.percentile(75));
+    r.p90_ns = ns(h.percentile(90));
+    r.p99_ns = ns(h.percentile(99));
+    r.p999_ns = ns(h.percentile(99.9));
+    r.max_ns = ns(h.max());
+    r.mean_ns = h.mean() / ghz;
+    BenchReport report{"jitter_bench"};
+    report.add(r);
+
+    // ========================================================================
+    // Attribution
+    // ========================================================================
+
+    std::cout << "\n=== Outliers > " << opt.threshold_ns << " ns ===\n";
+    std::cout << "  Count:       " << outliers.size() << std::setprecision(1) << " ("
+              << static_cast<double>(outliers.size()) / run_sec << "/s)";
+    if (result->outliers_dropped) std::cout << ", " << result->outliers_dropped << " more not recorded";
+    std::cout << "\n";
+    if (windows.size() < 2 || outliers.empty()) return report.write_if_requested(argc, argv) ? 0 : 1;
+
+    std::vector<uint64_t> freqs;
+    for (const auto& w : windows) if (w.freq_khz) freqs.push_back(w.freq_khz);
+    std::sort(freqs.begin(), freqs.end());
+    const uint64_t base_freq = freqs.empty() ? 0 : freqs[freqs.size() / 2];
+
+    // Baseline: how often each cause shows up in any window
+    std::array<uint64_t, CAUSE_COUNT> windows_with{};
+    std::vector<uint64_t> irq_all(lines);
+    for (size_t w = 0; w + 1 < windows.size(); ++w) {
+        const WindowDelta d = window_delta(windows, irq_counts, lines, w, w + 1, base_freq);
+        for (size_t c = 0; c < CAUSE_COUNT; ++c) windows_with[c] += d.causes[c] != 0;
+        for (const auto& [line, n] : d.interrupts) irq_all[line] += n;
+    }
+    const auto total_windows = static_cast<double>(windows.size() - 1);
+
+    std::array<uint64_t, CAUSE_COUNT> outliers_with{};
+    std::array<uint64_t, CAUSE_COUNT + 1> primary{};            // Last slot: unattributed
+    std::vector<uint8_t> outlier_window(windows.size());       // Window w: samples w .. w + 1
+    std::vector<std::pair<const Outlier*, std::string>> described;
+    for (const Outlier& o : outliers) {
+        // Windows overlapping [start, start + cycles]
+        auto after = std::upper_bound(windows.begin(), windows.end(), o.start,
+                                      [](uint64_t t, const WindowSample& w) { return t < w.tsc; });
+        if (after == windows.begin() || after == windows.end()) {
+            ++primary[CAUSE_COUNT];
+            continue;
+        }
+        const auto first = static_cast<size_t>(after - windows.begin()) - 1;
+        size_t last = first + 1;
+        while (last + 1 < windows.size() && windows[last].tsc < o.start + o.cycles) ++last;
+
+        const WindowDelta d = window_delta(windows, irq_counts, lines, first, last, base_freq);
+        size_t cause = CAUSE_COUNT;
+        for (size_t c = 0; c < CAUSE_COUNT; ++c) {
+            if (!d.causes[c]) continue;
+            ++outliers_with[c];
+            if (cause == CAUSE_COUNT) cause = c;
+        }
+        ++primary[cause];
+        std::fill(outlier_window.begin() + static_cast<std::ptrdiff_t>(first),
+                  outlier_window.begin() + static_cast<std::ptrdiff_t>(last), uint8_t{1});
+        described.emplace_back(&o, describe(d, irqs.labels()));
+    }
+
+    const auto n_outliers = static_cast<double>(outliers.size());
+    std::cout << "\n  " << std::left << std::setw(20) << "Cause" << std::right << std::setw(10) << "primary"
+              << std::setw(14) << "in window" << std::setw(14) << "all windows" << std::setw(8) << "lift" << "\n";
+    for (size_t c = 0; c <= CAUSE_COUNT; ++c) {
+        std::cout << "  " << std::left << std::setw(20) << (c < CAUSE_COUNT ? CAUSE_NAMES[c] : "unattributed")
+                  << std::right << std::setw(10) << primary[c];
+        if (c < CAUSE_COUNT) {
+            const double in_outliers = static_cast<double>(outliers_with[c]) / n_outliers;
+            const double in_all = static_cast<double>(windows_with[c]) / total_windows;
+            std::cout << std::setw(13) << in_outliers * 100.0 << "%" << std::setw(13) << in_all * 100.0 << "%";
+            if (in_all > 0.0) std::cout << std::setw(8) << in_outliers / in_all;
+            else if (in_outliers > 0.0) std::cout << std::setw(8) << "inf";
+        }
+        std::cout << "\n";
+    }
+
+    if (lines) {
+        std::vector<uint64_t> irq_outlier(lines);
+        for (size_t w = 0; w + 1 < windows.size(); ++w) {
+            if (!outlier_window[w]) continue;
+            for (size_t line = 0; line < lines; ++line) {
+                irq_outlier[line] += irq_counts[(w + 1) * lines + line] - irq_counts[w * lines + line];
+            }
+        }
+        std::vector<size_t> order(lines);
+        for (size_t i = 0; i < lines; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return irq_outlier[a] > irq_outlier[b]; });
+        std::cout << "\n  Interrupts on core " << opt.core << " (in outlier windows / whole run):\n";
+        for (size_t i = 0; i < std::min<size_t>(order.size(), 8) && irq_outlier[order[i]]; ++i) {
+            std::cout << "    " << std::left << std::setw(40) << irqs.labels()[order[i]].substr(0, 39) << std::right
+                      << std::setw(10) << irq_outlier[order[i]] << " / " << irq_all[order[i]] << "\n";
+        }
+    }
+
+    std::sort(described.begin(), described.end(),
+              [](const auto& a, const auto& b) { return a.first->cycles > b.first->cycles; });
+    std::cout << "\n  Worst outliers:\n";
+    std::cout << "    " << std::setw(10) << "t+ms" << std::setw(10) << "us" << "  cause\n";
+    for (size_t i = 0; i < std::min(opt.top, described.size()); ++i) {
+        const Outlier& o = *described[i].first;
+        std::cout << "    " << std::setprecision(3) << std::setw(10) << ns(o.start - result->first_tsc) / 1e6
+                  << std::setprecision(1) << std::setw(10) << ns(o.cycles) / 1e3 << "  " << described[i].second << "\n";
+    }
+
+    return report.write_if_requested(argc, argv) ? 0 : 1;
+}
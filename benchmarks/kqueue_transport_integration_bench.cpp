@@ -0,0 +1,221 @@
+// Benchmark: kqueue Transport Integration
+// Many FIX sessions on one thread: blocking TcpTransport vs KqueueTransport
+// sharing one kqueue (batched change lists, edge-triggered reads)
+//
+// Build: cmake --build build && ./build/bin/benchmarks/kqueue_transport_integration_bench [sessions]
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
+
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/transport/kqueue_transport.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+
+#if !NFX_KQUEUE_AVAILABLE
+
+int main() {
+    std::cout << "kqueue not available on this system.\n";
+    return 0;
+}
+
+#else
+
+constexpr int ROUNDS = 5000;
+constexpr int WARMUP_ROUNDS = 200;
+
+std::string make_heartbeat() {
+    std::string body = "35=0\x01" "49=CLIENT\x01" "56=BROKER\x01" "34=1\x01"
+                       "52=20240102-09:30:00.000\x01";
+    std::string msg = "8=FIX.4.4\x01" "9=";
+    msg += std::to_string(body.size());
+    msg += "\x01";
+    msg += body;
+    auto cs = nfx::fix::format_checksum(nfx::fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    msg += "10=";
+    msg += std::string{cs.data(), 3};
+    msg += "\x01";
+    return msg;
+}
+
+/// Loopback listener on an ephemeral port
+struct Listener {
+    nfx::TcpAcceptor acceptor;
+    uint16_t port{0};
+
+    bool open() {
+        if (!acceptor.listen(0)) return false;
+        struct sockaddr_in addr{};
+        nfx::SocketLength len = sizeof(addr);
+        if (::getsockname(acceptor.fd(), reinterpret_cast<struct sockaddr*>(&addr), &len) != 0) {
+            return false;
+        }
+        port = ntohs(addr.sin_port);
+        return true;
+    }
+};
+
+/// Blocking echo of exactly n bytes on a raw socket
+bool echo(int fd, size_t n) {
+    char buf[512];
+    size_t got = 0;
+    while (got < n) {
+        ssize_t r = ::recv(fd, buf + got, n - got, 0);
+        if (r <= 0) return false;
+        got += static_cast<size_t>(r);
+    }
+    return ::send(fd, buf, n, 0) == static_cast<ssize_t>(n);
+}
+
+bool receive_exact(nfx::ITransport& t, size_t n) {
+    char buf[512];
+    size_t got = 0;
+    while (got < n) {
+        auto r = t.receive(std::span<char>{buf + got, n - got});
+        if (!r || *r == 0) return false;
+        got += *r;
+    }
+    return true;
+}
+
+struct Result {
+    bool ok{false};
+    double round_trips_per_sec{0};
+    double ns_per_round_trip{0};
+};
+
+/// Round-robin ping-pong: every session sends, the echo side answers,
+/// then every session reads its echo
+Result run(std::vector<std::unique_ptr<nfx::ITransport>>& clients,
+           const std::vector<int>& servers, const std::string& message) {
+    const std::span<const char> out{message.data(), message.size()};
+    auto round = [&]() {
+        for (auto& c : clients) {
+            if (auto r = c->send(out); !r || *r != out.size()) return false;
+        }
+        for (int fd : servers) {
+            if (!echo(fd, out.size())) return false;
+        }
+        for (auto& c : clients) {
+            if (!receive_exact(*c, out.size())) return false;
+        }
+        return true;
+    };
+
+    Result r;
+    for (int i = 0; i < WARMUP_ROUNDS; ++i) {
+        if (!round()) return r;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROUNDS; ++i) {
+        if (!round()) return r;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double trips = static_cast<double>(ROUNDS) * static_cast<double>(clients.size());
+    r.ok = true;
+    r.round_trips_per_sec = trips / seconds;
+    r.ns_per_round_trip = seconds * 1e9 / trips;
+    return r;
+}
+
+/// Connect n clients made by make_client and accept their server ends
+template <typename MakeClient>
+bool connect_sessions(int n, Listener& listener, MakeClient&& make_client,
+                      std::vector<std::unique_ptr<nfx::ITransport>>& clients,
+                      std::vector<int>& servers) {
+    for (int i = 0; i < n; ++i) {
+        auto client = make_client();
+        if (!client->connect("127.0.0.1", listener.port)) return false;
+        auto fd = listener.acceptor.accept();
+        if (!fd) return false;
+        (void)nfx::set_tcp_nodelay(*fd, true);
+        clients.push_back(std::move(client));
+        servers.push_back(*fd);
+    }
+    return true;
+}
+
+void print_result(const char* name, const Result& r) {
+    std::cout << "  " << std::left << std::setw(18) << name << std::right;
+    if (!r.ok) {
+        std::cout << "failed\n";
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(0) << std::setw(12) << r.round_trips_per_sec
+              << " round trips/s  " << std::setprecision(1) << std::setw(8)
+              << r.ns_per_round_trip << " ns each\n";
+}
+
+int main(int argc, char** argv) {
+    const int num_sessions = argc > 1 ? std::atoi(argv[1]) : 32;
+    const std::string message = make_heartbeat();
+
+    std::cout << "==========================================================\n";
+    std::cout << "  kqueue Transport Integration: " << num_sessions << " sessions, one thread\n";
+    std::cout << "==========================================================\n\n";
+
+    Listener listener;
+    if (!listener.open()) {
+        std::cerr << "Failed to open loopback listener\n";
+        return 1;
+    }
+
+    // Blocking POSIX transport
+    Result tcp;
+    {
+        std::vector<std::unique_ptr<nfx::ITransport>> clients;
+        std::vector<int> servers;
+        if (connect_sessions(num_sessions, listener,
+                             [] { return std::make_unique<nfx::TcpTransport>(); },
+                             clients, servers)) {
+            tcp = run(clients, servers, message);
+        }
+        for (int fd : servers) ::close(fd);
+    }
+
+    // kqueue transport, all sessions on one kqueue
+    Result kq;
+    nfx::KqueueStats stats;
+    {
+        nfx::KqueueContext ctx;
+        if (!ctx.init()) {
+            std::cerr << "kqueue() failed\n";
+            return 1;
+        }
+        std::vector<std::unique_ptr<nfx::ITransport>> clients;
+        std::vector<int> servers;
+        if (connect_sessions(num_sessions, listener,
+                             [&ctx] { return std::make_unique<nfx::KqueueTransport>(ctx); },
+                             clients, servers)) {
+            kq = run(clients, servers, message);
+        }
+        stats = ctx.stats();
+        for (int fd : servers) ::close(fd);
+    }
+
+    print_result("TcpTransport:", tcp);
+    print_result("KqueueTransport:", kq);
+    if (kq.ok) {
+        const double trips = static_cast<double>(ROUNDS + WARMUP_ROUNDS) * num_sessions;
+        std::cout << "\n  kevent() calls per round trip: " << std::setprecision(3)
+                  << static_cast<double>(stats.kevent_calls) / trips << "\n"
+                  << "  Events per kevent() call:      "
+                  << static_cast<double>(stats.events) / static_cast<double>(stats.kevent_calls)
+                  << "\n"
+                  << "  Change-list entries flushed:   " << stats.changes << "\n";
+    }
+    if (tcp.ok && kq.ok) {
+        std::cout << "\n  Speedup: " << std::setprecision(2)
+                  << kq.round_trips_per_sec / tcp.round_trips_per_sec << "x\n";
+    }
+    return 0;
+}
+
+#endif  // NFX_KQUEUE_AVAILABLE
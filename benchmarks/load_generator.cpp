@@ -0,0 +1,644 @@
+// load_generator.cpp
+// Open-loop FIX load generator
+//
+// Drives one or more initiator sessions against a target acceptor at a
+// configured message rate, independent of how fast the target answers.
+// Closed-loop benchmarks send the next message only after the previous
+// one is done, so a slow target simply receives less load and its queueing
+// never shows. Here every message has a scheduled send time (constant
+// spacing or Poisson arrivals), and each order's response latency is taken
+// from that scheduled time: if the driver or the target falls behind, the
+// backlog shows up in the latency instead of in a lower send rate.
+//
+// Messages come from templates: by default one built-in message per type,
+// or every 35=D/F/G/8/W/X message of a captured FIX log. The mix follows
+// the capture's type frequencies unless --mix overrides it. Orders
+// (D/F/G) get a fresh ClOrdID (F/G an OrigClOrdID naming the previous
+// order) and are matched to the ExecutionReport echoing it; 8/W/X are sent
+// as-is and expect no response.
+//
+// Without --target an in-process loopback venue (LoopbackVenue) acks
+// every order, which measures the generator and the session layer alone.
+//
+// Usage:
+//   load_generator [--option=value ...]
+//     --target=HOST:PORT      Acceptor to drive (default: in-process venue)
+//     --sessions=N            Connections, SenderCompID PREFIX1..PREFIXN (1)
+//     --threads=N             Driver threads; sessions are dealt round-robin (1)
+//     --rate=R                Messages per second per session (1000)
+//     --arrivals=constant|poisson                                 (constant)
+//     --duration=S            Measured seconds (10)
+//     --warmup=S              Seconds sent before measuring (1)
+//     --capture=FILE          Raw FIX capture ('|' accepted for SOH)
+//     --mix=D:70,F:20,G:10    Weights per MsgType (capture frequencies, else D)
+//     --sender=PREFIX         SenderCompID prefix (LOADGEN)
+//     --target-comp=ID        TargetCompID (VENUE)
+//     --cores=a,b,...         Pin driver thread i to core i (unpinned)
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+#include "loopback_venue.hpp"
+
+using namespace nfx;
+
+namespace {
+
+// ============================================================================
+// Message Templates
+// ============================================================================
+
+inline constexpr std::array<std::string_view, 6> MIX_TYPES{"D", "F", "G", "8", "W", "X"};
+inline constexpr size_t MIX_ORDER_TYPES = 3;     // D, F, G expect an ExecutionReport
+
+[[nodiscard]] std::optional<size_t> mix_index(std::string_view msg_type) noexcept {
+    for (size_t i = 0; i < MIX_TYPES.size(); ++i) {
+        if (MIX_TYPES[i] == msg_type) return i;
+    }
+    return std::nullopt;
+}
+
+struct TemplateField {
+    int tag;
+    std::string value;
+};
+
+/// Body of a message minus its session header and trailer
+struct MessageTemplate {
+    size_t type;                          // Index into MIX_TYPES
+    std::vector<TemplateField> fields;
+};
+
+/// Tags the session writes itself
+[[nodiscard]] constexpr bool is_session_tag(int tag) noexcept {
+    switch (tag) {
+        case 8: case 9: case 10: case 34: case 35: case 43:
+        case 49: case 52: case 56: case 97: case 122:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Parse "tag=value<SOH>..." into a template; nullopt for other types
+[[nodiscard]] std::optional<MessageTemplate> make_template(std::string_view msg) {
+    MessageTemplate t{};
+    std::optional<size_t> type;
+    bool has_cl_ord_id = false;
+    while (!msg.empty()) {
+        const size_t end = std::min(msg.find(fix::SOH), msg.size());
+        const std::string_view field = msg.substr(0, end);
+        msg.remove_prefix(std::min(end + 1, msg.size()));
+
+        const size_t eq = field.find('=');
+        if (eq == std::string_view::npos) continue;
+        int tag = 0;
+        if (std::from_chars(field.data(), field.data() + eq, tag).ec != std::errc{}) continue;
+        const std::string_view value = field.substr(eq + 1);
+
+        if (tag == 35) type = mix_index(value);
+        if (is_session_tag(tag)) continue;
+        has_cl_ord_id |= tag == 11;
+        t.fields.push_back({tag, std::string{value}});
+    }
+    if (!type) return std::nullopt;
+    t.type = *type;
+    if (t.type < MIX_ORDER_TYPES && !has_cl_ord_id) t.fields.push_back({11, {}});
+    return t;
+}
+
+[[nodiscard]] std::vector<MessageTemplate> builtin_templates() {
+    constexpr std::array<std::string_view, 6> messages{
+        "35=D\x01" "11=x\x01" "55=AAPL\x01" "54=1\x01" "60=20240102-09:30:00.000\x01"
+            "38=100\x01" "40=2\x01" "44=150.25\x01" "59=0\x01",
+        "35=F\x01" "41=x\x01" "11=x\x01" "55=AAPL\x01" "54=1\x01"
+            "60=20240102-09:30:00.000\x01" "38=100\x01",
+        "35=G\x01" "41=x\x01" "11=x\x01" "55=AAPL\x01" "54=1\x01"
+            "60=20240102-09:30:00.000\x01" "38=200\x01" "40=2\x01" "44=150.30\x01",
+        "35=8\x01" "37=O1\x01" "17=E1\x01" "150=0\x01" "39=0\x01" "11=C1\x01" "55=AAPL\x01"
+            "54=1\x01" "38=100\x01" "151=100\x01" "14=0\x01" "6=0\x01",
+        "35=W\x01" "262=MD1\x01" "55=AAPL\x01" "268=2\x01" "269=0\x01" "270=150.25\x01"
+            "271=100\x01" "269=1\x01" "270=150.30\x01" "271=200\x01",
+        "35=X\x01" "268=1\x01" "279=0\x01" "269=0\x01" "55=AAPL\x01" "270=150.26\x01" "271=50\x01"};
+    std::vector<MessageTemplate> out;
+    for (std::string_view m : messages) out.push_back(*make_template(m));
+    return out;
+}
+
+/// Every D/F/G/8/W/X message of a capture, split at each "8=FIX"
+[[nodiscard]] std::vector<MessageTemplate> load_capture(const std::string& path) {
+    std::vector<MessageTemplate> out;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return out;
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    std::string data = ss.str();
+    std::replace(data.begin(), data.end(), '|', fix::SOH);
+    std::replace(data.begin(), data.end(), '\n', fix::SOH);
+
+    size_t start = data.find("8=FIX");
+    while (start != std::string::npos) {
+        const size_t next = data.find(std::string_view{"\x01" "8=FIX"}, start);
+        const size_t end = next == std::string::npos ? data.size() : next + 1;
+        if (auto t = make_template(std::string_view{data}.substr(start, end - start))) {
+            out.push_back(std::move(*t));
+        }
+        start = next == std::string::npos ? next : next + 1;
+    }
+    return out;
+}
+
+/// Builder SessionManager::send_app_message() fills the header of
+class TemplateBuilder {
+public:
+    TemplateBuilder(const MessageTemplate& t, std::string_view cl_ord_id,
+                    std::string_view orig_cl_ord_id) noexcept
+        : template_{t}, cl_ord_id_{cl_ord_id}, orig_cl_ord_id_{orig_cl_ord_id} {}
+
+    TemplateBuilder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
+    TemplateBuilder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
+    TemplateBuilder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
+    TemplateBuilder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+
+    [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+        asm_.start()
+            .field(tag::MsgType::value, MIX_TYPES[template_.type])
+            .field(tag::SenderCompID::value, sender_comp_id_)
+            .field(tag::TargetCompID::value, target_comp_id_)
+            .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
+            .field(tag::SendingTime::value, sending_time_);
+        for (const TemplateField& f : template_.fields) {
+            if (f.tag == 11 && !cl_ord_id_.empty()) {
+                asm_.field(f.tag, cl_ord_id_);
+            } else if (f.tag == 41 && !orig_cl_ord_id_.empty()) {
+                asm_.field(f.tag, orig_cl_ord_id_);
+            } else {
+                asm_.field(f.tag, std::string_view{f.value});
+            }
+        }
+        return asm_.finish();
+    }
+
+private:
+    const MessageTemplate& template_;
+    std::string_view cl_ord_id_;
+    std::string_view orig_cl_ord_id_;
+    std::string_view sender_comp_id_;
+    std::string_view target_comp_id_;
+    std::string_view sending_time_;
+    uint32_t msg_seq_num_{0};
+};
+
+// ============================================================================
+// Options
+// ============================================================================
+
+enum class Arrivals : uint8_t { Constant, Poisson };
+
+struct Options {
+    std::string target_host;               // Empty: in-process venue
+    uint16_t target_port{0};
+    size_t sessions{1};
+    size_t threads{1};
+    double rate{1000.0};
+    Arrivals arrivals{Arrivals::Constant};
+    double duration_sec{10.0};
+    double warmup_sec{1.0};
+    std::string capture;
+    std::array<double, MIX_TYPES.size()> mix{};
+    bool mix_set{false};
+    std::string sender_prefix{"LOADGEN"};
+    std::string target_comp_id{"VENUE"};
+    std::vector<int> cores;
+};
+
+[[nodiscard]] bool parse_options(int argc, char* argv[], Options& o) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const size_t eq = arg.find('=');
+        if (!arg.starts_with("--") || eq == std::string_view::npos) {
+            std::cerr << "Expected --option=value, got '" << arg << "'\n";
+            return false;
+        }
+        const std::string_view key = arg.substr(2, eq - 2);
+        const std::string value{arg.substr(eq + 1)};
+
+        if (key == "target") {
+            const size_t colon = value.rfind(':');
+            if (colon == std::string::npos) return false;
+            o.target_host = value.substr(0, colon);
+            o.target_port = static_cast<uint16_t>(std::stoul(value.substr(colon + 1)));
+        } else if (key == "sessions") {
+            o.sessions = std::max<size_t>(1, std::stoul(value));
+        } else if (key == "threads") {
+            o.threads = std::max<size_t>(1, std::stoul(value));
+        } else if (key == "rate") {
+            o.rate = std::stod(value);
+        } else if (key == "arrivals") {
+            if (value != "constant" && value != "poisson") return false;
+            o.arrivals = value == "poisson" ? Arrivals::Poisson : Arrivals::Constant;
+        } else if (key == "duration") {
+            o.duration_sec = std::stod(value);
+        } else if (key == "warmup") {
+            o.warmup_sec = std::stod(value);
+        } else if (key == "capture") {
+            o.capture = value;
+        } else if (key == "mix") {
+            std::istringstream items{value};
+            std::string item;
+            while (std::getline(items, item, ',')) {
+                const size_t c = item.find(':');
+                const auto idx = mix_index(std::string_view{item}.substr(0, c));
+                if (!idx || c == std::string::npos) return false;
+                o.mix[*idx] = std::stod(item.substr(c + 1));
+            }
+            o.mix_set = true;
+        } else if (key == "sender") {
+            o.sender_prefix = value;
+        } else if (key == "target-comp") {
+            o.target_comp_id = value;
+        } else if (key == "cores") {
+            std::istringstream items{value};
+            std::string item;
+            while (std::getline(items, item, ',')) o.cores.push_back(std::stoi(item));
+        } else {
+            std::cerr << "Unknown option --" << key << "\n";
+            return false;
+        }
+    }
+    o.threads = std::min(o.threads, o.sessions);
+    return o.rate > 0 && o.duration_sec > 0;
+}
+
+// ============================================================================
+// Load Session
+// ============================================================================
+
+class LoadSession;
+
+struct LoadHandler : NullSessionHandler {
+    LoadSession* owner{nullptr};
+
+    bool on_send(std::span<const char> data) noexcept;
+    void on_message(MsgTypeTag<'8'>, const ParsedMessage& msg) noexcept;
+};
+
+/// One connection, its schedule and its results (owned by one driver thread)
+class LoadSession {
+public:
+    static constexpr size_t PENDING_SLOTS = 1 << 16;    // Orders awaiting a response
+
+    struct Results {
+        LatencyHistogram response;     // Response time from the scheduled send (ns)
+        LatencyHistogram send_lag;     // Actual send - scheduled send (ns)
+        std::array<uint64_t, MIX_TYPES.size()> sent{};
+        uint64_t expected{0};          // Measured orders
+        uint64_t answered{0};          // ... whose ExecutionReport arrived
+        uint64_t send_failures{0};
+    };
+
+    LoadSession(const Options& options, std::string sender, size_t index,
+                const std::vector<MessageTemplate>& templates,
+                const std::array<std::vector<size_t>, MIX_TYPES.size()>& by_type,
+                const std::array<double, MIX_TYPES.size()>& weights)
+        : sender_{std::move(sender)}
+        , templates_{templates}
+        , by_type_{by_type}
+        , rng_{0x9E3779B97F4A7C15ULL * (index + 1)}
+        , pick_type_{weights.begin(), weights.end()}
+        , gap_ns_{1e9 / options.rate}
+        , poisson_{options.arrivals == Arrivals::Poisson}
+        , exponential_{options.rate / 1e9}
+        , pending_{std::make_unique<Pending[]>(PENDING_SLOTS)} {
+        config_.sender_comp_id = sender_;
+        config_.target_comp_id = options.target_comp_id;
+        session_.emplace(config_, LoadHandler{{}, this});
+    }
+
+    LoadSession(const LoadSession&) = delete;
+    LoadSession& operator=(const LoadSession&) = delete;
+
+    /// Connect and log on (before the run)
+    [[nodiscard]] bool connect(const std::string& host, uint16_t port) {
+        if (!transport_.connect(host, port)) return false;
+        (void)transport_.set_nodelay(true);
+        session_->on_connect();
+        if (!session_->initiate_logon()) return false;
+        const uint64_t deadline = util::RdtscClock::now_ns() + 5'000'000'000ULL;
+        while (session_->state() != SessionState::Active) {
+            if (!poll() || util::RdtscClock::now_ns() > deadline) return false;
+        }
+        return true;
+    }
+
+    void start(uint64_t first_send_ns, uint64_t measure_from_ns, uint64_t end_ns) noexcept {
+        next_send_ = static_cast<double>(first_send_ns);
+        measure_from_ = measure_from_ns;
+        end_ = end_ns;
+    }
+
+    /// Send everything scheduled up to now; late messages go out at once
+    void send_due(uint64_t now) noexcept {
+        while (static_cast<uint64_t>(next_send_) <= now && static_cast<uint64_t>(next_send_) < end_) {
+            send_one(static_cast<uint64_t>(next_send_), now);
+            next_send_ += poisson_ ? exponential_(rng_) : gap_ns_;
+            now = util::RdtscClock::now_ns();
+        }
+    }
+
+    /// Read and handle whatever the socket has; false once disconnected
+    bool poll() noexcept { return reader_.poll(transport_.socket(), *session_); }
+
+    void on_timer_tick() noexcept { session_->on_timer_tick(); }
+
+    [[nodiscard]] bool all_answered() const noexcept { return results_.answered >= results_.expected; }
+
+    void logout() noexcept {
+        if (session_->initiate_logout("load done")) {
+            const uint64_t deadline = util::RdtscClock::now_ns() + 1'000'000'000ULL;
+            while (session_->state() == SessionState::LogoutPending &&
+                   util::RdtscClock::now_ns() < deadline && poll()) {}
+        }
+        session_->on_disconnect();
+        transport_.disconnect();
+    }
+
+    [[nodiscard]] const Results& results() const noexcept { return results_; }
+
+    bool write(std::span<const char> data) noexcept {
+        while (!data.empty()) {
+            auto sent = transport_.send(data);
+            if (!sent) return false;
+            data = data.subspan(*sent);
+        }
+        return true;
+    }
+
+    void on_execution_report(const ParsedMessage& msg) noexcept {
+        const std::string_view cl_ord_id = msg.get_string(11);
+        if (cl_ord_id.size() < 2 || cl_ord_id[0] != 'L') return;
+        uint64_t id = 0;
+        if (std::from_chars(cl_ord_id.data() + 1, cl_ord_id.data() + cl_ord_id.size(), id).ec != std::errc{}) {
+            return;
+        }
+        Pending& p = pending_[id & (PENDING_SLOTS - 1)];
+        if (p.id != id + 1) return;            // Unknown, duplicate or overwritten
+        p.id = 0;
+        if (p.measured) {
+            results_.response.record(util::RdtscClock::now_ns() - p.scheduled);
+            ++results_.answered;
+        }
+    }
+
+private:
+    struct Pending {
+        uint64_t id{0};                // Order id + 1 (0 = free)
+        uint64_t scheduled{0};
+        bool measured{false};
+    };
+
+    void send_one(uint64_t scheduled, uint64_t now) noexcept {
+        const size_t type = static_cast<size_t>(pick_type_(rng_));
+        const auto& candidates = by_type_[type];
+        const MessageTemplate& t = templates_[candidates[next_template_[type]++ % candidates.size()]];
+        const bool measured = scheduled >= measure_from_;
+
+        std::string_view cl_ord_id;
+        std::string_view orig_cl_ord_id;
+        if (type < MIX_ORDER_TYPES) {
+            orig_cl_ord_id = {last_cl_ord_id_.data(), last_cl_ord_id_size_};
+            const uint64_t id = next_order_id_++;
+            cl_ord_id_[0] = 'L';
+            const auto [end, ec] = std::to_chars(cl_ord_id_.data() + 1, cl_ord_id_.data() + cl_ord_id_.size(), id);
+            cl_ord_id = {cl_ord_id_.data(), static_cast<size_t>(end - cl_ord_id_.data())};
+            pending_[id & (PENDING_SLOTS - 1)] = {id + 1, scheduled, measured};
+            if (measured) ++results_.expected;
+        }
+
+        TemplateBuilder builder{t, cl_ord_id, orig_cl_ord_id};
+        if (!session_->send_app_message(builder)) ++results_.send_failures;
+        if (!cl_ord_id.empty()) {
+            std::copy(cl_ord_id.begin(), cl_ord_id.end(), last_cl_ord_id_.begin());
+            last_cl_ord_id_size_ = cl_ord_id.size();
+        }
+        if (measured) {
+            ++results_.sent[type];
+            results_.send_lag.record(now - scheduled);
+        }
+    }
+
+    std::string sender_;
+    SessionConfig config_;
+    TcpTransport transport_;
+    std::optional<SessionManager<LoadHandler>> session_;
+
+    const std::vector<MessageTemplate>& templates_;
+    const std::array<std::vector<size_t>, MIX_TYPES.size()>& by_type_;
+    std::array<size_t, MIX_TYPES.size()> next_template_{};
+    std::mt19937_64 rng_;
+    std::discrete_distribution<int> pick_type_;
+    double gap_ns_;
+    bool poisson_;
+    std::exponential_distribution<double> exponential_;
+
+    double next_send_{0};
+    uint64_t measure_from_{0};
+    uint64_t end_{0};
+    uint64_t next_order_id_{0};
+    std::array<char, 24> cl_ord_id_{};
+    std::array<char, 24> last_cl_ord_id_{};
+    size_t last_cl_ord_id_size_{0};
+    std::unique_ptr<Pending[]> pending_;
+    bench::SessionReader reader_;
+    Results results_;
+};
+
+bool LoadHandler::on_send(std::span<const char> data) noexcept { return owner->write(data); }
+
+void LoadHandler::on_message(MsgTypeTag<'8'>, const ParsedMessage& msg) noexcept {
+    owner->on_execution_report(msg);
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+constexpr uint64_t TIMER_TICK_NS = 100'000'000;     // SessionManager::on_timer_tick()
+constexpr uint64_t DRAIN_NS = 1'000'000'000;        // Wait for late responses
+
+/// Run the schedule of sessions until end_ns, then drain responses
+void drive(std::vector<LoadSession*> sessions, uint64_t end_ns, int core) {
+    if (core >= 0) (void)util::CpuAffinity::pin_to_core(core);
+    uint64_t next_tick = util::RdtscClock::now_ns() + TIMER_TICK_NS;
+    while (true) {
+        const uint64_t now = util::RdtscClock::now_ns();
+        if (now >= end_ns) {
+            const bool done = std::all_of(sessions.begin(), sessions.end(),
+                                          [](const LoadSession* s) { return s->all_answered(); });
+            if (done || now >= end_ns + DRAIN_NS) break;
+        }
+        for (LoadSession* s : sessions) {
+            s->send_due(now);
+            (void)s->poll();
+        }
+        if (now >= next_tick) {
+            for (LoadSession* s : sessions) s->on_timer_tick();
+            next_tick += TIMER_TICK_NS;
+        }
+    }
+}
+
+void print_histogram(const char* name, const LatencyHistogram& h) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right
+              << "p50 " << std::setw(9) << h.percentile(50.0)
+              << "  p90 " << std::setw(9) << h.percentile(90.0)
+              << "  p99 " << std::setw(9) << h.percentile(99.0)
+              << "  p99.9 " << std::setw(9) << h.percentile(99.9)
+              << "  max " << std::setw(10) << h.max() << "  (ns)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "usage: " << argv[0] << " [--target=HOST:PORT] [--sessions=N] [--threads=N]"
+                  << " [--rate=R] [--arrivals=constant|poisson] [--duration=S] [--warmup=S]"
+                  << " [--capture=FILE] [--mix=D:70,F:20,G:10] [--sender=PREFIX]"
+                  << " [--target-comp=ID] [--cores=a,b,...]\n";
+        return 2;
+    }
+
+    // Templates and mix
+    std::vector<MessageTemplate> templates = options.capture.empty()
+        ? builtin_templates() : load_capture(options.capture);
+    std::array<std::vector<size_t>, MIX_TYPES.size()> by_type;
+    for (size_t i = 0; i < templates.size(); ++i) by_type[templates[i].type].push_back(i);
+
+    std::array<double, MIX_TYPES.size()> weights{};
+    for (size_t t = 0; t < MIX_TYPES.size(); ++t) {
+        if (by_type[t].empty()) continue;
+        if (options.mix_set) weights[t] = options.mix[t];
+        else if (!options.capture.empty()) weights[t] = static_cast<double>(by_type[t].size());
+        else weights[t] = t == 0 ? 1.0 : 0.0;
+    }
+    if (std::all_of(weights.begin(), weights.end(), [](double w) { return w <= 0; })) {
+        std::cerr << "No messages to send: the capture has no D/F/G/8/W/X or the mix selects none\n";
+        return 1;
+    }
+
+    std::cout << "NexusFIX Open-Loop Load Generator\n";
+    std::cout << "=================================\n";
+    std::cout << "  Target:      " << (options.target_host.empty() ? std::string{"in-process loopback venue"}
+                                       : options.target_host + ":" + std::to_string(options.target_port)) << "\n";
+    std::cout << "  Sessions:    " << options.sessions << " on " << options.threads << " thread(s)\n";
+    std::cout << "  Rate:        " << options.rate << " msg/s per session ("
+              << (options.arrivals == Arrivals::Poisson ? "Poisson" : "constant") << "), "
+              << options.rate * static_cast<double>(options.sessions) << " msg/s total\n";
+    std::cout << "  Duration:    " << options.duration_sec << " s (+" << options.warmup_sec << " s warmup)\n";
+    std::cout << "  Mix:        ";
+    const double total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    for (size_t t = 0; t < MIX_TYPES.size(); ++t) {
+        if (weights[t] > 0) {
+            std::cout << " " << MIX_TYPES[t] << ":" << std::fixed << std::setprecision(1)
+                      << 100.0 * weights[t] / total_weight << "%";
+        }
+    }
+    std::cout << "  (" << templates.size() << " template(s))\n";
+
+    util::RdtscClock::initialize();
+
+    // Target
+    bench::LoopbackVenue venue{options.target_comp_id};
+    std::string host = options.target_host;
+    uint16_t port = options.target_port;
+    if (host.empty()) {
+        host = "127.0.0.1";
+        port = venue.start(options.sessions);
+        if (port == 0) {
+            std::cerr << "Could not start the loopback venue\n";
+            return 1;
+        }
+    }
+
+    // Connect and log on every session
+    std::vector<std::unique_ptr<LoadSession>> sessions;
+    for (size_t i = 0; i < options.sessions; ++i) {
+        auto s = std::make_unique<LoadSession>(options, options.sender_prefix + std::to_string(i + 1), i,
+                                               templates, by_type, weights);
+        if (!s->connect(host, port)) {
+            std::cerr << "Session " << i + 1 << " could not connect or log on\n";
+            return 1;
+        }
+        sessions.push_back(std::move(s));
+    }
+
+    // Run: sessions start staggered over one gap so they do not send in lockstep
+    const uint64_t start = util::RdtscClock::now_ns() + 10'000'000;
+    const uint64_t measure_from = start + static_cast<uint64_t>(options.warmup_sec * 1e9);
+    const uint64_t end = measure_from + static_cast<uint64_t>(options.duration_sec * 1e9);
+    const auto gap = static_cast<uint64_t>(1e9 / options.rate);
+    std::vector<std::vector<LoadSession*>> assigned(options.threads);
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        sessions[i]->start(start + gap * i / sessions.size(), measure_from, end);
+        assigned[i % options.threads].push_back(sessions[i].get());
+    }
+
+    std::vector<std::thread> drivers;
+    for (size_t t = 0; t < options.threads; ++t) {
+        const int core = t < options.cores.size() ? options.cores[t] : -1;
+        drivers.emplace_back(drive, assigned[t], end, core);
+    }
+    for (auto& d : drivers) d.join();
+    for (auto& s : sessions) s->logout();
+    venue.stop();
+
+    // Report
+    LoadSession::Results total;
+    for (const auto& s : sessions) {
+        const auto& r = s->results();
+        total.response.merge(r.response);
+        total.send_lag.merge(r.send_lag);
+        for (size_t t = 0; t < MIX_TYPES.size(); ++t) total.sent[t] += r.sent[t];
+        total.expected += r.expected;
+        total.answered += r.answered;
+        total.send_failures += r.send_failures;
+    }
+    const uint64_t sent = std::accumulate(total.sent.begin(), total.sent.end(), uint64_t{0});
+
+    std::cout << "\nSent " << sent << " messages in the measured window ("
+              << std::fixed << std::setprecision(0) << static_cast<double>(sent) / options.duration_sec
+              << " msg/s):";
+    for (size_t t = 0; t < MIX_TYPES.size(); ++t) {
+        if (total.sent[t]) std::cout << " " << MIX_TYPES[t] << "=" << total.sent[t];
+    }
+    std::cout << "\n";
+    if (total.send_failures) std::cout << "  Send failures: " << total.send_failures << "\n";
+    std::cout << "Orders answered: " << total.answered << " of " << total.expected;
+    if (total.expected > total.answered) std::cout << " (" << total.expected - total.answered << " unanswered)";
+    std::cout << "\n";
+    print_histogram("response (from schedule)", total.response);
+    print_histogram("send lag", total.send_lag);
+    std::cout << "  Histogram buckets are within 6.25% of the recorded value.\n";
+    return 0;
+}
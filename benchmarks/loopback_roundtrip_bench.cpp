@@ -0,0 +1,296 @@
+// loopback_roundtrip_bench.cpp
+// End-to-end order round trip over loopback TCP
+//
+// Measures what the desk sees: a NewOrderSingle leaving the initiator's
+// SessionManager until the venue's ExecutionReport has been parsed and
+// dispatched back on the initiator:
+//
+//   initiator: send_app_message(D) -> transport -> loopback TCP
+//   venue:     acceptor SessionManager parses D, sends ExecutionReport (New)
+//   initiator: transport -> on_data_received -> on_message(8)   [stop]
+//
+// One order is in flight at a time (ping-pong). With a rate, orders are
+// scheduled at fixed intervals and each latency is taken from the order's
+// scheduled send time, not from when it actually went out: a slow round
+// trip delays the orders behind it, and those delays are counted instead
+// of silently dropped (coordinated omission). The uncorrected service time
+// is printed alongside. Rate 0 sends back to back (both are then equal).
+//
+// Both threads busy-poll their sockets and are pinned to the given cores.
+// shm replaces loopback TCP with ShmTransport (a shared-memory ring pair
+// under /dev/shm), the path for a strategy co-located with its gateway.
+//
+// Usage:
+//   loopback_roundtrip_bench [tcp|io_uring|shm] [rate_per_sec] [orders] [client_core] [server_core] [warmup]
+//
+// Defaults: tcp, 0 (back to back), 100000 orders, cores 2 and 3, 10000
+// warmup orders. A core of -1 leaves that thread unpinned; with both
+// threads on one core the busy-polling makes every round trip a
+// scheduler time slice.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+#include "loopback_venue.hpp"
+
+using namespace nfx;
+
+namespace {
+
+constexpr size_t RECV_BUFFER_SIZE = 64 * 1024;
+
+// ============================================================================
+// Initiator
+// ============================================================================
+
+struct ClientHandler : NullSessionHandler {
+    ITransport* transport{nullptr};
+    uint64_t acks{0};
+
+    bool on_send(std::span<const char> data) noexcept {
+        while (!data.empty()) {
+            auto sent = transport->send(data);
+            if (!sent) return false;
+            data = data.subspan(*sent);
+        }
+        return true;
+    }
+
+    void on_message(MsgTypeTag<'8'>, const ParsedMessage&) noexcept { ++acks; }
+};
+
+struct RoundTripResult {
+    LatencyHistogram corrected;    // From the scheduled send time (ns)
+    LatencyHistogram service;      // From the actual send time (ns)
+    uint64_t orders{0};
+    double elapsed_sec{0};
+    bool ok{false};
+};
+
+/// Logon, ping-pong orders, logout; receive() reads whatever the
+/// transport has (0 when nothing is queued)
+template <typename Receive>
+RoundTripResult run_client(const SessionConfig& config, ITransport& transport, Receive&& receive,
+                           uint64_t rate, size_t orders, size_t warmup) {
+    RoundTripResult result;
+    SessionManager<ClientHandler> session{config, ClientHandler{{}, &transport}};
+    auto buffer = std::make_unique<char[]>(RECV_BUFFER_SIZE);
+
+    // Read until pred() holds; false if the connection dropped
+    auto pump_until = [&](auto&& pred) {
+        while (!pred()) {
+            auto received = receive(std::span<char>{buffer.get(), RECV_BUFFER_SIZE});
+            if (!received) return false;
+            if (*received == 0) continue;
+            session.on_data_received({buffer.get(), *received});
+            session.end_receive_batch();
+        }
+        return true;
+    };
+
+    session.on_connect();
+    if (!session.initiate_logon() ||
+        !pump_until([&] { return session.state() == SessionState::Active; })) {
+        return result;
+    }
+
+    std::string cl_ord_id;
+    cl_ord_id.reserve(32);
+    const uint64_t interval_ns = rate ? 1'000'000'000 / rate : 0;
+
+    auto round_trip = [&](size_t i) {
+        cl_ord_id.assign("RT");
+        cl_ord_id.append(std::to_string(i));
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25));
+
+        const uint64_t expected = session.handler().acks + 1;
+        const uint64_t sent_at = util::RdtscClock::now_ns();
+        if (!session.send_app_message(order)) return uint64_t{0};
+        if (!pump_until([&] { return session.handler().acks >= expected; })) return uint64_t{0};
+        return sent_at;
+    };
+
+    for (size_t i = 0; i < warmup; ++i) {
+        if (round_trip(i) == 0) return result;
+    }
+
+    const uint64_t start = util::RdtscClock::now_ns();
+    for (size_t i = 0; i < orders; ++i) {
+        const uint64_t scheduled = start + i * interval_ns;
+        while (util::RdtscClock::now_ns() < scheduled) {
+            // Spin to the schedule; a late order goes out immediately
+        }
+        const uint64_t sent_at = round_trip(warmup + i);
+        if (sent_at == 0) return result;
+        const uint64_t done = util::RdtscClock::now_ns();
+        result.corrected.record(done - (interval_ns ? scheduled : sent_at));
+        result.service.record(done - sent_at);
+        ++result.orders;
+    }
+    result.elapsed_sec = static_cast<double>(util::RdtscClock::now_ns() - start) / 1e9;
+
+    if (session.initiate_logout("done")) {
+        (void)pump_until([&] { return session.state() != SessionState::LogoutPending; });
+    }
+    session.on_disconnect();
+    result.ok = true;
+    return result;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void print_histogram(const char* name, const LatencyHistogram& h) {
+    std::cout << "  " << std::left << std::setw(22) << name << std::right
+              << "p50 " << std::setw(8) << h.percentile(50.0)
+              << "  p99 " << std::setw(8) << h.percentile(99.0)
+              << "  p99.9 " << std::setw(8) << h.percentile(99.9)
+              << "  max " << std::setw(9) << h.max()
+              << "  mean " << std::setw(9) << static_cast<uint64_t>(h.mean()) << "  (ns)\n";
+}
+
+/// Print the result; exit code for main()
+int report(const RoundTripResult& result, uint64_t rate) {
+    if (!result.ok) {
+        std::cerr << "Round trip failed (connection, logon or order)\n";
+        return 1;
+    }
+
+    std::cout << "\nRound trip (D -> ExecutionReport), " << result.orders << " orders in "
+              << std::fixed << std::setprecision(2) << result.elapsed_sec << " s ("
+              << static_cast<uint64_t>(static_cast<double>(result.orders) / result.elapsed_sec)
+              << " orders/sec)\n";
+    print_histogram(rate ? "corrected (scheduled)" : "round trip", result.corrected);
+    if (rate) print_histogram("service (actual send)", result.service);
+    std::cout << "  Histogram buckets are within 6.25% of the recorded value.\n";
+    return 0;
+}
+
+void pin(int core, const char* who) {
+    if (core < 0) return;
+    if (!util::CpuAffinity::pin_to_core(core).success) {
+        std::cout << "  (could not pin " << who << " to core " << core << ")\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string transport_name = argc > 1 ? argv[1] : "tcp";
+    const uint64_t rate = argc > 2 ? std::stoull(argv[2]) : 0;
+    const size_t orders = argc > 3 ? std::stoul(argv[3]) : 100'000;
+    const int client_core = argc > 4 ? std::atoi(argv[4]) : 2;
+    const int server_core = argc > 5 ? std::atoi(argv[5]) : 3;
+    const size_t warmup = argc > 6 ? std::stoul(argv[6]) : 10'000;
+
+    if (transport_name != "tcp" && transport_name != "io_uring" && transport_name != "shm") {
+        std::cerr << "Unknown transport '" << transport_name << "' (tcp | io_uring | shm)\n";
+        return 1;
+    }
+
+    std::cout << "NexusFIX Loopback Round-Trip Benchmark\n";
+    std::cout << "======================================\n";
+    std::cout << "  Transport:   " << transport_name << "\n";
+    std::cout << "  Rate:        " << (rate ? std::to_string(rate) + " orders/sec" : "back to back") << "\n";
+    std::cout << "  Orders:      " << orders << " (+" << warmup << " warmup)\n";
+    std::cout << "  Cores:       client " << client_core << ", venue " << server_core << "\n";
+
+    util::RdtscClock::initialize();
+
+    SessionConfig client_config;
+    client_config.sender_comp_id = "CLIENT";
+    client_config.target_comp_id = "VENUE";
+    RoundTripResult result;
+
+    if (transport_name == "shm") {
+#if NFX_PLATFORM_LINUX
+        // Venue on its own thread, as it would be in the gateway process
+        const std::string path = "/dev/shm/nfx-roundtrip-" + std::to_string(::getpid());
+        bench::BasicVenueSession<ShmTransport> venue_session{"VENUE", ShmTransportConfig{}};
+        if (!venue_session.socket().listen(path)) {
+            std::cerr << "shm listen failed (" << path << ")\n";
+            return 1;
+        }
+        std::atomic<bool> stop{false};
+        std::thread venue_thread{[&] {
+            pin(server_core, "venue");
+            while (!stop.load(std::memory_order_relaxed) && venue_session.poll()) {}
+        }};
+
+        pin(client_core, "client");
+        ShmTransport transport;
+        if (transport.connect(path, 0)) {
+            result = run_client(client_config, transport,
+                [&](std::span<char> buf) { return transport.try_receive(buf); },
+                rate, orders, warmup);
+            transport.disconnect();
+        }
+        stop.store(true, std::memory_order_relaxed);
+        venue_thread.join();
+#else
+        std::cout << "  shm transport is Linux only\n";
+#endif
+        return report(result, rate);
+    }
+
+    bench::LoopbackVenue venue{"VENUE"};
+    const uint16_t port = venue.start(1, server_core);
+    if (port == 0) {
+        std::cerr << "listen failed\n";
+        return 1;
+    }
+
+    pin(client_core, "client");
+
+    if (transport_name == "tcp") {
+        TcpTransport transport;
+        if (transport.connect("127.0.0.1", port)) {
+            (void)transport.set_nodelay(true);
+            result = run_client(client_config, transport,
+                [&](std::span<char> buf) { return transport.socket().try_receive(buf); },
+                rate, orders, warmup);
+        }
+    } else {
+#if NFX_IO_URING_AVAILABLE
+        IoUringContext ctx;
+        if (ctx.init()) {
+            IoUringTransport transport{ctx};
+            if (transport.connect("127.0.0.1", port)) {
+                (void)transport.set_nodelay(true);
+                result = run_client(client_config, transport,
+                    [&](std::span<char> buf) { return transport.receive(buf); },
+                    rate, orders, warmup);
+            }
+        }
+#else
+        std::cout << "  io_uring not available in this build (configure with NFX_ENABLE_IO_URING=ON)\n";
+#endif
+    }
+
+    venue.stop();
+    return report(result, rate);
+}
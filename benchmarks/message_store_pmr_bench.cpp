@@ -14,8 +14,11 @@
 #include <memory_resource>
 #include <unordered_map>
 #include <span>
+#include <atomic>
+#include <thread>
 
 #include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
 
 using namespace nfx::util;
 
@@ -101,6 +104,53 @@ void print_stats(const char* label, const Stats& s) {
     std::cout << "    Max:    " << s.max << " ns\n";
 }
 
+// Store latency of MemoryMessageStore, optionally with a reader thread
+// retrieving recent messages the whole time
+std::vector<uint64_t> measure_store(bool single_writer, bool contended,
+                                    std::span<const char> msg, size_t& reader_hits) {
+    nfx::store::MemoryMessageStore store{nfx::store::MemoryMessageStore::Config{
+        .session_id = "BENCH",
+        .max_messages = 16384,
+        .single_writer = single_writer}};
+
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> last{0};
+    std::atomic<size_t> hits{0};
+    std::thread reader;
+    if (contended) {
+        reader = std::thread([&] {
+            (void)CpuAffinity::pin_to_core(3);
+            while (!done.load(std::memory_order_acquire)) {
+                const uint32_t seq = last.load(std::memory_order_acquire);
+                if (seq != 0 && store.retrieve(seq)) {
+                    hits.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    uint32_t seq = 1;
+    for (int i = 0; i < WARMUP_ITERATIONS; ++i, ++seq) {
+        (void)store.store(seq, msg);
+        last.store(seq, std::memory_order_release);
+    }
+
+    std::vector<uint64_t> latencies;
+    latencies.reserve(BENCHMARK_ITERATIONS);
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i, ++seq) {
+        uint64_t start = rdtsc();
+        (void)store.store(seq, msg);
+        uint64_t end = rdtsc();
+        latencies.push_back(end - start);
+        last.store(seq, std::memory_order_release);
+    }
+
+    done.store(true, std::memory_order_release);
+    if (reader.joinable()) reader.join();
+    reader_hits = hits.load();
+    return latencies;
+}
+
 int main() {
     std::cout << "==========================================================\n";
     std::cout << "  PMR vs Heap Allocation Benchmark (Message Store)\n";
@@ -251,6 +301,45 @@ int main() {
     std::cout << "\n  Summary: PMR is " << std::setprecision(1) << speedup_median
               << "x faster than heap allocation!\n";
 
+    // ========================================================================
+    // MemoryMessageStore: shared_mutex vs single-writer seqlock
+    // ========================================================================
+
+    std::cout << "\n==========================================================\n";
+    std::cout << "  MemoryMessageStore::store(): Locked vs Single-Writer\n";
+    std::cout << "==========================================================\n\n";
+
+    struct StoreCase {
+        const char* label;
+        bool single_writer;
+        bool contended;
+        Stats stats;
+        size_t reader_hits;
+    };
+    StoreCase cases[] = {
+        {"Locked, uncontended", false, false, {}, 0},
+        {"Single-writer, uncontended", true, false, {}, 0},
+        {"Locked, reader thread", false, true, {}, 0},
+        {"Single-writer, reader thread", true, true, {}, 0},
+    };
+    for (auto& c : cases) {
+        auto latencies = measure_store(c.single_writer, c.contended, msg, c.reader_hits);
+        c.stats = compute_stats(latencies, cpu_freq_ghz);
+    }
+
+    std::cout << "  Mode                              Mean     Median       P99     P99.9   Reader hits\n";
+    std::cout << "  -----------------------------------------------------------------------------------\n";
+    for (const auto& c : cases) {
+        std::cout << "  " << std::left << std::setw(30) << c.label << std::right
+                  << std::setw(8) << std::fixed << std::setprecision(1) << c.stats.mean << " ns"
+                  << std::setw(8) << c.stats.median << " ns"
+                  << std::setw(7) << c.stats.p99 << " ns"
+                  << std::setw(7) << c.stats.p999 << " ns"
+                  << std::setw(12) << c.reader_hits << "\n";
+    }
+    std::cout << "\n  Contended P99: locked / single-writer = " << std::setprecision(2)
+              << cases[2].stats.p99 / cases[3].stats.p99 << "x\n";
+
     // ========================================================================
     // Benefits Summary
     // ========================================================================
@@ -5,12 +5,14 @@
     - SPSC Queue (baseline)
     - MPSC Queue with sequence array
     - SimpleMPSC Queue with claim-publish
+    - Batch claim/publish + drain at different batch sizes
 
     Scenarios:
     - Single producer (compare overhead vs SPSC)
     - 2 producers
     - 4 producers
     - 8 producers
+    - Batch sizes 1, 4, 16, 64 (SPSC and MPSC 1P/4P)
 
     Metrics:
     - Throughput (messages/second)
@@ -30,6 +32,8 @@
 #include <vector>
 #include <numeric>
 #include <algorithm>
+#include <array>
+#include <span>
 
 using namespace nfx::memory;
 using namespace std::chrono;
@@ -238,6 +242,95 @@ MPSCResult benchmark_mpsc(size_t num_producers, size_t messages_per_producer) {
     };
 }
 
+// ============================================================================
+// Batch Claim/Publish Benchmark
+// ============================================================================
+
+constexpr size_t DRAIN_BATCH = 256;
+
+/// Producers fill `batch` slots per try_claim()/publish(); the consumer
+/// empties the queue with drain(). Works for SPSCQueue (1 producer) and
+/// MPSCQueue.
+template<typename QueueT>
+MPSCResult benchmark_batch(size_t num_producers, size_t messages_per_producer,
+                           size_t batch) {
+    auto queue_ptr = std::make_unique<QueueT>();
+    auto& queue = *queue_ptr;
+    std::atomic<bool> start{false};
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<size_t> producers_done{0};
+
+    std::thread consumer([&]() {
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        auto out = std::make_unique<std::array<TestMessage, DRAIN_BATCH>>();
+        uint64_t count = 0;
+        for (;;) {
+            const bool finished =
+                producers_done.load(std::memory_order_acquire) == num_producers;
+            const size_t n = queue.drain(std::span<TestMessage>(*out));
+            count += n;
+            if (n == 0) {
+                if (finished) break;
+                _mm_pause();
+            }
+        }
+        consumed.store(count, std::memory_order_release);
+    });
+
+    std::vector<std::thread> producers;
+    producers.reserve(num_producers);
+
+    for (size_t p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&, p]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            size_t i = 0;
+            while (i < messages_per_producer) {
+                const size_t n = std::min(batch, messages_per_producer - i);
+                ClaimedRange range;
+                while (!(range = queue.try_claim(n))) {
+                    _mm_pause();
+                }
+                for (size_t k = 0; k < n; ++k) {
+                    queue.slot(range, k) = TestMessage{i + k, rdtsc(), p, {}};
+                }
+                queue.publish(range);
+                i += n;
+            }
+
+            producers_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    std::this_thread::sleep_for(milliseconds(1));
+
+    auto start_time = steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    auto end_time = steady_clock::now();
+    consumer.join();
+
+    auto elapsed = duration_cast<nanoseconds>(end_time - start_time);
+    double elapsed_sec = elapsed.count() / 1e9;
+    size_t total_messages = num_producers * messages_per_producer;
+
+    return {
+        .throughput_mps = static_cast<double>(total_messages) / elapsed_sec / 1e6,
+        .latency_ns = static_cast<double>(elapsed.count()) / total_messages,
+        .total_messages = consumed.load(),
+        .num_producers = num_producers
+    };
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -362,6 +455,41 @@ int main() {
 
     print_separator();
 
+    // Batch claim/publish + drain
+    print_header("Batch Claim/Publish + Drain");
+
+    using SPSCBatchType = SPSCQueue<TestMessage, QUEUE_CAPACITY>;
+    const std::vector<size_t> batch_sizes = {1, 4, 16, 64};
+
+    std::cout << "\n";
+    std::cout << std::left << std::setw(25) << "Configuration"
+              << std::right << std::setw(15) << "Throughput"
+              << std::setw(15) << "Latency"
+              << std::setw(15) << "Messages" << "\n";
+    std::cout << std::string(70, '-') << "\n";
+
+    auto print_batch_row = [](const std::string& label, const MPSCResult& r) {
+        std::cout << std::left << std::setw(25) << label
+                  << std::right << std::setw(12) << r.throughput_mps << " M/s"
+                  << std::setw(12) << r.latency_ns << " ns"
+                  << std::setw(15) << r.total_messages << "\n";
+    };
+
+    for (size_t batch : batch_sizes) {
+        print_batch_row("SPSC batch " + std::to_string(batch),
+            benchmark_batch<SPSCBatchType>(1, MESSAGES_PER_PRODUCER, batch));
+    }
+    for (size_t num_producers : {size_t{1}, size_t{4}}) {
+        for (size_t batch : batch_sizes) {
+            print_batch_row("MPSC " + std::to_string(num_producers) + "P batch " +
+                                std::to_string(batch),
+                benchmark_batch<MPSCQueueType>(
+                    num_producers, MESSAGES_PER_PRODUCER / num_producers, batch));
+        }
+    }
+
+    print_separator();
+
     // Analysis
     std::cout << "\nAnalysis:\n";
 
@@ -180,11 +180,11 @@ int main() {
               << std::setprecision(2) << simd_avg.ops_per_sec / 1e6 << "M scans/sec\n";
 
     // ========================================================================
-    // Test 2: Hash Map Performance (absl::flat_hash_map)
+    // Test 2: Message Store Lookup (sequence-indexed circular log)
     // ========================================================================
 
     std::cout << "\n----------------------------------------------------------\n";
-    std::cout << "  Test 2: Hash Map Lookup (Message Store)\n";
+    std::cout << "  Test 2: Message Store Lookup\n";
     std::cout << "----------------------------------------------------------\n";
 
     nfx::store::MemoryMessageStore store("TEST_SESSION");
@@ -234,7 +234,7 @@ int main() {
     lookup_avg.p99_ns /= NUM_RUNS;
     lookup_avg.ops_per_sec = 1e9 / lookup_avg.mean_ns;
 
-    std::cout << "  Hash Map Lookup: " << std::fixed << std::setprecision(1)
+    std::cout << "  Store Lookup: " << std::fixed << std::setprecision(1)
               << lookup_avg.mean_ns << " ns/lookup, "
               << std::setprecision(2) << lookup_avg.ops_per_sec / 1e6 << "M lookups/sec\n";
 
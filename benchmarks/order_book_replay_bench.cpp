@@ -0,0 +1,346 @@
+// order_book_replay_bench.cpp
+// L2 OrderBook replay benchmark
+//
+// Replays a captured market data day (35=W / 35=X) through store::OrderBook,
+// one book per symbol, the way a market data session would:
+//   parse -> decode MDEntry columns once -> apply to each symbol's book
+//
+// Usage:
+//   order_book_replay_bench [feed_file] [synthetic_messages]
+//
+// feed_file holds raw FIX messages back to back or one per line; '|' is
+// accepted in place of SOH. Without a file (or with "-") a synthetic day is
+// generated: 8 symbols, 10-level snapshots, then price-keyed incrementals
+// concentrated near the top of book.
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/store/order_book.hpp"
+#include "benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+using Book = store::OrderBook<64, 256>;
+
+// ============================================================================
+// Feed
+// ============================================================================
+
+struct Feed {
+    std::string data;
+    std::vector<std::pair<size_t, size_t>> messages;  // offset, length
+
+    [[nodiscard]] std::span<const char> message(size_t i) const noexcept {
+        return {data.data() + messages[i].first, messages[i].second};
+    }
+};
+
+/// Split a capture into messages at each "8=FIX" that follows SOH or a newline
+static Feed load_feed(const std::string& path) {
+    Feed feed;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return feed;
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    std::string raw = ss.str();
+
+    feed.data.reserve(raw.size());
+    for (char c : raw) {
+        if (c == '|') c = fix::SOH;
+        if (c == '\r') continue;
+        feed.data.push_back(c);
+    }
+
+    size_t start = feed.data.find("8=FIX");
+    while (start != std::string::npos) {
+        size_t next = feed.data.find("8=FIX", start + 5);
+        while (next != std::string::npos && feed.data[next - 1] != fix::SOH &&
+               feed.data[next - 1] != '\n') {
+            next = feed.data.find("8=FIX", next + 5);
+        }
+        size_t end = next == std::string::npos ? feed.data.size() : next;
+        while (end > start && feed.data[end - 1] == '\n') --end;
+        feed.messages.emplace_back(start, end - start);
+        start = next;
+    }
+    return feed;
+}
+
+static void append_message(Feed& feed, std::string_view msg_type, uint32_t seq,
+                           const std::string& body) {
+    std::string fields = "35=" + std::string{msg_type} + "\x01" "49=FEED\x01" "56=CLIENT\x01"
+                         "34=" + std::to_string(seq) + "\x01" "52=20260122-10:00:00.000\x01" + body;
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(fields.size()) + "\x01" + fields;
+    auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    msg += "10=" + std::string{cs.data(), 3} + "\x01";
+
+    feed.messages.emplace_back(feed.data.size(), msg.size());
+    feed.data += msg;
+}
+
+static std::string price_str(int64_t ticks) {
+    // Tick = 0.01
+    return std::to_string(ticks / 100) + "." + (ticks % 100 < 10 ? "0" : "") +
+           std::to_string(ticks % 100);
+}
+
+/// Synthetic trading day: snapshots, then incrementals around a random walk
+static Feed synthesize_feed(size_t count) {
+    static constexpr const char* SYMBOLS[] = {
+        "AAPL", "MSFT", "GOOGL", "AMZN", "NVDA", "META", "TSLA", "JPM"};
+    constexpr size_t NUM_SYMBOLS = std::size(SYMBOLS);
+
+    Feed feed;
+    feed.data.reserve(count * 160);
+    std::mt19937_64 rng{42};
+    std::vector<int64_t> mid(NUM_SYMBOLS);
+    uint32_t seq = 1;
+
+    for (size_t s = 0; s < NUM_SYMBOLS; ++s) {
+        mid[s] = 10'000 + static_cast<int64_t>(s) * 5'000;
+        std::string body = "262=MD1\x01" "55=" + std::string{SYMBOLS[s]} + "\x01" "268=20\x01";
+        for (int lvl = 0; lvl < 10; ++lvl) {
+            body += "269=0\x01" "270=" + price_str(mid[s] - 1 - lvl) + "\x01" "271=" +
+                    std::to_string(100 * (lvl + 1)) + "\x01";
+            body += "269=1\x01" "270=" + price_str(mid[s] + 1 + lvl) + "\x01" "271=" +
+                    std::to_string(100 * (lvl + 1)) + "\x01";
+        }
+        append_message(feed, "W", seq++, body);
+    }
+
+    std::uniform_int_distribution<int> pct(0, 99);
+    std::uniform_int_distribution<int> depth(0, 9);
+    std::uniform_int_distribution<int> rows(1, 4);
+    std::uniform_int_distribution<size_t> sym(0, NUM_SYMBOLS - 1);
+
+    while (feed.messages.size() < count) {
+        const int n = rows(rng);
+        std::string body;
+        int entries = 0;
+        for (int r = 0; r < n; ++r, ++entries) {
+            const size_t s = sym(rng);
+            const int roll = pct(rng);
+            if (roll < 2) {
+                // Drift: the level the mid moves onto leaves the opposite side
+                const bool up = roll == 0;
+                body += "279=2\x01" "269=" + std::string{up ? "1" : "0"} + "\x01" "55=" +
+                        SYMBOLS[s] + "\x01" "270=" + price_str(up ? mid[s] + 1 : mid[s] - 1) +
+                        "\x01";
+                ++entries;
+                mid[s] += up ? 1 : -1;
+            }
+
+            const bool bid = pct(rng) < 50;
+            const int lvl = depth(rng);
+            const int64_t px = bid ? mid[s] - 1 - lvl : mid[s] + 1 + lvl;
+            const bool trade = roll >= 90 && roll < 95;
+            const char* action = trade ? "0"
+                : roll < 60 ? "1" : roll < 80 ? "0" : roll < 97 ? "2" : "4";
+            const char* type = trade ? "2" : (bid ? "0" : "1");
+
+            body += "279=" + std::string{action} + "\x01" "269=" + type + "\x01" "55=" +
+                    SYMBOLS[s] + "\x01" "270=" + price_str(px) + "\x01";
+            if (action[0] != '2') {
+                body += "271=" + std::to_string(100 + pct(rng) * 10) + "\x01";
+            }
+        }
+        append_message(feed, "X", seq++,
+                       "262=MD1\x01" "268=" + std::to_string(entries) + "\x01" + body);
+    }
+    return feed;
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+/// One book per symbol, fed from each message's decoded columns
+class BookSet {
+public:
+    template <typename Listener>
+    size_t apply(const ParsedMessage& msg, Listener&& on_change) noexcept {
+        const char type = msg.msg_type();
+        if (type != 'W' && type != 'X') return 0;
+
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count <= 0) return 0;
+
+        if (type == 'W') {
+            const std::string_view sym = msg.get_string(tag::Symbol::value);
+            (void)parser::decode_md_entries(msg.raw(), tag::MDEntryType::value,
+                                            static_cast<size_t>(count), columns_, sym);
+            return book(sym).rebuild(columns_, on_change);
+        }
+
+        (void)parser::decode_md_entries(msg.raw(), tag::MDUpdateAction::value,
+                                        static_cast<size_t>(count), columns_);
+        size_t applied = 0;
+        for (size_t s = 0; s < columns_.symbol_count; ++s) {
+            applied += book(columns_.symbols[s]).apply_entries(columns_, on_change);
+        }
+        return applied;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return books_.size(); }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (const auto& b : books_) fn(*b);
+    }
+
+private:
+    Book& book(std::string_view sym) {
+        auto it = index_.find(sym);
+        if (it != index_.end()) return *books_[it->second];
+        books_.push_back(std::make_unique<Book>(sym));
+        index_.emplace(books_.back()->symbol(), books_.size() - 1);  // Key owned by the book
+        return *books_.back();
+    }
+
+    std::unordered_map<std::string_view, size_t> index_;
+    std::vector<std::unique_ptr<Book>> books_;
+    MDEntryColumns<256> columns_{};
+};
+
+struct ReplayResult {
+    uint64_t cycles{0};
+    uint64_t rows{0};
+    uint64_t top_changes{0};
+};
+
+static ReplayResult replay(const Feed& feed, std::vector<uint64_t>* samples) {
+    BookSet books;
+    ReplayResult result;
+    auto on_change = [&result](const store::BookChange& c) {
+        if (c.level == 0) ++result.top_changes;
+    };
+
+    const uint64_t start = rdtsc_vm_safe();
+    for (size_t i = 0; i < feed.messages.size(); ++i) {
+        const uint64_t t0 = samples ? rdtsc_vm_safe() : 0;
+        auto msg = ParsedMessage::parse(feed.message(i));
+        if (msg) [[likely]] {
+            result.rows += books.apply(*msg, on_change);
+        }
+        if (samples) samples->push_back(rdtsc_vm_safe() - t0);
+    }
+    result.cycles = rdtsc_vm_safe() - start;
+    return result;
+}
+
+static uint64_t parse_only(const Feed& feed) {
+    const uint64_t start = rdtsc_vm_safe();
+    size_t ok = 0;
+    for (size_t i = 0; i < feed.messages.size(); ++i) {
+        auto msg = ParsedMessage::parse(feed.message(i));
+        ok += msg.has_value();
+        compiler_barrier();
+    }
+    const uint64_t cycles = rdtsc_vm_safe() - start;
+    if (ok == 0) std::cout << "  (no message parsed)\n";
+    return cycles;
+}
+
+static void print_stats(const char* label, const LatencyStats& s) {
+    std::cout << std::setw(28) << std::left << label << std::right << std::fixed
+              << std::setprecision(1)
+              << "  mean " << std::setw(8) << s.mean_ns
+              << "  p50 " << std::setw(8) << s.p50_ns
+              << "  p99 " << std::setw(8) << s.p99_ns
+              << "  p99.9 " << std::setw(8) << s.p999_ns << " ns\n";
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "-";
+    size_t synthetic = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+
+    std::cout << "==========================================================\n";
+    std::cout << "  NexusFIX L2 OrderBook Replay Benchmark\n";
+    std::cout << "==========================================================\n\n";
+
+    Feed feed;
+    if (path != "-") {
+        feed = load_feed(path);
+        if (feed.messages.empty()) {
+            std::cerr << "No FIX messages in " << path << "\n";
+            return 1;
+        }
+        std::cout << "Feed:      " << path << "\n";
+    } else {
+        feed = synthesize_feed(synthetic);
+        std::cout << "Feed:      synthetic (8 symbols)\n";
+    }
+    std::cout << "Messages:  " << feed.messages.size() << "\n";
+    std::cout << "Bytes:     " << feed.data.size() << "\n";
+
+    std::cout << "\nCalibrating CPU frequency (busy-wait)...\n";
+    const double freq_ghz = estimate_cpu_freq_ghz_busy();
+    std::cout << "  CPU frequency: " << std::fixed << std::setprecision(3) << freq_ghz << " GHz\n";
+
+    (void)replay(feed, nullptr);  // Warm caches and the book map
+
+    // Throughput: parse alone vs parse + decode + book update
+    const uint64_t parse_cycles = parse_only(feed);
+    const ReplayResult full = replay(feed, nullptr);
+
+    const double n = static_cast<double>(feed.messages.size());
+    const double parse_ns = cycles_to_ns(parse_cycles, freq_ghz) / n;
+    const double full_ns = cycles_to_ns(full.cycles, freq_ghz) / n;
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Replay throughput\n";
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << std::setprecision(1);
+    std::cout << "  Parse only:             " << parse_ns << " ns/msg\n";
+    std::cout << "  Parse + book update:    " << full_ns << " ns/msg  ("
+              << std::setprecision(2) << 1e3 / full_ns << " M msg/s)\n";
+    std::cout << std::setprecision(1);
+    std::cout << "  Book update share:      " << (full_ns - parse_ns) << " ns/msg\n";
+    std::cout << "  Rows applied:           " << full.rows << "\n";
+    std::cout << "  Top-of-book changes:    " << full.top_changes << "\n";
+
+    // Per-message latency distribution
+    std::vector<uint64_t> samples;
+    samples.reserve(feed.messages.size());
+    (void)replay(feed, &samples);
+    LatencyStats stats;
+    stats.compute(samples, freq_ghz);
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Per-message latency (parse + decode + apply)\n";
+    std::cout << "----------------------------------------------------------\n";
+    print_stats("OrderBook<64> replay", stats);
+
+    // Final book state
+    BookSet books;
+    auto ignore = [](const store::BookChange&) {};
+    for (size_t i = 0; i < feed.messages.size(); ++i) {
+        if (auto msg = ParsedMessage::parse(feed.message(i))) (void)books.apply(*msg, ignore);
+    }
+    size_t crossed = 0;
+    uint64_t dropped = 0;
+    books.for_each([&](const Book& b) {
+        crossed += b.crossed();
+        dropped += b.dropped_levels();
+    });
+    std::cout << "\nBooks: " << books.size() << "  crossed: " << crossed
+              << "  dropped levels: " << dropped << "\n";
+    return 0;
+}
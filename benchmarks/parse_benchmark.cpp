@@ -13,6 +13,8 @@
 #include <x86intrin.h>
 
 #include "nexusfix/nexusfix.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "benchmark_utils.hpp"
 
 namespace nfx::bench {
 
@@ -39,12 +41,6 @@ inline uint64_t rdtsc_end() noexcept {
     return __rdtscp(&aux);           // Read timestamp
 }
 
-/// Legacy rdtsc for compatibility (CPU frequency calibration)
-inline uint64_t rdtsc() noexcept {
-    uint32_t aux;
-    return __rdtscp(&aux);
-}
-
 /// Get CPU frequency for cycle-to-nanosecond conversion
 inline double get_cpu_freq_ghz() noexcept {
     auto start_time = std::chrono::steady_clock::now();
@@ -53,7 +49,7 @@ inline double get_cpu_freq_ghz() noexcept {
     // Busy wait for calibration
     volatile uint64_t dummy = 0;
     for (int i = 0; i < 10000000; ++i) {
-        dummy += i;
+        dummy = dummy + i;
     }
 
     uint64_t end_cycles = rdtsc();
@@ -65,11 +61,6 @@ inline double get_cpu_freq_ghz() noexcept {
     return static_cast<double>(end_cycles - start_cycles) / elapsed_ns;
 }
 
-/// Convert cycles to nanoseconds
-inline double cycles_to_ns(uint64_t cycles, double freq_ghz) noexcept {
-    return static_cast<double>(cycles) / freq_ghz;
-}
-
 // ============================================================================
 // Statistics
 // ============================================================================
@@ -78,7 +69,9 @@ struct BenchmarkStats {
     double min_ns;
     double max_ns;
     double mean_ns;
+    double p25_ns;
     double p50_ns;
+    double p75_ns;
     double p90_ns;
     double p99_ns;
     double p999_ns;
@@ -107,7 +100,9 @@ BenchmarkStats calculate_stats(std::vector<double>& latencies) {
         return latencies[idx];
     };
 
+    stats.p25_ns = percentile(0.25);
     stats.p50_ns = percentile(0.50);
+    stats.p75_ns = percentile(0.75);
     stats.p90_ns = percentile(0.90);
     stats.p99_ns = percentile(0.99);
     stats.p999_ns = percentile(0.999);
@@ -122,7 +117,13 @@ BenchmarkStats calculate_stats(std::vector<double>& latencies) {
     return stats;
 }
 
-void print_stats(const char* name, const BenchmarkStats& stats) {
+/// Every printed case, written as JSON when NFX_BENCH_JSON / --json= is set
+BenchReport& report() {
+    static BenchReport r{"parse_benchmark"};
+    return r;
+}
+
+BenchResult& print_stats(const char* name, const BenchmarkStats& stats) {
     std::cout << "\n=== " << name << " ===\n";
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "  Iterations: " << stats.iterations << "\n";
@@ -134,6 +135,20 @@ void print_stats(const char* name, const BenchmarkStats& stats) {
     std::cout << "  P99.9:  " << std::setw(10) << stats.p999_ns << " ns\n";
     std::cout << "  Max:    " << std::setw(10) << stats.max_ns << " ns\n";
     std::cout << "  StdDev: " << std::setw(10) << stats.stddev_ns << " ns\n";
+
+    BenchResult r;
+    r.name = name;
+    r.samples = stats.iterations;
+    r.min_ns = stats.min_ns;
+    r.p25_ns = stats.p25_ns;
+    r.median_ns = stats.p50_ns;
+    r.p75_ns = stats.p75_ns;
+    r.p90_ns = stats.p90_ns;
+    r.p99_ns = stats.p99_ns;
+    r.p999_ns = stats.p999_ns;
+    r.max_ns = stats.max_ns;
+    r.mean_ns = stats.mean_ns;
+    return report().add(std::move(r));
 }
 
 // ============================================================================
@@ -322,6 +337,394 @@ void benchmark_indexed_parser(size_t iterations, double freq_ghz) {
     print_stats("IndexedParser (ExecutionReport)", stats);
 }
 
+/// Benchmark: ParsedMessage generic vs single-pass structural parse
+void benchmark_structural_parse(size_t iterations, double freq_ghz) {
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    std::vector<double> generic_latencies;
+    std::vector<double> structural_latencies;
+    generic_latencies.reserve(iterations);
+    structural_latencies.reserve(iterations);
+
+    // Warmup
+    for (size_t i = 0; i < 1000; ++i) {
+        auto r1 = ParsedMessage::parse(data);
+        auto r2 = ParsedMessage::parse_structural(data);
+        (void)r1; (void)r2;
+    }
+
+    // Benchmark generic (scan_soh + find_equals per field + checksum pass)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = ParsedMessage::parse(data);
+        uint64_t end = rdtsc_end();
+
+        generic_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: ParsedMessage::parse failed\n";
+        }
+    }
+
+    // Benchmark single-pass structural index
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = ParsedMessage::parse_structural(data);
+        uint64_t end = rdtsc_end();
+
+        structural_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: ParsedMessage::parse_structural failed\n";
+        }
+    }
+
+    auto generic_stats = calculate_stats(generic_latencies);
+    auto structural_stats = calculate_stats(structural_latencies);
+    BenchResult& generic = print_stats("ParsedMessage::parse (ExecutionReport)", generic_stats);
+    BenchResult& structural = print_stats("ParsedMessage::parse_structural (ExecutionReport)", structural_stats);
+
+    // Per-message counters for the regression check (untimed passes)
+    MessageCounters counters;
+    counters.count(generic, iterations, [&] {
+        auto result = ParsedMessage::parse(data);
+        asm volatile("" :: "r"(&result) : "memory");
+    });
+    counters.count(structural, iterations, [&] {
+        auto result = ParsedMessage::parse_structural(data);
+        asm volatile("" :: "r"(&result) : "memory");
+    });
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << generic_stats.p50_ns / structural_stats.p50_ns << "x\n";
+}
+
+/// Benchmark: Parse + read 5 fields, eager vs lazy decoding
+/// Drop-copy pattern: only 35, 39, 11, 31, 32 are read from the message.
+void benchmark_lazy_parse(size_t iterations, double freq_ghz) {
+    // Drop-copy ExecutionReport: read fields early, long tail never read
+    static constexpr std::string_view DROP_COPY_BODY =
+        "8=FIX.4.4\x01" "9=300\x01" "35=8\x01" "49=SENDER\x01" "56=TARGET\x01"
+        "34=12345\x01" "52=20240115-10:30:00.123\x01" "11=CLORD001\x01"
+        "37=ORD123456\x01" "17=EXEC789012\x01" "150=F\x01" "39=1\x01"
+        "31=150.50\x01" "32=100\x01" "55=AAPL\x01" "54=1\x01" "38=1000\x01"
+        "44=150.50\x01" "151=900\x01" "14=100\x01" "6=150.50\x01"
+        "60=20240115-10:30:00.120\x01" "1=ACCOUNT01\x01" "30=XNAS\x01"
+        "59=0\x01" "40=2\x01" "58=drop copy\x01" "29=1\x01" "851=1\x01";
+    std::string msg = build_fix_message(DROP_COPY_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    std::vector<double> eager_latencies;
+    std::vector<double> lazy_latencies;
+    eager_latencies.reserve(iterations);
+    lazy_latencies.reserve(iterations);
+
+    auto read_fields = [](const auto& m) {
+        auto t = m.msg_type();
+        auto s = m.get_char(39);
+        auto c = m.get_string(11);
+        auto p = m.get_string(31);
+        auto q = m.get_string(32);
+        volatile size_t sink = static_cast<size_t>(t) + static_cast<size_t>(s) +
+                               c.size() + p.size() + q.size();
+        (void)sink;
+    };
+
+    // Warmup
+    for (size_t i = 0; i < 1000; ++i) {
+        auto r1 = ParsedMessage::parse_structural(data);
+        auto r2 = LazyParsedMessage::parse(data);
+        (void)r1; (void)r2;
+    }
+
+    // Benchmark eager (all fields materialized)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = ParsedMessage::parse_structural(data);
+        if (result) read_fields(*result);
+        uint64_t end = rdtsc_end();
+
+        eager_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: ParsedMessage::parse_structural failed\n";
+        }
+    }
+
+    // Benchmark lazy (tags decoded on lookup)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = LazyParsedMessage::parse(data);
+        if (result) read_fields(*result);
+        uint64_t end = rdtsc_end();
+
+        lazy_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: LazyParsedMessage::parse failed\n";
+        }
+    }
+
+    auto eager_stats = calculate_stats(eager_latencies);
+    auto lazy_stats = calculate_stats(lazy_latencies);
+    print_stats("Eager parse + 5 fields (drop-copy ExecReport)", eager_stats);
+    print_stats("LazyParsedMessage + 5 fields (drop-copy ExecReport)", lazy_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << eager_stats.p50_ns / lazy_stats.p50_ns << "x\n";
+}
+
+/// Benchmark: field reads from many messages held in flight
+/// 4096 ExecutionReports stay parsed (an order-state working set); each
+/// iteration reads three fields of a pseudo-random one. ParsedMessage
+/// spreads the fields over 24-byte FieldViews, CompactParsedMessage over
+/// 6-byte entries, so more of the working set stays in L1/L2.
+void benchmark_compact_in_flight(size_t iterations, double freq_ghz) {
+    constexpr size_t IN_FLIGHT = 4096;
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    std::vector<ParsedMessage> full(IN_FLIGHT);
+    std::vector<CompactParsedMessage> compact(IN_FLIGHT);
+    for (size_t i = 0; i < IN_FLIGHT; ++i) {
+        if (ParsedMessage::parse_into(data, full[i]).code != ParseErrorCode::None ||
+            CompactParsedMessage::parse_into(data, compact[i]).code != ParseErrorCode::None) {
+            std::cerr << "Error: in-flight parse failed\n";
+            return;
+        }
+    }
+
+    auto read_fields = [](const auto& m) {
+        auto e = m.get_string(17);
+        auto p = m.get_price(44);
+        auto s = m.get_char(39);
+        volatile size_t sink = e.size() + static_cast<size_t>(p.raw) + static_cast<size_t>(s);
+        (void)sink;
+    };
+
+    auto run = [&](const auto& messages) {
+        std::vector<double> latencies;
+        latencies.reserve(iterations);
+        uint32_t x = 2463534242u;
+        for (size_t i = 0; i < iterations; ++i) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            const auto& m = messages[x & (IN_FLIGHT - 1)];
+            uint64_t start = rdtsc_start();
+            read_fields(m);
+            uint64_t end = rdtsc_end();
+            latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+        }
+        return calculate_stats(latencies);
+    };
+
+    auto full_stats = run(full);
+    auto compact_stats = run(compact);
+    std::cout << "\n  sizeof(ParsedMessage) = " << sizeof(ParsedMessage)
+              << ", field bytes: " << full[0].field_count() * sizeof(FieldView)
+              << " vs " << compact[0].field_count() * sizeof(CompactParsedMessage::Field) << "\n";
+    print_stats("ParsedMessage, 3 fields of 4096 in flight", full_stats);
+    print_stats("CompactParsedMessage, 3 fields of 4096 in flight", compact_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << full_stats.p50_ns / compact_stats.p50_ns << "x\n";
+}
+
+/// Benchmark: ExecutionReport extraction, IndexedParser table vs parse_as<Schema>
+void benchmark_schema_parse(size_t iterations, double freq_ghz) {
+    using Schema = fix44::ExecutionReport::Schema;
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    std::vector<double> indexed_latencies;
+    std::vector<double> schema_latencies;
+    indexed_latencies.reserve(iterations);
+    schema_latencies.reserve(iterations);
+
+    // Warmup
+    for (size_t i = 0; i < 1000; ++i) {
+        auto r1 = IndexedParser::parse(data);
+        auto r2 = parse_as<Schema>(data);
+        (void)r1; (void)r2;
+    }
+
+    // Benchmark IndexedParser (perfect-hash field table, all tags)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = IndexedParser::parse(data);
+        uint64_t end = rdtsc_end();
+
+        indexed_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: IndexedParser::parse failed\n";
+        }
+    }
+
+    // Benchmark schema projection (listed tags only, fixed slots)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = parse_as<Schema>(data);
+        uint64_t end = rdtsc_end();
+
+        schema_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result) {
+            std::cerr << "Error: parse_as<ExecutionReport::Schema> failed\n";
+        }
+    }
+
+    auto indexed_stats = calculate_stats(indexed_latencies);
+    auto schema_stats = calculate_stats(schema_latencies);
+    print_stats("IndexedParser::parse (ExecutionReport)", indexed_stats);
+    print_stats("parse_as<ExecutionReport::Schema>", schema_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << indexed_stats.p50_ns / schema_stats.p50_ns << "x\n";
+}
+
+/// Benchmark: Generic header scan vs learned fixed-layout fast path
+void benchmark_header_predictor(size_t iterations, double freq_ghz) {
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+    HeaderLayoutPredictor predictor;
+
+    std::vector<double> generic_latencies;
+    std::vector<double> predicted_latencies;
+    generic_latencies.reserve(iterations);
+    predicted_latencies.reserve(iterations);
+
+    // Warmup (first call learns the layout)
+    for (size_t i = 0; i < 1000; ++i) {
+        auto r1 = parse_header(data);
+        auto r2 = predictor.parse(data);
+        (void)r1; (void)r2;
+    }
+
+    // Benchmark parse_header (FieldIterator + per-tag switch)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = parse_header(data);
+        uint64_t end = rdtsc_end();
+
+        generic_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result.ok()) {
+            std::cerr << "Error: parse_header failed\n";
+        }
+    }
+
+    // Benchmark speculative header (prefix + CompID memcmp)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = predictor.parse(data);
+        uint64_t end = rdtsc_end();
+
+        predicted_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+
+        if (!result.ok()) {
+            std::cerr << "Error: HeaderLayoutPredictor::parse failed\n";
+        }
+    }
+
+    auto generic_stats = calculate_stats(generic_latencies);
+    auto predicted_stats = calculate_stats(predicted_latencies);
+    print_stats("parse_header (ExecutionReport)", generic_stats);
+    print_stats("HeaderLayoutPredictor::parse (ExecutionReport)", predicted_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << generic_stats.p50_ns / predicted_stats.p50_ns << "x"
+              << " (hits: " << predictor.hits() << ", misses: " << predictor.misses() << ")\n";
+}
+
+/// Benchmark: One recv buffer holding a 40-message burst
+/// StreamParser framing + per-message parse vs a single parse_batch() call.
+void benchmark_batch_parse(size_t iterations, double freq_ghz) {
+    constexpr size_t BURST = 40;
+
+    std::string stream;
+    for (size_t seq = 1; seq <= BURST; ++seq) {
+        MessageAssembler assembler;
+        auto msg = assembler.start()
+            .field(tag::MsgType::value, '8')
+            .field(tag::SenderCompID::value, "BROKER")
+            .field(tag::TargetCompID::value, "CLIENT")
+            .field(tag::MsgSeqNum::value, static_cast<int64_t>(seq))
+            .field(tag::SendingTime::value, "20231215-10:30:00.000")
+            .field(tag::OrderID::value, "ORDER123")
+            .field(tag::ExecID::value, "EXEC456")
+            .field(tag::ExecType::value, '0')
+            .field(tag::OrdStatus::value, '0')
+            .field(tag::Symbol::value, "AAPL")
+            .field(tag::Side::value, '1')
+            .field(tag::LeavesQty::value, int64_t{100})
+            .field(tag::CumQty::value, int64_t{0})
+            .field(tag::AvgPx::value, "0")
+            .finish();
+        stream.append(msg.data(), msg.size());
+    }
+    std::span<const char> data{stream.data(), stream.size()};
+    std::vector<ParsedMessage> out(BURST);
+
+    iterations = std::max<size_t>(iterations / 10, 1);
+    std::vector<double> stream_latencies;
+    std::vector<double> batch_latencies;
+    stream_latencies.reserve(iterations);
+    batch_latencies.reserve(iterations);
+
+    auto stream_parse = [&]() {
+        StreamParser parser;
+        size_t offset = 0;
+        size_t parsed = 0;
+        while (offset < data.size()) {
+            size_t consumed = parser.feed(data.subspan(offset));
+            if (consumed == 0) break;
+            while (parser.has_message()) {
+                auto [start, end] = parser.next_message();
+                auto result = ParsedMessage::parse_structural(
+                    data.subspan(offset + start, end - start));
+                if (result) out[parsed++] = *result;
+            }
+            offset += consumed;
+        }
+        return parsed;
+    };
+
+    // Warmup
+    for (size_t i = 0; i < 100; ++i) {
+        (void)stream_parse();
+        (void)parse_batch(data, out);
+    }
+
+    // Benchmark StreamParser::feed + next_message + parse_structural
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        size_t parsed = stream_parse();
+        uint64_t end = rdtsc_end();
+
+        stream_latencies.push_back(cycles_to_ns(end - start, freq_ghz) / BURST);
+
+        if (parsed != BURST) {
+            std::cerr << "Error: StreamParser path parsed " << parsed << " messages\n";
+        }
+    }
+
+    // Benchmark parse_batch (BodyLength framing, parse in place)
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+        auto result = parse_batch(data, out);
+        uint64_t end = rdtsc_end();
+
+        batch_latencies.push_back(cycles_to_ns(end - start, freq_ghz) / BURST);
+
+        if (result.count != BURST) {
+            std::cerr << "Error: parse_batch parsed " << result.count << " messages\n";
+        }
+    }
+
+    auto stream_stats = calculate_stats(stream_latencies);
+    auto batch_stats = calculate_stats(batch_latencies);
+    print_stats("StreamParser + parse_structural (per msg, 40/recv)", stream_stats);
+    print_stats("parse_batch (per msg, 40/recv)", batch_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << stream_stats.p50_ns / batch_stats.p50_ns << "x\n";
+}
+
 /// Benchmark: Field access after parsing
 void benchmark_field_access(size_t iterations, double freq_ghz) {
     std::vector<double> latencies;
@@ -367,6 +770,97 @@ void benchmark_field_access(size_t iterations, double freq_ghz) {
     print_stats("Field Access (4 fields)", stats);
 }
 
+/// Benchmark: 5 fields from each of 200 MDEntries
+/// RepeatingGroupIterator (FieldIterator rescan per get_field) vs one
+/// RepeatingGroupIndex pass over a MonotonicPool.
+void benchmark_repeating_group_index(size_t iterations, double freq_ghz) {
+    constexpr size_t ENTRIES = 200;
+
+    std::string body = "8=FIX.4.4\x01" "9=9999\x01" "35=W\x01" "55=AAPL\x01" "268=200\x01";
+    for (size_t i = 0; i < ENTRIES; ++i) {
+        body += (i % 2 == 0) ? "269=0\x01" : "269=1\x01";
+        body += "270=" + std::to_string(150 + i % 50) + ".25\x01";
+        body += "271=" + std::to_string(100 + i) + "\x01";
+        body += "278=E" + std::to_string(i) + "\x01";
+        body += "290=" + std::to_string(i / 2 + 1) + "\x01";
+        body += "346=3\x01";
+    }
+    std::string msg = build_fix_message(body);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    static constexpr int FIELDS[] = {
+        tag::MDEntryType::value, tag::MDEntryPx::value, tag::MDEntrySize::value,
+        tag::MDEntryID::value, tag::NumberOfOrders::value
+    };
+
+    MonotonicPool<parser::RepeatingGroupIndex::storage_bytes(ENTRIES, 5) + 64> pool;
+    parser::RepeatingGroupIndex index{&pool};
+
+    auto read_scanning = [&]() {
+        int64_t acc = 0;
+        parser::RepeatingGroupIterator iter{data, tag::MDEntryType::value, ENTRIES};
+        while (iter.has_next()) {
+            auto entry = iter.next();
+            acc += entry.get_char(tag::MDEntryType::value);
+            acc += entry.get_price(tag::MDEntryPx::value).raw;
+            acc += entry.get_qty(tag::MDEntrySize::value).raw;
+            acc += static_cast<int64_t>(entry.get_string(tag::MDEntryID::value).size());
+            acc += entry.get_int(tag::NumberOfOrders::value).value_or(0);
+        }
+        return acc;
+    };
+
+    auto read_indexed = [&]() {
+        int64_t acc = 0;
+        pool.reset();
+        if (!index.build(data, tag::MDEntryType::value, ENTRIES, FIELDS)) return acc;
+        for (size_t i = 0; i < index.size(); ++i) {
+            auto entry = index[i];
+            acc += entry.get_char(tag::MDEntryType::value);
+            acc += entry.get_price(tag::MDEntryPx::value).raw;
+            acc += entry.get_qty(tag::MDEntrySize::value).raw;
+            acc += static_cast<int64_t>(entry.get_string(tag::MDEntryID::value).size());
+            acc += entry.get_int(tag::NumberOfOrders::value).value_or(0);
+        }
+        return acc;
+    };
+
+    if (read_scanning() != read_indexed()) {
+        std::cerr << "Error: RepeatingGroupIndex result mismatch\n";
+        return;
+    }
+
+    // Both paths are ~tens of microseconds per message; fewer rounds
+    const size_t rounds = std::max<size_t>(iterations / 100, 100);
+    std::vector<double> scan_latencies;
+    std::vector<double> index_latencies;
+    scan_latencies.reserve(rounds);
+    index_latencies.reserve(rounds);
+
+    for (size_t i = 0; i < rounds; ++i) {
+        uint64_t start = rdtsc_start();
+        volatile int64_t acc = read_scanning();
+        uint64_t end = rdtsc_end();
+        (void)acc;
+        scan_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    for (size_t i = 0; i < rounds; ++i) {
+        uint64_t start = rdtsc_start();
+        volatile int64_t acc = read_indexed();
+        uint64_t end = rdtsc_end();
+        (void)acc;
+        index_latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    auto scan_stats = calculate_stats(scan_latencies);
+    auto index_stats = calculate_stats(index_latencies);
+    print_stats("RepeatingGroupIterator (200 entries x 5 fields)", scan_stats);
+    print_stats("RepeatingGroupIndex (200 entries x 5 fields)", index_stats);
+    std::cout << "  Speedup (P50): " << std::setprecision(2)
+              << scan_stats.p50_ns / index_stats.p50_ns << "x\n";
+}
+
 /// Benchmark: Message boundary detection
 void benchmark_message_boundary(size_t iterations, double freq_ghz) {
     std::vector<double> latencies;
@@ -529,6 +1023,52 @@ void benchmark_int_parsing(size_t iterations, double freq_ghz) {
     print_stats("Integer Parsing", stats);
 }
 
+/// Benchmark: Tag number decoding (per-digit loop vs shared SWAR decoder)
+void benchmark_tag_decoding(size_t iterations, double freq_ghz) {
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    std::span<const char> data{msg.data(), msg.size()};
+
+    // Collect (start, len) of every tag in the message
+    std::vector<std::pair<size_t, size_t>> tags;
+    size_t field_start = 0;
+    bool in_tag = true;
+    for (size_t i = 0; i < msg.size(); ++i) {
+        if (in_tag && msg[i] == '=') {
+            tags.emplace_back(field_start, i - field_start);
+            in_tag = false;
+        } else if (msg[i] == '\x01') {
+            field_start = i + 1;
+            in_tag = true;
+        }
+    }
+
+    auto run = [&](const char* name, auto&& decode) {
+        std::vector<double> latencies;
+        latencies.reserve(iterations);
+        for (size_t i = 0; i < iterations; ++i) {
+            uint64_t start = rdtsc_start();
+            int sum = 0;
+            for (auto [s, len] : tags) sum += decode(s, len);
+            uint64_t end = rdtsc_end();
+            latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+            if (sum <= 0) std::cerr << "Error: Tag decode failed\n";
+        }
+        auto stats = calculate_stats(latencies);
+        print_stats(name, stats);
+    };
+
+    run("Tag Decode - Scalar (all tags in ExecutionReport)",
+        [&](size_t s, size_t len) { return parser::decode_tag_scalar(data.data() + s, len); });
+    run("Tag Decode - SWAR (all tags in ExecutionReport)",
+        [&](size_t s, size_t len) { return parser::decode_tag_swar(data, s, len); });
+#if defined(NFX_SSE41_TAG_DECODE)
+    run("Tag Decode - SSE4.1 (all tags in ExecutionReport)",
+        [&](size_t s, size_t len) { return parser::decode_tag_sse41(data, s, len); });
+#endif
+    run("Tag Decode - decode_tag dispatch (all tags in ExecutionReport)",
+        [&](size_t s, size_t len) { return parser::decode_tag(data, s, len); });
+}
+
 /// Benchmark: FixedPrice parsing
 void benchmark_price_parsing(size_t iterations, double freq_ghz) {
     std::vector<double> latencies;
@@ -799,7 +1339,7 @@ int main(int argc, char* argv[]) {
 
     size_t iterations = 100000;
 
-    if (argc > 1) {
+    if (argc > 1 && !std::string_view{argv[1]}.starts_with("--")) {
         iterations = std::stoul(argv[1]);
     }
 
@@ -816,12 +1356,20 @@ int main(int argc, char* argv[]) {
     // Run FIX 4.4 benchmarks
     std::cout << "\n--- FIX 4.4 Benchmarks ---\n";
     benchmark_indexed_parser(iterations, freq_ghz);
+    benchmark_structural_parse(iterations, freq_ghz);
+    benchmark_lazy_parse(iterations, freq_ghz);
+    benchmark_compact_in_flight(iterations, freq_ghz);
+    benchmark_schema_parse(iterations, freq_ghz);
+    benchmark_batch_parse(iterations, freq_ghz);
+    benchmark_header_predictor(iterations, freq_ghz);
     benchmark_field_access(iterations, freq_ghz);
+    benchmark_repeating_group_index(iterations, freq_ghz);
     benchmark_message_boundary(iterations, freq_ghz);
     benchmark_heartbeat_parse(iterations, freq_ghz);
     benchmark_new_order_parse(iterations, freq_ghz);
     benchmark_checksum(iterations, freq_ghz);
     benchmark_int_parsing(iterations, freq_ghz);
+    benchmark_tag_decoding(iterations, freq_ghz);
     benchmark_price_parsing(iterations, freq_ghz);
 
     // Run FIXT 1.1 / FIX 5.0 benchmarks
@@ -842,5 +1390,5 @@ int main(int argc, char* argv[]) {
     std::cout << "  similar performance (no regression)\n";
     std::cout << "========================================\n";
 
-    return 0;
+    return report().write_if_requested(argc, argv) ? 0 : 1;
 }
@@ -13,6 +13,7 @@
 #include <x86intrin.h>
 
 #include "nexusfix/sbe/sbe.hpp"
+#include "nexusfix/sbe/transcoder.hpp"
 #include "nexusfix/nexusfix.hpp"
 
 namespace nfx::bench {
@@ -45,7 +46,7 @@ inline double get_cpu_freq_ghz() noexcept {
 
     volatile uint64_t dummy = 0;
     for (int i = 0; i < 10000000; ++i) {
-        dummy += i;
+        dummy = dummy + i;
     }
 
     uint64_t end_cycles = rdtsc();
@@ -429,6 +430,160 @@ BenchmarkStats benchmark_sbe_dispatch(
     return calculate_stats(latencies);
 }
 
+// Build a checksum-valid FIX ExecutionReport matching prepare_sbe_exec_report
+std::vector<char> build_fix_exec_report() {
+    MessageAssembler asm_;
+    auto msg = fix44::ExecutionReport::Builder{}
+        .sender_comp_id("SENDER")
+        .target_comp_id("TARGET")
+        .msg_seq_num(1)
+        .sending_time("20240115-10:30:00.123")
+        .order_id("EX001")
+        .exec_id("EXEC001")
+        .exec_type(ExecType::PartialFill)
+        .ord_status(OrdStatus::PartiallyFilled)
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .leaves_qty(Qty::from_int(50))
+        .cum_qty(Qty::from_int(50))
+        .avg_px(FixedPrice::from_double(150.525))
+        .cl_ord_id("ORD001")
+        .order_qty(Qty::from_int(100))
+        .last_px(FixedPrice::from_double(150.55))
+        .last_qty(Qty::from_int(50))
+        .transact_time("20240115-10:30:00.123")
+        .build(asm_);
+    return std::vector<char>(msg.begin(), msg.end());
+}
+
+// Benchmark FIX text -> SBE transcode (schema-projected parse + single-pass encode)
+BenchmarkStats benchmark_transcode_fix_to_sbe(
+    const std::vector<char>& fix_msg,
+    size_t iterations, double freq_ghz) {
+
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+
+    alignas(8) char buffer[sbe::ExecutionReportCodec::TOTAL_SIZE];
+    std::span<const char> data{fix_msg.data(), fix_msg.size()};
+
+    // Warm up
+    for (size_t i = 0; i < 1000; ++i) {
+        auto parsed = parse_as<fix44::ExecutionReport::Schema>(data, '8');
+        auto encoded = sbe::transcode_execution_report(*parsed, buffer);
+        (void)encoded;
+    }
+
+    // Benchmark
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+
+        auto parsed = parse_as<fix44::ExecutionReport::Schema>(data, '8');
+        auto encoded = sbe::transcode_execution_report(*parsed, buffer);
+        (void)encoded;
+
+        uint64_t end = rdtsc_end();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    return calculate_stats(latencies);
+}
+
+// Benchmark FIX text -> domain object -> SBE (two-step baseline)
+BenchmarkStats benchmark_two_step_fix_to_sbe(
+    const std::vector<char>& fix_msg,
+    size_t iterations, double freq_ghz) {
+
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+
+    alignas(8) char buffer[sbe::ExecutionReportCodec::TOTAL_SIZE];
+    std::span<const char> data{fix_msg.data(), fix_msg.size()};
+
+    auto two_step = [&] {
+        auto er = fix44::ExecutionReport::from_buffer(data);
+        Timestamp ts;
+        (void)parse_utc_timestamp(er->transact_time, ts);
+        sbe::ExecutionReportCodec::wrapForEncode(buffer, sizeof(buffer))
+            .encodeHeader()
+            .orderId(er->order_id)
+            .execId(er->exec_id)
+            .clOrdId(er->cl_ord_id)
+            .symbol(er->symbol)
+            .side(er->side)
+            .execType(er->exec_type)
+            .ordStatus(er->ord_status)
+            .price(er->price)
+            .orderQty(er->order_qty)
+            .lastPx(er->last_px)
+            .lastQty(er->last_qty)
+            .leavesQty(er->leaves_qty)
+            .cumQty(er->cum_qty)
+            .avgPx(er->avg_px)
+            .transactTime(ts);
+    };
+
+    // Warm up
+    for (size_t i = 0; i < 1000; ++i) {
+        two_step();
+    }
+
+    // Benchmark
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+
+        two_step();
+
+        uint64_t end = rdtsc_end();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    return calculate_stats(latencies);
+}
+
+// Benchmark SBE -> FIX text transcode (outbound)
+BenchmarkStats benchmark_transcode_sbe_to_fix(
+    const char* buffer, size_t length,
+    size_t iterations, double freq_ghz) {
+
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+
+    MessageAssembler asm_;
+    UtcTimestampText ts_text;
+
+    auto transcode = [&] {
+        fix44::ExecutionReport::Builder builder;
+        (void)sbe::transcode_to_fix(
+            sbe::ExecutionReportCodec::wrapForDecode(buffer, length), builder, ts_text);
+        auto msg = builder
+            .sender_comp_id("SENDER")
+            .target_comp_id("TARGET")
+            .msg_seq_num(1)
+            .sending_time("20240115-10:30:00.123")
+            .build(asm_);
+        volatile auto size = msg.size();
+        (void)size;
+    };
+
+    // Warm up
+    for (size_t i = 0; i < 1000; ++i) {
+        transcode();
+    }
+
+    // Benchmark
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc_start();
+
+        transcode();
+
+        uint64_t end = rdtsc_end();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    return calculate_stats(latencies);
+}
+
 }  // namespace nfx::bench
 
 int main() {
@@ -481,6 +636,21 @@ int main() {
     auto fix_text = benchmark_fix_text_parse(SAMPLE_EXEC_REPORT, ITERATIONS, freq_ghz);
     print_stats("FIX Text Parse (ExecutionReport)", fix_text);
 
+    std::cout << "\n----------------------------------------\n";
+    std::cout << "FIX <-> SBE Transcode (gateway path)\n";
+    std::cout << "----------------------------------------\n";
+
+    auto fix_exec_report = build_fix_exec_report();
+    auto transcode_in = benchmark_transcode_fix_to_sbe(fix_exec_report, ITERATIONS, freq_ghz);
+    print_stats("Transcode FIX -> SBE (single pass)", transcode_in);
+
+    auto two_step = benchmark_two_step_fix_to_sbe(fix_exec_report, ITERATIONS, freq_ghz);
+    print_stats("FIX -> ExecutionReport -> SBE", two_step);
+
+    auto transcode_out = benchmark_transcode_sbe_to_fix(
+        sbe_buffer, sizeof(sbe_buffer), ITERATIONS, freq_ghz);
+    print_stats("Transcode SBE -> FIX", transcode_out);
+
     // Summary
     std::cout << "\n========================================\n";
     std::cout << "Performance Summary\n";
@@ -2,13 +2,21 @@
 // NexusFIX Session Throughput Benchmark
 // Target: 500K messages/second (vs QuickFIX 50K msg/s)
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "nexusfix/nexusfix.hpp"
+#include "nexusfix/store/mmap_message_store.hpp"
+#include "nexusfix/store/session_control_block.hpp"
+#include "nexusfix/store/tiered_message_store.hpp"
 
 namespace nfx::bench {
 
@@ -302,10 +310,8 @@ ThroughputStats benchmark_gap_tracker(size_t num_ops) {
 
     size_t operations = 0;
     for (size_t i = 0; i < num_ops / 10; ++i) {
-        if (tracker.gap_count() < GapTracker::MAX_GAPS - 1) {
-            tracker.add_gap(i * 10, i * 10 + 5);
-            ++operations;
-        }
+        tracker.add_gap(i * 10, i * 10 + 5);
+        ++operations;
         for (uint32_t j = i * 10; j <= i * 10 + 5; ++j) {
             tracker.fill(j);
             ++operations;
@@ -326,6 +332,35 @@ ThroughputStats benchmark_gap_tracker(size_t num_ops) {
     return stats;
 }
 
+/// Bad reconnect: every other seqnum missing, filled out of order
+ThroughputStats benchmark_gap_tracker_fragmented(size_t num_gaps) {
+    GapTracker tracker;
+    std::vector<uint32_t> order(num_gaps);
+    for (size_t i = 0; i < num_gaps; ++i) order[i] = static_cast<uint32_t>(i * 2 + 1);
+    std::mt19937 rng{42};
+    std::shuffle(order.begin(), order.end(), rng);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_gaps; ++i) {
+        // Each range one below the next: no merging
+        tracker.add_gap(static_cast<uint32_t>(i * 2 + 1), static_cast<uint32_t>(i * 2 + 1));
+    }
+    for (uint32_t seq : order) tracker.fill(seq);
+    auto end = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration<double>(end - start);
+    if (tracker.has_gaps()) std::cerr << "Gap tracker left ranges behind\n";
+
+    const size_t operations = num_gaps * 2;
+    ThroughputStats stats{};
+    stats.total_messages = operations;
+    stats.total_bytes = operations * sizeof(uint32_t);
+    stats.duration_sec = duration.count();
+    stats.messages_per_sec = operations / duration.count();
+    stats.bytes_per_sec = stats.total_bytes / duration.count();
+    stats.avg_latency_ns = (duration.count() * 1e9) / operations;
+    return stats;
+}
+
 // ============================================================================
 // Benchmark: Message Store
 // ============================================================================
@@ -368,6 +403,194 @@ ThroughputStats benchmark_message_store(size_t num_ops) {
     return stats;
 }
 
+// ============================================================================
+// Benchmark: Memory-Mapped Message Store
+// ============================================================================
+
+/// store() latency with the background flusher running, then reopen time
+ThroughputStats benchmark_mmap_message_store(size_t num_ops, double& recovery_ms) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "nfx_mmap_store_bench";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    std::string msg = build_fix_message(EXEC_REPORT_BODY);
+    store::MmapMessageStore::Config config{
+        .session_id = "BENCH",
+        .directory = dir.string(),
+        .journal_size = (num_ops + 1) * store::detail::record_span(msg.size()) + 4096,
+        .max_seq = num_ops + 2};
+
+    ThroughputStats stats{};
+    {
+        auto opened = store::MmapMessageStore::open(config);
+        if (!opened) {
+            std::cerr << "MmapMessageStore::open failed: " << opened.error().message() << "\n";
+            return stats;
+        }
+        auto& s = **opened;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 1; i <= num_ops; ++i) {
+            (void)s.store(static_cast<uint32_t>(i), std::span<const char>{msg.data(), msg.size()});
+        }
+        auto end = std::chrono::steady_clock::now();
+        stats.duration_sec = std::chrono::duration<double>(end - start).count();
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto reopened = store::MmapMessageStore::open(config);
+        auto end = std::chrono::steady_clock::now();
+        recovery_ms = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    fs::remove_all(dir);
+
+    stats.total_messages = num_ops;
+    stats.total_bytes = num_ops * msg.size();
+    stats.messages_per_sec = num_ops / stats.duration_sec;
+    stats.bytes_per_sec = stats.total_bytes / stats.duration_sec;
+    stats.avg_latency_ns = (stats.duration_sec * 1e9) / num_ops;
+    return stats;
+}
+
+// ============================================================================
+// Benchmark: Session Control Block Restart
+// ============================================================================
+
+/// Reopen num_sessions control blocks and restore their sequence state
+/// @return Total restart time in milliseconds
+double benchmark_control_block_restart(size_t num_sessions, double& update_ns) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "nfx_control_block_bench";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto config = [&](size_t i) {
+        std::string session_id{"S"};
+        session_id += std::to_string(i);
+        return store::SessionControlBlock::Config{.session_id = std::move(session_id),
+                                                  .directory = dir.string()};
+    };
+
+    {
+        std::vector<std::unique_ptr<store::SessionControlBlock>> blocks;
+        for (size_t i = 0; i < num_sessions; ++i) {
+            if (auto opened = store::SessionControlBlock::open(config(i))) {
+                blocks.push_back(std::move(*opened));
+            }
+        }
+        if (blocks.empty()) return 0;
+
+        // Per-message cost: one release store per seqnum change
+        constexpr uint32_t UPDATES = 1'000'000;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t seq = 1; seq <= UPDATES; ++seq) {
+            blocks[seq % blocks.size()]->set_next_sender_seq(seq);
+        }
+        auto end = std::chrono::steady_clock::now();
+        update_ns = std::chrono::duration<double, std::nano>(end - start).count() / UPDATES;
+    }
+
+    size_t restored = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_sessions; ++i) {
+        if (auto opened = store::SessionControlBlock::open(config(i)); opened && (*opened)->recovered()) {
+            SequenceManager sequences;
+            GapTracker gaps;
+            (*opened)->restore_sequences(sequences);
+            (*opened)->restore_gaps(gaps);
+            restored += sequences.current_outbound() != 0;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    fs::remove_all(dir);
+    if (restored != num_sessions) std::cerr << "Control block restore incomplete\n";
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// ============================================================================
+// Benchmark: Tiered Message Store
+// ============================================================================
+
+struct TieredStoreReport {
+    double raw_bytes_per_msg{0};
+    double stored_bytes_per_msg{0};   // Hot raw + cold compressed, after compact()
+    double cold_ratio{0};             // Raw / compressed bytes in the cold tier
+    double store_ns{0};               // store() including compaction, amortized
+    double hot_retrieve_ns{0};
+    double cold_retrieve_ns{0};       // Random cold seqnums (decompress per miss)
+};
+
+/// ExecutionReports whose ids, prices and times change per message
+std::string varied_exec_report(size_t i) {
+    static constexpr const char* SYMBOLS[] = {"AAPL", "MSFT", "NVDA", "AMZN", "GOOG", "META"};
+    const std::string body =
+        "35=8\x01" "49=SENDER\x01" "56=TARGET\x01" "34=" + std::to_string(i) + "\x01"
+        "52=20240115-10:" + std::to_string(10 + i / 60000 % 50) + ":" +
+        std::to_string(10 + i / 1000 % 50) + "." + std::to_string(100 + i % 900) + "\x01"
+        "37=ORD" + std::to_string(100000 + i) + "\x01" "17=EXEC" + std::to_string(500000 + i * 3) +
+        "\x01" "150=F\x01" "39=" + (i % 3 == 0 ? "2" : "1") + "\x01" "55=" + SYMBOLS[i % 6] +
+        "\x01" "54=" + std::to_string(1 + i % 2) + "\x01" "38=" + std::to_string(100 * (1 + i % 10)) +
+        "\x01" "44=" + std::to_string(100 + i % 200) + "." + std::to_string(10 + i % 90) + "\x01"
+        "32=100\x01" "31=" + std::to_string(100 + i % 200) + ".50\x01" "14=100\x01" "151=0\x01"
+        "6=" + std::to_string(100 + i % 200) + ".50\x01" "1=ACCT" + std::to_string(i % 4) + "\x01"
+        "59=0\x01" "60=20240115-10:30:00.123\x01";
+    return build_fix_message("8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body);
+}
+
+TieredStoreReport benchmark_tiered_message_store(size_t num_ops) {
+    TieredStoreReport report{};
+    num_ops = std::max<size_t>(num_ops, 20000);
+    store::TieredMessageStore s{"BENCH"};
+
+    std::vector<std::string> messages;
+    messages.reserve(num_ops);
+    size_t raw_bytes = 0;
+    for (size_t i = 1; i <= num_ops; ++i) {
+        messages.push_back(varied_exec_report(i));
+        raw_bytes += messages.back().size();
+    }
+
+    // Segments are compacted as they leave the hot tier (store() backpressure)
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 1; i <= num_ops; ++i) {
+        const std::string& msg = messages[i - 1];
+        (void)s.store(static_cast<uint32_t>(i), std::span<const char>{msg.data(), msg.size()});
+    }
+    (void)s.compact();
+    auto end = std::chrono::steady_clock::now();
+    const auto metrics = s.tier_metrics();
+    report.store_ns = std::chrono::duration<double, std::nano>(end - start).count() /
+                      static_cast<double>(num_ops);
+    report.cold_ratio = static_cast<double>(metrics.cold_raw_bytes) /
+                        static_cast<double>(metrics.cold_bytes);
+    report.raw_bytes_per_msg = static_cast<double>(raw_bytes) / static_cast<double>(num_ops);
+    report.stored_bytes_per_msg = static_cast<double>(metrics.hot_bytes + metrics.cold_bytes) /
+                                  static_cast<double>(num_ops);
+
+    constexpr size_t LOOKUPS = 10000;
+    size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < LOOKUPS; ++i) {
+        found += s.retrieve(static_cast<uint32_t>(num_ops - i % 1000)).has_value();
+    }
+    end = std::chrono::steady_clock::now();
+    report.hot_retrieve_ns = std::chrono::duration<double, std::nano>(end - start).count() / LOOKUPS;
+
+    uint32_t x = 12345;
+    const size_t cold_range = num_ops / 2;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < LOOKUPS / 10; ++i) {
+        x = x * 1664525u + 1013904223u;
+        found += s.retrieve(1 + x % static_cast<uint32_t>(cold_range)).has_value();
+    }
+    end = std::chrono::steady_clock::now();
+    report.cold_retrieve_ns =
+        std::chrono::duration<double, std::nano>(end - start).count() / (LOOKUPS / 10);
+    if (found == 0) std::cerr << "TieredMessageStore: no lookups succeeded\n";
+    return report;
+}
+
 // ============================================================================
 // Benchmark: Full Session Simulation
 // ============================================================================
@@ -421,6 +644,156 @@ ThroughputStats benchmark_session_simulation(size_t num_messages) {
     return stats;
 }
 
+// ============================================================================
+// Benchmark: Session Handler (std::function adapter vs concept handler)
+// ============================================================================
+
+/// Concept handler doing the same work as the callbacks below, inlinable
+/// into SessionManager
+struct CountingSessionHandler {
+    size_t* app_messages;
+    size_t* bytes_sent;
+
+    void on_app_message(const ParsedMessage&) noexcept { ++*app_messages; }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char> data) noexcept {
+        *bytes_sent += data.size();
+        return true;
+    }
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+/// Same counters behind SessionCallbacks (type-erased std::function calls)
+CallbackSessionHandler make_counting_callbacks(size_t& app_messages, size_t& bytes_sent) {
+    CallbackSessionHandler handler;
+    handler.callbacks.on_app_message = [&app_messages](const ParsedMessage&) { ++app_messages; };
+    handler.callbacks.on_send = [&bytes_sent](std::span<const char> data) {
+        bytes_sent += data.size();
+        return true;
+    };
+    return handler;
+}
+
+/// Build an inbound (BROKER -> CLIENT) message with correct BodyLength
+std::string build_session_message(std::string_view msg_type, uint32_t seq, std::string_view body) {
+    std::string fields = "35=" + std::string{msg_type} + "\x01" "49=BROKER\x01" "56=CLIENT\x01"
+                         "34=" + std::to_string(seq) + "\x01" "52=20240115-10:30:00.123\x01";
+    fields += body;
+    return build_fix_message(
+        "8=FIX.4.4\x01" "9=" + std::to_string(fields.size()) + "\x01" + fields);
+}
+
+SessionConfig benchmark_session_config() {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "BROKER";
+    return config;
+}
+
+/// Bring a session to Active with the counterparty Logon (seq 1)
+template <typename Handler>
+void logon_session(SessionManager<Handler>& session) {
+    session.on_connect();
+    [[maybe_unused]] auto sent = session.initiate_logon();
+    std::string logon = build_session_message("A", 1, "98=0\x01" "108=30\x01");
+    session.on_data_received(std::span<const char>{logon.data(), logon.size()});
+}
+
+/// Inbound path: parse, sequence check, MsgType dispatch, on_app_message
+/// A cycle of ExecutionReports (seq 2..N+1) ends with a SequenceReset back
+/// to 2, so the same buffers can be replayed without gaps.
+template <typename Handler>
+ThroughputStats benchmark_session_inbound(size_t num_messages, Handler handler) {
+    constexpr uint32_t CYCLE = 1024;
+    std::vector<std::string> msgs;
+    msgs.reserve(CYCLE + 1);
+    for (uint32_t seq = 2; seq < CYCLE + 2; ++seq) {
+        msgs.push_back(build_session_message("8", seq,
+            "37=ORD123456\x01" "17=EXEC789012\x01" "150=0\x01" "39=0\x01" "54=1\x01"
+            "151=1000\x01" "14=0\x01" "6=0\x01" "55=AAPL\x01" "38=1000\x01" "44=150.50\x01"));
+    }
+    msgs.push_back(build_session_message("4", CYCLE + 2, "36=2\x01"));
+
+    SessionManager<Handler> session{benchmark_session_config(), std::move(handler)};
+    logon_session(session);
+
+    for (size_t i = 0; i < 10000; ++i) {
+        const auto& msg = msgs[i % msgs.size()];
+        session.on_data_received(std::span<const char>{msg.data(), msg.size()});
+    }
+
+    // Restart on a cycle boundary (expected inbound is 2 again)
+    const size_t offset = 10000 % msgs.size();
+    for (size_t i = offset; i < msgs.size(); ++i) {
+        session.on_data_received(std::span<const char>{msgs[i].data(), msgs[i].size()});
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < num_messages; ++i) {
+        const auto& msg = msgs[i % msgs.size()];
+        session.on_data_received(std::span<const char>{msg.data(), msg.size()});
+        total_bytes += msg.size();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration<double>(end - start);
+
+    ThroughputStats stats{};
+    stats.total_messages = num_messages;
+    stats.total_bytes = total_bytes;
+    stats.duration_sec = duration.count();
+    stats.messages_per_sec = num_messages / duration.count();
+    stats.bytes_per_sec = total_bytes / duration.count();
+    stats.avg_latency_ns = (duration.count() * 1e9) / num_messages;
+
+    return stats;
+}
+
+/// Outbound path: stamp header, assemble NewOrderSingle, on_send
+template <typename Handler>
+ThroughputStats benchmark_session_send(size_t num_messages, Handler handler) {
+    SessionManager<Handler> session{benchmark_session_config(), std::move(handler)};
+    logon_session(session);
+
+    fix44::NewOrderSingle::Builder order;
+    order.cl_ord_id("ORD123456")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240115-10:30:00.123")
+        .order_qty(Qty::from_int(1000))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.50));
+
+    for (size_t i = 0; i < 10000; ++i) {
+        [[maybe_unused]] auto r = session.send_app_message(order);
+    }
+
+    const uint64_t bytes_before = session.stats().bytes_sent;
+    auto start = std::chrono::steady_clock::now();
+
+    size_t sent = 0;
+    for (size_t i = 0; i < num_messages; ++i) {
+        if (session.send_app_message(order)) ++sent;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration<double>(end - start);
+
+    ThroughputStats stats{};
+    stats.total_messages = sent;
+    stats.total_bytes = session.stats().bytes_sent - bytes_before;
+    stats.duration_sec = duration.count();
+    stats.messages_per_sec = sent / duration.count();
+    stats.bytes_per_sec = stats.total_bytes / duration.count();
+    stats.avg_latency_ns = (duration.count() * 1e9) / sent;
+
+    return stats;
+}
+
 } // namespace nfx::bench
 
 // ============================================================================
@@ -471,16 +844,79 @@ int main(int argc, char* argv[]) {
         print_throughput_stats("Gap Tracker Operations", stats);
     }
 
+    {
+        auto stats = benchmark_gap_tracker_fragmented(10000);
+        print_throughput_stats("Gap Tracker (10000 fragmented ranges)", stats);
+    }
+
     {
         auto stats = benchmark_message_store(num_messages);
         print_throughput_stats("Message Store (store+retrieve)", stats);
     }
 
+    {
+        double recovery_ms = 0;
+        auto stats = benchmark_mmap_message_store(num_messages, recovery_ms);
+        print_throughput_stats("Mmap Message Store (store, async flush)", stats);
+        std::cout << "  Reopen + recovery: " << std::fixed << std::setprecision(2)
+                  << recovery_ms << " ms\n";
+    }
+
+    {
+        double update_ns = 0;
+        const double restart_ms = benchmark_control_block_restart(500, update_ns);
+        std::cout << "\n=== Session Control Block ===\n";
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "  Restart, 500 sessions:  " << restart_ms << " ms\n";
+        std::cout << "  Seqnum update:          " << update_ns << " ns\n";
+    }
+
+    {
+        auto report = benchmark_tiered_message_store(num_messages);
+        std::cout << "\n=== Tiered Message Store (hot ring + compressed cold segments) ===\n";
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "  Raw bytes/message:      " << report.raw_bytes_per_msg << "\n";
+        std::cout << "  Stored bytes/message:   " << report.stored_bytes_per_msg << " ("
+                  << report.raw_bytes_per_msg / report.stored_bytes_per_msg << "x smaller)\n";
+        std::cout << "  Cold tier ratio:        " << report.cold_ratio << "x\n";
+        std::cout << "  Store + compaction:     " << report.store_ns << " ns/message\n";
+        std::cout << "  Hot retrieve:           " << report.hot_retrieve_ns << " ns\n";
+        std::cout << "  Cold retrieve (random): " << report.cold_retrieve_ns << " ns\n";
+    }
+
     {
         auto stats = benchmark_session_simulation(num_messages);
         print_throughput_stats("Full Session Simulation", stats);
     }
 
+    {
+        size_t app_messages = 0, bytes_sent = 0;
+        auto stats = benchmark_session_inbound(num_messages,
+            make_counting_callbacks(app_messages, bytes_sent));
+        print_throughput_stats("Session Inbound (std::function callbacks)", stats);
+    }
+
+    {
+        size_t app_messages = 0, bytes_sent = 0;
+        auto stats = benchmark_session_inbound(num_messages,
+            CountingSessionHandler{&app_messages, &bytes_sent});
+        print_throughput_stats("Session Inbound (concept handler)", stats);
+    }
+
+    {
+        size_t app_messages = 0, bytes_sent = 0;
+        auto stats = benchmark_session_send(num_messages,
+            make_counting_callbacks(app_messages, bytes_sent));
+        print_throughput_stats("Session Send (std::function callbacks)", stats);
+    }
+
+    {
+        size_t app_messages = 0, bytes_sent = 0;
+        auto stats = benchmark_session_send(num_messages,
+            CountingSessionHandler{&app_messages, &bytes_sent});
+        print_throughput_stats("Session Send (concept handler)", stats);
+    }
+
     std::cout << "\n";
     std::cout << "============================================\n";
     std::cout << "Target: Session throughput > 500K msg/sec\n";
@@ -0,0 +1,482 @@
+// session_scaling_bench.cpp
+// Session-count x core-count scaling of the session layer
+//
+// Runs 1 -> max_sessions SessionManagers spread round-robin over 1 -> N
+// pinned worker cores (the shared-nothing layout ShardedRuntime uses),
+// once with every session's MemoryMessageStore on the global allocator and
+// once with a private heap per session (memory::make_session_heap(), i.e.
+// SessionHeap when built with mimalloc). Each worker builds and logs on
+// its own sessions, then visits them in turn; one visit is
+//
+//   on_data_received(ExecutionReport) -> on_message(8) -> send_app_message(D)
+//
+// against an in-memory counterparty (no sockets), so what grows with the
+// session count is the working set every visit has to pull back in.
+//
+// Reported per configuration:
+//   aggregate msg/s          visits / wall time of the measured phase
+//   latency p50 / p99        one visit, all sessions merged
+//   per-session p99          median and worst of the sessions' own p99s
+//   LLC misses per visit     perf_event LLC read misses, summed over workers
+//                            (-1 when perf_event_open is not permitted)
+//   RSS per session          resident set growth / sessions (heaps, stores,
+//                            session objects and the harness's ~4 KiB
+//                            histogram; freed memory is trimmed between
+//                            configurations)
+//
+// A human-readable table goes to stdout and one JSON object per
+// configuration to the output file (JSON Lines), to keep next to the
+// release it was measured on.
+//
+// Usage:
+//   session_scaling_bench [max_sessions] [max_cores] [visits_per_session] [output.jsonl]
+//
+// Defaults: 1000 sessions, every core of CpuAffinityConfig::default_config(),
+// 1000 visits per session, session_scaling.jsonl. Session counts run
+// 1, 10, 100, 1000 (capped at max_sessions), core counts 1, 2, 4, ...
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include <unistd.h>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/memory/session_heap.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+#include "perf_counters.hpp"
+
+using namespace nfx;
+
+namespace {
+
+constexpr size_t STORE_POOL_SIZE = 256 * 1024;            // Per-session byte ring
+constexpr size_t SESSION_HEAP_SIZE = 2 * STORE_POOL_SIZE; // Ring + index + slack
+
+constexpr std::string_view EXEC_REPORT_BODY =
+    "37=O1\x01" "11=SCALE1\x01" "17=E1\x01" "150=0\x01" "39=0\x01" "55=AAPL\x01" "54=1\x01"
+    "38=100\x01" "44=150.25\x01" "151=100\x01" "14=0\x01" "6=0\x01";
+
+// ============================================================================
+// Counterparty
+// ============================================================================
+
+/// Venue side of one session: messages with a fixed-width MsgSeqNum that is
+/// patched in place (and the checksum adjusted), so producing the next
+/// ExecutionReport costs a few stores instead of formatting a message
+class ReportStream {
+public:
+    static constexpr size_t SEQ_DIGITS = 10;
+
+    ReportStream(std::string_view sender, std::string_view target) : sender_{sender}, target_{target} {}
+
+    /// Logon ack (MsgSeqNum 1)
+    [[nodiscard]] std::span<const char> logon() {
+        build("A", "98=0\x01" "108=30\x01");
+        return stamp();
+    }
+
+    /// Next ExecutionReport (must follow logon())
+    [[nodiscard]] std::span<const char> next() noexcept {
+        if (!built_report_) {
+            build("8", EXEC_REPORT_BODY);
+            built_report_ = true;
+        }
+        return stamp();
+    }
+
+private:
+    void build(std::string_view msg_type, std::string_view body) {
+        std::string fields{"35="};
+        fields.append(msg_type);
+        fields.append("\x01" "49=").append(sender_);
+        fields.append("\x01" "56=").append(target_);
+        fields.append("\x01" "34=");
+        const size_t seq_in_fields = fields.size();
+        fields.append(SEQ_DIGITS, '0');
+        fields.append("\x01" "52=20240102-09:30:00.000\x01");
+        fields.append(body);
+
+        buffer_.assign("8=FIX.4.4\x01" "9=");
+        buffer_.append(std::to_string(fields.size()));
+        buffer_.push_back('\x01');
+        seq_offset_ = buffer_.size() + seq_in_fields;
+        buffer_.append(fields);
+
+        base_sum_ = 0;
+        for (char c : buffer_) base_sum_ += static_cast<uint8_t>(c);
+        base_sum_ -= SEQ_DIGITS * '0';
+        buffer_.append("10=000\x01");
+    }
+
+    std::span<const char> stamp() noexcept {
+        uint64_t v = seq_++;
+        uint32_t sum = base_sum_;
+        for (size_t i = SEQ_DIGITS; i-- > 0;) {
+            const char d = static_cast<char>('0' + v % 10);
+            v /= 10;
+            buffer_[seq_offset_ + i] = d;
+            sum += static_cast<uint8_t>(d);
+        }
+        const uint32_t cs = sum % 256;
+        char* trailer = buffer_.data() + buffer_.size() - 4;
+        trailer[0] = static_cast<char>('0' + cs / 100);
+        trailer[1] = static_cast<char>('0' + cs / 10 % 10);
+        trailer[2] = static_cast<char>('0' + cs % 10);
+        return {buffer_.data(), buffer_.size()};
+    }
+
+    std::string sender_;
+    std::string target_;
+    std::string buffer_;
+    size_t seq_offset_{0};
+    uint32_t base_sum_{0};
+    uint64_t seq_{1};
+    bool built_report_{false};
+};
+
+// ============================================================================
+// Session Under Test
+// ============================================================================
+
+struct ScalingHandler : NullSessionHandler {
+    uint64_t bytes_sent{0};
+    uint64_t reports{0};
+
+    bool on_send(std::span<const char> data) noexcept {
+        bytes_sent += data.size();
+        return true;
+    }
+
+    void on_message(MsgTypeTag<'8'>, const ParsedMessage&) noexcept { ++reports; }
+};
+
+/// One session with its heap, store and counterparty, built on its worker
+struct ScalingSession {
+    ScalingSession(size_t index, bool isolated_heap, size_t max_messages)
+        : sender{"SCALE" + std::to_string(index)}
+        , heap{isolated_heap ? memory::make_session_heap(SESSION_HEAP_SIZE) : nullptr}
+        , store{store::MemoryMessageStore::Config{
+              .session_id = sender,
+              .max_messages = max_messages,
+              .pool_size_bytes = STORE_POOL_SIZE,
+              .upstream_resource = heap.get(),
+              .single_writer = true,
+          }}
+        , session{config(sender), ScalingHandler{}}
+        , venue{"VENUE", sender} {
+        session.set_message_store(&store);
+    }
+
+    [[nodiscard]] static SessionConfig config(std::string_view sender) noexcept {
+        SessionConfig c;
+        c.sender_comp_id = sender;
+        c.target_comp_id = "VENUE";
+        return c;
+    }
+
+    [[nodiscard]] bool logon() {
+        session.on_connect();
+        if (!session.initiate_logon()) return false;
+        session.on_data_received(venue.logon());
+        return session.state() == SessionState::Active;
+    }
+
+    /// ExecutionReport in, order out
+    void visit() noexcept {
+        session.on_data_received(venue.next());
+        session.end_receive_batch();
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("SCALE1")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25));
+        (void)session.send_app_message(order);
+    }
+
+    std::string sender;
+    std::unique_ptr<std::pmr::memory_resource> heap;
+    store::MemoryMessageStore store;
+    SessionManager<ScalingHandler> session;
+    ReportStream venue;
+    LatencyHistogram latency;
+};
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+struct RunConfig {
+    size_t sessions;
+    size_t cores;
+    bool isolated_heap;
+    size_t visits;               // Measured visits per session
+    size_t warmup;               // Unmeasured visits per session first
+};
+
+struct WorkerResult {
+    LatencyHistogram latency;
+    std::vector<uint64_t> session_p99;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+    uint64_t visits{0};
+    uint64_t llc_misses{0};
+    bool llc_valid{false};
+    bool ok{true};
+};
+
+struct RunResult {
+    RunConfig config{};
+    double elapsed_sec{0};
+    uint64_t visits{0};
+    LatencyHistogram latency;
+    uint64_t session_p99_median{0};
+    uint64_t session_p99_max{0};
+    int64_t llc_misses{-1};
+    int64_t rss_per_session{0};
+    bool ok{true};
+};
+
+[[nodiscard]] int64_t resident_bytes() {
+    std::ifstream statm{"/proc/self/statm"};
+    int64_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<int64_t>(::sysconf(_SC_PAGESIZE));
+}
+
+/// Build sessions first + k * stride, run them, report; sessions live until released
+void worker(const RunConfig& rc, size_t first, size_t stride, int core,
+            std::latch& built, std::latch& done, std::latch& release, WorkerResult& out) {
+    (void)util::CpuAffinity::pin_to_core(core);
+
+    std::vector<std::unique_ptr<ScalingSession>> sessions;
+    for (size_t i = first; i < rc.sessions; i += stride) {
+        sessions.push_back(std::make_unique<ScalingSession>(i, rc.isolated_heap, rc.visits + rc.warmup + 16));
+        out.ok &= sessions.back()->logon();
+    }
+    for (size_t v = 0; v < rc.warmup; ++v) {
+        for (auto& s : sessions) s->visit();
+    }
+
+    bench::PerfCounterGroup perf;
+    out.llc_valid = perf.add(bench::PerfEvent::LLCReadMiss);
+
+    built.arrive_and_wait();
+    out.start = std::chrono::steady_clock::now();
+    perf.start();
+    for (size_t v = 0; v < rc.visits; ++v) {
+        for (auto& s : sessions) {
+            const uint64_t start = util::RdtscClock::now_ns();
+            s->visit();
+            s->latency.record(util::RdtscClock::now_ns() - start);
+        }
+    }
+    perf.stop();
+    out.end = std::chrono::steady_clock::now();
+    done.count_down();
+
+    for (const auto& r : perf.read()) {
+        if (r.valid) out.llc_misses += r.value;
+        out.llc_valid &= r.valid;
+    }
+    for (auto& s : sessions) {
+        out.latency.merge(s->latency);
+        out.session_p99.push_back(s->latency.percentile(99.0));
+        out.visits += s->latency.count();
+        out.ok &= s->session.handler().reports == rc.visits + rc.warmup;
+    }
+    release.wait();   // RSS is read with every session still alive
+}
+
+[[nodiscard]] RunResult run(const RunConfig& rc, const std::vector<int>& cores) {
+#if defined(__GLIBC__)
+    ::malloc_trim(0);
+#endif
+    const int64_t rss_before = resident_bytes();
+
+    std::vector<WorkerResult> results(rc.cores);
+    std::latch built{static_cast<std::ptrdiff_t>(rc.cores + 1)};
+    std::latch done{static_cast<std::ptrdiff_t>(rc.cores)};
+    std::latch release{1};
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < rc.cores; ++w) {
+        threads.emplace_back(worker, std::cref(rc), w, rc.cores, cores[w],
+                             std::ref(built), std::ref(done), std::ref(release), std::ref(results[w]));
+    }
+
+    built.arrive_and_wait();
+    done.wait();
+    const int64_t rss_after = resident_bytes();   // Sessions stay alive until release
+    release.count_down();
+    for (auto& t : threads) t.join();
+
+    // Measured phase: first worker starting to last one finishing
+    RunResult result;
+    result.config = rc;
+    auto start = results.front().start;
+    auto end = results.front().end;
+    for (const auto& w : results) {
+        start = std::min(start, w.start);
+        end = std::max(end, w.end);
+    }
+    result.elapsed_sec = std::chrono::duration<double>(end - start).count();
+
+    result.rss_per_session = (rss_after - rss_before) / static_cast<int64_t>(rc.sessions);
+    std::vector<uint64_t> p99s;
+    bool llc_valid = true;
+    uint64_t llc = 0;
+    for (const auto& w : results) {
+        result.latency.merge(w.latency);
+        p99s.insert(p99s.end(), w.session_p99.begin(), w.session_p99.end());
+        result.visits += w.visits;
+        llc += w.llc_misses;
+        llc_valid &= w.llc_valid;
+        result.ok &= w.ok;
+    }
+    if (llc_valid) result.llc_misses = static_cast<int64_t>(llc);
+    std::sort(p99s.begin(), p99s.end());
+    if (!p99s.empty()) {
+        result.session_p99_median = p99s[p99s.size() / 2];
+        result.session_p99_max = p99s.back();
+    }
+    return result;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void print_header() {
+    std::cout << std::right
+              << std::setw(9) << "sessions" << std::setw(7) << "cores" << std::setw(10) << "heap"
+              << std::setw(13) << "msg/s" << std::setw(9) << "p50" << std::setw(10) << "p99"
+              << std::setw(12) << "sess p99" << std::setw(12) << "sess p99"
+              << std::setw(11) << "LLC miss" << std::setw(12) << "RSS/sess" << "\n"
+              << std::setw(9) << "" << std::setw(7) << "" << std::setw(10) << ""
+              << std::setw(13) << "" << std::setw(9) << "(ns)" << std::setw(10) << "(ns)"
+              << std::setw(12) << "med (ns)" << std::setw(12) << "max (ns)"
+              << std::setw(11) << "/msg" << std::setw(12) << "(KiB)" << "\n";
+}
+
+[[nodiscard]] double llc_per_visit(const RunResult& r) {
+    return r.llc_misses < 0 || r.visits == 0
+        ? -1.0 : static_cast<double>(r.llc_misses) / static_cast<double>(r.visits);
+}
+
+void print_row(const RunResult& r) {
+    std::cout << std::right << std::fixed
+              << std::setw(9) << r.config.sessions << std::setw(7) << r.config.cores
+              << std::setw(10) << (r.config.isolated_heap ? "isolated" : "shared")
+              << std::setw(13) << std::setprecision(0) << static_cast<double>(r.visits) / r.elapsed_sec
+              << std::setw(9) << r.latency.percentile(50.0) << std::setw(10) << r.latency.percentile(99.0)
+              << std::setw(12) << r.session_p99_median << std::setw(12) << r.session_p99_max
+              << std::setw(11) << std::setprecision(2) << llc_per_visit(r)
+              << std::setw(12) << std::setprecision(1) << static_cast<double>(r.rss_per_session) / 1024.0
+              << (r.ok ? "" : "  (session errors)") << "\n";
+}
+
+void write_json(std::ostream& out, const RunResult& r) {
+    out << std::fixed << std::setprecision(3)
+        << "{\"bench\":\"session_scaling\""
+        << ",\"sessions\":" << r.config.sessions
+        << ",\"cores\":" << r.config.cores
+        << ",\"heap\":\"" << (r.config.isolated_heap ? "isolated" : "shared") << "\""
+        << ",\"visits\":" << r.visits
+        << ",\"elapsed_sec\":" << r.elapsed_sec
+        << ",\"msgs_per_sec\":" << static_cast<double>(r.visits) / r.elapsed_sec
+        << ",\"latency_p50_ns\":" << r.latency.percentile(50.0)
+        << ",\"latency_p99_ns\":" << r.latency.percentile(99.0)
+        << ",\"latency_max_ns\":" << r.latency.max()
+        << ",\"session_p99_median_ns\":" << r.session_p99_median
+        << ",\"session_p99_max_ns\":" << r.session_p99_max
+        << ",\"llc_misses\":";
+    if (r.llc_misses < 0) out << "null"; else out << r.llc_misses;
+    out << ",\"llc_misses_per_msg\":";
+    if (r.llc_misses < 0) out << "null"; else out << llc_per_visit(r);
+    out << ",\"rss_bytes_per_session\":" << r.rss_per_session
+        << ",\"session_object_bytes\":" << sizeof(SessionManager<ScalingHandler>)
+        << ",\"ok\":" << (r.ok ? "true" : "false") << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::vector<int> all_cores = util::CpuAffinityConfig::default_config().allowed_cores;
+    const size_t max_sessions = argc > 1 ? std::max<size_t>(1, std::stoul(argv[1])) : 1000;
+    const size_t max_cores = std::min(argc > 2 ? std::max<size_t>(1, std::stoul(argv[2])) : all_cores.size(),
+                                      all_cores.size());
+    const size_t visits = argc > 3 ? std::max<size_t>(1, std::stoul(argv[3])) : 1000;
+    const std::string output = argc > 4 ? argv[4] : "session_scaling.jsonl";
+
+    std::vector<size_t> session_counts;
+    for (size_t n = 1; n < max_sessions; n *= 10) session_counts.push_back(n);
+    session_counts.push_back(max_sessions);
+    std::vector<size_t> core_counts;
+    for (size_t c = 1; c < max_cores; c *= 2) core_counts.push_back(c);
+    core_counts.push_back(max_cores);
+
+    std::cout << "NexusFIX Session Scaling Benchmark\n";
+    std::cout << "==================================\n";
+    std::cout << "  Sessions:    up to " << max_sessions << ", " << visits << " visits each (+"
+              << std::max<size_t>(1, visits / 10) << " warmup)\n";
+    std::cout << "  Cores:       up to " << max_cores << " of";
+    for (int c : all_cores) std::cout << " " << c;
+    std::cout << "\n";
+    std::cout << "  Heaps:       shared (global allocator) vs isolated ("
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+              << "SessionHeap"
+#else
+              << "monotonic pmr; build with mimalloc for SessionHeap"
+#endif
+              << ")\n";
+    std::cout << "  Output:      " << output << "\n\n";
+
+    std::ofstream json{output};
+    if (!json) {
+        std::cerr << "Cannot write " << output << "\n";
+        return 1;
+    }
+
+    util::RdtscClock::initialize();
+    print_header();
+    bool ok = true;
+    for (size_t sessions : session_counts) {
+        for (size_t cores : core_counts) {
+            if (cores > sessions) continue;
+            for (bool isolated : {false, true}) {
+                const RunConfig rc{sessions, cores, isolated, visits, std::max<size_t>(1, visits / 10)};
+                const RunResult r = run(rc, all_cores);
+                print_row(r);
+                write_json(json, r);
+                ok &= r.ok;
+            }
+        }
+    }
+
+    std::cout << "\nLatency buckets are within 6.25% of the recorded value; "
+                 "LLC misses of -1 mean perf_event_open was not permitted.\n";
+    return ok ? 0 : 1;
+}
@@ -1,5 +1,5 @@
 // Benchmark: SIMD FIX Checksum Performance
-// Compares scalar vs SSE2 vs AVX2 vs AVX-512 checksum calculation
+// Compares scalar vs SSE2 vs AVX2 vs AVX-512 vs NEON/SVE checksum calculation
 //
 // Build: cmake --build build && ./build/bin/benchmarks/simd_checksum_bench
 
@@ -27,11 +27,17 @@ constexpr size_t SMALL_MSG = 64;    // Heartbeat
 constexpr size_t MEDIUM_MSG = 256;  // NewOrderSingle
 constexpr size_t LARGE_MSG = 1024;  // ExecutionReport with fills
 
-// RDTSC for precise timing
+// RDTSC for precise timing (AArch64: generic timer, calibrated below)
 inline uint64_t rdtsc() {
+#if defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+    return ticks;
+#else
     uint64_t lo, hi;
     asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
     return (hi << 32) | lo;
+#endif
 }
 
 // Get CPU frequency
@@ -40,7 +46,11 @@ double get_cpu_freq_ghz() {
     uint64_t start_tsc = rdtsc();
 
     while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+#if defined(__aarch64__)
+        asm volatile("yield");
+#else
         asm volatile("pause");
+#endif
     }
 
     auto end = std::chrono::steady_clock::now();
@@ -144,6 +154,16 @@ int main() {
 #else
     std::cout << "  SSE2:    Not available\n";
 #endif
+#if NFX_NEON_AVAILABLE
+    std::cout << "  NEON:    Available\n";
+#else
+    std::cout << "  NEON:    Not available\n";
+#endif
+#if NFX_SVE_AVAILABLE
+    std::cout << "  SVE:     Available (" << svcntb() * 8 << "-bit)\n";
+#else
+    std::cout << "  SVE:     Not available\n";
+#endif
 
     std::cout << "\nConfiguration:\n";
     std::cout << "  Warmup:     " << WARMUP_ITERATIONS << " iterations\n";
@@ -172,6 +192,12 @@ int main() {
 #endif
 #if defined(NFX_AVX512_CHECKSUM)
     benchmark_checksum("AVX-512", checksum_avx512, small_msg.data(), SMALL_MSG, cpu_freq_ghz);
+#endif
+#if NFX_NEON_AVAILABLE
+    benchmark_checksum("NEON", checksum_neon, small_msg.data(), SMALL_MSG, cpu_freq_ghz);
+#endif
+#if NFX_SVE_AVAILABLE
+    benchmark_checksum("SVE", checksum_sve, small_msg.data(), SMALL_MSG, cpu_freq_ghz);
 #endif
     benchmark_checksum("Auto", static_cast<uint8_t(*)(const char*, size_t)>(checksum), small_msg.data(), SMALL_MSG, cpu_freq_ghz);
 
@@ -193,6 +219,12 @@ int main() {
 #endif
 #if defined(NFX_AVX512_CHECKSUM)
     benchmark_checksum("AVX-512", checksum_avx512, medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
+#endif
+#if NFX_NEON_AVAILABLE
+    benchmark_checksum("NEON", checksum_neon, medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
+#endif
+#if NFX_SVE_AVAILABLE
+    benchmark_checksum("SVE", checksum_sve, medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
 #endif
     benchmark_checksum("Auto", static_cast<uint8_t(*)(const char*, size_t)>(checksum), medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
 
@@ -214,9 +246,37 @@ int main() {
 #endif
 #if defined(NFX_AVX512_CHECKSUM)
     benchmark_checksum("AVX-512", checksum_avx512, large_msg.data(), LARGE_MSG, cpu_freq_ghz);
+#endif
+#if NFX_NEON_AVAILABLE
+    benchmark_checksum("NEON", checksum_neon, large_msg.data(), LARGE_MSG, cpu_freq_ghz);
+#endif
+#if NFX_SVE_AVAILABLE
+    benchmark_checksum("SVE", checksum_sve, large_msg.data(), LARGE_MSG, cpu_freq_ghz);
 #endif
     benchmark_checksum("Auto", static_cast<uint8_t(*)(const char*, size_t)>(checksum), large_msg.data(), LARGE_MSG, cpu_freq_ghz);
 
+    // ========================================================================
+    // In-Place Patch (21-byte SendingTime rewrite)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  In-Place Patch (21-byte field, delta vs full re-sum)\n";
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "  Method        Latency    Cycles   Throughput\n";
+
+    {
+        constexpr std::string_view NEW_TIME = "20260123-10:31:59.999";
+        const uint8_t before = checksum(medium_msg.data(), MEDIUM_MSG);
+        auto delta = [before, NEW_TIME](const char* data, size_t) noexcept {
+            return adjust_checksum(before, std::string_view{data + 40, NEW_TIME.size()}, NEW_TIME);
+        };
+        benchmark_checksum("Delta", delta, medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
+        benchmark_checksum("Full 256B", static_cast<uint8_t(*)(const char*, size_t)>(checksum),
+                           medium_msg.data(), MEDIUM_MSG, cpu_freq_ghz);
+        benchmark_checksum("Full 1024B", static_cast<uint8_t(*)(const char*, size_t)>(checksum),
+                           large_msg.data(), LARGE_MSG, cpu_freq_ghz);
+    }
+
     // ========================================================================
     // Verify Correctness
     // ========================================================================
@@ -250,9 +310,10 @@ int main() {
     std::cout << "  2. checksum_sse2() - 16 bytes/iteration (SSE2)\n";
     std::cout << "  3. checksum_avx2() - 32 bytes/iteration (AVX2)\n";
     std::cout << "  4. checksum_avx512() - 64 bytes/iteration (AVX-512)\n";
-    std::cout << "  5. checksum() - Auto-dispatch to best available\n";
-    std::cout << "  6. IncrementalChecksum - Streaming checksum\n";
-    std::cout << "  7. validate_fix_checksum() - Full message validation\n";
+    std::cout << "  5. checksum_neon() / checksum_sve() - AArch64 (NEON, SVE)\n";
+    std::cout << "  6. checksum() - Auto-dispatch to best available\n";
+    std::cout << "  7. IncrementalChecksum - Streaming checksum\n";
+    std::cout << "  8. validate_fix_checksum() - Full message validation\n";
 
     std::cout << "\nKey Optimizations:\n";
     std::cout << "  - Uses PSADBW (SAD) instruction for parallel byte sum\n";
@@ -1,8 +1,9 @@
-// Benchmark: SIMD SOH Scanner (Scalar vs AVX2 vs AVX-512)
+// Benchmark: SIMD SOH Scanner (Scalar vs AVX2 vs AVX-512 vs NEON/SVE)
 // Compares performance of different SIMD implementations
 //
 // Build: g++ -std=c++23 -O3 -march=native -mavx2 simd_scanner_bench.cpp -o simd_scanner_bench
 // With AVX-512: g++ -std=c++23 -O3 -march=native -mavx512f -mavx512bw simd_scanner_bench.cpp -o simd_scanner_bench
+// AArch64:      g++ -std=c++23 -O3 -mcpu=native simd_scanner_bench.cpp -o simd_scanner_bench
 
 #include <iostream>
 #include <iomanip>
@@ -14,8 +15,10 @@
 #include <cstring>
 #include <cmath>
 
-// Define NFX_HAS_SIMD before including
+// Define NFX_HAS_SIMD before including (x86 AVX2 path; NEON is detected)
+#if !defined(__aarch64__)
 #define NFX_HAS_SIMD 1
+#endif
 #include "../include/nexusfix/interfaces/i_message.hpp"
 #include "../include/nexusfix/memory/buffer_pool.hpp"
 #include "../include/nexusfix/parser/simd_scanner.hpp"
@@ -25,11 +28,17 @@ constexpr int WARMUP_ITERATIONS = 1000;
 constexpr int BENCHMARK_ITERATIONS = 100000;
 constexpr int NUM_RUNS = 5;
 
-// RDTSC for precise timing
+// RDTSC for precise timing (AArch64: generic timer, calibrated below)
 inline uint64_t rdtsc() {
+#if defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+    return ticks;
+#else
     uint64_t lo, hi;
     asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
     return (hi << 32) | lo;
+#endif
 }
 
 // Get CPU frequency
@@ -38,7 +47,11 @@ double get_cpu_freq_ghz() {
     uint64_t start_tsc = rdtsc();
 
     while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+#if defined(__aarch64__)
+        asm volatile("yield");
+#else
         asm volatile("pause");
+#endif
     }
 
     auto end = std::chrono::steady_clock::now();
@@ -131,6 +144,11 @@ int main() {
     std::cout << "SIMD Features:\n";
     std::cout << "  NFX_SIMD_AVAILABLE:   " << NFX_SIMD_AVAILABLE << "\n";
     std::cout << "  NFX_AVX512_AVAILABLE: " << NFX_AVX512_AVAILABLE << "\n";
+    std::cout << "  NFX_NEON_AVAILABLE:   " << NFX_NEON_AVAILABLE << "\n";
+    std::cout << "  NFX_SVE_AVAILABLE:    " << NFX_SVE_AVAILABLE << "\n";
+#if NFX_SVE_AVAILABLE
+    std::cout << "  SVE vector length:    " << svcntb() * 8 << " bits\n";
+#endif
 
     std::cout << "\nCalibrating CPU frequency...\n";
     double cpu_freq_ghz = get_cpu_freq_ghz();
@@ -166,6 +184,10 @@ int main() {
 #if NFX_AVX512_AVAILABLE
             auto r3 = nfx::simd::scan_soh_avx512(span);
             asm volatile("" :: "r"(r3.count));
+#endif
+#if NFX_NEON_AVAILABLE
+            auto r4 = nfx::simd::scan_soh_neon(span);
+            asm volatile("" :: "r"(r4.count));
 #endif
         }
 
@@ -242,6 +264,89 @@ int main() {
         std::cout << "  AVX-512 speedup (vs scalar): " << std::fixed << std::setprecision(2) << avx512_speedup << "x\n";
         std::cout << "  AVX-512 speedup (vs AVX2):   " << avx512_vs_avx2 << "x\n";
 #endif
+
+#if NFX_NEON_AVAILABLE
+        // Benchmark NEON
+        std::vector<BenchmarkResult> neon_results;
+        for (int run = 0; run < NUM_RUNS; ++run) {
+            neon_results.push_back(benchmark_scan(
+                nfx::simd::scan_soh_neon, span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+        }
+
+        BenchmarkResult neon_avg{};
+        for (const auto& r : neon_results) {
+            neon_avg.mean_ns += r.mean_ns;
+            neon_avg.median_ns += r.median_ns;
+            neon_avg.throughput_gbps += r.throughput_gbps;
+        }
+        neon_avg.mean_ns /= NUM_RUNS;
+        neon_avg.median_ns /= NUM_RUNS;
+        neon_avg.throughput_gbps /= NUM_RUNS;
+        neon_avg.bytes_processed = size;
+
+        print_result("NEON", neon_avg);
+
+        double neon_speedup = scalar_avg.mean_ns / neon_avg.mean_ns;
+        std::cout << "  NEON speedup: " << std::fixed << std::setprecision(2) << neon_speedup << "x\n";
+#endif
+    }
+
+    // ------------------------------------------------------------------------
+    // find_soh / count_soh per backend (first SOH placed at the end)
+    // ------------------------------------------------------------------------
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  find_soh / count_soh (mean latency, median latency, throughput)\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    struct CountResult { size_t count; };
+
+    for (size_t size : {size_t{256}, size_t{1024}, size_t{4096}}) {
+        std::cout << "\nBuffer size: " << size << " bytes\n";
+        std::cout << std::string(60, '-') << "\n";
+
+        auto data = generate_fix_data(size);
+        std::vector<char> no_soh(size, 'A');
+        no_soh.back() = nfx::fix::SOH;
+        std::span<const char> span{data.data(), data.size()};
+        std::span<const char> last{no_soh.data(), no_soh.size()};
+
+        print_result("find Scalar", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::find_soh_scalar(d)}; },
+            last, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#if NFX_SIMD_AVAILABLE
+        print_result("find AVX2", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::find_soh_avx2(d)}; },
+            last, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
+#if NFX_NEON_AVAILABLE
+        print_result("find NEON", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::find_soh_neon(d)}; },
+            last, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
+#if NFX_SVE_AVAILABLE
+        print_result("find SVE", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::find_soh_sve(d)}; },
+            last, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
+        print_result("count Auto", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::count_soh(d)}; },
+            span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#if NFX_SIMD_AVAILABLE
+        print_result("count AVX2", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::count_soh_avx2(d)}; },
+            span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
+#if NFX_NEON_AVAILABLE
+        print_result("count NEON", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::count_soh_neon(d)}; },
+            span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
+#if NFX_SVE_AVAILABLE
+        print_result("count SVE", benchmark_scan(
+            [](std::span<const char> d) { return CountResult{nfx::simd::count_soh_sve(d)}; },
+            span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+#endif
     }
 
     std::cout << "\n==========================================================\n";
@@ -250,7 +355,7 @@ int main() {
 
     std::cout << "\nImplementation hierarchy (auto-selected by buffer size):\n";
     std::cout << "  >= 128 bytes: AVX-512 (if available)\n";
-    std::cout << "  >= 64 bytes:  AVX2\n";
+    std::cout << "  >= 64 bytes:  AVX2 (x86) / NEON (AArch64)\n";
     std::cout << "  < 64 bytes:   Scalar\n";
 
 #if !NFX_AVX512_AVAILABLE
@@ -181,6 +181,97 @@ static LatencyStats bench_build_index_dispatch(
     return stats;
 }
 
+/// Stage 1: A specific build_index implementation
+static LatencyStats bench_build_index_impl(
+    simd::detail::BuildIndexFn build, std::span<const char> data,
+    size_t iterations, double freq_ghz)
+{
+    std::vector<uint64_t> cycles;
+    cycles.reserve(iterations);
+
+    warmup_icache([&]() {
+        auto idx = build(data);
+        compiler_barrier();
+        (void)idx;
+    });
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t elapsed;
+        {
+            ScopedTimer timer(elapsed);
+            auto idx = build(data);
+            compiler_barrier();
+            (void)idx;
+        }
+        cycles.push_back(elapsed);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
+/// Stage 1: build_index followed by a separate checksum pass
+static LatencyStats bench_index_then_checksum(
+    std::span<const char> data, size_t iterations, double freq_ghz)
+{
+    std::vector<uint64_t> cycles;
+    cycles.reserve(iterations);
+
+    warmup_icache([&]() {
+        auto idx = simd::build_index(data);
+        auto cs = fix::calculate_checksum(data.subspan(0, idx.checksum_start));
+        compiler_barrier();
+        (void)cs;
+    });
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t elapsed;
+        {
+            ScopedTimer timer(elapsed);
+            auto idx = simd::build_index(data);
+            auto cs = fix::calculate_checksum(data.subspan(0, idx.checksum_start));
+            compiler_barrier();
+            (void)cs;
+        }
+        cycles.push_back(elapsed);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
+/// Stage 1: build_index_with_checksum (byte sum fused into the scan)
+static LatencyStats bench_index_with_checksum(
+    std::span<const char> data, size_t iterations, double freq_ghz)
+{
+    std::vector<uint64_t> cycles;
+    cycles.reserve(iterations);
+
+    warmup_icache([&]() {
+        auto idx = simd::build_index_with_checksum(data);
+        compiler_barrier();
+        (void)idx;
+    });
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t elapsed;
+        {
+            ScopedTimer timer(elapsed);
+            auto idx = simd::build_index_with_checksum(data);
+            auto cs = idx.computed_checksum;
+            compiler_barrier();
+            (void)cs;
+        }
+        cycles.push_back(elapsed);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
 /// Stage 2: Field extraction by tag (linear search)
 static LatencyStats bench_field_extraction(
     std::span<const char> data, size_t iterations, double freq_ghz)
@@ -406,6 +497,84 @@ int main(int argc, char* argv[]) {
     dispatch_name += "] (ExecutionReport)";
     print_stats(dispatch_name.c_str(), dispatch_stats);
 
+    // ========================================================================
+    // Position Extraction: bit loop vs VBMI2 compress
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Position Extraction (AVX2 / AVX-512 / AVX-512 VBMI2)\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    // Dense message: snapshot-style body, ~4 fields per 64-byte block
+    std::string dense_body{"8=FIX.4.4\x01" "9=9999\x01" "35=W\x01" "49=SENDER\x01"
+                           "56=TARGET\x01" "34=1\x01" "52=20231215-10:30:00.000\x01"
+                           "268=40\x01"};
+    for (int e = 0; e < 40; ++e) {
+        dense_body += "269=0\x01" "270=150.25\x01" "271=100\x01";
+    }
+    std::string dense_msg = build_fix_message(dense_body);
+    std::span<const char> dense_data{dense_msg.data(), dense_msg.size()};
+
+    struct ExtractImpl {
+        const char* name;
+        simd::detail::BuildIndexFn fn;
+        bool supported;
+    };
+    ExtractImpl extract_impls[] = {
+#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
+        {"AVX2 (tzcnt loop)", simd::build_index_avx2, true},
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+        {"AVX-512 (tzcnt loop)", simd::build_index_avx512,
+         __builtin_cpu_supports("avx512bw") != 0},
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+        {"AVX-512 VBMI2 (compress)", simd::build_index_avx512_vbmi2,
+         __builtin_cpu_supports("avx512vbmi2") != 0},
+#endif
+        {"Scalar", simd::build_index_scalar, true},
+    };
+
+    std::cout << "\n  " << std::left << std::setw(28) << "Implementation"
+              << std::right << std::setw(14) << "ExecRpt P50"
+              << std::setw(14) << "Dense P50" << "\n";
+    std::cout << "  " << std::string(56, '-') << "\n";
+    for (const auto& impl : extract_impls) {
+        if (!impl.supported) {
+            std::cout << "  " << std::left << std::setw(28) << impl.name
+                      << std::right << std::setw(28) << "(not supported by CPU)\n";
+            continue;
+        }
+        auto exec_stats = bench_build_index_impl(impl.fn, exec_data, iterations, freq_ghz);
+        auto dense_stats = bench_build_index_impl(impl.fn, dense_data, iterations, freq_ghz);
+        std::cout << "  " << std::left << std::setw(28) << impl.name
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(11) << exec_stats.p50_ns << " ns"
+                  << std::setw(11) << dense_stats.p50_ns << " ns\n";
+    }
+    std::cout << "  (Dense: " << dense_msg.size() << " bytes, "
+              << simd::build_index_scalar(dense_data).soh_count << " fields)\n";
+
+    // ========================================================================
+    // Fused Checksum
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Checksum: separate pass vs fused into build_index\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    auto separate_cs_stats = bench_index_then_checksum(exec_data, iterations, freq_ghz);
+    print_stats("build_index + calculate_checksum (Separate)", separate_cs_stats);
+
+    auto fused_cs_stats = bench_index_with_checksum(exec_data, iterations, freq_ghz);
+    print_stats("build_index_with_checksum (Fused)", fused_cs_stats);
+
+    std::cout << "\n";
+    print_comparison_header("Separate", "Fused");
+    print_comparison("Mean", separate_cs_stats.mean_ns, fused_cs_stats.mean_ns);
+    print_comparison("P50", separate_cs_stats.p50_ns, fused_cs_stats.p50_ns);
+    print_comparison("P99", separate_cs_stats.p99_ns, fused_cs_stats.p99_ns);
+
     // ========================================================================
     // Stage 2: Field Extraction
     // ========================================================================
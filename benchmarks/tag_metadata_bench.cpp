@@ -11,6 +11,7 @@
 
 // Include the new implementation
 #include "nexusfix/types/tag.hpp"
+#include "nexusfix/parser/field_view.hpp"
 
 // ============================================================================
 // OLD Implementation (switch-based) - for comparison
@@ -331,6 +332,53 @@ int main() {
     std::cout << "  NEW (lookup):     " << new_rand_cpop << " cycles/op\n";
     std::cout << "  Improvement:      " << rand_improvement << "%\n\n";
 
+    // ========================================================================
+    // Benchmark 6: Per-message field table (IndexedParser storage)
+    // ========================================================================
+
+    constexpr int TABLE_ITERATIONS = 1'000'000;
+
+    std::cout << "--- Field table build + lookup (" << TABLE_ITERATIONS << " messages) ---\n\n";
+
+    // ExecutionReport-shaped message: known tags plus one venue tag
+    constexpr std::array<int, 22> MSG_TAGS = {
+        8, 9, 35, 49, 56, 34, 52, 37, 11, 17, 150, 39, 55, 54,
+        38, 44, 151, 14, 6, 31, 32, 60
+    };
+    constexpr std::array<int, 8> READ_TAGS = {35, 11, 39, 150, 55, 31, 32, 151};
+    const char* value = "12345";
+    std::span<const char> value_span{value, 5};
+
+    // OLD: FieldTable<512> (dense array, zeroed per message)
+    uint64_t old_table_start = rdtsc();
+    for (int i = 0; i < TABLE_ITERATIONS; ++i) {
+        nfx::FieldTable<512> table;
+        for (int tag : MSG_TAGS) table.set(tag, value_span);
+        for (int tag : READ_TAGS) do_not_optimize(table.get(tag));
+        do_not_optimize(table);
+    }
+    uint64_t old_table_cycles = rdtsc() - old_table_start;
+
+    // NEW: HashedFieldTable (perfect hash, presence bits cleared per message)
+    uint64_t new_table_start = rdtsc();
+    for (int i = 0; i < TABLE_ITERATIONS; ++i) {
+        nfx::HashedFieldTable table;
+        for (int tag : MSG_TAGS) (void)table.set(tag, value_span);
+        for (int tag : READ_TAGS) do_not_optimize(table.get(tag));
+        do_not_optimize(table);
+    }
+    uint64_t new_table_cycles = rdtsc() - new_table_start;
+
+    double old_table_cpm = static_cast<double>(old_table_cycles) / TABLE_ITERATIONS;
+    double new_table_cpm = static_cast<double>(new_table_cycles) / TABLE_ITERATIONS;
+    double table_improvement = (old_table_cpm - new_table_cpm) / old_table_cpm * 100;
+
+    std::cout << "  OLD (FieldTable<512>):  " << old_table_cpm << " cycles/msg ("
+              << sizeof(nfx::FieldTable<512>) << " bytes)\n";
+    std::cout << "  NEW (HashedFieldTable): " << new_table_cpm << " cycles/msg ("
+              << sizeof(nfx::HashedFieldTable) << " bytes)\n";
+    std::cout << "  Improvement:            " << table_improvement << "%\n\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
@@ -349,6 +397,7 @@ int main() {
     std::cout << "| is_required_tag()  | " << old_req_cpop << "       | " << new_req_cpop << "       | " << req_improvement << "% |\n";
     std::cout << "| Hot path           | " << old_hot_cpop << "       | " << new_hot_cpop << "       | " << hot_improvement << "% |\n";
     std::cout << "| Random access      | " << old_rand_cpop << "       | " << new_rand_cpop << "       | " << rand_improvement << "% |\n";
+    std::cout << "| Field table (msg)  | " << old_table_cpm << "       | " << new_table_cpm << "       | " << table_improvement << "% |\n";
     std::cout << "|--------------------|--------------|--------------|-------------|\n";
     std::cout << "| Average            |              |              | " << avg_improvement << "% |\n";
 
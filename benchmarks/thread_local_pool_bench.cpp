@@ -10,9 +10,14 @@
 #include <numeric>
 #include <chrono>
 #include <cstring>
+#include <thread>
+#include <atomic>
+#include <memory>
 
 #include "nexusfix/util/thread_local_pool.hpp"
 #include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/memory/concurrent_pool.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
 
 using namespace nfx::util;
 
@@ -51,6 +56,71 @@ T percentile(std::vector<T>& data, double p) {
     return data[idx];
 }
 
+// ============================================================================
+// Cross-Thread Benchmark (allocate on one thread, free on another)
+// ============================================================================
+
+constexpr int CROSS_THREAD_MESSAGES = 1'000'000;
+
+using CrossThreadPool = nfx::memory::ConcurrentFixedPool<4096, 1024>;
+using HandoffQueue = nfx::memory::SPSCQueue<void*, 512>;
+
+struct CrossThreadResult {
+    double alloc_median_ns;   // Producer allocate() latency
+    double alloc_p99_ns;
+    double throughput_mps;    // Messages handed over per second (millions)
+};
+
+/// Producer ("network thread") allocates and hands blocks over an SPSC
+/// queue; consumer ("strategy thread") frees them.
+template<typename Alloc, typename Free>
+CrossThreadResult run_cross_thread(Alloc&& alloc_on_producer, Free&& free_on_consumer,
+                                   double cpu_freq_ghz) {
+    auto queue = std::make_unique<HandoffQueue>();
+    std::vector<uint64_t> latencies;
+    latencies.reserve(CROSS_THREAD_MESSAGES);
+
+    std::thread consumer([&] {
+        int freed = 0;
+        void* p = nullptr;
+        while (freed < CROSS_THREAD_MESSAGES) {
+            if (queue->try_pop(p)) {
+                free_on_consumer(p);
+                ++freed;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < CROSS_THREAD_MESSAGES;) {
+        uint64_t start = rdtsc();
+        void* p = alloc_on_producer();
+        uint64_t end = rdtsc();
+        if (!p) {
+            std::this_thread::yield();  // Pool drained; consumer is behind
+            continue;
+        }
+        latencies.push_back(end - start);
+        std::memcpy(p, "8=FIX.4.4|9=100|35=D|", 21);
+        while (!queue->try_push(p)) {
+            std::this_thread::yield();
+        }
+        ++i;
+    }
+    consumer.join();
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+
+    std::sort(latencies.begin(), latencies.end());
+    double elapsed_sec = std::chrono::duration<double>(elapsed).count();
+    return {
+        static_cast<double>(latencies[latencies.size() / 2]) / cpu_freq_ghz,
+        static_cast<double>(percentile(latencies, 0.99)) / cpu_freq_ghz,
+        CROSS_THREAD_MESSAGES / elapsed_sec / 1e6
+    };
+}
+
 int main() {
     std::cout << "==========================================================\n";
     std::cout << "  Thread-Local Object Pool Benchmark\n";
@@ -248,6 +318,59 @@ int main() {
     std::cout << "  Median: " << std::fixed << std::setprecision(1) << large_median << " ns\n";
     std::cout << "  Capacity: " << LargeBufferPool::capacity() << " buffers\n";
 
+    // ========================================================================
+    // Cross-Thread Allocation (network thread allocates, strategy frees)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Cross-Thread Alloc/Free (4KB blocks, "
+              << CROSS_THREAD_MESSAGES / 1'000'000 << "M messages)\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    auto shared_pool = std::make_unique<CrossThreadPool>();
+
+    // Magazine caches: one per thread, blocks return via the depot
+    CrossThreadResult cached;
+    {
+        CrossThreadPool::LocalCache producer_cache{*shared_pool};
+        std::unique_ptr<CrossThreadPool::LocalCache> consumer_cache;
+        cached = run_cross_thread(
+            [&] { return producer_cache.allocate(); },
+            [&](void* p) {
+                if (!consumer_cache) {
+                    consumer_cache = std::make_unique<CrossThreadPool::LocalCache>(*shared_pool);
+                }
+                consumer_cache->deallocate(p);
+            },
+            cpu_freq_ghz);
+    }
+
+    // Depot only: every allocate/free is a CAS on the shared stack
+    CrossThreadResult uncached = run_cross_thread(
+        [&] { return shared_pool->allocate(); },
+        [&](void* p) { shared_pool->deallocate(p); },
+        cpu_freq_ghz);
+
+    // Heap baseline
+    CrossThreadResult heap = run_cross_thread(
+        [] { return static_cast<void*>(new MessageBuffer); },
+        [](void* p) { delete static_cast<MessageBuffer*>(p); },
+        cpu_freq_ghz);
+
+    std::cout << "                    Alloc p50   Alloc p99   Throughput\n";
+    std::cout << "  --------------------------------------------------------\n";
+    auto print_row = [](const char* label, const CrossThreadResult& r) {
+        std::cout << "  " << std::left << std::setw(16) << label << std::right
+                  << std::setw(8) << std::fixed << std::setprecision(1) << r.alloc_median_ns << " ns"
+                  << std::setw(9) << r.alloc_p99_ns << " ns"
+                  << std::setw(9) << std::setprecision(2) << r.throughput_mps << " M/s\n";
+    };
+    print_row("Magazine cache", cached);
+    print_row("Depot only", uncached);
+    print_row("Heap", heap);
+    std::cout << "  Depot blocks after run: " << shared_pool->depot_blocks()
+              << " / " << CrossThreadPool::capacity() << "\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
@@ -262,6 +385,7 @@ int main() {
     std::cout << "  3. MessageBuffer - 4KB aligned buffer for FIX messages\n";
     std::cout << "  4. LargeBuffer - 64KB buffer for batch operations\n";
     std::cout << "  5. MessageBufferPool / LargeBufferPool type aliases\n";
+    std::cout << "  6. ConcurrentFixedPool - cross-thread pool with magazine caches\n";
 
     std::cout << "\nKey Features:\n";
     std::cout << "  - Zero contention (thread-local)\n";
@@ -1,5 +1,6 @@
 // timing_comparison.cpp
 // Compare rdtscp vs nanobench timing on same workload
+// Also compares SendingTime formatting at ms / us / ns precision
 
 #include <cstdint>
 #include <iostream>
@@ -57,7 +58,7 @@ inline double get_cpu_freq_ghz() noexcept {
 
     volatile uint64_t dummy = 0;
     for (int i = 0; i < 10000000; ++i) {
-        dummy += i;
+        dummy = dummy + i;
     }
 
     uint64_t end_cycles = rdtsc();
@@ -142,6 +143,34 @@ int main() {
              ankerl::nanobench::doNotOptimizeAway(result);
          });
 
+    // =========================================================================
+    // Test 3: SendingTime formatting by precision
+    // =========================================================================
+    std::cout << "\n--- SendingTime Formatting (ms / us / ns) ---\n";
+
+    ankerl::nanobench::Bench ts_bench;
+    ts_bench.warmup(1000)
+            .minEpochIterations(ITERATIONS)
+            .relative(true);
+
+    for (auto precision : {util::TimestampPrecision::Milliseconds,
+                           util::TimestampPrecision::Microseconds,
+                           util::TimestampPrecision::Nanoseconds}) {
+        const std::string digits = std::to_string(static_cast<int>(precision));
+
+        util::FastTimestamp fast{precision};
+        ts_bench.run("FastTimestamp  " + digits + " digits", [&]() {
+            auto ts = fast.get();
+            ankerl::nanobench::doNotOptimizeAway(ts);
+        });
+
+        util::RdtscTimestamp rdtsc{precision};
+        ts_bench.run("RdtscTimestamp " + digits + " digits", [&]() {
+            auto ts = rdtsc.get();
+            ankerl::nanobench::doNotOptimizeAway(ts);
+        });
+    }
+
     // =========================================================================
     // Summary
     // =========================================================================
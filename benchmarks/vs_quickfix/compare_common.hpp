@@ -0,0 +1,228 @@
+// compare_common.hpp
+// Shared pieces of the QuickFIX comparison: timing, percentile statistics,
+// report formatting and the test messages. Included by both
+// quickfix_only_benchmark.cpp (C++14, QuickFIX headers) and
+// nexusfix_compare_benchmark.cpp (C++23), so both sides measure the same
+// inputs and print identical tables. Keep this header C++14.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// ============================================================================
+// High-Resolution Timing Utilities
+// ============================================================================
+
+inline uint64_t rdtsc() noexcept {
+    uint64_t lo, hi;
+    asm volatile (
+        "lfence\n\t"
+        "rdtsc\n\t"
+        "lfence\n\t"
+        : "=a"(lo), "=d"(hi)
+    );
+    return (hi << 32) | lo;
+}
+
+inline double get_cpu_freq_ghz() noexcept {
+    auto start_time = std::chrono::steady_clock::now();
+    uint64_t start_cycles = rdtsc();
+
+    volatile uint64_t dummy = 0;
+    for (int i = 0; i < 10000000; ++i) {
+        dummy = dummy + i;
+    }
+
+    uint64_t end_cycles = rdtsc();
+    auto end_time = std::chrono::steady_clock::now();
+
+    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        end_time - start_time).count();
+
+    return static_cast<double>(end_cycles - start_cycles) / elapsed_ns;
+}
+
+inline double cycles_to_ns(uint64_t cycles, double freq_ghz) noexcept {
+    return static_cast<double>(cycles) / freq_ghz;
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+struct BenchmarkStats {
+    double min_ns;
+    double max_ns;
+    double mean_ns;
+    double p50_ns;
+    double p90_ns;
+    double p99_ns;
+    double p999_ns;
+    double stddev_ns;
+    size_t iterations;
+};
+
+inline BenchmarkStats calculate_stats(std::vector<double>& latencies) {
+    BenchmarkStats stats = {};
+    stats.iterations = latencies.size();
+
+    if (latencies.empty()) return stats;
+
+    std::sort(latencies.begin(), latencies.end());
+
+    stats.min_ns = latencies.front();
+    stats.max_ns = latencies.back();
+
+    double sum = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+    stats.mean_ns = sum / latencies.size();
+
+    auto percentile = [&](double p) {
+        size_t idx = static_cast<size_t>(p * latencies.size());
+        if (idx >= latencies.size()) idx = latencies.size() - 1;
+        return latencies[idx];
+    };
+
+    stats.p50_ns = percentile(0.50);
+    stats.p90_ns = percentile(0.90);
+    stats.p99_ns = percentile(0.99);
+    stats.p999_ns = percentile(0.999);
+
+    double sq_sum = 0.0;
+    for (size_t i = 0; i < latencies.size(); ++i) {
+        double diff = latencies[i] - stats.mean_ns;
+        sq_sum += diff * diff;
+    }
+    stats.stddev_ns = std::sqrt(sq_sum / latencies.size());
+
+    return stats;
+}
+
+inline void print_stats(const char* name, const BenchmarkStats& stats) {
+    std::cout << "\n=== " << name << " ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Iterations: " << stats.iterations << std::endl;
+    std::cout << "  Min:    " << std::setw(10) << stats.min_ns << " ns" << std::endl;
+    std::cout << "  Mean:   " << std::setw(10) << stats.mean_ns << " ns" << std::endl;
+    std::cout << "  P50:    " << std::setw(10) << stats.p50_ns << " ns" << std::endl;
+    std::cout << "  P90:    " << std::setw(10) << stats.p90_ns << " ns" << std::endl;
+    std::cout << "  P99:    " << std::setw(10) << stats.p99_ns << " ns" << std::endl;
+    std::cout << "  P99.9:  " << std::setw(10) << stats.p999_ns << " ns" << std::endl;
+    std::cout << "  Max:    " << std::setw(10) << stats.max_ns << " ns" << std::endl;
+    std::cout << "  StdDev: " << std::setw(10) << stats.stddev_ns << " ns" << std::endl;
+}
+
+inline void print_section(const char* title) {
+    std::cout << "\n------------------------------------------------------------" << std::endl;
+    std::cout << "  " << title << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+}
+
+// ============================================================================
+// Summary Table
+// ============================================================================
+
+/// One row per scenario; both binaries print the same scenario names in
+/// the same order, so their summaries can be diffed line by line
+struct SummaryRow {
+    std::string scenario;
+    BenchmarkStats stats;
+};
+
+inline void print_summary(const char* library, const std::vector<SummaryRow>& rows) {
+    std::cout << "\n============================================================" << std::endl;
+    std::cout << "  " << library << " SUMMARY (ns)" << std::endl;
+    std::cout << "============================================================" << std::endl;
+    std::cout << std::left << std::setw(28) << "scenario" << std::right
+              << std::setw(12) << "mean" << std::setw(12) << "p50"
+              << std::setw(12) << "p99" << std::setw(12) << "p99.9" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const BenchmarkStats& s = rows[i].stats;
+        std::cout << std::left << std::setw(28) << rows[i].scenario << std::right
+                  << std::setw(12) << s.mean_ns << std::setw(12) << s.p50_ns
+                  << std::setw(12) << s.p99_ns << std::setw(12) << s.p999_ns << std::endl;
+    }
+    std::cout << "============================================================" << std::endl;
+}
+
+// ============================================================================
+// Scenario Parameters
+// ============================================================================
+
+/// Messages appended to the store before each resend retrieval
+const size_t STORE_PRELOAD = 10000;
+/// Messages fetched by one resend retrieval (a typical ResendRequest gap)
+const int RESEND_SPAN = 10;
+/// Default ping-pong orders for the loopback session round trip
+const size_t ROUND_TRIP_ORDERS = 20000;
+
+// ============================================================================
+// Test Messages (SOH = \001)
+// ============================================================================
+
+// Well-formed (BodyLength and CheckSum correct): NexusFIX validates both,
+// QuickFIX parses with validation off
+
+// ExecutionReport message (35=8)
+const std::string EXEC_REPORT_MSG =
+    "8=FIX.4.4\001"
+    "9=146\001"
+    "35=8\001"
+    "49=SENDER\001"
+    "56=TARGET\001"
+    "34=12345\001"
+    "52=20240115-10:30:00.123\001"
+    "37=ORD123456\001"
+    "17=EXEC789012\001"
+    "150=0\001"
+    "39=0\001"
+    "54=1\001"
+    "151=1000\001"
+    "14=0\001"
+    "6=0\001"
+    "55=AAPL\001"
+    "38=1000\001"
+    "44=150.50\001"
+    "10=216\001";
+
+// NewOrderSingle message (35=D); also the order both builders produce
+const std::string NEW_ORDER_MSG =
+    "8=FIX.4.4\001"
+    "9=135\001"
+    "35=D\001"
+    "49=SENDER\001"
+    "56=TARGET\001"
+    "34=100\001"
+    "52=20240115-10:30:00.000\001"
+    "11=CLORD001\001"
+    "55=AAPL\001"
+    "54=1\001"
+    "60=20240115-10:30:00.000\001"
+    "38=1000\001"
+    "40=2\001"
+    "44=150.00\001"
+    "59=0\001"
+    "10=193\001";
+
+// Heartbeat message (35=0)
+const std::string HEARTBEAT_MSG =
+    "8=FIX.4.4\001"
+    "9=56\001"
+    "35=0\001"
+    "49=SENDER\001"
+    "56=TARGET\001"
+    "34=50\001"
+    "52=20240115-10:30:00.000\001"
+    "10=118\001";
+
+} // namespace bench
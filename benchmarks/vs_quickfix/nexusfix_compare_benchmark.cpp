@@ -0,0 +1,369 @@
+// nexusfix_compare_benchmark.cpp
+// NexusFIX side of the QuickFIX comparison
+//
+// Runs the scenarios of quickfix_only_benchmark on the NexusFIX code paths,
+// with the same inputs and percentile tables (compare_common.hpp):
+//   - parse and field access     ParsedMessage::parse, get_string/get_char
+//   - NewOrderSingle build        fix44::NewOrderSingle::Builder::build()
+//   - store append + seq          MemoryMessageStore::store + next sender seq
+//   - resend retrieval            visit_range() (what SessionManager uses);
+//                                 retrieve_range() copies like QuickFIX's get()
+//   - session round trip          SessionManager over loopback TCP against the
+//                                 benchmark LoopbackVenue, store attached
+//
+// Timestamps are taken once per run on both sides. QuickFIX formats its
+// UtcTimeStamp into every SendingTime/TransactTime field it sets; NexusFIX
+// takes the text its timestamp cache already holds.
+//
+// Usage: ./nexusfix_compare_benchmark [iterations] [round_trip_orders]
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/util/fast_timestamp.hpp"
+#include "loopback_venue.hpp"
+
+#include "compare_common.hpp"
+
+namespace bench {
+
+namespace {
+
+std::span<const char> as_span(const std::string& s) noexcept { return {s.data(), s.size()}; }
+
+// ============================================================================
+// Parse
+// ============================================================================
+
+BenchmarkStats benchmark_parse(const std::string& msg, size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    size_t parsed = 0;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        parsed += nfx::ParsedMessage::parse(as_span(msg)).has_value();
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc();
+        auto result = nfx::ParsedMessage::parse(as_span(msg));
+        uint64_t end = rdtsc();
+
+        parsed += result.has_value();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (parsed != iterations + 1000) std::cerr << "Error: parse failed" << std::endl;
+    return calculate_stats(latencies);
+}
+
+BenchmarkStats benchmark_field_access(const std::string& msg, size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+
+    auto parsed = nfx::ParsedMessage::parse(as_span(msg));
+    if (!parsed) {
+        std::cerr << "Error: parse failed" << std::endl;
+        return BenchmarkStats{};
+    }
+    const nfx::ParsedMessage& message = *parsed;
+
+    size_t sink = 0;
+    for (size_t i = 0; i < iterations + 1000; ++i) {
+        uint64_t start = rdtsc();
+
+        std::string_view order_id = message.get_string(nfx::tag::OrderID::value);
+        std::string_view exec_id = message.get_string(nfx::tag::ExecID::value);
+        char side = message.get_char(nfx::tag::Side::value);
+        char msg_type = message.msg_type();
+
+        uint64_t end = rdtsc();
+        sink += order_id.size() + exec_id.size() + static_cast<size_t>(side + msg_type);
+        if (i >= 1000) latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (sink == 0) std::cerr << "Error" << std::endl;
+    return calculate_stats(latencies);
+}
+
+// ============================================================================
+// Serialize
+// ============================================================================
+
+/// Build NEW_ORDER_MSG's NewOrderSingle into a reused assembler
+BenchmarkStats benchmark_build_new_order(size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    nfx::MessageAssembler assembler;
+    nfx::util::FastTimestamp clock;
+    const std::string stamp{clock.get()};
+    size_t bytes = 0;
+
+    auto build = [&](uint32_t seq) {
+        nfx::fix44::NewOrderSingle::Builder order;
+        order.sender_comp_id("SENDER")
+            .target_comp_id("TARGET")
+            .msg_seq_num(seq)
+            .sending_time(stamp)
+            .cl_ord_id("CLORD001")
+            .symbol("AAPL")
+            .side(nfx::Side::Buy)
+            .transact_time(stamp)
+            .order_qty(nfx::Qty::from_int(1000))
+            .ord_type(nfx::OrdType::Limit)
+            .price(nfx::FixedPrice::from_double(150.00))
+            .time_in_force(nfx::TimeInForce::Day);
+        bytes += order.build(assembler).size();
+    };
+
+    for (uint32_t i = 0; i < 1000; ++i) build(i + 1);
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc();
+        build(static_cast<uint32_t>(i + 1));
+        uint64_t end = rdtsc();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (bytes == 0) std::cerr << "Error" << std::endl;
+    return calculate_stats(latencies);
+}
+
+// ============================================================================
+// Message Store
+// ============================================================================
+
+/// Append one message and advance the sender sequence, as send_message does
+BenchmarkStats benchmark_store_append(size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    // Sized so nothing is evicted: QuickFIX's MemoryStore keeps everything
+    nfx::store::MemoryMessageStore store{nfx::store::MemoryMessageStore::Config{
+        .session_id = "SENDER-TARGET", .max_messages = iterations + 1024}};
+
+    uint32_t seq = 1;
+    for (size_t i = 0; i < 1000; ++i) {
+        (void)store.store(seq, as_span(NEW_ORDER_MSG));
+        store.set_next_sender_seq_num(++seq);
+    }
+
+    size_t failures = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc();
+        failures += !store.store(seq, as_span(NEW_ORDER_MSG));
+        store.set_next_sender_seq_num(++seq);
+        uint64_t end = rdtsc();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (failures) std::cerr << "Error: " << failures << " store failures" << std::endl;
+    return calculate_stats(latencies);
+}
+
+/// Fetch RESEND_SPAN consecutive messages, as a ResendRequest does
+/// @param copy Use retrieve_range() (one vector per message) instead of
+///        the zero-copy visit_range()
+BenchmarkStats benchmark_resend_retrieval(size_t iterations, double freq_ghz, bool copy) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    nfx::store::MemoryMessageStore store{nfx::store::MemoryMessageStore::Config{
+        .session_id = "SENDER-TARGET", .max_messages = STORE_PRELOAD}};
+    for (uint32_t seq = 1; seq <= STORE_PRELOAD; ++seq) {
+        (void)store.store(seq, as_span(NEW_ORDER_MSG));
+    }
+    store.set_next_sender_seq_num(static_cast<uint32_t>(STORE_PRELOAD) + 1);
+
+    struct Sink {
+        size_t bytes{0};
+    } sink;
+    auto visit = [](void* ctx, uint32_t, std::span<const char> msg) noexcept {
+        static_cast<Sink*>(ctx)->bytes += msg.size();
+        return true;
+    };
+
+    const uint32_t last_begin = static_cast<uint32_t>(STORE_PRELOAD) - RESEND_SPAN + 1;
+    size_t fetched = 0;
+    for (size_t i = 0; i < iterations + 1000; ++i) {
+        const uint32_t begin = 1 + static_cast<uint32_t>((i * 7919) % last_begin);
+        const uint32_t end_seq = begin + RESEND_SPAN - 1;
+
+        uint64_t start = rdtsc();
+        if (copy) {
+            fetched += store.retrieve_range(begin, end_seq).size();
+        } else {
+            fetched += store.visit_range(begin, end_seq, visit, &sink);
+        }
+        uint64_t end = rdtsc();
+
+        if (i >= 1000) latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (fetched != (iterations + 1000) * RESEND_SPAN) std::cerr << "Error: short resend" << std::endl;
+    return calculate_stats(latencies);
+}
+
+// ============================================================================
+// Session Round Trip
+// ============================================================================
+
+struct ClientHandler : nfx::NullSessionHandler {
+    nfx::TcpSocket* socket{nullptr};
+    uint64_t acks{0};
+
+    bool on_send(std::span<const char> data) noexcept {
+        while (!data.empty()) {
+            auto sent = socket->send(data);
+            if (!sent) return false;
+            data = data.subspan(*sent);
+        }
+        return true;
+    }
+
+    void on_message(nfx::MsgTypeTag<'8'>, const nfx::ParsedMessage&) noexcept { ++acks; }
+};
+
+/// Ping-pong orders through a SessionManager with a MemoryMessageStore to
+/// the in-process LoopbackVenue (acceptor SessionManager) on loopback TCP
+BenchmarkStats benchmark_session_round_trip(size_t orders, double freq_ghz) {
+    nfx::bench::LoopbackVenue venue{"VENUE"};
+    const uint16_t port = venue.start(1);
+    if (port == 0) {
+        std::cerr << "  listen failed" << std::endl;
+        return BenchmarkStats{};
+    }
+
+    nfx::TcpSocket socket;
+    if (!socket.connect("127.0.0.1", port)) {
+        std::cerr << "  connect failed" << std::endl;
+        return BenchmarkStats{};
+    }
+    (void)socket.set_nodelay(true);
+
+    nfx::SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "VENUE";
+    nfx::store::MemoryMessageStore store{"CLIENT-VENUE"};
+    nfx::SessionManager<ClientHandler> session{config, ClientHandler{{}, &socket}};
+    session.set_message_store(&store);
+    nfx::bench::SessionReader reader;
+
+    auto pump_until = [&](auto&& pred) {
+        while (!pred()) {
+            if (!reader.poll(socket, session)) return false;
+        }
+        return true;
+    };
+
+    session.on_connect();
+    if (!session.initiate_logon() ||
+        !pump_until([&] { return session.state() == nfx::SessionState::Active; })) {
+        std::cerr << "  logon failed" << std::endl;
+        return BenchmarkStats{};
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(orders);
+    std::array<char, 24> cl_ord_id{'R', 'T'};
+    const size_t warmup = orders / 10;
+    for (size_t i = 0; i < warmup + orders; ++i) {
+        const uint64_t expected = session.handler().acks + 1;
+        uint64_t start = rdtsc();
+
+        auto [end_ptr, ec] = std::to_chars(cl_ord_id.data() + 2, cl_ord_id.data() + cl_ord_id.size(), i);
+        (void)ec;
+        nfx::fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id({cl_ord_id.data(), static_cast<size_t>(end_ptr - cl_ord_id.data())})
+            .symbol("AAPL")
+            .side(nfx::Side::Buy)
+            .transact_time("20240115-10:30:00.000")
+            .order_qty(nfx::Qty::from_int(100))
+            .ord_type(nfx::OrdType::Limit)
+            .price(nfx::FixedPrice::from_double(150.25));
+        if (!session.send_app_message(order) ||
+            !pump_until([&] { return session.handler().acks >= expected; })) {
+            std::cerr << "  round trip failed" << std::endl;
+            break;
+        }
+
+        uint64_t end = rdtsc();
+        if (i >= warmup) latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (session.initiate_logout("done")) {
+        (void)pump_until([&] { return session.state() != nfx::SessionState::LogoutPending; });
+    }
+    session.on_disconnect();
+    venue.stop();
+    return calculate_stats(latencies);
+}
+
+} // namespace
+
+} // namespace bench
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    using namespace bench;
+
+    size_t iterations = 100000;
+    size_t round_trip_orders = ROUND_TRIP_ORDERS;
+
+    if (argc > 1) iterations = std::stoul(argv[1]);
+    if (argc > 2) round_trip_orders = std::stoul(argv[2]);
+
+    std::cout << "============================================================" << std::endl;
+    std::cout << "           NexusFIX Comparison Benchmark" << std::endl;
+    std::cout << "============================================================" << std::endl;
+    std::cout << "Iterations: " << iterations << std::endl;
+    std::cout << "Round trip orders: " << round_trip_orders << std::endl;
+    std::cout << std::endl;
+    std::cout << "Compare the SUMMARY with quickfix_benchmark output." << std::endl;
+
+    std::cout << "\nCalibrating CPU frequency..." << std::endl;
+    double freq_ghz = get_cpu_freq_ghz();
+    std::cout << "CPU frequency: " << std::fixed << std::setprecision(3)
+              << freq_ghz << " GHz" << std::endl;
+
+    std::vector<SummaryRow> rows;
+    auto run = [&](const char* scenario, const BenchmarkStats& stats) {
+        print_stats(scenario, stats);
+        rows.push_back(SummaryRow{scenario, stats});
+    };
+
+    print_section("PARSE");
+    run("parse ExecutionReport", benchmark_parse(EXEC_REPORT_MSG, iterations, freq_ghz));
+    run("field access (4 fields)", benchmark_field_access(EXEC_REPORT_MSG, iterations, freq_ghz));
+    run("parse NewOrderSingle", benchmark_parse(NEW_ORDER_MSG, iterations, freq_ghz));
+    run("parse Heartbeat", benchmark_parse(HEARTBEAT_MSG, iterations, freq_ghz));
+
+    print_section("SERIALIZE");
+    run("build NewOrderSingle", benchmark_build_new_order(iterations, freq_ghz));
+
+    print_section("MESSAGE STORE (MemoryMessageStore)");
+    run("store append + seq", benchmark_store_append(iterations, freq_ghz));
+    run("resend retrieval (10 msgs)", benchmark_resend_retrieval(iterations, freq_ghz, false));
+
+    print_section("SESSION ROUND TRIP (loopback TCP)");
+    run("session round trip D->8", benchmark_session_round_trip(round_trip_orders, freq_ghz));
+
+    print_section("RESEND, COPYING (retrieve_range, like QuickFIX get)");
+    run("resend copy (10 msgs)", benchmark_resend_retrieval(iterations, freq_ghz, true));
+
+    print_summary("NexusFIX", rows);
+    std::cout << "\n(resend copy has no QuickFIX row: QuickFIX's get() always copies)" << std::endl;
+    return 0;
+}
@@ -2,185 +2,57 @@
 // QuickFIX Performance Benchmark (standalone, C++14 compatible)
 // TICKET_004: QuickFIX Comparison Benchmark
 //
-// Usage: ./quickfix_benchmark [iterations]
-// Compare output with NexusFIX parse_benchmark results
+// Covers the same scenarios as nexusfix_compare_benchmark, with the same
+// inputs and the same percentile tables (compare_common.hpp):
+//   - parse and field access (ExecutionReport, NewOrderSingle, Heartbeat)
+//   - NewOrderSingle build + serialize
+//   - message store append (with sender sequence increment)
+//   - resend retrieval of RESEND_SPAN stored messages
+//   - session round trip over loopback: initiator sends 35=D, an in-process
+//     acceptor answers 35=8, timed until the initiator's fromApp() sees it
+//
+// Usage: ./quickfix_benchmark [iterations] [round_trip_orders] [port]
+// Run ./nexusfix_compare_benchmark with the same arguments and diff the
+// SUMMARY tables.
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
+#include <memory>
 #include <vector>
-#include <algorithm>
-#include <numeric>
-#include <cmath>
 #include <string>
+#include <thread>
 
 // QuickFIX headers
+#include <quickfix/Application.h>
 #include <quickfix/Message.h>
+#include <quickfix/MessageStore.h>
 #include <quickfix/Field.h>
 #include <quickfix/FixFields.h>
+#include <quickfix/FixValues.h>
 #include <quickfix/Values.h>
+#include <quickfix/Session.h>
+#include <quickfix/SessionSettings.h>
+#include <quickfix/SocketAcceptor.h>
+#include <quickfix/SocketInitiator.h>
+#include <quickfix/fix44/ExecutionReport.h>
+#include <quickfix/fix44/NewOrderSingle.h>
+
+#include "compare_common.hpp"
+
+// QuickFIX 1.15 spells exception specifications with EXCEPT(); older
+// releases use throw() directly
+#ifdef EXCEPT
+#define QF_THROWS(...) EXCEPT(__VA_ARGS__)
+#else
+#define QF_THROWS(...) throw(__VA_ARGS__)
+#endif
 
 namespace bench {
 
-// ============================================================================
-// High-Resolution Timing Utilities
-// ============================================================================
-
-inline uint64_t rdtsc() noexcept {
-    uint64_t lo, hi;
-    asm volatile (
-        "lfence\n\t"
-        "rdtsc\n\t"
-        "lfence\n\t"
-        : "=a"(lo), "=d"(hi)
-    );
-    return (hi << 32) | lo;
-}
-
-inline double get_cpu_freq_ghz() noexcept {
-    auto start_time = std::chrono::steady_clock::now();
-    uint64_t start_cycles = rdtsc();
-
-    volatile uint64_t dummy = 0;
-    for (int i = 0; i < 10000000; ++i) {
-        dummy += i;
-    }
-
-    uint64_t end_cycles = rdtsc();
-    auto end_time = std::chrono::steady_clock::now();
-
-    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-        end_time - start_time).count();
-
-    return static_cast<double>(end_cycles - start_cycles) / elapsed_ns;
-}
-
-inline double cycles_to_ns(uint64_t cycles, double freq_ghz) noexcept {
-    return static_cast<double>(cycles) / freq_ghz;
-}
-
-// ============================================================================
-// Statistics
-// ============================================================================
-
-struct BenchmarkStats {
-    double min_ns;
-    double max_ns;
-    double mean_ns;
-    double p50_ns;
-    double p90_ns;
-    double p99_ns;
-    double p999_ns;
-    double stddev_ns;
-    size_t iterations;
-};
-
-BenchmarkStats calculate_stats(std::vector<double>& latencies) {
-    BenchmarkStats stats = {};
-    stats.iterations = latencies.size();
-
-    if (latencies.empty()) return stats;
-
-    std::sort(latencies.begin(), latencies.end());
-
-    stats.min_ns = latencies.front();
-    stats.max_ns = latencies.back();
-
-    double sum = std::accumulate(latencies.begin(), latencies.end(), 0.0);
-    stats.mean_ns = sum / latencies.size();
-
-    auto percentile = [&](double p) {
-        size_t idx = static_cast<size_t>(p * latencies.size());
-        if (idx >= latencies.size()) idx = latencies.size() - 1;
-        return latencies[idx];
-    };
-
-    stats.p50_ns = percentile(0.50);
-    stats.p90_ns = percentile(0.90);
-    stats.p99_ns = percentile(0.99);
-    stats.p999_ns = percentile(0.999);
-
-    double sq_sum = 0.0;
-    for (size_t i = 0; i < latencies.size(); ++i) {
-        double diff = latencies[i] - stats.mean_ns;
-        sq_sum += diff * diff;
-    }
-    stats.stddev_ns = std::sqrt(sq_sum / latencies.size());
-
-    return stats;
-}
-
-void print_stats(const char* name, const BenchmarkStats& stats) {
-    std::cout << "\n=== " << name << " ===" << std::endl;
-    std::cout << std::fixed << std::setprecision(2);
-    std::cout << "  Iterations: " << stats.iterations << std::endl;
-    std::cout << "  Min:    " << std::setw(10) << stats.min_ns << " ns" << std::endl;
-    std::cout << "  Mean:   " << std::setw(10) << stats.mean_ns << " ns" << std::endl;
-    std::cout << "  P50:    " << std::setw(10) << stats.p50_ns << " ns" << std::endl;
-    std::cout << "  P90:    " << std::setw(10) << stats.p90_ns << " ns" << std::endl;
-    std::cout << "  P99:    " << std::setw(10) << stats.p99_ns << " ns" << std::endl;
-    std::cout << "  P99.9:  " << std::setw(10) << stats.p999_ns << " ns" << std::endl;
-    std::cout << "  Max:    " << std::setw(10) << stats.max_ns << " ns" << std::endl;
-    std::cout << "  StdDev: " << std::setw(10) << stats.stddev_ns << " ns" << std::endl;
-}
-
-// ============================================================================
-// Test Messages (SOH = \001)
-// ============================================================================
-
-// ExecutionReport message (35=8)
-const std::string EXEC_REPORT_MSG =
-    "8=FIX.4.4\001"
-    "9=200\001"
-    "35=8\001"
-    "49=SENDER\001"
-    "56=TARGET\001"
-    "34=12345\001"
-    "52=20240115-10:30:00.123\001"
-    "37=ORD123456\001"
-    "17=EXEC789012\001"
-    "150=0\001"
-    "39=0\001"
-    "54=1\001"
-    "151=1000\001"
-    "14=0\001"
-    "6=0\001"
-    "55=AAPL\001"
-    "38=1000\001"
-    "44=150.50\001"
-    "10=207\001";
-
-// NewOrderSingle message (35=D)
-const std::string NEW_ORDER_MSG =
-    "8=FIX.4.4\001"
-    "9=150\001"
-    "35=D\001"
-    "49=SENDER\001"
-    "56=TARGET\001"
-    "34=100\001"
-    "52=20240115-10:30:00.000\001"
-    "11=CLORD001\001"
-    "55=AAPL\001"
-    "54=1\001"
-    "60=20240115-10:30:00.000\001"
-    "38=1000\001"
-    "40=2\001"
-    "44=150.00\001"
-    "59=0\001"
-    "10=076\001";
-
-// Heartbeat message (35=0)
-const std::string HEARTBEAT_MSG =
-    "8=FIX.4.4\001"
-    "9=60\001"
-    "35=0\001"
-    "49=SENDER\001"
-    "56=TARGET\001"
-    "34=50\001"
-    "52=20240115-10:30:00.000\001"
-    "10=052\001";
-
 // ============================================================================
 // QuickFIX Benchmarks
 // ============================================================================
@@ -274,6 +146,227 @@ void benchmark_throughput(const std::string& msg, size_t num_messages) {
               << (bytes_per_sec / 1024 / 1024) << " MB/sec" << std::endl;
 }
 
+/// Build a NewOrderSingle with the fields of NEW_ORDER_MSG and serialize it
+/// (BodyLength and CheckSum computed by toString)
+BenchmarkStats benchmark_build_new_order(size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    const FIX::UtcTimeStamp stamp;
+    std::string wire;
+    size_t bytes = 0;
+
+    auto build = [&](int seq) {
+        FIX44::NewOrderSingle order(FIX::ClOrdID("CLORD001"), FIX::Side(FIX::Side_BUY),
+                                    FIX::TransactTime(stamp), FIX::OrdType(FIX::OrdType_LIMIT));
+        FIX::Header& header = order.getHeader();
+        header.setField(FIX::SenderCompID("SENDER"));
+        header.setField(FIX::TargetCompID("TARGET"));
+        header.setField(FIX::MsgSeqNum(seq));
+        header.setField(FIX::SendingTime(stamp));
+        order.set(FIX::Symbol("AAPL"));
+        order.set(FIX::OrderQty(1000));
+        order.set(FIX::Price(150.00));
+        order.set(FIX::TimeInForce(FIX::TimeInForce_DAY));
+        order.toString(wire);
+        bytes += wire.size();
+    };
+
+    for (size_t i = 0; i < 1000; ++i) build(static_cast<int>(i + 1));
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc();
+        build(static_cast<int>(i + 1));
+        uint64_t end = rdtsc();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (bytes == 0) std::cerr << "Error" << std::endl;
+    return calculate_stats(latencies);
+}
+
+/// Append one message and advance the sender sequence, as Session::send does
+BenchmarkStats benchmark_store_append(size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    FIX::MemoryStore store{FIX::UtcTimeStamp()};
+
+    int seq = 1;
+    for (size_t i = 0; i < 1000; ++i) {
+        store.set(seq++, NEW_ORDER_MSG);
+        store.incrNextSenderMsgSeqNum();
+    }
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t start = rdtsc();
+        store.set(seq++, NEW_ORDER_MSG);
+        store.incrNextSenderMsgSeqNum();
+        uint64_t end = rdtsc();
+        latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    return calculate_stats(latencies);
+}
+
+/// Fetch RESEND_SPAN consecutive messages, as a ResendRequest does
+BenchmarkStats benchmark_resend_retrieval(size_t iterations, double freq_ghz) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    FIX::MemoryStore store{FIX::UtcTimeStamp()};
+    for (size_t seq = 1; seq <= STORE_PRELOAD; ++seq) {
+        store.set(static_cast<int>(seq), NEW_ORDER_MSG);
+    }
+
+    std::vector<std::string> messages;
+    const int last_begin = static_cast<int>(STORE_PRELOAD) - RESEND_SPAN + 1;
+    size_t fetched = 0;
+    for (size_t i = 0; i < iterations + 1000; ++i) {
+        const int begin = 1 + static_cast<int>((i * 7919) % last_begin);
+        messages.clear();
+
+        uint64_t start = rdtsc();
+        store.get(begin, begin + RESEND_SPAN - 1, messages);
+        uint64_t end = rdtsc();
+
+        fetched += messages.size();
+        if (i >= 1000) latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    if (fetched == 0) std::cerr << "Error" << std::endl;
+    return calculate_stats(latencies);
+}
+
+// ============================================================================
+// Session Round Trip
+// ============================================================================
+
+/// Both ends of the loopback session: the acceptor (VENUE) acknowledges
+/// every NewOrderSingle with an ExecutionReport, the initiator (CLIENT)
+/// counts them
+class RoundTripApplication : public FIX::Application {
+public:
+    std::atomic<uint64_t> acks{0};
+    std::atomic<bool> client_logged_on{false};
+    FIX::SessionID client_session;
+
+    void onCreate(const FIX::SessionID&) {}
+    void onLogon(const FIX::SessionID& id) {
+        if (id.getSenderCompID().getValue() == "CLIENT") {
+            client_session = id;
+            client_logged_on.store(true);
+        }
+    }
+    void onLogout(const FIX::SessionID&) {}
+    void toAdmin(FIX::Message&, const FIX::SessionID&) {}
+    void toApp(FIX::Message&, const FIX::SessionID&) QF_THROWS(FIX::DoNotSend) {}
+    void fromAdmin(const FIX::Message&, const FIX::SessionID&)
+        QF_THROWS(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+                  FIX::RejectLogon) {}
+
+    void fromApp(const FIX::Message& message, const FIX::SessionID& id)
+        QF_THROWS(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+                  FIX::UnsupportedMessageType) {
+        FIX::MsgType msg_type;
+        message.getHeader().getField(msg_type);
+        if (msg_type.getValue() == FIX::MsgType_ExecutionReport) {
+            acks.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        if (msg_type.getValue() != FIX::MsgType_NewOrderSingle) return;
+
+        FIX::ClOrdID cl_ord_id;
+        FIX::Side side;
+        FIX::OrderQty qty;
+        message.getField(cl_ord_id);
+        message.getField(side);
+        message.getField(qty);
+
+        FIX44::ExecutionReport report(FIX::OrderID("O" + cl_ord_id.getValue()),
+                                      FIX::ExecID("E" + cl_ord_id.getValue()),
+                                      FIX::ExecType(FIX::ExecType_NEW),
+                                      FIX::OrdStatus(FIX::OrdStatus_NEW), side,
+                                      FIX::LeavesQty(qty.getValue()), FIX::CumQty(0),
+                                      FIX::AvgPx(0));
+        report.set(cl_ord_id);
+        report.set(FIX::Symbol("AAPL"));
+        FIX::Session::sendToTarget(report, id);
+    }
+};
+
+FIX::Dictionary session_defaults(const char* connection_type, int port) {
+    FIX::Dictionary d;
+    d.setString("ConnectionType", connection_type);
+    d.setString("StartTime", "00:00:00");
+    d.setString("EndTime", "00:00:00");
+    d.setString("HeartBtInt", "30");
+    d.setString("ReconnectInterval", "1");
+    d.setString("UseDataDictionary", "N");
+    d.setString("ResetOnLogon", "Y");
+    d.setString("SocketNodelay", "Y");
+    if (std::string(connection_type) == "acceptor") {
+        d.setString("SocketAcceptPort", std::to_string(port));
+    } else {
+        d.setString("SocketConnectHost", "127.0.0.1");
+        d.setString("SocketConnectPort", std::to_string(port));
+    }
+    return d;
+}
+
+/// Ping-pong orders through SocketInitiator -> SocketAcceptor on loopback;
+/// both sessions keep their messages in a MemoryStore, as NexusFIX does
+BenchmarkStats benchmark_session_round_trip(size_t orders, int port, double freq_ghz) {
+    RoundTripApplication app;
+    FIX::MemoryStoreFactory store_factory;
+
+    FIX::SessionSettings acceptor_settings;
+    acceptor_settings.set(session_defaults("acceptor", port));
+    acceptor_settings.set(FIX::SessionID("FIX.4.4", "VENUE", "CLIENT"), FIX::Dictionary());
+    FIX::SessionSettings initiator_settings;
+    initiator_settings.set(session_defaults("initiator", port));
+    initiator_settings.set(FIX::SessionID("FIX.4.4", "CLIENT", "VENUE"), FIX::Dictionary());
+
+    FIX::SocketAcceptor acceptor(app, store_factory, acceptor_settings);
+    FIX::SocketInitiator initiator(app, store_factory, initiator_settings);
+    acceptor.start();
+    initiator.start();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!app.client_logged_on.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (!app.client_logged_on.load()) {
+        std::cerr << "  QuickFIX logon failed (port " << port << " in use?)" << std::endl;
+        initiator.stop();
+        acceptor.stop();
+        return BenchmarkStats{};
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(orders);
+    const FIX::UtcTimeStamp stamp;
+    const size_t warmup = orders / 10;
+    for (size_t i = 0; i < warmup + orders; ++i) {
+        const uint64_t expected = app.acks.load(std::memory_order_acquire) + 1;
+        uint64_t start = rdtsc();
+
+        FIX44::NewOrderSingle order(FIX::ClOrdID("RT" + std::to_string(i)), FIX::Side(FIX::Side_BUY),
+                                    FIX::TransactTime(stamp), FIX::OrdType(FIX::OrdType_LIMIT));
+        order.set(FIX::Symbol("AAPL"));
+        order.set(FIX::OrderQty(100));
+        order.set(FIX::Price(150.25));
+        FIX::Session::sendToTarget(order, app.client_session);
+        while (app.acks.load(std::memory_order_acquire) < expected) {
+            // QuickFIX delivers fromApp() on the initiator's socket thread
+        }
+
+        uint64_t end = rdtsc();
+        if (i >= warmup) latencies.push_back(cycles_to_ns(end - start, freq_ghz));
+    }
+
+    initiator.stop();
+    acceptor.stop();
+    return calculate_stats(latencies);
+}
+
 } // namespace bench
 
 // ============================================================================
@@ -284,18 +377,20 @@ int main(int argc, char* argv[]) {
     using namespace bench;
 
     size_t iterations = 100000;
+    size_t round_trip_orders = ROUND_TRIP_ORDERS;
+    int port = 55123;
 
-    if (argc > 1) {
-        iterations = std::stoul(argv[1]);
-    }
+    if (argc > 1) iterations = std::stoul(argv[1]);
+    if (argc > 2) round_trip_orders = std::stoul(argv[2]);
+    if (argc > 3) port = std::atoi(argv[3]);
 
     std::cout << "============================================================" << std::endl;
     std::cout << "           QuickFIX Performance Benchmark" << std::endl;
     std::cout << "============================================================" << std::endl;
     std::cout << "Iterations: " << iterations << std::endl;
+    std::cout << "Round trip orders: " << round_trip_orders << std::endl;
     std::cout << std::endl;
-    std::cout << "Compare these results with NexusFIX parse_benchmark output" << std::endl;
-    std::cout << "to see the performance difference." << std::endl;
+    std::cout << "Compare the SUMMARY with nexusfix_compare_benchmark output." << std::endl;
 
     // Calibrate CPU frequency
     std::cout << "\nCalibrating CPU frequency..." << std::endl;
@@ -303,70 +398,37 @@ int main(int argc, char* argv[]) {
     std::cout << "CPU frequency: " << std::fixed << std::setprecision(3)
               << freq_ghz << " GHz" << std::endl;
 
-    // ========================================================================
-    // ExecutionReport Parse
-    // ========================================================================
-    std::cout << "\n------------------------------------------------------------" << std::endl;
-    std::cout << "                 EXECUTIONREPORT (35=8)" << std::endl;
-    std::cout << "------------------------------------------------------------" << std::endl;
-
-    auto exec_stats = benchmark_parse(EXEC_REPORT_MSG, iterations, freq_ghz);
-    print_stats("QuickFIX ExecutionReport Parse", exec_stats);
-
-    // ========================================================================
-    // Field Access
-    // ========================================================================
-    std::cout << "\n------------------------------------------------------------" << std::endl;
-    std::cout << "                    FIELD ACCESS" << std::endl;
-    std::cout << "------------------------------------------------------------" << std::endl;
-
-    auto field_stats = benchmark_field_access(EXEC_REPORT_MSG, iterations, freq_ghz);
-    print_stats("QuickFIX Field Access (4 fields)", field_stats);
-
-    // ========================================================================
-    // NewOrderSingle Parse
-    // ========================================================================
-    std::cout << "\n------------------------------------------------------------" << std::endl;
-    std::cout << "                 NEWORDERSINGLE (35=D)" << std::endl;
-    std::cout << "------------------------------------------------------------" << std::endl;
-
-    auto order_stats = benchmark_parse(NEW_ORDER_MSG, iterations, freq_ghz);
-    print_stats("QuickFIX NewOrderSingle Parse", order_stats);
-
-    // ========================================================================
-    // Heartbeat Parse
-    // ========================================================================
-    std::cout << "\n------------------------------------------------------------" << std::endl;
-    std::cout << "                   HEARTBEAT (35=0)" << std::endl;
-    std::cout << "------------------------------------------------------------" << std::endl;
-
-    auto hb_stats = benchmark_parse(HEARTBEAT_MSG, iterations, freq_ghz);
-    print_stats("QuickFIX Heartbeat Parse", hb_stats);
-
-    // ========================================================================
-    // Throughput
-    // ========================================================================
-    std::cout << "\n------------------------------------------------------------" << std::endl;
-    std::cout << "                     THROUGHPUT" << std::endl;
-    std::cout << "------------------------------------------------------------" << std::endl;
+    std::vector<SummaryRow> rows;
+    auto run = [&](const char* scenario, const BenchmarkStats& stats) {
+        print_stats(scenario, stats);
+        SummaryRow row = {scenario, stats};
+        rows.push_back(row);
+    };
+
+    print_section("PARSE");
+    run("parse ExecutionReport", benchmark_parse(EXEC_REPORT_MSG, iterations, freq_ghz));
+    run("field access (4 fields)", benchmark_field_access(EXEC_REPORT_MSG, iterations, freq_ghz));
+    run("parse NewOrderSingle", benchmark_parse(NEW_ORDER_MSG, iterations, freq_ghz));
+    run("parse Heartbeat", benchmark_parse(HEARTBEAT_MSG, iterations, freq_ghz));
+
+    print_section("SERIALIZE");
+    run("build NewOrderSingle", benchmark_build_new_order(iterations, freq_ghz));
+
+    print_section("MESSAGE STORE (MemoryStore)");
+    run("store append + seq", benchmark_store_append(iterations, freq_ghz));
+    run("resend retrieval (10 msgs)", benchmark_resend_retrieval(iterations, freq_ghz));
 
+    print_section("SESSION ROUND TRIP (loopback TCP)");
+    run("session round trip D->8", benchmark_session_round_trip(round_trip_orders, port, freq_ghz));
+
+    print_section("THROUGHPUT");
     benchmark_throughput(EXEC_REPORT_MSG, iterations);
 
-    // ========================================================================
-    // Summary
-    // ========================================================================
-    std::cout << "\n============================================================" << std::endl;
-    std::cout << "                    QuickFIX SUMMARY" << std::endl;
-    std::cout << "============================================================" << std::endl;
-    std::cout << std::fixed << std::setprecision(2);
-    std::cout << "ExecutionReport Parse:  " << exec_stats.mean_ns << " ns (mean)" << std::endl;
-    std::cout << "Field Access (4 fields): " << field_stats.mean_ns << " ns (mean)" << std::endl;
-    std::cout << "NewOrderSingle Parse:   " << order_stats.mean_ns << " ns (mean)" << std::endl;
-    std::cout << "Heartbeat Parse:        " << hb_stats.mean_ns << " ns (mean)" << std::endl;
-    std::cout << "============================================================" << std::endl;
+    print_summary("QuickFIX", rows);
     std::cout << std::endl;
     std::cout << "To compare with NexusFIX, run:" << std::endl;
-    std::cout << "  ./build/bin/benchmarks/parse_benchmark " << iterations << std::endl;
+    std::cout << "  ./build/bin/benchmarks/nexusfix_compare_benchmark " << iterations << " "
+              << round_trip_orders << std::endl;
     std::cout << std::endl;
 
     return 0;
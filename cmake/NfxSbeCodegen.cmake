@@ -0,0 +1,61 @@
+# NexusFIX SBE codec generation
+#
+# nfx_sbe_generate(<target>
+#     SCHEMA <schema.xml>
+#     [NAMESPACE <c++ namespace>]      # default nfx::sbe::<package>
+#     [OUTPUT <header name>])          # default <schema name>.hpp
+#
+# Runs tools/sbe_codegen.py at build time (re-run when the schema or the
+# generator changes) and creates INTERFACE target <target>, linked to
+# nexusfix, whose include path holds the generated header:
+#
+#     nfx_sbe_generate(mdp3_codecs SCHEMA schemas/templates_FixBinary.xml
+#                      NAMESPACE nfx::sbe::mdp3 OUTPUT mdp3.hpp)
+#     target_link_libraries(feed_handler PRIVATE mdp3_codecs)
+#     // #include "mdp3.hpp"
+
+include_guard(GLOBAL)
+
+find_package(Python3 COMPONENTS Interpreter QUIET)
+
+find_file(NFX_SBE_CODEGEN sbe_codegen.py
+    PATHS "${CMAKE_CURRENT_LIST_DIR}" "${CMAKE_CURRENT_LIST_DIR}/../tools"
+    NO_DEFAULT_PATH
+)
+
+function(nfx_sbe_generate target)
+    cmake_parse_arguments(PARSE_ARGV 1 SBE "" "SCHEMA;NAMESPACE;OUTPUT" "")
+    if(NOT SBE_SCHEMA)
+        message(FATAL_ERROR "nfx_sbe_generate(${target}): SCHEMA is required")
+    endif()
+    if(NOT Python3_Interpreter_FOUND OR NOT NFX_SBE_CODEGEN)
+        message(FATAL_ERROR "nfx_sbe_generate(${target}): needs Python 3 and sbe_codegen.py")
+    endif()
+
+    get_filename_component(schema "${SBE_SCHEMA}" ABSOLUTE)
+    if(NOT SBE_OUTPUT)
+        get_filename_component(SBE_OUTPUT "${schema}" NAME_WE)
+        set(SBE_OUTPUT "${SBE_OUTPUT}.hpp")
+    endif()
+
+    set(out_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}")
+    set(header "${out_dir}/${SBE_OUTPUT}")
+    set(ns_args)
+    if(SBE_NAMESPACE)
+        set(ns_args --namespace "${SBE_NAMESPACE}")
+    endif()
+
+    add_custom_command(
+        OUTPUT "${header}"
+        COMMAND Python3::Interpreter "${NFX_SBE_CODEGEN}" "${schema}" -o "${header}" ${ns_args}
+        DEPENDS "${schema}" "${NFX_SBE_CODEGEN}"
+        COMMENT "Generating SBE codecs ${SBE_OUTPUT} from ${SBE_SCHEMA}"
+        VERBATIM
+    )
+    add_custom_target(${target}_codegen DEPENDS "${header}")
+
+    add_library(${target} INTERFACE)
+    target_include_directories(${target} INTERFACE "${out_dir}")
+    target_link_libraries(${target} INTERFACE nexusfix)
+    add_dependencies(${target} ${target}_codegen)
+endfunction()
@@ -0,0 +1,38 @@
+// binlog_decode.cpp
+// NexusFIX Binary Log Decoder
+// Renders a file written by util::BinaryLogger as one text line per message:
+//   20260122-14:30:45.123456789 I 1 8=FIX.4.4|9=...|
+//
+// Usage: binlog_decode <file.nfxlog> [session_id]
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "nexusfix/util/binary_logger.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <file.nfxlog> [session_id]\n", argv[0]);
+        return 2;
+    }
+
+    nfx::util::BinaryLogReader reader{argv[1]};
+    if (!reader.is_valid()) {
+        std::fprintf(stderr, "%s: not a NexusFIX binary log\n", argv[1]);
+        return 1;
+    }
+
+    const bool filter = argc > 2;
+    const auto session = filter ? static_cast<uint16_t>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    nfx::util::BinaryLogEntry entry;
+    std::string line;
+    while (reader.next(entry)) {
+        if (filter && entry.session_id != session) continue;
+        nfx::util::format_log_entry(entry, line);
+        line += '\n';
+        std::fwrite(line.data(), 1, line.size(), stdout);
+    }
+    return 0;
+}
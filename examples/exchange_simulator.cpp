@@ -0,0 +1,250 @@
+// exchange_simulator.cpp
+// NexusFIX Exchange Simulator
+// A matching venue for end-to-end benchmarks without a venue UAT: an AcceptorEngine whose
+// sessions answer NewOrderSingle / OrderCancelRequest / OrderCancelReplaceRequest from an
+// ExchangeSimulator (session/exchange_simulator.hpp) - a price-time book per session,
+// simulated liquidity filling fill_ratio of the orders, and ExecutionReports rendered from
+// pre-serialized templates, released after a configurable latency.
+//
+// The defaults pair with benchmarks/load_generator (SenderCompID LOADGEN1..N, TargetCompID VENUE):
+//   exchange_simulator --port=9876 --sessions=4 --ack-latency=uniform:20:50 --fill-latency=exp:50:200
+//   load_generator --target=127.0.0.1:9876 --sessions=4 --rate=250000
+//
+// Latencies are DIST:MIN[:X] in microseconds: fixed:MIN, uniform:MIN:MAX, exp:MIN:MEAN[:MAX]
+//
+// Usage: exchange_simulator [--port=N] [--sessions=N] [--sender=ID] [--target-prefix=PREFIX]
+//                           [--fill-ratio=X] [--partial-ratio=X] [--reject-ratio=X]
+//                           [--ack-latency=SPEC] [--fill-latency=SPEC] [--max-orders=N]
+//                           [--cores=a,b,...] [--busy-poll] [--duration=S]
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nexusfix/session/acceptor_engine.hpp"
+#include "nexusfix/session/exchange_simulator.hpp"
+
+namespace {
+
+std::atomic<bool> g_running{true};
+
+void signal_handler(int /*sig*/) {
+    g_running = false;
+}
+
+struct VenueSimulator;
+
+/// One per session; runs on the worker the session is bound to
+struct VenueApp {
+    VenueSimulator* sim{nullptr};
+
+    void on_app_message(const nfx::ParsedMessage& msg) noexcept;
+    void on_state_change(nfx::SessionState from, nfx::SessionState to) noexcept;
+    void on_error(const nfx::SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+    void on_poll() noexcept;
+};
+
+// VenueApp must be complete before the engine's constraints see it
+using Engine = nfx::AcceptorEngine<VenueApp>;
+
+struct VenueSimulator : nfx::ExchangeSimulator<Engine::Session> {
+    using ExchangeSimulator::ExchangeSimulator;
+};
+
+void VenueApp::on_app_message(const nfx::ParsedMessage& msg) noexcept {
+    sim->on_app_message(msg);
+}
+
+void VenueApp::on_state_change(nfx::SessionState from, nfx::SessionState to) noexcept {
+    // Reports owed to a dropped connection are not resent; resting orders stay
+    if (nfx::is_connected(from) && !nfx::is_connected(to)) sim->clear_pending();
+}
+
+void VenueApp::on_poll() noexcept {
+    if (sim->pending()) (void)sim->poll();
+}
+
+/// fixed:MIN | uniform:MIN:MAX | exp:MIN:MEAN[:MAX], microseconds
+std::optional<nfx::LatencyModel> parse_latency(std::string_view spec) {
+    std::vector<double> us;
+    const size_t colon = spec.find(':');
+    if (colon == std::string_view::npos) return std::nullopt;
+    const std::string_view dist = spec.substr(0, colon);
+    std::string rest{spec.substr(colon + 1)};
+    for (char* p = rest.data(); *p;) {
+        char* end = nullptr;
+        us.push_back(std::strtod(p, &end));
+        if (end == p) return std::nullopt;
+        p = *end == ':' ? end + 1 : end;
+    }
+    auto ns = [&](size_t i) { return i < us.size() ? static_cast<uint64_t>(us[i] * 1000.0) : 0; };
+
+    nfx::LatencyModel model;
+    if (dist == "fixed" && us.size() == 1) {
+        model.distribution = nfx::LatencyDistribution::Fixed;
+        model.min_ns = ns(0);
+    } else if (dist == "uniform" && us.size() == 2) {
+        model.distribution = nfx::LatencyDistribution::Uniform;
+        model.min_ns = ns(0);
+        model.max_ns = ns(1);
+    } else if (dist == "exp" && (us.size() == 2 || us.size() == 3)) {
+        model.distribution = nfx::LatencyDistribution::Exponential;
+        model.min_ns = ns(0);
+        model.mean_ns = ns(1);
+        model.max_ns = ns(2);
+    } else {
+        return std::nullopt;
+    }
+    return model;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    nfx::AcceptorEngineConfig engine_config{.port = 9876};
+    nfx::ExchangeSimulatorConfig sim_config{.fill_ratio = 0.5};
+    size_t sessions = 1;
+    std::string sender = "VENUE";
+    std::string target_prefix = "LOADGEN";
+    double duration_s = 0.0;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        auto value = [&](std::string_view name) { return std::string{arg.substr(name.size())}; };
+        if (arg.starts_with("--port=")) {
+            engine_config.port = static_cast<uint16_t>(std::strtoul(value("--port=").c_str(), nullptr, 10));
+        }
+        else if (arg.starts_with("--sessions=")) sessions = std::strtoul(value("--sessions=").c_str(), nullptr, 10);
+        else if (arg.starts_with("--sender=")) sender = value("--sender=");
+        else if (arg.starts_with("--target-prefix=")) target_prefix = value("--target-prefix=");
+        else if (arg.starts_with("--fill-ratio=")) sim_config.fill_ratio = std::strtod(value("--fill-ratio=").c_str(), nullptr);
+        else if (arg.starts_with("--partial-ratio=")) {
+            sim_config.partial_fill_ratio = std::strtod(value("--partial-ratio=").c_str(), nullptr);
+        }
+        else if (arg.starts_with("--reject-ratio=")) {
+            sim_config.reject_ratio = std::strtod(value("--reject-ratio=").c_str(), nullptr);
+        }
+        else if (arg.starts_with("--ack-latency=") || arg.starts_with("--fill-latency=")) {
+            const bool ack = arg.starts_with("--ack-latency=");
+            auto model = parse_latency(value(ack ? "--ack-latency=" : "--fill-latency="));
+            if (!model) {
+                std::fprintf(stderr, "bad latency %s (fixed:MIN, uniform:MIN:MAX, exp:MIN:MEAN[:MAX])\n", argv[i]);
+                return 2;
+            }
+            (ack ? sim_config.ack_latency : sim_config.fill_latency) = *model;
+        }
+        else if (arg.starts_with("--max-orders=")) {
+            sim_config.max_orders = std::strtoul(value("--max-orders=").c_str(), nullptr, 10);
+        }
+        else if (arg.starts_with("--cores=")) {
+            engine_config.cores.allowed_cores.clear();
+            const std::string list = value("--cores=");
+            for (const char* p = list.c_str(); *p;) {
+                char* end = nullptr;
+                engine_config.cores.allowed_cores.push_back(static_cast<int>(std::strtol(p, &end, 10)));
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+        else if (arg == "--busy-poll") engine_config.busy_poll = true;
+        else if (arg.starts_with("--duration=")) duration_s = std::strtod(value("--duration=").c_str(), nullptr);
+        else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (sessions == 0) {
+        std::fprintf(stderr, "--sessions must be at least 1\n");
+        return 2;
+    }
+    // Sub-millisecond latencies need the workers awake between packets
+    if (sim_config.ack_latency.min_ns || sim_config.ack_latency.max_ns || sim_config.ack_latency.mean_ns ||
+        sim_config.fill_latency.min_ns || sim_config.fill_latency.max_ns || sim_config.fill_latency.mean_ns) {
+        engine_config.timer_interval_ms = 1;
+    }
+
+    std::vector<std::unique_ptr<VenueSimulator>> simulators;   // Destroyed after the engine: stop() calls into them
+    Engine engine{engine_config};
+    for (size_t i = 1; i <= sessions; ++i) {
+        const std::string target = target_prefix + std::to_string(i);
+        nfx::SessionConfig config;
+        config.sender_comp_id = sender;
+        config.target_comp_id = target;
+        Engine::Session* session = engine.add_session(config);
+        if (!session) {
+            std::fprintf(stderr, "cannot add session %s -> %s\n", sender.c_str(), target.c_str());
+            return 1;
+        }
+        sim_config.seed = i;
+        simulators.push_back(std::make_unique<VenueSimulator>(*session, sim_config));
+        session->handler().app.sim = simulators.back().get();
+    }
+
+    if (auto started = engine.start(); !started) {
+        std::fprintf(stderr, "cannot start on port %u: %s\n", engine_config.port,
+                     std::string{started.error().message()}.c_str());
+        return 1;
+    }
+    std::printf("exchange simulator on port %u: %zu sessions (%s -> %s1..%zu), %zu workers%s\n",
+                engine.port(), sessions, sender.c_str(), target_prefix.c_str(), sessions,
+                engine.worker_count(), engine_config.busy_poll ? ", busy polling" : "");
+    std::printf("fill ratio %.2f, partial %.2f, reject %.2f\n",
+                sim_config.fill_ratio, sim_config.partial_fill_ratio, sim_config.reject_ratio);
+
+    std::signal(SIGINT, signal_handler);
+    std::signal(SIGTERM, signal_handler);
+    const auto start = std::chrono::steady_clock::now();
+    while (g_running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        if (duration_s > 0.0 &&
+            std::chrono::steady_clock::now() - start >= std::chrono::duration<double>{duration_s}) {
+            break;
+        }
+    }
+    engine.stop();
+
+    // Workers are joined: the simulators' counters are safe to read
+    nfx::ExchangeSimulatorStats total{};
+    for (const auto& sim : simulators) {
+        const nfx::ExchangeSimulatorStats& s = sim->stats();
+        total.orders += s.orders;
+        total.cancels += s.cancels;
+        total.replaces += s.replaces;
+        total.rejects += s.rejects;
+        total.cancel_rejects += s.cancel_rejects;
+        total.trades += s.trades;
+        total.traded_qty += s.traded_qty;
+        total.sent += s.sent;
+        total.dropped += s.dropped;
+        total.early_releases += s.early_releases;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const auto& engine_stats = engine.stats();
+    std::printf("%llu connections bound, %llu rejected\n",
+                static_cast<unsigned long long>(engine_stats.bound.load()),
+                static_cast<unsigned long long>(engine_stats.rejected.load()));
+    std::printf("%llu orders, %llu cancels, %llu replaces -> %llu reports (%.0f/s)\n",
+                static_cast<unsigned long long>(total.orders),
+                static_cast<unsigned long long>(total.cancels),
+                static_cast<unsigned long long>(total.replaces),
+                static_cast<unsigned long long>(total.sent),
+                elapsed > 0.0 ? static_cast<double>(total.sent) / elapsed : 0.0);
+    std::printf("%llu trades (%llu units), %llu rejects, %llu cancel rejects, "
+                "%llu dropped, %llu released early\n",
+                static_cast<unsigned long long>(total.trades),
+                static_cast<unsigned long long>(total.traded_qty),
+                static_cast<unsigned long long>(total.rejects),
+                static_cast<unsigned long long>(total.cancel_rejects),
+                static_cast<unsigned long long>(total.dropped),
+                static_cast<unsigned long long>(total.early_releases));
+    return 0;
+}
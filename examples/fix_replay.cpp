@@ -0,0 +1,133 @@
+// fix_replay.cpp
+// NexusFIX Session Replay
+// Replays a packet capture or a util::BinaryLogger file (session/session_replay.hpp),
+// parsing every message, or mirrors it to a live acceptor:
+//   fix_replay venue.pcap --local-port=40000 --direction=I
+//   fix_replay fix.nfxlog --original --speed=10 --mirror=uat-venue:9876 --direction=O
+//
+// Usage: fix_replay <file.pcap|file.pcapng|file.nfxlog> [--original] [--speed=X]
+//                   [--direction=I|O] [--stream=N] [--local-port=N] [--no-parse]
+//                   [--mirror=HOST:PORT]
+
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/session/session_replay.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+namespace {
+
+struct Totals {
+    uint64_t parsed{0};
+    uint64_t rejected{0};
+};
+
+void print_stats(const nfx::ReplayStats& stats, const Totals* totals) {
+    const double sec = static_cast<double>(stats.elapsed_ns) / 1e9;
+    std::printf("%llu messages, %llu bytes in %.3f s (%llu filtered)\n",
+                static_cast<unsigned long long>(stats.messages),
+                static_cast<unsigned long long>(stats.bytes), sec,
+                static_cast<unsigned long long>(stats.skipped));
+    if (sec > 0.0) {
+        std::printf("%.2f Mmsg/s, %.1f MB/s\n", static_cast<double>(stats.messages) / sec / 1e6,
+                    static_cast<double>(stats.bytes) / sec / 1e6);
+    }
+    if (stats.max_lag_ns) {
+        std::printf("max lag behind schedule: %.1f us\n", static_cast<double>(stats.max_lag_ns) / 1e3);
+    }
+    if (totals) {
+        std::printf("%llu parsed, %llu rejected\n", static_cast<unsigned long long>(totals->parsed),
+                    static_cast<unsigned long long>(totals->rejected));
+    }
+}
+
+template <nfx::ReplaySource Source>
+int run(Source& source, const nfx::ReplayOptions& options, bool parse, std::string_view mirror_to) {
+    if (!mirror_to.empty()) {
+        const size_t colon = mirror_to.rfind(':');
+        if (colon == std::string_view::npos) {
+            std::fprintf(stderr, "--mirror expects HOST:PORT\n");
+            return 2;
+        }
+        const std::string host{mirror_to.substr(0, colon)};
+        const auto port = static_cast<uint16_t>(std::strtoul(std::string{mirror_to.substr(colon + 1)}.c_str(), nullptr, 10));
+        nfx::TcpSocket socket;
+        if (!socket.connect(host, port)) {
+            std::fprintf(stderr, "cannot connect to %s:%u\n", host.c_str(), port);
+            return 1;
+        }
+        (void)socket.set_nodelay(true);
+        const nfx::MirrorStats stats = nfx::mirror(source, socket, options);
+        print_stats(stats.replay, nullptr);
+        std::printf("%llu response bytes, %llu send failures\n",
+                    static_cast<unsigned long long>(stats.bytes_received),
+                    static_cast<unsigned long long>(stats.send_failures));
+        return stats.send_failures ? 1 : 0;
+    }
+
+    Totals totals;
+    const nfx::ReplayStats stats = nfx::replay(source, options, [&](const nfx::ReplayMessage& msg) {
+        if (!parse) return;
+        if (nfx::ParsedMessage::parse(msg.bytes)) ++totals.parsed;
+        else ++totals.rejected;
+    });
+    print_stats(stats, parse ? &totals : nullptr);
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <file.pcap|file.pcapng|file.nfxlog> [--original] [--speed=X]\n"
+                             "       [--direction=I|O] [--stream=N] [--local-port=N] [--no-parse]"
+                             " [--mirror=HOST:PORT]\n", argv[0]);
+        return 2;
+    }
+
+    nfx::ReplayOptions options;
+    nfx::PcapReplaySource::Config capture;
+    bool parse = true;
+    std::string_view mirror_to;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const auto value = [&](std::string_view prefix) { return std::string{arg.substr(prefix.size())}; };
+        if (arg == "--original") options.pacing = nfx::ReplayPacing::Original;
+        else if (arg.starts_with("--speed=")) {
+            options.pacing = nfx::ReplayPacing::Original;
+            options.speed = std::strtod(value("--speed=").c_str(), nullptr);
+        }
+        else if (arg == "--direction=I") options.direction = nfx::ReplayDirection::Inbound;
+        else if (arg == "--direction=O") options.direction = nfx::ReplayDirection::Outbound;
+        else if (arg.starts_with("--stream=")) options.stream = std::atoi(value("--stream=").c_str());
+        else if (arg.starts_with("--local-port=")) {
+            capture.local_port = static_cast<uint16_t>(std::strtoul(value("--local-port=").c_str(), nullptr, 10));
+        }
+        else if (arg == "--no-parse") parse = false;
+        else if (arg.starts_with("--mirror=")) mirror_to = arg.substr(9);
+        else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    if (auto log = nfx::BinaryLogReplaySource::open(argv[1])) {
+        return run(*log, options, parse, mirror_to);
+    }
+    if (auto pcap = nfx::PcapReplaySource::open(argv[1], capture)) {
+        const int rc = run(*pcap, options, parse, mirror_to);
+        const auto& s = pcap->stats();
+        std::printf("capture: %llu frames, %llu TCP segments, %llu retransmitted bytes, %llu gaps,"
+                    " %llu messages reassembled\n",
+                    static_cast<unsigned long long>(s.frames), static_cast<unsigned long long>(s.segments),
+                    static_cast<unsigned long long>(s.retransmitted), static_cast<unsigned long long>(s.gaps),
+                    static_cast<unsigned long long>(s.reassembled));
+        return rc;
+    }
+    std::fprintf(stderr, "%s: not a packet capture or NexusFIX binary log\n", argv[1]);
+    return 1;
+}
@@ -0,0 +1,539 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/fast/stop_bit.hpp"
+
+namespace nfx::fast {
+
+// ============================================================================
+// FAST Templates
+// ============================================================================
+//
+// A FAST message is a presence map, a template ID and the template's
+// fields in order; field operators let the sender omit values the
+// receiver can derive from the previous message:
+//
+//   constant   value from the template (pmap bit only if optional)
+//   default    pmap bit set: value follows, clear: template value
+//   copy       pmap bit set: value follows, clear: previous value
+//   increment  pmap bit set: value follows, clear: previous value + 1
+//   delta      signed difference to the previous value (no pmap bit)
+//
+// Templates are C++ types, not XML read at run time: each field is a
+// descriptor carrying its tag, operator and initial value, so every
+// template compiles to straight-line decode code with the operator and
+// presence map handling resolved at compile time:
+//
+//   using MDIncRefresh = Template<32,
+//       Ascii<35, Op::Constant, Presence::Mandatory, "X">,
+//       UInt32<34, Op::Increment>,                          // MsgSeqNum
+//       UInt64<52, Op::Delta>,                              // SendingTime
+//       Sequence<UInt32<268>,                               // NoMDEntries
+//           UInt32<279, Op::Copy>,                          // MDUpdateAction
+//           Ascii<269, Op::Copy>,                           // MDEntryType
+//           UInt32<48, Op::Copy>,                           // SecurityID
+//           UInt32<83, Op::Increment>,                      // RptSeq
+//           Decimal<270, Op::Delta>,                        // MDEntryPx
+//           Int64<271, Op::Delta>>>;                        // MDEntrySize
+//
+//   Decoder<MDIncRefresh, MDSnapshot> decoder;
+//   decoder.decode(packet, sink);    // every message in the packet
+//
+// Dictionaries are per template (the FAST "template" scope); reset()
+// returns every field to its initial value, as a FAST reset message or a
+// new packet on a reset-per-packet feed requires.
+//
+// Decoded values go to a sink, whose callbacks are all optional and take
+// the tag as a template argument (see MDEntrySink in md_entry_decode.hpp):
+//   on_template(uint32_t id)          on_end(uint32_t id)
+//   on_uint<Tag>(uint64_t)            on_int<Tag>(int64_t)
+//   on_decimal<Tag>(int64_t mantissa, int32_t exponent)
+//   on_string<Tag>(std::string_view)  (valid until the next message)
+//   on_sequence<Tag>(uint32_t length) on_element<Tag>(uint32_t index)
+// Absent optional fields produce no call.
+
+enum class Op : uint8_t { None, Constant, Default, Copy, Increment, Delta };
+
+enum class Presence : uint8_t { Mandatory, Optional };
+
+/// Template string value (constant / default / initial)
+template <size_t N>
+struct Literal {
+    char value[N];
+
+    consteval Literal(const char (&text)[N]) noexcept {
+        std::copy_n(text, N, value);
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {value, N - 1}; }
+};
+
+namespace detail {
+
+/// Previous value state of a dictionary entry
+enum class Assigned : uint8_t { Undefined, Value, Empty };
+
+/// Field takes a presence map bit
+[[nodiscard]] consteval bool uses_pmap_bit(Op op, Presence presence) noexcept {
+    switch (op) {
+        case Op::None:
+        case Op::Delta:    return false;
+        case Op::Constant: return presence == Presence::Optional;
+        default:           return true;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Sink Calls (each callback is optional)
+// ----------------------------------------------------------------------------
+
+template <int Tag, typename Sink, typename T>
+NFX_FORCE_INLINE void emit_integer(Sink& sink, T value) noexcept {
+    if constexpr (std::is_signed_v<T>) {
+        if constexpr (requires { sink.template on_int<Tag>(int64_t{}); }) {
+            sink.template on_int<Tag>(static_cast<int64_t>(value));
+        }
+    } else {
+        if constexpr (requires { sink.template on_uint<Tag>(uint64_t{}); }) {
+            sink.template on_uint<Tag>(static_cast<uint64_t>(value));
+        }
+    }
+}
+
+template <int Tag, typename Sink>
+NFX_FORCE_INLINE void emit_decimal(Sink& sink, int64_t mantissa, int32_t exponent) noexcept {
+    if constexpr (requires { sink.template on_decimal<Tag>(int64_t{}, int32_t{}); }) {
+        sink.template on_decimal<Tag>(mantissa, exponent);
+    }
+}
+
+template <int Tag, typename Sink>
+NFX_FORCE_INLINE void emit_string(Sink& sink, std::string_view value) noexcept {
+    if constexpr (requires { sink.template on_string<Tag>(std::string_view{}); }) {
+        sink.template on_string<Tag>(value);
+    }
+}
+
+/// Integer of type T as encoded, nullable for optional fields
+template <typename T>
+[[nodiscard]] NFX_FORCE_INLINE std::optional<T> read_integer(FastReader& r, bool nullable) noexcept {
+    if constexpr (std::is_signed_v<T>) {
+        if (nullable) {
+            const auto v = r.nullable_int64();
+            if (v && (*v < std::numeric_limits<T>::min() || *v > std::numeric_limits<T>::max())) {
+                r.fail(FastError::Overflow);
+            }
+            return v ? std::optional<T>{static_cast<T>(*v)} : std::nullopt;
+        }
+        if constexpr (sizeof(T) == 4) return r.int32();
+        else return r.int64();
+    } else {
+        if (nullable) {
+            const auto v = r.nullable_uint64();
+            if (v && *v > std::numeric_limits<T>::max()) r.fail(FastError::Overflow);
+            return v ? std::optional<T>{static_cast<T>(*v)} : std::nullopt;
+        }
+        if constexpr (sizeof(T) == 4) return r.uint32();
+        else return r.uint64();
+    }
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Integer Fields
+// ============================================================================
+
+/// Integer field descriptor
+/// @tparam T uint32_t, int32_t, uint64_t or int64_t
+/// @tparam Initial Dictionary initial value (constant / default value)
+/// @tparam HasInitial Initial is set (copy / increment / default)
+template <typename T, int Tag, Op O, Presence P, T Initial, bool HasInitial>
+struct IntegerField {
+    static constexpr int tag = Tag;
+    static constexpr bool uses_pmap = detail::uses_pmap_bit(O, P);
+    static constexpr bool optional = P == Presence::Optional;
+
+    struct State {
+        T value{Initial};
+        detail::Assigned assigned{detail::Assigned::Undefined};
+    };
+
+    /// Decode the field's value (nullopt: absent)
+    [[nodiscard]] NFX_FORCE_INLINE static std::optional<T> read(
+        FastReader& r, PresenceMap& pmap, State& s) noexcept {
+        if constexpr (O == Op::None) {
+            return detail::read_integer<T>(r, optional);
+        } else if constexpr (O == Op::Constant) {
+            if constexpr (optional) {
+                if (!pmap.next()) return std::nullopt;
+            }
+            return Initial;
+        } else if constexpr (O == Op::Default) {
+            if (pmap.next()) return detail::read_integer<T>(r, optional);
+            if constexpr (HasInitial) return Initial;
+            else return missing(r);
+        } else if constexpr (O == Op::Copy || O == Op::Increment) {
+            if (pmap.next()) return assign(s, detail::read_integer<T>(r, optional));
+            switch (s.assigned) {
+                case detail::Assigned::Value:
+                    if constexpr (O == Op::Increment) s.value = static_cast<T>(s.value + 1);
+                    return s.value;
+                case detail::Assigned::Empty:
+                    return missing(r);
+                default:
+                    // Undefined: the initial value, if there is one
+                    if constexpr (HasInitial) return assign(s, Initial);
+                    s.assigned = detail::Assigned::Empty;
+                    return missing(r);
+            }
+        } else {
+            static_assert(O == Op::Delta);
+            const auto delta = optional ? r.nullable_int64() : std::optional<int64_t>{r.int64()};
+            if (!delta) return std::nullopt;
+            const T base = s.assigned == detail::Assigned::Value ? s.value : Initial;
+            s.value = static_cast<T>(static_cast<int64_t>(base) + *delta);
+            s.assigned = detail::Assigned::Value;
+            return s.value;
+        }
+    }
+
+    template <typename Sink>
+    NFX_FORCE_INLINE static void decode(FastReader& r, PresenceMap& pmap, State& s, Sink& sink) noexcept {
+        if (const auto v = read(r, pmap, s)) detail::emit_integer<Tag>(sink, *v);
+    }
+
+private:
+    static std::optional<T> assign(State& s, std::optional<T> v) noexcept {
+        if (v) {
+            s.value = *v;
+            s.assigned = detail::Assigned::Value;
+        } else {
+            s.assigned = detail::Assigned::Empty;
+        }
+        return v;
+    }
+
+    /// No value and no previous one: an error unless the field is optional
+    static std::optional<T> missing(FastReader& r) noexcept {
+        if constexpr (!optional) r.fail(FastError::MissingValue);
+        return std::nullopt;
+    }
+};
+
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory, uint32_t Initial = 0, bool HasInitial = (Initial != 0)>
+using UInt32 = IntegerField<uint32_t, Tag, O, P, Initial, HasInitial>;
+
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory, int32_t Initial = 0, bool HasInitial = (Initial != 0)>
+using Int32 = IntegerField<int32_t, Tag, O, P, Initial, HasInitial>;
+
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory, uint64_t Initial = 0, bool HasInitial = (Initial != 0)>
+using UInt64 = IntegerField<uint64_t, Tag, O, P, Initial, HasInitial>;
+
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory, int64_t Initial = 0, bool HasInitial = (Initial != 0)>
+using Int64 = IntegerField<int64_t, Tag, O, P, Initial, HasInitial>;
+
+// ============================================================================
+// Decimal Fields
+// ============================================================================
+
+/// Scaled decimal: exponent (int32) then mantissa (int64), one operator
+/// for the pair. Delta sends both differences; increment is not defined.
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory,
+          int64_t InitialMantissa = 0, int32_t InitialExponent = 0,
+          bool HasInitial = (InitialMantissa != 0 || InitialExponent != 0)>
+struct Decimal {
+    static_assert(O != Op::Increment, "FAST decimals have no increment operator");
+
+    static constexpr int tag = Tag;
+    static constexpr bool uses_pmap = detail::uses_pmap_bit(O, P);
+    static constexpr bool optional = P == Presence::Optional;
+
+    struct Value {
+        int64_t mantissa;
+        int32_t exponent;
+    };
+
+    struct State {
+        Value value{InitialMantissa, InitialExponent};
+        detail::Assigned assigned{detail::Assigned::Undefined};
+    };
+
+    [[nodiscard]] NFX_FORCE_INLINE static std::optional<Value> read(
+        FastReader& r, PresenceMap& pmap, State& s) noexcept {
+        if constexpr (O == Op::None) {
+            return read_value(r);
+        } else if constexpr (O == Op::Constant) {
+            if constexpr (optional) {
+                if (!pmap.next()) return std::nullopt;
+            }
+            return Value{InitialMantissa, InitialExponent};
+        } else if constexpr (O == Op::Default) {
+            if (pmap.next()) return read_value(r);
+            if constexpr (HasInitial) return Value{InitialMantissa, InitialExponent};
+            else return missing(r);
+        } else if constexpr (O == Op::Copy) {
+            if (pmap.next()) {
+                const auto v = read_value(r);
+                s.assigned = v ? detail::Assigned::Value : detail::Assigned::Empty;
+                if (v) s.value = *v;
+                return v;
+            }
+            if (s.assigned == detail::Assigned::Undefined) {
+                s.assigned = HasInitial ? detail::Assigned::Value : detail::Assigned::Empty;
+            }
+            if (s.assigned == detail::Assigned::Value) return s.value;
+            return missing(r);
+        } else {
+            static_assert(O == Op::Delta);
+            const auto exp_delta = optional ? r.nullable_int64() : std::optional<int64_t>{r.int64()};
+            if (!exp_delta) return std::nullopt;
+            const int64_t mantissa_delta = r.int64();
+            const Value base = s.assigned == detail::Assigned::Value
+                ? s.value : Value{InitialMantissa, InitialExponent};
+            s.value = Value{base.mantissa + mantissa_delta,
+                            static_cast<int32_t>(base.exponent + *exp_delta)};
+            s.assigned = detail::Assigned::Value;
+            return s.value;
+        }
+    }
+
+    template <typename Sink>
+    NFX_FORCE_INLINE static void decode(FastReader& r, PresenceMap& pmap, State& s, Sink& sink) noexcept {
+        if (const auto v = read(r, pmap, s)) detail::emit_decimal<Tag>(sink, v->mantissa, v->exponent);
+    }
+
+private:
+    /// Exponent (nullable when optional: NULL means no mantissa) and mantissa
+    NFX_FORCE_INLINE static std::optional<Value> read_value(FastReader& r) noexcept {
+        const auto exponent = detail::read_integer<int32_t>(r, optional);
+        if (!exponent) return std::nullopt;
+        return Value{r.int64(), *exponent};
+    }
+
+    static std::optional<Value> missing(FastReader& r) noexcept {
+        if constexpr (!optional) r.fail(FastError::MissingValue);
+        return std::nullopt;
+    }
+};
+
+// ============================================================================
+// ASCII String Fields
+// ============================================================================
+
+/// ASCII string field; values are copied into the dictionary entry
+/// @tparam Initial Constant / default / initial value
+/// @tparam MaxLength Longest value accepted (LengthExceeded beyond)
+template <int Tag, Op O = Op::None, Presence P = Presence::Mandatory,
+          Literal Initial = "", size_t MaxLength = 32>
+struct Ascii {
+    static_assert(O != Op::Increment && O != Op::Delta,
+                  "String delta / tail operators are not supported");
+
+    static constexpr int tag = Tag;
+    static constexpr bool uses_pmap = detail::uses_pmap_bit(O, P);
+    static constexpr bool optional = P == Presence::Optional;
+    static constexpr bool has_initial = Initial.view().size() != 0;
+    static_assert(Initial.view().size() <= MaxLength, "Initial value longer than MaxLength");
+
+    struct State {
+        char value[MaxLength]{};
+        size_t size{0};
+        detail::Assigned assigned{detail::Assigned::Undefined};
+    };
+
+    [[nodiscard]] NFX_FORCE_INLINE static std::optional<std::string_view> read(
+        FastReader& r, PresenceMap& pmap, State& s) noexcept {
+        if constexpr (O == Op::None) {
+            return read_value(r, s);
+        } else if constexpr (O == Op::Constant) {
+            if constexpr (optional) {
+                if (!pmap.next()) return std::nullopt;
+            }
+            return Initial.view();
+        } else if constexpr (O == Op::Default) {
+            if (pmap.next()) return read_value(r, s);
+            if constexpr (has_initial) return Initial.view();
+            else return missing(r);
+        } else {
+            static_assert(O == Op::Copy);
+            if (pmap.next()) {
+                const auto v = read_value(r, s);
+                s.assigned = v ? detail::Assigned::Value : detail::Assigned::Empty;
+                return v;
+            }
+            if (s.assigned == detail::Assigned::Undefined) {
+                s.assigned = has_initial ? detail::Assigned::Value : detail::Assigned::Empty;
+                std::copy_n(Initial.value, Initial.view().size(), s.value);
+                s.size = Initial.view().size();
+            }
+            if (s.assigned == detail::Assigned::Value) return std::string_view{s.value, s.size};
+            return missing(r);
+        }
+    }
+
+    template <typename Sink>
+    NFX_FORCE_INLINE static void decode(FastReader& r, PresenceMap& pmap, State& s, Sink& sink) noexcept {
+        if (const auto v = read(r, pmap, s)) detail::emit_string<Tag>(sink, *v);
+    }
+
+private:
+    NFX_FORCE_INLINE static std::optional<std::string_view> read_value(FastReader& r, State& s) noexcept {
+        const auto n = r.ascii(s.value, MaxLength, optional);
+        if (!n) return std::nullopt;
+        s.size = *n;
+        return std::string_view{s.value, s.size};
+    }
+
+    static std::optional<std::string_view> missing(FastReader& r) noexcept {
+        if constexpr (!optional) r.fail(FastError::MissingValue);
+        return std::nullopt;
+    }
+};
+
+// ============================================================================
+// Sequences
+// ============================================================================
+
+/// Repeating group: a length field, then that many elements; elements
+/// carry their own presence map when any of their fields uses one
+/// @tparam Length UInt32 length field (its tag names the sequence, e.g. 268)
+template <typename Length, typename... Fields>
+struct Sequence {
+    static constexpr int tag = Length::tag;
+    static constexpr bool uses_pmap = Length::uses_pmap;
+    static constexpr bool element_pmap = (Fields::uses_pmap || ...);
+
+    struct State {
+        typename Length::State length{};
+        std::tuple<typename Fields::State...> fields{};
+    };
+
+    template <typename Sink>
+    static void decode(FastReader& r, PresenceMap& pmap, State& s, Sink& sink) noexcept {
+        const auto length = Length::read(r, pmap, s.length);
+        if (!length) return;
+        const auto n = static_cast<uint32_t>(*length);
+        if constexpr (requires { sink.template on_sequence<tag>(uint32_t{}); }) {
+            sink.template on_sequence<tag>(n);
+        }
+        for (uint32_t i = 0; i < n && r.ok(); ++i) {
+            PresenceMap element = element_pmap ? r.pmap() : PresenceMap{};
+            if constexpr (requires { sink.template on_element<tag>(uint32_t{}); }) {
+                sink.template on_element<tag>(i);
+            }
+            decode_fields(r, element, s.fields, sink, std::index_sequence_for<Fields...>{});
+        }
+    }
+
+private:
+    template <typename Sink, size_t... I>
+    NFX_FORCE_INLINE static void decode_fields(FastReader& r, PresenceMap& pmap,
+                                               std::tuple<typename Fields::State...>& states,
+                                               Sink& sink, std::index_sequence<I...>) noexcept {
+        (Fields::decode(r, pmap, std::get<I>(states), sink), ...);
+    }
+};
+
+// ============================================================================
+// Templates
+// ============================================================================
+
+/// Message template: ID and fields in wire order
+template <uint32_t Id, typename... Fields>
+struct Template {
+    static constexpr uint32_t id = Id;
+
+    using State = std::tuple<typename Fields::State...>;
+
+    template <typename Sink>
+    NFX_HOT static void decode(FastReader& r, PresenceMap& pmap, State& s, Sink& sink) noexcept {
+        decode_fields(r, pmap, s, sink, std::index_sequence_for<Fields...>{});
+    }
+
+private:
+    template <typename Sink, size_t... I>
+    NFX_FORCE_INLINE static void decode_fields(FastReader& r, PresenceMap& pmap, State& s,
+                                               Sink& sink, std::index_sequence<I...>) noexcept {
+        (Fields::decode(r, pmap, std::get<I>(s), sink), ...);
+    }
+};
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+/// Decodes messages of a fixed template set, keeping each template's
+/// dictionary across messages
+template <typename... Templates>
+class Decoder {
+    static_assert(sizeof...(Templates) > 0, "A decoder needs at least one template");
+
+public:
+    /// Decode one message at the reader's position
+    /// @return false on error (see reader.error())
+    template <typename Sink>
+    NFX_HOT bool decode_message(FastReader& r, Sink& sink) noexcept {
+        PresenceMap pmap = r.pmap();
+        if (pmap.next()) {
+            last_template_ = r.uint32();   // Template ID: copy operator
+        }
+        if (!r.ok()) return false;
+
+        const uint32_t id = last_template_;
+        if constexpr (requires { sink.on_template(uint32_t{}); }) sink.on_template(id);
+        if (!dispatch(r, pmap, id, sink, std::index_sequence_for<Templates...>{})) {
+            r.fail(FastError::UnknownTemplate);
+            return false;
+        }
+        if (!r.ok()) return false;
+        if constexpr (requires { sink.on_end(uint32_t{}); }) sink.on_end(id);
+        return true;
+    }
+
+    /// Decode every message in data (one UDP packet, one stream block)
+    /// @return Messages decoded; stops at the first error
+    template <typename Sink>
+    size_t decode(std::span<const char> data, Sink& sink, FastError* error = nullptr) noexcept {
+        FastReader r{data.data(), data.size()};
+        size_t n = 0;
+        while (!r.at_end() && decode_message(r, sink)) ++n;
+        if (error) *error = r.error();
+        return n;
+    }
+
+    /// Return every dictionary entry to its initial value
+    void reset() noexcept {
+        states_ = {};
+        last_template_ = 0;
+    }
+
+    [[nodiscard]] uint32_t last_template() const noexcept { return last_template_; }
+
+private:
+    template <typename Sink, size_t... I>
+    NFX_FORCE_INLINE bool dispatch(FastReader& r, PresenceMap& pmap, uint32_t id,
+                                   Sink& sink, std::index_sequence<I...>) noexcept {
+        return ((id == Templates::id
+                     ? (Templates::decode(r, pmap, std::get<I>(states_), sink), true)
+                     : false) || ...);
+    }
+
+    std::tuple<typename Templates::State...> states_{};
+    uint32_t last_template_{0};
+};
+
+}  // namespace nfx::fast
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+namespace nfx::fast {
+
+// ============================================================================
+// FAST Market Data Entries -> MDEntryColumns
+// ============================================================================
+//
+// Decoder sink filling the struct-of-arrays columns the FIX text path
+// (parser::decode_md_entries) and the SBE path (sbe::decode_md_group)
+// fill, so OrderBook, TopOfBookStore and MarketDataRecovery consume a
+// FAST feed unchanged. Fields are matched by tag at compile time:
+//
+//   NoMDEntries (268) sequence    one row per element
+//   279 MDUpdateAction            uInt, 0 = New ...        -> update_action
+//   269 MDEntryType               string or uInt           -> entry_type
+//   270 MDEntryPx                 decimal                  -> price
+//   271 MDEntrySize               decimal or integer       -> size
+//   83 RptSeq, 346 NumberOfOrders                          -> rpt_seq, number_of_orders
+//   1023 MDPriceLevel, 290 MDEntryPositionNo               -> position_no
+//   55 Symbol                     per entry or per message -> symbol dictionary
+//   48 SecurityID                 per entry or per message -> security_ids (optional)
+//   34 MsgSeqNum, 52 SendingTime, 35 MsgType               -> header accessors
+//
+// Symbols are copied into the sink (decoded strings live in the FAST
+// dictionary and change with the next element). Rows beyond Capacity
+// are skipped and set truncated.
+//
+// Usage:
+//   MDEntryColumns<> cols;
+//   MDEntrySink sink{cols};
+//   FastReader reader{packet.data(), packet.size()};
+//   while (!reader.at_end() && decoder.decode_message(reader, sink)) {
+//       for (size_t i = 0; i < cols.count; ++i) book.apply_entry(cols.row(i));
+//   }
+
+/// Sink writing one message's NoMDEntries into MDEntryColumns
+template <size_t Capacity = 256>
+class MDEntrySink {
+public:
+    static constexpr int NO_MD_ENTRIES = 268;
+    static constexpr size_t SYMBOL_BYTES = 1024;
+
+    /// @param security_ids Optional per-row SecurityID output (at least Capacity)
+    explicit MDEntrySink(MDEntryColumns<Capacity>& out, std::span<int64_t> security_ids = {}) noexcept
+        : out_{out}, security_ids_{security_ids} {}
+
+    // ========================================================================
+    // Decoder Callbacks
+    // ========================================================================
+
+    void on_template(uint32_t id) noexcept {
+        out_.clear();
+        template_id_ = id;
+        msg_seq_num_ = 0;
+        sending_time_ = 0;
+        msg_type_ = '\0';
+        symbol_used_ = 0;
+        message_symbol_ = MDEntryColumns<Capacity>::NO_SYMBOL;
+        message_security_id_ = 0;
+        row_ = NO_ROW;
+    }
+
+    template <int Tag>
+    NFX_FORCE_INLINE void on_sequence(uint32_t length) noexcept {
+        if constexpr (Tag == NO_MD_ENTRIES) {
+            if (length > Capacity) out_.truncated = true;
+        }
+    }
+
+    template <int Tag>
+    NFX_FORCE_INLINE void on_element(uint32_t index) noexcept {
+        if constexpr (Tag == NO_MD_ENTRIES) {
+            if (index >= Capacity) [[unlikely]] {
+                row_ = SKIPPED;
+                return;
+            }
+            row_ = index;
+            out_.update_action[index] = MDUpdateAction::New;
+            out_.entry_type[index] = MDEntryType::Bid;
+            out_.price[index] = FixedPrice{};
+            out_.size[index] = Qty{};
+            out_.symbol_id[index] = message_symbol_;
+            out_.position_no[index] = 0;
+            out_.number_of_orders[index] = 0;
+            out_.rpt_seq[index] = 0;
+            if (index < security_ids_.size()) security_ids_[index] = message_security_id_;
+            out_.count = index + 1;
+        }
+    }
+
+    template <int Tag>
+    NFX_FORCE_INLINE void on_uint(uint64_t v) noexcept {
+        if constexpr (Tag == 34) {
+            msg_seq_num_ = static_cast<uint32_t>(v);
+        } else if constexpr (Tag == 52) {
+            sending_time_ = v;
+        } else if constexpr (Tag == 48) {
+            if (row_ == NO_ROW) {
+                message_security_id_ = static_cast<int64_t>(v);
+            } else if (row_ < security_ids_.size()) {
+                security_ids_[row_] = static_cast<int64_t>(v);
+            }
+        } else {
+            on_int<Tag>(static_cast<int64_t>(v));
+        }
+    }
+
+    template <int Tag>
+    NFX_FORCE_INLINE void on_int(int64_t v) noexcept {
+        if (row_ >= Capacity) return;
+        if constexpr (Tag == 279) {
+            out_.update_action[row_] = static_cast<MDUpdateAction>('0' + v);
+        } else if constexpr (Tag == 269) {
+            out_.entry_type[row_] = static_cast<MDEntryType>(v < 10 ? '0' + v : 'A' + (v - 10));
+        } else if constexpr (Tag == 271) {
+            out_.size[row_] = Qty{v * Qty::SCALE};
+        } else if constexpr (Tag == 83) {
+            out_.rpt_seq[row_] = static_cast<uint32_t>(v);
+        } else if constexpr (Tag == 346) {
+            out_.number_of_orders[row_] = static_cast<uint32_t>(v);
+        } else if constexpr (Tag == 1023 || Tag == 290) {
+            out_.position_no[row_] = static_cast<uint16_t>(v);
+        }
+    }
+
+    template <int Tag>
+    NFX_FORCE_INLINE void on_decimal(int64_t mantissa, int32_t exponent) noexcept {
+        if (row_ >= Capacity) return;
+        if constexpr (Tag == 270) {
+            out_.price[row_] = FixedPrice{scale(mantissa, exponent + FixedPrice::DECIMAL_PLACES)};
+        } else if constexpr (Tag == 271) {
+            out_.size[row_] = Qty{scale(mantissa, exponent + Qty::DECIMAL_PLACES)};
+        }
+    }
+
+    template <int Tag>
+    void on_string(std::string_view v) noexcept {
+        if constexpr (Tag == 35) {
+            msg_type_ = v.empty() ? '\0' : v[0];
+        } else if constexpr (Tag == 55) {
+            const uint16_t id = intern(v);
+            if (row_ == NO_ROW) {
+                message_symbol_ = id;
+            } else if (row_ < Capacity) {
+                out_.symbol_id[row_] = id;
+            }
+        } else if constexpr (Tag == 269) {
+            if (row_ < Capacity && !v.empty()) out_.entry_type[row_] = static_cast<MDEntryType>(v[0]);
+        }
+    }
+
+    // ========================================================================
+    // Message Header
+    // ========================================================================
+
+    [[nodiscard]] uint32_t template_id() const noexcept { return template_id_; }
+    [[nodiscard]] uint32_t msg_seq_num() const noexcept { return msg_seq_num_; }
+    [[nodiscard]] uint64_t sending_time() const noexcept { return sending_time_; }
+    [[nodiscard]] char msg_type() const noexcept { return msg_type_; }
+
+    /// Message-level SecurityID (0 if none)
+    [[nodiscard]] int64_t security_id() const noexcept { return message_security_id_; }
+
+    [[nodiscard]] MDEntryColumns<Capacity>& columns() noexcept { return out_; }
+
+private:
+    static constexpr size_t NO_ROW = SIZE_MAX;       // Before the entries
+    static constexpr size_t SKIPPED = SIZE_MAX - 1;  // Element past Capacity
+
+    /// mantissa * 10^exponent as an integer (0 if out of range)
+    [[nodiscard]] static int64_t scale(int64_t mantissa, int32_t exponent) noexcept {
+        static constexpr std::array<int64_t, 19> POW10 = [] {
+            std::array<int64_t, 19> p{1};
+            for (size_t i = 1; i < p.size(); ++i) p[i] = p[i - 1] * 10;
+            return p;
+        }();
+        if (exponent >= 0) {
+            return exponent < 19 ? mantissa * POW10[static_cast<size_t>(exponent)] : 0;
+        }
+        return -exponent < 19 ? mantissa / POW10[static_cast<size_t>(-exponent)] : 0;
+    }
+
+    /// Dictionary id of sym, copying new symbols into the sink
+    [[nodiscard]] uint16_t intern(std::string_view sym) noexcept {
+        for (size_t i = 0; i < out_.symbol_count; ++i) {
+            if (out_.symbols[i] == sym) return static_cast<uint16_t>(i);
+        }
+        if (sym.size() > SYMBOL_BYTES - symbol_used_) [[unlikely]] {
+            return MDEntryColumns<Capacity>::NO_SYMBOL;
+        }
+        char* copy = symbol_bytes_.data() + symbol_used_;
+        std::memcpy(copy, sym.data(), sym.size());
+        symbol_used_ += sym.size();
+        return out_.intern_symbol({copy, sym.size()});
+    }
+
+    MDEntryColumns<Capacity>& out_;
+    std::span<int64_t> security_ids_;
+
+    size_t row_{NO_ROW};
+    uint32_t template_id_{0};
+    uint32_t msg_seq_num_{0};
+    uint64_t sending_time_{0};
+    int64_t message_security_id_{0};
+    uint16_t message_symbol_{MDEntryColumns<Capacity>::NO_SYMBOL};
+    char msg_type_{'\0'};
+
+    std::array<char, SYMBOL_BYTES> symbol_bytes_{};
+    size_t symbol_used_{0};
+};
+
+}  // namespace nfx::fast
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(__SSE2__) || (NFX_COMPILER_MSVC && NFX_ARCH_X64)
+    #include <emmintrin.h>
+    #define NFX_FAST_SSE2 1
+#endif
+#if defined(__BMI2__)
+    #include <immintrin.h>
+    #define NFX_FAST_BMI2 1
+#endif
+
+namespace nfx::fast {
+
+// ============================================================================
+// FAST Stop-Bit Encoding
+// ============================================================================
+//
+// FAST (FIX Adapted for STreaming, 1.1) writes every integer, string and
+// presence map as a run of bytes carrying 7 data bits each, most
+// significant group first; the high bit marks the last byte:
+//
+//   942755 = 0x0E6CA3 -> 0x39 0x45 0xA3
+//            |0111001|1000101|0100011|   groups
+//                               ^ stop bit on the last byte
+//
+// The stop byte is found 16 bytes at a time (SSE2 movemask of the high
+// bits), and up to 8 bytes are assembled without a per-byte loop: PEXT
+// with BMI2, otherwise three SWAR steps merging 7-bit groups into 14, 28
+// and 56 bits. Longer fields (9-10 bytes, 64-bit values) take the loop.
+//
+// Nullable integers are stored +1 (0 encodes NULL); signed integers are
+// two's complement with the sign in bit 6 of the first byte.
+
+/// Decode failure (sticky in FastReader)
+enum class FastError : uint8_t {
+    None = 0,
+    Truncated,          // Field runs past the end of the buffer
+    Overflow,           // Integer wider than its type
+    UnknownTemplate,    // Template ID not in the decoder's set
+    MissingValue,       // Mandatory field absent with no previous value
+    LengthExceeded      // String or sequence longer than its storage
+};
+
+namespace detail {
+
+/// Bytes up to and including the stop byte, 0 if none within avail
+[[nodiscard]] NFX_FORCE_INLINE size_t stop_bit_length(const uint8_t* p, size_t avail) noexcept {
+#if defined(NFX_FAST_SSE2)
+    if (avail >= 16) [[likely]] {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+        if (mask != 0) [[likely]] return static_cast<size_t>(std::countr_zero(mask)) + 1;
+    }
+#endif
+    for (size_t i = 0; i < avail; ++i) {
+        if (p[i] & 0x80) return i + 1;
+    }
+    return 0;
+}
+
+/// 7-bit groups of len (1-8) bytes as one integer; the 8 bytes at p must be readable
+[[nodiscard]] NFX_FORCE_INLINE uint64_t assemble_8(const uint8_t* p, size_t len) noexcept {
+    uint64_t word;
+    std::memcpy(&word, p, 8);
+    if constexpr (std::endian::native == std::endian::little) {
+        word = std::byteswap(word);
+    }
+    // First byte is now the most significant; drop the bytes past len
+    word = (word >> (64 - 8 * len)) & 0x7F7F7F7F7F7F7F7FULL;
+#if defined(NFX_FAST_BMI2)
+    return _pext_u64(word, 0x7F7F7F7F7F7F7F7FULL);
+#else
+    word = ((word & 0x7F007F007F007F00ULL) >> 1) | (word & 0x007F007F007F007FULL);
+    word = ((word & 0x3FFF00003FFF0000ULL) >> 2) | (word & 0x00003FFF00003FFFULL);
+    return ((word & 0x0FFFFFFF00000000ULL) >> 4) | (word & 0x000000000FFFFFFFULL);
+#endif
+}
+
+/// Byte-at-a-time assembly (short buffers, 9-10 byte fields)
+[[nodiscard]] inline uint64_t assemble_loop(const uint8_t* p, size_t len) noexcept {
+    uint64_t value = 0;
+    for (size_t i = 0; i < len; ++i) {
+        value = (value << 7) | (p[i] & 0x7F);
+    }
+    return value;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Presence Map
+// ============================================================================
+
+/// Bits of one presence map, first bit first; bits past the end read 0
+class PresenceMap {
+public:
+    static constexpr size_t MAX_BITS = 63;   // 9 bytes of 7 bits
+
+    constexpr PresenceMap() noexcept = default;
+    constexpr explicit PresenceMap(uint64_t bits) noexcept : bits_{bits} {}
+
+    /// Next bit (field present / value follows)
+    [[nodiscard]] NFX_FORCE_INLINE bool next() noexcept {
+        const bool bit = (bits_ >> 63) != 0;
+        bits_ <<= 1;
+        return bit;
+    }
+
+    /// Unread bits, left-aligned
+    [[nodiscard]] constexpr uint64_t bits() const noexcept { return bits_; }
+
+private:
+    uint64_t bits_{0};
+};
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+/// Cursor over one FAST-encoded buffer; the first error stops all reads
+/// (they return 0 / empty) and is kept for error()
+class FastReader {
+public:
+    constexpr FastReader() noexcept = default;
+    FastReader(const char* data, size_t size) noexcept
+        : p_{reinterpret_cast<const uint8_t*>(data)}
+        , end_{reinterpret_cast<const uint8_t*>(data) + size} {}
+
+    // ------------------------------------------------------------------------
+    // Integers
+    // ------------------------------------------------------------------------
+
+    /// Mandatory unsigned integer
+    [[nodiscard]] NFX_FORCE_INLINE uint64_t uint64() noexcept {
+        size_t len;
+        const uint64_t raw = read_raw(len);
+        if (len > 9 && (len > 10 || (p_[-10] & 0x7E) != 0)) [[unlikely]] fail(FastError::Overflow);
+        return raw;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE uint32_t uint32() noexcept {
+        const uint64_t v = uint64();
+        if (v > UINT32_MAX) [[unlikely]] fail(FastError::Overflow);
+        return static_cast<uint32_t>(v);
+    }
+
+    /// Mandatory signed integer
+    [[nodiscard]] NFX_FORCE_INLINE int64_t int64() noexcept {
+        size_t len;
+        const uint64_t raw = read_raw(len);
+        if (len == 0) return 0;
+        if (len >= 10) {
+            if (len > 10) [[unlikely]] fail(FastError::Overflow);
+            return static_cast<int64_t>(raw);
+        }
+        const unsigned shift = 64 - 7 * static_cast<unsigned>(len);
+        return static_cast<int64_t>(raw << shift) >> shift;  // Sign is bit 6 of the first byte
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE int32_t int32() noexcept {
+        const int64_t v = int64();
+        if (v < INT32_MIN || v > INT32_MAX) [[unlikely]] fail(FastError::Overflow);
+        return static_cast<int32_t>(v);
+    }
+
+    /// Nullable unsigned integer (0 on the wire = NULL)
+    [[nodiscard]] NFX_FORCE_INLINE std::optional<uint64_t> nullable_uint64() noexcept {
+        const uint64_t v = uint64();
+        if (v == 0) return std::nullopt;
+        return v - 1;
+    }
+
+    /// Nullable signed integer (0 = NULL, positive values stored +1)
+    [[nodiscard]] NFX_FORCE_INLINE std::optional<int64_t> nullable_int64() noexcept {
+        const int64_t v = int64();
+        if (v == 0) return std::nullopt;
+        return v > 0 ? v - 1 : v;
+    }
+
+    // ------------------------------------------------------------------------
+    // Strings and Presence Maps
+    // ------------------------------------------------------------------------
+
+    /// ASCII string copied into out (stop bit cleared)
+    /// Mandatory: 0x80 is "". Nullable: 0x80 is NULL, 0x00 0x80 is "".
+    /// @return Length, nullopt for NULL (or on error)
+    [[nodiscard]] std::optional<size_t> ascii(char* out, size_t capacity, bool nullable) noexcept {
+        const size_t len = field_length();
+        if (len == 0) return std::nullopt;
+        const uint8_t* s = p_;
+        p_ += len;
+        if (len == 1 && s[0] == 0x80) {
+            if (nullable) return std::nullopt;
+            return size_t{0};
+        }
+        if (len == 2 && s[0] == 0x00 && s[1] == 0x80) return size_t{0};   // Empty string
+        if (len > capacity) [[unlikely]] {
+            fail(FastError::LengthExceeded);
+            return std::nullopt;
+        }
+        std::memcpy(out, s, len);
+        out[len - 1] = static_cast<char>(s[len - 1] & 0x7F);
+        return len;
+    }
+
+    /// Presence map of the next message, sequence element or group
+    [[nodiscard]] NFX_FORCE_INLINE PresenceMap pmap() noexcept {
+        const size_t len = field_length();
+        if (len == 0) return PresenceMap{};
+        const uint8_t* s = p_;
+        p_ += len;
+        const size_t used = len < 9 ? len : 9;  // Bits past 63 would only be 0
+        const uint64_t bits = used <= 8 && end_ - s >= 8 ? detail::assemble_8(s, used)
+                                                         : detail::assemble_loop(s, used);
+        return PresenceMap{bits << (64 - 7 * used)};
+    }
+
+    // ------------------------------------------------------------------------
+    // State
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] bool ok() const noexcept { return error_ == FastError::None; }
+    [[nodiscard]] FastError error() const noexcept { return error_; }
+
+    [[nodiscard]] size_t remaining() const noexcept { return static_cast<size_t>(end_ - p_); }
+    [[nodiscard]] bool at_end() const noexcept { return p_ == end_; }
+    [[nodiscard]] const char* position() const noexcept { return reinterpret_cast<const char*>(p_); }
+
+    void fail(FastError error) noexcept {
+        if (error_ == FastError::None) error_ = error;
+        p_ = end_;
+    }
+
+private:
+    /// Length of the next field; Truncated (and 0) if it has no stop byte
+    [[nodiscard]] NFX_FORCE_INLINE size_t field_length() noexcept {
+        const size_t len = detail::stop_bit_length(p_, remaining());
+        if (len == 0) [[unlikely]] {
+            if (ok()) fail(FastError::Truncated);
+        }
+        return len;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE uint64_t read_raw(size_t& len) noexcept {
+        len = field_length();
+        const uint8_t* s = p_;
+        p_ += len;
+        if (len <= 8 && end_ - s >= 8) [[likely]] {
+            return len == 0 ? 0 : detail::assemble_8(s, len);
+        }
+        return detail::assemble_loop(s, len);
+    }
+
+    const uint8_t* p_{nullptr};
+    const uint8_t* end_{nullptr};
+    FastError error_{FastError::None};
+};
+
+}  // namespace nfx::fast
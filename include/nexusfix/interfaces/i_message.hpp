@@ -35,6 +35,7 @@ inline constexpr char OrderCancelReplaceRequest = 'G';
 inline constexpr char OrderStatusRequest = 'H';
 inline constexpr char ExecutionReport  = '8';
 inline constexpr char OrderCancelReject = '9';
+inline constexpr char OrderMassCancelRequest = 'q';
 // Market Data Messages
 inline constexpr char MarketDataRequest = 'V';
 inline constexpr char MarketDataSnapshotFullRefresh = 'W';
@@ -136,6 +137,12 @@ template<> struct MsgTypeInfo<'H'> {  // OrderStatusRequest
     static constexpr bool is_valid = true;
 };
 
+template<> struct MsgTypeInfo<'q'> {  // OrderMassCancelRequest
+    static constexpr std::string_view name = "OrderMassCancelRequest";
+    static constexpr bool is_admin = false;
+    static constexpr bool is_valid = true;
+};
+
 template<> struct MsgTypeInfo<'V'> {  // MarketDataRequest
     static constexpr std::string_view name = "MarketDataRequest";
     static constexpr bool is_admin = false;
@@ -197,6 +204,7 @@ consteval std::array<MsgTypeEntry, 128> create_lookup_table() {
     table['W'] = {MsgTypeInfo<'W'>::name, MsgTypeInfo<'W'>::is_admin, true};
     table['X'] = {MsgTypeInfo<'X'>::name, MsgTypeInfo<'X'>::is_admin, true};
     table['Y'] = {MsgTypeInfo<'Y'>::name, MsgTypeInfo<'Y'>::is_admin, true};
+    table['q'] = {MsgTypeInfo<'q'>::name, MsgTypeInfo<'q'>::is_admin, true};
 
     return table;
 }
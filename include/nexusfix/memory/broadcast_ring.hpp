@@ -0,0 +1,330 @@
+/*
+    NexusFIX Broadcast Ring (SPMC)
+
+    Single-producer, multi-consumer ring where every consumer sees every
+    message: one market data session fanning parsed updates out to 4-8
+    strategy threads. Payloads are written once; each consumer only owns
+    a cursor.
+
+        head_ (producer)          consumer cursors (one cache line each)
+            |                       c0 ----+     c1 -+
+            v                              v         v
+        [ .. | 17 | 16 | 15 | 14 | 13 | 12 | 11 | 10 | .. ]
+
+    Two policies for a consumer that falls Capacity messages behind:
+    - Backpressure: the producer waits (publish) or fails (try_publish)
+      until the slowest consumer frees the slot. Consumers read slots in
+      place (try_consume), no copy.
+    - Overwrite: the producer never waits. Each slot carries a sequence
+      like a Seqlock; a lapped consumer detects it, skips to the oldest
+      message still in the ring and counts what it lost. Reads copy the
+      payload out and validate it (T must be trivially copyable).
+
+    The producer caches the slowest cursor and only rescans consumers
+    when the cached value says the ring is full.
+
+    Consumers are registered at subscription time with subscribe(), which
+    starts them at the current head; subscribe() and unsubscribe() may be
+    called while the producer runs.
+
+    Usage:
+        BroadcastRing<BookUpdate, 4096> ring;
+        auto reader = ring.subscribe();            // On each strategy thread
+
+        ring.publish(update);                      // Market data thread
+
+        ring.try_consume(reader, [](const BookUpdate& u) { ... });
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+
+namespace nfx::memory {
+
+using nfx::CACHE_LINE_SIZE;
+
+// Disable MSVC warning C4324: structure was padded due to alignment specifier
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+/// What the producer does when the slowest consumer is a full ring behind
+enum class BroadcastMode : uint8_t {
+    Backpressure,  // Producer waits for the slowest consumer
+    Overwrite      // Producer overwrites; lapped consumers skip ahead
+};
+
+/// Consumer handle returned by BroadcastRing::subscribe()
+/// Owned by one consumer thread; not shared.
+struct BroadcastReader {
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    uint32_t id{INVALID};
+    size_t position{0};      // Next sequence to read
+    size_t cached_head{0};   // Producer head last observed
+    size_t lost{0};          // Messages skipped after being lapped (Overwrite)
+
+    [[nodiscard]] bool valid() const noexcept { return id != INVALID; }
+    explicit operator bool() const noexcept { return valid(); }
+};
+
+/// Single-producer broadcast ring
+/// @tparam T Payload type
+/// @tparam Capacity Ring size (power of 2)
+/// @tparam MaxConsumers Consumer slots
+/// @tparam Mode Backpressure or Overwrite
+/// @tparam Wait Wait strategy for the blocking publish() / read()
+template <typename T, size_t Capacity, size_t MaxConsumers = 8,
+          BroadcastMode Mode = BroadcastMode::Backpressure,
+          WaitStrategy Wait = BusySpinWait>
+class alignas(CACHE_LINE_SIZE) BroadcastRing {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be power of 2");
+    static_assert(MaxConsumers > 0, "At least one consumer slot");
+    static_assert(Mode == BroadcastMode::Backpressure || std::is_trivially_copyable_v<T>,
+                  "Overwrite mode copies payloads racily; T must be trivially copyable");
+
+    static constexpr size_t MASK = Capacity - 1;
+    static constexpr bool OVERWRITE = Mode == BroadcastMode::Overwrite;
+
+public:
+    BroadcastRing() noexcept = default;
+
+    // Non-copyable, non-movable
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+    BroadcastRing(BroadcastRing&&) = delete;
+    BroadcastRing& operator=(BroadcastRing&&) = delete;
+
+    // ========================================================================
+    // Subscription
+    // ========================================================================
+
+    /// Register a consumer starting at the current head
+    /// @return Reader handle (invalid if every consumer slot is taken)
+    [[nodiscard]] BroadcastReader subscribe() noexcept {
+        for (uint32_t i = 0; i < MaxConsumers; ++i) {
+            bool expected = false;
+            if (consumers_[i].active.compare_exchange_strong(expected, true,
+                    std::memory_order_acq_rel)) {
+                const size_t head = head_.load(std::memory_order_acquire);
+                consumers_[i].cursor.store(head, std::memory_order_release);
+                return BroadcastReader{i, head, head, 0};
+            }
+        }
+        return {};
+    }
+
+    /// Release a consumer slot; the producer stops waiting for it
+    void unsubscribe(BroadcastReader& reader) noexcept {
+        if (!reader.valid()) return;
+        consumers_[reader.id].active.store(false, std::memory_order_release);
+        reader = {};
+    }
+
+    // ========================================================================
+    // Producer API (single thread)
+    // ========================================================================
+
+    /// Claim the next slot to fill in place
+    /// @return Empty claim if the slowest consumer is a ring behind (Backpressure)
+    [[nodiscard]] SlotClaim<T> try_claim() noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if constexpr (!OVERWRITE) {
+            if (head - cached_min_ >= Capacity) {
+                cached_min_ = slowest_cursor(head);
+                if (head - cached_min_ >= Capacity) {
+                    return {};
+                }
+            }
+        } else {
+            // Odd: readers of this slot retry or detect the lap
+            slot_seq_[head & MASK].store(2 * head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+        return {&slots_[head & MASK], head};
+    }
+
+    /// Publish a slot filled through try_claim()
+    void commit(SlotClaim<T> claim) noexcept {
+        if constexpr (OVERWRITE) {
+            slot_seq_[claim.position & MASK].store(2 * claim.position + 2,
+                                                   std::memory_order_release);
+        }
+        head_.store(claim.position + 1, std::memory_order_release);
+    }
+
+    /// Publish a copy of value
+    /// @return false if the ring is full (Backpressure only)
+    [[nodiscard]] bool try_publish(const T& value) noexcept {
+        auto claim = try_claim();
+        if (!claim) return false;
+        *claim = value;
+        commit(claim);
+        return true;
+    }
+
+    /// Publish, waiting with the wait strategy while the ring is full
+    void publish(const T& value) noexcept {
+        while (!try_publish(value)) {
+            Wait::wait();
+        }
+    }
+
+    // ========================================================================
+    // Consumer API (one thread per reader)
+    // ========================================================================
+
+    /// Call fn(const T&) on the next message
+    /// Backpressure: fn sees the slot in place. Overwrite: fn sees a
+    /// validated copy.
+    /// @return false if the reader is caught up
+    template <typename Fn>
+    [[nodiscard]] bool try_consume(BroadcastReader& reader, Fn&& fn) noexcept {
+        if constexpr (OVERWRITE) {
+            T value;
+            if (!try_read(reader, value)) return false;
+            std::forward<Fn>(fn)(std::as_const(value));
+            return true;
+        } else {
+            if (!available(reader)) return false;
+            std::forward<Fn>(fn)(std::as_const(slots_[reader.position & MASK]));
+            advance(reader);
+            return true;
+        }
+    }
+
+    /// Copy the next message into out
+    /// @return false if the reader is caught up
+    [[nodiscard]] bool try_read(BroadcastReader& reader, T& out) noexcept {
+        if constexpr (OVERWRITE) {
+            for (;;) {
+                if (!available(reader)) return false;
+
+                // Lapped: jump to the oldest message still in the ring
+                if (reader.cached_head - reader.position > Capacity) {
+                    const size_t oldest = reader.cached_head - Capacity;
+                    reader.lost += oldest - reader.position;
+                    reader.position = oldest;
+                }
+
+                const auto& seq = slot_seq_[reader.position & MASK];
+                const size_t expected = 2 * reader.position + 2;
+                if (seq.load(std::memory_order_acquire) == expected) {
+                    out = slots_[reader.position & MASK];
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (seq.load(std::memory_order_relaxed) == expected) {
+                        advance(reader);
+                        return true;
+                    }
+                }
+                // Overwritten while reading: the producer has claimed at
+                // least position + Capacity, and the slot of the message
+                // at head may be mid-write, so resume just after it
+                reader.cached_head = head_.load(std::memory_order_acquire);
+                const size_t resume = std::max(reader.cached_head + 1 - Capacity,
+                                               reader.position + 1);
+                reader.lost += resume - reader.position;
+                reader.position = resume;
+            }
+        } else {
+            if (!available(reader)) return false;
+            out = slots_[reader.position & MASK];
+            advance(reader);
+            return true;
+        }
+    }
+
+    /// Read the next message, waiting with the wait strategy
+    [[nodiscard]] T read(BroadcastReader& reader) noexcept {
+        T value;
+        while (!try_read(reader, value)) {
+            Wait::wait();
+        }
+        return value;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Messages published so far
+    [[nodiscard]] size_t published() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /// Messages the slowest active consumer has yet to read
+    [[nodiscard]] size_t max_lag() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return head - slowest_cursor(head);
+    }
+
+    /// Messages reader has yet to read
+    [[nodiscard]] size_t lag(const BroadcastReader& reader) const noexcept {
+        return head_.load(std::memory_order_acquire) - reader.position;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+    [[nodiscard]] static constexpr size_t max_consumers() noexcept { return MaxConsumers; }
+    [[nodiscard]] static constexpr BroadcastMode mode() noexcept { return Mode; }
+
+private:
+    /// True if a message is ready at reader.position (refreshes cached head)
+    [[nodiscard]] bool available(BroadcastReader& reader) const noexcept {
+        if (reader.position == reader.cached_head) {
+            reader.cached_head = head_.load(std::memory_order_acquire);
+        }
+        return reader.position != reader.cached_head;
+    }
+
+    /// Step past the current message and publish the cursor to the producer
+    void advance(BroadcastReader& reader) noexcept {
+        ++reader.position;
+        consumers_[reader.id].cursor.store(reader.position, std::memory_order_release);
+    }
+
+    /// Lowest cursor among active consumers (head if there are none)
+    [[nodiscard]] size_t slowest_cursor(size_t head) const noexcept {
+        size_t slowest = head;
+        for (const auto& c : consumers_) {
+            if (!c.active.load(std::memory_order_acquire)) continue;
+            const size_t cursor = c.cursor.load(std::memory_order_acquire);
+            if (head - cursor > head - slowest) {
+                slowest = cursor;
+            }
+        }
+        return slowest;
+    }
+
+    struct alignas(CACHE_LINE_SIZE) ConsumerSlot {
+        std::atomic<size_t> cursor{0};
+        std::atomic<bool> active{false};
+    };
+
+    // Producer line: head_ is read by consumers, cached_min_ is producer-only
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    size_t cached_min_{0};
+
+    std::array<ConsumerSlot, MaxConsumers> consumers_{};
+
+    // Per-slot sequences exist only in Overwrite mode
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<size_t>, OVERWRITE ? Capacity : 0> slot_seq_{};
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> slots_{};
+};
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+} // namespace nfx::memory
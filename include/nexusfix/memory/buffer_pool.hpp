@@ -131,6 +131,12 @@ public:
         : upstream_{std::pmr::null_memory_resource()}
         , resource_{buffer_.data(), buffer_.size(), upstream_} {}
 
+    /// @param upstream Source of overflow chunks once the buffer is full
+    ///        (released on reset()); the default throws bad_alloc instead
+    explicit MonotonicPool(std::pmr::memory_resource* upstream) noexcept
+        : upstream_{upstream}
+        , resource_{buffer_.data(), buffer_.size(), upstream_} {}
+
     /// Reset the pool (invalidates all allocations)
     void reset() noexcept {
         resource_.release();
@@ -0,0 +1,286 @@
+/*
+    NexusFIX Concurrent Fixed Pool
+
+    Fixed-size block pool that can be allocated from on one thread and
+    freed on another (e.g. network thread allocates a receive buffer,
+    strategy thread frees it after processing).
+
+    Design (Bonwick/Adams magazine allocator):
+    - Blocks move between threads in chains ("magazines") of up to
+      MagazineSize blocks, never one at a time
+    - Each thread owns a LocalCache holding two magazines; allocate and
+      deallocate touch only thread-local state until a magazine runs
+      empty or full
+    - A lock-free depot (Treiber stack of whole magazines) exchanges
+      magazines between threads: one CAS per MagazineSize blocks
+    - Depot head packs a 32-bit block index with a 32-bit tag that is
+      bumped on every push/pop, so a stale CAS cannot succeed (ABA)
+
+    Remote frees cost nothing extra: a block freed on the strategy thread
+    lands in that thread's magazine and travels back to the network
+    thread's cache through the depot once the magazine fills up.
+
+    Usage:
+        ConcurrentFixedPool<4096, 1024> pool;
+
+        // Per thread (e.g. thread_local or a member of the thread's loop)
+        ConcurrentFixedPool<4096, 1024>::LocalCache cache{pool};
+        void* p = cache.allocate();
+        ...
+        other_cache.deallocate(p);   // any thread's cache
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "nexusfix/memory/buffer_pool.hpp"
+
+namespace nfx::memory {
+
+using nfx::CACHE_LINE_SIZE;
+
+// Disable MSVC warning C4324: structure was padded due to alignment specifier
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+/// Fixed-size block pool safe for cross-thread allocate/free
+/// @tparam BlockSize Block size in bytes (power of 2)
+/// @tparam NumBlocks Number of blocks
+/// @tparam MagazineSize Blocks moved between a thread cache and the depot at once
+template <size_t BlockSize, size_t NumBlocks, size_t MagazineSize = 32>
+class alignas(CACHE_LINE_SIZE) ConcurrentFixedPool {
+    static_assert(std::has_single_bit(BlockSize), "Block size should be power of 2");
+    static_assert(NumBlocks > 0 && NumBlocks < UINT32_MAX, "NumBlocks must fit a 32-bit index");
+    static_assert(MagazineSize > 0 && MagazineSize <= NumBlocks, "MagazineSize must be 1..NumBlocks");
+
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+public:
+    /// Chain of free blocks linked through next_
+    struct Magazine {
+        uint32_t head{NIL};
+        uint32_t count{0};
+
+        [[nodiscard]] bool empty() const noexcept { return count == 0; }
+        [[nodiscard]] bool full() const noexcept { return count >= MagazineSize; }
+    };
+
+    ConcurrentFixedPool() noexcept {
+        // Carve all blocks into full magazines on the depot
+        for (uint32_t first = 0; first < NumBlocks; first += MagazineSize) {
+            const uint32_t last = static_cast<uint32_t>(
+                std::min<size_t>(first + MagazineSize, NumBlocks)) - 1;
+            for (uint32_t i = first; i < last; ++i) {
+                next_[i] = i + 1;
+            }
+            next_[last] = NIL;
+            push_magazine({first, last - first + 1});
+        }
+    }
+
+    // Non-copyable, non-movable (owns fixed storage)
+    ConcurrentFixedPool(const ConcurrentFixedPool&) = delete;
+    ConcurrentFixedPool& operator=(const ConcurrentFixedPool&) = delete;
+    ConcurrentFixedPool(ConcurrentFixedPool&&) = delete;
+    ConcurrentFixedPool& operator=(ConcurrentFixedPool&&) = delete;
+
+    // ========================================================================
+    // Thread Cache
+    // ========================================================================
+
+    /// Per-thread front end: owns a loaded and a previous magazine
+    /// Not thread-safe itself; give each thread its own. Destroying the
+    /// cache returns its blocks to the depot.
+    class LocalCache {
+    public:
+        explicit LocalCache(ConcurrentFixedPool& pool) noexcept : pool_{pool} {}
+
+        ~LocalCache() { flush(); }
+
+        LocalCache(const LocalCache&) = delete;
+        LocalCache& operator=(const LocalCache&) = delete;
+
+        /// Allocate a block (nullptr if the pool is exhausted)
+        [[nodiscard]] void* allocate() noexcept {
+            if (loaded_.empty()) {
+                if (!previous_.empty()) {
+                    std::swap(loaded_, previous_);
+                } else {
+                    loaded_ = pool_.pop_magazine();
+                    if (loaded_.empty()) {
+                        return nullptr;
+                    }
+                }
+            }
+            const uint32_t idx = loaded_.head;
+            loaded_.head = pool_.next_[idx];
+            --loaded_.count;
+            return pool_.block(idx);
+        }
+
+        /// Return a block allocated by any thread's cache (or the pool)
+        void deallocate(void* ptr) noexcept {
+            if (ptr == nullptr) return;
+
+            if (loaded_.full()) {
+                if (!previous_.empty()) {
+                    pool_.push_magazine(previous_);
+                }
+                previous_ = loaded_;
+                loaded_ = {};
+            }
+            const uint32_t idx = pool_.index_of(ptr);
+            pool_.next_[idx] = loaded_.head;
+            loaded_.head = idx;
+            ++loaded_.count;
+        }
+
+        /// Return every cached block to the depot
+        void flush() noexcept {
+            if (!loaded_.empty()) pool_.push_magazine(loaded_);
+            if (!previous_.empty()) pool_.push_magazine(previous_);
+            loaded_ = {};
+            previous_ = {};
+        }
+
+        /// Blocks held by this cache
+        [[nodiscard]] size_t cached() const noexcept {
+            return loaded_.count + previous_.count;
+        }
+
+    private:
+        ConcurrentFixedPool& pool_;
+        Magazine loaded_{};
+        Magazine previous_{};
+    };
+
+    // ========================================================================
+    // Uncached Access (any thread)
+    // ========================================================================
+
+    /// Allocate without a LocalCache (two depot operations; prefer a cache)
+    [[nodiscard]] void* allocate() noexcept {
+        Magazine mag = pop_magazine();
+        if (mag.empty()) {
+            return nullptr;
+        }
+        const uint32_t idx = mag.head;
+        mag.head = next_[idx];
+        --mag.count;
+        if (!mag.empty()) {
+            push_magazine(mag);
+        }
+        return block(idx);
+    }
+
+    /// Deallocate without a LocalCache (pushes a one-block magazine)
+    void deallocate(void* ptr) noexcept {
+        if (ptr == nullptr) return;
+        const uint32_t idx = index_of(ptr);
+        next_[idx] = NIL;
+        push_magazine({idx, 1});
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Check if pointer belongs to this pool
+    [[nodiscard]] bool owns(const void* ptr) const noexcept {
+        const char* p = static_cast<const char*>(ptr);
+        return p >= storage_.data() && p < storage_.data() + storage_.size();
+    }
+
+    /// Blocks currently in the depot (excludes thread caches)
+    [[nodiscard]] size_t depot_blocks() const noexcept {
+        return depot_blocks_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static constexpr size_t block_size() noexcept { return BlockSize; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return NumBlocks; }
+    [[nodiscard]] static constexpr size_t magazine_size() noexcept { return MagazineSize; }
+
+private:
+    // ========================================================================
+    // Depot (Treiber stack of magazines with ABA tag)
+    // ========================================================================
+
+    [[nodiscard]] static constexpr uint64_t pack(uint32_t index, uint32_t tag) noexcept {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+    [[nodiscard]] static constexpr uint32_t index_part(uint64_t v) noexcept {
+        return static_cast<uint32_t>(v);
+    }
+    [[nodiscard]] static constexpr uint32_t tag_part(uint64_t v) noexcept {
+        return static_cast<uint32_t>(v >> 32);
+    }
+
+    void push_magazine(Magazine mag) noexcept {
+        magazine_count_[mag.head] = mag.count;
+        // Counted before the push so a racing pop never drives it negative
+        depot_blocks_.fetch_add(mag.count, std::memory_order_relaxed);
+
+        uint64_t top = depot_.load(std::memory_order_relaxed);
+        for (;;) {
+            depot_next_[mag.head].store(index_part(top), std::memory_order_relaxed);
+            if (depot_.compare_exchange_weak(top, pack(mag.head, tag_part(top) + 1),
+                    std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] Magazine pop_magazine() noexcept {
+        uint64_t top = depot_.load(std::memory_order_acquire);
+        for (;;) {
+            const uint32_t head = index_part(top);
+            if (head == NIL) {
+                return {};
+            }
+            // May read a link the magazine's new owner is rewriting; the
+            // tag makes the CAS fail in that case
+            const uint32_t below = depot_next_[head].load(std::memory_order_relaxed);
+            if (depot_.compare_exchange_weak(top, pack(below, tag_part(top) + 1),
+                    std::memory_order_acquire, std::memory_order_acquire)) {
+                const uint32_t count = magazine_count_[head];
+                depot_blocks_.fetch_sub(count, std::memory_order_relaxed);
+                return {head, count};
+            }
+        }
+    }
+
+    [[nodiscard]] void* block(uint32_t idx) noexcept {
+        return &storage_[static_cast<size_t>(idx) * BlockSize];
+    }
+
+    [[nodiscard]] uint32_t index_of(const void* ptr) const noexcept {
+        const auto offset = static_cast<size_t>(static_cast<const char*>(ptr) - storage_.data());
+        return static_cast<uint32_t>(offset >> std::countr_zero(BlockSize));
+    }
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> depot_{pack(NIL, 0)};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> depot_blocks_{0};
+
+    // Links: next_ chains blocks within a magazine (owner only);
+    // depot_next_ links magazine heads on the depot stack
+    std::array<uint32_t, NumBlocks> next_{};
+    std::array<uint32_t, NumBlocks> magazine_count_{};
+    std::array<std::atomic<uint32_t>, NumBlocks> depot_next_{};
+
+    alignas(CACHE_LINE_SIZE) std::array<char, BlockSize * NumBlocks> storage_{};
+};
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+} // namespace nfx::memory
@@ -0,0 +1,219 @@
+/*
+    NexusFIX Conflating Queue
+
+    Latest-value-per-key hand-off for consumers that may fall behind the
+    feed: a strategy thread that only cares about the current book for a
+    symbol should not work through every 35=X queued during a burst.
+
+        producer (market data)               consumer (strategy)
+        ----------------------               -------------------
+        publish(7, book)  -> slot 7          drain(fn): 7 -> fn(7, latest)
+        publish(7, book') -> slot 7 (conflated)     3 -> fn(3, latest)
+        publish(3, book)  -> slot 3
+
+    Each key (a SymbolRegistry id) owns one cache-line slot that is
+    overwritten in place under a per-slot sequence, like a Seqlock. A key
+    enters the dirty list only on its first change since the consumer last
+    took it, so the list never holds more than MaxKeys entries: memory is
+    fixed and the consumer's backlog is bounded by the number of symbols,
+    not by the feed rate.
+
+    Single producer, single consumer. T must be trivially copyable (the
+    consumer copies a slot out and validates the copy).
+
+    Usage:
+        ConflatingQueue<TopOfBook, 4096> latest;
+
+        latest.publish(id, book);                      // Market data thread
+
+        latest.drain([](uint32_t id, const TopOfBook& b) { ... });  // Strategy
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/memory/spsc_queue.hpp"  // CACHE_LINE_SIZE, SPSCQueue
+#include "nexusfix/memory/wait_strategy.hpp"
+
+namespace nfx::memory {
+
+using nfx::CACHE_LINE_SIZE;
+
+// Disable MSVC warning C4324: structure was padded due to alignment specifier
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+/// Keyed latest-value queue with a dirty list
+/// @tparam T Value type (trivially copyable)
+/// @tparam MaxKeys Keys 0 .. MaxKeys-1 (e.g. SymbolRegistry capacity)
+template <typename T, size_t MaxKeys>
+class ConflatingQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "Slots are copied racily; T must be trivially copyable");
+    static_assert(MaxKeys > 0 && MaxKeys < UINT32_MAX, "MaxKeys must fit a 32-bit key");
+
+    // One spare slot: SPSCQueue keeps one empty for full detection
+    using DirtyList = SPSCQueue<uint32_t, std::bit_ceil(MaxKeys + 1)>;
+
+public:
+    using key_type = uint32_t;
+    using value_type = T;
+
+    ConflatingQueue() noexcept = default;
+
+    // Non-copyable, non-movable
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+    ConflatingQueue(ConflatingQueue&&) = delete;
+    ConflatingQueue& operator=(ConflatingQueue&&) = delete;
+
+    // ========================================================================
+    // Producer API (single thread)
+    // ========================================================================
+
+    /// Replace key's value and mark it dirty
+    /// @return false if key is out of range
+    bool publish(key_type key, const T& value) noexcept {
+        return update(key, [&](T& slot) noexcept { slot = value; });
+    }
+
+    /// Modify key's value in place with fn(T&) and mark it dirty
+    /// @return false if key is out of range
+    template <typename Fn>
+    bool update(key_type key, Fn&& fn) noexcept {
+        if (key >= MaxKeys) [[unlikely]] return false;
+
+        Slot& slot = slots_[key];
+        const uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::forward<Fn>(fn)(slot.value);
+        slot.seq.store(seq + 2, std::memory_order_release);
+
+        // seq_cst pairs with the consumer's fence after clearing the flag:
+        // either we see it cleared and re-queue the key, or the consumer's
+        // copy sees this write
+        if (slot.dirty.exchange(true, std::memory_order_seq_cst)) {
+            conflated_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            // Cannot fail: a key is queued at most once
+            [[maybe_unused]] const bool queued = dirty_.try_push(key);
+        }
+        published_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // ========================================================================
+    // Consumer API (single thread)
+    // ========================================================================
+
+    /// Take the next dirty key and call fn(key, const T&) with its latest value
+    /// A key re-dirtied with the value already delivered is skipped.
+    /// @return false if no key is dirty
+    template <typename Fn>
+    bool try_consume(Fn&& fn) noexcept {
+        key_type key = 0;
+        T value;
+        for (;;) {
+            if (!dirty_.try_pop(key)) return false;
+
+            Slot& slot = slots_[key];
+            slot.dirty.store(false, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const uint64_t seq = copy(slot, value);
+            if (seq == delivered_[key]) continue;  // Already seen this write
+            delivered_[key] = seq;
+            break;
+        }
+        std::forward<Fn>(fn)(key, std::as_const(value));
+        return true;
+    }
+
+    /// Consume up to max dirty keys
+    /// @return Number of keys delivered
+    template <typename Fn>
+    size_t drain(Fn&& fn, size_t max = MaxKeys) noexcept {
+        size_t n = 0;
+        while (n < max && try_consume(fn)) {
+            ++n;
+        }
+        return n;
+    }
+
+    /// Latest value of key, dirty or not (consumer thread)
+    /// @return false if key is out of range
+    [[nodiscard]] bool read(key_type key, T& out) const noexcept {
+        if (key >= MaxKeys) return false;
+        (void)copy(slots_[key], out);
+        return true;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Keys waiting for the consumer (approximate from other threads)
+    [[nodiscard]] size_t pending() const noexcept { return dirty_.size_approx(); }
+
+    [[nodiscard]] bool empty() const noexcept { return dirty_.empty(); }
+
+    /// Values published
+    [[nodiscard]] uint64_t published() const noexcept {
+        return published_.load(std::memory_order_relaxed);
+    }
+
+    /// Values overwritten before the consumer took them
+    [[nodiscard]] uint64_t conflated() const noexcept {
+        return conflated_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxKeys; }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        std::atomic<uint64_t> seq{0};     // Odd while the producer writes
+        std::atomic<bool> dirty{false};   // Key is on the dirty list
+        T value{};
+    };
+
+    /// Copy a consistent value out of slot
+    /// @return Sequence of the copied write
+    static uint64_t copy(const Slot& slot, T& out) noexcept {
+        for (;;) {
+            const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq & 1) [[unlikely]] {
+                BusySpinWait::wait();
+                continue;
+            }
+            out = slot.value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) == seq) return seq;
+        }
+    }
+
+    // Producer-written counters
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> conflated_{0};
+
+    DirtyList dirty_;
+
+    // Consumer-only: sequence last delivered per key
+    alignas(CACHE_LINE_SIZE) std::array<uint64_t, MaxKeys> delivered_{};
+
+    alignas(CACHE_LINE_SIZE) std::array<Slot, MaxKeys> slots_{};
+};
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+} // namespace nfx::memory
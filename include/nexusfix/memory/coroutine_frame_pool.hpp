@@ -0,0 +1,193 @@
+/*
+    NexusFIX Coroutine Frame Pool
+
+    Allocator behind the promise types of session/coroutine.hpp. A frame
+    is sized at compile time but allocated per call, so a workflow that
+    awaits a child Task per order would otherwise hit the global heap on
+    every order. Frames here come from per-thread free lists in 64-byte
+    size classes, carved from 64 KiB chunks:
+
+        Task<> child(...)   ->  operator new(232)  ->  class 3 (256 B)
+        frame destroyed     ->  pushed on class 3's free list
+        next child(...)     ->  popped again, no heap call
+
+    Frames larger than MAX_POOLED go to ::operator new. Chunks are released
+    when the thread exits, so a frame must not outlive the thread that
+    created it (coroutines here are resumed by one reactor thread anyway).
+
+    Thread-safety: per thread, no locks. A frame destroyed on another
+    thread lands on that thread's free list.
+
+    Per-class counters show which frame sizes a workload uses and how
+    many are live at once, e.g. to pre-warm with reserve() so the first
+    orders of the day do not take the chunk allocation either.
+
+    Usage:
+        CoroutineFramePool::reserve(256, 64);    // 64 frames of <= 256 B
+        ...
+        struct promise_type {
+            static void* operator new(std::size_t size) {
+                return memory::CoroutineFramePool::allocate(size);
+            }
+            static void operator delete(void* p, std::size_t size) noexcept {
+                memory::CoroutineFramePool::deallocate(p, size);
+            }
+        };
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace nfx::memory {
+
+class CoroutineFramePool {
+public:
+    static constexpr size_t CLASS_SIZE = 64;
+    static constexpr size_t CLASS_COUNT = 32;
+    static constexpr size_t MAX_POOLED = CLASS_SIZE * CLASS_COUNT;   // 2 KiB
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    /// Counters of the calling thread's pool
+    struct Stats {
+        uint64_t allocations{0};   // Pooled frames handed out
+        uint64_t reused{0};        // ... of which from a free list
+        uint64_t chunks{0};        // Chunks taken from the heap
+        uint64_t oversized{0};     // Frames above MAX_POOLED (heap)
+    };
+
+    /// Counters of one size class
+    struct ClassStats {
+        uint64_t allocations{0};
+        uint64_t reused{0};
+        uint32_t in_use{0};        // Frames live now
+        uint32_t peak{0};          // Most frames live at once
+        uint32_t free{0};          // Frames on the free list
+    };
+
+    [[nodiscard]] static void* allocate(size_t size) {
+        Local& pool = local();
+        if (size > MAX_POOLED) [[unlikely]] {
+            ++pool.stats.oversized;
+            return ::operator new(size);
+        }
+
+        const size_t c = class_of(size);
+        ClassStats& cls = pool.classes[c];
+        ++pool.stats.allocations;
+        ++cls.allocations;
+        if (++cls.in_use > cls.peak) cls.peak = cls.in_use;
+        if (FreeBlock* block = pool.free[c]) {
+            pool.free[c] = block->next;
+            ++pool.stats.reused;
+            ++cls.reused;
+            --cls.free;
+            return block;
+        }
+        return pool.carve(class_size(c));
+    }
+
+    /// @param size The size passed to allocate()
+    static void deallocate(void* p, size_t size) noexcept {
+        if (size > MAX_POOLED) [[unlikely]] {
+            ::operator delete(p);
+            return;
+        }
+        Local& pool = local();
+        const size_t c = class_of(size);
+        --pool.classes[c].in_use;
+        pool.push_free(c, p);
+    }
+
+    /// Put count frames of up to frame_size on the calling thread's free list
+    static void reserve(size_t frame_size, size_t count) {
+        if (frame_size > MAX_POOLED || count == 0) return;
+        Local& pool = local();
+        const size_t c = class_of(frame_size);
+        for (size_t i = 0; i < count; ++i) pool.push_free(c, pool.carve(class_size(c)));
+    }
+
+    [[nodiscard]] static const Stats& stats() noexcept { return local().stats; }
+
+    /// Counters of the class serving frames of frame_size (<= MAX_POOLED)
+    [[nodiscard]] static const ClassStats& class_stats(size_t frame_size) noexcept {
+        return local().classes[class_of(frame_size)];
+    }
+
+    /// Counters of every class; index i serves frames up to class_size(i)
+    [[nodiscard]] static const std::array<ClassStats, CLASS_COUNT>& all_class_stats() noexcept {
+        return local().classes;
+    }
+
+    /// Zero the counters (live and free frame counts are kept)
+    static void reset_stats() noexcept {
+        Local& pool = local();
+        pool.stats = Stats{};
+        for (auto& cls : pool.classes) {
+            cls.allocations = cls.reused = 0;
+            cls.peak = cls.in_use;
+        }
+    }
+
+    [[nodiscard]] static constexpr size_t class_size(size_t c) noexcept {
+        return (c + 1) * CLASS_SIZE;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Local {
+        std::array<FreeBlock*, CLASS_COUNT> free{};
+        std::vector<void*> chunks;
+        char* cursor{nullptr};
+        size_t remaining{0};
+        Stats stats{};
+        std::array<ClassStats, CLASS_COUNT> classes{};
+
+        Local() = default;
+        Local(const Local&) = delete;
+        Local& operator=(const Local&) = delete;
+
+        ~Local() {
+            for (void* chunk : chunks) ::operator delete(chunk, std::align_val_t{CLASS_SIZE});
+        }
+
+        void push_free(size_t c, void* p) noexcept {
+            auto* block = static_cast<FreeBlock*>(p);
+            block->next = free[c];
+            free[c] = block;
+            ++classes[c].free;
+        }
+
+        void* carve(size_t bytes) {
+            if (remaining < bytes) {
+                chunks.reserve(chunks.size() + 1);  // Throw before taking the chunk
+                cursor = static_cast<char*>(::operator new(CHUNK_SIZE, std::align_val_t{CLASS_SIZE}));
+                chunks.push_back(cursor);
+                remaining = CHUNK_SIZE;
+                ++stats.chunks;
+            }
+            void* block = cursor;
+            cursor += bytes;
+            remaining -= bytes;
+            return block;
+        }
+    };
+
+    [[nodiscard]] static constexpr size_t class_of(size_t size) noexcept {
+        return size == 0 ? 0 : (size - 1) / CLASS_SIZE;
+    }
+
+    [[nodiscard]] static Local& local() noexcept {
+        thread_local Local pool;
+        return pool;
+    }
+};
+
+} // namespace nfx::memory
@@ -0,0 +1,149 @@
+/*
+    NexusFIX Hibernation Pool
+
+    Shared home for the large buffers of idle sessions. A hibernating
+    session frees its store ring and index; this resource keeps the
+    freed blocks (by size and alignment) instead of returning them to
+    the system, and hands them to the next session that wakes up:
+
+        session A hibernates:  deallocate(ring, 1MB) --> cache [1MB, 1MB, 160KB ...]
+        session B wakes:       allocate(1MB)         <-- cache hit, pages already resident
+
+    So the memory held for buffers follows the number of sessions that
+    are busy, not the number configured, and a waking session does not
+    take page faults on a fresh mapping. Blocks past max_cached_bytes,
+    and blocks under min_block_size, go straight to the upstream.
+
+    Thread-safe (one mutex): sessions hibernate and wake on any worker.
+    Hibernation is rare, so the lock is never on a message path.
+
+    Usage:
+        memory::HibernationPool pool{{.max_cached_bytes = 256 << 20}};
+        store::MemoryMessageStore store{{.session_id = "S1", .upstream_resource = &pool}};
+        ...
+        store.hibernate();      // Ring and index back to the pool
+        store.rehydrate();      // Taken again, usually from the cache
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace nfx::memory {
+
+// ============================================================================
+// Hibernation Pool
+// ============================================================================
+
+struct HibernationPoolConfig {
+    size_t max_cached_bytes = 256 * 1024 * 1024;   // Free blocks kept for reuse
+    size_t min_block_size = 4096;                  // Smaller blocks are not cached
+    std::pmr::memory_resource* upstream = nullptr; // nullptr = new_delete_resource()
+};
+
+/// Thread-safe memory resource caching large freed blocks for reuse
+class HibernationPool : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        size_t cached_bytes{0};     // Free blocks held
+        size_t cached_blocks{0};
+        size_t in_use_bytes{0};     // Allocated and not yet returned
+        uint64_t hits{0};           // Allocations served from the cache
+        uint64_t misses{0};         // Allocations passed upstream
+        uint64_t released{0};       // Blocks returned upstream (cache full or trim())
+    };
+
+    explicit HibernationPool(HibernationPoolConfig config = {}) noexcept
+        : config_{config}
+        , upstream_{config.upstream ? config.upstream : std::pmr::new_delete_resource()} {}
+
+    ~HibernationPool() override { trim(); }
+
+    HibernationPool(const HibernationPool&) = delete;
+    HibernationPool& operator=(const HibernationPool&) = delete;
+
+    /// Return every cached block to the upstream
+    void trim() noexcept {
+        std::lock_guard lock{mutex_};
+        for (const Block& b : cache_) {
+            upstream_->deallocate(b.ptr, b.size, b.alignment);
+            ++stats_.released;
+        }
+        cache_.clear();
+        stats_.cached_bytes = 0;
+        stats_.cached_blocks = 0;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept {
+        std::lock_guard lock{mutex_};
+        return stats_;
+    }
+
+    [[nodiscard]] const HibernationPoolConfig& config() const noexcept { return config_; }
+
+private:
+    struct Block {
+        void* ptr;
+        size_t size;
+        size_t alignment;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        {
+            std::lock_guard lock{mutex_};
+            // Newest first: the most recently freed block is the likeliest to be resident
+            for (size_t i = cache_.size(); i-- > 0;) {
+                const Block b = cache_[i];
+                if (b.size != bytes || b.alignment != alignment) continue;
+                cache_[i] = cache_.back();
+                cache_.pop_back();
+                stats_.cached_bytes -= b.size;
+                stats_.cached_blocks = cache_.size();
+                stats_.in_use_bytes += bytes;
+                ++stats_.hits;
+                return b.ptr;
+            }
+        }
+        void* p = upstream_->allocate(bytes, alignment);
+        std::lock_guard lock{mutex_};
+        stats_.in_use_bytes += bytes;
+        ++stats_.misses;
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        {
+            std::lock_guard lock{mutex_};
+            stats_.in_use_bytes -= bytes;
+            if (bytes >= config_.min_block_size &&
+                stats_.cached_bytes + bytes <= config_.max_cached_bytes) {
+                try {
+                    cache_.push_back(Block{p, bytes, alignment});
+                    stats_.cached_bytes += bytes;
+                    stats_.cached_blocks = cache_.size();
+                    return;
+                } catch (...) {
+                    // No room to remember it: release below
+                }
+            }
+            ++stats_.released;
+        }
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    HibernationPoolConfig config_;
+    std::pmr::memory_resource* upstream_;
+    mutable std::mutex mutex_;
+    std::vector<Block> cache_;
+    Stats stats_{};
+};
+
+}  // namespace nfx::memory
@@ -8,6 +8,13 @@
     - Linux with huge pages enabled
     - Sufficient huge pages reserved: echo 512 > /proc/sys/vm/nr_hugepages
     - Or use Transparent Huge Pages (THP)
+
+    When no hugetlbfs page is free, huge page requests fall back to a
+    2MB-aligned standard mapping marked MADV_HUGEPAGE so khugepaged /
+    the fault path can still back it with THP.
+
+    NUMA: pass a node to allocate() to bind the mapping to it before any
+    page is touched (see numa.hpp). -1 keeps the default first-touch policy.
 */
 
 #pragma once
@@ -17,6 +24,8 @@
 #include <memory>
 #include <new>
 
+#include "nexusfix/memory/numa.hpp"
+
 #ifdef __linux__
 #include <sys/mman.h>
 #include <unistd.h>
@@ -35,6 +44,13 @@ enum class HugePageSize : size_t {
     Huge1GB  = 1024 * 1024 * 1024 // 1GB huge page (requires specific support)
 };
 
+/// How a mapping returned by HugePageAllocator is backed
+enum class HugePageBacking : uint8_t {
+    HugeTLB,      // Reserved huge pages (MAP_HUGETLB)
+    Transparent,  // Standard mapping advised MADV_HUGEPAGE (THP)
+    Standard      // 4KB pages (or non-Linux heap memory)
+};
+
 // ============================================================================
 // Huge Page Allocator
 // ============================================================================
@@ -43,9 +59,15 @@ enum class HugePageSize : size_t {
 class HugePageAllocator {
 public:
     /// Allocate memory with huge pages
-    /// Falls back to standard aligned allocation if huge pages unavailable
+    /// Falls back to transparent huge pages, then standard pages, if
+    /// reserved huge pages are unavailable
+    /// @param numa_node Bind the mapping to this node (-1 = no binding)
+    /// @param backing If non-null, receives how the mapping is backed
     [[nodiscard]] static void* allocate(size_t size,
-                                        HugePageSize page_size = HugePageSize::Huge2MB) noexcept {
+                                        HugePageSize page_size = HugePageSize::Huge2MB,
+                                        int numa_node = -1,
+                                        HugePageBacking* backing = nullptr) noexcept {
+        HugePageBacking kind = HugePageBacking::Standard;
 #ifdef __linux__
         int flags = MAP_PRIVATE | MAP_ANONYMOUS;
 
@@ -70,13 +92,25 @@ public:
                         flags, -1, 0);
 
         if (ptr != MAP_FAILED) {
-            return ptr;
+            if (flags & MAP_HUGETLB) kind = HugePageBacking::HugeTLB;
+        } else if (flags & MAP_HUGETLB) {
+            // Fall back to THP; same length so deallocate()'s munmap()
+            // matches the mapping
+            ptr = map_transparent(aligned_size);
+            if (ptr != MAP_FAILED) kind = HugePageBacking::Transparent;
+        }
+        if (ptr == MAP_FAILED) {
+            return nullptr;
         }
 
-        // Fall back to standard allocation with alignment
-        return allocate_fallback(size, static_cast<size_t>(HugePageSize::Standard));
+        // Nothing is faulted in yet, so the policy covers every page
+        (void)numa_bind(ptr, aligned_size, numa_node);
+        if (backing) *backing = kind;
+        return ptr;
 #else
         // Non-Linux: use standard aligned allocation
+        (void)numa_node;
+        if (backing) *backing = kind;
         return allocate_fallback(size, 4096);
 #endif
     }
@@ -123,11 +157,41 @@ public:
 #endif
     }
 
-private:
-    static size_t align_to_page(size_t size, size_t page_size) noexcept {
+    /// Round size up to a multiple of page_size (the mapped length)
+    [[nodiscard]] static constexpr size_t align_to_page(size_t size, size_t page_size) noexcept {
         return (size + page_size - 1) & ~(page_size - 1);
     }
 
+private:
+#ifdef __linux__
+    /// Standard pages, 2MB aligned and advised MADV_HUGEPAGE
+    /// Over-maps by 2MB and trims both ends so the result is exactly
+    /// length bytes and every 2MB extent is THP eligible
+    [[nodiscard]] static void* map_transparent(size_t length) noexcept {
+        constexpr size_t THP_SIZE = static_cast<size_t>(HugePageSize::Huge2MB);
+
+        void* raw = mmap(nullptr, length + THP_SIZE,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return MAP_FAILED;
+        }
+
+        const auto base = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t start = (base + THP_SIZE - 1) & ~(THP_SIZE - 1);
+        const size_t head = start - base;
+        const size_t tail = THP_SIZE - head;
+        if (head) munmap(raw, head);
+        if (tail) munmap(reinterpret_cast<void*>(start + length), tail);
+
+        void* ptr = reinterpret_cast<void*>(start);
+#ifdef MADV_HUGEPAGE
+        (void)madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+        return ptr;
+    }
+#endif
+
     [[nodiscard]] static void* allocate_fallback(size_t size, size_t alignment) noexcept {
         return std::aligned_alloc(alignment, align_to_page(size, alignment));
     }
@@ -187,10 +251,11 @@ public:
 class HugePageBuffer {
 public:
     explicit HugePageBuffer(size_t size,
-                           HugePageSize page_size = HugePageSize::Huge2MB)
+                           HugePageSize page_size = HugePageSize::Huge2MB,
+                           int numa_node = -1)
         : size_(size)
         , page_size_(page_size)
-        , data_(HugePageAllocator::allocate(size, page_size)) {}
+        , data_(HugePageAllocator::allocate(size, page_size, numa_node)) {}
 
     ~HugePageBuffer() {
         if (data_) {
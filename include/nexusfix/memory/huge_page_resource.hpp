@@ -0,0 +1,127 @@
+/*
+    NexusFIX Huge Page Memory Resource
+
+    std::pmr::memory_resource whose allocations are huge page mappings
+    (2MB or 1GB), so a 64MB session pool costs 32 TLB entries instead of
+    16384. Each allocation is its own mmap():
+    - Reserved hugetlbfs pages (MAP_HUGETLB) are tried first
+    - Otherwise a 2MB-aligned mapping advised MADV_HUGEPAGE (THP)
+    - Optionally pre-faulted so the first message never takes a page fault
+
+    Like NumaMemoryResource it is meant as the upstream of a pool or
+    monotonic resource, or for large one-off buffers - not small objects.
+
+    Usage:
+        HugePageMemoryResource huge{{.page_size = HugePageSize::Huge2MB,
+                                     .prefault = true}};
+
+        MemoryMessageStore store{{.session_id = "S1",
+                                  .upstream_resource = &huge}};
+
+        SessionHeap heap{SessionHeap::DEFAULT_INITIAL_SIZE, &huge};
+
+        IoUringTransportConfig io{.buffer_resource = &huge};
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/util/memory_lock.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// Huge Page Memory Resource
+// ============================================================================
+
+/// PMR resource backed by huge page mappings
+class HugePageMemoryResource : public std::pmr::memory_resource {
+public:
+    struct Config {
+        HugePageSize page_size{HugePageSize::Huge2MB};
+        int numa_node{-1};            // Bind mappings to this node (-1 = any)
+        bool prefault{false};         // Touch every page at allocation time
+        bool transparent_fallback{true};  // Accept THP when hugetlbfs is empty
+    };
+
+    HugePageMemoryResource() noexcept = default;
+
+    explicit HugePageMemoryResource(const Config& config) noexcept
+        : config_{config} {}
+
+    // Non-copyable, non-movable (identity is the resource)
+    HugePageMemoryResource(const HugePageMemoryResource&) = delete;
+    HugePageMemoryResource& operator=(const HugePageMemoryResource&) = delete;
+    HugePageMemoryResource(HugePageMemoryResource&&) = delete;
+    HugePageMemoryResource& operator=(HugePageMemoryResource&&) = delete;
+
+    /// Get the PMR allocator for this resource
+    [[nodiscard]] std::pmr::polymorphic_allocator<char> allocator() noexcept {
+        return std::pmr::polymorphic_allocator<char>{this};
+    }
+
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+    /// Bytes currently mapped through this resource (page-rounded)
+    [[nodiscard]] size_t bytes_mapped() const noexcept { return bytes_mapped_; }
+
+    /// Allocations served with the given backing since construction
+    [[nodiscard]] size_t allocations(HugePageBacking backing) const noexcept {
+        return allocations_[static_cast<size_t>(backing)];
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        // Mappings are page aligned; anything stricter is not supported
+        if (alignment > static_cast<size_t>(config_.page_size)) {
+            throw std::bad_alloc();
+        }
+
+        HugePageBacking backing{};
+        void* ptr = HugePageAllocator::allocate(bytes, config_.page_size,
+                                                config_.numa_node, &backing);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+
+        const size_t length = mapped_length(bytes);
+        if (backing != HugePageBacking::HugeTLB && !config_.transparent_fallback &&
+            config_.page_size != HugePageSize::Standard) {
+            HugePageAllocator::deallocate(ptr, bytes, config_.page_size);
+            throw std::bad_alloc();
+        }
+        if (config_.prefault) {
+            util::prefault_memory_write(ptr, length);
+        }
+
+        ++allocations_[static_cast<size_t>(backing)];
+        bytes_mapped_ += length;
+        return ptr;
+    }
+
+    void do_deallocate(void* p, size_t bytes,
+                       [[maybe_unused]] size_t alignment) override {
+        HugePageAllocator::deallocate(p, bytes, config_.page_size);
+        bytes_mapped_ -= mapped_length(bytes);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    [[nodiscard]] size_t mapped_length(size_t bytes) const noexcept {
+        return HugePageAllocator::align_to_page(bytes, static_cast<size_t>(config_.page_size));
+    }
+
+    Config config_{};
+    size_t bytes_mapped_{0};
+    std::array<size_t, 3> allocations_{};
+};
+
+} // namespace nfx::memory
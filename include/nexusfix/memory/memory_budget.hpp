@@ -0,0 +1,241 @@
+/*
+    NexusFIX Per-Session Memory Budget
+
+    One number per session for everything it holds: heap allocations,
+    store pools and the session's own buffers. A soft and a hard limit
+    turn a runaway session into a throttled one instead of letting it
+    push the whole gateway into swap.
+
+        sources (heap, store, buffers) --update()--> total --> level
+                                                        Ok    total < soft
+                                                        Soft  soft <= total < hard
+                                                        Hard  total >= hard
+
+    - Crossing the soft limit reclaims what can go without losing state
+      (reclaim(false): free pages returned, e.g. mi_heap_collect) and
+      counts a soft breach.
+    - Crossing the hard limit does the same; while Hard, admit() is false
+      and SessionManager refuses application messages (Throttled). Hard
+      holds until the total falls back under the soft limit, so a session
+      sitting at the limit does not flap.
+    - On logout (disconnect) the session calls reclaim(true): monotonic
+      pools are reset as well as purged.
+
+    Usage is polled, not charged per allocation: update() asks each
+    tracked source for its bytes (function pointer + context, as
+    TimerNode), and set_usage() takes sizes the owner measures itself.
+    SessionManager::set_memory_budget() does both on every timer tick,
+    counting its memory_regions() as Buffers and the message store's as
+    Store, and publishes MemoryBudgetStats as nfx_memory_* metrics.
+
+    Single-threaded: the budget belongs to the session's thread.
+
+    Usage:
+        memory::MemoryBudget budget{{.soft_limit = 96 << 20, .hard_limit = 128 << 20}};
+        budget.track(session_heap);                  // NFX_HAS_MIMALLOC
+        session.set_memory_budget(&budget, registry.add<memory::MemoryBudgetStats>(labels));
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+#include "nexusfix/memory/mimalloc_resource.hpp"
+#endif
+
+namespace nfx::memory {
+
+// ============================================================================
+// Budget Types
+// ============================================================================
+
+enum class BudgetCategory : uint8_t {
+    Heap,       // Session heaps (SessionHeap, MimallocMemoryResource)
+    Store,      // Message store pools and maps
+    Buffers     // Session object, resend / send / inbound batches
+};
+
+inline constexpr size_t BUDGET_CATEGORY_COUNT = 3;
+
+enum class BudgetLevel : uint8_t {
+    Ok,
+    Soft,       // Over the soft limit: free pages reclaimed
+    Hard        // Over the hard limit: application sends refused
+};
+
+struct MemoryBudgetConfig {
+    size_t soft_limit = 0;     // Bytes (0 = none)
+    size_t hard_limit = 0;     // Bytes (0 = none)
+};
+
+/// Budget state for metrics (see MetricFamily<MemoryBudgetStats>)
+struct MemoryBudgetStats {
+    uint64_t heap_bytes{0};
+    uint64_t store_bytes{0};
+    uint64_t buffer_bytes{0};
+    uint64_t total_bytes{0};
+    uint64_t peak_bytes{0};
+    uint64_t soft_limit{0};
+    uint64_t hard_limit{0};
+    uint64_t soft_breaches{0};     // Ok -> Soft or Hard
+    uint64_t hard_breaches{0};     // -> Hard
+    uint64_t reclaims{0};          // reclaim() calls
+    uint64_t reclaimed_bytes{0};   // Usage dropped by reclaims
+    uint8_t level{0};              // BudgetLevel
+};
+
+// ============================================================================
+// Memory Budget
+// ============================================================================
+
+/// Soft / hard memory limit over one session's heaps, store and buffers
+class MemoryBudget {
+public:
+    static constexpr size_t MAX_SOURCES = 8;
+
+    /// Bytes a source holds now
+    using UsageFn = size_t (*)(const void* context) noexcept;
+    /// Give memory back; full = also reset pools (logout)
+    using ReclaimFn = void (*)(void* context, bool full) noexcept;
+
+    explicit MemoryBudget(MemoryBudgetConfig config = {}) noexcept : config_{config} {
+        stats_.soft_limit = config.soft_limit;
+        stats_.hard_limit = config.hard_limit;
+    }
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    /// Poll a source on every update()
+    /// @param reclaim Optional
+    /// @return false if MAX_SOURCES are tracked already
+    bool track(BudgetCategory category, UsageFn usage, ReclaimFn reclaim, void* context) noexcept {
+        if (source_count_ == MAX_SOURCES || !usage) return false;
+        sources_[source_count_++] = Source{usage, reclaim, context, category};
+        return true;
+    }
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+    /// Track a session heap: purged on reclaim, pool reset on a full one
+    bool track(SessionHeap& heap) noexcept {
+        return track(BudgetCategory::Heap,
+            [](const void* c) noexcept -> size_t {
+                return static_cast<const SessionHeap*>(c)->stats().bytes_allocated;
+            },
+            [](void* c, bool full) noexcept {
+                auto* h = static_cast<SessionHeap*>(c);
+                if (full) h->reset();
+                h->purge();
+            },
+            &heap);
+    }
+
+    /// Track a mimalloc heap: purged on reclaim
+    bool track(MimallocMemoryResource& heap) noexcept {
+        return track(BudgetCategory::Heap,
+            [](const void* c) noexcept -> size_t {
+                return static_cast<const MimallocMemoryResource*>(c)->bytes_allocated();
+            },
+            [](void* c, bool) noexcept { static_cast<MimallocMemoryResource*>(c)->purge(); },
+            &heap);
+    }
+#endif
+
+    /// Bytes of a category measured by the owner, added to its sources
+    void set_usage(BudgetCategory category, size_t bytes) noexcept {
+        direct_[static_cast<size_t>(category)] = bytes;
+    }
+
+    /// Re-read every source and move between levels
+    /// Entering Soft or Hard reclaims free pages once and re-reads.
+    BudgetLevel update() noexcept {
+        measure();
+        const BudgetLevel next = level_for(stats_.total_bytes);
+        if (next > level_) {
+            if (level_ == BudgetLevel::Ok) ++stats_.soft_breaches;
+            if (next == BudgetLevel::Hard) ++stats_.hard_breaches;
+            reclaim(false);
+            level_ = level_for(stats_.total_bytes);
+        } else {
+            level_ = next;
+        }
+        stats_.level = static_cast<uint8_t>(level_);
+        return level_;
+    }
+
+    /// Read every source, ask each to give memory back, then re-read
+    /// @param full Also reset pools (the session is logging out)
+    void reclaim(bool full) noexcept {
+        measure();
+        const uint64_t before = stats_.total_bytes;
+        for (size_t i = 0; i < source_count_; ++i) {
+            const Source& s = sources_[i];
+            if (s.reclaim) s.reclaim(s.context, full);
+        }
+        ++stats_.reclaims;
+        measure();
+        if (stats_.total_bytes < before) stats_.reclaimed_bytes += before - stats_.total_bytes;
+        if (full) {
+            level_ = level_for(stats_.total_bytes);
+            stats_.level = static_cast<uint8_t>(level_);
+        }
+    }
+
+    /// New work may allocate (not over the hard limit)
+    [[nodiscard]] NFX_FORCE_INLINE bool admit() const noexcept {
+        return level_ != BudgetLevel::Hard;
+    }
+
+    [[nodiscard]] BudgetLevel level() const noexcept { return level_; }
+    [[nodiscard]] size_t total() const noexcept { return stats_.total_bytes; }
+    [[nodiscard]] const MemoryBudgetStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const MemoryBudgetConfig& config() const noexcept { return config_; }
+    [[nodiscard]] size_t sources() const noexcept { return source_count_; }
+
+private:
+    struct Source {
+        UsageFn usage{nullptr};
+        ReclaimFn reclaim{nullptr};
+        void* context{nullptr};
+        BudgetCategory category{BudgetCategory::Heap};
+    };
+
+    void measure() noexcept {
+        std::array<size_t, BUDGET_CATEGORY_COUNT> bytes = direct_;
+        for (size_t i = 0; i < source_count_; ++i) {
+            const Source& s = sources_[i];
+            bytes[static_cast<size_t>(s.category)] += s.usage(s.context);
+        }
+        stats_.heap_bytes = bytes[static_cast<size_t>(BudgetCategory::Heap)];
+        stats_.store_bytes = bytes[static_cast<size_t>(BudgetCategory::Store)];
+        stats_.buffer_bytes = bytes[static_cast<size_t>(BudgetCategory::Buffers)];
+        stats_.total_bytes = stats_.heap_bytes + stats_.store_bytes + stats_.buffer_bytes;
+        if (stats_.total_bytes > stats_.peak_bytes) stats_.peak_bytes = stats_.total_bytes;
+    }
+
+    /// Level for a total, with Hard held down to the soft limit
+    [[nodiscard]] BudgetLevel level_for(uint64_t total) const noexcept {
+        const uint64_t soft = config_.soft_limit;
+        const uint64_t hard = config_.hard_limit;
+        if (hard != 0 && total >= hard) return BudgetLevel::Hard;
+        if (level_ == BudgetLevel::Hard && hard != 0 && total >= (soft != 0 ? soft : hard)) {
+            return BudgetLevel::Hard;
+        }
+        if (soft != 0 && total >= soft) return BudgetLevel::Soft;
+        return BudgetLevel::Ok;
+    }
+
+    MemoryBudgetConfig config_;
+    MemoryBudgetStats stats_{};
+    BudgetLevel level_{BudgetLevel::Ok};
+    std::array<Source, MAX_SOURCES> sources_{};
+    size_t source_count_{0};
+    std::array<size_t, BUDGET_CATEGORY_COUNT> direct_{};
+};
+
+}  // namespace nfx::memory
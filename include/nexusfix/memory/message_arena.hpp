@@ -0,0 +1,146 @@
+/*
+    NexusFIX Message Arena
+
+    Bump allocator for objects derived from inbound messages (order state,
+    book updates) that only live while one receive batch is processed.
+    Built on MonotonicPool: allocation is a pointer bump into an inline
+    buffer, and reset() reclaims everything at once in O(1).
+
+    The session owns one InboundArena and resets it after every batch of
+    messages delivered from one receive completion (one epoch). Anything
+    that must outlive the batch has to be copied out explicitly.
+
+        struct MyHandler {
+            memory::InboundArena* arena{nullptr};
+
+            void bind_inbound_arena(memory::InboundArena& a) noexcept { arena = &a; }
+
+            void on_app_message(const ParsedMessage& msg) noexcept {
+                auto* update = arena->make<BookUpdate>(...);   // Gone next epoch
+                auto symbol = arena->copy(msg.get_string(55));
+            }
+        };
+
+    Only trivially destructible types may be created: no destructor runs
+    on reset(). Once the inline buffer is full, overflow chunks come from
+    the upstream resource (default: new/delete) and are released on reset.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/memory/buffer_pool.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// Message Arena
+// ============================================================================
+
+/// Epoch-reset bump arena for per-batch message processing
+/// @tparam Size Inline buffer size in bytes
+template <size_t Size>
+class MessageArena : public std::pmr::memory_resource {
+public:
+    /// @param upstream Overflow source once the inline buffer is exhausted
+    explicit MessageArena(
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+        : pool_{upstream} {}
+
+    // Non-copyable, non-movable (handlers keep a reference)
+    MessageArena(const MessageArena&) = delete;
+    MessageArena& operator=(const MessageArena&) = delete;
+    MessageArena(MessageArena&&) = delete;
+    MessageArena& operator=(MessageArena&&) = delete;
+
+    // ========================================================================
+    // Allocation
+    // ========================================================================
+
+    /// Construct a T valid until the next reset()
+    template <typename T, typename... Args>
+    [[nodiscard]] T* make(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "Arena objects are never destroyed");
+        return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /// Value-initialized array of n T valid until the next reset()
+    template <typename T>
+    [[nodiscard]] std::span<T> make_array(size_t n) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "Arena objects are never destroyed");
+        T* first = static_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+        for (size_t i = 0; i < n; ++i) {
+            ::new (first + i) T();
+        }
+        return {first, n};
+    }
+
+    /// Copy a string (e.g. a field view into the receive buffer) into the arena
+    [[nodiscard]] std::string_view copy(std::string_view s) {
+        if (s.empty()) return {};
+        char* dst = static_cast<char*>(allocate(s.size(), 1));
+        std::memcpy(dst, s.data(), s.size());
+        return {dst, s.size()};
+    }
+
+    /// Get the PMR allocator (for std::pmr containers living one epoch)
+    [[nodiscard]] std::pmr::polymorphic_allocator<char> allocator() noexcept {
+        return std::pmr::polymorphic_allocator<char>{this};
+    }
+
+    // ========================================================================
+    // Epochs
+    // ========================================================================
+
+    /// Reclaim every allocation and start the next epoch
+    void reset() noexcept {
+        if (bytes_allocated_ != 0) {
+            pool_.reset();
+            bytes_allocated_ = 0;
+        }
+        ++epoch_;
+    }
+
+    /// Current epoch (number of resets so far)
+    [[nodiscard]] uint64_t epoch() const noexcept { return epoch_; }
+
+    /// Bytes handed out in the current epoch
+    [[nodiscard]] size_t bytes_allocated() const noexcept { return bytes_allocated_; }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Size; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        bytes_allocated_ += bytes;
+        return pool_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate([[maybe_unused]] void* p, [[maybe_unused]] size_t bytes,
+                       [[maybe_unused]] size_t alignment) override {
+        // Reclaimed on reset()
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    MonotonicPool<Size> pool_;
+    size_t bytes_allocated_{0};
+    uint64_t epoch_{0};
+};
+
+/// Arena a session resets after each receive batch
+using InboundArena = MessageArena<16 * 1024>;
+
+} // namespace nfx::memory
@@ -16,6 +16,7 @@
 #include <mimalloc.h>
 
 #include "nexusfix/memory/buffer_pool.hpp"  // CACHE_LINE_SIZE
+#include "nexusfix/memory/huge_page_allocator.hpp"
 
 namespace nfx::memory {
 
@@ -87,6 +88,11 @@ public:
     /// Check if the heap was created successfully
     [[nodiscard]] bool valid() const noexcept { return heap_ != nullptr; }
 
+    /// Return the heap's free pages to the OS (mi_heap_collect, forced)
+    void purge() noexcept {
+        if (heap_) mi_heap_collect(heap_, true);
+    }
+
 private:
     void* do_allocate(size_t bytes, size_t alignment) override {
         void* ptr = mi_heap_malloc_aligned(heap_, bytes, alignment);
@@ -132,8 +138,14 @@ private:
 ///   1. pool_ destroyed first (frees overflow chunks via heap_)
 ///   2. heap_ destroyed last (mi_heap_destroy releases initial_buffer_ + remainder)
 ///
+/// NUMA: with a node, the initial buffer is a mapping bound to that node
+/// (the session's pinned core, see CpuAffinity::get_numa_node) instead of
+/// a mimalloc block. Overflow still comes from the mimalloc heap, which
+/// places pages by first touch, i.e. on the node of the session thread.
+///
 /// Usage:
 ///   SessionHeap session(64 * 1024 * 1024);  // 64MB initial buffer
+///   SessionHeap pinned(64 * 1024 * 1024, 1); // initial buffer on node 1
 ///   auto alloc = session.allocator();
 ///   auto* ptr = alloc.allocate(256);        // Monotonic bump (~10ns)
 ///   // ... use ptr ...
@@ -142,10 +154,29 @@ class SessionHeap : public std::pmr::memory_resource {
 public:
     static constexpr size_t DEFAULT_INITIAL_SIZE = 64 * 1024 * 1024;  // 64MB
 
-    explicit SessionHeap(size_t initial_buffer_size = DEFAULT_INITIAL_SIZE) noexcept
+    /// @param initial_buffer_size Monotonic buffer size
+    /// @param numa_node Bind the initial buffer to this node (-1 = mimalloc)
+    explicit SessionHeap(size_t initial_buffer_size = DEFAULT_INITIAL_SIZE,
+                         int numa_node = -1) noexcept
+        : heap_{}
+        , numa_node_(numa_node)
+        , initial_buffer_(static_cast<char*>(numa_node >= 0
+              ? HugePageAllocator::allocate(initial_buffer_size,
+                                            HugePageSize::Standard, numa_node)
+              : heap_.allocate(initial_buffer_size, CACHE_LINE_SIZE)))
+        , initial_buffer_size_(initial_buffer_size)
+        , pool_(initial_buffer_, initial_buffer_size_, &heap_) {}
+
+    /// @param initial_buffer_size Monotonic buffer size
+    /// @param initial_resource Source of the initial buffer (e.g. a
+    ///        HugePageMemoryResource); must outlive the heap. Overflow
+    ///        chunks still come from mimalloc.
+    SessionHeap(size_t initial_buffer_size,
+                std::pmr::memory_resource* initial_resource) noexcept
         : heap_{}
-        , initial_buffer_(static_cast<char*>(
-              heap_.allocate(initial_buffer_size, CACHE_LINE_SIZE)))
+        , numa_node_(-1)
+        , initial_resource_(initial_resource)
+        , initial_buffer_(allocate_initial(initial_resource, initial_buffer_size))
         , initial_buffer_size_(initial_buffer_size)
         , pool_(initial_buffer_, initial_buffer_size_, &heap_) {}
 
@@ -156,11 +187,25 @@ public:
     SessionHeap& operator=(SessionHeap&&) = delete;
 
     // Destructor order: pool_ first (frees overflow chunks via heap_),
-    // then heap_ (mi_heap_destroy releases initial_buffer_ + remainder)
+    // then heap_ (mi_heap_destroy releases initial_buffer_ + remainder).
+    // A NUMA-bound or resource-provided initial buffer is returned explicitly.
+    ~SessionHeap() override {
+        pool_.release();
+        if (initial_resource_ && initial_buffer_) {
+            initial_resource_->deallocate(initial_buffer_, initial_buffer_size_,
+                                          CACHE_LINE_SIZE);
+        } else if (numa_node_ >= 0 && initial_buffer_) {
+            HugePageAllocator::deallocate(initial_buffer_, initial_buffer_size_,
+                                          HugePageSize::Standard);
+        }
+    }
 
     /// Reset the monotonic pool (reuse initial buffer, keep heap alive)
     void reset() noexcept { pool_.release(); }
 
+    /// Return free pages of the underlying heap to the OS (after reset())
+    void purge() noexcept { heap_.purge(); }
+
     /// Get allocator for this session heap
     [[nodiscard]] std::pmr::polymorphic_allocator<char> allocator() noexcept {
         return std::pmr::polymorphic_allocator<char>{this};
@@ -179,7 +224,20 @@ public:
         return initial_buffer_size_;
     }
 
+    /// NUMA node the initial buffer is bound to (-1 = unbound)
+    [[nodiscard]] int numa_node() const noexcept { return numa_node_; }
+
 private:
+    [[nodiscard]] static char* allocate_initial(std::pmr::memory_resource* resource,
+                                                size_t size) noexcept {
+        if (!resource) return nullptr;
+        try {
+            return static_cast<char*>(resource->allocate(size, CACHE_LINE_SIZE));
+        } catch (...) {
+            return nullptr;  // Reported through valid()
+        }
+    }
+
     void* do_allocate(size_t bytes, size_t alignment) override {
         return pool_.allocate(bytes, alignment);
     }
@@ -199,6 +257,8 @@ private:
     // heap_ constructed first, destroyed last (releases everything)
     // pool_ constructed last, destroyed first (releases overflow chunks)
     MimallocMemoryResource heap_;
+    int numa_node_;
+    std::pmr::memory_resource* initial_resource_{nullptr};
     char* initial_buffer_;
     size_t initial_buffer_size_;
     std::pmr::monotonic_buffer_resource pool_;
@@ -32,7 +32,10 @@
 #include <optional>
 #include <type_traits>
 #include <new>
+#include <span>
+#include <algorithm>
 
+#include "spsc_queue.hpp"  // CACHE_LINE_SIZE, ClaimedRange
 #include "wait_strategy.hpp"
 #include "nexusfix/util/compiler.hpp"
 
@@ -163,6 +166,111 @@ public:
         }
     }
 
+    /// Reserve one slot for writing in place (producer, multiple threads)
+    /// Serialize directly into *claim, then commit(); nothing is copied.
+    /// @return The claimed slot, empty if the queue is full
+    [[nodiscard]] SlotClaim<T> try_claim() noexcept {
+        size_t head = head_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const size_t slot = head & mask_;
+            const size_t seq = sequences_[slot].value.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(head);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(head, head + 1,
+                        std::memory_order_relaxed)) {
+                    return {&buffer_[slot], head};
+                }
+            } else if (diff < 0) {
+                return {};
+            } else {
+                head = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Claim with spin wait (blocks until a slot is free)
+    [[nodiscard]] SlotClaim<T> claim() noexcept {
+        SlotClaim<T> claimed;
+        while (!(claimed = try_claim())) {
+            WaitStrategyT::wait();
+        }
+        return claimed;
+    }
+
+    /// Make a claimed slot visible to the consumer
+    void commit(const SlotClaim<T>& claimed) noexcept {
+        sequences_[claimed.position & mask_].value.store(
+            claimed.position + 1, std::memory_order_release);
+    }
+
+    // ========================================================================
+    // Batch Producer Interface (multiple threads)
+    // ========================================================================
+
+    /// Reserve n consecutive slots with a single CAS on head_ (all or nothing)
+    /// The consumer frees slots in order, each with a release store, so
+    /// acquiring the last slot of the run as free orders every earlier
+    /// slot's free before this claim. Fill the slots through slot() and
+    /// hand them over with publish(); the consumer stops at the first
+    /// unpublished slot.
+    /// @return The claimed range, empty if fewer than n slots are free
+    [[nodiscard]] ClaimedRange try_claim(size_t n) noexcept {
+        if (n == 0 || n > Capacity) {
+            return {};
+        }
+
+        size_t head = head_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const size_t last = head + n - 1;
+            const size_t seq = sequences_[last & mask_].value.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(last);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(head, head + n,
+                        std::memory_order_relaxed)) {
+                    return {head, n};
+                }
+            } else if (diff < 0) {
+                return {};
+            } else {
+                head = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Slot i of a claimed range
+    [[nodiscard]] T& slot(const ClaimedRange& range, size_t i) noexcept {
+        return buffer_[(range.first + i) & mask_];
+    }
+
+    /// Make every slot of a claimed range visible to the consumer
+    /// One release fence covers the whole range; the per-slot sequence
+    /// stores are uncontended and relaxed.
+    void publish(const ClaimedRange& range) noexcept {
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < range.count; ++i) {
+            const size_t pos = range.first + i;
+            sequences_[pos & mask_].value.store(pos + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Push all items with one claim and one publish (all or nothing)
+    /// @return true if successful, false if fewer than items.size() slots are free
+    [[nodiscard]] bool try_push_batch(std::span<const T> items) noexcept {
+        const ClaimedRange range = try_claim(items.size());
+        if (!range) {
+            return false;
+        }
+        for (size_t i = 0; i < range.count; ++i) {
+            slot(range, i) = items[i];
+        }
+        publish(range);
+        return true;
+    }
+
     // ========================================================================
     // Consumer Interface (single thread only)
     // ========================================================================
@@ -218,6 +326,26 @@ public:
         return item;
     }
 
+    /// Hand the front element to fn in place, then release its slot
+    /// @param fn Called as fn(T&) while the element is still in the ring
+    /// @return true if an element was consumed, false if none is published
+    template<typename Fn>
+    bool try_consume(Fn&& fn) noexcept(noexcept(fn(std::declval<T&>()))) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t slot = tail & mask_;
+        const size_t seq = sequences_[slot].value.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail + 1);
+
+        if (diff < 0) {
+            return false;
+        }
+
+        fn(buffer_[slot]);
+        sequences_[slot].value.store(tail + Capacity, std::memory_order_release);
+        tail_.store(tail + 1, std::memory_order_relaxed);
+        return true;
+    }
+
     // ========================================================================
     // Batch Operations (Consumer only)
     // ========================================================================
@@ -237,6 +365,68 @@ public:
         return count;
     }
 
+    /// Pop every published element, up to out.size(), at once
+    /// Stops at the first slot not yet published. Slots are released to
+    /// producers after the copy, in order, each with a release store: a
+    /// producer's batch try_claim() checks only the last slot of its run.
+    /// @return Number of elements written to the front of out
+    [[nodiscard]] size_t drain(std::span<T> out) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t count = 0;
+
+        while (count < out.size()) {
+            const size_t pos = tail + count;
+            const size_t seq = sequences_[pos & mask_].value.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+                break;
+            }
+            out[count++] = std::move(buffer_[pos & mask_]);
+        }
+
+        if (count != 0) {
+            for (size_t i = 0; i < count; ++i) {
+                const size_t pos = tail + i;
+                sequences_[pos & mask_].value.store(pos + Capacity, std::memory_order_release);
+            }
+            tail_.store(tail + count, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /// Number of published elements at the front, up to max_count, left
+    /// in the ring: read them through peek() and hand the slots back with
+    /// release(). Large elements are used in place instead of copied out.
+    [[nodiscard]] size_t readable(size_t max_count) const noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t count = 0;
+        while (count < max_count) {
+            const size_t pos = tail + count;
+            const size_t seq = sequences_[pos & mask_].value.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+                break;
+            }
+            ++count;
+        }
+        return count;
+    }
+
+    /// Element i from the front (i < readable())
+    [[nodiscard]] T& peek(size_t i) noexcept {
+        return buffer_[(tail_.load(std::memory_order_relaxed) + i) & mask_];
+    }
+
+    /// Release the first count elements (count <= readable()) to producers
+    /// In order, each with a release store, as drain() does.
+    void release(size_t count) noexcept {
+        if (count == 0) return;
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            const size_t pos = tail + i;
+            sequences_[pos & mask_].value.store(pos + Capacity, std::memory_order_release);
+        }
+        tail_.store(tail + count, std::memory_order_relaxed);
+    }
+
     // ========================================================================
     // Status Queries (thread-safe)
     // ========================================================================
@@ -0,0 +1,98 @@
+/*
+    NexusFIX NUMA Memory Placement
+
+    Binds memory ranges to a NUMA node so a session pinned to a core on
+    socket 1 keeps its store ring, receive buffers and heap on socket 1.
+
+    Uses the mbind(2) / get_mempolicy(2) system calls directly, so no
+    libnuma link dependency is needed. Policies only affect pages that
+    are faulted in after the call: bind freshly mmap()ed memory before
+    first touch, or pass move=true to migrate pages already resident.
+
+    Node topology (core -> node) lives in util/cpu_affinity.hpp.
+    Non-Linux: binding is a no-op that reports failure for node >= 0.
+*/
+
+#pragma once
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace nfx::memory {
+
+// ============================================================================
+// NUMA Policy
+// ============================================================================
+
+/// How strictly memory is tied to the requested node
+enum class NumaPolicy : uint8_t {
+    Preferred,  // Allocate on the node, fall back to others when it is full
+    Bind        // Only the node; faults fail (SIGBUS / OOM) when it is full
+};
+
+/// Highest node number a mask can describe
+inline constexpr int MAX_NUMA_NODES = 1024;
+
+// ============================================================================
+// Binding
+// ============================================================================
+
+/// Apply a NUMA memory policy to a range
+/// @param addr Start of the range (rounded down to a page boundary)
+/// @param length Range length in bytes
+/// @param node NUMA node; negative leaves the range untouched
+/// @param policy Preferred (default) or strict Bind
+/// @param move Also migrate pages that are already resident
+/// @return true if the policy was applied (or node < 0)
+[[nodiscard]] inline bool numa_bind(void* addr, size_t length, int node,
+                                    NumaPolicy policy = NumaPolicy::Preferred,
+                                    bool move = false) noexcept {
+    if (node < 0) return true;
+    if (addr == nullptr || length == 0 || node >= MAX_NUMA_NODES) return false;
+
+#ifdef __linux__
+    constexpr size_t BITS = sizeof(unsigned long) * CHAR_BIT;
+    std::array<unsigned long, MAX_NUMA_NODES / BITS> mask{};
+    mask[static_cast<size_t>(node) / BITS] = 1UL << (static_cast<size_t>(node) % BITS);
+
+    const auto page = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = reinterpret_cast<uintptr_t>(addr) & ~(page - 1);
+    const auto end = reinterpret_cast<uintptr_t>(addr) + length;
+
+    const int mode = policy == NumaPolicy::Bind ? MPOL_BIND : MPOL_PREFERRED;
+    const unsigned flags = move ? MPOL_MF_MOVE : 0;
+    return ::syscall(SYS_mbind, start, end - start, mode, mask.data(),
+                     MAX_NUMA_NODES + 1, flags) == 0;
+#else
+    (void)policy;
+    (void)move;
+    return false;
+#endif
+}
+
+/// NUMA node the page holding addr resides on
+/// @return Node number, or -1 if unknown (page not yet faulted in, or
+///         not supported on this platform)
+[[nodiscard]] inline int numa_node_of(const void* addr) noexcept {
+#ifdef __linux__
+    int node = -1;
+    if (::syscall(SYS_get_mempolicy, &node, nullptr, 0UL,
+                  const_cast<void*>(addr), MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+        return -1;
+    }
+    return node;
+#else
+    (void)addr;
+    return -1;
+#endif
+}
+
+} // namespace nfx::memory
@@ -0,0 +1,91 @@
+/*
+    NexusFIX NUMA Memory Resource
+
+    std::pmr::memory_resource that hands out page-granular mappings bound
+    to one NUMA node. Every allocation is its own mmap() (optionally huge
+    pages), so it is meant as the upstream of a pool or monotonic
+    resource, or for large one-off buffers such as the message store
+    ring - not for small objects directly.
+
+    Usage:
+        int node = CpuAffinity::get_numa_node(core);
+        NumaMemoryResource numa{node};
+
+        MemoryMessageStore store{{.session_id = "S1",
+                                  .upstream_resource = &numa}};
+
+        std::pmr::unsynchronized_pool_resource pool{&numa};
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/memory/numa.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// NUMA Memory Resource
+// ============================================================================
+
+/// PMR resource whose memory is bound to a NUMA node
+class NumaMemoryResource : public std::pmr::memory_resource {
+public:
+    /// @param numa_node Node to bind to (-1 = unbound, first-touch)
+    /// @param page_size Page size of each mapping (huge pages fall back to 4KB)
+    explicit NumaMemoryResource(int numa_node,
+                                HugePageSize page_size = HugePageSize::Standard) noexcept
+        : numa_node_{numa_node}
+        , page_size_{page_size} {}
+
+    // Non-copyable, non-movable (identity is the resource)
+    NumaMemoryResource(const NumaMemoryResource&) = delete;
+    NumaMemoryResource& operator=(const NumaMemoryResource&) = delete;
+    NumaMemoryResource(NumaMemoryResource&&) = delete;
+    NumaMemoryResource& operator=(NumaMemoryResource&&) = delete;
+
+    /// Get the PMR allocator for this resource
+    [[nodiscard]] std::pmr::polymorphic_allocator<char> allocator() noexcept {
+        return std::pmr::polymorphic_allocator<char>{this};
+    }
+
+    [[nodiscard]] int numa_node() const noexcept { return numa_node_; }
+    [[nodiscard]] HugePageSize page_size() const noexcept { return page_size_; }
+
+    /// Bytes currently mapped through this resource
+    [[nodiscard]] size_t bytes_mapped() const noexcept { return bytes_mapped_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        // Mappings are page aligned; anything stricter is not supported
+        if (alignment > static_cast<size_t>(page_size_)) {
+            throw std::bad_alloc();
+        }
+        void* ptr = HugePageAllocator::allocate(bytes, page_size_, numa_node_);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        bytes_mapped_ += bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void* p, size_t bytes,
+                       [[maybe_unused]] size_t alignment) override {
+        HugePageAllocator::deallocate(p, bytes, page_size_);
+        bytes_mapped_ -= bytes;
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    int numa_node_;
+    HugePageSize page_size_;
+    size_t bytes_mapped_{0};
+};
+
+} // namespace nfx::memory
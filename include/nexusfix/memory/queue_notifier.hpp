@@ -0,0 +1,322 @@
+/*
+    NexusFIX Queue Notifier
+
+    Blocking wake-up for lock-free queues whose consumer sometimes sleeps.
+    Producers pay a fence and a load per push; they only make a syscall
+    when the consumer has announced it is about to sleep:
+
+        consumer                          producer
+        --------                          --------
+        prepare_wait()   state = Sleeping
+        queue empty? -> wait()            push(item)
+                                          notify(): Sleeping? -> signal
+
+    Two signal paths:
+    - Futex: the consumer blocks in wait() on the state word
+    - EventFd: the consumer blocks in wait() (poll) or, more usefully,
+      keeps an IORING_OP_READ / POLL_ADD on fd() in its io_uring so one
+      thread sleeps on network completions and cross-thread submissions
+      at once (see IoUringReactor::watch_notifier)
+
+    The consumer must re-check the queue between prepare_wait() and
+    blocking; an item pushed before the announcement is not signalled.
+    NotifyingQueue wraps a queue and follows that protocol.
+
+    Usage:
+        NotifyingQueue<MPSCQueue<Order, 1024>> orders{QueueNotifier::Mode::EventFd};
+
+        orders.try_push(order);              // Any thread: wakes the consumer only if asleep
+
+        Order o;
+        if (orders.pop_wait(o, 100)) { ... } // Consumer: sleeps while empty
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "nexusfix/memory/spsc_queue.hpp"  // CACHE_LINE_SIZE, ClaimedRange
+#include "nexusfix/memory/wait_strategy.hpp"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace nfx::memory {
+
+// ============================================================================
+// Queue Notifier
+// ============================================================================
+
+/// Sleep announcement + wake signal shared by a queue's producers and consumer
+class QueueNotifier {
+public:
+    enum class Mode : uint8_t {
+        Futex,    // Consumer blocks in wait()
+        EventFd   // Consumer may also wait on fd() from an io_uring / poll set
+    };
+
+    /// @param mode Signal path; EventFd falls back to Futex if eventfd() fails
+    explicit QueueNotifier(Mode mode = Mode::Futex) noexcept {
+#if defined(__linux__)
+        if (mode == Mode::EventFd) {
+            // Blocking: io_uring completes a READ on O_NONBLOCK with -EAGAIN
+            fd_ = ::eventfd(0, EFD_CLOEXEC);
+        }
+#else
+        (void)mode;
+#endif
+    }
+
+    ~QueueNotifier() {
+#if defined(__linux__)
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    // Non-copyable, non-movable (producers and the ring hold references)
+    QueueNotifier(const QueueNotifier&) = delete;
+    QueueNotifier& operator=(const QueueNotifier&) = delete;
+    QueueNotifier(QueueNotifier&&) = delete;
+    QueueNotifier& operator=(QueueNotifier&&) = delete;
+
+    [[nodiscard]] Mode mode() const noexcept {
+        return fd_ >= 0 ? Mode::EventFd : Mode::Futex;
+    }
+
+    /// eventfd to register with io_uring or poll (-1 in Futex mode)
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    // ========================================================================
+    // Producer API (any thread)
+    // ========================================================================
+
+    /// Wake the consumer if it announced it is going to sleep
+    /// Call after the item is published.
+    void notify() noexcept {
+        // Pairs with the fence in prepare_wait(): either we see Sleeping,
+        // or the consumer's re-check sees our item
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (state_.load(std::memory_order_relaxed) != SLEEPING) return;
+        if (state_.exchange(AWAKE, std::memory_order_acq_rel) != SLEEPING) return;
+
+        signals_.fetch_add(1, std::memory_order_relaxed);
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            const uint64_t one = 1;
+            [[maybe_unused]] auto n = ::write(fd_, &one, sizeof(one));
+            return;
+        }
+#endif
+        detail::futex_wake(state_word());
+    }
+
+    // ========================================================================
+    // Consumer API (single thread)
+    // ========================================================================
+
+    /// Announce sleep; re-check the queue before blocking
+    void prepare_wait() noexcept {
+        state_.store(SLEEPING, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /// The re-check found work: stop producers signalling
+    void cancel_wait() noexcept {
+        state_.store(AWAKE, std::memory_order_relaxed);
+    }
+
+    /// Block after prepare_wait() until notified or timeout
+    /// @param timeout_ms Maximum wait (negative = no limit)
+    /// @return true if a producer signalled
+    bool wait(int timeout_ms) noexcept {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            struct pollfd pfd{fd_, POLLIN, 0};
+            while (::poll(&pfd, 1, timeout_ms) < 0 && errno == EINTR) {}
+            cancel_wait();
+            return drain();
+        }
+#endif
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (state_.load(std::memory_order_acquire) == SLEEPING) {
+            uint32_t slice_us = MAX_PARK_US;
+            if (timeout_ms >= 0) {
+                const auto left = std::chrono::duration_cast<std::chrono::microseconds>(
+                    deadline - Clock::now()).count();
+                if (left <= 0) break;
+                if (left < MAX_PARK_US) slice_us = static_cast<uint32_t>(left);
+            }
+            detail::futex_park(state_word(), SLEEPING, slice_us);
+        }
+        // AWAKE here means a producer took the wake-up
+        return state_.exchange(AWAKE, std::memory_order_acq_rel) == AWAKE;
+    }
+
+    /// Consume pending eventfd signals (after a POLL_ADD completion)
+    /// A completed IORING_OP_READ of fd() has already consumed them.
+    /// @return true if a signal was pending
+    bool drain() noexcept {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            struct pollfd pfd{fd_, POLLIN, 0};
+            if (::poll(&pfd, 1, 0) <= 0) return false;  // read() would block
+            uint64_t count = 0;
+            return ::read(fd_, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count));
+        }
+#endif
+        return false;
+    }
+
+    /// True between prepare_wait() and the wake-up or cancel_wait()
+    [[nodiscard]] bool sleeping() const noexcept {
+        return state_.load(std::memory_order_acquire) == SLEEPING;
+    }
+
+    /// Wake-ups that needed a syscall
+    [[nodiscard]] uint64_t signals() const noexcept {
+        return signals_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t AWAKE = 0;
+    static constexpr uint32_t SLEEPING = 1;
+    static constexpr uint32_t MAX_PARK_US = 100'000;  // Bound one futex sleep
+
+    [[nodiscard]] uint32_t* state_word() noexcept {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+        return reinterpret_cast<uint32_t*>(&state_);
+    }
+
+    // Written by the consumer, read by every producer
+    alignas(nfx::CACHE_LINE_SIZE) std::atomic<uint32_t> state_{AWAKE};
+    std::atomic<uint64_t> signals_{0};
+    int fd_{-1};
+};
+
+// ============================================================================
+// Notifying Queue
+// ============================================================================
+
+/// Queue adaptor that wakes a sleeping consumer through a QueueNotifier
+/// @tparam Queue SPSCQueue or MPSCQueue instantiation
+template<typename Queue>
+class NotifyingQueue {
+public:
+    using value_type = typename Queue::value_type;
+    using T = value_type;
+
+    explicit NotifyingQueue(QueueNotifier::Mode mode = QueueNotifier::Mode::Futex) noexcept
+        : notifier_{mode} {}
+
+    // ========================================================================
+    // Producer Interface
+    // ========================================================================
+
+    [[nodiscard]] bool try_push(const T& item) noexcept {
+        if (!queue_.try_push(item)) return false;
+        notifier_.notify();
+        return true;
+    }
+
+    [[nodiscard]] bool try_push(T&& item) noexcept {
+        if (!queue_.try_push(std::move(item))) return false;
+        notifier_.notify();
+        return true;
+    }
+
+    void push(const T& item) noexcept {
+        queue_.push(item);
+        notifier_.notify();
+    }
+
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args) noexcept {
+        if (!queue_.try_emplace(std::forward<Args>(args)...)) return false;
+        notifier_.notify();
+        return true;
+    }
+
+    /// Claim a slot to fill in place (publish with commit())
+    [[nodiscard]] auto try_claim() noexcept { return queue_.try_claim(); }
+
+    template<typename Claim>
+    void commit(const Claim& claimed) noexcept {
+        queue_.commit(claimed);
+        notifier_.notify();
+    }
+
+    /// Claim n slots (publish with publish())
+    [[nodiscard]] ClaimedRange try_claim(size_t n) noexcept { return queue_.try_claim(n); }
+
+    [[nodiscard]] T& slot(const ClaimedRange& range, size_t i) noexcept {
+        return queue_.slot(range, i);
+    }
+
+    void publish(const ClaimedRange& range) noexcept {
+        queue_.publish(range);
+        notifier_.notify();  // One check per batch
+    }
+
+    // ========================================================================
+    // Consumer Interface
+    // ========================================================================
+
+    [[nodiscard]] bool try_pop(T& item) noexcept { return queue_.try_pop(item); }
+
+    template<typename Fn>
+    bool try_consume(Fn&& fn) noexcept(noexcept(fn(std::declval<T&>()))) {
+        return queue_.try_consume(std::forward<Fn>(fn));
+    }
+
+    /// Pop, sleeping on the notifier while the queue is empty
+    /// @param timeout_ms Maximum wait (negative = no limit)
+    /// @return false on timeout
+    [[nodiscard]] bool pop_wait(T& item, int timeout_ms = -1) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+        for (;;) {
+            if (queue_.try_pop(item)) return true;
+
+            notifier_.prepare_wait();
+            if (queue_.try_pop(item)) {
+                notifier_.cancel_wait();
+                return true;
+            }
+
+            int remaining = timeout_ms;
+            if (timeout_ms >= 0) {
+                remaining = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - Clock::now()).count());
+                if (remaining <= 0) {
+                    notifier_.cancel_wait();
+                    return queue_.try_pop(item);
+                }
+            }
+            (void)notifier_.wait(remaining);
+        }
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return queue_.empty(); }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Queue::capacity(); }
+
+    /// Underlying queue (pushes through it bypass the notifier)
+    [[nodiscard]] Queue& queue() noexcept { return queue_; }
+
+    [[nodiscard]] QueueNotifier& notifier() noexcept { return notifier_; }
+
+private:
+    Queue queue_;
+    QueueNotifier notifier_;
+};
+
+} // namespace nfx::memory
@@ -29,6 +29,8 @@
 #include <new>
 #include <type_traits>
 
+#include "nexusfix/memory/buffer_pool.hpp"
+
 #if defined(__x86_64__) || defined(_M_X64)
 #include <immintrin.h>
 #define NFX_SEQLOCK_PAUSE() _mm_pause()
@@ -44,13 +46,8 @@ namespace nfx::memory {
 // Seqlock Configuration
 // ============================================================================
 
-/// Cache line size for alignment
-inline constexpr std::size_t CACHE_LINE_SIZE =
-#ifdef __cpp_lib_hardware_interference_size
-    std::hardware_destructive_interference_size;
-#else
-    64;
-#endif
+/// Cache line size for alignment (shared with buffer_pool.hpp)
+using nfx::CACHE_LINE_SIZE;
 
 // ============================================================================
 // Seqlock Implementation
@@ -79,7 +76,10 @@ public:
     void write(const T& value) noexcept {
         // Increment to odd (write in progress)
         uint64_t seq = sequence_.load(std::memory_order_relaxed);
-        sequence_.store(seq + 1, std::memory_order_release);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        // Keep the data stores after the odd sequence (a release store
+        // alone only orders what comes before it)
+        std::atomic_thread_fence(std::memory_order_release);
 
         // Write data
         data_ = value;
@@ -92,7 +92,8 @@ public:
     /// Must be paired with end_write()
     void begin_write() noexcept {
         uint64_t seq = sequence_.load(std::memory_order_relaxed);
-        sequence_.store(seq + 1, std::memory_order_release);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
     }
 
     /// End write operation
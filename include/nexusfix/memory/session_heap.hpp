@@ -0,0 +1,34 @@
+#pragma once
+
+// make_session_heap - one private heap per FIX session
+//
+// memory::SessionHeap (mimalloc heap + monotonic pool, optionally NUMA
+// bound) when NFX_HAS_MIMALLOC is set, otherwise a std::pmr monotonic
+// resource. Engines that own many sessions use it as the upstream of each
+// session's store so no two sessions share heap pages.
+//
+// Construct it on the thread that will use it: the initial buffer is
+// first touched there.
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+#include "nexusfix/memory/mimalloc_resource.hpp"
+#endif
+
+namespace nfx::memory {
+
+/// @param size Initial buffer size
+/// @param numa_node Node for the initial buffer (-1 = any; mimalloc only)
+[[nodiscard]] inline std::unique_ptr<std::pmr::memory_resource>
+make_session_heap(size_t size, [[maybe_unused]] int numa_node = -1) {
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+    return std::make_unique<SessionHeap>(size, numa_node);
+#else
+    return std::make_unique<std::pmr::monotonic_buffer_resource>(size);
+#endif
+}
+
+} // namespace nfx::memory
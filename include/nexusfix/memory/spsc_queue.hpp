@@ -21,6 +21,11 @@
 #include <optional>
 #include <type_traits>
 #include <new>
+#include <span>
+#include <algorithm>
+#include <utility>
+
+#include "nexusfix/memory/buffer_pool.hpp"
 
 namespace nfx::memory {
 
@@ -28,11 +33,36 @@ namespace nfx::memory {
 // Cache Line Constants
 // ============================================================================
 
-#ifdef __cpp_lib_hardware_interference_size
-    inline constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
-#else
-    inline constexpr size_t CACHE_LINE_SIZE = 64;
-#endif
+/// Shared with buffer_pool.hpp so every memory header agrees on one value
+using nfx::CACHE_LINE_SIZE;
+
+// ============================================================================
+// Claimed Range
+// ============================================================================
+
+/// Run of slots reserved by try_claim(), filled by the producer and made
+/// visible to the consumer with publish(). Empty when the claim failed.
+struct ClaimedRange {
+    size_t first{0};    // First slot position (masked by the queue)
+    size_t count{0};    // Slots claimed
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return count; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return count != 0; }
+};
+
+/// Single ring slot reserved by try_claim() for in-place writing
+/// The slot still holds whatever the consumer left there: assign it or
+/// construct over it, then hand it over with commit().
+template<typename T>
+struct SlotClaim {
+    T* slot{nullptr};       // Ring slot (nullptr if the claim failed)
+    size_t position{0};     // Slot position (masked by the queue)
+
+    [[nodiscard]] T& operator*() const noexcept { return *slot; }
+    [[nodiscard]] T* operator->() const noexcept { return slot; }
+    [[nodiscard]] explicit operator bool() const noexcept { return slot != nullptr; }
+};
 
 // ============================================================================
 // SPSC Queue
@@ -47,6 +77,8 @@ class SPSCQueue {
     static_assert(Capacity >= 2, "Capacity must be at least 2");
 
 public:
+    using value_type = T;
+
     SPSCQueue() noexcept = default;
 
     // Non-copyable, non-movable
@@ -127,6 +159,91 @@ public:
         return true;
     }
 
+    /// Reserve the next slot for writing in place (producer only)
+    /// Serialize directly into *claim, then commit(); nothing is copied.
+    /// @return The claimed slot, empty if the queue is full
+    [[nodiscard]] SlotClaim<T> try_claim() noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t next_head = (head + 1) & mask_;
+
+        if (next_head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (next_head == cached_tail_) {
+                return {};
+            }
+        }
+        return {&buffer_[head], head};
+    }
+
+    /// Claim with spin wait (blocks until a slot is free)
+    [[nodiscard]] SlotClaim<T> claim() noexcept {
+        SlotClaim<T> claimed;
+        while (!(claimed = try_claim())) {
+            #if defined(__x86_64__) || defined(_M_X64)
+            asm volatile("pause" ::: "memory");
+            #endif
+        }
+        return claimed;
+    }
+
+    /// Make a claimed slot visible to the consumer
+    void commit(const SlotClaim<T>& claimed) noexcept {
+        head_.store((claimed.position + 1) & mask_, std::memory_order_release);
+    }
+
+    // ========================================================================
+    // Batch Producer Interface (single thread only)
+    // ========================================================================
+
+    /// Reserve n contiguous slots (all or nothing, producer only)
+    /// Fill them through slot() and hand them over with one publish(),
+    /// instead of one head_ release store per element.
+    /// @return The claimed range, empty if fewer than n slots are free
+    [[nodiscard]] ClaimedRange try_claim(size_t n) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (n == 0 || n > capacity()) {
+            return {};
+        }
+
+        if (free_slots(head, cached_tail_) < n) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (free_slots(head, cached_tail_) < n) {
+                return {};
+            }
+        }
+        return {head, n};
+    }
+
+    /// Slot i of a claimed range
+    [[nodiscard]] T& slot(const ClaimedRange& range, size_t i) noexcept {
+        return buffer_[(range.first + i) & mask_];
+    }
+
+    /// Make every slot of a claimed range visible to the consumer
+    void publish(const ClaimedRange& range) noexcept {
+        head_.store((range.first + range.count) & mask_, std::memory_order_release);
+    }
+
+    /// Push as many items as fit with a single publish
+    /// @return Number of items pushed (prefix of items)
+    [[nodiscard]] size_t try_push_batch(std::span<const T> items) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t n = std::min(items.size(), free_slots(head, cached_tail_));
+        if (n < items.size()) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            n = std::min(items.size(), free_slots(head, cached_tail_));
+        }
+        if (n == 0) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            buffer_[(head + i) & mask_] = items[i];
+        }
+        head_.store((head + n) & mask_, std::memory_order_release);
+        return n;
+    }
+
     // ========================================================================
     // Consumer Interface (single thread only)
     // ========================================================================
@@ -185,6 +302,41 @@ public:
         return item;
     }
 
+    /// Hand the front element to fn in place, then release its slot
+    /// @param fn Called as fn(T&) while the element is still in the ring
+    /// @return true if an element was consumed, false if queue is empty
+    template<typename Fn>
+    bool try_consume(Fn&& fn) noexcept(noexcept(fn(std::declval<T&>()))) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return false;
+            }
+        }
+
+        fn(buffer_[tail]);
+        tail_.store((tail + 1) & mask_, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop everything available, up to out.size(), with one tail_ store
+    /// @return Number of elements written to the front of out
+    [[nodiscard]] size_t drain(std::span<T> out) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        cached_head_ = head_.load(std::memory_order_acquire);
+
+        const size_t n = std::min(out.size(), (cached_head_ - tail) & mask_);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = std::move(buffer_[(tail + i) & mask_]);
+        }
+        if (n != 0) {
+            tail_.store((tail + n) & mask_, std::memory_order_release);
+        }
+        return n;
+    }
+
     /// Peek at the front element without removing it
     [[nodiscard]] const T* front() const noexcept {
         const size_t tail = tail_.load(std::memory_order_relaxed);
@@ -229,6 +381,11 @@ public:
 private:
     static constexpr size_t mask_ = Capacity - 1;
 
+    /// Free slots between head and a (possibly stale) view of tail
+    [[nodiscard]] static constexpr size_t free_slots(size_t head, size_t tail) noexcept {
+        return capacity() - ((head - tail) & mask_);
+    }
+
     // Cache line padded to avoid false sharing
     alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
     alignas(CACHE_LINE_SIZE) size_t cached_tail_{0};  // Producer's cached view of tail
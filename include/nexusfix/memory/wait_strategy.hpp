@@ -10,10 +10,15 @@
     | YieldingWait  | Low      | High      | Active trading          |
     | SleepingWait  | Medium   | Low       | Background processing   |
     | BackoffWait   | Adaptive | Variable  | General purpose         |
+    | AdaptiveWait  | Learned  | Variable  | Bursty feeds            |
+
+    AdaptiveWait picks its phase from how long recent waits on the same
+    thread lasted (rdtsc), instead of from fixed iteration counts.
 */
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <thread>
@@ -23,6 +28,20 @@
 #include <immintrin.h>
 #endif
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define NFX_WAIT_HAS_WAITPKG 1
+#else
+#define NFX_WAIT_HAS_WAITPKG 0
+#endif
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#endif
+
 namespace nfx::memory {
 
 // ============================================================================
@@ -204,6 +223,209 @@ struct BackoffWait {
     }
 };
 
+// ============================================================================
+// Adaptive Wait Strategy
+// ============================================================================
+
+namespace detail {
+
+/// Cycle counter for wait timing (steady_clock nanoseconds off x86)
+[[nodiscard]] inline uint64_t wait_ticks() noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// True if the CPU implements WAITPKG (TPAUSE / UMONITOR / UMWAIT)
+[[nodiscard]] inline bool cpu_has_waitpkg() noexcept {
+#if NFX_WAIT_HAS_WAITPKG
+    static const bool supported = [] {
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+        return (ecx & (1u << 5)) != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+#if NFX_WAIT_HAS_WAITPKG
+/// Light sleep (C0.1) until deadline TSC, or until addr is written if given
+__attribute__((target("waitpkg")))
+inline void waitpkg_pause(const volatile void* addr, uint64_t deadline) noexcept {
+    if (addr) {
+        _umonitor(const_cast<void*>(addr));
+        _umwait(1, deadline);
+    } else {
+        _tpause(1, deadline);
+    }
+}
+#endif
+
+/// Sleep on word while it equals expected, at most timeout_us (Linux futex)
+/// @param shared word lives in memory mapped by several processes
+inline void futex_park(const uint32_t* word, uint32_t expected, uint32_t timeout_us,
+                       bool shared = false) noexcept {
+#if defined(__linux__)
+    struct timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout_us / 1'000'000);
+    ts.tv_nsec = static_cast<long>(timeout_us % 1'000'000) * 1000;
+    ::syscall(SYS_futex, word, shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+#else
+    (void)word;
+    (void)expected;
+    (void)shared;
+    std::this_thread::sleep_for(std::chrono::microseconds(timeout_us));
+#endif
+}
+
+/// Wake one thread parked on word (no-op off Linux: parks are timed)
+inline void futex_wake(uint32_t* word, bool shared = false) noexcept {
+#if defined(__linux__)
+    ::syscall(SYS_futex, word, shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+    (void)word;
+    (void)shared;
+#endif
+}
+
+} // namespace detail
+
+/// Adaptive strategy driven by measured wait durations
+///
+/// Each thread keeps an EWMA of how long its recent waits lasted (the
+/// inter-arrival gap seen by a caught-up consumer). A wait episode then
+/// goes through up to three phases:
+/// - Spin: pause loop, for up to SpinCycles when arrivals are expected
+///   soon, only SpinCycles/8 when the feed has been quiet
+/// - Pause: TPAUSE light sleep (UMONITOR/UMWAIT on the watched sequence
+///   in wait_for_sequence) where WAITPKG exists, yield otherwise
+/// - Park: timed futex sleep with exponential backoff to MaxParkMicroseconds
+///
+/// reset() marks an arrival and feeds the estimate; counters() reports
+/// which phases the calling thread has used.
+/// @tparam SpinCycles Spin budget in TSC cycles
+/// @tparam ParkCycles Wait length after which the thread parks
+/// @tparam MaxParkMicroseconds Longest single park
+template<uint64_t SpinCycles = 20'000,
+         uint64_t ParkCycles = 2'000'000,
+         uint32_t MaxParkMicroseconds = 1000>
+struct AdaptiveWait {
+    static_assert(SpinCycles < ParkCycles, "Spin phase must end before parking");
+
+    static constexpr const char* name() noexcept { return "AdaptiveWait"; }
+
+    /// Phase a wait iteration ran in
+    enum class Mode : uint8_t { Spin, Pause, Park };
+
+    /// Per-thread observability counters
+    struct Counters {
+        uint64_t spins{0};          // Spin iterations
+        uint64_t pauses{0};         // TPAUSE / UMWAIT / yield iterations
+        uint64_t parks{0};          // Futex sleeps
+        uint64_t arrivals{0};       // reset() calls
+        uint64_t avg_wait_cycles{0};  // EWMA of wait durations (1/8 weight)
+        Mode last_mode{Mode::Spin};
+    };
+
+    /// One wait episode (from the first empty poll to reset())
+    struct State {
+        uint64_t start{0};
+        uint32_t park_us{1};
+        uint32_t park_word{0};
+    };
+
+    /// Calling thread's counters and inter-arrival estimate
+    [[nodiscard]] static Counters& counters() noexcept {
+        thread_local Counters c{};
+        return c;
+    }
+
+    /// Single wait iteration with state tracking
+    static void wait(State& state) noexcept {
+        wait_on(state, nullptr);
+    }
+
+    /// Record an arrival: learn the episode length and start a new episode
+    static void reset(State& state) noexcept {
+        Counters& c = counters();
+        const uint64_t waited = state.start != 0 ? detail::wait_ticks() - state.start : 0;
+        c.avg_wait_cycles = c.arrivals == 0
+            ? waited
+            : c.avg_wait_cycles - c.avg_wait_cycles / 8 + waited / 8;
+        ++c.arrivals;
+        state = State{};
+    }
+
+    /// Stateless wait (spin phase only)
+    static void wait() noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    template<typename Predicate>
+    static void wait_until(Predicate&& pred) noexcept {
+        State state{};
+        while (!pred()) {
+            wait(state);
+        }
+        reset(state);
+    }
+
+    static void wait_for_sequence(
+        const std::atomic<size_t>& sequence,
+        size_t target) noexcept
+    {
+        State state{};
+        while (sequence.load(std::memory_order_acquire) < target) {
+            wait_on(state, &sequence);
+        }
+        reset(state);
+    }
+
+private:
+    static constexpr uint64_t PAUSE_SLICE_CYCLES = 10'000;
+
+    static void wait_on(State& state, const volatile void* watch) noexcept {
+        Counters& c = counters();
+        const uint64_t now = detail::wait_ticks();
+        if (state.start == 0) state.start = now;
+        const uint64_t elapsed = now - state.start;
+
+        // Quiet feed: don't burn the full spin budget on every wait
+        const uint64_t spin_limit = c.avg_wait_cycles <= SpinCycles ? SpinCycles : SpinCycles / 8;
+
+        if (elapsed < spin_limit) {
+            ++c.spins;
+            c.last_mode = Mode::Spin;
+            wait();
+        } else if (elapsed < ParkCycles) {
+            ++c.pauses;
+            c.last_mode = Mode::Pause;
+#if NFX_WAIT_HAS_WAITPKG
+            if (detail::cpu_has_waitpkg()) {
+                detail::waitpkg_pause(watch, now + PAUSE_SLICE_CYCLES);
+                return;
+            }
+#endif
+            (void)watch;
+            std::this_thread::yield();
+        } else {
+            ++c.parks;
+            c.last_mode = Mode::Park;
+            detail::futex_park(&state.park_word, state.park_word, state.park_us);
+            state.park_us = std::min(state.park_us * 2, MaxParkMicroseconds);
+        }
+    }
+};
+
 // ============================================================================
 // Wait Strategy Concept
 // ============================================================================
@@ -220,5 +442,6 @@ static_assert(WaitStrategy<BusySpinWait>);
 static_assert(WaitStrategy<YieldingWait>);
 static_assert(WaitStrategy<SleepingWait<>>);
 static_assert(WaitStrategy<BackoffWait<>>);
+static_assert(WaitStrategy<AdaptiveWait<>>);
 
 } // namespace nfx::memory
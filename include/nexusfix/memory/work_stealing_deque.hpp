@@ -0,0 +1,179 @@
+/*
+    NexusFIX Work-Stealing Deque
+
+    Bounded Chase-Lev deque (Le, Pop, Cohen, Zappa Nardelli, "Correct and
+    Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+
+    Design:
+    - One owner pushes and pops at the bottom (LIFO, no atomic RMW unless
+      racing a thief for the last element)
+    - Any thread steals from the top (FIFO, one CAS)
+    - Fixed power-of-two capacity: push fails instead of growing, so the
+      owner never allocates
+
+    Elements are copied out before the stealing CAS; a thief that loses
+    the race discards its copy. T must therefore be trivially copyable.
+    Lock-free sized elements (pointers, indexes) are accessed as relaxed
+    atomics as in the paper; a larger T's discarded copy may overlap the
+    owner refilling that slot, which is harmless but visible to TSan.
+
+    Usage:
+        WorkStealingDeque<Job, 4096> deque;
+        deque.push(job);                 // Owner
+        Job job;
+        if (deque.pop(job)) run(job);    // Owner, newest first
+        if (deque.steal(job)) run(job);  // Any other thread, oldest first
+*/
+
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "spsc_queue.hpp"  // CACHE_LINE_SIZE
+
+namespace nfx::memory {
+
+// ============================================================================
+// Work-Stealing Deque
+// ============================================================================
+
+/// Bounded single-owner, multi-thief deque
+/// @tparam T Element type (trivially copyable)
+/// @tparam Capacity Must be power of 2
+template<typename T, size_t Capacity>
+class WorkStealingDeque {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
+    static_assert(std::is_trivially_copyable_v<T>, "Thieves copy elements before claiming them");
+
+public:
+    using value_type = T;
+
+    WorkStealingDeque() noexcept = default;
+
+    // Non-copyable, non-movable
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    // ========================================================================
+    // Owner Interface (single thread only)
+    // ========================================================================
+
+    /// Push at the bottom (owner only)
+    /// @return false if the deque is full
+    [[nodiscard]] bool push(const T& item) noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(Capacity)) {
+            return false;
+        }
+
+        store_slot(static_cast<size_t>(bottom), item);
+        bottom_.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop the newest element (owner only)
+    /// @return false if empty or a thief took the last element
+    [[nodiscard]] bool pop(T& item) noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);  // Was empty
+            return false;
+        }
+
+        item = load_slot(static_cast<size_t>(bottom));
+        if (top != bottom) {
+            return true;  // More than one left: no thief can reach this one
+        }
+
+        // Last element: race the thieves for it
+        const bool won = top_.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    /// True if the owner cannot push (owner only; thieves only shrink it)
+    [[nodiscard]] bool full() const noexcept {
+        return bottom_.load(std::memory_order_relaxed) - top_.load(std::memory_order_acquire) >=
+               static_cast<int64_t>(Capacity);
+    }
+
+    // ========================================================================
+    // Thief Interface (any thread)
+    // ========================================================================
+
+    /// Steal the oldest element
+    /// @return false if empty or another thread won the element
+    [[nodiscard]] bool steal(T& item) noexcept {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        item = load_slot(static_cast<size_t>(top));
+        return top_.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_approx() == 0;
+    }
+
+    [[nodiscard]] size_t size_approx() const noexcept {
+        const int64_t size = bottom_.load(std::memory_order_relaxed) -
+                             top_.load(std::memory_order_relaxed);
+        return size > 0 ? static_cast<size_t>(size) : 0;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept {
+        return Capacity;
+    }
+
+private:
+    static constexpr size_t mask_ = Capacity - 1;
+    static constexpr bool ATOMIC_SLOTS = std::atomic_ref<T>::is_always_lock_free;
+
+    /// Element aligned for atomic_ref (an 8-byte struct of two uint32_t)
+    struct Slot {
+        alignas(ATOMIC_SLOTS ? std::atomic_ref<T>::required_alignment : alignof(T)) T value;
+    };
+
+    void store_slot(size_t position, const T& item) noexcept {
+        if constexpr (ATOMIC_SLOTS) {
+            std::atomic_ref<T>{buffer_[position & mask_].value}.store(item, std::memory_order_relaxed);
+        } else {
+            buffer_[position & mask_].value = item;
+        }
+    }
+
+    [[nodiscard]] T load_slot(size_t position) noexcept {
+        if constexpr (ATOMIC_SLOTS) {
+            return std::atomic_ref<T>{buffer_[position & mask_].value}.load(std::memory_order_relaxed);
+        } else {
+            return buffer_[position & mask_].value;
+        }
+    }
+
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top_{0};      // Thieves
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom_{0};   // Owner
+    alignas(CACHE_LINE_SIZE) std::array<Slot, Capacity> buffer_{};
+};
+
+} // namespace nfx::memory
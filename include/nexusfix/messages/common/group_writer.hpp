@@ -0,0 +1,245 @@
+/*
+    NexusFIX Repeating Group Writer
+
+    Typed, allocation-free serialization of repeating groups (NoPartyIDs,
+    NoLegs, ...) into MessageAssembler or FastMessageBuilder:
+
+        auto parties = asm_.group<groups::Parties>();     // "453=0|"
+        parties.entry("BROKER1")                          // 448 (delimiter)
+            .field<tag::PartyIDSource::value>('D')
+            .field<tag::PartyRole::value>(1);
+        parties.entry("TRADER7").field<tag::PartyRole::value>(11);
+        parties.close();                                  // "453=2|"
+
+    A GroupDef lists the count tag and the entry tags in wire order, the
+    first entry tag being the delimiter. entry() writes the delimiter, and
+    each field<Tag>() is checked at compile time: Tag must belong to the
+    group and come after the fields already written in that entry.
+    Optional fields may be skipped.
+
+    The count is a one-digit placeholder back-patched by close(): no
+    entries remove the count field (FIX omits empty groups), ten or more
+    move the entries right by the extra digits. Groups with fewer than ten
+    entries are written exactly once.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Group Definition
+// ============================================================================
+
+/// Compile-time repeating group layout
+/// @tparam CountTag NumInGroup field (453, 555, ...)
+/// @tparam EntryTags Entry fields in wire order; the first is the delimiter
+template <int CountTag, int... EntryTags>
+struct GroupDef {
+    static_assert(sizeof...(EntryTags) > 0, "A group needs at least its delimiter field");
+
+    static constexpr int count_tag = CountTag;
+    static constexpr std::array<int, sizeof...(EntryTags)> tags{EntryTags...};
+    static constexpr int delimiter = tags[0];
+    static constexpr size_t NOT_IN_GROUP = sizeof...(EntryTags);
+
+    /// Index of tag in the entry layout, NOT_IN_GROUP if absent
+    [[nodiscard]] static consteval size_t position(int tag) noexcept {
+        for (size_t i = 0; i < tags.size(); ++i) {
+            if (tags[i] == tag) return i;
+        }
+        return NOT_IN_GROUP;
+    }
+
+private:
+    [[nodiscard]] static consteval bool valid_layout() noexcept {
+        for (size_t i = 0; i < tags.size(); ++i) {
+            if (tags[i] <= 0 || tags[i] == CountTag) return false;
+            for (size_t j = i + 1; j < tags.size(); ++j) {
+                if (tags[i] == tags[j]) return false;
+            }
+        }
+        return CountTag > 0;
+    }
+    static_assert(valid_layout(), "Group tags must be positive, unique and differ from the count tag");
+};
+
+// ============================================================================
+// Common Groups
+// ============================================================================
+
+namespace groups {
+
+using Parties = GroupDef<tag::NoPartyIDs::value,
+                         tag::PartyID::value, tag::PartyIDSource::value, tag::PartyRole::value>;
+
+using Legs = GroupDef<tag::NoLegs::value,
+                      tag::LegSymbol::value, tag::LegSide::value,
+                      tag::LegRatioQty::value, tag::LegPrice::value>;
+
+using MDEntryTypes = GroupDef<tag::NoMDEntryTypes::value, tag::MDEntryType::value>;
+
+using RelatedSym = GroupDef<tag::NoRelatedSym::value, tag::Symbol::value>;
+
+}  // namespace groups
+
+namespace detail {
+
+// ============================================================================
+// Builder Adapters
+// ============================================================================
+
+/// Append one field through whichever interface the builder has:
+/// field<Tag>(v) (FastMessageBuilder) or field(tag, v) (MessageAssembler)
+template <int Tag, typename Builder, typename V>
+void write_group_field(Builder& builder, const V& value) noexcept {
+    if constexpr (std::is_convertible_v<const V&, std::string_view>) {
+        const std::string_view text{value};
+        if constexpr (requires { builder.template field<Tag>(text); }) {
+            builder.template field<Tag>(text);
+        } else {
+            builder.field(Tag, text);
+        }
+    } else if constexpr (std::is_same_v<V, bool>) {
+        write_group_field<Tag>(builder, value ? 'Y' : 'N');
+    } else if constexpr (std::is_enum_v<V>) {
+        if constexpr (std::is_same_v<std::underlying_type_t<V>, char>) {
+            write_group_field<Tag>(builder, static_cast<char>(std::to_underlying(value)));
+        } else {
+            write_group_field<Tag>(builder, static_cast<int64_t>(std::to_underlying(value)));
+        }
+    } else if constexpr (std::is_integral_v<V> && !std::is_same_v<V, char>) {
+        if constexpr (requires { builder.template field<Tag>(uint32_t{}); }) {
+            builder.template field<Tag>(static_cast<uint32_t>(value));
+        } else {
+            builder.field(Tag, static_cast<int64_t>(value));
+        }
+    } else if constexpr (requires { builder.template field<Tag>(value); }) {
+        builder.template field<Tag>(value);
+    } else {
+        builder.field(Tag, value);
+    }
+}
+
+[[nodiscard]] consteval size_t tag_digits(int tag) noexcept {
+    size_t n = 1;
+    while (tag >= 10) {
+        tag /= 10;
+        ++n;
+    }
+    return n;
+}
+
+/// Back-patch the one-digit count placeholder at buf[at] (at >= capacity
+/// when the builder had no room for it); count 0 removes "<count_tag>=0|" (nothing may follow it yet); a
+/// multi-digit count moves the entries right, truncating at capacity.
+inline void patch_group_count(char* buf, size_t& pos, size_t capacity, size_t at,
+                              size_t count_tag_digits, size_t count) noexcept {
+    if (at >= capacity) [[unlikely]] return;  // Placeholder did not fit
+    if (count == 0) {
+        pos = at - count_tag_digits - 1;
+        return;
+    }
+    char digits[20];
+    size_t n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + count % 10);
+        count /= 10;
+    } while (count != 0);
+
+    size_t fit = n;
+    if (n > 1) [[unlikely]] {
+        const size_t end = pos + n - 1 < capacity ? pos + n - 1 : capacity;
+        if (at + n < end) {
+            std::memmove(buf + at + n, buf + at + 1, end - at - n);
+        }
+        pos = end;
+        if (at + n > capacity) fit = capacity - at;
+    }
+    for (size_t i = 0; i < fit; ++i) {
+        buf[at + i] = digits[n - 1 - i];
+    }
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Group Writer
+// ============================================================================
+
+/// Fields of one group entry; Next is the first layout index still allowed
+template <typename Def, typename Builder, size_t Next>
+class GroupEntryWriter {
+public:
+    explicit GroupEntryWriter(Builder* builder) noexcept : builder_{builder} {}
+
+    /// Append field Tag of this entry
+    template <int Tag, typename V>
+    GroupEntryWriter<Def, Builder, Def::position(Tag) + 1> field(const V& value) noexcept {
+        static_assert(Def::position(Tag) != Def::NOT_IN_GROUP, "Tag is not a field of this group");
+        static_assert(Def::position(Tag) >= Next,
+                      "Group fields must follow the definition order; the delimiter starts an entry");
+        if (builder_) detail::write_group_field<Tag>(*builder_, value);
+        return GroupEntryWriter<Def, Builder, Def::position(Tag) + 1>{builder_};
+    }
+
+private:
+    Builder* builder_;  // nullptr: entry refused
+};
+
+/// Open repeating group on a builder; close() before the next non-group field
+/// @tparam Def GroupDef
+/// @tparam Builder MessageAssembler or FastMessageBuilder
+template <typename Def, typename Builder>
+class GroupWriter {
+public:
+    explicit GroupWriter(Builder& builder) noexcept
+        : builder_{builder}
+        , count_at_{builder.open_group(Def::count_tag)} {}
+
+    ~GroupWriter() { close(); }
+
+    GroupWriter(const GroupWriter&) = delete;
+    GroupWriter& operator=(const GroupWriter&) = delete;
+
+    /// Start an entry with its delimiter field (nothing once closed)
+    template <typename V>
+    GroupEntryWriter<Def, Builder, 1> entry(const V& delimiter_value) noexcept {
+        if (closed_) [[unlikely]] {
+            return GroupEntryWriter<Def, Builder, 1>{nullptr};
+        }
+        ++count_;
+        detail::write_group_field<Def::delimiter>(builder_, delimiter_value);
+        return GroupEntryWriter<Def, Builder, 1>{&builder_};
+    }
+
+    /// Back-patch the count (once; later calls do nothing)
+    /// @return The builder, to continue the message
+    Builder& close() noexcept {
+        if (!closed_) {
+            builder_.close_group(count_at_, detail::tag_digits(Def::count_tag), count_);
+            closed_ = true;
+        }
+        return builder_;
+    }
+
+    [[nodiscard]] size_t count() const noexcept { return count_; }
+
+private:
+    Builder& builder_;
+    size_t count_at_;
+    size_t count_{0};
+    bool closed_{false};
+};
+
+}  // namespace nfx
@@ -1,13 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <span>
 #include <array>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <string_view>
 
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/error.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/util/allocation_tracker.hpp"
+#include "nexusfix/serializer/checked_copy.hpp"
+#include "nexusfix/serializer/decimal_serializer.hpp"
+#include "nexusfix/messages/common/group_writer.hpp"
 
 namespace nfx {
 
@@ -15,6 +22,9 @@ namespace nfx {
 // FIX Message Trailer
 // ============================================================================
 
+/// Bytes in a serialized trailer: "10=XXX\x01"
+inline constexpr size_t TRAILER_SIZE = 7;
+
 /// FIX trailer with checksum calculation
 struct FixTrailer {
     std::array<char, 3> check_sum;  // Tag 10 - 3 digit checksum
@@ -48,8 +58,6 @@ struct FixTrailer {
 /// Builder for constructing FIX message trailers
 class TrailerBuilder {
 public:
-    static constexpr size_t TRAILER_SIZE = 7;  // "10=XXX\x01"
-
     constexpr TrailerBuilder() noexcept : buffer_{} {}
 
     /// Build trailer from message body (calculates checksum)
@@ -158,15 +166,165 @@ namespace checksum {
 // ============================================================================
 
 /// Assembles complete FIX message with header, body, and trailer
+/// Builds into an internal buffer, or into a caller-provided destination
+/// (e.g. a registered io_uring slot) selected with into().
+///
+/// By default start() writes a zero-padded "9=000000" placeholder that
+/// finish() overwrites in place. With set_header_backfill(true) the body
+/// is serialized first behind HEADER_HEADROOM reserved bytes, and finish()
+/// writes "8=...|9=N|" right-aligned against it: the BodyLength has no
+/// padding, nothing is moved, and the returned span starts inside the
+/// buffer at the first byte of the header.
+///
+/// set_session_header() renders the session-constant bytes once:
+/// "8=<BeginString>|" and "49=<Sender>|56=<Target>|" together with their
+/// checksum contributions. start() and comp_ids() then copy them with one
+/// memcpy each, and finish() sums only the bytes around them.
+///
+/// set_value_validation(true) copies every field value with SIMD loads
+/// that also test it for SOH and '=' (serializer/checked_copy.hpp);
+/// invalid_field() then names the first offending tag of the message.
 class MessageAssembler {
 public:
     static constexpr size_t MAX_MESSAGE_SIZE = 4096;
+    /// Bytes reserved before the body in backfill mode: "8=" BeginString
+    /// SOH "9=" up to 10 digits SOH, for BeginStrings of up to
+    /// MAX_BACKFILL_BEGIN_STRING characters (longer ones use the placeholder)
+    static constexpr size_t HEADER_HEADROOM = 32;
+    static constexpr size_t MAX_BACKFILL_BEGIN_STRING = HEADER_HEADROOM - 16;
+    /// Longest "49=..|56=..|" that set_session_header() can cache
+    static constexpr size_t MAX_COMP_IDS_SIZE = 128;
 
     constexpr MessageAssembler() noexcept : buffer_{}, pos_{0} {}
 
+    /// Serialize the next message (up to its finish()) into dest
+    /// Lets builders write straight into the buffer handed to the
+    /// transport, avoiding a copy. dest must outlive the returned span;
+    /// output is truncated at dest.size().
+    MessageAssembler& into(std::span<char> dest) noexcept {
+        next_out_ = dest.data();
+        next_capacity_ = dest.size();
+        return *this;
+    }
+
+    /// Serialize the body first and back-fill BeginString and BodyLength
+    /// in finish() (applies from the next start())
+    MessageAssembler& set_header_backfill(bool enabled) noexcept {
+        backfill_ = enabled;
+        return *this;
+    }
+
+    [[nodiscard]] bool header_backfill() const noexcept { return backfill_; }
+
+    /// Check field values for SOH and '=' while copying them
+    MessageAssembler& set_value_validation(bool enabled) noexcept {
+        validate_values_ = enabled;
+        return *this;
+    }
+
+    [[nodiscard]] bool value_validation() const noexcept { return validate_values_; }
+
+    /// Tag of the first value holding SOH or '=' since start() (0 = none)
+    /// Only tracked with set_value_validation(true); the message is still
+    /// written and must not be sent.
+    [[nodiscard]] int invalid_field() const noexcept { return invalid_field_; }
+
+    /// Render "8=<begin_string>|" and "49=<sender>|56=<target>|" once, with
+    /// their checksum contributions, for start() and comp_ids() to copy
+    /// @return false (and nothing cached) if the fields do not fit
+    bool set_session_header(std::string_view begin_string, std::string_view sender,
+                            std::string_view target) noexcept {
+        clear_session_header();
+        const size_t comp_ids_size = 3 + sender.size() + 1 + 3 + target.size() + 1;
+        if (begin_string.empty() || begin_string.size() > MAX_BACKFILL_BEGIN_STRING ||
+            comp_ids_size > MAX_COMP_IDS_SIZE) {
+            return false;
+        }
+
+        // "8=<begin_string>|9=000000|": the placeholder rides along in
+        // the same memcpy but is summed after finish() patches it
+        size_t n = 0;
+        auto put = [](char* dst, size_t& at, std::string_view sv) noexcept {
+            std::memcpy(dst + at, sv.data(), sv.size());
+            at += sv.size();
+        };
+        put(prefix_.data(), n, "8=");
+        put(prefix_.data(), n, begin_string);
+        prefix_[n++] = fix::SOH;
+        prefix_size_ = n;
+        prefix_sum_ = fix::calculate_checksum(std::span<const char>{prefix_.data(), n});
+        put(prefix_.data(), n, "9=000000");
+        prefix_[n++] = fix::SOH;
+        prefix_with_length_size_ = n;
+
+        n = 0;
+        put(comp_ids_.data(), n, "49=");
+        put(comp_ids_.data(), n, sender);
+        comp_ids_[n++] = fix::SOH;
+        put(comp_ids_.data(), n, "56=");
+        put(comp_ids_.data(), n, target);
+        comp_ids_[n++] = fix::SOH;
+        comp_ids_size_ = n;
+        comp_ids_sum_ = fix::calculate_checksum(std::span<const char>{comp_ids_.data(), n});
+        sender_size_ = sender.size();
+        return true;
+    }
+
+    void clear_session_header() noexcept {
+        prefix_size_ = 0;
+        comp_ids_size_ = 0;
+    }
+
+    [[nodiscard]] bool has_session_header() const noexcept { return comp_ids_size_ != 0; }
+
+    /// Append SenderCompID (49) and TargetCompID (56): one memcpy of the
+    /// cached blob when they match set_session_header()
+    MessageAssembler& comp_ids(std::string_view sender, std::string_view target) noexcept {
+        if (comp_ids_size_ != 0 && pos_ + comp_ids_size_ <= capacity_ &&
+            sender == std::string_view{comp_ids_.data() + 3, sender_size_} &&
+            target == std::string_view{comp_ids_.data() + 3 + sender_size_ + 4,
+                                       comp_ids_size_ - sender_size_ - 8}) {
+            std::memcpy(out_ + pos_, comp_ids_.data(), comp_ids_size_);
+            comp_ids_at_ = pos_;
+            pos_ += comp_ids_size_;
+            return *this;
+        }
+        append_field(tag::SenderCompID::value, sender);
+        append_field(tag::TargetCompID::value, target);
+        return *this;
+    }
+
     /// Start building a new message
     MessageAssembler& start(std::string_view begin_string = fix::FIX_4_4) noexcept {
+        if (next_out_) {
+            out_ = next_out_;
+            capacity_ = next_capacity_;
+            next_out_ = nullptr;
+        } else {
+            out_ = buffer_.data();
+            capacity_ = MAX_MESSAGE_SIZE;
+        }
         pos_ = 0;
+        begin_string_ = {};
+        comp_ids_at_ = NO_CACHED_BYTES;
+        invalid_field_ = 0;
+        prefix_cached_ = prefix_size_ != 0 &&
+            begin_string == std::string_view{prefix_.data() + 2, prefix_size_ - 3};
+        if (backfill_ && begin_string.size() <= MAX_BACKFILL_BEGIN_STRING &&
+            capacity_ > HEADER_HEADROOM) {
+            begin_string_ = begin_string;
+            pos_ = HEADER_HEADROOM;
+            body_start_ = pos_;
+            return *this;
+        }
+        if (prefix_cached_ && capacity_ >= prefix_with_length_size_) {
+            std::memcpy(out_, prefix_.data(), prefix_with_length_size_);
+            body_length_pos_ = prefix_size_;
+            pos_ = prefix_with_length_size_;
+            body_start_ = pos_;
+            return *this;
+        }
+        prefix_cached_ = false;
         append_field(tag::BeginString::value, begin_string);
         body_length_pos_ = pos_;
         append_raw("9=000000");  // Placeholder
@@ -188,26 +346,9 @@ public:
 
     /// Append integer field
     MessageAssembler& field(int tag_num, int64_t value) noexcept {
-        char buf[32];
-        int len = 0;
-        bool negative = value < 0;
-        if (negative) value = -value;
-
-        do {
-            buf[len++] = '0' + (value % 10);
-            value /= 10;
-        } while (value > 0);
-
-        if (negative) buf[len++] = '-';
-
-        // Reverse
-        for (int i = 0; i < len / 2; ++i) {
-            char tmp = buf[i];
-            buf[i] = buf[len - 1 - i];
-            buf[len - 1 - i] = tmp;
-        }
-
-        return field(tag_num, std::string_view{buf, static_cast<size_t>(len)});
+        char buf[serializer::MAX_I64_CHARS];
+        const size_t len = serializer::write_i64(buf, value);
+        return field(tag_num, std::string_view{buf, len});
     }
 
     /// Append char field
@@ -215,40 +356,75 @@ public:
         return field(tag_num, std::string_view{&value, 1});
     }
 
-    /// Append price field
+    /// Append price field (exact decimal, trailing zeros trimmed)
     MessageAssembler& field(int tag_num, FixedPrice price) noexcept {
-        // Format price to string
-        char buf[32];
-        double d = price.to_double();
-        int len = std::snprintf(buf, sizeof(buf), "%.8g", d);
-        return field(tag_num, std::string_view{buf, static_cast<size_t>(len)});
+        char buf[serializer::MAX_DECIMAL_CHARS];
+        const size_t len = serializer::write_decimal<FixedPrice::DECIMAL_PLACES>(buf, price.raw);
+        return field(tag_num, std::string_view{buf, len});
+    }
+
+    /// Append quantity field (exact decimal, trailing zeros trimmed)
+    MessageAssembler& field(int tag_num, Qty qty) noexcept {
+        char buf[serializer::MAX_DECIMAL_CHARS];
+        const size_t len = serializer::write_decimal<Qty::DECIMAL_PLACES>(buf, qty.raw);
+        return field(tag_num, std::string_view{buf, len});
+    }
+
+    /// Open a repeating group (see group_writer.hpp); close it before
+    /// the next field outside the group
+    template <typename Def>
+    [[nodiscard]] GroupWriter<Def, MessageAssembler> group() noexcept {
+        return GroupWriter<Def, MessageAssembler>{*this};
+    }
+
+    /// Write "<count_tag>=0|" for a GroupWriter
+    /// @return Position of the count placeholder digit, capacity if full
+    size_t open_group(int count_tag) noexcept {
+        size_t need = 3;  // "=0|"
+        for (int t = count_tag; t > 0; t /= 10) ++need;
+        if (capacity_ - pos_ < need) {
+            pos_ = capacity_;
+            return capacity_;
+        }
+        append_field(count_tag, "0");
+        return pos_ - 2;
+    }
+
+    /// Back-patch the count written by open_group()
+    void close_group(size_t count_at, size_t count_tag_digits, size_t count) noexcept {
+        detail::patch_group_count(out_, pos_, capacity_, count_at, count_tag_digits, count);
     }
 
     /// Finalize message (updates body length and adds checksum)
     [[nodiscard]] std::span<const char> finish() noexcept {
+        if (!begin_string_.empty()) {
+            return finish_backfill();
+        }
+
         // Calculate body length (from after 9=XXXXXX\x01 to before 10=)
         size_t body_length = pos_ - body_start_;
 
         // Update body length field
         size_t len_pos = body_length_pos_ + 2;  // After "9="
         for (int i = 5; i >= 0; --i) {
-            buffer_[len_pos + i] = '0' + (body_length % 10);
+            out_[len_pos + i] = '0' + (body_length % 10);
             body_length /= 10;
         }
 
         // Calculate checksum (everything before trailer)
-        uint8_t checksum = fix::calculate_checksum(
-            std::span<const char>{buffer_.data(), pos_});
+        uint8_t checksum = checksum_from(0);
 
         // Append trailer
         append_field(tag::CheckSum::value, checksum::format(checksum));
 
-        return std::span<const char>{buffer_.data(), pos_};
+        return std::span<const char>{out_, pos_};
     }
 
-    /// Get current message content (before finish)
+    /// Get current message content (before finish; the body only while
+    /// the header is still to be back-filled)
     [[nodiscard]] std::span<const char> data() const noexcept {
-        return std::span<const char>{buffer_.data(), pos_};
+        const size_t first = begin_string_.empty() ? 0 : body_start_;
+        return std::span<const char>{out_ + first, pos_ - first};
     }
 
     /// Reset for new message
@@ -256,20 +432,71 @@ public:
         pos_ = 0;
         body_length_pos_ = 0;
         body_start_ = 0;
+        begin_string_ = {};
+        comp_ids_at_ = NO_CACHED_BYTES;
+        prefix_cached_ = false;
+        invalid_field_ = 0;
     }
 
 private:
+    /// Write "8=<BeginString>|9=<BodyLength>|" right to left ending at the
+    /// body, then checksum the final bytes and append the trailer
+    [[nodiscard]] std::span<const char> finish_backfill() noexcept {
+        size_t body_length = pos_ - body_start_;
+        size_t first = body_start_;
+
+        out_[--first] = fix::SOH;
+        do {
+            out_[--first] = static_cast<char>('0' + body_length % 10);
+            body_length /= 10;
+        } while (body_length > 0);
+        out_[--first] = '=';
+        out_[--first] = '9';
+        if (prefix_cached_) {
+            first -= prefix_size_;
+            std::memcpy(out_ + first, prefix_.data(), prefix_size_);
+        } else {
+            out_[--first] = fix::SOH;
+            first -= begin_string_.size();
+            std::memcpy(out_ + first, begin_string_.data(), begin_string_.size());
+            out_[--first] = '=';
+            out_[--first] = '8';
+        }
+        begin_string_ = {};
+
+        append_field(tag::CheckSum::value, checksum::format(checksum_from(first)));
+        return std::span<const char>{out_ + first, pos_ - first};
+    }
+
+    /// Checksum of [first, pos_), taking the cached blobs' contributions
+    /// from set_session_header() instead of summing their bytes again
+    [[nodiscard]] uint8_t checksum_from(size_t first) const noexcept {
+        auto sum = [this](size_t from, size_t to) noexcept {
+            return fix::calculate_checksum(std::span<const char>{out_ + from, to - from});
+        };
+        uint8_t checksum = 0;
+        if (prefix_cached_) {
+            checksum = static_cast<uint8_t>(checksum + prefix_sum_);
+            first += prefix_size_;
+        }
+        if (comp_ids_at_ != NO_CACHED_BYTES) {
+            checksum = static_cast<uint8_t>(checksum + sum(first, comp_ids_at_) + comp_ids_sum_);
+            first = comp_ids_at_ + comp_ids_size_;
+        }
+        return static_cast<uint8_t>(checksum + sum(first, pos_));
+    }
+
     void append_raw(std::string_view sv) noexcept {
         for (char c : sv) {
-            if (pos_ < MAX_MESSAGE_SIZE) {
-                buffer_[pos_++] = c;
+            if (pos_ < capacity_) {
+                out_[pos_++] = c;
             }
         }
     }
 
     void append_soh() noexcept {
-        if (pos_ < MAX_MESSAGE_SIZE) {
-            buffer_[pos_++] = fix::SOH;
+        if (pos_ < capacity_) {
+            out_[pos_++] = fix::SOH;
         }
     }
 
@@ -283,13 +510,22 @@ private:
         } while (t > 0);
 
         for (int i = tag_len - 1; i >= 0; --i) {
-            if (pos_ < MAX_MESSAGE_SIZE) {
-                buffer_[pos_++] = tag_buf[i];
+            if (pos_ < capacity_) {
+                out_[pos_++] = tag_buf[i];
             }
         }
 
-        if (pos_ < MAX_MESSAGE_SIZE) buffer_[pos_++] = '=';
-        append_raw(value);
+        if (pos_ < capacity_) out_[pos_++] = '=';
+        if (validate_values_) {
+            const size_t n = std::min(value.size(), capacity_ - pos_);
+            if (!serializer::copy_value_checked(out_ + pos_, value.data(), n) &&
+                invalid_field_ == 0) {
+                invalid_field_ = tag;
+            }
+            pos_ += n;
+        } else {
+            append_raw(value);
+        }
         append_soh();
     }
 
@@ -298,9 +534,30 @@ private:
     }
 
     std::array<char, MAX_MESSAGE_SIZE> buffer_;
+    char* out_{nullptr};
+    size_t capacity_{0};
+    char* next_out_{nullptr};
+    size_t next_capacity_{0};
     size_t pos_;
     size_t body_length_pos_{0};
     size_t body_start_{0};
+    std::string_view begin_string_;  // Set while a back-filled header is pending
+    bool backfill_{false};
+    bool validate_values_{false};
+    int invalid_field_{0};           // First tag with SOH or '=' (validate_values_)
+
+    // Session header cache (set_session_header)
+    static constexpr size_t NO_CACHED_BYTES = SIZE_MAX;
+    std::array<char, HEADER_HEADROOM> prefix_{};
+    std::array<char, MAX_COMP_IDS_SIZE> comp_ids_{};
+    size_t prefix_size_{0};             // "8=..|"
+    size_t prefix_with_length_size_{0}; // "8=..|9=000000|"
+    size_t comp_ids_size_{0};
+    size_t sender_size_{0};
+    uint8_t prefix_sum_{0};
+    uint8_t comp_ids_sum_{0};
+    bool prefix_cached_{false};         // This message starts with prefix_
+    size_t comp_ids_at_{NO_CACHED_BYTES};  // Where this message holds comp_ids_
 };
 
 } // namespace nfx
@@ -9,6 +9,7 @@
 #include "nexusfix/types/error.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/schema_parser.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
 
@@ -56,6 +57,33 @@ struct ExecutionReport {
     // Raw buffer reference
     std::span<const char> raw_data;
 
+    /// Tags extracted by from_buffer (required = rejected when absent)
+    using Schema = MessageSchema<
+        FieldSpec<tag::OrderID::value>,
+        FieldSpec<tag::ExecID::value>,
+        FieldSpec<tag::ExecType::value>,
+        FieldSpec<tag::OrdStatus::value>,
+        FieldSpec<tag::Symbol::value>,
+        FieldSpec<tag::Side::value>,
+        FieldSpec<tag::LeavesQty::value, FieldRequirement::Optional>,
+        FieldSpec<tag::CumQty::value, FieldRequirement::Optional>,
+        FieldSpec<tag::AvgPx::value, FieldRequirement::Optional>,
+        FieldSpec<tag::ClOrdID::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::OrigClOrdID::value, FieldRequirement::Conditional>,
+        FieldSpec<19, FieldRequirement::Conditional>,  // ExecRefID
+        FieldSpec<tag::OrderQty::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::OrdType::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Price::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::StopPx::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::TimeInForce::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::LastPx::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::LastQty::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Text::value, FieldRequirement::Optional>,
+        FieldSpec<tag::OrdRejReason::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Account::value, FieldRequirement::Optional>,
+        FieldSpec<tag::TransactTime::value, FieldRequirement::Conditional>
+    >;
+
     constexpr ExecutionReport() noexcept
         : header{}
         , order_id{}
@@ -141,96 +169,64 @@ struct ExecutionReport {
     [[nodiscard]] static ParseResult<ExecutionReport> from_buffer(
         std::span<const char> buffer) noexcept
     {
-        auto parsed = IndexedParser::parse(buffer);
+        auto parsed = parse_as<Schema>(buffer, MSG_TYPE);
         if (!parsed.has_value()) {
             return std::unexpected{parsed.error()};
         }
 
         auto& p = *parsed;
 
-        if (p.msg_type() != MSG_TYPE) {
-            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
-        }
-
         ExecutionReport msg;
         msg.raw_data = buffer;
 
         // Parse header
-        msg.header.begin_string = p.get_string(tag::BeginString::value);
-        if (auto v = p.get_int(tag::BodyLength::value)) {
-            msg.header.body_length = static_cast<int>(*v);
-        }
+        msg.header.begin_string = p.header().begin_string;
+        msg.header.body_length = p.header().body_length;
         msg.header.msg_type = p.msg_type();
         msg.header.sender_comp_id = p.sender_comp_id();
         msg.header.target_comp_id = p.target_comp_id();
         msg.header.msg_seq_num = p.msg_seq_num();
         msg.header.sending_time = p.sending_time();
 
-        // Parse required body fields
-        msg.order_id = p.get_string(tag::OrderID::value);
-        if (msg.order_id.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrderID::value}};
-        }
+        // Required body fields (presence checked by parse_as)
+        msg.order_id = p.get_string<tag::OrderID::value>();
+        msg.exec_id = p.get_string<tag::ExecID::value>();
+        msg.exec_type = static_cast<ExecType>(p.get_char<tag::ExecType::value>());
+        msg.ord_status = static_cast<OrdStatus>(p.get_char<tag::OrdStatus::value>());
+        msg.symbol = p.get_string<tag::Symbol::value>();
+        msg.side = static_cast<Side>(p.get_char<tag::Side::value>());
 
-        msg.exec_id = p.get_string(tag::ExecID::value);
-        if (msg.exec_id.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::ExecID::value}};
-        }
-
-        char exec_type_char = p.get_char(tag::ExecType::value);
-        if (exec_type_char == '\0') {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::ExecType::value}};
-        }
-        msg.exec_type = static_cast<ExecType>(exec_type_char);
-
-        char ord_status_char = p.get_char(tag::OrdStatus::value);
-        if (ord_status_char == '\0') {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrdStatus::value}};
-        }
-        msg.ord_status = static_cast<OrdStatus>(ord_status_char);
-
-        msg.symbol = p.get_string(tag::Symbol::value);
-        if (msg.symbol.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Symbol::value}};
-        }
-
-        char side_char = p.get_char(tag::Side::value);
-        if (side_char == '\0') {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Side::value}};
-        }
-        msg.side = static_cast<Side>(side_char);
-
-        msg.leaves_qty = p.get_field(tag::LeavesQty::value).as_qty();
-        msg.cum_qty = p.get_field(tag::CumQty::value).as_qty();
-        msg.avg_px = p.get_field(tag::AvgPx::value).as_price();
+        msg.leaves_qty = p.get_qty<tag::LeavesQty::value>();
+        msg.cum_qty = p.get_qty<tag::CumQty::value>();
+        msg.avg_px = p.get_price<tag::AvgPx::value>();
 
         // Parse optional/conditional fields
-        msg.cl_ord_id = p.get_string(tag::ClOrdID::value);
-        msg.orig_cl_ord_id = p.get_string(tag::OrigClOrdID::value);
-        msg.exec_ref_id = p.get_string(19);  // ExecRefID
-        msg.order_qty = p.get_field(tag::OrderQty::value).as_qty();
+        msg.cl_ord_id = p.get_string<tag::ClOrdID::value>();
+        msg.orig_cl_ord_id = p.get_string<tag::OrigClOrdID::value>();
+        msg.exec_ref_id = p.get_string<19>();  // ExecRefID
+        msg.order_qty = p.get_qty<tag::OrderQty::value>();
 
-        if (char c = p.get_char(tag::OrdType::value); c != '\0') {
+        if (char c = p.get_char<tag::OrdType::value>(); c != '\0') {
             msg.ord_type = static_cast<OrdType>(c);
         }
 
-        msg.price = p.get_field(tag::Price::value).as_price();
-        msg.stop_px = p.get_field(tag::StopPx::value).as_price();
+        msg.price = p.get_price<tag::Price::value>();
+        msg.stop_px = p.get_price<tag::StopPx::value>();
 
-        if (char c = p.get_char(tag::TimeInForce::value); c != '\0') {
+        if (char c = p.get_char<tag::TimeInForce::value>(); c != '\0') {
             msg.time_in_force = static_cast<TimeInForce>(c);
         }
 
-        msg.last_px = p.get_field(tag::LastPx::value).as_price();
-        msg.last_qty = p.get_field(tag::LastQty::value).as_qty();
-        msg.text = p.get_string(tag::Text::value);
+        msg.last_px = p.get_price<tag::LastPx::value>();
+        msg.last_qty = p.get_qty<tag::LastQty::value>();
+        msg.text = p.get_string<tag::Text::value>();
 
-        if (auto v = p.get_int(tag::OrdRejReason::value)) {
+        if (auto v = p.get_int<tag::OrdRejReason::value>()) {
             msg.ord_rej_reason = static_cast<int>(*v);
         }
 
-        msg.account = p.get_string(tag::Account::value);
-        msg.transact_time = p.get_string(tag::TransactTime::value);
+        msg.account = p.get_string<tag::Account::value>();
+        msg.transact_time = p.get_string<tag::TransactTime::value>();
 
         return msg;
     }
@@ -269,10 +265,10 @@ struct ExecutionReport {
         Builder& account(std::string_view v) noexcept { account_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::OrderID::value, order_id_)
@@ -281,8 +277,8 @@ struct ExecutionReport {
                 .field(tag::OrdStatus::value, static_cast<char>(ord_status_))
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
-                .field(tag::LeavesQty::value, static_cast<int64_t>(leaves_qty_.whole()))
-                .field(tag::CumQty::value, static_cast<int64_t>(cum_qty_.whole()))
+                .field(tag::LeavesQty::value, leaves_qty_)
+                .field(tag::CumQty::value, cum_qty_)
                 .field(tag::AvgPx::value, avg_px_);
 
             if (!cl_ord_id_.empty()) {
@@ -290,11 +286,11 @@ struct ExecutionReport {
             }
 
             if (order_qty_.raw > 0) {
-                asm_.field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()));
+                asm_.field(tag::OrderQty::value, order_qty_);
             }
 
             if (last_qty_.raw > 0) {
-                asm_.field(tag::LastQty::value, static_cast<int64_t>(last_qty_.whole()));
+                asm_.field(tag::LastQty::value, last_qty_);
                 asm_.field(tag::LastPx::value, last_px_);
             }
 
@@ -102,10 +102,10 @@ struct Heartbeat {
         }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -219,10 +219,10 @@ struct TestRequest {
         }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::TestReqID::value, test_req_id_);
@@ -346,10 +346,10 @@ struct ResendRequest {
         }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(7, static_cast<int64_t>(begin_seq_no_))   // BeginSeqNo
@@ -470,14 +470,26 @@ struct SequenceReset {
             return *this;
         }
 
+        /// PossDupFlag=Y with OrigSendingTime (gap fills inside a resend)
+        Builder& poss_dup(std::string_view orig_sending_time) noexcept {
+            orig_sending_time_ = orig_sending_time;
+            return *this;
+        }
+
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
-                .field(tag::SendingTime::value, sending_time_)
-                .field(36, static_cast<int64_t>(new_seq_no_));  // NewSeqNo
+                .field(tag::SendingTime::value, sending_time_);
+
+            if (!orig_sending_time_.empty()) {
+                asm_.field(43, 'Y')                                   // PossDupFlag
+                    .field(122, orig_sending_time_);                 // OrigSendingTime
+            }
+
+            asm_.field(36, static_cast<int64_t>(new_seq_no_));  // NewSeqNo
 
             if (gap_fill_flag_) {
                 asm_.field(123, 'Y');  // GapFillFlag
@@ -492,6 +504,7 @@ struct SequenceReset {
         uint32_t msg_seq_num_{1};
         std::string_view sending_time_;
         uint32_t new_seq_no_{1};
+        std::string_view orig_sending_time_;
         bool gap_fill_flag_{false};
     };
 };
@@ -624,10 +637,10 @@ struct Reject {
         }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::RefSeqNum::value, static_cast<int64_t>(ref_seq_num_));
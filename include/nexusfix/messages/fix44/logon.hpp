@@ -182,10 +182,10 @@ struct Logon {
 
         /// Build the message into provided buffer
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(98, static_cast<int64_t>(encrypt_method_))  // EncryptMethod
@@ -308,10 +308,10 @@ struct Logout {
         }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -57,6 +57,11 @@ struct MarketDataRequest {
     [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
     [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
 
+    /// Get iterator over RelatedSym repeating group
+    [[nodiscard]] parser::RelatedSymIterator related_symbols() const noexcept {
+        return parser::RelatedSymIterator{raw_data, no_related_sym};
+    }
+
     /// Check if this is a snapshot request
     [[nodiscard]] constexpr bool is_snapshot() const noexcept {
         return subscription_type == SubscriptionRequestType::Snapshot;
@@ -78,6 +83,9 @@ struct MarketDataRequest {
 
     class Builder {
     public:
+        static constexpr size_t MAX_ENTRY_TYPES = 16;
+        static constexpr size_t MAX_SYMBOLS = 64;       // RelatedSym entries per request
+
         Builder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
         Builder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
         Builder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
@@ -104,11 +112,16 @@ struct MarketDataRequest {
             return *this;
         }
 
+        /// Symbols added so far (e.g. to intern into a SymbolRegistry)
+        [[nodiscard]] std::span<const std::string_view> symbols() const noexcept {
+            return {symbols_.data(), symbol_count_};
+        }
+
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::MDReqID::value, md_req_id_)
@@ -122,29 +135,23 @@ struct MarketDataRequest {
 
             asm_.field(tag::AggregatedBook::value, aggregated_book_ ? 'Y' : 'N');
 
-            // MDEntryTypes repeating group
-            if (entry_type_count_ > 0) {
-                asm_.field(tag::NoMDEntryTypes::value, static_cast<int64_t>(entry_type_count_));
-                for (size_t i = 0; i < entry_type_count_; ++i) {
-                    asm_.field(tag::MDEntryType::value, static_cast<char>(entry_types_[i]));
-                }
+            // Repeating groups (omitted when empty)
+            auto entry_types = asm_.group<groups::MDEntryTypes>();
+            for (size_t i = 0; i < entry_type_count_; ++i) {
+                entry_types.entry(entry_types_[i]);
             }
+            entry_types.close();
 
-            // RelatedSym repeating group
-            if (symbol_count_ > 0) {
-                asm_.field(tag::NoRelatedSym::value, static_cast<int64_t>(symbol_count_));
-                for (size_t i = 0; i < symbol_count_; ++i) {
-                    asm_.field(tag::Symbol::value, symbols_[i]);
-                }
+            auto related_sym = asm_.group<groups::RelatedSym>();
+            for (size_t i = 0; i < symbol_count_; ++i) {
+                related_sym.entry(symbols_[i]);
             }
+            related_sym.close();
 
             return asm_.finish();
         }
 
     private:
-        static constexpr size_t MAX_ENTRY_TYPES = 16;
-        static constexpr size_t MAX_SYMBOLS = 64;
-
         std::string_view sender_comp_id_;
         std::string_view target_comp_id_;
         uint32_t msg_seq_num_{1};
@@ -201,6 +208,13 @@ struct MarketDataSnapshotFullRefresh {
         return parser::MDEntryIterator{raw_data, no_md_entries};
     }
 
+    /// Decode the MDEntry group column-wise (rows default to this symbol)
+    template <size_t Capacity>
+    size_t decode_entries(MDEntryColumns<Capacity>& out) const noexcept {
+        return parser::decode_md_entries(
+            raw_data, tag::MDEntryType::value, no_md_entries, out, symbol);
+    }
+
     /// Get number of entries
     [[nodiscard]] constexpr size_t entry_count() const noexcept {
         return no_md_entries;
@@ -290,6 +304,13 @@ struct MarketDataIncrementalRefresh {
         return parser::MDEntryIterator{raw_data, no_md_entries, tag::MDUpdateAction::value};
     }
 
+    /// Decode the MDEntry group column-wise (one pass, no MDEntry objects)
+    template <size_t Capacity>
+    size_t decode_entries(MDEntryColumns<Capacity>& out) const noexcept {
+        return parser::decode_md_entries(
+            raw_data, tag::MDUpdateAction::value, no_md_entries, out);
+    }
+
     /// Get number of entries
     [[nodiscard]] constexpr size_t entry_count() const noexcept {
         return no_md_entries;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include <span>
 #include <string_view>
 
@@ -8,6 +9,7 @@
 #include "nexusfix/types/error.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/schema_parser.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
 
@@ -49,6 +51,27 @@ struct NewOrderSingle {
     // Raw buffer reference
     std::span<const char> raw_data;
 
+    /// Tags extracted by from_buffer (required = rejected when absent)
+    using Schema = MessageSchema<
+        FieldSpec<tag::ClOrdID::value>,
+        FieldSpec<tag::Symbol::value>,
+        FieldSpec<tag::Side::value>,
+        FieldSpec<tag::TransactTime::value>,
+        FieldSpec<tag::OrderQty::value>,
+        FieldSpec<tag::OrdType::value>,
+        FieldSpec<tag::Price::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::StopPx::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::TimeInForce::value, FieldRequirement::Optional>,
+        FieldSpec<tag::Account::value, FieldRequirement::Optional>,
+        FieldSpec<tag::HandlInst::value, FieldRequirement::Optional>,
+        FieldSpec<tag::ExDestination::value, FieldRequirement::Optional>,
+        FieldSpec<tag::SecurityType::value, FieldRequirement::Optional>,
+        FieldSpec<15, FieldRequirement::Optional>,   // Currency
+        FieldSpec<110, FieldRequirement::Optional>,  // MinQty
+        FieldSpec<111, FieldRequirement::Optional>,  // MaxFloor
+        FieldSpec<tag::Text::value, FieldRequirement::Optional>
+    >;
+
     constexpr NewOrderSingle() noexcept
         : header{}
         , cl_ord_id{}
@@ -125,80 +148,54 @@ struct NewOrderSingle {
     [[nodiscard]] static ParseResult<NewOrderSingle> from_buffer(
         std::span<const char> buffer) noexcept
     {
-        auto parsed = IndexedParser::parse(buffer);
+        auto parsed = parse_as<Schema>(buffer, MSG_TYPE);
         if (!parsed.has_value()) {
             return std::unexpected{parsed.error()};
         }
 
         auto& p = *parsed;
 
-        if (p.msg_type() != MSG_TYPE) {
-            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
-        }
-
         NewOrderSingle msg;
         msg.raw_data = buffer;
 
         // Parse header
-        msg.header.begin_string = p.get_string(tag::BeginString::value);
-        if (auto v = p.get_int(tag::BodyLength::value)) {
-            msg.header.body_length = static_cast<int>(*v);
-        }
+        msg.header.begin_string = p.header().begin_string;
+        msg.header.body_length = p.header().body_length;
         msg.header.msg_type = p.msg_type();
         msg.header.sender_comp_id = p.sender_comp_id();
         msg.header.target_comp_id = p.target_comp_id();
         msg.header.msg_seq_num = p.msg_seq_num();
         msg.header.sending_time = p.sending_time();
 
-        // Parse required body fields
-        msg.cl_ord_id = p.get_string(tag::ClOrdID::value);
-        if (msg.cl_ord_id.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::ClOrdID::value}};
-        }
-
-        msg.symbol = p.get_string(tag::Symbol::value);
-        if (msg.symbol.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Symbol::value}};
-        }
+        // Required body fields (presence checked by parse_as)
+        msg.cl_ord_id = p.get_string<tag::ClOrdID::value>();
+        msg.symbol = p.get_string<tag::Symbol::value>();
+        msg.side = static_cast<Side>(p.get_char<tag::Side::value>());
+        msg.transact_time = p.get_string<tag::TransactTime::value>();
 
-        char side_char = p.get_char(tag::Side::value);
-        if (side_char == '\0') {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Side::value}};
-        }
-        msg.side = static_cast<Side>(side_char);
-
-        msg.transact_time = p.get_string(tag::TransactTime::value);
-        if (msg.transact_time.empty()) {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::TransactTime::value}};
-        }
-
-        msg.order_qty = p.get_field(tag::OrderQty::value).as_qty();
+        msg.order_qty = p.get_qty<tag::OrderQty::value>();
         if (msg.order_qty.raw == 0) {
             return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrderQty::value}};
         }
 
-        char ord_type_char = p.get_char(tag::OrdType::value);
-        if (ord_type_char == '\0') {
-            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrdType::value}};
-        }
-        msg.ord_type = static_cast<OrdType>(ord_type_char);
+        msg.ord_type = static_cast<OrdType>(p.get_char<tag::OrdType::value>());
 
         // Parse optional/conditional fields
-        msg.price = p.get_field(tag::Price::value).as_price();
-        msg.stop_px = p.get_field(tag::StopPx::value).as_price();
+        msg.price = p.get_price<tag::Price::value>();
+        msg.stop_px = p.get_price<tag::StopPx::value>();
 
-        if (char c = p.get_char(tag::TimeInForce::value); c != '\0') {
+        if (char c = p.get_char<tag::TimeInForce::value>(); c != '\0') {
             msg.time_in_force = static_cast<TimeInForce>(c);
         }
 
-        msg.account = p.get_string(tag::Account::value);
-        msg.handl_inst = p.get_char(tag::HandlInst::value);
-        msg.ex_destination = p.get_string(tag::ExDestination::value);
-        msg.security_type = p.get_string(tag::SecurityType::value);
-        msg.currency = p.get_string(15);  // Currency
-        msg.min_qty = p.get_field(110).as_qty();  // MinQty
-        msg.max_floor = p.get_field(111).as_qty();  // MaxFloor
-        msg.text = p.get_string(tag::Text::value);
+        msg.account = p.get_string<tag::Account::value>();
+        msg.handl_inst = p.get_char<tag::HandlInst::value>();
+        msg.ex_destination = p.get_string<tag::ExDestination::value>();
+        msg.security_type = p.get_string<tag::SecurityType::value>();
+        msg.currency = p.get_string<15>();  // Currency
+        msg.min_qty = p.get_qty<110>();  // MinQty
+        msg.max_floor = p.get_qty<111>();  // MaxFloor
+        msg.text = p.get_string<tag::Text::value>();
 
         // Validate conditional fields
         if (msg.is_limit() && msg.price.raw == 0) {
@@ -239,18 +236,35 @@ struct NewOrderSingle {
         Builder& ex_destination(std::string_view v) noexcept { ex_destination_ = v; return *this; }
         Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
 
+        /// Fields seen by a pre-trade risk stage (see HasPreTradeRisk)
+        [[nodiscard]] OrderFields order_fields() const noexcept {
+            return OrderFields{symbol_, side_, order_qty_, price_, ord_type_};
+        }
+
+        /// Open an entry in an order table (store::OrderTable) and use the
+        /// ClOrdID it mints; set side, order_qty and price first.
+        /// The ClOrdID stays empty if the table is full.
+        template <typename OrderTable>
+            requires requires(OrderTable& table, Side side, Qty qty, FixedPrice px) {
+                { table.open(side, qty, px) } -> std::convertible_to<std::string_view>;
+            }
+        Builder& mint_cl_ord_id(OrderTable& table) noexcept {
+            cl_ord_id_ = table.open(side_, order_qty_, price_);
+            return *this;
+        }
+
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::ClOrdID::value, cl_ord_id_)
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
                 .field(tag::TransactTime::value, transact_time_)
-                .field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()))
+                .field(tag::OrderQty::value, order_qty_)
                 .field(tag::OrdType::value, static_cast<char>(ord_type_));
 
             if (price_.raw != 0) {
@@ -301,6 +315,178 @@ struct NewOrderSingle {
         std::string_view ex_destination_;
         std::string_view text_;
     };
+
+    // ========================================================================
+    // Typestate Building
+    // ========================================================================
+
+    /// Fields a TypedBuilder has been given, one bit each
+    struct Bit {
+        static constexpr uint32_t SenderCompID = 1u << 0;
+        static constexpr uint32_t TargetCompID = 1u << 1;
+        static constexpr uint32_t MsgSeqNum = 1u << 2;
+        static constexpr uint32_t SendingTime = 1u << 3;
+        static constexpr uint32_t ClOrdID = 1u << 4;
+        static constexpr uint32_t Symbol = 1u << 5;
+        static constexpr uint32_t Side = 1u << 6;
+        static constexpr uint32_t TransactTime = 1u << 7;
+        static constexpr uint32_t OrderQty = 1u << 8;
+        static constexpr uint32_t OrdType = 1u << 9;
+        static constexpr uint32_t Price = 1u << 10;
+        static constexpr uint32_t StopPx = 1u << 11;
+        static constexpr uint32_t TimeInForce = 1u << 12;
+        static constexpr uint32_t Account = 1u << 13;
+        static constexpr uint32_t HandlInst = 1u << 14;
+        static constexpr uint32_t ExDestination = 1u << 15;
+        static constexpr uint32_t Text = 1u << 16;
+
+        static constexpr uint32_t REQUIRED = SenderCompID | TargetCompID | MsgSeqNum |
+            SendingTime | ClOrdID | Symbol | Side | TransactTime | OrderQty | OrdType;
+    };
+
+    /// Values held by every TypedBuilder state
+    struct TypedFields {
+        std::string_view sender_comp_id;
+        std::string_view target_comp_id;
+        uint32_t msg_seq_num{1};
+        std::string_view sending_time;
+        std::string_view cl_ord_id;
+        std::string_view symbol;
+        nfx::Side side{nfx::Side::Buy};
+        std::string_view transact_time;
+        Qty order_qty;
+        nfx::OrdType ord_type{nfx::OrdType::Limit};
+        FixedPrice price;
+        FixedPrice stop_px;
+        nfx::TimeInForce time_in_force{nfx::TimeInForce::Day};
+        std::string_view account;
+        char handl_inst{'1'};
+        std::string_view ex_destination;
+        std::string_view text;
+    };
+
+    /// Builder whose type records the fields set so far
+    /// Each setter returns TypedBuilder<Set | bit> and may be called once;
+    /// build() only compiles once every required field is set. Optional
+    /// fields are emitted iff their setter was called (if constexpr), so
+    /// the build has no presence checks. Output matches Builder given the
+    /// same fields; Price / StopPx stay the caller's to pair with OrdType.
+    /// Pass one without the four header fields to send_app_message().
+    template <uint32_t Set = 0>
+    class TypedBuilder {
+    public:
+        static constexpr uint32_t FIELDS = Set;
+        static constexpr bool COMPLETE = (Set & Bit::REQUIRED) == Bit::REQUIRED;
+
+        constexpr TypedBuilder() noexcept = default;
+
+        [[nodiscard]] constexpr auto sender_comp_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::SenderCompID))
+        { auto next = with<Bit::SenderCompID>(); next.f_.sender_comp_id = v; return next; }
+        [[nodiscard]] constexpr auto target_comp_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::TargetCompID))
+        { auto next = with<Bit::TargetCompID>(); next.f_.target_comp_id = v; return next; }
+        [[nodiscard]] constexpr auto msg_seq_num(uint32_t v) const noexcept
+            requires (!(Set & Bit::MsgSeqNum))
+        { auto next = with<Bit::MsgSeqNum>(); next.f_.msg_seq_num = v; return next; }
+        [[nodiscard]] constexpr auto sending_time(std::string_view v) const noexcept
+            requires (!(Set & Bit::SendingTime))
+        { auto next = with<Bit::SendingTime>(); next.f_.sending_time = v; return next; }
+        [[nodiscard]] constexpr auto cl_ord_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::ClOrdID))
+        { auto next = with<Bit::ClOrdID>(); next.f_.cl_ord_id = v; return next; }
+        [[nodiscard]] constexpr auto symbol(std::string_view v) const noexcept
+            requires (!(Set & Bit::Symbol))
+        { auto next = with<Bit::Symbol>(); next.f_.symbol = v; return next; }
+        [[nodiscard]] constexpr auto side(nfx::Side v) const noexcept
+            requires (!(Set & Bit::Side))
+        { auto next = with<Bit::Side>(); next.f_.side = v; return next; }
+        [[nodiscard]] constexpr auto transact_time(std::string_view v) const noexcept
+            requires (!(Set & Bit::TransactTime))
+        { auto next = with<Bit::TransactTime>(); next.f_.transact_time = v; return next; }
+        [[nodiscard]] constexpr auto order_qty(Qty v) const noexcept
+            requires (!(Set & Bit::OrderQty))
+        { auto next = with<Bit::OrderQty>(); next.f_.order_qty = v; return next; }
+        [[nodiscard]] constexpr auto ord_type(nfx::OrdType v) const noexcept
+            requires (!(Set & Bit::OrdType))
+        { auto next = with<Bit::OrdType>(); next.f_.ord_type = v; return next; }
+        [[nodiscard]] constexpr auto price(FixedPrice v) const noexcept
+            requires (!(Set & Bit::Price))
+        { auto next = with<Bit::Price>(); next.f_.price = v; return next; }
+        [[nodiscard]] constexpr auto stop_px(FixedPrice v) const noexcept
+            requires (!(Set & Bit::StopPx))
+        { auto next = with<Bit::StopPx>(); next.f_.stop_px = v; return next; }
+        [[nodiscard]] constexpr auto time_in_force(nfx::TimeInForce v) const noexcept
+            requires (!(Set & Bit::TimeInForce))
+        { auto next = with<Bit::TimeInForce>(); next.f_.time_in_force = v; return next; }
+        [[nodiscard]] constexpr auto account(std::string_view v) const noexcept
+            requires (!(Set & Bit::Account))
+        { auto next = with<Bit::Account>(); next.f_.account = v; return next; }
+        [[nodiscard]] constexpr auto handl_inst(char v) const noexcept
+            requires (!(Set & Bit::HandlInst))
+        { auto next = with<Bit::HandlInst>(); next.f_.handl_inst = v; return next; }
+        [[nodiscard]] constexpr auto ex_destination(std::string_view v) const noexcept
+            requires (!(Set & Bit::ExDestination))
+        { auto next = with<Bit::ExDestination>(); next.f_.ex_destination = v; return next; }
+        [[nodiscard]] constexpr auto text(std::string_view v) const noexcept
+            requires (!(Set & Bit::Text))
+        { auto next = with<Bit::Text>(); next.f_.text = v; return next; }
+
+        /// Fields seen by a pre-trade risk stage (see HasPreTradeRisk)
+        [[nodiscard]] OrderFields order_fields() const noexcept {
+            return OrderFields{f_.symbol, f_.side, f_.order_qty, f_.price, f_.ord_type};
+        }
+
+        /// mint_cl_ord_id() of Builder; side and order_qty must be set
+        template <typename OrderTable>
+            requires ((Set & (Bit::Side | Bit::OrderQty)) == (Bit::Side | Bit::OrderQty)) &&
+                     (!(Set & Bit::ClOrdID)) &&
+                     requires(OrderTable& table, nfx::Side side, Qty qty, FixedPrice px) {
+                         { table.open(side, qty, px) } -> std::convertible_to<std::string_view>;
+                     }
+        [[nodiscard]] auto mint_cl_ord_id(OrderTable& table) const noexcept {
+            return cl_ord_id(table.open(f_.side, f_.order_qty, f_.price));
+        }
+
+        [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept
+            requires COMPLETE
+        {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
+            asm_.start()
+                .field(tag::MsgType::value, MSG_TYPE)
+                .comp_ids(f_.sender_comp_id, f_.target_comp_id)
+                .field(tag::MsgSeqNum::value, static_cast<int64_t>(f_.msg_seq_num))
+                .field(tag::SendingTime::value, f_.sending_time)
+                .field(tag::ClOrdID::value, f_.cl_ord_id)
+                .field(tag::Symbol::value, f_.symbol)
+                .field(tag::Side::value, static_cast<char>(f_.side))
+                .field(tag::TransactTime::value, f_.transact_time)
+                .field(tag::OrderQty::value, f_.order_qty)
+                .field(tag::OrdType::value, static_cast<char>(f_.ord_type));
+            if constexpr ((Set & Bit::Price) != 0) asm_.field(tag::Price::value, f_.price);
+            if constexpr ((Set & Bit::StopPx) != 0) asm_.field(tag::StopPx::value, f_.stop_px);
+            asm_.field(tag::TimeInForce::value, static_cast<char>(f_.time_in_force));
+            if constexpr ((Set & Bit::Account) != 0) asm_.field(tag::Account::value, f_.account);
+            asm_.field(tag::HandlInst::value, f_.handl_inst);
+            if constexpr ((Set & Bit::ExDestination) != 0) {
+                asm_.field(tag::ExDestination::value, f_.ex_destination);
+            }
+            if constexpr ((Set & Bit::Text) != 0) asm_.field(tag::Text::value, f_.text);
+            return asm_.finish();
+        }
+
+    private:
+        template <uint32_t> friend class TypedBuilder;
+
+        template <uint32_t B>
+        [[nodiscard]] constexpr TypedBuilder<Set | B> with() const noexcept {
+            TypedBuilder<Set | B> next;
+            next.f_ = f_;
+            return next;
+        }
+
+        TypedFields f_;
+    };
 };
 
 // ============================================================================
@@ -322,6 +508,18 @@ struct OrderCancelRequest {
     std::string_view text;            // Tag 58 - Optional
     std::span<const char> raw_data;
 
+    /// Tags extracted by from_buffer (required = rejected when absent)
+    using Schema = MessageSchema<
+        FieldSpec<tag::OrigClOrdID::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::ClOrdID::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Symbol::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Side::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::TransactTime::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::OrderQty::value, FieldRequirement::Optional>,
+        FieldSpec<tag::OrderID::value, FieldRequirement::Optional>,
+        FieldSpec<tag::Text::value, FieldRequirement::Optional>
+    >;
+
     constexpr OrderCancelRequest() noexcept
         : header{}
         , orig_cl_ord_id{}
@@ -343,38 +541,34 @@ struct OrderCancelRequest {
     [[nodiscard]] static ParseResult<OrderCancelRequest> from_buffer(
         std::span<const char> buffer) noexcept
     {
-        auto parsed = IndexedParser::parse(buffer);
+        auto parsed = parse_as<Schema>(buffer, MSG_TYPE);
         if (!parsed.has_value()) {
             return std::unexpected{parsed.error()};
         }
 
         auto& p = *parsed;
 
-        if (p.msg_type() != MSG_TYPE) {
-            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
-        }
-
         OrderCancelRequest msg;
         msg.raw_data = buffer;
-        msg.header.begin_string = p.get_string(tag::BeginString::value);
+        msg.header.begin_string = p.header().begin_string;
         msg.header.msg_type = p.msg_type();
         msg.header.sender_comp_id = p.sender_comp_id();
         msg.header.target_comp_id = p.target_comp_id();
         msg.header.msg_seq_num = p.msg_seq_num();
         msg.header.sending_time = p.sending_time();
 
-        msg.orig_cl_ord_id = p.get_string(tag::OrigClOrdID::value);
-        msg.cl_ord_id = p.get_string(tag::ClOrdID::value);
-        msg.symbol = p.get_string(tag::Symbol::value);
+        msg.orig_cl_ord_id = p.get_string<tag::OrigClOrdID::value>();
+        msg.cl_ord_id = p.get_string<tag::ClOrdID::value>();
+        msg.symbol = p.get_string<tag::Symbol::value>();
 
-        if (char c = p.get_char(tag::Side::value); c != '\0') {
+        if (char c = p.get_char<tag::Side::value>(); c != '\0') {
             msg.side = static_cast<Side>(c);
         }
 
-        msg.transact_time = p.get_string(tag::TransactTime::value);
-        msg.order_qty = p.get_field(tag::OrderQty::value).as_qty();
-        msg.order_id = p.get_string(tag::OrderID::value);
-        msg.text = p.get_string(tag::Text::value);
+        msg.transact_time = p.get_string<tag::TransactTime::value>();
+        msg.order_qty = p.get_qty<tag::OrderQty::value>();
+        msg.order_id = p.get_string<tag::OrderID::value>();
+        msg.text = p.get_string<tag::Text::value>();
 
         return msg;
     }
@@ -394,10 +588,10 @@ struct OrderCancelRequest {
         Builder& order_id(std::string_view v) noexcept { order_id_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::OrigClOrdID::value, orig_cl_ord_id_)
@@ -407,7 +601,7 @@ struct OrderCancelRequest {
                 .field(tag::TransactTime::value, transact_time_);
 
             if (order_qty_.raw > 0) {
-                asm_.field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()));
+                asm_.field(tag::OrderQty::value, order_qty_);
             }
 
             if (!order_id_.empty()) {
@@ -430,6 +624,253 @@ struct OrderCancelRequest {
         Qty order_qty_;
         std::string_view order_id_;
     };
+
+    // ========================================================================
+    // Typestate Building
+    // ========================================================================
+
+    /// Fields a TypedBuilder has been given, one bit each
+    struct Bit {
+        static constexpr uint32_t SenderCompID = 1u << 0;
+        static constexpr uint32_t TargetCompID = 1u << 1;
+        static constexpr uint32_t MsgSeqNum = 1u << 2;
+        static constexpr uint32_t SendingTime = 1u << 3;
+        static constexpr uint32_t OrigClOrdID = 1u << 4;
+        static constexpr uint32_t ClOrdID = 1u << 5;
+        static constexpr uint32_t Symbol = 1u << 6;
+        static constexpr uint32_t Side = 1u << 7;
+        static constexpr uint32_t TransactTime = 1u << 8;
+        static constexpr uint32_t OrderQty = 1u << 9;
+        static constexpr uint32_t OrderID = 1u << 10;
+
+        static constexpr uint32_t REQUIRED = SenderCompID | TargetCompID | MsgSeqNum |
+            SendingTime | OrigClOrdID | ClOrdID | Symbol | Side | TransactTime;
+    };
+
+    /// Values held by every TypedBuilder state
+    struct TypedFields {
+        std::string_view sender_comp_id;
+        std::string_view target_comp_id;
+        uint32_t msg_seq_num{1};
+        std::string_view sending_time;
+        std::string_view orig_cl_ord_id;
+        std::string_view cl_ord_id;
+        std::string_view symbol;
+        nfx::Side side{nfx::Side::Buy};
+        std::string_view transact_time;
+        Qty order_qty;
+        std::string_view order_id;
+    };
+
+    /// Builder whose type records the fields set so far
+    /// Same contract as NewOrderSingle::TypedBuilder.
+    template <uint32_t Set = 0>
+    class TypedBuilder {
+    public:
+        static constexpr uint32_t FIELDS = Set;
+        static constexpr bool COMPLETE = (Set & Bit::REQUIRED) == Bit::REQUIRED;
+
+        constexpr TypedBuilder() noexcept = default;
+
+        [[nodiscard]] constexpr auto sender_comp_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::SenderCompID))
+        { auto next = with<Bit::SenderCompID>(); next.f_.sender_comp_id = v; return next; }
+        [[nodiscard]] constexpr auto target_comp_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::TargetCompID))
+        { auto next = with<Bit::TargetCompID>(); next.f_.target_comp_id = v; return next; }
+        [[nodiscard]] constexpr auto msg_seq_num(uint32_t v) const noexcept
+            requires (!(Set & Bit::MsgSeqNum))
+        { auto next = with<Bit::MsgSeqNum>(); next.f_.msg_seq_num = v; return next; }
+        [[nodiscard]] constexpr auto sending_time(std::string_view v) const noexcept
+            requires (!(Set & Bit::SendingTime))
+        { auto next = with<Bit::SendingTime>(); next.f_.sending_time = v; return next; }
+        [[nodiscard]] constexpr auto orig_cl_ord_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::OrigClOrdID))
+        { auto next = with<Bit::OrigClOrdID>(); next.f_.orig_cl_ord_id = v; return next; }
+        [[nodiscard]] constexpr auto cl_ord_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::ClOrdID))
+        { auto next = with<Bit::ClOrdID>(); next.f_.cl_ord_id = v; return next; }
+        [[nodiscard]] constexpr auto symbol(std::string_view v) const noexcept
+            requires (!(Set & Bit::Symbol))
+        { auto next = with<Bit::Symbol>(); next.f_.symbol = v; return next; }
+        [[nodiscard]] constexpr auto side(nfx::Side v) const noexcept
+            requires (!(Set & Bit::Side))
+        { auto next = with<Bit::Side>(); next.f_.side = v; return next; }
+        [[nodiscard]] constexpr auto transact_time(std::string_view v) const noexcept
+            requires (!(Set & Bit::TransactTime))
+        { auto next = with<Bit::TransactTime>(); next.f_.transact_time = v; return next; }
+        [[nodiscard]] constexpr auto order_qty(Qty v) const noexcept
+            requires (!(Set & Bit::OrderQty))
+        { auto next = with<Bit::OrderQty>(); next.f_.order_qty = v; return next; }
+        [[nodiscard]] constexpr auto order_id(std::string_view v) const noexcept
+            requires (!(Set & Bit::OrderID))
+        { auto next = with<Bit::OrderID>(); next.f_.order_id = v; return next; }
+
+        [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept
+            requires COMPLETE
+        {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
+            asm_.start()
+                .field(tag::MsgType::value, MSG_TYPE)
+                .comp_ids(f_.sender_comp_id, f_.target_comp_id)
+                .field(tag::MsgSeqNum::value, static_cast<int64_t>(f_.msg_seq_num))
+                .field(tag::SendingTime::value, f_.sending_time)
+                .field(tag::OrigClOrdID::value, f_.orig_cl_ord_id)
+                .field(tag::ClOrdID::value, f_.cl_ord_id)
+                .field(tag::Symbol::value, f_.symbol)
+                .field(tag::Side::value, static_cast<char>(f_.side))
+                .field(tag::TransactTime::value, f_.transact_time);
+            if constexpr ((Set & Bit::OrderQty) != 0) asm_.field(tag::OrderQty::value, f_.order_qty);
+            if constexpr ((Set & Bit::OrderID) != 0) asm_.field(tag::OrderID::value, f_.order_id);
+            return asm_.finish();
+        }
+
+    private:
+        template <uint32_t> friend class TypedBuilder;
+
+        template <uint32_t B>
+        [[nodiscard]] constexpr TypedBuilder<Set | B> with() const noexcept {
+            TypedBuilder<Set | B> next;
+            next.f_ = f_;
+            return next;
+        }
+
+        TypedFields f_;
+    };
+};
+
+// ============================================================================
+// OrderMassCancelRequest Message (MsgType = q)
+// ============================================================================
+
+/// FIX 4.4 OrderMassCancelRequest message (35=q)
+struct OrderMassCancelRequest {
+    static constexpr char MSG_TYPE = msg_type::OrderMassCancelRequest;
+
+    FixHeader header;
+    std::string_view cl_ord_id;               // Tag 11 - Required
+    MassCancelRequestType request_type;       // Tag 530 - Required
+    std::string_view symbol;                  // Tag 55 - Conditional (request_type Security)
+    Side side;                                // Tag 54 - Optional
+    bool has_side;
+    std::string_view transact_time;           // Tag 60 - Required
+    std::string_view text;                    // Tag 58 - Optional
+    std::span<const char> raw_data;
+
+    /// Tags extracted by from_buffer (required = rejected when absent)
+    using Schema = MessageSchema<
+        FieldSpec<tag::ClOrdID::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::MassCancelRequestType::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Symbol::value, FieldRequirement::Optional>,
+        FieldSpec<tag::Side::value, FieldRequirement::Optional>,
+        FieldSpec<tag::TransactTime::value, FieldRequirement::Conditional>,
+        FieldSpec<tag::Text::value, FieldRequirement::Optional>
+    >;
+
+    constexpr OrderMassCancelRequest() noexcept
+        : header{}
+        , cl_ord_id{}
+        , request_type{MassCancelRequestType::AllOrders}
+        , symbol{}
+        , side{Side::Buy}
+        , has_side{false}
+        , transact_time{}
+        , text{}
+        , raw_data{} {}
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept { return raw_data; }
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept { return header.msg_seq_num; }
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept { return header.sender_comp_id; }
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
+
+    [[nodiscard]] static ParseResult<OrderMassCancelRequest> from_buffer(
+        std::span<const char> buffer) noexcept
+    {
+        auto parsed = parse_as<Schema>(buffer, MSG_TYPE);
+        if (!parsed.has_value()) {
+            return std::unexpected{parsed.error()};
+        }
+
+        auto& p = *parsed;
+
+        OrderMassCancelRequest msg;
+        msg.raw_data = buffer;
+        msg.header.begin_string = p.header().begin_string;
+        msg.header.msg_type = p.msg_type();
+        msg.header.sender_comp_id = p.sender_comp_id();
+        msg.header.target_comp_id = p.target_comp_id();
+        msg.header.msg_seq_num = p.msg_seq_num();
+        msg.header.sending_time = p.sending_time();
+
+        msg.cl_ord_id = p.get_string<tag::ClOrdID::value>();
+        if (char c = p.get_char<tag::MassCancelRequestType::value>(); c != '\0') {
+            msg.request_type = static_cast<MassCancelRequestType>(c);
+        }
+        msg.symbol = p.get_string<tag::Symbol::value>();
+        if (char c = p.get_char<tag::Side::value>(); c != '\0') {
+            msg.side = static_cast<Side>(c);
+            msg.has_side = true;
+        }
+        msg.transact_time = p.get_string<tag::TransactTime::value>();
+        msg.text = p.get_string<tag::Text::value>();
+
+        return msg;
+    }
+
+    class Builder {
+    public:
+        Builder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
+        Builder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
+        Builder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
+        Builder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+        Builder& cl_ord_id(std::string_view v) noexcept { cl_ord_id_ = v; return *this; }
+        Builder& request_type(MassCancelRequestType v) noexcept { request_type_ = v; return *this; }
+        Builder& symbol(std::string_view v) noexcept { symbol_ = v; return *this; }
+        Builder& side(Side v) noexcept { side_ = v; has_side_ = true; return *this; }
+        Builder& transact_time(std::string_view v) noexcept { transact_time_ = v; return *this; }
+        Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
+
+        [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
+            asm_.start()
+                .field(tag::MsgType::value, MSG_TYPE)
+                .comp_ids(sender_comp_id_, target_comp_id_)
+                .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
+                .field(tag::SendingTime::value, sending_time_)
+                .field(tag::ClOrdID::value, cl_ord_id_)
+                .field(tag::MassCancelRequestType::value, static_cast<char>(request_type_));
+
+            if (!symbol_.empty()) {
+                asm_.field(tag::Symbol::value, symbol_);
+            }
+
+            if (has_side_) {
+                asm_.field(tag::Side::value, static_cast<char>(side_));
+            }
+
+            asm_.field(tag::TransactTime::value, transact_time_);
+
+            if (!text_.empty()) {
+                asm_.field(tag::Text::value, text_);
+            }
+
+            return asm_.finish();
+        }
+
+    private:
+        std::string_view sender_comp_id_;
+        std::string_view target_comp_id_;
+        uint32_t msg_seq_num_{1};
+        std::string_view sending_time_;
+        std::string_view cl_ord_id_;
+        MassCancelRequestType request_type_{MassCancelRequestType::AllOrders};
+        std::string_view symbol_;
+        Side side_{Side::Buy};
+        bool has_side_{false};
+        std::string_view transact_time_;
+        std::string_view text_;
+    };
 };
 
 } // namespace nfx::fix44
@@ -296,10 +296,10 @@ struct ExecutionReport {
         Builder& account(std::string_view v) noexcept { account_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()  // Use FIXT.1.1 transport
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -314,8 +314,8 @@ struct ExecutionReport {
                 .field(tag::OrdStatus::value, static_cast<char>(ord_status_))
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
-                .field(tag::LeavesQty::value, static_cast<int64_t>(leaves_qty_.whole()))
-                .field(tag::CumQty::value, static_cast<int64_t>(cum_qty_.whole()))
+                .field(tag::LeavesQty::value, leaves_qty_)
+                .field(tag::CumQty::value, cum_qty_)
                 .field(tag::AvgPx::value, avg_px_);
 
             if (!cl_ord_id_.empty()) {
@@ -323,11 +323,11 @@ struct ExecutionReport {
             }
 
             if (order_qty_.raw > 0) {
-                asm_.field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()));
+                asm_.field(tag::OrderQty::value, order_qty_);
             }
 
             if (last_qty_.raw > 0) {
-                asm_.field(tag::LastQty::value, static_cast<int64_t>(last_qty_.whole()));
+                asm_.field(tag::LastQty::value, last_qty_);
                 asm_.field(tag::LastPx::value, last_px_);
             }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include <span>
 #include <string_view>
 
@@ -262,11 +263,28 @@ struct NewOrderSingle {
         Builder& ex_destination(std::string_view v) noexcept { ex_destination_ = v; return *this; }
         Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
 
+        /// Fields seen by a pre-trade risk stage (see HasPreTradeRisk)
+        [[nodiscard]] OrderFields order_fields() const noexcept {
+            return OrderFields{symbol_, side_, order_qty_, price_, ord_type_};
+        }
+
+        /// Open an entry in an order table (store::OrderTable) and use the
+        /// ClOrdID it mints; set side, order_qty and price first.
+        /// The ClOrdID stays empty if the table is full.
+        template <typename OrderTable>
+            requires requires(OrderTable& table, Side side, Qty qty, FixedPrice px) {
+                { table.open(side, qty, px) } -> std::convertible_to<std::string_view>;
+            }
+        Builder& mint_cl_ord_id(OrderTable& table) noexcept {
+            cl_ord_id_ = table.open(side_, order_qty_, price_);
+            return *this;
+        }
+
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()  // Use FIXT.1.1 transport
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -279,7 +297,7 @@ struct NewOrderSingle {
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
                 .field(tag::TransactTime::value, transact_time_)
-                .field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()))
+                .field(tag::OrderQty::value, order_qty_)
                 .field(tag::OrdType::value, static_cast<char>(ord_type_));
 
             if (price_.raw != 0) {
@@ -441,10 +459,10 @@ struct OrderCancelRequest {
         Builder& use_fix50_sp2() noexcept { return appl_ver_id(nfx::appl_ver_id::FIX_5_0_SP2); }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -459,7 +477,7 @@ struct OrderCancelRequest {
                 .field(tag::TransactTime::value, transact_time_);
 
             if (order_qty_.raw > 0) {
-                asm_.field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()));
+                asm_.field(tag::OrderQty::value, order_qty_);
             }
 
             if (!order_id_.empty()) {
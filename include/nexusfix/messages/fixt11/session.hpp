@@ -11,6 +11,7 @@
 #include "nexusfix/parser/field_view.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
 #include "nexusfix/messages/common/header.hpp"
+#include "nexusfix/util/allocation_tracker.hpp"
 
 namespace nfx::fixt11 {
 
@@ -65,10 +66,10 @@ struct Heartbeat {
         Builder& test_req_id(std::string_view v) noexcept { test_req_id_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_);
 
@@ -139,10 +140,10 @@ struct TestRequest {
         Builder& test_req_id(std::string_view v) noexcept { test_req_id_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::TestReqID::value, test_req_id_);
@@ -218,10 +219,10 @@ struct ResendRequest {
         Builder& end_seq_no(uint32_t v) noexcept { end_seq_no_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::BeginSeqNo::value, static_cast<int64_t>(begin_seq_no_))
@@ -295,15 +296,23 @@ struct SequenceReset {
         Builder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
         Builder& new_seq_no(uint32_t v) noexcept { new_seq_no_ = v; return *this; }
         Builder& gap_fill_flag(bool v) noexcept { gap_fill_flag_ = v; return *this; }
+        /// PossDupFlag=Y with OrigSendingTime (gap fills inside a resend)
+        Builder& poss_dup(std::string_view v) noexcept { orig_sending_time_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
-                .field(tag::SendingTime::value, sending_time_)
-                .field(tag::NewSeqNo::value, static_cast<int64_t>(new_seq_no_));
+                .field(tag::SendingTime::value, sending_time_);
+
+            if (!orig_sending_time_.empty()) {
+                asm_.field(tag::PossDupFlag::value, 'Y')
+                    .field(tag::OrigSendingTime::value, orig_sending_time_);
+            }
+
+            asm_.field(tag::NewSeqNo::value, static_cast<int64_t>(new_seq_no_));
 
             if (gap_fill_flag_) {
                 asm_.field(tag::GapFillFlag::value, 'Y');
@@ -318,6 +327,7 @@ struct SequenceReset {
         uint32_t msg_seq_num_{1};
         std::string_view sending_time_;
         uint32_t new_seq_no_{0};
+        std::string_view orig_sending_time_;
         bool gap_fill_flag_{false};
     };
 };
@@ -390,10 +400,10 @@ struct Reject {
         Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
 
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            NFX_NO_ALLOC_REGION("MessageBuilder::build");
             asm_.start_fixt11()
                 .field(tag::MsgType::value, MSG_TYPE)
-                .field(tag::SenderCompID::value, sender_comp_id_)
-                .field(tag::TargetCompID::value, target_comp_id_)
+                .comp_ids(sender_comp_id_, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
                 .field(tag::SendingTime::value, sending_time_)
                 .field(tag::RefSeqNum::value, static_cast<int64_t>(ref_seq_num_));
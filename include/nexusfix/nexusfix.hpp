@@ -7,6 +7,7 @@
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/types/utc_timestamp.hpp"
 
 // Memory
 #include "nexusfix/memory/buffer_pool.hpp"
@@ -19,6 +20,7 @@
 #include "nexusfix/parser/simd_scanner.hpp"
 #include "nexusfix/parser/consteval_parser.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/schema_parser.hpp"
 
 // Messages
 #include "nexusfix/messages/common/header.hpp"
@@ -8,6 +8,7 @@
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/types/fix_version.hpp"
 #include "nexusfix/parser/field_view.hpp"
 
 namespace nfx {
@@ -250,7 +251,106 @@ struct HeaderParseResult {
     }
 };
 
+namespace detail {
+
+/// Store one header field into result (shared by all header parsers)
+/// Returns false when the field is not a header field (body starts here).
+/// Sets result.error on malformed BodyLength/MsgSeqNum values.
+[[nodiscard]] NFX_HOT
+constexpr bool assign_header_field(
+    HeaderParseResult& result,
+    const FieldView& field,
+    int& fields_parsed) noexcept
+{
+    switch (field.tag) {
+        case tag::BeginString::value:
+            result.header.begin_string = field.as_string();
+            ++fields_parsed;
+            return true;
+
+        case tag::BodyLength::value:
+            if (auto val = field.as_int()) [[likely]] {
+                result.header.body_length = static_cast<int>(*val);
+            } else {
+                result.error = ParseError{ParseErrorCode::InvalidBodyLength, 9};
+            }
+            ++fields_parsed;
+            return true;
+
+        case tag::MsgType::value:
+            result.header.msg_type = field.as_char();
+            ++fields_parsed;
+            return true;
+
+        case tag::SenderCompID::value:
+            result.header.sender_comp_id = field.as_string();
+            ++fields_parsed;
+            return true;
+
+        case tag::TargetCompID::value:
+            result.header.target_comp_id = field.as_string();
+            ++fields_parsed;
+            return true;
+
+        case tag::MsgSeqNum::value:
+            if (auto val = field.as_uint()) [[likely]] {
+                result.header.msg_seq_num = static_cast<uint32_t>(*val);
+            } else {
+                result.error = ParseError{ParseErrorCode::InvalidFieldFormat, 34};
+            }
+            ++fields_parsed;
+            return true;
+
+        case tag::SendingTime::value:
+            result.header.sending_time = field.as_string();
+            ++fields_parsed;
+            return true;
+
+        case tag::PossDupFlag::value:
+            result.header.poss_dup_flag = field.as_bool();
+            return true;
+
+        case tag::PossResend::value:
+            result.header.poss_resend = field.as_bool();
+            return true;
+
+        case tag::OrigSendingTime::value:
+            result.header.orig_sending_time = field.as_string();
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/// Check that all required header fields were populated
+[[nodiscard]] constexpr ParseError validate_header_fields(
+    const MessageHeader& header) noexcept
+{
+    if (header.begin_string.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::BeginString::value};
+    } else if (header.body_length == 0) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::BodyLength::value};
+    } else if (header.msg_type == '\0') [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgType::value};
+    } else if (header.sender_comp_id.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::SenderCompID::value};
+    } else if (header.target_comp_id.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::TargetCompID::value};
+    } else if (header.msg_seq_num == 0) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgSeqNum::value};
+    }
+    return ParseError{};
+}
+
+}  // namespace detail
+
 /// Parse FIX message header (constexpr-capable)
+/// @tparam Ver Version the session is fixed to: "8=<BeginString>|" is then
+///         matched as one compile-time prefix instead of being scanned,
+///         and any other BeginString fails with InvalidBeginString.
+///         FixVersion::Unknown accepts every BeginString.
+template <FixVersion Ver = FixVersion::Unknown>
 [[nodiscard]] NFX_HOT
 constexpr HeaderParseResult parse_header(
     std::span<const char> data) noexcept
@@ -265,6 +365,18 @@ constexpr HeaderParseResult parse_header(
     FieldIterator iter{data};
     int fields_parsed = 0;
 
+    if constexpr (SessionVersion<Ver>::is_fixed) {
+        constexpr std::string_view prefix = SessionVersion<Ver>::begin_string_field;
+        static_assert(prefix.size() < fix::MIN_MESSAGE_SIZE);
+        if (std::string_view{data.data(), prefix.size()} != prefix) [[unlikely]] {
+            result.error = ParseError{ParseErrorCode::InvalidBeginString, tag::BeginString::value};
+            return result;
+        }
+        result.header.begin_string = std::string_view{data.data() + 2, prefix.size() - 3};
+        iter = FieldIterator{data, prefix.size()};
+        fields_parsed = 1;
+    }
+
     // Parse required header fields in order
     while (iter.has_next() && fields_parsed < 7) [[likely]] {
         FieldView field = iter.next();
@@ -273,87 +385,17 @@ constexpr HeaderParseResult parse_header(
             return result;
         }
 
-        switch (field.tag) {
-            case tag::BeginString::value:
-                result.header.begin_string = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::BodyLength::value:
-                if (auto val = field.as_int()) [[likely]] {
-                    result.header.body_length = static_cast<int>(*val);
-                } else {
-                    result.error = ParseError{ParseErrorCode::InvalidBodyLength, 9};
-                    return result;
-                }
-                ++fields_parsed;
-                break;
-
-            case tag::MsgType::value:
-                result.header.msg_type = field.as_char();
-                ++fields_parsed;
-                break;
-
-            case tag::SenderCompID::value:
-                result.header.sender_comp_id = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::TargetCompID::value:
-                result.header.target_comp_id = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::MsgSeqNum::value:
-                if (auto val = field.as_uint()) [[likely]] {
-                    result.header.msg_seq_num = static_cast<uint32_t>(*val);
-                } else {
-                    result.error = ParseError{ParseErrorCode::InvalidFieldFormat, 34};
-                    return result;
-                }
-                ++fields_parsed;
-                break;
-
-            case tag::SendingTime::value:
-                result.header.sending_time = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::PossDupFlag::value:
-                result.header.poss_dup_flag = field.as_bool();
-                break;
-
-            case tag::PossResend::value:
-                result.header.poss_resend = field.as_bool();
-                break;
-
-            case tag::OrigSendingTime::value:
-                result.header.orig_sending_time = field.as_string();
-                break;
-
-            default:
-                // Non-header field encountered, body starts here
-                result.body_start = iter.position() - field.value.size() - 2;  // Back up
-                break;
+        if (!detail::assign_header_field(result, field, fields_parsed)) [[unlikely]] {
+            // Non-header field encountered, body starts here
+            result.body_start = iter.position() - field.value.size() - 2;  // Back up
+            break;
         }
 
-        if (result.body_start > 0) [[unlikely]] break;
+        if (!result.ok()) [[unlikely]] return result;
     }
 
     // Validate required header fields
-    if (result.header.begin_string.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::BeginString::value};
-    } else if (result.header.body_length == 0) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::BodyLength::value};
-    } else if (result.header.msg_type == '\0') [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::MsgType::value};
-    } else if (result.header.sender_comp_id.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::SenderCompID::value};
-    } else if (result.header.target_comp_id.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::TargetCompID::value};
-    } else if (result.header.msg_seq_num == 0) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::MsgSeqNum::value};
-    }
+    result.error = detail::validate_header_fields(result.header);
 
     if (result.body_start == 0) [[likely]] {
         result.body_start = iter.position();
@@ -410,6 +452,73 @@ constexpr ParseError validate_checksum(
     return ParseError{};  // Valid
 }
 
+/// Validate checksum from a byte sum gathered during indexing
+/// checksum_pos is the offset of "10="; byte_sum covers the whole buffer,
+/// so only the short trailer is re-read (see build_index_with_checksum).
+[[nodiscard]] NFX_HOT
+constexpr ParseError validate_checksum_fused(
+    std::span<const char> data,
+    size_t checksum_pos,
+    uint32_t byte_sum) noexcept
+{
+    if (checksum_pos + 6 > data.size()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::CheckSum::value};
+    }
+
+    const char* cs = data.data() + checksum_pos + 3;
+    if (cs[0] < '0' || cs[0] > '9' || cs[1] < '0' || cs[1] > '9' ||
+        cs[2] < '0' || cs[2] > '9') [[unlikely]] {
+        return ParseError{ParseErrorCode::InvalidChecksum, tag::CheckSum::value};
+    }
+    int expected = (cs[0] - '0') * 100 + (cs[1] - '0') * 10 + (cs[2] - '0');
+
+    uint32_t trailer_sum = 0;
+    for (size_t i = checksum_pos; i < data.size(); ++i) {
+        trailer_sum += static_cast<uint8_t>(data[i]);
+    }
+    uint8_t actual = static_cast<uint8_t>((byte_sum - trailer_sum) & 0xFF);
+
+    if (static_cast<int>(actual) != expected) [[unlikely]] {
+        return ParseError{ParseErrorCode::InvalidChecksum, tag::CheckSum::value};
+    }
+
+    return ParseError{};  // Valid
+}
+
+/// Validate checksum from a structural index built with checksum
+/// When the index located the same "10=" as the caller, its
+/// computed_checksum already covers [0, checksum_pos) and only the three
+/// digits are read. Otherwise (no checksum pass, or the index's tag scan
+/// stopped on another "10=") falls back to validate_checksum_fused().
+template <typename Index>
+    requires requires(const Index& idx) {
+        idx.checksum_computed; idx.checksum_start; idx.computed_checksum; idx.byte_sum;
+    }
+[[nodiscard]] NFX_HOT
+constexpr ParseError validate_checksum_indexed(
+    std::span<const char> data,
+    size_t checksum_pos,
+    const Index& idx) noexcept
+{
+    if (!idx.checksum_computed || idx.checksum_start != checksum_pos ||
+        checksum_pos + 6 > data.size()) [[unlikely]] {
+        return validate_checksum_fused(data, checksum_pos, idx.byte_sum);
+    }
+
+    const char* cs = data.data() + checksum_pos + 3;
+    if (cs[0] < '0' || cs[0] > '9' || cs[1] < '0' || cs[1] > '9' ||
+        cs[2] < '0' || cs[2] > '9') [[unlikely]] {
+        return ParseError{ParseErrorCode::InvalidChecksum, tag::CheckSum::value};
+    }
+    int expected = (cs[0] - '0') * 100 + (cs[1] - '0') * 10 + (cs[2] - '0');
+
+    if (static_cast<int>(idx.computed_checksum) != expected) [[unlikely]] {
+        return ParseError{ParseErrorCode::InvalidChecksum, tag::CheckSum::value};
+    }
+
+    return ParseError{};  // Valid
+}
+
 // ============================================================================
 // Static Assertions for Parser Types
 // ============================================================================
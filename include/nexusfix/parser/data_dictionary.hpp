@@ -0,0 +1,689 @@
+/*
+    NexusFIX Data Dictionary Validator
+
+    Loads a FIX data dictionary in QuickFIX XML format once at startup and
+    compiles it into flat tables, so per-message validation needs no
+    string compares and no per-rule branches:
+
+    - tag -> dense field index (one array load per field)
+    - per MsgType: required-field and allowed-field bitsets
+    - per enumerated field: 128-bit valid-char bitmap (multi-char enum
+      values fall back to a sorted list)
+    - optional conditional rules ("OrdType=2 requires Price") compiled to
+      per-message (trigger, value, required) triples
+
+    Validation is a single pass that sets one presence bit per field and
+    checks enum bitmaps, followed by (required & ~present) and
+    (present & ~allowed) over a handful of 64-bit words.
+
+    Header, trailer and component requirements are expanded into every
+    message. Fields inside repeating groups are allowed but never required
+    at message level (the group count field follows its own flag).
+
+    Complements SchemaValidator (consteval_parser.hpp), which covers
+    schemas known at compile time.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+#include <expected>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Dictionary Load Error
+// ============================================================================
+
+/// Reason the dictionary could not be loaded (startup path only)
+struct DictionaryError {
+    std::string_view reason;   // Static description
+    size_t offset{0};          // Byte offset in the XML text (0 if N/A)
+    std::string detail{};      // Offending name or path, if any
+};
+
+// ============================================================================
+// Minimal XML Reader (QuickFIX dictionary subset)
+// ============================================================================
+
+namespace detail {
+
+/// Element with attributes and child elements; text content is ignored
+struct XmlNode {
+    std::string_view name;
+    std::vector<std::pair<std::string_view, std::string_view>> attrs;
+    std::vector<uint32_t> children;
+
+    [[nodiscard]] std::string_view attr(std::string_view key) const noexcept {
+        for (const auto& [k, v] : attrs) {
+            if (k == key) return v;
+        }
+        return {};
+    }
+};
+
+[[nodiscard]] constexpr bool is_xml_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+[[nodiscard]] constexpr bool is_xml_name_end(char c) noexcept {
+    return is_xml_space(c) || c == '/' || c == '>' || c == '=';
+}
+
+/// Parse elements into a flat node list; node 0 is a virtual root
+[[nodiscard]] inline std::expected<std::vector<XmlNode>, DictionaryError>
+parse_xml(std::string_view xml) {
+    std::vector<XmlNode> nodes(1);
+    std::vector<uint32_t> stack{0};
+    size_t pos = 0;
+
+    auto skip_past = [&](std::string_view terminator) {
+        const size_t end = xml.find(terminator, pos);
+        pos = end == std::string_view::npos ? xml.size() : end + terminator.size();
+        return end != std::string_view::npos;
+    };
+    auto read_name = [&] {
+        const size_t start = pos;
+        while (pos < xml.size() && !is_xml_name_end(xml[pos])) ++pos;
+        return xml.substr(start, pos - start);
+    };
+    auto skip_space = [&] {
+        while (pos < xml.size() && is_xml_space(xml[pos])) ++pos;
+    };
+
+    while ((pos = xml.find('<', pos)) != std::string_view::npos) {
+        const size_t tag_offset = pos;
+        const std::string_view rest = xml.substr(pos);
+
+        if (rest.starts_with("<?")) {
+            if (!skip_past("?>")) return std::unexpected{DictionaryError{"Unterminated declaration", tag_offset}};
+            continue;
+        }
+        if (rest.starts_with("<!--")) {
+            if (!skip_past("-->")) return std::unexpected{DictionaryError{"Unterminated comment", tag_offset}};
+            continue;
+        }
+        if (rest.starts_with("<!")) {
+            if (!skip_past(">")) return std::unexpected{DictionaryError{"Unterminated directive", tag_offset}};
+            continue;
+        }
+
+        if (rest.starts_with("</")) {
+            pos += 2;
+            const std::string_view name = read_name();
+            if (stack.size() < 2 || nodes[stack.back()].name != name) {
+                return std::unexpected{DictionaryError{"Mismatched closing tag", tag_offset, std::string{name}}};
+            }
+            stack.pop_back();
+            if (!skip_past(">")) return std::unexpected{DictionaryError{"Unterminated tag", tag_offset}};
+            continue;
+        }
+
+        ++pos;
+        const auto index = static_cast<uint32_t>(nodes.size());
+        XmlNode node;
+        node.name = read_name();
+        if (node.name.empty()) {
+            return std::unexpected{DictionaryError{"Missing element name", tag_offset}};
+        }
+
+        bool self_closing = false;
+        for (;;) {
+            skip_space();
+            if (pos >= xml.size()) {
+                return std::unexpected{DictionaryError{"Unterminated tag", tag_offset}};
+            }
+            if (xml[pos] == '>') { ++pos; break; }
+            if (xml[pos] == '/') {
+                if (pos + 1 >= xml.size() || xml[pos + 1] != '>') {
+                    return std::unexpected{DictionaryError{"Malformed tag end", pos}};
+                }
+                pos += 2;
+                self_closing = true;
+                break;
+            }
+
+            const std::string_view key = read_name();
+            skip_space();
+            if (key.empty() || pos >= xml.size() || xml[pos] != '=') {
+                return std::unexpected{DictionaryError{"Malformed attribute", pos}};
+            }
+            ++pos;
+            skip_space();
+            if (pos >= xml.size() || (xml[pos] != '"' && xml[pos] != '\'')) {
+                return std::unexpected{DictionaryError{"Unquoted attribute value", pos}};
+            }
+            const char quote = xml[pos++];
+            const size_t value_end = xml.find(quote, pos);
+            if (value_end == std::string_view::npos) {
+                return std::unexpected{DictionaryError{"Unterminated attribute value", pos}};
+            }
+            node.attrs.emplace_back(key, xml.substr(pos, value_end - pos));
+            pos = value_end + 1;
+        }
+
+        nodes.push_back(std::move(node));
+        nodes[stack.back()].children.push_back(index);
+        if (!self_closing) stack.push_back(index);
+    }
+
+    if (stack.size() != 1) {
+        return std::unexpected{DictionaryError{"Unclosed element", xml.size(),
+                                               std::string{nodes[stack.back()].name}}};
+    }
+    return nodes;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Data Dictionary
+// ============================================================================
+
+/// Runtime-loaded FIX dictionary compiled to bitset tables
+class DataDictionary {
+public:
+    /// Dense field indices are uint16_t; bitsets are sized to the dictionary
+    static constexpr size_t MAX_FIELDS = 4096;
+    static constexpr size_t MAX_WORDS = MAX_FIELDS / 64;
+
+    /// Distinct fields that can trigger conditional rules
+    static constexpr size_t MAX_TRIGGER_FIELDS = 16;
+
+    static constexpr uint16_t NO_INDEX = 0xFFFF;
+    static constexpr uint8_t NO_TRIGGER = 0xFF;
+
+    /// Tags at or above this number are user-defined (FIX convention)
+    static constexpr int USER_DEFINED_TAG_MIN = 5000;
+
+    struct Options {
+        bool check_enum_values = true;
+        bool allow_unknown_fields = false;       // Tags absent from <fields>
+        bool allow_user_defined_fields = true;   // Unknown tags >= 5000
+    };
+
+    DataDictionary() noexcept { single_char_msg_.fill(NO_INDEX); }
+
+    // ========================================================================
+    // Loading (startup only)
+    // ========================================================================
+
+    /// Compile a QuickFIX-format XML dictionary held in memory
+    [[nodiscard]] static std::expected<DataDictionary, DictionaryError>
+    from_xml(std::string_view xml) {
+        auto nodes = detail::parse_xml(xml);
+        if (!nodes) return std::unexpected{std::move(nodes.error())};
+
+        DataDictionary dict;
+        if (auto error = dict.compile(*nodes); !error.reason.empty()) {
+            return std::unexpected{std::move(error)};
+        }
+        return dict;
+    }
+
+    /// Read and compile a dictionary file (e.g. FIX44.xml)
+    [[nodiscard]] static std::expected<DataDictionary, DictionaryError>
+    load(const std::string& path) {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) {
+            return std::unexpected{DictionaryError{"Cannot open dictionary file", 0, path}};
+        }
+        const std::string xml{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        return from_xml(xml);
+    }
+
+    /// Require required_tag in msg_type messages whose trigger_tag == value
+    /// Rules apply to single-character trigger values (OrdType, Side, ...).
+    /// @return false if a tag or the message type is not in the dictionary
+    bool add_conditional(
+        std::string_view msg_type, int trigger_tag, char value, int required_tag)
+    {
+        const uint16_t msg = find_message(msg_type);
+        const uint16_t trigger = field_index(trigger_tag);
+        const uint16_t required = field_index(required_tag);
+        if (msg == NO_INDEX || trigger == NO_INDEX || required == NO_INDEX) return false;
+
+        uint8_t slot = trigger_slot_[trigger];
+        if (slot == NO_TRIGGER) {
+            if (trigger_count_ == MAX_TRIGGER_FIELDS) return false;
+            slot = static_cast<uint8_t>(trigger_count_++);
+            trigger_slot_[trigger] = slot;
+        }
+        messages_[msg].conditionals.push_back(ConditionalRule{slot, value, required});
+        return true;
+    }
+
+    void set_options(const Options& options) noexcept { options_ = options; }
+    [[nodiscard]] const Options& options() const noexcept { return options_; }
+
+    // ========================================================================
+    // Validation (hot path)
+    // ========================================================================
+
+    /// Validate a complete raw message in one FieldIterator pass
+    [[nodiscard]] NFX_HOT
+    ParseError validate(std::span<const char> data) const noexcept {
+        Pass pass{*this};
+        FieldIterator iter{data};
+        while (iter.has_next()) {
+            const FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, iter.position()};
+            }
+            const ParseError error = pass.add(field);
+            if (!error.ok()) [[unlikely]] {
+                return ParseError{error.code, error.tag,
+                                  static_cast<size_t>(field.value.data() - data.data())};
+            }
+        }
+        return pass.finish();
+    }
+
+    /// Validate an already parsed message (fields include header/trailer)
+    [[nodiscard]] NFX_HOT
+    ParseError validate(const ParsedMessage& msg) const noexcept {
+        Pass pass{*this};
+        for (const FieldView& field : msg) {
+            const ParseError error = pass.add(field);
+            if (!error.ok()) [[unlikely]] return error;
+        }
+        return pass.finish();
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] size_t field_count() const noexcept { return tags_.size(); }
+    [[nodiscard]] size_t message_count() const noexcept { return messages_.size(); }
+
+    [[nodiscard]] bool has_field(int tag) const noexcept {
+        return field_index(tag) != NO_INDEX;
+    }
+
+    [[nodiscard]] bool has_message(std::string_view msg_type) const noexcept {
+        return find_message(msg_type) != NO_INDEX;
+    }
+
+    /// True if tag is required in msg_type (header/trailer included)
+    [[nodiscard]] bool is_required(std::string_view msg_type, int tag) const noexcept {
+        const uint16_t msg = find_message(msg_type);
+        const uint16_t idx = field_index(tag);
+        return msg != NO_INDEX && idx != NO_INDEX && test_bit(required_bits(msg), idx);
+    }
+
+    /// True if tag may appear in msg_type (groups and components included)
+    [[nodiscard]] bool is_allowed(std::string_view msg_type, int tag) const noexcept {
+        const uint16_t msg = find_message(msg_type);
+        const uint16_t idx = field_index(tag);
+        return msg != NO_INDEX && idx != NO_INDEX && test_bit(allowed_bits(msg), idx);
+    }
+
+private:
+    struct ConditionalRule {
+        uint8_t trigger_slot;
+        char value;
+        uint16_t required_index;
+    };
+
+    struct MessageRules {
+        std::string msg_type;
+        std::vector<ConditionalRule> conditionals;
+    };
+
+    /// Valid values of one enumerated field
+    struct EnumSet {
+        std::array<uint64_t, 2> chars{};   // Single-char values (ASCII)
+        std::vector<std::string> strings;  // Multi-char values, sorted
+
+        [[nodiscard]] bool contains(std::string_view value) const noexcept {
+            if (value.size() == 1) {
+                const auto c = static_cast<unsigned char>(value[0]);
+                return c < 128 && (chars[c >> 6] >> (c & 63)) & 1;
+            }
+            return std::binary_search(strings.begin(), strings.end(), value);
+        }
+    };
+
+    // ========================================================================
+    // Per-message Validation State
+    // ========================================================================
+
+    class Pass {
+    public:
+        explicit Pass(const DataDictionary& dict) noexcept : dict_{dict} {
+            std::fill_n(present_.begin(), dict.words_, 0);
+            std::fill_n(trigger_values_.begin(), dict.trigger_count_, '\0');
+        }
+
+        [[nodiscard]] NFX_FORCE_INLINE
+        ParseError add(const FieldView& field) noexcept {
+            if (field.tag == tag::MsgType::value) [[unlikely]] {
+                msg_ = dict_.find_message(field.as_string());
+                if (msg_ == NO_INDEX) [[unlikely]] {
+                    return ParseError{ParseErrorCode::InvalidMsgType, field.tag};
+                }
+            }
+
+            const uint16_t idx = dict_.field_index(field.tag);
+            if (idx == NO_INDEX) [[unlikely]] {
+                return dict_.unknown_field_allowed(field.tag)
+                    ? ParseError{} : ParseError{ParseErrorCode::InvalidTagNumber, field.tag};
+            }
+            present_[idx >> 6] |= 1ULL << (idx & 63);
+
+            const uint16_t enum_index = dict_.enum_of_[idx];
+            if (enum_index != NO_INDEX && dict_.options_.check_enum_values &&
+                !dict_.enums_[enum_index].contains(field.as_string())) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, field.tag};
+            }
+
+            const uint8_t slot = dict_.trigger_slot_[idx];
+            if (slot != NO_TRIGGER) [[unlikely]] {
+                trigger_values_[slot] = field.as_char();
+            }
+            return ParseError{};
+        }
+
+        [[nodiscard]] NFX_FORCE_INLINE
+        ParseError finish() const noexcept {
+            if (msg_ == NO_INDEX) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value};
+            }
+
+            const uint64_t* required = dict_.required_bits(msg_);
+            const uint64_t* allowed = dict_.allowed_bits(msg_);
+            for (size_t w = 0; w < dict_.words_; ++w) {
+                if (const uint64_t missing = required[w] & ~present_[w]) [[unlikely]] {
+                    return ParseError{ParseErrorCode::MissingRequiredField,
+                                      dict_.tag_at(w, missing)};
+                }
+            }
+            for (size_t w = 0; w < dict_.words_; ++w) {
+                if (const uint64_t extra = present_[w] & ~allowed[w]) [[unlikely]] {
+                    return ParseError{ParseErrorCode::InvalidTagNumber, dict_.tag_at(w, extra)};
+                }
+            }
+
+            for (const ConditionalRule& rule : dict_.messages_[msg_].conditionals) {
+                if (trigger_values_[rule.trigger_slot] == rule.value &&
+                    !test_bit(present_.data(), rule.required_index)) {
+                    return ParseError{ParseErrorCode::MissingRequiredField,
+                                      dict_.tags_[rule.required_index]};
+                }
+            }
+            return ParseError{};
+        }
+
+    private:
+        const DataDictionary& dict_;
+        uint16_t msg_{NO_INDEX};
+        std::array<uint64_t, MAX_WORDS> present_;
+        std::array<char, MAX_TRIGGER_FIELDS> trigger_values_;
+    };
+
+    // ========================================================================
+    // Table Access
+    // ========================================================================
+
+    [[nodiscard]] NFX_FORCE_INLINE
+    uint16_t field_index(int tag) const noexcept {
+        return (tag >= 0 && static_cast<size_t>(tag) < tag_index_.size())
+            ? tag_index_[static_cast<size_t>(tag)] : NO_INDEX;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE
+    uint16_t find_message(std::string_view msg_type) const noexcept {
+        if (msg_type.size() == 1) [[likely]] {
+            const auto c = static_cast<unsigned char>(msg_type[0]);
+            return c < single_char_msg_.size() ? single_char_msg_[c] : NO_INDEX;
+        }
+        for (size_t i = 0; i < messages_.size(); ++i) {
+            if (messages_[i].msg_type == msg_type) return static_cast<uint16_t>(i);
+        }
+        return NO_INDEX;
+    }
+
+    [[nodiscard]] bool unknown_field_allowed(int tag) const noexcept {
+        return options_.allow_unknown_fields ||
+               (options_.allow_user_defined_fields && tag >= USER_DEFINED_TAG_MIN);
+    }
+
+    [[nodiscard]] const uint64_t* required_bits(uint16_t msg) const noexcept {
+        return bits_.data() + static_cast<size_t>(msg) * 2 * words_;
+    }
+
+    [[nodiscard]] const uint64_t* allowed_bits(uint16_t msg) const noexcept {
+        return required_bits(msg) + words_;
+    }
+
+    [[nodiscard]] int tag_at(size_t word, uint64_t bits) const noexcept {
+        return tags_[word * 64 + static_cast<size_t>(std::countr_zero(bits))];
+    }
+
+    [[nodiscard]] static bool test_bit(const uint64_t* bits, uint16_t idx) noexcept {
+        return (bits[idx >> 6] >> (idx & 63)) & 1;
+    }
+
+    static void set_bit(uint64_t* bits, uint16_t idx) noexcept {
+        bits[idx >> 6] |= 1ULL << (idx & 63);
+    }
+
+    // ========================================================================
+    // Compilation
+    // ========================================================================
+
+    using NameMap = std::unordered_map<std::string_view, uint16_t>;
+    using NodeMap = std::unordered_map<std::string_view, uint32_t>;
+
+    /// Maximum component nesting (guards against recursive definitions)
+    static constexpr int MAX_COMPONENT_DEPTH = 32;
+
+    [[nodiscard]] static const detail::XmlNode* child(
+        const std::vector<detail::XmlNode>& nodes, const detail::XmlNode& parent,
+        std::string_view name) noexcept
+    {
+        for (uint32_t c : parent.children) {
+            if (nodes[c].name == name) return &nodes[c];
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] static bool is_multi_value_type(std::string_view type) noexcept {
+        return type == "MULTIPLEVALUESTRING" || type == "MULTIPLESTRINGVALUE" ||
+               type == "MULTIPLECHARVALUE";
+    }
+
+    [[nodiscard]] DictionaryError compile(const std::vector<detail::XmlNode>& nodes) {
+        const detail::XmlNode* fix = child(nodes, nodes[0], "fix");
+        if (!fix) return DictionaryError{"Missing <fix> root element"};
+
+        NameMap names;
+        if (auto error = compile_fields(nodes, *fix, names); !error.reason.empty()) {
+            return error;
+        }
+
+        NodeMap components;
+        if (const detail::XmlNode* section = child(nodes, *fix, "components")) {
+            for (uint32_t c : section->children) {
+                if (nodes[c].name == "component") components[nodes[c].attr("name")] = c;
+            }
+        }
+
+        // Header and trailer rules are shared by every message
+        std::vector<uint64_t> common(2 * words_, 0);
+        for (std::string_view section_name : {std::string_view{"header"}, std::string_view{"trailer"}}) {
+            if (const detail::XmlNode* section = child(nodes, *fix, section_name)) {
+                if (auto error = expand(nodes, *section, true, names, components,
+                                        common.data(), common.data() + words_, 0);
+                    !error.reason.empty()) {
+                    return error;
+                }
+            }
+        }
+
+        const detail::XmlNode* section = child(nodes, *fix, "messages");
+        if (!section) return DictionaryError{"Missing <messages> section"};
+        for (uint32_t c : section->children) {
+            const detail::XmlNode& message = nodes[c];
+            if (message.name != "message") continue;
+
+            const std::string_view msg_type = message.attr("msgtype");
+            if (msg_type.empty() || find_message(msg_type) != NO_INDEX) {
+                return DictionaryError{"Missing or duplicate msgtype", 0, std::string{message.attr("name")}};
+            }
+            if (messages_.size() >= NO_INDEX) return DictionaryError{"Too many messages"};
+
+            const auto msg = static_cast<uint16_t>(messages_.size());
+            messages_.push_back(MessageRules{std::string{msg_type}, {}});
+            bits_.insert(bits_.end(), common.begin(), common.end());
+            uint64_t* required = bits_.data() + static_cast<size_t>(msg) * 2 * words_;
+            if (auto error = expand(nodes, message, true, names, components,
+                                    required, required + words_, 0);
+                !error.reason.empty()) {
+                return error;
+            }
+            if (msg_type.size() == 1 && static_cast<unsigned char>(msg_type[0]) < single_char_msg_.size()) {
+                single_char_msg_[static_cast<unsigned char>(msg_type[0])] = msg;
+            }
+        }
+        return DictionaryError{};
+    }
+
+    /// <fields>: assign dense indices and build enum sets
+    [[nodiscard]] DictionaryError compile_fields(
+        const std::vector<detail::XmlNode>& nodes, const detail::XmlNode& fix, NameMap& names)
+    {
+        const detail::XmlNode* section = child(nodes, fix, "fields");
+        if (!section) return DictionaryError{"Missing <fields> section"};
+
+        int max_tag = 0;
+        for (uint32_t c : section->children) {
+            const detail::XmlNode& field = nodes[c];
+            if (field.name != "field") continue;
+
+            const std::string_view number = field.attr("number");
+            int tag = 0;
+            const auto [end, ec] = std::from_chars(number.data(), number.data() + number.size(), tag);
+            if (ec != std::errc{} || end != number.data() + number.size() || tag <= 0) {
+                return DictionaryError{"Invalid field number", 0, std::string{field.attr("name")}};
+            }
+            if (tags_.size() >= MAX_FIELDS) return DictionaryError{"Too many fields"};
+            if (!names.emplace(field.attr("name"), static_cast<uint16_t>(tags_.size())).second) {
+                return DictionaryError{"Duplicate field name", 0, std::string{field.attr("name")}};
+            }
+
+            uint16_t enum_index = NO_INDEX;
+            if (!field.children.empty() && !is_multi_value_type(field.attr("type"))) {
+                EnumSet set;
+                for (uint32_t v : field.children) {
+                    if (nodes[v].name != "value") continue;
+                    const std::string_view value = nodes[v].attr("enum");
+                    if (value.size() == 1 && static_cast<unsigned char>(value[0]) < 128) {
+                        const auto ch = static_cast<unsigned char>(value[0]);
+                        set.chars[ch >> 6] |= 1ULL << (ch & 63);
+                    } else {
+                        set.strings.emplace_back(value);
+                    }
+                }
+                std::sort(set.strings.begin(), set.strings.end());
+                enum_index = static_cast<uint16_t>(enums_.size());
+                enums_.push_back(std::move(set));
+            }
+
+            tags_.push_back(tag);
+            enum_of_.push_back(enum_index);
+            max_tag = std::max(max_tag, tag);
+        }
+
+        tag_index_.assign(static_cast<size_t>(max_tag) + 1, NO_INDEX);
+        for (size_t i = 0; i < tags_.size(); ++i) {
+            uint16_t& slot = tag_index_[static_cast<size_t>(tags_[i])];
+            if (slot != NO_INDEX) {
+                return DictionaryError{"Duplicate field number", 0, std::to_string(tags_[i])};
+            }
+            slot = static_cast<uint16_t>(i);
+        }
+        trigger_slot_.assign(tags_.size(), NO_TRIGGER);
+        words_ = std::max<size_t>(1, (tags_.size() + 63) / 64);
+        return DictionaryError{};
+    }
+
+    /// Mark the fields of a message, header, group or component
+    /// @param required_context false inside repeating groups / optional components
+    [[nodiscard]] DictionaryError expand(
+        const std::vector<detail::XmlNode>& nodes, const detail::XmlNode& parent,
+        bool required_context, const NameMap& names, const NodeMap& components,
+        uint64_t* required, uint64_t* allowed, int depth) const
+    {
+        if (depth > MAX_COMPONENT_DEPTH) {
+            return DictionaryError{"Component nesting too deep", 0, std::string{parent.attr("name")}};
+        }
+
+        for (uint32_t c : parent.children) {
+            const detail::XmlNode& node = nodes[c];
+            const bool node_required = required_context && node.attr("required") == "Y";
+
+            if (node.name == "field" || node.name == "group") {
+                const auto it = names.find(node.attr("name"));
+                if (it == names.end()) {
+                    return DictionaryError{"Undefined field", 0, std::string{node.attr("name")}};
+                }
+                set_bit(allowed, it->second);
+                if (node_required) set_bit(required, it->second);
+
+                if (node.name == "group") {
+                    if (auto error = expand(nodes, node, false, names, components,
+                                            required, allowed, depth + 1);
+                        !error.reason.empty()) {
+                        return error;
+                    }
+                }
+            } else if (node.name == "component") {
+                const auto it = components.find(node.attr("name"));
+                if (it == components.end()) {
+                    return DictionaryError{"Undefined component", 0, std::string{node.attr("name")}};
+                }
+                if (auto error = expand(nodes, nodes[it->second], node_required, names,
+                                        components, required, allowed, depth + 1);
+                    !error.reason.empty()) {
+                    return error;
+                }
+            }
+        }
+        return DictionaryError{};
+    }
+
+    std::vector<int> tags_;                  // Dense index -> tag
+    std::vector<uint16_t> tag_index_;        // Tag -> dense index
+    std::vector<uint16_t> enum_of_;          // Dense index -> enum set
+    std::vector<EnumSet> enums_;
+    std::vector<uint8_t> trigger_slot_;      // Dense index -> trigger slot
+    std::vector<MessageRules> messages_;
+    std::vector<uint64_t> bits_;             // Per message: required | allowed
+    std::array<uint16_t, 128> single_char_msg_{};
+    size_t words_{1};
+    size_t trigger_count_{0};
+    Options options_{};
+};
+
+} // namespace nfx
@@ -0,0 +1,270 @@
+/*
+    NexusFIX Batch Decimal Decoder
+
+    Converts many FIX decimal values (MDEntryPx, MDEntrySize, ...) to
+    FixedPrice / Qty in one call. Snapshot refreshes carry hundreds of
+    prices per message, so the per-field scalar loop in from_string()
+    (one multiply and two branches per digit) dominates decode time.
+
+    Fixed-width fast path (SSE4.1): a value of at most 16 bytes with at
+    most DECIMAL_PLACES fractional digits is gathered with one pshufb into
+    a canonical 16-digit layout, integer digits right-aligned before the
+    implied decimal point and fractional digits zero-padded after it:
+
+        "123.45"  (Qty, 4 places)   -> 000000000123|4500
+        "1.2345"  (Price, 8 places) -> 00000001|23450000
+
+    The 16 digits are then combined with maddubs/madd/packus/madd into
+    two 8-digit halves, so raw = hi * 10^8 + lo needs no per-digit work.
+    With AVX2 two values share one 256-bit combine.
+
+    Anything else (longer values, extra fractional digits, stray
+    characters, second '.') falls back to from_string(), so results are
+    identical to FieldView::as_price() / as_qty() for every input.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/parser/field_view.hpp"
+
+#if defined(__SSE4_1__)
+    #include <immintrin.h>
+    #define NFX_SSE41_DECIMAL_DECODE 1
+#endif
+
+namespace nfx::parser {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+/// Widest value (sign excluded) handled by the fixed-width fast path
+inline constexpr size_t DECIMAL_FAST_MAX_WIDTH = 16;
+
+// ============================================================================
+// SSE4.1 Fixed-Width Kernel
+// ============================================================================
+
+#if defined(NFX_SSE41_DECIMAL_DECODE)
+
+namespace detail {
+
+inline constexpr uintptr_t DECIMAL_PAGE_SIZE = 4096;
+
+/// Load 16 bytes starting at ptr without faulting
+/// Values sit inside a receive buffer, so a 16-byte over-read is safe as
+/// long as it stays within the page; bytes past len are discarded by the
+/// gather shuffle. Near a page end the value is copied instead.
+[[nodiscard]] NFX_FORCE_INLINE
+__m128i load_decimal_window(const char* ptr, size_t len) noexcept {
+    if ((reinterpret_cast<uintptr_t>(ptr) & (DECIMAL_PAGE_SIZE - 1)) <=
+        DECIMAL_PAGE_SIZE - DECIMAL_FAST_MAX_WIDTH) [[likely]] {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    }
+    alignas(16) char tmp[DECIMAL_FAST_MAX_WIDTH]{};
+    std::memcpy(tmp, ptr, len);
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(tmp));
+}
+
+/// Gather the digits of an unsigned decimal into the canonical layout
+/// @tparam Places Fractional digits kept (FixedPrice: 8, Qty: 4)
+/// @return false if the value needs the scalar path
+template <int Places>
+[[nodiscard]] NFX_FORCE_INLINE
+bool gather_decimal_digits(const char* ptr, size_t len, __m128i& digits) noexcept {
+    static_assert(Places > 0 && Places < static_cast<int>(DECIMAL_FAST_MAX_WIDTH));
+    constexpr int INTEGER_DIGITS = static_cast<int>(DECIMAL_FAST_MAX_WIDTH) - Places;
+
+    if (len > DECIMAL_FAST_MAX_WIDTH) [[unlikely]] return false;
+
+    const __m128i raw = load_decimal_window(ptr, len);
+    const uint32_t len_mask = (1u << len) - 1;
+
+    // Decimal point: first '.' inside the value, or len when absent
+    const uint32_t dot_mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(raw, _mm_set1_epi8('.')))) & len_mask;
+    const int dot = dot_mask ? std::countr_zero(dot_mask) : static_cast<int>(len);
+    const int frac_digits = dot_mask ? static_cast<int>(len) - dot - 1 : 0;
+    if (dot > INTEGER_DIGITS || frac_digits > Places) [[unlikely]] return false;
+
+    // Every byte but the decimal point must be a digit
+    const __m128i values = _mm_sub_epi8(raw, _mm_set1_epi8('0'));
+    const __m128i non_digit = _mm_cmpgt_epi8(
+        _mm_xor_si128(values, _mm_set1_epi8(static_cast<char>(0x80))),
+        _mm_set1_epi8(static_cast<char>(0x80 + 9)));
+    const uint32_t bad = static_cast<uint32_t>(_mm_movemask_epi8(non_digit)) &
+                         len_mask & ~(dot_mask & (0u - dot_mask));
+    if (bad != 0) [[unlikely]] return false;
+
+    // Output byte j reads source byte j + dot - INTEGER_DIGITS (integer half)
+    // or j + dot + 1 - INTEGER_DIGITS (fraction half); out-of-value -> zero
+    const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i frac_half = _mm_cmpgt_epi8(iota, _mm_set1_epi8(INTEGER_DIGITS - 1));
+    __m128i index = _mm_add_epi8(iota, _mm_set1_epi8(static_cast<char>(dot - INTEGER_DIGITS)));
+    index = _mm_sub_epi8(index, frac_half);  // -(-1) = +1 skips the point
+
+    const __m128i in_range = _mm_andnot_si128(
+        _mm_cmpgt_epi8(_mm_setzero_si128(), index),
+        _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(len)), index));
+    index = _mm_or_si128(index, _mm_andnot_si128(in_range, _mm_set1_epi8(static_cast<char>(0x80))));
+
+    digits = _mm_shuffle_epi8(values, index);
+    return true;
+}
+
+/// 16 digits (0-9 per byte, most significant first) -> two 8-digit halves
+[[nodiscard]] NFX_FORCE_INLINE
+__m128i combine_16_digits(__m128i digits) noexcept {
+    __m128i v = _mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1,
+                                                        10, 1, 10, 1, 10, 1, 10, 1));
+    v = _mm_madd_epi16(v, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    v = _mm_packus_epi32(v, v);
+    return _mm_madd_epi16(v, _mm_setr_epi16(10000, 1, 10000, 1, 0, 0, 0, 0));
+}
+
+[[nodiscard]] NFX_FORCE_INLINE
+int64_t halves_to_int(__m128i halves) noexcept {
+    const uint64_t pair = static_cast<uint64_t>(_mm_cvtsi128_si64(halves));
+    return static_cast<int64_t>(pair & 0xFFFFFFFFu) * 100000000LL +
+           static_cast<int64_t>(pair >> 32);
+}
+
+#if NFX_HAS_AVX2
+
+/// Two canonical 16-digit values combined in one 256-bit pass
+[[nodiscard]] NFX_FORCE_INLINE
+__m256i combine_2x16_digits(__m128i first, __m128i second) noexcept {
+    __m256i v = _mm256_set_m128i(second, first);
+    v = _mm256_maddubs_epi16(v, _mm256_set1_epi16(0x010A));  // bytes: 10, 1
+    v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00010064)); // words: 100, 1
+    v = _mm256_packus_epi32(v, v);
+    return _mm256_madd_epi16(v, _mm256_set1_epi32(0x00012710)); // 10000, 1
+}
+
+#endif
+
+/// Decode one value with the fast path; false -> caller uses from_string
+template <int Places>
+[[nodiscard]] NFX_FORCE_INLINE
+bool decode_decimal_fast(std::string_view sv, int64_t& raw) noexcept {
+    const bool negative = !sv.empty() && sv[0] == '-';
+    const char* ptr = sv.data() + negative;
+    const size_t len = sv.size() - negative;
+    if (len == 0) {
+        raw = 0;
+        return true;
+    }
+
+    __m128i digits;
+    if (!gather_decimal_digits<Places>(ptr, len, digits)) [[unlikely]] return false;
+    const int64_t value = halves_to_int(combine_16_digits(digits));
+    raw = negative ? -value : value;
+    return true;
+}
+
+}  // namespace detail
+
+#endif  // NFX_SSE41_DECIMAL_DECODE
+
+// ============================================================================
+// Batch Decoders
+// ============================================================================
+
+namespace detail {
+
+template <typename T>
+[[nodiscard]] NFX_FORCE_INLINE
+std::string_view decimal_text(const T& value) noexcept {
+    if constexpr (std::is_same_v<T, FieldView>) {
+        return value.as_string();
+    } else {
+        return std::string_view{value.data(), value.size()};
+    }
+}
+
+/// Shared loop for FixedPrice / Qty over FieldViews or value spans
+template <typename Out, typename In>
+NFX_HOT
+size_t decode_decimals(std::span<const In> values, std::span<Out> out) noexcept {
+    const size_t n = values.size() < out.size() ? values.size() : out.size();
+    size_t i = 0;
+
+#if defined(NFX_SSE41_DECIMAL_DECODE)
+    constexpr int PLACES = Out::DECIMAL_PLACES;
+#if NFX_HAS_AVX2
+    // Pairs of plain (unsigned, fast-path) values share one combine
+    for (; i + 2 <= n; i += 2) {
+        const std::string_view a = decimal_text(values[i]);
+        const std::string_view b = decimal_text(values[i + 1]);
+        __m128i da, db;
+        if (!a.empty() && !b.empty() && a[0] != '-' && b[0] != '-' &&
+            gather_decimal_digits<PLACES>(a.data(), a.size(), da) &&
+            gather_decimal_digits<PLACES>(b.data(), b.size(), db)) [[likely]] {
+            const __m256i halves = combine_2x16_digits(da, db);
+            out[i] = Out{halves_to_int(_mm256_castsi256_si128(halves))};
+            out[i + 1] = Out{halves_to_int(_mm256_extracti128_si256(halves, 1))};
+            continue;
+        }
+        for (size_t k = i; k < i + 2; ++k) {
+            const std::string_view sv = decimal_text(values[k]);
+            int64_t raw;
+            out[k] = decode_decimal_fast<PLACES>(sv, raw) ? Out{raw} : Out::from_string(sv);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        const std::string_view sv = decimal_text(values[i]);
+        int64_t raw;
+        out[i] = decode_decimal_fast<PLACES>(sv, raw) ? Out{raw} : Out::from_string(sv);
+    }
+#else
+    for (; i < n; ++i) {
+        out[i] = Out::from_string(decimal_text(values[i]));
+    }
+#endif
+    return n;
+}
+
+}  // namespace detail
+
+/// Decode fields as FixedPrice; same result as field.as_price() per entry
+/// @return Number of values written (min of both sizes)
+[[nodiscard]] inline size_t decode_prices(
+    std::span<const FieldView> fields, std::span<FixedPrice> out) noexcept
+{
+    return detail::decode_decimals<FixedPrice>(fields, out);
+}
+
+/// Decode raw value spans (e.g. a column of MDEntryPx values) as FixedPrice
+[[nodiscard]] inline size_t decode_prices(
+    std::span<const std::span<const char>> values, std::span<FixedPrice> out) noexcept
+{
+    return detail::decode_decimals<FixedPrice>(values, out);
+}
+
+/// Decode fields as Qty; same result as field.as_qty() per entry
+[[nodiscard]] inline size_t decode_qtys(
+    std::span<const FieldView> fields, std::span<Qty> out) noexcept
+{
+    return detail::decode_decimals<Qty>(fields, out);
+}
+
+/// Decode raw value spans as Qty
+[[nodiscard]] inline size_t decode_qtys(
+    std::span<const std::span<const char>> values, std::span<Qty> out) noexcept
+{
+    return detail::decode_decimals<Qty>(values, out);
+}
+
+} // namespace nfx::parser
@@ -10,8 +10,10 @@
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/util/compiler.hpp"
 #include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/tag_hash.hpp"
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"  // For CACHE_LINE_SIZE
 
 namespace nfx {
@@ -162,6 +164,10 @@ public:
     constexpr explicit FieldIterator(std::span<const char> data) noexcept
         : data_{data}, pos_{0} {}
 
+    /// Start at offset pos (the first byte of a field's tag)
+    constexpr FieldIterator(std::span<const char> data, size_t pos) noexcept
+        : data_{data}, pos_{pos} {}
+
     /// Get next field (returns invalid FieldView if no more fields)
     [[nodiscard]] NFX_HOT constexpr FieldView next() noexcept {
         if (pos_ >= data_.size()) [[unlikely]] {
@@ -171,20 +177,20 @@ public:
 
         const char* __restrict ptr = data_.data();
 
-        // Parse tag number
-        int tag = 0;
+        // Locate '=' then decode the tag digits in one step
+        const size_t tag_start = pos_;
         while (pos_ < data_.size() && ptr[pos_] != fix::EQUALS) [[likely]] {
-            char c = ptr[pos_];
-            if (c < '0' || c > '9') [[unlikely]] {
-                return FieldView{};  // Invalid tag
-            }
-            tag = tag * 10 + (c - '0');
             ++pos_;
         }
 
-        if (pos_ >= data_.size() || ptr[pos_] != fix::EQUALS) [[unlikely]] {
+        if (pos_ >= data_.size()) [[unlikely]] {
             return FieldView{};  // Missing '='
         }
+
+        int tag = parser::decode_tag(data_, tag_start, pos_ - tag_start);
+        if (tag == parser::INVALID_TAG) [[unlikely]] {
+            return FieldView{};  // Invalid tag
+        }
         ++pos_;  // Skip '='
 
         // Find value (until SOH)
@@ -293,6 +299,108 @@ private:
 static_assert(alignof(FieldTable<512>) >= CACHE_LINE_SIZE,
     "FieldTable must be cache-line aligned for optimal memory access");
 
+// ============================================================================
+// Hashed Field Table (known tags via perfect hash, overflow for the rest)
+// ============================================================================
+
+/// Field lookup table keyed by the known-tag perfect hash (tag_hash.hpp)
+/// Known tags map to a unique slot (2KB of values vs 12KB for a
+/// FieldTable<512>); unknown tags, including venue tags above 512, go to
+/// a small overflow list instead of being dropped. Construction only
+/// clears the presence bits, so it is cheap enough to build per message.
+/// Set semantics match FieldTable: a repeated tag overwrites.
+class alignas(CACHE_LINE_SIZE) HashedFieldTable {
+public:
+    static constexpr size_t OVERFLOW_CAPACITY = 32;
+
+    constexpr HashedFieldTable() noexcept
+        : present_{}, overflow_count_{0} {}
+
+    /// Set field value (false if the overflow list is full)
+    constexpr bool set(int tag, std::span<const char> value) noexcept {
+        const size_t slot = tag::known_tag_slot(tag);
+        if (slot != tag::UNKNOWN_TAG_SLOT) [[likely]] {
+            values_[slot] = RawValue{value.data(), value.size()};
+            present_[slot >> 6] |= 1ULL << (slot & 63);
+            return true;
+        }
+        if (tag <= 0) [[unlikely]] return false;
+
+        for (size_t i = 0; i < overflow_count_; ++i) {
+            if (overflow_tags_[i] == tag) {
+                overflow_values_[i] = RawValue{value.data(), value.size()};
+                return true;
+            }
+        }
+        if (overflow_count_ >= OVERFLOW_CAPACITY) [[unlikely]] return false;
+        overflow_tags_[overflow_count_] = tag;
+        overflow_values_[overflow_count_++] = RawValue{value.data(), value.size()};
+        return true;
+    }
+
+    /// Get field value (O(1) for known tags)
+    [[nodiscard]] NFX_HOT constexpr FieldView get(int tag) const noexcept {
+        const size_t slot = tag::known_tag_slot(tag);
+        if (slot != tag::UNKNOWN_TAG_SLOT) [[likely]] {
+            if (!((present_[slot >> 6] >> (slot & 63)) & 1)) return FieldView{};
+            return FieldView{tag, values_[slot].data, values_[slot].size};
+        }
+        for (size_t i = 0; i < overflow_count_; ++i) {
+            if (overflow_tags_[i] == tag) {
+                return FieldView{tag, overflow_values_[i].data, overflow_values_[i].size};
+            }
+        }
+        return FieldView{};
+    }
+
+    /// Check if tag exists
+    [[nodiscard]] NFX_HOT constexpr bool has(int tag) const noexcept {
+        return get(tag).is_valid();
+    }
+
+    /// Get string value for tag
+    [[nodiscard]] NFX_HOT constexpr std::string_view get_string(int tag) const noexcept {
+        return get(tag).as_string();
+    }
+
+    /// Get int value for tag
+    [[nodiscard]] NFX_HOT constexpr std::optional<int64_t> get_int(int tag) const noexcept {
+        return get(tag).as_int();
+    }
+
+    /// Get char value for tag
+    [[nodiscard]] NFX_HOT constexpr char get_char(int tag) const noexcept {
+        return get(tag).as_char();
+    }
+
+    /// Number of unknown tags held in the overflow list
+    [[nodiscard]] constexpr size_t overflow_count() const noexcept {
+        return overflow_count_;
+    }
+
+    /// Clear all entries
+    constexpr void clear() noexcept {
+        present_ = {};
+        overflow_count_ = 0;
+    }
+
+private:
+    /// Trivial value storage: left uninitialized until its presence bit is set
+    struct RawValue {
+        const char* data;
+        size_t size;
+    };
+
+    std::array<uint64_t, tag::KNOWN_TAG_SLOTS / 64> present_;
+    std::array<RawValue, tag::KNOWN_TAG_SLOTS> values_;
+    std::array<int, OVERFLOW_CAPACITY> overflow_tags_;
+    std::array<RawValue, OVERFLOW_CAPACITY> overflow_values_;
+    size_t overflow_count_;
+};
+
+static_assert(tag::KNOWN_TAG_SLOTS % 64 == 0,
+    "HashedFieldTable presence mask uses whole 64-bit words");
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
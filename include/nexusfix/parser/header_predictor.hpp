@@ -0,0 +1,213 @@
+/*
+    NexusFIX Speculative Header Parser
+
+    Busy sessions receive thousands of messages whose standard header is
+    byte-for-byte predictable: the same counterparty always sends
+
+        8=<BeginString>|9=<len>|35=<type>|49=<sender>|56=<target>|34=<seq>|52=<time>|
+
+    HeaderLayoutPredictor learns that layout from the last message and
+    checks it with two memcmp calls (BeginString prefix, CompID block) plus a
+    handful of byte compares around the variable fields. Any mismatch (other
+    field order, different CompIDs, PossDupFlag inside the header block,
+    malformed digits) falls back to parse_header() and re-learns, so results
+    are always identical to parse_header().
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/consteval_parser.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Header Layout Predictor
+// ============================================================================
+
+/// Per-session header parser with a speculative fixed-layout fast path
+class HeaderLayoutPredictor {
+public:
+    /// "8=" + BeginString + SOH + "9="
+    static constexpr size_t MAX_BEGIN_PREFIX = 32;
+
+    /// SOH + "49=" + SenderCompID + SOH + "56=" + TargetCompID + SOH + "34="
+    static constexpr size_t MAX_COMP_BLOCK = 160;
+
+    constexpr HeaderLayoutPredictor() noexcept = default;
+
+    /// Parse header, trying the learned layout first
+    /// Same result as parse_header<Ver>(data) for every input: a layout is
+    /// only learned from a header parse_header<Ver>() accepted, so the
+    /// learned BeginString prefix is always Ver's.
+    template <FixVersion Ver = FixVersion::Unknown>
+    [[nodiscard]] NFX_HOT
+    HeaderParseResult parse(std::span<const char> data) noexcept {
+        HeaderParseResult result;
+        if (learned_ && predict(data, result)) [[likely]] {
+            ++hits_;
+            return result;
+        }
+
+        ++misses_;
+        result = parse_header<Ver>(data);
+        if (result.ok()) {
+            learn(data, result.header);
+        }
+        return result;
+    }
+
+    /// Forget the learned layout (e.g. on reconnect / new counterparty)
+    constexpr void reset() noexcept {
+        learned_ = false;
+        begin_len_ = 0;
+        comp_len_ = 0;
+    }
+
+    [[nodiscard]] constexpr bool has_layout() const noexcept { return learned_; }
+    [[nodiscard]] constexpr uint64_t hits() const noexcept { return hits_; }
+    [[nodiscard]] constexpr uint64_t misses() const noexcept { return misses_; }
+
+private:
+    /// Read ASCII digits up to SOH; false on empty, non-digit or overflow
+    [[nodiscard]] NFX_FORCE_INLINE
+    static bool read_digits(
+        const char* ptr, size_t size, size_t& pos,
+        size_t max_digits, uint64_t& value) noexcept
+    {
+        const size_t start = pos;
+        value = 0;
+        while (pos < size && ptr[pos] != fix::SOH) {
+            const unsigned digit = static_cast<unsigned char>(ptr[pos]) - '0';
+            if (digit > 9 || pos - start >= max_digits) [[unlikely]] return false;
+            value = value * 10 + digit;
+            ++pos;
+        }
+        return pos > start && pos < size;
+    }
+
+    /// Advance pos to the next SOH; false if none
+    [[nodiscard]] NFX_FORCE_INLINE
+    static bool skip_to_soh(const char* ptr, size_t size, size_t& pos) noexcept {
+        while (pos < size && ptr[pos] != fix::SOH) ++pos;
+        return pos < size;
+    }
+
+    /// Fast path: verify the learned layout and fill result
+    [[nodiscard]] NFX_HOT
+    bool predict(std::span<const char> data, HeaderParseResult& result) const noexcept {
+        const char* __restrict ptr = data.data();
+        const size_t size = data.size();
+        if (size < fix::MIN_MESSAGE_SIZE) [[unlikely]] return false;
+
+        // 8=FIX.4.4|9=
+        if (size < begin_len_ ||
+            std::memcmp(ptr, begin_prefix_, begin_len_) != 0) [[unlikely]] {
+            return false;
+        }
+        size_t pos = begin_len_;
+
+        uint64_t body_length;
+        if (!read_digits(ptr, size, pos, 9, body_length)) [[unlikely]] return false;
+
+        // |35=<type>
+        if (pos + 5 > size || ptr[pos + 1] != '3' || ptr[pos + 2] != '5' ||
+            ptr[pos + 3] != '=') [[unlikely]] {
+            return false;
+        }
+        pos += 4;
+        const size_t type_start = pos;
+        if (!skip_to_soh(ptr, size, pos) || pos == type_start) [[unlikely]] return false;
+
+        // |49=SENDER|56=TARGET|34=
+        const size_t comp_start = pos;
+        if (pos + comp_len_ > size ||
+            std::memcmp(ptr + pos, comp_block_, comp_len_) != 0) [[unlikely]] {
+            return false;
+        }
+        pos += comp_len_;
+
+        uint64_t seq_num;
+        if (!read_digits(ptr, size, pos, 9, seq_num)) [[unlikely]] return false;
+
+        // |52=<time>|
+        if (pos + 4 > size || ptr[pos + 1] != '5' || ptr[pos + 2] != '2' ||
+            ptr[pos + 3] != '=') [[unlikely]] {
+            return false;
+        }
+        pos += 4;
+        const size_t time_start = pos;
+        if (!skip_to_soh(ptr, size, pos)) [[unlikely]] return false;
+
+        MessageHeader& header = result.header;
+        header.begin_string = std::string_view{ptr + 2, begin_len_ - 5};
+        header.body_length = static_cast<int>(body_length);
+        header.msg_type = ptr[type_start];
+        header.sender_comp_id = std::string_view{ptr + comp_start + 4, sender_len_};
+        header.target_comp_id = std::string_view{ptr + comp_start + sender_len_ + 8, target_len_};
+        header.msg_seq_num = static_cast<uint32_t>(seq_num);
+        header.sending_time = std::string_view{ptr + time_start, pos - time_start};
+        result.body_start = pos + 1;
+        result.error = detail::validate_header_fields(header);
+        return true;
+    }
+
+    /// Build the templates from a generically parsed header, then keep
+    /// them only if this very message matches (layout really is fixed).
+    /// A one-off message in another layout (e.g. PossDupFlag in the header
+    /// of a resend) keeps the previously learned layout.
+    void learn(std::span<const char> data, const MessageHeader& header) noexcept {
+        const HeaderLayoutPredictor previous = *this;
+
+        const size_t begin_len = header.begin_string.size() + 5;
+        const size_t comp_len =
+            header.sender_comp_id.size() + header.target_comp_id.size() + 12;
+        if (begin_len > MAX_BEGIN_PREFIX || comp_len > MAX_COMP_BLOCK) [[unlikely]] {
+            return;
+        }
+
+        char* out = begin_prefix_;
+        *out++ = '8'; *out++ = '=';
+        std::memcpy(out, header.begin_string.data(), header.begin_string.size());
+        out += header.begin_string.size();
+        *out++ = fix::SOH; *out++ = '9'; *out++ = '=';
+        begin_len_ = begin_len;
+
+        out = comp_block_;
+        *out++ = fix::SOH; *out++ = '4'; *out++ = '9'; *out++ = '=';
+        std::memcpy(out, header.sender_comp_id.data(), header.sender_comp_id.size());
+        out += header.sender_comp_id.size();
+        *out++ = fix::SOH; *out++ = '5'; *out++ = '6'; *out++ = '=';
+        std::memcpy(out, header.target_comp_id.data(), header.target_comp_id.size());
+        out += header.target_comp_id.size();
+        *out++ = fix::SOH; *out++ = '3'; *out++ = '4'; *out++ = '=';
+        comp_len_ = comp_len;
+
+        sender_len_ = header.sender_comp_id.size();
+        target_len_ = header.target_comp_id.size();
+
+        HeaderParseResult check;
+        learned_ = true;
+        if (!predict(data, check)) {
+            *this = previous;
+        }
+    }
+
+    char begin_prefix_[MAX_BEGIN_PREFIX]{};
+    char comp_block_[MAX_COMP_BLOCK]{};
+    size_t begin_len_{0};
+    size_t comp_len_{0};
+    size_t sender_len_{0};
+    size_t target_len_{0};
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+    bool learned_{false};
+};
+
+} // namespace nfx
@@ -0,0 +1,236 @@
+/*
+    NexusFIX Message Reassembler
+
+    Frames FIX messages directly inside kernel-provided receive buffers
+    (io_uring ProvidedBufferGroup / multishot recv) and carries partial
+    messages across buffer boundaries.
+
+    - Messages fully inside one buffer are delivered as spans into that
+      buffer (zero-copy). The buffer is released as soon as the last
+      complete message in it has been handled.
+    - A trailing partial message pins its buffer (no copy) until the next
+      buffer arrives. The straddling message is then assembled with one
+      bounded copy (tail + head) into a PaddedMessageBuffer and the pinned
+      buffer is released immediately.
+    - At most one buffer is pinned at a time; a message spanning three or
+      more buffers keeps accumulating in the padded buffer.
+
+    Buffer ownership is expressed through a release callback, so the
+    reassembler has no io_uring dependency and can run against any
+    buffer-id based receive path.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <span>
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Reassembly Statistics
+// ============================================================================
+
+struct ReassemblyStats {
+    uint64_t zero_copy_messages{0};   // Delivered in place
+    uint64_t copied_messages{0};      // Straddled buffers, assembled by copy
+    uint64_t copied_bytes{0};         // Bytes written to the padded buffer
+    uint64_t garbled_bytes{0};        // Bytes skipped while resynchronising
+};
+
+// ============================================================================
+// Message Reassembler
+// ============================================================================
+
+/// Buffer-id aware framer for zero-copy receive paths
+/// @tparam MaxMessageSize Largest message that can straddle buffers
+template <size_t MaxMessageSize = 4096>
+class MessageReassembler {
+public:
+    static constexpr size_t MAX_MESSAGE_SIZE = MaxMessageSize;
+    static constexpr uint32_t NO_BUFFER = UINT32_MAX;
+
+    MessageReassembler() noexcept = default;
+
+    // Non-copyable: holds a pinned buffer reference
+    MessageReassembler(const MessageReassembler&) = delete;
+    MessageReassembler& operator=(const MessageReassembler&) = delete;
+
+    /// Process one receive completion
+    /// @param buf_id Buffer id owning data (passed back to release)
+    /// @param data Received bytes
+    /// @param on_message Called with each complete message span; the span
+    ///        is only valid for the duration of the call
+    /// @param release Called with a buffer id once no message references it
+    /// @return Number of messages delivered
+    template <typename OnMessage, typename OnRelease>
+    size_t feed(
+        uint16_t buf_id,
+        std::span<const char> data,
+        OnMessage&& on_message,
+        OnRelease&& release) noexcept
+    {
+        size_t delivered = 0;
+        size_t cursor = 0;
+
+        // Finish the message carried over from previous buffers
+        if (pinned_id_ != NO_BUFFER || !stash_.empty()) [[unlikely]] {
+            cursor = complete_partial(data, on_message, release, delivered);
+            if (cursor == data.size() && !stash_.empty()) {
+                release(buf_id);  // Fully copied into the stash
+                return delivered;
+            }
+        }
+
+        // Common case: frame in place
+        while (cursor < data.size()) [[likely]] {
+            const simd::MessageBoundary boundary = detail::frame_message(data, cursor);
+            if (!boundary.complete) {
+                if (boundary.start > cursor) {
+                    stats_.garbled_bytes += boundary.start - cursor;
+                    cursor = boundary.start;
+                } else if (boundary.start < cursor) {
+                    // No message start found: keep only the bytes after the
+                    // last SOH, which may be the first bytes of the next one
+                    size_t last = data.size();
+                    while (last > cursor && data[last - 1] != fix::SOH) --last;
+                    stats_.garbled_bytes += last - cursor;
+                    cursor = last;
+                }
+                break;
+            }
+            if (boundary.start > cursor) [[unlikely]] {
+                stats_.garbled_bytes += boundary.start - cursor;
+            }
+
+            on_message(boundary.slice(data));
+            ++stats_.zero_copy_messages;
+            ++delivered;
+            cursor = boundary.end;
+        }
+
+        if (cursor < data.size()) {
+            // Partial tail: keep the buffer, copy nothing yet
+            pinned_id_ = buf_id;
+            pinned_tail_ = data.subspan(cursor);
+        } else {
+            release(buf_id);
+        }
+        return delivered;
+    }
+
+    /// Drop any partial message and release the pinned buffer
+    template <typename OnRelease>
+    void reset(OnRelease&& release) noexcept {
+        if (pinned_id_ != NO_BUFFER) {
+            release(static_cast<uint16_t>(pinned_id_));
+            pinned_id_ = NO_BUFFER;
+            pinned_tail_ = {};
+        }
+        stash_.clear();
+    }
+
+    /// True while a partial message is held (pinned or copied)
+    [[nodiscard]] bool has_partial() const noexcept {
+        return pinned_id_ != NO_BUFFER || !stash_.empty();
+    }
+
+    /// Buffer currently pinned by a partial message, or NO_BUFFER
+    [[nodiscard]] uint32_t pinned_buffer() const noexcept {
+        return pinned_id_;
+    }
+
+    [[nodiscard]] const ReassemblyStats& stats() const noexcept {
+        return stats_;
+    }
+
+private:
+    /// Assemble the carried-over message from pinned tail + data head
+    /// Returns the offset in data where in-place framing resumes.
+    template <typename OnMessage, typename OnRelease>
+    size_t complete_partial(
+        std::span<const char> data,
+        OnMessage& on_message,
+        OnRelease& release,
+        size_t& delivered) noexcept
+    {
+        // Single copy of the pinned tail; its buffer goes back right away
+        if (pinned_id_ != NO_BUFFER) {
+            stats_.copied_bytes += stash_.append(pinned_tail_);
+            release(static_cast<uint16_t>(pinned_id_));
+            pinned_id_ = NO_BUFFER;
+            pinned_tail_ = {};
+        }
+
+        size_t cursor = 0;
+        size_t msg_size = detail::declared_message_size(stash_.data(), 0);
+
+        // Header itself straddled: pull in just enough to read BodyLength
+        while (msg_size == detail::MESSAGE_SIZE_UNKNOWN && cursor < data.size()) {
+            const size_t step = std::min(HEADER_PROBE, data.size() - cursor);
+            const size_t copied = stash_.append(data.subspan(cursor, step));
+            stats_.copied_bytes += copied;
+            cursor += copied;
+            msg_size = detail::declared_message_size(stash_.data(), 0);
+            if (copied == 0) break;
+        }
+        if (msg_size == detail::MESSAGE_SIZE_UNKNOWN) {
+            if (stash_.size() == MaxMessageSize) [[unlikely]] {
+                return resync(cursor);  // No header within the size limit
+            }
+            return cursor;  // Still waiting for the header
+        }
+
+        if (msg_size == detail::MESSAGE_SIZE_INVALID || msg_size > MaxMessageSize) [[unlikely]] {
+            return resync(cursor);
+        }
+        if (stash_.size() > msg_size) {
+            // Header probe overshot a short message: hand the bytes back
+            const size_t overshoot = stash_.size() - msg_size;
+            cursor -= overshoot;
+            stats_.copied_bytes -= overshoot;
+            stash_.set_size(msg_size);
+        }
+
+        // Copy exactly the rest of the message
+        const size_t need = msg_size - stash_.size();
+        const size_t copied = stash_.append(
+            data.subspan(cursor, std::min(need, data.size() - cursor)));
+        stats_.copied_bytes += copied;
+        cursor += copied;
+        if (stash_.size() < msg_size) {
+            return cursor;  // Spans a further buffer
+        }
+
+        if (!detail::has_trailer_at(stash_.data().data(), msg_size)) [[unlikely]] {
+            return resync(cursor);
+        }
+
+        on_message(stash_.data());
+        ++stats_.copied_messages;
+        ++delivered;
+        stash_.clear();
+        return cursor;
+    }
+
+    /// Discard a corrupt partial; framing restarts at the next "8=" in data
+    [[nodiscard]] size_t resync(size_t cursor) noexcept {
+        stats_.garbled_bytes += stash_.size();
+        stash_.clear();
+        return cursor;  // frame_message() skips to the next message start
+    }
+
+    /// Bytes pulled per step while the header itself is incomplete
+    static constexpr size_t HEADER_PROBE = 32;
+
+    simd::PaddedMessageBuffer<MaxMessageSize> stash_;
+    std::span<const char> pinned_tail_{};
+    uint32_t pinned_id_{NO_BUFFER};
+    ReassemblyStats stats_{};
+};
+
+} // namespace nfx
@@ -4,10 +4,14 @@
 #include <string_view>
 #include <cstdint>
 #include <array>
+#include <algorithm>
+#include <memory_resource>
+#include <new>
 #include <optional>
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/tag_hash.hpp"
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/market_data_types.hpp"
 #include "nexusfix/parser/field_view.hpp"
@@ -200,13 +204,290 @@ private:
     size_t current_pos_{0};
 };
 
+// ============================================================================
+// Repeating Group Index
+// ============================================================================
+
+/// One-pass index over a repeating group for O(1) per-entry field access.
+/// build() walks the group once (same entry boundaries as
+/// RepeatingGroupIterator) and records, for each requested tag, the value
+/// offset/length of every entry in struct-of-arrays columns:
+///
+///     column c:  offsets[0..count), lengths[0..count)
+///
+/// Column storage is a single block from a std::pmr::memory_resource, so a
+/// MonotonicPool sized with storage_bytes() keeps the hot path
+/// allocation-free. Tags that were not requested still resolve through a
+/// scan of the entry's own bytes.
+class RepeatingGroupIndex {
+public:
+    static constexpr size_t MAX_COLUMNS = 16;
+    static constexpr uint8_t NO_COLUMN = 0xFF;
+    static constexpr uint32_t ABSENT = UINT32_MAX;
+
+    /// View of one indexed entry
+    class Entry {
+    public:
+        constexpr Entry(const RepeatingGroupIndex* index, size_t i) noexcept
+            : index_{index}, i_{i} {}
+
+        /// Field value by tag: column load for indexed tags, else entry scan
+        [[nodiscard]] NFX_HOT
+        FieldView get(int target_tag) const noexcept {
+            const uint8_t col = index_->column_of(target_tag);
+            if (col != NO_COLUMN) [[likely]] {
+                return index_->value_at(i_, col, target_tag);
+            }
+            return index_->scan_entry(i_, target_tag);
+        }
+
+        [[nodiscard]] std::string_view get_string(int target_tag) const noexcept {
+            auto fv = get(target_tag);
+            return std::string_view{fv.value.data(), fv.value.size()};
+        }
+
+        [[nodiscard]] char get_char(int target_tag) const noexcept {
+            auto fv = get(target_tag);
+            return fv.is_valid() && !fv.value.empty() ? fv.value[0] : '\0';
+        }
+
+        [[nodiscard]] std::optional<int64_t> get_int(int tag) const noexcept {
+            return get(tag).as_int();
+        }
+
+        [[nodiscard]] FixedPrice get_price(int tag) const noexcept {
+            return get(tag).as_price();
+        }
+
+        [[nodiscard]] Qty get_qty(int tag) const noexcept {
+            return get(tag).as_qty();
+        }
+
+        /// Raw bytes of this entry (delimiter tag up to the next entry)
+        [[nodiscard]] std::span<const char> data() const noexcept {
+            return index_->entry_data(i_);
+        }
+
+    private:
+        const RepeatingGroupIndex* index_;
+        size_t i_;
+    };
+
+    explicit RepeatingGroupIndex(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept
+        : resource_{resource}
+    {
+        column_of_slot_.fill(NO_COLUMN);
+    }
+
+    ~RepeatingGroupIndex() { release(); }
+
+    // Non-copyable: owns a block from resource_
+    RepeatingGroupIndex(const RepeatingGroupIndex&) = delete;
+    RepeatingGroupIndex& operator=(const RepeatingGroupIndex&) = delete;
+
+    /// Column storage needed for entries x columns (size the arena with this)
+    /// Adds alignment slack so a monotonic resource never falls upstream.
+    [[nodiscard]] static constexpr size_t storage_bytes(
+        size_t entries, size_t columns) noexcept
+    {
+        return entries * (2 + 2 * columns) * sizeof(uint32_t) + alignof(uint32_t);
+    }
+
+    /// Walk the group once and fill the offset columns
+    /// @param data Message bytes containing the group
+    /// @param delimiter_tag First tag of each entry (e.g. 269 MDEntryType)
+    /// @param count Declared entry count (NoXxx field)
+    /// @param tags Tags to index (at most MAX_COLUMNS, order = column number)
+    /// @return false if tags exceed MAX_COLUMNS or the resource is exhausted
+    [[nodiscard]] NFX_HOT
+    bool build(
+        std::span<const char> data,
+        int delimiter_tag,
+        size_t count,
+        std::span<const int> tags) noexcept
+    {
+        reset_columns();
+        data_ = data;
+        if (tags.size() > MAX_COLUMNS) [[unlikely]] return false;
+
+        // Every entry needs at least "N=v|"; bounds a corrupt NoXxx count
+        count = std::min(count, data.size() / 4);
+        if (!reserve(count, tags.size())) [[unlikely]] return false;
+
+        for (size_t c = 0; c < tags.size(); ++c) {
+            column_tags_[c] = tags[c];
+            const size_t slot = tag::known_tag_slot(tags[c]);
+            if (slot != tag::UNKNOWN_TAG_SLOT) {
+                column_of_slot_[slot] = static_cast<uint8_t>(c);
+            }
+        }
+        column_count_ = tags.size();
+        for (size_t c = 0; c < column_count_ * capacity_; ++c) {
+            offsets_[c] = ABSENT;
+        }
+
+        size_ = 0;
+        if (count == 0) return true;
+
+        FieldIterator iter{data};
+        while (iter.has_next()) [[likely]] {
+            const size_t field_start = iter.position();
+            FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] break;
+
+            if (field.tag == delimiter_tag && size_ < count) {
+                // New entry; the last one runs to the trailer like the iterator
+                if (size_ > 0) entry_end_[size_ - 1] = static_cast<uint32_t>(field_start);
+                entry_begin_[size_] = static_cast<uint32_t>(field_start);
+                ++size_;
+            } else if (field.tag == tag::CheckSum::value) [[unlikely]] {
+                if (size_ > 0) entry_end_[size_ - 1] = static_cast<uint32_t>(field_start);
+                return true;
+            }
+            if (size_ == 0) continue;  // Fields before the first entry
+
+            const uint8_t col = column_of(field.tag);
+            if (col == NO_COLUMN) continue;
+
+            // First occurrence within the entry wins (matches get_field)
+            const size_t cell = col * capacity_ + (size_ - 1);
+            if (offsets_[cell] == ABSENT) {
+                offsets_[cell] = static_cast<uint32_t>(field.value.data() - data.data());
+                lengths_[cell] = static_cast<uint32_t>(field.value.size());
+            }
+        }
+
+        if (size_ > 0) entry_end_[size_ - 1] = static_cast<uint32_t>(data.size());
+        return true;
+    }
+
+    /// Number of entries found (at most the declared count)
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] Entry entry(size_t i) const noexcept { return Entry{this, i}; }
+    [[nodiscard]] Entry operator[](size_t i) const noexcept { return entry(i); }
+
+    /// Column number of an indexed tag, or NO_COLUMN
+    [[nodiscard]] NFX_FORCE_INLINE
+    uint8_t column_of(int target_tag) const noexcept {
+        const size_t slot = tag::known_tag_slot(target_tag);
+        if (slot != tag::UNKNOWN_TAG_SLOT) [[likely]] {
+            return column_of_slot_[slot];
+        }
+        for (size_t c = 0; c < column_count_; ++c) {
+            if (column_tags_[c] == target_tag) return static_cast<uint8_t>(c);
+        }
+        return NO_COLUMN;
+    }
+
+    /// Column offsets over all entries (ABSENT where the tag is missing)
+    [[nodiscard]] std::span<const uint32_t> column_offsets(uint8_t col) const noexcept {
+        return {offsets_ + col * capacity_, size_};
+    }
+
+    /// Column value lengths over all entries
+    [[nodiscard]] std::span<const uint32_t> column_lengths(uint8_t col) const noexcept {
+        return {lengths_ + col * capacity_, size_};
+    }
+
+private:
+    [[nodiscard]] NFX_FORCE_INLINE
+    FieldView value_at(size_t i, uint8_t col, int target_tag) const noexcept {
+        const size_t cell = col * capacity_ + i;
+        if (i >= size_ || offsets_[cell] == ABSENT) [[unlikely]] return FieldView{};
+        return FieldView{target_tag, data_.data() + offsets_[cell], lengths_[cell]};
+    }
+
+    [[nodiscard]] std::span<const char> entry_data(size_t i) const noexcept {
+        if (i >= size_) [[unlikely]] return {};
+        return data_.subspan(entry_begin_[i], entry_end_[i] - entry_begin_[i]);
+    }
+
+    [[nodiscard]] FieldView scan_entry(size_t i, int target_tag) const noexcept {
+        FieldIterator iter{entry_data(i)};
+        while (iter.has_next()) [[likely]] {
+            FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] break;
+            if (field.tag == target_tag) [[unlikely]] return field;
+        }
+        return FieldView{};
+    }
+
+    /// Ensure the block holds entries x columns; reuses a large enough block
+    [[nodiscard]] bool reserve(size_t entries, size_t columns) noexcept {
+        const size_t words = entries * (2 + 2 * columns);
+        if (words > block_words_) {
+            release();
+            try {
+                block_ = static_cast<uint32_t*>(
+                    resource_->allocate(words * sizeof(uint32_t), alignof(uint32_t)));
+            } catch (const std::bad_alloc&) {
+                return false;  // Arena exhausted
+            }
+            block_words_ = words;
+        }
+        capacity_ = entries;
+        entry_begin_ = block_;
+        entry_end_ = block_ + entries;
+        offsets_ = block_ + 2 * entries;
+        lengths_ = offsets_ + columns * entries;
+        return true;
+    }
+
+    void release() noexcept {
+        if (block_ != nullptr) {
+            resource_->deallocate(block_, block_words_ * sizeof(uint32_t), alignof(uint32_t));
+            block_ = nullptr;
+            block_words_ = 0;
+        }
+    }
+
+    void reset_columns() noexcept {
+        for (size_t c = 0; c < column_count_; ++c) {
+            const size_t slot = tag::known_tag_slot(column_tags_[c]);
+            if (slot != tag::UNKNOWN_TAG_SLOT) column_of_slot_[slot] = NO_COLUMN;
+        }
+        column_count_ = 0;
+        size_ = 0;
+    }
+
+    std::pmr::memory_resource* resource_;
+    uint32_t* block_{nullptr};
+    size_t block_words_{0};
+
+    // Struct-of-arrays views into block_
+    uint32_t* entry_begin_{nullptr};
+    uint32_t* entry_end_{nullptr};
+    uint32_t* offsets_{nullptr};
+    uint32_t* lengths_{nullptr};
+    size_t capacity_{0};
+    size_t size_{0};
+
+    std::span<const char> data_{};
+    std::array<uint8_t, tag::KNOWN_TAG_SLOTS> column_of_slot_{};
+    std::array<int, MAX_COLUMNS> column_tags_{};
+    size_t column_count_{0};
+};
+
 // ============================================================================
 // MD Entry Parser Helper
 // ============================================================================
 
-/// Parse a single MDEntry from a repeating group entry
+/// Tags read by parse_md_entry (columns for a RepeatingGroupIndex)
+inline constexpr std::array<int, 10> MD_ENTRY_TAGS = {
+    tag::MDEntryType::value, tag::MDEntryPx::value, tag::MDEntrySize::value,
+    tag::MDUpdateAction::value, tag::MDEntryID::value, tag::Symbol::value,
+    tag::MDEntryDate::value, tag::MDEntryTime::value,
+    tag::MDEntryPositionNo::value, tag::NumberOfOrders::value
+};
+
+namespace detail {
+
+/// Shared by the scanning and the indexed entry types
+template <typename EntryT>
 [[nodiscard]] NFX_HOT
-inline MDEntry parse_md_entry(const RepeatingGroupIterator::Entry& entry) noexcept {
+inline MDEntry parse_md_entry_impl(const EntryT& entry) noexcept {
     MDEntry md;
 
     if (auto c = entry.get_char(tag::MDEntryType::value); c != '\0') {
@@ -236,6 +517,140 @@ inline MDEntry parse_md_entry(const RepeatingGroupIterator::Entry& entry) noexce
     return md;
 }
 
+}  // namespace detail
+
+/// Parse a single MDEntry from a repeating group entry
+[[nodiscard]] NFX_HOT
+inline MDEntry parse_md_entry(const RepeatingGroupIterator::Entry& entry) noexcept {
+    return detail::parse_md_entry_impl(entry);
+}
+
+/// Parse a single MDEntry from an indexed entry (column loads, no rescans)
+[[nodiscard]] NFX_HOT
+inline MDEntry parse_md_entry(const RepeatingGroupIndex::Entry& entry) noexcept {
+    return detail::parse_md_entry_impl(entry);
+}
+
+// ============================================================================
+// Columnar MD Entry Decoder
+// ============================================================================
+
+/// Decode a NoMDEntries group straight into MDEntryColumns (no MDEntry rows)
+/// Single FieldIterator pass; entry boundaries and first-occurrence-wins
+/// match RepeatingGroupIterator + parse_md_entry, absent fields keep the
+/// MDEntry defaults. Rows without Symbol (55) get default_symbol (the
+/// snapshot's message-level symbol) or NO_SYMBOL.
+/// @return Number of rows decoded (out.truncated set if Capacity was hit)
+template <size_t Capacity>
+[[nodiscard]] NFX_HOT
+inline size_t decode_md_entries(
+    std::span<const char> data,
+    int delimiter_tag,
+    size_t count,
+    MDEntryColumns<Capacity>& out,
+    std::string_view default_symbol = {}) noexcept
+{
+    using Columns = MDEntryColumns<Capacity>;
+
+    // Per-row "already set" bits, so the first occurrence wins
+    enum : uint8_t {
+        SEEN_ACTION = 1, SEEN_TYPE = 2, SEEN_PRICE = 4, SEEN_SIZE = 8, SEEN_SYMBOL = 16,
+        SEEN_POSITION = 32, SEEN_ORDERS = 64, SEEN_RPT_SEQ = 128
+    };
+
+    out.clear();
+    if (count == 0) return 0;
+    const uint16_t default_id = default_symbol.empty()
+        ? Columns::NO_SYMBOL : out.intern_symbol(default_symbol);
+
+    size_t row = 0;
+    uint8_t seen = 0;
+    FieldIterator iter{data};
+    while (iter.has_next()) [[likely]] {
+        FieldView field = iter.next();
+        if (!field.is_valid()) [[unlikely]] break;
+
+        if (field.tag == delimiter_tag && out.count < count) {
+            if (out.count == Capacity) [[unlikely]] {
+                out.truncated = true;
+                break;
+            }
+            row = out.count++;
+            seen = 0;
+            out.update_action[row] = MDUpdateAction::New;
+            out.entry_type[row] = MDEntryType::Bid;
+            out.price[row] = FixedPrice{};
+            out.size[row] = Qty{};
+            out.symbol_id[row] = default_id;
+            out.position_no[row] = 0;
+            out.number_of_orders[row] = 0;
+            out.rpt_seq[row] = 0;
+        } else if (field.tag == tag::CheckSum::value) [[unlikely]] {
+            break;
+        }
+        if (out.count == 0 || field.value.empty()) continue;
+
+        switch (field.tag) {
+            case tag::MDUpdateAction::value:
+                if (!(seen & SEEN_ACTION)) {
+                    out.update_action[row] = static_cast<MDUpdateAction>(field.value[0]);
+                    seen |= SEEN_ACTION;
+                }
+                break;
+            case tag::MDEntryType::value:
+                if (!(seen & SEEN_TYPE)) {
+                    out.entry_type[row] = static_cast<MDEntryType>(field.value[0]);
+                    seen |= SEEN_TYPE;
+                }
+                break;
+            case tag::MDEntryPx::value:
+                if (!(seen & SEEN_PRICE)) {
+                    out.price[row] = field.as_price();
+                    seen |= SEEN_PRICE;
+                }
+                break;
+            case tag::MDEntrySize::value:
+                if (!(seen & SEEN_SIZE)) {
+                    out.size[row] = field.as_qty();
+                    seen |= SEEN_SIZE;
+                }
+                break;
+            case tag::Symbol::value:
+                if (!(seen & SEEN_SYMBOL)) {
+                    out.symbol_id[row] = out.intern_symbol(field.as_string());
+                    seen |= SEEN_SYMBOL;
+                }
+                break;
+            case tag::MDEntryPositionNo::value:
+                if (!(seen & SEEN_POSITION)) {
+                    const auto pos = field.as_int().value_or(0);
+                    out.position_no[row] = pos > 0 && pos <= UINT16_MAX
+                        ? static_cast<uint16_t>(pos) : uint16_t{0};
+                    seen |= SEEN_POSITION;
+                }
+                break;
+            case tag::NumberOfOrders::value:
+                if (!(seen & SEEN_ORDERS)) {
+                    const auto orders = field.as_int().value_or(0);
+                    out.number_of_orders[row] = orders > 0 ? static_cast<uint32_t>(orders) : 0u;
+                    seen |= SEEN_ORDERS;
+                }
+                break;
+            case tag::RptSeq::value:
+                if (!(seen & SEEN_RPT_SEQ)) {
+                    const auto seq = field.as_int().value_or(0);
+                    out.rpt_seq[row] = seq > 0 && seq <= UINT32_MAX ? static_cast<uint32_t>(seq) : 0u;
+                    seen |= SEEN_RPT_SEQ;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    return out.count;
+}
+
 // ============================================================================
 // Related Symbol Parser Helper
 // ============================================================================
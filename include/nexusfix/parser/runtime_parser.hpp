@@ -9,14 +9,20 @@
 
 #include <span>
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/types/wire_timestamp.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/parser/field_view.hpp"
 #include "nexusfix/parser/simd_scanner.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
 #include "nexusfix/parser/consteval_parser.hpp"
+#include "nexusfix/parser/header_predictor.hpp"
 
 namespace nfx {
 
@@ -42,12 +48,68 @@ public:
         std::span<const char> data) noexcept
     {
         ParsedMessage msg;
+        auto error = parse_into(data, msg);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
+        return msg;
+    }
+
+    /// Parse from buffer, taking the header from a session's predictor
+    /// The predictor skips the generic header scan when the counterparty's
+    /// fixed header layout matches (see HeaderLayoutPredictor).
+    [[nodiscard]] NFX_HOT
+    static ParseResult<ParsedMessage> parse(
+        std::span<const char> data,
+        HeaderLayoutPredictor& predictor) noexcept
+    {
+        ParsedMessage msg;
+        auto error = parse_into(data, predictor, msg);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
+        return msg;
+    }
+
+    /// parse() writing into an existing message
+    /// The ~3 KB field array is neither constructed nor moved through
+    /// ParseResult: callers keep one message (a session member, an
+    /// ObjectPool slot) and reuse it. On error msg holds a partial parse.
+    /// @tparam Ver Version a session is fixed to (see parse_header())
+    template <FixVersion Ver = FixVersion::Unknown>
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_into(
+        std::span<const char> data,
+        ParsedMessage& msg) noexcept
+    {
+        return parse_with_header(data, parse_header<Ver>(data), msg);
+    }
+
+    /// parse(data, predictor) writing into an existing message
+    template <FixVersion Ver = FixVersion::Unknown>
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_into(
+        std::span<const char> data,
+        HeaderLayoutPredictor& predictor,
+        ParsedMessage& msg) noexcept
+    {
+        return parse_with_header(data, predictor.parse<Ver>(data), msg);
+    }
+
+private:
+    /// parse_into() body once the header has been parsed
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_with_header(
+        std::span<const char> data,
+        const HeaderParseResult& header_result,
+        ParsedMessage& msg) noexcept
+    {
         msg.raw_ = data;
+        msg.field_count_ = 0;
+        msg.rx_timestamp_ = WireTimestamp{};
 
-        // Parse header
-        auto header_result = parse_header(data);
         if (!header_result.ok()) [[unlikely]] {
-            return std::unexpected{header_result.error};
+            return header_result.error;
         }
         msg.header_ = header_result.header;
 
@@ -62,19 +124,13 @@ public:
             // Find '=' separator
             size_t eq_pos = simd::find_equals(data, field_start);
             if (eq_pos >= field_end) [[unlikely]] {
-                return std::unexpected{ParseError{
-                    ParseErrorCode::InvalidFieldFormat, 0, field_start}};
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, field_start};
             }
 
             // Parse tag number
-            int tag = 0;
-            for (size_t j = field_start; j < eq_pos; ++j) [[likely]] {
-                char c = ptr[j];
-                if (c < '0' || c > '9') [[unlikely]] {
-                    return std::unexpected{ParseError{
-                        ParseErrorCode::InvalidTagNumber, 0, j}};
-                }
-                tag = tag * 10 + (c - '0');
+            int tag = parser::decode_tag(data, field_start, eq_pos - field_start);
+            if (tag == parser::INVALID_TAG) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidTagNumber, 0, field_start};
             }
 
             // Create field view (zero-copy)
@@ -90,14 +146,117 @@ public:
         }
 
         // Validate checksum
-        auto checksum_error = validate_checksum(data);
-        if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
-            return std::unexpected{checksum_error};
-        }
+        return validate_checksum(data);
+    }
 
+public:
+    /// Parse from buffer in a single structural pass (zero-copy)
+    /// SOH and '=' positions and the byte sum come from one SIMD sweep
+    /// (simd::build_index_with_checksum) and feed FieldView construction
+    /// directly. The header is taken from the located fields and the
+    /// checksum is derived from the fused byte sum, so the buffer is not
+    /// rescanned. Falls back to parse() for messages
+    /// the structural index cannot hold.
+    [[nodiscard]] NFX_HOT
+    static ParseResult<ParsedMessage> parse_structural(
+        std::span<const char> data) noexcept
+    {
+        ParsedMessage msg;
+        auto error = parse_structural_into(data, msg);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
         return msg;
     }
 
+    /// parse_structural() writing into an existing message
+    /// Avoids moving the field array through ParseResult; used by
+    /// parse_batch() to fill caller-provided output slots in place.
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_structural_into(
+        std::span<const char> data,
+        ParsedMessage& msg) noexcept
+    {
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+            return ParseError{ParseErrorCode::BufferTooShort};
+        }
+
+        const simd::FIXStructuralIndex idx = data.size() <= UINT16_MAX
+            ? simd::build_index_with_checksum(data)
+            : simd::FIXStructuralIndex{};
+        if (data.size() > UINT16_MAX ||  // Index positions are 16-bit
+            idx.soh_count > MAX_FIELDS ||
+            idx.equals_count >= simd::MAX_FIELDS) [[unlikely]] {
+            return parse_into(data, msg);
+        }
+
+        msg.raw_ = data;
+        msg.field_count_ = 0;
+        msg.rx_timestamp_ = WireTimestamp{};
+        const char* __restrict ptr = data.data();
+
+        // Pair each SOH with the first '=' after the previous SOH.
+        // '=' inside values is skipped by the cursor, not mis-paired.
+        size_t field_start = 0;
+        size_t eq_cursor = 0;
+        for (size_t i = 0; i < idx.soh_count; ++i) [[likely]] {
+            const size_t field_end = idx.soh_positions[i];
+
+            while (eq_cursor < idx.equals_count &&
+                   idx.equals_positions[eq_cursor] < field_start) {
+                ++eq_cursor;
+            }
+            if (eq_cursor >= idx.equals_count ||
+                idx.equals_positions[eq_cursor] >= field_end) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, field_start};
+            }
+            const size_t eq_pos = idx.equals_positions[eq_cursor];
+
+            int tag = parser::decode_tag(data, field_start, eq_pos - field_start);
+            if (tag == parser::INVALID_TAG) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidTagNumber, 0, field_start};
+            }
+
+            msg.fields_[msg.field_count_++] = FieldView{
+                tag,
+                std::span<const char>{ptr + eq_pos + 1, field_end - eq_pos - 1}
+            };
+
+            field_start = field_end + 1;
+        }
+
+        if (msg.field_count_ == 0) [[unlikely]] {
+            return ParseError{ParseErrorCode::InvalidFieldFormat};
+        }
+
+        // Header from the leading fields (same rules as parse_header)
+        HeaderParseResult header_result;
+        int header_fields = 0;
+        for (size_t i = 0; i < msg.field_count_ && header_fields < 7; ++i) {
+            if (!detail::assign_header_field(
+                    header_result, msg.fields_[i], header_fields)) [[unlikely]] {
+                break;
+            }
+            if (!header_result.ok()) [[unlikely]] {
+                return header_result.error;
+            }
+        }
+        auto header_error = detail::validate_header_fields(header_result.header);
+        if (header_error.code != ParseErrorCode::None) [[unlikely]] {
+            return header_error;
+        }
+        msg.header_ = header_result.header;
+
+        // Checksum: last field must be 10=NNN; sum covers bytes before it
+        const FieldView& trailer = msg.fields_[msg.field_count_ - 1];
+        if (trailer.tag != tag::CheckSum::value ||
+            trailer.value.size() != fix::CHECKSUM_LENGTH) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::CheckSum::value};
+        }
+        const size_t checksum_pos = static_cast<size_t>(trailer.value.data() - ptr) - 3;  // "10="
+        return validate_checksum_indexed(data, checksum_pos, idx);
+    }
+
     // ========================================================================
     // Accessors
     // ========================================================================
@@ -192,6 +351,16 @@ public:
         return get_field(tag).as_qty();
     }
 
+    /// Kernel/NIC receive timestamp (zero unless the transport stamps)
+    [[nodiscard]] constexpr const WireTimestamp& receive_timestamp() const noexcept {
+        return rx_timestamp_;
+    }
+
+    /// Attach the receive timestamp of the segment that carried this message
+    constexpr void set_receive_timestamp(const WireTimestamp& ts) noexcept {
+        rx_timestamp_ = ts;
+    }
+
     // ========================================================================
     // Iteration
     // ========================================================================
@@ -210,6 +379,7 @@ private:
     MessageHeader header_;
     std::array<FieldView, MAX_FIELDS> fields_;
     size_t field_count_;
+    WireTimestamp rx_timestamp_{};
 };
 
 // ============================================================================
@@ -237,15 +407,19 @@ public:
                 break;  // Need more data
             }
 
-            // Store message boundary for retrieval
-            if (pending_count_ < MAX_PENDING) {
-                pending_messages_[pending_count_++] = {
-                    consumed + boundary.start,
-                    consumed + boundary.end
-                };
+            // Queue full: leave the rest unconsumed instead of dropping it
+            if (pending_count_ == MAX_PENDING) [[unlikely]] {
+                break;
             }
 
-            consumed = boundary.end;
+            // Store message boundary for retrieval
+            pending_messages_[(pending_head_ + pending_count_) & PENDING_MASK] = {
+                consumed + boundary.start,
+                consumed + boundary.end
+            };
+            ++pending_count_;
+
+            consumed += boundary.end;
         }
 
         return consumed;
@@ -256,18 +430,14 @@ public:
         return pending_count_ > 0;
     }
 
-    /// Get next message boundary
+    /// Get next message boundary (O(1) ring pop)
     [[nodiscard]] std::pair<size_t, size_t> next_message() noexcept {
         if (pending_count_ == 0) {
             return {0, 0};
         }
 
-        auto result = pending_messages_[0];
-
-        // Shift remaining messages
-        for (size_t i = 1; i < pending_count_; ++i) {
-            pending_messages_[i - 1] = pending_messages_[i];
-        }
+        auto result = pending_messages_[pending_head_];
+        pending_head_ = (pending_head_ + 1) & PENDING_MASK;
         --pending_count_;
 
         return result;
@@ -275,38 +445,200 @@ public:
 
     /// Clear parser state
     void reset() noexcept {
+        pending_head_ = 0;
         pending_count_ = 0;
     }
 
 private:
     static constexpr size_t MAX_PENDING = 16;
+    static constexpr size_t PENDING_MASK = MAX_PENDING - 1;
+    static_assert((MAX_PENDING & PENDING_MASK) == 0, "MAX_PENDING must be a power of 2");
 
     std::array<std::pair<size_t, size_t>, MAX_PENDING> pending_messages_;
+    size_t pending_head_{0};
     size_t pending_count_{0};
 };
 
+// ============================================================================
+// Batch Parsing (many messages per receive buffer)
+// ============================================================================
+
+namespace detail {
+
+/// declared_message_size(): header not complete yet
+inline constexpr size_t MESSAGE_SIZE_UNKNOWN = 0;
+
+/// declared_message_size(): data[start] is not a well-formed header
+inline constexpr size_t MESSAGE_SIZE_INVALID = SIZE_MAX;
+
+/// Total message size declared by "8=...|9=NNN|" at data[start]
+/// Header bytes + BodyLength + "10=NNN|". Only the header is read.
+[[nodiscard]] NFX_HOT
+inline size_t declared_message_size(
+    std::span<const char> data,
+    size_t start) noexcept
+{
+    const char* __restrict ptr = data.data();
+    const size_t size = data.size();
+
+    if (start >= size) return MESSAGE_SIZE_UNKNOWN;
+    if (ptr[start] != '8') [[unlikely]] return MESSAGE_SIZE_INVALID;
+    if (start + 1 >= size) return MESSAGE_SIZE_UNKNOWN;
+    if (ptr[start + 1] != '=') [[unlikely]] return MESSAGE_SIZE_INVALID;
+
+    size_t pos = simd::find_soh(data, start + 2) + 1;
+    if (pos + 2 > size) return MESSAGE_SIZE_UNKNOWN;
+    if (ptr[pos] != '9' || ptr[pos + 1] != '=') [[unlikely]] return MESSAGE_SIZE_INVALID;
+    pos += 2;
+
+    size_t body_length = 0;
+    size_t digits = 0;
+    while (pos < size && ptr[pos] >= '0' && ptr[pos] <= '9' && digits < 7) {
+        body_length = body_length * 10 + static_cast<size_t>(ptr[pos] - '0');
+        ++pos;
+        ++digits;
+    }
+    if (pos == size) return MESSAGE_SIZE_UNKNOWN;
+    if (digits == 0 || ptr[pos] != fix::SOH ||
+        body_length > fix::MAX_MESSAGE_SIZE) [[unlikely]] {
+        return MESSAGE_SIZE_INVALID;
+    }
+
+    // Trailer "10=NNN|" follows the body
+    return pos + 1 - start + body_length + fix::CHECKSUM_LENGTH + 4;
+}
+
+/// Check that a message of the given size ends in "10=NNN|"
+[[nodiscard]] NFX_FORCE_INLINE
+bool has_trailer_at(const char* ptr, size_t end) noexcept {
+    return ptr[end - 7] == '1' && ptr[end - 6] == '0' &&
+           ptr[end - 5] == '=' && ptr[end - 1] == fix::SOH;
+}
+
+/// Frame one message starting at data[start] using BodyLength (tag 9)
+/// O(1) per message: reads "8=...|9=NNN|" and checks that "10=" sits
+/// where BodyLength says, so the body itself is never scanned here.
+/// Falls back to simd::find_message_boundary() when the buffer does not
+/// start with a well-formed header or the trailer is not where expected.
+[[nodiscard]] NFX_HOT
+inline simd::MessageBoundary frame_message(
+    std::span<const char> data,
+    size_t start) noexcept
+{
+    const size_t msg_size = declared_message_size(data, start);
+    if (msg_size == MESSAGE_SIZE_UNKNOWN) {
+        return simd::MessageBoundary{start, 0, false};  // Header not yet received
+    }
+    if (msg_size != MESSAGE_SIZE_INVALID) [[likely]] {
+        const size_t end = start + msg_size;
+        if (end > data.size()) {
+            return simd::MessageBoundary{start, 0, false};
+        }
+        if (has_trailer_at(data.data(), end)) [[likely]] {
+            return simd::MessageBoundary{start, end, true};
+        }
+    }
+
+    return simd::find_message_boundary(data, start);
+}
+
+}  // namespace detail
+
+/// Outcome of parse_batch()
+struct BatchParseResult {
+    size_t count{0};       // Messages parsed into out[0, count)
+    size_t consumed{0};    // Bytes of data fully handled
+    ParseError error{};    // First malformed message (offset is into data)
+
+    [[nodiscard]] constexpr bool ok() const noexcept {
+        return error.code == ParseErrorCode::None;
+    }
+};
+
+/// Frame and parse every complete message in data (e.g. one multishot
+/// recv buffer) into out, in order, in a single call.
+/// Framing uses BodyLength so each message is swept once, by the
+/// structural index build inside ParsedMessage::parse_structural_into().
+/// Stops when out is full, at a trailing partial message (consumed points
+/// at its start, keep those bytes for the next recv), or at the first
+/// malformed message; that message is included in consumed so the caller
+/// can report it and resume after it.
+[[nodiscard]] NFX_HOT
+inline BatchParseResult parse_batch(
+    std::span<const char> data,
+    std::span<ParsedMessage> out) noexcept
+{
+    BatchParseResult result;
+    size_t cursor = 0;
+
+    while (result.count < out.size() && cursor < data.size()) [[likely]] {
+        const simd::MessageBoundary boundary = detail::frame_message(data, cursor);
+        if (!boundary.complete) {
+            // Partial tail: skip any leading garbage, keep the rest
+            if (boundary.start > cursor) cursor = boundary.start;
+            break;
+        }
+
+        auto error = ParsedMessage::parse_structural_into(
+            boundary.slice(data), out[result.count]);
+        cursor = boundary.end;
+
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            error.offset += boundary.start;
+            result.error = error;
+            break;
+        }
+        ++result.count;
+    }
+
+    result.consumed = cursor;
+    return result;
+}
+
 // ============================================================================
 // Optimized Tag Lookup Parser
 // ============================================================================
 
-/// Parser with O(1) tag lookup using precomputed offset table
+/// Parser with O(1) tag lookup via the known-tag perfect hash
+/// Unknown tags (e.g. venue tags 5000+) are kept in an overflow list; a
+/// message with more distinct unknown tags than it holds fails with
+/// ParseErrorCode::TooManyFields.
 /// Aligned to cache line boundary for optimal memory access
 class alignas(PARSER_CACHE_LINE_SIZE) IndexedParser {
 public:
-    static constexpr size_t MAX_TAG = 512;
+
+    IndexedParser() noexcept = default;
 
     /// Parse and index all fields for O(1) lookup
+    /// @tparam Ver Version the caller is fixed to (see parse_header())
+    template <FixVersion Ver = FixVersion::Unknown>
     [[nodiscard]] NFX_HOT
     static ParseResult<IndexedParser> parse(
         std::span<const char> data) noexcept
     {
         IndexedParser parser;
+        auto error = parse_into<Ver>(data, parser);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
+        return parser;
+    }
+
+    /// parse() writing into an existing parser (no copy of the ~3 KB
+    /// field table through ParseResult)
+    template <FixVersion Ver = FixVersion::Unknown>
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_into(
+        std::span<const char> data,
+        IndexedParser& parser) noexcept
+    {
         parser.raw_ = data;
+        parser.field_table_.clear();
 
         // Parse header
-        auto header_result = parse_header(data);
+        auto header_result = parse_header<Ver>(data);
         if (!header_result.ok()) [[unlikely]] {
-            return std::unexpected{header_result.error};
+            return header_result.error;
         }
         parser.header_ = header_result.header;
 
@@ -316,19 +648,16 @@ public:
             FieldView field = iter.next();
             if (!field.is_valid()) [[unlikely]] break;
 
-            // Store in lookup table for O(1) access
-            if (field.tag > 0 && static_cast<size_t>(field.tag) < MAX_TAG) [[likely]] {
-                parser.field_table_.set(field.tag, field.value);
+            // Store in lookup table for O(1) access. A full overflow list
+            // fails the parse rather than hiding the extra unknown tags.
+            if (!parser.field_table_.set(field.tag, field.value)) [[unlikely]] {
+                return ParseError{ParseErrorCode::TooManyFields, field.tag,
+                    static_cast<size_t>(field.value.data() - data.data())};
             }
         }
 
         // Validate checksum
-        auto checksum_error = validate_checksum(data);
-        if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
-            return std::unexpected{checksum_error};
-        }
-
-        return parser;
+        return validate_checksum(data);
     }
 
     // ========================================================================
@@ -424,11 +753,536 @@ public:
     }
 
 private:
-    IndexedParser() noexcept = default;
+    std::span<const char> raw_;
+    MessageHeader header_;
+    HashedFieldTable field_table_;
+};
+
+// ============================================================================
+// Lazy Parsed Message (on-demand field materialization)
+// ============================================================================
+
+/// Parsed message that decodes fields only when they are first requested
+/// parse() validates framing, header and checksum from one structural pass
+/// (simd::build_index_with_checksum) and keeps only the SOH positions;
+/// body tags are decoded on lookup and cached. Suited to drop-copy flows
+/// that read a handful of fields. Lookups mutate internal caches: not safe
+/// for concurrent readers.
+class alignas(PARSER_CACHE_LINE_SIZE) LazyParsedMessage {
+public:
+    static constexpr size_t MAX_FIELDS = simd::MAX_FIELDS;
+    static constexpr size_t TAG_CACHE_SIZE = 16;  // Direct-mapped, power of 2
+
+    /// Validate and index message; only header fields are decoded
+    [[nodiscard]] NFX_HOT
+    static ParseResult<LazyParsedMessage> parse(
+        std::span<const char> data) noexcept
+    {
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+        if (data.size() > UINT16_MAX) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};  // 16-bit index
+        }
+
+        const simd::FIXStructuralIndex idx = simd::build_index_with_checksum(data);
+
+        // A full index may have dropped positions: no reliable lookup
+        if (idx.soh_count >= MAX_FIELDS) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};
+        }
+        if (idx.soh_count < 2 ||
+            idx.soh_positions[idx.soh_count - 1] != data.size() - 1) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::UnterminatedField}};
+        }
+
+        // Trailer must be exactly "10=NNN<SOH>"
+        const char* ptr = data.data();
+        const size_t trailer_start = idx.soh_positions[idx.soh_count - 2] + 1u;
+        if (data.size() - trailer_start != 7 ||
+            ptr[trailer_start] != '1' || ptr[trailer_start + 1] != '0' ||
+            ptr[trailer_start + 2] != fix::EQUALS) [[unlikely]] {
+            return std::unexpected{ParseError{
+                ParseErrorCode::MissingRequiredField, tag::CheckSum::value}};
+        }
+        auto checksum_error = validate_checksum_indexed(data, trailer_start, idx);
+        if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{checksum_error};
+        }
+
+        LazyParsedMessage msg;
+        msg.raw_ = data;
+        msg.field_count_ = idx.soh_count;
+        std::memcpy(msg.soh_positions_.data(), idx.soh_positions.data(),
+                    idx.soh_count * sizeof(uint16_t));
+
+        // Header fields lead the message; decoding them warms the cache
+        HeaderParseResult header_result;
+        int header_fields = 0;
+        while (header_fields < 7 && msg.decoded_count_ < msg.field_count_) {
+            const uint16_t slot = msg.decoded_count_;
+            msg.decode_next();
+            if (msg.tags_[slot] == parser::INVALID_TAG) [[unlikely]] {
+                return std::unexpected{ParseError{
+                    ParseErrorCode::InvalidTagNumber, 0, msg.field_start(slot)}};
+            }
+            if (!detail::assign_header_field(
+                    header_result, msg.field_view_at(slot), header_fields)) [[unlikely]] {
+                break;
+            }
+            if (!header_result.ok()) [[unlikely]] {
+                return std::unexpected{header_result.error};
+            }
+        }
+        auto header_error = detail::validate_header_fields(header_result.header);
+        if (header_error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{header_error};
+        }
+        msg.header_ = header_result.header;
+
+        return msg;
+    }
+
+    // ========================================================================
+    // Lazy Field Access
+    // ========================================================================
+
+    /// Get field by tag; decodes forward until found, then caches the slot
+    /// Returns the first occurrence, like ParsedMessage::get_field.
+    [[nodiscard]] NFX_HOT FieldView get_field(int tag) const noexcept {
+        TagCacheEntry& entry = tag_cache_[static_cast<size_t>(tag) & (TAG_CACHE_SIZE - 1)];
+        if (entry.tag == tag) [[likely]] {
+            return entry.slot == NOT_FOUND ? FieldView{} : field_view_at(entry.slot);
+        }
+
+        uint16_t slot = find_decoded(tag);
+        while (slot == NOT_FOUND && decoded_count_ < field_count_) {
+            const uint16_t next = decoded_count_;
+            decode_next();
+            if (tags_[next] == tag) slot = next;
+        }
+
+        entry = TagCacheEntry{tag, slot};
+        return slot == NOT_FOUND ? FieldView{} : field_view_at(slot);
+    }
+
+    [[nodiscard]] NFX_HOT bool has_field(int tag) const noexcept {
+        return get_field(tag).is_valid();
+    }
+
+    [[nodiscard]] NFX_HOT std::string_view get_string(int tag) const noexcept {
+        return get_field(tag).as_string();
+    }
+
+    [[nodiscard]] NFX_HOT std::optional<int64_t> get_int(int tag) const noexcept {
+        return get_field(tag).as_int();
+    }
+
+    [[nodiscard]] NFX_HOT char get_char(int tag) const noexcept {
+        return get_field(tag).as_char();
+    }
+
+    [[nodiscard]] NFX_HOT FixedPrice get_price(int tag) const noexcept {
+        return get_field(tag).as_price();
+    }
+
+    [[nodiscard]] NFX_HOT Qty get_qty(int tag) const noexcept {
+        return get_field(tag).as_qty();
+    }
+
+    /// Get field by position (decodes every field up to index)
+    [[nodiscard]] FieldView field_at(size_t index) const noexcept {
+        if (index >= field_count_) return FieldView{};
+        while (decoded_count_ <= index) decode_next();
+        return field_view_at(static_cast<uint16_t>(index));
+    }
+
+    /// Total fields in message (known from the index, nothing decoded)
+    [[nodiscard]] size_t field_count() const noexcept {
+        return field_count_;
+    }
+
+    /// Fields whose tag has been decoded so far
+    [[nodiscard]] size_t decoded_count() const noexcept {
+        return decoded_count_;
+    }
+
+    // ========================================================================
+    // Header Access
+    // ========================================================================
+
+    [[nodiscard]] const MessageHeader& header() const noexcept {
+        return header_;
+    }
+
+    [[nodiscard]] std::span<const char> raw() const noexcept {
+        return raw_;
+    }
+
+    [[nodiscard]] char msg_type() const noexcept {
+        return header_.msg_type;
+    }
+
+    [[nodiscard]] uint32_t msg_seq_num() const noexcept {
+        return header_.msg_seq_num;
+    }
+
+    [[nodiscard]] std::string_view sender_comp_id() const noexcept {
+        return header_.sender_comp_id;
+    }
+
+    [[nodiscard]] std::string_view target_comp_id() const noexcept {
+        return header_.target_comp_id;
+    }
+
+    [[nodiscard]] std::string_view sending_time() const noexcept {
+        return header_.sending_time;
+    }
+
+private:
+    static constexpr uint16_t NOT_FOUND = UINT16_MAX;
+
+    struct TagCacheEntry {
+        int tag{parser::INVALID_TAG};
+        uint16_t slot{NOT_FOUND};
+    };
+
+    LazyParsedMessage() noexcept = default;
+
+    [[nodiscard]] size_t field_start(uint16_t slot) const noexcept {
+        return slot == 0 ? 0 : soh_positions_[slot - 1] + 1u;
+    }
+
+    /// Decode tag of the next undecoded field
+    /// '=' is found by a short forward scan: tags are at most 9 digits.
+    NFX_HOT void decode_next() const noexcept {
+        const uint16_t slot = decoded_count_++;
+        const size_t start = field_start(slot);
+        const size_t end = soh_positions_[slot];
+        const size_t limit = std::min(end, start + parser::MAX_TAG_DIGITS + 1);
+
+        size_t eq = start;
+        while (eq < limit && raw_[eq] != fix::EQUALS) ++eq;
+        if (eq == limit || eq == start) [[unlikely]] {
+            tags_[slot] = parser::INVALID_TAG;
+            return;
+        }
+
+        tags_[slot] = parser::decode_tag(raw_, start, eq - start);
+        tag_lens_[slot] = static_cast<uint8_t>(eq - start);
+    }
+
+    [[nodiscard]] uint16_t find_decoded(int tag) const noexcept {
+        for (uint16_t i = 0; i < decoded_count_; ++i) {
+            if (tags_[i] == tag) return i;
+        }
+        return NOT_FOUND;
+    }
+
+    [[nodiscard]] FieldView field_view_at(uint16_t slot) const noexcept {
+        if (tags_[slot] == parser::INVALID_TAG) [[unlikely]] return FieldView{};
+        const size_t value_start = field_start(slot) + tag_lens_[slot] + 1u;
+        return FieldView{
+            tags_[slot],
+            std::span<const char>{raw_.data() + value_start,
+                                  soh_positions_[slot] - value_start}
+        };
+    }
 
     std::span<const char> raw_;
     MessageHeader header_;
-    FieldTable<MAX_TAG> field_table_;
+    uint16_t field_count_{0};
+    mutable uint16_t decoded_count_{0};
+    mutable std::array<TagCacheEntry, TAG_CACHE_SIZE> tag_cache_{};
+    std::array<uint16_t, MAX_FIELDS> soh_positions_;      // Only [0, field_count_) set
+    mutable std::array<int32_t, MAX_FIELDS> tags_;        // Only [0, decoded_count_) set
+    mutable std::array<uint8_t, MAX_FIELDS> tag_lens_;
+};
+
+// ============================================================================
+// Compact Parsed Message (16-bit offsets)
+// ============================================================================
+
+/// Zero-copy parsed message with 6-byte field entries
+/// Same accessors as ParsedMessage, but each field is stored as
+/// (tag, value offset, value length) in 16 bits each, relative to raw(),
+/// instead of a 24-byte FieldView: the fields of a typical
+/// ExecutionReport occupy 3 cache lines instead of 12. Suited to
+/// messages kept in flight (order state, drop copy queues) where L1
+/// residency matters more than the per-access FieldView rebuild.
+/// Limits: tags up to 65535, messages up to 64 KB and MAX_FIELDS fields;
+/// anything larger is rejected rather than truncated.
+class alignas(PARSER_CACHE_LINE_SIZE) CompactParsedMessage {
+public:
+    static constexpr size_t MAX_FIELDS = ParsedMessage::MAX_FIELDS;
+
+    /// Packed field entry
+    struct Field {
+        uint16_t tag;
+        uint16_t offset;  // Value start within raw()
+        uint16_t length;
+    };
+    static_assert(sizeof(Field) == 6);
+
+    constexpr CompactParsedMessage() noexcept = default;
+
+    /// Parse from buffer in a single structural pass (zero-copy)
+    [[nodiscard]] NFX_HOT
+    static ParseResult<CompactParsedMessage> parse(
+        std::span<const char> data) noexcept
+    {
+        CompactParsedMessage msg;
+        auto error = parse_into(data, msg);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
+        return msg;
+    }
+
+    /// parse() writing into an existing message
+    [[nodiscard]] NFX_HOT
+    static ParseError parse_into(
+        std::span<const char> data,
+        CompactParsedMessage& msg) noexcept
+    {
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+            return ParseError{ParseErrorCode::BufferTooShort};
+        }
+        if (data.size() > UINT16_MAX) [[unlikely]] {
+            return ParseError{ParseErrorCode::GarbledMessage};  // 16-bit offsets
+        }
+
+        const simd::FIXStructuralIndex idx = simd::build_index_with_checksum(data);
+        if (idx.soh_count > MAX_FIELDS ||
+            idx.equals_count >= simd::MAX_FIELDS) [[unlikely]] {
+            return ParseError{ParseErrorCode::GarbledMessage};
+        }
+
+        msg.raw_ = data;
+        msg.field_count_ = 0;
+        msg.rx_timestamp_ = WireTimestamp{};
+
+        // Pair each SOH with the first '=' after the previous SOH
+        size_t field_start = 0;
+        size_t eq_cursor = 0;
+        for (size_t i = 0; i < idx.soh_count; ++i) [[likely]] {
+            const size_t field_end = idx.soh_positions[i];
+
+            while (eq_cursor < idx.equals_count &&
+                   idx.equals_positions[eq_cursor] < field_start) {
+                ++eq_cursor;
+            }
+            if (eq_cursor >= idx.equals_count ||
+                idx.equals_positions[eq_cursor] >= field_end) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, field_start};
+            }
+            const size_t eq_pos = idx.equals_positions[eq_cursor];
+
+            const int tag = parser::decode_tag(data, field_start, eq_pos - field_start);
+            if (tag == parser::INVALID_TAG || tag > UINT16_MAX) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidTagNumber, 0, field_start};
+            }
+
+            msg.fields_[msg.field_count_++] = Field{
+                static_cast<uint16_t>(tag),
+                static_cast<uint16_t>(eq_pos + 1),
+                static_cast<uint16_t>(field_end - eq_pos - 1)
+            };
+
+            field_start = field_end + 1;
+        }
+
+        if (msg.field_count_ == 0) [[unlikely]] {
+            return ParseError{ParseErrorCode::InvalidFieldFormat};
+        }
+
+        // Header from the leading fields (same rules as parse_header)
+        HeaderParseResult header_result;
+        int header_fields = 0;
+        for (size_t i = 0; i < msg.field_count_ && header_fields < 7; ++i) {
+            if (!detail::assign_header_field(
+                    header_result, msg.field_at(i), header_fields)) [[unlikely]] {
+                break;
+            }
+            if (!header_result.ok()) [[unlikely]] {
+                return header_result.error;
+            }
+        }
+        auto header_error = detail::validate_header_fields(header_result.header);
+        if (header_error.code != ParseErrorCode::None) [[unlikely]] {
+            return header_error;
+        }
+        msg.header_ = header_result.header;
+
+        // Checksum: last field must be 10=NNN; sum covers bytes before it
+        const Field& trailer = msg.fields_[msg.field_count_ - 1];
+        if (trailer.tag != tag::CheckSum::value ||
+            trailer.length != fix::CHECKSUM_LENGTH) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::CheckSum::value};
+        }
+        return validate_checksum_indexed(data, trailer.offset - 3u, idx);  // "10="
+    }
+
+    /// Compact copy of a message parsed by ParsedMessage (same buffer)
+    /// @return false if the message exceeds the 16-bit limits
+    [[nodiscard]] static bool from(const ParsedMessage& source, CompactParsedMessage& msg) noexcept {
+        const std::span<const char> data = source.raw();
+        if (data.size() > UINT16_MAX) [[unlikely]] {
+            return false;
+        }
+        msg.raw_ = data;
+        msg.header_ = source.header();
+        msg.rx_timestamp_ = source.receive_timestamp();
+        msg.field_count_ = 0;
+        for (const FieldView& field : source) {
+            if (field.tag <= 0 || field.tag > UINT16_MAX) [[unlikely]] {
+                return false;
+            }
+            msg.fields_[msg.field_count_++] = Field{
+                static_cast<uint16_t>(field.tag),
+                static_cast<uint16_t>(field.value.data() - data.data()),
+                static_cast<uint16_t>(field.value.size())
+            };
+        }
+        return true;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept {
+        return raw_;
+    }
+
+    [[nodiscard]] constexpr const MessageHeader& header() const noexcept {
+        return header_;
+    }
+
+    [[nodiscard]] constexpr char msg_type() const noexcept {
+        return header_.msg_type;
+    }
+
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept {
+        return header_.msg_seq_num;
+    }
+
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept {
+        return header_.sender_comp_id;
+    }
+
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept {
+        return header_.target_comp_id;
+    }
+
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept {
+        return header_.sending_time;
+    }
+
+    [[nodiscard]] constexpr size_t field_count() const noexcept {
+        return field_count_;
+    }
+
+    /// Get field by index
+    [[nodiscard]] constexpr FieldView field_at(size_t index) const noexcept {
+        return index < field_count_ ? view(fields_[index]) : FieldView{};
+    }
+
+    /// Get field by tag (O(n) scan over 6-byte entries)
+    [[nodiscard]] constexpr FieldView get_field(int tag) const noexcept {
+        for (size_t i = 0; i < field_count_; ++i) {
+            if (fields_[i].tag == tag) {
+                return view(fields_[i]);
+            }
+        }
+        return FieldView{};
+    }
+
+    [[nodiscard]] constexpr bool has_field(int tag) const noexcept {
+        for (size_t i = 0; i < field_count_; ++i) {
+            if (fields_[i].tag == tag) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr std::string_view get_string(int tag) const noexcept {
+        return get_field(tag).as_string();
+    }
+
+    [[nodiscard]] constexpr std::optional<int64_t> get_int(int tag) const noexcept {
+        return get_field(tag).as_int();
+    }
+
+    [[nodiscard]] constexpr char get_char(int tag) const noexcept {
+        return get_field(tag).as_char();
+    }
+
+    [[nodiscard]] constexpr FixedPrice get_price(int tag) const noexcept {
+        return get_field(tag).as_price();
+    }
+
+    [[nodiscard]] constexpr Qty get_qty(int tag) const noexcept {
+        return get_field(tag).as_qty();
+    }
+
+    [[nodiscard]] constexpr const WireTimestamp& receive_timestamp() const noexcept {
+        return rx_timestamp_;
+    }
+
+    constexpr void set_receive_timestamp(const WireTimestamp& ts) noexcept {
+        rx_timestamp_ = ts;
+    }
+
+    /// Packed entries, for callers that scan tags without building views
+    [[nodiscard]] constexpr std::span<const Field> fields() const noexcept {
+        return {fields_.data(), field_count_};
+    }
+
+    // ========================================================================
+    // Iteration (yields FieldView by value)
+    // ========================================================================
+
+    class Iterator {
+    public:
+        constexpr Iterator(const CompactParsedMessage* msg, size_t index) noexcept
+            : msg_{msg}, index_{index} {}
+
+        [[nodiscard]] constexpr FieldView operator*() const noexcept {
+            return msg_->view(msg_->fields_[index_]);
+        }
+        constexpr Iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+        [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+    private:
+        const CompactParsedMessage* msg_;
+        size_t index_;
+    };
+
+    [[nodiscard]] constexpr Iterator begin() const noexcept {
+        return Iterator{this, 0};
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept {
+        return Iterator{this, field_count_};
+    }
+
+private:
+    [[nodiscard]] constexpr FieldView view(const Field& field) const noexcept {
+        return FieldView{field.tag, std::span<const char>{raw_.data() + field.offset, field.length}};
+    }
+
+    std::span<const char> raw_{};
+    MessageHeader header_{};
+    WireTimestamp rx_timestamp_{};
+    uint16_t field_count_{0};
+    std::array<Field, MAX_FIELDS> fields_;  // Only [0, field_count_) set
 };
 
 // ============================================================================
@@ -443,6 +1297,14 @@ inline ParseResult<ParsedMessage> parse_message(
     return ParsedMessage::parse(data);
 }
 
+/// Parse FIX message using a single structural-index pass
+[[nodiscard]] NFX_HOT
+inline ParseResult<ParsedMessage> parse_message_structural(
+    std::span<const char> data) noexcept
+{
+    return ParsedMessage::parse_structural(data);
+}
+
 /// Parse with O(1) field lookup
 [[nodiscard]] NFX_HOT
 inline ParseResult<IndexedParser> parse_indexed(
@@ -451,6 +1313,22 @@ inline ParseResult<IndexedParser> parse_indexed(
     return IndexedParser::parse(data);
 }
 
+/// Parse with on-demand field decoding
+[[nodiscard]] NFX_HOT
+inline ParseResult<LazyParsedMessage> parse_lazy(
+    std::span<const char> data) noexcept
+{
+    return LazyParsedMessage::parse(data);
+}
+
+/// Parse into 6-byte field entries
+[[nodiscard]] NFX_HOT
+inline ParseResult<CompactParsedMessage> parse_compact(
+    std::span<const char> data) noexcept
+{
+    return CompactParsedMessage::parse(data);
+}
+
 // ============================================================================
 // Static Assertions for Parser Layout
 // ============================================================================
@@ -462,6 +1340,12 @@ static_assert(alignof(ParsedMessage) >= PARSER_CACHE_LINE_SIZE,
 static_assert(alignof(IndexedParser) >= PARSER_CACHE_LINE_SIZE,
     "IndexedParser must be cache-line aligned for optimal memory access");
 
+static_assert(alignof(LazyParsedMessage) >= PARSER_CACHE_LINE_SIZE,
+    "LazyParsedMessage must be cache-line aligned for optimal memory access");
+
+static_assert(alignof(CompactParsedMessage) >= PARSER_CACHE_LINE_SIZE,
+    "CompactParsedMessage must be cache-line aligned for optimal memory access");
+
 } // namespace nfx
 
 #ifdef _MSC_VER
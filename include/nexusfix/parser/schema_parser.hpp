@@ -0,0 +1,364 @@
+/*
+    NexusFIX Schema-Projected Parser
+
+    parse_as<Schema>() extracts only the tags listed in a MessageSchema
+    into fixed slots known at compile time:
+
+    - Tag -> slot mapping is a constexpr table generated from the schema
+      (dense uint8_t array up to SCHEMA_TABLE_MAX_TAG, else an unrolled
+      compare chain), so unlisted tags cost one load and are skipped
+    - Required fields are tracked in a 64-bit presence mask and checked
+      with a single AND/compare at the end (no second pass)
+    - Framing and checksum come from one structural pass
+      (simd::build_index_with_checksum), like ParsedMessage::parse_structural
+
+    Intended to replace IndexedParser's 512-entry table for hot message
+    types; see the Schema aliases on fix44::ExecutionReport et al.
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
+#include "nexusfix/parser/consteval_parser.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Compile-time Tag to Slot Mapping
+// ============================================================================
+
+/// Largest schema tag served by the dense slot table (1 byte per tag)
+inline constexpr int SCHEMA_TABLE_MAX_TAG = 1024;
+
+namespace detail {
+
+inline constexpr uint8_t NO_SCHEMA_SLOT = 0xFF;
+
+template <typename Schema>
+consteval int schema_max_tag() {
+    int max_tag = 0;
+    for (int t : Schema::tags()) {
+        max_tag = t > max_tag ? t : max_tag;
+    }
+    return max_tag;
+}
+
+template <typename Schema>
+consteval bool schema_tags_unique() {
+    constexpr auto tags = Schema::tags();
+    for (size_t i = 0; i < tags.size(); ++i) {
+        for (size_t j = i + 1; j < tags.size(); ++j) {
+            if (tags[i] == tags[j]) return false;
+        }
+    }
+    return true;
+}
+
+template <typename Schema>
+consteval uint64_t schema_required_mask() {
+    constexpr auto required = Schema::required_flags();
+    uint64_t mask = 0;
+    for (size_t i = 0; i < required.size(); ++i) {
+        if (required[i]) mask |= 1ULL << i;
+    }
+    return mask;
+}
+
+/// Dense tag -> slot table, NO_SCHEMA_SLOT for tags outside the schema
+template <typename Schema>
+inline constexpr auto schema_slot_table = [] {
+    std::array<uint8_t, static_cast<size_t>(schema_max_tag<Schema>()) + 1> table{};
+    table.fill(NO_SCHEMA_SLOT);
+    constexpr auto tags = Schema::tags();
+    for (size_t i = 0; i < tags.size(); ++i) {
+        table[static_cast<size_t>(tags[i])] = static_cast<uint8_t>(i);
+    }
+    return table;
+}();
+
+/// Map tag to its schema slot (NO_SCHEMA_SLOT if not listed)
+template <typename Schema>
+[[nodiscard]] NFX_FORCE_INLINE
+constexpr uint8_t schema_slot(int tag) noexcept {
+    constexpr int max_tag = schema_max_tag<Schema>();
+    if constexpr (max_tag <= SCHEMA_TABLE_MAX_TAG) {
+        if (static_cast<unsigned>(tag) > static_cast<unsigned>(max_tag)) {
+            return NO_SCHEMA_SLOT;
+        }
+        return schema_slot_table<Schema>[static_cast<size_t>(tag)];
+    } else {
+        constexpr auto tags = Schema::tags();
+        for (size_t i = 0; i < tags.size(); ++i) {
+            if (tags[i] == tag) return static_cast<uint8_t>(i);
+        }
+        return NO_SCHEMA_SLOT;
+    }
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Schema Message (fixed slots, zero-copy)
+// ============================================================================
+
+/// Message projected onto a MessageSchema: one FieldView slot per schema tag
+template <typename Schema>
+class SchemaMessage {
+public:
+    static_assert(Schema::field_count > 0 && Schema::field_count <= 64,
+        "Schema presence mask holds at most 64 fields");
+    static_assert(detail::schema_tags_unique<Schema>(),
+        "Schema lists a tag more than once");
+
+    using schema_type = Schema;
+
+    static constexpr size_t SLOT_COUNT = Schema::field_count;
+    static constexpr uint64_t REQUIRED_MASK = detail::schema_required_mask<Schema>();
+
+    /// Parse and project onto Schema (zero-copy)
+    /// Unlisted tags are skipped; the first occurrence of a listed tag wins.
+    /// A required field with an empty value counts as missing. A non-zero
+    /// expected_msg_type is checked before required fields (InvalidMsgType).
+    [[nodiscard]] NFX_HOT
+    static ParseResult<SchemaMessage> parse(
+        std::span<const char> data,
+        char expected_msg_type = '\0') noexcept
+    {
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+
+        SchemaMessage msg;
+        msg.raw_ = data;
+
+        ParseError error = (data.size() <= UINT16_MAX)
+            ? msg.extract_structural(data)
+            : msg.extract_generic(data);
+        if (error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{error};
+        }
+
+        auto header_error = detail::validate_header_fields(msg.header_state_.header);
+        if (header_error.code != ParseErrorCode::None) [[unlikely]] {
+            return std::unexpected{header_error};
+        }
+        if (expected_msg_type != '\0' &&
+            msg.header_state_.header.msg_type != expected_msg_type) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        // Required fields: single mask compare, report first missing slot
+        if ((msg.present_ & REQUIRED_MASK) != REQUIRED_MASK) [[unlikely]] {
+            constexpr auto tags = Schema::tags();
+            const uint64_t missing = REQUIRED_MASK & ~msg.present_;
+            return std::unexpected{ParseError{
+                ParseErrorCode::MissingRequiredField,
+                tags[static_cast<size_t>(std::countr_zero(missing))]}};
+        }
+
+        return msg;
+    }
+
+    // ========================================================================
+    // Compile-time Slot Access
+    // ========================================================================
+
+    /// Get field for a schema tag (invalid FieldView if absent)
+    template <int Tag>
+    [[nodiscard]] constexpr FieldView get() const noexcept {
+        static_assert(Schema::template has_tag<Tag>(), "Tag is not part of the schema");
+        return slots_[static_cast<size_t>(Schema::template tag_index<Tag>())];
+    }
+
+    /// Check if schema tag was present with a non-empty value
+    template <int Tag>
+    [[nodiscard]] constexpr bool has() const noexcept {
+        static_assert(Schema::template has_tag<Tag>(), "Tag is not part of the schema");
+        return (present_ >> Schema::template tag_index<Tag>()) & 1;
+    }
+
+    template <int Tag>
+    [[nodiscard]] constexpr std::string_view get_string() const noexcept {
+        return get<Tag>().as_string();
+    }
+
+    template <int Tag>
+    [[nodiscard]] constexpr std::optional<int64_t> get_int() const noexcept {
+        return get<Tag>().as_int();
+    }
+
+    template <int Tag>
+    [[nodiscard]] constexpr char get_char() const noexcept {
+        return get<Tag>().as_char();
+    }
+
+    template <int Tag>
+    [[nodiscard]] constexpr FixedPrice get_price() const noexcept {
+        return get<Tag>().as_price();
+    }
+
+    template <int Tag>
+    [[nodiscard]] constexpr Qty get_qty() const noexcept {
+        return get<Tag>().as_qty();
+    }
+
+    /// Presence bit per schema slot (bit i = Schema::tags()[i])
+    [[nodiscard]] constexpr uint64_t present_mask() const noexcept {
+        return present_;
+    }
+
+    // ========================================================================
+    // Header Access
+    // ========================================================================
+
+    [[nodiscard]] constexpr const MessageHeader& header() const noexcept {
+        return header_state_.header;
+    }
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept {
+        return raw_;
+    }
+
+    [[nodiscard]] constexpr char msg_type() const noexcept {
+        return header_state_.header.msg_type;
+    }
+
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept {
+        return header_state_.header.msg_seq_num;
+    }
+
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept {
+        return header_state_.header.sender_comp_id;
+    }
+
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept {
+        return header_state_.header.target_comp_id;
+    }
+
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept {
+        return header_state_.header.sending_time;
+    }
+
+private:
+    constexpr SchemaMessage() noexcept = default;
+
+    /// Route one field to the header and/or its schema slot
+    NFX_FORCE_INLINE ParseError consume(const FieldView& field) noexcept {
+        if (header_open_) {
+            if (header_fields_ < 7 &&
+                detail::assign_header_field(header_state_, field, header_fields_)) {
+                if (!header_state_.ok()) [[unlikely]] return header_state_.error;
+            } else {
+                header_open_ = false;
+            }
+        }
+
+        const uint8_t slot = detail::schema_slot<Schema>(field.tag);
+        if (slot != detail::NO_SCHEMA_SLOT) {
+            const uint64_t bit = 1ULL << slot;
+            if (!(seen_ & bit)) {
+                seen_ |= bit;
+                slots_[slot] = field;
+                if (!field.value.empty()) present_ |= bit;
+            }
+        }
+        return ParseError{};
+    }
+
+    /// Single structural pass with fused checksum
+    NFX_HOT ParseError extract_structural(std::span<const char> data) noexcept {
+        const simd::FIXStructuralIndex idx = simd::build_index_with_checksum(data);
+        if (idx.soh_count >= simd::MAX_FIELDS ||
+            idx.equals_count >= simd::MAX_FIELDS) [[unlikely]] {
+            return extract_generic(data);
+        }
+
+        const char* __restrict ptr = data.data();
+        size_t field_start = 0;
+        size_t eq_cursor = 0;
+        size_t last_field_start = 0;
+        int last_tag = 0;
+
+        for (size_t i = 0; i < idx.soh_count; ++i) [[likely]] {
+            const size_t field_end = idx.soh_positions[i];
+
+            while (eq_cursor < idx.equals_count &&
+                   idx.equals_positions[eq_cursor] < field_start) {
+                ++eq_cursor;
+            }
+            if (eq_cursor >= idx.equals_count ||
+                idx.equals_positions[eq_cursor] >= field_end) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, field_start};
+            }
+            const size_t eq_pos = idx.equals_positions[eq_cursor];
+
+            int tag = parser::decode_tag(data, field_start, eq_pos - field_start);
+            if (tag == parser::INVALID_TAG) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidTagNumber, 0, field_start};
+            }
+
+            ParseError error = consume(FieldView{
+                tag, std::span<const char>{ptr + eq_pos + 1, field_end - eq_pos - 1}});
+            if (error.code != ParseErrorCode::None) [[unlikely]] return error;
+
+            last_field_start = field_start;
+            last_tag = tag;
+            field_start = field_end + 1;
+        }
+
+        if (last_tag != tag::CheckSum::value) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::CheckSum::value};
+        }
+        return validate_checksum_indexed(data, last_field_start, idx);
+    }
+
+    /// Fallback for buffers the 16-bit structural index cannot hold
+    ParseError extract_generic(std::span<const char> data) noexcept {
+        FieldIterator iter{data};
+        while (iter.has_next()) [[likely]] {
+            const size_t field_start = iter.position();
+            FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, 0, field_start};
+            }
+            ParseError error = consume(field);
+            if (error.code != ParseErrorCode::None) [[unlikely]] return error;
+        }
+        return validate_checksum(data);
+    }
+
+    std::span<const char> raw_{};
+    HeaderParseResult header_state_{};
+    std::array<FieldView, SLOT_COUNT> slots_{};
+    uint64_t present_{0};
+    uint64_t seen_{0};
+    int header_fields_{0};
+    bool header_open_{true};
+};
+
+// ============================================================================
+// Convenience Function
+// ============================================================================
+
+/// Parse FIX message keeping only the tags listed in Schema
+template <typename Schema>
+[[nodiscard]] NFX_HOT
+inline ParseResult<SchemaMessage<Schema>> parse_as(
+    std::span<const char> data,
+    char expected_msg_type = '\0') noexcept
+{
+    return SchemaMessage<Schema>::parse(data, expected_msg_type);
+}
+
+} // namespace nfx
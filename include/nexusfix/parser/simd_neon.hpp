@@ -0,0 +1,97 @@
+/*
+    NexusFIX ARM NEON / SVE Helpers
+
+    Shared by simd_scanner.hpp, simd_checksum.hpp and structural_index.hpp.
+
+    NEON has no movemask instruction, so compare results are turned into
+    scalar bitmasks with two well-known sequences:
+
+    - nibble_mask(): vshrn by 4 packs one 16-byte compare into 64 bits,
+      4 bits per byte. Cheapest way to answer "first match in 16 bytes".
+    - bitmask_64(): AND with bit weights + three pairwise adds packs four
+      16-byte compares into one bit per byte (same layout as AVX-512
+      cmpeq masks), used where every position is extracted.
+
+    SVE paths use predicated loops (whilelt) and need no scalar tail; they
+    are preferred only when the hardware vector is wider than NEON.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_HAS_NEON
+    #include <arm_neon.h>
+    #define NFX_NEON_AVAILABLE 1
+#else
+    #define NFX_NEON_AVAILABLE 0
+#endif
+
+// SVE2 implies SVE; the kernels below only need base SVE instructions
+#if NFX_NEON_AVAILABLE && defined(__ARM_FEATURE_SVE)
+    #include <arm_sve.h>
+    #define NFX_SVE_AVAILABLE 1
+#else
+    #define NFX_SVE_AVAILABLE 0
+#endif
+
+namespace nfx::simd::neon {
+
+inline constexpr size_t NEON_REGISTER_SIZE = 16;  // 128 bits = 16 bytes
+
+#if NFX_NEON_AVAILABLE
+
+/// One 16-byte compare result -> 4 bits per byte (index = ctz / 4)
+[[nodiscard]] NFX_FORCE_INLINE
+uint64_t nibble_mask(uint8x16_t cmp) noexcept {
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+/// Four 16-byte compare results -> 64-bit mask, one bit per byte
+[[nodiscard]] NFX_FORCE_INLINE
+uint64_t bitmask_64(uint8x16_t c0, uint8x16_t c1, uint8x16_t c2, uint8x16_t c3) noexcept {
+    static constexpr uint8_t BIT_WEIGHTS[16] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+    };
+    const uint8x16_t weights = vld1q_u8(BIT_WEIGHTS);
+
+    uint8x16_t s0 = vpaddq_u8(vandq_u8(c0, weights), vandq_u8(c1, weights));
+    uint8x16_t s1 = vpaddq_u8(vandq_u8(c2, weights), vandq_u8(c3, weights));
+    s0 = vpaddq_u8(s0, s1);
+    s0 = vpaddq_u8(s0, s0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(s0), 0);
+}
+
+/// Widen-and-accumulate 64 bytes into 32-bit lanes (checksum helper)
+/// Per-call 16-bit partials peak at 8 * 255, so they cannot overflow.
+[[nodiscard]] NFX_FORCE_INLINE
+uint32x4_t accumulate_64(
+    uint32x4_t acc,
+    uint8x16_t c0, uint8x16_t c1, uint8x16_t c2, uint8x16_t c3) noexcept
+{
+    uint16x8_t partial = vpaddlq_u8(c0);
+    partial = vpadalq_u8(partial, c1);
+    partial = vpadalq_u8(partial, c2);
+    partial = vpadalq_u8(partial, c3);
+    return vpadalq_u16(acc, partial);
+}
+
+#endif  // NFX_NEON_AVAILABLE
+
+#if NFX_SVE_AVAILABLE
+
+/// SVE pays off over NEON only with vectors wider than 128 bits
+/// (e.g. Graviton3: 256-bit SVE). svcntb() is a single RDVL instruction.
+[[nodiscard]] NFX_FORCE_INLINE
+bool sve_wider_than_neon() noexcept {
+    return svcntb() > NEON_REGISTER_SIZE;
+}
+
+#endif  // NFX_SVE_AVAILABLE
+
+}  // namespace nfx::simd::neon
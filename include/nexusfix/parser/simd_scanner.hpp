@@ -11,12 +11,14 @@
 #include <cstdint>
 #include <cstddef>
 #include <array>
+#include <algorithm>
 #include <memory>  // std::assume_aligned
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/util/compiler.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"  // For nfx::CACHE_LINE_SIZE
+#include "nexusfix/parser/simd_neon.hpp"
 
 // SIMD feature detection
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
@@ -432,12 +434,188 @@ inline size_t count_soh_avx512(std::span<const char> data) noexcept {
 
 #endif  // NFX_AVX512_AVAILABLE
 
+// ============================================================================
+// ARM NEON Scanner (AArch64 baseline)
+// ============================================================================
+
+#if NFX_NEON_AVAILABLE
+
+/// NEON SOH scanner (64 bytes per iteration, one bit per byte)
+[[nodiscard]] NFX_HOT
+inline SohPositions scan_soh_neon(std::span<const char> data) noexcept {
+    SohPositions result;
+
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const uint8_t* __restrict ptr = reinterpret_cast<const uint8_t*>(data.data());
+
+    size_t i = 0;
+    for (; i + 64 <= data.size() && result.count < MAX_SOH_POSITIONS - 64; i += 64) {
+        uint64_t mask = neon::bitmask_64(
+            vceqq_u8(vld1q_u8(ptr + i), soh_vec),
+            vceqq_u8(vld1q_u8(ptr + i + 16), soh_vec),
+            vceqq_u8(vld1q_u8(ptr + i + 32), soh_vec),
+            vceqq_u8(vld1q_u8(ptr + i + 48), soh_vec));
+
+        while (mask != 0) {
+            result.push(static_cast<uint16_t>(i + static_cast<size_t>(__builtin_ctzll(mask))));
+            mask &= mask - 1;
+        }
+    }
+
+    // Scalar tail (from where NEON stopped)
+    for (; i < data.size() && result.count < MAX_SOH_POSITIONS; ++i) {
+        if (ptr[i] == static_cast<uint8_t>(fix::SOH)) [[unlikely]] {
+            result.push(static_cast<uint16_t>(i));
+        }
+    }
+
+    return result;
+}
+
+namespace detail {
+
+/// NEON first-occurrence search, 16 bytes per iteration
+[[nodiscard]] NFX_FORCE_INLINE
+size_t find_byte_neon(std::span<const char> data, size_t start, char needle) noexcept {
+    if (start >= data.size()) [[unlikely]] return data.size();
+
+    const uint8x16_t needle_vec = vdupq_n_u8(static_cast<uint8_t>(needle));
+    const uint8_t* __restrict ptr = reinterpret_cast<const uint8_t*>(data.data());
+    size_t i = start;
+
+    for (; i + neon::NEON_REGISTER_SIZE <= data.size(); i += neon::NEON_REGISTER_SIZE) {
+        const uint64_t mask = neon::nibble_mask(vceqq_u8(vld1q_u8(ptr + i), needle_vec));
+        if (mask != 0) [[unlikely]] {
+            return i + (static_cast<size_t>(__builtin_ctzll(mask)) >> 2);
+        }
+    }
+
+    for (; i < data.size(); ++i) {
+        if (ptr[i] == static_cast<uint8_t>(needle)) [[unlikely]] return i;
+    }
+    return data.size();
+}
+
+}  // namespace detail
+
+/// NEON-accelerated find next SOH
+[[nodiscard]] NFX_HOT
+inline size_t find_soh_neon(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_byte_neon(data, start, fix::SOH);
+}
+
+/// NEON-accelerated find '='
+[[nodiscard]] NFX_HOT
+inline size_t find_equals_neon(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_byte_neon(data, start, fix::EQUALS);
+}
+
+/// Count SOH occurrences using NEON
+/// Matches are summed as 8-bit lane counters, flushed every 255 vectors.
+[[nodiscard]] NFX_HOT
+inline size_t count_soh_neon(std::span<const char> data) noexcept {
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const size_t simd_end = data.size() & ~(neon::NEON_REGISTER_SIZE - 1);
+    const uint8_t* __restrict ptr = reinterpret_cast<const uint8_t*>(data.data());
+
+    size_t count = 0;
+    size_t i = 0;
+    while (i < simd_end) {
+        const size_t block_end = std::min(simd_end, i + 255 * neon::NEON_REGISTER_SIZE);
+        uint8x16_t lane_counts = vdupq_n_u8(0);
+        for (; i < block_end; i += neon::NEON_REGISTER_SIZE) {
+            // Compare yields 0xFF (-1) per match
+            lane_counts = vsubq_u8(lane_counts, vceqq_u8(vld1q_u8(ptr + i), soh_vec));
+        }
+        count += vaddlvq_u8(lane_counts);
+    }
+
+    // Scalar tail
+    for (; i < data.size(); ++i) {
+        if (ptr[i] == static_cast<uint8_t>(fix::SOH)) [[unlikely]] ++count;
+    }
+
+    return count;
+}
+
+#endif  // NFX_NEON_AVAILABLE
+
+// ============================================================================
+// ARM SVE Scanner (predicated, vector-length agnostic)
+// ============================================================================
+
+#if NFX_SVE_AVAILABLE
+
+namespace detail {
+
+/// SVE first-occurrence search; whilelt predicate covers the tail
+[[nodiscard]] NFX_FORCE_INLINE
+size_t find_byte_sve(std::span<const char> data, size_t start, char needle) noexcept {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t size = data.size();
+
+    for (uint64_t i = start; i < size; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, size);
+        const svbool_t match = svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i),
+                                            static_cast<uint8_t>(needle));
+        if (svptest_any(pg, match)) {
+            // Active lanes before the first match
+            return static_cast<size_t>(i + svcntp_b8(pg, svbrkb_b_z(pg, match)));
+        }
+    }
+    return data.size();
+}
+
+}  // namespace detail
+
+/// SVE-accelerated find next SOH
+[[nodiscard]] NFX_HOT
+inline size_t find_soh_sve(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_byte_sve(data, start, fix::SOH);
+}
+
+/// SVE-accelerated find '='
+[[nodiscard]] NFX_HOT
+inline size_t find_equals_sve(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_byte_sve(data, start, fix::EQUALS);
+}
+
+/// Count SOH occurrences using SVE predicate popcount
+[[nodiscard]] NFX_HOT
+inline size_t count_soh_sve(std::span<const char> data) noexcept {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t size = data.size();
+
+    uint64_t count = 0;
+    for (uint64_t i = 0; i < size; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, size);
+        const svbool_t match = svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i),
+                                            static_cast<uint8_t>(fix::SOH));
+        count += svcntp_b8(pg, match);
+    }
+    return static_cast<size_t>(count);
+}
+
+#endif  // NFX_SVE_AVAILABLE
+
 // ============================================================================
 // Unified API (auto-selects SIMD or scalar)
 // ============================================================================
 
 /// Scan for all SOH positions (auto-selects best implementation)
-/// Priority: AVX-512 > AVX2 > Scalar
+/// Priority: AVX-512 > AVX2 > NEON > Scalar
 [[nodiscard]] NFX_HOT
 inline SohPositions scan_soh(std::span<const char> data) noexcept {
 #if NFX_AVX512_AVAILABLE
@@ -453,12 +631,17 @@ inline SohPositions scan_soh(std::span<const char> data) noexcept {
         NFX_ASSUME(data.size() >= AVX2_REGISTER_SIZE);
         return scan_soh_avx2(data);
     }
+#endif
+#if NFX_NEON_AVAILABLE
+    if (data.size() >= 64) [[likely]] {
+        return scan_soh_neon(data);
+    }
 #endif
     return scan_soh_scalar(data);
 }
 
 /// Find next SOH position (auto-selects best implementation)
-/// Priority: AVX-512 > AVX2 > Scalar
+/// Priority: AVX-512 > AVX2 > SVE (wider than 128-bit) > NEON > Scalar
 [[nodiscard]] NFX_HOT
 inline size_t find_soh(
     std::span<const char> data,
@@ -476,12 +659,22 @@ inline size_t find_soh(
         NFX_ASSUME(remaining >= AVX2_REGISTER_SIZE);
         return find_soh_avx2(data, start);
     }
+#endif
+#if NFX_SVE_AVAILABLE
+    if (remaining >= 64 && neon::sve_wider_than_neon()) [[likely]] {
+        return find_soh_sve(data, start);
+    }
+#endif
+#if NFX_NEON_AVAILABLE
+    if (remaining >= 32) [[likely]] {
+        return find_soh_neon(data, start);
+    }
 #endif
     return find_soh_scalar(data, start);
 }
 
 /// Find '=' position (auto-selects best implementation)
-/// Priority: AVX-512 > AVX2 > Scalar
+/// Priority: AVX-512 > AVX2 > SVE (wider than 128-bit) > NEON > Scalar
 [[nodiscard]] NFX_HOT
 inline size_t find_equals(
     std::span<const char> data,
@@ -499,12 +692,22 @@ inline size_t find_equals(
         NFX_ASSUME(remaining >= AVX2_REGISTER_SIZE);
         return find_equals_avx2(data, start);
     }
+#endif
+#if NFX_SVE_AVAILABLE
+    if (remaining >= 64 && neon::sve_wider_than_neon()) [[likely]] {
+        return find_equals_sve(data, start);
+    }
+#endif
+#if NFX_NEON_AVAILABLE
+    if (remaining >= 32) [[likely]] {
+        return find_equals_neon(data, start);
+    }
 #endif
     return find_equals_scalar(data, start);
 }
 
 /// Count SOH occurrences
-/// Priority: AVX-512 > AVX2 > Scalar
+/// Priority: AVX-512 > AVX2 > SVE (wider than 128-bit) > NEON > Scalar
 [[nodiscard]] NFX_HOT
 inline size_t count_soh(std::span<const char> data) noexcept {
 #if NFX_AVX512_AVAILABLE
@@ -516,6 +719,16 @@ inline size_t count_soh(std::span<const char> data) noexcept {
     if (data.size() >= 64) [[likely]] {
         return count_soh_avx2(data);
     }
+#endif
+#if NFX_SVE_AVAILABLE
+    if (data.size() >= 64 && neon::sve_wider_than_neon()) [[likely]] {
+        return count_soh_sve(data);
+    }
+#endif
+#if NFX_NEON_AVAILABLE
+    if (data.size() >= 64) [[likely]] {
+        return count_soh_neon(data);
+    }
 #endif
     size_t count = 0;
     for (char c : data) {
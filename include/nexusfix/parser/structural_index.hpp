@@ -13,6 +13,7 @@
 ///            - Parse only required tags
 ///            - ~20ns per accessed field
 
+#include <bit>
 #include <span>
 #include <cstdint>
 #include <cstddef>
@@ -26,6 +27,8 @@
 #include "nexusfix/util/compiler.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
+#include "nexusfix/parser/simd_neon.hpp"
 
 // SIMD headers
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
@@ -75,6 +78,20 @@ public:
         }
     }
 
+    /// Append data after current contents (bounded by capacity)
+    /// Zeros the SIMD padding window past the new end.
+    /// Returns number of bytes copied.
+    size_t append(std::span<const char> msg) noexcept {
+        const size_t n = std::min(msg.size(), MaxSize - size_);
+        std::memcpy(buffer_.data() + size_, msg.data(), n);
+        size_ += n;
+        std::memset(buffer_.data() + size_, 0, SIMD_PADDING);
+        return n;
+    }
+
+    /// Drop contents (padding is re-zeroed by the next set/append)
+    void clear() noexcept { size_ = 0; }
+
     /// Get buffer as span (actual data only, not padding)
     [[nodiscard]] std::span<const char> data() const noexcept {
         return std::span<const char>{buffer_.data(), size_};
@@ -125,6 +142,9 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
     uint16_t body_length_start;                        // Position of tag 9=
     uint16_t msg_type_start;                           // Position of tag 35=
     uint16_t message_size;                             // Total message size
+    uint32_t byte_sum;                                 // Sum of all bytes (fused build only)
+    uint8_t computed_checksum;                         // Tag 10 value over [0, checksum_start)
+    bool checksum_computed;                            // byte_sum/computed_checksum are set
 
     constexpr FIXStructuralIndex() noexcept
         : soh_positions{}
@@ -135,6 +155,9 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
         , body_length_start{0}
         , msg_type_start{0}
         , message_size{0}
+        , byte_sum{0}
+        , computed_checksum{0}
+        , checksum_computed{false}
     {}
 
     /// Get field count (number of tag=value pairs)
@@ -168,13 +191,9 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
         auto bounds = field_bounds(field_idx);
         if (bounds[0] >= bounds[1]) [[unlikely]] return 0;
 
-        int tag = 0;
-        for (uint16_t i = bounds[0]; i < bounds[1]; ++i) {
-            char c = msg[i];
-            if (c < '0' || c > '9') [[unlikely]] return 0;
-            tag = tag * 10 + (c - '0');
-        }
-        return tag;
+        int tag = parser::decode_tag(msg, bounds[0],
+            static_cast<size_t>(bounds[1] - bounds[0]));
+        return tag == parser::INVALID_TAG ? 0 : tag;
     }
 
     /// Extract value at field index as string_view (zero-copy)
@@ -190,6 +209,19 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
             static_cast<size_t>(bounds[3] - bounds[2])};
     }
 
+    /// Compare computed checksum against the 3-digit tag 10 value
+    /// Requires an index built by build_index_with_checksum()
+    [[nodiscard]] constexpr bool checksum_matches(std::span<const char> msg) const noexcept {
+        const size_t value_pos = static_cast<size_t>(checksum_start) + 3;  // Skip "10="
+        if (!checksum_computed || checksum_start == 0 ||
+            value_pos + 3 > msg.size()) [[unlikely]] {
+            return false;
+        }
+        const char* cs = msg.data() + value_pos;
+        int expected = (cs[0] - '0') * 100 + (cs[1] - '0') * 10 + (cs[2] - '0');
+        return static_cast<int>(computed_checksum) == expected;
+    }
+
     /// Find field by tag number (linear search through index)
     [[nodiscard]] size_t find_tag(std::span<const char> msg, int target_tag) const noexcept {
         for (size_t i = 0; i < soh_count; ++i) {
@@ -205,16 +237,44 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
 // Scalar Implementation
 // ============================================================================
 
-/// Build structural index using scalar code (fallback)
+namespace detail {
+
+/// Derive tag 10 value from the whole-message byte sum
+/// Checksum covers [0, checksum_start); the short trailer "10=NNN|" is
+/// subtracted instead of summing the body a second time.
+NFX_FORCE_INLINE void finalize_checksum(
+    FIXStructuralIndex& idx,
+    const char* ptr,
+    size_t len,
+    uint32_t byte_sum) noexcept
+{
+    idx.byte_sum = byte_sum;
+    uint32_t trailer_sum = 0;
+    if (idx.checksum_start > 0) [[likely]] {
+        for (size_t i = idx.checksum_start; i < len; ++i) {
+            trailer_sum += static_cast<uint8_t>(ptr[i]);
+        }
+    }
+    idx.computed_checksum = static_cast<uint8_t>((byte_sum - trailer_sum) & 0xFF);
+    idx.checksum_computed = true;
+}
+
+/// Scalar index builder, optionally summing bytes in the same loop
+template <bool ComputeChecksum>
 [[nodiscard]] NFX_HOT
-inline FIXStructuralIndex build_index_scalar(std::span<const char> data) noexcept {
+inline FIXStructuralIndex build_index_scalar_impl(std::span<const char> data) noexcept {
     FIXStructuralIndex idx;
     idx.message_size = static_cast<uint16_t>(data.size());
 
     const char* ptr = data.data();
     const size_t len = data.size();
+    uint32_t byte_sum = 0;
 
-    for (size_t i = 0; i < len && idx.soh_count < MAX_FIELDS; ++i) {
+    size_t i = 0;
+    for (; i < len && idx.soh_count < MAX_FIELDS; ++i) {
+        if constexpr (ComputeChecksum) {
+            byte_sum += static_cast<uint8_t>(ptr[i]);
+        }
         if (ptr[i] == fix::EQUALS) [[unlikely]] {
             idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
 
@@ -235,9 +295,30 @@ inline FIXStructuralIndex build_index_scalar(std::span<const char> data) noexcep
         }
     }
 
+    if constexpr (ComputeChecksum) {
+        for (; i < len; ++i) {
+            byte_sum += static_cast<uint8_t>(ptr[i]);
+        }
+        finalize_checksum(idx, ptr, len, byte_sum);
+    }
+
     return idx;
 }
 
+}  // namespace detail
+
+/// Build structural index using scalar code (fallback)
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_scalar(std::span<const char> data) noexcept {
+    return detail::build_index_scalar_impl<false>(data);
+}
+
+/// Build structural index and checksum in one scalar pass
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum_scalar(std::span<const char> data) noexcept {
+    return detail::build_index_scalar_impl<true>(data);
+}
+
 // ============================================================================
 // AVX2 Implementation
 // ============================================================================
@@ -259,22 +340,33 @@ inline void extract_positions_avx2(
     }
 }
 
-/// Build structural index using AVX2 (processes 32 bytes at a time)
+namespace detail {
+
+/// AVX2 index builder, optionally summing bytes (vpsadbw) in the same loop
+template <bool ComputeChecksum>
 [[nodiscard]] NFX_HOT
-inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept {
+inline FIXStructuralIndex build_index_avx2_impl(std::span<const char> data) noexcept {
     FIXStructuralIndex idx;
     idx.message_size = static_cast<uint16_t>(data.size());
 
     const __m256i soh_vec = _mm256_set1_epi8(fix::SOH);
     const __m256i eq_vec = _mm256_set1_epi8(fix::EQUALS);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i sum_vec = _mm256_setzero_si256();
     const size_t simd_end = data.size() & ~31ULL;  // Round down to 32
     const char* __restrict ptr = data.data();
 
     // Process 32-byte chunks
-    for (size_t i = 0; i < simd_end && idx.soh_count < MAX_FIELDS - 32; i += 32) {
+    size_t i = 0;
+    for (; i < simd_end && idx.soh_count < MAX_FIELDS - 32; i += 32) {
         __m256i chunk = _mm256_loadu_si256(
             reinterpret_cast<const __m256i*>(ptr + i));
 
+        if constexpr (ComputeChecksum) {
+            // SAD against zero sums each 8-byte group into a 64-bit lane
+            sum_vec = _mm256_add_epi64(sum_vec, _mm256_sad_epu8(chunk, zero));
+        }
+
         // Detect SOH positions
         __m256i soh_cmp = _mm256_cmpeq_epi8(chunk, soh_vec);
         uint32_t soh_mask = static_cast<uint32_t>(_mm256_movemask_epi8(soh_cmp));
@@ -290,10 +382,28 @@ inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept
                                idx.equals_count, MAX_FIELDS);
     }
 
-    // Handle remaining bytes with scalar code
-    for (size_t i = simd_end; i < data.size() && idx.soh_count < MAX_FIELDS; ++i) {
+    uint32_t byte_sum = 0;
+    if constexpr (ComputeChecksum) {
+        __m128i sum128 = _mm_add_epi64(
+            _mm256_castsi256_si128(sum_vec),
+            _mm256_extracti128_si256(sum_vec, 1));
+        sum128 = _mm_add_epi64(sum128, _mm_unpackhi_epi64(sum128, sum128));
+        byte_sum = static_cast<uint32_t>(_mm_cvtsi128_si64(sum128));
+    }
+
+    // Handle remaining bytes with scalar code (from where SIMD stopped)
+    for (; i < data.size(); ++i) {
+        if constexpr (ComputeChecksum) {
+            byte_sum += static_cast<uint8_t>(ptr[i]);
+        }
+        if (idx.soh_count >= MAX_FIELDS) [[unlikely]] {
+            if constexpr (ComputeChecksum) continue;
+            else break;
+        }
         if (ptr[i] == fix::EQUALS) [[unlikely]] {
-            idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+            if (idx.equals_count < MAX_FIELDS) {
+                idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+            }
         }
         else if (ptr[i] == fix::SOH) [[unlikely]] {
             idx.soh_positions[idx.soh_count++] = static_cast<uint16_t>(i);
@@ -301,8 +411,8 @@ inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept
     }
 
     // Post-process to find important tags
-    for (uint16_t i = 0; i < idx.equals_count && i < 10; ++i) {
-        uint16_t eq_pos = idx.equals_positions[i];
+    for (uint16_t k = 0; k < idx.equals_count && k < 10; ++k) {
+        uint16_t eq_pos = idx.equals_positions[k];
         if (eq_pos < 2) continue;
 
         // Check for 2-digit tags
@@ -322,8 +432,8 @@ inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept
     // Find checksum tag (near end)
     if (idx.equals_count > 0) {
         size_t end_idx = (idx.equals_count > 5) ? idx.equals_count - 5 : 0;
-        for (size_t i = idx.equals_count; i > end_idx; --i) {
-            uint16_t eq_pos = idx.equals_positions[i - 1];
+        for (size_t k = idx.equals_count; k > end_idx; --k) {
+            uint16_t eq_pos = idx.equals_positions[k - 1];
             if (eq_pos >= 2 && ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
                 idx.checksum_start = eq_pos - 2;
                 break;
@@ -331,9 +441,27 @@ inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept
         }
     }
 
+    if constexpr (ComputeChecksum) {
+        finalize_checksum(idx, ptr, data.size(), byte_sum);
+    }
+
     return idx;
 }
 
+}  // namespace detail
+
+/// Build structural index using AVX2 (processes 32 bytes at a time)
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept {
+    return detail::build_index_avx2_impl<false>(data);
+}
+
+/// Build structural index and checksum in one AVX2 pass
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum_avx2(std::span<const char> data) noexcept {
+    return detail::build_index_avx2_impl<true>(data);
+}
+
 #endif  // NFX_HAS_SIMD
 
 // ============================================================================
@@ -357,22 +485,69 @@ inline void extract_positions_avx512(
     }
 }
 
-/// Build structural index using AVX-512 (processes 64 bytes at a time)
+#if defined(__AVX512VBMI2__)
+
+/// Extract set bit positions with VBMI2 compress (no per-bit loop)
+/// vpcompressw packs the lane indexes selected by each 32-bit half of the
+/// mask; the full 32-lane vector is stored and count advances by popcount,
+/// so positions needs 64 entries of slack past count.
+NFX_FORCE_INLINE void extract_positions_vbmi2(
+    uint64_t mask,
+    size_t offset,
+    uint16_t* positions,
+    uint16_t& count,
+    uint16_t max_count) noexcept
+{
+    if (count + 64 > max_count) [[unlikely]] {
+        extract_positions_avx512(mask, offset, positions, count, max_count);
+        return;
+    }
+
+    const __m512i lane_idx = _mm512_add_epi16(
+        _mm512_set_epi16(31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+                         15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        _mm512_set1_epi16(static_cast<short>(offset)));
+
+    const __mmask32 lo = static_cast<__mmask32>(mask);
+    const __mmask32 hi = static_cast<__mmask32>(mask >> 32);
+
+    _mm512_storeu_si512(positions + count, _mm512_maskz_compress_epi16(lo, lane_idx));
+    count += static_cast<uint16_t>(std::popcount(static_cast<uint32_t>(lo)));
+
+    const __m512i hi_idx = _mm512_add_epi16(lane_idx, _mm512_set1_epi16(32));
+    _mm512_storeu_si512(positions + count, _mm512_maskz_compress_epi16(hi, hi_idx));
+    count += static_cast<uint16_t>(std::popcount(static_cast<uint32_t>(hi)));
+}
+
+#endif  // __AVX512VBMI2__
+
+namespace detail {
+
+/// AVX-512 index builder, optionally summing bytes in the same loop
+/// UseCompress selects VBMI2 compress-store position extraction.
+template <bool ComputeChecksum, bool UseCompress = false>
 [[nodiscard]] NFX_HOT
-inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcept {
+inline FIXStructuralIndex build_index_avx512_impl(std::span<const char> data) noexcept {
     FIXStructuralIndex idx;
     idx.message_size = static_cast<uint16_t>(data.size());
 
     const __m512i soh_vec = _mm512_set1_epi8(fix::SOH);
     const __m512i eq_vec = _mm512_set1_epi8(fix::EQUALS);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i sum_vec = _mm512_setzero_si512();
     const size_t simd_end = data.size() & ~63ULL;  // Round down to 64
     const char* __restrict ptr = data.data();
 
     // Process 64-byte chunks
-    for (size_t i = 0; i < simd_end && idx.soh_count < MAX_FIELDS - 64; i += 64) {
+    size_t i = 0;
+    for (; i < simd_end && idx.soh_count < MAX_FIELDS - 64; i += 64) {
         __m512i chunk = _mm512_loadu_si512(
             reinterpret_cast<const __m512i*>(ptr + i));
 
+        if constexpr (ComputeChecksum) {
+            sum_vec = _mm512_add_epi64(sum_vec, _mm512_sad_epu8(chunk, zero));
+        }
+
         // Detect SOH positions (returns 64-bit mask directly)
         __mmask64 soh_mask = _mm512_cmpeq_epi8_mask(chunk, soh_vec);
 
@@ -380,16 +555,45 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
         __mmask64 eq_mask = _mm512_cmpeq_epi8_mask(chunk, eq_vec);
 
         // Extract positions from masks
-        extract_positions_avx512(soh_mask, i, idx.soh_positions.data(),
-                                 idx.soh_count, MAX_FIELDS);
-        extract_positions_avx512(eq_mask, i, idx.equals_positions.data(),
-                                 idx.equals_count, MAX_FIELDS);
+#if defined(__AVX512VBMI2__)
+        if constexpr (UseCompress) {
+            extract_positions_vbmi2(soh_mask, i, idx.soh_positions.data(),
+                                    idx.soh_count, MAX_FIELDS);
+            extract_positions_vbmi2(eq_mask, i, idx.equals_positions.data(),
+                                    idx.equals_count, MAX_FIELDS);
+        } else
+#endif
+        {
+            extract_positions_avx512(soh_mask, i, idx.soh_positions.data(),
+                                     idx.soh_count, MAX_FIELDS);
+            extract_positions_avx512(eq_mask, i, idx.equals_positions.data(),
+                                     idx.equals_count, MAX_FIELDS);
+        }
+    }
+
+    uint32_t byte_sum = 0;
+    if constexpr (ComputeChecksum) {
+        // Spill and add lanes (_mm512_reduce_add_epi64 trips -Wuninitialized on GCC 12)
+        alignas(64) uint64_t lanes[8];
+        _mm512_store_si512(reinterpret_cast<__m512i*>(lanes), sum_vec);
+        for (uint64_t lane : lanes) {
+            byte_sum += static_cast<uint32_t>(lane);
+        }
     }
 
-    // Handle remaining bytes with scalar code
-    for (size_t i = simd_end; i < data.size() && idx.soh_count < MAX_FIELDS; ++i) {
+    // Handle remaining bytes with scalar code (from where SIMD stopped)
+    for (; i < data.size(); ++i) {
+        if constexpr (ComputeChecksum) {
+            byte_sum += static_cast<uint8_t>(ptr[i]);
+        }
+        if (idx.soh_count >= MAX_FIELDS) [[unlikely]] {
+            if constexpr (ComputeChecksum) continue;
+            else break;
+        }
         if (ptr[i] == fix::EQUALS) [[unlikely]] {
-            idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+            if (idx.equals_count < MAX_FIELDS) {
+                idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+            }
         }
         else if (ptr[i] == fix::SOH) [[unlikely]] {
             idx.soh_positions[idx.soh_count++] = static_cast<uint16_t>(i);
@@ -397,8 +601,8 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
     }
 
     // Post-process to find important tags (same as AVX2)
-    for (uint16_t i = 0; i < idx.equals_count && i < 10; ++i) {
-        uint16_t eq_pos = idx.equals_positions[i];
+    for (uint16_t k = 0; k < idx.equals_count && k < 10; ++k) {
+        uint16_t eq_pos = idx.equals_positions[k];
         if (eq_pos < 2) continue;
 
         if (ptr[eq_pos - 2] >= '0' && ptr[eq_pos - 2] <= '9' &&
@@ -414,8 +618,8 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
 
     if (idx.equals_count > 0) {
         size_t end_idx = (idx.equals_count > 5) ? idx.equals_count - 5 : 0;
-        for (size_t i = idx.equals_count; i > end_idx; --i) {
-            uint16_t eq_pos = idx.equals_positions[i - 1];
+        for (size_t k = idx.equals_count; k > end_idx; --k) {
+            uint16_t eq_pos = idx.equals_positions[k - 1];
             if (eq_pos >= 2 && ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
                 idx.checksum_start = eq_pos - 2;
                 break;
@@ -423,11 +627,182 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
         }
     }
 
+    if constexpr (ComputeChecksum) {
+        finalize_checksum(idx, ptr, data.size(), byte_sum);
+    }
+
     return idx;
 }
 
+}  // namespace detail
+
+/// Build structural index using AVX-512 (processes 64 bytes at a time)
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcept {
+    return detail::build_index_avx512_impl<false>(data);
+}
+
+/// Build structural index and checksum in one AVX-512 pass
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum_avx512(std::span<const char> data) noexcept {
+    return detail::build_index_avx512_impl<true>(data);
+}
+
+#if defined(__AVX512VBMI2__)
+
+/// Build structural index using AVX-512 with VBMI2 compress extraction
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_avx512_vbmi2(std::span<const char> data) noexcept {
+    return detail::build_index_avx512_impl<false, true>(data);
+}
+
+/// Build structural index and checksum in one AVX-512 VBMI2 pass
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum_avx512_vbmi2(std::span<const char> data) noexcept {
+    return detail::build_index_avx512_impl<true, true>(data);
+}
+
+#endif  // __AVX512VBMI2__
+
 #endif  // AVX-512
 
+// ============================================================================
+// ARM NEON Implementation
+// ============================================================================
+
+#if NFX_NEON_AVAILABLE
+
+/// Extract all set bit positions from 64-bit mask
+inline void extract_positions_neon(
+    uint64_t mask,
+    size_t offset,
+    uint16_t* positions,
+    uint16_t& count,
+    uint16_t max_count) noexcept
+{
+    while (mask != 0 && count < max_count) {
+        uint64_t bit = static_cast<uint64_t>(__builtin_ctzll(mask));  // rbit + clz
+        positions[count++] = static_cast<uint16_t>(offset + bit);
+        mask &= mask - 1;  // Clear lowest set bit
+    }
+}
+
+namespace detail {
+
+/// NEON index builder, optionally summing bytes in the same loop
+/// 64 bytes per iteration so masks have the AVX-512 one-bit-per-byte layout.
+template <bool ComputeChecksum>
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_neon_impl(std::span<const char> data) noexcept {
+    FIXStructuralIndex idx;
+    idx.message_size = static_cast<uint16_t>(data.size());
+
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const uint8x16_t eq_vec = vdupq_n_u8(static_cast<uint8_t>(fix::EQUALS));
+    uint32x4_t sum_vec = vdupq_n_u32(0);
+    const size_t simd_end = data.size() & ~63ULL;  // Round down to 64
+    const char* __restrict ptr = data.data();
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(ptr);
+
+    // Process 64-byte chunks
+    size_t i = 0;
+    for (; i < simd_end && idx.soh_count < MAX_FIELDS - 64; i += 64) {
+        const uint8x16_t c0 = vld1q_u8(bytes + i);
+        const uint8x16_t c1 = vld1q_u8(bytes + i + 16);
+        const uint8x16_t c2 = vld1q_u8(bytes + i + 32);
+        const uint8x16_t c3 = vld1q_u8(bytes + i + 48);
+
+        if constexpr (ComputeChecksum) {
+            sum_vec = neon::accumulate_64(sum_vec, c0, c1, c2, c3);
+        }
+
+        const uint64_t soh_mask = neon::bitmask_64(
+            vceqq_u8(c0, soh_vec), vceqq_u8(c1, soh_vec),
+            vceqq_u8(c2, soh_vec), vceqq_u8(c3, soh_vec));
+        const uint64_t eq_mask = neon::bitmask_64(
+            vceqq_u8(c0, eq_vec), vceqq_u8(c1, eq_vec),
+            vceqq_u8(c2, eq_vec), vceqq_u8(c3, eq_vec));
+
+        extract_positions_neon(soh_mask, i, idx.soh_positions.data(),
+                               idx.soh_count, MAX_FIELDS);
+        extract_positions_neon(eq_mask, i, idx.equals_positions.data(),
+                               idx.equals_count, MAX_FIELDS);
+    }
+
+    uint32_t byte_sum = 0;
+    if constexpr (ComputeChecksum) {
+        byte_sum = vaddvq_u32(sum_vec);
+    }
+
+    // Handle remaining bytes with scalar code (from where SIMD stopped)
+    for (; i < data.size(); ++i) {
+        if constexpr (ComputeChecksum) {
+            byte_sum += static_cast<uint8_t>(ptr[i]);
+        }
+        if (idx.soh_count >= MAX_FIELDS) [[unlikely]] {
+            if constexpr (ComputeChecksum) continue;
+            else break;
+        }
+        if (ptr[i] == fix::EQUALS) [[unlikely]] {
+            if (idx.equals_count < MAX_FIELDS) {
+                idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+            }
+        }
+        else if (ptr[i] == fix::SOH) [[unlikely]] {
+            idx.soh_positions[idx.soh_count++] = static_cast<uint16_t>(i);
+        }
+    }
+
+    // Post-process to find important tags (same as AVX2)
+    for (uint16_t k = 0; k < idx.equals_count && k < 10; ++k) {
+        uint16_t eq_pos = idx.equals_positions[k];
+        if (eq_pos < 2) continue;
+
+        if (ptr[eq_pos - 2] >= '0' && ptr[eq_pos - 2] <= '9' &&
+            ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            int tag = (ptr[eq_pos - 2] - '0') * 10 + (ptr[eq_pos - 1] - '0');
+            if (tag == 35) idx.msg_type_start = eq_pos - 2;
+        }
+        else if (ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            int tag = ptr[eq_pos - 1] - '0';
+            if (tag == 9) idx.body_length_start = eq_pos - 1;
+        }
+    }
+
+    if (idx.equals_count > 0) {
+        size_t end_idx = (idx.equals_count > 5) ? idx.equals_count - 5 : 0;
+        for (size_t k = idx.equals_count; k > end_idx; --k) {
+            uint16_t eq_pos = idx.equals_positions[k - 1];
+            if (eq_pos >= 2 && ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
+                idx.checksum_start = eq_pos - 2;
+                break;
+            }
+        }
+    }
+
+    if constexpr (ComputeChecksum) {
+        finalize_checksum(idx, ptr, data.size(), byte_sum);
+    }
+
+    return idx;
+}
+
+}  // namespace detail
+
+/// Build structural index using NEON (processes 64 bytes at a time)
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_neon(std::span<const char> data) noexcept {
+    return detail::build_index_neon_impl<false>(data);
+}
+
+/// Build structural index and checksum in one NEON pass
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum_neon(std::span<const char> data) noexcept {
+    return detail::build_index_neon_impl<true>(data);
+}
+
+#endif  // NFX_NEON_AVAILABLE
+
 // ============================================================================
 // Runtime SIMD Dispatch (simdjson-style)
 // ============================================================================
@@ -436,7 +811,9 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
 enum class SimdImpl : uint8_t {
     Scalar = 0,
     AVX2 = 1,
-    AVX512 = 2
+    AVX512 = 2,
+    AVX512_VBMI2 = 3,  // AVX-512 + compress-store extraction (Ice Lake+)
+    NEON = 4           // AArch64 Advanced SIMD (Graviton, Ampere)
 };
 
 /// Get implementation name
@@ -445,6 +822,8 @@ enum class SimdImpl : uint8_t {
         case SimdImpl::Scalar: return "Scalar";
         case SimdImpl::AVX2:   return "AVX2";
         case SimdImpl::AVX512: return "AVX-512";
+        case SimdImpl::AVX512_VBMI2: return "AVX-512 VBMI2";
+        case SimdImpl::NEON:   return "NEON";
     }
     return "Unknown";
 }
@@ -456,12 +835,21 @@ using BuildIndexFn = FIXStructuralIndex(*)(std::span<const char>) noexcept;
 
 /// Runtime-selected implementation
 inline BuildIndexFn g_build_index_fn = nullptr;
+inline BuildIndexFn g_build_index_checksum_fn = nullptr;
 inline SimdImpl g_active_impl = SimdImpl::Scalar;
 inline bool g_initialized = false;
 
-/// Detect CPU capabilities at runtime using CPUID
+/// Detect CPU capabilities at runtime (CPUID on x86, baseline NEON on AArch64)
 [[nodiscard]] inline SimdImpl detect_best_impl() noexcept {
 #if NFX_ARCH_X64 || NFX_ARCH_X86
+    // Check for AVX-512 VBMI2 (compress-store position extraction)
+    #if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vbmi2")) {
+        return SimdImpl::AVX512_VBMI2;
+    }
+    #endif
+
     // Check for AVX-512 support (both F and BW required)
     #if defined(__AVX512F__) && defined(__AVX512BW__)
     if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
@@ -475,6 +863,9 @@ inline bool g_initialized = false;
         return SimdImpl::AVX2;
     }
     #endif
+#elif NFX_NEON_AVAILABLE
+    // Advanced SIMD is mandatory on AArch64
+    return SimdImpl::NEON;
 #endif
 
     return SimdImpl::Scalar;
@@ -483,6 +874,10 @@ inline bool g_initialized = false;
 /// Select function pointer based on implementation
 [[nodiscard]] inline BuildIndexFn select_build_index_fn(SimdImpl impl) noexcept {
     switch (impl) {
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+        case SimdImpl::AVX512_VBMI2:
+            return build_index_avx512_vbmi2;
+#endif
 #if defined(__AVX512F__) && defined(__AVX512BW__)
         case SimdImpl::AVX512:
             return build_index_avx512;
@@ -490,6 +885,10 @@ inline bool g_initialized = false;
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
         case SimdImpl::AVX2:
             return build_index_avx2;
+#endif
+#if NFX_NEON_AVAILABLE
+        case SimdImpl::NEON:
+            return build_index_neon;
 #endif
         case SimdImpl::Scalar:
         default:
@@ -497,6 +896,31 @@ inline bool g_initialized = false;
     }
 }
 
+/// Select fused index+checksum function pointer based on implementation
+[[nodiscard]] inline BuildIndexFn select_build_index_checksum_fn(SimdImpl impl) noexcept {
+    switch (impl) {
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+        case SimdImpl::AVX512_VBMI2:
+            return build_index_with_checksum_avx512_vbmi2;
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+        case SimdImpl::AVX512:
+            return build_index_with_checksum_avx512;
+#endif
+#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
+        case SimdImpl::AVX2:
+            return build_index_with_checksum_avx2;
+#endif
+#if NFX_NEON_AVAILABLE
+        case SimdImpl::NEON:
+            return build_index_with_checksum_neon;
+#endif
+        case SimdImpl::Scalar:
+        default:
+            return build_index_with_checksum_scalar;
+    }
+}
+
 }  // namespace detail
 
 /// Initialize runtime SIMD dispatch (call once at startup)
@@ -528,6 +952,16 @@ inline void init_simd_dispatch() noexcept {
                 detail::g_active_impl = SimdImpl::AVX512;
             }
 #endif
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+            else if (std::strcmp(impl, "avx512vbmi2") == 0) {
+                detail::g_active_impl = SimdImpl::AVX512_VBMI2;
+            }
+#endif
+#if NFX_NEON_AVAILABLE
+            else if (std::strcmp(impl, "neon") == 0) {
+                detail::g_active_impl = SimdImpl::NEON;
+            }
+#endif
 #if defined(_MSC_VER)
             std::free(const_cast<char*>(impl));
 #endif
@@ -535,6 +969,8 @@ inline void init_simd_dispatch() noexcept {
 
         // Set function pointer
         detail::g_build_index_fn = detail::select_build_index_fn(detail::g_active_impl);
+        detail::g_build_index_checksum_fn =
+            detail::select_build_index_checksum_fn(detail::g_active_impl);
         detail::g_initialized = true;
     });
 }
@@ -556,6 +992,17 @@ inline FIXStructuralIndex build_index(std::span<const char> data) noexcept {
     return detail::g_build_index_fn(data);
 }
 
+/// Build structural index and compute the tag 10 checksum in the same pass
+/// Byte sums are accumulated in the SOH/'=' mask loop, so validation needs
+/// no second memory pass (see FIXStructuralIndex::checksum_matches).
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_with_checksum(std::span<const char> data) noexcept {
+    if (!detail::g_initialized) [[unlikely]] {
+        init_simd_dispatch();
+    }
+    return detail::g_build_index_checksum_fn(data);
+}
+
 // ============================================================================
 // FIX Field Accessor (lazy parsing from index)
 // ============================================================================
@@ -205,6 +205,15 @@
     #define NFX_COLD
 #endif
 
+// Keep a function out of line
+#if NFX_COMPILER_MSVC
+    #define NFX_NOINLINE __declspec(noinline)
+#elif NFX_COMPILER_GCC || NFX_COMPILER_CLANG
+    #define NFX_NOINLINE __attribute__((noinline))
+#else
+    #define NFX_NOINLINE
+#endif
+
 // Cache line size (for alignment)
 #if defined(__cpp_lib_hardware_interference_size)
     #include <new>
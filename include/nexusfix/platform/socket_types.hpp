@@ -267,6 +267,38 @@ template <typename T>
 #endif
 }
 
+/// Enable kernel busy polling on a socket (Linux SO_BUSY_POLL)
+/// @param microseconds Time a blocking or MSG_DONTWAIT read may spin on
+///        the device queue; 0 disables
+/// @param prefer Also set SO_PREFER_BUSY_POLL (suppresses IRQ-driven
+///        NAPI while the application keeps polling; Linux 5.11+)
+/// @return false if unsupported or not permitted (raising the value above
+///         net.core.busy_read needs CAP_NET_ADMIN)
+[[nodiscard]] inline bool set_socket_busy_poll(
+    SocketHandle socket, int microseconds, bool prefer) noexcept
+{
+#if NFX_PLATFORM_LINUX && defined(SO_BUSY_POLL)
+    if (::setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL,
+                     sockopt_ptr(&microseconds), sizeof(microseconds)) != 0) {
+        return false;
+    }
+#if defined(SO_PREFER_BUSY_POLL)
+    int flag = prefer ? 1 : 0;
+    if (::setsockopt(socket, SOL_SOCKET, SO_PREFER_BUSY_POLL,
+                     sockopt_ptr(&flag), sizeof(flag)) != 0) {
+        return !prefer;
+    }
+#else
+    if (prefer) return false;
+#endif
+    return true;
+#else
+    (void)socket;
+    (void)prefer;
+    return microseconds == 0;
+#endif
+}
+
 // ============================================================================
 // Error Code Checks
 // ============================================================================
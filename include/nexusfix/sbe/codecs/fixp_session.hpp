@@ -0,0 +1,532 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/message_header.hpp"
+#include "nexusfix/sbe/types/composite_types.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// FIXP Session Messages (FIX Performance Session Layer)
+// ============================================================================
+//
+// Binary session layer for SBE order entry: Negotiate / Establish bind a
+// session (a 64-bit id, iLink 3 style) to a connection, Sequence carries the
+// next implicit sequence number (and doubles as keepalive), and
+// RetransmitRequest / Retransmission recover a recoverable flow. Application
+// messages carry no sequence number: each one after a Sequence (or
+// Retransmission) takes the next number.
+//
+// Template ids follow the iLink 3 numbering (500-510) within the NexusFix
+// schema, so session and application messages share one header and stream.
+//
+// Every codec is a fixed-length flyweight over the same header:
+//
+//   | MessageHeader (8) | body (BLOCK_LENGTH, int64 fields 8-aligned) |
+//
+// Usage:
+//   if (auto msg = writer.add<EstablishCodec>()) {
+//       msg->sessionId(id).timestamp(now).nextSeqNo(1).keepaliveInterval(1000);
+//   }
+//
+//   auto ack = EstablishmentAckCodec::wrapForDecode(data, length);
+//   if (ack.isValid()) next_inbound = ack.nextSeqNo();
+
+/// FIXP FlowType
+enum class FixpFlowType : SbeUint8 {
+    Recoverable = 0,   // Sequenced, retransmitted on request
+    Unsequenced = 1,   // No sequence numbers
+    Idempotent = 2,    // Sequenced, never retransmitted
+    None = 3           // No application messages in this direction
+};
+
+/// NegotiationReject / EstablishmentReject reason
+enum class FixpRejectCode : SbeUint8 {
+    Unspecified = 0,
+    Credentials = 1,
+    FlowTypeNotSupported = 2,
+    DuplicateId = 3,
+    Unnegotiated = 4,
+    AlreadyEstablished = 5,
+    KeepaliveInterval = 6
+};
+
+/// Terminate reason
+enum class FixpTerminationCode : SbeUint8 {
+    Finished = 0,
+    UnspecifiedError = 1,
+    ReRequestOutOfBounds = 2,
+    ReRequestInProgress = 3
+};
+
+/// RetransmitReject reason
+enum class FixpRetransmitRejectCode : SbeUint8 {
+    OutOfRange = 0,
+    InvalidSession = 1,
+    RequestLimitExceeded = 2
+};
+
+namespace detail {
+
+// ============================================================================
+// Shared Flyweight Plumbing
+// ============================================================================
+
+/// Wrap / validate / header encode for the fixed-length FIXP codecs
+/// @tparam Derived Concrete codec (fluent setters return Derived&)
+template <typename Derived, SbeUint16 TemplateId, std::size_t BlockLength>
+class FixpCodecBase {
+public:
+    static constexpr SbeUint16 TEMPLATE_ID = TemplateId;
+    static constexpr std::size_t BLOCK_LENGTH = BlockLength;
+    static constexpr std::size_t TOTAL_SIZE = MessageHeader::SIZE + BLOCK_LENGTH;
+
+    [[nodiscard]] NFX_FORCE_INLINE static Derived wrapForDecode(
+        const char* buffer, std::size_t length) noexcept {
+        Derived codec;
+        codec.buffer_ = buffer;
+        codec.length_ = length;
+        return codec;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static Derived wrapForEncode(
+        char* buffer, std::size_t length) noexcept {
+        return wrapForDecode(buffer, length);
+    }
+
+    // Check if buffer holds this message type
+    [[nodiscard]] NFX_FORCE_INLINE bool isValid() const noexcept {
+        if (buffer_ == nullptr || length_ < TOTAL_SIZE) {
+            return false;
+        }
+        auto header = MessageHeader::wrapForDecode(buffer_, length_);
+        return header.templateId() == TEMPLATE_ID &&
+               header.blockLength() == BLOCK_LENGTH;
+    }
+
+    // Encode header and clear the body (call first)
+    NFX_FORCE_INLINE Derived& encodeHeader() noexcept {
+        auto header = MessageHeader::wrapForEncode(mutableBuffer(), length_);
+        header.encodeHeader(BLOCK_LENGTH, TEMPLATE_ID);
+        std::memset(mutableBody(), 0, BLOCK_LENGTH);
+        return static_cast<Derived&>(*this);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE MessageHeader header() const noexcept {
+        return MessageHeader::wrapForDecode(buffer_, length_);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE const char* body() const noexcept {
+        return buffer_ + MessageHeader::SIZE;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBody() noexcept {
+        return mutableBuffer() + MessageHeader::SIZE;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {
+        return const_cast<char*>(buffer_);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {
+        return std::span<const char>{buffer_, TOTAL_SIZE};
+    }
+
+    [[nodiscard]] static constexpr std::size_t encodedSize() noexcept {
+        return TOTAL_SIZE;
+    }
+
+protected:
+    [[nodiscard]] NFX_FORCE_INLINE SbeUint64 getU64(std::size_t offset) const noexcept {
+        return read_uint64(body() + offset);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE SbeUint32 getU32(std::size_t offset) const noexcept {
+        return read_uint32(body() + offset);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE SbeUint8 getU8(std::size_t offset) const noexcept {
+        return read_uint8(body() + offset);
+    }
+
+    NFX_FORCE_INLINE Derived& putU64(std::size_t offset, SbeUint64 value) noexcept {
+        write_uint64(mutableBody() + offset, value);
+        return static_cast<Derived&>(*this);
+    }
+
+    NFX_FORCE_INLINE Derived& putU32(std::size_t offset, SbeUint32 value) noexcept {
+        write_uint32(mutableBody() + offset, value);
+        return static_cast<Derived&>(*this);
+    }
+
+    NFX_FORCE_INLINE Derived& putU8(std::size_t offset, SbeUint8 value) noexcept {
+        write_uint8(mutableBody() + offset, value);
+        return static_cast<Derived&>(*this);
+    }
+
+    const char* buffer_{nullptr};
+    std::size_t length_{0};
+};
+
+}  // namespace detail
+
+// ============================================================================
+// Negotiate / NegotiationResponse / NegotiationReject (24-byte body)
+// ============================================================================
+//
+//   Offset  0- 7: sessionId          uint64
+//   Offset  8-15: timestamp          int64   (request timestamp in replies)
+//   Offset    16: flow / code        uint8
+//   Offset 17-23: padding
+
+class NegotiateCodec
+    : public detail::FixpCodecBase<NegotiateCodec, MessageHeader::TemplateId::Negotiate, 24> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t Timestamp = 8;
+        static constexpr std::size_t ClientFlow = 16;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp timestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::Timestamp);
+    }
+    [[nodiscard]] FixpFlowType clientFlow() const noexcept {
+        return static_cast<FixpFlowType>(getU8(Offset::ClientFlow));
+    }
+
+    NegotiateCodec& sessionId(SbeUint64 v) noexcept { return putU64(Offset::SessionId, v); }
+    NegotiateCodec& timestamp(Timestamp v) noexcept {
+        return putU64(Offset::Timestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    NegotiateCodec& clientFlow(FixpFlowType v) noexcept {
+        return putU8(Offset::ClientFlow, static_cast<SbeUint8>(v));
+    }
+};
+
+class NegotiationResponseCodec
+    : public detail::FixpCodecBase<NegotiationResponseCodec,
+                                   MessageHeader::TemplateId::NegotiationResponse, 24> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t ServerFlow = 16;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] FixpFlowType serverFlow() const noexcept {
+        return static_cast<FixpFlowType>(getU8(Offset::ServerFlow));
+    }
+
+    NegotiationResponseCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    NegotiationResponseCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    NegotiationResponseCodec& serverFlow(FixpFlowType v) noexcept {
+        return putU8(Offset::ServerFlow, static_cast<SbeUint8>(v));
+    }
+};
+
+class NegotiationRejectCodec
+    : public detail::FixpCodecBase<NegotiationRejectCodec,
+                                   MessageHeader::TemplateId::NegotiationReject, 24> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t Code = 16;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] FixpRejectCode code() const noexcept {
+        return static_cast<FixpRejectCode>(getU8(Offset::Code));
+    }
+
+    NegotiationRejectCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    NegotiationRejectCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    NegotiationRejectCodec& code(FixpRejectCode v) noexcept {
+        return putU8(Offset::Code, static_cast<SbeUint8>(v));
+    }
+};
+
+// ============================================================================
+// Establish / EstablishmentAck (32-byte body), EstablishmentReject (24)
+// ============================================================================
+//
+//   Offset  0- 7: sessionId          uint64
+//   Offset  8-15: timestamp          int64   (request timestamp in Ack)
+//   Offset 16-23: nextSeqNo          uint64  (sender's next outbound seq)
+//   Offset 24-27: keepaliveInterval  uint32  (milliseconds)
+//   Offset 28-31: padding
+
+class EstablishCodec
+    : public detail::FixpCodecBase<EstablishCodec, MessageHeader::TemplateId::Establish, 32> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t Timestamp = 8;
+        static constexpr std::size_t NextSeqNo = 16;
+        static constexpr std::size_t KeepaliveInterval = 24;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp timestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::Timestamp);
+    }
+    [[nodiscard]] SbeUint64 nextSeqNo() const noexcept { return getU64(Offset::NextSeqNo); }
+    [[nodiscard]] SbeUint32 keepaliveInterval() const noexcept {
+        return getU32(Offset::KeepaliveInterval);
+    }
+
+    EstablishCodec& sessionId(SbeUint64 v) noexcept { return putU64(Offset::SessionId, v); }
+    EstablishCodec& timestamp(Timestamp v) noexcept {
+        return putU64(Offset::Timestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    EstablishCodec& nextSeqNo(SbeUint64 v) noexcept { return putU64(Offset::NextSeqNo, v); }
+    EstablishCodec& keepaliveInterval(SbeUint32 v) noexcept {
+        return putU32(Offset::KeepaliveInterval, v);
+    }
+};
+
+class EstablishmentAckCodec
+    : public detail::FixpCodecBase<EstablishmentAckCodec,
+                                   MessageHeader::TemplateId::EstablishmentAck, 32> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t NextSeqNo = 16;
+        static constexpr std::size_t KeepaliveInterval = 24;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] SbeUint64 nextSeqNo() const noexcept { return getU64(Offset::NextSeqNo); }
+    [[nodiscard]] SbeUint32 keepaliveInterval() const noexcept {
+        return getU32(Offset::KeepaliveInterval);
+    }
+
+    EstablishmentAckCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    EstablishmentAckCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    EstablishmentAckCodec& nextSeqNo(SbeUint64 v) noexcept {
+        return putU64(Offset::NextSeqNo, v);
+    }
+    EstablishmentAckCodec& keepaliveInterval(SbeUint32 v) noexcept {
+        return putU32(Offset::KeepaliveInterval, v);
+    }
+};
+
+class EstablishmentRejectCodec
+    : public detail::FixpCodecBase<EstablishmentRejectCodec,
+                                   MessageHeader::TemplateId::EstablishmentReject, 24> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t Code = 16;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] FixpRejectCode code() const noexcept {
+        return static_cast<FixpRejectCode>(getU8(Offset::Code));
+    }
+
+    EstablishmentRejectCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    EstablishmentRejectCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    EstablishmentRejectCodec& code(FixpRejectCode v) noexcept {
+        return putU8(Offset::Code, static_cast<SbeUint8>(v));
+    }
+};
+
+// ============================================================================
+// Sequence (8-byte body), Terminate (16-byte body)
+// ============================================================================
+//
+//   Sequence:  Offset 0-7: nextSeqNo uint64
+//   Terminate: Offset 0-7: sessionId uint64, Offset 8: code uint8
+
+class SequenceCodec
+    : public detail::FixpCodecBase<SequenceCodec, MessageHeader::TemplateId::Sequence, 8> {
+public:
+    struct Offset {
+        static constexpr std::size_t NextSeqNo = 0;
+    };
+
+    [[nodiscard]] SbeUint64 nextSeqNo() const noexcept { return getU64(Offset::NextSeqNo); }
+    SequenceCodec& nextSeqNo(SbeUint64 v) noexcept { return putU64(Offset::NextSeqNo, v); }
+};
+
+class TerminateCodec
+    : public detail::FixpCodecBase<TerminateCodec, MessageHeader::TemplateId::Terminate, 16> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t Code = 8;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] FixpTerminationCode code() const noexcept {
+        return static_cast<FixpTerminationCode>(getU8(Offset::Code));
+    }
+
+    TerminateCodec& sessionId(SbeUint64 v) noexcept { return putU64(Offset::SessionId, v); }
+    TerminateCodec& code(FixpTerminationCode v) noexcept {
+        return putU8(Offset::Code, static_cast<SbeUint8>(v));
+    }
+};
+
+// ============================================================================
+// RetransmitRequest / Retransmission (32-byte body), RetransmitReject (24)
+// ============================================================================
+//
+//   Offset  0- 7: sessionId          uint64
+//   Offset  8-15: timestamp          int64   (request timestamp in replies)
+//   Offset 16-23: fromSeqNo/nextSeqNo uint64
+//   Offset 24-27: count              uint32
+//   Offset 28-31: padding
+
+class RetransmitRequestCodec
+    : public detail::FixpCodecBase<RetransmitRequestCodec,
+                                   MessageHeader::TemplateId::RetransmitRequest, 32> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t Timestamp = 8;
+        static constexpr std::size_t FromSeqNo = 16;
+        static constexpr std::size_t Count = 24;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp timestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::Timestamp);
+    }
+    [[nodiscard]] SbeUint64 fromSeqNo() const noexcept { return getU64(Offset::FromSeqNo); }
+    [[nodiscard]] SbeUint32 count() const noexcept { return getU32(Offset::Count); }
+
+    RetransmitRequestCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    RetransmitRequestCodec& timestamp(Timestamp v) noexcept {
+        return putU64(Offset::Timestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    RetransmitRequestCodec& fromSeqNo(SbeUint64 v) noexcept {
+        return putU64(Offset::FromSeqNo, v);
+    }
+    RetransmitRequestCodec& count(SbeUint32 v) noexcept { return putU32(Offset::Count, v); }
+};
+
+class RetransmissionCodec
+    : public detail::FixpCodecBase<RetransmissionCodec,
+                                   MessageHeader::TemplateId::Retransmission, 32> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t NextSeqNo = 16;
+        static constexpr std::size_t Count = 24;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] SbeUint64 nextSeqNo() const noexcept { return getU64(Offset::NextSeqNo); }
+    [[nodiscard]] SbeUint32 count() const noexcept { return getU32(Offset::Count); }
+
+    RetransmissionCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    RetransmissionCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    RetransmissionCodec& nextSeqNo(SbeUint64 v) noexcept {
+        return putU64(Offset::NextSeqNo, v);
+    }
+    RetransmissionCodec& count(SbeUint32 v) noexcept { return putU32(Offset::Count, v); }
+};
+
+class RetransmitRejectCodec
+    : public detail::FixpCodecBase<RetransmitRejectCodec,
+                                   MessageHeader::TemplateId::RetransmitReject, 24> {
+public:
+    struct Offset {
+        static constexpr std::size_t SessionId = 0;
+        static constexpr std::size_t RequestTimestamp = 8;
+        static constexpr std::size_t Code = 16;
+    };
+
+    [[nodiscard]] SbeUint64 sessionId() const noexcept { return getU64(Offset::SessionId); }
+    [[nodiscard]] Timestamp requestTimestamp() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::RequestTimestamp);
+    }
+    [[nodiscard]] FixpRetransmitRejectCode code() const noexcept {
+        return static_cast<FixpRetransmitRejectCode>(getU8(Offset::Code));
+    }
+
+    RetransmitRejectCodec& sessionId(SbeUint64 v) noexcept {
+        return putU64(Offset::SessionId, v);
+    }
+    RetransmitRejectCodec& requestTimestamp(Timestamp v) noexcept {
+        return putU64(Offset::RequestTimestamp, static_cast<SbeUint64>(v.nanos));
+    }
+    RetransmitRejectCodec& code(FixpRetransmitRejectCode v) noexcept {
+        return putU8(Offset::Code, static_cast<SbeUint8>(v));
+    }
+};
+
+// ============================================================================
+// Static Assertions: Verify Layout
+// ============================================================================
+
+static_assert(NegotiateCodec::TOTAL_SIZE == 32);
+static_assert(EstablishCodec::TOTAL_SIZE == 40);
+static_assert(SequenceCodec::TOTAL_SIZE == 16);
+static_assert(TerminateCodec::TOTAL_SIZE == 24);
+static_assert(RetransmitRequestCodec::TOTAL_SIZE == 40);
+static_assert(EstablishCodec::Offset::NextSeqNo % 8 == 0,
+              "NextSeqNo must be 8-byte aligned");
+static_assert(RetransmitRequestCodec::Offset::FromSeqNo % 8 == 0,
+              "FromSeqNo must be 8-byte aligned");
+
+/// True for template ids handled by the FIXP session layer
+[[nodiscard]] constexpr bool is_fixp_session_message(SbeUint16 template_id) noexcept {
+    return template_id >= MessageHeader::TemplateId::Negotiate &&
+           template_id <= MessageHeader::TemplateId::RetransmitReject;
+}
+
+}  // namespace nfx::sbe
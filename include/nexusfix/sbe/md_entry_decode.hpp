@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/types/group_types.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// SBE Market Data Entries -> MDEntryColumns
+// ============================================================================
+//
+// Batch decode of a binary NoMDEntries group into the same struct-of-arrays
+// layout the FIX text path fills (parser::decode_md_entries), so OrderBook,
+// TopOfBookStore and MarketDataRecovery consume either feed unchanged.
+//
+// The entry layout is a compile-time MDGroupLayout: each column is a fixed
+// offset inside the entry block, so the loop is straight loads and stores
+// with no per-field dispatch. Columns whose field lies beyond the sender's
+// blockLength (an older schema version) are filled as absent.
+//
+//   MDP3 MDIncrementalRefreshBook46 NoMDEntries (blockLength 32):
+//   | MDEntryPx 0 | MDEntrySize 8 | SecurityID 12 | RptSeq 16 |
+//   | NumberOfOrders 20 | MDPriceLevel 24 | MDUpdateAction 25 | MDEntryType 26 |
+//
+// Usage:
+//   MessageCursor cursor{packet, length};
+//   auto entries = cursor.group<GroupSize>();
+//   MDEntryColumns<> cols;
+//   std::array<int32_t, 256> security_ids;
+//   decode_md_group<MDP3_BOOK_ENTRY>(entries, cols, security_ids);
+
+/// Offsets of the market data columns inside one group entry
+struct MDGroupLayout {
+    static constexpr uint16_t ABSENT = 0xFFFF;
+
+    uint16_t price{ABSENT};             // int64 mantissa
+    int8_t price_exponent{-9};          // Price = mantissa * 10^price_exponent
+    uint16_t size{ABSENT};              // int32 quantity
+    uint16_t security_id{ABSENT};       // int32
+    uint16_t rpt_seq{ABSENT};           // uint32
+    uint16_t number_of_orders{ABSENT};  // int32
+    uint16_t price_level{ABSENT};       // uint8 (-> position_no)
+    uint16_t update_action{ABSENT};     // uint8, 0 = New, 1 = Change, ...
+    uint16_t entry_type{ABSENT};        // char, FIX MDEntryType
+};
+
+/// CME MDP3 MDIncrementalRefreshBook46 / SnapshotFullRefresh52 book entries
+inline constexpr MDGroupLayout MDP3_BOOK_ENTRY{
+    .price = 0, .price_exponent = -9, .size = 8, .security_id = 12,
+    .rpt_seq = 16, .number_of_orders = 20, .price_level = 24,
+    .update_action = 25, .entry_type = 26};
+
+namespace detail {
+
+[[nodiscard]] consteval int64_t md_pow10(int n) noexcept {
+    int64_t v = 1;
+    for (int i = 0; i < n; ++i) v *= 10;
+    return v;
+}
+
+/// Mantissa at 10^Exponent -> FixedPrice raw (10^-8)
+template <int Exponent>
+[[nodiscard]] NFX_FORCE_INLINE int64_t md_price_raw(int64_t mantissa) noexcept {
+    if (mantissa == null_value::INT64 || mantissa == INT64_MAX) [[unlikely]] return 0;
+    constexpr int shift = Exponent + 8;
+    if constexpr (shift >= 0) {
+        return mantissa * md_pow10(shift);
+    } else {
+        return mantissa / md_pow10(-shift);
+    }
+}
+
+/// int32 with either SBE null sentinel (INT32_MIN, or MDP3's INT32_MAX) -> 0
+[[nodiscard]] NFX_FORCE_INLINE int32_t md_int32(int32_t v) noexcept {
+    return (v == null_value::INT32 || v == INT32_MAX) ? 0 : v;
+}
+
+}  // namespace detail
+
+/// Decode a flat group of market data entries column-wise
+/// @tparam Layout Entry layout (offsets into the entry block)
+/// @param group Group wrapped at the entries' dimension header
+/// @param out Columns to fill (cleared first; truncated set past Capacity)
+/// @param security_ids Optional per-row SecurityID output (at least Capacity)
+/// @return Rows decoded
+template <MDGroupLayout Layout, typename Dimension, size_t Capacity>
+NFX_HOT size_t decode_md_group(
+    const GroupView<Dimension>& group,
+    MDEntryColumns<Capacity>& out,
+    std::span<int32_t> security_ids = {}) noexcept
+{
+    constexpr uint16_t ABSENT = MDGroupLayout::ABSENT;
+
+    out.clear();
+    size_t n = group.size();
+    if (n > Capacity) [[unlikely]] {
+        n = Capacity;
+        out.truncated = true;
+    }
+    out.truncated |= group.truncated();
+
+    // A field is decoded only if the sender's block (schema version) has it
+    const size_t bl = group.blockLength();
+    const bool has_price = Layout.price != ABSENT && Layout.price + 8u <= bl;
+    const bool has_size = Layout.size != ABSENT && Layout.size + 4u <= bl;
+    const bool has_secid = Layout.security_id != ABSENT && Layout.security_id + 4u <= bl &&
+                           security_ids.size() >= n;
+    const bool has_seq = Layout.rpt_seq != ABSENT && Layout.rpt_seq + 4u <= bl;
+    const bool has_orders = Layout.number_of_orders != ABSENT && Layout.number_of_orders + 4u <= bl;
+    const bool has_level = Layout.price_level != ABSENT && Layout.price_level + 1u <= bl;
+    const bool has_action = Layout.update_action != ABSENT && Layout.update_action + 1u <= bl;
+    const bool has_type = Layout.entry_type != ABSENT && Layout.entry_type + 1u <= bl;
+
+    const char* e = group.data();
+    for (size_t i = 0; i < n; ++i, e += bl) {
+        out.price[i] = FixedPrice{has_price
+            ? detail::md_price_raw<Layout.price_exponent>(read_le<SbeInt64>(e + Layout.price)) : 0};
+        out.size[i] = Qty{has_size
+            ? int64_t{detail::md_int32(read_le<SbeInt32>(e + Layout.size))} * Qty::SCALE : 0};
+        out.rpt_seq[i] = has_seq ? read_le<SbeUint32>(e + Layout.rpt_seq) : 0;
+        out.number_of_orders[i] = has_orders
+            ? static_cast<uint32_t>(detail::md_int32(read_le<SbeInt32>(e + Layout.number_of_orders))) : 0;
+        out.position_no[i] = has_level ? read_le<SbeUint8>(e + Layout.price_level) : 0;
+        out.update_action[i] = has_action
+            ? static_cast<MDUpdateAction>('0' + read_le<SbeUint8>(e + Layout.update_action))
+            : MDUpdateAction::New;
+        out.entry_type[i] = has_type ? static_cast<MDEntryType>(e[Layout.entry_type]) : MDEntryType::Bid;
+        out.symbol_id[i] = MDEntryColumns<Capacity>::NO_SYMBOL;
+        if (has_secid) {
+            security_ids[i] = read_le<SbeInt32>(e + Layout.security_id);
+        }
+    }
+    out.count = n;
+    return n;
+}
+
+}  // namespace nfx::sbe
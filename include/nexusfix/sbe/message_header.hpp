@@ -34,6 +34,19 @@ public:
     struct TemplateId {
         static constexpr SbeUint16 NewOrderSingle = 1;
         static constexpr SbeUint16 ExecutionReport = 8;
+
+        // FIXP session layer (see codecs/fixp_session.hpp); iLink 3 numbering
+        static constexpr SbeUint16 Negotiate = 500;
+        static constexpr SbeUint16 NegotiationResponse = 501;
+        static constexpr SbeUint16 NegotiationReject = 502;
+        static constexpr SbeUint16 Establish = 503;
+        static constexpr SbeUint16 EstablishmentAck = 504;
+        static constexpr SbeUint16 EstablishmentReject = 505;
+        static constexpr SbeUint16 Sequence = 506;
+        static constexpr SbeUint16 Terminate = 507;
+        static constexpr SbeUint16 RetransmitRequest = 508;
+        static constexpr SbeUint16 Retransmission = 509;
+        static constexpr SbeUint16 RetransmitReject = 510;
     };
 
     // Field offsets within the header
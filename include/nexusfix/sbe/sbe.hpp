@@ -13,6 +13,7 @@
 // Message Types:
 //   - NewOrderSingle (templateId=1, 64 bytes)
 //   - ExecutionReport (templateId=8, 144 bytes)
+//   - FIXP session messages (templateId=500-510, codecs/fixp_session.hpp)
 //
 // Usage (Decode):
 //   auto msg = sbe::ExecutionReportCodec::wrapForDecode(buffer, length);
@@ -30,16 +31,46 @@
 //       .side(Side::Buy)
 //       .price(FixedPrice::from_double(150.50));
 //
+// Usage (Groups / var-data, see types/group_types.hpp):
+//   MessageCursor cursor{buffer, length};
+//   auto entries = cursor.group<GroupSize>();   // Zero-copy, blockLength-stepped
+//   decode_md_group<MDP3_BOOK_ENTRY>(entries, columns);   // -> MDEntryColumns
+//   auto text = cursor.var_data<VarStringEncoding>();
+//
 // Usage (Dispatch):
 //   sbe::dispatch(buffer, length, [](auto& codec) {
 //       // codec is NewOrderSingleCodec or ExecutionReportCodec
 //   });
+//
+// Usage (SOFH-framed TCP stream, see sofh.hpp):
+//   SbeFrameWriter writer{transport.acquire_send_buffer()};
+//   writer.add<NewOrderSingleCodec>()->clOrdId("ORD1");   // x N messages
+//   transport.send(writer.frame());                       // one write_fixed
+//   deframer.feed(buf_id, data, on_message, release);     // partial-frame safe
+//
+// Usage (FIX gateway, include nexusfix/sbe/transcoder.hpp):
+//   auto encoded = sbe::transcode_to_sbe(indexed_parser, buffer);   // 35=D / 35=8
+//   sbe::transcode_to_fix(codec, fix_builder, ts_text);             // outbound
+//
+// Usage (FIXP binary order entry, include nexusfix/session/fixp_session.hpp):
+//   FixpSession<Handler> session{config};   // Negotiate/Establish/Sequence/Retransmit
+//   session.send<NewOrderSingleCodec>([](auto& nos) { nos.clOrdId("ORD1"); });
+//
+// Venue schemas (CME MDP3, iLink3, ...): codecs in this style, with repeating
+// groups, var-data and a jump-table dispatch, are generated from the SBE XML
+// at build time by tools/sbe_codegen.py:
+//   nfx_sbe_generate(mdp3_codecs SCHEMA templates_FixBinary.xml
+//                    NAMESPACE nfx::sbe::mdp3)   // cmake/NfxSbeCodegen.cmake
 
 #include "nexusfix/sbe/message_header.hpp"
 #include "nexusfix/sbe/types/sbe_types.hpp"
 #include "nexusfix/sbe/types/composite_types.hpp"
+#include "nexusfix/sbe/types/group_types.hpp"
+#include "nexusfix/sbe/md_entry_decode.hpp"
+#include "nexusfix/sbe/sofh.hpp"
 #include "nexusfix/sbe/codecs/new_order_single.hpp"
 #include "nexusfix/sbe/codecs/execution_report.hpp"
+#include "nexusfix/sbe/codecs/fixp_session.hpp"
 
 namespace nfx::sbe {
 
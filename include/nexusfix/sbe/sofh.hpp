@@ -0,0 +1,420 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// Simple Open Framing Header (SOFH)
+// ============================================================================
+//
+// SBE over a byte stream (FIXP / iLink 3 style) prefixes every message with
+// a framing header carrying the frame length (header included) and the
+// encoding of the payload:
+//
+//   FIX SOFH 1.0 (6 bytes, big-endian):
+//   | Message_Length uint32 | Encoding_Type uint16 | SBE message ... |
+//
+//   Compact variant (4 bytes, little-endian, CME iLink 3):
+//   | Message_Length uint16 | Encoding_Type uint16 | SBE message ... |
+//
+// SbeFrameWriter packs many framed messages back to back into one send
+// buffer, typically a registered buffer, so a batch goes out as a single
+// write_fixed. SofhDeframer splits the receive stream back into messages
+// and carries partial frames across recv completions.
+//
+// Usage (send):
+//   SbeFrameWriter writer{transport.acquire_send_buffer()};
+//   if (auto nos = writer.add<NewOrderSingleCodec>()) {
+//       nos->clOrdId("ORD1").symbol("ESZ5").side(Side::Buy);
+//   }
+//   ...
+//   transport.send(writer.frame());   // registered buffer -> write_fixed
+//
+// Usage (receive):
+//   SofhDeframer<> deframer;
+//   deframer.feed(buf_id, data, [](std::span<const char> msg) {
+//       dispatch(msg.data(), msg.size(), handler);
+//   }, [&](uint16_t id) { buffers.replenish(id); });
+
+/// Encoding_Type values
+struct SofhEncoding {
+    static constexpr SbeUint16 SbeBigEndian = 0x5BE0;     // SBE 1.0 big-endian
+    static constexpr SbeUint16 SbeLittleEndian = 0xEB50;  // SBE 1.0 little-endian
+    static constexpr SbeUint16 CmeSbe = 0xCAFE;           // CME iLink 3 / MDP 3
+};
+
+/// Framing header layout
+/// @tparam LengthT Message_Length field type (uint32 or uint16)
+/// @tparam ByteOrder Byte order of both header fields
+/// @tparam DefaultEncoding Encoding_Type written when none is given
+template <typename LengthT, std::endian ByteOrder, SbeUint16 DefaultEncoding>
+class BasicSofh {
+public:
+    static constexpr std::size_t SIZE = sizeof(LengthT) + sizeof(SbeUint16);
+    static constexpr std::size_t MAX_FRAME_LENGTH = static_cast<LengthT>(-1);
+    static constexpr SbeUint16 DEFAULT_ENCODING = DefaultEncoding;
+
+    /// Write a header for a frame of frame_length bytes (header included)
+    NFX_FORCE_INLINE static void encode(
+        char* buffer, std::size_t frame_length,
+        SbeUint16 encoding = DefaultEncoding) noexcept {
+        write_le(buffer, to_wire(static_cast<LengthT>(frame_length)));
+        write_le(buffer + sizeof(LengthT), to_wire(encoding));
+    }
+
+    /// Frame length including the header
+    [[nodiscard]] NFX_FORCE_INLINE static std::size_t frameLength(
+        const char* buffer) noexcept {
+        return to_wire(read_le<LengthT>(buffer));
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static SbeUint16 encodingType(
+        const char* buffer) noexcept {
+        return to_wire(read_le<SbeUint16>(buffer + sizeof(LengthT)));
+    }
+
+private:
+    /// Host <-> wire (an involution: the same swap both ways)
+    template <typename T>
+    [[nodiscard]] NFX_FORCE_INLINE static constexpr T to_wire(T v) noexcept {
+        if constexpr (ByteOrder == std::endian::little) {
+            return v;
+        } else {
+            return std::byteswap(v);
+        }
+    }
+};
+
+/// FIX Simple Open Framing Header 1.0, SBE little-endian payload
+using Sofh = BasicSofh<SbeUint32, std::endian::big, SofhEncoding::SbeLittleEndian>;
+
+/// 4-byte header used by CME iLink 3
+using CompactSofh = BasicSofh<SbeUint16, std::endian::little, SofhEncoding::CmeSbe>;
+
+static_assert(Sofh::SIZE == 6);
+static_assert(CompactSofh::SIZE == 4);
+
+// ============================================================================
+// Batched Frame Writer
+// ============================================================================
+
+/// Packs SOFH-framed SBE messages back to back into one caller buffer
+/// @tparam SofhT Framing header layout
+template <typename SofhT = Sofh>
+class SbeFrameWriter {
+public:
+    explicit SbeFrameWriter(
+        std::span<char> buffer,
+        SbeUint16 encoding = SofhT::DEFAULT_ENCODING) noexcept
+        : buffer_{buffer}, encoding_{encoding} {}
+
+    /// Reserve a frame for a fixed-size codec and wrap it for encoding
+    /// (header already encoded)
+    /// @return Codec over the frame payload, or nullopt if the buffer is full
+    template <typename Codec>
+    [[nodiscard]] NFX_HOT std::optional<Codec> add() noexcept {
+        std::span<char> payload = reserve(Codec::TOTAL_SIZE);
+        if (payload.empty()) [[unlikely]] return std::nullopt;
+        commit(Codec::TOTAL_SIZE);
+        auto codec = Codec::wrapForEncode(payload.data(), payload.size());
+        codec.encodeHeader();
+        return codec;
+    }
+
+    /// Copy an already encoded message in as the next frame
+    /// @return false if it does not fit
+    [[nodiscard]] bool append(std::span<const char> message) noexcept {
+        std::span<char> payload = reserve(message.size());
+        if (payload.empty()) [[unlikely]] return false;
+        std::memcpy(payload.data(), message.data(), message.size());
+        commit(message.size());
+        return true;
+    }
+
+    /// Reserve up to max_length payload bytes for a variable-length message;
+    /// finish with commit(actual_length). A later reserve() abandons it.
+    /// @return Payload area (after the header), empty if it does not fit
+    [[nodiscard]] std::span<char> reserve(std::size_t max_length) noexcept {
+        const std::size_t frame = SofhT::SIZE + max_length;
+        if (max_length == 0 || frame > SofhT::MAX_FRAME_LENGTH ||
+            frame > buffer_.size() - size_) [[unlikely]] {
+            reserved_ = 0;
+            return {};
+        }
+        reserved_ = max_length;
+        return buffer_.subspan(size_ + SofhT::SIZE, max_length);
+    }
+
+    /// Close the reserved frame at length payload bytes (<= reserved)
+    void commit(std::size_t length) noexcept {
+        if (length == 0 || length > reserved_) [[unlikely]] return;
+        const std::size_t frame = SofhT::SIZE + length;
+        SofhT::encode(buffer_.data() + size_, frame, encoding_);
+        size_ += frame;
+        reserved_ = 0;
+        ++count_;
+    }
+
+    /// All committed frames, ready for one send
+    [[nodiscard]] std::span<const char> frame() const noexcept {
+        return {buffer_.data(), size_};
+    }
+
+    /// Start a new batch in the same buffer
+    void reset() noexcept {
+        size_ = 0;
+        reserved_ = 0;
+        count_ = 0;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] std::size_t message_count() const noexcept { return count_; }
+    [[nodiscard]] std::size_t remaining() const noexcept { return buffer_.size() - size_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+private:
+    std::span<char> buffer_;
+    std::size_t size_{0};
+    std::size_t reserved_{0};
+    std::size_t count_{0};
+    SbeUint16 encoding_;
+};
+
+// ============================================================================
+// Stream Deframer
+// ============================================================================
+
+struct DeframeStats {
+    std::uint64_t zero_copy_messages{0};  // Delivered in place
+    std::uint64_t copied_messages{0};     // Straddled recv buffers
+    std::uint64_t copied_bytes{0};        // Bytes written to the stash
+};
+
+/// Splits a SOFH-framed byte stream into SBE messages
+///
+/// Same buffer discipline as MessageReassembler: frames wholly inside a
+/// receive buffer are delivered in place; a trailing partial frame pins its
+/// buffer until the next completion, then is assembled with one bounded
+/// copy. Binary framing cannot resynchronise, so a bad header (wrong
+/// encoding, length out of range) stops the deframer until reset().
+/// @tparam SofhT Framing header layout
+/// @tparam MaxFrameSize Largest accepted frame, header included
+template <typename SofhT = Sofh, std::size_t MaxFrameSize = 4096>
+class SofhDeframer {
+public:
+    static constexpr std::size_t MAX_FRAME_SIZE = MaxFrameSize;
+    static constexpr std::uint32_t NO_BUFFER = UINT32_MAX;
+
+    explicit SofhDeframer(SbeUint16 encoding = SofhT::DEFAULT_ENCODING) noexcept
+        : encoding_{encoding} {}
+
+    // Non-copyable: holds a pinned buffer reference
+    SofhDeframer(const SofhDeframer&) = delete;
+    SofhDeframer& operator=(const SofhDeframer&) = delete;
+
+    /// Process one receive completion
+    /// @param buf_id Buffer id owning data (passed back to release)
+    /// @param data Received bytes
+    /// @param on_message Called with each SBE message (SOFH stripped); the
+    ///        span is only valid for the duration of the call
+    /// @param release Called with a buffer id once no frame references it
+    /// @return Number of messages delivered
+    template <typename OnMessage, typename OnRelease>
+    std::size_t feed(
+        std::uint16_t buf_id,
+        std::span<const char> data,
+        OnMessage&& on_message,
+        OnRelease&& release) noexcept
+    {
+        std::size_t delivered = 0;
+        const std::size_t cursor = process(data, on_message, release, delivered);
+
+        if (cursor < data.size() && !failed_) {
+            // Partial tail: keep the buffer, copy nothing yet
+            pinned_id_ = buf_id;
+            pinned_tail_ = data.subspan(cursor);
+        } else {
+            release(buf_id);
+        }
+        return delivered;
+    }
+
+    /// Process bytes that are only valid for this call (e.g. a copy-based
+    /// recv); a partial tail is copied into the stash
+    template <typename OnMessage>
+    std::size_t feed(std::span<const char> data, OnMessage&& on_message) noexcept {
+        std::size_t delivered = 0;
+        auto no_release = [](std::uint16_t) noexcept {};
+        const std::size_t cursor = process(data, on_message, no_release, delivered);
+
+        if (cursor < data.size() && !failed_) {
+            stats_.copied_bytes += stash_.append(data.subspan(cursor));
+        }
+        return delivered;
+    }
+
+    /// Drop any partial frame, release the pinned buffer and clear a failure
+    template <typename OnRelease>
+    void reset(OnRelease&& release) noexcept {
+        if (pinned_id_ != NO_BUFFER) {
+            release(static_cast<std::uint16_t>(pinned_id_));
+            pinned_id_ = NO_BUFFER;
+            pinned_tail_ = {};
+        }
+        stash_.clear();
+        failed_ = false;
+    }
+
+    void reset() noexcept {
+        reset([](std::uint16_t) noexcept {});
+    }
+
+    /// True after a bad frame header; the stream must be reset (reconnect)
+    [[nodiscard]] bool failed() const noexcept { return failed_; }
+
+    /// True while a partial frame is held (pinned or copied)
+    [[nodiscard]] bool has_partial() const noexcept {
+        return pinned_id_ != NO_BUFFER || !stash_.empty();
+    }
+
+    /// Buffer currently pinned by a partial frame, or NO_BUFFER
+    [[nodiscard]] std::uint32_t pinned_buffer() const noexcept {
+        return pinned_id_;
+    }
+
+    [[nodiscard]] const DeframeStats& stats() const noexcept {
+        return stats_;
+    }
+
+private:
+    [[nodiscard]] NFX_FORCE_INLINE bool valid_header(const char* header) noexcept {
+        const std::size_t frame = SofhT::frameLength(header);
+        if (frame <= SofhT::SIZE || frame > MaxFrameSize ||
+            SofhT::encodingType(header) != encoding_) [[unlikely]] {
+            failed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    /// Deliver every complete frame; returns the offset of the first
+    /// unconsumed byte in data
+    template <typename OnMessage, typename OnRelease>
+    std::size_t process(
+        std::span<const char> data,
+        OnMessage& on_message,
+        OnRelease& release,
+        std::size_t& delivered) noexcept
+    {
+        if (failed_) [[unlikely]] return data.size();
+
+        std::size_t cursor = 0;
+
+        // Finish the frame carried over from previous completions
+        if (has_partial()) [[unlikely]] {
+            cursor = complete_partial(data, on_message, release, delivered);
+            if (failed_ || has_partial()) return data.size();
+        }
+
+        // Common case: frame in place
+        while (data.size() - cursor >= SofhT::SIZE) [[likely]] {
+            const char* header = data.data() + cursor;
+            if (!valid_header(header)) [[unlikely]] return data.size();
+            const std::size_t frame = SofhT::frameLength(header);
+            if (frame > data.size() - cursor) break;
+
+            on_message(data.subspan(cursor + SofhT::SIZE, frame - SofhT::SIZE));
+            ++stats_.zero_copy_messages;
+            ++delivered;
+            cursor += frame;
+        }
+        return cursor;
+    }
+
+    /// Assemble the carried-over frame from pinned tail / stash + data head
+    template <typename OnMessage, typename OnRelease>
+    std::size_t complete_partial(
+        std::span<const char> data,
+        OnMessage& on_message,
+        OnRelease& release,
+        std::size_t& delivered) noexcept
+    {
+        // Single copy of the pinned tail; its buffer goes back right away
+        if (pinned_id_ != NO_BUFFER) {
+            stats_.copied_bytes += stash_.append(pinned_tail_);
+            release(static_cast<std::uint16_t>(pinned_id_));
+            pinned_id_ = NO_BUFFER;
+            pinned_tail_ = {};
+        }
+
+        std::size_t cursor = 0;
+        auto take = [&](std::size_t want) noexcept {
+            const std::size_t n = std::min(want, data.size() - cursor);
+            const std::size_t copied = stash_.append(data.subspan(cursor, n));
+            stats_.copied_bytes += copied;
+            cursor += copied;
+        };
+
+        // Header itself straddled
+        if (stash_.size < SofhT::SIZE) {
+            take(SofhT::SIZE - stash_.size);
+            if (stash_.size < SofhT::SIZE) return cursor;
+        }
+        if (!valid_header(stash_.data().data())) [[unlikely]] {
+            stash_.clear();
+            return data.size();
+        }
+
+        // Copy exactly the rest of the frame
+        const std::size_t frame = SofhT::frameLength(stash_.data().data());
+        take(frame - stash_.size);
+        if (stash_.size < frame) {
+            return cursor;  // Spans a further completion
+        }
+
+        on_message(stash_.data().subspan(SofhT::SIZE));
+        ++stats_.copied_messages;
+        ++delivered;
+        stash_.clear();
+        return cursor;
+    }
+
+    /// Bytes of the frame being assembled across completions
+    struct Stash {
+        std::array<char, MaxFrameSize> bytes;
+        std::size_t size{0};
+
+        std::size_t append(std::span<const char> data) noexcept {
+            const std::size_t n = std::min(data.size(), MaxFrameSize - size);
+            std::memcpy(bytes.data() + size, data.data(), n);
+            size += n;
+            return n;
+        }
+        [[nodiscard]] std::span<const char> data() const noexcept { return {bytes.data(), size}; }
+        [[nodiscard]] bool empty() const noexcept { return size == 0; }
+        void clear() noexcept { size = 0; }
+    };
+
+    alignas(8) Stash stash_;
+    std::span<const char> pinned_tail_{};
+    std::uint32_t pinned_id_{NO_BUFFER};
+    SbeUint16 encoding_;
+    bool failed_{false};
+    DeframeStats stats_{};
+};
+
+}  // namespace nfx::sbe
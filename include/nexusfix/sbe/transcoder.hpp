@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/codecs/execution_report.hpp"
+#include "nexusfix/sbe/codecs/new_order_single.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/utc_timestamp.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// FIX Tag-Value <-> SBE Transcoder (gateway path)
+// ============================================================================
+//
+// Inbound: reads fields straight out of a parsed FIX message and writes them
+// into the SBE flyweight in one pass. Prices and quantities go from the
+// field bytes to DecimalPrice / DecimalQty via FixedPrice / Qty, TransactTime
+// from UTCTimestamp text to SbeTimestamp. No domain object, no allocation.
+//
+// Any parse result with msg_type() and get_field(int) works (IndexedParser,
+// ParsedMessage, LazyParsedMessage), as does SchemaMessage<Schema> from
+// parse_as<Schema>(); tags missing from its schema read as absent at
+// compile time.
+//
+// Outbound: fills the fix44 Builder from a decoded codec. String fields are
+// views into the SBE buffer; the TransactTime text goes into caller storage,
+// so both must outlive build().
+//
+// Usage:
+//   IndexedParser parser;
+//   parser.parse(fix_bytes);
+//   alignas(8) char sbe[ExecutionReportCodec::TOTAL_SIZE];
+//   auto encoded = transcode_to_sbe(parser, sbe);
+//
+//   fix44::ExecutionReport::Builder builder;
+//   UtcTimestampText ts;
+//   transcode_to_fix(ExecutionReportCodec::wrapForDecode(sbe, sizeof(sbe)), builder, ts);
+//   builder.sender_comp_id("GW").target_comp_id("CLIENT").msg_seq_num(seq)...;
+
+/// Parsed FIX message readable by the transcoder
+template <typename Msg>
+concept FixFieldSource = requires(const Msg& msg) {
+    { msg.msg_type() } -> std::convertible_to<char>;
+} && (requires { typename Msg::schema_type; } ||
+      requires(const Msg& msg, int tag) { { msg.get_field(tag) } -> std::same_as<FieldView>; });
+
+namespace detail {
+
+/// Field lookup for either source kind (invalid FieldView if absent)
+template <int Tag, FixFieldSource Msg>
+[[nodiscard]] NFX_FORCE_INLINE FieldView fix_field(const Msg& msg) noexcept {
+    if constexpr (requires { typename Msg::schema_type; }) {
+        if constexpr (Msg::schema_type::template has_tag<Tag>()) {
+            return msg.template get<Tag>();
+        } else {
+            return FieldView{};
+        }
+    } else {
+        return msg.get_field(Tag);
+    }
+}
+
+/// Required, non-empty field; sets err to MissingRequiredField otherwise
+template <int Tag, FixFieldSource Msg>
+[[nodiscard]] NFX_FORCE_INLINE FieldView required_field(
+    const Msg& msg, ParseError& err) noexcept {
+    FieldView f = fix_field<Tag>(msg);
+    if (f.value.empty() && err.code == ParseErrorCode::None) [[unlikely]] {
+        err = ParseError{ParseErrorCode::MissingRequiredField, Tag};
+    }
+    return f;
+}
+
+/// Fixed-width string that must fit the SBE field without truncation
+template <typename FixedStr>
+NFX_FORCE_INLINE void encode_id(
+    char* dst, const FieldView& f, int tag, ParseError& err) noexcept {
+    if (f.value.size() > FixedStr::SIZE && err.code == ParseErrorCode::None) [[unlikely]] {
+        err = ParseError{ParseErrorCode::InvalidFieldFormat, tag};
+    }
+    FixedStr::encode(dst, f.as_string());
+}
+
+/// Optional TransactTime; absent encodes as 0, malformed is an error
+NFX_FORCE_INLINE void encode_transact_time(
+    char* dst, const FieldView& f, ParseError& err) noexcept {
+    Timestamp ts{0};
+    if (!f.value.empty() && !parse_utc_timestamp(f.as_string(), ts) &&
+        err.code == ParseErrorCode::None) [[unlikely]] {
+        err = ParseError{ParseErrorCode::InvalidFieldFormat, tag::TransactTime::value};
+    }
+    SbeTimestamp::encode(dst, ts);
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Inbound: FIX -> SBE
+// ============================================================================
+
+/// Transcode a NewOrderSingle (35=D) into a NewOrderSingleCodec
+/// @param msg Parsed FIX message
+/// @param out Destination (at least NewOrderSingleCodec::TOTAL_SIZE bytes)
+/// @return Encoded bytes, or the first missing / malformed field
+template <FixFieldSource Msg>
+[[nodiscard]] NFX_HOT ParseResult<std::span<const char>> transcode_new_order_single(
+    const Msg& msg, std::span<char> out) noexcept
+{
+    using Codec = NewOrderSingleCodec;
+    if (out.size() < Codec::TOTAL_SIZE) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+    }
+    if (msg.msg_type() != 'D') [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value}};
+    }
+
+    auto codec = Codec::wrapForEncode(out.data(), out.size());
+    codec.encodeHeader();
+    char* body = codec.mutableBody();
+    ParseError err;
+
+    detail::encode_id<FixedString20>(body + Codec::Offset::ClOrdId,
+        detail::required_field<tag::ClOrdID::value>(msg, err), tag::ClOrdID::value, err);
+    detail::encode_id<FixedString8>(body + Codec::Offset::Symbol,
+        detail::required_field<tag::Symbol::value>(msg, err), tag::Symbol::value, err);
+    body[Codec::Offset::Side] = detail::required_field<tag::Side::value>(msg, err).as_char();
+    body[Codec::Offset::OrdType] = detail::required_field<tag::OrdType::value>(msg, err).as_char();
+    DecimalQty::encode(body + Codec::Offset::OrderQty,
+        detail::required_field<tag::OrderQty::value>(msg, err).as_qty());
+    DecimalPrice::encode(body + Codec::Offset::Price,
+        detail::fix_field<tag::Price::value>(msg).as_price());
+    detail::encode_transact_time(body + Codec::Offset::TransactTime,
+        detail::fix_field<tag::TransactTime::value>(msg), err);
+
+    if (err.code != ParseErrorCode::None) [[unlikely]] {
+        return std::unexpected{err};
+    }
+    return codec.encoded();
+}
+
+/// Transcode an ExecutionReport (35=8) into an ExecutionReportCodec
+/// @param msg Parsed FIX message
+/// @param out Destination (at least ExecutionReportCodec::TOTAL_SIZE bytes)
+/// @return Encoded bytes, or the first missing / malformed field
+template <FixFieldSource Msg>
+[[nodiscard]] NFX_HOT ParseResult<std::span<const char>> transcode_execution_report(
+    const Msg& msg, std::span<char> out) noexcept
+{
+    using Codec = ExecutionReportCodec;
+    if (out.size() < Codec::TOTAL_SIZE) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+    }
+    if (msg.msg_type() != '8') [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value}};
+    }
+
+    auto codec = Codec::wrapForEncode(out.data(), out.size());
+    codec.encodeHeader();
+    char* body = codec.mutableBody();
+    ParseError err;
+
+    detail::encode_id<FixedString20>(body + Codec::Offset::OrderId,
+        detail::required_field<tag::OrderID::value>(msg, err), tag::OrderID::value, err);
+    detail::encode_id<FixedString20>(body + Codec::Offset::ExecId,
+        detail::required_field<tag::ExecID::value>(msg, err), tag::ExecID::value, err);
+    detail::encode_id<FixedString20>(body + Codec::Offset::ClOrdId,
+        detail::fix_field<tag::ClOrdID::value>(msg), tag::ClOrdID::value, err);
+    detail::encode_id<FixedString8>(body + Codec::Offset::Symbol,
+        detail::required_field<tag::Symbol::value>(msg, err), tag::Symbol::value, err);
+    body[Codec::Offset::Side] = detail::required_field<tag::Side::value>(msg, err).as_char();
+    body[Codec::Offset::ExecType] = detail::required_field<tag::ExecType::value>(msg, err).as_char();
+    body[Codec::Offset::OrdStatus] = detail::required_field<tag::OrdStatus::value>(msg, err).as_char();
+    DecimalPrice::encode(body + Codec::Offset::Price,
+        detail::fix_field<tag::Price::value>(msg).as_price());
+    DecimalQty::encode(body + Codec::Offset::OrderQty,
+        detail::fix_field<tag::OrderQty::value>(msg).as_qty());
+    DecimalPrice::encode(body + Codec::Offset::LastPx,
+        detail::fix_field<tag::LastPx::value>(msg).as_price());
+    DecimalQty::encode(body + Codec::Offset::LastQty,
+        detail::fix_field<tag::LastQty::value>(msg).as_qty());
+    DecimalQty::encode(body + Codec::Offset::LeavesQty,
+        detail::required_field<tag::LeavesQty::value>(msg, err).as_qty());
+    DecimalQty::encode(body + Codec::Offset::CumQty,
+        detail::required_field<tag::CumQty::value>(msg, err).as_qty());
+    DecimalPrice::encode(body + Codec::Offset::AvgPx,
+        detail::required_field<tag::AvgPx::value>(msg, err).as_price());
+    detail::encode_transact_time(body + Codec::Offset::TransactTime,
+        detail::fix_field<tag::TransactTime::value>(msg), err);
+
+    if (err.code != ParseErrorCode::None) [[unlikely]] {
+        return std::unexpected{err};
+    }
+    return codec.encoded();
+}
+
+/// Transcode by MsgType: 35=D -> NewOrderSingleCodec, 35=8 -> ExecutionReportCodec
+/// @return Encoded bytes, InvalidMsgType for any other MsgType
+template <FixFieldSource Msg>
+[[nodiscard]] NFX_HOT ParseResult<std::span<const char>> transcode_to_sbe(
+    const Msg& msg, std::span<char> out) noexcept
+{
+    switch (msg.msg_type()) {
+        case 'D': return transcode_new_order_single(msg, out);
+        case '8': return transcode_execution_report(msg, out);
+        default:
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value}};
+    }
+}
+
+// ============================================================================
+// Outbound: SBE -> FIX
+// ============================================================================
+
+/// Fill a NewOrderSingle builder from a decoded codec (session header fields
+/// are left to the caller)
+/// @param ts_text Storage for the TransactTime text (must outlive build())
+/// @return false if the codec does not wrap a valid NewOrderSingle
+[[nodiscard]] inline bool transcode_to_fix(
+    const NewOrderSingleCodec& codec,
+    fix44::NewOrderSingle::Builder& builder,
+    UtcTimestampText& ts_text) noexcept
+{
+    if (!codec.isValid()) [[unlikely]] return false;
+
+    builder.cl_ord_id(codec.clOrdId())
+        .symbol(codec.symbol())
+        .side(codec.side())
+        .ord_type(codec.ordType())
+        .order_qty(codec.orderQty())
+        .price(codec.price());
+    if (const Timestamp ts = codec.transactTime(); ts.nanos != 0) {
+        builder.transact_time(format_utc_timestamp(ts, ts_text));
+    }
+    return true;
+}
+
+/// Fill an ExecutionReport builder from a decoded codec (session header
+/// fields are left to the caller)
+/// @param ts_text Storage for the TransactTime text (must outlive build())
+/// @return false if the codec does not wrap a valid ExecutionReport
+[[nodiscard]] inline bool transcode_to_fix(
+    const ExecutionReportCodec& codec,
+    fix44::ExecutionReport::Builder& builder,
+    UtcTimestampText& ts_text) noexcept
+{
+    if (!codec.isValid()) [[unlikely]] return false;
+
+    builder.order_id(codec.orderId())
+        .exec_id(codec.execId())
+        .cl_ord_id(codec.clOrdId())
+        .symbol(codec.symbol())
+        .side(codec.side())
+        .exec_type(codec.execType())
+        .ord_status(codec.ordStatus())
+        .price(codec.price())
+        .order_qty(codec.orderQty())
+        .last_px(codec.lastPx())
+        .last_qty(codec.lastQty())
+        .leaves_qty(codec.leavesQty())
+        .cum_qty(codec.cumQty())
+        .avg_px(codec.avgPx());
+    if (const Timestamp ts = codec.transactTime(); ts.nanos != 0) {
+        builder.transact_time(format_utc_timestamp(ts, ts_text));
+    }
+    return true;
+}
+
+}  // namespace nfx::sbe
@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/message_header.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// Repeating Groups and Variable-Length Data
+// ============================================================================
+//
+// After the root block a message carries its groups, then its var-data, in
+// schema order. Nothing there sits at a fixed offset:
+//
+//   | header | root block (header.blockLength) | dim | entry | entry | len | bytes |
+//                                              `- group ----------'   `- var-data'
+//
+// Entries are stepped by the blockLength in the group's dimension header,
+// not by the size this build was compiled against, and the root block is
+// skipped by the header's blockLength. A newer sender that appended fields
+// (higher schema version) therefore still decodes; an older sender's short
+// block is detected per field with GroupEntry::has().
+//
+// Usage (flat groups):
+//   MessageCursor cursor{buffer, length};
+//   for (GroupEntry e : cursor.group<GroupSize>()) {
+//       auto px = e.read<SbeInt64>(0);
+//   }
+//   std::string_view text = cursor.var_data<VarStringEncoding>();
+//
+// Usage (entries with nested groups or var-data):
+//   auto outer = cursor.begin_group<GroupSizeEncoding>();
+//   while (outer.has_next()) {
+//       GroupEntry e = outer.next();                 // Cursor moves past block
+//       for (GroupEntry leg : cursor.group<GroupSizeEncoding>()) { ... }
+//   }
+
+// ============================================================================
+// GroupDimension: Group Header (blockLength + numInGroup)
+// ============================================================================
+
+/// Dimension composite layout of a repeating group
+/// @tparam BlockLengthT Encoded type of blockLength (offset 0)
+/// @tparam NumInGroupT Encoded type of numInGroup
+/// @tparam NumInGroupOffset Offset of numInGroup
+/// @tparam Size Encoded size of the composite (including padding)
+template <typename BlockLengthT, typename NumInGroupT,
+          std::size_t NumInGroupOffset, std::size_t Size>
+struct GroupDimension {
+    static constexpr std::size_t SIZE = Size;
+
+    struct Offset {
+        static constexpr std::size_t BlockLength = 0;
+        static constexpr std::size_t NumInGroup = NumInGroupOffset;
+    };
+
+    static_assert(NumInGroupOffset >= sizeof(BlockLengthT));
+    static_assert(NumInGroupOffset + sizeof(NumInGroupT) <= Size);
+
+    [[nodiscard]] NFX_FORCE_INLINE static std::size_t blockLength(
+        const char* buffer) noexcept {
+        return read_le<BlockLengthT>(buffer + Offset::BlockLength);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static std::size_t numInGroup(
+        const char* buffer) noexcept {
+        return read_le<NumInGroupT>(buffer + Offset::NumInGroup);
+    }
+
+    NFX_FORCE_INLINE static void encode(
+        char* buffer, std::size_t block_length, std::size_t count) noexcept {
+        std::memset(buffer, 0, SIZE);
+        write_le(buffer + Offset::BlockLength, static_cast<BlockLengthT>(block_length));
+        write_le(buffer + Offset::NumInGroup, static_cast<NumInGroupT>(count));
+    }
+};
+
+// SBE standard groupSizeEncoding (iLink3, FIX SBE reference schemas)
+using GroupSizeEncoding = GroupDimension<SbeUint16, SbeUint16, 2, 4>;
+
+// CME MDP3 groupSize / groupSize8Byte
+using GroupSize = GroupDimension<SbeUint16, SbeUint8, 2, 3>;
+using GroupSize8Byte = GroupDimension<SbeUint16, SbeUint8, 7, 8>;
+
+// ============================================================================
+// VarDataEncoding: Length-Prefixed Bytes
+// ============================================================================
+
+/// Var-data composite: length prefix followed by the bytes
+/// @tparam LengthT Encoded type of the length prefix
+template <typename LengthT>
+struct VarDataEncoding {
+    static constexpr std::size_t SIZE = sizeof(LengthT);
+
+    /// Decode from at most available bytes
+    /// @return Bytes consumed (0 if truncated, out left empty)
+    [[nodiscard]] NFX_FORCE_INLINE static std::size_t decode(
+        const char* buffer, std::size_t available, std::string_view& out) noexcept {
+        if (available < SIZE) [[unlikely]] return 0;
+        const std::size_t n = read_le<LengthT>(buffer);
+        if (available - SIZE < n) [[unlikely]] return 0;
+        out = std::string_view{buffer + SIZE, n};
+        return SIZE + n;
+    }
+
+    /// Encode value (truncated to the largest LengthT)
+    /// @return Bytes written
+    NFX_FORCE_INLINE static std::size_t encode(
+        char* buffer, std::string_view value) noexcept {
+        constexpr std::size_t max = static_cast<LengthT>(~LengthT{0});
+        const std::size_t n = value.size() < max ? value.size() : max;
+        write_le(buffer, static_cast<LengthT>(n));
+        std::memcpy(buffer + SIZE, value.data(), n);
+        return SIZE + n;
+    }
+};
+
+using VarStringEncoding = VarDataEncoding<SbeUint16>;   // varStringEncoding / varDataEncoding
+using VarData8Encoding = VarDataEncoding<SbeUint8>;
+using VarData32Encoding = VarDataEncoding<SbeUint32>;
+
+// ============================================================================
+// GroupEntry: One Block of a Repeating Group
+// ============================================================================
+
+/// Zero-copy view of one group entry, sized by the sender's blockLength
+class GroupEntry {
+public:
+    constexpr GroupEntry() noexcept = default;
+    constexpr GroupEntry(const char* data, std::size_t block_length) noexcept
+        : data_{data}, block_length_{block_length} {}
+
+    /// Field at offset (no block-length check)
+    template <typename T>
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE T read(std::size_t offset) const noexcept {
+        return read_le<T>(data_ + offset);
+    }
+
+    /// Field at offset, or null_value if the sender's block is too short
+    /// (field added in a schema version newer than the sender's)
+    template <typename T>
+    [[nodiscard]] NFX_FORCE_INLINE T get(std::size_t offset, T null_value) const noexcept {
+        return has(offset, sizeof(T)) ? read<T>(offset) : null_value;
+    }
+
+    /// Field [offset, offset + size) is inside the sender's block
+    [[nodiscard]] NFX_FORCE_INLINE constexpr bool has(
+        std::size_t offset, std::size_t size) const noexcept {
+        return offset + size <= block_length_;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE constexpr const char* data() const noexcept { return data_; }
+    [[nodiscard]] NFX_FORCE_INLINE constexpr std::size_t blockLength() const noexcept {
+        return block_length_;
+    }
+
+private:
+    const char* data_{nullptr};
+    std::size_t block_length_{0};
+};
+
+// ============================================================================
+// GroupView: Flat Repeating Group (random access, range-for)
+// ============================================================================
+
+/// Group whose entries are fixed blocks (no nested groups or var-data)
+/// @tparam Dimension GroupDimension of the group
+template <typename Dimension>
+class GroupView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = GroupEntry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = GroupEntry;
+
+        constexpr iterator() noexcept = default;
+        constexpr iterator(const char* p, std::size_t step) noexcept : p_{p}, step_{step} {}
+
+        [[nodiscard]] constexpr GroupEntry operator*() const noexcept { return {p_, step_}; }
+        constexpr iterator& operator++() noexcept { p_ += step_; return *this; }
+        constexpr iterator operator++(int) noexcept { auto t = *this; p_ += step_; return t; }
+        [[nodiscard]] constexpr bool operator==(const iterator& o) const noexcept { return p_ == o.p_; }
+
+    private:
+        const char* p_{nullptr};
+        std::size_t step_{0};
+    };
+
+    constexpr GroupView() noexcept = default;
+
+    /// Wrap the group whose dimension header starts at buffer[position]
+    /// Entries that do not fit length are dropped and truncated() is set.
+    [[nodiscard]] NFX_FORCE_INLINE static GroupView wrap(
+        const char* buffer, std::size_t length, std::size_t position) noexcept {
+        GroupView view;
+        if (position > length || length - position < Dimension::SIZE) [[unlikely]] {
+            view.truncated_ = true;
+            return view;
+        }
+        const char* dim = buffer + position;
+        view.entries_ = dim + Dimension::SIZE;
+        view.block_length_ = Dimension::blockLength(dim);
+        view.count_ = Dimension::numInGroup(dim);
+
+        const std::size_t available = length - position - Dimension::SIZE;
+        if (view.block_length_ == 0) {
+            view.count_ = 0;  // Malformed; refuse to step in place
+        } else if (view.count_ > available / view.block_length_) [[unlikely]] {
+            view.count_ = available / view.block_length_;
+            view.truncated_ = true;
+        }
+        return view;
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE constexpr std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] NFX_FORCE_INLINE constexpr bool empty() const noexcept { return count_ == 0; }
+
+    /// Sender's entry size (may differ from the compiled schema's)
+    [[nodiscard]] NFX_FORCE_INLINE constexpr std::size_t blockLength() const noexcept {
+        return block_length_;
+    }
+
+    /// Encoded size of the group: dimension + entries
+    [[nodiscard]] NFX_FORCE_INLINE constexpr std::size_t encodedLength() const noexcept {
+        return Dimension::SIZE + count_ * block_length_;
+    }
+
+    /// Buffer ran out before numInGroup entries
+    [[nodiscard]] NFX_FORCE_INLINE constexpr bool truncated() const noexcept { return truncated_; }
+
+    /// First entry (for column decoders that step the blocks themselves)
+    [[nodiscard]] NFX_FORCE_INLINE constexpr const char* data() const noexcept { return entries_; }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE GroupEntry operator[](std::size_t i) const noexcept {
+        return GroupEntry{entries_ + i * block_length_, block_length_};
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return {entries_, block_length_}; }
+    [[nodiscard]] constexpr iterator end() const noexcept {
+        return {entries_ + count_ * block_length_, block_length_};
+    }
+
+private:
+    const char* entries_{nullptr};
+    std::size_t block_length_{0};
+    std::size_t count_{0};
+    bool truncated_{false};
+};
+
+// ============================================================================
+// MessageCursor: Sequential Reader for Groups and Var-Data
+// ============================================================================
+
+/// Reads a message's groups and var-data in schema order
+class MessageCursor {
+public:
+    /// Sequential reader for a group whose entries hold nested groups/var-data
+    template <typename Dimension>
+    class GroupReader {
+    public:
+        [[nodiscard]] NFX_FORCE_INLINE std::size_t count() const noexcept { return count_; }
+        [[nodiscard]] NFX_FORCE_INLINE std::size_t index() const noexcept { return index_; }
+
+        /// Another entry left and its block fits the buffer
+        [[nodiscard]] NFX_FORCE_INLINE bool has_next() const noexcept {
+            return index_ < count_ && cursor_->remaining() >= block_length_;
+        }
+
+        /// Entry at the cursor; the cursor moves past its block so nested
+        /// groups/var-data of this entry are read next
+        NFX_FORCE_INLINE GroupEntry next() noexcept {
+            GroupEntry e{cursor_->buffer_ + cursor_->position_, block_length_};
+            cursor_->position_ += block_length_;
+            ++index_;
+            return e;
+        }
+
+    private:
+        friend class MessageCursor;
+        GroupReader(MessageCursor* cursor, std::size_t block_length, std::size_t count) noexcept
+            : cursor_{cursor}, block_length_{block_length}, count_{count} {}
+
+        MessageCursor* cursor_;
+        std::size_t block_length_;
+        std::size_t count_;
+        std::size_t index_{0};
+    };
+
+    /// Start after the root block, using the header's (acting) blockLength
+    MessageCursor(const char* buffer, std::size_t length) noexcept
+        : buffer_{buffer}, length_{length} {
+        if (length >= MessageHeader::SIZE) {
+            const auto header = MessageHeader::wrapForDecode(buffer, length);
+            version_ = header.version();
+            position_ = MessageHeader::SIZE + header.blockLength();
+        }
+        ok_ = position_ <= length_;
+    }
+
+    /// Start at an explicit position (e.g. inside a larger packet)
+    MessageCursor(const char* buffer, std::size_t length, std::size_t position) noexcept
+        : buffer_{buffer}, length_{length}, position_{position}, ok_{position <= length} {}
+
+    /// Flat group at the cursor; cursor moves past it
+    template <typename Dimension>
+    [[nodiscard]] NFX_FORCE_INLINE GroupView<Dimension> group() noexcept {
+        if (!ok_) return {};
+        auto view = GroupView<Dimension>::wrap(buffer_, length_, position_);
+        if (view.truncated()) {
+            ok_ = false;
+        }
+        position_ += view.truncated() ? 0 : view.encodedLength();
+        return view;
+    }
+
+    /// Group at the cursor whose entries are read one by one
+    template <typename Dimension>
+    [[nodiscard]] NFX_FORCE_INLINE GroupReader<Dimension> begin_group() noexcept {
+        if (!ok_ || remaining() < Dimension::SIZE) [[unlikely]] {
+            ok_ = false;
+            return GroupReader<Dimension>{this, 0, 0};
+        }
+        const char* dim = buffer_ + position_;
+        position_ += Dimension::SIZE;
+        return GroupReader<Dimension>{this, Dimension::blockLength(dim),
+                                      Dimension::numInGroup(dim)};
+    }
+
+    /// Var-data at the cursor (empty and !ok() if truncated)
+    template <typename Encoding = VarStringEncoding>
+    [[nodiscard]] NFX_FORCE_INLINE std::string_view var_data() noexcept {
+        std::string_view out;
+        if (!ok_) return out;
+        const std::size_t used = Encoding::decode(buffer_ + position_, remaining(), out);
+        if (used == 0) [[unlikely]] {
+            ok_ = false;
+        }
+        position_ += used;
+        return out;
+    }
+
+    /// Byte offset of the next group/var-data
+    [[nodiscard]] NFX_FORCE_INLINE std::size_t position() const noexcept { return position_; }
+
+    [[nodiscard]] NFX_FORCE_INLINE std::size_t remaining() const noexcept {
+        return position_ <= length_ ? length_ - position_ : 0;
+    }
+
+    /// Schema version from the header (0 with an explicit start position)
+    [[nodiscard]] NFX_FORCE_INLINE SbeUint16 version() const noexcept { return version_; }
+
+    /// No read so far ran past the buffer
+    [[nodiscard]] NFX_FORCE_INLINE bool ok() const noexcept { return ok_; }
+
+private:
+    const char* buffer_;
+    std::size_t length_;
+    std::size_t position_{0};
+    SbeUint16 version_{0};
+    bool ok_{false};
+};
+
+// ============================================================================
+// Static Assertions
+// ============================================================================
+
+static_assert(GroupSizeEncoding::SIZE == 4);
+static_assert(GroupSize::SIZE == 3);
+static_assert(GroupSize8Byte::Offset::NumInGroup == 7);
+static_assert(VarStringEncoding::SIZE == 2);
+
+}  // namespace nfx::sbe
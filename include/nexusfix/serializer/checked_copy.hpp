@@ -0,0 +1,114 @@
+/*
+    NexusFIX Checked Value Copy
+
+    Copies an outbound field value and, in the same vector pass, checks it
+    for the two bytes that break FIX framing: SOH ends the field early and
+    '=' turns the rest of the value into a bogus tag for strict parsers.
+    A ClOrdID or Text carrying either is rejected or, worse, desynchronizes
+    the counterparty's parser and costs a disconnect.
+
+        load 32 (AVX2) / 16 (SSE2) bytes -> store to dst
+                                         -> cmpeq SOH | cmpeq '=' -> OR into flags
+
+    The compares run on the register that was loaded for the store, so the
+    check adds two compares and an OR per vector to the copy. The tail of
+    a value of 16 bytes or more is one overlapping 16-byte block; shorter
+    values (most tags' values) take an inline byte loop, and the vector
+    path is an out-of-line call.
+
+    Used by MessageAssembler::set_value_validation() and
+    FastMessageBuilder::set_value_validation().
+
+    Usage:
+        if (!serializer::copy_value_checked(out + pos, value.data(), value.size())) {
+            // value holds SOH or '='
+        }
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(__SSE2__) || (NFX_COMPILER_MSVC && NFX_ARCH_X64)
+    #include <immintrin.h>
+    #define NFX_SSE2_CHECKED_COPY 1
+#endif
+
+namespace nfx::serializer {
+
+/// Bytes a FIX field value must not contain
+[[nodiscard]] constexpr bool is_forbidden_value_byte(char c) noexcept {
+    return c == '\x01' || c == '=';
+}
+
+#if defined(NFX_SSE2_CHECKED_COPY)
+/// Vector body of copy_value_checked() for n >= 16
+/// Kept out of line: inlined into a caller that passes a short
+/// fixed-size array, GCC follows the 16/32-byte loads past its end on
+/// paths the size check never takes and fails -Warray-bounds.
+[[nodiscard]] NFX_NOINLINE inline bool copy_value_checked_wide(
+    char* dst, const char* src, size_t n) noexcept
+{
+    size_t i = 0;
+#if NFX_HAS_AVX2
+    if (n >= 32) {
+        const __m256i soh = _mm256_set1_epi8('\x01');
+        const __m256i eq = _mm256_set1_epi8('=');
+        __m256i bad = _mm256_setzero_si256();
+        for (; i + 32 <= n; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+            bad = _mm256_or_si256(bad, _mm256_or_si256(_mm256_cmpeq_epi8(v, soh),
+                                                       _mm256_cmpeq_epi8(v, eq)));
+        }
+        if (!_mm256_testz_si256(bad, bad)) {
+            std::memcpy(dst + i, src + i, n - i);
+            return false;
+        }
+    }
+#endif
+    const __m128i soh = _mm_set1_epi8('\x01');
+    const __m128i eq = _mm_set1_epi8('=');
+    __m128i bad = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+        bad = _mm_or_si128(bad, _mm_or_si128(_mm_cmpeq_epi8(v, soh), _mm_cmpeq_epi8(v, eq)));
+    }
+    if (i < n) {
+        // Last 16 bytes, overlapping what was already copied
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n - 16), v);
+        bad = _mm_or_si128(bad, _mm_or_si128(_mm_cmpeq_epi8(v, soh), _mm_cmpeq_epi8(v, eq)));
+    }
+    return _mm_movemask_epi8(bad) == 0;
+}
+#endif
+
+/// Copy n bytes from src to dst (non-overlapping)
+/// @return false if any copied byte is SOH or '=' (the copy is still made)
+[[nodiscard]] NFX_HOT inline bool copy_value_checked(char* dst, const char* src, size_t n) noexcept {
+#if defined(NFX_SSE2_CHECKED_COPY)
+    if (n >= 16) return copy_value_checked_wide(dst, src, n);
+#endif
+    bool ok = true;
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = src[i];
+        ok &= !is_forbidden_value_byte(src[i]);
+    }
+    return ok;
+}
+
+/// True if value holds no SOH or '=' (no copy)
+[[nodiscard]] constexpr bool is_valid_value(std::string_view value) noexcept {
+    for (char c : value) {
+        if (is_forbidden_value_byte(c)) return false;
+    }
+    return true;
+}
+
+} // namespace nfx::serializer
@@ -24,6 +24,9 @@
 #include <type_traits>
 
 #include "nexusfix/platform/platform.hpp"
+#include "nexusfix/messages/common/group_writer.hpp"
+#include "nexusfix/serializer/checked_copy.hpp"
+#include "nexusfix/serializer/decimal_serializer.hpp"
 
 namespace nfx::serializer {
 
@@ -117,31 +120,16 @@ template<size_t Width>
 struct FastIntSerializer {
     static_assert(Width >= 1 && Width <= 10, "Width must be 1-10");
 
-    /// Serialize integer to fixed-width buffer
+    /// Serialize integer to buffer (room for MAX_U32_CHARS)
     /// Returns actual number of digits written
     NFX_HOT
     static size_t serialize(char* buf, uint32_t value) noexcept {
-        // Count digits
-        size_t digits = 1;
-        uint32_t temp = value;
-        while (temp >= 10) { temp /= 10; ++digits; }
-
-        // Write digits right-to-left
-        size_t pos = digits;
-        do {
-            buf[--pos] = '0' + (value % 10);
-            value /= 10;
-        } while (value > 0);
-
-        return digits;
+        return write_u32(buf, value);
     }
 
-    /// Serialize to fixed width with leading zeros
+    /// Serialize to fixed width with leading zeros (low Width digits)
     static void serialize_fixed(char* buf, uint32_t value) noexcept {
-        for (size_t i = Width; i > 0; --i) {
-            buf[i - 1] = '0' + (value % 10);
-            value /= 10;
-        }
+        write_fixed_digits(buf, value % detail::pow10(Width), Width);
     }
 };
 
@@ -165,18 +153,40 @@ struct FieldDescriptor {
 // ============================================================================
 
 /// High-performance message builder with compile-time field layout
+/// With set_value_validation(true) string values are copied by
+/// copy_value_checked() and invalid_field() names the first one holding
+/// SOH or '='.
 template<size_t MaxSize = 4096>
 class FastMessageBuilder {
 public:
     constexpr FastMessageBuilder() noexcept : buffer_{}, pos_{0} {}
 
+    /// Check string values for SOH and '=' while copying them
+    FastMessageBuilder& set_value_validation(bool enabled) noexcept {
+        validate_values_ = enabled;
+        return *this;
+    }
+
+    [[nodiscard]] bool value_validation() const noexcept { return validate_values_; }
+
+    /// Tag of the first string value holding SOH or '=' since reset() (0 = none)
+    [[nodiscard]] int invalid_field() const noexcept { return invalid_field_; }
+
     /// Write a field with string value
     template<int Tag>
     NFX_HOT
     FastMessageBuilder& field(std::string_view value) noexcept {
         constexpr TagString<Tag> tag_str{};
         write_raw(tag_str.c_str(), tag_str.size());
-        write_raw(value.data(), value.size());
+        if (validate_values_) {
+            const size_t n = (pos_ + value.size() <= MaxSize) ? value.size() : (MaxSize - pos_);
+            if (!copy_value_checked(&buffer_[pos_], value.data(), n) && invalid_field_ == 0) {
+                invalid_field_ = Tag;
+            }
+            pos_ += n;
+        } else {
+            write_raw(value.data(), value.size());
+        }
         write_soh();
         return *this;
     }
@@ -189,7 +199,7 @@ public:
         write_raw(tag_str.c_str(), tag_str.size());
 
         // Fast integer serialization
-        char int_buf[16];
+        char int_buf[MAX_U32_CHARS];
         size_t len = FastIntSerializer<10>::serialize(int_buf, value);
         write_raw(int_buf, len);
         write_soh();
@@ -214,6 +224,34 @@ public:
         return field<Tag>(value ? 'Y' : 'N');
     }
 
+    /// Open a repeating group (see group_writer.hpp); close it before
+    /// the next field outside the group
+    template<typename Def>
+    [[nodiscard]] GroupWriter<Def, FastMessageBuilder> group() noexcept {
+        return GroupWriter<Def, FastMessageBuilder>{*this};
+    }
+
+    /// Write "<count_tag>=0|" for a GroupWriter
+    /// @return Position of the count placeholder digit, MaxSize if full
+    size_t open_group(int count_tag) noexcept {
+        char tag_buf[MAX_U32_CHARS + 3];
+        size_t len = FastIntSerializer<10>::serialize(tag_buf, static_cast<uint32_t>(count_tag));
+        if (pos_ + len + 3 > MaxSize) {
+            pos_ = MaxSize;
+            return MaxSize;
+        }
+        std::memcpy(tag_buf + len, "=0", 2);
+        len += 2;
+        write_raw(tag_buf, len);
+        write_soh();
+        return pos_ - 2;
+    }
+
+    /// Back-patch the count written by open_group()
+    void close_group(size_t count_at, size_t count_tag_digits, size_t count) noexcept {
+        nfx::detail::patch_group_count(buffer_.data(), pos_, MaxSize, count_at, count_tag_digits, count);
+    }
+
     /// Write BeginString (tag 8)
     FastMessageBuilder& begin_string(std::string_view value) noexcept {
         return field<8>(value);
@@ -299,7 +337,10 @@ public:
     [[nodiscard]] const char* c_str() const noexcept { return buffer_.data(); }
 
     /// Reset builder
-    void reset() noexcept { pos_ = 0; }
+    void reset() noexcept {
+        pos_ = 0;
+        invalid_field_ = 0;
+    }
 
     /// Get body start position (after tag 9)
     [[nodiscard]] size_t body_start() const noexcept { return body_start_; }
@@ -321,6 +362,8 @@ private:
     std::array<char, MaxSize> buffer_;
     size_t pos_;
     size_t body_start_{0};
+    bool validate_values_{false};
+    int invalid_field_{0};
 };
 
 // ============================================================================
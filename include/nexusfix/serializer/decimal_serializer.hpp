@@ -0,0 +1,272 @@
+/*
+    NexusFIX Decimal Serializer
+
+    Integer and fixed-point decimal formatting for outbound fields
+    (MsgSeqNum, quantities, prices). No digit-by-digit division loop:
+
+    - 8-digit blocks: SSE2 converts a value < 10^8 to eight ASCII digits
+      in one register (two 16-bit reciprocal multiplies per lane);
+      without SSE2 four 2-digit lookups do the same
+    - Leading zeros are dropped by shifting the 8-byte block, the count
+      comes from a trailing-zero count, not from comparing against
+      powers of ten
+    - Fixed-point values trim trailing fractional zeros the same way:
+      FixedPrice 15025000000 -> "150.25", Qty 1000000 -> "100"
+    - Fixed-width, zero-padded variants keep BodyLength constant for
+      slots patched in place (OrderTemplate)
+
+    Destinations need room for the longest result (MAX_U32_CHARS, ...):
+    8-digit blocks are stored whole and later blocks overwrite the tail.
+
+    Usage:
+        char buf[MAX_DECIMAL_CHARS];
+        size_t n = write_u64(buf, 1234567890123);        // "1234567890123"
+        n = write_decimal<8>(buf, price.raw);             // "150.25"
+        write_fixed_digits(slot, seq_num, 9);             // "000000042"
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(__SSE2__) || (NFX_COMPILER_MSVC && NFX_ARCH_X64)
+    #include <emmintrin.h>
+    #define NFX_SSE2_DIGITS 1
+#endif
+
+namespace nfx::serializer {
+
+// ============================================================================
+// Buffer Sizes
+// ============================================================================
+
+inline constexpr size_t MAX_U32_CHARS = 10;
+inline constexpr size_t MAX_U64_CHARS = 20;
+inline constexpr size_t MAX_I64_CHARS = 20;       // '-' + 19 digits
+inline constexpr size_t MAX_DECIMAL_CHARS = 32;   // '-' + integer + '.' + 8 decimals
+
+namespace detail {
+
+// ============================================================================
+// Digit Tables
+// ============================================================================
+
+inline constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline constexpr uint64_t ASCII_ZEROS = 0x3030303030303030ULL;
+inline constexpr uint32_t TEN_8 = 100000000u;
+
+NFX_FORCE_INLINE void write_2_digits(char* out, uint32_t value) noexcept {
+    std::memcpy(out, DIGIT_PAIRS + value * 2, 2);
+}
+
+[[nodiscard]] consteval uint64_t pow10(size_t n) noexcept {
+    uint64_t v = 1;
+    for (size_t i = 0; i < n; ++i) v *= 10;
+    return v;
+}
+
+// ============================================================================
+// 8-Digit Block
+// ============================================================================
+
+/// Eight digit values (0-9, not ASCII) of value < 10^8, most significant
+/// digit in the first byte of memory order
+[[nodiscard]] NFX_FORCE_INLINE uint64_t digit_values_8(uint32_t value) noexcept {
+#if defined(NFX_SSE2_DIGITS)
+    // value = abcdefgh -> abcd, efgh -> each replicated across 4 lanes,
+    // then lane i = x / 10^(3-i) by multiply-high with a scaled
+    // reciprocal, and digit = lane - 10 * previous lane
+    const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(value));
+    const __m128i abcd = _mm_srli_epi64(
+        _mm_mul_epu32(abcdefgh, _mm_set1_epi32(static_cast<int>(0xd1b71759u))), 45);
+    const __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+
+    const __m128i v1 = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+    const __m128i v2 = _mm_unpacklo_epi32(_mm_unpacklo_epi16(v1, v1), _mm_unpacklo_epi16(v1, v1));
+
+    const __m128i div_powers = _mm_setr_epi16(8389, 5243, 13108, static_cast<short>(32768),
+                                              8389, 5243, 13108, static_cast<short>(32768));
+    const __m128i shift_powers = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, static_cast<short>(1 << 15),
+                                                1 << 7, 1 << 11, 1 << 13, static_cast<short>(1 << 15));
+    const __m128i prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(v2, div_powers), shift_powers);
+
+    const __m128i tens = _mm_slli_epi64(_mm_mullo_epi16(prefixes, _mm_set1_epi16(10)), 16);
+    const __m128i digits = _mm_packus_epi16(_mm_sub_epi16(prefixes, tens), _mm_setzero_si128());
+
+    uint64_t word;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&word), digits);
+    return word;
+#else
+    const uint32_t hi = value / 10000;
+    const uint32_t lo = value % 10000;
+    char ascii[8];
+    write_2_digits(ascii, hi / 100);
+    write_2_digits(ascii + 2, hi % 100);
+    write_2_digits(ascii + 4, lo / 100);
+    write_2_digits(ascii + 6, lo % 100);
+    uint64_t word;
+    std::memcpy(&word, ascii, 8);
+    return word - ASCII_ZEROS;
+#endif
+}
+
+/// Leading zero digits of a digit_values_8 block, at most 7 (so 0 keeps "0")
+[[nodiscard]] NFX_FORCE_INLINE uint32_t leading_zero_digits(uint64_t digits) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<uint32_t>(std::countr_zero(digits | (1ULL << 56))) >> 3;
+    } else {
+        return static_cast<uint32_t>(std::countl_zero(digits | (1ULL << 7))) >> 3;
+    }
+}
+
+/// Trailing zero digits of a digit_values_8 block (8 for 0)
+[[nodiscard]] NFX_FORCE_INLINE uint32_t trailing_zero_digits(uint64_t digits) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<uint32_t>(std::countl_zero(digits)) >> 3;
+    } else {
+        return static_cast<uint32_t>(std::countr_zero(digits)) >> 3;
+    }
+}
+
+/// Drop the first n (< 8) digits of a block (memory order)
+[[nodiscard]] NFX_FORCE_INLINE uint64_t skip_digits(uint64_t digits, uint32_t n) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        return digits >> (n * 8);
+    } else {
+        return digits << (n * 8);
+    }
+}
+
+/// value < 10^8 without leading zeros; stores 8 bytes, returns length
+NFX_FORCE_INLINE size_t write_short(char* out, uint32_t value) noexcept {
+    const uint64_t digits = digit_values_8(value);
+    const uint32_t zeros = leading_zero_digits(digits);
+    const uint64_t ascii = skip_digits(digits, zeros) + ASCII_ZEROS;
+    std::memcpy(out, &ascii, 8);
+    return 8 - zeros;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Fixed-Width (Zero-Padded)
+// ============================================================================
+
+/// Exactly 8 digits of value < 10^8
+NFX_FORCE_INLINE void write_8_digits(char* out, uint32_t value) noexcept {
+    const uint64_t ascii = detail::digit_values_8(value) + detail::ASCII_ZEROS;
+    std::memcpy(out, &ascii, 8);
+}
+
+/// Write value as exactly width digits (zero-padded)
+/// Caller guarantees value < 10^width.
+NFX_FORCE_INLINE void write_fixed_digits(char* out, uint64_t value, size_t width) noexcept {
+    while (width >= 8) {
+        width -= 8;
+        write_8_digits(out + width, static_cast<uint32_t>(value % detail::TEN_8));
+        value /= detail::TEN_8;
+    }
+    while (width >= 2) {
+        width -= 2;
+        detail::write_2_digits(out + width, static_cast<uint32_t>(value % 100));
+        value /= 100;
+    }
+    if (width != 0) {
+        *out = static_cast<char>('0' + value);
+    }
+}
+
+// ============================================================================
+// Variable-Width Integers
+// ============================================================================
+
+/// uint32 without leading zeros; out needs MAX_U32_CHARS
+/// @return Characters written
+[[nodiscard]] NFX_FORCE_INLINE size_t write_u32(char* out, uint32_t value) noexcept {
+    if (value < detail::TEN_8) [[likely]] {
+        return detail::write_short(out, value);
+    }
+    const size_t n = detail::write_short(out, value / detail::TEN_8);
+    write_8_digits(out + n, value % detail::TEN_8);
+    return n + 8;
+}
+
+/// uint64 without leading zeros; out needs MAX_U64_CHARS
+/// @return Characters written
+[[nodiscard]] NFX_FORCE_INLINE size_t write_u64(char* out, uint64_t value) noexcept {
+    if (value < detail::TEN_8) [[likely]] {
+        return detail::write_short(out, static_cast<uint32_t>(value));
+    }
+    constexpr uint64_t TEN_16 = detail::pow10(16);
+    if (value < TEN_16) {
+        const size_t n = detail::write_short(out, static_cast<uint32_t>(value / detail::TEN_8));
+        write_8_digits(out + n, static_cast<uint32_t>(value % detail::TEN_8));
+        return n + 8;
+    }
+    const size_t n = detail::write_short(out, static_cast<uint32_t>(value / TEN_16));
+    const uint64_t low = value % TEN_16;
+    write_8_digits(out + n, static_cast<uint32_t>(low / detail::TEN_8));
+    write_8_digits(out + n + 8, static_cast<uint32_t>(low % detail::TEN_8));
+    return n + 16;
+}
+
+/// int64 with '-' when negative; out needs MAX_I64_CHARS
+/// @return Characters written
+[[nodiscard]] NFX_FORCE_INLINE size_t write_i64(char* out, int64_t value) noexcept {
+    const size_t negative = value < 0;
+    const uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value)
+                                        : static_cast<uint64_t>(value);
+    out[0] = '-';
+    return negative + write_u64(out + negative, magnitude);
+}
+
+// ============================================================================
+// Fixed-Point Decimals
+// ============================================================================
+
+/// Scaled integer raw / 10^Decimals as a FIX decimal: no exponent,
+/// trailing fractional zeros (and a bare '.') dropped
+/// @tparam Decimals FixedPrice::DECIMAL_PLACES, 4 for Qty (1-8)
+/// @return Characters written (out needs MAX_DECIMAL_CHARS)
+template <size_t Decimals>
+[[nodiscard]] NFX_FORCE_INLINE size_t write_decimal(char* out, int64_t raw) noexcept {
+    static_assert(Decimals >= 1 && Decimals <= 8, "Decimals must be 1-8");
+    constexpr uint64_t SCALE = detail::pow10(Decimals);
+
+    const size_t negative = raw < 0;
+    const uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(raw)
+                                        : static_cast<uint64_t>(raw);
+    out[0] = '-';
+    size_t pos = negative + write_u64(out + negative, magnitude / SCALE);
+
+    // Fraction as the last Decimals digits of an 8-digit block
+    const uint64_t digits = detail::skip_digits(
+        detail::digit_values_8(static_cast<uint32_t>(magnitude % SCALE)), 8 - Decimals);
+    const size_t frac_len = Decimals - (detail::trailing_zero_digits(digits) - (8 - Decimals));
+    out[pos] = '.';
+    const uint64_t ascii = digits + detail::ASCII_ZEROS;
+    std::memcpy(out + pos + 1, &ascii, 8);
+    return pos + (frac_len != 0) + frac_len;
+}
+
+/// Zero-padded decimal with every digit present, for patchable slots:
+/// IntDigits + '.' + Decimals characters ("00000150.25000000")
+/// Caller guarantees 0 <= raw < 10^(IntDigits + Decimals).
+template <size_t IntDigits, size_t Decimals>
+NFX_FORCE_INLINE void write_decimal_fixed(char* out, uint64_t raw) noexcept {
+    constexpr uint64_t SCALE = detail::pow10(Decimals);
+    write_fixed_digits(out, raw / SCALE, IntDigits);
+    out[IntDigits] = '.';
+    write_fixed_digits(out + IntDigits + 1, raw % SCALE, Decimals);
+}
+
+}  // namespace nfx::serializer
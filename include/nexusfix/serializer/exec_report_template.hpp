@@ -0,0 +1,328 @@
+/*
+    NexusFIX Pre-Serialized ExecutionReport Template
+
+    The venue-side counterpart of OrderTemplate. Every ExecutionReport a
+    session sends shares its header and tag layout; the numbers change,
+    and three strings echo the order (Symbol, ClOrdID, OrigClOrdID).
+    ExecReportTemplate renders the fixed part once with fixed-width slots
+    for the numbers and appends the echoed strings at the end of the body:
+
+        8=FIX.4.4|9=000231|35=8|49=..|56=..|34=000000042|52=20260123-10:30:00.123|
+        37=O000000001234|17=X000000005678|150=F|39=1|54=1|
+        38=0000000100|44=00000150.25000000|32=0000000040|31=00000150.25000000|
+        151=0000000060|14=0000000040|6=00000150.25000000|60=20260123-10:30:00.123|
+        55=AAPL|11=CL-77|41=CL-76|10=XXX|
+        \_____________________ fixed slots ________________________/\__ tail __/
+
+    Only the tail and the trailer move when the echoed strings change
+    length, so render() patches the slots in place, copies the tail
+    (checking it for SOH / '=' in the same pass, copy_value_checked()),
+    and derives BodyLength and the checksum from the precomputed sum of
+    the static bytes plus the slot and tail bytes (IncrementalChecksum).
+
+    Leading zeros are valid in FIX int, Qty and Price values.
+
+    Usage:
+        serializer::ExecReportTemplate<> report{{.sender_comp_id = "EXCH", .target_comp_id = "CLIENT1"}};
+        auto msg = report.render(0, {.order_id = 1, .exec_id = 7, .exec_type = ExecType::New,
+                                     .ord_status = OrdStatus::New, .symbol = "AAPL",
+                                     .cl_ord_id = "CL-1", ...}, timestamp);
+        session.send_prebuilt({&msg, 1});    // MsgSeqNum 0: sequenced by the session
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+#include "nexusfix/serializer/checked_copy.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/serializer/decimal_serializer.hpp"
+
+namespace nfx::serializer {
+
+// ============================================================================
+// ExecutionReport Template
+// ============================================================================
+
+/// Static ExecutionReport content shared by every report from a template
+struct ExecReportTemplateFields {
+    std::string_view begin_string{"FIX.4.4"};
+    std::string_view sender_comp_id;
+    std::string_view target_comp_id;
+    std::string_view order_id_prefix{"O"};   // OrderID = prefix + zero-padded id
+    std::string_view exec_id_prefix{"X"};    // ExecID = prefix + zero-padded id
+};
+
+/// Per-report values (quantities in whole units)
+struct ExecReportValues {
+    uint64_t order_id{0};
+    uint64_t exec_id{0};
+    ExecType exec_type{ExecType::New};
+    OrdStatus ord_status{OrdStatus::New};
+    Side side{Side::Buy};
+    Qty order_qty{};
+    FixedPrice price{};
+    Qty last_qty{};
+    FixedPrice last_px{};
+    Qty leaves_qty{};
+    Qty cum_qty{};
+    FixedPrice avg_px{};
+    std::string_view symbol{};
+    std::string_view cl_ord_id{};
+    std::string_view orig_cl_ord_id{};       // Omitted when empty
+};
+
+/// Pre-rendered ExecutionReport with in-place patched slots and an echoed tail
+template <size_t MaxSize = 512>
+class ExecReportTemplate {
+public:
+    static constexpr size_t SEQ_NUM_WIDTH = 9;
+    static constexpr size_t TIMESTAMP_WIDTH = 21;       // YYYYMMDD-HH:MM:SS.sss
+    static constexpr size_t ID_DIGITS = 12;
+    static constexpr size_t QTY_WIDTH = 10;             // Whole units
+    static constexpr size_t PRICE_INTEGER_DIGITS = 8;   // + '.' + 8 decimals
+    static constexpr size_t PRICE_WIDTH =
+        PRICE_INTEGER_DIGITS + 1 + FixedPrice::DECIMAL_PLACES;
+    static constexpr size_t BODY_LENGTH_WIDTH = 6;      // body_length_placeholder()
+
+    explicit ExecReportTemplate(const ExecReportTemplateFields& fields) noexcept {
+        FastMessageBuilder<MaxSize> builder;
+        constexpr char ZEROS[32] = "0000000000000000000000000000000";
+        constexpr std::string_view TIMESTAMP_SLOT{"00000000-00:00:00.000"};
+        static_assert(TIMESTAMP_SLOT.size() == TIMESTAMP_WIDTH);
+
+        char price[PRICE_WIDTH];
+        std::memcpy(price, ZEROS, PRICE_WIDTH);
+        price[PRICE_INTEGER_DIGITS] = '.';
+        const std::string_view price_slot{price, PRICE_WIDTH};
+        const std::string_view qty_slot{ZEROS, QTY_WIDTH};
+
+        // Offset of the value just written by a field<Tag>(...) call
+        auto value_offset = [&builder](size_t width) noexcept {
+            return builder.size() - 1 - width;
+        };
+        // Prefix + ID_DIGITS zeros; the digits become the slot
+        auto id_field = [&](auto tag, std::string_view prefix) noexcept {
+            char id[32 + ID_DIGITS];
+            const size_t len = prefix.size() < 32 ? prefix.size() : 32;
+            std::memcpy(id, prefix.data(), len);
+            std::memcpy(id + len, ZEROS, ID_DIGITS);
+            builder.template field<decltype(tag)::value>(std::string_view{id, len + ID_DIGITS});
+            return add_slot(value_offset(ID_DIGITS), ID_DIGITS);
+        };
+
+        builder.begin_string(fields.begin_string);
+        const size_t body_len_pos = builder.body_length_placeholder();
+        body_length_ = add_slot(body_len_pos, BODY_LENGTH_WIDTH);
+        builder.mark_body_start();
+        builder.msg_type('8');
+        builder.sender_comp_id(fields.sender_comp_id);
+        builder.target_comp_id(fields.target_comp_id);
+
+        builder.template field<34>(std::string_view{ZEROS, SEQ_NUM_WIDTH});
+        seq_num_ = add_slot(value_offset(SEQ_NUM_WIDTH), SEQ_NUM_WIDTH);
+        builder.template field<52>(TIMESTAMP_SLOT);
+        sending_time_ = add_slot(value_offset(TIMESTAMP_WIDTH), TIMESTAMP_WIDTH);
+
+        order_id_ = id_field(std::integral_constant<int, 37>{}, fields.order_id_prefix);
+        exec_id_ = id_field(std::integral_constant<int, 17>{}, fields.exec_id_prefix);
+        builder.template field<150>(static_cast<char>(ExecType::New));
+        exec_type_ = add_slot(value_offset(1), 1);
+        builder.template field<39>(static_cast<char>(OrdStatus::New));
+        ord_status_ = add_slot(value_offset(1), 1);
+        builder.template field<54>(static_cast<char>(Side::Buy));
+        side_ = add_slot(value_offset(1), 1);
+
+        builder.template field<38>(qty_slot);
+        order_qty_ = add_slot(value_offset(QTY_WIDTH), QTY_WIDTH);
+        builder.template field<44>(price_slot);
+        price_ = add_slot(value_offset(PRICE_WIDTH), PRICE_WIDTH);
+        builder.template field<32>(qty_slot);
+        last_qty_ = add_slot(value_offset(QTY_WIDTH), QTY_WIDTH);
+        builder.template field<31>(price_slot);
+        last_px_ = add_slot(value_offset(PRICE_WIDTH), PRICE_WIDTH);
+        builder.template field<151>(qty_slot);
+        leaves_qty_ = add_slot(value_offset(QTY_WIDTH), QTY_WIDTH);
+        builder.template field<14>(qty_slot);
+        cum_qty_ = add_slot(value_offset(QTY_WIDTH), QTY_WIDTH);
+        builder.template field<6>(price_slot);
+        avg_px_ = add_slot(value_offset(PRICE_WIDTH), PRICE_WIDTH);
+        builder.template field<60>(TIMESTAMP_SLOT);
+        transact_time_ = add_slot(value_offset(TIMESTAMP_WIDTH), TIMESTAMP_WIDTH);
+
+        fixed_size_ = builder.size();
+        fixed_body_length_ = fixed_size_ - builder.body_start();
+        valid_ = fixed_size_ + TRAILER_SIZE < MaxSize;  // FastMessageBuilder truncates on overflow
+        std::memcpy(buffer_.data(), builder.data().data(), fixed_size_);
+
+        // Sum of every fixed byte outside the slots, computed once
+        size_t pos = 0;
+        for (size_t i = 0; i < num_slots_; ++i) {
+            static_sum_.update(buffer_.data() + pos, slots_[i].offset - pos);
+            pos = slots_[i].offset + slots_[i].width;
+        }
+        static_sum_.update(buffer_.data() + pos, fixed_size_ - pos);
+        size_ = fixed_size_;
+    }
+
+    /// Patch the slots, append the echoed strings and return the message
+    /// @param timestamp SendingTime and TransactTime, TIMESTAMP_WIDTH chars
+    /// @return Empty span if a value does not fit its slot, an echoed
+    ///         string holds SOH or '=', or the message would exceed MaxSize
+    [[nodiscard]] NFX_HOT
+    std::span<const char> render(
+        uint32_t seq_num,
+        const ExecReportValues& v,
+        std::string_view timestamp) noexcept
+    {
+        const size_t tail_size = tail_field_size(v.symbol) + tail_field_size(v.cl_ord_id) +
+            (v.orig_cl_ord_id.empty() ? 0 : tail_field_size(v.orig_cl_ord_id));
+
+        if (!valid_ ||
+            fixed_size_ + tail_size + TRAILER_SIZE > MaxSize ||
+            seq_num >= detail::pow10(SEQ_NUM_WIDTH) ||
+            v.order_id >= detail::pow10(ID_DIGITS) ||
+            v.exec_id >= detail::pow10(ID_DIGITS) ||
+            timestamp.size() != TIMESTAMP_WIDTH ||
+            !fits(v.order_qty) || !fits(v.last_qty) || !fits(v.leaves_qty) || !fits(v.cum_qty) ||
+            !fits(v.price) || !fits(v.last_px) || !fits(v.avg_px)) [[unlikely]] {
+            return {};
+        }
+
+        char* buf = buffer_.data();
+        auto put_qty = [buf, this](size_t slot, Qty qty) noexcept {
+            write_fixed_digits(buf + slots_[slot].offset, static_cast<uint64_t>(qty.whole()), QTY_WIDTH);
+        };
+        auto put_price = [buf, this](size_t slot, FixedPrice px) noexcept {
+            write_decimal_fixed<PRICE_INTEGER_DIGITS, FixedPrice::DECIMAL_PLACES>(
+                buf + slots_[slot].offset, static_cast<uint64_t>(px.raw));
+        };
+
+        // Tail first: an invalid echoed string leaves the slots untouched
+        char* tail = buf + fixed_size_;
+        bool clean = append_tail_field(tail, "55=", v.symbol);
+        clean &= append_tail_field(tail, "11=", v.cl_ord_id);
+        if (!v.orig_cl_ord_id.empty()) clean &= append_tail_field(tail, "41=", v.orig_cl_ord_id);
+        if (!clean) [[unlikely]] {
+            size_ = fixed_size_;
+            return {};
+        }
+
+        write_fixed_digits(buf + slots_[body_length_].offset,
+                           fixed_body_length_ + tail_size, BODY_LENGTH_WIDTH);
+        write_fixed_digits(buf + slots_[seq_num_].offset, seq_num, SEQ_NUM_WIDTH);
+        std::memcpy(buf + slots_[sending_time_].offset, timestamp.data(), TIMESTAMP_WIDTH);
+        write_fixed_digits(buf + slots_[order_id_].offset, v.order_id, ID_DIGITS);
+        write_fixed_digits(buf + slots_[exec_id_].offset, v.exec_id, ID_DIGITS);
+        buf[slots_[exec_type_].offset] = static_cast<char>(v.exec_type);
+        buf[slots_[ord_status_].offset] = static_cast<char>(v.ord_status);
+        buf[slots_[side_].offset] = static_cast<char>(v.side);
+        put_qty(order_qty_, v.order_qty);
+        put_price(price_, v.price);
+        put_qty(last_qty_, v.last_qty);
+        put_price(last_px_, v.last_px);
+        put_qty(leaves_qty_, v.leaves_qty);
+        put_qty(cum_qty_, v.cum_qty);
+        put_price(avg_px_, v.avg_px);
+        std::memcpy(buf + slots_[transact_time_].offset, timestamp.data(), TIMESTAMP_WIDTH);
+
+        parser::IncrementalChecksum sum = static_sum_;
+        for (size_t i = 0; i < num_slots_; ++i) {
+            sum.update(buf + slots_[i].offset, slots_[i].width);
+        }
+        sum.update(buf + fixed_size_, tail_size);
+
+        char* trailer = buf + fixed_size_ + tail_size;
+        std::memcpy(trailer, "10=", 3);
+        parser::format_checksum(sum.finalize(), trailer + 3);
+        trailer[6] = '\x01';
+
+        size_ = fixed_size_ + tail_size + TRAILER_SIZE;
+        return {buf, size_};
+    }
+
+    /// Last rendered message (the fixed part before the first render or
+    /// after a rejected echoed string)
+    [[nodiscard]] std::span<const char> data() const noexcept {
+        return {buffer_.data(), size_};
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool valid() const noexcept { return valid_; }
+
+private:
+    struct Slot {
+        size_t offset;
+        size_t width;
+    };
+
+    static constexpr size_t MAX_SLOTS = 16;
+
+    size_t add_slot(size_t offset, size_t width) noexcept {
+        slots_[num_slots_] = Slot{offset, width};
+        return num_slots_++;
+    }
+
+    [[nodiscard]] static constexpr size_t tail_field_size(std::string_view value) noexcept {
+        return 3 + value.size() + 1;   // "NN=" value SOH
+    }
+
+    /// Write tag= value SOH at out and advance it
+    /// @return false if value holds SOH or '='
+    static bool append_tail_field(char*& out, std::string_view tag_eq, std::string_view value) noexcept {
+        std::memcpy(out, tag_eq.data(), tag_eq.size());
+        out += tag_eq.size();
+        const bool clean = copy_value_checked(out, value.data(), value.size());
+        out += value.size();
+        *out++ = '\x01';
+        return clean;
+    }
+
+    [[nodiscard]] static constexpr bool fits(Qty qty) noexcept {
+        const int64_t whole = qty.whole();
+        return whole >= 0 && static_cast<uint64_t>(whole) < detail::pow10(QTY_WIDTH);
+    }
+
+    [[nodiscard]] static constexpr bool fits(FixedPrice px) noexcept {
+        constexpr uint64_t MAX_PRICE_RAW =
+            detail::pow10(PRICE_INTEGER_DIGITS + FixedPrice::DECIMAL_PLACES);
+        return px.raw >= 0 && static_cast<uint64_t>(px.raw) < MAX_PRICE_RAW;
+    }
+
+    std::array<char, MaxSize> buffer_{};
+    std::array<Slot, MAX_SLOTS> slots_{};
+    size_t num_slots_{0};
+    size_t body_length_{0};
+    size_t seq_num_{0};
+    size_t sending_time_{0};
+    size_t order_id_{0};
+    size_t exec_id_{0};
+    size_t exec_type_{0};
+    size_t ord_status_{0};
+    size_t side_{0};
+    size_t order_qty_{0};
+    size_t price_{0};
+    size_t last_qty_{0};
+    size_t last_px_{0};
+    size_t leaves_qty_{0};
+    size_t cum_qty_{0};
+    size_t avg_px_{0};
+    size_t transact_time_{0};
+    size_t fixed_size_{0};
+    size_t fixed_body_length_{0};
+    size_t size_{0};
+    parser::IncrementalChecksum static_sum_;
+    bool valid_{false};
+};
+
+} // namespace nfx::serializer
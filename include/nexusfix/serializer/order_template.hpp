@@ -0,0 +1,225 @@
+/*
+    NexusFIX Pre-Serialized Order Template
+
+    Consecutive NewOrderSingle messages on one session differ only in
+    MsgSeqNum, SendingTime/TransactTime, ClOrdID, OrderQty and Price.
+    OrderTemplate renders everything else once with FastMessageBuilder,
+    leaving fixed-width slots for those fields:
+
+        8=FIX.4.4|9=000183|35=D|49=..|56=..|34=000000042|52=20260123-10:30:00.123|
+        11=NFX000000001234|55=AAPL|54=1|60=20260123-10:30:00.123|
+        38=0000000100|40=2|44=00000150.25000000|59=0|10=XXX|
+
+    Because every slot has a fixed width, BodyLength never changes. Each
+    render() writes the slots in place and derives the checksum from the
+    precomputed sum of the static bytes plus the slot bytes only
+    (IncrementalChecksum), so the 150+ static bytes are never re-summed.
+
+    Leading zeros are valid in FIX int, Qty and Price values.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/serializer/decimal_serializer.hpp"
+
+namespace nfx::serializer {
+
+// ============================================================================
+// Order Template
+// ============================================================================
+
+/// Static NewOrderSingle content shared by every order from a template
+struct OrderTemplateFields {
+    std::string_view begin_string{"FIX.4.4"};
+    std::string_view sender_comp_id;
+    std::string_view target_comp_id;
+    std::string_view symbol;
+    std::string_view cl_ord_id_prefix;  // ClOrdID = prefix + zero-padded id
+    std::string_view account;           // Omitted when empty
+    Side side{Side::Buy};
+    OrdType ord_type{OrdType::Limit};   // Price slot omitted for Market
+    TimeInForce time_in_force{TimeInForce::Day};
+    char handl_inst{'\0'};              // Omitted when '\0'
+};
+
+/// Pre-rendered NewOrderSingle with in-place patched fixed-width slots
+template <size_t MaxSize = 512>
+class OrderTemplate {
+public:
+    static constexpr size_t SEQ_NUM_WIDTH = 9;
+    static constexpr size_t TIMESTAMP_WIDTH = 21;       // YYYYMMDD-HH:MM:SS.sss
+    static constexpr size_t CL_ORD_ID_DIGITS = 12;
+    static constexpr size_t QTY_WIDTH = 10;             // Whole units
+    static constexpr size_t PRICE_INTEGER_DIGITS = 8;   // + '.' + 8 decimals
+    static constexpr size_t PRICE_WIDTH =
+        PRICE_INTEGER_DIGITS + 1 + FixedPrice::DECIMAL_PLACES;
+
+    explicit OrderTemplate(const OrderTemplateFields& fields) noexcept {
+        FastMessageBuilder<MaxSize> builder;
+        constexpr char ZEROS[32] = "0000000000000000000000000000000";
+        constexpr std::string_view TIMESTAMP_SLOT{"00000000-00:00:00.000"};
+        static_assert(TIMESTAMP_SLOT.size() == TIMESTAMP_WIDTH);
+
+        // Offset of the value just written by a field<Tag>(...) call
+        auto value_offset = [&builder](size_t width) noexcept {
+            return builder.size() - 1 - width;
+        };
+
+        builder.begin_string(fields.begin_string);
+        const size_t body_len_pos = builder.body_length_placeholder();
+        builder.mark_body_start();
+        builder.msg_type('D');
+        builder.sender_comp_id(fields.sender_comp_id);
+        builder.target_comp_id(fields.target_comp_id);
+
+        builder.template field<34>(std::string_view{ZEROS, SEQ_NUM_WIDTH});
+        seq_num_ = add_slot(value_offset(SEQ_NUM_WIDTH), SEQ_NUM_WIDTH);
+        builder.template field<52>(TIMESTAMP_SLOT);
+        sending_time_ = add_slot(value_offset(TIMESTAMP_WIDTH), TIMESTAMP_WIDTH);
+
+        // ClOrdID: static prefix, then the patched digits
+        char cl_ord_id[64 + CL_ORD_ID_DIGITS];
+        const size_t prefix_len =
+            fields.cl_ord_id_prefix.size() < 64 ? fields.cl_ord_id_prefix.size() : 64;
+        std::memcpy(cl_ord_id, fields.cl_ord_id_prefix.data(), prefix_len);
+        std::memcpy(cl_ord_id + prefix_len, ZEROS, CL_ORD_ID_DIGITS);
+        builder.template field<11>(std::string_view{cl_ord_id, prefix_len + CL_ORD_ID_DIGITS});
+        cl_ord_id_ = add_slot(value_offset(CL_ORD_ID_DIGITS), CL_ORD_ID_DIGITS);
+
+        if (!fields.account.empty()) {
+            builder.template field<1>(fields.account);
+        }
+        if (fields.handl_inst != '\0') {
+            builder.template field<21>(fields.handl_inst);
+        }
+        builder.template field<55>(fields.symbol);
+        builder.template field<54>(static_cast<char>(fields.side));
+        builder.template field<60>(TIMESTAMP_SLOT);
+        transact_time_ = add_slot(value_offset(TIMESTAMP_WIDTH), TIMESTAMP_WIDTH);
+        builder.template field<38>(std::string_view{ZEROS, QTY_WIDTH});
+        qty_ = add_slot(value_offset(QTY_WIDTH), QTY_WIDTH);
+        builder.template field<40>(static_cast<char>(fields.ord_type));
+
+        has_price_ = fields.ord_type != OrdType::Market;
+        if (has_price_) {
+            char price[PRICE_WIDTH];
+            std::memcpy(price, ZEROS, PRICE_WIDTH);
+            price[PRICE_INTEGER_DIGITS] = '.';
+            builder.template field<44>(std::string_view{price, PRICE_WIDTH});
+            price_ = add_slot(value_offset(PRICE_WIDTH), PRICE_WIDTH);
+        }
+        builder.template field<59>(static_cast<char>(fields.time_in_force));
+
+        builder.update_body_length(body_len_pos, builder.size() - builder.body_start());
+        builder.finalize_checksum();  // Reserves 10=XXX|; value patched per render
+
+        size_ = builder.size();
+        valid_ = size_ + 1 < MaxSize;  // FastMessageBuilder truncates on overflow
+        std::memcpy(buffer_.data(), builder.data().data(), size_);
+        checksum_pos_ = size_ - 4;
+
+        // Sum of every byte outside the slots, computed once
+        size_t pos = 0;
+        for (size_t i = 0; i < num_slots_; ++i) {
+            static_sum_.update(buffer_.data() + pos, slots_[i].offset - pos);
+            pos = slots_[i].offset + slots_[i].width;
+        }
+        static_sum_.update(buffer_.data() + pos, checksum_pos_ - 3 - pos);
+    }
+
+    /// Patch the variable fields and return the complete message
+    /// @param timestamp SendingTime and TransactTime, TIMESTAMP_WIDTH chars
+    /// @return Empty span if a value does not fit its slot (or the
+    ///         template overflowed MaxSize); the buffer is then unchanged
+    [[nodiscard]] NFX_HOT
+    std::span<const char> render(
+        uint32_t seq_num,
+        uint64_t cl_ord_id,
+        FixedPrice price,
+        Qty qty,
+        std::string_view timestamp) noexcept
+    {
+        constexpr uint64_t MAX_PRICE_RAW =
+            detail::pow10(PRICE_INTEGER_DIGITS + FixedPrice::DECIMAL_PLACES);
+        const int64_t whole_qty = qty.whole();
+
+        if (!valid_ ||
+            seq_num >= detail::pow10(SEQ_NUM_WIDTH) ||
+            cl_ord_id >= detail::pow10(CL_ORD_ID_DIGITS) ||
+            whole_qty < 0 || static_cast<uint64_t>(whole_qty) >= detail::pow10(QTY_WIDTH) ||
+            timestamp.size() != TIMESTAMP_WIDTH ||
+            (has_price_ && (price.raw < 0 ||
+                            static_cast<uint64_t>(price.raw) >= MAX_PRICE_RAW))) [[unlikely]] {
+            return {};
+        }
+
+        char* buf = buffer_.data();
+        write_fixed_digits(buf + slots_[seq_num_].offset, seq_num, SEQ_NUM_WIDTH);
+        std::memcpy(buf + slots_[sending_time_].offset, timestamp.data(), TIMESTAMP_WIDTH);
+        write_fixed_digits(buf + slots_[cl_ord_id_].offset, cl_ord_id, CL_ORD_ID_DIGITS);
+        std::memcpy(buf + slots_[transact_time_].offset, timestamp.data(), TIMESTAMP_WIDTH);
+        write_fixed_digits(buf + slots_[qty_].offset,
+                                   static_cast<uint64_t>(whole_qty), QTY_WIDTH);
+        if (has_price_) {
+            write_decimal_fixed<PRICE_INTEGER_DIGITS, FixedPrice::DECIMAL_PLACES>(
+                buf + slots_[price_].offset, static_cast<uint64_t>(price.raw));
+        }
+
+        parser::IncrementalChecksum sum = static_sum_;
+        for (size_t i = 0; i < num_slots_; ++i) {
+            sum.update(buf + slots_[i].offset, slots_[i].width);
+        }
+        parser::format_checksum(sum.finalize(), buf + checksum_pos_);
+
+        return {buf, size_};
+    }
+
+    /// Last rendered message (template bytes before the first render)
+    [[nodiscard]] std::span<const char> data() const noexcept {
+        return {buffer_.data(), size_};
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool valid() const noexcept { return valid_; }
+
+private:
+    struct Slot {
+        size_t offset;
+        size_t width;
+    };
+
+    static constexpr size_t MAX_SLOTS = 6;
+
+    size_t add_slot(size_t offset, size_t width) noexcept {
+        slots_[num_slots_] = Slot{offset, width};
+        return num_slots_++;
+    }
+
+    std::array<char, MaxSize> buffer_{};
+    std::array<Slot, MAX_SLOTS> slots_{};
+    size_t num_slots_{0};
+    size_t seq_num_{0};
+    size_t sending_time_{0};
+    size_t cl_ord_id_{0};
+    size_t transact_time_{0};
+    size_t qty_{0};
+    size_t price_{0};
+    size_t size_{0};
+    size_t checksum_pos_{0};
+    parser::IncrementalChecksum static_sum_;
+    bool has_price_{false};
+    bool valid_{false};
+};
+
+} // namespace nfx::serializer
@@ -0,0 +1,663 @@
+/*
+    NexusFIX Acceptor Engine
+
+    Server side for many counterparties on one port. One acceptor thread
+    keeps a multishot accept armed on the listening socket; every new
+    connection is handed to a worker, one per core from a
+    util::SessionCoreMapper (round-robin: CompIDs are unknown until the
+    Logon arrives). Each worker runs its own IoUringReactor pinned to its
+    core and receives fds through an eventfd-backed SPSC queue, so accept
+    bursts never touch the workers' rings directly.
+
+        accept thread:  multishot accept -> next_core_round_robin() -> SPSC
+        worker (core):  attach(fd) -> Logon (35=A) -> CompIdIndex -> session
+
+    The first message on a connection must be a Logon. Its (TargetCompID,
+    SenderCompID) pair - our (sender, target) - is looked up in a
+    CompIdIndex built at setup, and the connection binds to that
+    pre-configured SessionManager. A session is bound to at most one
+    connection; a second Logon for it, an unknown pair, or no Logon within
+    logon_timeout_ms closes the connection. Sessions keep their sequence
+    numbers and stores across connections and may be bound by a different
+    worker next time; the bound flag hands them over (acquire/release).
+
+    Deadlines live on one util::TimerWheel per worker: the logon timeout of
+    each unbound connection and the heartbeat / test request timers of each
+    bound session. Idle sessions cost nothing per tick; only sessions with
+    coalesce_sends keep a reactor timer to flush their pending sends.
+
+    Every session owns a heap (memory::SessionHeap with mimalloc, else a
+    monotonic pmr resource) that backs its MemoryMessageStore, so one
+    session's resend history never shares pages with another's.
+
+    With hibernate_after_ms set, stores come from one shared
+    memory::HibernationPool instead. A session with no application
+    traffic for that long, or whose connection closes, hibernates: its
+    store ring, index and batches go back to the pool and the next
+    session to wake takes them, so resident memory follows the busy
+    sessions rather than the configured ones. Receive buffers are the
+    worker reactor's shared buffer ring either way.
+
+    An App with on_poll() is called once per worker-loop iteration for
+    each bound session, for work with deadlines finer than the wheel
+    (ExchangeSimulator releasing delayed reports). With busy_poll the
+    workers spin instead of sleeping up to timer_interval_ms.
+
+    Usage:
+        struct App {
+            void on_app_message(const ParsedMessage& msg) noexcept { ... }
+            void on_state_change(SessionState, SessionState) noexcept {}
+            void on_error(const SessionError&) noexcept {}
+            void on_logon() noexcept {}
+            void on_logout(std::string_view) noexcept {}
+        };
+
+        AcceptorEngine<App> engine{{.port = 9876}};
+        SessionConfig cfg;
+        cfg.sender_comp_id = "EXCH";
+        cfg.target_comp_id = "CLIENT1";
+        engine.add_session(cfg);            // Before start()
+        engine.start();
+        ...
+        engine.stop();
+*/
+
+#pragma once
+
+#include "nexusfix/memory/hibernation_pool.hpp"
+#include "nexusfix/memory/queue_notifier.hpp"
+#include "nexusfix/memory/session_heap.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/io_uring_reactor.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/timer_wheel.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// CompID Index
+// ============================================================================
+
+/// (SenderCompID, TargetCompID) -> session index, open addressing
+/// Filled at setup (insert() allocates the key strings); find() is
+/// allocation-free and safe from any thread once setup is done.
+/// @tparam MaxSessions Entries; the table is kept at most half full
+template <size_t MaxSessions = 1024>
+class CompIdIndex {
+    static_assert(MaxSessions > 0 && MaxSessions < UINT32_MAX, "MaxSessions must fit a 32-bit index");
+
+    static constexpr size_t TABLE_SIZE = std::bit_ceil(MaxSessions * 2);
+    static constexpr size_t TABLE_MASK = TABLE_SIZE - 1;
+
+public:
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+    CompIdIndex() = default;
+
+    CompIdIndex(const CompIdIndex&) = delete;
+    CompIdIndex& operator=(const CompIdIndex&) = delete;
+
+    /// @return false if the pair is already present or the index is full
+    bool insert(std::string_view sender, std::string_view target, uint32_t value) {
+        if (count_ == MaxSessions || value == NOT_FOUND) return false;
+
+        const uint64_t h = util::CpuAffinity::session_hash(sender, target);
+        size_t i = h & TABLE_MASK;
+        for (; entries_[i].used; i = (i + 1) & TABLE_MASK) {
+            if (matches(entries_[i], h, sender, target)) return false;
+        }
+
+        Entry& e = entries_[i];
+        e.hash = h;
+        e.sender.assign(sender);
+        e.target.assign(target);
+        e.value = value;
+        e.used = true;
+        ++count_;
+        return true;
+    }
+
+    /// Value stored for the pair, or NOT_FOUND
+    [[nodiscard]] uint32_t find(std::string_view sender, std::string_view target) const noexcept {
+        const uint64_t h = util::CpuAffinity::session_hash(sender, target);
+        for (size_t i = h & TABLE_MASK; entries_[i].used; i = (i + 1) & TABLE_MASK) {
+            if (matches(entries_[i], h, sender, target)) return entries_[i].value;
+        }
+        return NOT_FOUND;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSessions; }
+
+private:
+    struct Entry {
+        uint64_t hash{0};
+        std::string sender;
+        std::string target;
+        uint32_t value{NOT_FOUND};
+        bool used{false};
+    };
+
+    [[nodiscard]] static bool matches(const Entry& e, uint64_t h, std::string_view sender,
+                                      std::string_view target) noexcept {
+        return e.hash == h && e.sender == sender && e.target == target;
+    }
+
+    std::array<Entry, TABLE_SIZE> entries_{};
+    size_t count_{0};
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Acceptor Session Handler
+// ============================================================================
+
+/// Application callbacks for acceptor sessions (on_send is the engine's)
+template <typename T>
+concept AcceptorApp = HasOnAppMessage<T> &&
+                      HasOnStateChange<T> &&
+                      HasOnError<T> &&
+                      HasOnLogon<T> &&
+                      HasOnLogout<T>;
+
+/// Optional per-iteration hook of an AcceptorApp
+template <typename T>
+concept HasOnPoll = requires(T& app) {
+    { app.on_poll() } noexcept;
+};
+
+/// SessionHandler writing to whichever reactor channel the session is bound to
+template <AcceptorApp App>
+struct AcceptorSessionHandler {
+    App app;
+    IoUringReactor* reactor{nullptr};
+    IoUringReactor::ChannelId channel{IoUringReactor::INVALID_CHANNEL};
+
+    void on_app_message(const ParsedMessage& msg) noexcept { app.on_app_message(msg); }
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        app.on_state_change(from, to);
+        // Logout, heartbeat timeout, rejected Logon: drop the connection
+        if (reactor && is_connected(from) && !is_connected(to)) reactor->close(channel);
+    }
+    bool on_send(std::span<const char> data) noexcept {
+        return reactor && reactor->send(channel, data).has_value();
+    }
+    void on_error(const SessionError& err) noexcept { app.on_error(err); }
+    void on_logon() noexcept { app.on_logon(); }
+    void on_logout(std::string_view reason) noexcept { app.on_logout(reason); }
+};
+
+// ============================================================================
+// Engine Configuration
+// ============================================================================
+
+struct AcceptorEngineConfig {
+    uint16_t port{0};                      // 0 = ephemeral (see AcceptorEngine::port())
+    int backlog{1024};
+    bool dual_stack{true};                 // [::] accepting IPv4 and IPv6
+
+    /// One worker per allowed core; connections spread round-robin
+    util::CpuAffinityConfig cores{util::CpuAffinityConfig::default_config()};
+    bool pin_workers{true};
+
+    /// Ring and channel table of each worker
+    IoUringReactorConfig worker_reactor{};
+
+    uint32_t logon_timeout_ms{5000};       // Connection closed if no Logon binds it
+    uint32_t timer_interval_ms{100};       // Timer wheel tick; coalesced-send flush period
+    bool busy_poll{false};                 // Workers never sleep (App::on_poll deadlines)
+
+    /// Per session: heap size and the store's byte ring carved from it
+    size_t session_heap_size{4 * 1024 * 1024};
+    size_t store_pool_size{1024 * 1024};
+    size_t store_max_messages{10000};
+
+    /// Hibernate sessions idle this long (0 = never; see SessionManager::hibernate)
+    uint32_t hibernate_after_ms{0};
+    size_t hibernation_cache_bytes{256 * 1024 * 1024};   // Freed blocks the shared pool keeps
+};
+
+/// Engine counters (any thread)
+struct AcceptorEngineStats {
+    std::atomic<uint64_t> accepted{0};         // Connections handed to workers
+    std::atomic<uint64_t> bound{0};            // Logons routed to a session
+    std::atomic<uint64_t> rejected{0};         // Unknown CompIDs, duplicate binds, non-Logon first message
+    std::atomic<uint64_t> logon_timeouts{0};
+    std::atomic<uint64_t> dropped{0};          // Worker inbox full or channel table exhausted
+};
+
+// ============================================================================
+// Acceptor Engine
+// ============================================================================
+
+/// Multi-session FIX acceptor over per-core io_uring reactors
+/// @tparam App Application callbacks, one instance per session
+/// @tparam MaxSessions Sessions add_session() accepts
+template <AcceptorApp App, size_t MaxSessions = 1024>
+class AcceptorEngine {
+public:
+    using Handler = AcceptorSessionHandler<App>;
+    using Session = SessionManager<Handler>;
+
+    explicit AcceptorEngine(AcceptorEngineConfig config = {})
+        : config_{std::move(config)}
+        , mapper_{config_.cores}
+        , hibernation_pool_{{.max_cached_bytes = config_.hibernation_cache_bytes}} {}
+
+    ~AcceptorEngine() { stop(); }
+
+    AcceptorEngine(const AcceptorEngine&) = delete;
+    AcceptorEngine& operator=(const AcceptorEngine&) = delete;
+
+    // ========================================================================
+    // Setup
+    // ========================================================================
+
+    /// Register a counterparty (before start())
+    /// The CompIDs are copied; config's other string_views must outlive
+    /// the engine.
+    /// @return nullptr if the pair is already registered or the engine is full
+    Session* add_session(const SessionConfig& config, App app = App{}) {
+        if (running_ || sessions_.size() == MaxSessions) return nullptr;
+
+        auto slot = std::make_unique<SessionSlot>();
+        slot->sender.assign(config.sender_comp_id);
+        slot->target.assign(config.target_comp_id);
+        if (!index_.insert(slot->sender, slot->target, static_cast<uint32_t>(sessions_.size()))) {
+            return nullptr;
+        }
+
+        // Hibernating stores hand their blocks back: a monotonic heap would keep them
+        const bool hibernates = config_.hibernate_after_ms != 0;
+        if (!hibernates) {
+            slot->heap = memory::make_session_heap(config_.session_heap_size, config_.cores.numa_node);
+        }
+        slot->store = std::make_unique<store::MemoryMessageStore>(store::MemoryMessageStore::Config{
+            .session_id = slot->sender + "->" + slot->target,
+            .max_messages = config_.store_max_messages,
+            .pool_size_bytes = config_.store_pool_size,
+            .upstream_resource = hibernates ? &hibernation_pool_ : slot->heap.get(),
+            .single_writer = true,
+        });
+
+        SessionConfig owned = config;
+        owned.sender_comp_id = slot->sender;
+        owned.target_comp_id = slot->target;
+        if (hibernates && owned.hibernate_after_ms == 0) {
+            owned.hibernate_after_ms = config_.hibernate_after_ms;
+        }
+        slot->session = std::make_unique<Session>(owned, Handler{std::move(app)});
+        slot->session->set_message_store(slot->store.get());
+
+        Session* session = slot->session.get();
+        sessions_.push_back(std::move(slot));
+        return session;
+    }
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Listen, start one worker per allowed core, then the acceptor thread
+    [[nodiscard]] TransportResult<void> start() {
+        if (running_) return {};
+        if (mapper_.config().allowed_cores.empty()) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+        if (auto result = listener_.listen(config_.port, config_.backlog, config_.dual_stack);
+            !result) {
+            return result;
+        }
+
+        stop_.store(false, std::memory_order_relaxed);
+        const auto& cores = mapper_.config().allowed_cores;
+        workers_.reserve(cores.size());
+        for (int core : cores) workers_.push_back(std::make_unique<Worker>(*this, core));
+
+        // Rings are SINGLE_ISSUER: each one is created on the thread that drives it
+        std::latch ready{static_cast<std::ptrdiff_t>(workers_.size() + 1)};
+        for (auto& worker : workers_) {
+            worker->thread = std::thread([this, w = worker.get(), &ready] { worker_main(*w, ready); });
+        }
+        acceptor_thread_ = std::thread([this, &ready] { acceptor_main(ready); });
+        ready.wait();
+
+        running_ = true;
+        if (auto error = start_error()) {
+            stop();
+            return std::unexpected{*error};
+        }
+        return {};
+    }
+
+    /// Stop accepting, close every connection and join all threads
+    void stop() noexcept {
+        if (!running_) return;
+        stop_.store(true, std::memory_order_relaxed);
+        if (acceptor_thread_.joinable()) acceptor_thread_.join();
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        for (auto& worker : workers_) {
+            int fd;
+            while (worker->inbox.try_pop(fd)) ::close(fd);
+        }
+        // Threads are joined: unbind here, while the workers' wheels still exist
+        for (auto& slot : sessions_) {
+            if (slot->bound.load(std::memory_order_relaxed)) {
+                slot->session->handler().reactor = nullptr;
+                slot->session->on_disconnect();
+                slot->session->set_timer_wheel(nullptr);
+                slot->bound.store(false, std::memory_order_relaxed);
+            }
+        }
+        workers_.clear();  // Reactors close their channels
+        listener_.close();
+        running_ = false;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /// Port being listened on (resolves config port 0)
+    [[nodiscard]] uint16_t port() const noexcept { return listener_.local_port(); }
+
+    [[nodiscard]] size_t session_count() const noexcept { return sessions_.size(); }
+    [[nodiscard]] size_t worker_count() const noexcept { return workers_.size(); }
+    [[nodiscard]] bool is_running() const noexcept { return running_; }
+
+    /// Session registered for (our sender, our target), or nullptr
+    /// Owned by a worker thread while bound.
+    [[nodiscard]] Session* find_session(std::string_view sender, std::string_view target) noexcept {
+        const uint32_t i = index_.find(sender, target);
+        return i == CompIdIndex<MaxSessions>::NOT_FOUND ? nullptr : sessions_[i]->session.get();
+    }
+
+    [[nodiscard]] const AcceptorEngineStats& stats() const noexcept { return stats_; }
+
+    /// Shared home of hibernated sessions' store blocks (hibernate_after_ms)
+    [[nodiscard]] const memory::HibernationPool& hibernation_pool() const noexcept {
+        return hibernation_pool_;
+    }
+    [[nodiscard]] const AcceptorEngineConfig& config() const noexcept { return config_; }
+
+private:
+    static constexpr size_t INBOX_CAPACITY = 1024;
+    using FdInbox = memory::NotifyingQueue<memory::SPSCQueue<int, INBOX_CAPACITY>>;
+    using ChannelId = IoUringReactor::ChannelId;
+
+    struct SessionSlot {
+        std::string sender;
+        std::string target;
+        std::unique_ptr<std::pmr::memory_resource> heap;
+        std::unique_ptr<store::MemoryMessageStore> store;
+        std::unique_ptr<Session> session;
+        std::atomic<bool> bound{false};     // Claimed by a connection
+    };
+
+    struct Worker;
+
+    /// One accepted socket on a worker; binds to a session at Logon
+    class Connection final : public IReactorHandler {
+    public:
+        Connection(AcceptorEngine& engine, Worker& worker) noexcept
+            : engine_{engine}, worker_{worker}, logon_timer_{&on_logon_deadline, this} {}
+
+        void open(ChannelId channel) noexcept {
+            channel_ = channel;
+            closing_ = false;
+            worker_.wheel.schedule_after(logon_timer_,
+                                         std::chrono::milliseconds{engine_.config_.logon_timeout_ms});
+        }
+
+        void on_connected() noexcept override {}
+
+        void on_message(std::span<const char> message) noexcept override {
+            if (closing_) return;
+            if (!slot_) {
+                if (!bind(message)) close();
+                return;
+            }
+            slot_->session->on_data_received(message);
+        }
+
+        void on_receive_complete() noexcept override {
+            if (slot_) slot_->session->end_receive_batch();
+        }
+
+        /// App::on_poll of the bound session, every worker-loop iteration
+        void poll() noexcept requires HasOnPoll<App> {
+            if (!closing_ && slot_) slot_->session->handler().app.on_poll();
+        }
+
+        /// Coalesced-send flush (armed only for sessions with coalesce_sends)
+        void on_timer() noexcept override {
+            if (!closing_ && slot_) slot_->session->on_timer_tick();
+        }
+
+        void on_closed(const TransportError&) noexcept override {
+            worker_.wheel.cancel(logon_timer_);
+            if (slot_) {
+                Session& session = *slot_->session;
+                // The channel is gone: detach before the state change would close it
+                session.handler().reactor = nullptr;
+                session.handler().channel = IoUringReactor::INVALID_CHANNEL;
+                session.on_disconnect();
+                session.set_timer_wheel(nullptr);
+                if (session.config().hibernate_after_ms != 0) (void)session.hibernate();
+                slot_->bound.store(false, std::memory_order_release);
+                slot_ = nullptr;
+            }
+            channel_ = IoUringReactor::INVALID_CHANNEL;
+            worker_.free_connections.push_back(this);
+        }
+
+    private:
+        /// Route the Logon to its session; false rejects the connection
+        bool bind(std::span<const char> message) noexcept {
+            auto parsed = ParsedMessage::parse(message);
+            if (!parsed || parsed->msg_type() != 'A') {
+                engine_.stats_.rejected.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            // Their target is our sender
+            const uint32_t i = engine_.index_.find(parsed->target_comp_id(),
+                                                   parsed->sender_comp_id());
+            if (i == CompIdIndex<MaxSessions>::NOT_FOUND ||
+                engine_.sessions_[i]->bound.exchange(true, std::memory_order_acq_rel)) {
+                engine_.stats_.rejected.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            slot_ = engine_.sessions_[i].get();
+            engine_.stats_.bound.fetch_add(1, std::memory_order_relaxed);
+            worker_.wheel.cancel(logon_timer_);
+            Session& session = *slot_->session;
+            session.handler().reactor = &worker_.reactor;
+            session.handler().channel = channel_;
+            session.set_timer_wheel(&worker_.wheel);
+            if (session.config().coalesce_sends) {
+                worker_.reactor.set_timer(channel_, engine_.config_.timer_interval_ms);
+            }
+            session.on_connect();
+            session.on_data_received(message);
+            return true;
+        }
+
+        static void on_logon_deadline(void* context) noexcept {
+            auto& self = *static_cast<Connection*>(context);
+            if (self.closing_ || self.slot_) return;
+            self.engine_.stats_.logon_timeouts.fetch_add(1, std::memory_order_relaxed);
+            self.close();
+        }
+
+        void close() noexcept {
+            closing_ = true;
+            worker_.reactor.close(channel_);
+        }
+
+        AcceptorEngine& engine_;
+        Worker& worker_;
+        SessionSlot* slot_{nullptr};
+        ChannelId channel_{IoUringReactor::INVALID_CHANNEL};
+        util::TimerNode logon_timer_;
+        bool closing_{false};
+    };
+
+    /// Reactor, inbox and connection pool of one core
+    struct Worker final : INotifierHandler {
+        Worker(AcceptorEngine& e, int c)
+            : engine{e}, core{c}, reactor{e.config_.worker_reactor}
+            , wheel{std::chrono::milliseconds{e.config_.timer_interval_ms}} {
+            const uint32_t n = e.config_.worker_reactor.max_channels;
+            connections.reserve(n);
+            free_connections.reserve(n);
+            for (uint32_t i = 0; i < n; ++i) {
+                connections.push_back(std::make_unique<Connection>(e, *this));
+                free_connections.push_back(connections.back().get());
+            }
+        }
+
+        /// Adopt every fd the acceptor queued
+        void on_notified() noexcept override {
+            int fd;
+            while (inbox.try_pop(fd)) {
+                if (free_connections.empty()) {
+                    ::close(fd);
+                    engine.stats_.dropped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                Connection* conn = free_connections.back();
+                auto channel = reactor.attach(fd, *conn);
+                if (!channel) {
+                    ::close(fd);
+                    engine.stats_.dropped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                free_connections.pop_back();
+                conn->open(*channel);
+            }
+        }
+
+        AcceptorEngine& engine;
+        int core;
+        IoUringReactor reactor;
+        util::TimerWheel wheel;              // Logon timeouts and session deadlines
+        FdInbox inbox{memory::QueueNotifier::Mode::EventFd};
+        std::vector<std::unique_ptr<Connection>> connections;
+        std::vector<Connection*> free_connections;
+        std::thread thread;
+        std::optional<TransportError> error;   // Set by the thread before start() resumes
+    };
+
+    /// Multishot accept -> worker inbox
+    struct AcceptHandler final : IAcceptHandler {
+        explicit AcceptHandler(AcceptorEngine& e) noexcept : engine{e} {}
+
+        void on_accept(int fd) noexcept override {
+            Worker* worker = engine.worker_for_core(engine.mapper_.next_core_round_robin());
+            if (!worker || !worker->inbox.try_push(fd)) {
+                ::close(fd);
+                engine.stats_.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            engine.stats_.accepted.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        AcceptorEngine& engine;
+    };
+
+    // ========================================================================
+    // Threads
+    // ========================================================================
+
+    void worker_main(Worker& worker, std::latch& ready) noexcept {
+        if (config_.pin_workers) (void)util::CpuAffinity::pin_to_core(worker.core);
+        auto result = worker.reactor.init();
+        if (result) result = worker.reactor.watch_notifier(worker.inbox.notifier(), worker);
+        if (!result) worker.error = result.error();
+        ready.count_down();
+        if (!result) return;
+
+        // Wake at least once per wheel tick; the wheel reads the clock once per loop
+        const int wait_ms = config_.busy_poll ? 0 : static_cast<int>(config_.timer_interval_ms);
+        while (!stop_.load(std::memory_order_relaxed)) {
+            (void)worker.reactor.run_once(wait_ms);
+            worker.wheel.advance(util::TimerWheel::Clock::now());
+            if constexpr (HasOnPoll<App>) {
+                for (auto& connection : worker.connections) connection->poll();
+            }
+        }
+    }
+
+    void acceptor_main(std::latch& ready) noexcept {
+        // The accept ring only needs a minimal receive buffer group
+        IoUringReactor reactor{IoUringReactorConfig{
+            .queue_depth = 64,
+            .max_channels = 1,
+            .num_recv_buffers = 8,
+            .recv_buffer_size = 256,
+        }};
+        AcceptHandler handler{*this};
+        auto result = reactor.init();
+        if (result) result = reactor.accept_on(listener_.fd(), handler);
+        if (!result) acceptor_error_ = result.error();
+        ready.count_down();
+        if (!result) return;
+
+        reactor.run(stop_);
+    }
+
+    [[nodiscard]] std::optional<TransportError> start_error() const noexcept {
+        if (acceptor_error_) return acceptor_error_;
+        for (const auto& worker : workers_) {
+            if (worker->error) return worker->error;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] Worker* worker_for_core(int core) noexcept {
+        for (auto& worker : workers_) {
+            if (worker->core == core) return worker.get();
+        }
+        return nullptr;
+    }
+
+    AcceptorEngineConfig config_;
+    util::SessionCoreMapper mapper_;
+    CompIdIndex<MaxSessions> index_;
+    memory::HibernationPool hibernation_pool_;   // Outlives the stores using it
+    std::vector<std::unique_ptr<SessionSlot>> sessions_;
+
+    TcpAcceptor listener_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::thread acceptor_thread_;
+    std::atomic<bool> stop_{false};
+    bool running_{false};
+    std::optional<TransportError> acceptor_error_;
+
+    AcceptorEngineStats stats_;
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+}  // namespace nfx
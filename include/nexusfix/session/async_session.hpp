@@ -0,0 +1,359 @@
+/*
+    NexusFIX Async Session
+
+    Coroutine front end for SessionManager: order workflows written as
+    straight-line code instead of callback state machines.
+
+        Task<void> trade(AsyncSession<App>& s) {
+            auto sent = co_await s.send(order);          // Waits for logon
+            if (!sent) co_return;
+            const ParsedMessage* er = co_await s.next_execution("ORD1");
+            if (!er) co_return;                          // Session lost
+            ...
+        }
+
+    Nothing here runs a loop of its own. Awaiting coroutines are resumed
+    inline from the session callbacks - on_logon() for send(), the typed
+    ExecutionReport hook for next_execution() - which in turn run inside
+    on_data_received(), i.e. on the io_uring completion that delivered
+    the bytes (see transport/async_channel.hpp and pump()).
+
+    Awaiters are intrusive: a suspended send() or next_execution() links
+    its own awaiter (part of the coroutine frame) into a wait list, so an
+    await costs no allocation. Frames come from CoroutineFramePool.
+
+    A message handed to next_execution() is the session's parsed view:
+    valid until the coroutine next suspends. ExecutionReports claimed by a
+    waiter are not passed on to the inner handler; the others are. Waiters
+    are failed (send: NotConnected, next_execution: nullptr) when the
+    session leaves a connected state or enters Error.
+
+    Usage:
+        AsyncSession<App> session{config, App{&channel}};
+        auto task = trade(session);
+        task.resume();                  // Runs to its first co_await
+        session.session().on_connect();
+        (void)session.session().initiate_logon();
+        ...                             // Inbound traffic resumes it
+*/
+
+#pragma once
+
+#include <coroutine>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/session/session_handler.hpp"
+#include "nexusfix/session/session_manager.hpp"
+
+namespace nfx {
+
+namespace detail {
+
+// ============================================================================
+// Intrusive Wait List
+// ============================================================================
+
+/// A suspended coroutine linked into an AsyncWaitList; unlinks on destruction
+class AsyncWaiter {
+public:
+    AsyncWaiter() noexcept = default;
+    ~AsyncWaiter() { unlink(); }
+
+    // Linked by address
+    AsyncWaiter(const AsyncWaiter&) = delete;
+    AsyncWaiter& operator=(const AsyncWaiter&) = delete;
+
+    [[nodiscard]] bool linked() const noexcept { return next_ != nullptr; }
+
+    std::coroutine_handle<> handle{};
+    std::string_view key{};                  // ClOrdID awaited (executions)
+    const ParsedMessage* message{nullptr};   // Set when woken by a match
+    bool failed{false};                      // Set when woken by session loss
+
+private:
+    friend class AsyncWaitList;
+
+    void unlink() noexcept {
+        if (!next_) return;
+        prev_->next_ = next_;
+        next_->prev_ = prev_;
+        prev_ = next_ = nullptr;
+    }
+
+    AsyncWaiter* prev_{nullptr};
+    AsyncWaiter* next_{nullptr};
+};
+
+/// FIFO of waiters around a sentinel
+class AsyncWaitList {
+public:
+    AsyncWaitList() noexcept { head_.prev_ = head_.next_ = &head_; }
+
+    ~AsyncWaitList() {
+        while (!empty()) head_.next_->unlink();
+        head_.prev_ = head_.next_ = nullptr;
+    }
+
+    AsyncWaitList(const AsyncWaitList&) = delete;
+    AsyncWaitList& operator=(const AsyncWaitList&) = delete;
+
+    void push(AsyncWaiter& waiter) noexcept {
+        waiter.prev_ = head_.prev_;
+        waiter.next_ = &head_;
+        head_.prev_->next_ = &waiter;
+        head_.prev_ = &waiter;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return head_.next_ == &head_; }
+
+    /// Oldest waiter awaiting key, or nullptr
+    [[nodiscard]] AsyncWaiter* find(std::string_view key) noexcept {
+        for (AsyncWaiter* w = head_.next_; w != &head_; w = w->next_) {
+            if (w->key == key) return w;
+        }
+        return nullptr;
+    }
+
+    /// Unlink waiter and resume it
+    static void wake(AsyncWaiter& waiter) noexcept {
+        waiter.unlink();
+        waiter.handle.resume();
+    }
+
+    /// Resume every waiter linked now, oldest first
+    /// The list is detached first: waiters that re-await land in this list
+    /// again and are left for the next wake.
+    void wake_all(bool failed) noexcept {
+        if (empty()) return;
+        AsyncWaiter pending;
+        pending.next_ = head_.next_;
+        pending.prev_ = head_.prev_;
+        pending.next_->prev_ = &pending;
+        pending.prev_->next_ = &pending;
+        head_.prev_ = head_.next_ = &head_;
+
+        while (pending.next_ != &pending) {
+            AsyncWaiter& waiter = *pending.next_;
+            waiter.failed = failed;
+            wake(waiter);
+        }
+        pending.prev_ = pending.next_ = nullptr;
+    }
+
+private:
+    AsyncWaiter head_;
+};
+
+/// Wait lists of one AsyncSession
+struct AsyncSessionWaiters {
+    AsyncWaitList logon;        // send() before Active
+    AsyncWaitList executions;   // next_execution()
+};
+
+} // namespace detail
+
+// ============================================================================
+// Async Session Handler
+// ============================================================================
+
+/// Resumes AsyncSession awaiters, forwards everything to Inner
+template <SessionHandler Inner>
+struct AsyncSessionHandler {
+    Inner inner;
+    detail::AsyncSessionWaiters* waiters{nullptr};
+
+    void on_app_message(const ParsedMessage& msg) noexcept { inner.on_app_message(msg); }
+
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        inner.on_state_change(from, to);
+        if ((is_connected(from) && !is_connected(to)) || to == SessionState::Error) {
+            waiters->logon.wake_all(true);
+            waiters->executions.wake_all(true);
+        }
+    }
+
+    bool on_send(std::span<const char> data) noexcept { return inner.on_send(data); }
+    void on_error(const SessionError& err) noexcept { inner.on_error(err); }
+
+    void on_logon() noexcept {
+        inner.on_logon();
+        waiters->logon.wake_all(false);
+    }
+
+    void on_logout(std::string_view reason) noexcept { inner.on_logout(reason); }
+
+    /// ExecutionReport: the oldest next_execution() on its ClOrdID(11)
+    void on_message(MsgTypeTag<'8'> tag, const ParsedMessage& msg) noexcept {
+        if (auto* waiter = waiters->executions.find(msg.get_string(11))) {
+            waiter->message = &msg;
+            detail::AsyncWaitList::wake(*waiter);
+            return;
+        }
+        if constexpr (HasOnMsgType<Inner, '8'>) inner.on_message(tag, msg);
+        else inner.on_app_message(msg);
+    }
+
+    /// Inner's other typed hooks
+    template <char... Chars>
+        requires HasOnMsgType<Inner, Chars...>
+    void on_message(MsgTypeTag<Chars...> tag, const ParsedMessage& msg) noexcept {
+        inner.on_message(tag, msg);
+    }
+
+    std::span<char> acquire_send_buffer() noexcept
+        requires HasSendBuffer<Inner>
+    {
+        return inner.acquire_send_buffer();
+    }
+
+    bool on_send_batch(std::span<const std::span<const char>> batch) noexcept
+        requires HasOnSendBatch<Inner>
+    {
+        return inner.on_send_batch(batch);
+    }
+
+    bool should_resend(std::span<const char> stored) noexcept
+        requires HasResendFilter<Inner>
+    {
+        return inner.should_resend(stored);
+    }
+
+    void bind_inbound_arena(memory::InboundArena& arena) noexcept
+        requires HasInboundArena<Inner>
+    {
+        inner.bind_inbound_arena(arena);
+    }
+};
+
+// ============================================================================
+// Async Session
+// ============================================================================
+
+/// SessionManager with awaitable send() and next_execution()
+/// Single-threaded: awaits, resumes and session calls all happen on the
+/// thread that feeds the session.
+template <SessionHandler Inner = NullSessionHandler>
+class AsyncSession {
+public:
+    using Handler = AsyncSessionHandler<Inner>;
+
+    explicit AsyncSession(const SessionConfig& config, Inner inner = Inner{}) noexcept
+        : session_{config, Handler{std::move(inner), &waiters_}} {}
+
+    AsyncSession(const AsyncSession&) = delete;
+    AsyncSession& operator=(const AsyncSession&) = delete;
+
+    // ========================================================================
+    // Awaitables
+    // ========================================================================
+
+    template <typename MsgBuilder>
+    struct SendAwaiter {
+        AsyncSession& self;
+        MsgBuilder& builder;
+        bool urgent;
+        detail::AsyncWaiter waiter{};
+
+        bool await_ready() const noexcept { return !should_wait(self.session_.state()); }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            waiter.handle = h;
+            self.waiters_.logon.push(waiter);
+        }
+
+        SessionResult<void> await_resume() noexcept {
+            if (waiter.failed || !can_send_app_messages(self.session_.state())) {
+                return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+            }
+            return self.session_.send_app_message(builder, urgent);
+        }
+
+        /// Not yet logged on, but on the way
+        static constexpr bool should_wait(SessionState state) noexcept {
+            switch (state) {
+                case SessionState::Disconnected:
+                case SessionState::SocketConnected:
+                case SessionState::LogonSent:
+                case SessionState::LogonReceived:
+                case SessionState::Reconnecting:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    };
+
+    /// co_await: send once the session is Active
+    /// The builder must stay alive until the await completes.
+    /// @return send_app_message()'s result, or NotConnected if the session
+    ///         is logging out, in error or lost before logon
+    template <typename MsgBuilder>
+    [[nodiscard]] SendAwaiter<MsgBuilder> send(MsgBuilder& builder, bool urgent = false) noexcept {
+        return SendAwaiter<MsgBuilder>{*this, builder, urgent};
+    }
+
+    struct ExecutionAwaiter {
+        AsyncSession& self;
+        std::string_view cl_ord_id;
+        detail::AsyncWaiter waiter{};
+
+        bool await_ready() const noexcept { return self.session_.state() == SessionState::Error; }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            waiter.handle = h;
+            waiter.key = cl_ord_id;
+            self.waiters_.executions.push(waiter);
+        }
+
+        const ParsedMessage* await_resume() const noexcept { return waiter.message; }
+    };
+
+    /// co_await: next ExecutionReport for cl_ord_id
+    /// @param cl_ord_id Must stay alive until the await completes
+    /// @return The report (valid until the coroutine next suspends), or
+    ///         nullptr if the session was lost first
+    [[nodiscard]] ExecutionAwaiter next_execution(std::string_view cl_ord_id) noexcept {
+        return ExecutionAwaiter{*this, cl_ord_id};
+    }
+
+    /// Feed the session from an awaitable channel until it closes
+    /// Channel: co_await recv() yields one message (empty = closed) and
+    /// pending() counts messages already buffered; see AsyncChannel.
+    template <typename Channel>
+    Task<void> pump(Channel& channel) {
+        for (;;) {
+            std::span<const char> data = co_await channel.recv();
+            if (data.empty()) break;
+            session_.on_data_received(data);
+            if (channel.pending() == 0) session_.end_receive_batch();
+        }
+        session_.end_receive_batch();
+        session_.on_disconnect();
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] SessionManager<Handler>& session() noexcept { return session_; }
+    [[nodiscard]] const SessionManager<Handler>& session() const noexcept { return session_; }
+    [[nodiscard]] Inner& inner() noexcept { return session_.handler().inner; }
+
+    [[nodiscard]] bool logged_on() const noexcept {
+        return session_.state() == SessionState::Active;
+    }
+
+    /// Coroutines suspended in send() / next_execution()
+    [[nodiscard]] bool has_waiters() const noexcept {
+        return !waiters_.logon.empty() || !waiters_.executions.empty();
+    }
+
+private:
+    detail::AsyncSessionWaiters waiters_;   // Before session_: its handler points here
+    SessionManager<Handler> session_;
+};
+
+} // namespace nfx
@@ -6,6 +6,7 @@
 #include <exception>
 #include <utility>
 
+#include "nexusfix/memory/coroutine_frame_pool.hpp"
 #include "nexusfix/types/error.hpp"
 
 namespace nfx {
@@ -26,6 +27,14 @@ public:
         std::exception_ptr exception;
         std::coroutine_handle<> continuation;
 
+        // Frames come from the per-thread pool, not the global heap
+        static void* operator new(std::size_t size) {
+            return memory::CoroutineFramePool::allocate(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept {
+            memory::CoroutineFramePool::deallocate(p, size);
+        }
+
         Task get_return_object() noexcept {
             return Task{handle_type::from_promise(*this)};
         }
@@ -149,6 +158,14 @@ public:
         std::exception_ptr exception;
         std::coroutine_handle<> continuation;
 
+        // Frames come from the per-thread pool, not the global heap
+        static void* operator new(std::size_t size) {
+            return memory::CoroutineFramePool::allocate(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept {
+            memory::CoroutineFramePool::deallocate(p, size);
+        }
+
         Task get_return_object() noexcept {
             return Task{handle_type::from_promise(*this)};
         }
@@ -256,6 +273,14 @@ public:
         T current_value;
         std::exception_ptr exception;
 
+        // Frames come from the per-thread pool, not the global heap
+        static void* operator new(std::size_t size) {
+            return memory::CoroutineFramePool::allocate(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept {
+            memory::CoroutineFramePool::deallocate(p, size);
+        }
+
         Generator get_return_object() noexcept {
             return Generator{handle_type::from_promise(*this)};
         }
@@ -0,0 +1,214 @@
+/*
+    NexusFIX Duplicate Filter
+
+    After a reconnect a venue resends execution reports it is not sure we
+    got, flagged PossDupFlag(43)=Y; a client resends orders flagged
+    PossResend(97)=Y. Handlers must not book them twice, but an
+    unordered_set<std::string> of every ExecID grows for the whole
+    session and allocates per message.
+
+    DuplicateFilter remembers the last `window` keys exactly, in memory
+    allocated once at construction:
+
+        ring    window slots of {hash, size, key bytes}, oldest overwritten
+        index   open addressing (linear probing, at most half full) from
+                the key's hash to its ring slot; evicted keys are removed
+                by backward shift, so there are no tombstones
+
+    check_and_insert() is one hash of the key and a probe or two; nothing
+    allocates after construction. Keys longer than MAX_KEY_SIZE are
+    compared on their first MAX_KEY_SIZE bytes, length and 64-bit hash.
+
+    SessionManager uses one per session with SessionConfig::duplicate_window:
+    every ExecutionReport's ExecID and every order's ClOrdID is recorded,
+    and a PossDup / PossResend message whose key is already in the window
+    is dropped before dispatch (SessionStats::duplicates_dropped).
+
+    Usage:
+        DuplicateFilter seen{1 << 20};
+        if (seen.check_and_insert(report.get_string(tag::ExecID::value))) return;
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Duplicate Filter
+// ============================================================================
+
+struct DuplicateFilterStats {
+    uint64_t inserts{0};
+    uint64_t hits{0};        // check_and_insert() calls that found the key
+    uint64_t evictions{0};   // Keys dropped from the window
+};
+
+/// Exact set of the last `window` keys, allocation-free after construction
+class DuplicateFilter {
+public:
+    static constexpr size_t MAX_KEY_SIZE = 52;           // Slots are 64 bytes
+    static constexpr size_t MAX_WINDOW = size_t{1} << 30;
+
+    /// @param window Keys remembered (1 to MAX_WINDOW)
+    explicit DuplicateFilter(size_t window)
+        : window_{std::clamp<size_t>(window, 1, MAX_WINDOW)}
+        , mask_{std::bit_ceil(window_ * 2) - 1}
+        , ring_{std::make_unique<Slot[]>(window_)}
+        , index_{std::make_unique<uint64_t[]>(mask_ + 1)} {}
+
+    DuplicateFilter(const DuplicateFilter&) = delete;
+    DuplicateFilter& operator=(const DuplicateFilter&) = delete;
+    DuplicateFilter(DuplicateFilter&&) noexcept = default;
+    DuplicateFilter& operator=(DuplicateFilter&&) noexcept = default;
+
+    /// Record key
+    /// @return true if key was already in the window (not recorded again)
+    NFX_HOT bool check_and_insert(std::string_view key) noexcept {
+        const uint64_t h = hash(key);
+        if (find(key, h) != NOT_FOUND) {
+            ++stats_.hits;
+            return true;
+        }
+        insert(key, h);
+        return false;
+    }
+
+    [[nodiscard]] bool contains(std::string_view key) const noexcept {
+        return find(key, hash(key)) != NOT_FOUND;
+    }
+
+    /// Forget every key
+    void clear() noexcept {
+        std::fill_n(index_.get(), mask_ + 1, uint64_t{0});
+        head_ = 0;
+        count_ = 0;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] size_t window() const noexcept { return window_; }
+    [[nodiscard]] const DuplicateFilterStats& stats() const noexcept { return stats_; }
+
+private:
+    struct Slot {
+        uint64_t hash;
+        uint32_t size;
+        char key[MAX_KEY_SIZE];
+    };
+    static_assert(sizeof(Slot) == 64);
+
+    static constexpr size_t NOT_FOUND = SIZE_MAX;
+
+    /// FNV-1a with the high half folded in: FNV's low bits see only the
+    /// low bits of each byte, and the index is addressed by them
+    [[nodiscard]] static uint64_t hash(std::string_view key) noexcept {
+        const uint64_t h = util::fnv1a_hash64_runtime(key);
+        return h ^ (h >> 32);
+    }
+
+    // Index entry: low 32 bits of the hash, then ring slot + 1 (0 = empty)
+    [[nodiscard]] static uint64_t entry(uint64_t h, size_t slot) noexcept {
+        return (h << 32) | (slot + 1);
+    }
+    [[nodiscard]] static size_t entry_slot(uint64_t e) noexcept {
+        return static_cast<size_t>(e & 0xFFFFFFFF) - 1;
+    }
+    [[nodiscard]] size_t home(uint64_t h) const noexcept { return h & mask_; }
+
+    /// Index position of key, or NOT_FOUND
+    [[nodiscard]] size_t find(std::string_view key, uint64_t h) const noexcept {
+        const uint32_t tag = static_cast<uint32_t>(h);
+        for (size_t i = home(h); index_[i] != 0; i = (i + 1) & mask_) {
+            const uint64_t e = index_[i];
+            if (static_cast<uint32_t>(e >> 32) != tag) continue;
+            const Slot& slot = ring_[entry_slot(e)];
+            if (slot.hash == h && slot.size == key.size() &&
+                std::memcmp(slot.key, key.data(), std::min(key.size(), MAX_KEY_SIZE)) == 0) {
+                return i;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    void insert(std::string_view key, uint64_t h) noexcept {
+        if (count_ == window_) evict(head_);
+
+        Slot& slot = ring_[head_];
+        slot.hash = h;
+        slot.size = static_cast<uint32_t>(key.size());
+        std::memcpy(slot.key, key.data(), std::min(key.size(), MAX_KEY_SIZE));
+
+        size_t i = home(h);
+        while (index_[i] != 0) i = (i + 1) & mask_;
+        index_[i] = entry(h, head_);
+
+        head_ = head_ + 1 == window_ ? 0 : head_ + 1;
+        if (count_ < window_) ++count_;
+        ++stats_.inserts;
+    }
+
+    /// Remove the index entry of ring slot `slot`
+    void evict(size_t slot) noexcept {
+        size_t hole = home(ring_[slot].hash);
+        while (entry_slot(index_[hole]) != slot) hole = (hole + 1) & mask_;
+
+        // Backward shift: pull later entries of the cluster into the hole
+        // when the hole lies between their home and where they sit
+        for (size_t j = (hole + 1) & mask_; index_[j] != 0; j = (j + 1) & mask_) {
+            const size_t j_home = home(index_[j] >> 32);
+            if (((j - j_home) & mask_) >= ((j - hole) & mask_)) {
+                index_[hole] = index_[j];
+                hole = j;
+            }
+        }
+        index_[hole] = 0;
+        ++stats_.evictions;
+    }
+
+    size_t window_;
+    size_t mask_;
+    std::unique_ptr<Slot[]> ring_;
+    std::unique_ptr<uint64_t[]> index_;
+    size_t head_{0};    // Next slot written; the oldest once full
+    size_t count_{0};
+    DuplicateFilterStats stats_;
+};
+
+// ============================================================================
+// Session Keys
+// ============================================================================
+
+/// Key a resent message is recognised by: ExecID(17) of an ExecutionReport,
+/// ClOrdID(11) of a NewOrderSingle, cancel or replace; empty for others
+[[nodiscard]] inline std::string_view duplicate_key(const ParsedMessage& msg) noexcept {
+    const std::string_view type = msg.get_string(tag::MsgType::value);
+    if (type.size() != 1) return {};
+    switch (type[0]) {
+        case '8':
+            return msg.get_string(tag::ExecID::value);
+        case 'D': case 'F': case 'G':
+            return msg.get_string(tag::ClOrdID::value);
+        default:
+            return {};
+    }
+}
+
+/// PossDupFlag(43) or PossResend(97) set
+[[nodiscard]] inline bool is_possible_duplicate(const ParsedMessage& msg) noexcept {
+    return msg.get_char(tag::PossDupFlag::value) == 'Y' ||
+           msg.get_char(tag::PossResend::value) == 'Y';
+}
+
+} // namespace nfx
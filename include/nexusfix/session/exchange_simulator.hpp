@@ -0,0 +1,732 @@
+/*
+    NexusFIX Exchange Simulator
+
+    The venue end of an end-to-end benchmark: answers NewOrderSingle,
+    OrderCancelRequest and OrderCancelReplaceRequest the way a matching
+    engine would, from one session's point of view, without a venue UAT.
+
+        35=D  ->  8 New  [8 Trade ...]  [8 Trade (simulated liquidity)]  [8 Canceled (IOC / Market rest)]
+        35=F  ->  8 Canceled               | 9 (unknown order, 434=1)
+        35=G  ->  8 Replaced [8 Trade ...] | 9 (unknown order or qty <= CumQty, 434=2)
+
+    Orders are matched price-time against a SimOrderBook: an incoming
+    order trades with the crossing orders resting on the other side (both
+    get Trade reports), then, with probability fill_ratio, with simulated
+    liquidity at its limit price (Market orders: the symbol's last trade),
+    in full or - with probability partial_fill_ratio - for half. What is
+    left rests (Day / GTC limit orders) or is canceled (Market, IOC).
+
+    Every response is rendered at once from an ExecReportTemplate into a
+    pending slot and released after a latency drawn from a LatencyModel
+    (Fixed, Uniform or Exponential; acks and fills have separate models).
+    Releases keep arrival order, as on a venue gateway: a response is
+    never sent before one queued ahead of it. poll() hands the due ones
+    to SessionManager::send_prebuilt() together, which sequences them and
+    sends them in one batch.
+
+    The book changes when the request arrives; only the report is
+    delayed. Single-threaded: one simulator, with its own book, per
+    session, driven from the session's thread. The book and the pending
+    slots are allocated by the constructor.
+
+    Usage:
+        ExchangeSimulator<SessionManager<Handler>> sim{session, {
+            .fill_ratio = 0.8,
+            .ack_latency = {.distribution = LatencyDistribution::Uniform, .min_ns = 20'000, .max_ns = 50'000},
+            .fill_latency = {.distribution = LatencyDistribution::Exponential, .min_ns = 100'000, .mean_ns = 400'000},
+        }};
+        void on_app_message(const ParsedMessage& msg) noexcept { sim.on_app_message(msg); }
+        ...
+        sim.poll();     // Every event-loop iteration (AcceptorEngine: App::on_poll)
+*/
+
+#pragma once
+
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/serializer/exec_report_template.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/util/fast_timestamp.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Random Source and Latency Model
+// ============================================================================
+
+/// xorshift64*: cheap, seedable, good enough for fill and latency draws
+class SimRandom {
+public:
+    explicit constexpr SimRandom(uint64_t seed = 1) noexcept
+        : state_{seed ? seed : 0x9E3779B97F4A7C15ULL} {}
+
+    constexpr uint64_t next() noexcept {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1DULL;
+    }
+
+    /// [0, 1)
+    constexpr double uniform() noexcept {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+
+    /// True with probability p (no draw when p is 0 or 1)
+    constexpr bool chance(double p) noexcept {
+        return p >= 1.0 || (p > 0.0 && uniform() < p);
+    }
+
+private:
+    uint64_t state_;
+};
+
+enum class LatencyDistribution : uint8_t {
+    Fixed,          // min_ns
+    Uniform,        // [min_ns, max_ns]
+    Exponential     // min_ns + Exp(mean_ns), capped at max_ns when set
+};
+
+/// Delay between a request and its response
+struct LatencyModel {
+    LatencyDistribution distribution{LatencyDistribution::Fixed};
+    uint64_t min_ns{0};
+    uint64_t max_ns{0};
+    uint64_t mean_ns{0};      // Exponential: mean above min_ns
+
+    [[nodiscard]] uint64_t sample(SimRandom& rng) const noexcept {
+        switch (distribution) {
+            case LatencyDistribution::Fixed:
+                return min_ns;
+            case LatencyDistribution::Uniform:
+                return max_ns > min_ns ? min_ns + rng.next() % (max_ns - min_ns + 1) : min_ns;
+            case LatencyDistribution::Exponential: {
+                const double tail = -std::log(1.0 - rng.uniform()) * static_cast<double>(mean_ns);
+                const uint64_t ns = min_ns + static_cast<uint64_t>(tail);
+                return max_ns > min_ns ? std::min(ns, max_ns) : ns;
+            }
+        }
+        return min_ns;
+    }
+};
+
+// ============================================================================
+// Simulated Order Book
+// ============================================================================
+
+/// One live order (quantities in whole units)
+struct SimOrder {
+    static constexpr size_t MAX_ID_LENGTH = 40;
+
+    uint64_t order_id{0};
+    uint64_t hash{0};                // Of the ClOrdID
+    FixedPrice price{};
+    int64_t order_qty{0};
+    int64_t cum_qty{0};
+    double notional{0.0};            // Sum of LastQty * LastPx (AvgPx)
+    uint32_t prev{UINT32_MAX};       // Price-time list of its side
+    uint32_t next{UINT32_MAX};
+    uint16_t symbol{0};
+    Side side{Side::Buy};
+    bool resting{false};
+    uint8_t cl_ord_id_length{0};
+    std::array<char, MAX_ID_LENGTH> cl_ord_id{};
+
+    [[nodiscard]] int64_t leaves_qty() const noexcept { return order_qty - cum_qty; }
+    [[nodiscard]] bool is_buy() const noexcept {
+        return side == Side::Buy || side == Side::BuyMinus;
+    }
+    [[nodiscard]] std::string_view cl_ord_id_view() const noexcept {
+        return {cl_ord_id.data(), cl_ord_id_length};
+    }
+    [[nodiscard]] FixedPrice avg_px() const noexcept {
+        return cum_qty == 0 ? FixedPrice{} : FixedPrice::from_double(notional / static_cast<double>(cum_qty));
+    }
+};
+
+/// Price-time order book over a fixed pool of orders
+/// Each symbol keeps a bid and an ask list, best first; inserting walks
+/// the list from the best price, which is cheap for the shallow books a
+/// simulation builds. ClOrdIDs are indexed in an open-addressing table.
+class SimOrderBook {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr uint16_t NO_SYMBOL = UINT16_MAX;
+    static constexpr size_t MAX_SYMBOLS = 256;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 24;
+
+    explicit SimOrderBook(size_t max_orders)
+        : orders_(max_orders)
+        , index_(std::bit_ceil(std::max<size_t>(max_orders * 2, 2)), NONE)
+        , index_mask_{index_.size() - 1} {
+        free_.reserve(max_orders);
+        for (size_t i = max_orders; i-- > 0;) free_.push_back(static_cast<uint32_t>(i));
+    }
+
+    SimOrderBook(const SimOrderBook&) = delete;
+    SimOrderBook& operator=(const SimOrderBook&) = delete;
+
+    /// Symbol id, added on first sight (NO_SYMBOL if too long or the table is full)
+    [[nodiscard]] uint16_t symbol_id(std::string_view symbol) noexcept {
+        for (size_t i = 0; i < symbol_count_; ++i) {
+            const Symbol& s = symbols_[i];
+            if (std::string_view{s.name.data(), s.length} == symbol) return static_cast<uint16_t>(i);
+        }
+        if (symbol.empty() || symbol.size() > MAX_SYMBOL_LENGTH || symbol_count_ == MAX_SYMBOLS) {
+            return NO_SYMBOL;
+        }
+        Symbol& s = symbols_[symbol_count_];
+        std::memcpy(s.name.data(), symbol.data(), symbol.size());
+        s.length = static_cast<uint8_t>(symbol.size());
+        return static_cast<uint16_t>(symbol_count_++);
+    }
+
+    [[nodiscard]] std::string_view symbol_name(uint16_t symbol) const noexcept {
+        return {symbols_[symbol].name.data(), symbols_[symbol].length};
+    }
+
+    /// Price of the symbol's last trade (zero before the first)
+    [[nodiscard]] FixedPrice last_price(uint16_t symbol) const noexcept {
+        return symbols_[symbol].last_px;
+    }
+
+    /// New live order, not yet resting
+    /// @return NONE if the pool is full or the ClOrdID is empty, too long or live
+    [[nodiscard]] uint32_t add(std::string_view cl_ord_id, uint16_t symbol, Side side,
+                               FixedPrice price, int64_t qty) noexcept {
+        if (free_.empty() || symbol >= symbol_count_ || !valid_id(cl_ord_id) ||
+            find(cl_ord_id) != NONE) {
+            return NONE;
+        }
+        const uint32_t idx = free_.back();
+        free_.pop_back();
+        SimOrder& o = orders_[idx];
+        o = SimOrder{};
+        o.order_id = ++last_order_id_;
+        o.price = price;
+        o.order_qty = qty;
+        o.symbol = symbol;
+        o.side = side;
+        set_id(o, cl_ord_id);
+        index_insert(idx);
+        ++live_;
+        return idx;
+    }
+
+    /// Live order with this ClOrdID, or NONE
+    [[nodiscard]] uint32_t find(std::string_view cl_ord_id) const noexcept {
+        if (!valid_id(cl_ord_id)) return NONE;
+        const uint64_t h = util::fnv1a_hash64_runtime(cl_ord_id);
+        for (size_t i = h & index_mask_; index_[i] != NONE; i = (i + 1) & index_mask_) {
+            const SimOrder& o = orders_[index_[i]];
+            if (o.hash == h && o.cl_ord_id_view() == cl_ord_id) return index_[i];
+        }
+        return NONE;
+    }
+
+    /// Give a live order the ClOrdID of a replace request
+    /// @return false if the new ClOrdID is empty, too long or live
+    bool rekey(uint32_t idx, std::string_view cl_ord_id) noexcept {
+        if (!valid_id(cl_ord_id) || find(cl_ord_id) != NONE) return false;
+        index_erase(idx);
+        set_id(orders_[idx], cl_ord_id);
+        index_insert(idx);
+        return true;
+    }
+
+    /// Queue the order on its side, behind orders at the same price
+    void rest(uint32_t idx) noexcept {
+        SimOrder& o = orders_[idx];
+        if (o.resting) return;
+        uint32_t& head = side_head(o.symbol, o.is_buy());
+        uint32_t prev = NONE;
+        for (uint32_t i = head; i != NONE && !better(o, orders_[i]); i = orders_[i].next) prev = i;
+        o.prev = prev;
+        o.next = prev == NONE ? head : orders_[prev].next;
+        if (o.next != NONE) orders_[o.next].prev = idx;
+        (prev == NONE ? head : orders_[prev].next) = idx;
+        o.resting = true;
+    }
+
+    /// Take the order off its side (it stays live)
+    void unrest(uint32_t idx) noexcept {
+        SimOrder& o = orders_[idx];
+        if (!o.resting) return;
+        if (o.prev != NONE) orders_[o.prev].next = o.next;
+        else side_head(o.symbol, o.is_buy()) = o.next;
+        if (o.next != NONE) orders_[o.next].prev = o.prev;
+        o.prev = o.next = NONE;
+        o.resting = false;
+    }
+
+    /// Record a trade of qty at px on the order
+    void execute(uint32_t idx, int64_t qty, FixedPrice px) noexcept {
+        SimOrder& o = orders_[idx];
+        o.cum_qty += qty;
+        o.notional += static_cast<double>(qty) * px.to_double();
+        symbols_[o.symbol].last_px = px;
+    }
+
+    /// Trade the order against the crossing orders resting on the other side
+    /// on_trade(resting, qty, px) runs after each trade, before a filled
+    /// resting order is removed.
+    /// @param market Cross at any price
+    template <typename OnTrade>
+    void match(uint32_t idx, bool market, OnTrade&& on_trade) noexcept {
+        SimOrder& o = orders_[idx];
+        uint32_t& head = side_head(o.symbol, !o.is_buy());
+        while (head != NONE && o.leaves_qty() > 0) {
+            const uint32_t resting = head;
+            const SimOrder& r = orders_[resting];
+            if (!market && (o.is_buy() ? o.price < r.price : o.price > r.price)) break;
+            const int64_t qty = std::min(o.leaves_qty(), r.leaves_qty());
+            const FixedPrice px = r.price;
+            execute(resting, qty, px);
+            execute(idx, qty, px);
+            on_trade(resting, qty, px);
+            if (orders_[resting].leaves_qty() == 0) remove(resting);
+        }
+    }
+
+    /// Drop a live order (filled, canceled or done)
+    void remove(uint32_t idx) noexcept {
+        unrest(idx);
+        index_erase(idx);
+        orders_[idx].order_id = 0;
+        free_.push_back(idx);
+        --live_;
+    }
+
+    [[nodiscard]] const SimOrder& order(uint32_t idx) const noexcept { return orders_[idx]; }
+    [[nodiscard]] SimOrder& order(uint32_t idx) noexcept { return orders_[idx]; }
+
+    /// Best resting order on a side (NONE if empty)
+    [[nodiscard]] uint32_t best(uint16_t symbol, bool buy) const noexcept {
+        return buy ? symbols_[symbol].bid_head : symbols_[symbol].ask_head;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return live_; }
+    [[nodiscard]] size_t capacity() const noexcept { return orders_.size(); }
+
+private:
+    struct Symbol {
+        std::array<char, MAX_SYMBOL_LENGTH> name{};
+        uint8_t length{0};
+        uint32_t bid_head{NONE};
+        uint32_t ask_head{NONE};
+        FixedPrice last_px{};
+    };
+
+    [[nodiscard]] static bool valid_id(std::string_view id) noexcept {
+        return !id.empty() && id.size() <= SimOrder::MAX_ID_LENGTH;
+    }
+
+    static void set_id(SimOrder& o, std::string_view id) noexcept {
+        std::memcpy(o.cl_ord_id.data(), id.data(), id.size());
+        o.cl_ord_id_length = static_cast<uint8_t>(id.size());
+        o.hash = util::fnv1a_hash64_runtime(id);
+    }
+
+    [[nodiscard]] uint32_t& side_head(uint16_t symbol, bool buy) noexcept {
+        return buy ? symbols_[symbol].bid_head : symbols_[symbol].ask_head;
+    }
+
+    /// a goes ahead of b (strictly better price; equal prices keep time order)
+    [[nodiscard]] static bool better(const SimOrder& a, const SimOrder& b) noexcept {
+        return a.is_buy() ? a.price > b.price : a.price < b.price;
+    }
+
+    void index_insert(uint32_t idx) noexcept {
+        size_t i = orders_[idx].hash & index_mask_;
+        while (index_[i] != NONE) i = (i + 1) & index_mask_;
+        index_[i] = idx;
+    }
+
+    /// Backward-shift deletion: no tombstones, probes stay short
+    void index_erase(uint32_t idx) noexcept {
+        size_t i = orders_[idx].hash & index_mask_;
+        while (index_[i] != idx) i = (i + 1) & index_mask_;
+        for (size_t j = (i + 1) & index_mask_; index_[j] != NONE; j = (j + 1) & index_mask_) {
+            const size_t home = orders_[index_[j]].hash & index_mask_;
+            // Move j into the hole unless its home lies cyclically in (i, j]
+            const bool stays = i <= j ? (home > i && home <= j) : (home > i || home <= j);
+            if (!stays) {
+                index_[i] = index_[j];
+                i = j;
+            }
+        }
+        index_[i] = NONE;
+    }
+
+    std::vector<SimOrder> orders_;
+    std::vector<uint32_t> free_;
+    std::vector<uint32_t> index_;
+    size_t index_mask_;
+    std::array<Symbol, MAX_SYMBOLS> symbols_{};
+    size_t symbol_count_{0};
+    size_t live_{0};
+    uint64_t last_order_id_{0};
+};
+
+// ============================================================================
+// Exchange Simulator
+// ============================================================================
+
+struct ExchangeSimulatorConfig {
+    double fill_ratio{1.0};             // Orders traded by simulated liquidity on arrival
+    double partial_fill_ratio{0.0};     // Of those, traded for half their quantity
+    double reject_ratio{0.0};           // Orders rejected outright
+    LatencyModel ack_latency{};         // Request -> New / Canceled / Replaced / Rejected
+    LatencyModel fill_latency{};        // Ack -> simulated-liquidity Trade
+    size_t max_orders{65536};           // Live orders in the book
+    size_t max_pending{4096};           // Responses waiting for their latency
+    uint64_t seed{1};
+    std::string_view order_id_prefix{"O"};
+    std::string_view exec_id_prefix{"X"};
+};
+
+/// Simulator counters (session thread)
+struct ExchangeSimulatorStats {
+    uint64_t orders{0};             // 35=D received
+    uint64_t cancels{0};            // 35=F received
+    uint64_t replaces{0};           // 35=G received
+    uint64_t rejects{0};            // Orders answered 150=8
+    uint64_t cancel_rejects{0};     // 35=9 sent for F / G
+    uint64_t trades{0};             // Trade reports (each side of a book trade counts)
+    uint64_t traded_qty{0};         // Units traded, both sides
+    uint64_t queued{0};             // Responses rendered
+    uint64_t sent{0};               // Responses the session accepted
+    uint64_t dropped{0};            // Not rendered (value did not fit) or refused by the session
+    uint64_t early_releases{0};     // Sent before their time: pending slots were full
+};
+
+/// Matching venue for one acceptor session
+/// @tparam Session SessionManager instantiation (config(), send_prebuilt())
+/// @tparam MaxMessageSize Largest response; each pending slot is this big
+template <typename Session, size_t MaxMessageSize = 512>
+class ExchangeSimulator {
+public:
+    static constexpr size_t RELEASE_BATCH = 64;
+
+    ExchangeSimulator(Session& session, ExchangeSimulatorConfig config = {})
+        : session_{session}
+        , config_{config}
+        , template_{{
+            .begin_string = session.config().begin_string,
+            .sender_comp_id = session.config().sender_comp_id,
+            .target_comp_id = session.config().target_comp_id,
+            .order_id_prefix = config.order_id_prefix,
+            .exec_id_prefix = config.exec_id_prefix,
+          }}
+        , book_{config.max_orders}
+        , rng_{config.seed}
+        , slots_(std::max<size_t>(config.max_pending, 1) * MaxMessageSize)
+        , pending_(std::max<size_t>(config.max_pending, 1)) {}
+
+    ExchangeSimulator(const ExchangeSimulator&) = delete;
+    ExchangeSimulator& operator=(const ExchangeSimulator&) = delete;
+
+    /// Handle an application message received at now_ns
+    /// Types other than D, F and G are ignored.
+    void on_app_message(const ParsedMessage& msg, uint64_t now_ns = clock_ns()) noexcept {
+        switch (msg.msg_type()) {
+            case msg_type::NewOrderSingle: new_order(msg, now_ns); break;
+            case msg_type::OrderCancelRequest: cancel(msg, now_ns); break;
+            case msg_type::OrderCancelReplaceRequest: replace(msg, now_ns); break;
+            default: break;
+        }
+    }
+
+    /// Send every response due by now_ns
+    /// @return Responses handed to the session
+    size_t poll(uint64_t now_ns = clock_ns()) noexcept {
+        size_t released = 0;
+        while (count_ != 0 && pending_[head_].due_ns <= now_ns) {
+            released += release(RELEASE_BATCH, now_ns);
+        }
+        return released;
+    }
+
+    /// Forget responses not yet sent (the connection is gone); the book stays
+    void clear_pending() noexcept {
+        head_ = 0;
+        count_ = 0;
+        last_due_ns_ = 0;
+    }
+
+    /// Due time of the next response (UINT64_MAX if none)
+    [[nodiscard]] uint64_t next_due_ns() const noexcept {
+        return count_ ? pending_[head_].due_ns : UINT64_MAX;
+    }
+
+    [[nodiscard]] size_t pending() const noexcept { return count_; }
+    [[nodiscard]] const SimOrderBook& book() const noexcept { return book_; }
+    [[nodiscard]] const ExchangeSimulatorStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const ExchangeSimulatorConfig& config() const noexcept { return config_; }
+
+    /// Monotonic clock for the now_ns arguments
+    [[nodiscard]] static uint64_t clock_ns() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    using Template = serializer::ExecReportTemplate<MaxMessageSize>;
+
+    struct Pending {
+        uint64_t due_ns{0};
+        uint32_t size{0};
+    };
+
+    // ========================================================================
+    // Requests
+    // ========================================================================
+
+    void new_order(const ParsedMessage& msg, uint64_t now_ns) noexcept {
+        ++stats_.orders;
+        const std::string_view cl_ord_id = msg.get_string(tag::ClOrdID::value);
+        const std::string_view symbol = msg.get_string(tag::Symbol::value);
+        const char side_char = msg.get_char(tag::Side::value);
+        const Side side = side_char ? static_cast<Side>(side_char) : Side::Buy;
+        const int64_t qty = msg.get_qty(tag::OrderQty::value).whole();
+        const bool market = msg.get_char(tag::OrdType::value) == static_cast<char>(OrdType::Market);
+        const FixedPrice price = market ? FixedPrice{} : msg.get_price(tag::Price::value);
+        const char tif = msg.get_char(tag::TimeInForce::value);
+        const bool ioc = tif == static_cast<char>(TimeInForce::ImmediateOrCancel) ||
+                         tif == static_cast<char>(TimeInForce::FillOrKill);
+
+        const uint64_t ack_due = now_ns + config_.ack_latency.sample(rng_);
+        uint32_t idx = SimOrderBook::NONE;
+        if (qty > 0 && (market || price.raw > 0) && !rng_.chance(config_.reject_ratio)) {
+            const uint16_t sym = book_.symbol_id(symbol);
+            if (sym != SimOrderBook::NO_SYMBOL) idx = book_.add(cl_ord_id, sym, side, price, qty);
+        }
+        if (idx == SimOrderBook::NONE) {
+            ++stats_.rejects;
+            queue(ack_due, serializer::ExecReportValues{
+                .exec_id = ++last_exec_id_,
+                .exec_type = ExecType::Rejected,
+                .ord_status = OrdStatus::Rejected,
+                .side = side,
+                .order_qty = Qty::from_int(std::max<int64_t>(qty, 0)),
+                .price = price.raw > 0 ? price : FixedPrice{},
+                .symbol = symbol,
+                .cl_ord_id = cl_ord_id,
+            });
+            return;
+        }
+
+        report(idx, ExecType::New, ack_due);
+        trade_and_finish(idx, market, ioc, ack_due, /*simulated=*/true);
+    }
+
+    void cancel(const ParsedMessage& msg, uint64_t now_ns) noexcept {
+        ++stats_.cancels;
+        const std::string_view cl_ord_id = msg.get_string(tag::ClOrdID::value);
+        const std::string_view orig = msg.get_string(tag::OrigClOrdID::value);
+        const uint64_t due = now_ns + config_.ack_latency.sample(rng_);
+
+        const uint32_t idx = book_.find(orig);
+        if (idx == SimOrderBook::NONE) {
+            cancel_reject(due, cl_ord_id, orig, '1');
+            return;
+        }
+        report(idx, ExecType::Canceled, due, 0, {}, cl_ord_id, orig);
+        book_.remove(idx);
+    }
+
+    void replace(const ParsedMessage& msg, uint64_t now_ns) noexcept {
+        ++stats_.replaces;
+        const std::string_view cl_ord_id = msg.get_string(tag::ClOrdID::value);
+        const std::string_view orig = msg.get_string(tag::OrigClOrdID::value);
+        const uint64_t due = now_ns + config_.ack_latency.sample(rng_);
+
+        const uint32_t idx = book_.find(orig);
+        const int64_t qty = msg.get_qty(tag::OrderQty::value).whole();
+        if (idx == SimOrderBook::NONE || qty <= book_.order(idx).cum_qty ||
+            !book_.rekey(idx, cl_ord_id)) {
+            cancel_reject(due, cl_ord_id, orig, '2');
+            return;
+        }
+
+        // A replaced order loses its time priority
+        book_.unrest(idx);
+        SimOrder& o = book_.order(idx);
+        o.order_qty = qty;
+        if (msg.has_field(tag::Price::value)) o.price = msg.get_price(tag::Price::value);
+        report(idx, ExecType::Replaced, due, 0, {}, {}, orig);
+        trade_and_finish(idx, false, false, due, /*simulated=*/false);
+    }
+
+    /// Match against the book, maybe against simulated liquidity, then rest or cancel the rest
+    void trade_and_finish(uint32_t idx, bool market, bool ioc, uint64_t due,
+                          bool simulated) noexcept {
+        book_.match(idx, market, [&](uint32_t resting, int64_t qty, FixedPrice px) noexcept {
+            report(resting, ExecType::Trade, due, qty, px);
+            report(idx, ExecType::Trade, due, qty, px);
+        });
+
+        const SimOrder& o = book_.order(idx);
+        const FixedPrice px = market ? book_.last_price(o.symbol) : o.price;
+        if (simulated && o.leaves_qty() > 0 && px.raw > 0 && rng_.chance(config_.fill_ratio)) {
+            int64_t qty = o.leaves_qty();
+            if (qty > 1 && rng_.chance(config_.partial_fill_ratio)) qty /= 2;
+            book_.execute(idx, qty, px);
+            report(idx, ExecType::Trade, due + config_.fill_latency.sample(rng_), qty, px);
+        }
+
+        if (book_.order(idx).leaves_qty() == 0) {
+            book_.remove(idx);
+        } else if (market || ioc) {
+            report(idx, ExecType::Canceled, due);
+            book_.remove(idx);
+        } else {
+            book_.rest(idx);
+        }
+    }
+
+    // ========================================================================
+    // Responses
+    // ========================================================================
+
+    /// Queue an ExecutionReport for a live order
+    /// @param cl_ord_id Overrides the order's (cancel requests)
+    void report(uint32_t idx, ExecType type, uint64_t due_ns, int64_t last_qty = 0,
+                FixedPrice last_px = {}, std::string_view cl_ord_id = {},
+                std::string_view orig_cl_ord_id = {}) noexcept {
+        const SimOrder& o = book_.order(idx);
+        OrdStatus status;
+        switch (type) {
+            case ExecType::Canceled: status = OrdStatus::Canceled; break;
+            case ExecType::New: status = OrdStatus::New; break;
+            default:
+                status = o.cum_qty == 0 ? OrdStatus::New
+                       : o.leaves_qty() == 0 ? OrdStatus::Filled : OrdStatus::PartiallyFilled;
+                break;
+        }
+        if (type == ExecType::Trade) {
+            ++stats_.trades;
+            stats_.traded_qty += static_cast<uint64_t>(last_qty);
+        }
+        queue(due_ns, serializer::ExecReportValues{
+            .order_id = o.order_id,
+            .exec_id = ++last_exec_id_,
+            .exec_type = type,
+            .ord_status = status,
+            .side = o.side,
+            .order_qty = Qty::from_int(o.order_qty),
+            .price = o.price,
+            .last_qty = Qty::from_int(last_qty),
+            .last_px = last_px,
+            .leaves_qty = Qty::from_int(status == OrdStatus::Canceled ? 0 : o.leaves_qty()),
+            .cum_qty = Qty::from_int(o.cum_qty),
+            .avg_px = o.avg_px(),
+            .symbol = book_.symbol_name(o.symbol),
+            .cl_ord_id = cl_ord_id.empty() ? o.cl_ord_id_view() : cl_ord_id,
+            .orig_cl_ord_id = orig_cl_ord_id,
+        });
+    }
+
+    void queue(uint64_t due_ns, const serializer::ExecReportValues& values) noexcept {
+        const std::span<const char> msg = template_.render(0, values, timestamp_.get());
+        if (msg.empty()) [[unlikely]] {
+            ++stats_.dropped;
+            return;
+        }
+        push(due_ns, msg);
+    }
+
+    /// OrderCancelReject (35=9): rare, so built field by field
+    /// @param response_to CxlRejResponseTo: '1' cancel, '2' replace
+    void cancel_reject(uint64_t due_ns, std::string_view cl_ord_id, std::string_view orig,
+                       char response_to) noexcept {
+        ++stats_.cancel_rejects;
+        serializer::FastMessageBuilder<MaxMessageSize> builder;
+        builder.begin_string(session_.config().begin_string);
+        const size_t body_len_pos = builder.body_length_placeholder();
+        builder.mark_body_start();
+        builder.msg_type(msg_type::OrderCancelReject);
+        builder.sender_comp_id(session_.config().sender_comp_id);
+        builder.target_comp_id(session_.config().target_comp_id);
+        builder.msg_seq_num(0);
+        builder.sending_time(timestamp_.get());
+        builder.template field<37>(std::string_view{"NONE"});
+        builder.template field<11>(cl_ord_id);
+        builder.template field<41>(orig);
+        builder.template field<39>(static_cast<char>(OrdStatus::Rejected));
+        builder.template field<434>(response_to);
+        builder.template field<102>('1');   // CxlRejReason: unknown order
+        builder.update_body_length(body_len_pos, builder.size() - builder.body_start());
+        builder.finalize_checksum();
+        if (builder.size() + 1 >= MaxMessageSize) [[unlikely]] {
+            ++stats_.dropped;
+            return;
+        }
+        push(due_ns, builder.data());
+    }
+
+    /// Copy a response into the next pending slot
+    /// It is due no earlier than the response ahead of it.
+    void push(uint64_t due_ns, std::span<const char> msg) noexcept {
+        if (count_ == pending_.size()) {
+            stats_.early_releases += release(1, UINT64_MAX);
+        }
+        const size_t slot = (head_ + count_) % pending_.size();
+        std::memcpy(slots_.data() + slot * MaxMessageSize, msg.data(), msg.size());
+        last_due_ns_ = std::max(last_due_ns_, due_ns);
+        pending_[slot] = Pending{last_due_ns_, static_cast<uint32_t>(msg.size())};
+        ++count_;
+        ++stats_.queued;
+    }
+
+    /// Hand up to max responses due by now_ns to the session in one call
+    size_t release(size_t max, uint64_t now_ns) noexcept {
+        std::array<std::span<const char>, RELEASE_BATCH> batch;
+        size_t n = 0;
+        while (n < max && n < count_) {
+            const size_t slot = (head_ + n) % pending_.size();
+            if (pending_[slot].due_ns > now_ns) break;
+            batch[n++] = {slots_.data() + slot * MaxMessageSize, pending_[slot].size};
+        }
+        if (n == 0) return 0;
+        const std::span<const std::span<const char>> due{batch.data(), n};
+        const size_t sent = session_.send_prebuilt(due).accepted;
+        stats_.sent += sent;
+        stats_.dropped += n - sent;
+        head_ = (head_ + n) % pending_.size();
+        count_ -= n;
+        return n;
+    }
+
+    Session& session_;
+    ExchangeSimulatorConfig config_;
+    Template template_;
+    SimOrderBook book_;
+    SimRandom rng_;
+    util::FastTimestamp timestamp_{};
+
+    std::vector<char> slots_;            // max_pending x MaxMessageSize
+    std::vector<Pending> pending_;       // Ring over the slots
+    size_t head_{0};
+    size_t count_{0};
+    uint64_t last_due_ns_{0};
+    uint64_t last_exec_id_{0};
+
+    ExchangeSimulatorStats stats_{};
+};
+
+} // namespace nfx
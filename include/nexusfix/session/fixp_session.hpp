@@ -0,0 +1,772 @@
+/*
+    NexusFIX FIXP Session (binary order entry)
+
+    FIX Performance Session Layer over SOFH-framed SBE, alongside the
+    tag-value SessionManager. Session messages are the fixed-length SBE
+    codecs in sbe/codecs/fixp_session.hpp; application messages are any
+    SBE codec (NewOrderSingleCodec, ExecutionReportCodec, generated venue
+    codecs) and carry no sequence number: it is implied by the last
+    Establish / Sequence / Retransmission, so nothing is parsed or
+    formatted per message beyond the 8-byte SBE header.
+
+        Initiator                         Acceptor
+        Negotiate            ------->
+                             <-------     NegotiationResponse
+        Establish(nextSeqNo) ------->
+                             <-------     EstablishmentAck(nextSeqNo)
+        app messages / Sequence (keepalive) <------> both ways
+        RetransmitRequest    ------->     (gap on a recoverable flow)
+                             <-------     Retransmission + replay + Sequence
+        Terminate            <------>     Terminate
+
+    Reuses the tag-value building blocks: SequenceManager and GapTracker
+    for sequencing, store::IMessageStore for replay, the SessionState
+    transition table, and the handler's on_send / acquire_send_buffer()
+    transport hooks (a frame is built directly in a registered buffer).
+    A negotiated session survives reconnects: establish() on a new
+    connection re-binds it and both sides recover the gap.
+
+    Usage:
+        struct OrderEntry {
+            void on_app_message(const FixpAppMessage& msg) noexcept {
+                sbe::dispatch(msg.data, [&](auto& codec) { ... });
+            }
+            void on_state_change(SessionState from, SessionState to) noexcept { ... }
+            bool on_send(std::span<const char> frame) noexcept { ... }
+            void on_error(const SessionError& err) noexcept { ... }
+        };
+
+        FixpSessionConfig config;
+        config.session_id = 0x1234;
+        FixpSession<OrderEntry> session{config};
+        session.set_message_store(&store);
+
+        session.on_connect();
+        (void)session.establish();
+        session.on_data_received(bytes);   // SOFH-framed stream
+
+        (void)session.send<sbe::NewOrderSingleCodec>([](auto& nos) {
+            nos.clOrdId("ORD1").symbol("ESZ5").side(Side::Buy);
+        });
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/codecs/fixp_session.hpp"
+#include "nexusfix/sbe/sofh.hpp"
+#include "nexusfix/session/sequence.hpp"
+#include "nexusfix/session/session_handler.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/types/error.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// FIXP Handler
+// ============================================================================
+
+/// Inbound application message handed to the handler
+struct FixpAppMessage {
+    uint32_t seq_num;              // Implicit FIXP sequence number
+    bool retransmitted;            // Part of a Retransmission replay
+    std::span<const char> data;    // SBE message (header + body), SOFH stripped
+};
+
+/// Callbacks required by FixpSession (hooks as in session_handler.hpp;
+/// acquire_send_buffer() is honoured when present)
+template <typename T>
+concept FixpSessionHandler = requires(T& handler, const FixpAppMessage& msg,
+                                      SessionState state, std::span<const char> data,
+                                      const SessionError& err) {
+    { handler.on_app_message(msg) } noexcept;
+    { handler.on_state_change(state, state) } noexcept;
+    { handler.on_send(data) } noexcept -> std::same_as<bool>;
+    { handler.on_error(err) } noexcept;
+};
+
+// ============================================================================
+// FIXP Session Configuration
+// ============================================================================
+
+struct FixpSessionConfig {
+    uint64_t session_id{0};                  // Agreed out of band (iLink 3: UUID)
+    uint32_t keepalive_interval_ms{1000};    // Sent in Establish / EstablishmentAck
+    sbe::FixpFlowType flow{sbe::FixpFlowType::Recoverable};  // Our outbound flow
+    uint32_t max_retransmit_count{2500};     // Largest RetransmitRequest served / sent
+    bool coalesce_sends{false};              // Queue app messages until flush_sends()
+
+    constexpr FixpSessionConfig() noexcept = default;
+};
+
+// ============================================================================
+// FIXP Session
+// ============================================================================
+
+/// FIXP session over a SOFH-framed SBE byte stream
+/// @tparam Handler Session callbacks (FixpSessionHandler), held by value
+/// @tparam SofhT Framing header layout (sbe::Sofh, sbe::CompactSofh)
+template <FixpSessionHandler Handler, typename SofhT = sbe::Sofh>
+class FixpSession {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+    /// Internal frame buffer (used without a handler send buffer, or when coalescing)
+    static constexpr size_t SEND_BUFFER_SIZE = 16 * 1024;
+
+    explicit FixpSession(const FixpSessionConfig& config, Handler handler = Handler{}) noexcept
+        : config_{config}
+        , handler_{std::move(handler)}
+        , writer_{std::span<char>{tx_buffer_}}
+        , peer_keepalive_ms_{config.keepalive_interval_ms} {}
+
+    // Non-copyable, non-movable (the frame writer points into this object)
+    FixpSession(const FixpSession&) = delete;
+    FixpSession& operator=(const FixpSession&) = delete;
+
+    // ========================================================================
+    // Session Control
+    // ========================================================================
+
+    [[nodiscard]] Handler& handler() noexcept { return handler_; }
+    [[nodiscard]] const Handler& handler() const noexcept { return handler_; }
+
+    /// Set message store for retransmission support
+    /// @param store Pointer to message store (ownership NOT transferred)
+    void set_message_store(store::IMessageStore* store) noexcept {
+        message_store_ = store;
+    }
+
+    /// Get the current message store (may be nullptr)
+    [[nodiscard]] store::IMessageStore* message_store() const noexcept {
+        return message_store_;
+    }
+
+    /// Called when TCP connection is established
+    void on_connect() noexcept {
+        reset_connection();
+        transition(SessionEvent::Connect);
+    }
+
+    /// Called when TCP connection is lost
+    /// Unsent frames are dropped; they are stored and recovered by retransmission.
+    void on_disconnect() noexcept {
+        reset_connection();
+        transition(SessionEvent::Disconnect);
+    }
+
+    /// Bind the session to this connection (initiator)
+    /// Negotiates first if the session id has not been negotiated yet;
+    /// Establish then follows the NegotiationResponse.
+    SessionResult<void> establish() noexcept {
+        if (state_ != SessionState::SocketConnected) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+
+        const bool sent = negotiated_ ? send_establish() : send_negotiate();
+        if (!sent) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+
+        transition(SessionEvent::LogonSent);
+        return {};
+    }
+
+    /// End the connection; the peer answers with its own Terminate
+    SessionResult<void> terminate(
+        sbe::FixpTerminationCode code = sbe::FixpTerminationCode::Finished) noexcept {
+        if (state_ != SessionState::Active) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+
+        if (!send_terminate(code)) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+
+        transition(SessionEvent::LogoutSent);
+        return {};
+    }
+
+    /// Process bytes read from the connection (SOFH-framed stream)
+    /// Partial frames are carried over to the next call.
+    NFX_HOT void on_data_received(std::span<const char> data) noexcept {
+        if (deframer_.failed()) [[unlikely]] return;
+        stats_.bytes_received += data.size();
+
+        (void)deframer_.feed(data, [this](std::span<const char> msg) noexcept {
+            on_message(msg);
+        });
+
+        if (deframer_.failed()) [[unlikely]] {
+            // Binary framing cannot resynchronise: the connection is unusable
+            handler_.on_error(SessionError{SessionErrorCode::Disconnected});
+            transition(SessionEvent::Error);
+        }
+    }
+
+    /// Process one SBE message (for transports that strip SOFH themselves)
+    NFX_HOT void on_message(std::span<const char> msg) noexcept {
+        if (msg.size() < sbe::MessageHeader::SIZE) [[unlikely]] return;
+        last_received_ = Clock::now();
+        ++stats_.messages_received;
+
+        const auto template_id =
+            sbe::MessageHeader::wrapForDecode(msg.data(), msg.size()).templateId();
+        if (!sbe::is_fixp_session_message(template_id)) [[likely]] {
+            handle_app_message(msg);
+            return;
+        }
+
+        using Id = sbe::MessageHeader::TemplateId;
+        switch (template_id) {
+            case Id::Negotiate:           handle_negotiate(msg); break;
+            case Id::NegotiationResponse: handle_negotiation_response(msg); break;
+            case Id::NegotiationReject:
+            case Id::EstablishmentReject: handle_reject(); break;
+            case Id::Establish:           handle_establish(msg); break;
+            case Id::EstablishmentAck:    handle_establishment_ack(msg); break;
+            case Id::Sequence:            handle_sequence(msg); break;
+            case Id::Terminate:           handle_terminate(msg); break;
+            case Id::RetransmitRequest:   handle_retransmit_request(msg); break;
+            case Id::Retransmission:      handle_retransmission(msg); break;
+            case Id::RetransmitReject:    handle_retransmit_reject(); break;
+            default: break;
+        }
+    }
+
+    /// Periodic timer tick (call regularly, e.g., every 100ms)
+    void on_timer_tick() noexcept { on_timer_tick(Clock::now()); }
+
+    /// Timer tick at an explicit time (keepalive Sequence / peer timeout)
+    void on_timer_tick(TimePoint now) noexcept {
+        if (state_ != SessionState::Active) return;
+
+        flush_sends();
+
+        // Two missed peer keepalives, as HeartbeatTimer::has_timed_out()
+        if (now - last_received_ >= 2 * std::chrono::milliseconds{peer_keepalive_ms_}) {
+            handler_.on_error(SessionError{SessionErrorCode::HeartbeatTimeout});
+            transition(SessionEvent::HeartbeatTimeout);
+            return;
+        }
+
+        if (now - last_sent_ >= std::chrono::milliseconds{config_.keepalive_interval_ms}) {
+            if (send_sequence()) ++stats_.heartbeats_sent;
+        }
+    }
+
+    // ========================================================================
+    // Message Sending
+    // ========================================================================
+
+    /// Encode an application message directly into the outbound frame
+    /// @tparam Codec Fixed-size SBE codec (TOTAL_SIZE, wrapForEncode)
+    /// @param fill Called with the codec, header already encoded
+    template <typename Codec, typename Fill>
+    SessionResult<void> send(Fill&& fill) noexcept {
+        if (!can_send_app_messages(state_)) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+
+        auto codec = add<Codec>();
+        if (!codec) [[unlikely]] {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        std::forward<Fill>(fill)(*codec);
+        return commit_app_message(codec->encoded());
+    }
+
+    /// Send an already encoded SBE application message (copied into the frame)
+    SessionResult<void> send_app_message(std::span<const char> msg) noexcept {
+        if (!can_send_app_messages(state_)) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+
+        if (!append(msg)) [[unlikely]] {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        return commit_app_message(msg);
+    }
+
+    /// Send every queued frame in one on_send()
+    /// @return false if the handler failed to send
+    bool flush_sends() noexcept {
+        if (writer_.empty()) return true;
+
+        const auto frame = writer_.frame();
+        const size_t messages = writer_.message_count();
+        const bool sent = handler_.on_send(frame);
+        if (sent) {
+            last_sent_ = Clock::now();
+            stats_.messages_sent += messages;
+            stats_.bytes_sent += frame.size();
+            ++stats_.send_batches;
+        }
+        release_frame();
+        return sent;
+    }
+
+    /// Application and session messages queued for the next flush_sends()
+    [[nodiscard]] size_t pending_sends() const noexcept {
+        return writer_.message_count();
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] SessionState state() const noexcept { return state_; }
+    [[nodiscard]] const FixpSessionConfig& config() const noexcept { return config_; }
+    [[nodiscard]] const SessionStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const SequenceManager& sequences() const noexcept { return sequences_; }
+
+    /// Inbound ranges missing on a recoverable flow and not yet replayed
+    [[nodiscard]] const GapTracker& inbound_gaps() const noexcept { return inbound_gaps_; }
+
+    /// True once Negotiate was answered (kept across reconnects)
+    [[nodiscard]] bool negotiated() const noexcept { return negotiated_; }
+
+    /// True while a RetransmitRequest is outstanding
+    [[nodiscard]] bool retransmit_pending() const noexcept { return retransmit_pending_; }
+
+private:
+    // ========================================================================
+    // State Machine
+    // ========================================================================
+
+    void transition(SessionEvent event) noexcept {
+        SessionState prev = state_;
+        SessionState next = next_state(state_, event);
+
+        if (next != prev) {
+            state_ = next;
+            handler_.on_state_change(prev, next);
+        }
+    }
+
+    void reset_connection() noexcept {
+        deframer_.reset();
+        release_frame();
+        retransmit_pending_ = false;
+        retrans_remaining_ = 0;
+    }
+
+    void session_established(uint32_t peer_keepalive_ms) noexcept {
+        peer_keepalive_ms_ = peer_keepalive_ms;
+        last_sent_ = last_received_ = Clock::now();
+    }
+
+    // ========================================================================
+    // Negotiation / Establishment
+    // ========================================================================
+
+    /// Acceptor: bind the session id to this peer
+    void handle_negotiate(std::span<const char> msg) noexcept {
+        auto req = sbe::NegotiateCodec::wrapForDecode(msg.data(), msg.size());
+        if (!req.isValid() || state_ != SessionState::SocketConnected) return;
+
+        if (req.sessionId() != config_.session_id) {
+            if (auto reject = add<sbe::NegotiationRejectCodec>()) {
+                reject->sessionId(req.sessionId())
+                    .requestTimestamp(req.timestamp())
+                    .code(sbe::FixpRejectCode::Credentials);
+            }
+            flush_sends();
+            handler_.on_error(SessionError{SessionErrorCode::LogonRejected});
+            return;
+        }
+
+        negotiated_ = true;
+        peer_flow_ = req.clientFlow();
+        if (auto response = add<sbe::NegotiationResponseCodec>()) {
+            response->sessionId(config_.session_id)
+                .requestTimestamp(req.timestamp())
+                .serverFlow(config_.flow);
+        }
+        flush_sends();
+    }
+
+    /// Initiator: negotiation accepted, establish right away
+    void handle_negotiation_response(std::span<const char> msg) noexcept {
+        auto response = sbe::NegotiationResponseCodec::wrapForDecode(msg.data(), msg.size());
+        if (!response.isValid() || state_ != SessionState::LogonSent ||
+            response.sessionId() != config_.session_id) return;
+
+        negotiated_ = true;
+        peer_flow_ = response.serverFlow();
+        if (!send_establish()) {
+            handler_.on_error(SessionError{SessionErrorCode::NotConnected});
+        }
+    }
+
+    /// Acceptor: (re)bind a negotiated session to this connection
+    void handle_establish(std::span<const char> msg) noexcept {
+        auto req = sbe::EstablishCodec::wrapForDecode(msg.data(), msg.size());
+        if (!req.isValid() || state_ != SessionState::SocketConnected) return;
+
+        auto code = sbe::FixpRejectCode::Unspecified;
+        if (!negotiated_) code = sbe::FixpRejectCode::Unnegotiated;
+        else if (req.sessionId() != config_.session_id) code = sbe::FixpRejectCode::Credentials;
+        else if (req.keepaliveInterval() == 0) code = sbe::FixpRejectCode::KeepaliveInterval;
+
+        if (code != sbe::FixpRejectCode::Unspecified) {
+            if (auto reject = add<sbe::EstablishmentRejectCodec>()) {
+                reject->sessionId(req.sessionId()).requestTimestamp(req.timestamp()).code(code);
+            }
+            flush_sends();
+            handler_.on_error(SessionError{SessionErrorCode::LogonRejected});
+            return;
+        }
+
+        transition(SessionEvent::LogonReceived);
+        if (auto ack = add<sbe::EstablishmentAckCodec>()) {
+            ack->sessionId(config_.session_id)
+                .requestTimestamp(req.timestamp())
+                .nextSeqNo(sequences_.current_outbound())
+                .keepaliveInterval(config_.keepalive_interval_ms);
+        }
+        if (!flush_sends()) {
+            handler_.on_error(SessionError{SessionErrorCode::NotConnected});
+            return;
+        }
+
+        session_established(req.keepaliveInterval());
+        transition(SessionEvent::LogonAcknowledged);
+        apply_peer_next_seq(req.nextSeqNo());
+    }
+
+    /// Initiator: session bound; recover anything missed while away
+    void handle_establishment_ack(std::span<const char> msg) noexcept {
+        auto ack = sbe::EstablishmentAckCodec::wrapForDecode(msg.data(), msg.size());
+        if (!ack.isValid() || state_ != SessionState::LogonSent ||
+            ack.sessionId() != config_.session_id) return;
+
+        session_established(ack.keepaliveInterval());
+        transition(SessionEvent::LogonReceived);
+        apply_peer_next_seq(ack.nextSeqNo());
+    }
+
+    /// NegotiationReject / EstablishmentReject
+    void handle_reject() noexcept {
+        if (state_ != SessionState::LogonSent) return;
+        handler_.on_error(SessionError{SessionErrorCode::LogonRejected});
+        transition(SessionEvent::LogonRejected);
+    }
+
+    void handle_terminate(std::span<const char> msg) noexcept {
+        auto terminate = sbe::TerminateCodec::wrapForDecode(msg.data(), msg.size());
+        if (!terminate.isValid()) return;
+
+        if (terminate.code() != sbe::FixpTerminationCode::Finished) {
+            handler_.on_error(SessionError{SessionErrorCode::Disconnected});
+        }
+
+        if (state_ == SessionState::LogoutPending) {
+            transition(SessionEvent::LogoutReceived);   // Our Terminate answered
+        } else if (state_ == SessionState::Active) {
+            transition(SessionEvent::LogoutReceived);
+            (void)send_terminate(sbe::FixpTerminationCode::Finished);
+            transition(SessionEvent::LogoutSent);
+        } else {
+            transition(SessionEvent::Disconnect);
+        }
+    }
+
+    // ========================================================================
+    // Inbound Sequencing / Recovery
+    // ========================================================================
+
+    NFX_HOT void handle_app_message(std::span<const char> msg) noexcept {
+        if (state_ != SessionState::Active && state_ != SessionState::LogoutPending) [[unlikely]] {
+            handler_.on_error(SessionError{SessionErrorCode::InvalidState});
+            return;
+        }
+
+        if (retrans_remaining_ != 0) [[unlikely]] {
+            const uint32_t seq = retrans_next_++;
+            inbound_gaps_.fill(seq);
+            handler_.on_app_message(FixpAppMessage{seq, true, msg});
+            if (--retrans_remaining_ == 0) finish_retransmission();
+            return;
+        }
+
+        const uint32_t seq = sequences_.expected_inbound();
+        sequences_.set_inbound(seq + 1);
+        handler_.on_app_message(FixpAppMessage{seq, false, msg});
+    }
+
+    void handle_sequence(std::span<const char> msg) noexcept {
+        auto sequence = sbe::SequenceCodec::wrapForDecode(msg.data(), msg.size());
+        if (!sequence.isValid() || state_ != SessionState::Active) return;
+
+        ++stats_.heartbeats_received;
+        if (retrans_remaining_ != 0) [[unlikely]] {
+            // Replay cut short (peer no longer has the messages): give up on the rest
+            const uint32_t last = retrans_next_ + retrans_remaining_ - 1;
+            for (uint32_t seq = retrans_next_; seq <= last; ++seq) inbound_gaps_.fill(seq);
+            handler_.on_error(SessionError{SessionErrorCode::SequenceGap, retrans_next_, last + 1});
+            finish_retransmission();
+        }
+        apply_peer_next_seq(sequence.nextSeqNo());
+    }
+
+    /// Peer announced its next outbound seq (Establish, Ack, Sequence)
+    void apply_peer_next_seq(uint64_t next) noexcept {
+        const uint32_t expected = sequences_.expected_inbound();
+        const auto received = static_cast<uint32_t>(next);
+
+        if (received < expected) [[unlikely]] {
+            handler_.on_error(SessionError{SessionErrorCode::SequenceGap, expected, received});
+            return;
+        }
+        if (received == expected) return;
+
+        sequences_.set_inbound(received);
+        if (peer_flow_ != sbe::FixpFlowType::Recoverable) {
+            // Idempotent flow: the messages are gone, just report it
+            handler_.on_error(SessionError{SessionErrorCode::SequenceGap, expected, received});
+            return;
+        }
+        (void)inbound_gaps_.add_gap(expected, received - 1);
+        request_next_gap();
+    }
+
+    /// One RetransmitRequest outstanding at a time (FIXP ReRequestInProgress)
+    void request_next_gap() noexcept {
+        if (retransmit_pending_ || !inbound_gaps_.has_gaps()) return;
+
+        const auto& gap = inbound_gaps_.ranges().front();
+        const uint32_t count = std::min(gap.end - gap.begin + 1, config_.max_retransmit_count);
+        if (auto request = add<sbe::RetransmitRequestCodec>()) {
+            request->sessionId(config_.session_id)
+                .timestamp(wall_clock())
+                .fromSeqNo(gap.begin)
+                .count(count);
+        }
+        requested_from_ = gap.begin;
+        requested_count_ = count;
+        retransmit_pending_ = true;
+        ++stats_.resend_requests_sent;
+        flush_sends();
+    }
+
+    void handle_retransmission(std::span<const char> msg) noexcept {
+        auto header = sbe::RetransmissionCodec::wrapForDecode(msg.data(), msg.size());
+        if (!header.isValid() || !retransmit_pending_) return;
+
+        retrans_next_ = static_cast<uint32_t>(header.nextSeqNo());
+        retrans_remaining_ = header.count();
+        if (retrans_remaining_ == 0) finish_retransmission();
+    }
+
+    /// Peer cannot replay the range: drop it and move on
+    void handle_retransmit_reject() noexcept {
+        if (!retransmit_pending_) return;
+
+        const uint32_t last = requested_from_ + requested_count_ - 1;
+        for (uint32_t seq = requested_from_; seq <= last; ++seq) inbound_gaps_.fill(seq);
+        handler_.on_error(SessionError{SessionErrorCode::SequenceGap, requested_from_, last + 1});
+        finish_retransmission();
+    }
+
+    void finish_retransmission() noexcept {
+        retransmit_pending_ = false;
+        retrans_remaining_ = 0;
+        request_next_gap();
+    }
+
+    // ========================================================================
+    // Outbound Recovery
+    // ========================================================================
+
+    /// Replay [from, from + count) from the message store, then resume
+    /// the live stream with a Sequence
+    void handle_retransmit_request(std::span<const char> msg) noexcept {
+        auto req = sbe::RetransmitRequestCodec::wrapForDecode(msg.data(), msg.size());
+        if (!req.isValid() || state_ != SessionState::Active) return;
+
+        const uint64_t from = req.fromSeqNo();
+        const uint32_t count = req.count();
+        const uint32_t last_sent = sequences_.current_outbound() - 1;
+
+        auto code = std::optional<sbe::FixpRetransmitRejectCode>{};
+        if (req.sessionId() != config_.session_id) {
+            code = sbe::FixpRetransmitRejectCode::InvalidSession;
+        } else if (count > config_.max_retransmit_count) {
+            code = sbe::FixpRetransmitRejectCode::RequestLimitExceeded;
+        } else if (!message_store_ || config_.flow != sbe::FixpFlowType::Recoverable ||
+                   count == 0 || from == 0 || from + count - 1 > last_sent) {
+            code = sbe::FixpRetransmitRejectCode::OutOfRange;
+        }
+
+        if (code) {
+            if (auto reject = add<sbe::RetransmitRejectCodec>()) {
+                reject->sessionId(req.sessionId()).requestTimestamp(req.timestamp()).code(*code);
+            }
+            flush_sends();
+            return;
+        }
+
+        flush_sends();  // Queued live messages were sequenced first
+        if (auto header = add<sbe::RetransmissionCodec>()) {
+            header->sessionId(config_.session_id)
+                .requestTimestamp(req.timestamp())
+                .nextSeqNo(from)
+                .count(count);
+        }
+        replay_next_ = static_cast<uint32_t>(from);
+        (void)message_store_->visit_range(replay_next_, replay_next_ + count - 1,
+                                          &replay_visitor, this);
+        stats_.messages_resent += replay_next_ - static_cast<uint32_t>(from);
+        (void)send_sequence();
+    }
+
+    /// Replays must be contiguous: a seqnum missing from the store ends
+    /// the replay early (the peer sees the Sequence and gives up the rest)
+    static bool replay_visitor(void* ctx, uint32_t seq, std::span<const char> stored) noexcept {
+        auto& session = *static_cast<FixpSession*>(ctx);
+        if (seq != session.replay_next_ || !session.append(stored)) return false;
+        ++session.replay_next_;
+        return true;
+    }
+
+    // ========================================================================
+    // Message Sending
+    // ========================================================================
+
+    SessionResult<void> commit_app_message(std::span<const char> encoded) noexcept {
+        const uint32_t seq = sequences_.next_outbound();
+        if (message_store_) (void)message_store_->store(seq, encoded);
+
+        if (!config_.coalesce_sends && !flush_sends()) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        return {};
+    }
+
+    bool send_negotiate() noexcept {
+        if (auto negotiate = add<sbe::NegotiateCodec>()) {
+            negotiate->sessionId(config_.session_id)
+                .timestamp(wall_clock())
+                .clientFlow(config_.flow);
+        }
+        return flush_sends();
+    }
+
+    bool send_establish() noexcept {
+        if (auto establish = add<sbe::EstablishCodec>()) {
+            establish->sessionId(config_.session_id)
+                .timestamp(wall_clock())
+                .nextSeqNo(sequences_.current_outbound())
+                .keepaliveInterval(config_.keepalive_interval_ms);
+        }
+        return flush_sends();
+    }
+
+    bool send_sequence() noexcept {
+        if (auto sequence = add<sbe::SequenceCodec>()) {
+            sequence->nextSeqNo(sequences_.current_outbound());
+        }
+        return flush_sends();
+    }
+
+    bool send_terminate(sbe::FixpTerminationCode code) noexcept {
+        if (auto terminate = add<sbe::TerminateCodec>()) {
+            terminate->sessionId(config_.session_id).code(code);
+        }
+        return flush_sends();
+    }
+
+    /// Reserve a framed codec, flushing once if the frame is full
+    template <typename Codec>
+    [[nodiscard]] std::optional<Codec> add() noexcept {
+        open_frame();
+        auto codec = writer_.template add<Codec>();
+        if (!codec && !writer_.empty()) [[unlikely]] {
+            flush_sends();
+            open_frame();
+            codec = writer_.template add<Codec>();
+        }
+        return codec;
+    }
+
+    /// Copy an encoded message into the frame, flushing once if full
+    [[nodiscard]] bool append(std::span<const char> msg) noexcept {
+        open_frame();
+        if (writer_.append(msg)) return true;
+        if (writer_.empty()) return false;
+        flush_sends();
+        open_frame();
+        return writer_.append(msg);
+    }
+
+    /// Start a new frame in the transport's buffer when the handler has one
+    /// (not when coalescing: the handler expects that buffer back in on_send)
+    void open_frame() noexcept {
+        if constexpr (HasSendBuffer<Handler>) {
+            if (writer_.empty() && !holding_send_buffer_ && !config_.coalesce_sends) {
+                if (auto dest = handler_.acquire_send_buffer(); !dest.empty()) {
+                    writer_ = sbe::SbeFrameWriter<SofhT>{dest};
+                    holding_send_buffer_ = true;
+                }
+            }
+        }
+    }
+
+    void release_frame() noexcept {
+        writer_ = sbe::SbeFrameWriter<SofhT>{std::span<char>{tx_buffer_}};
+        holding_send_buffer_ = false;
+    }
+
+    [[nodiscard]] static Timestamp wall_clock() noexcept {
+        return Timestamp{std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count()};
+    }
+
+    // ========================================================================
+    // Members
+    // ========================================================================
+
+    FixpSessionConfig config_;
+    SessionState state_{SessionState::Disconnected};
+    Handler handler_;
+
+    alignas(8) std::array<char, SEND_BUFFER_SIZE> tx_buffer_;
+    sbe::SbeFrameWriter<SofhT> writer_;
+    bool holding_send_buffer_{false};
+    sbe::SofhDeframer<SofhT> deframer_;
+
+    SequenceManager sequences_;
+    GapTracker inbound_gaps_{GapTracker::DEFAULT_CAPACITY};
+    store::IMessageStore* message_store_{nullptr};
+    SessionStats stats_;
+
+    bool negotiated_{false};
+    sbe::FixpFlowType peer_flow_{sbe::FixpFlowType::Recoverable};
+    uint32_t peer_keepalive_ms_;
+    TimePoint last_sent_{};
+    TimePoint last_received_{};
+
+    // Inbound recovery (one RetransmitRequest in flight)
+    bool retransmit_pending_{false};
+    uint32_t requested_from_{0};
+    uint32_t requested_count_{0};
+    uint32_t retrans_next_{0};
+    uint32_t retrans_remaining_{0};
+
+    // Outbound replay cursor (handle_retransmit_request)
+    uint32_t replay_next_{0};
+};
+
+}  // namespace nfx
@@ -0,0 +1,321 @@
+/*
+    NexusFIX Flight Recorder
+
+    Reconstructs what happened to one inbound message and the orders it
+    triggered. Sessions append a 24-byte record at fixed points of the
+    message path; the last N records stay in a ring that can be dumped
+    on demand or from a signal handler after a latency spike.
+
+        on_data_received --- RecvCqe
+          parse            --- ParseDone
+          handler          --- HandlerEntry ... HandlerExit
+            send_app_message --- BuildDone --- Submit --- SendComplete
+
+    Every inbound message opens a trace with a fresh id (monotonic across
+    the recorder). The id is also made the calling thread's active trace
+    until the handler returns, so a message the handler sends - on this
+    session or on any other session sharing the recorder - carries the id
+    of the tick or ExecutionReport that caused it. Sends outside a handler
+    (timers, strategy threads) open a trace of their own.
+
+    Recording is an rdtscp, one relaxed fetch_add on the ring position and
+    a store into a 32-byte slot. Readers check each slot's stamp (seqlock style) and
+    skip records overwritten while they copied, so dump() never blocks
+    the session threads and is async-signal-safe.
+
+    SendComplete is taken when the handler's on_send() / on_send_batch()
+    returns. Transports that learn of completion later (io_uring send
+    CQE) can record it themselves with trace(TracePoint::SendComplete, ...)
+    using FlightRecorder::active_trace() captured at submit.
+
+    Usage:
+        FlightRecorder recorder{1 << 16};           // Shared by all sessions
+        session_a.set_flight_recorder(&recorder, 1);
+        session_b.set_flight_recorder(&recorder, 2);
+        recorder.dump_on_signal(SIGUSR2, STDERR_FILENO);
+
+        std::vector<TraceRecord> records;
+        recorder.snapshot(records);                 // Oldest first
+        recorder.dump(fd);                          // One text line per record
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <unistd.h>
+#define NFX_FLIGHT_RECORDER_HAS_SIGNALS 1
+#else
+#define NFX_FLIGHT_RECORDER_HAS_SIGNALS 0
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Trace Points
+// ============================================================================
+
+enum class TracePoint : uint8_t {
+    RecvCqe = 0,       // Bytes handed to the session
+    ParseDone,         // Message parsed
+    HandlerEntry,      // About to call the handler
+    HandlerExit,       // Handler returned
+    BuildDone,         // Outbound message sequenced and serialized
+    Submit,            // Passed to the transport (on_send / batch)
+    SendComplete       // Transport accepted it
+};
+
+inline constexpr size_t TRACE_POINT_COUNT = 7;
+
+[[nodiscard]] constexpr std::string_view trace_point_name(TracePoint point) noexcept {
+    constexpr std::array<std::string_view, TRACE_POINT_COUNT> names{
+        "recv", "parsed", "handler_in", "handler_out", "built", "submit", "sent"};
+    const auto idx = static_cast<uint8_t>(point);
+    return idx < names.size() ? names[idx] : "unknown";
+}
+
+// ============================================================================
+// Trace Record
+// ============================================================================
+
+struct TraceRecord {
+    uint64_t tsc{0};
+    uint64_t trace_id{0};
+    uint32_t seq_num{0};       // MsgSeqNum, 0 if not known at that point
+    uint16_t session_id{0};
+    TracePoint point{TracePoint::RecvCqe};
+    uint8_t reserved{0};
+};
+
+static_assert(sizeof(TraceRecord) == 24);
+
+// ============================================================================
+// Flight Recorder
+// ============================================================================
+
+class FlightRecorder {
+public:
+    /// @param capacity Records kept (rounded up to a power of two)
+    explicit FlightRecorder(size_t capacity = 1 << 16)
+        : capacity_{std::bit_ceil(std::max<size_t>(capacity, 2))}
+        , mask_{capacity_ - 1}
+        , slots_{std::make_unique<Slot[]>(capacity_)} {
+        util::RdtscClock::initialize();  // dump() converts with the calibration
+    }
+
+    ~FlightRecorder() {
+        // A signal-time dump must not reach a destroyed recorder
+        FlightRecorder* self = this;
+        (void)signal_target().compare_exchange_strong(self, nullptr);
+    }
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    // ========================================================================
+    // Tracing (any thread)
+    // ========================================================================
+
+    /// Allocate a fresh trace id (never 0)
+    [[nodiscard]] uint64_t next_trace_id() noexcept {
+        return next_id_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /// Trace the calling thread is working on (0 = none)
+    [[nodiscard]] static uint64_t active_trace() noexcept { return active_trace_; }
+
+    /// Make id the active trace until the scope ends (restores the outer one)
+    class Scope {
+    public:
+        explicit Scope(uint64_t id) noexcept : saved_{active_trace_} { active_trace_ = id; }
+        ~Scope() { active_trace_ = saved_; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        uint64_t saved_;
+    };
+
+    /// Append one record
+    NFX_HOT void trace(TracePoint point, uint64_t trace_id, uint16_t session_id,
+                       uint32_t seq_num = 0) noexcept {
+        trace_at(point, trace_id, session_id, seq_num, util::detail::rdtscp());
+    }
+
+    /// Append one record with a timestamp taken earlier
+    NFX_HOT void trace_at(TracePoint point, uint64_t trace_id, uint16_t session_id,
+                          uint32_t seq_num, uint64_t tsc) noexcept {
+        const uint64_t pos = head_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+
+        // Seqlock-style: readers discard the slot while stamp is 0 or moved
+        slot.stamp.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.record.tsc = tsc;
+        slot.record.trace_id = trace_id;
+        slot.record.seq_num = seq_num;
+        slot.record.session_id = session_id;
+        slot.record.point = point;
+        slot.stamp.store(pos + 1, std::memory_order_release);
+    }
+
+    // ========================================================================
+    // Reading (any thread, does not block writers)
+    // ========================================================================
+
+    /// Records ever appended (those older than capacity() are gone)
+    [[nodiscard]] uint64_t recorded() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+
+    /// Copy the retained records into out, oldest first
+    /// Records being overwritten during the copy are skipped.
+    /// @return Number of records copied
+    size_t snapshot(std::vector<TraceRecord>& out) const {
+        out.clear();
+        const uint64_t head = recorded();
+        const uint64_t first = head > capacity_ ? head - capacity_ : 0;
+        out.reserve(static_cast<size_t>(head - first));
+        TraceRecord record;
+        for (uint64_t pos = first; pos < head; ++pos) {
+            if (read_slot(pos, record)) out.push_back(record);
+        }
+        return out.size();
+    }
+
+    /// Write the retained records to fd as text, oldest first
+    ///     <trace_id> <point> session=<id> seq=<n> tsc=<tsc> ns=<epoch ns>
+    /// Async-signal-safe: no allocation, no locks, only write(2).
+    void dump(int fd) const noexcept {
+        const auto cal = util::RdtscClock::calibration();
+        const uint64_t head = recorded();
+        const uint64_t first = head > capacity_ ? head - capacity_ : 0;
+        TraceRecord record;
+        for (uint64_t pos = first; pos < head; ++pos) {
+            if (!read_slot(pos, record)) continue;
+            LineBuffer line;
+            line.append_uint(record.trace_id);
+            line.append(" ");
+            line.append(trace_point_name(record.point));
+            line.append(" session=");
+            line.append_uint(record.session_id);
+            line.append(" seq=");
+            line.append_uint(record.seq_num);
+            line.append(" tsc=");
+            line.append_uint(record.tsc);
+            line.append(" ns=");
+            line.append_uint(util::RdtscClock::to_ns(cal, record.tsc));
+            line.append("\n");
+            write_all(fd, line.data, line.size);
+        }
+    }
+
+    /// Dump to fd whenever signo is delivered
+    /// One recorder per process can be the signal target; fd must stay open.
+    /// @return false if the handler could not be installed
+    bool dump_on_signal(int signo, int fd) noexcept {
+#if NFX_FLIGHT_RECORDER_HAS_SIGNALS
+        signal_fd().store(fd, std::memory_order_relaxed);
+        signal_target().store(this, std::memory_order_release);
+        struct sigaction action{};
+        action.sa_handler = &FlightRecorder::on_signal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        return ::sigaction(signo, &action, nullptr) == 0;
+#else
+        (void)signo;
+        (void)fd;
+        return false;
+#endif
+    }
+
+private:
+    struct alignas(32) Slot {
+        std::atomic<uint64_t> stamp{0};    // Ring position + 1 (0 = being written)
+        TraceRecord record{};
+    };
+
+    bool read_slot(uint64_t pos, TraceRecord& out) const noexcept {
+        const Slot& slot = slots_[pos & mask_];
+        const uint64_t before = slot.stamp.load(std::memory_order_acquire);
+        if (before != pos + 1) return false;
+        out = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.stamp.load(std::memory_order_relaxed) == before;
+    }
+
+    struct LineBuffer {
+        char data[160];
+        size_t size{0};
+
+        void append(std::string_view s) noexcept {
+            const size_t n = std::min(s.size(), sizeof(data) - size);
+            for (size_t i = 0; i < n; ++i) data[size + i] = s[i];
+            size += n;
+        }
+
+        void append_uint(uint64_t v) noexcept {
+            char digits[20];
+            size_t n = 0;
+            do {
+                digits[n++] = static_cast<char>('0' + v % 10);
+                v /= 10;
+            } while (v != 0);
+            while (n != 0 && size < sizeof(data)) data[size++] = digits[--n];
+        }
+    };
+
+    static void write_all(int fd, const char* data, size_t size) noexcept {
+#if NFX_FLIGHT_RECORDER_HAS_SIGNALS
+        while (size != 0) {
+            const ssize_t n = ::write(fd, data, size);
+            if (n <= 0) return;
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+#else
+        (void)fd;
+        (void)data;
+        (void)size;
+#endif
+    }
+
+    static std::atomic<FlightRecorder*>& signal_target() noexcept {
+        static std::atomic<FlightRecorder*> target{nullptr};
+        return target;
+    }
+
+    static std::atomic<int>& signal_fd() noexcept {
+        static std::atomic<int> fd{-1};
+        return fd;
+    }
+
+    static void on_signal(int) noexcept {
+        if (const FlightRecorder* recorder = signal_target().load(std::memory_order_acquire)) {
+            recorder->dump(signal_fd().load(std::memory_order_relaxed));
+        }
+    }
+
+    static inline thread_local uint64_t active_trace_{0};
+
+    size_t capacity_;
+    size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> next_id_{0};
+};
+
+} // namespace nfx
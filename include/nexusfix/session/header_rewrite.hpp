@@ -0,0 +1,265 @@
+/*
+    NexusFIX Header Rewrite
+
+    Forwarding a message from one session to another changes only its
+    standard header; the body goes out byte for byte. A received message
+    splits into three runs:
+
+        8=FIX.4.4|9=178|35=D|49=CLIENT1|56=HUB|34=17|52=...|    header
+        11=ORD1|55=AAPL|54=1|...                                body
+        10=123|                                                 trailer
+
+    forward_parts() writes a new header (BeginString, BodyLength and
+    MsgType as received, then the outbound session's 49/56/34/52 and
+    optional OnBehalfOfCompID(115) / DeliverToCompID(128), then any other
+    header field as received) and a new trailer into a scratch buffer,
+    and returns the body as a view into the received bytes. The CheckSum
+    is the received one with the old header's bytes taken out and the new
+    header's put in; the body is never summed, decoded or re-encoded.
+
+    The three runs go to a gather write as they are, or through
+    rewrite_forwarded() into one buffer (what the resend store needs).
+
+    Header fields are those up to the first non-header tag; data fields
+    carrying SOH (SecureData, 91) are not supported in the header.
+
+    Usage:
+        ForwardHeader header{.sender_comp_id = "HUB", .target_comp_id = "BROKER",
+                             .msg_seq_num = seq, .sending_time = now,
+                             .on_behalf_of_comp_id = msg.sender_comp_id()};
+        size_t n = rewrite_forwarded(msg.raw(), header, out);
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Header Fields
+// ============================================================================
+
+/// Routing fields a forwarded message is sent with (empty = omitted)
+struct ForwardFields {
+    std::string_view on_behalf_of_comp_id{};   // OnBehalfOfCompID(115)
+    std::string_view deliver_to_comp_id{};     // DeliverToCompID(128)
+};
+
+/// Header of a forwarded message as the outbound session sends it
+struct ForwardHeader {
+    std::string_view sender_comp_id{};
+    std::string_view target_comp_id{};
+    uint32_t msg_seq_num{0};
+    std::string_view sending_time{};
+    std::string_view on_behalf_of_comp_id{};   // 115 (empty = omitted)
+    std::string_view deliver_to_comp_id{};     // 128 (empty = omitted)
+};
+
+/// FIX 4.4 standard header tags
+[[nodiscard]] constexpr bool is_standard_header_tag(uint32_t tag) noexcept {
+    switch (tag) {
+        case 8: case 9: case 35: case 49: case 56: case 115: case 128:
+        case 90: case 91: case 34: case 50: case 142: case 57: case 143:
+        case 116: case 144: case 129: case 145: case 43: case 97: case 52:
+        case 122: case 212: case 213: case 347: case 369: case 627: case 628:
+        case 629: case 630: case 1128: case 1129: case 1156:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Header tags forward_parts() writes itself instead of copying
+[[nodiscard]] constexpr bool is_rewritten_header_tag(uint32_t tag) noexcept {
+    switch (tag) {
+        case 8: case 9: case 35: case 49: case 56: case 34: case 52: case 115: case 128:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// ============================================================================
+// Forwarded Message
+// ============================================================================
+
+/// A forwarded message as three runs: new header, received body, new trailer
+struct ForwardedMessage {
+    std::span<const char> header;
+    std::span<const char> body;      // Into the received message
+    std::span<const char> trailer;   // 10=XXX<SOH>
+
+    [[nodiscard]] bool empty() const noexcept { return header.empty(); }
+    [[nodiscard]] size_t size() const noexcept {
+        return header.size() + body.size() + trailer.size();
+    }
+
+    /// Copy the three runs into out; header and trailer may lie in out
+    /// @return Bytes written (0 if out is too small)
+    size_t copy_to(std::span<char> out) const noexcept {
+        if (empty() || out.size() < size()) [[unlikely]] return 0;
+        std::array<char, 7> tail{};
+        std::memcpy(tail.data(), trailer.data(), trailer.size());
+        char* p = out.data();
+        std::memmove(p, header.data(), header.size());
+        p += header.size();
+        std::memcpy(p, body.data(), body.size());
+        p += body.size();
+        std::memcpy(p, tail.data(), trailer.size());
+        return size();
+    }
+};
+
+/// Scratch bytes forward_parts() / rewrite_forwarded() need at most
+[[nodiscard]] constexpr size_t forward_capacity(size_t received_size, const ForwardHeader& header) noexcept {
+    // The received 8=/9=/35= fields cover the new ones but for the length
+    // digits; the rest is tags, SOHs and up to 10 digits each for 9 and 34
+    return received_size + header.sender_comp_id.size() + header.target_comp_id.size() +
+           header.sending_time.size() + header.on_behalf_of_comp_id.size() +
+           header.deliver_to_comp_id.size() + 64;
+}
+
+/// Rewrite the header of a received message, leaving its body in place
+/// @param scratch Receives the new header and trailer; at least
+///        forward_capacity() bytes
+/// @return The three runs; empty if received lacks 8/9/35 and a 10=
+///         trailer or scratch is too small
+[[nodiscard]] NFX_HOT
+inline ForwardedMessage forward_parts(
+    std::span<const char> received,
+    const ForwardHeader& header,
+    std::span<char> scratch) noexcept
+{
+    const std::string_view msg{received.data(), received.size()};
+    if (msg.size() < TRAILER_SIZE + 8 || msg[0] != '8' || msg[1] != '=' ||
+        scratch.size() < forward_capacity(msg.size(), header)) [[unlikely]] {
+        return {};
+    }
+    const size_t trailer = msg.size() - TRAILER_SIZE;
+    if (msg.compare(trailer, 3, "10=") != 0 || msg.back() != '\x01') [[unlikely]] return {};
+
+    // Field at pos: tag, first value byte and the SOH after it
+    struct Field {
+        uint32_t tag;
+        size_t value;
+        size_t end;
+    };
+    auto field_at = [&msg, trailer](size_t pos, Field& out) noexcept {
+        uint32_t tag = 0;
+        size_t i = pos;
+        for (; i < trailer && msg[i] != '='; ++i) {
+            const unsigned digit = static_cast<unsigned char>(msg[i]) - '0';
+            if (digit > 9 || i - pos >= 9) return false;
+            tag = tag * 10 + digit;
+        }
+        if (i == pos || i >= trailer) return false;
+        const size_t end = msg.find('\x01', i + 1);
+        if (end == std::string_view::npos || end >= trailer) return false;
+        out = Field{tag, i + 1, end};
+        return true;
+    };
+
+    // 8=...|9=...|, then header fields up to the first body tag
+    Field field{};
+    if (!field_at(0, field) || field.tag != 8) [[unlikely]] return {};
+    const std::string_view begin_string = msg.substr(field.value, field.end - field.value);
+    if (!field_at(field.end + 1, field) || field.tag != 9) [[unlikely]] return {};
+    const size_t after_length = field.end + 1;
+
+    std::string_view msg_type{};
+    size_t header_end = after_length;
+    while (header_end < trailer) {
+        if (!field_at(header_end, field)) [[unlikely]] return {};
+        if (!is_standard_header_tag(field.tag)) break;
+        if (field.tag == 35) msg_type = msg.substr(field.value, field.end - field.value);
+        header_end = field.end + 1;
+    }
+    if (msg_type.empty()) [[unlikely]] return {};
+
+    auto to_digits = [](size_t value, char (&buf)[16]) noexcept {
+        size_t n = 0;
+        do {
+            buf[15 - n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        return std::string_view{buf + 16 - n, n};
+    };
+
+    // Everything after 9=: written first, leaving room for 8= and 9= before it
+    char* const tail = scratch.data() + begin_string.size() + 16;
+    char* p = tail;
+    auto put = [&p](std::string_view bytes) noexcept {
+        std::memcpy(p, bytes.data(), bytes.size());
+        p += bytes.size();
+    };
+    auto put_field = [&put](std::string_view tag_eq, std::string_view value) noexcept {
+        put(tag_eq);
+        put(value);
+        put("\x01");
+    };
+
+    char seq_buf[16];
+    put_field("35=", msg_type);
+    put_field("49=", header.sender_comp_id);
+    put_field("56=", header.target_comp_id);
+    put_field("34=", to_digits(header.msg_seq_num, seq_buf));
+    put_field("52=", header.sending_time);
+    if (!header.on_behalf_of_comp_id.empty()) put_field("115=", header.on_behalf_of_comp_id);
+    if (!header.deliver_to_comp_id.empty()) put_field("128=", header.deliver_to_comp_id);
+    for (size_t pos = after_length; pos < header_end; pos = field.end + 1) {
+        (void)field_at(pos, field);  // Checked above
+        if (!is_rewritten_header_tag(field.tag)) put(msg.substr(pos, field.end + 1 - pos));
+    }
+
+    // BodyLength: the received body plus the new header after 9=
+    char len_buf[16];
+    const std::string_view length = to_digits(
+        trailer - header_end + static_cast<size_t>(p - tail), len_buf);
+    char* const head = tail - (begin_string.size() + length.size() + 6);
+    std::memcpy(head, "8=", 2);
+    std::memcpy(head + 2, begin_string.data(), begin_string.size());
+    std::memcpy(head + 2 + begin_string.size(), "\x01" "9=", 3);
+    std::memcpy(head + 5 + begin_string.size(), length.data(), length.size());
+    head[5 + begin_string.size() + length.size()] = '\x01';
+
+    // CheckSum: the body's contribution is unchanged
+    const std::string_view new_header{head, static_cast<size_t>(p - head)};
+    parser::IncrementalChecksum sum{parser::parse_checksum(msg.data() + trailer + 3)};
+    sum.replace(msg.substr(0, header_end), new_header);
+    char* const checksum = p;
+    put("10=");
+    parser::format_checksum(sum.finalize(), p);
+    p += 3;
+    put("\x01");
+
+    return ForwardedMessage{
+        std::span<const char>{new_header.data(), new_header.size()},
+        received.subspan(header_end, trailer - header_end),
+        std::span<const char>{checksum, TRAILER_SIZE},
+    };
+}
+
+/// Rewrite the header of a received message into one contiguous buffer
+/// @param out At least forward_capacity() bytes
+/// @return Bytes written; 0 if received is malformed or out too small
+[[nodiscard]] NFX_HOT
+inline size_t rewrite_forwarded(
+    std::span<const char> received,
+    const ForwardHeader& header,
+    std::span<char> out) noexcept
+{
+    const ForwardedMessage parts = forward_parts(received, header, out);
+    return parts.empty() ? 0 : parts.copy_to(out);
+}
+
+} // namespace nfx
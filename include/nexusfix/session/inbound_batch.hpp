@@ -0,0 +1,103 @@
+/*
+    NexusFIX Inbound Batch
+
+    Application messages of one receive completion, parsed and sequenced
+    one by one but handed to the handler together:
+
+        recv -> [8][8][0][8][8] -> seqnum check, admin handling per message
+                                -> on_app_messages({8, 8})   before the 0
+                                -> on_app_messages({8, 8})   end_receive_batch()
+
+    The transport only guarantees a message span for the duration of
+    on_data_received(), so each batched message is copied into the
+    batch's byte arena and parsed there. Arena and message slots are
+    allocated once with the session; stage() fails when either is full
+    and the session delivers what it holds first.
+
+    Used by SessionManager for handlers with on_app_messages() (see
+    HasBatchedDelivery).
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/util/working_set.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Inbound Batch
+// ============================================================================
+
+/// Parsed application messages awaiting one handler call
+class InboundBatch {
+public:
+    static constexpr size_t DEFAULT_ARENA_SIZE = 64 * 1024;
+    static constexpr size_t DEFAULT_MAX_MESSAGES = 64;
+
+    explicit InboundBatch(
+        size_t arena_size = DEFAULT_ARENA_SIZE,
+        size_t max_messages = DEFAULT_MAX_MESSAGES)
+        : arena_(arena_size)
+        , messages_(max_messages ? max_messages : 1) {}
+
+    /// Copy data into the arena and reserve the next message slot
+    /// Nothing is kept until commit(); the next stage() reuses both.
+    /// @param data In: received message, out: its copy in the arena
+    /// @return Slot to parse into, nullptr if the batch is full
+    [[nodiscard]] ParsedMessage* stage(std::span<const char>& data) noexcept {
+        if (count_ == messages_.size() || data.size() > arena_.size() - used_) {
+            return nullptr;
+        }
+        std::memcpy(arena_.data() + used_, data.data(), data.size());
+        data = {arena_.data() + used_, data.size()};
+        staged_ = data.size();
+        return &messages_[count_];
+    }
+
+    /// Keep the message last staged
+    void commit() noexcept {
+        used_ += staged_;
+        staged_ = 0;
+        ++count_;
+    }
+
+    [[nodiscard]] std::span<const ParsedMessage> messages() const noexcept {
+        return {messages_.data(), count_};
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] size_t max_messages() const noexcept { return messages_.size(); }
+
+    /// Arena and message slots, under the owner's names
+    size_t memory_regions(std::span<util::MemoryRegion> out,
+                          std::string_view arena_name = "batch.arena",
+                          std::string_view messages_name = "batch.messages") const noexcept {
+        return util::write_regions(out, {
+            {arena_name, const_cast<char*>(arena_.data()), arena_.size()},
+            {messages_name, const_cast<ParsedMessage*>(messages_.data()),
+             messages_.size() * sizeof(ParsedMessage)}});
+    }
+
+    void clear() noexcept {
+        count_ = 0;
+        used_ = 0;
+        staged_ = 0;
+    }
+
+private:
+    std::vector<char> arena_;
+    std::vector<ParsedMessage> messages_;
+    size_t count_{0};
+    size_t used_{0};
+    size_t staged_{0};
+};
+
+} // namespace nfx
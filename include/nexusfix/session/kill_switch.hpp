@@ -0,0 +1,238 @@
+/*
+    NexusFIX Kill Switch
+
+    Cancel-on-disconnect done by the client: when a risk limit trips or
+    the strategy dies, every open order must be cancelled now, not after
+    one builder call, CheckSum pass and send() per order.
+
+    KillSwitch builds each order's OrderCancelRequest (35=F) when the
+    order is sent (arm()), into a slot of an arena allocated once, with
+    MsgSeqNum 0 as a placeholder. fire() hands them all to the session's
+    send_prebuilt(), which patches only MsgSeqNum, SendingTime and
+    TransactTime (CheckSum adjusted over the patched bytes) and submits
+    the lot as one batch: one writev / io_uring submission per batch
+    arena.
+
+        arm(ORD1) arm(ORD2) arm(ORD3) disarm(ORD2)   fire()
+                                                     -> F(ORD1) F(ORD3) in one submission
+
+    Venues that take OrderMassCancelRequest (35=q) need none of that:
+    with KillSwitchConfig::mass_cancel, fire() sends one 35=q with
+    MassCancelRequestType(530)=7 (all orders) and arm() is not needed.
+
+    Cancel ClOrdIDs are cancel_id_prefix plus a counter; choose a prefix
+    unique to the trading day. The SessionConfig's strings must outlive
+    the kill switch, as they do the session.
+
+    Usage:
+        KillSwitch kill{session_config};
+        entry.user_data = kill.arm(order.cl_ord_id, order.symbol, order.side, order.qty);
+        ...
+        kill.disarm(entry.user_data);   // Filled, cancelled or rejected
+        ...
+        if (breached) kill.fire(session);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Kill Switch
+// ============================================================================
+
+struct KillSwitchConfig {
+    size_t capacity{4096};                  // Orders armed at once
+    size_t slot_size{256};                  // Largest pre-built cancel
+    std::string_view cancel_id_prefix{"KS"};
+    bool mass_cancel{false};                // Venue supports OrderMassCancelRequest (35=q)
+};
+
+struct KillSwitchStats {
+    uint64_t armed{0};
+    uint64_t disarmed{0};
+    uint64_t arm_failures{0};     // Full, or the cancel exceeded slot_size
+    uint64_t fired{0};
+    uint64_t cancels_sent{0};     // Pre-built cancels sequenced by fire()
+    uint64_t mass_cancels_sent{0};
+};
+
+/// Pre-built OrderCancelRequests for every open order, sent in one batch
+class KillSwitch {
+public:
+    /// Slot index and generation; 0 is never a valid handle
+    using Handle = uint64_t;
+    static constexpr Handle INVALID_HANDLE = 0;
+
+    explicit KillSwitch(const SessionConfig& session, const KillSwitchConfig& config = {})
+        : session_{session}
+        , config_{config}
+        , prefix_{config.cancel_id_prefix}
+        , timestamp_{session.timestamp_precision}
+        , storage_(config.capacity * config.slot_size)
+        , slots_(config.capacity)
+        , free_(config.capacity) {
+        armed_.reserve(config.capacity);
+        for (size_t i = 0; i < config.capacity; ++i) {
+            free_[i] = static_cast<uint32_t>(config.capacity - 1 - i);
+        }
+        free_count_ = config.capacity;
+        (void)assembler_.set_session_header(session.begin_string, session.sender_comp_id,
+                                            session.target_comp_id);
+    }
+
+    KillSwitch(const KillSwitch&) = delete;
+    KillSwitch& operator=(const KillSwitch&) = delete;
+
+    /// Pre-build the cancel of an order just sent
+    /// @return Handle for disarm() (fits OrderEntry::user_data);
+    ///         INVALID_HANDLE if every slot is taken or the cancel is too large
+    Handle arm(std::string_view orig_cl_ord_id, std::string_view symbol,
+               Side side, Qty order_qty = {}) noexcept {
+        if (free_count_ == 0) [[unlikely]] {
+            ++stats_.arm_failures;
+            return INVALID_HANDLE;
+        }
+
+        char id_buf[64];
+        const std::string_view cancel_id = next_cancel_id(id_buf);
+        const std::string_view now = timestamp_.get();
+        auto msg = fix44::OrderCancelRequest::Builder{}
+            .sender_comp_id(session_.sender_comp_id)
+            .target_comp_id(session_.target_comp_id)
+            .msg_seq_num(0)
+            .sending_time(now)
+            .orig_cl_ord_id(orig_cl_ord_id)
+            .cl_ord_id(cancel_id)
+            .symbol(symbol)
+            .side(side)
+            .transact_time(now)
+            .order_qty(order_qty)
+            .build(assembler_);
+        if (msg.size() > config_.slot_size) [[unlikely]] {
+            ++stats_.arm_failures;
+            return INVALID_HANDLE;
+        }
+
+        const uint32_t slot = free_[--free_count_];
+        char* dest = storage_.data() + size_t{slot} * config_.slot_size;
+        std::memcpy(dest, msg.data(), msg.size());
+        Slot& s = slots_[slot];
+        s.position = static_cast<uint32_t>(armed_.size());
+        armed_.emplace_back(dest, msg.size());
+        ++stats_.armed;
+        return (uint64_t{s.generation} << 32) | (slot + 1);
+    }
+
+    /// The order is done (filled, cancelled, rejected): drop its cancel
+    /// @return false for a stale or invalid handle
+    bool disarm(Handle handle) noexcept {
+        const uint32_t index = static_cast<uint32_t>(handle);
+        if (index == 0 || index > slots_.size()) return false;
+        const uint32_t slot = index - 1;
+        Slot& s = slots_[slot];
+        if (s.generation != static_cast<uint32_t>(handle >> 32) || s.position == NOT_ARMED) {
+            return false;
+        }
+
+        // Swap-remove from the dense list fire() sends
+        const uint32_t last = static_cast<uint32_t>(armed_.size() - 1);
+        if (s.position != last) {
+            armed_[s.position] = armed_[last];
+            slots_[slot_of(armed_[last])].position = s.position;
+        }
+        armed_.pop_back();
+        s.position = NOT_ARMED;
+        ++s.generation;
+        free_[free_count_++] = slot;
+        ++stats_.disarmed;
+        return true;
+    }
+
+    /// Cancel every armed order through session (a SessionManager)
+    /// Cancels stay armed until disarm(): the orders are open until the
+    /// venue confirms each cancel.
+    /// @return Messages sent (pre-built cancels, or 1 for a mass cancel)
+    template <typename Session>
+    size_t fire(Session& session) noexcept {
+        ++stats_.fired;
+        if (config_.mass_cancel) {
+            char id_buf[64];
+            const std::string_view now = timestamp_.get();
+            auto builder = fix44::OrderMassCancelRequest::Builder{}
+                .cl_ord_id(next_cancel_id(id_buf))
+                .request_type(MassCancelRequestType::AllOrders)
+                .transact_time(now);
+            if (!session.send_app_message(builder, true)) return 0;
+            ++stats_.mass_cancels_sent;
+            return 1;
+        }
+        const size_t sent = session.send_prebuilt(cancels()).accepted;
+        stats_.cancels_sent += sent;
+        return sent;
+    }
+
+    /// Pre-built cancels fire() sends, in no particular order
+    [[nodiscard]] std::span<const std::span<const char>> cancels() const noexcept { return armed_; }
+    [[nodiscard]] size_t armed() const noexcept { return armed_.size(); }
+    [[nodiscard]] size_t capacity() const noexcept { return slots_.size(); }
+    [[nodiscard]] const KillSwitchStats& stats() const noexcept { return stats_; }
+
+private:
+    static constexpr uint32_t NOT_ARMED = UINT32_MAX;
+
+    struct Slot {
+        uint32_t generation{1};
+        uint32_t position{NOT_ARMED};   // Index in armed_
+    };
+
+    [[nodiscard]] uint32_t slot_of(std::span<const char> cancel) const noexcept {
+        return static_cast<uint32_t>(
+            static_cast<size_t>(cancel.data() - storage_.data()) / config_.slot_size);
+    }
+
+    /// cancel_id_prefix followed by a per-switch counter
+    [[nodiscard]] std::string_view next_cancel_id(char (&buf)[64]) noexcept {
+        const size_t prefix = std::min(prefix_.size(), sizeof(buf) - 20);
+        std::memcpy(buf, prefix_.data(), prefix);
+        char digits[20];
+        size_t n = 0;
+        uint64_t value = ++cancel_ids_;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        for (size_t i = 0; i < n; ++i) buf[prefix + i] = digits[n - 1 - i];
+        return {buf, prefix + n};
+    }
+
+    SessionConfig session_;
+    KillSwitchConfig config_;
+    std::string prefix_;
+    util::RdtscTimestamp timestamp_;
+    MessageAssembler assembler_;
+    std::vector<char> storage_;                 // capacity * slot_size
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_;
+    size_t free_count_{0};
+    std::vector<std::span<const char>> armed_;  // Dense, for fire()
+    uint64_t cancel_ids_{0};
+    KillSwitchStats stats_;
+};
+
+} // namespace nfx
@@ -0,0 +1,234 @@
+/*
+    NexusFIX Hot-Path Latency Histograms
+
+    Always-on latency distributions for the four legs of a message's trip
+    through SessionManager, recorded as rdtscp cycle deltas:
+
+        on_data_received ─┬─ RecvToParse ──── parse done
+                          └─ ParseToHandler ─ dispatch (validation, audit)
+        send_app_message ─┬─ HandlerToSend ── sequenced and serialized
+                          └─ SendToWire ───── handler's on_send() / batch write
+
+    Buckets are HDR-style log-linear: 16 linear sub-buckets per power of
+    two, so any recorded value lands in a bucket within 1/16 (6.25%) of
+    it, from 1 cycle up to 2^32 cycles (beyond that: the last bucket).
+    Recording is a bit_width, a shift and an increment.
+
+    The session thread records into private, cache-line-aligned counts
+    and publishes a copy into a VersionedValue every PUBLISH_EVERY samples
+    and on on_timer_tick(); a monitoring thread reads that copy without
+    locking (seqlock retry). Snapshots lag the live counts by at most one
+    publish interval.
+
+    Compile-time option: configure with -DNFX_ENABLE_LATENCY_HISTOGRAMS=ON
+    (defines NFX_HAS_LATENCY_HISTOGRAMS=1). Without it the recorder in
+    SessionManager is an empty [[no_unique_address]] member whose calls
+    compile to nothing, and snapshots are empty.
+
+    Usage:
+        // Monitoring thread
+        const LatencySnapshot snap = session.latency().snapshot();
+        const auto& parse = snap[LatencyStage::RecvToParse];
+        double p99 = parse.percentile_ns(99.0);
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#ifndef NFX_HAS_LATENCY_HISTOGRAMS
+#define NFX_HAS_LATENCY_HISTOGRAMS 0
+#endif
+
+namespace nfx {
+
+inline constexpr bool LATENCY_HISTOGRAMS_ENABLED = NFX_HAS_LATENCY_HISTOGRAMS;
+
+// ============================================================================
+// Stages
+// ============================================================================
+
+enum class LatencyStage : uint8_t {
+    RecvToParse = 0,
+    ParseToHandler,
+    HandlerToSend,
+    SendToWire
+};
+
+inline constexpr size_t LATENCY_STAGE_COUNT = 4;
+
+[[nodiscard]] constexpr std::string_view latency_stage_name(LatencyStage stage) noexcept {
+    constexpr std::array<std::string_view, LATENCY_STAGE_COUNT> names{
+        "recv->parse", "parse->handler", "handler->send", "send->wire"};
+    const auto idx = static_cast<uint8_t>(stage);
+    return idx < names.size() ? names[idx] : "unknown";
+}
+
+// ============================================================================
+// Log-Linear Histogram
+// ============================================================================
+
+/// Cycle-count histogram with 6.25% bucket resolution
+/// Trivially copyable, so a whole set can be published through a seqlock.
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    static constexpr uint32_t MAX_BITS = 32;       // Values >= 2^32 share the last bucket
+    static constexpr size_t BUCKETS = (MAX_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    /// Bucket of value: exact below 16, then 16 per power of two
+    [[nodiscard]] static constexpr size_t bucket_of(uint64_t value) noexcept {
+        if (value < SUB_BUCKETS) return static_cast<size_t>(value);
+        const uint32_t msb = static_cast<uint32_t>(std::bit_width(value)) - 1;
+        if (msb >= MAX_BITS) return BUCKETS - 1;
+        const uint32_t group = msb - SUB_BUCKET_BITS + 1;
+        return group * SUB_BUCKETS +
+               static_cast<size_t>((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    }
+
+    /// Smallest value that lands in bucket
+    [[nodiscard]] static constexpr uint64_t bucket_floor(size_t bucket) noexcept {
+        const size_t group = bucket / SUB_BUCKETS;
+        const uint64_t sub = bucket % SUB_BUCKETS;
+        if (group == 0) return sub;
+        return (SUB_BUCKETS + sub) << (group - 1);
+    }
+
+    NFX_HOT void record(uint64_t cycles) noexcept {
+        ++counts_[bucket_of(cycles)];
+        ++count_;
+        sum_ += cycles;
+        if (cycles > max_) max_ = cycles;
+    }
+
+    void reset() noexcept { *this = LatencyHistogram{}; }
+
+    /// Add other's samples (e.g. per-thread histograms into a total)
+    void merge(const LatencyHistogram& other) noexcept {
+        for (size_t b = 0; b < BUCKETS; ++b) counts_[b] += other.counts_[b];
+        count_ += other.count_;
+        sum_ += other.sum_;
+        if (other.max_ > max_) max_ = other.max_;
+    }
+
+    [[nodiscard]] uint64_t count() const noexcept { return count_; }
+    [[nodiscard]] uint64_t max() const noexcept { return max_; }
+    [[nodiscard]] uint64_t sum() const noexcept { return sum_; }
+    [[nodiscard]] uint64_t count_at(size_t bucket) const noexcept { return counts_[bucket]; }
+
+    [[nodiscard]] double mean() const noexcept {
+        return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0;
+    }
+
+    /// Lower bound of the bucket holding the p-th percentile, in cycles
+    [[nodiscard]] uint64_t percentile(double p) const noexcept {
+        if (count_ == 0) return 0;
+        const double target = p / 100.0 * static_cast<double>(count_);
+        uint64_t rank = static_cast<uint64_t>(target);
+        if (static_cast<double>(rank) < target || rank == 0) ++rank;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            seen += counts_[b];
+            if (seen >= rank) return bucket_floor(b);
+        }
+        return max_;
+    }
+
+    /// percentile() converted with the calibrated TSC frequency
+    [[nodiscard]] double percentile_ns(double p) const noexcept {
+        const double ghz = util::RdtscClock::frequency_ghz();
+        return ghz > 0.0 ? static_cast<double>(percentile(p)) / ghz : 0.0;
+    }
+
+private:
+    std::array<uint64_t, BUCKETS> counts_{};
+    uint64_t count_{0};
+    uint64_t sum_{0};
+    uint64_t max_{0};
+};
+
+/// One histogram per stage
+struct LatencySnapshot {
+    std::array<LatencyHistogram, LATENCY_STAGE_COUNT> stages{};
+
+    [[nodiscard]] const LatencyHistogram& operator[](LatencyStage stage) const noexcept {
+        return stages[static_cast<uint8_t>(stage)];
+    }
+};
+
+// ============================================================================
+// Latency Recorder
+// ============================================================================
+
+/// Session-thread recorder publishing snapshots for other threads
+/// @tparam Enabled false: empty, every call a no-op
+template <bool Enabled = LATENCY_HISTOGRAMS_ENABLED>
+class LatencyRecorder;
+
+template <>
+class LatencyRecorder<false> {
+public:
+    [[nodiscard]] static constexpr uint64_t stamp() noexcept { return 0; }
+    static constexpr void record(LatencyStage, uint64_t, uint64_t) noexcept {}
+    static constexpr void publish() noexcept {}
+    static constexpr void reset() noexcept {}
+    [[nodiscard]] static LatencySnapshot snapshot() noexcept { return {}; }
+};
+
+template <>
+class LatencyRecorder<true> {
+public:
+    static constexpr uint64_t PUBLISH_EVERY = 4096;    // Samples between publishes
+
+    LatencyRecorder() : state_{std::make_unique<State>()} {}
+
+    /// rdtscp reading to pass to record()
+    [[nodiscard]] NFX_HOT static uint64_t stamp() noexcept { return util::detail::rdtscp(); }
+
+    /// Record end - start for stage (session thread)
+    NFX_HOT void record(LatencyStage stage, uint64_t start, uint64_t end) noexcept {
+        State& s = *state_;
+        s.live.stages[static_cast<uint8_t>(stage)].record(end - start);
+        if (++s.since_publish >= PUBLISH_EVERY) [[unlikely]] publish();
+    }
+
+    /// Make the live counts visible to snapshot() (session thread)
+    void publish() noexcept {
+        State& s = *state_;
+        if (s.since_publish == 0) return;
+        s.published.write(s.live);
+        s.since_publish = 0;
+    }
+
+    /// Clear the live counts and publish the empty set (session thread)
+    void reset() noexcept {
+        State& s = *state_;
+        s.live = LatencySnapshot{};
+        s.published.write(s.live);
+        s.since_publish = 0;
+    }
+
+    /// Last published counts (any thread, lock-free)
+    [[nodiscard]] LatencySnapshot snapshot() const noexcept { return state_->published.read().value; }
+
+private:
+    // ~15 KiB per set: kept off the SessionManager object
+    struct State {
+        alignas(CACHE_LINE_SIZE) LatencySnapshot live{};
+        uint64_t since_publish{0};
+        memory::VersionedValue<LatencySnapshot> published;
+    };
+
+    std::unique_ptr<State> state_;
+};
+
+} // namespace nfx
@@ -0,0 +1,408 @@
+/*
+    NexusFIX Market Data Subscription Manager
+
+    Startup subscription of thousands of symbols without flooding the
+    session or tripping the venue's message-rate limit:
+
+        add("AAPL"), add("MSFT"), ... x4000
+              |
+              v  packed batch_size symbols per 35=V (NoRelatedSym group)
+        [ NFX1: 64 syms ][ NFX2: 64 syms ] ... [ NFX63: 32 syms ]
+              |
+              v  paced by a TokenBucket (requests_per_second, burst)
+        poll(now, send) -> session.send_app_message(builder)
+
+    Each request's MDReqID maps to its symbol set as SymbolRegistry ids,
+    so a MarketDataRequestReject (35=Y) is resolved back to the symbols
+    it covered and handled by MDReqRejReason:
+
+        UnknownSymbol, InsufficientPermissions   batch split in half and
+                                                 resent until the bad
+                                                 symbol is alone -> Failed
+        DuplicateMDReqID                         resent under a new MDReqID
+        InsufficientCredit, Other                resent after retry_delay
+                                                 (doubling), up to max_retries
+        Unsupported*                             configuration error -> Failed
+
+    The manager never reads a clock: callers pass a monotonic nanosecond
+    time to poll() and on_reject(), and can sleep until next_poll().
+
+    Usage:
+        MarketDataSubscriptions<> subs{symbols, {.batch_size = 64, .requests_per_second = 20}};
+        for (auto s : universe) subs.add(s);
+
+        // Event loop
+        subs.poll(now_ns, [&](fix44::MarketDataRequest::Builder& b) {
+            return session.send_app_message(b).has_value();
+        });
+
+        void on_message(MsgTypeTag<'Y'>, const ParsedMessage& m) noexcept {
+            if (auto r = fix44::MarketDataRequestReject::from_buffer(m.raw())) subs.on_reject(*r, now_ns);
+        }
+
+    Setup-path code: request bookkeeping uses std::vector. Single-threaded
+    (session thread).
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/util/token_bucket.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Subscription Types
+// ============================================================================
+
+/// Entry types requested by default (top of book)
+inline constexpr std::array<MDEntryType, 2> DEFAULT_MD_ENTRY_TYPES{
+    MDEntryType::Bid, MDEntryType::Offer
+};
+
+/// Where a symbol's subscription stands
+enum class SubscriptionStatus : uint8_t {
+    None,       // Not added
+    Queued,     // Waiting for a request slot or a token
+    Sent,       // Request sent, no market data seen yet
+    Active,     // Market data received (on_market_data)
+    Failed      // Rejected for good (unknown symbol, no permission, ...)
+};
+
+/// Subscription pacing and request contents
+struct SubscriptionConfig {
+    size_t batch_size{fix44::MarketDataRequest::Builder::MAX_SYMBOLS};  // Symbols per 35=V
+    uint64_t requests_per_second{20};           // Sustained request rate
+    uint64_t burst{5};                          // Requests sent back to back
+    uint32_t max_retries{3};                    // Resends after transient rejects
+    uint64_t retry_delay_ns{1'000'000'000};     // First resend delay (doubles)
+
+    int market_depth{0};                        // 264 (0 = full book)
+    MDUpdateType md_update_type{MDUpdateType::IncrementalRefresh};
+    bool aggregated_book{true};
+    std::span<const MDEntryType> entry_types{DEFAULT_MD_ENTRY_TYPES};
+    std::string_view md_req_id_prefix{"NFX"};   // MDReqID = prefix + request number
+};
+
+/// Subscription counters
+struct SubscriptionStats {
+    uint64_t requests_sent{0};
+    uint64_t symbols_sent{0};
+    uint64_t rejects{0};
+    uint64_t retries{0};          // Requests resent after a transient reject
+    uint64_t splits{0};           // Batches halved to isolate a bad symbol
+    uint64_t failed_symbols{0};
+};
+
+// ============================================================================
+// Market Data Subscriptions
+// ============================================================================
+
+/// Batched, rate-paced MarketDataRequest sender with reject handling
+/// @tparam MaxSymbols SymbolRegistry capacity
+template <size_t MaxSymbols = 4096>
+class MarketDataSubscriptions {
+public:
+    using Registry = store::SymbolRegistry<MaxSymbols>;
+    using SymbolId = store::SymbolId;
+
+    static constexpr uint32_t NO_REQUEST = UINT32_MAX;
+
+    /// @param symbols Registry the ids are interned into (shared with the books)
+    explicit MarketDataSubscriptions(Registry& symbols, const SubscriptionConfig& config = {}) noexcept
+        : symbols_{symbols}
+        , config_{config}
+        , bucket_{config.requests_per_second, config.burst} {
+        config_.batch_size = std::clamp<size_t>(config_.batch_size, 1,
+                                                fix44::MarketDataRequest::Builder::MAX_SYMBOLS);
+    }
+
+    // ========================================================================
+    // Setup
+    // ========================================================================
+
+    /// Intern a symbol and queue its subscription (no-op if already added)
+    /// @return Symbol id, or INVALID_SYMBOL if the registry is full
+    SymbolId add(std::string_view symbol) {
+        const SymbolId id = symbols_.intern(symbol);
+        if (id != store::INVALID_SYMBOL && status_[id] == SubscriptionStatus::None) {
+            status_[id] = SubscriptionStatus::Queued;
+            queue_.push_back(id);
+        }
+        return id;
+    }
+
+    /// Queue every symbol of a list
+    /// @return Number of symbols with an id
+    size_t add(std::span<const std::string_view> symbols) {
+        size_t added = 0;
+        for (std::string_view s : symbols) {
+            if (add(s) != store::INVALID_SYMBOL) ++added;
+        }
+        return added;
+    }
+
+    // ========================================================================
+    // Event Loop
+    // ========================================================================
+
+    /// Pack queued symbols and send every due request the bucket allows
+    /// @param send Callable taking fix44::MarketDataRequest::Builder&,
+    ///             returning false if the session could not send
+    /// @return Requests sent
+    template <typename Sender>
+    size_t poll(uint64_t now_ns, Sender&& send) {
+        pack();
+
+        size_t sent = 0;
+        size_t kept = 0;
+        bool blocked = false;
+        for (size_t i = 0; i < ready_.size(); ++i) {
+            const uint32_t r = ready_[i];
+            if (!blocked && requests_[r].due_ns <= now_ns) {
+                if (!bucket_.try_acquire(now_ns)) {
+                    blocked = true;
+                } else if (send_request(r, send)) {
+                    ++sent;
+                    continue;
+                } else {
+                    blocked = true;  // Session cannot send; keep order
+                }
+            }
+            ready_[kept++] = r;
+        }
+        ready_.resize(kept);
+        return sent;
+    }
+
+    /// Earliest time poll() can send something (UINT64_MAX if nothing waits)
+    [[nodiscard]] uint64_t next_poll(uint64_t now_ns) const noexcept {
+        uint64_t due = queue_.size() > queue_head_ ? now_ns : UINT64_MAX;
+        for (uint32_t r : ready_) due = std::min(due, requests_[r].due_ns);
+        if (due == UINT64_MAX) return due;
+        return std::max({due, now_ns, bucket_.next_available(now_ns)});
+    }
+
+    /// Handle a MarketDataRequestReject (35=Y) for one of our requests
+    /// @return false if the MDReqID is not one of ours (or already handled)
+    bool on_reject(const fix44::MarketDataRequestReject& reject, uint64_t now_ns) {
+        const uint32_t r = find_request(reject.md_req_id);
+        if (r == NO_REQUEST || requests_[r].state != RequestState::Sent) return false;
+
+        Request& req = requests_[r];
+        req.state = RequestState::Rejected;
+        ++stats_.rejects;
+
+        switch (reject.md_req_rej_reason) {
+            case MDReqRejReason::UnknownSymbol:
+            case MDReqRejReason::InsufficientPermissions:
+                if (req.ids.size() > 1) {
+                    // Bisect: the good half goes through, the bad one splits again
+                    // (enqueue() grows requests_, so take what we need first)
+                    const uint32_t attempts = req.attempts;
+                    std::vector<SymbolId> ids = std::move(req.ids);
+                    const auto mid = ids.begin() + static_cast<std::ptrdiff_t>(ids.size() / 2);
+                    enqueue(std::vector<SymbolId>(ids.begin(), mid), attempts, now_ns);
+                    enqueue(std::vector<SymbolId>(mid, ids.end()), attempts, now_ns);
+                    ++stats_.splits;
+                } else {
+                    fail(req);
+                }
+                break;
+
+            case MDReqRejReason::DuplicateMDReqID:
+                retry(req, now_ns);
+                break;
+
+            case MDReqRejReason::InsufficientCredit:
+            case MDReqRejReason::Other: {
+                const uint32_t shift = std::min<uint32_t>(req.attempts, 20);
+                retry(req, now_ns + (config_.retry_delay_ns << shift));
+                break;
+            }
+
+            default:
+                fail(req);  // Unsupported request contents: resending cannot help
+                break;
+        }
+        return true;
+    }
+
+    /// Mark a symbol's subscription confirmed (first 35=W / 35=X seen)
+    void on_market_data(SymbolId id) noexcept {
+        if (id < MaxSymbols && status_[id] == SubscriptionStatus::Sent) {
+            status_[id] = SubscriptionStatus::Active;
+        }
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] SubscriptionStatus status(SymbolId id) const noexcept {
+        return id < MaxSymbols ? status_[id] : SubscriptionStatus::None;
+    }
+
+    /// MDReqID of the request currently covering a symbol (empty if none)
+    [[nodiscard]] std::string_view md_req_id(SymbolId id) const noexcept {
+        if (id >= MaxSymbols || request_of_[id] == NO_REQUEST) return {};
+        return requests_[request_of_[id]].md_req_id();
+    }
+
+    /// Symbols of a request by MDReqID (empty if unknown)
+    [[nodiscard]] std::span<const SymbolId> symbols_of(std::string_view md_req_id) const noexcept {
+        const uint32_t r = find_request(md_req_id);
+        return r == NO_REQUEST ? std::span<const SymbolId>{} : std::span<const SymbolId>{requests_[r].ids};
+    }
+
+    /// Symbols not yet sent (queued or waiting for a retry)
+    [[nodiscard]] size_t waiting() const noexcept {
+        size_t n = queue_.size() - queue_head_;
+        for (uint32_t r : ready_) n += requests_[r].ids.size();
+        return n;
+    }
+
+    /// True once every added symbol has been sent or has failed
+    [[nodiscard]] bool idle() const noexcept {
+        return queue_head_ == queue_.size() && ready_.empty();
+    }
+
+    [[nodiscard]] const SubscriptionStats& stats() const noexcept { return stats_; }
+
+    [[nodiscard]] const SubscriptionConfig& config() const noexcept { return config_; }
+
+private:
+    enum class RequestState : uint8_t { Ready, Sent, Rejected };
+
+    struct Request {
+        std::vector<SymbolId> ids;
+        uint64_t due_ns{0};
+        uint32_t attempts{0};                  // Transient rejects so far
+        RequestState state{RequestState::Ready};
+        std::array<char, 32> id_buf{};
+        uint8_t id_len{0};
+
+        [[nodiscard]] std::string_view md_req_id() const noexcept { return {id_buf.data(), id_len}; }
+    };
+
+    /// Turn queued symbols into batch_size requests
+    void pack() {
+        while (queue_head_ < queue_.size()) {
+            const size_t n = std::min(config_.batch_size, queue_.size() - queue_head_);
+            const auto first = queue_.begin() + static_cast<std::ptrdiff_t>(queue_head_);
+            enqueue(std::vector<SymbolId>(first, first + static_cast<std::ptrdiff_t>(n)), 0, 0);
+            queue_head_ += n;
+        }
+        queue_.clear();
+        queue_head_ = 0;
+    }
+
+    /// New request (fresh MDReqID) for ids, sent once due
+    void enqueue(std::vector<SymbolId> ids, uint32_t attempts, uint64_t due_ns) {
+        const auto r = static_cast<uint32_t>(requests_.size());
+        Request& req = requests_.emplace_back();
+        req.ids = std::move(ids);
+        req.attempts = attempts;
+        req.due_ns = due_ns;
+
+        const std::string_view prefix = config_.md_req_id_prefix.substr(
+            0, std::min<size_t>(config_.md_req_id_prefix.size(), req.id_buf.size() - 11));
+        std::copy(prefix.begin(), prefix.end(), req.id_buf.begin());
+        auto [end, ec] = std::to_chars(req.id_buf.data() + prefix.size(),
+                                       req.id_buf.data() + req.id_buf.size(), r + 1);
+        (void)ec;
+        req.id_len = static_cast<uint8_t>(end - req.id_buf.data());
+
+        for (SymbolId id : req.ids) {
+            status_[id] = SubscriptionStatus::Queued;
+            request_of_[id] = r;
+        }
+        ready_.push_back(r);
+    }
+
+    /// Resend a rejected request's symbols, or fail them past max_retries
+    void retry(Request& req, uint64_t due_ns) {
+        if (req.attempts >= config_.max_retries) {
+            fail(req);
+            return;
+        }
+        ++stats_.retries;
+        const uint32_t attempts = req.attempts + 1;
+        enqueue(std::move(req.ids), attempts, due_ns);  // Invalidates req
+    }
+
+    void fail(Request& req) noexcept {
+        for (SymbolId id : req.ids) {
+            status_[id] = SubscriptionStatus::Failed;
+        }
+        stats_.failed_symbols += req.ids.size();
+    }
+
+    template <typename Sender>
+    bool send_request(uint32_t r, Sender& send) {
+        Request& req = requests_[r];
+        fix44::MarketDataRequest::Builder builder;
+        builder.md_req_id(req.md_req_id())
+               .subscription_type(SubscriptionRequestType::SnapshotPlusUpdates)
+               .market_depth(config_.market_depth)
+               .md_update_type(config_.md_update_type)
+               .aggregated_book(config_.aggregated_book);
+        for (MDEntryType type : config_.entry_types) {
+            builder.add_entry_type(type);
+        }
+        for (SymbolId id : req.ids) {
+            builder.add_symbol(symbols_.symbol(id));
+        }
+        if (!send(builder)) return false;
+
+        req.state = RequestState::Sent;
+        for (SymbolId id : req.ids) {
+            status_[id] = SubscriptionStatus::Sent;
+        }
+        ++stats_.requests_sent;
+        stats_.symbols_sent += req.ids.size();
+        return true;
+    }
+
+    /// Request index from an MDReqID of ours (NO_REQUEST if not ours)
+    [[nodiscard]] uint32_t find_request(std::string_view md_req_id) const noexcept {
+        const std::string_view prefix = config_.md_req_id_prefix;
+        if (!md_req_id.starts_with(prefix)) return NO_REQUEST;
+        uint32_t n = 0;
+        const char* first = md_req_id.data() + prefix.size();
+        const char* last = md_req_id.data() + md_req_id.size();
+        auto [ptr, ec] = std::from_chars(first, last, n);
+        if (ec != std::errc{} || ptr != last || n == 0 || n > requests_.size()) return NO_REQUEST;
+        return n - 1;
+    }
+
+    Registry& symbols_;
+    SubscriptionConfig config_;
+    util::TokenBucket bucket_;
+
+    std::vector<SymbolId> queue_;          // Added, not yet packed
+    size_t queue_head_{0};
+    std::vector<Request> requests_;        // Index + 1 = MDReqID number
+    std::vector<uint32_t> ready_;          // Requests waiting to be sent, oldest first
+
+    std::array<SubscriptionStatus, MaxSymbols> status_{};
+    std::array<uint32_t, MaxSymbols> request_of_ = [] {
+        std::array<uint32_t, MaxSymbols> a{};
+        a.fill(NO_REQUEST);
+        return a;
+    }();
+
+    SubscriptionStats stats_{};
+};
+
+} // namespace nfx
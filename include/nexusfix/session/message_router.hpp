@@ -0,0 +1,285 @@
+/*
+    NexusFIX Message Router
+
+    Hub forwarding between sessions. Each application message received on
+    one session is looked up by (SenderCompID, DeliverToCompID or else
+    TargetCompID, MsgType) in a route table built at setup, and handed to
+    the destination session's forward_message(): the header is rewritten
+    to that session's CompIDs, MsgSeqNum and SendingTime, and the body
+    goes out as received (see header_rewrite.hpp).
+
+        CLIENT1 --35=D 49=CLIENT1 56=HUB 128=BROKER--> hub
+        hub     --35=D 49=HUB 56=BROKER 115=CLIENT1--> BROKER
+
+    Rules may leave any key field empty as a wildcard. The most specific
+    rule wins: fewer wildcards first, then SenderCompID, DeliverTo, MsgType
+    in that order. Only the wildcard patterns some rule uses are probed,
+    so an exact-match table costs one hash probe per message.
+
+    Destinations are sessions with forward_message(msg, fields) (any
+    SessionManager); the router keeps a context pointer and a function
+    pointer per destination, so sessions with different handlers mix.
+
+    Usage (from the inbound sessions' on_app_message):
+        MessageRouter<> router;
+        auto broker = router.add_destination(broker_session);
+        auto client = router.add_destination(client_session);
+        router.add_route({.sender_comp_id = "CLIENT1", .destination = broker});
+        router.add_route({.sender_comp_id = "BROKER", .deliver_to = "CLIENT1",
+                          .destination = client});
+        ...
+        void on_app_message(const ParsedMessage& msg) noexcept { router.route(msg); }
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/session/header_rewrite.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Route Rules
+// ============================================================================
+
+struct RouteRule {
+    std::string_view sender_comp_id{};   // SenderCompID(49) received ("" = any)
+    std::string_view deliver_to{};       // DeliverToCompID(128), else TargetCompID(56) ("" = any)
+    std::string_view msg_type{};         // MsgType(35) ("" = any)
+    uint32_t destination{0};             // From MessageRouter::add_destination()
+
+    /// Send with OnBehalfOfCompID(115) = the received SenderCompID
+    bool on_behalf_of{true};
+};
+
+/// Outcome of MessageRouter::route()
+enum class RouteOutcome : uint8_t {
+    Forwarded,
+    NoRoute,    // No rule matches
+    Failed      // The destination refused it (not logged on, throttled, malformed)
+};
+
+/// Where a matching rule sends a message
+struct Route {
+    uint32_t destination{0};
+    bool on_behalf_of{true};
+};
+
+struct RouterStats {
+    uint64_t forwarded{0};
+    uint64_t unroutable{0};
+    uint64_t failed{0};
+};
+
+// ============================================================================
+// Route Table
+// ============================================================================
+
+/// (SenderCompID, DeliverTo, MsgType) -> Route, open addressing with wildcards
+/// Filled at setup (insert() allocates the key strings); find() is
+/// allocation-free.
+/// @tparam MaxRoutes Rules; the table is kept at most half full
+template <size_t MaxRoutes = 1024>
+class RouteTable {
+    static_assert(MaxRoutes > 0, "MaxRoutes must be positive");
+
+    static constexpr size_t TABLE_SIZE = std::bit_ceil(MaxRoutes * 2);
+    static constexpr size_t TABLE_MASK = TABLE_SIZE - 1;
+
+    // Key fields a rule sets
+    static constexpr uint8_t SENDER = 1;
+    static constexpr uint8_t DELIVER_TO = 2;
+    static constexpr uint8_t MSG_TYPE = 4;
+
+    // Probe order: fewer wildcards first; ties by sender, deliver-to, type
+    static constexpr std::array<uint8_t, 8> PATTERN_ORDER{
+        SENDER | DELIVER_TO | MSG_TYPE,
+        SENDER | DELIVER_TO,
+        SENDER | MSG_TYPE,
+        DELIVER_TO | MSG_TYPE,
+        SENDER,
+        DELIVER_TO,
+        MSG_TYPE,
+        0,
+    };
+
+public:
+    RouteTable() = default;
+
+    RouteTable(const RouteTable&) = delete;
+    RouteTable& operator=(const RouteTable&) = delete;
+
+    /// @return false if a rule with the same key is present or the table is full
+    bool insert(const RouteRule& rule) {
+        if (count_ == MaxRoutes) return false;
+
+        const uint8_t pattern = pattern_of(rule);
+        const uint64_t h = hash(pattern, rule.sender_comp_id, rule.deliver_to, rule.msg_type);
+        size_t i = h & TABLE_MASK;
+        for (; entries_[i].used; i = (i + 1) & TABLE_MASK) {
+            if (matches(entries_[i], h, pattern, rule.sender_comp_id, rule.deliver_to, rule.msg_type)) {
+                return false;
+            }
+        }
+
+        Entry& e = entries_[i];
+        e.hash = h;
+        e.pattern = pattern;
+        e.sender.assign(rule.sender_comp_id);
+        e.deliver_to.assign(rule.deliver_to);
+        e.msg_type.assign(rule.msg_type);
+        e.route = Route{rule.destination, rule.on_behalf_of};
+        e.used = true;
+        patterns_ |= uint8_t(1u << pattern);
+        ++count_;
+        return true;
+    }
+
+    /// Route of the most specific rule matching the key, or nullptr
+    [[nodiscard]] const Route* find(std::string_view sender, std::string_view deliver_to,
+                                    std::string_view msg_type) const noexcept {
+        for (uint8_t pattern : PATTERN_ORDER) {
+            if (!(patterns_ & (1u << pattern))) continue;
+            const std::string_view s = pattern & SENDER ? sender : std::string_view{};
+            const std::string_view d = pattern & DELIVER_TO ? deliver_to : std::string_view{};
+            const std::string_view t = pattern & MSG_TYPE ? msg_type : std::string_view{};
+            const uint64_t h = hash(pattern, s, d, t);
+            for (size_t i = h & TABLE_MASK; entries_[i].used; i = (i + 1) & TABLE_MASK) {
+                if (matches(entries_[i], h, pattern, s, d, t)) return &entries_[i].route;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxRoutes; }
+
+private:
+    struct Entry {
+        uint64_t hash{0};
+        std::string sender;
+        std::string deliver_to;
+        std::string msg_type;
+        Route route{};
+        uint8_t pattern{0};
+        bool used{false};
+    };
+
+    [[nodiscard]] static uint8_t pattern_of(const RouteRule& rule) noexcept {
+        return uint8_t((rule.sender_comp_id.empty() ? 0 : SENDER) |
+                       (rule.deliver_to.empty() ? 0 : DELIVER_TO) |
+                       (rule.msg_type.empty() ? 0 : MSG_TYPE));
+    }
+
+    /// FNV-1a over the pattern and the fields it sets
+    [[nodiscard]] static uint64_t hash(uint8_t pattern, std::string_view sender,
+                                       std::string_view deliver_to, std::string_view msg_type) noexcept {
+        constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+        constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+        uint64_t h = (FNV_OFFSET ^ pattern) * FNV_PRIME;
+        for (std::string_view part : {sender, deliver_to, msg_type}) {
+            for (char c : part) {
+                h ^= static_cast<uint8_t>(c);
+                h *= FNV_PRIME;
+            }
+            h ^= 0x1F;  // Separator: AB+CD differs from ABC+D
+            h *= FNV_PRIME;
+        }
+        return h;
+    }
+
+    [[nodiscard]] static bool matches(const Entry& e, uint64_t h, uint8_t pattern,
+                                      std::string_view sender, std::string_view deliver_to,
+                                      std::string_view msg_type) noexcept {
+        return e.hash == h && e.pattern == pattern && e.sender == sender &&
+               e.deliver_to == deliver_to && e.msg_type == msg_type;
+    }
+
+    std::array<Entry, TABLE_SIZE> entries_{};
+    size_t count_{0};
+    uint8_t patterns_{0};   // Bit per pattern some rule uses
+};
+
+// ============================================================================
+// Message Router
+// ============================================================================
+
+template <size_t MaxRoutes = 1024>
+class MessageRouter {
+public:
+    using ForwardFn = SessionResult<void> (*)(void* session, const ParsedMessage& msg,
+                                              const ForwardFields& fields) noexcept;
+
+    MessageRouter() = default;
+
+    MessageRouter(const MessageRouter&) = delete;
+    MessageRouter& operator=(const MessageRouter&) = delete;
+
+    /// Register a session messages can be forwarded to (setup only)
+    /// @return Its index for RouteRule::destination
+    template <typename Session>
+    uint32_t add_destination(Session& session) {
+        destinations_.push_back(Destination{
+            &session,
+            [](void* s, const ParsedMessage& msg, const ForwardFields& fields) noexcept {
+                return static_cast<Session*>(s)->forward_message(msg, fields);
+            }});
+        return static_cast<uint32_t>(destinations_.size() - 1);
+    }
+
+    /// @return false for an unknown destination, a duplicate key or a full table
+    bool add_route(const RouteRule& rule) {
+        if (rule.destination >= destinations_.size()) return false;
+        return table_.insert(rule);
+    }
+
+    /// Forward msg per the first matching rule
+    NFX_HOT RouteOutcome route(const ParsedMessage& msg) noexcept {
+        const std::string_view sender = msg.sender_comp_id();
+        std::string_view deliver_to = msg.get_string(tag::DeliverToCompID::value);
+        if (deliver_to.empty()) deliver_to = msg.target_comp_id();
+
+        const Route* route = table_.find(sender, deliver_to, msg.get_string(tag::MsgType::value));
+        if (!route) [[unlikely]] {
+            ++stats_.unroutable;
+            return RouteOutcome::NoRoute;
+        }
+
+        const ForwardFields fields{route->on_behalf_of ? sender : std::string_view{}, {}};
+        const Destination& dest = destinations_[route->destination];
+        if (!dest.forward(dest.session, msg, fields)) [[unlikely]] {
+            ++stats_.failed;
+            return RouteOutcome::Failed;
+        }
+        ++stats_.forwarded;
+        return RouteOutcome::Forwarded;
+    }
+
+    [[nodiscard]] const RouteTable<MaxRoutes>& routes() const noexcept { return table_; }
+    [[nodiscard]] size_t destinations() const noexcept { return destinations_.size(); }
+    [[nodiscard]] const RouterStats& stats() const noexcept { return stats_; }
+
+private:
+    struct Destination {
+        void* session;
+        ForwardFn forward;
+    };
+
+    RouteTable<MaxRoutes> table_;
+    std::vector<Destination> destinations_;
+    RouterStats stats_;
+};
+
+} // namespace nfx
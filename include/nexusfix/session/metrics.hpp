@@ -0,0 +1,502 @@
+/*
+    NexusFIX Metrics Registry
+
+    Session, store, pool and latency statistics rendered in OpenMetrics
+    (Prometheus) text format, without reading any structure another
+    thread is writing:
+
+        session thread                      exporter thread
+        on_timer_tick():                    render():
+          slot->publish(stats_) --seqlock-->  slot->read() -> text
+        (a store / pool owner publishes     LatencyRecorder::snapshot()
+         the same way)
+
+    Publishing is one seqlock write of a trivially copyable stats struct;
+    rendering, formatting and serving happen on the exporter's thread
+    (transport/metrics_http.hpp serves render() over HTTP).
+
+    Each stats type is one metric family group: every field is a family
+    named <prefix>_<field>, and each registered slot adds one sample to
+    each family, distinguished by its labels. Families of one type are
+    rendered together, as OpenMetrics requires.
+
+        SessionStats                    nfx_session_*
+        store::IMessageStore::Stats     nfx_store_*
+        MemoryMessageStore::PoolMetrics nfx_store_pool_*
+        MessagePool::Stats              nfx_buffer_pool_*
+        MemoryBudgetStats               nfx_memory_*
+        MimallocHeapStats               nfx_heap_*        (NFX_HAS_MIMALLOC)
+        LatencyRecorder                 nfx_session_latency_seconds histogram
+
+    Register everything before starting the exporter; slots live as long
+    as the registry.
+
+    Usage:
+        MetricsRegistry registry;
+        const std::string labels = metric_labels({{"session", "CLIENT->BROKER"}});
+        session.set_metrics(registry.add<SessionStats>(labels),
+                            registry.add<store::IMessageStore::Stats>(labels));
+        registry.add_latency(labels, session.latency());
+
+        auto* pool = registry.add<MemoryMessageStore::PoolMetrics>(labels);
+        pool->publish(store.pool_metrics());     // Owner thread, periodically
+
+        std::string text = registry.render();    // Exporter thread
+*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/memory/memory_budget.hpp"
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+#include "nexusfix/memory/mimalloc_resource.hpp"
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Metric Families
+// ============================================================================
+
+enum class MetricKind : uint8_t {
+    Counter,
+    Gauge
+};
+
+/// One field of a stats struct exported as a metric family
+template <typename T>
+struct MetricField {
+    std::string_view name;
+    MetricKind kind;
+    std::string_view help;
+    uint64_t (*value)(const T&) noexcept;
+};
+
+/// Specialize with prefix and fields to export a stats struct
+template <typename T>
+struct MetricFamily;
+
+template <>
+struct MetricFamily<SessionStats> {
+    static constexpr std::string_view prefix = "nfx_session";
+    static constexpr std::array<MetricField<SessionStats>, 25> fields{{
+        {"messages_sent", MetricKind::Counter, "Messages sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.messages_sent; }},
+        {"messages_received", MetricKind::Counter, "Messages received",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.messages_received; }},
+        {"bytes_sent", MetricKind::Counter, "Bytes sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.bytes_sent; }},
+        {"bytes_received", MetricKind::Counter, "Bytes received",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.bytes_received; }},
+        {"heartbeats_sent", MetricKind::Counter, "Heartbeats sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.heartbeats_sent; }},
+        {"heartbeats_received", MetricKind::Counter, "Heartbeats received",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.heartbeats_received; }},
+        {"test_requests_sent", MetricKind::Counter, "TestRequests sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.test_requests_sent; }},
+        {"resend_requests_sent", MetricKind::Counter, "ResendRequests sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.resend_requests_sent; }},
+        {"messages_resent", MetricKind::Counter, "Messages replayed or gap filled",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.messages_resent; }},
+        {"gap_fills_sent", MetricKind::Counter, "SequenceReset-GapFills sent",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.gap_fills_sent; }},
+        {"sequence_resets", MetricKind::Counter, "Sequence resets",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.sequence_resets; }},
+        {"reconnects", MetricKind::Counter, "Reconnects",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.reconnect_count; }},
+        {"send_batches", MetricKind::Counter, "Coalesced send flushes",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.send_batches; }},
+        {"throttle_rejects", MetricKind::Counter, "Sends refused by the throttle",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_rejects; }},
+        {"throttle_queued", MetricKind::Counter, "Sends held in the throttle queue",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_queued; }},
+        {"throttle_delayed", MetricKind::Counter, "Sends delayed by the throttle",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_delayed; }},
+        {"throttle_dropped", MetricKind::Counter, "Throttled sends dropped on disconnect",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_dropped; }},
+        {"throttle_queue_depth", MetricKind::Gauge, "Sends waiting for a throttle token",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_queue_depth; }},
+        {"throttle_queue_peak", MetricKind::Gauge, "Throttle queue high-water mark",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.throttle_queue_peak; }},
+        {"risk_rejects", MetricKind::Counter, "Orders refused by the pre-trade check",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.risk_rejects; }},
+        {"invalid_values", MetricKind::Counter, "App messages refused for SOH or '=' in a value",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.invalid_values; }},
+        {"budget_rejects", MetricKind::Counter, "App messages refused over the memory budget",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.budget_rejects; }},
+        {"messages_filtered", MetricKind::Counter, "Inbound messages of an ignored MsgType",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.messages_filtered; }},
+        {"hibernations", MetricKind::Counter, "Idle periods with buffers released",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.hibernations; }},
+        {"wakeups", MetricKind::Counter, "Rehydrations from hibernation",
+         [](const SessionStats& s) noexcept -> uint64_t { return s.wakeups; }},
+    }};
+};
+
+template <>
+struct MetricFamily<store::IMessageStore::Stats> {
+    using Stats = store::IMessageStore::Stats;
+    static constexpr std::string_view prefix = "nfx_store";
+    static constexpr std::array<MetricField<Stats>, 4> fields{{
+        {"messages_stored", MetricKind::Counter, "Messages stored for resend",
+         [](const Stats& s) noexcept -> uint64_t { return s.messages_stored; }},
+        {"messages_retrieved", MetricKind::Counter, "Messages read back for resend",
+         [](const Stats& s) noexcept -> uint64_t { return s.messages_retrieved; }},
+        {"bytes_stored", MetricKind::Counter, "Bytes stored",
+         [](const Stats& s) noexcept -> uint64_t { return s.bytes_stored; }},
+        {"store_failures", MetricKind::Counter, "Messages the store could not keep",
+         [](const Stats& s) noexcept -> uint64_t { return s.store_failures; }},
+    }};
+};
+
+template <>
+struct MetricFamily<store::MemoryMessageStore::PoolMetrics> {
+    using Stats = store::MemoryMessageStore::PoolMetrics;
+    static constexpr std::string_view prefix = "nfx_store_pool";
+    static constexpr std::array<MetricField<Stats>, 4> fields{{
+        {"capacity_bytes", MetricKind::Gauge, "Byte ring size",
+         [](const Stats& s) noexcept -> uint64_t { return s.pool_capacity; }},
+        {"allocated_bytes", MetricKind::Gauge, "Byte ring in use",
+         [](const Stats& s) noexcept -> uint64_t { return s.bytes_allocated; }},
+        {"peak_bytes", MetricKind::Gauge, "Byte ring high-water mark",
+         [](const Stats& s) noexcept -> uint64_t { return s.peak_usage; }},
+        {"resets", MetricKind::Counter, "Store resets",
+         [](const Stats& s) noexcept -> uint64_t { return s.reset_count; }},
+    }};
+};
+
+template <>
+struct MetricFamily<MessagePool::Stats> {
+    using Stats = MessagePool::Stats;
+    static constexpr std::string_view prefix = "nfx_buffer_pool";
+    static constexpr std::array<MetricField<Stats>, 6> fields{{
+        {"small_allocated", MetricKind::Gauge, "Small blocks in use",
+         [](const Stats& s) noexcept -> uint64_t { return s.small_allocated; }},
+        {"small_available", MetricKind::Gauge, "Small blocks free",
+         [](const Stats& s) noexcept -> uint64_t { return s.small_available; }},
+        {"medium_allocated", MetricKind::Gauge, "Medium blocks in use",
+         [](const Stats& s) noexcept -> uint64_t { return s.medium_allocated; }},
+        {"medium_available", MetricKind::Gauge, "Medium blocks free",
+         [](const Stats& s) noexcept -> uint64_t { return s.medium_available; }},
+        {"large_allocated", MetricKind::Gauge, "Large blocks in use",
+         [](const Stats& s) noexcept -> uint64_t { return s.large_allocated; }},
+        {"large_available", MetricKind::Gauge, "Large blocks free",
+         [](const Stats& s) noexcept -> uint64_t { return s.large_available; }},
+    }};
+};
+
+template <>
+struct MetricFamily<memory::MemoryBudgetStats> {
+    using Stats = memory::MemoryBudgetStats;
+    static constexpr std::string_view prefix = "nfx_memory";
+    static constexpr std::array<MetricField<Stats>, 12> fields{{
+        {"heap_bytes", MetricKind::Gauge, "Session heap bytes",
+         [](const Stats& s) noexcept -> uint64_t { return s.heap_bytes; }},
+        {"store_bytes", MetricKind::Gauge, "Message store bytes",
+         [](const Stats& s) noexcept -> uint64_t { return s.store_bytes; }},
+        {"buffer_bytes", MetricKind::Gauge, "Session buffer bytes",
+         [](const Stats& s) noexcept -> uint64_t { return s.buffer_bytes; }},
+        {"total_bytes", MetricKind::Gauge, "Bytes charged to the budget",
+         [](const Stats& s) noexcept -> uint64_t { return s.total_bytes; }},
+        {"peak_bytes", MetricKind::Gauge, "Budget high-water mark",
+         [](const Stats& s) noexcept -> uint64_t { return s.peak_bytes; }},
+        {"soft_limit_bytes", MetricKind::Gauge, "Soft limit (0 = none)",
+         [](const Stats& s) noexcept -> uint64_t { return s.soft_limit; }},
+        {"hard_limit_bytes", MetricKind::Gauge, "Hard limit (0 = none)",
+         [](const Stats& s) noexcept -> uint64_t { return s.hard_limit; }},
+        {"soft_breaches", MetricKind::Counter, "Soft limit crossings",
+         [](const Stats& s) noexcept -> uint64_t { return s.soft_breaches; }},
+        {"hard_breaches", MetricKind::Counter, "Hard limit crossings",
+         [](const Stats& s) noexcept -> uint64_t { return s.hard_breaches; }},
+        {"reclaims", MetricKind::Counter, "Reclaim passes",
+         [](const Stats& s) noexcept -> uint64_t { return s.reclaims; }},
+        {"reclaimed_bytes", MetricKind::Counter, "Bytes given back by reclaims",
+         [](const Stats& s) noexcept -> uint64_t { return s.reclaimed_bytes; }},
+        {"level", MetricKind::Gauge, "0 = ok, 1 = over soft limit, 2 = over hard limit",
+         [](const Stats& s) noexcept -> uint64_t { return s.level; }},
+    }};
+};
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+template <>
+struct MetricFamily<memory::MimallocHeapStats> {
+    using Stats = memory::MimallocHeapStats;
+    static constexpr std::string_view prefix = "nfx_heap";
+    static constexpr std::array<MetricField<Stats>, 3> fields{{
+        {"allocated_bytes", MetricKind::Gauge, "Bytes allocated from the session heap",
+         [](const Stats& s) noexcept -> uint64_t { return s.bytes_allocated; }},
+        {"allocations", MetricKind::Gauge, "Live allocations",
+         [](const Stats& s) noexcept -> uint64_t { return s.allocation_count; }},
+        {"peak_bytes", MetricKind::Gauge, "Heap high-water mark",
+         [](const Stats& s) noexcept -> uint64_t { return s.peak_bytes; }},
+    }};
+};
+#endif
+
+template <typename T>
+concept ExportableStats = std::is_trivially_copyable_v<T> && requires {
+    MetricFamily<T>::prefix;
+    MetricFamily<T>::fields;
+};
+
+// ============================================================================
+// Labels
+// ============================================================================
+
+/// Render {name, value} pairs as an OpenMetrics label set body:
+/// session="A->B",venue="X" (values escaped)
+[[nodiscard]] inline std::string metric_labels(
+    std::initializer_list<std::pair<std::string_view, std::string_view>> labels)
+{
+    std::string out;
+    for (const auto& [name, value] : labels) {
+        if (!out.empty()) out += ',';
+        out.append(name);
+        out += "=\"";
+        for (char c : value) {
+            switch (c) {
+                case '\\': out += "\\\\"; break;
+                case '"':  out += "\\\""; break;
+                case '\n': out += "\\n"; break;
+                default:   out += c; break;
+            }
+        }
+        out += '"';
+    }
+    return out;
+}
+
+// ============================================================================
+// Metrics Slot
+// ============================================================================
+
+/// Latest published copy of one stats struct
+/// publish() from the thread that owns the struct; read() from any.
+template <ExportableStats T>
+class MetricsSlot {
+public:
+    explicit MetricsSlot(std::string labels) : labels_{std::move(labels)} {}
+
+    MetricsSlot(const MetricsSlot&) = delete;
+    MetricsSlot& operator=(const MetricsSlot&) = delete;
+
+    void publish(const T& stats) noexcept { value_.write(stats); }
+
+    [[nodiscard]] T read() const noexcept { return value_.read(); }
+
+    [[nodiscard]] const std::string& labels() const noexcept { return labels_; }
+
+private:
+    memory::Seqlock<T> value_;
+    std::string labels_;
+};
+
+// ============================================================================
+// Metrics Registry
+// ============================================================================
+
+class MetricsRegistry {
+public:
+    MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /// New slot exporting T under labels (a metric_labels() string)
+    template <ExportableStats T>
+    [[nodiscard]] MetricsSlot<T>* add(std::string labels) {
+        std::lock_guard lock{mutex_};
+        return group<T>().slots.emplace_back(std::make_unique<MetricsSlot<T>>(std::move(labels))).get();
+    }
+
+    /// Export a session's latency histograms (nfx_session_latency_seconds)
+    /// Nothing is rendered for it unless NFX_HAS_LATENCY_HISTOGRAMS.
+    void add_latency(std::string labels, const LatencyRecorder<>& recorder) {
+        std::lock_guard lock{mutex_};
+        latency_.emplace_back(std::move(labels), &recorder);
+    }
+
+    /// OpenMetrics exposition of every registered slot
+    [[nodiscard]] std::string render() const {
+        std::string out;
+        render(out);
+        return out;
+    }
+
+    /// Append the exposition to out (reuse out across scrapes)
+    void render(std::string& out) const {
+        std::lock_guard lock{mutex_};
+        for (const auto& g : groups_) g->render(out);
+        render_latency(out);
+        out += "# EOF\n";
+    }
+
+private:
+    struct GroupBase {
+        virtual ~GroupBase() = default;
+        virtual void render(std::string& out) const = 0;
+    };
+
+    template <typename T>
+    struct Group final : GroupBase {
+        std::deque<std::unique_ptr<MetricsSlot<T>>> slots;
+
+        void render(std::string& out) const override {
+            std::vector<T> values;
+            values.reserve(slots.size());
+            for (const auto& slot : slots) values.push_back(slot->read());
+
+            for (const auto& field : MetricFamily<T>::fields) {
+                const bool counter = field.kind == MetricKind::Counter;
+                write_header(out, MetricFamily<T>::prefix, field.name,
+                             counter ? "counter" : "gauge", field.help);
+                for (size_t i = 0; i < slots.size(); ++i) {
+                    write_name(out, MetricFamily<T>::prefix, field.name);
+                    if (counter) out += "_total";
+                    write_labels(out, slots[i]->labels(), {});
+                    out += ' ';
+                    append_number(out, field.value(values[i]));
+                    out += '\n';
+                }
+            }
+        }
+    };
+
+    template <typename T>
+    Group<T>& group() {
+        static const char key = 0;    // One address per T
+        for (auto& [k, g] : group_keys_) {
+            if (k == &key) return static_cast<Group<T>&>(*g);
+        }
+        auto owned = std::make_unique<Group<T>>();
+        Group<T>& g = *owned;
+        group_keys_.emplace_back(&key, &g);
+        groups_.push_back(std::move(owned));
+        return g;
+    }
+
+    void render_latency(std::string& out) const {
+        if constexpr (LATENCY_HISTOGRAMS_ENABLED) {
+            if (latency_.empty()) return;
+            if (util::RdtscClock::frequency_ghz() == 0.0) util::RdtscClock::initialize();
+            const double seconds_per_cycle = 1e-9 / util::RdtscClock::frequency_ghz();
+            write_header(out, "nfx_session", "latency_seconds", "histogram",
+                         "Hot-path stage latency");
+
+            for (const auto& [labels, recorder] : latency_) {
+                const LatencySnapshot snap = recorder->snapshot();
+                for (size_t s = 0; s < LATENCY_STAGE_COUNT; ++s) {
+                    const LatencyHistogram& h = snap.stages[s];
+                    std::string stage = "stage=\"";
+                    stage.append(latency_stage_name(static_cast<LatencyStage>(s)));
+                    stage += '"';
+
+                    // Cumulative counts at powers of two: bucket edges align there
+                    uint64_t cumulative = 0;
+                    size_t bucket = 0;
+                    for (uint32_t bit = LatencyHistogram::SUB_BUCKET_BITS;
+                         bit <= LatencyHistogram::MAX_BITS; ++bit) {
+                        const uint64_t edge = 1ULL << bit;
+                        while (bucket < LatencyHistogram::BUCKETS &&
+                               LatencyHistogram::bucket_floor(bucket) < edge) {
+                            cumulative += h.count_at(bucket++);
+                        }
+                        out += "nfx_session_latency_seconds_bucket";
+                        std::string le = stage + ",le=\"";
+                        append_double(le, static_cast<double>(edge) * seconds_per_cycle);
+                        le += '"';
+                        write_labels(out, labels, le);
+                        out += ' ';
+                        append_number(out, cumulative);
+                        out += '\n';
+                    }
+                    out += "nfx_session_latency_seconds_bucket";
+                    write_labels(out, labels, stage + ",le=\"+Inf\"");
+                    out += ' ';
+                    append_number(out, h.count());
+                    out += '\n';
+
+                    out += "nfx_session_latency_seconds_count";
+                    write_labels(out, labels, stage);
+                    out += ' ';
+                    append_number(out, h.count());
+                    out += '\n';
+
+                    out += "nfx_session_latency_seconds_sum";
+                    write_labels(out, labels, stage);
+                    out += ' ';
+                    append_double(out, static_cast<double>(h.sum()) * seconds_per_cycle);
+                    out += '\n';
+                }
+            }
+        } else {
+            (void)out;
+        }
+    }
+
+    static void write_name(std::string& out, std::string_view prefix, std::string_view name) {
+        out.append(prefix);
+        out += '_';
+        out.append(name);
+    }
+
+    static void write_header(std::string& out, std::string_view prefix, std::string_view name,
+                             std::string_view type, std::string_view help) {
+        out += "# TYPE ";
+        write_name(out, prefix, name);
+        out += ' ';
+        out.append(type);
+        out += "\n# HELP ";
+        write_name(out, prefix, name);
+        out += ' ';
+        out.append(help);
+        out += '\n';
+    }
+
+    static void write_labels(std::string& out, std::string_view labels, std::string_view extra) {
+        if (labels.empty() && extra.empty()) return;
+        out += '{';
+        out.append(labels);
+        if (!labels.empty() && !extra.empty()) out += ',';
+        out.append(extra);
+        out += '}';
+    }
+
+    static void append_number(std::string& out, uint64_t value) {
+        char buf[24];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, end);
+    }
+
+    static void append_double(std::string& out, double value) {
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, end);
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<GroupBase>> groups_;           // Registration order
+    std::vector<std::pair<const void*, GroupBase*>> group_keys_;
+    std::vector<std::pair<std::string, const LatencyRecorder<>*>> latency_;
+};
+
+} // namespace nfx
@@ -0,0 +1,142 @@
+/*
+    NexusFIX Inbound MsgType Filter
+
+    Drop-copy and market data sessions receive many message types they
+    never read (35=B News, 35=h TradingSessionStatus, ...). A session
+    with SessionConfig::msg_type_filter set reads MsgType and MsgSeqNum
+    from the leading header fields of each framed message (peek_header)
+    and, for an ignored type arriving in sequence, only advances the
+    inbound sequence: no field indexing, no checksum, no dispatch.
+
+    Anything unusual takes the full parse: a gap, a duplicate or a header
+    that cannot be peeked. Ignored types that arrive that way are parsed
+    and sequenced as usual, then not dispatched. Session-level types
+    (0-5, A) cannot be ignored.
+
+    Usage:
+        SessionConfig config;
+        config.msg_type_filter.ignore("B");    // News
+        config.msg_type_filter.ignore("h");    // TradingSessionStatus
+        config.msg_type_filter.ignore("BE");   // UserRequest
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/interfaces/i_message.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// MsgType Filter
+// ============================================================================
+
+/// Bitmap of ignored MsgTypes: any single character, or two characters
+/// 'A'-'Z' followed by 'A'-'Z' / '0'-'9'
+class MsgTypeFilter {
+public:
+    constexpr MsgTypeFilter() noexcept = default;
+
+    /// Stop dispatching type
+    /// @return false for session-level and unrepresentable types
+    constexpr bool ignore(std::string_view type) noexcept {
+        const size_t bit = slot(type);
+        if (bit == NO_SLOT || (type.size() == 1 && msg_type::is_admin(type[0]))) {
+            return false;
+        }
+        bits_[bit / 64] |= 1ULL << (bit % 64);
+        return true;
+    }
+
+    /// Dispatch type again
+    constexpr void allow(std::string_view type) noexcept {
+        const size_t bit = slot(type);
+        if (bit != NO_SLOT) bits_[bit / 64] &= ~(1ULL << (bit % 64));
+    }
+
+    [[nodiscard]] constexpr bool ignores(std::string_view type) const noexcept {
+        const size_t bit = slot(type);
+        return bit != NO_SLOT && ((bits_[bit / 64] >> (bit % 64)) & 1);
+    }
+
+    /// Nothing ignored (the session skips the header peek)
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        for (uint64_t word : bits_) {
+            if (word != 0) return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t SINGLE = 256;
+    static constexpr size_t SECOND = 36;  // 'A'-'Z', '0'-'9'
+    static constexpr size_t BITS = SINGLE + 26 * SECOND;
+    static constexpr size_t NO_SLOT = BITS;
+
+    [[nodiscard]] static constexpr size_t slot(std::string_view type) noexcept {
+        if (type.size() == 1) return static_cast<unsigned char>(type[0]);
+        if (type.size() != 2 || type[0] < 'A' || type[0] > 'Z') return NO_SLOT;
+        size_t second;
+        if (type[1] >= 'A' && type[1] <= 'Z') second = static_cast<size_t>(type[1] - 'A');
+        else if (type[1] >= '0' && type[1] <= '9') second = 26 + static_cast<size_t>(type[1] - '0');
+        else return NO_SLOT;
+        return SINGLE + static_cast<size_t>(type[0] - 'A') * SECOND + second;
+    }
+
+    std::array<uint64_t, (BITS + 63) / 64> bits_{};
+};
+
+// ============================================================================
+// Header Peek
+// ============================================================================
+
+/// MsgType and MsgSeqNum read from the leading header fields
+struct HeaderPeek {
+    std::string_view msg_type;
+    uint32_t msg_seq_num{0};
+
+    [[nodiscard]] constexpr bool ok() const noexcept {
+        return !msg_type.empty() && msg_seq_num != 0;
+    }
+};
+
+/// Read 35 and 34 from the first header fields of one framed message
+/// Scans at most MAX_FIELDS fields; no checksum or BodyLength checks.
+[[nodiscard]] constexpr HeaderPeek peek_header(std::span<const char> data) noexcept {
+    constexpr int MAX_FIELDS = 8;
+    HeaderPeek peek;
+    size_t pos = 0;
+    for (int field = 0; field < MAX_FIELDS && pos < data.size(); ++field) {
+        // Tag digits up to '='
+        uint32_t tag = 0;
+        while (pos < data.size() && data[pos] >= '0' && data[pos] <= '9' && tag < 100000) {
+            tag = tag * 10 + static_cast<uint32_t>(data[pos++] - '0');
+        }
+        if (pos >= data.size() || data[pos] != '=') return HeaderPeek{};
+        const size_t value = ++pos;
+        while (pos < data.size() && data[pos] != '\x01') ++pos;
+        if (pos >= data.size()) return HeaderPeek{};
+        const std::string_view text{data.data() + value, pos - value};
+        ++pos;
+
+        if (tag == 35) {
+            peek.msg_type = text;
+        } else if (tag == 34) {
+            uint32_t seq = 0;
+            for (char c : text) {
+                if (c < '0' || c > '9' || seq > (UINT32_MAX - 9) / 10) return HeaderPeek{};
+                seq = seq * 10 + static_cast<uint32_t>(c - '0');
+            }
+            peek.msg_seq_num = seq;
+        }
+        if (peek.ok()) break;
+    }
+    return peek;
+}
+
+}  // namespace nfx
@@ -0,0 +1,195 @@
+/*
+    NexusFIX Per-Message-Type Performance Profile
+
+    Aggregates hardware counter deltas (util::ThreadPerfCounters) per
+    message type and region, so IPC and cache / TLB misses of e.g. parsing
+    ExecutionReports can be watched live in production:
+
+        on_data_received ── Parse ──── parse done       (inbound MsgType)
+                         └─ Dispatch ─ handler returned (inbound MsgType)
+        send_app_message ── Build ──── serialized       (outbound MsgType)
+
+    The session thread adds into a private table (up to TABLE_SIZE message
+    types; later ones share the "?" row) and publishes a copy every
+    PUBLISH_EVERY samples and on on_timer_tick(). Monitoring threads read
+    the copy lock-free, like LatencyRecorder snapshots.
+
+    The counters belong to the thread that opened them: open them on the
+    session worker thread and attach the profile from that thread.
+
+    Usage:
+        // Session worker thread
+        util::ThreadPerfCounters counters;
+        counters.open(util::DEFAULT_PERF_EVENTS);
+        MsgTypePerfProfile profile{counters};
+        session.set_perf_profile(&profile);
+
+        // Monitoring thread
+        const PerfProfileSnapshot snap = profile.snapshot();
+        if (const auto* row = snap.find("8"))
+            double ipc = (*row)[PerfRegion::Parse].ratio(1, 0);   // instructions / cycles
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/perf_counters.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Regions
+// ============================================================================
+
+enum class PerfRegion : uint8_t {
+    Parse = 0,
+    Dispatch,
+    Build
+};
+
+inline constexpr size_t PERF_REGION_COUNT = 3;
+
+[[nodiscard]] constexpr std::string_view perf_region_name(PerfRegion region) noexcept {
+    constexpr std::array<std::string_view, PERF_REGION_COUNT> names{"parse", "dispatch", "build"};
+    const auto idx = static_cast<uint8_t>(region);
+    return idx < names.size() ? names[idx] : "unknown";
+}
+
+// ============================================================================
+// Totals
+// ============================================================================
+
+/// Summed counter deltas of one region
+struct PerfTotals {
+    uint64_t samples{0};
+    util::PerfSample values{};     // Indexed like ThreadPerfCounters::event(i)
+
+    /// Per-sample average of counter i
+    [[nodiscard]] double mean(size_t i) const noexcept {
+        return samples ? static_cast<double>(values[i]) / static_cast<double>(samples) : 0.0;
+    }
+
+    /// values[num] / values[den], e.g. instructions / cycles = IPC
+    [[nodiscard]] double ratio(size_t num, size_t den) const noexcept {
+        return values[den] ? static_cast<double>(values[num]) / static_cast<double>(values[den]) : 0.0;
+    }
+};
+
+/// Totals of one message type
+struct PerfTypeRow {
+    std::array<char, 2> msg_type{};    // 1 or 2 chars; {0, 0} = unused row
+    std::array<PerfTotals, PERF_REGION_COUNT> regions{};
+
+    [[nodiscard]] std::string_view type() const noexcept {
+        return {msg_type.data(), msg_type[1] ? size_t{2} : size_t{1}};
+    }
+
+    [[nodiscard]] const PerfTotals& operator[](PerfRegion region) const noexcept {
+        return regions[static_cast<uint8_t>(region)];
+    }
+};
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+struct PerfProfileSnapshot {
+    static constexpr size_t TABLE_SIZE = 32;           // Power of two
+
+    std::array<PerfTypeRow, TABLE_SIZE> rows{};
+    std::array<util::PerfEvent, util::MAX_PERF_EVENTS> events{};
+    uint32_t event_count{0};
+
+    /// Row of msg_type, nullptr if it was never sampled
+    [[nodiscard]] const PerfTypeRow* find(std::string_view msg_type) const noexcept {
+        for (const auto& row : rows) {
+            if (row.msg_type[0] && row.type() == msg_type) return &row;
+        }
+        return nullptr;
+    }
+};
+
+// ============================================================================
+// Message Type Performance Profile
+// ============================================================================
+
+class MsgTypePerfProfile {
+public:
+    static constexpr size_t TABLE_SIZE = PerfProfileSnapshot::TABLE_SIZE;
+    static constexpr uint64_t PUBLISH_EVERY = 4096;    // Samples between publishes
+
+    explicit MsgTypePerfProfile(const util::ThreadPerfCounters& counters)
+        : counters_{counters}, state_{std::make_unique<State>()} {
+        State& s = *state_;
+        s.live.event_count = static_cast<uint32_t>(counters.size());
+        for (size_t i = 0; i < counters.size(); ++i) s.live.events[i] = counters.event(i);
+        (void)row_for(s.live, "?");    // Overflow row always exists
+        s.published.write(s.live);
+    }
+
+    [[nodiscard]] bool active() const noexcept { return counters_.is_open(); }
+
+    /// Read the counters at the start of a region (session thread)
+    NFX_HOT void begin(util::PerfSample& start) const noexcept { counters_.sample(start); }
+
+    /// Read the counters again and add the deltas to msg_type's region
+    NFX_HOT void end(PerfRegion region, std::string_view msg_type,
+                     const util::PerfSample& start) noexcept {
+        util::PerfSample now{};
+        counters_.sample(now);
+        State& s = *state_;
+        PerfTotals& totals = row_for(s.live, msg_type).regions[static_cast<uint8_t>(region)];
+        ++totals.samples;
+        for (size_t i = 0; i < util::MAX_PERF_EVENTS; ++i) totals.values[i] += now[i] - start[i];
+        if (++s.since_publish >= PUBLISH_EVERY) [[unlikely]] publish();
+    }
+
+    /// Make the live totals visible to snapshot() (session thread)
+    void publish() noexcept {
+        State& s = *state_;
+        if (s.since_publish == 0) return;
+        s.published.write(s.live);
+        s.since_publish = 0;
+    }
+
+    /// Last published totals (any thread, lock-free)
+    [[nodiscard]] PerfProfileSnapshot snapshot() const noexcept { return state_->published.read().value; }
+
+private:
+    struct State {
+        alignas(CACHE_LINE_SIZE) PerfProfileSnapshot live{};
+        uint64_t since_publish{0};
+        memory::VersionedValue<PerfProfileSnapshot> published;
+    };
+
+    /// Open-addressed by MsgType; a full table folds new types into "?"
+    static PerfTypeRow& row_for(PerfProfileSnapshot& table, std::string_view msg_type) noexcept {
+        std::array<char, 2> key{'?', 0};
+        if (!msg_type.empty() && msg_type.size() <= 2) {
+            key[0] = msg_type[0];
+            key[1] = msg_type.size() == 2 ? msg_type[1] : '\0';
+        }
+        size_t slot = (static_cast<uint8_t>(key[0]) * 31u + static_cast<uint8_t>(key[1])) & (TABLE_SIZE - 1);
+        for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+            PerfTypeRow& row = table.rows[slot];
+            if (row.msg_type == key) return row;
+            if (row.msg_type[0] == 0) {
+                row.msg_type = key;
+                return row;
+            }
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+        }
+        return row_for(table, "?");
+    }
+
+    const util::ThreadPerfCounters& counters_;
+    std::unique_ptr<State> state_;
+};
+
+} // namespace nfx
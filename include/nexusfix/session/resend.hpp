@@ -0,0 +1,339 @@
+/*
+    NexusFIX Resend Pipeline
+
+    Answering a ResendRequest replays stored messages with the header
+    changes FIX requires (PossDupFlag=Y, OrigSendingTime, new SendingTime):
+
+        8=FIX.4.4|9=<len>|35=D|...|52=<old>|<rest>|10=XXX|
+     -> 8=FIX.4.4|9=<len+N>|35=D|...|52=<now>|43=Y|122=<old>|<rest>|10=YYY|
+
+    rewrite_for_resend() copies the message once into the output buffer
+    and derives the new checksum from the stored one: only the changed
+    BodyLength digits, the SendingTime swap and the inserted bytes are
+    summed (IncrementalChecksum), never the whole body.
+
+    ResendBatch collects rewritten messages in one arena so the session
+    can hand a whole replay to the transport in a single scatter-gather
+    submission (see HasOnSendBatch / queue_scatter_gather()).
+
+    Session-level messages are not replayed: each run of consecutive
+    skipped seqnums (admin messages, seqnums missing from the store,
+    messages a handler declines) becomes one SequenceReset-GapFill:
+
+        2:D 3:0 4:0 5:1 6:D  ->  D(2)  4(3, 36=6, 123=Y)  D(6)
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+#include "nexusfix/util/working_set.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Gap-Fill Classification
+// ============================================================================
+
+/// MsgType(35) of a stored message; empty if not found in the header
+[[nodiscard]] inline std::string_view stored_msg_type(std::span<const char> stored) noexcept {
+    const std::string_view msg{stored.data(), stored.size()};
+    const size_t tag = msg.find("\x01" "35=");
+    if (tag == std::string_view::npos) [[unlikely]] return {};
+    const size_t start = tag + 4;
+    const size_t end = msg.find('\x01', start);
+    if (end == std::string_view::npos) [[unlikely]] return {};
+    return msg.substr(start, end - start);
+}
+
+/// True for stored messages replaced by a gap fill instead of being resent
+/// FIX resends only application messages; session-level messages
+/// (Heartbeat, TestRequest, ResendRequest, Reject, SequenceReset, Logon,
+/// Logout) are skipped, as is anything without a readable MsgType.
+[[nodiscard]] inline bool is_gap_fill_candidate(std::span<const char> stored) noexcept {
+    const std::string_view type = stored_msg_type(stored);
+    return type.empty() || (type.size() == 1 && msg_type::is_admin(type[0]));
+}
+
+// ============================================================================
+// PossDup Rewriting
+// ============================================================================
+
+/// Output bytes needed to rewrite original with a sending_time of new_time_len
+[[nodiscard]] constexpr size_t resend_rewrite_capacity(
+    size_t original_size, size_t new_time_len) noexcept
+{
+    // 43=Y + 122= + SOHs (10 bytes) + new SendingTime + one extra length digit
+    return original_size + new_time_len + 11;
+}
+
+namespace detail {
+
+/// Offsets in a stored message of the fields a resend rewrite touches
+struct ResendFields {
+    size_t digits_start{0};     // BodyLength value
+    size_t digits_end{0};
+    size_t body_length{0};
+    size_t time_start{0};       // SendingTime value
+    size_t time_end{0};
+    size_t trailer{0};          // "10="
+    std::string_view orig_time; // OrigSendingTime to write: stored 122, else stored 52
+    // Existing PossDupFlag / OrigSendingTime fields as [SOH, value end),
+    // dropped from the copy; begin == end when absent
+    size_t poss_dup_begin{0};
+    size_t poss_dup_end{0};
+    size_t orig_begin{0};
+    size_t orig_end{0};
+    bool valid{false};
+};
+
+/// Locate 9=, 52=, 43=, 122= and the 10= trailer of a stored message
+[[nodiscard]] inline ResendFields find_resend_fields(std::string_view msg) noexcept {
+    ResendFields f;
+    if (msg.size() < TRAILER_SIZE + 8 || msg[0] != '8' || msg[1] != '=') [[unlikely]] return f;
+
+    // 8=...|9=<digits>|
+    const size_t len_start = msg.find("\x01" "9=");
+    if (len_start == std::string_view::npos) [[unlikely]] return f;
+    f.digits_start = len_start + 3;
+    f.digits_end = msg.find('\x01', f.digits_start);
+    if (f.digits_end == std::string_view::npos || f.digits_end == f.digits_start ||
+        f.digits_end - f.digits_start > 9) [[unlikely]] {
+        return f;
+    }
+    for (size_t i = f.digits_start; i < f.digits_end; ++i) {
+        const unsigned digit = static_cast<unsigned char>(msg[i]) - '0';
+        if (digit > 9) [[unlikely]] return f;
+        f.body_length = f.body_length * 10 + digit;
+    }
+
+    f.trailer = msg.size() - TRAILER_SIZE;
+    if (msg.compare(f.trailer, 3, "10=") != 0 || msg.back() != '\x01') [[unlikely]] return f;
+    // BodyLength covers everything between its own SOH and the trailer
+    if (f.body_length != f.trailer - (f.digits_end + 1)) [[unlikely]] return f;
+
+    // |<tag>=<value>| before the trailer: [SOH, value end), or npos
+    auto field = [&](std::string_view tag, size_t& value_start) noexcept {
+        const size_t soh = msg.find(tag, f.digits_end);
+        if (soh == std::string_view::npos || soh > f.trailer) return std::string_view::npos;
+        value_start = soh + tag.size();
+        const size_t end = msg.find('\x01', value_start);
+        return end == std::string_view::npos || end > f.trailer ? std::string_view::npos : end;
+    };
+
+    f.time_end = field("\x01" "52=", f.time_start);
+    if (f.time_end == std::string_view::npos) [[unlikely]] return f;
+    f.orig_time = msg.substr(f.time_start, f.time_end - f.time_start);
+
+    // A message stored as a possible duplicate keeps its first OrigSendingTime
+    size_t value = 0;
+    if (const size_t end = field("\x01" "43=", value); end != std::string_view::npos) [[unlikely]] {
+        f.poss_dup_begin = value - 4;
+        f.poss_dup_end = end;
+    }
+    if (const size_t end = field("\x01" "122=", value); end != std::string_view::npos) [[unlikely]] {
+        f.orig_begin = value - 5;
+        f.orig_end = end;
+        f.orig_time = msg.substr(value, end - value);
+    }
+    f.valid = true;
+    return f;
+}
+
+} // namespace detail
+
+/// True if rewrite_for_resend() can rewrite original (given room)
+[[nodiscard]] inline bool can_rewrite_for_resend(std::span<const char> original) noexcept {
+    return detail::find_resend_fields({original.data(), original.size()}).valid;
+}
+
+/// Rewrite a stored message for resend into out
+/// Sets SendingTime(52) to sending_time and inserts PossDupFlag(43)=Y and
+/// OrigSendingTime(122)=<stored SendingTime> right after it. A message
+/// that already carries 43 and/or 122 has them replaced (43=N becomes Y;
+/// an existing OrigSendingTime is kept as the value of the new 122).
+/// @return Bytes written; 0 if original is not a complete message with
+///         8/9/52 and a 10= trailer, or out is smaller than
+///         resend_rewrite_capacity()
+[[nodiscard]] NFX_HOT
+inline size_t rewrite_for_resend(
+    std::span<const char> original,
+    std::string_view sending_time,
+    std::span<char> out) noexcept
+{
+    constexpr std::string_view POSS_DUP = "\x01" "43=Y\x01" "122=";
+
+    const std::string_view msg{original.data(), original.size()};
+    if (out.size() < resend_rewrite_capacity(msg.size(), sending_time.size())) [[unlikely]] {
+        return 0;
+    }
+    const detail::ResendFields f = detail::find_resend_fields(msg);
+    if (!f.valid) [[unlikely]] return 0;
+
+    const std::string_view old_time = msg.substr(f.time_start, f.time_end - f.time_start);
+    const std::string_view old_digits = msg.substr(f.digits_start, f.digits_end - f.digits_start);
+    const size_t dropped = (f.poss_dup_end - f.poss_dup_begin) + (f.orig_end - f.orig_begin);
+
+    char digits[16];
+    size_t new_len = f.body_length - old_time.size() + sending_time.size() +
+                     POSS_DUP.size() + f.orig_time.size() - dropped;
+    size_t num_digits = 0;
+    do {
+        digits[15 - num_digits++] = static_cast<char>('0' + new_len % 10);
+        new_len /= 10;
+    } while (new_len > 0);
+    const std::string_view new_digits{digits + 16 - num_digits, num_digits};
+
+    // Assemble: prefix | new length | header up to 52= | now | 43,122 | rest,
+    // leaving out any stored 43 / 122 fields
+    char* p = out.data();
+    auto put = [&p](std::string_view bytes) noexcept {
+        std::memcpy(p, bytes.data(), bytes.size());
+        p += bytes.size();
+    };
+    std::pair<size_t, size_t> skips[2]{{f.poss_dup_begin, f.poss_dup_end},
+                                       {f.orig_begin, f.orig_end}};
+    if (skips[1].first < skips[0].first) std::swap(skips[0], skips[1]);
+    auto put_range = [&](size_t from, size_t to) noexcept {
+        for (const auto& [skip_begin, skip_end] : skips) {
+            if (skip_begin == skip_end || skip_begin < from || skip_begin >= to) continue;
+            put(msg.substr(from, skip_begin - from));
+            from = skip_end;
+        }
+        put(msg.substr(from, to - from));
+    };
+    put(msg.substr(0, f.digits_start));
+    put(new_digits);
+    put_range(f.digits_end, f.time_start);
+    put(sending_time);
+    const char* inserted = p;
+    put(POSS_DUP);
+    put(f.orig_time);
+    const size_t inserted_size = static_cast<size_t>(p - inserted);
+    put_range(f.time_end, f.trailer + 3);  // ... through "10="
+
+    parser::IncrementalChecksum sum{parser::parse_checksum(msg.data() + f.trailer + 3)};
+    sum.replace(old_digits, new_digits);
+    sum.replace(old_time, sending_time);
+    sum.update(inserted, inserted_size);
+    if (dropped != 0) [[unlikely]] {
+        sum.remove(msg.data() + f.poss_dup_begin, f.poss_dup_end - f.poss_dup_begin);
+        sum.remove(msg.data() + f.orig_begin, f.orig_end - f.orig_begin);
+    }
+    parser::format_checksum(sum.finalize(), p);
+    p[3] = '\x01';
+    p += 4;
+
+    return static_cast<size_t>(p - out.data());
+}
+
+// ============================================================================
+// Resend Batch
+// ============================================================================
+
+/// Arena of outbound messages submitted together
+/// Arena and span list are allocated once; add() fails when either is
+/// full, so the owner flushes and clears.
+class ResendBatch {
+public:
+    static constexpr size_t DEFAULT_ARENA_SIZE = 256 * 1024;
+    static constexpr size_t DEFAULT_MAX_MESSAGES = 1024;
+
+    explicit ResendBatch(
+        size_t arena_size = DEFAULT_ARENA_SIZE,
+        size_t max_messages = DEFAULT_MAX_MESSAGES)
+        : arena_(arena_size)
+    {
+        messages_.reserve(max_messages);
+        max_messages_ = max_messages;
+    }
+
+    /// Rewrite original for resend (PossDup) into the arena
+    /// A message is never added unchanged; callers gap-fill what
+    /// can_rewrite_for_resend() rejects.
+    /// @return false if the batch is full or original cannot be
+    ///         rewritten (nothing added)
+    [[nodiscard]] bool add_resend(
+        std::span<const char> original, std::string_view sending_time) noexcept
+    {
+        const size_t need = resend_rewrite_capacity(original.size(), sending_time.size());
+        if (messages_.size() >= max_messages_ || need > arena_.size() - used_) {
+            return false;
+        }
+        std::span<char> dest{arena_.data() + used_, need};
+        const size_t written = rewrite_for_resend(original, sending_time, dest);
+        if (written == 0) [[unlikely]] return false;
+        messages_.emplace_back(dest.data(), written);
+        used_ += written;
+        return true;
+    }
+
+    /// Copy a message into the arena as-is
+    [[nodiscard]] bool add(std::span<const char> msg) noexcept {
+        if (messages_.size() >= max_messages_ || msg.size() > arena_.size() - used_) {
+            return false;
+        }
+        std::memcpy(arena_.data() + used_, msg.data(), msg.size());
+        messages_.emplace_back(arena_.data() + used_, msg.size());
+        used_ += msg.size();
+        return true;
+    }
+
+    /// Room for a message of up to capacity bytes, written in place
+    /// and added by commit()
+    /// @return Empty if the batch is full
+    [[nodiscard]] std::span<char> reserve(size_t capacity) noexcept {
+        if (messages_.size() >= max_messages_ || capacity > arena_.size() - used_) {
+            return {};
+        }
+        return {arena_.data() + used_, capacity};
+    }
+
+    /// Add the first size bytes of the last reserve()
+    void commit(size_t size) noexcept {
+        messages_.emplace_back(arena_.data() + used_, size);
+        used_ += size;
+    }
+
+    [[nodiscard]] std::span<const std::span<const char>> messages() const noexcept {
+        return messages_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return messages_.empty(); }
+    [[nodiscard]] size_t size() const noexcept { return messages_.size(); }
+    [[nodiscard]] size_t bytes() const noexcept { return used_; }
+    [[nodiscard]] size_t arena_size() const noexcept { return arena_.size(); }
+
+    /// Arena and the reserved span list, under the owner's names
+    size_t memory_regions(std::span<util::MemoryRegion> out,
+                          std::string_view arena_name = "batch.arena",
+                          std::string_view messages_name = "batch.messages") const noexcept {
+        return util::write_regions(out, {
+            {arena_name, const_cast<char*>(arena_.data()), arena_.size()},
+            {messages_name, const_cast<std::span<const char>*>(messages_.data()),
+             messages_.capacity() * sizeof(std::span<const char>)}});
+    }
+
+    void clear() noexcept {
+        messages_.clear();
+        used_ = 0;
+    }
+
+private:
+    std::vector<char> arena_;
+    std::vector<std::span<const char>> messages_;
+    size_t max_messages_{0};
+    size_t used_{0};
+};
+
+} // namespace nfx
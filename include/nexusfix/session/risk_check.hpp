@@ -0,0 +1,325 @@
+/*
+    NexusFIX Pre-Trade Risk
+
+    Fat-finger and credit checks run inside SessionManager::send_app_message()
+    before an order is sequenced, instead of in application code on the
+    way to it:
+
+        send_app_message(order)
+          -> handler.pre_trade_check(order.order_fields())
+               symbol -> SymbolId (interned, hot-symbol cache)
+               RiskChecks<...>::evaluate(order, limits[id])
+          -> throttle, sequence, send
+
+    Limits and exposure for a symbol share one 64-byte SymbolRisk, so a
+    check reads a single cache line. All arithmetic is on the raw
+    fixed-point values of Qty / FixedPrice. The checks are a compile-time
+    list: each is evaluated without short-circuiting into one bitmask, so
+    an accepted order (the common case) takes a single branch, and a
+    check left out of the list costs nothing.
+
+        MaxQtyCheck         order_qty <= max_order_qty
+        PriceCollarCheck    price_floor <= price <= price_cap (priced orders)
+        MaxNotionalCheck    price * order_qty <= max_notional (priced orders)
+        PositionLimitCheck  worst-case position on the order's side,
+                            |position +/- open orders +/- order_qty|,
+                            <= max_position
+
+    An accepted order is added to its side's open exposure; fills and
+    closed orders move it back out (on_execution()), and so does an order
+    the session refuses or drops after the check (release(order), from
+    the handler's pre_trade_release()). Symbols without limits are
+    rejected (UnknownSymbol). Unset limits are unlimited.
+
+    Single-threaded: owned by the session's thread.
+
+    Usage:
+        auto risk = std::make_unique<PreTradeRisk<>>();
+        SymbolRisk* aapl = risk->limits("AAPL");
+        aapl->max_order_qty = Qty::from_int(10'000);
+        aapl->price_floor = FixedPrice::from_double(100.0);
+        aapl->price_cap = FixedPrice::from_double(200.0);
+
+        struct App {
+            PreTradeRisk<>* risk;
+            bool pre_trade_check(const OrderFields& o) noexcept { return risk->check(o); }
+            void pre_trade_release(const OrderFields& o) noexcept { risk->release(o); }
+            void on_message(MsgTypeTag<'8'>, const ParsedMessage& er) noexcept {
+                risk->on_execution(er);
+            }
+            ...
+        };
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Reject Reasons
+// ============================================================================
+
+enum class RiskReject : uint8_t {
+    None = 0,
+    UnknownSymbol,
+    MaxQty,
+    PriceCollar,
+    MaxNotional,
+    PositionLimit
+};
+
+inline constexpr size_t RISK_REJECT_COUNT = 6;
+
+[[nodiscard]] constexpr std::string_view risk_reject_name(RiskReject reason) noexcept {
+    constexpr std::array<std::string_view, RISK_REJECT_COUNT> names{
+        "None", "UnknownSymbol", "MaxQty", "PriceCollar", "MaxNotional", "PositionLimit"};
+    const auto idx = static_cast<uint8_t>(reason);
+    return idx < names.size() ? names[idx] : "Unknown";
+}
+
+// ============================================================================
+// Per-Symbol Limits
+// ============================================================================
+
+/// Limits and exposure of one symbol (one cache line)
+struct alignas(64) SymbolRisk {
+    static constexpr int64_t UNLIMITED = std::numeric_limits<int64_t>::max();
+
+    // Limits
+    Qty max_order_qty{UNLIMITED};
+    FixedPrice max_notional{UNLIMITED};
+    FixedPrice price_floor{0};
+    FixedPrice price_cap{UNLIMITED};
+    Qty max_position{UNLIMITED};
+
+    // Exposure
+    Qty position{};        // Net filled quantity, buys positive
+    Qty open_buy{};        // Accepted, not yet filled or closed
+    Qty open_sell{};
+};
+
+static_assert(sizeof(SymbolRisk) == 64, "SymbolRisk should fill one cache line");
+
+// ============================================================================
+// Checks
+// ============================================================================
+
+/// Each check: static bool violated(const OrderFields&, const SymbolRisk&)
+/// written without branches, and the RiskReject it reports.
+
+struct MaxQtyCheck {
+    static constexpr RiskReject reason = RiskReject::MaxQty;
+
+    [[nodiscard]] static bool violated(const OrderFields& o, const SymbolRisk& r) noexcept {
+        return (o.order_qty.raw > r.max_order_qty.raw) | (o.order_qty.raw <= 0);
+    }
+};
+
+struct PriceCollarCheck {
+    static constexpr RiskReject reason = RiskReject::PriceCollar;
+
+    [[nodiscard]] static bool violated(const OrderFields& o, const SymbolRisk& r) noexcept {
+        return (o.price.raw != 0) &
+               ((o.price.raw < r.price_floor.raw) | (o.price.raw > r.price_cap.raw));
+    }
+};
+
+struct MaxNotionalCheck {
+    static constexpr RiskReject reason = RiskReject::MaxNotional;
+
+    /// price * qty > max_notional, compared at price * qty scale (no division)
+    [[nodiscard]] static bool violated(const OrderFields& o, const SymbolRisk& r) noexcept {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using Int128 = __int128;   // -Wpedantic: GCC/Clang extension
+        const Int128 notional = static_cast<Int128>(o.price.raw) * o.order_qty.raw;
+        const Int128 limit = static_cast<Int128>(r.max_notional.raw) * Qty::SCALE;
+        return notional > limit;
+#else
+        const double notional = static_cast<double>(o.price.raw) * static_cast<double>(o.order_qty.raw);
+        return notional > static_cast<double>(r.max_notional.raw) * static_cast<double>(Qty::SCALE);
+#endif
+    }
+};
+
+struct PositionLimitCheck {
+    static constexpr RiskReject reason = RiskReject::PositionLimit;
+
+    [[nodiscard]] static bool violated(const OrderFields& o, const SymbolRisk& r) noexcept {
+        const int64_t long_worst = r.position.raw + r.open_buy.raw + o.order_qty.raw;
+        const int64_t short_worst = r.open_sell.raw - r.position.raw + o.order_qty.raw;
+        const int64_t worst = o.side == Side::Buy ? long_worst : short_worst;  // cmov
+        return worst > r.max_position.raw;
+    }
+};
+
+/// Compile-time list of checks, all evaluated into one bitmask
+template <typename... Checks>
+struct RiskChecks {
+    static_assert(sizeof...(Checks) <= 32, "One mask bit per check");
+
+    /// First failing check's reason in list order, or None
+    [[nodiscard]] NFX_HOT static RiskReject evaluate(const OrderFields& o, const SymbolRisk& r) noexcept {
+        if constexpr (sizeof...(Checks) == 0) {
+            return RiskReject::None;
+        } else {
+            uint32_t mask = 0;
+            uint32_t bit = 0;
+            ((mask |= static_cast<uint32_t>(Checks::violated(o, r)) << bit++), ...);
+            if (mask == 0) [[likely]] return RiskReject::None;
+
+            constexpr std::array<RiskReject, sizeof...(Checks)> reasons{Checks::reason...};
+            return reasons[static_cast<size_t>(std::countr_zero(mask))];
+        }
+    }
+};
+
+using StandardRiskChecks = RiskChecks<MaxQtyCheck, PriceCollarCheck, MaxNotionalCheck, PositionLimitCheck>;
+
+// ============================================================================
+// Pre-Trade Risk Stage
+// ============================================================================
+
+/// Per-symbol limit table plus the checks run against it
+/// Members are inline arrays: allocate on the heap.
+/// @tparam Checks A RiskChecks<...> list
+/// @tparam MaxSymbols Symbols with limits
+template <typename Checks = StandardRiskChecks, size_t MaxSymbols = 1024>
+class PreTradeRisk {
+public:
+    PreTradeRisk() noexcept = default;
+
+    PreTradeRisk(const PreTradeRisk&) = delete;
+    PreTradeRisk& operator=(const PreTradeRisk&) = delete;
+
+    // ========================================================================
+    // Setup
+    // ========================================================================
+
+    /// Limits of symbol, interning it on first use
+    /// @return nullptr if the table is full or the symbol too long
+    [[nodiscard]] SymbolRisk* limits(std::string_view symbol) noexcept {
+        const store::SymbolId id = symbols_.intern(symbol);
+        return id == store::INVALID_SYMBOL ? nullptr : &table_[id];
+    }
+
+    /// Id of a symbol with limits (callers holding it can use check(id, ...))
+    [[nodiscard]] store::SymbolId symbol_id(std::string_view symbol) const noexcept {
+        return symbols_.find(symbol);
+    }
+
+    [[nodiscard]] SymbolRisk& operator[](store::SymbolId id) noexcept { return table_[id]; }
+    [[nodiscard]] const SymbolRisk& operator[](store::SymbolId id) const noexcept { return table_[id]; }
+
+    // ========================================================================
+    // Checks
+    // ========================================================================
+
+    /// Run the checks; an accepted order is added to open exposure
+    [[nodiscard]] NFX_HOT bool check(const OrderFields& order) noexcept {
+        const store::SymbolId id = symbols_.resolve(order.symbol);
+        if (id == store::INVALID_SYMBOL) [[unlikely]] return reject(RiskReject::UnknownSymbol);
+        return check(id, order);
+    }
+
+    [[nodiscard]] NFX_HOT bool check(store::SymbolId id, const OrderFields& order) noexcept {
+        SymbolRisk& r = table_[id];
+        const RiskReject reason = Checks::evaluate(order, r);
+        if (reason != RiskReject::None) [[unlikely]] return reject(reason);
+
+        Qty& open = order.side == Side::Buy ? r.open_buy : r.open_sell;
+        open.raw += order.order_qty.raw;
+        ++accepted_;
+        return true;
+    }
+
+    // ========================================================================
+    // Exposure Updates
+    // ========================================================================
+
+    /// Move filled quantity from open exposure into the position
+    void on_fill(store::SymbolId id, Side side, Qty qty) noexcept {
+        SymbolRisk& r = table_[id];
+        const bool buy = side == Side::Buy;
+        (buy ? r.open_buy : r.open_sell).raw -= qty.raw;
+        r.position.raw += buy ? qty.raw : -qty.raw;
+    }
+
+    /// Drop quantity that will no longer fill (canceled, rejected, expired)
+    void release(store::SymbolId id, Side side, Qty qty) noexcept {
+        SymbolRisk& r = table_[id];
+        (side == Side::Buy ? r.open_buy : r.open_sell).raw -= qty.raw;
+    }
+
+    /// Undo check() for an accepted order that was never sent
+    void release(const OrderFields& order) noexcept {
+        const store::SymbolId id = symbols_.resolve(order.symbol);
+        if (id == store::INVALID_SYMBOL) return;
+        release(id, order.side, order.order_qty);
+        ++released_;
+    }
+
+    /// Apply an ExecutionReport: LastQty (32) fills, and on a closing
+    /// OrdStatus (canceled, rejected, expired, done for day) the unfilled
+    /// OrderQty (38) - CumQty (14) is released
+    void on_execution(const ParsedMessage& report) noexcept {
+        const store::SymbolId id = symbols_.resolve(report.get_string(tag::Symbol::value));
+        if (id == store::INVALID_SYMBOL) return;
+        const auto side = static_cast<Side>(report.get_char(tag::Side::value));
+
+        const Qty last = report.get_qty(tag::LastQty::value);
+        if (last.raw > 0) on_fill(id, side, last);
+
+        switch (static_cast<OrdStatus>(report.get_char(tag::OrdStatus::value))) {
+            case OrdStatus::Canceled:
+            case OrdStatus::Rejected:
+            case OrdStatus::Expired:
+            case OrdStatus::DoneForDay: {
+                const Qty unfilled{report.get_qty(tag::OrderQty::value).raw -
+                                   report.get_qty(tag::CumQty::value).raw};
+                if (unfilled.raw > 0) release(id, side, unfilled);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] uint64_t accepted() const noexcept { return accepted_; }
+    [[nodiscard]] uint64_t released() const noexcept { return released_; }  // Accepted, then not sent
+    [[nodiscard]] uint64_t rejected(RiskReject reason) const noexcept {
+        return rejects_[static_cast<uint8_t>(reason)];
+    }
+    [[nodiscard]] RiskReject last_reject() const noexcept { return last_reject_; }
+
+private:
+    bool reject(RiskReject reason) noexcept {
+        ++rejects_[static_cast<uint8_t>(reason)];
+        last_reject_ = reason;
+        return false;
+    }
+
+    std::array<SymbolRisk, MaxSymbols> table_{};
+    store::SymbolRegistry<MaxSymbols> symbols_;
+    uint64_t accepted_{0};
+    uint64_t released_{0};
+    std::array<uint64_t, RISK_REJECT_COUNT> rejects_{};
+    RiskReject last_reject_{RiskReject::None};
+};
+
+} // namespace nfx
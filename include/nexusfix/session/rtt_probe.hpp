@@ -0,0 +1,310 @@
+/*
+    NexusFIX Round-Trip Probing and Latency-Aware Session Groups
+
+    RttProbe measures a session's round trip to the counterparty with the
+    admin messages every FIX engine already answers: a TestRequest (35=1)
+    whose TestReqID (112) carries the rdtsc value it was sent at, and the
+    Heartbeat (35=0) that must echo it back.
+
+        send:     TestReqID = "RTT" + 16 hex digits of rdtscp()
+        receive:  Heartbeat 112 == outstanding id -> rtt = now - tsc
+
+    The id is matched against the one outstanding probe, so an echo from
+    before a reconnect or a forged id never produces a sample. Samples
+    feed an EWMA (gain 1/2^ewma_shift, as TCP's SRTT), min/max and an
+    HDR-style LatencyHistogram for percentiles; the summary is published
+    through a seqlock so order-routing threads read it without locking.
+
+    SessionManager::set_rtt_probe() sends a probe every interval_ns while
+    Active and uses the same ids for its liveness TestRequests.
+
+    SessionGroup holds the sessions to one venue's gateways and picks,
+    for each outbound order, the Active session with the lowest EWMA
+    whose probe is not overdue. The current choice is kept until another
+    session is faster by switch_margin_pct, so two gateways with similar
+    latency do not alternate on noise. Sessions not yet measured are used
+    only when no measured one is healthy.
+
+    Usage:
+        RttProbe probe_a, probe_b;
+        session_a.set_rtt_probe(&probe_a);
+        session_b.set_rtt_probe(&probe_b);
+
+        SessionGroup<SessionManager<Handler>> venue;
+        venue.add(session_a, probe_a);
+        venue.add(session_b, probe_b);
+        venue.send_app_message(order);     // Fastest healthy gateway
+*/
+
+#pragma once
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace nfx {
+
+// ============================================================================
+// RTT Statistics
+// ============================================================================
+
+/// Published RTT summary (nanoseconds; zero until the first sample)
+struct RttStats {
+    uint64_t last_ns{0};
+    uint64_t ewma_ns{0};
+    uint64_t min_ns{0};
+    uint64_t max_ns{0};
+    uint64_t p50_ns{0};
+    uint64_t p99_ns{0};
+    uint64_t samples{0};
+    uint64_t lost{0};              // Probes never answered (superseded or reset)
+    uint64_t outstanding_tsc{0};   // Send tsc of the unanswered probe (0 = none)
+
+    [[nodiscard]] constexpr bool measured() const noexcept { return samples != 0; }
+};
+
+struct RttProbeConfig {
+    uint64_t interval_ns = 1'000'000'000ULL;   // Between probes while Active
+    uint64_t timeout_ns = 2'000'000'000ULL;    // Unanswered longer = unhealthy
+    uint32_t ewma_shift = 3;                   // EWMA gain 1/8
+};
+
+// ============================================================================
+// RTT Probe
+// ============================================================================
+
+/// TestRequest / Heartbeat round-trip meter for one session
+/// Writer methods belong to the session's thread; stats() and
+/// overdue() may be called from any thread.
+class RttProbe {
+public:
+    static constexpr std::string_view PREFIX = "RTT";
+    static constexpr size_t ID_LENGTH = PREFIX.size() + 16;
+
+    explicit RttProbe(RttProbeConfig config = {}) noexcept : config_{config} {}
+
+    RttProbe(const RttProbe&) = delete;
+    RttProbe& operator=(const RttProbe&) = delete;
+
+    // ========================================================================
+    // Writer API (session thread)
+    // ========================================================================
+
+    /// A probe should go out now (none outstanding, interval elapsed)
+    [[nodiscard]] bool due(uint64_t now_tsc) const noexcept {
+        if (outstanding_tsc_ != 0) return false;
+        return last_sent_tsc_ == 0 || elapsed_ns(last_sent_tsc_, now_tsc) >= config_.interval_ns;
+    }
+
+    /// TestReqID for a probe sent at now_tsc (valid until the next call)
+    /// An unanswered previous probe is counted as lost.
+    [[nodiscard]] std::string_view next_id(uint64_t now_tsc) noexcept {
+        if (outstanding_tsc_ != 0) ++stats_.lost;
+        outstanding_tsc_ = now_tsc ? now_tsc : 1;
+        last_sent_tsc_ = outstanding_tsc_;
+
+        std::copy(PREFIX.begin(), PREFIX.end(), id_.begin());
+        constexpr char HEX[] = "0123456789abcdef";
+        for (size_t i = 0; i < 16; ++i) {
+            id_[PREFIX.size() + i] = HEX[(outstanding_tsc_ >> (60 - 4 * i)) & 0xF];
+        }
+        stats_.outstanding_tsc = outstanding_tsc_;
+        published_.write(stats_);
+        return {id_.data(), ID_LENGTH};
+    }
+
+    /// Heartbeat TestReqID received at now_tsc
+    /// @return true if it answered the outstanding probe (a sample was taken)
+    bool on_heartbeat(std::string_view test_req_id, uint64_t now_tsc) noexcept {
+        const uint64_t tsc = decode_id(test_req_id);
+        if (tsc == 0 || tsc != outstanding_tsc_) return false;
+        outstanding_tsc_ = 0;
+        stats_.outstanding_tsc = 0;
+        record(elapsed_ns(tsc, now_tsc));
+        return true;
+    }
+
+    /// Add one RTT sample (also for transports timed elsewhere)
+    void record(uint64_t rtt_ns) noexcept {
+        histogram_.record(rtt_ns);
+        if (stats_.samples == 0) {
+            stats_.ewma_ns = stats_.min_ns = stats_.max_ns = rtt_ns;
+        } else {
+            const int64_t delta = static_cast<int64_t>(rtt_ns) - static_cast<int64_t>(stats_.ewma_ns);
+            stats_.ewma_ns = static_cast<uint64_t>(static_cast<int64_t>(stats_.ewma_ns) +
+                                                   (delta >> config_.ewma_shift));
+            stats_.min_ns = std::min(stats_.min_ns, rtt_ns);
+            stats_.max_ns = std::max(stats_.max_ns, rtt_ns);
+        }
+        stats_.last_ns = rtt_ns;
+        ++stats_.samples;
+        stats_.p50_ns = histogram_.percentile(50.0);
+        stats_.p99_ns = histogram_.percentile(99.0);
+        published_.write(stats_);
+    }
+
+    /// Forget the outstanding probe (disconnect); it counts as lost
+    void reset() noexcept {
+        if (outstanding_tsc_ == 0) return;
+        outstanding_tsc_ = 0;
+        last_sent_tsc_ = 0;
+        ++stats_.lost;
+        stats_.outstanding_tsc = 0;
+        published_.write(stats_);
+    }
+
+    // ========================================================================
+    // Reader API (any thread)
+    // ========================================================================
+
+    [[nodiscard]] RttStats stats() const noexcept { return published_.read().value; }
+
+    /// The outstanding probe has gone unanswered longer than timeout_ns
+    [[nodiscard]] bool overdue(const RttStats& s, uint64_t now_tsc) const noexcept {
+        return s.outstanding_tsc != 0 && now_tsc > s.outstanding_tsc &&
+               elapsed_ns(s.outstanding_tsc, now_tsc) > config_.timeout_ns;
+    }
+
+    /// Writer-side histogram (nanoseconds)
+    [[nodiscard]] const LatencyHistogram& histogram() const noexcept { return histogram_; }
+
+    [[nodiscard]] const RttProbeConfig& config() const noexcept { return config_; }
+
+    /// rdtsc value encoded in a probe id (0 if not a probe id)
+    [[nodiscard]] static constexpr uint64_t decode_id(std::string_view id) noexcept {
+        if (id.size() != ID_LENGTH || id.substr(0, PREFIX.size()) != PREFIX) return 0;
+        uint64_t value = 0;
+        for (size_t i = PREFIX.size(); i < ID_LENGTH; ++i) {
+            const char c = id[i];
+            uint64_t digit;
+            if (c >= '0' && c <= '9') digit = static_cast<uint64_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') digit = static_cast<uint64_t>(c - 'a' + 10);
+            else return 0;
+            value = (value << 4) | digit;
+        }
+        return value;
+    }
+
+private:
+    /// TSC interval in nanoseconds with the current calibration
+    [[nodiscard]] static uint64_t elapsed_ns(uint64_t from_tsc, uint64_t to_tsc) noexcept {
+        if (to_tsc <= from_tsc) return 0;
+        const auto cal = util::RdtscClock::calibration();
+        return util::RdtscClock::to_ns(cal, to_tsc) - util::RdtscClock::to_ns(cal, from_tsc);
+    }
+
+    RttProbeConfig config_;
+    memory::VersionedValue<RttStats> published_{};
+
+    // Writer-only state
+    RttStats stats_{};
+    LatencyHistogram histogram_{};
+    uint64_t outstanding_tsc_{0};
+    uint64_t last_sent_tsc_{0};
+    std::array<char, ID_LENGTH> id_{};
+};
+
+// ============================================================================
+// Session Group
+// ============================================================================
+
+struct SessionGroupConfig {
+    uint64_t max_rtt_ns = 0;             // EWMA above this = unhealthy (0 = no limit)
+    uint32_t switch_margin_pct = 10;     // Leave the current session only if beaten by this
+};
+
+/// Sessions to one venue's gateways; orders go to the fastest healthy one
+/// @tparam Session SessionManager instantiation (state(), send_app_message())
+/// @tparam MaxSessions Group size
+template <typename Session, size_t MaxSessions = 8>
+class SessionGroup {
+public:
+    static constexpr size_t NONE = MaxSessions;
+
+    explicit SessionGroup(SessionGroupConfig config = {}) noexcept : config_{config} {}
+
+    /// Add a session and the probe attached to it
+    /// @return false if the group is full
+    bool add(Session& session, const RttProbe& probe) noexcept {
+        if (count_ == MaxSessions) return false;
+        members_[count_++] = Member{&session, &probe};
+        return true;
+    }
+
+    /// Index of the session the next order goes to (NONE if none is Active)
+    [[nodiscard]] size_t select(uint64_t now_tsc = util::detail::rdtscp()) noexcept {
+        size_t best = NONE;
+        uint64_t best_rtt = UINT64_MAX;
+        size_t fallback = NONE;           // Active but not yet measured
+        uint64_t current_rtt = UINT64_MAX;
+
+        for (size_t i = 0; i < count_; ++i) {
+            const Member& m = members_[i];
+            if (m.session->state() != SessionState::Active) continue;
+            const RttStats s = m.probe->stats();
+            if (m.probe->overdue(s, now_tsc)) continue;
+            if (!s.measured()) {
+                if (fallback == NONE) fallback = i;
+                continue;
+            }
+            if (config_.max_rtt_ns != 0 && s.ewma_ns > config_.max_rtt_ns) continue;
+            if (i == current_) current_rtt = s.ewma_ns;
+            if (s.ewma_ns < best_rtt) {
+                best_rtt = s.ewma_ns;
+                best = i;
+            }
+        }
+
+        if (best == NONE) best = fallback;
+        // Stay unless the best beats the current session by the margin
+        if (best != NONE && current_rtt != UINT64_MAX && best != current_ &&
+            best_rtt * (100 + config_.switch_margin_pct) >= current_rtt * 100) {
+            best = current_;
+        }
+        if (best != current_ && best != NONE && current_ != NONE) ++switches_;
+        current_ = best;
+        return best;
+    }
+
+    /// Send through the selected session
+    template <typename MsgBuilder>
+    SessionResult<void> send_app_message(MsgBuilder& builder, bool urgent = false) noexcept {
+        const size_t i = select();
+        if (i == NONE) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        return members_[i].session->send_app_message(builder, urgent);
+    }
+
+    [[nodiscard]] Session& session(size_t i) noexcept { return *members_[i].session; }
+    [[nodiscard]] const RttProbe& probe(size_t i) const noexcept { return *members_[i].probe; }
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+
+    /// Last selection (NONE before the first)
+    [[nodiscard]] size_t current() const noexcept { return current_; }
+
+    /// Times the selection moved from one session to another
+    [[nodiscard]] uint64_t switches() const noexcept { return switches_; }
+
+private:
+    struct Member {
+        Session* session{nullptr};
+        const RttProbe* probe{nullptr};
+    };
+
+    SessionGroupConfig config_;
+    std::array<Member, MaxSessions> members_{};
+    size_t count_{0};
+    size_t current_{NONE};
+    uint64_t switches_{0};
+};
+
+} // namespace nfx
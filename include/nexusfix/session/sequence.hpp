@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <atomic>
 #include <optional>
+#include <span>
+#include <vector>
 
+#include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/util/allocation_tracker.hpp"
 
 namespace nfx {
 
@@ -149,6 +154,7 @@ public:
     MemoryMessageStore() noexcept : head_{0}, count_{0} {}
 
     void store(uint32_t seq_num, std::span<const char> message) override {
+        NFX_NO_ALLOC_REGION("MemoryMessageStore::store");
         if (message.size() > MaxMessageSize) return;
 
         size_t idx = head_;
@@ -210,83 +216,141 @@ private:
 // Sequence Gap Tracker
 // ============================================================================
 
-/// Tracks sequence number gaps for resend handling
+/// Outstanding inbound seqnum ranges, sorted and disjoint
+/// Ranges live in a flat vector ordered by begin; adjacent or overlapping
+/// ranges are merged on insert, so lookups are binary searches and there
+/// is no cap on how fragmented a bad reconnect can leave the sequence.
+/// Sessions reserve DEFAULT_CAPACITY ranges up front; add_gap() and fill()
+/// allocate only when a sequence fragments past the reservation, and then
+/// out of line in grow(), exempt from the caller's no-alloc region.
 class GapTracker {
 public:
-    static constexpr size_t MAX_GAPS = 32;
-
     struct Gap {
         uint32_t begin;
         uint32_t end;
     };
 
-    GapTracker() noexcept : count_{0} {}
+    static constexpr size_t DEFAULT_CAPACITY = 512;  // 4KB of ranges
+
+    GapTracker() noexcept = default;
 
-    /// Add a gap to track
+    /// Reserve room for capacity disjoint ranges
+    explicit GapTracker(size_t capacity) {
+        gaps_.reserve(capacity);
+    }
+
+    /// Add [begin, end] to track, merging with neighbouring ranges
     bool add_gap(uint32_t begin, uint32_t end) noexcept {
-        if (count_ >= MAX_GAPS) return false;
-        gaps_[count_++] = {begin, end};
+        if (begin > end) return false;
+
+        // First range that overlaps or touches begin
+        auto it = std::lower_bound(gaps_.begin(), gaps_.end(), begin,
+            [](const Gap& gap, uint32_t seq) noexcept {
+                return static_cast<uint64_t>(gap.end) + 1 < seq;
+            });
+        auto last = it;
+        while (last != gaps_.end() && last->begin <= static_cast<uint64_t>(end) + 1) {
+            begin = std::min(begin, last->begin);
+            end = std::max(end, last->end);
+            ++last;
+        }
+        if (it == last) {
+            if (gaps_.size() == gaps_.capacity()) [[unlikely]] it = grow(it);
+            gaps_.insert(it, Gap{begin, end});
+        } else {
+            *it = {begin, end};
+            gaps_.erase(it + 1, last);
+        }
         return true;
     }
 
     /// Mark a sequence number as filled
     void fill(uint32_t seq_num) noexcept {
-        for (size_t i = 0; i < count_; ) {
-            auto& gap = gaps_[i];
-            if (seq_num >= gap.begin && seq_num <= gap.end) {
-                if (seq_num == gap.begin && seq_num == gap.end) {
-                    // Gap completely filled, remove
-                    remove_gap(i);
-                } else if (seq_num == gap.begin) {
-                    ++gap.begin;
-                    ++i;
-                } else if (seq_num == gap.end) {
-                    --gap.end;
-                    ++i;
-                } else {
-                    // Split gap
-                    if (count_ < MAX_GAPS) {
-                        gaps_[count_++] = {seq_num + 1, gap.end};
-                        gap.end = seq_num - 1;
-                    }
-                    ++i;
-                }
-            } else {
-                ++i;
-            }
+        auto it = find(gaps_, seq_num);
+        if (it == gaps_.end()) return;
+
+        if (it->begin == it->end) {
+            gaps_.erase(it);     // Gap completely filled
+        } else if (seq_num == it->begin) {
+            ++it->begin;
+        } else if (seq_num == it->end) {
+            --it->end;
+        } else {
+            const Gap upper{seq_num + 1, it->end};
+            it->end = seq_num - 1;
+            if (gaps_.size() == gaps_.capacity()) [[unlikely]] it = grow(it);
+            gaps_.insert(it + 1, upper);
         }
     }
 
+    /// Drop gap seqnums below seq (e.g. after a gap fill up to NewSeqNo)
+    void fill_below(uint32_t seq_num) noexcept {
+        auto it = std::lower_bound(gaps_.begin(), gaps_.end(), seq_num,
+            [](const Gap& gap, uint32_t seq) noexcept { return gap.end < seq; });
+        gaps_.erase(gaps_.begin(), it);
+        if (!gaps_.empty() && gaps_.front().begin < seq_num) gaps_.front().begin = seq_num;
+    }
+
+    /// Check whether seq_num is still outstanding
+    [[nodiscard]] bool contains(uint32_t seq_num) const noexcept {
+        return find(gaps_, seq_num) != gaps_.end();
+    }
+
     /// Check if any gaps remain
     [[nodiscard]] bool has_gaps() const noexcept {
-        return count_ > 0;
+        return !gaps_.empty();
     }
 
     /// Get number of gaps
     [[nodiscard]] size_t gap_count() const noexcept {
-        return count_;
+        return gaps_.size();
+    }
+
+    /// Ranges held before add_gap() / fill() allocate
+    [[nodiscard]] size_t capacity() const noexcept {
+        return gaps_.capacity();
     }
 
-    /// Get gap at index
+    /// Get gap at index (ascending seqnum order)
     [[nodiscard]] const Gap* get_gap(size_t idx) const noexcept {
-        return idx < count_ ? &gaps_[idx] : nullptr;
+        return idx < gaps_.size() ? &gaps_[idx] : nullptr;
+    }
+
+    /// All outstanding ranges, ascending (e.g. one ResendRequest each)
+    [[nodiscard]] std::span<const Gap> ranges() const noexcept {
+        return gaps_;
     }
 
     /// Clear all gaps
     void clear() noexcept {
-        count_ = 0;
+        gaps_.clear();
     }
 
 private:
-    void remove_gap(size_t idx) noexcept {
-        if (idx < count_ - 1) {
-            gaps_[idx] = gaps_[count_ - 1];
-        }
-        --count_;
+    /// Double the reserved ranges; returns it rebased onto the new storage
+    /// Cold: only a sequence fragmented past the reservation gets here.
+    NFX_COLD NFX_NOINLINE std::vector<Gap>::iterator grow(
+        std::vector<Gap>::iterator it) noexcept
+    {
+        NFX_ALLOW_ALLOC_REGION();
+        const auto offset = it - gaps_.begin();
+        gaps_.reserve(std::max(gaps_.capacity() * 2, DEFAULT_CAPACITY));
+        return gaps_.begin() + offset;
     }
 
-    std::array<Gap, MAX_GAPS> gaps_;
-    size_t count_;
+    /// Range containing seq_num, or end()
+    template <typename Gaps>
+    [[nodiscard]] static auto find(Gaps& gaps, uint32_t seq_num) noexcept
+        -> decltype(gaps.begin())
+    {
+        auto it = std::upper_bound(gaps.begin(), gaps.end(), seq_num,
+            [](uint32_t seq, const Gap& gap) noexcept { return seq < gap.begin; });
+        if (it == gaps.begin()) return gaps.end();
+        --it;
+        return seq_num <= it->end ? it : gaps.end();
+    }
+
+    std::vector<Gap> gaps_;
 };
 
 } // namespace nfx
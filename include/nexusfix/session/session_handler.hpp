@@ -15,6 +15,67 @@
         };
 
         SessionManager<MyHandler> session{config, handler};
+
+    Optional typed hooks take the message type as a tag and get their own
+    slot in the session's compile-time dispatch table, so no runtime
+    MsgType branching is needed in the handler:
+
+        void on_message(MsgTypeTag<'8'>, const ParsedMessage& msg) noexcept;
+        void on_message(MsgTypeTag<'A', 'E'>, const ParsedMessage& msg) noexcept;
+
+    Message types without a typed hook go to on_app_message().
+
+    A handler that owns the transport's send buffers can also provide
+    acquire_send_buffer(); application messages are then serialized
+    straight into that buffer and handed to on_send() without a copy:
+
+        std::span<char> acquire_send_buffer() noexcept;  // empty = none free
+
+    With SessionConfig::backfill_body_length the message handed to
+    on_send() starts up to MessageAssembler::HEADER_HEADROOM bytes into
+    that buffer rather than at its first byte.
+
+    Resend replays are handed over in batches when the handler has
+
+        bool on_send_batch(std::span<const std::span<const char>> msgs) noexcept;
+
+    Handlers that build short-lived objects from inbound messages can take
+    the session's per-batch arena (reset after each receive batch, see
+    SessionManager::end_receive_batch):
+
+        void bind_inbound_arena(memory::InboundArena& arena) noexcept;
+
+    Application messages of one receive completion can be delivered in
+    one call instead of one on_app_message() each (see inbound_batch.hpp).
+    Seqnum checks and session-level messages are still handled per message
+    as they arrive; pending application messages are delivered before any
+    session-level message is handled and at end_receive_batch():
+
+        void on_app_messages(std::span<const ParsedMessage> msgs) noexcept;
+
+    Such a handler receives every application message this way, typed
+    hooks included; on_app_message() still sees those fed re-entrantly
+    from a callback or whose MsgType is not in the leading header fields.
+
+    A pre-trade risk stage (see session/risk_check.hpp) sees every order
+    whose builder exposes order_fields() before it is sequenced; false
+    fails send_app_message() with SessionErrorCode::RiskRejected:
+
+        bool pre_trade_check(const OrderFields& order) noexcept;
+
+    An accepted order the session then refuses (throttle reject or queue
+    full, invalid value) or drops (queued when the connection is lost) is
+    handed back, so the stage can undo what the check booked:
+
+        void pre_trade_release(const OrderFields& order) noexcept;
+
+    A handler owning a transport with a send queue monitor (see
+    transport/send_backpressure.hpp) reports it after each send and on
+    each on_timer_tick(), and can be told when it changes, e.g. to
+    conflate quotes while the socket drains:
+
+        BackpressureState send_backpressure() noexcept;
+        void on_backpressure(BackpressureState state) noexcept;
 */
 
 #pragma once
@@ -23,8 +84,11 @@
 #include <span>
 #include <string_view>
 
+#include "nexusfix/memory/message_arena.hpp"
 #include "nexusfix/session/state.hpp"
+#include "nexusfix/transport/send_backpressure.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/types/field_types.hpp"
 
 namespace nfx {
 
@@ -71,6 +135,90 @@ concept HasOnLogout = requires(T& handler, std::string_view reason) {
     { handler.on_logout(reason) } noexcept;
 };
 
+/// Compile-time MsgType tag (one or two characters, e.g. <'8'>, <'A', 'E'>)
+template <char... Chars>
+    requires (sizeof...(Chars) == 1 || sizeof...(Chars) == 2)
+struct MsgTypeTag {
+    static constexpr char value[] = {Chars..., '\0'};
+};
+
+/// Concept for an optional per-MsgType application message hook
+template <typename T, char... Chars>
+concept HasOnMsgType = requires(T& handler, const ParsedMessage& msg) {
+    { handler.on_message(MsgTypeTag<Chars...>{}, msg) } noexcept;
+};
+
+/// Concept for an optional zero-copy send buffer provider
+/// Every non-empty buffer returned is passed back through on_send().
+template <typename T>
+concept HasSendBuffer = requires(T& handler) {
+    { handler.acquire_send_buffer() } noexcept -> std::same_as<std::span<char>>;
+};
+
+/// Concept for an optional batched send (e.g. one scatter-gather submit)
+/// Used for resend replays; messages must go out in order.
+template <typename T>
+concept HasOnSendBatch = requires(T& handler, std::span<const std::span<const char>> batch) {
+    { handler.on_send_batch(batch) } noexcept -> std::same_as<bool>;
+};
+
+/// Concept for an optional resend filter
+/// Stored application messages it rejects (e.g. stale orders) are
+/// gap-filled like admin messages instead of being resent.
+template <typename T>
+concept HasResendFilter = requires(T& handler, std::span<const char> stored) {
+    { handler.should_resend(stored) } noexcept -> std::same_as<bool>;
+};
+
+/// Concept for an optional inbound arena consumer
+/// Called once at session construction; the arena lives as long as the
+/// session and is reset after every receive batch.
+template <typename T>
+concept HasInboundArena = requires(T& handler, memory::InboundArena& arena) {
+    { handler.bind_inbound_arena(arena) } noexcept;
+};
+
+/// Concept for optional batched delivery of application messages
+/// Messages (and the bytes they view) are valid for the call only.
+template <typename T>
+concept HasBatchedDelivery = requires(T& handler, std::span<const ParsedMessage> msgs) {
+    { handler.on_app_messages(msgs) } noexcept;
+};
+
+/// Concept for an optional pre-trade risk stage
+/// Returns false to refuse the order; nothing is sent or sequenced.
+template <typename T>
+concept HasPreTradeRisk = requires(T& handler, const OrderFields& order) {
+    { handler.pre_trade_check(order) } noexcept -> std::same_as<bool>;
+};
+
+/// Concept for giving back an order pre_trade_check() accepted
+/// Called when the session refuses or drops it before it is sequenced.
+template <typename T>
+concept HasPreTradeRelease = requires(T& handler, const OrderFields& order) {
+    { handler.pre_trade_release(order) } noexcept;
+};
+
+/// Concept for an optional send queue probe (transport backpressure)
+/// Should sample the socket while Draining (poll_backpressure()) so
+/// the session sees it clear.
+template <typename T>
+concept HasSendBackpressure = requires(T& handler) {
+    { handler.send_backpressure() } noexcept -> std::same_as<BackpressureState>;
+};
+
+/// Concept for an optional backpressure change notification
+template <typename T>
+concept HasOnBackpressure = requires(T& handler, BackpressureState state) {
+    { handler.on_backpressure(state) } noexcept;
+};
+
+/// Outbound builders that carry an order (NewOrderSingle)
+template <typename B>
+concept HasOrderFields = requires(const B& builder) {
+    { builder.order_fields() } noexcept -> std::same_as<OrderFields>;
+};
+
 /// Complete session handler concept - requires all callbacks
 template <typename T>
 concept SessionHandler = HasOnAppMessage<T> &&
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/error.hpp"
@@ -12,12 +17,35 @@
 #include "nexusfix/messages/common/trailer.hpp"
 #include "nexusfix/messages/fix44/logon.hpp"
 #include "nexusfix/messages/fix44/heartbeat.hpp"
+#include "nexusfix/messages/fixt11/logon.hpp"
+#include "nexusfix/messages/fixt11/session.hpp"
 #include "nexusfix/session/state.hpp"
 #include "nexusfix/session/sequence.hpp"
 #include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/session/session_handler.hpp"
+#include "nexusfix/session/resend.hpp"
+#include "nexusfix/session/inbound_batch.hpp"
+#include "nexusfix/session/throttle.hpp"
+#include "nexusfix/session/header_rewrite.hpp"
+#include "nexusfix/session/duplicate_filter.hpp"
+#include "nexusfix/session/flight_recorder.hpp"
+#include "nexusfix/session/latency_histogram.hpp"
+#include "nexusfix/session/perf_profile.hpp"
+#include "nexusfix/session/rtt_probe.hpp"
+#include "nexusfix/session/metrics.hpp"
+#include "nexusfix/memory/memory_budget.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/util/allocation_tracker.hpp"
+#include "nexusfix/util/binary_logger.hpp"
 #include "nexusfix/util/fast_timestamp.hpp"
+#include "nexusfix/util/profile_zones.hpp"
 #include "nexusfix/util/rdtsc_timestamp.hpp"
+#include "nexusfix/util/timer_wheel.hpp"
+#include "nexusfix/util/working_set.hpp"
+#include "nexusfix/store/audit_tap.hpp"
 #include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/replication.hpp"
+#include "nexusfix/store/session_control_block.hpp"
 
 namespace nfx {
 
@@ -46,6 +74,38 @@ struct SessionCallbacks {
     std::function<void(std::string_view)> on_logout;
 };
 
+/// SessionHandler adapter over SessionCallbacks (default SessionManager handler)
+/// Unset callbacks are skipped; on_send reports failure when unset.
+struct CallbackSessionHandler {
+    SessionCallbacks callbacks;
+
+    void on_app_message(const ParsedMessage& msg) noexcept {
+        if (callbacks.on_app_message) callbacks.on_app_message(msg);
+    }
+
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        if (callbacks.on_state_change) callbacks.on_state_change(from, to);
+    }
+
+    bool on_send(std::span<const char> data) noexcept {
+        return callbacks.on_send && callbacks.on_send(data);
+    }
+
+    void on_error(const SessionError& err) noexcept {
+        if (callbacks.on_error) callbacks.on_error(err);
+    }
+
+    void on_logon() noexcept {
+        if (callbacks.on_logon) callbacks.on_logon();
+    }
+
+    void on_logout(std::string_view reason) noexcept {
+        if (callbacks.on_logout) callbacks.on_logout(reason);
+    }
+};
+
+static_assert(SessionHandler<CallbackSessionHandler>, "CallbackSessionHandler must satisfy SessionHandler concept");
+
 // ============================================================================
 // Heartbeat Timer
 // ============================================================================
@@ -102,6 +162,15 @@ public:
         test_request_pending_ = true;
     }
 
+    /// Inbound traffic answered the test request (no clock read)
+    void test_request_answered() noexcept {
+        test_request_pending_ = false;
+    }
+
+    [[nodiscard]] bool test_request_pending() const noexcept {
+        return test_request_pending_;
+    }
+
     /// Set heartbeat interval
     void set_interval(int seconds) noexcept {
         interval_ = Duration{seconds};
@@ -127,20 +196,101 @@ private:
     bool test_request_pending_;
 };
 
+// ============================================================================
+// Admin Message Set
+// ============================================================================
+
+/// Builders for the session-level messages of one FIX version
+/// FixVersion::Unknown keeps the FIX 4.4 builders (BeginString FIX.4.4).
+template <FixVersion Version>
+struct AdminMessages {
+    using Logon = fix44::Logon;
+    using Logout = fix44::Logout;
+    using Heartbeat = fix44::Heartbeat;
+    using TestRequest = fix44::TestRequest;
+    using ResendRequest = fix44::ResendRequest;
+    using SequenceReset = fix44::SequenceReset;
+};
+
+template <FixVersion Version>
+    requires (SessionVersion<Version>::is_fixt)
+struct AdminMessages<Version> {
+    using Logon = fixt11::Logon;
+    using Logout = fixt11::Logout;
+    using Heartbeat = fixt11::Heartbeat;
+    using TestRequest = fixt11::TestRequest;
+    using ResendRequest = fixt11::ResendRequest;
+    using SequenceReset = fixt11::SequenceReset;
+};
+
+// ============================================================================
+// Pre-built Sends
+// ============================================================================
+
+/// What SessionManager::send_prebuilt() did with its messages
+struct PrebuiltSendResult {
+    size_t taken{0};      // From the front: sequenced, queued by the throttle, or skipped
+    size_t accepted{0};   // Of those, sequenced or queued (the rest can never be sent)
+};
+
 // ============================================================================
 // Session Manager
 // ============================================================================
 
 /// Manages FIX session lifecycle and message handling
+/// @tparam Handler Session callbacks (see session_handler.hpp), called
+///         directly so they can be inlined. The handler is held by value;
+///         use handler() to reach its state.
+///
+/// @tparam Version FIX version the session is fixed to (FIX_4_4 or a
+///         FIXT / FIX 5.x version). BeginString, the inbound BeginString
+///         check, the admin message builders and Logon's DefaultApplVerID
+///         are then compile-time constants; config.begin_string is
+///         ignored. FixVersion::Unknown takes BeginString from the config
+///         and accepts any on receipt.
+///
+/// Inbound messages are routed through constexpr tables from MsgType to
+/// session / handler member: 256 entries by first character, plus a
+/// second level for two-character types ("AE", "BZ", ...).
+template <SessionHandler Handler = CallbackSessionHandler,
+          FixVersion Version = FixVersion::Unknown>
 class SessionManager {
+    static_assert(Version == FixVersion::Unknown || Version == FixVersion::FIX_4_4 ||
+                  SessionVersion<Version>::is_fixt,
+                  "Fixed-version sessions speak FIX 4.4 or FIXT.1.1 (FIX 5.x)");
+
 public:
-    explicit SessionManager(const SessionConfig& config) noexcept
-        : config_{config}
+    using Protocol = SessionVersion<Version>;
+    using Admin = AdminMessages<Version>;
+
+    explicit SessionManager(const SessionConfig& config, Handler handler = Handler{}) noexcept
+        : config_{with_begin_string(config)}
         , state_{SessionState::Disconnected}
+        , handler_{std::move(handler)}
         , heartbeat_timer_{config.heart_bt_int}
         , assembler_{}
         , sequences_{}
-        , stats_{} {}
+        , stats_{}
+        , timestamp_generator_{config.timestamp_precision} {
+        if constexpr (HasInboundArena<Handler>) {
+            handler_.bind_inbound_arena(inbound_arena_);
+        }
+        if constexpr (HasBatchedDelivery<Handler>) {
+            inbound_batch_.emplace(config.inbound_batch_bytes, config.inbound_batch_messages);
+        }
+        send_timer_.bind(&on_send_deadline, this);
+        recv_timer_.bind(&on_recv_deadline, this);
+        logon_timer_.bind(&on_logon_deadline, this);
+        throttle_timer_.bind(&on_throttle_deadline, this);
+        idle_timer_.bind(&on_idle_deadline, this);
+        assembler_.set_header_backfill(config.backfill_body_length);
+        assembler_.set_value_validation(config.validate_outbound_values);
+        // Session-constant header bytes, rendered once for every message
+        (void)assembler_.set_session_header(config_.begin_string, config.sender_comp_id,
+                                            config.target_comp_id);
+        if (config.duplicate_window != 0) duplicates_.emplace(config.duplicate_window);
+        emplace_throttle();
+    }
 
     // Non-copyable, non-movable
     SessionManager(const SessionManager&) = delete;
@@ -150,11 +300,16 @@ public:
     // Session Control
     // ========================================================================
 
-    /// Set callbacks
-    void set_callbacks(SessionCallbacks callbacks) noexcept {
-        callbacks_ = std::move(callbacks);
+    /// Set callbacks (std::function adapter only)
+    void set_callbacks(SessionCallbacks callbacks) noexcept
+        requires std::same_as<Handler, CallbackSessionHandler>
+    {
+        handler_.callbacks = std::move(callbacks);
     }
 
+    [[nodiscard]] Handler& handler() noexcept { return handler_; }
+    [[nodiscard]] const Handler& handler() const noexcept { return handler_; }
+
     /// Set message store for resend support
     /// @param store Pointer to message store (ownership NOT transferred)
     void set_message_store(store::IMessageStore* store) noexcept {
@@ -166,13 +321,282 @@ public:
         return message_store_;
     }
 
+    /// Publish every inbound and sequenced outbound message to an audit tap
+    /// Outbound descriptors point at the store's record when it exposes
+    /// one (last_stored()); other messages are copied to the tap's capture
+    /// journal. Sinks drain the tap on their own threads.
+    /// @param tap Pointer to audit tap (ownership NOT transferred)
+    void set_audit_tap(store::AuditTap* tap) noexcept {
+        audit_tap_ = tap;
+    }
+
+    [[nodiscard]] store::AuditTap* audit_tap() const noexcept {
+        return audit_tap_;
+    }
+
+    /// Replicate stored messages and seqnums to a hot standby
+    /// Frames are shipped at the end of each receive batch, on the timer
+    /// tick, and after each application message sent without coalescing.
+    /// @param publisher Pointer to publisher (ownership NOT transferred)
+    void set_replicator(store::ReplicationPublisher* publisher) noexcept {
+        replicator_ = publisher;
+        if (publisher) {
+            publisher->on_sequences(sequences_.current_outbound(), sequences_.expected_inbound());
+        }
+    }
+
+    [[nodiscard]] store::ReplicationPublisher* replicator() const noexcept {
+        return replicator_;
+    }
+
+    /// Log every received message and every stored outbound message,
+    /// raw, to a binary logger (retransmissions are not logged again)
+    /// @param logger Pointer to logger (ownership NOT transferred)
+    /// @param session_id Id the decoder shows for this session
+    void set_binary_logger(util::BinaryLogger* logger, uint16_t session_id) noexcept {
+        binary_logger_ = logger;
+        log_session_id_ = session_id;
+    }
+
+    [[nodiscard]] util::BinaryLogger* binary_logger() const noexcept { return binary_logger_; }
+
+    /// Trace each message's path (receive, parse, handler, build, send)
+    /// into a flight recorder, which may be shared with other sessions
+    /// @param recorder Pointer to recorder (ownership NOT transferred)
+    /// @param session_id Id the trace records carry for this session
+    void set_flight_recorder(FlightRecorder* recorder, uint16_t session_id) noexcept {
+        flight_recorder_ = recorder;
+        trace_session_id_ = session_id;
+    }
+
+    [[nodiscard]] FlightRecorder* flight_recorder() const noexcept { return flight_recorder_; }
+
+    /// Sample hardware counters around parse, dispatch and build, per
+    /// message type; the profile's counters must belong to the thread
+    /// that drives this session
+    /// @param profile Pointer to profile (ownership NOT transferred)
+    void set_perf_profile(MsgTypePerfProfile* profile) noexcept {
+        perf_profile_ = profile && profile->active() ? profile : nullptr;
+    }
+
+    [[nodiscard]] MsgTypePerfProfile* perf_profile() const noexcept { return perf_profile_; }
+
+    /// Measure round trips with rdtsc-stamped TestRequests
+    /// While Active, on_timer_tick() sends a probe every interval_ns;
+    /// liveness TestRequests carry probe ids too.
+    /// @param probe Pointer to probe (ownership NOT transferred)
+    void set_rtt_probe(RttProbe* probe) noexcept { rtt_probe_ = probe; }
+
+    [[nodiscard]] RttProbe* rtt_probe() const noexcept { return rtt_probe_; }
+
+    /// Hold this session to a memory budget
+    /// Each timer tick charges memory_regions() to it (the message store's
+    /// as Store, the rest as Buffers) and re-reads its tracked heaps. Over
+    /// the hard limit application messages are refused (Throttled,
+    /// counted in budget_rejects); on disconnect the resend batch is
+    /// released and the budget reclaims in full (pools reset and purged).
+    /// @param budget Pointer to budget (ownership NOT transferred)
+    /// @param slot Optional; MemoryBudgetStats published with the other metrics
+    void set_memory_budget(memory::MemoryBudget* budget,
+                           MetricsSlot<memory::MemoryBudgetStats>* slot = nullptr) noexcept {
+        memory_budget_ = budget;
+        budget_metrics_ = budget ? slot : nullptr;
+        if (budget) {
+            charge_memory_budget();
+            budget->update();
+        }
+    }
+
+    [[nodiscard]] memory::MemoryBudget* memory_budget() const noexcept { return memory_budget_; }
+
+    /// Release the large buffers of an idle session: the resend, send and
+    /// inbound batches, the throttle queue, the forward buffer and the
+    /// message store's ring and index (IMessageStore::hibernate()).
+    /// Seqnums, heartbeat deadlines and the rendered session header stay,
+    /// so Heartbeats and TestRequests are still answered and sent without
+    /// waking (they are not stored; a resend gap-fills them as always).
+    /// Any other inbound message, and any application send, wakes the
+    /// session first. Called after hibernate_after_ms without application
+    /// messages either way; with a memory::HibernationPool as the store's
+    /// upstream the freed blocks serve the next session to wake.
+    /// @return false if already hibernated, inside a handler, or with
+    ///         sends still queued
+    bool hibernate() noexcept {
+        if (hibernated_ || inbound_depth_ != 0) return false;
+        if constexpr (HasBatchedDelivery<Handler>) deliver_batch();
+        if (!flush_sends() || throttled_sends() != 0) return false;
+
+        resend_batch_.reset();
+        outbound_batch_.reset();
+        if constexpr (HasBatchedDelivery<Handler>) inbound_batch_.reset();
+        throttle_.reset();                         // Refilled to its burst when re-created
+        std::vector<char>{}.swap(forward_buffer_);
+        if (message_store_) (void)message_store_->hibernate();
+        inbound_arena_.reset();
+        if (timer_wheel_) timer_wheel_->cancel(idle_timer_);
+
+        hibernated_ = true;
+        ++stats_.hibernations;
+        return true;
+    }
+
+    /// Restore what hibernate() released (no-op when awake)
+    void wake() noexcept {
+        if (!hibernated_) return;
+        hibernated_ = false;
+        if (message_store_) message_store_->rehydrate();
+        if constexpr (HasBatchedDelivery<Handler>) {
+            inbound_batch_.emplace(config_.inbound_batch_bytes, config_.inbound_batch_messages);
+        }
+        emplace_throttle();
+        ++stats_.wakeups;
+        idle_activity_ = app_activity();
+        idle_since_ns_ = util::RdtscClock::now_ns();
+        if (timer_wheel_ && state_ == SessionState::Active) arm_idle_timer();
+    }
+
+    [[nodiscard]] bool hibernated() const noexcept { return hibernated_; }
+
+    /// Memory this session writes while active: the session object itself
+    /// (inbound arena, assembler buffer), the resend and coalescing batches
+    /// once allocated, and the message store's regions
+    size_t memory_regions(std::span<util::MemoryRegion> out) const noexcept {
+        size_t n = util::write_regions(out, {
+            {"session", const_cast<SessionManager*>(this), sizeof(*this)}});
+        if (resend_batch_) {
+            n += resend_batch_->memory_regions(out.subspan(n), "session.resend_arena",
+                                               "session.resend_spans");
+        }
+        if (outbound_batch_) {
+            n += outbound_batch_->memory_regions(out.subspan(n), "session.send_arena",
+                                                 "session.send_spans");
+        }
+        if (inbound_batch_) {
+            n += inbound_batch_->memory_regions(out.subspan(n), "session.inbound_batch_arena",
+                                                "session.inbound_batch_messages");
+        }
+        if (message_store_) n += message_store_->memory_regions(out.subspan(n));
+        return n;
+    }
+
+    /// Startup phase: allocate the batches now instead of on first use,
+    /// then lock, pre-fault and prefetch memory_regions() so no page fault
+    /// hits after logon. Call after set_message_store(), before on_connect().
+    [[nodiscard]] util::WorkingSetReport prepare(const util::PrepareOptions& options = {}) {
+        util::WorkingSet working_set;
+        return prepare(working_set, options);
+    }
+
+    /// prepare() together with other regions, e.g. the transport's buffer pools
+    [[nodiscard]] util::WorkingSetReport prepare(util::WorkingSet& working_set,
+                                                 const util::PrepareOptions& options = {}) {
+        if (!resend_batch_) resend_batch_.emplace();
+        if (config_.coalesce_sends && !outbound_batch_) {
+            outbound_batch_.emplace(config_.coalesce_buffer_size, ResendBatch::DEFAULT_MAX_MESSAGES);
+        }
+        working_set.add(*this);
+        return working_set.prepare(options);
+    }
+
+    /// Publish SessionStats (and the message store's Stats) to a metrics
+    /// registry on every timer tick and on publish_metrics()
+    /// @param store_slot Optional; needs a message store
+    /// Slots are owned by the MetricsRegistry (ownership NOT transferred)
+    void set_metrics(MetricsSlot<SessionStats>* session_slot,
+                     MetricsSlot<store::IMessageStore::Stats>* store_slot = nullptr) noexcept {
+        session_metrics_ = session_slot;
+        store_metrics_ = store_slot;
+        publish_metrics();
+    }
+
+    /// Copy the current stats into the metrics slots (session thread)
+    void publish_metrics() noexcept {
+        if (session_metrics_) session_metrics_->publish(stats_);
+        if (store_metrics_ && message_store_) store_metrics_->publish(message_store_->stats());
+        if (budget_metrics_) budget_metrics_->publish(memory_budget_->stats());
+    }
+
+    /// Resume at seqnums known from elsewhere (e.g. a replicated standby
+    /// taking over); call before logon
+    void restore_sequences(uint32_t next_sender, uint32_t next_target) noexcept {
+        sequences_.set_outbound(next_sender);
+        sequences_.set_inbound(next_target);
+        inbound_gaps_.clear();
+        inbound_high_ = 0;
+        if (control_block_) {
+            control_block_->set_next_sender_seq(next_sender);
+            control_block_->set_next_target_seq(next_target);
+            control_block_->save_gaps(inbound_gaps_);
+        }
+        if (replicator_) replicator_->on_sequences(next_sender, next_target);
+    }
+
+    /// Mirror seqnums, logon time and inbound gaps into a control block
+    /// A recovered block restores them here, so a restarted session
+    /// resumes its sequence without scanning the journal.
+    /// @param block Pointer to control block (ownership NOT transferred)
+    void set_control_block(store::SessionControlBlock* block) noexcept {
+        control_block_ = block;
+        if (!block) return;
+        if (block->recovered()) {
+            block->restore_sequences(sequences_);
+            block->restore_gaps(inbound_gaps_);
+            inbound_high_ = inbound_gaps_.has_gaps() ? inbound_gaps_.ranges().back().end : 0;
+        } else {
+            block->set_next_sender_seq(sequences_.current_outbound());
+            block->set_next_target_seq(sequences_.expected_inbound());
+            block->save_gaps(inbound_gaps_);
+        }
+    }
+
+    /// Drive heartbeats, test requests and logon timeouts from a shared wheel
+    /// Deadlines are scheduled on entering LogonSent / Active, pushed back
+    /// on traffic and cancelled on leaving, so the owner only advances the
+    /// wheel; on_timer_tick() then just flushes coalesced sends and no
+    /// per-message clock reads remain. nullptr returns to polling.
+    /// @param wheel Advanced on the session's thread
+    void set_timer_wheel(util::TimerWheel* wheel) noexcept {
+        cancel_timers();
+        timer_wheel_ = wheel;
+        if (!wheel) return;
+        if (state_ == SessionState::LogonSent) arm_logon_timer();
+        if (state_ == SessionState::Active) {
+            arm_heartbeat_timers();
+            arm_idle_timer();
+        }
+        if (throttle_ && !throttle_->empty()) arm_throttle_timer(util::RdtscClock::now_ns());
+    }
+
+    [[nodiscard]] util::TimerWheel* timer_wheel() const noexcept { return timer_wheel_; }
+
+    /// Inbound ranges requested by ResendRequest and not yet received
+    [[nodiscard]] const GapTracker& inbound_gaps() const noexcept { return inbound_gaps_; }
+
     /// Called when TCP connection is established
     void on_connect() noexcept {
+        gaps_requested_ = false;  // Re-request outstanding ranges on this connection
         transition(SessionEvent::Connect);
     }
 
     /// Called when TCP connection is lost
     void on_disconnect() noexcept {
+        if constexpr (HasBatchedDelivery<Handler>) deliver_batch();  // Already sequenced
+        if (outbound_batch_) outbound_batch_->clear();  // Stored; recovered by resend
+        if (throttle_ && !throttle_->empty()) {
+            // Never sequenced: stale orders are not sent on the next connection
+            stats_.throttle_dropped += throttle_->size();
+            if constexpr (HasPreTradeRisk<Handler> && HasPreTradeRelease<Handler>) release_booked_throttled();
+            throttle_->clear();
+            stats_.throttle_queue_depth = 0;
+        }
+        backpressure_ = BackpressureState::Clear;  // A new connection starts empty
+        stats_.backpressured = false;
+        if (rtt_probe_) rtt_probe_->reset();        // Its echo can no longer arrive
+        if (memory_budget_) {
+            resend_batch_.reset();                     // Allocated again on the next resend
+            charge_memory_budget();
+            memory_budget_->reclaim(true);
+        }
         transition(SessionEvent::Disconnect);
     }
 
@@ -183,7 +607,7 @@ public:
         }
 
         // Build logon message
-        auto msg = fix44::Logon::Builder{}
+        auto msg = logon_builder()
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -207,7 +631,7 @@ public:
             return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
         }
 
-        auto msg = fix44::Logout::Builder{}
+        auto msg = typename Admin::Logout::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -224,23 +648,85 @@ public:
     }
 
     /// Process incoming data
-    void on_data_received(std::span<const char> data) noexcept {
+    NFX_HOT void on_data_received(std::span<const char> data) noexcept {
+        on_data_received(data, WireTimestamp{});
+    }
+
+    /// Process incoming data stamped by the transport (SO_TIMESTAMPING)
+    /// The stamp is attached to the ParsedMessage handed to the handler.
+    NFX_HOT void on_data_received(std::span<const char> data, const WireTimestamp& rx_time) noexcept {
+        NFX_NO_ALLOC_REGION("SessionManager::on_data_received");
+        const uint64_t recv_tsc = latency_.stamp();
+        uint64_t trace_id = 0;
+        if (flight_recorder_) [[unlikely]] {
+            trace_id = flight_recorder_->next_trace_id();
+            flight_recorder_->trace(TracePoint::RecvCqe, trace_id, trace_session_id_);
+        }
+        if (binary_logger_) {
+            (void)binary_logger_->log(util::LogDirection::Inbound, log_session_id_, data);
+        }
+
+        util::PerfSample perf_start{};
+        if (perf_profile_) [[unlikely]] perf_profile_->begin(perf_start);
+
         // Update heartbeat timer
-        heartbeat_timer_.message_received();
+        note_received();
         ++stats_.messages_received;
         stats_.bytes_received += data.size();
 
-        // Parse message
-        auto result = ParsedMessage::parse(data);
-        if (!result.has_value()) {
-            handle_parse_error(result.error());
+        if (!config_.msg_type_filter.empty() && state_ == SessionState::Active &&
+            skip_ignored(data)) {
             return;
         }
 
-        auto& msg = *result;
+        // Parse in place into the session's reused message. A handler that
+        // feeds this session again from a callback parses into a message
+        // of its own, leaving the one still being dispatched intact.
+        // Batched application messages are parsed from a copy in the batch.
+        std::span<const char> bytes = data;
+        ParsedMessage* batched = nullptr;
+        if constexpr (HasBatchedDelivery<Handler>) {
+            if (inbound_depth_ == 0) batched = stage_batched(bytes);
+        }
+        std::optional<ParsedMessage> nested;
+        ParsedMessage& msg = batched ? *batched
+                           : inbound_depth_ == 0 ? inbound_msg_ : nested.emplace();
+        DepthGuard depth_guard{++inbound_depth_};
+
+        NFX_ZONE_BEGIN(parse);
+        const ParseError parse_error = config_.expect_fixed_header_layout
+            ? ParsedMessage::parse_into<Version>(bytes, header_predictor_, msg)
+            : ParsedMessage::parse_into<Version>(bytes, msg);
+        NFX_ZONE_END(parse);
+        if (parse_error.code != ParseErrorCode::None) {
+            handle_parse_error(parse_error);
+            return;
+        }
+
+        if (hibernated_ && !answered_hibernated(msg.msg_type())) [[unlikely]] wake();
+
+        const uint64_t parsed_tsc = latency_.stamp();
+        latency_.record(LatencyStage::RecvToParse, recv_tsc, parsed_tsc);
+
+        msg.set_receive_timestamp(rx_time);
+        if (trace_id) {
+            flight_recorder_->trace(TracePoint::ParseDone, trace_id, trace_session_id_, msg.msg_seq_num());
+        }
+        if (perf_profile_) [[unlikely]] {
+            perf_profile_->end(PerfRegion::Parse, msg.get_string(tag::MsgType::value), perf_start);
+            perf_profile_->begin(perf_start);
+        }
+        if (audit_tap_) {
+            (void)audit_tap_->capture(store::AuditDirection::Inbound, msg.msg_seq_num(),
+                                      data, util::RdtscClock::now_ns());
+        }
 
         // Validate sequence number
         auto seq_result = sequences_.validate_inbound(msg.msg_seq_num());
+        if (seq_result == SequenceManager::SequenceResult::GapDetected &&
+            msg.msg_seq_num() <= inbound_high_ && !inbound_gaps_.contains(msg.msg_seq_num())) {
+            seq_result = SequenceManager::SequenceResult::TooLow;  // Already received past a gap
+        }
         if (seq_result == SequenceManager::SequenceResult::GapDetected) {
             handle_sequence_gap(msg.msg_seq_num());
         } else if (seq_result == SequenceManager::SequenceResult::TooLow) {
@@ -250,21 +736,71 @@ public:
                 handle_sequence_error(msg.msg_seq_num());
                 return;
             }
+        } else {
+            inbound_advanced();
         }
 
-        // Route by message type
-        char msg_type = msg.msg_type();
-        if (msg_type::is_admin(msg_type)) {
-            handle_admin_message(msg);
+        if (config_.msg_type_filter.ignores(msg.get_string(tag::MsgType::value))) [[unlikely]] {
+            ++stats_.messages_filtered;  // Sequenced on the full path, not dispatched
+            return;
+        }
+        if (duplicates_ && is_resent_duplicate(msg)) [[unlikely]] {
+            ++stats_.duplicates_dropped;  // Sequenced, already handled once
+            return;
+        }
+
+        latency_.record(LatencyStage::ParseToHandler, parsed_tsc, latency_.stamp());
+        if (batched) {
+            inbound_batch_->commit();  // Delivered with the rest of the batch
+            return;
+        }
+        NFX_ZONE_BEGIN(dispatch);
+        if (trace_id) [[unlikely]] {
+            dispatch_traced(msg, trace_id);
         } else {
-            handle_app_message(msg);
+            dispatch(msg);
         }
+        NFX_ZONE_END(dispatch);
+        if (perf_profile_) [[unlikely]] {
+            perf_profile_->end(PerfRegion::Dispatch, msg.get_string(tag::MsgType::value), perf_start);
+        }
+    }
+
+    /// End of the messages delivered by one receive completion
+    /// Resets the inbound arena (everything handlers allocated from it is
+    /// reclaimed) and flushes replies coalesced while handling the batch.
+    void end_receive_batch() noexcept {
+        if constexpr (HasBatchedDelivery<Handler>) deliver_batch();
+        inbound_arena_.reset();
+        flush_sends();
+        if (replicator_) (void)replicator_->flush();
     }
 
+    /// Arena handlers may allocate from until end_receive_batch()
+    [[nodiscard]] memory::InboundArena& inbound_arena() noexcept { return inbound_arena_; }
+
     /// Periodic timer tick (call regularly, e.g., every 100ms)
+    /// With a timer wheel attached only coalesced sends are flushed here.
     void on_timer_tick() noexcept {
+        latency_.publish();
+        if (perf_profile_) perf_profile_->publish();
+        if (memory_budget_) {
+            charge_memory_budget();
+            memory_budget_->update();
+        }
+        publish_metrics();
         if (state_ != SessionState::Active) return;
 
+        poll_backpressure();
+        flush_sends();
+        if (replicator_) (void)replicator_->flush();
+        if (rtt_probe_ && rtt_probe_->due(util::detail::rdtscp())) send_rtt_probe();
+        if (timer_wheel_) return;
+
+        if (config_.hibernate_after_ms != 0 && !hibernated_) check_idle(util::RdtscClock::now_ns());
+
+        if (throttle_ && !throttle_->empty()) release_throttled(util::RdtscClock::now_ns());
+
         if (heartbeat_timer_.has_timed_out()) {
             transition(SessionEvent::HeartbeatTimeout);
             return;
@@ -282,26 +818,315 @@ public:
     // ========================================================================
 
     /// Send an application message
+    /// With SessionConfig::coalesce_sends the message is queued and goes
+    /// out with the rest of the batch on flush_sends(); an urgent message
+    /// flushes the queue (itself included) immediately.
+    /// With SessionConfig::throttle_rate each message takes a token first;
+    /// without one it is rejected (Throttled), queued unsequenced, or sent
+    /// after a short spin, per throttle_mode. With hold_on_backpressure a
+    /// non-urgent message is queued while the transport is Draining.
+    /// Over a memory budget's hard limit every message is refused.
+    /// Orders pass the handler's pre-trade check (if any) before both;
+    /// one refused after it is handed back to pre_trade_release().
     template <typename MsgBuilder>
-    SessionResult<void> send_app_message(MsgBuilder& builder) noexcept {
+    SessionResult<void> send_app_message(MsgBuilder& builder, bool urgent = false) noexcept {
         if (!can_send_app_messages(state_)) {
             return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
         }
+        if (memory_budget_ && !memory_budget_->admit()) [[unlikely]] {
+            ++stats_.budget_rejects;
+            return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+        }
+        if (hibernated_) [[unlikely]] wake();
+        const uint64_t send_tsc = latency_.stamp();
+
+        if constexpr (HasPreTradeRisk<Handler> && HasOrderFields<MsgBuilder>) {
+            if (!handler_.pre_trade_check(builder.order_fields())) [[unlikely]] {
+                ++stats_.risk_rejects;
+                return std::unexpected{SessionError{SessionErrorCode::RiskRejected}};
+            }
+        }
+
+        if (throttle_) {
+            const ThrottleAdmit admit = !urgent && holding_for_backpressure()
+                ? ThrottleAdmit::Hold : throttle_admit();
+            if (admit == ThrottleAdmit::Hold) {
+                auto held = queue_throttled(builder);
+                if (!held) {
+                    release_pre_trade(builder);
+                    return held;
+                }
+                ++stats_.backpressure_held;
+                release_throttled(util::RdtscClock::now_ns());  // A cancel is not held
+                return held;
+            }
+            if (admit == ThrottleAdmit::Queue) {
+                auto queued = queue_throttled(builder);
+                if (!queued) release_pre_trade(builder);
+                return queued;
+            }
+            if (admit == ThrottleAdmit::Reject) {
+                ++stats_.throttle_rejects;
+                release_pre_trade(builder);
+                return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+            }
+        }
+
+        const bool coalesce = config_.coalesce_sends && (!urgent || pending_sends() != 0);
+
+        util::PerfSample perf_start{};
+        if (perf_profile_) [[unlikely]] perf_profile_->begin(perf_start);
+
+        // Serialize into the transport's buffer when the handler has one
+        // (not when queueing or validating: the handler expects that buffer
+        // back in on_send, and a rejected value is never sent)
+        if constexpr (HasSendBuffer<Handler>) {
+            if (!coalesce && !config_.validate_outbound_values) {
+                if (auto dest = handler_.acquire_send_buffer(); !dest.empty()) {
+                    assembler_.into(dest);
+                }
+            }
+        }
 
+        const uint32_t seq = sequences_.current_outbound();
+        NFX_ZONE_BEGIN(build);
         auto msg = builder
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
             .sending_time(current_timestamp())
             .build(assembler_);
+        NFX_ZONE_END(build);
+        if (assembler_.invalid_field() != 0) [[unlikely]] {
+            // A value with SOH or '=': give the seqnum back, send nothing
+            sequences_.set_outbound(seq);
+            ++stats_.invalid_values;
+            release_pre_trade(builder);
+            return std::unexpected{SessionError{SessionErrorCode::MalformedMessage}};
+        }
+        latency_.record(LatencyStage::HandlerToSend, send_tsc, latency_.stamp());
+        if (perf_profile_) [[unlikely]] perf_profile_->end(PerfRegion::Build, built_msg_type(msg), perf_start);
+
+        if (flight_recorder_) [[unlikely]] {
+            // Inside a handler: the inbound message's trace; else a new one
+            const uint64_t active = FlightRecorder::active_trace();
+            send_trace_.id = active ? active : flight_recorder_->next_trace_id();
+            send_trace_.seq = sequences_.current_outbound() - 1;
+            flight_recorder_->trace(TracePoint::BuildDone, send_trace_.id, trace_session_id_, send_trace_.seq);
+        }
 
-        if (!send_message(msg)) {
+        const bool sent = coalesce ? queue_message(msg, urgent) : send_message(msg);
+        if (send_trace_.id && coalesce) batch_trace_ = send_trace_;
+        send_trace_ = {};
+        if (replicator_ && !coalesce) (void)replicator_->flush();
+        if (!sent) {
             return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
         }
 
         return {};
     }
 
+    /// Forward a message received on another session (see message_router.hpp)
+    /// Its header is replaced by this session's CompIDs, next MsgSeqNum
+    /// and SendingTime plus fields; the body is copied once, unparsed,
+    /// into the send buffer and the CheckSum adjusted over the header
+    /// bytes only (header_rewrite.hpp). Throttling, hold_on_backpressure
+    /// and coalescing apply as in send_app_message(); the handler's
+    /// pre-trade check does not (there are no order fields to check).
+    SessionResult<void> forward_message(const ParsedMessage& received,
+                                        const ForwardFields& fields = {},
+                                        bool urgent = false) noexcept {
+        if (!can_send_app_messages(state_)) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+        if (memory_budget_ && !memory_budget_->admit()) [[unlikely]] {
+            ++stats_.budget_rejects;
+            return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+        }
+        if (hibernated_) [[unlikely]] wake();
+        ForwardHeader header{
+            .sender_comp_id = config_.sender_comp_id,
+            .target_comp_id = config_.target_comp_id,
+            .msg_seq_num = 0,
+            .sending_time = current_timestamp(),
+            .on_behalf_of_comp_id = fields.on_behalf_of_comp_id,
+            .deliver_to_comp_id = fields.deliver_to_comp_id,
+        };
+        const std::span<const char> raw = received.raw();
+        const size_t capacity = forward_capacity(raw.size(), header);
+
+        if (throttle_) {
+            const ThrottleAdmit admit = !urgent && holding_for_backpressure()
+                ? ThrottleAdmit::Hold : throttle_admit();
+            if (admit == ThrottleAdmit::Hold || admit == ThrottleAdmit::Queue) {
+                // Queued with a placeholder MsgSeqNum, as queue_throttled()
+                const size_t size = rewrite_forwarded(raw, header, forward_buffer(capacity));
+                if (size == 0) [[unlikely]] {
+                    return std::unexpected{SessionError{SessionErrorCode::MalformedMessage}};
+                }
+                auto queued = push_throttled(std::span<const char>{forward_buffer_.data(), size});
+                if (!queued) return queued;
+                ++stats_.messages_forwarded;
+                if (admit == ThrottleAdmit::Hold) {
+                    ++stats_.backpressure_held;
+                    release_throttled(util::RdtscClock::now_ns());
+                }
+                return queued;
+            }
+            if (admit == ThrottleAdmit::Reject) {
+                ++stats_.throttle_rejects;
+                return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+            }
+        }
+
+        const bool coalesce = config_.coalesce_sends && (!urgent || pending_sends() != 0);
+
+        // Straight into the transport's buffer when it has one and it fits
+        std::span<char> out{};
+        if constexpr (HasSendBuffer<Handler>) {
+            if (!coalesce) {
+                if (auto dest = handler_.acquire_send_buffer(); dest.size() >= capacity) out = dest;
+            }
+        }
+        if (out.empty()) out = forward_buffer(capacity);
+
+        header.msg_seq_num = sequences_.current_outbound();
+        const size_t size = rewrite_forwarded(raw, header, out);
+        if (size == 0) [[unlikely]] {
+            return std::unexpected{SessionError{SessionErrorCode::MalformedMessage}};
+        }
+        (void)sequences_.next_outbound();
+        ++stats_.messages_forwarded;
+
+        const std::span<const char> msg{out.data(), size};
+        const bool sent = coalesce ? queue_message(msg, urgent) : send_message(msg);
+        if (replicator_ && !coalesce) (void)replicator_->flush();
+        if (!sent) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        return {};
+    }
+
+    /// Sequence and send messages serialized ahead of time (see kill_switch.hpp)
+    /// Each is a builder's output with MsgSeqNum 0, like a throttled
+    /// message: it is copied into the outbound batch with MsgSeqNum and
+    /// SendingTime restamped, and TransactTime set to the same time when
+    /// it has that width. All of them go to the handler together,
+    /// through on_send_batch() (one writev / io_uring submission per
+    /// batch arena) when it has one, after any coalesced messages.
+    /// Stops at the first message it cannot take now (no throttle token in
+    /// Reject mode, throttle queue full, the handler failed a flush): that
+    /// one and the rest are left to the caller. One that can never be sent
+    /// (not a builder's message, larger than the batch arena) is skipped.
+    /// @param throttled Take a throttle token per message, queueing or
+    ///        refusing it as send_app_message() would; otherwise (a kill
+    ///        switch) they go ahead of throttled messages. Throttled
+    ///        NewOrderSingles are taken to have passed the handler's
+    ///        pre_trade_check() (SubmissionGateway::drain()), so one queued
+    ///        and dropped on disconnect is given to pre_trade_release().
+    /// @return Messages taken from the front, and of those accepted:
+    ///         sequenced and stored for resend, or queued by the throttle
+    PrebuiltSendResult send_prebuilt(std::span<const std::span<const char>> messages,
+                                     bool throttled = false) noexcept {
+        PrebuiltSendResult result;
+        if (!can_send_app_messages(state_) || messages.empty()) return result;
+        if (hibernated_) [[unlikely]] wake();
+        if (!outbound_batch_) {
+            outbound_batch_.emplace(config_.coalesce_buffer_size, ResendBatch::DEFAULT_MAX_MESSAGES);
+        }
+
+        const std::string_view now = current_timestamp();
+        for (std::span<const char> prebuilt : messages) {
+            if (throttled && throttle_) {
+                const ThrottleAdmit admit = holding_for_backpressure()
+                    ? ThrottleAdmit::Hold : throttle_admit();
+                if (admit == ThrottleAdmit::Reject) {
+                    ++stats_.throttle_rejects;
+                    break;
+                }
+                if (admit != ThrottleAdmit::Now) {
+                    const bool booked = HasPreTradeRisk<Handler> && stored_msg_type(prebuilt) == "D";
+                    if (!push_throttled(prebuilt, booked)) break;
+                    if (admit == ThrottleAdmit::Hold) ++stats_.backpressure_held;
+                    ++result.taken;
+                    ++result.accepted;
+                    continue;
+                }
+            }
+            const size_t capacity = restamp_capacity(prebuilt.size(), now.size());
+            std::span<char> out = outbound_batch_->reserve(capacity);
+            if (out.empty()) {
+                if (!flush_sends()) break;
+                out = outbound_batch_->reserve(capacity);
+            }
+            ++result.taken;
+            if (out.empty()) [[unlikely]] continue;  // Larger than the whole arena
+            const size_t size = restamp_queued(prebuilt, sequences_.current_outbound(), now, out);
+            if (size == 0) [[unlikely]] continue;  // Not a builder's message
+            (void)restamp_transact_time(out.first(size), now);
+            (void)sequences_.next_outbound();
+            persist_outbound(out.first(size));
+            outbound_batch_->commit(size);
+            ++result.accepted;
+        }
+
+        if (control_block_) control_block_->set_next_sender_seq(sequences_.current_outbound());
+        (void)flush_sends();
+        if (replicator_) (void)replicator_->flush();
+        return result;
+    }
+
+    /// Send every queued application message in one batch
+    /// Call at the end of each event-loop iteration when coalescing; the
+    /// handler's on_send_batch() (one writev / ScatterGatherSend) is used
+    /// when it has one, else on_send() per message.
+    /// @return false if the handler failed to send the batch
+    bool flush_sends() noexcept {
+        if (!outbound_batch_ || outbound_batch_->empty()) return true;
+        const size_t queued = outbound_batch_->size();
+        const uint64_t write_tsc = latency_.stamp();
+        // The batch is traced under its last traced message
+        const OutboundTrace traced = std::exchange(batch_trace_, OutboundTrace{});
+        if (traced.id) flight_recorder_->trace(TracePoint::Submit, traced.id, trace_session_id_, traced.seq);
+        const size_t sent = submit_batch(*outbound_batch_);
+        if (traced.id) flight_recorder_->trace(TracePoint::SendComplete, traced.id, trace_session_id_, traced.seq);
+        latency_.record(LatencyStage::SendToWire, write_tsc, latency_.stamp());
+        ++stats_.send_batches;
+        return sent == queued;
+    }
+
+    /// Application messages queued for the next flush_sends()
+    [[nodiscard]] size_t pending_sends() const noexcept {
+        return outbound_batch_ ? outbound_batch_->size() : 0;
+    }
+
+    /// Application messages waiting for a throttle token
+    [[nodiscard]] size_t throttled_sends() const noexcept {
+        return throttle_ ? throttle_->size() : 0;
+    }
+
+    /// Throttle tokens available now (UINT64_MAX when unthrottled)
+    [[nodiscard]] uint64_t throttle_tokens() const noexcept {
+        return throttle_ ? throttle_->available(util::RdtscClock::now_ns()) : UINT64_MAX;
+    }
+
+    /// Report the transport's send queue state (see send_backpressure.hpp)
+    /// Handlers with send_backpressure() are polled after each send and
+    /// tick; other event loops call this when their transport changes.
+    /// Clearing releases messages held by hold_on_backpressure.
+    void set_send_backpressure(BackpressureState state) noexcept {
+        if (state == backpressure_) return;
+        backpressure_ = state;
+        stats_.backpressured = state == BackpressureState::Draining;
+        if (stats_.backpressured) ++stats_.backpressure_episodes;
+        if constexpr (HasOnBackpressure<Handler>) handler_.on_backpressure(state);
+        if (!stats_.backpressured && throttle_ && !throttle_->empty()) {
+            release_throttled(util::RdtscClock::now_ns());
+        }
+    }
+
+    [[nodiscard]] BackpressureState send_backpressure() const noexcept { return backpressure_; }
+
     // ========================================================================
     // Accessors
     // ========================================================================
@@ -309,13 +1134,27 @@ public:
     [[nodiscard]] SessionState state() const noexcept { return state_; }
     [[nodiscard]] const SessionConfig& config() const noexcept { return config_; }
     [[nodiscard]] const SessionStats& stats() const noexcept { return stats_; }
+
+    /// Hot-path latency histograms (empty unless NFX_HAS_LATENCY_HISTOGRAMS)
+    /// snapshot() may be called from any thread.
+    [[nodiscard]] const LatencyRecorder<>& latency() const noexcept { return latency_; }
     [[nodiscard]] const SequenceManager& sequences() const noexcept { return sequences_; }
 
     [[nodiscard]] SessionId session_id() const noexcept {
         return SessionId{config_.sender_comp_id, config_.target_comp_id, config_.begin_string};
     }
 
+    /// DefaultApplVerID (1137) of the counterparty's Logon; '\0' before
+    /// logon, when absent, or when the session is not FIXT
+    [[nodiscard]] char counterparty_appl_ver_id() const noexcept { return counterparty_appl_ver_id_; }
+
 private:
+    /// Trace id and MsgSeqNum of an outbound message (id 0 = untraced)
+    struct OutboundTrace {
+        uint64_t id{0};
+        uint32_t seq{0};
+    };
+
     // ========================================================================
     // State Machine
     // ========================================================================
@@ -326,43 +1165,307 @@ private:
 
         if (next != prev) {
             state_ = next;
-            if (callbacks_.on_state_change) {
-                callbacks_.on_state_change(prev, next);
-            }
+            if (timer_wheel_) update_timers(prev, next);
+            handler_.on_state_change(prev, next);
         }
     }
 
     // ========================================================================
-    // Admin Message Handling
+    // Timer Wheel Deadlines
     // ========================================================================
 
-    void handle_admin_message(const ParsedMessage& msg) noexcept {
-        switch (msg.msg_type()) {
-            case msg_type::Logon:
-                handle_logon(msg);
-                break;
-            case msg_type::Logout:
-                handle_logout(msg);
-                break;
-            case msg_type::Heartbeat:
-                handle_heartbeat(msg);
-                break;
-            case msg_type::TestRequest:
-                handle_test_request(msg);
-                break;
-            case msg_type::ResendRequest:
-                handle_resend_request(msg);
-                break;
-            case msg_type::SequenceReset:
-                handle_sequence_reset(msg);
-                break;
-            case msg_type::Reject:
-                handle_reject(msg);
-                break;
+    void update_timers(SessionState prev, SessionState next) noexcept {
+        if (prev == SessionState::LogonSent) timer_wheel_->cancel(logon_timer_);
+        if (prev == SessionState::Active) {
+            timer_wheel_->cancel(send_timer_);
+            timer_wheel_->cancel(recv_timer_);
+            timer_wheel_->cancel(throttle_timer_);
+        }
+        if (prev == SessionState::Active) timer_wheel_->cancel(idle_timer_);
+        if (next == SessionState::LogonSent) arm_logon_timer();
+        if (next == SessionState::Active) {
+            arm_heartbeat_timers();
+            arm_idle_timer();
+        }
+    }
+
+    void arm_logon_timer() noexcept {
+        if (config_.logon_timeout <= 0) return;
+        timer_wheel_->schedule_after(logon_timer_, std::chrono::seconds{config_.logon_timeout});
+    }
+
+    /// Heartbeat after one idle interval out, test request after 1.5 in
+    void arm_heartbeat_timers() noexcept {
+        const int interval = heartbeat_timer_.interval();
+        if (interval <= 0) return;
+        heartbeat_timer_.test_request_answered();
+        timer_wheel_->schedule_after(send_timer_, std::chrono::seconds{interval});
+        timer_wheel_->schedule_after(recv_timer_, std::chrono::seconds{interval + interval / 2});
+    }
+
+    void cancel_timers() noexcept {
+        if (!timer_wheel_) return;
+        timer_wheel_->cancel(send_timer_);
+        timer_wheel_->cancel(recv_timer_);
+        timer_wheel_->cancel(logon_timer_);
+        timer_wheel_->cancel(throttle_timer_);
+        timer_wheel_->cancel(idle_timer_);
+    }
+
+    /// Idle check every hibernate_after_ms (a session hibernates after
+    /// one to two periods without application messages)
+    void arm_idle_timer() noexcept {
+        if (config_.hibernate_after_ms == 0 || hibernated_) return;
+        idle_activity_ = app_activity();
+        idle_since_ns_ = util::RdtscClock::now_ns();
+        timer_wheel_->schedule_after(idle_timer_,
+                                     std::chrono::milliseconds{config_.hibernate_after_ms});
+    }
+
+    static void on_idle_deadline(void* context) noexcept {
+        auto& session = *static_cast<SessionManager*>(context);
+        if (session.hibernated_ || session.state_ != SessionState::Active) return;
+        session.check_idle(util::RdtscClock::now_ns());
+        if (!session.hibernated_) {
+            session.timer_wheel_->schedule_after(
+                session.idle_timer_, std::chrono::milliseconds{session.config_.hibernate_after_ms});
+        }
+    }
+
+    /// Hibernate once no application message has passed for hibernate_after_ms
+    void check_idle(uint64_t now_ns) noexcept {
+        const uint64_t activity = app_activity();
+        if (activity != idle_activity_) {
+            idle_activity_ = activity;
+            idle_since_ns_ = now_ns;
+            return;
+        }
+        if (now_ns - idle_since_ns_ >= uint64_t{config_.hibernate_after_ms} * 1'000'000) {
+            (void)hibernate();
+        }
+    }
+
+    /// Messages other than our Heartbeats and TestRequests, either way
+    [[nodiscard]] uint64_t app_activity() const noexcept {
+        return stats_.messages_received - stats_.heartbeats_received +
+               stats_.messages_sent - stats_.heartbeats_sent - stats_.test_requests_sent;
+    }
+
+    /// Inbound types a hibernated session handles without waking
+    [[nodiscard]] static constexpr bool answered_hibernated(char type) noexcept {
+        return type == msg_type::Heartbeat || type == msg_type::TestRequest;
+    }
+
+    void emplace_throttle() noexcept {
+        if (config_.throttle_rate == 0) return;
+        throttle_.emplace(OutboundThrottle::Config{
+            .rate_per_second = config_.throttle_rate,
+            .burst = config_.throttle_burst,
+            .queue_capacity = config_.throttle_mode == ThrottleMode::Queue
+                ? config_.throttle_queue_size : 0u,
+            .slot_size = config_.throttle_slot_size,
+        });
+    }
+
+    /// Outbound traffic: push the heartbeat back
+    void note_sent() noexcept {
+        poll_backpressure();
+        if (!timer_wheel_) {
+            heartbeat_timer_.message_sent();
+        } else if (send_timer_.armed()) {
+            timer_wheel_->schedule_after(send_timer_,
+                                         std::chrono::seconds{heartbeat_timer_.interval()});
+        }
+    }
+
+    /// Inbound traffic: push the test request back
+    void note_received() noexcept {
+        if (!timer_wheel_) {
+            heartbeat_timer_.message_received();
+        } else if (recv_timer_.armed()) {
+            const int interval = heartbeat_timer_.interval();
+            heartbeat_timer_.test_request_answered();
+            timer_wheel_->schedule_after(recv_timer_,
+                                         std::chrono::seconds{interval + interval / 2});
+        }
+    }
+
+    static void on_send_deadline(void* context) noexcept {
+        auto& session = *static_cast<SessionManager*>(context);
+        session.send_heartbeat();
+        if (!session.send_timer_.armed() && session.state_ == SessionState::Active) {
+            // Send failed: try again next interval
+            session.timer_wheel_->schedule_after(
+                session.send_timer_, std::chrono::seconds{session.heartbeat_timer_.interval()});
+        }
+    }
+
+    static void on_recv_deadline(void* context) noexcept {
+        auto& session = *static_cast<SessionManager*>(context);
+        if (session.heartbeat_timer_.test_request_pending()) {
+            session.transition(SessionEvent::HeartbeatTimeout);
+        } else {
+            session.send_test_request();
+        }
+    }
+
+    static void on_throttle_deadline(void* context) noexcept {
+        auto& session = *static_cast<SessionManager*>(context);
+        session.release_throttled(util::RdtscClock::now_ns());
+    }
+
+    static void on_logon_deadline(void* context) noexcept {
+        auto& session = *static_cast<SessionManager*>(context);
+        if (session.state_ != SessionState::LogonSent) return;
+        session.handler_.on_error(SessionError{SessionErrorCode::LogonTimeout});
+        session.transition(SessionEvent::LogonRejected);
+    }
+
+    // ========================================================================
+    // Compile-time MsgType Dispatch
+    // ========================================================================
+
+    using Route = void (*)(SessionManager&, const ParsedMessage&) noexcept;
+
+    /// Two-character types: first char in [FIRST, LAST], second in 'A'-'Z'
+    static constexpr char MULTI_CHAR_FIRST = 'A';
+    static constexpr char MULTI_CHAR_LAST = 'E';
+    static constexpr size_t MULTI_CHAR_SECOND = 26;
+
+    /// Route for a single-character MsgType
+    template <char C>
+    static void route(SessionManager& session, const ParsedMessage& msg) noexcept {
+        if constexpr (C == msg_type::Logon) session.handle_logon(msg);
+        else if constexpr (C == msg_type::Logout) session.handle_logout(msg);
+        else if constexpr (C == msg_type::Heartbeat) session.handle_heartbeat(msg);
+        else if constexpr (C == msg_type::TestRequest) session.handle_test_request(msg);
+        else if constexpr (C == msg_type::ResendRequest) session.handle_resend_request(msg);
+        else if constexpr (C == msg_type::SequenceReset) session.handle_sequence_reset(msg);
+        else if constexpr (C == msg_type::Reject) session.handle_reject(msg);
+        else if constexpr (HasOnMsgType<Handler, C>) session.handler_.on_message(MsgTypeTag<C>{}, msg);
+        else session.handler_.on_app_message(msg);
+    }
+
+    /// Route for a two-character MsgType (application messages only)
+    template <char C1, char C2>
+    static void route(SessionManager& session, const ParsedMessage& msg) noexcept {
+        if constexpr (HasOnMsgType<Handler, C1, C2>) session.handler_.on_message(MsgTypeTag<C1, C2>{}, msg);
+        else session.handler_.on_app_message(msg);
+    }
+
+    static consteval std::array<Route, 256> make_single_routes() {
+        return []<size_t... I>(std::index_sequence<I...>) {
+            return std::array<Route, 256>{&route<static_cast<char>(I)>...};
+        }(std::make_index_sequence<256>{});
+    }
+
+    static consteval auto make_multi_routes() {
+        constexpr size_t FIRSTS = MULTI_CHAR_LAST - MULTI_CHAR_FIRST + 1;
+        return []<size_t... I>(std::index_sequence<I...>) {
+            return std::array<Route, FIRSTS * MULTI_CHAR_SECOND>{
+                &route<static_cast<char>(MULTI_CHAR_FIRST + I / MULTI_CHAR_SECOND),
+                       static_cast<char>('A' + I % MULTI_CHAR_SECOND)>...};
+        }(std::make_index_sequence<FIRSTS * MULTI_CHAR_SECOND>{});
+    }
+
+    /// MsgType (35) of a message the assembler just built
+    [[nodiscard]] static std::string_view built_msg_type(std::span<const char> msg) noexcept {
+        const std::string_view text{msg.data(), msg.size()};
+        const size_t begin = text.find("\x01" "35=");
+        if (begin == std::string_view::npos) return {};
+        const size_t end = text.find('\x01', begin + 4);
+        return text.substr(begin + 4, end == std::string_view::npos ? end : end - begin - 4);
+    }
+
+    /// Filtered fast path: an ignored MsgType arriving in sequence only
+    /// advances the inbound sequence. Gaps, duplicates and headers that
+    /// cannot be peeked return false and take the full parse.
+    NFX_HOT bool skip_ignored(std::span<const char> data) noexcept {
+        const HeaderPeek peek = peek_header(data);
+        if (!peek.ok() || !config_.msg_type_filter.ignores(peek.msg_type) ||
+            peek.msg_seq_num != sequences_.expected_inbound()) {
+            return false;
+        }
+        (void)sequences_.validate_inbound(peek.msg_seq_num);
+        inbound_advanced();
+        ++stats_.messages_filtered;
+        if (audit_tap_) {
+            (void)audit_tap_->capture(store::AuditDirection::Inbound, peek.msg_seq_num,
+                                      data, util::RdtscClock::now_ns());
+        }
+        return true;
+    }
+
+    /// Batched delivery: stage an application message in the batch
+    /// Anything else delivers the pending batch first, so the handler
+    /// sees application messages before the session-level one after them.
+    /// @param bytes In: received message, out: its copy in the batch
+    /// @return Slot to parse into, nullptr to take the per-message path
+    ParsedMessage* stage_batched(std::span<const char>& bytes) noexcept {
+        const std::string_view type = peek_header(bytes).msg_type;
+        if (type.empty() || (type.size() == 1 && msg_type::is_admin(type[0]))) {
+            deliver_batch();
+            return nullptr;
+        }
+        if (hibernated_) [[unlikely]] wake();
+        ParsedMessage* slot = inbound_batch_->stage(bytes);
+        if (!slot) [[unlikely]] {
+            deliver_batch();
+            slot = inbound_batch_->stage(bytes);  // nullptr: larger than the batch arena
+        }
+        return slot;
+    }
+
+    /// Hand the batched application messages to the handler in one call
+    /// Re-entrant feeds from the callback take the per-message path.
+    void deliver_batch() noexcept {
+        if (!inbound_batch_ || inbound_batch_->empty()) return;
+        NFX_ZONE_SCOPED(dispatch);
+        {
+            DepthGuard depth_guard{++inbound_depth_};
+            handler_.on_app_messages(inbound_batch_->messages());
+        }
+        inbound_batch_->clear();
+    }
+
+    /// dispatch() with msg's trace active, so replies carry its id
+    NFX_NO_INLINE void dispatch_traced(const ParsedMessage& msg, uint64_t trace_id) noexcept {
+        flight_recorder_->trace(TracePoint::HandlerEntry, trace_id, trace_session_id_, msg.msg_seq_num());
+        {
+            FlightRecorder::Scope scope{trace_id};
+            dispatch(msg);
+        }
+        flight_recorder_->trace(TracePoint::HandlerExit, trace_id, trace_session_id_, msg.msg_seq_num());
+    }
+
+    /// Route one inbound message: one table load and one indirect call
+    NFX_HOT void dispatch(const ParsedMessage& msg) noexcept {
+        static constexpr std::array<Route, 256> SINGLE = make_single_routes();
+        static constexpr auto MULTI = make_multi_routes();
+
+        const std::string_view type = msg.get_string(tag::MsgType::value);
+        if (type.size() == 1) [[likely]] {
+            SINGLE[static_cast<unsigned char>(type[0])](*this, msg);
+            return;
+        }
+        if (type.size() == 2 &&
+            type[0] >= MULTI_CHAR_FIRST && type[0] <= MULTI_CHAR_LAST &&
+            type[1] >= 'A' && type[1] <= 'Z') {
+            MULTI[static_cast<size_t>(type[0] - MULTI_CHAR_FIRST) * MULTI_CHAR_SECOND +
+                  static_cast<size_t>(type[1] - 'A')](*this, msg);
+            return;
         }
+        handler_.on_app_message(msg);  // User-defined / longer MsgTypes
     }
 
+    // ========================================================================
+    // Admin Message Handling
+    // ========================================================================
+
     void handle_logon(const ParsedMessage& msg) noexcept {
+        if constexpr (Protocol::is_fixt) {
+            counterparty_appl_ver_id_ = msg.get_char(tag::DefaultApplVerID::value);
+        }
         if (state_ == SessionState::LogonSent) {
             // Response to our logon
             if (auto v = msg.get_int(108)) {  // HeartBtInt
@@ -370,16 +1473,15 @@ private:
             }
             transition(SessionEvent::LogonReceived);
             heartbeat_timer_.reset();
+            record_logon();
 
-            if (callbacks_.on_logon) {
-                callbacks_.on_logon();
-            }
+            handler_.on_logon();
         } else if (state_ == SessionState::SocketConnected) {
             // Incoming logon - we're the acceptor
             transition(SessionEvent::LogonReceived);
 
             // Send logon response
-            auto response = fix44::Logon::Builder{}
+            auto response = logon_builder()
                 .sender_comp_id(config_.sender_comp_id)
                 .target_comp_id(config_.target_comp_id)
                 .msg_seq_num(sequences_.next_outbound())
@@ -391,10 +1493,9 @@ private:
             send_message(response);
             transition(SessionEvent::LogonAcknowledged);
             heartbeat_timer_.reset();
+            record_logon();
 
-            if (callbacks_.on_logon) {
-                callbacks_.on_logon();
-            }
+            handler_.on_logon();
         }
     }
 
@@ -408,7 +1509,7 @@ private:
             // Incoming logout - send response
             transition(SessionEvent::LogoutReceived);
 
-            auto response = fix44::Logout::Builder{}
+            auto response = typename Admin::Logout::Builder{}
                 .sender_comp_id(config_.sender_comp_id)
                 .target_comp_id(config_.target_comp_id)
                 .msg_seq_num(sequences_.next_outbound())
@@ -419,22 +1520,22 @@ private:
             transition(SessionEvent::LogoutSent);
         }
 
-        if (callbacks_.on_logout) {
-            callbacks_.on_logout(text);
-        }
+        handler_.on_logout(text);
     }
 
     void handle_heartbeat(const ParsedMessage& msg) noexcept {
         ++stats_.heartbeats_received;
-        // TestReqID handling if present
-        // Nothing else to do - heartbeat timer already updated
+        // Heartbeat timer already updated; an echoed probe id is an RTT sample
+        if (rtt_probe_) {
+            rtt_probe_->on_heartbeat(msg.get_string(tag::TestReqID::value), util::detail::rdtscp());
+        }
     }
 
     void handle_test_request(const ParsedMessage& msg) noexcept {
         // Send heartbeat with TestReqID
         std::string_view test_req_id = msg.get_string(tag::TestReqID::value);
 
-        auto response = fix44::Heartbeat::Builder{}
+        auto response = typename Admin::Heartbeat::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -456,28 +1557,24 @@ private:
         uint32_t begin = static_cast<uint32_t>(*begin_seq);
         uint32_t end = static_cast<uint32_t>(*end_seq);
 
-        // Try to retrieve messages from store
+        // Replay stored application messages as zero-copy views, rewritten
+        // with PossDupFlag=Y / OrigSendingTime into the batch arena; each
+        // run of skipped seqnums collapses into one gap fill
         if (message_store_) {
-            auto messages = message_store_->retrieve_range(begin, end);
-
-            if (!messages.empty()) {
-                // Resend stored messages with PossDupFlag=Y
-                for (const auto& stored_msg : messages) {
-                    // Note: In production, we should modify the message to set
-                    // PossDupFlag=Y (tag 43) and update SendingTime (tag 52)
-                    // For now, resend as-is
-                    if (callbacks_.on_send) {
-                        callbacks_.on_send(stored_msg);
-                        ++stats_.messages_sent;
-                        stats_.bytes_sent += stored_msg.size();
-                    }
-                }
-                return;
-            }
+            const uint32_t last_sent = sequences_.current_outbound() - 1;
+            const uint32_t last = (end == 0 || end > last_sent) ? last_sent : end;
+            if (begin > last) return;
+
+            if (!resend_batch_) resend_batch_.emplace();
+            resend_gap_begin_ = begin;
+            (void)message_store_->visit_range(begin, last, &resend_visitor, this);
+            queue_gap_fill(last + 1);
+            flush_resend_batch();
+            return;
         }
 
-        // Fallback: No store or messages not found - send SequenceReset (gap fill)
-        auto response = fix44::SequenceReset::Builder{}
+        // Fallback: No store - send SequenceReset (gap fill)
+        auto response = typename Admin::SequenceReset::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(begin)
@@ -486,7 +1583,92 @@ private:
             .gap_fill_flag(true)
             .build(assembler_);
 
-        send_message(response);
+        send_message(response, false);  // Reuses seq begin: not stored
+    }
+
+    static bool resend_visitor(void* ctx, uint32_t seq, std::span<const char> stored) noexcept {
+        auto& session = *static_cast<SessionManager*>(ctx);
+        if (is_gap_fill_candidate(stored)) return true;  // Extends the current gap
+        if constexpr (HasResendFilter<Handler>) {
+            if (!session.handler_.should_resend(stored)) return true;
+        }
+
+        // Never resent unchanged: a message that cannot be rewritten with
+        // 43=Y, or whose rewrite cannot fit the arena, is gap-filled
+        const size_t need = resend_rewrite_capacity(
+            stored.size(), session.current_timestamp().size());
+        if (!can_rewrite_for_resend(stored) || need > session.resend_batch_->arena_size()) {
+            return true;
+        }
+
+        session.queue_gap_fill(seq);
+        session.resend_gap_begin_ = seq + 1;
+
+        const std::string_view now = session.current_timestamp();
+        if (!session.resend_batch_->add_resend(stored, now)) {
+            session.flush_resend_batch();
+            if (!session.resend_batch_->add_resend(stored, now)) [[unlikely]] {
+                session.resend_gap_begin_ = seq;  // Left to the next gap fill
+            }
+        }
+        return true;
+    }
+
+    /// Close the pending gap [resend_gap_begin_, new_seq_no) with one
+    /// SequenceReset-GapFill carrying the first skipped seqnum
+    void queue_gap_fill(uint32_t new_seq_no) noexcept {
+        if (resend_gap_begin_ >= new_seq_no) return;
+
+        const std::string_view now = current_timestamp();
+        auto gap_fill = typename Admin::SequenceReset::Builder{}
+            .sender_comp_id(config_.sender_comp_id)
+            .target_comp_id(config_.target_comp_id)
+            .msg_seq_num(resend_gap_begin_)
+            .sending_time(now)
+            .poss_dup(now)
+            .new_seq_no(new_seq_no)
+            .gap_fill_flag(true)
+            .build(assembler_);
+
+        if (!resend_batch_->add(gap_fill)) {
+            flush_resend_batch();
+            (void)resend_batch_->add(gap_fill);  // Empty arena always fits one
+        }
+        ++stats_.gap_fills_sent;
+        resend_gap_begin_ = new_seq_no;
+    }
+
+    void flush_resend_batch() noexcept {
+        if (resend_batch_->empty()) return;
+        flush_sends();  // Queued messages go first
+        stats_.messages_resent += submit_batch(*resend_batch_);
+    }
+
+    /// Hand a batch to the transport and clear it
+    /// @return Messages sent
+    size_t submit_batch(ResendBatch& batch) noexcept {
+        NFX_ZONE_SCOPED(submit);
+        size_t sent = 0;
+        size_t bytes = 0;
+        if constexpr (HasOnSendBatch<Handler>) {
+            if (handler_.on_send_batch(batch.messages())) {
+                sent = batch.size();
+                bytes = batch.bytes();
+            }
+        } else {
+            for (auto stored : batch.messages()) {
+                if (handler_.on_send(stored)) {
+                    ++sent;
+                    bytes += stored.size();
+                }
+            }
+        }
+
+        if (sent != 0) note_sent();
+        stats_.messages_sent += sent;
+        stats_.bytes_sent += bytes;
+        batch.clear();
+        return sent;
     }
 
     void handle_sequence_reset(const ParsedMessage& msg) noexcept {
@@ -501,26 +1683,17 @@ private:
             } else {
                 // Hard reset
                 sequences_.set_inbound(static_cast<uint32_t>(*new_seq));
+                inbound_gaps_.clear();
+                inbound_high_ = 0;
             }
+            inbound_advanced();
         }
     }
 
     void handle_reject(const ParsedMessage& msg) noexcept {
         // Session-level reject - log and continue
         [[maybe_unused]] std::string_view text = msg.get_string(tag::Text::value);
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{SessionErrorCode::InvalidState});
-        }
-    }
-
-    // ========================================================================
-    // Application Message Handling
-    // ========================================================================
-
-    void handle_app_message(const ParsedMessage& msg) noexcept {
-        if (callbacks_.on_app_message) {
-            callbacks_.on_app_message(msg);
-        }
+        handler_.on_error(SessionError{SessionErrorCode::InvalidState});
     }
 
     // ========================================================================
@@ -528,15 +1701,42 @@ private:
     // ========================================================================
 
     void handle_parse_error(const ParseError& error) noexcept {
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{SessionErrorCode::InvalidState});
+        if constexpr (Protocol::is_fixed) {
+            // Another FIX version on a fixed-version session: log out
+            if (error.code == ParseErrorCode::InvalidBeginString) [[unlikely]] {
+                handler_.on_error(SessionError{SessionErrorCode::MalformedMessage});
+                if (state_ == SessionState::Active) (void)initiate_logout("Incorrect BeginString");
+                return;
+            }
         }
+        handler_.on_error(SessionError{SessionErrorCode::InvalidState});
     }
 
+    /// Expected stays at the first gap; seqnums received past it are
+    /// filled out of inbound_gaps_, and only newly missing ranges are
+    /// requested (all outstanding ones on the first gap of a connection).
     void handle_sequence_gap(uint32_t received) noexcept {
-        auto [begin, end] = sequences_.gap_range(received);
+        if (received <= inbound_high_) {
+            inbound_gaps_.fill(received);  // A resent or late seqnum
+        } else {
+            const uint32_t begin = std::max(sequences_.expected_inbound(), inbound_high_ + 1);
+            if (begin < received) (void)inbound_gaps_.add_gap(begin, received - 1);
+            inbound_high_ = received;
+
+            if (!gaps_requested_) {
+                gaps_requested_ = true;
+                for (const auto& gap : inbound_gaps_.ranges()) {
+                    send_resend_request(gap.begin, gap.end);
+                }
+            } else if (begin < received) {
+                send_resend_request(begin, received - 1);
+            }
+        }
+        if (control_block_) control_block_->save_gaps(inbound_gaps_);
+    }
 
-        auto request = fix44::ResendRequest::Builder{}
+    void send_resend_request(uint32_t begin, uint32_t end) noexcept {
+        auto request = typename Admin::ResendRequest::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -550,40 +1750,103 @@ private:
 
     void handle_sequence_error(uint32_t received) noexcept {
         // Sequence too low - reject or logout
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{
-                SessionErrorCode::SequenceGap,
-                sequences_.expected_inbound(),
-                received
-            });
-        }
+        handler_.on_error(SessionError{
+            SessionErrorCode::SequenceGap,
+            sequences_.expected_inbound(),
+            received
+        });
     }
 
     // ========================================================================
     // Message Sending
     // ========================================================================
 
-    bool send_message(std::span<const char> msg) noexcept {
-        if (!callbacks_.on_send) return false;
+    /// @param persist Store for resend under the seq just assigned by
+    ///        next_outbound() (false for messages that reuse a seq)
+    NFX_HOT bool send_message(std::span<const char> msg, bool persist = true) noexcept {
+        NFX_NO_ALLOC_REGION("SessionManager::send_message");
+        // Anything queued was sequenced first: keep the wire in seq order
+        if (pending_sends() != 0) [[unlikely]] {
+            if (send_trace_.id) batch_trace_ = send_trace_;
+            return queue_message(msg, true, persist);
+        }
 
         // Store message for potential resend (before actual send)
-        if (message_store_) {
-            // Get sequence number from message for storage key
-            uint32_t seq_num = sequences_.current_outbound();
-            message_store_->store(seq_num, msg);
+        if (persist) persist_outbound(msg);
+        if (control_block_) control_block_->set_next_sender_seq(sequences_.current_outbound());
+
+        const uint64_t write_tsc = latency_.stamp();
+        if (send_trace_.id) flight_recorder_->trace(TracePoint::Submit, send_trace_.id, trace_session_id_, send_trace_.seq);
+        NFX_ZONE_BEGIN(submit);
+        bool sent = handler_.on_send(msg);
+        NFX_ZONE_END(submit);
+        if (send_trace_.id && sent) {
+            flight_recorder_->trace(TracePoint::SendComplete, send_trace_.id, trace_session_id_, send_trace_.seq);
         }
-
-        bool sent = callbacks_.on_send(msg);
+        latency_.record(LatencyStage::SendToWire, write_tsc, latency_.stamp());
         if (sent) {
-            heartbeat_timer_.message_sent();
+            note_sent();
             ++stats_.messages_sent;
             stats_.bytes_sent += msg.size();
         }
         return sent;
     }
 
+    /// Store msg for resend and publish it to the audit tap
+    void persist_outbound(std::span<const char> msg) noexcept {
+        const uint32_t seq_num = sequences_.current_outbound() - 1;
+        NFX_ZONE_BEGIN(store);
+        // Hibernated: only Heartbeats / TestRequests go out, gap-filled on resend
+        const bool stored = message_store_ && !hibernated_ && message_store_->store(seq_num, msg);
+        NFX_ZONE_END(store);
+        if (replicator_) replicator_->on_append(seq_num, msg, sequences_.current_outbound());
+        if (binary_logger_) (void)binary_logger_->log(util::LogDirection::Outbound, log_session_id_, msg);
+        if (!audit_tap_) return;
+
+        const uint64_t now = util::RdtscClock::now_ns();
+        const std::span<const char> record = stored ? message_store_->last_stored()
+                                                    : std::span<const char>{};
+        if (!record.empty()) {
+            (void)audit_tap_->publish(store::AuditDirection::Outbound, seq_num, record, now);
+        } else {
+            (void)audit_tap_->capture(store::AuditDirection::Outbound, seq_num, msg, now);
+        }
+    }
+
+    /// Store msg and copy it into the outbound batch
+    /// @param flush Send the batch now (urgent or session-level message)
+    bool queue_message(std::span<const char> msg, bool flush, bool persist = true) noexcept {
+        if (persist) persist_outbound(msg);
+        if (control_block_) control_block_->set_next_sender_seq(sequences_.current_outbound());
+
+        if (!outbound_batch_) {
+            outbound_batch_.emplace(config_.coalesce_buffer_size, ResendBatch::DEFAULT_MAX_MESSAGES);
+        }
+        if (outbound_batch_->empty() && config_.coalesce_window_ns != 0) {
+            batch_opened_ = std::chrono::steady_clock::now();
+        }
+        if (!outbound_batch_->add(msg)) {
+            if (!flush_sends()) return false;
+            if (!outbound_batch_->add(msg)) {
+                // Larger than the whole arena: send on its own
+                if (!handler_.on_send(msg)) return false;
+                note_sent();
+                ++stats_.messages_sent;
+                stats_.bytes_sent += msg.size();
+                return true;
+            }
+        }
+
+        if (flush || (config_.coalesce_window_ns != 0 &&
+                      std::chrono::steady_clock::now() - batch_opened_ >=
+                          std::chrono::nanoseconds(config_.coalesce_window_ns))) {
+            return flush_sends();
+        }
+        return true;
+    }
+
     void send_heartbeat(std::string_view test_req_id = "") noexcept {
-        auto msg = fix44::Heartbeat::Builder{}
+        auto msg = typename Admin::Heartbeat::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -596,47 +1859,328 @@ private:
     }
 
     void send_test_request() noexcept {
-        // Generate test request ID
+        // Generate test request ID (rdtsc-stamped when probing RTT)
         char id_buf[32];
-        auto len = std::snprintf(id_buf, sizeof(id_buf), "TEST%lu",
-            static_cast<unsigned long>(stats_.test_requests_sent + 1));
+        std::string_view id;
+        if (rtt_probe_) {
+            id = rtt_probe_->next_id(util::detail::rdtscp());
+        } else {
+            auto len = std::snprintf(id_buf, sizeof(id_buf), "TEST%lu",
+                static_cast<unsigned long>(stats_.test_requests_sent + 1));
+            id = std::string_view{id_buf, static_cast<size_t>(len)};
+        }
+
+        send_test_request_message(id);
+        heartbeat_timer_.test_request_sent();
+        if (timer_wheel_) {
+            // Timeout at twice the interval since the last inbound message
+            const int interval = heartbeat_timer_.interval();
+            timer_wheel_->schedule_after(recv_timer_, std::chrono::seconds{interval - interval / 2});
+        }
+        ++stats_.test_requests_sent;
+    }
+
+    /// Periodic RTT probe: a TestRequest outside the liveness check
+    void send_rtt_probe() noexcept {
+        send_test_request_message(rtt_probe_->next_id(util::detail::rdtscp()));
+        ++stats_.test_requests_sent;
+    }
 
-        auto msg = fix44::TestRequest::Builder{}
+    /// Set the budget's Store and Buffers usage from memory_regions()
+    void charge_memory_budget() noexcept {
+        std::array<util::MemoryRegion, 16> regions{};
+        size_t total = 0;
+        for (size_t i = 0, n = memory_regions(regions); i < n; ++i) total += regions[i].size;
+        size_t store = 0;
+        if (message_store_) {
+            for (size_t i = 0, n = message_store_->memory_regions(regions); i < n; ++i) {
+                store += regions[i].size;
+            }
+        }
+        memory_budget_->set_usage(memory::BudgetCategory::Store, store);
+        memory_budget_->set_usage(memory::BudgetCategory::Buffers, total - std::min(total, store));
+    }
+
+    void send_test_request_message(std::string_view test_req_id) noexcept {
+        auto msg = typename Admin::TestRequest::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
             .sending_time(current_timestamp())
-            .test_req_id(std::string_view{id_buf, static_cast<size_t>(len)})
+            .test_req_id(test_req_id)
             .build(assembler_);
 
         send_message(msg);
-        heartbeat_timer_.test_request_sent();
-        ++stats_.test_requests_sent;
+    }
+
+    // ========================================================================
+    // Outbound Throttle
+    // ========================================================================
+
+    enum class ThrottleAdmit : uint8_t { Now, Queue, Hold, Reject };
+
+    /// Non-urgent messages wait in the queue (hold_on_backpressure, Draining)
+    [[nodiscard]] bool holding_for_backpressure() const noexcept {
+        return config_.hold_on_backpressure && config_.throttle_mode == ThrottleMode::Queue &&
+               backpressure_ == BackpressureState::Draining;
+    }
+
+    /// Queued messages that may go now: held ones wait out the drain,
+    /// cancels do not
+    [[nodiscard]] bool throttle_releasable() const noexcept {
+        return !throttle_->empty() && (!holding_for_backpressure() || throttle_->priority_pending());
+    }
+
+    void poll_backpressure() noexcept {
+        if constexpr (HasSendBackpressure<Handler>) set_send_backpressure(handler_.send_backpressure());
+    }
+
+    /// Take a token for the next application message, per throttle_mode
+    ThrottleAdmit throttle_admit() noexcept {
+        uint64_t now = util::RdtscClock::now_ns();
+        release_throttled(now);  // Anything already waiting goes first
+        if (!throttle_releasable() && throttle_->try_acquire(now)) {
+            stats_.throttled = false;
+            return ThrottleAdmit::Now;
+        }
+
+        stats_.throttled = true;
+        switch (config_.throttle_mode) {
+            case ThrottleMode::Queue:
+                return ThrottleAdmit::Queue;
+            case ThrottleMode::Delay: {
+                const uint64_t due = throttle_->next_available(now);
+                if (due - now > uint64_t{config_.throttle_max_delay_us} * 1000) break;
+                memory::BusySpinWait::wait_until([&] {
+                    return throttle_->try_acquire(util::RdtscClock::now_ns());
+                });
+                ++stats_.throttle_delayed;
+                return ThrottleAdmit::Now;
+            }
+            case ThrottleMode::Reject:
+                break;
+        }
+        return ThrottleAdmit::Reject;
+    }
+
+    /// Serialize with a placeholder MsgSeqNum; sequenced when released
+    template <typename MsgBuilder>
+    SessionResult<void> queue_throttled(MsgBuilder& builder) noexcept {
+        auto msg = builder
+            .sender_comp_id(config_.sender_comp_id)
+            .target_comp_id(config_.target_comp_id)
+            .msg_seq_num(0)
+            .sending_time(current_timestamp())
+            .build(assembler_);
+        return push_throttled(msg, HasPreTradeRisk<Handler> && HasOrderFields<MsgBuilder>);
+    }
+
+    /// Queue a message serialized with a placeholder MsgSeqNum
+    /// @param booked An order pre_trade_check() accepted (released if dropped)
+    SessionResult<void> push_throttled(std::span<const char> msg, bool booked = false) noexcept {
+        if (!throttle_->push(msg, is_cancel_message(msg), booked)) {
+            ++stats_.throttle_rejects;
+            return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+        }
+        ++stats_.throttle_queued;
+        stats_.throttle_queue_depth = static_cast<uint32_t>(throttle_->size());
+        stats_.throttle_queue_peak = std::max(stats_.throttle_queue_peak, stats_.throttle_queue_depth);
+        if (throttle_releasable()) arm_throttle_timer(util::RdtscClock::now_ns());
+        return {};
+    }
+
+    /// Give back an order pre_trade_check() accepted and the session refused
+    template <typename MsgBuilder>
+    void release_pre_trade(const MsgBuilder& builder) noexcept {
+        if constexpr (HasPreTradeRisk<Handler> && HasPreTradeRelease<Handler> && HasOrderFields<MsgBuilder>) {
+            handler_.pre_trade_release(builder.order_fields());
+        }
+    }
+
+    /// Give back the booked orders of a throttle queue about to be dropped
+    /// Their fields are read back from the queued bytes (disconnects only;
+    /// a placeholder MsgSeqNum 0 would not pass ParsedMessage::parse()).
+    void release_booked_throttled() noexcept {
+        for (; !throttle_->empty(); throttle_->pop()) {
+            if (!throttle_->front_booked()) continue;
+            OrderFields order{};
+            FieldIterator fields{throttle_->front()};
+            while (fields.has_next()) {
+                const FieldView field = fields.next();
+                switch (field.tag) {
+                    case tag::Symbol::value: order.symbol = field.as_string(); break;
+                    case tag::Side::value: order.side = static_cast<Side>(field.as_char()); break;
+                    case tag::OrderQty::value: order.order_qty = field.as_qty(); break;
+                    case tag::Price::value: order.price = field.as_price(); break;
+                    case tag::OrdType::value: order.ord_type = static_cast<OrdType>(field.as_char()); break;
+                    default: break;
+                }
+            }
+            handler_.pre_trade_release(order);
+        }
+    }
+
+    /// Sequence and send queued messages while tokens last (cancels first)
+    void release_throttled(uint64_t now_ns) noexcept {
+        if (throttle_->empty() || !can_send_app_messages(state_)) return;
+
+        while (throttle_releasable() && throttle_->try_acquire(now_ns)) {
+            const size_t size = restamp_queued(throttle_->front(), sequences_.current_outbound(),
+                                               current_timestamp(), throttle_->scratch());
+            throttle_->pop();
+            if (size == 0) [[unlikely]] continue;  // Not a builder's message: nothing to sequence
+            (void)sequences_.next_outbound();
+            send_message(std::span<const char>{throttle_->scratch().data(), size});
+        }
+
+        stats_.throttle_queue_depth = static_cast<uint32_t>(throttle_->size());
+        stats_.throttled = !throttle_->empty();
+        if (throttle_releasable()) arm_throttle_timer(now_ns);
+    }
+
+    /// Wake when the next token accrues (polled from on_timer_tick() without a wheel)
+    void arm_throttle_timer(uint64_t now_ns) noexcept {
+        if (!timer_wheel_ || throttle_timer_.armed()) return;
+        timer_wheel_->schedule_after(
+            throttle_timer_, std::chrono::nanoseconds{throttle_->next_available(now_ns) - now_ns});
+    }
+
+    // ========================================================================
+    // Control Block
+    // ========================================================================
+
+    /// Expected inbound moved forward: trim filled gaps, skip seqnums
+    /// already received past them, publish the result
+    void inbound_advanced() noexcept {
+        if (inbound_gaps_.has_gaps() || inbound_high_ >= sequences_.expected_inbound()) {
+            inbound_gaps_.fill_below(sequences_.expected_inbound());
+            sequences_.set_inbound(inbound_gaps_.has_gaps()
+                ? std::max(sequences_.expected_inbound(), inbound_gaps_.ranges().front().begin)
+                : std::max(sequences_.expected_inbound(), inbound_high_ + 1));
+            if (control_block_) control_block_->save_gaps(inbound_gaps_);
+        }
+        if (control_block_) control_block_->set_next_target_seq(sequences_.expected_inbound());
+        if (replicator_) {
+            replicator_->on_sequences(sequences_.current_outbound(), sequences_.expected_inbound());
+        }
+    }
+
+    void record_logon() noexcept {
+        if (!control_block_) return;
+        control_block_->set_last_logon_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
     }
 
     // ========================================================================
     // Utilities
     // ========================================================================
 
+    /// forward_message() output when the handler has no send buffer
+    /// (grown to the largest forwarded message, allocating on first use)
+    [[nodiscard]] std::span<char> forward_buffer(size_t capacity) noexcept {
+        if (forward_buffer_.size() < capacity) {
+            forward_buffer_.resize(std::max(capacity, MessageAssembler::MAX_MESSAGE_SIZE));
+        }
+        return forward_buffer_;
+    }
+
     [[nodiscard]] std::string_view current_timestamp() noexcept {
         // RDTSC-based timestamp: ~10ns hot path (no syscall)
         // Periodic calibration (~200ns) once per second to prevent drift
+        // Fraction digits per SessionConfig::timestamp_precision
         return timestamp_generator_.get();
     }
 
+    /// Record msg's ExecID / ClOrdID; true if it is a PossDup or
+    /// PossResend repeat of one already in the window
+    bool is_resent_duplicate(const ParsedMessage& msg) noexcept {
+        const std::string_view key = duplicate_key(msg);
+        if (key.empty()) return false;
+        return duplicates_->check_and_insert(key) && is_possible_duplicate(msg);
+    }
+
+    /// config with the BeginString Version fixes
+    [[nodiscard]] static SessionConfig with_begin_string(SessionConfig config) noexcept {
+        if constexpr (Protocol::is_fixed) config.begin_string = Protocol::begin_string;
+        return config;
+    }
+
+    /// Logon builder carrying the version's DefaultApplVerID (FIXT)
+    [[nodiscard]] static typename Admin::Logon::Builder logon_builder() noexcept {
+        typename Admin::Logon::Builder builder;
+        if constexpr (Protocol::is_fixt) builder.default_appl_ver_id(Protocol::default_appl_ver_id);
+        return builder;
+    }
+
+    /// Scoped inbound_depth_ increment (already applied by the caller)
+    struct DepthGuard {
+        uint32_t& depth;
+        ~DepthGuard() { --depth; }
+    };
+
     // ========================================================================
     // Member Variables
     // ========================================================================
 
     SessionConfig config_;
     SessionState state_;
-    SessionCallbacks callbacks_;
+    Handler handler_;
     HeartbeatTimer heartbeat_timer_;
     MessageAssembler assembler_;
     SequenceManager sequences_;
+    HeaderLayoutPredictor header_predictor_;  // Used when expect_fixed_header_layout
+    ParsedMessage inbound_msg_;               // Reused by on_data_received
+    uint32_t inbound_depth_{0};               // on_data_received nesting
+    char counterparty_appl_ver_id_{'\0'};      // Logon DefaultApplVerID (FIXT)
     SessionStats stats_;
+    [[no_unique_address]] LatencyRecorder<> latency_;
+    MetricsSlot<SessionStats>* session_metrics_{nullptr};
+    MetricsSlot<store::IMessageStore::Stats>* store_metrics_{nullptr};
     util::RdtscTimestamp timestamp_generator_;  // RDTSC-based: ~10ns vs ~50ns chrono
     store::IMessageStore* message_store_{nullptr};
+    store::SessionControlBlock* control_block_{nullptr};
+    store::AuditTap* audit_tap_{nullptr};
+    store::ReplicationPublisher* replicator_{nullptr};
+    util::BinaryLogger* binary_logger_{nullptr};
+    uint16_t log_session_id_{0};
+    FlightRecorder* flight_recorder_{nullptr};
+    uint16_t trace_session_id_{0};
+    OutboundTrace send_trace_;                 // Message send_app_message is sending
+    OutboundTrace batch_trace_;                // Last traced message in outbound_batch_
+    MsgTypePerfProfile* perf_profile_{nullptr};
+    RttProbe* rtt_probe_{nullptr};
+    memory::MemoryBudget* memory_budget_{nullptr};
+    MetricsSlot<memory::MemoryBudgetStats>* budget_metrics_{nullptr};
+    GapTracker inbound_gaps_{GapTracker::DEFAULT_CAPACITY};  // Mirrored to control_block_
+    uint32_t inbound_high_{0};                 // Highest seqnum received past a gap
+    bool gaps_requested_{false};               // Outstanding ranges requested this connection
+    std::optional<ResendBatch> resend_batch_;  // Allocated on first resend
+    uint32_t resend_gap_begin_{0};             // First seqnum of the open gap
+    std::optional<ResendBatch> outbound_batch_;  // Coalesced sends, allocated on first queue
+    std::optional<InboundBatch> inbound_batch_;  // Batched delivery (HasBatchedDelivery) only
+    std::chrono::steady_clock::time_point batch_opened_{};  // First message of the open batch
+    memory::InboundArena inbound_arena_;        // Reset by end_receive_batch()
+    util::TimerWheel* timer_wheel_{nullptr};    // Deadline-driven timers when set
+    util::TimerNode send_timer_;                // Heartbeat due
+    util::TimerNode recv_timer_;                // Test request / heartbeat timeout due
+    util::TimerNode logon_timer_;               // Logon response due
+    util::TimerNode throttle_timer_;            // Next throttle token due
+    util::TimerNode idle_timer_;                // Hibernation check (hibernate_after_ms)
+    bool hibernated_{false};                    // Large buffers released (hibernate())
+    uint64_t idle_activity_{0};                 // app_activity() when last seen changing
+    uint64_t idle_since_ns_{0};
+    std::optional<OutboundThrottle> throttle_;  // When throttle_rate is set
+    BackpressureState backpressure_{BackpressureState::Clear};  // Transport send queue
+    std::vector<char> forward_buffer_;          // forward_message() output
+    std::optional<DuplicateFilter> duplicates_;  // When duplicate_window is set
 };
 
+/// FIX 4.4 session with BeginString and admin messages fixed at compile time
+template <SessionHandler Handler = CallbackSessionHandler>
+using Fix44SessionManager = SessionManager<Handler, FixVersion::FIX_4_4>;
+
+/// FIXT.1.1 session whose Logon announces FIX 5.0 SP2 (DefaultApplVerID=9)
+template <SessionHandler Handler = CallbackSessionHandler>
+using Fix50Sp2SessionManager = SessionManager<Handler, FixVersion::FIX_5_0_SP2>;
+
 } // namespace nfx
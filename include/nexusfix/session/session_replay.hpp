@@ -0,0 +1,787 @@
+/*
+    NexusFIX Session Replay
+
+    Replays a recorded session - a packet capture or a BinaryLogger file -
+    message by message, as fast as possible or at its original timing:
+
+        PcapReplaySource  ----+                     +--> callback (StreamParser, ...)
+                              +--> replay() --------+--> SessionManager (replay_into)
+        BinaryLogReplaySource +    pacing, filters  +--> live acceptor  (mirror)
+
+    Sources map the file read-only and hand out spans into the mapping:
+    nothing is copied except a message that a capture split across TCP
+    segments, which is assembled in a per-flow buffer. A source yields
+    one framed FIX message per next(); the span stays valid until the
+    following next() call (the mapping itself lives as long as the source).
+
+    PcapReplaySource reads classic pcap (us/ns, either byte order) and
+    pcapng, over Ethernet (VLAN), Linux SLL/SLL2, loopback or raw IP, IPv4
+    or IPv6. TCP is reassembled per flow: retransmitted bytes are
+    dropped, and after bytes missing from the capture framing resyncs at
+    the next "8=FIX". IP fragments and IPv6 extension headers are skipped.
+
+    Pacing is TSC based (RdtscClock): the replay waits until
+    first_send + (message_time - first_message_time) / speed, sleeping
+    while the target is far away and spinning for the last stretch.
+
+    Usage:
+        auto source = PcapReplaySource::open("venue.pcap", {.local_port = 9876});
+        ReplayOptions options;
+        options.pacing = ReplayPacing::Original;
+        options.direction = ReplayDirection::Inbound;
+
+        replay_into(*source, session, options);             // Re-run the day's inbound
+
+        TcpSocket socket;                                   // Or drive a live acceptor
+        (void)socket.connect("uat-venue", 9876);
+        mirror(*source, socket, options);
+
+    Mirror sends the recorded bytes verbatim (original MsgSeqNum,
+    SendingTime, CompIDs): the acceptor's store must start where the
+    recording did, e.g. reset to seqnum 1 for a capture of a full day.
+
+    POSIX only.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+
+#if !NFX_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/types/wire_timestamp.hpp"
+#include "nexusfix/util/binary_logger.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Mapped File
+// ============================================================================
+
+/// Read-only private mapping of a whole file
+class MappedFile {
+public:
+    /// @return nullopt if the file cannot be opened or mapped
+    [[nodiscard]] static std::optional<MappedFile> open(const char* path) noexcept {
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return std::nullopt;
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        MappedFile file;
+        file.size_ = static_cast<size_t>(st.st_size);
+        if (file.size_ != 0) {
+            void* data = ::mmap(nullptr, file.size_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                return std::nullopt;
+            }
+            ::madvise(data, file.size_, MADV_SEQUENTIAL);
+            file.data_ = static_cast<const char*>(data);
+        }
+        ::close(fd);
+        return file;
+    }
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() { unmap(); }
+
+    [[nodiscard]] std::span<const char> bytes() const noexcept { return {data_, size_}; }
+
+private:
+    MappedFile() noexcept = default;
+
+    void unmap() noexcept {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    const char* data_{nullptr};
+    size_t size_{0};
+};
+
+// ============================================================================
+// Replay Message
+// ============================================================================
+
+/// Side of the recorded session a message travelled
+enum class ReplayDirection : uint8_t {
+    Any = 0,                     // ReplayOptions filter only
+    Inbound = 'I',               // Received by the recorded side
+    Outbound = 'O'               // Sent by the recorded side
+};
+
+/// One recorded FIX message
+struct ReplayMessage {
+    std::span<const char> bytes; // Exactly one framed message
+    int64_t time_ns{0};          // Capture / log time, ns since epoch; 0 = unknown
+    ReplayDirection direction{ReplayDirection::Inbound};
+    uint16_t stream{0};          // Binary log session id; capture flow index
+};
+
+/// Anything that yields recorded messages in order
+template <typename S>
+concept ReplaySource = requires(S& source, ReplayMessage& msg) {
+    { source.next(msg) } -> std::same_as<bool>;
+};
+
+// ============================================================================
+// Binary Log Source
+// ============================================================================
+
+/// Messages of a util::BinaryLogger file, in file order
+class BinaryLogReplaySource {
+public:
+    /// @return nullopt if path is not a readable binary log
+    [[nodiscard]] static std::optional<BinaryLogReplaySource> open(const char* path) noexcept {
+        auto file = MappedFile::open(path);
+        if (!file) return std::nullopt;
+        util::BinaryLogFileHeader header;
+        const auto bytes = file->bytes();
+        if (bytes.size() < sizeof(header)) return std::nullopt;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != util::BinaryLogFileHeader::MAGIC ||
+            header.version != util::BinaryLogFileHeader::VERSION ||
+            header.record_header_size != sizeof(util::BinaryLogRecord)) {
+            return std::nullopt;
+        }
+        return BinaryLogReplaySource{std::move(*file)};
+    }
+
+    /// @return false at end of file or at a truncated record
+    [[nodiscard]] bool next(ReplayMessage& msg) noexcept {
+        const auto bytes = file_.bytes();
+        while (bytes.size() - offset_ >= sizeof(util::BinaryLogRecord)) {
+            util::BinaryLogRecord record;
+            std::memcpy(&record, bytes.data() + offset_, sizeof(record));
+            const size_t span = util::detail::log_record_size(record.length);
+            if (span > bytes.size() - offset_) return false;
+            const char* payload = bytes.data() + offset_ + sizeof(record);
+            offset_ += span;
+
+            if (record.direction == static_cast<uint8_t>(util::LogDirection::Calibration)) {
+                if (record.length == sizeof(calibration_)) std::memcpy(&calibration_, payload, sizeof(calibration_));
+                continue;
+            }
+            msg.bytes = {payload, record.length};
+            msg.time_ns = calibration_.mult
+                ? static_cast<int64_t>(util::RdtscClock::to_ns(calibration_, record.tsc)) : 0;
+            msg.direction = static_cast<ReplayDirection>(record.direction);
+            msg.stream = record.session_id;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    explicit BinaryLogReplaySource(MappedFile file) noexcept
+        : file_{std::move(file)} {}
+
+    MappedFile file_;
+    size_t offset_{sizeof(util::BinaryLogFileHeader)};
+    util::TscCalibration calibration_{};
+};
+
+// ============================================================================
+// Packet Capture Source
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint32_t PCAP_MAGIC_US = 0xa1b2c3d4;
+inline constexpr uint32_t PCAP_MAGIC_NS = 0xa1b23c4d;
+inline constexpr uint32_t PCAPNG_SECTION = 0x0a0d0d0a;
+inline constexpr uint32_t PCAPNG_BYTE_ORDER = 0x1a2b3c4d;
+
+/// DLT_* link types the capture source understands
+enum CaptureLink : uint32_t {
+    LINK_NULL = 0, LINK_ETHERNET = 1, LINK_RAW = 101, LINK_LINUX_SLL = 113,
+    LINK_IPV4 = 228, LINK_IPV6 = 229, LINK_LINUX_SLL2 = 276
+};
+
+[[nodiscard]] inline uint16_t load_be16(const uint8_t* p) noexcept {
+    return static_cast<uint16_t>(p[0] << 8 | p[1]);
+}
+
+[[nodiscard]] inline uint32_t load_be32(const uint8_t* p) noexcept {
+    return uint32_t{p[0]} << 24 | uint32_t{p[1]} << 16 | uint32_t{p[2]} << 8 | p[3];
+}
+
+/// Capture file header fields in the file's byte order
+struct CaptureEndian {
+    bool swap{false};
+
+    [[nodiscard]] uint16_t u16(const uint8_t* p) const noexcept {
+        uint16_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return swap ? __builtin_bswap16(v) : v;
+    }
+
+    [[nodiscard]] uint32_t u32(const uint8_t* p) const noexcept {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return swap ? __builtin_bswap32(v) : v;
+    }
+};
+
+/// TCP payload of one captured frame
+struct TcpSegment {
+    std::string_view flow_key;   // Addresses and ports (points into the frame)
+    uint16_t src_port{0};
+    uint16_t dst_port{0};
+    uint32_t seq{0};
+    std::span<const char> payload;
+};
+
+/// Strip link, IP and TCP headers; false if the frame is not TCP with payload
+[[nodiscard]] inline bool decode_tcp_frame(uint32_t link, const uint8_t* p, size_t len,
+                                           TcpSegment& out) noexcept {
+    uint16_t ethertype = 0;
+    switch (link) {
+        case LINK_ETHERNET:
+            if (len < 14) return false;
+            ethertype = load_be16(p + 12);
+            p += 14; len -= 14;
+            while ((ethertype == 0x8100 || ethertype == 0x88a8) && len >= 4) {   // VLAN tags
+                ethertype = load_be16(p + 2);
+                p += 4; len -= 4;
+            }
+            break;
+        case LINK_LINUX_SLL:
+            if (len < 16) return false;
+            ethertype = load_be16(p + 14);
+            p += 16; len -= 16;
+            break;
+        case LINK_LINUX_SLL2:
+            if (len < 20) return false;
+            ethertype = load_be16(p);
+            p += 20; len -= 20;
+            break;
+        case LINK_NULL:
+            if (len < 4) return false;
+            p += 4; len -= 4;
+            [[fallthrough]];
+        case LINK_RAW: case LINK_IPV4: case LINK_IPV6:
+            if (len < 1) return false;
+            ethertype = (p[0] >> 4) == 6 ? 0x86dd : 0x0800;
+            break;
+        default:
+            return false;
+    }
+
+    const uint8_t* tcp;
+    size_t tcp_len;
+    if (ethertype == 0x0800) {
+        if (len < 20 || p[9] != 6) return false;             // TCP only
+        const size_t ihl = (p[0] & 0x0fu) * 4u;
+        const size_t total = std::min<size_t>(load_be16(p + 2), len);
+        if (ihl < 20 || total < ihl || (load_be16(p + 6) & 0x3fff) != 0) return false;   // Fragments
+        out.flow_key = {reinterpret_cast<const char*>(p + 12), 8};
+        tcp = p + ihl;
+        tcp_len = total - ihl;
+    } else if (ethertype == 0x86dd) {
+        if (len < 40 || p[6] != 6) return false;             // TCP, no extension headers
+        out.flow_key = {reinterpret_cast<const char*>(p + 8), 32};
+        tcp = p + 40;
+        tcp_len = std::min<size_t>(load_be16(p + 4), len - 40);
+    } else {
+        return false;
+    }
+
+    if (tcp_len < 20) return false;
+    const size_t offset = (tcp[12] >> 4) * 4u;
+    if (offset < 20 || offset >= tcp_len) return false;
+    out.src_port = load_be16(tcp);
+    out.dst_port = load_be16(tcp + 2);
+    out.seq = load_be32(tcp + 4);
+    out.payload = {reinterpret_cast<const char*>(tcp + offset), tcp_len - offset};
+    return true;
+}
+
+}  // namespace detail
+
+/// FIX messages carried by the TCP flows of a pcap / pcapng file
+class PcapReplaySource {
+public:
+    struct Config {
+        /// Port of the recorded side: TCP to it is Inbound, from it
+        /// Outbound. 0: every message is Inbound.
+        uint16_t local_port{0};
+    };
+
+    struct Stats {
+        uint64_t frames{0};          // Packet records read
+        uint64_t segments{0};        // TCP segments with payload
+        uint64_t retransmitted{0};   // Payload bytes already seen
+        uint64_t gaps{0};            // Holes in a flow (bytes not captured)
+        uint64_t reassembled{0};     // Messages split across segments
+    };
+
+    /// @return nullopt if path is not a readable pcap / pcapng file
+    [[nodiscard]] static std::optional<PcapReplaySource> open(const char* path) noexcept {
+        return open(path, Config{});
+    }
+
+    [[nodiscard]] static std::optional<PcapReplaySource> open(const char* path, Config config) noexcept {
+        auto file = MappedFile::open(path);
+        if (!file) return std::nullopt;
+        PcapReplaySource source{std::move(*file), config};
+        if (!source.read_file_header()) return std::nullopt;
+        return source;
+    }
+
+    /// @return false once every frame has been read
+    [[nodiscard]] bool next(ReplayMessage& msg) {
+        if (completed_) {
+            completed_->carry.clear();
+            completed_ = nullptr;
+        }
+        while (true) {
+            if (segment_flow_ && cursor_ < segment_.size() && next_in_segment(msg)) return true;
+            if (!next_segment()) return false;
+        }
+    }
+
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+private:
+    struct Flow {
+        uint32_t next_seq{0};
+        bool started{false};
+        uint16_t index{0};
+        ReplayDirection direction{ReplayDirection::Inbound};
+        std::string carry;           // Start of a message continued in a later segment
+    };
+
+    PcapReplaySource(MappedFile file, Config config) noexcept
+        : file_{std::move(file)}, config_{config} {}
+
+    [[nodiscard]] const uint8_t* data() const noexcept {
+        return reinterpret_cast<const uint8_t*>(file_.bytes().data());
+    }
+
+    [[nodiscard]] size_t remaining() const noexcept { return file_.bytes().size() - offset_; }
+
+    bool read_file_header() noexcept {
+        if (file_.bytes().size() < 24) return false;
+        uint32_t magic;
+        std::memcpy(&magic, data(), sizeof(magic));
+        if (magic == detail::PCAP_MAGIC_US || magic == detail::PCAP_MAGIC_NS ||
+            magic == __builtin_bswap32(detail::PCAP_MAGIC_US) ||
+            magic == __builtin_bswap32(detail::PCAP_MAGIC_NS)) {
+            endian_.swap = magic != detail::PCAP_MAGIC_US && magic != detail::PCAP_MAGIC_NS;
+            const bool nanos = magic == detail::PCAP_MAGIC_NS || magic == __builtin_bswap32(detail::PCAP_MAGIC_NS);
+            interfaces_.push_back({endian_.u32(data() + 20) & 0x0fffffffu, nanos ? 1 : 1000, 0});
+            offset_ = 24;
+            return true;
+        }
+        if (magic != detail::PCAPNG_SECTION) return false;
+        pcapng_ = true;
+        return true;
+    }
+
+    /// Advance to the next TCP segment that carries new payload
+    bool next_segment() {
+        segment_flow_ = nullptr;
+        detail::TcpSegment tcp;
+        int64_t time_ns = 0;
+        while (pcapng_ ? next_pcapng_frame(tcp, time_ns) : next_pcap_frame(tcp, time_ns)) {
+            ++stats_.segments;
+            Flow& flow = flow_for(tcp);
+            std::span<const char> payload = tcp.payload;
+            if (flow.started) {
+                const auto ahead = static_cast<int32_t>(tcp.seq - flow.next_seq);
+                if (ahead < 0) {
+                    const auto overlap = static_cast<size_t>(-static_cast<int64_t>(ahead));
+                    stats_.retransmitted += std::min(overlap, payload.size());
+                    if (overlap >= payload.size()) continue;
+                    payload = payload.subspan(overlap);
+                    tcp.seq += static_cast<uint32_t>(overlap);
+                } else if (ahead > 0) {
+                    ++stats_.gaps;
+                    flow.carry.clear();                      // Resync at the next "8=FIX"
+                }
+            }
+            flow.started = true;
+            flow.next_seq = tcp.seq + static_cast<uint32_t>(payload.size());
+            segment_ = payload;
+            segment_flow_ = &flow;
+            segment_time_ = time_ns;
+            cursor_ = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /// Next message in the current segment, completing the flow's carry first
+    bool next_in_segment(ReplayMessage& msg) {
+        Flow& flow = *segment_flow_;
+        while (!flow.carry.empty() && cursor_ < segment_.size()) {
+            const std::span<const char> carry{flow.carry.data(), flow.carry.size()};
+            const size_t size = detail::declared_message_size(carry, 0);
+            if (size == detail::MESSAGE_SIZE_INVALID) {
+                flow.carry.clear();
+                break;
+            }
+            const size_t take = size == detail::MESSAGE_SIZE_UNKNOWN
+                ? std::min<size_t>(segment_.size() - cursor_, 32)
+                : std::min(size - flow.carry.size(), segment_.size() - cursor_);
+            flow.carry.append(segment_.data() + cursor_, take);
+            cursor_ += take;
+            if (size == detail::MESSAGE_SIZE_UNKNOWN || flow.carry.size() < size) continue;
+            if (!detail::has_trailer_at(flow.carry.data(), size)) {
+                flow.carry.clear();
+                break;
+            }
+            ++stats_.reassembled;
+            completed_ = &flow;
+            emit(msg, {flow.carry.data(), flow.carry.size()}, flow);
+            return true;
+        }
+
+        while (cursor_ < segment_.size()) {
+            const std::string_view rest{segment_.data() + cursor_, segment_.size() - cursor_};
+            if (!rest.starts_with("8=FIX")) {
+                const size_t start = rest.find("8=FIX");
+                if (start == std::string_view::npos) {
+                    // Keep a tail that may be the start of "8=FIX"
+                    for (size_t keep = std::min<size_t>(rest.size(), 4); keep > 0; --keep) {
+                        if (std::string_view{"8=FIX"}.starts_with(rest.substr(rest.size() - keep))) {
+                            flow.carry.assign(rest.substr(rest.size() - keep));
+                            break;
+                        }
+                    }
+                    cursor_ = segment_.size();
+                    return false;
+                }
+                cursor_ += start;
+            }
+            const simd::MessageBoundary b = detail::frame_message(segment_, cursor_);
+            if (!b.complete) {
+                flow.carry.assign(segment_.data() + cursor_, segment_.size() - cursor_);
+                cursor_ = segment_.size();
+                return false;
+            }
+            cursor_ = b.end;
+            emit(msg, b.slice(segment_), flow);
+            return true;
+        }
+        return false;
+    }
+
+    void emit(ReplayMessage& msg, std::span<const char> bytes, const Flow& flow) const noexcept {
+        msg.bytes = bytes;
+        msg.time_ns = segment_time_;
+        msg.direction = flow.direction;
+        msg.stream = flow.index;
+    }
+
+    Flow& flow_for(const detail::TcpSegment& tcp) {
+        std::string key{tcp.flow_key};
+        key.append(reinterpret_cast<const char*>(&tcp.src_port), sizeof(tcp.src_port));
+        key.append(reinterpret_cast<const char*>(&tcp.dst_port), sizeof(tcp.dst_port));
+        auto [it, inserted] = flows_.try_emplace(std::move(key));
+        if (inserted) {
+            it->second.index = static_cast<uint16_t>(flows_.size() - 1);
+            it->second.direction = config_.local_port != 0 && tcp.src_port == config_.local_port
+                ? ReplayDirection::Outbound : ReplayDirection::Inbound;
+        }
+        return it->second;
+    }
+
+    struct Interface {
+        uint32_t link;
+        int64_t ns_per_tick;         // 0: ticks_per_second applies
+        uint64_t ticks_per_second;
+    };
+
+    [[nodiscard]] static int64_t ticks_to_ns(const Interface& iface, uint64_t ticks) noexcept {
+        if (iface.ns_per_tick) return static_cast<int64_t>(ticks) * iface.ns_per_tick;
+        const uint64_t tps = iface.ticks_per_second;
+        __extension__ using UInt128 = unsigned __int128;
+        const auto fraction = static_cast<UInt128>(ticks % tps) * 1'000'000'000ULL / tps;
+        return static_cast<int64_t>(ticks / tps * 1'000'000'000ULL + static_cast<uint64_t>(fraction));
+    }
+
+    bool next_pcap_frame(detail::TcpSegment& tcp, int64_t& time_ns) noexcept {
+        while (remaining() >= 16) {
+            const uint8_t* record = data() + offset_;
+            const uint32_t captured = endian_.u32(record + 8);
+            if (captured > remaining() - 16) return false;
+            offset_ += 16 + captured;
+            ++stats_.frames;
+            if (detail::decode_tcp_frame(interfaces_[0].link, record + 16, captured, tcp)) {
+                time_ns = static_cast<int64_t>(endian_.u32(record)) * 1'000'000'000 +
+                          static_cast<int64_t>(endian_.u32(record + 4)) * interfaces_[0].ns_per_tick;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool next_pcapng_frame(detail::TcpSegment& tcp, int64_t& time_ns) noexcept {
+        while (remaining() >= 12) {
+            const uint8_t* block = data() + offset_;
+            uint32_t type = endian_.u32(block);
+            if (type == detail::PCAPNG_SECTION || type == __builtin_bswap32(detail::PCAPNG_SECTION)) {
+                uint32_t order;
+                std::memcpy(&order, block + 8, sizeof(order));
+                endian_.swap = order != detail::PCAPNG_BYTE_ORDER;
+                interfaces_.clear();
+                type = detail::PCAPNG_SECTION;
+            }
+            const uint32_t length = endian_.u32(block + 4);
+            if (length < 12 || length > remaining()) return false;
+            offset_ += length;
+            const uint8_t* body = block + 8;
+            const size_t body_len = length - 12;
+
+            if (type == 1 && body_len >= 8) {                        // Interface Description
+                interfaces_.push_back(read_interface(body, body_len));
+            } else if (type == 6 && body_len >= 20) {                // Enhanced Packet
+                ++stats_.frames;
+                const uint32_t id = endian_.u32(body);
+                const uint32_t captured = endian_.u32(body + 12);
+                if (id >= interfaces_.size() || captured > body_len - 20) continue;
+                if (detail::decode_tcp_frame(interfaces_[id].link, body + 20, captured, tcp)) {
+                    const uint64_t ticks = uint64_t{endian_.u32(body + 4)} << 32 | endian_.u32(body + 8);
+                    time_ns = ticks_to_ns(interfaces_[id], ticks);
+                    return true;
+                }
+            } else if (type == 3 && body_len >= 4 && !interfaces_.empty()) {   // Simple Packet
+                ++stats_.frames;
+                const size_t captured = std::min<size_t>(endian_.u32(body), body_len - 4);
+                if (detail::decode_tcp_frame(interfaces_[0].link, body + 4, captured, tcp)) {
+                    time_ns = 0;                                      // No timestamp
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// Link type and timestamp resolution (if_tsresol) of an IDB
+    [[nodiscard]] Interface read_interface(const uint8_t* body, size_t len) const noexcept {
+        Interface iface{endian_.u16(body), 1000, 0};                // Default: microseconds
+        for (size_t at = 8; at + 4 <= len;) {
+            const uint16_t code = endian_.u16(body + at);
+            const uint16_t size = endian_.u16(body + at + 2);
+            if (code == 0 || at + 4 + size > len) break;
+            if (code == 9 && size >= 1) {
+                const uint8_t resolution = body[at + 4];
+                const uint32_t exponent = resolution & 0x7fu;
+                if (resolution & 0x80u) {                            // 2^-exponent seconds
+                    iface = {iface.link, 0, exponent < 64 ? uint64_t{1} << exponent : 1};
+                } else if (exponent <= 9) {                          // 10^-exponent seconds
+                    int64_t ns = 1;
+                    for (uint32_t i = exponent; i < 9; ++i) ns *= 10;
+                    iface.ns_per_tick = ns;
+                } else {
+                    uint64_t per_second = 1;
+                    for (uint32_t i = 0; i < exponent && i < 19; ++i) per_second *= 10;
+                    iface = {iface.link, 0, per_second};
+                }
+            }
+            at += 4 + ((size + 3u) & ~3u);
+        }
+        return iface;
+    }
+
+    MappedFile file_;
+    Config config_;
+    detail::CaptureEndian endian_;
+    bool pcapng_{false};
+    size_t offset_{0};
+    std::vector<Interface> interfaces_;
+    std::unordered_map<std::string, Flow> flows_;
+
+    std::span<const char> segment_;
+    Flow* segment_flow_{nullptr};
+    int64_t segment_time_{0};
+    size_t cursor_{0};
+    Flow* completed_{nullptr};       // Carry handed out; cleared by the next next()
+    Stats stats_;
+};
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+enum class ReplayPacing : uint8_t {
+    AsFastAsPossible,
+    Original                     // Recorded inter-message gaps, divided by speed
+};
+
+struct ReplayOptions {
+    ReplayPacing pacing{ReplayPacing::AsFastAsPossible};
+    double speed{1.0};                               // Original pacing: 2.0 = twice as fast
+    ReplayDirection direction{ReplayDirection::Any}; // Only messages travelling this way
+    int32_t stream{-1};                              // Only this session id / flow; -1 = all
+    std::chrono::microseconds spin_threshold{200};   // Sleep until this close to a send time
+};
+
+struct ReplayStats {
+    uint64_t messages{0};        // Delivered to the target
+    uint64_t bytes{0};
+    uint64_t skipped{0};         // Filtered out
+    uint64_t elapsed_ns{0};      // First to last delivery
+    uint64_t max_lag_ns{0};      // Original pacing: worst delivery behind schedule
+};
+
+namespace detail {
+
+/// Wait (RdtscClock) until target_ns, sleeping while it is far away
+inline void wait_until_ns(uint64_t target_ns, std::chrono::nanoseconds spin) noexcept {
+    uint64_t now = util::RdtscClock::now_ns();
+    const auto spin_ns = static_cast<uint64_t>(spin.count());
+    if (target_ns > now + spin_ns) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds{target_ns - now - spin_ns});
+    }
+    while (util::RdtscClock::now_ns() < target_ns) {
+        memory::BusySpinWait::wait();
+    }
+}
+
+}  // namespace detail
+
+/// Deliver the source's messages to fn(const ReplayMessage&) with the
+/// requested pacing and filters. Feeding a StreamParser, a parse loop or
+/// any other consumer goes through here.
+template <ReplaySource Source, typename Fn>
+ReplayStats replay(Source& source, const ReplayOptions& options, Fn&& fn) {
+    ReplayStats stats;
+    ReplayMessage msg;
+    const bool paced = options.pacing == ReplayPacing::Original && options.speed > 0.0;
+    int64_t first_time = 0;
+    uint64_t start_ns = 0;
+    uint64_t last_ns = 0;
+
+    while (source.next(msg)) {
+        if ((options.direction != ReplayDirection::Any && msg.direction != options.direction) ||
+            (options.stream >= 0 && msg.stream != options.stream)) {
+            ++stats.skipped;
+            continue;
+        }
+        if (stats.messages == 0) {
+            first_time = msg.time_ns;
+            start_ns = util::RdtscClock::now_ns();
+        } else if (paced && msg.time_ns > first_time) {
+            const auto offset = static_cast<double>(msg.time_ns - first_time) / options.speed;
+            const uint64_t target = start_ns + static_cast<uint64_t>(offset);
+            detail::wait_until_ns(target, options.spin_threshold);
+            const uint64_t now = util::RdtscClock::now_ns();
+            stats.max_lag_ns = std::max(stats.max_lag_ns, now - std::min(now, target));
+        }
+
+        fn(static_cast<const ReplayMessage&>(msg));
+        ++stats.messages;
+        stats.bytes += msg.bytes.size();
+        if (paced) last_ns = util::RdtscClock::now_ns();
+    }
+
+    if (stats.messages != 0) {
+        if (!paced) last_ns = util::RdtscClock::now_ns();
+        stats.elapsed_ns = last_ns - std::min(last_ns, start_ns);
+    }
+    return stats;
+}
+
+/// Feed recorded messages to a session as if its transport received them
+/// Each message is its own receive batch, stamped with its recorded time.
+/// Filter on ReplayDirection::Inbound for the recorded side's own session.
+template <ReplaySource Source, SessionHandler Handler, FixVersion Version>
+ReplayStats replay_into(Source& source, SessionManager<Handler, Version>& session, const ReplayOptions& options) {
+    return replay(source, options, [&](const ReplayMessage& msg) {
+        session.on_data_received(msg.bytes, WireTimestamp{msg.time_ns, 0});
+        session.end_receive_batch();
+    });
+}
+
+/// Socket that mirror() can drive (TcpSocket)
+template <typename S>
+concept MirrorSocket = requires(S& socket, std::span<const char> out, std::span<char> in) {
+    { socket.send(out) };
+    { socket.try_receive(in) };
+};
+
+struct MirrorStats {
+    ReplayStats replay;
+    uint64_t send_failures{0};   // Messages not fully written (connection lost)
+    uint64_t bytes_received{0};  // Responses drained from the acceptor
+};
+
+/// Send recorded messages to a live acceptor over a connected socket,
+/// draining (and discarding) its responses so its sends never block.
+/// Usually options.direction selects what the recorded counterparty sent
+/// to the recorded acceptor: Inbound for an acceptor-side recording.
+template <ReplaySource Source, MirrorSocket Socket>
+MirrorStats mirror(Source& source, Socket& socket, const ReplayOptions& options) {
+    MirrorStats stats;
+    std::array<char, 65536> drain;
+    const auto receive_pending = [&] {
+        while (true) {
+            auto received = socket.try_receive(std::span<char>{drain});
+            if (!received || *received == 0) return;
+            stats.bytes_received += *received;
+        }
+    };
+
+    stats.replay = replay(source, options, [&](const ReplayMessage& msg) {
+        std::span<const char> pending = msg.bytes;
+        while (!pending.empty()) {
+            auto sent = socket.send(pending);
+            if (!sent) {
+                ++stats.send_failures;
+                return;
+            }
+            pending = pending.subspan(*sent);
+            if (!pending.empty()) receive_pending();     // Peer's window is full
+        }
+        receive_pending();
+    });
+    receive_pending();
+    return stats;
+}
+
+} // namespace nfx
+
+#endif // !NFX_PLATFORM_WINDOWS
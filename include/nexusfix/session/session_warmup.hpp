@@ -0,0 +1,233 @@
+/*
+    NexusFIX Session Warmup
+
+    util::warm_icache() warms the parser with canned messages, but the
+    rest of a first order's path - MsgType routing, the handler's typed
+    hooks, sequencing, the builders, store writes and the handler's send
+    into the transport - is still cold at market open. warm_session()
+    runs synthetic traffic through a real SessionManager<Handler> of the
+    production Handler type, so the very same template instantiation is
+    executed, then throws the session away:
+
+        on_connect -> initiate_logon -> Logon ack
+        per pass:  Heartbeat, TestRequest (-> Heartbeat reply),
+                   ExecutionReport (New, Fill), OrderCancelReject,
+                   MarketData W / X, and with send_orders:
+                   NewOrderSingle, OrderCancelRequest, MarketDataRequest,
+                   then a ResendRequest replaying them from the store
+        initiate_logout -> Logout ack -> on_disconnect
+
+    Nothing outlives the call: the session, its throwaway
+    MemoryMessageStore and its sequence numbers are destroyed on return,
+    so the production session starts from its own clean state. Only the
+    handler passed in sees the traffic - give it a null or loopback
+    transport (and a strategy that ignores the synthetic fills).
+
+    Usage:
+        // Before the open, on the thread that will run the session
+        auto stats = warm_session(config, MyHandler{null_transport});
+        SessionManager<MyHandler> session{config, MyHandler{real_transport}};
+        session.set_message_store(&store);
+        auto report = session.prepare();            // Data side: lock + pre-fault
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Options / Stats
+// ============================================================================
+
+struct SessionWarmupOptions {
+    size_t iterations{200};        // Passes of the inbound / outbound mix
+    bool send_orders{true};        // Build and send test orders (and replay them)
+};
+
+struct SessionWarmupStats {
+    size_t iterations{0};
+    uint64_t messages_received{0};
+    uint64_t messages_sent{0};
+    uint64_t messages_resent{0};
+    uint64_t total_cycles{0};      // rdtscp cycles spent in the warmup
+    bool logged_on{false};         // The synthetic Logon was accepted
+
+    [[nodiscard]] constexpr bool success() const noexcept { return logged_on; }
+};
+
+// ============================================================================
+// Counterparty Message Factory
+// ============================================================================
+
+namespace detail {
+
+/// Builds the counterparty's side of the synthetic conversation
+class WarmupCounterparty {
+public:
+    explicit WarmupCounterparty(const SessionConfig& config)
+        : sender_{config.target_comp_id}, target_{config.sender_comp_id} {
+        buffer_.reserve(512);
+        fields_.reserve(512);
+    }
+
+    /// Next inbound message of msg_type with body (SOH-terminated fields)
+    [[nodiscard]] std::span<const char> next(std::string_view msg_type, std::string_view body = {}) {
+        fields_.assign("35=");
+        fields_.append(msg_type);
+        fields_.append("\x01" "49=");
+        fields_.append(sender_);
+        fields_.append("\x01" "56=");
+        fields_.append(target_);
+        fields_.append("\x01" "34=");
+        fields_.append(std::to_string(seq_++));
+        fields_.append("\x01" "52=20240102-09:30:00.000\x01");
+        fields_.append(body);
+
+        buffer_.assign("8=FIX.4.4\x01" "9=");
+        buffer_.append(std::to_string(fields_.size()));
+        buffer_.push_back('\x01');
+        buffer_.append(fields_);
+        const auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{buffer_.data(), buffer_.size()}));
+        buffer_.append("10=");
+        buffer_.append(cs.data(), cs.size());
+        buffer_.push_back('\x01');
+        return {buffer_.data(), buffer_.size()};
+    }
+
+private:
+    std::string_view sender_;
+    std::string_view target_;
+    uint32_t seq_{1};
+    std::string fields_;
+    std::string buffer_;
+};
+
+inline constexpr std::string_view WARMUP_EXEC_NEW =
+    "37=WARM-O1\x01" "11=WARM-C1\x01" "17=WARM-E1\x01" "150=0\x01" "39=0\x01"
+    "55=AAPL\x01" "54=1\x01" "38=100\x01" "44=150.25\x01" "151=100\x01" "14=0\x01" "6=0\x01";
+
+inline constexpr std::string_view WARMUP_EXEC_FILL =
+    "37=WARM-O1\x01" "11=WARM-C1\x01" "17=WARM-E2\x01" "150=F\x01" "39=2\x01"
+    "55=AAPL\x01" "54=1\x01" "38=100\x01" "44=150.25\x01" "32=100\x01" "31=150.25\x01"
+    "151=0\x01" "14=100\x01" "6=150.25\x01";
+
+inline constexpr std::string_view WARMUP_CANCEL_REJECT =
+    "37=WARM-O1\x01" "11=WARM-C2\x01" "41=WARM-C1\x01" "39=2\x01" "434=1\x01" "102=1\x01";
+
+inline constexpr std::string_view WARMUP_MD_SNAPSHOT =
+    "262=WARM-MD\x01" "55=AAPL\x01" "268=2\x01"
+    "269=0\x01" "270=150.25\x01" "271=100\x01"
+    "269=1\x01" "270=150.30\x01" "271=200\x01";
+
+inline constexpr std::string_view WARMUP_MD_INCREMENTAL =
+    "268=1\x01" "279=0\x01" "269=0\x01" "55=AAPL\x01" "270=150.26\x01" "271=50\x01";
+
+} // namespace detail
+
+// ============================================================================
+// Session Warmup
+// ============================================================================
+
+/// Run synthetic traffic through a throwaway SessionManager<Handler>
+/// @param config Production session config (same branches get warmed)
+/// @param handler Handler wired to a null / loopback transport
+[[nodiscard]] inline auto warm_session(const SessionConfig& config, auto handler,
+                                       const SessionWarmupOptions& options = {}) noexcept
+    -> SessionWarmupStats
+{
+    using Handler = decltype(handler);
+
+    SessionWarmupStats stats{};
+    const uint64_t start = util::detail::rdtscp();
+
+    store::MemoryMessageStore store{"warmup"};
+    SessionManager<Handler> session{config, std::move(handler)};
+    session.set_message_store(&store);
+    detail::WarmupCounterparty peer{config};
+
+    const auto feed = [&](std::span<const char> msg) { session.on_data_received(msg); };
+
+    session.on_connect();
+    if (session.initiate_logon().has_value()) {
+        feed(peer.next("A", "98=0\x01" "108=30\x01"));
+    }
+    stats.logged_on = session.state() == SessionState::Active;
+
+    for (size_t i = 0; stats.logged_on && i < options.iterations; ++i) {
+        feed(peer.next("0"));
+        feed(peer.next("1", "112=WARM\x01"));
+        feed(peer.next("8", detail::WARMUP_EXEC_NEW));
+        feed(peer.next("8", detail::WARMUP_EXEC_FILL));
+        feed(peer.next("9", detail::WARMUP_CANCEL_REJECT));
+        feed(peer.next("W", detail::WARMUP_MD_SNAPSHOT));
+        feed(peer.next("X", detail::WARMUP_MD_INCREMENTAL));
+        session.end_receive_batch();
+
+        if (options.send_orders) {
+            const uint32_t first = session.sequences().current_outbound();
+
+            fix44::NewOrderSingle::Builder order;
+            order.cl_ord_id("WARM-C1")
+                .symbol("AAPL")
+                .side(Side::Buy)
+                .transact_time("20240102-09:30:00.000")
+                .order_qty(Qty::from_int(100))
+                .ord_type(OrdType::Limit)
+                .price(FixedPrice::from_double(150.25));
+            (void)session.send_app_message(order);
+
+            fix44::OrderCancelRequest::Builder cancel;
+            cancel.orig_cl_ord_id("WARM-C1")
+                .cl_ord_id("WARM-C2")
+                .symbol("AAPL")
+                .side(Side::Buy)
+                .transact_time("20240102-09:30:00.000")
+                .order_qty(Qty::from_int(100));
+            (void)session.send_app_message(cancel);
+
+            fix44::MarketDataRequest::Builder md;
+            md.md_req_id("WARM-MD")
+                .subscription_type(SubscriptionRequestType::SnapshotPlusUpdates)
+                .market_depth(1)
+                .add_entry_type(MDEntryType::Bid)
+                .add_entry_type(MDEntryType::Offer)
+                .add_symbol("AAPL");
+            (void)session.send_app_message(md);
+            session.flush_sends();
+
+            // Replay them from the store
+            const std::string range = "7=" + std::to_string(first) + "\x01" "16=0\x01";
+            feed(peer.next("2", range));
+            session.end_receive_batch();
+        }
+        session.on_timer_tick();
+    }
+
+    if (stats.logged_on && session.initiate_logout("warmup").has_value()) {
+        feed(peer.next("5"));
+    }
+    session.on_disconnect();
+
+    stats.iterations = options.iterations;
+    stats.messages_received = session.stats().messages_received;
+    stats.messages_sent = session.stats().messages_sent;
+    stats.messages_resent = session.stats().messages_resent;
+    stats.total_cycles = util::detail::rdtscp() - start;
+    return stats;
+}
+
+} // namespace nfx
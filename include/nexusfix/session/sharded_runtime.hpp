@@ -0,0 +1,634 @@
+/*
+    NexusFIX Sharded Session Runtime
+
+    Thread-per-core, shared-nothing home for initiator sessions. Each
+    shard is one pinned thread that owns everything its sessions touch:
+
+        shard (core N)
+          IoUringReactor      sockets of its sessions, SINGLE_ISSUER ring
+          timer wheel         heartbeats, test requests, logon timeouts, reconnects
+          per-session heap    backs the session's MemoryMessageStore
+          inboxes             one SPSCQueue per producer shard (+1 external)
+
+    Sessions are placed with SessionCoreMapper::core_for_session(), so a
+    given CompID pair always lands on the same shard, and all of their
+    state (heap, store, SessionManager) is built on the shard thread, where
+    it is first touched. Nothing on the hot path is shared between shards:
+    shards talk only through ShardMessage mailboxes, one SPSCQueue for
+    every (producer, consumer) pair, and one eventfd per consumer wakes its
+    ring when any of its inboxes gets work.
+
+    Reconnects go through a ReconnectManager per session: addresses are
+    resolved and standby sockets created while the connection is up, a
+    connection that stayed up for at least reconnect_interval is redialled
+    at once (anything else waits reconnect_interval, so a peer that accepts
+    and drops cannot spin the shard), and a backup endpoint is either
+    tried after the primary fails or raced against it (race_backup).
+
+    Apps reach other shards through the ShardContext handed to the optional
+    bind_shard() hook, and receive mail through the optional
+    on_shard_message() hook:
+
+        void bind_shard(ShardContext& shard) noexcept;
+        void on_shard_message(Session& session, const ShardMessage& msg) noexcept;
+
+    Usage:
+        ShardedRuntime<App> runtime{{.cores = CpuAffinityConfig::default_config()}};
+        SessionConfig cfg;
+        cfg.sender_comp_id = "CLIENT";
+        cfg.target_comp_id = "EXCH1";
+        ShardSessionRef ref = runtime.add_session(cfg, "10.0.0.1", 9876);   // Before start()
+        // or with a backup: add_session(cfg, "10.0.0.1", 9876, {}, "10.0.1.1", 9876)
+        runtime.start();
+
+        ShardMessage msg{.kind = CANCEL_ALL};
+        runtime.post(ref, msg);              // Control thread -> owning shard
+        ...
+        runtime.stop();
+*/
+
+#pragma once
+
+#include "nexusfix/memory/queue_notifier.hpp"
+#include "nexusfix/memory/session_heap.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/io_uring_reactor.hpp"
+#include "nexusfix/transport/reconnect_manager.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/timer_wheel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <latch>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Cross-Shard Messages
+// ============================================================================
+
+/// Session address: owning shard and its slot there
+struct ShardSessionRef {
+    static constexpr uint16_t INVALID_SHARD = UINT16_MAX;
+
+    uint16_t shard{INVALID_SHARD};
+    uint32_t slot{0};
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return shard != INVALID_SHARD; }
+    constexpr bool operator==(const ShardSessionRef&) const noexcept = default;
+};
+
+/// One cache line of mail for a session on another shard
+struct ShardMessage {
+    static constexpr size_t PAYLOAD_SIZE = 48;
+
+    uint32_t session{0};            // Target slot (set by the runtime on post)
+    uint16_t source_shard{0};       // Sender (set by the runtime; shard_count() = external)
+    uint16_t kind{0};               // Application-defined
+    uint32_t length{0};             // Payload bytes in use
+    uint32_t tag{0};                // Application-defined (e.g. a correlation id)
+    std::array<char, PAYLOAD_SIZE> payload{};
+
+    /// Copy data into the payload
+    /// @return false if data does not fit
+    bool set_payload(std::span<const char> data) noexcept {
+        if (data.size() > PAYLOAD_SIZE) return false;
+        std::memcpy(payload.data(), data.data(), data.size());
+        length = static_cast<uint32_t>(data.size());
+        return true;
+    }
+
+    [[nodiscard]] std::span<const char> data() const noexcept {
+        return {payload.data(), std::min<size_t>(length, PAYLOAD_SIZE)};
+    }
+};
+
+static_assert(sizeof(ShardMessage) == 64, "ShardMessage must be one cache line");
+static_assert(std::is_trivially_copyable_v<ShardMessage>);
+
+/// A shard as seen by the apps it runs
+class ShardContext {
+public:
+    virtual ~ShardContext() = default;
+
+    /// Mail a session on any shard (this one included); shard thread only
+    /// @return false if the target is unknown or its inbox from this shard is full
+    virtual bool post(ShardSessionRef to, const ShardMessage& msg) noexcept = 0;
+
+    [[nodiscard]] virtual uint16_t index() const noexcept = 0;
+    [[nodiscard]] virtual int core() const noexcept = 0;
+};
+
+/// Optional hook: the shard that will run the app (called on that shard)
+template <typename T>
+concept HasBindShard = requires(T& app, ShardContext& shard) {
+    { app.bind_shard(shard) } noexcept;
+};
+
+/// Optional hook: mail for the app's session
+template <typename T, typename Session>
+concept HasOnShardMessage = requires(T& app, Session& session, const ShardMessage& msg) {
+    { app.on_shard_message(session, msg) } noexcept;
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Shard Session Handler
+// ============================================================================
+
+/// Application callbacks for sharded sessions (on_send is the runtime's)
+template <typename T>
+concept ShardApp = HasOnAppMessage<T> &&
+                   HasOnStateChange<T> &&
+                   HasOnError<T> &&
+                   HasOnLogon<T> &&
+                   HasOnLogout<T>;
+
+/// SessionHandler writing to the session's channel on its shard's reactor
+template <ShardApp App>
+struct ShardSessionHandler {
+    App app;
+    IoUringReactor* reactor{nullptr};
+    IoUringReactor::ChannelId channel{IoUringReactor::INVALID_CHANNEL};
+
+    void on_app_message(const ParsedMessage& msg) noexcept { app.on_app_message(msg); }
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        app.on_state_change(from, to);
+        // Logout, heartbeat timeout, rejected Logon: drop the connection
+        if (reactor && is_connected(from) && !is_connected(to)) reactor->close(channel);
+    }
+    bool on_send(std::span<const char> data) noexcept {
+        return reactor && reactor->send(channel, data).has_value();
+    }
+    void on_error(const SessionError& err) noexcept { app.on_error(err); }
+    void on_logon() noexcept { app.on_logon(); }
+    void on_logout(std::string_view reason) noexcept { app.on_logout(reason); }
+};
+
+// ============================================================================
+// Runtime Configuration
+// ============================================================================
+
+struct ShardedRuntimeConfig {
+    /// One shard per allowed core
+    util::CpuAffinityConfig cores{util::CpuAffinityConfig::default_config()};
+    bool pin_shards{true};
+
+    /// Ring and channel table of each shard (max_channels >= its sessions)
+    IoUringReactorConfig reactor{};
+
+    uint32_t tick_interval_ms{100};        // Timer wheel tick; coalesced-send flush period
+
+    /// Per session: connect deadline, standby sockets, primary/backup racing
+    uint32_t connect_timeout_ms{3000};
+    size_t standby_sockets{1};
+    bool race_backup{false};
+
+    /// Per session: heap size and the store's byte ring carved from it
+    size_t session_heap_size{4 * 1024 * 1024};
+    size_t store_pool_size{1024 * 1024};
+    size_t store_max_messages{10000};
+};
+
+/// Counters of one shard, written only by its thread (read after stop())
+struct ShardStats {
+    uint64_t timers_fired{0};          // Session and reconnect deadlines
+    uint64_t connects{0};
+    uint64_t immediate_reconnects{0};  // Reconnects started without waiting reconnect_interval
+    uint64_t messages_delivered{0};    // ShardMessages handed to an app
+    uint64_t messages_dropped{0};      // Unknown slot or no on_shard_message hook
+    uint64_t posts_failed{0};          // Target inbox full
+};
+
+// ============================================================================
+// Sharded Runtime
+// ============================================================================
+
+/// Initiator sessions sharded over pinned, shared-nothing reactor threads
+/// @tparam App Application callbacks, one instance per session
+/// @tparam MailboxCapacity Slots in each (producer, consumer) inbox
+template <ShardApp App, size_t MailboxCapacity = 1024>
+class ShardedRuntime {
+public:
+    using Handler = ShardSessionHandler<App>;
+    using Session = SessionManager<Handler>;
+    using Mailbox = memory::SPSCQueue<ShardMessage, MailboxCapacity>;
+
+    explicit ShardedRuntime(ShardedRuntimeConfig config = {})
+        : config_{std::move(config)}
+        , mapper_{config_.cores} {
+        const auto& cores = mapper_.config().allowed_cores;
+        shards_.reserve(cores.size());
+        for (size_t i = 0; i < cores.size(); ++i) {
+            shards_.push_back(std::make_unique<Shard>(*this, static_cast<uint16_t>(i), cores[i]));
+        }
+    }
+
+    ~ShardedRuntime() { stop(); }
+
+    ShardedRuntime(const ShardedRuntime&) = delete;
+    ShardedRuntime& operator=(const ShardedRuntime&) = delete;
+
+    // ========================================================================
+    // Setup
+    // ========================================================================
+
+    /// Register an initiator session (before start())
+    /// CompIDs, BeginString and hosts are copied. The session is built on
+    /// its shard at start() and connects from there.
+    /// @param backup_host Optional second endpoint of the counterparty
+    /// @return Address of the session, invalid if there are no shards
+    ShardSessionRef add_session(const SessionConfig& config, std::string_view host,
+                                uint16_t port, App app = App{},
+                                std::string_view backup_host = {}, uint16_t backup_port = 0) {
+        if (running_) return {};
+        Shard* shard = shard_for_core(
+            mapper_.core_for_session(config.sender_comp_id, config.target_comp_id));
+        if (!shard) return {};
+
+        auto spec = std::make_unique<SessionSpec>();
+        spec->sender.assign(config.sender_comp_id);
+        spec->target.assign(config.target_comp_id);
+        spec->begin_string.assign(config.begin_string);
+        spec->host.assign(host);
+        spec->port = port;
+        spec->backup_host.assign(backup_host);
+        spec->backup_port = backup_port;
+        spec->config = config;
+        spec->config.sender_comp_id = spec->sender;
+        spec->config.target_comp_id = spec->target;
+        spec->config.begin_string = spec->begin_string;
+        spec->app = std::move(app);
+
+        const auto slot = static_cast<uint32_t>(shard->specs.size());
+        shard->specs.push_back(std::move(spec));
+        return ShardSessionRef{shard->index(), slot};
+    }
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Start every shard (once); returns when all have built their sessions
+    [[nodiscard]] TransportResult<void> start() {
+        if (running_) return {};
+        if (started_ || shards_.empty()) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+
+        started_ = true;
+        stop_.store(false, std::memory_order_relaxed);
+        std::latch ready{static_cast<std::ptrdiff_t>(shards_.size())};
+        for (auto& shard : shards_) {
+            shard->thread = std::thread([s = shard.get(), &ready] { s->main(ready); });
+        }
+        ready.wait();
+
+        running_ = true;
+        for (const auto& shard : shards_) {
+            if (shard->error) {
+                const TransportError error = *shard->error;
+                stop();
+                return std::unexpected{error};
+            }
+        }
+        return {};
+    }
+
+    /// Stop and join every shard; sessions and their stores are released
+    void stop() noexcept {
+        if (!running_) return;
+        stop_.store(true, std::memory_order_relaxed);
+        for (auto& shard : shards_) {
+            if (shard->thread.joinable()) shard->thread.join();
+        }
+        running_ = false;
+    }
+
+    // ========================================================================
+    // Messaging
+    // ========================================================================
+
+    /// Mail a session from outside the shards (one control thread only)
+    /// @return false if the target is unknown or its external inbox is full
+    bool post(ShardSessionRef to, const ShardMessage& msg) noexcept {
+        return route(static_cast<uint16_t>(shards_.size()), to, msg);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] size_t shard_count() const noexcept { return shards_.size(); }
+    [[nodiscard]] bool is_running() const noexcept { return running_; }
+
+    /// Sessions placed on a shard
+    [[nodiscard]] size_t session_count(uint16_t shard) const noexcept {
+        return shard < shards_.size() ? shards_[shard]->specs.size() : 0;
+    }
+
+    /// Core a shard runs on
+    [[nodiscard]] int shard_core(uint16_t shard) const noexcept {
+        return shard < shards_.size() ? shards_[shard]->core() : -1;
+    }
+
+    /// Counters of a shard (stable once stop() returned)
+    [[nodiscard]] const ShardStats& shard_stats(uint16_t shard) const noexcept {
+        return shards_[shard]->stats;
+    }
+
+    [[nodiscard]] const ShardedRuntimeConfig& config() const noexcept { return config_; }
+
+private:
+    using ChannelId = IoUringReactor::ChannelId;
+    using Clock = std::chrono::steady_clock;
+
+    /// What add_session() recorded; the session itself is built on its shard
+    struct SessionSpec {
+        std::string sender;
+        std::string target;
+        std::string begin_string;
+        std::string host;
+        uint16_t port{0};
+        std::string backup_host;
+        uint16_t backup_port{0};
+        SessionConfig config{};
+        App app{};
+    };
+
+    class Shard;
+
+    /// One session on its shard: heap, store, SessionManager, connection
+    class ShardSession final : public IReactorHandler {
+    public:
+        ShardSession(Shard& shard, SessionSpec& spec)
+            : shard_{shard}
+            , spec_{spec}
+            , heap_{memory::make_session_heap(shard.runtime().config_.session_heap_size,
+                                              shard.runtime().config_.cores.numa_node)}
+            , store_{store::MemoryMessageStore::Config{
+                  .session_id = spec.sender + "->" + spec.target,
+                  .max_messages = shard.runtime().config_.store_max_messages,
+                  .pool_size_bytes = shard.runtime().config_.store_pool_size,
+                  .upstream_resource = heap_.get(),
+                  .single_writer = true,
+              }}
+            , session_{spec.config, Handler{std::move(spec.app)}}
+            , reconnect_{ReconnectConfig{
+                  .primary_host = spec.host,
+                  .primary_port = spec.port,
+                  .backup_host = spec.backup_host,
+                  .backup_port = spec.backup_port,
+                  .race_backup = shard.runtime().config_.race_backup,
+                  .connect_timeout_ms = shard.runtime().config_.connect_timeout_ms,
+                  .standby_sockets = shard.runtime().config_.standby_sockets,
+              }}
+            , reconnect_timer_{&on_reconnect_deadline, this} {
+            session_.set_message_store(&store_);
+            session_.set_timer_wheel(&shard.wheel);
+            session_.handler().reactor = &shard.reactor;
+            if constexpr (HasBindShard<App>) session_.handler().app.bind_shard(shard);
+        }
+
+        [[nodiscard]] Session& session() noexcept { return session_; }
+
+        void on_connected() noexcept override {
+            connected_ = true;
+            connected_at_ = Clock::now();
+            attempts_ = 0;
+            reconnect_.on_connected(shard_.reactor);
+            if (spec_.config.coalesce_sends) {
+                shard_.reactor.set_timer(channel_, shard_.runtime().config_.tick_interval_ms);
+            }
+            session_.on_connect();
+            (void)session_.initiate_logon();
+            reconnect_.prepare();  // After the Logon is out: ready for the next drop
+        }
+
+        void on_message(std::span<const char> message) noexcept override {
+            session_.on_data_received(message);
+        }
+
+        void on_receive_complete() noexcept override {
+            session_.end_receive_batch();
+        }
+
+        /// Coalesced-send flush (armed only for sessions with coalesce_sends)
+        void on_timer() noexcept override {
+            if (connected_) session_.on_timer_tick();
+        }
+
+        void on_closed(const TransportError&) noexcept override {
+            // The channel is gone: detach before the state change would close it
+            channel_ = IoUringReactor::INVALID_CHANNEL;
+            session_.handler().channel = channel_;
+            const bool was_connected = connected_;
+            if (connected_) session_.on_disconnect();
+            connected_ = false;
+            if (!was_connected) reconnect_.on_connect_failed();
+            schedule_reconnect(was_connected && Clock::now() - connected_at_ >= reconnect_interval());
+        }
+
+        /// Shard startup: resolve and create sockets, then connect
+        void start() noexcept {
+            reconnect_.prepare();
+            connect();
+        }
+
+        void connect() noexcept {
+            ++attempts_;
+            auto channel = reconnect_.connect(shard_.reactor, *this);
+            if (!channel) {
+                reconnect_.on_connect_failed();
+                schedule_reconnect(false);
+                return;
+            }
+            ++shard_.stats.connects;
+            channel_ = *channel;
+            session_.handler().channel = channel_;
+        }
+
+    private:
+        /// Retry after reconnect_interval unless max_reconnect_attempts is spent
+        /// immediate: a connection that had been up long enough dropped
+        void schedule_reconnect(bool immediate) noexcept {
+            if (immediate) {
+                ++shard_.stats.immediate_reconnects;
+                connect();
+                return;
+            }
+            const int max_attempts = spec_.config.max_reconnect_attempts;
+            if (max_attempts > 0 && attempts_ >= static_cast<uint32_t>(max_attempts)) return;
+            shard_.wheel.schedule_after(reconnect_timer_, reconnect_interval());
+        }
+
+        [[nodiscard]] std::chrono::seconds reconnect_interval() const noexcept {
+            return std::chrono::seconds{std::max(spec_.config.reconnect_interval, 0)};
+        }
+
+        static void on_reconnect_deadline(void* context) noexcept {
+            auto& self = *static_cast<ShardSession*>(context);
+            if (self.channel_ == IoUringReactor::INVALID_CHANNEL) self.connect();
+        }
+
+        Shard& shard_;
+        SessionSpec& spec_;
+        std::unique_ptr<std::pmr::memory_resource> heap_;
+        store::MemoryMessageStore store_;
+        Session session_;
+        ReconnectManager reconnect_;
+        util::TimerNode reconnect_timer_;
+        ChannelId channel_{IoUringReactor::INVALID_CHANNEL};
+        Clock::time_point connected_at_{};
+        uint32_t attempts_{0};
+        bool connected_{false};
+    };
+
+    /// One pinned thread: reactor, sessions and inboxes
+    class Shard final : public ShardContext, public INotifierHandler {
+    public:
+        Shard(ShardedRuntime& runtime, uint16_t index, int core) noexcept
+            : reactor{runtime.config_.reactor}
+            , wheel{std::chrono::milliseconds{runtime.config_.tick_interval_ms}}
+            , runtime_{runtime}, index_{index}, core_{core} {}
+
+        // ShardContext
+        bool post(ShardSessionRef to, const ShardMessage& msg) noexcept override {
+            return runtime_.route(index_, to, msg);
+        }
+        [[nodiscard]] uint16_t index() const noexcept override { return index_; }
+        [[nodiscard]] int core() const noexcept override { return core_; }
+
+        /// Deliver everything in every inbox
+        void on_notified() noexcept override {
+            ShardMessage msg;
+            for (auto& inbox : inboxes) {
+                while (inbox->try_pop(msg)) deliver(msg);
+            }
+        }
+
+        /// Thread body: build shard-local state, then run until stopped
+        void main(std::latch& ready) noexcept {
+            if (runtime_.config_.pin_shards) (void)util::CpuAffinity::pin_to_core(core_);
+            if (auto result = setup(); !result) error = result.error();
+            ready.arrive_and_wait();  // Every inbox exists before anyone posts
+            if (error) return;
+
+            for (auto& session : sessions) session->start();
+            run();
+
+            sessions.clear();  // Heaps and stores released on their own thread
+        }
+
+        [[nodiscard]] ShardedRuntime& runtime() noexcept { return runtime_; }
+
+        IoUringReactor reactor;
+        util::TimerWheel wheel;                          // Deadlines of every session here
+        memory::QueueNotifier notifier{memory::QueueNotifier::Mode::EventFd};
+        std::vector<std::unique_ptr<Mailbox>> inboxes;   // [producer shard], then external
+        std::vector<std::unique_ptr<SessionSpec>> specs;
+        std::vector<std::unique_ptr<ShardSession>> sessions;
+        std::thread thread;
+        std::optional<TransportError> error;
+        ShardStats stats;
+
+    private:
+        [[nodiscard]] TransportResult<void> setup() noexcept {
+            // Rings are SINGLE_ISSUER and inboxes are consumed here: build both on this thread
+            if (auto result = reactor.init(); !result) return result;
+            const size_t producers = runtime_.shards_.size() + 1;
+            inboxes.reserve(producers);
+            for (size_t i = 0; i < producers; ++i) {
+                auto inbox = std::unique_ptr<Mailbox>(new (std::nothrow) Mailbox{});
+                if (!inbox) {
+                    return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, ENOMEM}};
+                }
+                inboxes.push_back(std::move(inbox));
+            }
+            sessions.reserve(specs.size());
+            for (auto& spec : specs) sessions.push_back(std::make_unique<ShardSession>(*this, *spec));
+            return reactor.watch_notifier(notifier, *this);
+        }
+
+        /// Wake at least once per wheel tick; one clock read per loop
+        void run() noexcept {
+            const int wait = static_cast<int>(runtime_.config_.tick_interval_ms);
+            while (!runtime_.stop_.load(std::memory_order_relaxed)) {
+                (void)reactor.run_once(wait);
+                stats.timers_fired += wheel.advance(Clock::now());
+            }
+        }
+
+        void deliver(const ShardMessage& msg) noexcept {
+            if constexpr (HasOnShardMessage<App, Session>) {
+                if (msg.session < sessions.size()) {
+                    Session& session = sessions[msg.session]->session();
+                    session.handler().app.on_shard_message(session, msg);
+                    ++stats.messages_delivered;
+                    return;
+                }
+            }
+            ++stats.messages_dropped;
+        }
+
+        ShardedRuntime& runtime_;
+        uint16_t index_;
+        int core_;
+    };
+
+    // ========================================================================
+    // Routing
+    // ========================================================================
+
+    /// Push into the target's inbox for this producer and wake it
+    /// Inboxes exist from start() on; before that every post fails.
+    bool route(uint16_t from, ShardSessionRef to, const ShardMessage& msg) noexcept {
+        if (to.shard >= shards_.size()) return false;
+        Shard& target = *shards_[to.shard];
+        if (to.slot >= target.specs.size() || from >= target.inboxes.size()) return false;
+
+        ShardMessage mail = msg;
+        mail.session = to.slot;
+        mail.source_shard = from;
+        if (!target.inboxes[from]->try_push(mail)) {
+            if (from < shards_.size()) ++shards_[from]->stats.posts_failed;
+            return false;
+        }
+        target.notifier.notify();
+        return true;
+    }
+
+    [[nodiscard]] Shard* shard_for_core(int core) noexcept {
+        for (auto& shard : shards_) {
+            if (shard->core() == core) return shard.get();
+        }
+        return nullptr;
+    }
+
+    ShardedRuntimeConfig config_;
+    util::SessionCoreMapper mapper_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<bool> stop_{false};
+    bool running_{false};
+    bool started_{false};
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+}  // namespace nfx
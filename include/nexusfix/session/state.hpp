@@ -5,6 +5,9 @@
 #include <string_view>
 #include <chrono>
 
+#include "nexusfix/util/fast_timestamp.hpp"
+#include "nexusfix/session/msg_type_filter.hpp"
+
 namespace nfx {
 
 // ============================================================================
@@ -393,6 +396,13 @@ static_assert(detail::TRANSITION_TABLE[4][7] == 6);  // Active + LogoutReceived
 // Session Configuration
 // ============================================================================
 
+/// What send_app_message() does when the outbound throttle has no token
+enum class ThrottleMode : uint8_t {
+    Reject,     // Fail with SessionErrorCode::Throttled
+    Queue,      // Hold until a token accrues (cancels ahead of new orders)
+    Delay       // Spin for up to throttle_max_delay_us, then reject
+};
+
 /// Session configuration parameters
 struct SessionConfig {
     std::string_view sender_comp_id;
@@ -411,6 +421,31 @@ struct SessionConfig {
     bool validate_comp_ids{true};
     bool validate_checksum{true};
     bool persist_messages{false};
+    bool expect_fixed_header_layout{false};  // Speculative header fast path (HeaderLayoutPredictor)
+    bool backfill_body_length{false};  // Unpadded BodyLength written after the body (MessageAssembler::set_header_backfill)
+    bool validate_outbound_values{false};  // Refuse app messages whose values hold SOH or '=' (MessageAssembler::set_value_validation)
+    util::TimestampPrecision timestamp_precision{util::TimestampPrecision::Milliseconds};  // SendingTime fraction digits
+    MsgTypeFilter msg_type_filter{};  // Inbound types sequenced but neither parsed nor dispatched
+    size_t inbound_batch_messages{64};          // Batched delivery: messages per on_app_messages() call at most
+    size_t inbound_batch_bytes{64 * 1024};      // Batched delivery: bytes held before a forced delivery
+    uint32_t duplicate_window{0};   // ExecIDs / ClOrdIDs remembered to drop PossDup / PossResend repeats (0 = off)
+
+    // Outbound coalescing (see SessionManager::flush_sends)
+    bool coalesce_sends{false};               // Queue app messages until flush_sends()
+    uint32_t coalesce_window_ns{0};           // Also flush once the oldest queued message is this old (0 = off)
+    size_t coalesce_buffer_size{64 * 1024};   // Bytes queued before a forced flush
+
+    // Outbound throttle for application messages (see throttle.hpp)
+    uint32_t throttle_rate{0};                // Messages per second (0 = unthrottled)
+    uint32_t throttle_burst{1};               // Messages allowed back to back
+    ThrottleMode throttle_mode{ThrottleMode::Queue};
+    uint32_t throttle_queue_size{1024};       // Queue mode: messages held
+    uint32_t throttle_slot_size{512};         // Queue mode: largest message held
+    uint32_t throttle_max_delay_us{1000};     // Delay mode: longest spin for a token
+    bool hold_on_backpressure{false};         // Queue mode: hold non-urgent app messages while the transport drains
+
+    // Idle-session hibernation (see SessionManager::hibernate)
+    uint32_t hibernate_after_ms{0};           // No app messages either way this long: hibernate (0 = never)
 
     // CPU affinity (for latency optimization)
     int cpu_affinity_core{-1};      // Pin session thread to specific core (-1 = auto/disabled)
@@ -433,8 +468,34 @@ struct SessionStats {
     uint64_t heartbeats_received{0};
     uint64_t test_requests_sent{0};
     uint64_t resend_requests_sent{0};
+    uint64_t messages_resent{0};     // Replays and gap fills
+    uint64_t gap_fills_sent{0};
     uint64_t sequence_resets{0};
     uint64_t reconnect_count{0};
+    uint64_t send_batches{0};        // Coalesced flushes (see coalesce_sends)
+
+    // Outbound throttle (see throttle_rate)
+    uint64_t throttle_rejects{0};    // Refused: Reject mode, queue full, Delay past its limit
+    uint64_t throttle_queued{0};     // Held in the throttle queue
+    uint64_t throttle_delayed{0};    // Sent after a Delay-mode spin
+    uint64_t throttle_dropped{0};    // Queued messages discarded on disconnect
+    uint32_t throttle_queue_depth{0};
+    uint32_t throttle_queue_peak{0};
+    bool throttled{false};           // Out of tokens at the last send or release
+
+    // Transport send queue (see send_backpressure.hpp)
+    uint64_t backpressure_episodes{0};  // Clear -> Draining changes
+    uint64_t backpressure_held{0};      // Queued by hold_on_backpressure
+    bool backpressured{false};          // Transport Draining now
+
+    uint64_t risk_rejects{0};        // Orders refused by the handler's pre-trade check
+    uint64_t invalid_values{0};      // App messages refused for SOH / '=' in a value (validate_outbound_values)
+    uint64_t budget_rejects{0};      // App messages refused over the hard memory limit (memory_budget.hpp)
+    uint64_t messages_filtered{0};   // Inbound messages of an ignored MsgType (msg_type_filter)
+    uint64_t duplicates_dropped{0};  // PossDup / PossResend messages already seen (duplicate_window)
+    uint64_t messages_forwarded{0};  // Sent by forward_message() (see header_rewrite.hpp)
+    uint64_t hibernations{0};        // Buffers released while idle (hibernate_after_ms)
+    uint64_t wakeups{0};             // Rehydrated by traffic or a send
 
     using TimePoint = std::chrono::steady_clock::time_point;
     TimePoint session_start;
@@ -452,8 +513,29 @@ struct SessionStats {
         heartbeats_received = 0;
         test_requests_sent = 0;
         resend_requests_sent = 0;
+        messages_resent = 0;
+        gap_fills_sent = 0;
         sequence_resets = 0;
         reconnect_count = 0;
+        send_batches = 0;
+        throttle_rejects = 0;
+        throttle_queued = 0;
+        throttle_delayed = 0;
+        throttle_dropped = 0;
+        throttle_queue_depth = 0;
+        throttle_queue_peak = 0;
+        throttled = false;
+        backpressure_episodes = 0;
+        backpressure_held = 0;
+        backpressured = false;
+        risk_rejects = 0;
+        invalid_values = 0;
+        budget_rejects = 0;
+        messages_filtered = 0;
+        duplicates_dropped = 0;
+        messages_forwarded = 0;
+        hibernations = 0;
+        wakeups = 0;
     }
 };
 
@@ -0,0 +1,255 @@
+/*
+    NexusFIX Submission Gateway
+
+    Several strategy threads sending on one session. SessionManager and
+    SequenceManager belong to the session thread; wrapping them in a mutex
+    puts every strategy behind every other one and behind the socket.
+
+    The gateway moves the work to where it belongs instead:
+
+        strategy threads                          session thread
+        Producer::submit(builder)                 drain(session) per loop
+          serialize (own assembler,                 pre-trade check
+            MsgSeqNum 0)                            restamp 34 / 52 / 60
+          claim + copy into MPSCQueue  ------->     send_prebuilt(): one batch,
+                                                      one coalesced write
+
+    A producer serializes the whole message on its own thread with its own
+    MessageAssembler and takes one slot of a lock-free MPSCQueue (a CAS on
+    the head, no lock). The session thread reads the published slots in
+    place, runs the handler's pre_trade_check() on each order's fields
+    (captured at submit), and hands the batch to send_prebuilt(), which
+    assigns MsgSeqNums, stamps SendingTime and writes it as one batch,
+    taking throttle tokens as send_app_message() would.
+
+    Submissions wait in the queue while the session cannot send
+    application messages; submit() fails when the queue is full. Only the
+    submissions send_prebuilt() took leave the queue: the rest (no throttle
+    token in Reject mode, throttle queue full, a failed flush) stay for
+    the next drain(), their pre-trade exposure given back through the
+    handler's pre_trade_release() and checked again then.
+
+    Usage:
+        SubmissionGateway<> gateway{session_config};
+        // strategy thread
+        SubmissionGateway<>::Producer producer{gateway};
+        if (!producer.submit(order)) ...   // full: back off
+        // session thread, once per loop iteration
+        gateway.drain(session);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/memory/mpsc_queue.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/session/session_handler.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/types/field_types.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Submission Gateway
+// ============================================================================
+
+struct SubmissionProducerStats {
+    uint64_t submitted{0};
+    uint64_t queue_full{0};
+    uint64_t too_large{0};     // Message over MaxMessageSize or symbol over MAX_SYMBOL_SIZE
+};
+
+struct SubmissionGatewayStats {
+    uint64_t drained{0};       // Submissions taken off the queue
+    uint64_t accepted{0};      // Sequenced or queued by the throttle
+    uint64_t risk_rejects{0};
+    uint64_t dropped{0};       // Taken but never sendable (larger than the session's batch arena)
+    uint64_t deferred{0};      // Left in the queue by a drain() the session stopped short
+    uint64_t batches{0};
+};
+
+/// Lock-free multi-producer submission into a single-threaded session
+/// @tparam Capacity Queue slots (power of 2)
+/// @tparam MaxMessageSize Largest serialized message a slot holds
+template <size_t Capacity = 1024, size_t MaxMessageSize = 448>
+class SubmissionGateway {
+public:
+    static constexpr size_t MAX_SYMBOL_SIZE = 24;
+    static constexpr size_t MAX_BATCH = 64;   // Submissions per drain()
+
+    /// One serialized message and the order fields its pre-trade check needs
+    struct Submission {
+        uint32_t size{0};
+        bool has_order{false};
+        bool booked{false};        // Passed pre_trade_check() on an earlier drain() (no release hook)
+        uint8_t symbol_size{0};
+        Side side{Side::Buy};
+        OrdType ord_type{OrdType::Limit};
+        Qty order_qty{};
+        FixedPrice price{};
+        std::array<char, MAX_SYMBOL_SIZE> symbol{};
+        std::array<char, MaxMessageSize> bytes{};
+
+        [[nodiscard]] std::span<const char> message() const noexcept { return {bytes.data(), size}; }
+        [[nodiscard]] OrderFields order_fields() const noexcept {
+            return OrderFields{{symbol.data(), symbol_size}, side, order_qty, price, ord_type};
+        }
+    };
+
+    using Queue = memory::MPSCQueue<Submission, Capacity>;
+
+    /// Submits from one strategy thread (one Producer per thread)
+    class Producer {
+    public:
+        explicit Producer(SubmissionGateway& gateway) noexcept : gateway_{&gateway} {
+            const SessionConfig& session = gateway.session_;
+            (void)assembler_.set_session_header(session.begin_string, session.sender_comp_id,
+                                                session.target_comp_id);
+        }
+
+        Producer(const Producer&) = delete;
+        Producer& operator=(const Producer&) = delete;
+
+        /// Serialize builder's message and queue it for the session thread
+        /// The CompIDs are set here; MsgSeqNum and SendingTime when sent.
+        /// @return false if the queue is full or the message does not fit a slot
+        template <typename MsgBuilder>
+        bool submit(MsgBuilder& builder) noexcept {
+            const SessionConfig& session = gateway_->session_;
+            auto msg = builder
+                .sender_comp_id(session.sender_comp_id)
+                .target_comp_id(session.target_comp_id)
+                .msg_seq_num(0)
+                .sending_time(PLACEHOLDER_TIME)
+                .build(assembler_);
+
+            OrderFields order{};
+            if constexpr (HasOrderFields<MsgBuilder>) order = builder.order_fields();
+            if (msg.size() > MaxMessageSize || order.symbol.size() > MAX_SYMBOL_SIZE) [[unlikely]] {
+                ++stats_.too_large;
+                return false;
+            }
+
+            auto claim = gateway_->queue_->try_claim();
+            if (!claim) [[unlikely]] {
+                ++stats_.queue_full;
+                return false;
+            }
+            Submission& slot = *claim;
+            std::memcpy(slot.bytes.data(), msg.data(), msg.size());
+            slot.size = static_cast<uint32_t>(msg.size());
+            slot.has_order = HasOrderFields<MsgBuilder>;
+            slot.booked = false;
+            if constexpr (HasOrderFields<MsgBuilder>) {
+                std::memcpy(slot.symbol.data(), order.symbol.data(), order.symbol.size());
+                slot.symbol_size = static_cast<uint8_t>(order.symbol.size());
+                slot.side = order.side;
+                slot.ord_type = order.ord_type;
+                slot.order_qty = order.order_qty;
+                slot.price = order.price;
+            }
+            gateway_->queue_->commit(claim);
+            ++stats_.submitted;
+            return true;
+        }
+
+        [[nodiscard]] const SubmissionProducerStats& stats() const noexcept { return stats_; }
+
+    private:
+        // Replaced on send; any width restamps
+        static constexpr std::string_view PLACEHOLDER_TIME{"00000000-00:00:00.000"};
+
+        SubmissionGateway* gateway_;
+        MessageAssembler assembler_;
+        SubmissionProducerStats stats_;
+    };
+
+    /// @param session Config of the session drained into (CompIDs, BeginString);
+    ///        its strings must outlive the gateway
+    explicit SubmissionGateway(const SessionConfig& session)
+        : session_{session}
+        , queue_{std::make_unique<Queue>()} {}
+
+    SubmissionGateway(const SubmissionGateway&) = delete;
+    SubmissionGateway& operator=(const SubmissionGateway&) = delete;
+
+    /// Send up to max_count submissions through session (session thread only)
+    /// Orders failing the handler's pre_trade_check() are dropped
+    /// (risk_rejects); the rest go to send_prebuilt() as one batch. Those
+    /// it did not take stay queued (deferred), with their exposure given
+    /// back to pre_trade_release(); a handler without one keeps it booked
+    /// and the order is not checked again.
+    /// Nothing is taken while the session cannot send application messages.
+    /// @return Messages sequenced or queued by the session's throttle
+    template <typename Session>
+    size_t drain(Session& session, size_t max_count = MAX_BATCH) noexcept {
+        if (!can_send_app_messages(session.state())) return 0;
+        const size_t count = queue_->readable(std::min(max_count, MAX_BATCH));
+        if (count == 0) return 0;
+
+        using Handler = std::remove_reference_t<decltype(session.handler())>;
+        std::array<bool, MAX_BATCH> risk_rejected{};
+        size_t batched = 0;
+        for (size_t i = 0; i < count; ++i) {
+            Submission& submission = queue_->peek(i);
+            if constexpr (HasPreTradeRisk<Handler>) {
+                if (submission.has_order && !submission.booked &&
+                    !session.handler().pre_trade_check(submission.order_fields())) [[unlikely]] {
+                    risk_rejected[i] = true;
+                    continue;
+                }
+            }
+            batch_[batched] = submission.message();
+            batch_index_[batched++] = static_cast<uint32_t>(i);
+        }
+
+        const auto sent = session.send_prebuilt(
+            std::span<const std::span<const char>>{batch_.data(), batched}, true);
+
+        // The queue gives back its front only: everything from the first
+        // submission not taken waits for the next drain()
+        const size_t consumed = sent.taken == batched ? count : batch_index_[sent.taken];
+        if constexpr (HasPreTradeRisk<Handler>) {
+            for (size_t b = sent.taken; b < batched; ++b) {
+                Submission& submission = queue_->peek(batch_index_[b]);
+                if (!submission.has_order) continue;
+                if constexpr (HasPreTradeRelease<Handler>) {
+                    session.handler().pre_trade_release(submission.order_fields());
+                    submission.booked = false;
+                } else {
+                    submission.booked = true;
+                }
+            }
+            for (size_t i = 0; i < consumed; ++i) stats_.risk_rejects += risk_rejected[i];
+        }
+        queue_->release(consumed);
+        stats_.drained += consumed;
+        stats_.accepted += sent.accepted;
+        stats_.dropped += sent.taken - sent.accepted;
+        stats_.deferred += count - consumed;
+        ++stats_.batches;
+        return sent.accepted;
+    }
+
+    /// Submissions waiting (approximate; any thread)
+    [[nodiscard]] size_t pending() const noexcept { return queue_->size_approx(); }
+    [[nodiscard]] const SubmissionGatewayStats& stats() const noexcept { return stats_; }
+
+private:
+    SessionConfig session_;
+    std::unique_ptr<Queue> queue_;
+    std::array<std::span<const char>, MAX_BATCH> batch_{};
+    std::array<uint32_t, MAX_BATCH> batch_index_{};   // Queue position of each batch_ entry
+    SubmissionGatewayStats stats_;
+};
+
+} // namespace nfx
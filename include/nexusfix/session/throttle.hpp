@@ -0,0 +1,313 @@
+/*
+    NexusFIX Outbound Throttle
+
+    Keeps a session under a venue's message-rate limit (e.g. 500 msg/s).
+    Application messages take a token from a util::TokenBucket before they
+    are sequenced; what happens without one is SessionConfig::throttle_mode:
+
+        Reject   send_app_message() fails with SessionErrorCode::Throttled
+        Queue    the message waits here and goes out as tokens accrue
+        Delay    the caller spins on the rdtsc clock for up to
+                 throttle_max_delay_us, then falls back to Reject
+
+    Queued messages are serialized at once (the builder's string_views do
+    not outlive the call) with a placeholder MsgSeqNum, and restamped with
+    their real MsgSeqNum and SendingTime when released, so nothing is
+    sequenced - or stored for resend - before it can go on the wire. That
+    is what lets cancels jump the line: OrderCancelRequest (F) and
+    OrderMassCancelRequest (q) sit in a priority lane drained before the
+    queued new orders.
+
+    The queue is a fixed pool of slots allocated once: pushing and
+    releasing copy bytes and move slot indices, nothing else. Queued
+    messages are released on the next send, on_timer_tick() or timer
+    wheel tick, so the burst should cover one tick's worth of rate.
+
+        push(D1) push(D2) push(F)   ->  release order: F, D1, D2
+
+    Usage:
+        OutboundThrottle throttle{{.rate_per_second = 500, .burst = 20}};
+        if (!throttle.try_acquire(now_ns)) throttle.push(msg, is_cancel_message(msg));
+        ...
+        while (!throttle.empty() && throttle.try_acquire(now_ns)) {
+            size_t n = restamp_queued(throttle.front(), seq, now, out);
+            throttle.pop();
+        }
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+#include "nexusfix/session/resend.hpp"
+#include "nexusfix/util/token_bucket.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Cancel Classification
+// ============================================================================
+
+/// True for messages that bypass queued orders (OrderCancelRequest, mass cancel)
+[[nodiscard]] inline bool is_cancel_message(std::span<const char> msg) noexcept {
+    const std::string_view type = stored_msg_type(msg);
+    return type == "F" || type == "q";
+}
+
+// ============================================================================
+// Sequence Restamping
+// ============================================================================
+
+/// Output bytes needed to restamp a queued message of queued_size
+[[nodiscard]] constexpr size_t restamp_capacity(size_t queued_size, size_t new_time_len) noexcept {
+    // Up to 10 seqnum digits and one extra length digit over the placeholder
+    return queued_size + new_time_len + 11;
+}
+
+/// Copy a queued message into out with its MsgSeqNum(34) and SendingTime(52) set
+/// BodyLength and CheckSum are adjusted incrementally from the queued ones.
+/// @return Bytes written; 0 if queued lacks 8/9/34/52 and a 10= trailer or
+///         out is smaller than restamp_capacity()
+[[nodiscard]] NFX_HOT
+inline size_t restamp_queued(
+    std::span<const char> queued,
+    uint32_t seq_num,
+    std::string_view sending_time,
+    std::span<char> out) noexcept
+{
+    const std::string_view msg{queued.data(), queued.size()};
+    if (msg.size() < TRAILER_SIZE + 8 || msg[0] != '8' || msg[1] != '=' ||
+        out.size() < restamp_capacity(msg.size(), sending_time.size())) [[unlikely]] {
+        return 0;
+    }
+
+    // 8=...|9=<digits>|
+    const size_t len_start = msg.find("\x01" "9=");
+    if (len_start == std::string_view::npos) [[unlikely]] return 0;
+    const size_t digits_start = len_start + 3;
+    const size_t digits_end = msg.find('\x01', digits_start);
+    if (digits_end == std::string_view::npos || digits_end == digits_start ||
+        digits_end - digits_start > 9) [[unlikely]] {
+        return 0;
+    }
+    size_t body_length = 0;
+    for (size_t i = digits_start; i < digits_end; ++i) {
+        const unsigned digit = static_cast<unsigned char>(msg[i]) - '0';
+        if (digit > 9) [[unlikely]] return 0;
+        body_length = body_length * 10 + digit;
+    }
+
+    // |34=<seq>| ... |52=<time>| (the builders write them in this order)
+    const size_t trailer = msg.size() - TRAILER_SIZE;
+    if (msg.compare(trailer, 3, "10=") != 0 || msg.back() != '\x01') [[unlikely]] return 0;
+    const size_t seq_tag = msg.find("\x01" "34=", digits_end);
+    if (seq_tag == std::string_view::npos || seq_tag > trailer) [[unlikely]] return 0;
+    const size_t seq_start = seq_tag + 4;
+    const size_t seq_end = msg.find('\x01', seq_start);
+    const size_t time_tag = msg.find("\x01" "52=", seq_end);
+    if (time_tag == std::string_view::npos || time_tag > trailer) [[unlikely]] return 0;
+    const size_t time_start = time_tag + 4;
+    const size_t time_end = msg.find('\x01', time_start);
+    if (time_end == std::string_view::npos || time_end > trailer) [[unlikely]] return 0;
+
+    auto to_digits = [](size_t value, char (&buf)[16], size_t width = 1) noexcept {
+        size_t n = 0;
+        do {
+            buf[15 - n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0 || n < width);
+        return std::string_view{buf + 16 - n, n};
+    };
+
+    const std::string_view old_seq = msg.substr(seq_start, seq_end - seq_start);
+    const std::string_view old_time = msg.substr(time_start, time_end - time_start);
+    const std::string_view old_digits = msg.substr(digits_start, digits_end - digits_start);
+
+    char seq_buf[16];
+    const std::string_view new_seq = to_digits(seq_num, seq_buf);
+    char len_buf[16];  // Keeps the assembler's zero-padded width
+    const std::string_view new_digits = to_digits(
+        body_length + new_seq.size() + sending_time.size() - old_seq.size() - old_time.size(),
+        len_buf, old_digits.size());
+
+    char* p = out.data();
+    auto put = [&p](std::string_view bytes) noexcept {
+        std::memcpy(p, bytes.data(), bytes.size());
+        p += bytes.size();
+    };
+    put(msg.substr(0, digits_start));
+    put(new_digits);
+    put(msg.substr(digits_end, seq_start - digits_end));
+    put(new_seq);
+    put(msg.substr(seq_end, time_start - seq_end));
+    put(sending_time);
+    put(msg.substr(time_end, trailer + 3 - time_end));  // ... through "10="
+
+    parser::IncrementalChecksum sum{parser::parse_checksum(msg.data() + trailer + 3)};
+    sum.replace(old_digits, new_digits);
+    sum.replace(old_seq, new_seq);
+    sum.replace(old_time, sending_time);
+    parser::format_checksum(sum.finalize(), p);
+    p[3] = '\x01';
+    p += 4;
+
+    return static_cast<size_t>(p - out.data());
+}
+
+/// Overwrite TransactTime(60) in place when the new time has its width
+/// (the builder was given a time at the session's precision)
+/// @return false (message unchanged) if 60 is absent or of another width
+inline bool restamp_transact_time(std::span<char> msg, std::string_view transact_time) noexcept {
+    const std::string_view view{msg.data(), msg.size()};
+    const size_t tag = view.find("\x01" "60=");
+    if (tag == std::string_view::npos) return false;
+    const size_t start = tag + 4;
+    const size_t end = view.find('\x01', start);
+    if (end == std::string_view::npos || end - start != transact_time.size()) return false;
+    return parser::patch_field(msg, start, transact_time);
+}
+
+// ============================================================================
+// Outbound Throttle
+// ============================================================================
+
+/// Token bucket plus a two-lane queue of serialized messages
+/// Slots are allocated once by the constructor; push() fails when the
+/// pool is exhausted or the message exceeds slot_size.
+class OutboundThrottle {
+public:
+    struct Config {
+        uint32_t rate_per_second{1};   // Sustained messages per second
+        uint32_t burst{1};             // Messages allowed back to back
+        size_t queue_capacity{1024};   // Messages held across both lanes
+        size_t slot_size{512};         // Largest queued message
+    };
+
+    explicit OutboundThrottle(const Config& config)
+        : bucket_{config.rate_per_second, config.burst}
+        , slot_size_{config.slot_size}
+        , capacity_{config.queue_capacity}
+        , storage_(config.queue_capacity * config.slot_size)
+        , lengths_(config.queue_capacity)
+        , booked_(config.queue_capacity)
+        , free_(config.queue_capacity)
+        , lanes_{Lane(config.queue_capacity), Lane(config.queue_capacity)}
+        , scratch_(restamp_capacity(config.slot_size, 32)) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            free_[i] = static_cast<uint32_t>(capacity_ - 1 - i);
+        }
+        free_count_ = capacity_;
+    }
+
+    OutboundThrottle(const OutboundThrottle&) = delete;
+    OutboundThrottle& operator=(const OutboundThrottle&) = delete;
+
+    // ========================================================================
+    // Tokens
+    // ========================================================================
+
+    [[nodiscard]] bool try_acquire(uint64_t now_ns) noexcept { return bucket_.try_acquire(now_ns); }
+    [[nodiscard]] uint64_t next_available(uint64_t now_ns) const noexcept {
+        return bucket_.next_available(now_ns);
+    }
+    [[nodiscard]] uint64_t available(uint64_t now_ns) const noexcept {
+        return bucket_.available(now_ns);
+    }
+
+    // ========================================================================
+    // Queue
+    // ========================================================================
+
+    /// Copy msg into a free slot of the priority or normal lane
+    /// @param booked An order a pre-trade stage counted as open (front_booked())
+    /// @return false if every slot is taken or msg exceeds slot_size
+    bool push(std::span<const char> msg, bool priority, bool booked = false) noexcept {
+        if (free_count_ == 0 || msg.size() > slot_size_) [[unlikely]] return false;
+        const uint32_t slot = free_[--free_count_];
+        std::memcpy(storage_.data() + size_t{slot} * slot_size_, msg.data(), msg.size());
+        lengths_[slot] = static_cast<uint32_t>(msg.size());
+        booked_[slot] = booked;
+        lanes_[priority ? 0 : 1].push(slot);
+        return true;
+    }
+
+    /// Oldest priority message, else oldest normal one (queue not empty)
+    [[nodiscard]] std::span<const char> front() const noexcept {
+        const uint32_t slot = lanes_[lanes_[0].empty() ? 1 : 0].front();
+        return {storage_.data() + size_t{slot} * slot_size_, lengths_[slot]};
+    }
+
+    /// front() was pushed as booked
+    [[nodiscard]] bool front_booked() const noexcept {
+        return booked_[lanes_[lanes_[0].empty() ? 1 : 0].front()] != 0;
+    }
+
+    /// Release the message front() returned
+    void pop() noexcept {
+        free_[free_count_++] = lanes_[lanes_[0].empty() ? 1 : 0].pop();
+    }
+
+    /// Drop every queued message
+    void clear() noexcept {
+        for (auto& lane : lanes_) {
+            while (!lane.empty()) free_[free_count_++] = lane.pop();
+        }
+    }
+
+    /// A priority-lane message is queued
+    [[nodiscard]] bool priority_pending() const noexcept { return !lanes_[0].empty(); }
+
+    [[nodiscard]] size_t size() const noexcept { return capacity_ - free_count_; }
+    [[nodiscard]] bool empty() const noexcept { return free_count_ == capacity_; }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] size_t slot_size() const noexcept { return slot_size_; }
+
+    /// Buffer a released message is restamped into
+    [[nodiscard]] std::span<char> scratch() noexcept { return scratch_; }
+
+private:
+    /// FIFO of slot indices
+    class Lane {
+    public:
+        explicit Lane(size_t capacity) : slots_(capacity) {}
+
+        void push(uint32_t slot) noexcept {
+            slots_[(head_ + count_) % slots_.size()] = slot;
+            ++count_;
+        }
+        uint32_t pop() noexcept {
+            const uint32_t slot = slots_[head_];
+            head_ = (head_ + 1) % slots_.size();
+            --count_;
+            return slot;
+        }
+        [[nodiscard]] uint32_t front() const noexcept { return slots_[head_]; }
+        [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    private:
+        std::vector<uint32_t> slots_;
+        size_t head_{0};
+        size_t count_{0};
+    };
+
+    util::TokenBucket bucket_;
+    size_t slot_size_;
+    size_t capacity_;
+    std::vector<char> storage_;
+    std::vector<uint32_t> lengths_;
+    std::vector<uint8_t> booked_;
+    std::vector<uint32_t> free_;       // Stack of free slots
+    size_t free_count_{0};
+    Lane lanes_[2];                    // [0] cancels, [1] everything else
+    std::vector<char> scratch_;
+};
+
+} // namespace nfx
@@ -0,0 +1,325 @@
+/*
+    NexusFIX Audit Tap
+
+    Mirrors every message a session sends and receives to audit sinks
+    (a disk log, a drop-copy session) without doing their work on the
+    session thread. The session publishes a 32-byte descriptor per
+    message into an SPMC BroadcastRing; each sink drains the ring on a
+    thread of its own.
+
+        session thread                      sink threads
+        send:  store(seq, msg) --+
+               descriptor -------+--> [ ring ] --> AuditWriter: disk
+        recv:  copy to capture --+              --> AuditWriter: drop copy
+
+    A descriptor points at the message bytes, it does not carry them:
+    - Outbound: the record the message store just wrote (last_stored()),
+      e.g. the MmapMessageStore journal. No copy.
+    - Inbound, or outbound with no addressable store: one memcpy into the
+      tap's capture journal, a byte ring reclaimed as the slowest sink
+      moves past the descriptors pointing into it.
+
+    The ring applies backpressure to sinks, never to the session: when it
+    (or the capture journal) is full the descriptor is dropped and
+    counted, and sinks see the hole as a seqnum gap in that direction.
+
+    Bytes in the store journal stay valid until the store is reset():
+    drain the sinks first. Retransmissions (resends, gap fills) are not
+    published again; the original was.
+
+    Usage:
+        auto tap = std::make_unique<AuditTap>();
+        session.set_audit_tap(tap.get());
+
+        AuditFileSink file{"audit.bin"};
+        AuditWriter disk{*tap};
+        disk.start([&file](const AuditRecord& r) { file.write(r); });
+        ...
+        disk.stop();                // Drains what was published
+        file.flush();
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/memory/broadcast_ring.hpp"
+#include "nexusfix/platform/platform.hpp"
+
+namespace nfx::store {
+
+// ============================================================================
+// Audit Record
+// ============================================================================
+
+enum class AuditDirection : uint8_t {
+    Inbound = 'I',
+    Outbound = 'O'
+};
+
+/// Descriptor of one audited message
+struct AuditRecord {
+    const char* data{nullptr};   // Store journal or capture journal
+    uint64_t timestamp_ns{0};    // RdtscClock::now_ns() at publish
+    uint32_t length{0};
+    uint32_t seq{0};             // MsgSeqNum(34)
+    AuditDirection direction{AuditDirection::Inbound};
+    bool captured{false};        // Bytes are in the capture journal
+
+    [[nodiscard]] std::span<const char> bytes() const noexcept { return {data, length}; }
+};
+
+// ============================================================================
+// Audit Tap
+// ============================================================================
+
+/// Descriptor ring plus capture journal of one session
+/// Producer calls (publish, capture) come from the session thread only.
+/// Members are inline arrays: allocate on the heap.
+class AuditTap {
+public:
+    static constexpr size_t CAPACITY = 8192;       // Descriptors in flight
+    static constexpr size_t MAX_SINKS = 4;
+
+    using Ring = memory::BroadcastRing<AuditRecord, CAPACITY, MAX_SINKS>;
+
+    struct Stats {
+        uint64_t published{0};
+        uint64_t captured{0};        // ... of which copied to the capture journal
+        uint64_t captured_bytes{0};
+        uint64_t dropped{0};         // Ring or capture journal full
+    };
+
+    /// @param capture_bytes Capture journal size; a message larger than it
+    ///        cannot be captured
+    explicit AuditTap(size_t capture_bytes = 1 << 20)
+        : capture_(std::max<size_t>(capture_bytes, 1)) {}
+
+    AuditTap(const AuditTap&) = delete;
+    AuditTap& operator=(const AuditTap&) = delete;
+
+    // ========================================================================
+    // Producer (session thread)
+    // ========================================================================
+
+    /// Publish a message whose bytes stay put until every sink has seen it
+    /// @return false if the ring is full (descriptor dropped)
+    NFX_HOT bool publish(AuditDirection direction, uint32_t seq,
+                         std::span<const char> bytes, uint64_t timestamp_ns) noexcept {
+        auto slot = ring_.try_claim();
+        if (!slot) [[unlikely]] return drop();
+        capture_begin_[slot.position & (CAPACITY - 1)] = capture_head_;
+        *slot = AuditRecord{bytes.data(), timestamp_ns, static_cast<uint32_t>(bytes.size()),
+                            seq, direction, false};
+        ring_.commit(slot);
+        ++stats_.published;
+        return true;
+    }
+
+    /// Copy a message into the capture journal and publish it
+    /// @return false if the ring or the capture journal is full
+    NFX_HOT bool capture(AuditDirection direction, uint32_t seq,
+                         std::span<const char> bytes, uint64_t timestamp_ns) noexcept {
+        auto slot = ring_.try_claim();
+        if (!slot) [[unlikely]] return drop();
+
+        // Records are contiguous: one that would wrap starts at offset 0
+        const size_t size = capture_.size();
+        const size_t offset = capture_head_ % size;
+        const size_t pad = offset + bytes.size() > size ? size - offset : 0;
+        const uint64_t end = capture_head_ + pad + bytes.size();
+        if (end - capture_tail_ > size) {
+            capture_tail_ = reclaimed();
+            if (end - capture_tail_ > size) [[unlikely]] return drop();
+        }
+
+        capture_begin_[slot.position & (CAPACITY - 1)] = capture_head_;
+        char* dst = capture_.data() + (pad ? 0 : offset);
+        std::memcpy(dst, bytes.data(), bytes.size());
+        capture_head_ = end;
+
+        *slot = AuditRecord{dst, timestamp_ns, static_cast<uint32_t>(bytes.size()),
+                            seq, direction, true};
+        ring_.commit(slot);
+        ++stats_.published;
+        ++stats_.captured;
+        stats_.captured_bytes += bytes.size();
+        return true;
+    }
+
+    // ========================================================================
+    // Sinks (one thread per reader)
+    // ========================================================================
+
+    /// Register a sink starting at the next published message
+    /// @return Invalid reader if MAX_SINKS are registered
+    [[nodiscard]] memory::BroadcastReader subscribe() noexcept { return ring_.subscribe(); }
+
+    void unsubscribe(memory::BroadcastReader& reader) noexcept { ring_.unsubscribe(reader); }
+
+    /// Call fn(const AuditRecord&) on up to max published records
+    /// The record's bytes are valid during the call only.
+    /// @return Records consumed
+    template <typename Fn>
+    size_t drain(memory::BroadcastReader& reader, Fn&& fn, size_t max = SIZE_MAX) noexcept {
+        size_t n = 0;
+        while (n < max && ring_.try_consume(reader, fn)) ++n;
+        return n;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+    /// Records the slowest sink has yet to consume
+    [[nodiscard]] size_t backlog() const noexcept { return ring_.max_lag(); }
+
+    [[nodiscard]] size_t capture_capacity() const noexcept { return capture_.size(); }
+
+private:
+    bool drop() noexcept {
+        ++stats_.dropped;
+        return false;
+    }
+
+    /// Capture position below which no unconsumed descriptor points
+    [[nodiscard]] uint64_t reclaimed() const noexcept {
+        const size_t head = ring_.published();
+        const size_t lag = ring_.max_lag();
+        if (lag == 0) return capture_head_;
+        return capture_begin_[(head - lag) & (CAPACITY - 1)];
+    }
+
+    Ring ring_;
+    std::vector<char> capture_;
+    uint64_t capture_head_{0};     // Next byte written (monotonic)
+    uint64_t capture_tail_{0};     // Reclaimed up to here (cached)
+    std::array<uint64_t, CAPACITY> capture_begin_{};  // Capture head per descriptor
+    Stats stats_;
+};
+
+// ============================================================================
+// Audit Writer
+// ============================================================================
+
+/// Sink thread draining one AuditTap reader into a callback
+/// Subscribes at construction: records published from then on are seen.
+class AuditWriter {
+public:
+    using Callback = std::function<void(const AuditRecord&)>;
+
+    explicit AuditWriter(AuditTap& tap,
+                         std::chrono::microseconds idle_sleep = std::chrono::microseconds{50}) noexcept
+        : tap_{tap}, reader_{tap.subscribe()}, idle_sleep_{idle_sleep} {}
+
+    ~AuditWriter() {
+        stop();
+        tap_.unsubscribe(reader_);
+    }
+
+    AuditWriter(const AuditWriter&) = delete;
+    AuditWriter& operator=(const AuditWriter&) = delete;
+
+    /// Start the sink thread
+    /// @return false if already running or no sink slot was free
+    bool start(Callback callback) {
+        if (!reader_ || running_.exchange(true)) return false;
+        callback_ = std::move(callback);
+        worker_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    /// Stop the thread after draining what has been published
+    void stop() noexcept {
+        if (!running_.exchange(false)) return;
+        if (worker_.joinable()) worker_.join();
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    /// Records handed to the callback
+    [[nodiscard]] uint64_t written() const noexcept {
+        return written_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run() noexcept {
+        auto write = [this](const AuditRecord& r) { callback_(r); };
+        while (running_.load(std::memory_order_acquire)) {
+            const size_t n = tap_.drain(reader_, write, 256);
+            written_.fetch_add(n, std::memory_order_relaxed);
+            if (n == 0) std::this_thread::sleep_for(idle_sleep_);
+        }
+        written_.fetch_add(tap_.drain(reader_, write), std::memory_order_relaxed);
+    }
+
+    AuditTap& tap_;
+    memory::BroadcastReader reader_;
+    std::chrono::microseconds idle_sleep_;
+    Callback callback_;
+    std::thread worker_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> written_{0};
+};
+
+// ============================================================================
+// Audit File Sink
+// ============================================================================
+
+/// Appends records to a binary audit log (stdio-buffered)
+/// Each record: AuditFileSink::Header, then length message bytes.
+class AuditFileSink {
+public:
+    struct Header {
+        uint64_t timestamp_ns;
+        uint32_t seq;
+        uint32_t length;
+        char direction;          // 'I' / 'O'
+        char reserved[7];
+    };
+
+    static_assert(sizeof(Header) == 24);
+
+    explicit AuditFileSink(const char* path) noexcept
+        : file_{std::fopen(path, "ab")} {}
+
+    ~AuditFileSink() {
+        if (file_) std::fclose(file_);
+    }
+
+    AuditFileSink(const AuditFileSink&) = delete;
+    AuditFileSink& operator=(const AuditFileSink&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return file_ != nullptr; }
+
+    bool write(const AuditRecord& r) noexcept {
+        if (!file_) return false;
+        Header h{r.timestamp_ns, r.seq, r.length, static_cast<char>(r.direction), {}};
+        return std::fwrite(&h, sizeof(h), 1, file_) == 1 &&
+               std::fwrite(r.data, 1, r.length, file_) == r.length;
+    }
+
+    void flush() noexcept {
+        if (file_) std::fflush(file_);
+    }
+
+private:
+    std::FILE* file_;
+};
+
+} // namespace nfx::store
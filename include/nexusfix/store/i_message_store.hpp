@@ -10,13 +10,63 @@
 #pragma once
 
 #include <cstdint>
+#include <expected>
 #include <span>
 #include <optional>
 #include <vector>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/util/allocation_tracker.hpp"
+#include "nexusfix/util/sharded_counter.hpp"
+#include "nexusfix/util/working_set.hpp"
 
 namespace nfx::store {
 
+// ============================================================================
+// Store Errors (file-backed store startup)
+// ============================================================================
+
+enum class StoreErrorCode : uint8_t {
+    None = 0,
+    InvalidConfig,
+    OpenFailed,
+    ResizeFailed,
+    MapFailed,
+    Corrupt,
+    ThreadFailed,
+    IoFailed
+};
+
+struct StoreError {
+    StoreErrorCode code;
+    int system_errno;
+
+    constexpr StoreError() noexcept
+        : code{StoreErrorCode::None}, system_errno{0} {}
+
+    constexpr StoreError(StoreErrorCode c, int err = 0) noexcept
+        : code{c}, system_errno{err} {}
+
+    [[nodiscard]] constexpr std::string_view message() const noexcept {
+        switch (code) {
+            case StoreErrorCode::None:          return "No error";
+            case StoreErrorCode::InvalidConfig: return "Invalid store configuration";
+            case StoreErrorCode::OpenFailed:    return "Failed to open store file";
+            case StoreErrorCode::ResizeFailed:  return "Failed to preallocate store file";
+            case StoreErrorCode::MapFailed:     return "Failed to map store file";
+            case StoreErrorCode::Corrupt:       return "Store file header is invalid";
+            case StoreErrorCode::ThreadFailed:  return "Failed to start flusher thread";
+            case StoreErrorCode::IoFailed:      return "Store file I/O failed";
+        }
+        std::unreachable();
+    }
+};
+
+template<typename T>
+using StoreResult = std::expected<T, StoreError>;
+
 // ============================================================================
 // Message Store Interface
 // ============================================================================
@@ -37,6 +87,12 @@ public:
     [[nodiscard]] virtual bool store(uint32_t seq_num,
                                      std::span<const char> msg) noexcept = 0;
 
+    /// Bytes written by the last successful store(), in the store's own
+    /// memory (e.g. a mapped journal) and valid until reset(); empty if the
+    /// store does not keep messages at stable addresses
+    /// Call from the thread that stores.
+    [[nodiscard]] virtual std::span<const char> last_stored() const noexcept { return {}; }
+
     /// Retrieve a stored message by sequence number
     /// @param seq_num The sequence number to retrieve
     /// @return The message bytes, or empty optional if not found
@@ -44,11 +100,61 @@ public:
         retrieve(uint32_t seq_num) const noexcept = 0;
 
     /// Retrieve a range of messages for resend
+    /// Compatibility wrapper: copies every message. Prefer for_each_in_range().
     /// @param begin_seq Start sequence number (inclusive)
     /// @param end_seq End sequence number (inclusive, 0 = infinity)
     /// @return Vector of messages in order
     [[nodiscard]] virtual std::vector<std::vector<char>>
-        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept = 0;
+        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept {
+        std::vector<std::vector<char>> result;
+        for_each_in_range(begin_seq, end_seq, [&result](uint32_t, std::span<const char> msg) {
+            result.emplace_back(msg.begin(), msg.end());
+        });
+        return result;
+    }
+
+    /// Zero-copy range visitor; return false to stop
+    using RangeVisitor = bool (*)(void* ctx, uint32_t seq_num,
+                                  std::span<const char> msg) noexcept;
+
+    /// Visit stored messages in [begin_seq, end_seq] in order without copying
+    /// Views are only valid during the visitor call. The default goes
+    /// through retrieve(); stores override it to expose their own storage.
+    /// @param end_seq End sequence number (inclusive, 0 = last sent)
+    /// @return Number of messages visited
+    virtual size_t visit_range(uint32_t begin_seq, uint32_t end_seq,
+                               RangeVisitor visitor, void* ctx) const noexcept {
+        if (end_seq == 0) end_seq = get_next_sender_seq_num() - 1;
+        size_t visited = 0;
+        for (uint32_t seq = begin_seq; seq != 0 && seq <= end_seq; ++seq) {
+            if (auto msg = retrieve(seq)) {
+                ++visited;
+                if (!visitor(ctx, seq, std::span<const char>{msg->data(), msg->size()})) break;
+            }
+        }
+        return visited;
+    }
+
+    /// Visit stored messages with any callable (seq, std::span<const char>)
+    /// The callable may return bool (false stops) or void. It runs with the
+    /// store's read lock held: it must not store into the same store.
+    /// @return Number of messages visited
+    template <typename F>
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq, F&& callback) const noexcept {
+        using Callback = std::remove_reference_t<F>;
+        return visit_range(begin_seq, end_seq,
+            [](void* ctx, uint32_t seq, std::span<const char> msg) noexcept -> bool {
+                auto& fn = *static_cast<Callback*>(ctx);
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback&, uint32_t,
+                                                                  std::span<const char>>, void>) {
+                    fn(seq, msg);
+                    return true;
+                } else {
+                    return static_cast<bool>(fn(seq, msg));
+                }
+            },
+            const_cast<void*>(static_cast<const void*>(std::addressof(callback))));
+    }
 
     // ========================================================================
     // Sequence Number Persistence
@@ -79,6 +185,23 @@ public:
     /// Get the session identifier
     [[nodiscard]] virtual std::string_view session_id() const noexcept = 0;
 
+    /// Anonymous memory the store writes on the hot path, for
+    /// util::WorkingSet (file mappings are not reported)
+    /// @return Number of regions written to out
+    virtual size_t memory_regions(std::span<util::MemoryRegion> out) const noexcept {
+        (void)out;
+        return 0;
+    }
+
+    /// Give up hot-path memory while the session is idle (see
+    /// SessionManager::hibernate()); messages stay retrievable after
+    /// rehydrate(). Session thread only, with no reader on another thread.
+    /// @return Bytes released (0 if the store keeps nothing to release)
+    virtual size_t hibernate() noexcept { return 0; }
+
+    /// Restore what hibernate() released; store() does so itself
+    virtual void rehydrate() noexcept {}
+
     // ========================================================================
     // Store Statistics
     // ========================================================================
@@ -94,6 +217,38 @@ public:
     [[nodiscard]] virtual Stats stats() const noexcept = 0;
 };
 
+// ============================================================================
+// Store Counters
+// ============================================================================
+
+/// IMessageStore::Stats as sharded counters (see sharded_counter.hpp)
+/// Resend readers count retrievals from their own threads, under a shared
+/// lock or none, without racing the writer or each other.
+class StoreCounters {
+public:
+    void stored(size_t bytes) noexcept {
+        counters_.add(STORED);
+        counters_.add(BYTES_STORED, bytes);
+    }
+    void retrieved(uint64_t n = 1) noexcept { counters_.add(RETRIEVED, n); }
+    void failed() noexcept { counters_.add(FAILURES); }
+    void reset() noexcept { counters_.reset(); }
+
+    [[nodiscard]] IMessageStore::Stats snapshot() const noexcept {
+        return IMessageStore::Stats{
+            .messages_stored = counters_.value(STORED),
+            .messages_retrieved = counters_.value(RETRIEVED),
+            .bytes_stored = counters_.value(BYTES_STORED),
+            .store_failures = counters_.value(FAILURES),
+        };
+    }
+
+private:
+    enum : size_t { STORED, RETRIEVED, BYTES_STORED, FAILURES, COUNTERS };
+
+    util::ShardedCounters<COUNTERS> counters_;
+};
+
 // ============================================================================
 // Null Message Store (No-op implementation)
 // ============================================================================
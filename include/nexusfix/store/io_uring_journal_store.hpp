@@ -0,0 +1,558 @@
+/*
+    NexusFIX io_uring Journal Store
+
+    Durable outbound log without a flusher thread. store() only appends
+    a record (store/journal_format.hpp) to an in-memory block; once per
+    event-loop tick commit() hands everything appended since the last
+    durable point to io_uring as one linked chain:
+
+        WRITE(_FIXED) block k ... -> WRITE(_FIXED) block k+n -> FSYNC(DATASYNC)
+
+    Group commit: at most one chain is in flight; stores made meanwhile
+    ride the next tick's chain, so the number of fsyncs is bounded by the
+    tick rate rather than the message rate.
+
+    File layout (O_DIRECT, so every write is 4KB aligned):
+
+        block 0                       block 1
+        [header 4KB][records ... pad][records ........ pad][...
+
+    Blocks of block_size bytes map to fixed file ranges (block 0 starts
+    with the header page, written only by open() and reset()); a record never
+    crosses a block boundary. num_blocks blocks are kept in memory (and
+    registered with the ring when possible); a block is reused only after
+    its contents are durable. The page holding the durable end is simply
+    rewritten by the next commit.
+
+    Threading: single-threaded, like the session that owns it. The ring
+    may be dedicated or shared with the transport. On a shared ring the
+    owner routes CQEs to on_completion(); poll() and the blocking helpers
+    (flush(), backpressure when every block is busy) need a dedicated ring.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/transport/batch_submitter.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/journal_format.hpp"
+
+#if NFX_IO_URING_AVAILABLE
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace nfx::store {
+
+// ============================================================================
+// Journal File Header
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint64_t URING_JOURNAL_MAGIC = 0x4C4E524A55584E4EULL;  // "NNXUJRNL"
+inline constexpr uint32_t URING_JOURNAL_VERSION = 1;
+inline constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+struct UringJournalHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t epoch;
+    uint64_t block_size;
+};
+
+[[nodiscard]] constexpr uint64_t align_down(uint64_t v, uint64_t a) noexcept { return v & ~(a - 1); }
+[[nodiscard]] constexpr uint64_t align_up(uint64_t v, uint64_t a) noexcept { return (v + a - 1) & ~(a - 1); }
+
+}  // namespace detail
+
+// ============================================================================
+// io_uring Journal Store
+// ============================================================================
+
+class IoUringJournalStore final : public IMessageStore {
+public:
+    struct Config {
+        std::string session_id;
+        std::string directory{"."};
+        size_t block_size = 1024 * 1024;     // Multiple of 4KB
+        size_t num_blocks = 8;               // In-memory blocks (write window)
+        bool direct_io = true;               // O_DIRECT; buffered if unsupported
+        bool register_buffers = true;        // WRITE_FIXED when the ring allows
+        bool dedicated_ring = true;          // Store may reap CQEs itself
+    };
+
+    /// Open (or create) <directory>/<session_id>.ujournal and recover it
+    [[nodiscard]] static StoreResult<std::unique_ptr<IoUringJournalStore>>
+        open(IoUringContext& ring, Config config) noexcept
+    {
+        if (config.session_id.empty() || config.num_blocks < 2 ||
+            config.block_size < 2 * detail::DIRECT_IO_ALIGNMENT ||
+            config.block_size % detail::DIRECT_IO_ALIGNMENT != 0 ||
+            !ring.is_initialized()) {
+            return std::unexpected(StoreError{StoreErrorCode::InvalidConfig});
+        }
+
+        std::unique_ptr<IoUringJournalStore> store{
+            new (std::nothrow) IoUringJournalStore(ring, std::move(config))};
+        if (!store) return std::unexpected(StoreError{StoreErrorCode::MapFailed, ENOMEM});
+        if (auto result = store->open_files(); !result) return std::unexpected(result.error());
+        if (auto result = store->recover(); !result) return std::unexpected(result.error());
+        store->register_blocks();
+        return store;
+    }
+
+    ~IoUringJournalStore() override {
+        if (config_.dedicated_ring) {
+            (void)commit();
+            while (inflight_ && wait_one()) {}
+        }
+        if (fixed_) (void)ring_.unregister_buffers();
+        std::free(blocks_);
+        if (fd_ >= 0) ::close(fd_);
+        if (read_fd_ >= 0) ::close(read_fd_);
+    }
+
+    IoUringJournalStore(const IoUringJournalStore&) = delete;
+    IoUringJournalStore& operator=(const IoUringJournalStore&) = delete;
+
+    // ========================================================================
+    // Message Storage
+    // ========================================================================
+
+    /// Append to the current block; no syscall
+    [[nodiscard]] NFX_HOT bool store(uint32_t seq_num,
+                                     std::span<const char> msg) noexcept override {
+        NFX_NO_ALLOC_REGION("IoUringJournalStore::store");
+        const size_t span = detail::record_span(msg.size());
+        if (seq_num == 0 || msg.empty() || span > config_.block_size ||
+            (count_ != 0 && seq_num <= last_seq_)) [[unlikely]] {
+            counters_.failed();
+            return false;
+        }
+
+        const uint64_t in_block = end_ % config_.block_size;
+        if (in_block + span > config_.block_size) [[unlikely]] {
+            // Zero tail of this block, continue in the next one
+            std::memset(block_at(end_) + in_block, 0, config_.block_size - in_block);
+            end_ += config_.block_size - in_block;
+        }
+        if (end_ % config_.block_size == 0 && !acquire_block(end_ / config_.block_size)) [[unlikely]] {
+            counters_.failed();
+            return false;
+        }
+
+        detail::write_record(block_at(end_) + end_ % config_.block_size,
+                             seq_num, epoch_, msg.data(), msg.size());
+
+        if (count_ == 0) {
+            first_seq_ = seq_num;
+            offsets_.clear();
+        } else {
+            offsets_.resize(seq_num - first_seq_, NO_OFFSET);  // Skipped seqnums
+        }
+        offsets_.push_back(end_);
+        last_seq_ = seq_num;
+        ++count_;
+        end_ += span;
+
+        counters_.stored(msg.size());
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        std::optional<std::vector<char>> result;
+        (void)with_message(seq_num, [&result](std::span<const char> msg) {
+            result.emplace(msg.begin(), msg.end());
+        });
+        if (result) counters_.retrieved();
+        return result;
+    }
+
+    /// Views point into in-memory blocks, or a scratch buffer for older
+    /// records read back from the file
+    size_t visit_range(uint32_t begin_seq, uint32_t end_seq,
+                       RangeVisitor visitor, void* ctx) const noexcept override {
+        if (count_ == 0) return 0;
+        const uint32_t actual_end = (end_seq == 0 || end_seq > last_seq_) ? last_seq_ : end_seq;
+        size_t visited = 0;
+        bool more = true;
+
+        for (uint32_t seq = std::max(begin_seq, first_seq_); more && seq <= actual_end; ++seq) {
+            if (with_message(seq, [&](std::span<const char> msg) {
+                    more = visitor(ctx, seq, msg);
+                })) {
+                ++visited;
+                counters_.retrieved();
+            }
+        }
+        return visited;
+    }
+
+    // ========================================================================
+    // Group Commit
+    // ========================================================================
+
+    /// Queue and submit one write+fsync chain covering everything stored
+    /// since the durable point. Call once per event-loop tick.
+    /// @return true if a chain was submitted (false: nothing new, a chain
+    ///         is already in flight, or the SQ has no room)
+    bool commit() noexcept {
+        if (inflight_ || durable_ == end_) return false;
+
+        const uint64_t from = detail::align_down(durable_, detail::DIRECT_IO_ALIGNMENT);
+        const uint64_t to = detail::align_up(end_, detail::DIRECT_IO_ALIGNMENT);
+        const uint64_t first_block = from / config_.block_size;
+        const uint64_t last_block = (to - 1) / config_.block_size;
+        const unsigned sqes = static_cast<unsigned>(last_block - first_block + 2);
+        if (io_uring_sq_space_left(ring_.ring()) < sqes) return false;
+
+        // Whole pages (O_DIRECT); bytes past end_ are still zero from acquire
+        LinkedOperations chain{ring_};
+        for (uint64_t pos = from; pos < to;) {
+            const uint64_t block = pos / config_.block_size;
+            const uint64_t stop = std::min<uint64_t>(to, (block + 1) * config_.block_size);
+            const std::span<const char> bytes{block_at(pos) + pos % config_.block_size,
+                                              static_cast<size_t>(stop - pos)};
+            const auto index = static_cast<uint16_t>(block % config_.num_blocks);
+            (void)(fixed_ ? chain.chain_write_fixed(fd_, bytes, pos, index, &write_tag_)
+                          : chain.chain_write(fd_, bytes, pos, &write_tag_));
+            pos = stop;
+        }
+        (void)chain.chain_fsync(fd_, true, &fsync_tag_);
+
+        inflight_ = true;
+        inflight_end_ = end_;
+        inflight_epoch_ = epoch_;
+        pending_cqes_ = sqes;
+        inflight_failed_ = false;
+        ++commits_;
+        (void)chain.submit();
+        return true;
+    }
+
+    /// Handle a CQE from the ring; false if it does not belong to this store
+    bool on_completion(void* user_data, int result) noexcept {
+        if (user_data != &write_tag_ && user_data != &fsync_tag_) return false;
+        if (result < 0) inflight_failed_ = true;
+        if (--pending_cqes_ == 0) {
+            inflight_ = false;
+            if (inflight_failed_) {
+                ++write_errors_;  // Same range is retried by the next commit
+            } else if (inflight_epoch_ == epoch_) {
+                durable_ = inflight_end_;
+            }
+        }
+        return true;
+    }
+
+    /// Reap available completions (dedicated ring only)
+    /// @return Number of completions handled
+    size_t poll() noexcept {
+        size_t handled = 0;
+        struct io_uring_cqe* cqe;
+        while (ring_.peek(&cqe) == 0) {
+            if (on_completion(io_uring_cqe_get_data(cqe), cqe->res)) ++handled;
+            ring_.seen(cqe);
+        }
+        return handled;
+    }
+
+    /// Bytes stored but not yet durable
+    [[nodiscard]] uint64_t pending_bytes() const noexcept { return end_ - durable_; }
+    [[nodiscard]] bool commit_in_flight() const noexcept { return inflight_; }
+    [[nodiscard]] uint64_t commits() const noexcept { return commits_; }
+    [[nodiscard]] uint64_t write_errors() const noexcept { return write_errors_; }
+    [[nodiscard]] bool direct_io() const noexcept { return direct_; }
+    [[nodiscard]] bool fixed_buffers() const noexcept { return fixed_; }
+    [[nodiscard]] size_t message_count() const noexcept { return static_cast<size_t>(count_); }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    /// In memory; after recovery the sender seq resumes past the journal
+    void set_next_sender_seq_num(uint32_t seq) noexcept override { next_sender_seq_ = seq; }
+    void set_next_target_seq_num(uint32_t seq) noexcept override { next_target_seq_ = seq; }
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override { return next_sender_seq_; }
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override { return next_target_seq_; }
+
+    // ========================================================================
+    // Session Management
+    // ========================================================================
+
+    /// Start a new epoch: records already on disk are ignored by recovery
+    /// An in-flight chain completes harmlessly (its records carry the old epoch).
+    void reset() noexcept override {
+        ++epoch_;
+        (void)write_header();
+        end_ = durable_ = detail::DIRECT_IO_ALIGNMENT;
+        first_seq_ = last_seq_ = 0;
+        count_ = 0;
+        offsets_.clear();
+        for (auto& number : block_numbers_) number = NO_BLOCK;
+        (void)acquire_block(0);
+        next_sender_seq_ = next_target_seq_ = 1;
+        counters_.reset();
+    }
+
+    /// Commit and wait until everything stored is durable (dedicated ring)
+    /// On a shared ring this only submits the commit.
+    void flush() noexcept override {
+        if (!config_.dedicated_ring) {
+            (void)commit();
+            return;
+        }
+        while (durable_ != end_) {
+            if (!inflight_ && !commit()) {
+                (void)ring_.submit();  // Make SQ room
+            }
+            if (inflight_ && !wait_one()) return;
+            if (write_errors_ > MAX_FLUSH_RETRIES) return;
+        }
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return config_.session_id;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept override {
+        return counters_.snapshot();
+    }
+
+private:
+    static constexpr uint64_t NO_OFFSET = UINT64_MAX;
+    static constexpr uint64_t NO_BLOCK = UINT64_MAX;
+    static constexpr uint64_t MAX_FLUSH_RETRIES = 16;
+
+    IoUringJournalStore(IoUringContext& ring, Config config) noexcept
+        : ring_{ring}, config_(std::move(config)) {}
+
+    [[nodiscard]] char* block_at(uint64_t offset) const noexcept {
+        const uint64_t block = offset / config_.block_size;
+        return blocks_ + (block % config_.num_blocks) * config_.block_size;
+    }
+
+    /// Map block number onto its in-memory slot once the slot's previous
+    /// block is durable (waits for the in-flight commit if needed)
+    [[nodiscard]] bool acquire_block(uint64_t block) noexcept {
+        uint64_t& slot = block_numbers_[block % config_.num_blocks];
+        while (slot != NO_BLOCK && (slot + 1) * config_.block_size > durable_) {
+            if (!config_.dedicated_ring) return false;  // Can't reap foreign CQEs
+            if (!inflight_) (void)commit();
+            if (!inflight_ || !wait_one()) return false;
+        }
+        slot = block;
+        std::memset(block_at(block * config_.block_size), 0, config_.block_size);
+        return true;
+    }
+
+    /// Call fn(view) with the stored bytes of seq_num
+    template <typename Fn>
+    bool with_message(uint32_t seq_num, Fn&& fn) const noexcept {
+        if (count_ == 0 || seq_num < first_seq_ || seq_num > last_seq_) return false;
+        const uint64_t offset = offsets_[seq_num - first_seq_];
+        if (offset == NO_OFFSET) return false;
+
+        const uint64_t block = offset / config_.block_size;
+        const size_t available = static_cast<size_t>((block + 1) * config_.block_size - offset);
+        detail::RecordHeader header;
+
+        if (block_numbers_[block % config_.num_blocks] == block) {
+            const char* src = block_at(offset) + offset % config_.block_size;
+            if (detail::read_record(src, available, epoch_, header) == 0) return false;
+            fn(std::span<const char>{src + sizeof(header), header.size});
+            return true;
+        }
+
+        // Older block: read the record back (page cache, not O_DIRECT)
+        if (::pread(read_fd_, &header, sizeof(header), static_cast<off_t>(offset)) !=
+            static_cast<ssize_t>(sizeof(header)) || header.seq != seq_num ||
+            detail::record_span(header.size) > available) {
+            return false;
+        }
+        scratch_.resize(detail::record_span(header.size));
+        if (::pread(read_fd_, scratch_.data(), scratch_.size(), static_cast<off_t>(offset)) !=
+                static_cast<ssize_t>(scratch_.size()) ||
+            detail::read_record(scratch_.data(), scratch_.size(), epoch_, header) == 0) {
+            return false;
+        }
+        fn(std::span<const char>{scratch_.data() + sizeof(header), header.size});
+        return true;
+    }
+
+    [[nodiscard]] bool wait_one() noexcept {
+        struct io_uring_cqe* cqe;
+        if (ring_.wait(&cqe) != 0) return false;
+        (void)on_completion(io_uring_cqe_get_data(cqe), cqe->res);
+        ring_.seen(cqe);
+        return true;
+    }
+
+    // ========================================================================
+    // Files and Recovery
+    // ========================================================================
+
+    [[nodiscard]] StoreResult<void> open_files() noexcept {
+        const std::string path = config_.directory + "/" + config_.session_id + ".ujournal";
+
+        read_fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (read_fd_ < 0) return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+
+        if (config_.direct_io) {
+            fd_ = ::open(path.c_str(), O_WRONLY | O_CLOEXEC | O_DIRECT);
+            direct_ = fd_ >= 0;
+        }
+        if (fd_ < 0) fd_ = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);  // e.g. tmpfs
+        if (fd_ < 0) return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+
+        blocks_ = static_cast<char*>(std::aligned_alloc(detail::DIRECT_IO_ALIGNMENT,
+                                                        config_.num_blocks * config_.block_size));
+        if (!blocks_) return std::unexpected(StoreError{StoreErrorCode::MapFailed, ENOMEM});
+        block_numbers_.assign(config_.num_blocks, NO_BLOCK);
+        return {};
+    }
+
+    [[nodiscard]] bool write_header() noexcept {
+        alignas(detail::DIRECT_IO_ALIGNMENT) char page[detail::DIRECT_IO_ALIGNMENT]{};
+        const detail::UringJournalHeader header{detail::URING_JOURNAL_MAGIC,
+                                                detail::URING_JOURNAL_VERSION, epoch_,
+                                                config_.block_size};
+        std::memcpy(page, &header, sizeof(header));
+        return ::pwrite(read_fd_, page, sizeof(page), 0) == static_cast<ssize_t>(sizeof(page)) &&
+               ::fdatasync(read_fd_) == 0;
+    }
+
+    /// Scan the journal, rebuild the index and reload the last block
+    [[nodiscard]] StoreResult<void> recover() noexcept {
+        detail::UringJournalHeader header{};
+        const ssize_t n = ::pread(read_fd_, &header, sizeof(header), 0);
+        if (n <= 0 || header.magic == 0) {
+            epoch_ = 1;
+            if (!write_header()) return std::unexpected(StoreError{StoreErrorCode::IoFailed, errno});
+        } else if (n != static_cast<ssize_t>(sizeof(header)) ||
+                   header.magic != detail::URING_JOURNAL_MAGIC ||
+                   header.version != detail::URING_JOURNAL_VERSION ||
+                   header.block_size != config_.block_size) {
+            return std::unexpected(StoreError{StoreErrorCode::Corrupt});
+        } else {
+            epoch_ = header.epoch;
+        }
+
+        // Record scan, one block at a time; a block whose remaining bytes
+        // are all zero (the next record did not fit) continues at the
+        // following block, anything else ends the log
+        std::vector<char> buffer(config_.block_size);
+        uint64_t pos = detail::DIRECT_IO_ALIGNMENT;
+        uint64_t tail = pos;
+        uint64_t loaded = NO_BLOCK;
+        size_t loaded_size = 0;
+        for (;;) {
+            const uint64_t block = pos / config_.block_size;
+            if (block != loaded) {
+                const ssize_t got = ::pread(read_fd_, buffer.data(), buffer.size(),
+                                            static_cast<off_t>(block * config_.block_size));
+                if (got <= 0) break;
+                loaded = block;
+                loaded_size = static_cast<size_t>(got);
+            }
+            const size_t at = static_cast<size_t>(pos % config_.block_size);
+            detail::RecordHeader record;
+            if (at < loaded_size &&
+                detail::read_record(buffer.data() + at, loaded_size - at, epoch_, record) != 0 &&
+                (count_ == 0 || record.seq > last_seq_)) {
+                if (count_ == 0) first_seq_ = record.seq;
+                else offsets_.resize(record.seq - first_seq_, NO_OFFSET);
+                offsets_.push_back(pos);
+                last_seq_ = record.seq;
+                ++count_;
+                pos = tail = pos + detail::record_span(record.size);
+                continue;
+            }
+            if (at != 0 && loaded_size == config_.block_size &&
+                std::all_of(buffer.begin() + static_cast<ptrdiff_t>(at), buffer.end(),
+                            [](char c) { return c == 0; })) {
+                pos = (block + 1) * config_.block_size;
+                continue;
+            }
+            break;
+        }
+
+        // Resume appending after the last valid record
+        end_ = durable_ = tail;
+        const uint64_t block = end_ / config_.block_size;
+        block_numbers_[block % config_.num_blocks] = block;
+        char* dest = block_at(end_);
+        std::memset(dest, 0, config_.block_size);
+        const size_t keep = static_cast<size_t>(end_ % config_.block_size);
+        if (keep != 0 && ::pread(read_fd_, dest, keep,
+                                 static_cast<off_t>(block * config_.block_size)) !=
+                             static_cast<ssize_t>(keep)) {
+            return std::unexpected(StoreError{StoreErrorCode::IoFailed, errno});
+        }
+        next_sender_seq_ = last_seq_ + 1;
+        return {};
+    }
+
+    void register_blocks() noexcept {
+        if (!config_.register_buffers || ring_.has_registered_buffers()) return;
+        std::vector<struct iovec> iovecs(config_.num_blocks);
+        for (size_t i = 0; i < config_.num_blocks; ++i) {
+            iovecs[i].iov_base = blocks_ + i * config_.block_size;
+            iovecs[i].iov_len = config_.block_size;
+        }
+        fixed_ = ring_.register_buffers(iovecs.data(), static_cast<unsigned>(iovecs.size())) == 0;
+    }
+
+    IoUringContext& ring_;
+    Config config_;
+
+    int fd_{-1};                    // Writes (O_DIRECT when supported)
+    int read_fd_{-1};               // Header, recovery, read-back
+    bool direct_{false};
+    bool fixed_{false};
+    char* blocks_{nullptr};
+    std::vector<uint64_t> block_numbers_;   // Slot -> file block it holds
+
+    // Log position
+    uint64_t end_{detail::DIRECT_IO_ALIGNMENT};
+    uint64_t durable_{detail::DIRECT_IO_ALIGNMENT};
+    uint32_t epoch_{1};
+
+    // In-flight chain
+    char write_tag_{0};
+    char fsync_tag_{0};
+    bool inflight_{false};
+    bool inflight_failed_{false};
+    uint64_t inflight_end_{0};
+    uint32_t inflight_epoch_{0};
+    unsigned pending_cqes_{0};
+    uint64_t commits_{0};
+    uint64_t write_errors_{0};
+
+    // Index: (seq - first_seq_) -> file offset
+    std::vector<uint64_t> offsets_;
+    uint32_t first_seq_{0};
+    uint32_t last_seq_{0};
+    uint64_t count_{0};
+
+    uint32_t next_sender_seq_{1};
+    uint32_t next_target_seq_{1};
+
+    mutable std::vector<char> scratch_;
+    mutable StoreCounters counters_;
+};
+
+} // namespace nfx::store
+
+#endif // NFX_IO_URING_AVAILABLE
@@ -0,0 +1,79 @@
+/*
+    NexusFIX Journal Record Format
+
+    Record layout shared by the file-backed message stores:
+
+        [seq u32|size u32|epoch u32|checksum u32][message bytes][pad to 8]
+
+    The checksum covers the header fields and the message, so recovery
+    can tell a complete record from a torn write or unwritten space.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace nfx::store::detail {
+
+struct RecordHeader {
+    uint32_t seq;
+    uint32_t size;
+    uint32_t epoch;
+    uint32_t checksum;
+};
+
+static_assert(sizeof(RecordHeader) == 16);
+
+/// Journal bytes taken by a record holding size message bytes
+[[nodiscard]] constexpr size_t record_span(size_t size) noexcept {
+    return (sizeof(RecordHeader) + size + 7) & ~size_t{7};
+}
+
+/// Torn-write check: 64-bit word sum mixed with the record header fields
+[[nodiscard]] inline uint32_t record_checksum(
+    uint32_t seq, uint32_t epoch, const char* data, size_t size) noexcept
+{
+    uint64_t sum = (static_cast<uint64_t>(seq) << 32) ^ epoch ^ (size * 0x9E3779B97F4A7C15ULL);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        sum += word;
+        sum ^= sum >> 29;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + i, size - i);
+    sum += tail;
+    sum *= 0xBF58476D1CE4E5B9ULL;
+    return static_cast<uint32_t>(sum ^ (sum >> 32));
+}
+
+/// Write a complete record at dest (record_span(size) bytes, padding zeroed)
+inline void write_record(char* dest, uint32_t seq, uint32_t epoch,
+                         const char* data, size_t size) noexcept {
+    const RecordHeader header{seq, static_cast<uint32_t>(size), epoch,
+                              record_checksum(seq, epoch, data, size)};
+    std::memcpy(dest + sizeof(header), data, size);
+    const size_t pad = record_span(size) - sizeof(header) - size;
+    if (pad != 0) std::memset(dest + sizeof(header) + size, 0, pad);
+    std::memcpy(dest, &header, sizeof(header));
+}
+
+/// Validate the record at src against the bytes available after it
+/// @return Message size, or 0 if src does not hold a complete record
+[[nodiscard]] inline size_t read_record(const char* src, size_t available,
+                                        uint32_t epoch, RecordHeader& header) noexcept {
+    if (available < sizeof(RecordHeader)) return 0;
+    std::memcpy(&header, src, sizeof(header));
+    if (header.size == 0 || header.seq == 0 || header.epoch != epoch ||
+        record_span(header.size) > available ||
+        header.checksum != record_checksum(header.seq, header.epoch,
+                                           src + sizeof(header), header.size)) {
+        return 0;
+    }
+    return header.size;
+}
+
+}  // namespace nfx::store::detail
@@ -0,0 +1,245 @@
+/*
+    NexusFIX Segment Codec
+
+    LZ4-style block compression for cold message-store segments. A block
+    is a run of sequences:
+
+        [token: lit_len:4 | match_len-4:4][lit_len ext][literals]
+        [offset][match_len ext]
+
+    length nibbles of 15 continue in 255-valued extension bytes; the last
+    sequence carries literals only. Unlike LZ4 the offset is variable:
+
+        0x00            repeat the previous offset
+        0x01..0x7F      offset 1..127
+        0x80|hi, lo     offset up to 32767
+
+    Consecutive FIX messages line up field for field, so most matches
+    reuse the distance to the previous message and cost one byte. Matches
+    reach back up to 32KB, into a preset dictionary that both sides
+    prepend to the window; a dictionary of typical headers lets even the
+    first message of a segment compress.
+
+    Compression runs off the hot path (store compaction) and favours ratio
+    over speed: every position of a match is hashed. Decompression checks
+    all bounds, since segments are only as trustworthy as their memory.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nfx::store::lz {
+
+// ============================================================================
+// Limits and Dictionary
+// ============================================================================
+
+inline constexpr size_t MIN_MATCH = 4;
+inline constexpr size_t MAX_OFFSET = 32767;
+inline constexpr unsigned HASH_BITS = 14;
+inline constexpr size_t WILD_COPY = 16;       // Decoder over-copy for short runs
+
+/// Preset dictionary: common FIX 4.4 header and order/execution fields
+inline constexpr std::string_view FIX_DICTIONARY =
+    "8=FIX.4.4\x01" "9=\x01" "35=0\x01" "35=1\x01" "35=2\x01" "35=4\x01" "35=5\x01"
+    "35=A\x01" "35=F\x01" "35=G\x01" "35=9\x01" "35=j\x01" "35=W\x01" "35=X\x01"
+    "43=Y\x01" "97=Y\x01" "122=" "123=Y\x01" "36=" "1=" "6=0\x01" "14=0\x01" "15=USD\x01"
+    "17=" "21=1\x01" "22=8\x01" "31=" "32=" "37=" "41=" "58=" "59=0\x01" "59=1\x01"
+    "60=" "99=" "100=" "103=" "126=" "150=F\x01" "150=0\x01" "151=0\x01" "167=CS\x01"
+    "207=" "262=" "263=1\x01" "264=" "269=0\x01" "269=1\x01" "270=" "271="
+    "40=1\x01" "40=2\x01" "39=0\x01" "39=1\x01" "39=2\x01" "54=1\x01" "54=2\x01"
+    "44=" "38=" "55=" "11=" "10=" "35=D\x01" "35=8\x01" "49=" "56=" "34=" "52=20";
+
+/// Worst-case compressed size of n input bytes
+[[nodiscard]] constexpr size_t compress_bound(size_t n) noexcept {
+    return n + n / 255 + 16;  // Incompressible: one literal run
+}
+
+// ============================================================================
+// Compression
+// ============================================================================
+
+namespace detail {
+
+[[nodiscard]] inline uint32_t read32(const char* p) noexcept {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+[[nodiscard]] inline uint32_t hash32(uint32_t v) noexcept {
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+inline char* put_length(char* out, size_t extra) noexcept {
+    while (extra >= 255) {
+        *out++ = static_cast<char>(255);
+        extra -= 255;
+    }
+    *out++ = static_cast<char>(extra);
+    return out;
+}
+
+inline char* put_sequence(char* out, const char* literals, size_t lit_len,
+                          size_t offset, size_t match_len, size_t& last_offset) noexcept {
+    const size_t ml = match_len != 0 ? match_len - MIN_MATCH : 0;
+    *out++ = static_cast<char>(((lit_len < 15 ? lit_len : 15) << 4) | (ml < 15 ? ml : 15));
+    if (lit_len >= 15) out = put_length(out, lit_len - 15);
+    std::memcpy(out, literals, lit_len);
+    out += lit_len;
+    if (match_len == 0) return out;
+    if (offset == last_offset) {
+        *out++ = 0;
+    } else if (offset < 0x80) {
+        *out++ = static_cast<char>(offset);
+    } else {
+        *out++ = static_cast<char>(0x80 | (offset >> 8));
+        *out++ = static_cast<char>(offset & 0xFF);
+    }
+    last_offset = offset;
+    if (ml >= 15) out = put_length(out, ml - 15);
+    return out;
+}
+
+}  // namespace detail
+
+/// Compress src, with dict as preceding history, into out
+/// out must hold compress_bound(src.size()) bytes.
+/// @return Compressed size
+[[nodiscard]] inline size_t compress(std::string_view dict, std::span<const char> src,
+                                     std::span<char> out) noexcept {
+    if (out.size() < compress_bound(src.size())) return 0;
+    if (dict.size() > MAX_OFFSET) dict = dict.substr(dict.size() - MAX_OFFSET);
+
+    // Window = dict | src, so matches into the dictionary need no special case
+    std::vector<char> window(dict.size() + src.size());
+    std::memcpy(window.data(), dict.data(), dict.size());
+    std::memcpy(window.data() + dict.size(), src.data(), src.size());
+    const char* base = window.data();
+    const size_t end = window.size();
+
+    constexpr uint32_t EMPTY = UINT32_MAX;
+    std::vector<uint32_t> table(size_t{1} << HASH_BITS, EMPTY);
+    for (size_t i = 0; i + MIN_MATCH <= dict.size(); ++i) {
+        table[detail::hash32(detail::read32(base + i))] = static_cast<uint32_t>(i);
+    }
+
+    char* op = out.data();
+    size_t anchor = dict.size();
+    size_t pos = anchor;
+    size_t last_offset = 0;
+    while (pos + MIN_MATCH <= end) {
+        const uint32_t word = detail::read32(base + pos);
+        const uint32_t h = detail::hash32(word);
+        size_t cand = table[h];
+        table[h] = static_cast<uint32_t>(pos);
+
+        // Prefer the previous distance: the same field of the previous message
+        if (last_offset != 0 && last_offset <= pos &&
+            detail::read32(base + pos - last_offset) == word) {
+            cand = pos - last_offset;
+        } else if (cand == EMPTY || pos - cand > MAX_OFFSET || detail::read32(base + cand) != word) {
+            ++pos;
+            continue;
+        }
+
+        size_t len = MIN_MATCH;
+        while (pos + len < end && base[cand + len] == base[pos + len]) ++len;
+        while (pos > anchor && cand > 0 && base[pos - 1] == base[cand - 1]) {
+            --pos;
+            --cand;
+            ++len;
+        }
+
+        op = detail::put_sequence(op, base + anchor, pos - anchor, pos - cand, len, last_offset);
+        for (size_t i = pos + 1; i < pos + len && i + MIN_MATCH <= end; ++i) {
+            table[detail::hash32(detail::read32(base + i))] = static_cast<uint32_t>(i);
+        }
+        pos += len;
+        anchor = pos;
+    }
+    op = detail::put_sequence(op, base + anchor, end - anchor, 0, 0, last_offset);
+    return static_cast<size_t>(op - out.data());
+}
+
+// ============================================================================
+// Decompression
+// ============================================================================
+
+/// Decompress src into window as dict | raw_size bytes
+/// The message bytes start at window.data() + dict.size() (dictionary
+/// trimmed to MAX_OFFSET as in compress()).
+/// @return false if src is malformed or does not expand to raw_size bytes
+[[nodiscard]] inline bool decompress(std::string_view dict, std::span<const char> src,
+                                     size_t raw_size, std::vector<char>& window) noexcept {
+    if (dict.size() > MAX_OFFSET) dict = dict.substr(dict.size() - MAX_OFFSET);
+    window.resize(dict.size() + raw_size);
+    std::memcpy(window.data(), dict.data(), dict.size());
+
+    const auto* ip = reinterpret_cast<const uint8_t*>(src.data());
+    const auto* const iend = ip + src.size();
+    char* const base = window.data();
+    size_t pos = dict.size();
+    const size_t end = window.size();
+    size_t last_offset = 0;
+
+    auto get_length = [&](size_t length) noexcept -> size_t {
+        if (length != 15) return length;
+        uint8_t b;
+        do {
+            if (ip == iend) return SIZE_MAX;
+            b = *ip++;
+            length += b;
+        } while (b == 255);
+        return length;
+    };
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+        const size_t lit_len = get_length(token >> 4);
+        if (lit_len > static_cast<size_t>(iend - ip) || lit_len > end - pos) return false;
+        // Short runs dominate FIX traffic: one fixed-size copy when there is slack
+        if (lit_len <= WILD_COPY && static_cast<size_t>(iend - ip) >= WILD_COPY &&
+            end - pos >= WILD_COPY) {
+            std::memcpy(base + pos, ip, WILD_COPY);
+        } else {
+            std::memcpy(base + pos, ip, lit_len);
+        }
+        ip += lit_len;
+        pos += lit_len;
+        if (ip == iend) break;  // Last sequence: literals only
+
+        size_t offset = *ip++;
+        if (offset == 0) {
+            offset = last_offset;
+        } else if (offset & 0x80) {
+            if (ip == iend) return false;
+            offset = ((offset & 0x7F) << 8) | *ip++;
+        }
+        last_offset = offset;
+        size_t match_len = get_length(token & 0x0F);
+        if (match_len == SIZE_MAX) return false;
+        match_len += MIN_MATCH;
+        if (offset == 0 || offset > pos || match_len > end - pos) return false;
+
+        const char* from = base + pos - offset;
+        if (offset >= WILD_COPY && match_len <= WILD_COPY && end - pos >= WILD_COPY) {
+            std::memcpy(base + pos, from, WILD_COPY);
+        } else if (offset >= match_len) {
+            std::memcpy(base + pos, from, match_len);
+        } else {
+            // Overlapping: repeats the last offset bytes
+            for (size_t i = 0; i < match_len; ++i) base[pos + i] = from[i];
+        }
+        pos += match_len;
+    }
+    return pos == end;
+}
+
+}  // namespace nfx::store::lz
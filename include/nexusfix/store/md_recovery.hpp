@@ -0,0 +1,343 @@
+/*
+    NexusFIX Market Data Recovery
+
+    Per-symbol arbitration between MarketDataSnapshotFullRefresh (35=W)
+    and MarketDataIncrementalRefresh (35=X):
+
+        AwaitingSnapshot --35=W--> Live --RptSeq gap--> Recovering
+               ^                    ^                       |
+               |                    +---------35=W----------+
+            reset()                  (buffered 35=X replayed)
+
+    - Live: an incremental row is applied if its RptSeq (83) is the next
+      one, dropped if it is not newer than the book, and starts recovery
+      if rows are missing. Rows without RptSeq are dropped if their
+      MsgSeqNum is covered by the snapshot's LastMsgSeqNumProcessed (369).
+    - AwaitingSnapshot / Recovering: rows are copied into a bounded,
+      fixed-size buffer for the symbol (oldest dropped on overflow).
+    - Snapshot: the book is rebuilt, the buffered rows the snapshot does
+      not cover are replayed in order and the symbol goes Live; if the
+      buffer itself has a gap the symbol stays Recovering for the next
+      snapshot.
+
+    State is per symbol, so one symbol waiting for its snapshot never
+    holds back updates for the others. Ids come from a SymbolRegistry
+    shared with the books the handler maintains.
+
+    Handler (duck-typed):
+        void on_snapshot(SymbolId id, const MDEntryColumns<MaxEntries>& cols);
+        void on_entry(SymbolId id, const MDEntryRow& row);
+        void on_gap(SymbolId id, uint32_t expected, uint32_t received);  // optional:
+                                                   // send a snapshot request here
+
+    Usage:
+        SymbolRegistry<> symbols;
+        auto recovery = std::make_unique<MarketDataRecovery<>>(symbols);
+
+        void on_message(MsgTypeTag<'W'>, const ParsedMessage& m) noexcept { recovery->apply(m, books); }
+        void on_message(MsgTypeTag<'X'>, const ParsedMessage& m) noexcept { recovery->apply(m, books); }
+
+    Single-threaded (market data session thread).
+*/
+
+#pragma once
+
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace nfx::store {
+
+// ============================================================================
+// Recovery Types
+// ============================================================================
+
+enum class RecoveryState : uint8_t {
+    AwaitingSnapshot,   // No book yet; incrementals are buffered
+    Live,               // Incrementals applied as they arrive
+    Recovering          // Gap detected; buffering until the next snapshot
+};
+
+/// Counters across all symbols
+struct RecoveryStats {
+    uint64_t snapshots{0};        // Snapshots applied
+    uint64_t applied{0};          // Incremental rows passed to the handler live
+    uint64_t replayed{0};         // Buffered rows passed to the handler after a snapshot
+    uint64_t stale{0};            // Rows (or snapshots) older than the book, dropped
+    uint64_t buffered{0};         // Rows buffered while not Live
+    uint64_t overflowed{0};       // Buffered rows dropped because a buffer was full
+    uint64_t gaps{0};             // Live -> Recovering transitions
+};
+
+// ============================================================================
+// Market Data Recovery
+// ============================================================================
+
+/// Snapshot/incremental sequencing with per-symbol buffering
+/// @tparam MaxSymbols Symbols tracked (SymbolRegistry capacity)
+/// @tparam MaxPending Incremental rows buffered per symbol
+/// @tparam MaxEntries MDEntries decoded from one message
+template <size_t MaxSymbols = 1024, size_t MaxPending = 32, size_t MaxEntries = 256>
+class MarketDataRecovery {
+    static_assert(MaxPending > 0 && MaxPending <= UINT16_MAX, "MaxPending must fit a 16-bit count");
+
+public:
+    using Registry = SymbolRegistry<MaxSymbols>;
+    using Columns = MDEntryColumns<MaxEntries>;
+
+    /// @param symbols Registry resolving tag 55 / 48 to book ids
+    explicit MarketDataRecovery(Registry& symbols) noexcept
+        : symbols_{symbols} {}
+
+    // Non-copyable (large; holds a registry reference)
+    MarketDataRecovery(const MarketDataRecovery&) = delete;
+    MarketDataRecovery& operator=(const MarketDataRecovery&) = delete;
+
+    // ========================================================================
+    // Feed
+    // ========================================================================
+
+    /// Arbitrate a 35=W or 35=X message; other types are ignored
+    /// @return Rows / levels passed to the handler
+    template <typename Handler>
+    NFX_HOT size_t apply(const ParsedMessage& msg, Handler&& handler) noexcept {
+        switch (msg.msg_type()) {
+            case 'W': return apply_snapshot(msg, handler);
+            case 'X': return apply_incremental(msg, handler);
+            default:  return 0;
+        }
+    }
+
+    /// Rebuild a symbol from 35=W, then replay what it buffered
+    /// @return Rows passed to the handler (snapshot rows + replayed rows)
+    template <typename Handler>
+    size_t apply_snapshot(const ParsedMessage& msg, Handler&& handler) noexcept {
+        const SymbolId id = symbols_.resolve(msg);
+        if (id == INVALID_SYMBOL || id >= MaxSymbols) return 0;
+
+        const auto rpt_seq = msg.get_int(tag::RptSeq::value).value_or(0);
+        const uint32_t seq = rpt_seq > 0 && rpt_seq <= UINT32_MAX ? static_cast<uint32_t>(rpt_seq) : 0u;
+
+        // A live book already past this snapshot keeps its state
+        if (state_[id] == RecoveryState::Live && seq != 0 && seq <= last_rpt_seq_[id]) {
+            ++stats_.stale;
+            return 0;
+        }
+
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count > 0) {
+            (void)parser::decode_md_entries(msg.raw(), tag::MDEntryType::value,
+                                            static_cast<size_t>(count), columns_,
+                                            symbols_.symbol(id));
+        } else {
+            columns_.clear();
+        }
+        handler.on_snapshot(id, std::as_const(columns_));
+        ++stats_.snapshots;
+
+        const auto last_processed = msg.get_int(tag::LastMsgSeqNumProcessed::value).value_or(0);
+        last_rpt_seq_[id] = seq;
+        covered_msg_seq_[id] = last_processed > 0 && last_processed <= UINT32_MAX
+            ? static_cast<uint32_t>(last_processed) : 0u;
+        state_[id] = RecoveryState::Live;
+
+        return columns_.count + replay(id, handler);
+    }
+
+    /// Arbitrate the rows of a 35=X per symbol
+    /// @return Rows passed to the handler
+    template <typename Handler>
+    size_t apply_incremental(const ParsedMessage& msg, Handler&& handler) noexcept {
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count <= 0) return 0;
+        const size_t rows = parser::decode_md_entries(msg.raw(), tag::MDUpdateAction::value,
+                                                      static_cast<size_t>(count), columns_);
+
+        // Resolve the message's symbol dictionary once, not per row
+        std::array<SymbolId, Columns::MAX_SYMBOLS> ids;
+        symbols_.resolve(columns_, ids);
+
+        const uint32_t msg_seq = msg.msg_seq_num();
+        size_t applied = 0;
+        for (size_t r = 0; r < rows; ++r) {
+            const uint16_t s = columns_.symbol_id[r];
+            if (s == Columns::NO_SYMBOL) continue;
+            const SymbolId id = ids[s];
+            if (id == INVALID_SYMBOL || id >= MaxSymbols) continue;
+
+            const MDEntryRow row = columns_.row(r);
+            if (state_[id] != RecoveryState::Live) {
+                buffer(id, row, msg_seq);
+                continue;
+            }
+            switch (check(id, row, msg_seq)) {
+                case Verdict::Apply:
+                    handler.on_entry(id, row);
+                    ++stats_.applied;
+                    ++applied;
+                    break;
+                case Verdict::Stale:
+                    ++stats_.stale;
+                    break;
+                case Verdict::Gap:
+                    start_recovery(id, row.rpt_seq, handler);
+                    buffer(id, row, msg_seq);
+                    break;
+            }
+        }
+        return applied;
+    }
+
+    // ========================================================================
+    // Control
+    // ========================================================================
+
+    /// Buffer a Live symbol's incrementals until its next snapshot
+    /// (call when sending a snapshot request for it)
+    void request_snapshot(SymbolId id) noexcept {
+        if (id < MaxSymbols && state_[id] == RecoveryState::Live) {
+            state_[id] = RecoveryState::Recovering;
+        }
+    }
+
+    /// Buffer every Live symbol until its next snapshot (a packet lost on
+    /// the incremental feed may have carried rows for any of them)
+    void request_snapshot_all() noexcept {
+        for (size_t id = 0; id < symbols_.size() && id < MaxSymbols; ++id) {
+            request_snapshot(static_cast<SymbolId>(id));
+        }
+    }
+
+    /// Forget a symbol's book and buffer (e.g. after unsubscribe / resubscribe)
+    void reset(SymbolId id) noexcept {
+        if (id >= MaxSymbols) return;
+        state_[id] = RecoveryState::AwaitingSnapshot;
+        last_rpt_seq_[id] = 0;
+        covered_msg_seq_[id] = 0;
+        pending_head_[id] = 0;
+        pending_count_[id] = 0;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] RecoveryState state(SymbolId id) const noexcept {
+        return id < MaxSymbols ? state_[id] : RecoveryState::AwaitingSnapshot;
+    }
+
+    /// RptSeq of the last row applied to a symbol (0 if none seen)
+    [[nodiscard]] uint32_t last_rpt_seq(SymbolId id) const noexcept {
+        return id < MaxSymbols ? last_rpt_seq_[id] : 0;
+    }
+
+    /// Rows buffered for a symbol
+    [[nodiscard]] size_t pending(SymbolId id) const noexcept {
+        return id < MaxSymbols ? pending_count_[id] : 0;
+    }
+
+    /// Registered symbols that are not Live
+    [[nodiscard]] size_t recovering() const noexcept {
+        size_t n = 0;
+        for (size_t id = 0; id < symbols_.size() && id < MaxSymbols; ++id) {
+            if (state_[id] != RecoveryState::Live) ++n;
+        }
+        return n;
+    }
+
+    [[nodiscard]] const RecoveryStats& stats() const noexcept { return stats_; }
+
+    [[nodiscard]] static constexpr size_t max_pending() noexcept { return MaxPending; }
+
+private:
+    enum class Verdict : uint8_t { Apply, Stale, Gap };
+
+    struct Pending {
+        MDEntryRow row;
+        uint32_t msg_seq_num;
+    };
+
+    /// Sequence check of a row against a Live symbol (advances on Apply)
+    [[nodiscard]] Verdict check(SymbolId id, const MDEntryRow& row, uint32_t msg_seq) noexcept {
+        if (row.rpt_seq == 0) {
+            return msg_seq != 0 && msg_seq <= covered_msg_seq_[id] ? Verdict::Stale : Verdict::Apply;
+        }
+        const uint32_t last = last_rpt_seq_[id];
+        if (last != 0) {
+            if (row.rpt_seq <= last) return Verdict::Stale;
+            if (row.rpt_seq != last + 1) return Verdict::Gap;
+        }
+        last_rpt_seq_[id] = row.rpt_seq;  // First sequenced row sets the baseline
+        return Verdict::Apply;
+    }
+
+    template <typename Handler>
+    void start_recovery(SymbolId id, uint32_t received, Handler& handler) noexcept {
+        state_[id] = RecoveryState::Recovering;
+        ++stats_.gaps;
+        if constexpr (requires { handler.on_gap(id, received, received); }) {
+            handler.on_gap(id, last_rpt_seq_[id] + 1, received);
+        }
+    }
+
+    /// Append a row to a symbol's buffer, dropping the oldest when full
+    void buffer(SymbolId id, const MDEntryRow& row, uint32_t msg_seq) noexcept {
+        auto& head = pending_head_[id];
+        auto& count = pending_count_[id];
+        if (count == MaxPending) {
+            head = static_cast<uint16_t>((head + 1) % MaxPending);
+            --count;
+            ++stats_.overflowed;
+        }
+        pending_[id][(head + count) % MaxPending] = Pending{row, msg_seq};
+        ++count;
+        ++stats_.buffered;
+    }
+
+    /// Replay buffered rows in order after a snapshot; stops at a gap
+    /// @return Rows passed to the handler
+    template <typename Handler>
+    size_t replay(SymbolId id, Handler& handler) noexcept {
+        auto& head = pending_head_[id];
+        auto& count = pending_count_[id];
+        size_t replayed = 0;
+        while (count != 0) {
+            const Pending& p = pending_[id][head];
+            const Verdict v = check(id, p.row, p.msg_seq_num);
+            if (v == Verdict::Gap) {
+                start_recovery(id, p.row.rpt_seq, handler);
+                break;  // Keep the rest for the next snapshot
+            }
+            if (v == Verdict::Apply) {
+                handler.on_entry(id, p.row);
+                ++replayed;
+            } else {
+                ++stats_.stale;
+            }
+            head = static_cast<uint16_t>((head + 1) % MaxPending);
+            --count;
+        }
+        if (count == 0) head = 0;
+        stats_.replayed += replayed;
+        return replayed;
+    }
+
+    Registry& symbols_;
+
+    std::array<RecoveryState, MaxSymbols> state_{};
+    std::array<uint32_t, MaxSymbols> last_rpt_seq_{};
+    std::array<uint32_t, MaxSymbols> covered_msg_seq_{};   // Snapshot's LastMsgSeqNumProcessed
+    std::array<uint16_t, MaxSymbols> pending_head_{};
+    std::array<uint16_t, MaxSymbols> pending_count_{};
+    std::array<std::array<Pending, MaxPending>, MaxSymbols> pending_{};
+
+    RecoveryStats stats_{};
+    Columns columns_{};
+};
+
+} // namespace nfx::store
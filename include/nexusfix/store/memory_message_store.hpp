@@ -8,40 +8,60 @@
     - Scenarios where durability is not critical
 
     For production with durability requirements, use MmapMessageStore.
+
+    Outbound sequence numbers are dense and increasing, so messages live
+    in a circular log rather than a hash map:
+
+        index:  [seq - first_seq] -> {offset, size}     (ring of entries)
+        bytes:  |..head..[msg 7][msg 8][msg 9]..tail..|  (ring of bytes)
+
+    - store():      append at tail, one index write, no allocation
+    - retrieve():   one index read
+    - visit_range:  one walk over consecutive index entries
+    - eviction:     bump first_seq and head past the oldest message
+
+    A message never wraps around the end of the byte ring; the tail skips
+    to the start instead. Sequence numbers must be stored in increasing
+    order (gaps allowed).
+
+    Config::single_writer drops the mutex from the write path when only
+    the session thread stores. store() publishes the index and log window
+    through a Seqlock; other threads read versioned:
+
+        writer:  begin_write | evict, copy bytes, index entry | end_write
+        reader:  read entry (retry while odd) -> copy bytes -> re-read window,
+                 accept only if the bytes were not evicted meanwhile
+
+    In this mode lookups from other threads return copies (retrieve(),
+    visit_range() through a scratch buffer); pin() is for the writer
+    thread only.
+
+    Stats and pool metrics are readable from any thread without the lock:
+    retrieval counts are sharded per reader thread (StoreCounters), the
+    byte ring gauges are relaxed atomics only the writer stores.
+
+    hibernate() packs the live messages into one buffer of exactly their
+    size and frees the ring and index to the upstream resource (a
+    memory::HibernationPool keeps them for the next session to wake);
+    rehydrate(), or the next store(), lays them out again. Lookups see an
+    empty store in between.
 */
 
 #pragma once
 
 #include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/memory/seqlock.hpp"
 
-#include <mutex>
-#include <shared_mutex>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory_resource>
-
-// Use Abseil flat_hash_map for ~3x faster lookups (Swiss Tables with SIMD probing)
-#if defined(NFX_HAS_ABSEIL) && NFX_HAS_ABSEIL
-    #include <absl/container/flat_hash_map.h>
-    #define NFX_USE_ABSEIL_HASH_MAP 1
-#else
-    #include <unordered_map>
-    #define NFX_USE_ABSEIL_HASH_MAP 0
-#endif
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 
 namespace nfx::store {
 
-// ============================================================================
-// Hash Map Type Selection
-// ============================================================================
-
-/// Hash map type - absl::flat_hash_map when available, std::unordered_map otherwise
-template<typename K, typename V>
-#if NFX_USE_ABSEIL_HASH_MAP
-using HashMap = absl::flat_hash_map<K, V>;
-#else
-using HashMap = std::unordered_map<K, V>;
-#endif
-
 // ============================================================================
 // Memory Message Store
 // ============================================================================
@@ -52,28 +72,30 @@ public:
     /// Configuration for the memory store
     struct Config {
         std::string session_id;
-        size_t max_messages = 10000;      // Maximum messages to retain
+        size_t max_messages = 10000;      // Maximum messages (index slots) to retain
         size_t max_bytes = 100'000'000;   // 100MB max
         bool evict_oldest = true;         // Evict oldest when full
-        size_t pool_size_bytes = 64 * 1024 * 1024;  // 64MB PMR pool
-        std::pmr::memory_resource* upstream_resource = nullptr;  // Optional: mimalloc SessionHeap
+        size_t pool_size_bytes = 64 * 1024 * 1024;  // 64MB byte ring
+        std::pmr::memory_resource* upstream_resource = nullptr;  // Optional: SessionHeap, HugePageMemoryResource
+        bool single_writer = false;       // Lock-free store(); one writer thread only
     };
 
-    /// PMR pool metrics for monitoring
+    /// Byte ring metrics for monitoring
     struct PoolMetrics {
-        size_t pool_capacity{0};          // Total pool size in bytes
-        size_t bytes_allocated{0};        // Current bytes allocated from pool
+        size_t pool_capacity{0};          // Byte ring size
+        size_t bytes_allocated{0};        // Ring bytes in use (messages + wrap padding)
         size_t peak_usage{0};             // High water mark
-        size_t reset_count{0};            // Number of pool resets
+        size_t reset_count{0};            // Number of store resets
     };
 
     explicit MemoryMessageStore(Config config)
         : config_(std::move(config))
-        , pool_storage_(config_.upstream_resource ? 0 : config_.pool_size_bytes)
-        , pool_(pool_storage_.data(), pool_storage_.size(),
-                config_.upstream_resource ? config_.upstream_resource
-                                         : std::pmr::null_memory_resource())
-        , pool_metrics_{.pool_capacity = config_.pool_size_bytes} {}
+        , ring_(config_.pool_size_bytes,
+                std::pmr::polymorphic_allocator<char>{
+                    config_.upstream_resource ? config_.upstream_resource
+                                              : std::pmr::get_default_resource()})
+        , index_(index_size(), ring_.get_allocator())
+        , packed_(ring_.get_allocator()) {}
 
     explicit MemoryMessageStore(std::string_view session_id)
         : MemoryMessageStore(Config{.session_id = std::string(session_id)}) {}
@@ -84,87 +106,137 @@ public:
 
     [[nodiscard]] bool store(uint32_t seq_num,
                             std::span<const char> msg) noexcept override {
-        std::unique_lock lock(mutex_);
-
-        // Check capacity
-        if (messages_.size() >= config_.max_messages ||
-            total_bytes_ + msg.size() > config_.max_bytes) {
-            if (config_.evict_oldest && !messages_.empty()) {
-                evict_oldest_locked();
-            } else {
-                ++stats_.store_failures;
-                return false;
-            }
-        }
+        NFX_NO_ALLOC_REGION("MemoryMessageStore::store");
+        std::unique_lock lock(mutex_, std::defer_lock);
+        if (!config_.single_writer) lock.lock();
 
-        // Allocate message buffer from PMR pool (O(1), no syscall)
-        std::pmr::polymorphic_allocator<char> alloc(&pool_);
-        PmrVector pmr_msg(alloc);
-        try {
-            pmr_msg.assign(msg.begin(), msg.end());
-        } catch (const std::bad_alloc&) {
-            // Pool exhausted
-            ++stats_.store_failures;
+        if (hibernated_ && !rehydrate_locked()) [[unlikely]] {
+            counters_.failed();
+            return false;
+        }
+        if (count_ != 0 && seq_num <= last_seq_) {
+            // Duplicate, or out of order for the log
+            if (find_locked(seq_num).empty()) counters_.failed();
+            return false;
+        }
+        if (msg.empty() || msg.size() > ring_.size() || msg.size() > config_.max_bytes ||
+            msg.size() > UINT32_MAX) {
+            counters_.failed();
             return false;
         }
 
-        // Store the message
-        auto [it, inserted] = messages_.try_emplace(
-            seq_num,
-            std::move(pmr_msg)
-        );
-
-        if (inserted) {
-            total_bytes_ += msg.size();
-            ++stats_.messages_stored;
-            stats_.bytes_stored += msg.size();
-
-            // Update pool metrics
-            pool_metrics_.bytes_allocated += msg.size();
-            if (pool_metrics_.bytes_allocated > pool_metrics_.peak_usage) {
-                pool_metrics_.peak_usage = pool_metrics_.bytes_allocated;
+        // Make room: index window, message count, byte budget, ring space
+        WindowWriter publish{*this};
+        uint64_t offset = 0;
+        for (;;) {
+            offset = placement(msg.size());
+            const bool fits =
+                count_ == 0 ||
+                (seq_num - first_seq_ < index_.size() &&
+                 count_ < config_.max_messages &&
+                 total_bytes_ + msg.size() <= config_.max_bytes &&
+                 offset + msg.size() - head_ <= ring_.size());
+            if (fits) break;
+            if (!config_.evict_oldest) {
+                counters_.failed();
+                return false;
             }
+            evict_oldest_locked();
+        }
 
-            // Track min/max sequence for efficient range queries
-            if (seq_num < min_seq_) min_seq_ = seq_num;
-            if (seq_num > max_seq_) max_seq_ = seq_num;
+        if (count_ == 0) {
+            // Empty log: restart the window at this message
+            head_ = tail_;
+            offset = placement(msg.size());
+            first_seq_ = seq_num;
+        } else {
+            // Skipped seqnums (e.g. gap-filled) leave absent entries
+            for (uint32_t seq = last_seq_ + 1; seq < seq_num; ++seq) {
+                slot(seq) = Entry{};
+            }
         }
 
-        return inserted;
+        std::memcpy(ring_.data() + offset % ring_.size(), msg.data(), msg.size());
+        slot(seq_num) = Entry{offset, static_cast<uint32_t>(msg.size()), true};
+        tail_ = offset + msg.size();
+        last_seq_ = seq_num;
+        ++count_;
+        total_bytes_ += msg.size();
+
+        counters_.stored(msg.size());
+        ring_in_use(static_cast<size_t>(tail_ - head_));
+        return true;
     }
 
     [[nodiscard]] std::optional<std::vector<char>>
         retrieve(uint32_t seq_num) const noexcept override {
+        if (config_.single_writer) {
+            std::vector<char> msg;
+            if (!copy_versioned(seq_num, msg)) return std::nullopt;
+            return msg;
+        }
         std::shared_lock lock(mutex_);
 
-        auto it = messages_.find(seq_num);
-        if (it != messages_.end()) {
-            ++stats_.messages_retrieved;
-            // Copy from PMR storage to regular vector for return
-            return std::vector<char>(it->second.begin(), it->second.end());
+        if (auto msg = find_locked(seq_num); !msg.empty()) {
+            counters_.retrieved();
+            return std::vector<char>(msg.begin(), msg.end());
         }
         return std::nullopt;
     }
 
-    [[nodiscard]] std::vector<std::vector<char>>
-        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
-        std::shared_lock lock(mutex_);
+    /// Zero-copy: visitor sees the stored bytes under a shared lock
+    size_t visit_range(uint32_t begin_seq, uint32_t end_seq,
+                       RangeVisitor visitor, void* ctx) const noexcept override {
+        if (config_.single_writer) return visit_range_versioned(begin_seq, end_seq, visitor, ctx);
 
-        std::vector<std::vector<char>> result;
+        std::shared_lock lock(mutex_);
+        if (count_ == 0 || hibernated_) return 0;
 
-        // End sequence 0 means "to infinity"
-        uint32_t actual_end = (end_seq == 0) ? max_seq_ : end_seq;
+        const uint32_t actual_end = (end_seq == 0 || end_seq > last_seq_) ? last_seq_ : end_seq;
+        size_t visited = 0;
 
-        for (uint32_t seq = begin_seq; seq <= actual_end; ++seq) {
-            auto it = messages_.find(seq);
-            if (it != messages_.end()) {
-                // Copy from PMR storage to regular vector
-                result.emplace_back(it->second.begin(), it->second.end());
-                ++stats_.messages_retrieved;
+        for (uint32_t seq = std::max(begin_seq, first_seq_); seq <= actual_end; ++seq) {
+            const Entry& entry = slot(seq);
+            if (entry.present) {
+                ++visited;
+                counters_.retrieved();
+                if (!visitor(ctx, seq, view(entry))) break;
             }
+            if (seq == UINT32_MAX) break;
         }
 
-        return result;
+        return visited;
+    }
+
+    /// Stored message pinned by a held read lock
+    /// Valid until destroyed; store() and reset() on this store block (and
+    /// deadlock if called from the owning thread) while a pin is alive.
+    class PinnedMessage {
+    public:
+        PinnedMessage() noexcept = default;
+
+        [[nodiscard]] std::span<const char> data() const noexcept { return data_; }
+        [[nodiscard]] size_t size() const noexcept { return data_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return data_.empty(); }
+        [[nodiscard]] explicit operator bool() const noexcept { return !data_.empty(); }
+
+    private:
+        friend class MemoryMessageStore;
+        PinnedMessage(std::shared_lock<std::shared_mutex> lock,
+                      std::span<const char> data) noexcept
+            : lock_(std::move(lock)), data_(data) {}
+
+        std::shared_lock<std::shared_mutex> lock_;
+        std::span<const char> data_;
+    };
+
+    /// Zero-copy lookup; empty if seq_num is not stored
+    [[nodiscard]] PinnedMessage pin(uint32_t seq_num) const noexcept {
+        std::shared_lock lock(mutex_);
+        auto msg = find_locked(seq_num);
+        if (msg.empty()) return {};
+        counters_.retrieved();
+        return PinnedMessage{std::move(lock), msg};
     }
 
     // ========================================================================
@@ -192,20 +264,26 @@ public:
     // ========================================================================
 
     void reset() noexcept override {
-        std::unique_lock lock(mutex_);
-        messages_.clear();
-
-        // Release PMR pool - O(1) memory reclamation
-        pool_.release();
-        ++pool_metrics_.reset_count;
-        pool_metrics_.bytes_allocated = 0;
-
+        std::unique_lock lock(mutex_, std::defer_lock);
+        if (!config_.single_writer) lock.lock();
+        WindowWriter publish{*this};
+
+        // O(1): the log is emptied by moving its bounds, entries are
+        // overwritten as new messages arrive. Offsets keep increasing so
+        // versioned readers can tell recycled bytes apart.
+        head_ = tail_;
+        first_seq_ = 0;
+        last_seq_ = 0;
+        count_ = 0;
         total_bytes_ = 0;
-        min_seq_ = UINT32_MAX;
-        max_seq_ = 0;
+        packed_.clear();  // A hibernated store wakes up empty
+        reset_count_.store(reset_count_.load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+        bytes_allocated_.store(0, std::memory_order_relaxed);
+
         next_sender_seq_.store(1, std::memory_order_release);
         next_target_seq_.store(1, std::memory_order_release);
-        stats_ = Stats{};
+        counters_.reset();
     }
 
     void flush() noexcept override {
@@ -217,13 +295,68 @@ public:
     }
 
     [[nodiscard]] Stats stats() const noexcept override {
-        return stats_;
+        return counters_.snapshot();
+    }
+
+    /// Pack the live messages and free the ring and index
+    /// @return Bytes released, net of the packed copy (0 if already
+    ///         hibernated or the copy could not be allocated)
+    size_t hibernate() noexcept override {
+        std::unique_lock lock(mutex_, std::defer_lock);
+        if (!config_.single_writer) lock.lock();
+        if (hibernated_) return 0;
+
+        std::pmr::vector<char> packed{ring_.get_allocator()};
+        try {
+            packed.resize(total_bytes_ + count_ * sizeof(PackedHeader));
+        } catch (...) {
+            return 0;
+        }
+        size_t pos = 0;
+        for (uint32_t seq = first_seq_; count_ != 0; ++seq) {
+            if (const Entry& entry = slot(seq); entry.present) {
+                const PackedHeader header{seq, entry.size};
+                std::memcpy(packed.data() + pos, &header, sizeof(header));
+                std::memcpy(packed.data() + pos + sizeof(header), view(entry).data(), entry.size);
+                pos += sizeof(header) + entry.size;
+            }
+            if (seq == last_seq_) break;
+        }
+
+        WindowWriter publish{*this};
+        const size_t held = ring_.capacity() + index_.capacity() * sizeof(Entry);
+        std::pmr::vector<char>{ring_.get_allocator()}.swap(ring_);
+        std::pmr::vector<Entry>{index_.get_allocator()}.swap(index_);
+        packed_ = std::move(packed);
+        hibernated_ = true;
+        bytes_allocated_.store(0, std::memory_order_relaxed);
+        return held > packed_.capacity() ? held - packed_.capacity() : 0;
+    }
+
+    /// Allocate the ring and index again and restore the packed messages
+    void rehydrate() noexcept override {
+        std::unique_lock lock(mutex_, std::defer_lock);
+        if (!config_.single_writer) lock.lock();
+        (void)rehydrate_locked();
+    }
+
+    [[nodiscard]] bool hibernated() const noexcept { return hibernated_; }
+
+    /// Byte ring and index
+    size_t memory_regions(std::span<util::MemoryRegion> out) const noexcept override {
+        return util::write_regions(out, {
+            {"store.ring", const_cast<char*>(ring_.data()), ring_.size()},
+            {"store.index", const_cast<Entry*>(index_.data()), index_.size() * sizeof(Entry)}});
     }
 
-    /// Get PMR pool metrics for monitoring
+    /// Get byte ring metrics for monitoring
     [[nodiscard]] PoolMetrics pool_metrics() const noexcept {
-        std::shared_lock lock(mutex_);
-        return pool_metrics_;
+        return PoolMetrics{
+            .pool_capacity = config_.pool_size_bytes,
+            .bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed),
+            .peak_usage = peak_usage_.load(std::memory_order_relaxed),
+            .reset_count = reset_count_.load(std::memory_order_relaxed),
+        };
     }
 
     // ========================================================================
@@ -232,68 +365,234 @@ public:
 
     /// Get current message count
     [[nodiscard]] size_t message_count() const noexcept {
+        if (config_.single_writer) return static_cast<size_t>(window_.read().count);
         std::shared_lock lock(mutex_);
-        return messages_.size();
+        return count_;
     }
 
     /// Get total bytes stored
     [[nodiscard]] size_t bytes_used() const noexcept {
+        if (config_.single_writer) return static_cast<size_t>(window_.read().total_bytes);
         std::shared_lock lock(mutex_);
         return total_bytes_;
     }
 
     /// Check if a sequence number exists
     [[nodiscard]] bool contains(uint32_t seq_num) const noexcept {
+        if (config_.single_writer) return read_entry(seq_num).present;
         std::shared_lock lock(mutex_);
-        return messages_.contains(seq_num);
+        return !find_locked(seq_num).empty();
     }
 
 private:
-    /// PMR-allocated vector type for message storage
-    using PmrVector = std::pmr::vector<char>;
+    /// Index entry; offset is a logical (unwrapped) byte ring position
+    struct Entry {
+        uint64_t offset{0};
+        uint32_t size{0};
+        bool present{false};
+    };
 
-    void evict_oldest_locked() noexcept {
-        // Find and remove the oldest message (smallest sequence number)
-        if (messages_.empty()) return;
-
-        auto it = messages_.find(min_seq_);
-        if (it != messages_.end()) {
-            size_t msg_size = it->second.size();
-            total_bytes_ -= msg_size;
-            // Note: PMR monotonic buffer doesn't reclaim on erase,
-            // memory is reclaimed on pool reset()
-            messages_.erase(it);
-
-            // Update min_seq_
-            if (messages_.empty()) {
-                min_seq_ = UINT32_MAX;
-            } else {
-                // Find new minimum
-                min_seq_ = UINT32_MAX;
-                for (const auto& [seq, _] : messages_) {
-                    if (seq < min_seq_) min_seq_ = seq;
-                }
+    /// Record prefix in the packed copy of a hibernated store
+    struct PackedHeader {
+        uint32_t seq;
+        uint32_t size;
+    };
+
+    [[nodiscard]] size_t index_size() const noexcept {
+        return config_.max_messages > 0 ? config_.max_messages : 1;
+    }
+
+    /// Lay the packed messages out from the next ring start
+    /// Offsets keep increasing, so versioned readers never confuse the
+    /// new layout with bytes they saw before hibernation.
+    /// @return false if the ring or index could not be allocated
+    [[nodiscard]] bool rehydrate_locked() noexcept {
+        if (!hibernated_) return true;
+        try {
+            ring_.resize(config_.pool_size_bytes);
+            index_.resize(index_size());
+        } catch (...) {
+            std::pmr::vector<char>{ring_.get_allocator()}.swap(ring_);
+            std::pmr::vector<Entry>{index_.get_allocator()}.swap(index_);
+            return false;
+        }
+
+        WindowWriter publish{*this};
+        const uint64_t capacity = ring_.size();
+        uint64_t offset = (tail_ + capacity - 1) / capacity * capacity;
+        head_ = offset;
+        for (size_t pos = 0; pos < packed_.size();) {
+            PackedHeader header;
+            std::memcpy(&header, packed_.data() + pos, sizeof(header));
+            pos += sizeof(header);
+            std::memcpy(ring_.data() + offset % capacity, packed_.data() + pos, header.size);
+            slot(header.seq) = Entry{offset, header.size, true};
+            offset += header.size;
+            pos += header.size;
+        }
+        tail_ = offset;
+        std::pmr::vector<char>{packed_.get_allocator()}.swap(packed_);
+        hibernated_ = false;
+        ring_in_use(static_cast<size_t>(tail_ - head_));
+        return true;
+    }
+
+    [[nodiscard]] Entry& slot(uint32_t seq) noexcept {
+        return index_[seq % index_.size()];
+    }
+    [[nodiscard]] const Entry& slot(uint32_t seq) const noexcept {
+        return index_[seq % index_.size()];
+    }
+
+    [[nodiscard]] std::span<const char> view(const Entry& entry) const noexcept {
+        return {ring_.data() + entry.offset % ring_.size(), entry.size};
+    }
+
+    [[nodiscard]] std::span<const char> find_locked(uint32_t seq_num) const noexcept {
+        if (count_ == 0 || hibernated_ || seq_num < first_seq_ || seq_num > last_seq_) return {};
+        const Entry& entry = slot(seq_num);
+        return entry.present ? view(entry) : std::span<const char>{};
+    }
+
+    /// Logical offset for a message of size bytes appended at the tail
+    /// Skips to the next ring start rather than wrap a message.
+    [[nodiscard]] uint64_t placement(size_t size) const noexcept {
+        const uint64_t capacity = ring_.size();
+        const uint64_t position = tail_ % capacity;
+        return position + size > capacity ? tail_ + (capacity - position) : tail_;
+    }
+
+    // ========================================================================
+    // Single-Writer Publication
+    // ========================================================================
+
+    /// Log bounds as seen by versioned readers
+    struct Window {
+        uint64_t head{0};
+        uint32_t first_seq{0};
+        uint32_t last_seq{0};
+        uint64_t count{0};
+        uint64_t total_bytes{0};
+    };
+
+    /// Write section around a mutation of the index and ring
+    /// Readers of index entries retry until it ends; the window is
+    /// republished from the writer's bounds on exit.
+    class WindowWriter {
+    public:
+        explicit WindowWriter(MemoryMessageStore& store) noexcept : store_{store} {
+            store_.window_.begin_write();
+        }
+        ~WindowWriter() {
+            // A hibernated store has no ring to read: readers see it empty
+            store_.window_.data() = Window{store_.head_, store_.first_seq_, store_.last_seq_,
+                                           store_.hibernated_ ? 0 : store_.count_,
+                                           store_.total_bytes_};
+            store_.window_.end_write();
+        }
+        WindowWriter(const WindowWriter&) = delete;
+        WindowWriter& operator=(const WindowWriter&) = delete;
+
+    private:
+        MemoryMessageStore& store_;
+    };
+
+    /// Versioned read of the index entry for seq_num
+    [[nodiscard]] Entry read_entry(uint32_t seq_num) const noexcept {
+        return window_.read_with([this, seq_num](const Window& window) {
+            if (window.count == 0 || seq_num < window.first_seq || seq_num > window.last_seq) {
+                return Entry{};
+            }
+            return slot(seq_num);
+        });
+    }
+
+    /// Copy seq_num's bytes into out; false if absent or evicted mid-copy
+    [[nodiscard]] bool copy_versioned(uint32_t seq_num, std::vector<char>& out) const noexcept {
+        const Entry entry = read_entry(seq_num);
+        if (!entry.present) return false;
+        out.resize(entry.size);
+        std::memcpy(out.data(), view(entry).data(), entry.size);
+        // Bytes are recycled only after head moves past them
+        if (window_.read().head > entry.offset) return false;
+        counters_.retrieved();
+        return true;
+    }
+
+    size_t visit_range_versioned(uint32_t begin_seq, uint32_t end_seq,
+                                 RangeVisitor visitor, void* ctx) const noexcept {
+        const Window window = window_.read();
+        if (window.count == 0) return 0;
+
+        const uint32_t actual_end =
+            (end_seq == 0 || end_seq > window.last_seq) ? window.last_seq : end_seq;
+        std::vector<char> scratch;
+        size_t visited = 0;
+
+        for (uint32_t seq = std::max(begin_seq, window.first_seq); seq <= actual_end; ++seq) {
+            if (copy_versioned(seq, scratch)) {
+                ++visited;
+                if (!visitor(ctx, seq, scratch)) break;
             }
+            if (seq == UINT32_MAX) break;
         }
+
+        return visited;
     }
 
-    Config config_;
+    void evict_oldest_locked() noexcept {
+        if (count_ == 0) return;
 
-    // PMR pool for zero-syscall message allocation
-    std::vector<char> pool_storage_;              // Backing storage
-    std::pmr::monotonic_buffer_resource pool_;    // PMR resource
+        Entry& oldest = slot(first_seq_);
+        total_bytes_ -= oldest.size;
+        head_ = oldest.offset + oldest.size;
+        oldest = Entry{};
+        --count_;
 
-    HashMap<uint32_t, PmrVector> messages_;       // Swiss Tables when Abseil available
+        if (count_ == 0) {
+            head_ = tail_;
+            return;
+        }
+        // Advance to the next stored message; skipped seqnums hold no bytes
+        do {
+            ++first_seq_;
+        } while (!slot(first_seq_).present);
+        bytes_allocated_.store(static_cast<size_t>(tail_ - head_), std::memory_order_relaxed);
+    }
+
+    /// Publish the ring bytes in use and the high water mark (writer only)
+    void ring_in_use(size_t bytes) noexcept {
+        bytes_allocated_.store(bytes, std::memory_order_relaxed);
+        if (bytes > peak_usage_.load(std::memory_order_relaxed)) {
+            peak_usage_.store(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    Config config_;
+
+    std::pmr::vector<char> ring_;                 // Message bytes
+    std::pmr::vector<Entry> index_;               // seq % size -> entry
+    std::pmr::vector<char> packed_;               // Live messages while hibernated
+    bool hibernated_{false};                      // Ring and index released
+    uint64_t head_{0};                            // Logical start of live bytes
+    uint64_t tail_{0};                            // Logical end of live bytes
+    uint32_t first_seq_{0};                       // Oldest stored seq
+    uint32_t last_seq_{0};                        // Newest stored seq
+    size_t count_{0};
     size_t total_bytes_{0};
-    uint32_t min_seq_{UINT32_MAX};
-    uint32_t max_seq_{0};
+
+    memory::Seqlock<Window> window_;              // Published bounds (single_writer)
 
     std::atomic<uint32_t> next_sender_seq_{1};
     std::atomic<uint32_t> next_target_seq_{1};
 
     mutable std::shared_mutex mutex_;
-    mutable Stats stats_;
-    mutable PoolMetrics pool_metrics_;
+    mutable StoreCounters counters_;
+
+    // PoolMetrics gauges: stored by the writer, read by anyone
+    std::atomic<size_t> bytes_allocated_{0};
+    std::atomic<size_t> peak_usage_{0};
+    std::atomic<size_t> reset_count_{0};
 };
 
 } // namespace nfx::store
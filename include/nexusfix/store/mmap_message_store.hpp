@@ -0,0 +1,557 @@
+/*
+    NexusFIX Memory-Mapped Message Store
+
+    File-backed IMessageStore that survives restarts. Two preallocated,
+    MAP_SHARED files per session:
+
+        <dir>/<session>.journal   64-byte header, then records
+                                  (store/journal_format.hpp)
+        <dir>/<session>.index     header (persistent state), then one
+                                  uint64 journal offset per seqnum
+
+    store() is a memcpy into the journal plus one index write under the
+    lock; it never syncs. Writes reach the page cache immediately, so a
+    process crash loses nothing. A background flusher batches msync() of
+    the newly written journal and index pages every flush_interval and
+    only then advances the durable watermark in the index header.
+
+    Recovery maps both files, starts from the durable watermark and scans
+    forward over records whose epoch and checksum match, so restart cost
+    is proportional to the unsynced tail, not the session length. Index
+    entries are validated against the record they point to, so entries
+    left stale by a crash or reset() are never returned. With
+    verify_tail_checksum the tail records must also carry a valid FIX
+    CheckSum (SIMD sum, parser/simd_checksum.hpp).
+
+    POSIX only. huge_pages requests transparent huge pages for the
+    mappings (effective when the files live on tmpfs or hugetlbfs) and
+    rounds the journal to 2MB.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/store/journal_format.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+
+#if !NFX_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nfx::store {
+
+// ============================================================================
+// On-Disk Layout
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint64_t JOURNAL_MAGIC = 0x4C4E524A5846464EULL;  // "NFFXJRNL"
+inline constexpr uint64_t INDEX_MAGIC = 0x58444E4958464E4EULL;    // "NNFXINDX"
+inline constexpr uint32_t MMAP_STORE_VERSION = 1;
+inline constexpr size_t JOURNAL_DATA_START = 64;
+inline constexpr size_t INDEX_HEADER_SIZE = 4096;
+
+struct JournalHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t journal_size;
+};
+
+/// Durable watermark: state up to journal_end is known to be on disk
+struct DurableState {
+    uint64_t journal_end;
+    uint32_t first_seq;
+    uint32_t last_seq;
+    uint64_t count;
+};
+
+struct IndexHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t epoch;               // Bumped by reset(); older records are ignored
+    uint64_t journal_size;
+    uint64_t max_seq;
+    DurableState durable;
+    uint32_t next_sender_seq;
+    uint32_t next_target_seq;
+};
+
+static_assert(sizeof(IndexHeader) <= INDEX_HEADER_SIZE);
+
+[[nodiscard]] inline size_t page_size() noexcept {
+    static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Mmap Message Store
+// ============================================================================
+
+/// Persistent message store over a memory-mapped journal and index
+class MmapMessageStore final : public IMessageStore {
+public:
+    struct Config {
+        std::string session_id;
+        std::string directory{"."};
+        size_t journal_size = 256 * 1024 * 1024;    // Preallocated journal bytes
+        size_t max_seq = 4 * 1024 * 1024;           // Index capacity (seqnums)
+        bool huge_pages = false;                    // THP for the mappings
+        bool async_flush = true;                    // Background flusher thread
+        bool verify_tail_checksum = false;          // Unsynced tail needs a valid 10=
+        std::chrono::milliseconds flush_interval{10};
+    };
+
+    /// Open (or create) the store and recover its state
+    [[nodiscard]] static StoreResult<std::unique_ptr<MmapMessageStore>>
+        open(Config config) noexcept
+    {
+        if (config.session_id.empty() || config.max_seq < 2 ||
+            config.journal_size <= detail::JOURNAL_DATA_START) {
+            return std::unexpected(StoreError{StoreErrorCode::InvalidConfig});
+        }
+        if (config.huge_pages) {
+            constexpr size_t HUGE_PAGE = static_cast<size_t>(memory::HugePageSize::Huge2MB);
+            config.journal_size = (config.journal_size + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+        }
+
+        std::unique_ptr<MmapMessageStore> store{new (std::nothrow) MmapMessageStore(std::move(config))};
+        if (!store) return std::unexpected(StoreError{StoreErrorCode::MapFailed, ENOMEM});
+
+        if (auto result = store->map_files(); !result) return std::unexpected(result.error());
+        store->recover();
+
+        if (store->config_.async_flush) {
+            try {
+                store->flusher_ = std::thread([s = store.get()] { s->flush_loop(); });
+            } catch (...) {
+                return std::unexpected(StoreError{StoreErrorCode::ThreadFailed});
+            }
+        }
+        return store;
+    }
+
+    ~MmapMessageStore() override {
+        if (flusher_.joinable()) {
+            {
+                std::lock_guard lock(flush_mutex_);
+                stopping_ = true;
+            }
+            flush_cv_.notify_one();
+            flusher_.join();
+        }
+        if (journal_ && index_) flush();
+        unmap(journal_, config_.journal_size);
+        unmap(index_, index_size());
+        if (journal_fd_ >= 0) ::close(journal_fd_);
+        if (index_fd_ >= 0) ::close(index_fd_);
+    }
+
+    MmapMessageStore(const MmapMessageStore&) = delete;
+    MmapMessageStore& operator=(const MmapMessageStore&) = delete;
+
+    // ========================================================================
+    // Message Storage
+    // ========================================================================
+
+    [[nodiscard]] bool store(uint32_t seq_num,
+                            std::span<const char> msg) noexcept override {
+        NFX_NO_ALLOC_REGION("MmapMessageStore::store");
+        std::unique_lock lock(mutex_);
+
+        const size_t span = detail::record_span(msg.size());
+        if (seq_num == 0 || seq_num >= config_.max_seq || msg.empty() ||
+            (count_ != 0 && seq_num <= last_seq_) ||
+            span > config_.journal_size - journal_end_) [[unlikely]] {
+            counters_.failed();
+            return false;
+        }
+
+        detail::write_record(journal_ + journal_end_, seq_num, epoch_, msg.data(), msg.size());
+
+        offsets()[seq_num] = journal_end_;
+        journal_end_ += span;
+        if (count_ == 0) first_seq_ = seq_num;
+        last_seq_ = seq_num;
+        ++count_;
+
+        last_stored_ = {journal_ + offsets()[seq_num] + sizeof(detail::RecordHeader), msg.size()};
+        counters_.stored(msg.size());
+        return true;
+    }
+
+    /// The record just appended to the journal (stays mapped until reset())
+    [[nodiscard]] std::span<const char> last_stored() const noexcept override {
+        return last_stored_;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        std::shared_lock lock(mutex_);
+
+        if (auto msg = find_locked(seq_num); !msg.empty()) {
+            counters_.retrieved();
+            return std::vector<char>(msg.begin(), msg.end());
+        }
+        return std::nullopt;
+    }
+
+    /// Zero-copy: visitor sees the mapped journal bytes under a shared lock
+    size_t visit_range(uint32_t begin_seq, uint32_t end_seq,
+                       RangeVisitor visitor, void* ctx) const noexcept override {
+        std::shared_lock lock(mutex_);
+        if (count_ == 0) return 0;
+
+        const uint32_t actual_end = (end_seq == 0 || end_seq > last_seq_) ? last_seq_ : end_seq;
+        size_t visited = 0;
+
+        for (uint32_t seq = std::max(begin_seq, first_seq_); seq <= actual_end; ++seq) {
+            if (auto msg = find_locked(seq); !msg.empty()) {
+                ++visited;
+                counters_.retrieved();
+                if (!visitor(ctx, seq, msg)) break;
+            }
+        }
+
+        return visited;
+    }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        std::atomic_ref{header().next_sender_seq}.store(seq, std::memory_order_release);
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        std::atomic_ref{header().next_target_seq}.store(seq, std::memory_order_release);
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return std::atomic_ref{header().next_sender_seq}.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return std::atomic_ref{header().next_target_seq}.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Session Management
+    // ========================================================================
+
+    /// Empty the store: bumps the epoch so existing records are ignored
+    void reset() noexcept override {
+        {
+            std::unique_lock lock(mutex_);
+            ++epoch_;
+            journal_end_ = detail::JOURNAL_DATA_START;
+            first_seq_ = last_seq_ = 0;
+            count_ = 0;
+            last_stored_ = {};
+            synced_end_ = journal_end_;
+            synced_last_seq_ = 0;
+
+            detail::IndexHeader& h = header();
+            h.epoch = epoch_;
+            h.durable = detail::DurableState{journal_end_, 0, 0, 0};
+            h.next_sender_seq = 1;
+            h.next_target_seq = 1;
+            counters_.reset();
+        }
+        sync(index_, detail::INDEX_HEADER_SIZE);
+    }
+
+    /// Synchronously make every stored message durable
+    void flush() noexcept override {
+        std::lock_guard sync_lock(sync_mutex_);
+
+        detail::DurableState target;
+        uint64_t from;
+        uint32_t from_seq;
+        {
+            std::shared_lock lock(mutex_);
+            target = detail::DurableState{journal_end_, first_seq_, last_seq_, count_};
+            from = synced_end_;
+            from_seq = synced_last_seq_;
+        }
+
+        if (target.journal_end == from) return;  // Nothing new
+        sync(journal_ + from, target.journal_end - from);
+        sync(reinterpret_cast<char*>(offsets() + from_seq),
+             (static_cast<size_t>(target.last_seq) + 1 - from_seq) * sizeof(uint64_t));
+
+        {
+            std::unique_lock lock(mutex_);
+            if (synced_end_ != from) return;  // reset() raced
+            header().durable = target;
+            synced_end_ = target.journal_end;
+            synced_last_seq_ = target.last_seq;
+        }
+        sync(index_, detail::INDEX_HEADER_SIZE);
+        ++flushes_;
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return config_.session_id;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept override {
+        return counters_.snapshot();
+    }
+
+    // ========================================================================
+    // Additional Methods
+    // ========================================================================
+
+    [[nodiscard]] size_t message_count() const noexcept {
+        std::shared_lock lock(mutex_);
+        return static_cast<size_t>(count_);
+    }
+
+    /// Journal bytes in use (headers and padding included)
+    [[nodiscard]] size_t journal_used() const noexcept {
+        std::shared_lock lock(mutex_);
+        return static_cast<size_t>(journal_end_);
+    }
+
+    /// Journal bytes not yet synced by the flusher
+    [[nodiscard]] size_t unsynced_bytes() const noexcept {
+        std::shared_lock lock(mutex_);
+        return static_cast<size_t>(journal_end_ - synced_end_);
+    }
+
+    /// Records found past the durable watermark at open()
+    [[nodiscard]] size_t recovered_tail() const noexcept { return recovered_tail_; }
+
+    /// Completed flushes (background and explicit)
+    [[nodiscard]] uint64_t flush_count() const noexcept {
+        return flushes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    explicit MmapMessageStore(Config config) noexcept : config_(std::move(config)) {}
+
+    [[nodiscard]] size_t index_size() const noexcept {
+        return detail::INDEX_HEADER_SIZE + config_.max_seq * sizeof(uint64_t);
+    }
+
+    [[nodiscard]] detail::IndexHeader& header() const noexcept {
+        return *reinterpret_cast<detail::IndexHeader*>(index_);
+    }
+
+    [[nodiscard]] uint64_t* offsets() const noexcept {
+        return reinterpret_cast<uint64_t*>(index_ + detail::INDEX_HEADER_SIZE);
+    }
+
+    /// Stored bytes for seq_num after validating the record it points to
+    [[nodiscard]] std::span<const char> find_locked(uint32_t seq_num) const noexcept {
+        if (count_ == 0 || seq_num < first_seq_ || seq_num > last_seq_) return {};
+        const uint64_t offset = offsets()[seq_num];
+        if (offset < detail::JOURNAL_DATA_START ||
+            offset + sizeof(detail::RecordHeader) > journal_end_) return {};
+
+        detail::RecordHeader record;
+        std::memcpy(&record, journal_ + offset, sizeof(record));
+        if (record.seq != seq_num || record.epoch != epoch_ ||
+            offset + detail::record_span(record.size) > journal_end_) return {};
+        return {journal_ + offset + sizeof(record), record.size};
+    }
+
+    // ========================================================================
+    // Mapping and Recovery
+    // ========================================================================
+
+    [[nodiscard]] StoreResult<void> map_files() noexcept {
+        const std::string base = config_.directory + "/" + config_.session_id;
+
+        auto journal = map_file(base + ".journal", config_.journal_size, journal_fd_);
+        if (!journal) return std::unexpected(journal.error());
+        journal_ = *journal;
+
+        auto index = map_file(base + ".index", index_size(), index_fd_);
+        if (!index) return std::unexpected(index.error());
+        index_ = *index;
+
+        auto& jh = *reinterpret_cast<detail::JournalHeader*>(journal_);
+        detail::IndexHeader& ih = header();
+        const bool fresh_journal = jh.magic == 0;
+        const bool fresh_index = ih.magic == 0;
+
+        if (fresh_journal != fresh_index ||
+            (!fresh_journal && (jh.magic != detail::JOURNAL_MAGIC ||
+                                jh.version != detail::MMAP_STORE_VERSION ||
+                                jh.journal_size != config_.journal_size ||
+                                ih.magic != detail::INDEX_MAGIC ||
+                                ih.version != detail::MMAP_STORE_VERSION ||
+                                ih.journal_size != config_.journal_size ||
+                                ih.max_seq != config_.max_seq))) {
+            return std::unexpected(StoreError{StoreErrorCode::Corrupt});
+        }
+
+        if (fresh_journal) {
+            jh = detail::JournalHeader{detail::JOURNAL_MAGIC, detail::MMAP_STORE_VERSION, 0,
+                                       config_.journal_size};
+            ih = detail::IndexHeader{};
+            ih.magic = detail::INDEX_MAGIC;
+            ih.version = detail::MMAP_STORE_VERSION;
+            ih.epoch = 1;
+            ih.journal_size = config_.journal_size;
+            ih.max_seq = config_.max_seq;
+            ih.durable = detail::DurableState{detail::JOURNAL_DATA_START, 0, 0, 0};
+            ih.next_sender_seq = 1;
+            ih.next_target_seq = 1;
+            sync(journal_, detail::JOURNAL_DATA_START);
+            sync(index_, detail::INDEX_HEADER_SIZE);
+        }
+        return {};
+    }
+
+    /// Resume from the durable watermark and scan the unsynced tail
+    void recover() noexcept {
+        const detail::IndexHeader& h = header();
+        epoch_ = h.epoch;
+        journal_end_ = h.durable.journal_end;
+        first_seq_ = h.durable.first_seq;
+        last_seq_ = h.durable.last_seq;
+        count_ = h.durable.count;
+        if (journal_end_ < detail::JOURNAL_DATA_START || journal_end_ > config_.journal_size) {
+            journal_end_ = detail::JOURNAL_DATA_START;
+            first_seq_ = last_seq_ = 0;
+            count_ = 0;
+        }
+
+        for (;;) {
+            detail::RecordHeader record;
+            if (detail::read_record(journal_ + journal_end_, config_.journal_size - journal_end_,
+                                    epoch_, record) == 0 ||
+                record.seq >= config_.max_seq || (count_ != 0 && record.seq <= last_seq_)) {
+                break;
+            }
+            if (config_.verify_tail_checksum &&
+                !parser::validate_fix_checksum({journal_ + journal_end_ + sizeof(record), record.size})) {
+                break;
+            }
+            offsets()[record.seq] = journal_end_;
+            journal_end_ += detail::record_span(record.size);
+            if (count_ == 0) first_seq_ = record.seq;
+            last_seq_ = record.seq;
+            ++count_;
+            ++recovered_tail_;
+        }
+
+        synced_end_ = h.durable.journal_end;
+        synced_last_seq_ = h.durable.last_seq;
+        if (synced_end_ > journal_end_) synced_end_ = journal_end_;
+    }
+
+    [[nodiscard]] StoreResult<char*> map_file(
+        const std::string& path, size_t size, int& fd) const noexcept
+    {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+        }
+        if (static_cast<size_t>(st.st_size) < size) {
+#if NFX_PLATFORM_LINUX
+            const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+            if (err != 0 && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                return std::unexpected(StoreError{StoreErrorCode::ResizeFailed, err});
+            }
+#else
+            if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                return std::unexpected(StoreError{StoreErrorCode::ResizeFailed, errno});
+            }
+#endif
+        }
+
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED) {
+            return std::unexpected(StoreError{StoreErrorCode::MapFailed, errno});
+        }
+#if defined(MADV_HUGEPAGE)
+        if (config_.huge_pages) (void)::madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+        return static_cast<char*>(ptr);
+    }
+
+    static void unmap(char* ptr, size_t size) noexcept {
+        if (ptr) ::munmap(ptr, size);
+    }
+
+    /// msync the pages covering [ptr, ptr + size)
+    static void sync(char* ptr, size_t size) noexcept {
+        const size_t page = detail::page_size();
+        const auto addr = reinterpret_cast<uintptr_t>(ptr);
+        const uintptr_t start = addr & ~(page - 1);
+        (void)::msync(reinterpret_cast<void*>(start), size + (addr - start), MS_SYNC);
+    }
+
+    void flush_loop() noexcept {
+        std::unique_lock lock(flush_mutex_);
+        while (!stopping_) {
+            flush_cv_.wait_for(lock, config_.flush_interval, [this] { return stopping_; });
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
+
+    Config config_;
+
+    char* journal_{nullptr};
+    char* index_{nullptr};
+    int journal_fd_{-1};
+    int index_fd_{-1};
+
+    // Live state (guarded by mutex_)
+    uint64_t journal_end_{detail::JOURNAL_DATA_START};
+    uint64_t count_{0};
+    uint32_t first_seq_{0};
+    uint32_t last_seq_{0};
+    uint32_t epoch_{1};
+    uint64_t synced_end_{detail::JOURNAL_DATA_START};
+    uint32_t synced_last_seq_{0};
+    size_t recovered_tail_{0};
+    std::span<const char> last_stored_{};      // Record of the last store()
+
+    mutable std::shared_mutex mutex_;
+    mutable StoreCounters counters_;
+
+    // Flusher
+    std::mutex sync_mutex_;                     // Serializes flush()
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cv_;
+    bool stopping_{false};
+    std::atomic<uint64_t> flushes_{0};
+    std::thread flusher_;
+};
+
+} // namespace nfx::store
+
+#endif  // !NFX_PLATFORM_WINDOWS
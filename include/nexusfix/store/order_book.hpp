@@ -0,0 +1,441 @@
+/*
+    NexusFIX L2 Order Book
+
+    Market-by-price book for one instrument, maintained straight from
+    MarketDataSnapshotFullRefresh (35=W) and MarketDataIncrementalRefresh
+    (35=X) messages.
+
+    Each side is a flat, sorted struct-of-arrays (best level first):
+
+        bids.price  [ 100.05 | 100.04 | 100.02 | ... ]   contiguous FixedPrice
+        bids.size   [    300 |    100 |    700 | ... ]   contiguous Qty
+        bids.orders [      3 |      1 |      9 | ... ]
+
+    Feeds that send MDEntryPositionNo (290) are applied by index with no
+    search; price-keyed feeds scan the price column from the top, where
+    nearly every update lands. Inserts and deletes shift the tail of three
+    short arrays - a few cache lines for a 64-level book - instead of
+    chasing tree or list nodes.
+
+    Supported MDUpdateAction (279) per row:
+    - New / Change:  insert or update a level (by position or by price)
+    - Delete:        remove a level
+    - DeleteThru:    remove levels 1..MDEntryPositionNo (or through price)
+    - DeleteFrom:    remove levels MDEntryPositionNo..end (or from price)
+
+    Every level change is reported to an optional listener, so consumers
+    can react to what moved instead of diffing the book.
+
+    Usage:
+        OrderBook<> book{"AAPL"};
+
+        book.apply(msg, [](const BookChange& c) {
+            if (c.level == 0) on_top_of_book_change(c);
+        });
+
+        if (book.depth(BookSide::Bid) > 0) quote(book.best_bid().price);
+
+    Single-threaded: publish derived state (e.g. TopOfBookStore::publish)
+    for other threads.
+*/
+
+#pragma once
+
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+namespace nfx::store {
+
+// ============================================================================
+// Book Types
+// ============================================================================
+
+enum class BookSide : uint8_t {
+    Bid,
+    Ask
+};
+
+/// One aggregated price level
+struct PriceLevel {
+    FixedPrice price{};
+    Qty size{};
+    uint32_t orders{0};            // NumberOfOrders (0 if the feed omits it)
+};
+
+/// Kind of change reported to a book listener
+enum class BookEvent : uint8_t {
+    Snapshot,   // Book rebuilt from 35=W (level/price/size unused)
+    Insert,     // New level at level
+    Update,     // Size (or price) of level changed
+    Remove      // count levels removed starting at level
+};
+
+/// Change notification passed to apply() listeners
+struct BookChange {
+    BookEvent event{BookEvent::Snapshot};
+    BookSide side{BookSide::Bid};
+    uint16_t level{0};             // 0 = best, after the change
+    uint16_t count{1};             // Levels removed (Remove)
+    FixedPrice price{};
+    Qty size{};
+};
+
+/// Listener that ignores every change
+struct NoBookListener {
+    constexpr void operator()(const BookChange&) const noexcept {}
+};
+
+// ============================================================================
+// Order Book
+// ============================================================================
+
+/// L2 (market-by-price) order book for one symbol
+/// @tparam MaxDepth Levels kept per side; deeper levels are dropped
+/// @tparam MaxEntries MDEntries decoded from one message
+template <size_t MaxDepth = 64, size_t MaxEntries = 256>
+class OrderBook {
+    static_assert(MaxDepth > 0 && MaxDepth < UINT16_MAX, "MaxDepth must fit a 16-bit level");
+
+public:
+    static constexpr size_t MAX_SYMBOL_LENGTH = 31;
+
+    /// @param symbol Rows for other symbols are ignored (empty = accept all)
+    explicit OrderBook(std::string_view symbol = {}) noexcept {
+        symbol_length_ = static_cast<uint8_t>(std::min(symbol.size(), MAX_SYMBOL_LENGTH));
+        std::memcpy(symbol_.data(), symbol.data(), symbol_length_);
+    }
+
+    // ========================================================================
+    // Feed
+    // ========================================================================
+
+    /// Apply a 35=W or 35=X message; other types are ignored
+    /// @param on_change Called with each BookChange
+    /// @return Rows applied
+    template <typename Listener = NoBookListener>
+    NFX_HOT size_t apply(const ParsedMessage& msg, Listener&& on_change = {}) noexcept {
+        switch (msg.msg_type()) {
+            case 'W': return apply_snapshot(msg, on_change);
+            case 'X': return apply_incremental(msg, on_change);
+            default:  return 0;
+        }
+    }
+
+    /// Rebuild the book from MarketDataSnapshotFullRefresh (35=W)
+    /// @return Levels loaded (0 if the message is for another symbol)
+    template <typename Listener = NoBookListener>
+    size_t apply_snapshot(const ParsedMessage& msg, Listener&& on_change = {}) noexcept {
+        const std::string_view sym = msg.get_string(tag::Symbol::value);
+        if (!accepts(sym)) return 0;
+        decode(msg, tag::MDEntryType::value, sym);
+        msg_seq_num_ = msg.msg_seq_num();
+        return rebuild(columns_, on_change);
+    }
+
+    /// Apply MarketDataIncrementalRefresh (35=X) rows for this symbol
+    /// @return Rows applied
+    template <typename Listener = NoBookListener>
+    size_t apply_incremental(const ParsedMessage& msg, Listener&& on_change = {}) noexcept {
+        decode(msg, tag::MDUpdateAction::value, {});
+        msg_seq_num_ = msg.msg_seq_num();
+        return apply_entries(columns_, on_change);
+    }
+
+    /// Replace the book with the Bid/Offer rows of a decoded snapshot
+    /// @return Levels loaded
+    template <size_t Capacity, typename Listener = NoBookListener>
+    size_t rebuild(const MDEntryColumns<Capacity>& cols, Listener&& on_change = {}) noexcept {
+        clear();
+        size_t loaded = 0;
+        for (size_t r = 0; r < cols.count; ++r) {
+            const MDEntryType type = cols.entry_type[r];
+            if (type != MDEntryType::Bid && type != MDEntryType::Offer) continue;
+            const bool bid = type == MDEntryType::Bid;
+            Side& s = side(bid);
+            const PriceLevel level{cols.price[r], cols.size[r], cols.number_of_orders[r]};
+
+            if (cols.position_no[r] != 0) {
+                if (insert_at(s, cols.position_no[r] - 1u, level)) ++loaded;
+                continue;
+            }
+            const size_t i = find_price(s, bid, level.price);
+            if (i < s.depth && s.price[i].raw == level.price.raw) {
+                // Same price twice (order-level snapshot): aggregate
+                s.size[i].raw += level.size.raw;
+                s.orders[i] += level.orders;
+                ++loaded;
+            } else if (insert_at(s, i, level)) {
+                ++loaded;
+            }
+        }
+        ++updates_;
+        on_change(BookChange{BookEvent::Snapshot, BookSide::Bid, 0, 0, {}, {}});
+        return loaded;
+    }
+
+    /// Apply the Bid/Offer rows of a decoded incremental refresh
+    /// @return Rows applied
+    template <size_t Capacity, typename Listener = NoBookListener>
+    size_t apply_entries(const MDEntryColumns<Capacity>& cols, Listener&& on_change = {}) noexcept {
+        size_t applied = 0;
+        for (size_t r = 0; r < cols.count; ++r) {
+            const MDEntryType type = cols.entry_type[r];
+            if (type != MDEntryType::Bid && type != MDEntryType::Offer) continue;
+            if (!accepts(cols.symbol(r))) continue;
+            applied += apply_row(type == MDEntryType::Bid, cols.update_action[r],
+                                 cols.position_no[r],
+                                 PriceLevel{cols.price[r], cols.size[r], cols.number_of_orders[r]},
+                                 on_change);
+        }
+        if (applied != 0) ++updates_;
+        return applied;
+    }
+
+    /// Apply one buffered incremental row (e.g. replayed after recovery)
+    /// @return 1 if the book changed
+    template <typename Listener = NoBookListener>
+    size_t apply_entry(const MDEntryRow& row, Listener&& on_change = {}) noexcept {
+        if (row.entry_type != MDEntryType::Bid && row.entry_type != MDEntryType::Offer) return 0;
+        const size_t applied = apply_row(row.entry_type == MDEntryType::Bid, row.update_action,
+                                         row.position_no,
+                                         PriceLevel{row.price, row.size, row.number_of_orders},
+                                         on_change);
+        updates_ += applied;
+        return applied;
+    }
+
+    /// Remove every level
+    void clear() noexcept {
+        bids_.depth = 0;
+        asks_.depth = 0;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Levels on a side
+    [[nodiscard]] size_t depth(BookSide s) const noexcept {
+        return side(s == BookSide::Bid).depth;
+    }
+
+    /// Level i of a side (0 = best); i must be < depth(s)
+    [[nodiscard]] PriceLevel level(BookSide s, size_t i) const noexcept {
+        const Side& sd = side(s == BookSide::Bid);
+        return {sd.price[i], sd.size[i], sd.orders[i]};
+    }
+
+    [[nodiscard]] PriceLevel best_bid() const noexcept { return level(BookSide::Bid, 0); }
+    [[nodiscard]] PriceLevel best_ask() const noexcept { return level(BookSide::Ask, 0); }
+
+    /// Price column of a side, best first
+    [[nodiscard]] std::span<const FixedPrice> prices(BookSide s) const noexcept {
+        const Side& sd = side(s == BookSide::Bid);
+        return {sd.price.data(), sd.depth};
+    }
+
+    /// Size column of a side, best first
+    [[nodiscard]] std::span<const Qty> sizes(BookSide s) const noexcept {
+        const Side& sd = side(s == BookSide::Bid);
+        return {sd.size.data(), sd.depth};
+    }
+
+    /// True if best bid >= best ask (stale or out-of-order data)
+    [[nodiscard]] bool crossed() const noexcept {
+        return bids_.depth != 0 && asks_.depth != 0 && bids_.price[0].raw >= asks_.price[0].raw;
+    }
+
+    [[nodiscard]] std::string_view symbol() const noexcept {
+        return {symbol_.data(), symbol_length_};
+    }
+
+    /// MsgSeqNum of the last message applied
+    [[nodiscard]] uint32_t msg_seq_num() const noexcept { return msg_seq_num_; }
+
+    /// Messages that changed the book
+    [[nodiscard]] uint64_t updates() const noexcept { return updates_; }
+
+    /// Levels pushed past MaxDepth and discarded
+    [[nodiscard]] uint64_t dropped_levels() const noexcept { return dropped_levels_; }
+
+    [[nodiscard]] static constexpr size_t max_depth() noexcept { return MaxDepth; }
+
+private:
+    struct Side {
+        alignas(64) std::array<FixedPrice, MaxDepth> price{};
+        alignas(64) std::array<Qty, MaxDepth> size{};
+        alignas(64) std::array<uint32_t, MaxDepth> orders{};
+        size_t depth{0};
+    };
+
+    [[nodiscard]] Side& side(bool bid) noexcept { return bid ? bids_ : asks_; }
+    [[nodiscard]] const Side& side(bool bid) const noexcept { return bid ? bids_ : asks_; }
+
+    [[nodiscard]] bool accepts(std::string_view sym) const noexcept {
+        return symbol_length_ == 0 || sym.empty() || sym == symbol();
+    }
+
+    /// First level at or behind price (bids descending, asks ascending)
+    [[nodiscard]] static size_t find_price(const Side& s, bool bid, FixedPrice px) noexcept {
+        size_t i = 0;
+        if (bid) {
+            while (i < s.depth && s.price[i].raw > px.raw) ++i;
+        } else {
+            while (i < s.depth && s.price[i].raw < px.raw) ++i;
+        }
+        return i;
+    }
+
+    /// Insert level at index i (clamped to depth); the worst level falls
+    /// off a full side
+    /// @return false if the level itself was beyond MaxDepth
+    bool insert_at(Side& s, size_t i, const PriceLevel& level) noexcept {
+        i = std::min(i, s.depth);
+        if (i >= MaxDepth) {
+            ++dropped_levels_;
+            return false;
+        }
+        size_t last = s.depth;
+        if (s.depth == MaxDepth) {
+            --last;
+            ++dropped_levels_;
+        } else {
+            ++s.depth;
+        }
+        std::copy_backward(s.price.begin() + i, s.price.begin() + last, s.price.begin() + last + 1);
+        std::copy_backward(s.size.begin() + i, s.size.begin() + last, s.size.begin() + last + 1);
+        std::copy_backward(s.orders.begin() + i, s.orders.begin() + last, s.orders.begin() + last + 1);
+        s.price[i] = level.price;
+        s.size[i] = level.size;
+        s.orders[i] = level.orders;
+        return true;
+    }
+
+    /// Remove n levels starting at index i
+    static void erase(Side& s, size_t i, size_t n) noexcept {
+        std::copy(s.price.begin() + i + n, s.price.begin() + s.depth, s.price.begin() + i);
+        std::copy(s.size.begin() + i + n, s.size.begin() + s.depth, s.size.begin() + i);
+        std::copy(s.orders.begin() + i + n, s.orders.begin() + s.depth, s.orders.begin() + i);
+        s.depth -= n;
+    }
+
+    /// Apply one incremental row to a side
+    /// @return 1 if the book changed
+    template <typename Listener>
+    size_t apply_row(bool bid, MDUpdateAction action, uint16_t position,
+                     const PriceLevel& level, Listener& on_change) noexcept {
+        Side& s = side(bid);
+        const BookSide book_side = bid ? BookSide::Bid : BookSide::Ask;
+        auto notify = [&](BookEvent event, size_t i, size_t count) {
+            on_change(BookChange{event, book_side, static_cast<uint16_t>(i),
+                                 static_cast<uint16_t>(count), level.price, level.size});
+        };
+
+        switch (action) {
+            case MDUpdateAction::New:
+            case MDUpdateAction::Change: {
+                size_t i;
+                if (position != 0) {
+                    i = position - 1u;
+                    // Positional feeds: Change overwrites the level in place
+                    if (action == MDUpdateAction::Change && i < s.depth) {
+                        set(s, i, level);
+                        notify(BookEvent::Update, i, 1);
+                        return 1;
+                    }
+                } else {
+                    i = find_price(s, bid, level.price);
+                    if (i < s.depth && s.price[i].raw == level.price.raw) {
+                        set(s, i, level);
+                        notify(BookEvent::Update, i, 1);
+                        return 1;
+                    }
+                }
+                if (!insert_at(s, i, level)) return 0;
+                notify(BookEvent::Insert, std::min(i, s.depth - 1), 1);
+                return 1;
+            }
+
+            case MDUpdateAction::Delete: {
+                size_t i;
+                if (position != 0) {
+                    i = position - 1u;
+                } else {
+                    i = find_price(s, bid, level.price);
+                    if (i < s.depth && s.price[i].raw != level.price.raw) return 0;
+                }
+                if (i >= s.depth) return 0;
+                erase(s, i, 1);
+                notify(BookEvent::Remove, i, 1);
+                return 1;
+            }
+
+            case MDUpdateAction::DeleteThru: {
+                // Levels 1..position, or every level at or better than price
+                size_t n = s.depth;
+                if (position != 0) {
+                    n = std::min<size_t>(position, s.depth);
+                } else if (level.price.raw != 0) {
+                    n = find_price(s, bid, level.price);
+                    if (n < s.depth && s.price[n].raw == level.price.raw) ++n;
+                }
+                if (n == 0) return 0;
+                erase(s, 0, n);
+                notify(BookEvent::Remove, 0, n);
+                return 1;
+            }
+
+            case MDUpdateAction::DeleteFrom: {
+                // Levels position..end, or every level at or behind price
+                size_t i = 0;
+                if (position != 0) {
+                    i = position - 1u;
+                } else if (level.price.raw != 0) {
+                    i = find_price(s, bid, level.price);
+                }
+                if (i >= s.depth) return 0;
+                const size_t n = s.depth - i;
+                erase(s, i, n);
+                notify(BookEvent::Remove, i, n);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    static void set(Side& s, size_t i, const PriceLevel& level) noexcept {
+        s.price[i] = level.price;
+        s.size[i] = level.size;
+        s.orders[i] = level.orders;
+    }
+
+    /// Decode the MDEntry group of msg into columns_
+    void decode(const ParsedMessage& msg, int delimiter, std::string_view sym) noexcept {
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count <= 0) {
+            columns_.clear();
+            return;
+        }
+        (void)parser::decode_md_entries(msg.raw(), delimiter, static_cast<size_t>(count),
+                                        columns_, sym);
+    }
+
+    Side bids_{};
+    Side asks_{};
+    uint32_t msg_seq_num_{0};
+    uint64_t updates_{0};
+    uint64_t dropped_levels_{0};
+    std::array<char, MAX_SYMBOL_LENGTH> symbol_{};
+    uint8_t symbol_length_{0};
+    MDEntryColumns<MaxEntries> columns_{};
+};
+
+} // namespace nfx::store
@@ -0,0 +1,548 @@
+/*
+    NexusFIX L3 Order Book
+
+    Market-by-order book for one instrument, for venues that send one
+    MDEntry per resting order (MDEntryID, tag 278). Where the L2
+    OrderBook (store/order_book.hpp) keeps aggregated levels, this keeps
+    every order in time priority, so strategies can model their queue
+    position.
+
+        orders_  open-addressing table  order id --> OrderNode
+        levels_  open-addressing table  price    --> LevelNode   (per side)
+
+        LevelNode  price | qty | orders | head ----> tail
+                                          |           |
+                   OrderNode <-> OrderNode <-> OrderNode   (FIFO, intrusive)
+
+    Add, modify and delete are O(1): one hash probe for the order, one
+    for its level, and a few pointer writes. Nodes come from fixed
+    ObjectPools, so the book never allocates after construction. Level
+    qty and order count are kept current on every event. Best prices and
+    the sorted depth are derived lazily: best_bid() / best_ask() rescan
+    the (short, contiguous) list of live levels only after the best
+    level emptied, and depth() sorts on request.
+
+    Modify keeps time priority when the price is unchanged and the qty
+    does not grow; a price change or a qty increase moves the order to
+    the back of its (new) level, as at most venues.
+
+    Order ids: numeric MDEntryIDs of up to 19 digits map to their value;
+    other ids are FNV-1a hashed (top bit set, 2^-63 collision odds).
+
+    Usage:
+        auto book = std::make_unique<L3OrderBook<>>("AAPL");  // Large: heap
+        book->apply(msg);                    // 35=W / 35=X with MDEntryID
+        book->add(id, BookSide::Bid, px, qty);
+        auto ahead = book->queue_ahead(my_id);
+
+    Single-threaded, like OrderBook.
+*/
+
+#pragma once
+
+#include "nexusfix/memory/object_pool.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/store/order_book.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+namespace nfx::store {
+
+// ============================================================================
+// Order Id Key
+// ============================================================================
+
+/// 64-bit key of an MDEntryID (see file comment)
+[[nodiscard]] inline uint64_t l3_order_key(std::string_view id) noexcept {
+    if (!id.empty() && id.size() <= 19) {
+        uint64_t value = 0;
+        bool numeric = true;
+        for (char c : id) {
+            const auto digit = static_cast<uint8_t>(c - '0');
+            numeric &= digit < 10;
+            value = value * 10 + digit;
+        }
+        if (numeric) return value;
+    }
+    return util::fnv1a_hash_runtime(id) | (uint64_t{1} << 63);
+}
+
+namespace detail {
+
+/// Linear-probing map from uint64 key to node pointer
+/// Deletion shifts later entries back, so there are no tombstones and
+/// probe lengths stay short under constant churn.
+template <typename Node, size_t MaxEntries>
+class L3Table {
+public:
+    static constexpr size_t CAPACITY = std::bit_ceil(MaxEntries * 2);
+
+    [[nodiscard]] Node* find(uint64_t key) const noexcept {
+        for (size_t i = home(key);; i = (i + 1) & MASK) {
+            const Slot& s = slots_[i];
+            if (!s.node || s.key == key) return s.node;
+        }
+    }
+
+    /// Insert a key that is not present (caller checked find())
+    void insert(uint64_t key, Node* node) noexcept {
+        size_t i = home(key);
+        while (slots_[i].node) i = (i + 1) & MASK;
+        slots_[i] = Slot{key, node};
+    }
+
+    void erase(uint64_t key) noexcept {
+        size_t i = home(key);
+        while (slots_[i].node && slots_[i].key != key) i = (i + 1) & MASK;
+        if (!slots_[i].node) return;
+
+        // Backward shift: pull later entries of the run into the hole
+        for (size_t j = (i + 1) & MASK; slots_[j].node; j = (j + 1) & MASK) {
+            const size_t h = home(slots_[j].key);
+            const bool movable = i <= j ? (h <= i || h > j) : (h <= i && h > j);
+            if (movable) {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i].node = nullptr;
+    }
+
+    void clear() noexcept { slots_.fill(Slot{}); }
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+    static constexpr int SHIFT = 64 - std::countr_zero(CAPACITY);
+
+    struct Slot {
+        uint64_t key{0};
+        Node* node{nullptr};
+    };
+
+    /// Fibonacci hashing: sequential ids spread over the table
+    [[nodiscard]] static size_t home(uint64_t key) noexcept {
+        if constexpr (SHIFT >= 64) {
+            return 0;
+        } else {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> SHIFT);
+        }
+    }
+
+    std::array<Slot, CAPACITY> slots_{};
+};
+
+}  // namespace detail
+
+// ============================================================================
+// L3 Order Book
+// ============================================================================
+
+/// One resting order
+struct L3Order {
+    uint64_t id{0};
+    BookSide side{BookSide::Bid};
+    FixedPrice price{};
+    Qty qty{};
+};
+
+/// L3 (market-by-order) order book for one symbol
+/// @tparam MaxOrders Resting orders held at once
+/// @tparam MaxLevels Live price levels per side
+template <size_t MaxOrders = 65536, size_t MaxLevels = 4096>
+class L3OrderBook {
+    static_assert(MaxLevels < UINT32_MAX, "Level slots are 32-bit");
+
+public:
+    static constexpr size_t MAX_SYMBOL_LENGTH = 31;
+
+    /// @param symbol Rows for other symbols are ignored (empty = accept all)
+    explicit L3OrderBook(std::string_view symbol = {}) noexcept {
+        symbol_length_ = static_cast<uint8_t>(std::min(symbol.size(), MAX_SYMBOL_LENGTH));
+        std::memcpy(symbol_.data(), symbol.data(), symbol_length_);
+    }
+
+    L3OrderBook(const L3OrderBook&) = delete;
+    L3OrderBook& operator=(const L3OrderBook&) = delete;
+
+    // ========================================================================
+    // Order Events
+    // ========================================================================
+
+    /// Add an order at the back of its price level
+    /// @return false on a duplicate id or a full pool / level table
+    NFX_HOT bool add(uint64_t id, BookSide side, FixedPrice price, Qty qty) noexcept {
+        if (orders_.find(id)) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        LevelNode* level = level_for(side, price);
+        if (!level) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        OrderNode* order = order_pool_.allocate();
+        if (!order) [[unlikely]] {
+            if (!level->head) release_level(level);
+            ++rejected_;
+            return false;
+        }
+        order->id = id;
+        order->qty = qty.raw;
+        orders_.insert(id, order);
+        link_back(level, order);
+        on_better(level);
+        ++events_;
+        return true;
+    }
+
+    /// Change an order's price and/or qty (see file comment for priority)
+    /// @return false if the id is unknown or the new level cannot be made
+    NFX_HOT bool modify(uint64_t id, FixedPrice price, Qty qty) noexcept {
+        OrderNode* order = orders_.find(id);
+        if (!order) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        LevelNode* level = order->level;
+        if (price.raw == level->price) {
+            if (qty.raw > order->qty) {
+                level->qty += qty.raw - order->qty;
+                order->qty = qty.raw;
+                unlink(level, order);
+                link_back(level, order);
+            } else {
+                level->qty -= order->qty - qty.raw;
+                order->qty = qty.raw;
+            }
+            ++events_;
+            return true;
+        }
+
+        LevelNode* target = level_for(level->side, price);
+        if (!target) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        unlink(level, order);
+        if (!level->head) release_level(level);
+        order->qty = qty.raw;
+        link_back(target, order);
+        on_better(target);
+        ++events_;
+        return true;
+    }
+
+    /// Remove an order (cancel or full fill)
+    /// @return false if the id is unknown
+    NFX_HOT bool remove(uint64_t id) noexcept {
+        OrderNode* order = orders_.find(id);
+        if (!order) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        LevelNode* level = order->level;
+        unlink(level, order);
+        if (!level->head) release_level(level);
+        orders_.erase(id);
+        order_pool_.deallocate(order);
+        ++events_;
+        return true;
+    }
+
+    /// Reduce an order by a traded qty; removes it when nothing is left
+    /// @return false if the id is unknown
+    bool execute(uint64_t id, Qty traded) noexcept {
+        OrderNode* order = orders_.find(id);
+        if (!order) [[unlikely]] {
+            ++rejected_;
+            return false;
+        }
+        if (traded.raw >= order->qty) return remove(id);
+        order->qty -= traded.raw;
+        order->level->qty -= traded.raw;
+        ++events_;
+        return true;
+    }
+
+    /// Remove every order
+    void clear() noexcept {
+        for (size_t s = 0; s < 2; ++s) {
+            for (uint32_t i = 0; i < live_count_[s]; ++i) {
+                LevelNode* level = live_[s][i];
+                for (OrderNode* o = level->head; o;) {
+                    OrderNode* next = o->next;
+                    order_pool_.deallocate(o);
+                    o = next;
+                }
+                level_pool_.deallocate(level);
+            }
+            live_count_[s] = 0;
+            levels_[s].clear();
+            best_[s] = nullptr;
+            best_valid_[s] = true;
+        }
+        orders_.clear();
+    }
+
+    // ========================================================================
+    // Feed
+    // ========================================================================
+
+    /// Apply a 35=W or 35=X message keyed by MDEntryID; others are ignored
+    /// Snapshot rows are added in message order (their queue order).
+    /// Incremental New / Change / Delete map to add / modify / remove.
+    /// @return Rows applied
+    NFX_HOT size_t apply(const ParsedMessage& msg) noexcept {
+        const char type = msg.msg_type();
+        if (type != 'W' && type != 'X') return 0;
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        const std::string_view msg_symbol = msg.get_string(tag::Symbol::value);
+
+        if (type == 'W') {
+            if (!accepts(msg_symbol)) return 0;
+            clear();
+        }
+        msg_seq_num_ = msg.msg_seq_num();
+        if (count <= 0) return 0;
+
+        size_t applied = 0;
+        parser::MDEntryIterator iter{msg.raw(), static_cast<size_t>(count),
+            type == 'W' ? tag::MDEntryType::value : tag::MDUpdateAction::value};
+        while (iter.has_next()) {
+            const MDEntry e = iter.next();
+            if (!e.is_bid() && !e.is_offer()) continue;
+            if (e.entry_id.empty() || (type == 'X' && !accepts(e.symbol))) continue;
+            applied += apply_entry(e) ? 1 : 0;
+        }
+        return applied;
+    }
+
+    /// Apply one parsed order-level MDEntry
+    /// @return true if the book changed
+    bool apply_entry(const MDEntry& e) noexcept {
+        const uint64_t id = l3_order_key(e.entry_id);
+        const BookSide side = e.is_bid() ? BookSide::Bid : BookSide::Ask;
+        switch (e.update_action) {
+            case MDUpdateAction::New:
+                return add(id, side, FixedPrice{e.price_raw}, Qty{e.size_raw});
+            case MDUpdateAction::Change:
+                return modify(id, FixedPrice{e.price_raw}, Qty{e.size_raw});
+            case MDUpdateAction::Delete:
+                return remove(id);
+            default:
+                return false;
+        }
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Order by id (id 0 and zero qty if unknown)
+    [[nodiscard]] L3Order order(uint64_t id) const noexcept {
+        const OrderNode* o = orders_.find(id);
+        if (!o) return {};
+        return L3Order{o->id, o->level->side, FixedPrice{o->level->price}, Qty{o->qty}};
+    }
+
+    [[nodiscard]] bool contains(uint64_t id) const noexcept { return orders_.find(id) != nullptr; }
+
+    /// Qty resting ahead of an order at its level (0 if unknown)
+    [[nodiscard]] Qty queue_ahead(uint64_t id) const noexcept {
+        const OrderNode* o = orders_.find(id);
+        if (!o) return Qty{};
+        int64_t ahead = 0;
+        for (const OrderNode* p = o->level->head; p != o; p = p->next) ahead += p->qty;
+        return Qty{ahead};
+    }
+
+    /// Aggregate of the level at price (empty if none)
+    [[nodiscard]] PriceLevel level_at(BookSide side, FixedPrice price) const noexcept {
+        const LevelNode* level = levels_[index(side)].find(static_cast<uint64_t>(price.raw));
+        return level ? aggregate(level) : PriceLevel{};
+    }
+
+    [[nodiscard]] PriceLevel best_bid() noexcept { return best(BookSide::Bid); }
+    [[nodiscard]] PriceLevel best_ask() noexcept { return best(BookSide::Ask); }
+
+    /// Best level of a side (empty if the side is empty)
+    [[nodiscard]] PriceLevel best(BookSide side) noexcept {
+        const LevelNode* level = best_level(index(side));
+        return level ? aggregate(level) : PriceLevel{};
+    }
+
+    /// Fill out with the best levels of a side, best first
+    /// @return Levels written
+    size_t depth(BookSide side, std::span<PriceLevel> out) const noexcept {
+        const size_t s = index(side);
+        const size_t n = std::min<size_t>(out.size(), live_count_[s]);
+        std::array<const LevelNode*, MaxLevels> sorted;
+        std::copy_n(live_[s].begin(), live_count_[s], sorted.begin());
+        const auto better = [bid = side == BookSide::Bid](const LevelNode* a, const LevelNode* b) {
+            return bid ? a->price > b->price : a->price < b->price;
+        };
+        std::partial_sort(sorted.begin(), sorted.begin() + n, sorted.begin() + live_count_[s], better);
+        for (size_t i = 0; i < n; ++i) out[i] = aggregate(sorted[i]);
+        return n;
+    }
+
+    /// Visit the orders of a level front to back as fn(const L3Order&)
+    template <typename Fn>
+    void for_each_order(BookSide side, FixedPrice price, Fn&& fn) const {
+        const LevelNode* level = levels_[index(side)].find(static_cast<uint64_t>(price.raw));
+        if (!level) return;
+        for (const OrderNode* o = level->head; o; o = o->next) {
+            fn(L3Order{o->id, side, price, Qty{o->qty}});
+        }
+    }
+
+    [[nodiscard]] size_t order_count() const noexcept { return order_pool_.allocated(); }
+    [[nodiscard]] size_t level_count(BookSide side) const noexcept { return live_count_[index(side)]; }
+
+    [[nodiscard]] std::string_view symbol() const noexcept {
+        return {symbol_.data(), symbol_length_};
+    }
+
+    /// MsgSeqNum of the last message applied
+    [[nodiscard]] uint32_t msg_seq_num() const noexcept { return msg_seq_num_; }
+
+    /// Events applied / refused (unknown or duplicate id, capacity)
+    [[nodiscard]] uint64_t events() const noexcept { return events_; }
+    [[nodiscard]] uint64_t rejected() const noexcept { return rejected_; }
+
+private:
+    struct LevelNode;
+
+    struct OrderNode {
+        uint64_t id;
+        int64_t qty;
+        OrderNode* prev;
+        OrderNode* next;
+        LevelNode* level;
+    };
+
+    struct LevelNode {
+        int64_t price;
+        int64_t qty;
+        uint32_t orders;
+        uint32_t live_index;            // Position in live_[side]
+        OrderNode* head;
+        OrderNode* tail;
+        BookSide side;
+    };
+
+    [[nodiscard]] static constexpr size_t index(BookSide side) noexcept {
+        return side == BookSide::Bid ? 0 : 1;
+    }
+
+    [[nodiscard]] static PriceLevel aggregate(const LevelNode* level) noexcept {
+        return PriceLevel{FixedPrice{level->price}, Qty{level->qty}, level->orders};
+    }
+
+    [[nodiscard]] bool accepts(std::string_view sym) const noexcept {
+        return symbol_length_ == 0 || sym.empty() || sym == symbol();
+    }
+
+    [[nodiscard]] static bool better(size_t s, int64_t a, int64_t b) noexcept {
+        return s == 0 ? a > b : a < b;
+    }
+
+    /// Existing level at price, or a new empty one (nullptr when full)
+    LevelNode* level_for(BookSide side, FixedPrice price) noexcept {
+        const size_t s = index(side);
+        const auto key = static_cast<uint64_t>(price.raw);
+        if (LevelNode* level = levels_[s].find(key)) return level;
+        if (live_count_[s] == MaxLevels) [[unlikely]] return nullptr;
+        LevelNode* level = level_pool_.allocate();
+        if (!level) [[unlikely]] return nullptr;
+        *level = LevelNode{price.raw, 0, 0, live_count_[s], nullptr, nullptr, side};
+        live_[s][live_count_[s]++] = level;
+        levels_[s].insert(key, level);
+        return level;
+    }
+
+    /// Drop an emptied level; the best is recomputed on the next query
+    void release_level(LevelNode* level) noexcept {
+        const size_t s = index(level->side);
+        LevelNode* last = live_[s][--live_count_[s]];
+        live_[s][level->live_index] = last;
+        last->live_index = level->live_index;
+        levels_[s].erase(static_cast<uint64_t>(level->price));
+        if (best_[s] == level) best_valid_[s] = false;
+        level_pool_.deallocate(level);
+    }
+
+    /// Track a level that may now be the best of its side
+    void on_better(LevelNode* level) noexcept {
+        const size_t s = index(level->side);
+        if (best_valid_[s] && (!best_[s] || better(s, level->price, best_[s]->price))) {
+            best_[s] = level;
+        }
+    }
+
+    [[nodiscard]] const LevelNode* best_level(size_t s) noexcept {
+        if (!best_valid_[s]) {
+            LevelNode* best = nullptr;
+            for (uint32_t i = 0; i < live_count_[s]; ++i) {
+                if (!best || better(s, live_[s][i]->price, best->price)) best = live_[s][i];
+            }
+            best_[s] = best;
+            best_valid_[s] = true;
+        }
+        return best_[s];
+    }
+
+    static void link_back(LevelNode* level, OrderNode* order) noexcept {
+        order->level = level;
+        order->next = nullptr;
+        order->prev = level->tail;
+        if (level->tail) {
+            level->tail->next = order;
+        } else {
+            level->head = order;
+        }
+        level->tail = order;
+        level->qty += order->qty;
+        ++level->orders;
+    }
+
+    static void unlink(LevelNode* level, OrderNode* order) noexcept {
+        if (order->prev) {
+            order->prev->next = order->next;
+        } else {
+            level->head = order->next;
+        }
+        if (order->next) {
+            order->next->prev = order->prev;
+        } else {
+            level->tail = order->prev;
+        }
+        level->qty -= order->qty;
+        --level->orders;
+    }
+
+    memory::ObjectPool<OrderNode, MaxOrders> order_pool_;
+    memory::ObjectPool<LevelNode, MaxLevels * 2> level_pool_;
+    detail::L3Table<OrderNode, MaxOrders> orders_;
+    std::array<detail::L3Table<LevelNode, MaxLevels>, 2> levels_;
+    std::array<std::array<LevelNode*, MaxLevels>, 2> live_{};
+    std::array<uint32_t, 2> live_count_{};
+    std::array<LevelNode*, 2> best_{};
+    std::array<bool, 2> best_valid_{true, true};
+    uint32_t msg_seq_num_{0};
+    uint64_t events_{0};
+    uint64_t rejected_{0};
+    std::array<char, MAX_SYMBOL_LENGTH> symbol_{};
+    uint8_t symbol_length_{0};
+};
+
+} // namespace nfx::store
@@ -0,0 +1,418 @@
+/*
+    NexusFIX Order Table
+
+    Open orders keyed by ClOrdID (11), owned by the engine so execution
+    report handlers stop keeping their own unordered_map<std::string, ...>.
+
+    Orders opened here get a minted, fixed-format ClOrdID that carries
+    the entry's slot and a generation:
+
+        <prefix><slot: 5 hex><generation: 6 hex>     "NX" -> "NX0002A000001"
+
+    so finding the order for an inbound report is a length/prefix check,
+    eleven table-driven hex digits and an array index - no hashing. The
+    generation changes whenever a slot is released, so a late report for
+    an order that is gone does not land on the slot's next occupant.
+
+    Orders whose ClOrdID we did not mint (track(): drop copy, manual
+    orders, another engine's ids) go to a Swiss table: one control byte
+    per bucket holding 7 bits of the hash, probed 16 buckets at a time
+    with one SSE2 compare, so a lookup touches one or two cache lines
+    before the single key comparison.
+
+    apply() updates OrdStatus (39), CumQty (14), LeavesQty (151) and
+    AvgPx (6) in place. Orders reaching Filled, Canceled, Rejected or
+    Expired are closed: their entry stays readable until the slot is
+    reused by a later open().
+
+    Single-threaded: owned by the thread that runs the session.
+
+    Usage:
+        auto orders = std::make_unique<store::OrderTable<>>("NX");
+        fix44::NewOrderSingle::Builder order;
+        order.symbol("AAPL").side(Side::Buy).order_qty(Qty::from_int(100))
+             .price(FixedPrice::from_double(150.25))
+             .mint_cl_ord_id(*orders);               // Opens the entry
+        ...
+        void on_message(MsgTypeTag<'8'>, const ParsedMessage& er) noexcept {
+            if (const store::OrderEntry* o = orders->apply(er)) { ... }
+        }
+*/
+
+#pragma once
+
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+namespace nfx::store {
+
+inline constexpr uint32_t INVALID_ORDER = UINT32_MAX;
+
+// ============================================================================
+// Order Entry
+// ============================================================================
+
+/// State of one order, updated in place by OrderTable::apply()
+struct OrderEntry {
+    static constexpr size_t MAX_ID_LENGTH = 32;
+
+    char cl_ord_id[MAX_ID_LENGTH]{};
+    uint8_t id_length{0};
+    OrdStatus status{OrdStatus::PendingNew};
+    Side side{Side::Buy};
+    bool open{false};
+    bool external{false};          // Tracked by id, not minted
+    uint32_t generation{0};
+    Qty order_qty{};
+    Qty cum_qty{};
+    Qty leaves_qty{};
+    FixedPrice price{};
+    FixedPrice avg_px{};
+    uint64_t user_data{0};         // Free for the application
+
+    [[nodiscard]] std::string_view id() const noexcept { return {cl_ord_id, id_length}; }
+};
+
+/// Statuses after which no further reports are expected
+[[nodiscard]] constexpr bool is_terminal(OrdStatus status) noexcept {
+    return status == OrdStatus::Filled || status == OrdStatus::Canceled ||
+           status == OrdStatus::Rejected || status == OrdStatus::Expired;
+}
+
+// ============================================================================
+// Order Table
+// ============================================================================
+
+/// ClOrdID -> order state for up to Capacity open orders
+/// Members are inline arrays (Capacity = 4096 is ~0.5 MB): allocate the
+/// table on the heap.
+template <size_t Capacity = 4096>
+class OrderTable {
+    static_assert(Capacity > 0 && Capacity <= (size_t{1} << 20), "Slot must fit 5 hex digits");
+
+public:
+    static constexpr size_t MAX_PREFIX = 8;
+    static constexpr size_t SLOT_DIGITS = 5;
+    static constexpr size_t GENERATION_DIGITS = 6;
+    static constexpr uint32_t GENERATION_MASK = (uint32_t{1} << (4 * GENERATION_DIGITS)) - 1;
+
+    struct Stats {
+        uint64_t decoded{0};       // Found from a minted id
+        uint64_t hashed{0};        // Found through the Swiss table
+        uint64_t misses{0};        // Unknown ClOrdID
+        uint64_t opened{0};
+        uint64_t closed{0};
+    };
+
+    /// @param prefix Leads every minted ClOrdID (at most MAX_PREFIX chars);
+    ///        make it unique per session and day if ids must not repeat
+    explicit OrderTable(std::string_view prefix = "NX") noexcept
+        : prefix_length_{static_cast<uint8_t>(prefix.size() < MAX_PREFIX ? prefix.size() : MAX_PREFIX)} {
+        std::memcpy(prefix_.data(), prefix.data(), prefix_length_);
+        for (size_t i = 0; i < Capacity; ++i) free_[i] = static_cast<uint32_t>(Capacity - 1 - i);
+        free_count_ = Capacity;
+        ctrl_.fill(EMPTY);
+    }
+
+    OrderTable(const OrderTable&) = delete;
+    OrderTable& operator=(const OrderTable&) = delete;
+
+    // ========================================================================
+    // Opening Orders
+    // ========================================================================
+
+    /// Open an entry and mint its ClOrdID
+    /// @return The ClOrdID (stable until the slot is reused), empty if full
+    [[nodiscard]] std::string_view open(Side side, Qty order_qty, FixedPrice price = {}) noexcept {
+        const uint32_t slot = acquire(side, order_qty, price);
+        if (slot == INVALID_ORDER) [[unlikely]] return {};
+
+        OrderEntry& e = entries_[slot];
+        char* p = e.cl_ord_id;
+        std::memcpy(p, prefix_.data(), prefix_length_);
+        p += prefix_length_;
+        put_hex(p, slot, SLOT_DIGITS);
+        put_hex(p + SLOT_DIGITS, e.generation, GENERATION_DIGITS);
+        e.id_length = static_cast<uint8_t>(prefix_length_ + SLOT_DIGITS + GENERATION_DIGITS);
+        return e.id();
+    }
+
+    /// Open an entry under an id minted elsewhere
+    /// @return The slot, or INVALID_ORDER if full, the id is too long,
+    ///         already open, or in this table's minted format
+    uint32_t track(std::string_view cl_ord_id, Side side, Qty order_qty,
+                   FixedPrice price = {}) noexcept {
+        if (cl_ord_id.empty() || cl_ord_id.size() > OrderEntry::MAX_ID_LENGTH ||
+            looks_minted(cl_ord_id) || find_external(cl_ord_id, hash(cl_ord_id)) != INVALID_ORDER) {
+            return INVALID_ORDER;
+        }
+        const uint32_t slot = acquire(side, order_qty, price);
+        if (slot == INVALID_ORDER) [[unlikely]] return INVALID_ORDER;
+
+        OrderEntry& e = entries_[slot];
+        std::memcpy(e.cl_ord_id, cl_ord_id.data(), cl_ord_id.size());
+        e.id_length = static_cast<uint8_t>(cl_ord_id.size());
+        e.external = true;
+        insert_external(slot, hash(cl_ord_id));
+        return slot;
+    }
+
+    // ========================================================================
+    // Lookup and Update
+    // ========================================================================
+
+    /// Slot of the open order with cl_ord_id, or INVALID_ORDER
+    [[nodiscard]] NFX_HOT uint32_t find(std::string_view cl_ord_id) noexcept {
+        const uint32_t slot = decode(cl_ord_id);
+        if (slot != INVALID_ORDER) {
+            ++stats_.decoded;
+            return slot;
+        }
+        if (external_count_ != 0 && !looks_minted(cl_ord_id)) {
+            const uint32_t found = find_external(cl_ord_id, hash(cl_ord_id));
+            if (found != INVALID_ORDER) {
+                ++stats_.hashed;
+                return found;
+            }
+        }
+        ++stats_.misses;
+        return INVALID_ORDER;
+    }
+
+    /// Apply an ExecutionReport to its order (ClOrdID, else OrigClOrdID)
+    /// @return The updated entry, or nullptr for an unknown order
+    NFX_HOT const OrderEntry* apply(const ParsedMessage& report) noexcept {
+        uint32_t slot = find(report.get_string(tag::ClOrdID::value));
+        if (slot == INVALID_ORDER) {
+            const std::string_view orig = report.get_string(tag::OrigClOrdID::value);
+            if (orig.empty()) return nullptr;
+            slot = find(orig);
+            if (slot == INVALID_ORDER) return nullptr;
+        }
+
+        OrderEntry& e = entries_[slot];
+        if (const char status = report.get_char(tag::OrdStatus::value); status != '\0') {
+            e.status = static_cast<OrdStatus>(status);
+        }
+        if (report.has_field(tag::CumQty::value)) e.cum_qty = report.get_qty(tag::CumQty::value);
+        if (report.has_field(tag::LeavesQty::value)) e.leaves_qty = report.get_qty(tag::LeavesQty::value);
+        if (report.has_field(tag::AvgPx::value)) e.avg_px = report.get_price(tag::AvgPx::value);
+
+        if (is_terminal(e.status)) close(slot);
+        return &e;
+    }
+
+    /// Close an order (no more reports will be matched to it)
+    void close(uint32_t slot) noexcept {
+        if (slot >= Capacity || !entries_[slot].open) return;
+        OrderEntry& e = entries_[slot];
+        if (e.external) erase_external(slot, hash(e.id()));
+        e.open = false;
+        e.generation = (e.generation + 1) & GENERATION_MASK;
+        free_[free_count_++] = slot;
+        ++stats_.closed;
+    }
+
+    [[nodiscard]] OrderEntry& operator[](uint32_t slot) noexcept { return entries_[slot]; }
+    [[nodiscard]] const OrderEntry& operator[](uint32_t slot) const noexcept { return entries_[slot]; }
+
+    /// Call f(const OrderEntry&) for every open order
+    template <typename F>
+    void for_each_open(F&& f) const {
+        for (const OrderEntry& e : entries_) {
+            if (e.open) f(e);
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return Capacity - free_count_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+    [[nodiscard]] std::string_view prefix() const noexcept { return {prefix_.data(), prefix_length_}; }
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+private:
+    // Swiss table: bucket i holds a slot index; ctrl_[i] is EMPTY, DELETED
+    // or the low 7 hash bits. The first GROUP control bytes are mirrored
+    // past the end so a group load never wraps.
+    static constexpr size_t GROUP = 16;
+    static constexpr size_t BUCKETS = std::bit_ceil(Capacity * 2 < GROUP ? GROUP : Capacity * 2);
+    static constexpr size_t BUCKET_MASK = BUCKETS - 1;
+    static constexpr int8_t EMPTY = -128;
+    static constexpr int8_t DELETED = -2;
+
+    uint32_t acquire(Side side, Qty order_qty, FixedPrice price) noexcept {
+        if (free_count_ == 0) [[unlikely]] return INVALID_ORDER;
+        const uint32_t slot = free_[--free_count_];
+        OrderEntry& e = entries_[slot];
+        e.status = OrdStatus::PendingNew;
+        e.side = side;
+        e.open = true;
+        e.external = false;
+        e.order_qty = order_qty;
+        e.cum_qty = Qty{};
+        e.leaves_qty = order_qty;
+        e.price = price;
+        e.avg_px = FixedPrice{};
+        e.user_data = 0;
+        ++stats_.opened;
+        return slot;
+    }
+
+    // ------------------------------------------------------------------------
+    // Minted ids
+    // ------------------------------------------------------------------------
+
+    static constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    static constexpr std::array<uint8_t, 256> HEX_VALUES = [] {
+        std::array<uint8_t, 256> t{};
+        t.fill(0xFF);
+        for (uint8_t i = 0; i < 10; ++i) t['0' + i] = i;
+        for (uint8_t i = 0; i < 6; ++i) t['A' + i] = static_cast<uint8_t>(10 + i);
+        return t;
+    }();
+
+    static void put_hex(char* p, uint32_t value, size_t digits) noexcept {
+        for (size_t i = digits; i-- > 0; value >>= 4) p[i] = HEX_DIGITS[value & 0xF];
+    }
+
+    [[nodiscard]] bool looks_minted(std::string_view id) const noexcept {
+        return id.size() == size_t{prefix_length_} + SLOT_DIGITS + GENERATION_DIGITS &&
+               std::memcmp(id.data(), prefix_.data(), prefix_length_) == 0;
+    }
+
+    /// Slot of an open minted order, or INVALID_ORDER
+    [[nodiscard]] NFX_HOT uint32_t decode(std::string_view id) const noexcept {
+        if (!looks_minted(id)) return INVALID_ORDER;
+        const char* p = id.data() + prefix_length_;
+
+        uint8_t invalid = 0;
+        auto digits = [&p, &invalid](size_t count) noexcept {
+            uint32_t value = 0;
+            for (size_t i = 0; i < count; ++i) {
+                const uint8_t digit = HEX_VALUES[static_cast<uint8_t>(*p++)];
+                invalid |= digit;
+                value = (value << 4) | (digit & 0xF);
+            }
+            return value;
+        };
+        const uint32_t slot = digits(SLOT_DIGITS);
+        const uint32_t generation = digits(GENERATION_DIGITS);
+        if ((invalid & 0xF0) != 0 || slot >= Capacity) return INVALID_ORDER;
+
+        const OrderEntry& e = entries_[slot];
+        return e.open && !e.external && e.generation == generation ? slot : INVALID_ORDER;
+    }
+
+    // ------------------------------------------------------------------------
+    // Swiss table (external ids)
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] static uint64_t hash(std::string_view id) noexcept {
+        // fnv1a's low bits mix poorly on short keys: fold the high half in
+        const uint64_t h = util::fnv1a_hash64_runtime(id);
+        return h ^ (h >> 29);
+    }
+
+    [[nodiscard]] static int8_t h2(uint64_t h) noexcept { return static_cast<int8_t>(h & 0x7F); }
+
+    /// Bitmask of positions in the group at pos whose control byte is value
+    [[nodiscard]] uint32_t match(size_t pos, int8_t value) const noexcept {
+#if defined(__SSE2__) || defined(_M_X64)
+        const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl_.data() + pos));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP; ++i) mask |= uint32_t{ctrl_[pos + i] == value} << i;
+        return mask;
+#endif
+    }
+
+    void set_ctrl(size_t bucket, int8_t value) noexcept {
+        ctrl_[bucket] = value;
+        if (bucket < GROUP) ctrl_[BUCKETS + bucket] = value;
+    }
+
+    [[nodiscard]] uint32_t find_external(std::string_view id, uint64_t h) const noexcept {
+        size_t pos = (h >> 7) & BUCKET_MASK;
+        for (size_t probe = 1; probe <= BUCKETS / GROUP; ++probe) {
+            for (uint32_t m = match(pos, h2(h)); m != 0; m &= m - 1) {
+                const size_t bucket = (pos + static_cast<size_t>(std::countr_zero(m))) & BUCKET_MASK;
+                const uint32_t slot = buckets_[bucket];
+                if (entries_[slot].id() == id) return slot;
+            }
+            if (match(pos, EMPTY) != 0) return INVALID_ORDER;
+            pos = (pos + probe * GROUP) & BUCKET_MASK;  // Triangular: visits every group
+        }
+        return INVALID_ORDER;
+    }
+
+    void insert_external(uint32_t slot, uint64_t h) noexcept {
+        size_t pos = (h >> 7) & BUCKET_MASK;
+        for (size_t probe = 1;; ++probe) {
+            const uint32_t m = match(pos, EMPTY) | match(pos, DELETED);
+            if (m != 0) {
+                const size_t bucket = (pos + static_cast<size_t>(std::countr_zero(m))) & BUCKET_MASK;
+                if (ctrl_[bucket] == DELETED) --deleted_;
+                set_ctrl(bucket, h2(h));
+                buckets_[bucket] = slot;
+                ++external_count_;
+                return;
+            }
+            pos = (pos + probe * GROUP) & BUCKET_MASK;  // At most half full: terminates
+        }
+    }
+
+    void erase_external(uint32_t slot, uint64_t h) noexcept {
+        size_t pos = (h >> 7) & BUCKET_MASK;
+        for (size_t probe = 1; probe <= BUCKETS / GROUP; ++probe) {
+            for (uint32_t m = match(pos, h2(h)); m != 0; m &= m - 1) {
+                const size_t bucket = (pos + static_cast<size_t>(std::countr_zero(m))) & BUCKET_MASK;
+                if (buckets_[bucket] != slot) continue;
+                set_ctrl(bucket, DELETED);
+                --external_count_;
+                if (++deleted_ > BUCKETS / 4) rebuild_external();
+                return;
+            }
+            pos = (pos + probe * GROUP) & BUCKET_MASK;
+        }
+    }
+
+    /// Drop tombstones (they lengthen probes and never turn back into EMPTY)
+    void rebuild_external() noexcept {
+        ctrl_.fill(EMPTY);
+        deleted_ = 0;
+        external_count_ = 0;
+        for (uint32_t slot = 0; slot < Capacity; ++slot) {
+            const OrderEntry& e = entries_[slot];
+            if (e.open && e.external) insert_external(slot, hash(e.id()));
+        }
+    }
+
+    std::array<OrderEntry, Capacity> entries_{};
+    std::array<uint32_t, Capacity> free_{};
+    size_t free_count_{0};
+
+    alignas(16) std::array<int8_t, BUCKETS + GROUP> ctrl_{};
+    std::array<uint32_t, BUCKETS> buckets_{};
+    size_t external_count_{0};
+    size_t deleted_{0};
+
+    std::array<char, MAX_PREFIX> prefix_{};
+    uint8_t prefix_length_;
+    Stats stats_{};
+};
+
+} // namespace nfx::store
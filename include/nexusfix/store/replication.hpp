@@ -0,0 +1,553 @@
+/*
+    NexusFIX Session Replication
+
+    Keeps a hot standby's message store and seqnums in step with the
+    primary, so failover is a logon at the right seqnums instead of a
+    logon-and-resend cycle:
+
+        primary session thread                 standby process
+        persist_outbound() -> on_append()       ReplicationStandby::poll()
+        inbound_advanced() -> on_sequences()      -> store(seq, msg)
+        end of batch       -> flush()  ==link==>  -> next sender / target seq
+                              acks  <===========  <- Ack(applied position)
+
+    Frames are a 32-byte header plus, for appends, the message bytes. Every
+    frame takes the next stream position; the standby acknowledges the
+    last position it applied, so the primary knows how far behind the
+    standby is (lag()). Seqnum updates are coalesced into one frame per
+    flush; appends carry the seqnums too.
+
+    Replication is asynchronous: the session never waits for the standby.
+    A frame that does not fit the link is dropped and its position
+    skipped, which the standby sees as a gap: it marks itself stale and
+    must be resynchronised (resync() re-ships the primary's store) before
+    it can take over.
+
+    Links (IReplicationLink) move bytes without blocking:
+    - ShmReplicationLink: two byte rings in a shared mapping (same host)
+    - TcpReplicationLink: a non-blocking TCP socket (cross host,
+      transport/tcp_replication_link.hpp)
+
+    Usage:
+        // Primary
+        auto link = ShmReplicationLink::open({"/dev/shm/nfx-CLIENT", 1 << 22,
+                                              ReplicationRole::Primary});
+        ReplicationPublisher publisher{**link};
+        session.set_replicator(&publisher);
+
+        // Standby
+        auto link = ShmReplicationLink::open({"/dev/shm/nfx-CLIENT", 1 << 22,
+                                              ReplicationRole::Standby});
+        ReplicationStandby standby{**link, standby_store};
+        while (!primary_lost()) standby.poll();
+        standby.take_over(session);          // Store + seqnums, then logon
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#if !NFX_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nfx::store {
+
+// ============================================================================
+// Wire Format
+// ============================================================================
+
+enum class ReplicationFrameType : uint8_t {
+    Append = 1,      // Outbound message stored under seq
+    Sequences,       // Next sender / target seqnums
+    Reset,           // Store reset, seqnums back to 1
+    Ack              // Standby -> primary: position applied
+};
+
+/// Header of every frame; length payload bytes follow
+struct ReplicationFrame {
+    uint32_t length{0};
+    ReplicationFrameType type{ReplicationFrameType::Append};
+    uint8_t reserved[3]{};
+    uint32_t seq{0};
+    uint32_t next_sender{0};
+    uint32_t next_target{0};
+    uint32_t reserved2{0};
+    uint64_t position{0};      // Stream position, from 1
+};
+
+static_assert(sizeof(ReplicationFrame) == 32, "Replication frame header is 32 bytes");
+
+// ============================================================================
+// Link Interface
+// ============================================================================
+
+/// Non-blocking byte pipe between primary and standby, one per side
+class IReplicationLink {
+public:
+    virtual ~IReplicationLink() = default;
+
+    /// Queue one frame (header and payload) for the peer
+    /// @return false if it does not fit (nothing queued)
+    [[nodiscard]] virtual bool write(std::span<const char> header,
+                                     std::span<const char> payload) noexcept = 0;
+
+    /// Hand queued frames to the peer
+    /// @return false if the link has failed
+    virtual bool flush() noexcept = 0;
+
+    /// Copy bytes the peer has sent, without blocking
+    /// @return Bytes read, 0 if none
+    [[nodiscard]] virtual size_t read(std::span<char> buffer) noexcept = 0;
+
+    [[nodiscard]] virtual bool connected() const noexcept = 0;
+};
+
+enum class ReplicationRole : uint8_t {
+    Primary,     // Writes frames, reads acks
+    Standby      // Reads frames, writes acks
+};
+
+// ============================================================================
+// Shared-Memory Link
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint64_t REPLICATION_MAGIC = 0x4C5045524E584E4EULL;  // "NNXNREPL"
+inline constexpr size_t REPLICATION_ACK_RING = 64 * 1024;
+
+/// Cursors of one byte ring; each on its own cache line
+struct alignas(64) ShmRingCursors {
+    alignas(64) uint64_t tail;   // Bytes published by the writer
+    alignas(64) uint64_t head;   // Bytes consumed by the reader
+};
+
+struct ShmLinkHeader {
+    uint64_t magic;
+    uint64_t frame_capacity;     // Primary -> standby ring bytes
+    uint64_t ack_capacity;       // Standby -> primary ring bytes
+    uint64_t reserved[5];
+    ShmRingCursors frames;
+    ShmRingCursors acks;
+};
+
+inline constexpr size_t SHM_LINK_HEADER_SIZE = 4096;
+static_assert(sizeof(ShmLinkHeader) <= SHM_LINK_HEADER_SIZE);
+
+}  // namespace detail
+
+/// Both directions of a primary/standby pair in one shared file mapping
+/// (e.g. under /dev/shm). Each ring is single-producer single-consumer:
+/// write() fills behind the published tail, flush() publishes it with a
+/// release store. POSIX only: open() fails with OpenFailed elsewhere.
+class ShmReplicationLink final : public IReplicationLink {
+public:
+    struct Config {
+        std::string path;
+        size_t capacity{4 * 1024 * 1024};    // Frame ring bytes (power of 2)
+        ReplicationRole role{ReplicationRole::Primary};
+    };
+
+    /// Map (creating if needed) the shared file; the first side to open
+    /// it sizes the rings
+    [[nodiscard]] static StoreResult<std::unique_ptr<ShmReplicationLink>>
+        open(const Config& config) noexcept
+    {
+        if (config.path.empty() || !std::has_single_bit(config.capacity)) {
+            return std::unexpected(StoreError{StoreErrorCode::InvalidConfig});
+        }
+#if NFX_PLATFORM_WINDOWS
+        return std::unexpected(StoreError{StoreErrorCode::OpenFailed, ENOSYS});
+#else
+        const size_t size = detail::SHM_LINK_HEADER_SIZE + config.capacity +
+                            detail::REPLICATION_ACK_RING;
+        const int fd = ::open(config.path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected(StoreError{StoreErrorCode::OpenFailed, err});
+        }
+        if (static_cast<size_t>(st.st_size) < size &&
+            ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected(StoreError{StoreErrorCode::ResizeFailed, err});
+        }
+
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int map_errno = errno;
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            return std::unexpected(StoreError{StoreErrorCode::MapFailed, map_errno});
+        }
+
+        auto* header = static_cast<detail::ShmLinkHeader*>(ptr);
+        std::atomic_ref magic{header->magic};
+        if (magic.load(std::memory_order_acquire) == 0) {
+            header->frame_capacity = config.capacity;
+            header->ack_capacity = detail::REPLICATION_ACK_RING;
+            magic.store(detail::REPLICATION_MAGIC, std::memory_order_release);
+        } else if (magic.load(std::memory_order_acquire) != detail::REPLICATION_MAGIC ||
+                   header->frame_capacity != config.capacity ||
+                   header->ack_capacity != detail::REPLICATION_ACK_RING) {
+            ::munmap(ptr, size);
+            return std::unexpected(StoreError{StoreErrorCode::Corrupt});
+        }
+
+        std::unique_ptr<ShmReplicationLink> link{
+            new (std::nothrow) ShmReplicationLink(header, size, config.role)};
+        if (!link) {
+            ::munmap(ptr, size);
+            return std::unexpected(StoreError{StoreErrorCode::MapFailed, ENOMEM});
+        }
+        return link;
+#endif
+    }
+
+    ~ShmReplicationLink() override {
+#if !NFX_PLATFORM_WINDOWS
+        ::munmap(header_, mapped_size_);
+#endif
+    }
+
+    ShmReplicationLink(const ShmReplicationLink&) = delete;
+    ShmReplicationLink& operator=(const ShmReplicationLink&) = delete;
+
+    [[nodiscard]] bool write(std::span<const char> header,
+                             std::span<const char> payload) noexcept override {
+        const uint64_t need = header.size() + payload.size();
+        if (pending_tail_ + need - out_.head() > out_.capacity) {
+            return false;
+        }
+        out_.copy_in(pending_tail_, header);
+        out_.copy_in(pending_tail_ + header.size(), payload);
+        pending_tail_ += need;
+        return true;
+    }
+
+    bool flush() noexcept override {
+        std::atomic_ref{out_.cursors->tail}.store(pending_tail_, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] size_t read(std::span<char> buffer) noexcept override {
+        const uint64_t head = std::atomic_ref{in_.cursors->head}.load(std::memory_order_relaxed);
+        const uint64_t tail = std::atomic_ref{in_.cursors->tail}.load(std::memory_order_acquire);
+        const size_t n = static_cast<size_t>(std::min<uint64_t>(tail - head, buffer.size()));
+        if (n == 0) return 0;
+        in_.copy_out(head, buffer.first(n));
+        std::atomic_ref{in_.cursors->head}.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    [[nodiscard]] bool connected() const noexcept override { return true; }
+
+private:
+    /// One direction: cursors plus data bytes
+    struct Ring {
+        detail::ShmRingCursors* cursors;
+        char* data;
+        uint64_t capacity;
+
+        [[nodiscard]] uint64_t head() const noexcept {
+            return std::atomic_ref{cursors->head}.load(std::memory_order_acquire);
+        }
+
+        void copy_in(uint64_t pos, std::span<const char> bytes) noexcept {
+            const size_t offset = static_cast<size_t>(pos & (capacity - 1));
+            const size_t first = std::min<size_t>(bytes.size(), capacity - offset);
+            std::memcpy(data + offset, bytes.data(), first);
+            std::memcpy(data, bytes.data() + first, bytes.size() - first);
+        }
+
+        void copy_out(uint64_t pos, std::span<char> bytes) const noexcept {
+            const size_t offset = static_cast<size_t>(pos & (capacity - 1));
+            const size_t first = std::min<size_t>(bytes.size(), capacity - offset);
+            std::memcpy(bytes.data(), data + offset, first);
+            std::memcpy(bytes.data() + first, data, bytes.size() - first);
+        }
+    };
+
+    ShmReplicationLink(detail::ShmLinkHeader* header, size_t mapped_size, ReplicationRole role) noexcept
+        : header_{header}, mapped_size_{mapped_size}
+    {
+        char* base = reinterpret_cast<char*>(header) + detail::SHM_LINK_HEADER_SIZE;
+        Ring frames{&header->frames, base, header->frame_capacity};
+        Ring acks{&header->acks, base + header->frame_capacity, header->ack_capacity};
+        out_ = role == ReplicationRole::Primary ? frames : acks;
+        in_ = role == ReplicationRole::Primary ? acks : frames;
+        pending_tail_ = std::atomic_ref{out_.cursors->tail}.load(std::memory_order_acquire);
+    }
+
+    detail::ShmLinkHeader* header_;
+    size_t mapped_size_;
+    Ring out_{};
+    Ring in_{};
+    uint64_t pending_tail_{0};     // Written, not yet published by flush()
+};
+
+// ============================================================================
+// Primary: Replication Publisher
+// ============================================================================
+
+/// Encodes store appends and seqnum changes into frames on the session
+/// thread; SessionManager::set_replicator() wires it in
+class ReplicationPublisher {
+public:
+    struct Stats {
+        uint64_t appends{0};
+        uint64_t sequence_updates{0};   // Sequences frames (coalesced)
+        uint64_t bytes{0};
+        uint64_t dropped{0};            // Frames that did not fit the link
+        uint64_t acks{0};
+    };
+
+    explicit ReplicationPublisher(IReplicationLink& link) noexcept : link_{link} {}
+
+    ReplicationPublisher(const ReplicationPublisher&) = delete;
+    ReplicationPublisher& operator=(const ReplicationPublisher&) = delete;
+
+    /// An outbound message was stored under seq
+    void on_append(uint32_t seq, std::span<const char> msg, uint32_t next_sender) noexcept {
+        next_sender_ = next_sender;
+        sequences_dirty_ = false;      // The append carries them
+        ReplicationFrame frame{static_cast<uint32_t>(msg.size()), ReplicationFrameType::Append,
+                               {}, seq, next_sender_, next_target_, 0, 0};
+        if (emit(frame, msg)) ++stats_.appends;
+    }
+
+    /// Seqnums moved without an append (inbound traffic, resets)
+    void on_sequences(uint32_t next_sender, uint32_t next_target) noexcept {
+        sequences_dirty_ |= next_sender != next_sender_ || next_target != next_target_;
+        next_sender_ = next_sender;
+        next_target_ = next_target;
+    }
+
+    /// The session's store was reset (new sequence run)
+    void on_reset() noexcept {
+        next_sender_ = next_target_ = 1;
+        sequences_dirty_ = false;
+        (void)emit(ReplicationFrame{0, ReplicationFrameType::Reset, {}, 0, 1, 1, 0, 0}, {});
+    }
+
+    /// Ship coalesced seqnums and queued frames, then read acks
+    bool flush() noexcept {
+        if (sequences_dirty_) {
+            sequences_dirty_ = false;
+            ReplicationFrame frame{0, ReplicationFrameType::Sequences, {}, 0,
+                                   next_sender_, next_target_, 0, 0};
+            if (emit(frame, {})) ++stats_.sequence_updates;
+        }
+        const bool ok = link_.flush();
+        (void)poll_acks();
+        return ok;
+    }
+
+    /// Re-ship a store from the start: Reset, every stored message, seqnums
+    /// For a standby that is stale or attaching late. The link must have
+    /// room for the whole store.
+    /// @return false if a frame was dropped
+    bool resync(const IMessageStore& store, uint32_t next_sender, uint32_t next_target) noexcept {
+        const uint64_t dropped = stats_.dropped;
+        on_reset();
+        if (next_sender > 1) {
+            (void)store.for_each_in_range(1, next_sender - 1,
+                [this, next_sender](uint32_t seq, std::span<const char> msg) {
+                    on_append(seq, msg, next_sender);
+                });
+        }
+        next_sender_ = next_sender;
+        on_sequences(next_sender, next_target);
+        sequences_dirty_ = true;
+        (void)flush();
+        return stats_.dropped == dropped;
+    }
+
+    /// Read acks the standby has sent
+    /// @return Acks read
+    size_t poll_acks() noexcept {
+        size_t acks = 0;
+        for (;;) {
+            const size_t n = link_.read(std::span<char>{ack_buffer_}.subspan(ack_used_));
+            if (n == 0) break;
+            ack_used_ += n;
+            const size_t whole = ack_used_ / sizeof(ReplicationFrame);
+            for (size_t i = 0; i < whole; ++i) {
+                ReplicationFrame ack;
+                std::memcpy(&ack, ack_buffer_.data() + i * sizeof(ack), sizeof(ack));
+                if (ack.type == ReplicationFrameType::Ack && ack.position > acked_) {
+                    acked_ = ack.position;
+                }
+            }
+            const size_t used = whole * sizeof(ReplicationFrame);
+            std::memmove(ack_buffer_.data(), ack_buffer_.data() + used, ack_used_ - used);
+            ack_used_ -= used;
+            acks += whole;
+        }
+        stats_.acks += acks;
+        return acks;
+    }
+
+    /// Last stream position written
+    [[nodiscard]] uint64_t position() const noexcept { return position_; }
+    /// Last position the standby has applied
+    [[nodiscard]] uint64_t acked() const noexcept { return acked_; }
+    /// Frames the standby has yet to apply
+    [[nodiscard]] uint64_t lag() const noexcept { return position_ - acked_; }
+    /// No frame dropped since construction (or the last successful resync())
+    [[nodiscard]] bool in_sync() const noexcept { return stats_.dropped == dropped_at_sync_; }
+
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+private:
+    bool emit(ReplicationFrame frame, std::span<const char> payload) noexcept {
+        frame.position = ++position_;
+        if (frame.type == ReplicationFrameType::Reset) dropped_at_sync_ = stats_.dropped;
+        const std::span<const char> header{reinterpret_cast<const char*>(&frame), sizeof(frame)};
+        if (!link_.write(header, payload)) [[unlikely]] {
+            ++stats_.dropped;
+            return false;
+        }
+        stats_.bytes += sizeof(frame) + payload.size();
+        return true;
+    }
+
+    IReplicationLink& link_;
+    uint64_t position_{0};
+    uint64_t acked_{0};
+    uint64_t dropped_at_sync_{0};
+    uint32_t next_sender_{1};
+    uint32_t next_target_{1};
+    bool sequences_dirty_{false};
+    std::array<char, 64 * sizeof(ReplicationFrame)> ack_buffer_{};
+    size_t ack_used_{0};
+    Stats stats_;
+};
+
+// ============================================================================
+// Standby: Replication Standby
+// ============================================================================
+
+/// Applies frames to the standby's own store and acknowledges them
+/// Single-threaded: poll() from one thread.
+class ReplicationStandby {
+public:
+    /// @param buffer_bytes Reassembly buffer; must hold the largest frame
+    ReplicationStandby(IReplicationLink& link, IMessageStore& store,
+                       size_t buffer_bytes = 256 * 1024)
+        : link_{link}, store_{store}, buffer_(buffer_bytes) {}
+
+    ReplicationStandby(const ReplicationStandby&) = delete;
+    ReplicationStandby& operator=(const ReplicationStandby&) = delete;
+
+    /// Apply every complete frame available and acknowledge them
+    /// @return Frames applied
+    size_t poll() noexcept {
+        size_t applied = 0;
+        for (;;) {
+            const size_t n = link_.read(std::span<char>{buffer_}.subspan(used_));
+            used_ += n;
+
+            size_t offset = 0;
+            while (used_ - offset >= sizeof(ReplicationFrame)) {
+                ReplicationFrame frame;
+                std::memcpy(&frame, buffer_.data() + offset, sizeof(frame));
+                const size_t span = sizeof(frame) + frame.length;
+                if (span > buffer_.size()) [[unlikely]] {
+                    stale_ = true;     // Cannot reassemble: resync needed
+                    used_ = offset = 0;
+                    break;
+                }
+                if (used_ - offset < span) break;
+                apply(frame, {buffer_.data() + offset + sizeof(frame), frame.length});
+                offset += span;
+                ++applied;
+            }
+            std::memmove(buffer_.data(), buffer_.data() + offset, used_ - offset);
+            used_ -= offset;
+            if (n == 0) break;
+        }
+
+        if (applied != 0) {
+            const ReplicationFrame ack{0, ReplicationFrameType::Ack, {}, 0,
+                                       next_sender_, next_target_, 0, position_};
+            if (link_.write({reinterpret_cast<const char*>(&ack), sizeof(ack)}, {})) {
+                (void)link_.flush();
+            }
+        }
+        return applied;
+    }
+
+    /// Point session at the replicated store and seqnums (before its logon)
+    /// @return false if the standby is stale (resync first)
+    template <typename Session>
+    bool take_over(Session& session) noexcept {
+        if (stale_) return false;
+        session.set_message_store(&store_);
+        session.restore_sequences(next_sender_, next_target_);
+        return true;
+    }
+
+    [[nodiscard]] uint32_t next_sender_seq() const noexcept { return next_sender_; }
+    [[nodiscard]] uint32_t next_target_seq() const noexcept { return next_target_; }
+    /// Last stream position applied
+    [[nodiscard]] uint64_t position() const noexcept { return position_; }
+    /// A frame was lost: the replica may be missing messages
+    [[nodiscard]] bool stale() const noexcept { return stale_; }
+
+private:
+    void apply(const ReplicationFrame& frame, std::span<const char> payload) noexcept {
+        if (frame.type == ReplicationFrameType::Reset) {
+            store_.reset();
+            stale_ = false;
+        } else if (frame.position != position_ + 1) {
+            stale_ = true;
+        }
+        position_ = frame.position;
+
+        switch (frame.type) {
+            case ReplicationFrameType::Append:
+                (void)store_.store(frame.seq, payload);
+                break;
+            case ReplicationFrameType::Sequences:
+            case ReplicationFrameType::Reset:
+                break;
+            default:
+                return;
+        }
+        next_sender_ = frame.next_sender;
+        next_target_ = frame.next_target;
+        store_.set_next_sender_seq_num(next_sender_);
+        store_.set_next_target_seq_num(next_target_);
+    }
+
+    IReplicationLink& link_;
+    IMessageStore& store_;
+    std::vector<char> buffer_;
+    size_t used_{0};
+    uint64_t position_{0};
+    uint32_t next_sender_{1};
+    uint32_t next_target_{1};
+    bool stale_{false};
+};
+
+} // namespace nfx::store
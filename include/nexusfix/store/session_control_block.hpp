@@ -0,0 +1,261 @@
+/*
+    NexusFIX Session Control Block
+
+    One memory-mapped page per session holding the state a restart needs
+    before it can log on again:
+
+        <dir>/<session>.ctl   magic | version | next sender/target seq |
+                              last logon time | inbound gap list
+
+    Every field is updated in place with release stores, so the block is
+    current the moment a seqnum changes and survives a process crash
+    through the page cache; sync() adds power-loss durability. The gap
+    list is multi-field and published under a sequence counter (odd while
+    being written), like memory::Seqlock. Past CONTROL_MAX_GAPS ranges the
+    last slot spans the remainder: re-requesting a few seqnums is safe,
+    losing a gap is not.
+
+    Startup reads the page in O(1) instead of deriving seqnums from the
+    message journal. Single writer (the session thread); any thread may
+    read. POSIX only: open() fails with OpenFailed elsewhere.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/session/sequence.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <memory>
+#include <string>
+
+#if !NFX_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nfx::store {
+
+// ============================================================================
+// On-Disk Layout
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint64_t CONTROL_MAGIC = 0x4C5254434E584E4EULL;  // "NNXNCTRL"
+inline constexpr uint32_t CONTROL_VERSION = 1;
+inline constexpr size_t CONTROL_PAGE_SIZE = 4096;
+inline constexpr size_t CONTROL_MAX_GAPS = 500;
+
+struct ControlPage {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint32_t next_sender_seq;
+    uint32_t next_target_seq;
+    int64_t last_logon_ns;            // Unix epoch nanoseconds, 0 = never
+    uint64_t gap_sequence;            // Odd while gaps are being written
+    uint32_t gap_count;
+    uint32_t reserved2;
+    GapTracker::Gap gaps[CONTROL_MAX_GAPS];
+};
+
+static_assert(sizeof(ControlPage) <= CONTROL_PAGE_SIZE);
+
+}  // namespace detail
+
+// ============================================================================
+// Session Control Block
+// ============================================================================
+
+class SessionControlBlock {
+public:
+    struct Config {
+        std::string session_id;
+        std::string directory{"."};
+    };
+
+    /// Map (creating if needed) <directory>/<session_id>.ctl
+    [[nodiscard]] static StoreResult<std::unique_ptr<SessionControlBlock>>
+        open(const Config& config) noexcept
+    {
+        if (config.session_id.empty()) {
+            return std::unexpected(StoreError{StoreErrorCode::InvalidConfig});
+        }
+#if NFX_PLATFORM_WINDOWS
+        return std::unexpected(StoreError{StoreErrorCode::OpenFailed, ENOSYS});
+#else
+        const std::string path = config.directory + "/" + config.session_id + ".ctl";
+
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) return std::unexpected(StoreError{StoreErrorCode::OpenFailed, errno});
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected(StoreError{StoreErrorCode::OpenFailed, err});
+        }
+        if (static_cast<size_t>(st.st_size) < detail::CONTROL_PAGE_SIZE &&
+            ::ftruncate(fd, static_cast<off_t>(detail::CONTROL_PAGE_SIZE)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected(StoreError{StoreErrorCode::ResizeFailed, err});
+        }
+
+        void* ptr = ::mmap(nullptr, detail::CONTROL_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd, 0);
+        const int map_errno = errno;
+        ::close(fd);  // The mapping keeps the file
+        if (ptr == MAP_FAILED) {
+            return std::unexpected(StoreError{StoreErrorCode::MapFailed, map_errno});
+        }
+
+        auto* page = static_cast<detail::ControlPage*>(ptr);
+        const bool fresh = page->magic == 0;
+        if (!fresh && (page->magic != detail::CONTROL_MAGIC ||
+                       page->version != detail::CONTROL_VERSION ||
+                       page->gap_count > detail::CONTROL_MAX_GAPS)) {
+            ::munmap(ptr, detail::CONTROL_PAGE_SIZE);
+            return std::unexpected(StoreError{StoreErrorCode::Corrupt});
+        }
+
+        std::unique_ptr<SessionControlBlock> block{
+            new (std::nothrow) SessionControlBlock(page, !fresh)};
+        if (!block) {
+            ::munmap(ptr, detail::CONTROL_PAGE_SIZE);
+            return std::unexpected(StoreError{StoreErrorCode::MapFailed, ENOMEM});
+        }
+        if (fresh) {
+            block->reset();
+            std::atomic_ref{page->magic}.store(detail::CONTROL_MAGIC, std::memory_order_release);
+            block->sync();
+        }
+        return block;
+#endif
+    }
+
+    ~SessionControlBlock() {
+#if !NFX_PLATFORM_WINDOWS
+        ::munmap(page_, detail::CONTROL_PAGE_SIZE);
+#endif
+    }
+
+    SessionControlBlock(const SessionControlBlock&) = delete;
+    SessionControlBlock& operator=(const SessionControlBlock&) = delete;
+
+    /// True if the block existed before open() (state worth restoring)
+    [[nodiscard]] bool recovered() const noexcept { return recovered_; }
+
+    // ========================================================================
+    // Writer (session thread)
+    // ========================================================================
+
+    void set_next_sender_seq(uint32_t seq) noexcept {
+        std::atomic_ref{page_->next_sender_seq}.store(seq, std::memory_order_release);
+    }
+
+    void set_next_target_seq(uint32_t seq) noexcept {
+        std::atomic_ref{page_->next_target_seq}.store(seq, std::memory_order_release);
+    }
+
+    void set_last_logon_ns(int64_t unix_ns) noexcept {
+        std::atomic_ref{page_->last_logon_ns}.store(unix_ns, std::memory_order_release);
+    }
+
+    /// Publish the gap list as one versioned update
+    void save_gaps(const GapTracker& gaps) noexcept {
+        std::atomic_ref sequence{page_->gap_sequence};
+        const uint64_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const auto ranges = gaps.ranges();
+        const size_t count = std::min(ranges.size(), detail::CONTROL_MAX_GAPS);
+        for (size_t i = 0; i < count; ++i) {
+            // Overflow: the last slot covers every remaining range
+            const uint32_t end = i + 1 == count ? ranges.back().end : ranges[i].end;
+            std::atomic_ref{page_->gaps[i].begin}.store(ranges[i].begin, std::memory_order_relaxed);
+            std::atomic_ref{page_->gaps[i].end}.store(end, std::memory_order_relaxed);
+        }
+        std::atomic_ref{page_->gap_count}.store(static_cast<uint32_t>(count),
+                                                std::memory_order_relaxed);
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /// Fresh sequence run: seqnums back to 1, no gaps (logon time kept)
+    void reset() noexcept {
+        set_next_sender_seq(SequenceManager::INITIAL_SEQ_NUM);
+        set_next_target_seq(SequenceManager::INITIAL_SEQ_NUM);
+        save_gaps(GapTracker{});
+        std::atomic_ref{page_->version}.store(detail::CONTROL_VERSION, std::memory_order_relaxed);
+    }
+
+    /// msync the page (power-loss durability; process crashes need nothing)
+    void sync() noexcept {
+#if !NFX_PLATFORM_WINDOWS
+        (void)::msync(page_, detail::CONTROL_PAGE_SIZE, MS_SYNC);
+#endif
+    }
+
+    // ========================================================================
+    // Reader
+    // ========================================================================
+
+    [[nodiscard]] uint32_t next_sender_seq() const noexcept {
+        return std::atomic_ref{page_->next_sender_seq}.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint32_t next_target_seq() const noexcept {
+        return std::atomic_ref{page_->next_target_seq}.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] int64_t last_logon_ns() const noexcept {
+        return std::atomic_ref{page_->last_logon_ns}.load(std::memory_order_acquire);
+    }
+
+    /// Copy the last published gap list into gaps (replacing its contents)
+    void restore_gaps(GapTracker& gaps) const noexcept {
+        std::atomic_ref sequence{page_->gap_sequence};
+        for (;;) {
+            const uint64_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            GapTracker copy;
+            const uint32_t count = std::min<uint32_t>(
+                std::atomic_ref{page_->gap_count}.load(std::memory_order_relaxed),
+                static_cast<uint32_t>(detail::CONTROL_MAX_GAPS));
+            for (uint32_t i = 0; i < count; ++i) {
+                (void)copy.add_gap(
+                    std::atomic_ref{page_->gaps[i].begin}.load(std::memory_order_relaxed),
+                    std::atomic_ref{page_->gaps[i].end}.load(std::memory_order_relaxed));
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                gaps = copy;
+                return;
+            }
+        }
+    }
+
+    /// Restore seqnums into a SequenceManager
+    void restore_sequences(SequenceManager& sequences) const noexcept {
+        sequences.set_outbound(next_sender_seq());
+        sequences.set_inbound(next_target_seq());
+    }
+
+private:
+    SessionControlBlock(detail::ControlPage* page, bool recovered) noexcept
+        : page_{page}, recovered_{recovered} {}
+
+    detail::ControlPage* page_;
+    bool recovered_;
+};
+
+} // namespace nfx::store
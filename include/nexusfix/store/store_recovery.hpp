@@ -0,0 +1,198 @@
+/*
+    NexusFIX Parallel Store Recovery
+
+    Opens the MmapMessageStores of many sessions at process startup on a
+    pool of threads instead of one after another. Each open() maps the
+    journal and index, scans the unsynced tail and restores seqnums; with
+    hundreds of sessions that is the bulk of the time before the gateway
+    can accept logons.
+
+        configs[0..n) --> worker 0 --+
+                      --> worker 1 --+--> slot i: store | error, ready flag
+                      --> ...      --+         on_ready(i, result)
+
+    Workers claim sessions in config order from a shared counter, so the
+    first configs come up first: list the sessions that should log on
+    earliest at the front. Each session is published the moment its own
+    store is open (ready(i) with acquire, plus the on_ready callback on
+    the worker thread), so it can log on while the others are loading.
+    Tail records are checked against their FIX CheckSum (SIMD) unless
+    StoreRecoveryOptions::verify_tail_checksum is off.
+
+    Usage:
+        store::StoreRecovery recovery{std::move(configs)};
+        recovery.start([&](size_t i, const store::StoreRecovery::Result& r) {
+            if (r) ready_queue.push(i);   // Hand to the session thread
+        });
+        ...
+        auto& store = *recovery.result(i);   // Once ready(i)
+        session.set_message_store(store.get());
+        session.restore_sequences(store->get_next_sender_seq_num(),
+                                  store->get_next_target_seq_num());
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/mmap_message_store.hpp"
+#include "nexusfix/util/prefetch.hpp"   // CACHE_LINE_SIZE
+
+#if !NFX_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nfx::store {
+
+// ============================================================================
+// Store Recovery
+// ============================================================================
+
+struct StoreRecoveryOptions {
+    size_t threads = 0;                 // 0 = hardware concurrency
+    bool verify_tail_checksum = true;   // Applied to every config
+};
+
+/// Opens many persistent session stores concurrently at startup
+class StoreRecovery {
+public:
+    using Result = StoreResult<std::unique_ptr<MmapMessageStore>>;
+
+    /// Totals once every store is done (see wait())
+    struct Stats {
+        size_t recovered{0};                // Stores opened
+        size_t failed{0};                   // Stores whose open() failed
+        size_t tail_records{0};             // Records found past durable watermarks
+        uint64_t elapsed_ns{0};             // start() to the last store
+    };
+
+    explicit StoreRecovery(std::vector<MmapMessageStore::Config> configs,
+                           StoreRecoveryOptions options = {}) noexcept
+        : configs_{std::move(configs)}
+        , slots_{std::make_unique<Slot[]>(configs_.size())}
+        , options_{options}
+    {
+        for (auto& config : configs_) {
+            config.verify_tail_checksum = options_.verify_tail_checksum;
+        }
+    }
+
+    ~StoreRecovery() { wait(); }
+
+    StoreRecovery(const StoreRecovery&) = delete;
+    StoreRecovery& operator=(const StoreRecovery&) = delete;
+
+    /// Start the workers
+    /// @param on_ready Called as on_ready(index, const Result&) on a worker
+    ///        thread as each store finishes; must be safe to run
+    ///        concurrently with itself
+    /// @return false if already started or no thread could be started
+    template <typename OnReady>
+        requires std::is_invocable_v<OnReady&, size_t, const Result&>
+    [[nodiscard]] bool start(OnReady on_ready) {
+        if (!workers_.empty()) return false;
+        start_ = std::chrono::steady_clock::now();
+
+        const size_t hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+        const size_t count = std::min(options_.threads ? options_.threads : hw, configs_.size());
+        workers_.reserve(count);
+        try {
+            for (size_t i = 0; i < count; ++i) {
+                workers_.emplace_back([this, on_ready]() mutable { run(on_ready); });
+            }
+        } catch (...) {
+            // Threads already running finish the whole list on their own
+            if (workers_.empty()) return false;
+        }
+        return true;
+    }
+
+    /// Start with no callback; poll ready() or wait()
+    [[nodiscard]] bool start() {
+        return start([](size_t, const Result&) noexcept {});
+    }
+
+    /// Block until every store is done
+    void wait() noexcept {
+        for (auto& worker : workers_) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    /// Store i has been opened (or failed); result(i) is then safe to read
+    [[nodiscard]] bool ready(size_t i) const noexcept {
+        return slots_[i].ready.load(std::memory_order_acquire);
+    }
+
+    /// Outcome of store i, valid once ready(i); move the store out to own it
+    [[nodiscard]] Result& result(size_t i) noexcept { return *slots_[i].result; }
+
+    /// Stores done so far, failures included
+    [[nodiscard]] size_t completed() const noexcept {
+        return completed_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool done() const noexcept { return completed() == configs_.size(); }
+    [[nodiscard]] size_t size() const noexcept { return configs_.size(); }
+    [[nodiscard]] const MmapMessageStore::Config& config(size_t i) const noexcept { return configs_[i]; }
+
+    /// Totals over finished stores (complete after wait())
+    [[nodiscard]] Stats stats() const noexcept {
+        return Stats{recovered_.load(std::memory_order_relaxed),
+                     completed() - recovered_.load(std::memory_order_relaxed),
+                     tail_records_.load(std::memory_order_relaxed),
+                     elapsed_ns_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    struct alignas(util::CACHE_LINE_SIZE) Slot {
+        std::optional<Result> result;
+        std::atomic<bool> ready{false};
+    };
+
+    template <typename OnReady>
+    void run(OnReady& on_ready) {
+        for (;;) {
+            const size_t i = next_.fetch_add(1, std::memory_order_relaxed);
+            if (i >= configs_.size()) return;
+
+            Slot& slot = slots_[i];
+            slot.result.emplace(MmapMessageStore::open(configs_[i]));
+            if (const Result& r = *slot.result) {
+                recovered_.fetch_add(1, std::memory_order_relaxed);
+                tail_records_.fetch_add((*r)->recovered_tail(), std::memory_order_relaxed);
+            }
+            slot.ready.store(true, std::memory_order_release);
+            on_ready(i, *slot.result);
+
+            if (completed_.fetch_add(1, std::memory_order_acq_rel) + 1 == configs_.size()) {
+                elapsed_ns_.store(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start_).count()),
+                    std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<MmapMessageStore::Config> configs_;
+    std::unique_ptr<Slot[]> slots_;
+    StoreRecoveryOptions options_;
+    std::vector<std::thread> workers_;
+    std::chrono::steady_clock::time_point start_{};
+    std::atomic<size_t> next_{0};
+    std::atomic<size_t> completed_{0};
+    std::atomic<size_t> recovered_{0};
+    std::atomic<size_t> tail_records_{0};
+    std::atomic<uint64_t> elapsed_ns_{0};
+};
+
+}  // namespace nfx::store
+
+#endif  // !NFX_PLATFORM_WINDOWS
@@ -0,0 +1,324 @@
+/*
+    NexusFIX Symbol Registry
+
+    Interns instrument identifiers once, at subscription time, and hands
+    out dense uint32_t ids so everything downstream of the parser (books,
+    snapshot stores, fan-out rings) indexes arrays instead of hashing or
+    comparing strings on every update.
+
+        subscribe(35=V)  -> "AAPL" = 0, "MSFT" = 1, ...   (setup)
+        resolve("MSFT")  -> 1                             (hot path)
+
+    Both Symbol (55) and SecurityID (48) resolve to the same id when a
+    RelatedSym entry carries both. Keys are stored zero-padded in 32-byte
+    blocks so a comparison is one AVX2 (or two SSE2) compares; resolve()
+    checks a small cache of recently seen keys before the FNV-1a table,
+    which covers the handful of symbols that make up most of a feed.
+
+    Single writer: intern()/subscribe()/resolve() belong to one thread
+    (the market data session). find() and symbol() are safe from any
+    thread once setup is done.
+
+    Usage:
+        SymbolRegistry<> symbols;
+        symbols.subscribe(request);                    // 35=V RelatedSym group
+
+        const SymbolId id = symbols.resolve(msg.get_string(tag::Symbol::value));
+        if (id != INVALID_SYMBOL) books[id].apply(msg);
+*/
+
+#pragma once
+
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+namespace nfx::store {
+
+using SymbolId = uint32_t;
+
+inline constexpr SymbolId INVALID_SYMBOL = UINT32_MAX;
+
+// ============================================================================
+// Symbol Key
+// ============================================================================
+
+/// Identifier zero-padded to one 32-byte block (FIX values contain no NUL,
+/// so equal blocks mean equal strings)
+struct alignas(32) SymbolKey {
+    static constexpr size_t SIZE = 32;
+    static constexpr size_t MAX_LENGTH = SIZE - 1;
+
+    std::array<char, SIZE> bytes{};
+
+    /// @return false if value is empty or longer than MAX_LENGTH
+    [[nodiscard]] bool assign(std::string_view value) noexcept {
+        if (value.empty() || value.size() > MAX_LENGTH) return false;
+        bytes = {};
+        std::memcpy(bytes.data(), value.data(), value.size());
+        return true;
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        const void* end = std::memchr(bytes.data(), '\0', SIZE);
+        return {bytes.data(), end ? static_cast<size_t>(static_cast<const char*>(end) - bytes.data())
+                                  : SIZE};
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE bool operator==(const SymbolKey& other) const noexcept {
+#if NFX_HAS_AVX2
+        const __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(bytes.data()));
+        const __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(other.bytes.data()));
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) == -1;
+#elif defined(__SSE2__) || defined(_M_X64)
+        const auto* a = reinterpret_cast<const __m128i*>(bytes.data());
+        const auto* b = reinterpret_cast<const __m128i*>(other.bytes.data());
+        const __m128i eq = _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_load_si128(a), _mm_load_si128(b)),
+            _mm_cmpeq_epi8(_mm_load_si128(a + 1), _mm_load_si128(b + 1)));
+        return _mm_movemask_epi8(eq) == 0xFFFF;
+#else
+        return std::memcmp(bytes.data(), other.bytes.data(), SIZE) == 0;
+#endif
+    }
+};
+
+static_assert(sizeof(SymbolKey) == 32, "SymbolKey must be one 32-byte block");
+
+// ============================================================================
+// Symbol Registry
+// ============================================================================
+
+/// Symbol / SecurityID -> dense id map
+/// @tparam MaxSymbols Ids handed out (0 .. MaxSymbols-1)
+/// @tparam CacheSize Recently resolved keys checked before the hash table
+template <size_t MaxSymbols = 4096, size_t CacheSize = 8>
+class SymbolRegistry {
+    static_assert(MaxSymbols > 0 && MaxSymbols < UINT32_MAX, "MaxSymbols must fit a 32-bit id");
+    static_assert(CacheSize > 0, "At least one cache entry");
+
+    static constexpr size_t TABLE_SIZE = std::bit_ceil(MaxSymbols * 2);
+    static constexpr size_t TABLE_MASK = TABLE_SIZE - 1;
+
+public:
+    static constexpr size_t MAX_SYMBOL_LENGTH = SymbolKey::MAX_LENGTH;
+
+    SymbolRegistry() noexcept = default;
+
+    // Non-copyable (ids are only meaningful against one registry)
+    SymbolRegistry(const SymbolRegistry&) = delete;
+    SymbolRegistry& operator=(const SymbolRegistry&) = delete;
+
+    // ========================================================================
+    // Interning (setup / writer thread)
+    // ========================================================================
+
+    /// Id of symbol, assigning the next free one if it is new
+    /// @return INVALID_SYMBOL if full or the symbol is empty / too long
+    [[nodiscard]] SymbolId intern(std::string_view symbol) noexcept {
+        SymbolKey key;
+        if (!key.assign(symbol)) return INVALID_SYMBOL;
+
+        const uint32_t h = util::fnv1a_hash32_runtime(symbol);
+        size_t i = h & TABLE_MASK;
+        for (; symbol_table_[i] != 0; i = (i + 1) & TABLE_MASK) {
+            const SymbolId id = symbol_table_[i] - 1;
+            if (hashes_[id] == h && keys_[id] == key) return id;
+        }
+        if (count_ == MaxSymbols) return INVALID_SYMBOL;
+
+        const auto id = static_cast<SymbolId>(count_++);
+        keys_[id] = key;
+        hashes_[id] = h;
+        symbol_table_[i] = id + 1;
+        return id;
+    }
+
+    /// Intern symbol and make security_id (tag 48) resolve to the same id
+    /// An empty security_id is ignored; a SecurityID already bound to
+    /// another symbol keeps its first binding.
+    [[nodiscard]] SymbolId intern(std::string_view symbol, std::string_view security_id) noexcept {
+        const SymbolId id = intern(symbol);
+        if (id != INVALID_SYMBOL && !security_id.empty()) {
+            (void)alias(id, security_id);
+        }
+        return id;
+    }
+
+    /// Bind a SecurityID to an interned id
+    /// @return false if id is unknown, the value is too long, or it is bound elsewhere
+    bool alias(SymbolId id, std::string_view security_id) noexcept {
+        SymbolKey key;
+        if (id >= count_ || !key.assign(security_id)) return false;
+
+        const uint32_t h = util::fnv1a_hash32_runtime(security_id);
+        size_t i = h & TABLE_MASK;
+        for (; security_table_[i] != 0; i = (i + 1) & TABLE_MASK) {
+            const uint32_t a = security_table_[i] - 1;
+            if (security_hashes_[a] == h && security_keys_[a] == key) return security_ids_[a] == id;
+        }
+        if (security_count_ == MaxSymbols) return false;
+
+        const auto a = static_cast<uint32_t>(security_count_++);
+        security_keys_[a] = key;
+        security_hashes_[a] = h;
+        security_ids_[a] = id;
+        security_table_[i] = a + 1;
+        return true;
+    }
+
+    /// Intern every RelatedSym entry (55 with optional 48) of a MarketDataRequest (35=V)
+    /// @return Number of entries that have an id
+    size_t subscribe(const ParsedMessage& request) noexcept {
+        const auto count = request.get_int(tag::NoRelatedSym::value).value_or(0);
+        if (count <= 0) return 0;
+
+        size_t interned = 0;
+        parser::RelatedSymIterator it{request.raw(), static_cast<size_t>(count)};
+        while (it.has_next()) {
+            const RelatedSymbol sym = it.next();
+            if (intern(sym.symbol, sym.security_id) != INVALID_SYMBOL) ++interned;
+        }
+        return interned;
+    }
+
+    /// Intern a list of symbols (e.g. MarketDataRequest::Builder::symbols())
+    /// @return Number of symbols that have an id
+    size_t subscribe(std::span<const std::string_view> symbols) noexcept {
+        size_t interned = 0;
+        for (std::string_view s : symbols) {
+            if (intern(s) != INVALID_SYMBOL) ++interned;
+        }
+        return interned;
+    }
+
+    // ========================================================================
+    // Lookup
+    // ========================================================================
+
+    /// Id of an interned Symbol (any thread once setup is done)
+    [[nodiscard]] SymbolId find(std::string_view symbol) const noexcept {
+        SymbolKey key;
+        if (!key.assign(symbol)) return INVALID_SYMBOL;
+        return find_symbol(key, util::fnv1a_hash32_runtime(symbol));
+    }
+
+    /// Id bound to a SecurityID (any thread once setup is done)
+    [[nodiscard]] SymbolId find_security_id(std::string_view security_id) const noexcept {
+        SymbolKey key;
+        if (!key.assign(security_id)) return INVALID_SYMBOL;
+        return find_security(key, util::fnv1a_hash32_runtime(security_id));
+    }
+
+    /// Id of a Symbol, checking the hot-symbol cache first (writer thread)
+    [[nodiscard]] NFX_HOT SymbolId resolve(std::string_view symbol) noexcept {
+        SymbolKey key;
+        if (!key.assign(symbol)) [[unlikely]] return INVALID_SYMBOL;
+
+        for (size_t c = 0; c < CacheSize; ++c) {
+            if (cache_keys_[c] == key) {
+                ++cache_hits_;
+                return cache_ids_[c];
+            }
+        }
+
+        const SymbolId id = find_symbol(key, util::fnv1a_hash32_runtime(symbol));
+        if (id != INVALID_SYMBOL) {
+            // Round-robin replacement: a feed's hot set is small and stable
+            cache_keys_[cache_next_] = key;
+            cache_ids_[cache_next_] = id;
+            cache_next_ = (cache_next_ + 1) % CacheSize;
+        }
+        return id;
+    }
+
+    /// Id of a message's instrument: Symbol (55), else SecurityID (48)
+    [[nodiscard]] SymbolId resolve(const ParsedMessage& msg) noexcept {
+        const std::string_view symbol = msg.get_string(tag::Symbol::value);
+        if (!symbol.empty()) return resolve(symbol);
+        return find_security_id(msg.get_string(tag::SecurityID::value));
+    }
+
+    /// Map the per-message symbol dictionary of decoded MDEntry columns to ids
+    /// ids[k] is the registry id of cols.symbols[k] (INVALID_SYMBOL if unknown).
+    /// @return Number of dictionary entries mapped
+    template <size_t Capacity>
+    size_t resolve(const MDEntryColumns<Capacity>& cols, std::span<SymbolId> ids) noexcept {
+        const size_t n = std::min<size_t>(cols.symbol_count, ids.size());
+        for (size_t s = 0; s < n; ++s) {
+            ids[s] = resolve(cols.symbols[s]);
+        }
+        return n;
+    }
+
+    /// Interned Symbol of an id (empty if unknown)
+    [[nodiscard]] std::string_view symbol(SymbolId id) const noexcept {
+        return id < count_ ? keys_[id].view() : std::string_view{};
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Number of ids handed out
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+
+    [[nodiscard]] bool contains(SymbolId id) const noexcept { return id < count_; }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSymbols; }
+
+    /// resolve() calls answered by the hot-symbol cache
+    [[nodiscard]] uint64_t cache_hits() const noexcept { return cache_hits_; }
+
+private:
+    [[nodiscard]] SymbolId find_symbol(const SymbolKey& key, uint32_t h) const noexcept {
+        for (size_t i = h & TABLE_MASK; symbol_table_[i] != 0; i = (i + 1) & TABLE_MASK) {
+            const SymbolId id = symbol_table_[i] - 1;
+            if (hashes_[id] == h && keys_[id] == key) return id;
+        }
+        return INVALID_SYMBOL;
+    }
+
+    [[nodiscard]] SymbolId find_security(const SymbolKey& key, uint32_t h) const noexcept {
+        for (size_t i = h & TABLE_MASK; security_table_[i] != 0; i = (i + 1) & TABLE_MASK) {
+            const uint32_t a = security_table_[i] - 1;
+            if (security_hashes_[a] == h && security_keys_[a] == key) return security_ids_[a];
+        }
+        return INVALID_SYMBOL;
+    }
+
+    // Hot-symbol cache (writer only); empty keys never match a valid key
+    std::array<SymbolKey, CacheSize> cache_keys_{};
+    std::array<SymbolId, CacheSize> cache_ids_{};
+    size_t cache_next_{0};
+    uint64_t cache_hits_{0};
+
+    // Symbols (55): id -> key
+    std::array<SymbolKey, MaxSymbols> keys_{};
+    std::array<uint32_t, MaxSymbols> hashes_{};
+    std::array<SymbolId, TABLE_SIZE> symbol_table_{};     // id + 1, 0 = empty
+    size_t count_{0};
+
+    // SecurityIDs (48): alias -> key, id
+    std::array<SymbolKey, MaxSymbols> security_keys_{};
+    std::array<uint32_t, MaxSymbols> security_hashes_{};
+    std::array<SymbolId, MaxSymbols> security_ids_{};
+    std::array<uint32_t, TABLE_SIZE> security_table_{};   // alias + 1, 0 = empty
+    size_t security_count_{0};
+};
+
+} // namespace nfx::store
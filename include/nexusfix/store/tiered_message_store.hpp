@@ -0,0 +1,418 @@
+/*
+    NexusFIX Tiered Message Store
+
+    In-memory store that keeps a whole trading day resendable at a fraction
+    of MemoryMessageStore's footprint. Messages are grouped into segments
+    of consecutive sequence numbers:
+
+        cold (compressed)                  hot (raw)
+        [1..1024][1025..2048] ...  [..][..][open segment <- store()]
+
+    - store():     append to the open segment; seal it when full (O(1))
+    - compact():   compress sealed segments beyond hot_segments into the
+                   cold tier (store/lz_codec.hpp); call from idle time
+    - lookup:      binary search on segment first_seq; a cold hit
+                   decompresses only that segment (one-segment cache)
+
+    store() compacts inline only as backpressure, when more than
+    hot_segments sealed segments are waiting. Cold segments beyond
+    max_cold_bytes are dropped oldest first.
+
+    The compression dictionary is FIX_DICTIONARY followed by a sample of
+    this session's own traffic (CompIDs, symbols, accounts), taken from
+    the first segment compacted and frozen thereafter.
+*/
+
+#pragma once
+
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/lz_codec.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+namespace nfx::store {
+
+// ============================================================================
+// Tiered Message Store
+// ============================================================================
+
+class TieredMessageStore final : public IMessageStore {
+public:
+    struct Config {
+        std::string session_id;
+        size_t segment_messages = 1024;        // Seal after this many seqnums
+        size_t segment_bytes = 256 * 1024;     // ... or this many raw bytes
+        size_t hot_segments = 4;               // Sealed segments kept raw
+        size_t max_cold_bytes = 512 * 1024 * 1024;  // Compressed retention budget
+        size_t dictionary_sample = 4096;       // Session bytes added to the dictionary
+    };
+
+    /// Tier sizes for monitoring
+    struct TierMetrics {
+        size_t hot_segments{0};
+        size_t cold_segments{0};
+        size_t hot_bytes{0};              // Raw message bytes in the hot tier
+        size_t cold_bytes{0};             // Compressed bytes + per-message offsets
+        size_t cold_raw_bytes{0};         // What the cold tier would take raw
+        uint64_t compactions{0};
+        uint64_t decompressions{0};
+        uint64_t cold_evictions{0};       // Segments dropped over max_cold_bytes
+    };
+
+    explicit TieredMessageStore(Config config)
+        : config_(std::move(config))
+        , dictionary_(lz::FIX_DICTIONARY)
+    {
+        if (config_.segment_messages == 0) config_.segment_messages = 1;
+        if (config_.segment_bytes == 0) config_.segment_bytes = 1;
+    }
+
+    explicit TieredMessageStore(std::string_view session_id)
+        : TieredMessageStore(Config{.session_id = std::string(session_id)}) {}
+
+    // ========================================================================
+    // Message Storage
+    // ========================================================================
+
+    [[nodiscard]] bool store(uint32_t seq_num,
+                            std::span<const char> msg) noexcept override {
+        NFX_NO_ALLOC_REGION("TieredMessageStore::store");
+        std::unique_lock lock(mutex_);
+
+        if (msg.empty() || msg.size() > UINT32_MAX || seq_num == 0 ||
+            (last_seq_ != 0 && seq_num <= last_seq_)) {
+            counters_.failed();
+            return false;
+        }
+
+        if (segments_.empty() || !fits_open(seq_num, msg.size())) {
+            open_segment(seq_num);
+        }
+
+        Segment& open = segments_.back();
+        // Skipped seqnums (gap-filled) get empty ranges
+        open.ends.resize(seq_num - open.first_seq, static_cast<uint32_t>(open.data.size()));
+        open.data.insert(open.data.end(), msg.begin(), msg.end());
+        open.ends.push_back(static_cast<uint32_t>(open.data.size()));
+        open.last_seq = seq_num;
+        ++open.messages;
+        last_seq_ = seq_num;
+        ++count_;
+        hot_bytes_ += msg.size();
+
+        counters_.stored(msg.size());
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        std::shared_lock lock(mutex_);
+
+        const Segment* segment = find_segment(seq_num);
+        if (!segment) return std::nullopt;
+
+        if (!segment->compressed) {
+            auto msg = segment->message(seq_num, segment->data.data());
+            if (msg.empty()) return std::nullopt;
+            counters_.retrieved();
+            return std::vector<char>(msg.begin(), msg.end());
+        }
+
+        std::lock_guard cache_lock(cache_mutex_);
+        if (cache_first_seq_ != segment->first_seq) {
+            if (!inflate(*segment, cache_)) return std::nullopt;
+            cache_first_seq_ = segment->first_seq;
+        }
+        auto msg = segment->message(seq_num, cache_.data() + dictionary_.size());
+        if (msg.empty()) return std::nullopt;
+        counters_.retrieved();
+        return std::vector<char>(msg.begin(), msg.end());
+    }
+
+    /// Hot messages are visited in place; each cold segment in the range
+    /// is decompressed once into a scratch buffer
+    size_t visit_range(uint32_t begin_seq, uint32_t end_seq,
+                       RangeVisitor visitor, void* ctx) const noexcept override {
+        std::shared_lock lock(mutex_);
+        if (segments_.empty()) return 0;
+
+        const uint32_t actual_end = (end_seq == 0 || end_seq > last_seq_) ? last_seq_ : end_seq;
+        size_t visited = 0;
+        std::vector<char> scratch;
+
+        auto it = std::upper_bound(segments_.begin(), segments_.end(), begin_seq,
+            [](uint32_t seq, const Segment& s) { return seq < s.first_seq; });
+        if (it != segments_.begin()) --it;
+
+        for (; it != segments_.end() && it->first_seq <= actual_end; ++it) {
+            const char* base = it->data.data();
+            if (it->compressed) {
+                if (!inflate(*it, scratch)) continue;
+                base = scratch.data() + dictionary_.size();
+            }
+            const uint32_t last = std::min(it->last_seq, actual_end);
+            for (uint32_t seq = std::max(begin_seq, it->first_seq); seq <= last; ++seq) {
+                auto msg = it->message(seq, base);
+                if (msg.empty()) continue;
+                ++visited;
+                counters_.retrieved();
+                if (!visitor(ctx, seq, msg)) return visited;
+            }
+        }
+        return visited;
+    }
+
+    // ========================================================================
+    // Compaction
+    // ========================================================================
+
+    /// Compress up to max_segments sealed segments beyond the hot tier
+    /// @return Number of segments compressed
+    size_t compact(size_t max_segments = SIZE_MAX) noexcept {
+        std::unique_lock lock(mutex_);
+        return compact_locked(max_segments);
+    }
+
+    /// Sealed segments waiting for compact()
+    [[nodiscard]] size_t pending_compaction() const noexcept {
+        std::shared_lock lock(mutex_);
+        return pending_locked();
+    }
+
+    [[nodiscard]] TierMetrics tier_metrics() const noexcept {
+        std::shared_lock lock(mutex_);
+        TierMetrics metrics = metrics_;
+        metrics.hot_bytes = hot_bytes_;
+        metrics.cold_segments = cold_segments_;
+        metrics.hot_segments = segments_.size() - cold_segments_;
+        metrics.decompressions = decompressions_.load(std::memory_order_relaxed);
+        return metrics;
+    }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        next_sender_seq_.store(seq, std::memory_order_release);
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        next_target_seq_.store(seq, std::memory_order_release);
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return next_sender_seq_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return next_target_seq_.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Session Management
+    // ========================================================================
+
+    /// Drop both tiers; the trained dictionary is kept
+    void reset() noexcept override {
+        std::unique_lock lock(mutex_);
+        segments_.clear();
+        cold_segments_ = 0;
+        last_seq_ = 0;
+        count_ = 0;
+        hot_bytes_ = 0;
+        metrics_ = TierMetrics{};
+        {
+            std::lock_guard cache_lock(cache_mutex_);
+            cache_first_seq_ = 0;
+        }
+        next_sender_seq_.store(1, std::memory_order_release);
+        next_target_seq_.store(1, std::memory_order_release);
+        counters_.reset();
+    }
+
+    void flush() noexcept override {
+        // No-op: in-memory tiers
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return config_.session_id;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept override {
+        return counters_.snapshot();
+    }
+
+    /// Messages held in either tier
+    [[nodiscard]] size_t message_count() const noexcept {
+        std::shared_lock lock(mutex_);
+        return count_;
+    }
+
+    /// Current compression dictionary (FIX_DICTIONARY + session sample)
+    /// Changes only during the first compaction.
+    [[nodiscard]] std::string_view dictionary() const noexcept {
+        return dictionary_;
+    }
+
+private:
+    /// Consecutive seqnums [first_seq, last_seq]; message i spans
+    /// [ends[i-1], ends[i]) of the raw bytes, empty if never stored
+    struct Segment {
+        uint32_t first_seq{0};
+        uint32_t last_seq{0};
+        bool compressed{false};
+        uint32_t raw_size{0};           // Raw bytes (cold segments)
+        uint32_t messages{0};           // Stored (non-empty) entries
+        std::vector<uint32_t> ends;
+        std::vector<char> data;         // Raw bytes, or compressed block
+
+        [[nodiscard]] std::span<const char> message(uint32_t seq, const char* raw) const noexcept {
+            if (seq < first_seq || seq > last_seq) return {};
+            const size_t i = seq - first_seq;
+            const uint32_t begin = i == 0 ? 0 : ends[i - 1];
+            return {raw + begin, ends[i] - begin};
+        }
+    };
+
+    [[nodiscard]] bool fits_open(uint32_t seq_num, size_t size) const noexcept {
+        const Segment& open = segments_.back();
+        return seq_num - open.first_seq < config_.segment_messages &&
+               open.data.size() + size <= config_.segment_bytes;
+    }
+
+    /// Seal the open segment and start a new one at seq_num
+    void open_segment(uint32_t seq_num) noexcept {
+        // Backpressure: keep the raw backlog bounded
+        if (!segments_.empty() && pending_locked() + 1 > config_.hot_segments) {
+            (void)compact_locked(1);
+        }
+        Segment segment;
+        segment.first_seq = seq_num;
+        segment.last_seq = seq_num;
+        if (!spare_.empty()) {
+            segment.data = std::move(spare_.back());
+            spare_.pop_back();
+            segment.data.clear();
+        } else {
+            segment.data.reserve(config_.segment_bytes);
+        }
+        segment.ends.reserve(config_.segment_messages);
+        segments_.push_back(std::move(segment));
+    }
+
+    /// Sealed raw segments outside the hot tier
+    [[nodiscard]] size_t pending_locked() const noexcept {
+        // Cold segments are a prefix; the back segment is open
+        const size_t raw = segments_.size() - cold_segments_;
+        const size_t sealed = raw > 0 ? raw - 1 : 0;
+        return sealed > config_.hot_segments ? sealed - config_.hot_segments : 0;
+    }
+
+    size_t compact_locked(size_t max_segments) noexcept {
+        size_t done = 0;
+        for (size_t pending = pending_locked(); done < max_segments && pending > 0; --pending) {
+            Segment& segment = segments_[cold_segments_];
+
+            if (!dictionary_trained_) train_dictionary(segment);
+
+            std::vector<char> packed(lz::compress_bound(segment.data.size()));
+            const size_t size = lz::compress(dictionary_, segment.data, packed);
+            packed.resize(size);
+            packed.shrink_to_fit();
+
+            hot_bytes_ -= segment.data.size();
+            segment.raw_size = static_cast<uint32_t>(segment.data.size());
+            metrics_.cold_raw_bytes += segment.raw_size;
+            if (spare_.size() < 2) spare_.push_back(std::move(segment.data));
+            segment.data = std::move(packed);
+            segment.ends.shrink_to_fit();
+            segment.compressed = true;
+            ++cold_segments_;
+            metrics_.cold_bytes += cold_size(segment);
+            ++metrics_.compactions;
+            ++done;
+        }
+        evict_cold_locked();
+        return done;
+    }
+
+    /// Drop oldest cold segments over max_cold_bytes
+    void evict_cold_locked() noexcept {
+        while (metrics_.cold_bytes > config_.max_cold_bytes &&
+               !segments_.empty() && segments_.front().compressed) {
+            const Segment& oldest = segments_.front();
+            metrics_.cold_bytes -= cold_size(oldest);
+            metrics_.cold_raw_bytes -= oldest.raw_size;
+            count_ -= oldest.messages;
+            ++metrics_.cold_evictions;
+            --cold_segments_;
+            {
+                std::lock_guard cache_lock(cache_mutex_);
+                if (cache_first_seq_ == oldest.first_seq) cache_first_seq_ = 0;
+            }
+            segments_.pop_front();
+        }
+    }
+
+    [[nodiscard]] static size_t cold_size(const Segment& segment) noexcept {
+        return segment.data.size() + segment.ends.size() * sizeof(uint32_t);
+    }
+
+    /// Append the tail of a segment's raw bytes to the dictionary
+    /// (the end is closest to what later segments look like)
+    void train_dictionary(const Segment& segment) noexcept {
+        const size_t take = std::min(config_.dictionary_sample, segment.data.size());
+        dictionary_.append(segment.data.data() + segment.data.size() - take, take);
+        if (dictionary_.size() > lz::MAX_OFFSET) {
+            dictionary_.erase(0, dictionary_.size() - lz::MAX_OFFSET);
+        }
+        dictionary_trained_ = true;
+    }
+
+    [[nodiscard]] bool inflate(const Segment& segment, std::vector<char>& window) const noexcept {
+        if (!lz::decompress(dictionary_, segment.data, segment.raw_size, window)) return false;
+        decompressions_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    [[nodiscard]] const Segment* find_segment(uint32_t seq_num) const noexcept {
+        auto it = std::upper_bound(segments_.begin(), segments_.end(), seq_num,
+            [](uint32_t seq, const Segment& s) { return seq < s.first_seq; });
+        if (it == segments_.begin()) return nullptr;
+        --it;
+        return seq_num <= it->last_seq ? &*it : nullptr;
+    }
+
+    Config config_;
+    std::string dictionary_;
+    bool dictionary_trained_{false};
+
+    std::deque<Segment> segments_;                  // Ordered by first_seq
+    size_t cold_segments_{0};                       // Compressed prefix of segments_
+    std::vector<std::vector<char>> spare_;          // Recycled raw buffers
+    uint32_t last_seq_{0};
+    size_t count_{0};
+    size_t hot_bytes_{0};
+    TierMetrics metrics_;
+
+    // One-segment decompression cache for retrieve()
+    mutable std::mutex cache_mutex_;
+    mutable std::vector<char> cache_;
+    mutable uint32_t cache_first_seq_{0};
+
+    mutable std::atomic<uint64_t> decompressions_{0};
+
+    std::atomic<uint32_t> next_sender_seq_{1};
+    std::atomic<uint32_t> next_target_seq_{1};
+
+    mutable std::shared_mutex mutex_;
+    mutable StoreCounters counters_;
+};
+
+} // namespace nfx::store
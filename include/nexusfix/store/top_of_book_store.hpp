@@ -0,0 +1,272 @@
+/*
+    NexusFIX Top-of-Book Snapshot Store
+
+    Latest best bid/offer and last trade per symbol, written by the market
+    data session straight from parsed 35=W / 35=X messages and read
+    wait-free by any number of strategy threads - no queue in between.
+
+        subscribe("AAPL") -> id 3           (setup: symbol -> slot via SymbolRegistry)
+
+        market data thread:  apply(msg)     (35=W / 35=X -> slot 3 updated)
+        strategy threads:    read(3)        (seqlock read, retries on a torn copy)
+
+    Each slot is a memory::VersionedValue<TopOfBook> (Seqlock), so slots
+    sit on their own cache lines and readers can poll read_if_changed()
+    with the last version they saw. The writer keeps a private copy of
+    every book; a message updates the copy and publishes it once per
+    symbol, so readers never see half a message's update for a symbol.
+
+    Incremental refreshes are read as a top-of-book feed (MarketDepth=1):
+    New/Change replaces a side, Delete clears it, a trade replaces the
+    last trade. Symbols without a slot are ignored.
+
+    Single writer. subscribe() must not race apply(): call it at setup or
+    from the writer thread.
+
+    Usage (typed session hooks):
+        void on_message(MsgTypeTag<'W'>, const ParsedMessage& m) noexcept { books.apply(m); }
+        void on_message(MsgTypeTag<'X'>, const ParsedMessage& m) noexcept { books.apply(m); }
+*/
+
+#pragma once
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace nfx::store {
+
+// ============================================================================
+// Top of Book
+// ============================================================================
+
+/// Best bid/offer and last trade for one symbol (zero size = side empty)
+struct TopOfBook {
+    FixedPrice bid_px{};
+    Qty bid_size{};
+    FixedPrice ask_px{};
+    Qty ask_size{};
+    FixedPrice last_px{};
+    Qty last_size{};
+    uint32_t msg_seq_num{0};      // MsgSeqNum of the message that last changed it
+
+    [[nodiscard]] constexpr bool has_bid() const noexcept { return bid_size.raw != 0; }
+    [[nodiscard]] constexpr bool has_ask() const noexcept { return ask_size.raw != 0; }
+    [[nodiscard]] constexpr bool has_trade() const noexcept { return last_size.raw != 0; }
+};
+
+// ============================================================================
+// Top-of-Book Store
+// ============================================================================
+
+/// Seqlock-published top-of-book snapshots keyed by symbol
+/// @tparam MaxSymbols Symbol slots
+/// @tparam MaxEntries MDEntries decoded from one message
+template <size_t MaxSymbols = 1024, size_t MaxEntries = 256>
+class TopOfBookStore {
+public:
+    using SymbolId = store::SymbolId;
+    using Snapshot = typename memory::VersionedValue<TopOfBook>::Snapshot;
+
+    static constexpr SymbolId INVALID_SYMBOL = store::INVALID_SYMBOL;
+    static constexpr size_t MAX_SYMBOL_LENGTH = SymbolRegistry<MaxSymbols>::MAX_SYMBOL_LENGTH;
+
+    TopOfBookStore() noexcept = default;
+
+    // Non-copyable, non-movable (readers hold references to slots)
+    TopOfBookStore(const TopOfBookStore&) = delete;
+    TopOfBookStore& operator=(const TopOfBookStore&) = delete;
+
+    // ========================================================================
+    // Subscription (setup / writer thread)
+    // ========================================================================
+
+    /// Assign a slot to symbol (returns the existing slot if already subscribed)
+    /// @return Slot id, or INVALID_SYMBOL if full or the symbol is too long
+    [[nodiscard]] SymbolId subscribe(std::string_view symbol) noexcept {
+        return symbols_.intern(symbol);
+    }
+
+    /// Assign slots to every RelatedSym entry of a MarketDataRequest (35=V)
+    /// @return Number of entries that have a slot
+    size_t subscribe(const ParsedMessage& request) noexcept {
+        return symbols_.subscribe(request);
+    }
+
+    /// Slot of a subscribed symbol (INVALID_SYMBOL if none)
+    [[nodiscard]] SymbolId find(std::string_view symbol) const noexcept {
+        return symbols_.find(symbol);
+    }
+
+    /// Symbol of a slot
+    [[nodiscard]] std::string_view symbol(SymbolId id) const noexcept {
+        return symbols_.symbol(id);
+    }
+
+    /// Number of subscribed symbols
+    [[nodiscard]] size_t size() const noexcept { return symbols_.size(); }
+
+    /// Symbol -> slot map (slot ids are registry ids)
+    [[nodiscard]] const SymbolRegistry<MaxSymbols>& registry() const noexcept { return symbols_; }
+
+    // ========================================================================
+    // Writer API (market data session thread)
+    // ========================================================================
+
+    /// Apply a 35=W or 35=X message; other types are ignored
+    /// @return Number of symbols updated
+    NFX_HOT size_t apply(const ParsedMessage& msg) noexcept {
+        switch (msg.msg_type()) {
+            case 'W': return apply_snapshot(msg) ? 1 : 0;
+            case 'X': return apply_incremental(msg);
+            default:  return 0;
+        }
+    }
+
+    /// Replace a symbol's book from MarketDataSnapshotFullRefresh (35=W)
+    /// @return false if the symbol has no slot
+    bool apply_snapshot(const ParsedMessage& msg) noexcept {
+        const std::string_view sym = msg.get_string(tag::Symbol::value);
+        const SymbolId id = symbols_.resolve(sym);
+        if (id == INVALID_SYMBOL) return false;
+
+        const size_t rows = decode(msg, tag::MDEntryType::value, sym);
+
+        TopOfBook book{};
+        for (size_t r = 0; r < rows; ++r) {
+            const FixedPrice px = columns_.price[r];
+            const Qty qty = columns_.size[r];
+            switch (columns_.entry_type[r]) {
+                case MDEntryType::Bid:
+                    if (!book.has_bid() || px.raw > book.bid_px.raw) {
+                        book.bid_px = px;
+                        book.bid_size = qty;
+                    }
+                    break;
+                case MDEntryType::Offer:
+                    if (!book.has_ask() || px.raw < book.ask_px.raw) {
+                        book.ask_px = px;
+                        book.ask_size = qty;
+                    }
+                    break;
+                case MDEntryType::Trade:
+                    book.last_px = px;
+                    book.last_size = qty;
+                    break;
+                default:
+                    break;
+            }
+        }
+        book.msg_seq_num = msg.msg_seq_num();
+
+        books_[id] = book;
+        slots_[id].write(book);
+        return true;
+    }
+
+    /// Apply MarketDataIncrementalRefresh (35=X) rows to their symbols
+    /// @return Number of symbols updated
+    size_t apply_incremental(const ParsedMessage& msg) noexcept {
+        const size_t rows = decode(msg, tag::MDUpdateAction::value, {});
+
+        // Resolve the message's symbol dictionary once, not per row
+        std::array<SymbolId, MDEntryColumns<MaxEntries>::MAX_SYMBOLS> ids;
+        symbols_.resolve(columns_, ids);
+
+        std::array<bool, MDEntryColumns<MaxEntries>::MAX_SYMBOLS> touched{};
+        for (size_t r = 0; r < rows; ++r) {
+            const uint16_t s = columns_.symbol_id[r];
+            if (s == MDEntryColumns<MaxEntries>::NO_SYMBOL) continue;
+            if (ids[s] == INVALID_SYMBOL) continue;
+
+            TopOfBook& book = books_[ids[s]];
+            const bool remove = columns_.update_action[r] == MDUpdateAction::Delete;
+            switch (columns_.entry_type[r]) {
+                case MDEntryType::Bid:
+                    book.bid_px = remove ? FixedPrice{} : columns_.price[r];
+                    book.bid_size = remove ? Qty{} : columns_.size[r];
+                    break;
+                case MDEntryType::Offer:
+                    book.ask_px = remove ? FixedPrice{} : columns_.price[r];
+                    book.ask_size = remove ? Qty{} : columns_.size[r];
+                    break;
+                case MDEntryType::Trade:
+                    if (remove) continue;
+                    book.last_px = columns_.price[r];
+                    book.last_size = columns_.size[r];
+                    break;
+                default:
+                    continue;
+            }
+            touched[s] = true;
+        }
+
+        // One publish per symbol
+        size_t updated = 0;
+        for (size_t s = 0; s < columns_.symbol_count; ++s) {
+            if (!touched[s]) continue;
+            TopOfBook& book = books_[ids[s]];
+            book.msg_seq_num = msg.msg_seq_num();
+            slots_[ids[s]].write(book);
+            ++updated;
+        }
+        return updated;
+    }
+
+    /// Publish a book built elsewhere (e.g. from a binary feed)
+    void publish(SymbolId id, const TopOfBook& book) noexcept {
+        if (!symbols_.contains(id)) return;
+        books_[id] = book;
+        slots_[id].write(book);
+    }
+
+    // ========================================================================
+    // Reader API (any thread, wait-free)
+    // ========================================================================
+
+    /// Latest book and its version
+    [[nodiscard]] Snapshot read(SymbolId id) const noexcept {
+        return slots_[id].read();
+    }
+
+    /// Copy the book only if it changed since version (updated on success)
+    [[nodiscard]] bool read_if_changed(SymbolId id, TopOfBook& out, uint64_t& version) const noexcept {
+        return slots_[id].read_if_changed(out, version);
+    }
+
+    /// True if the book changed since version
+    [[nodiscard]] bool changed_since(SymbolId id, uint64_t version) const noexcept {
+        return slots_[id].changed_since(version);
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSymbols; }
+
+private:
+    /// Decode the MDEntry group of msg into columns_
+    size_t decode(const ParsedMessage& msg, int delimiter, std::string_view symbol) noexcept {
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count <= 0) {
+            columns_.clear();
+            return 0;
+        }
+        return parser::decode_md_entries(msg.raw(), delimiter, static_cast<size_t>(count),
+                                         columns_, symbol);
+    }
+
+    // Reader-visible: one seqlock slot per symbol
+    std::array<memory::VersionedValue<TopOfBook>, MaxSymbols> slots_{};
+
+    // Writer-only state
+    std::array<TopOfBook, MaxSymbols> books_{};
+    SymbolRegistry<MaxSymbols> symbols_{};
+    MDEntryColumns<MaxEntries> columns_{};
+};
+
+} // namespace nfx::store
@@ -0,0 +1,404 @@
+/*
+    NexusFIX Trade Aggregate Store
+
+    Per-symbol trade statistics (OHLC, volume, VWAP, trade count) kept by
+    the market data session from parsed 35=X trade entries and read
+    wait-free by strategy threads, next to TopOfBookStore.
+
+        market data thread:  apply(msg, now_ns)   (35=X trades -> per-symbol batches)
+                                                  (batch -> bucket + session totals)
+                                                  (one seqlock publish per symbol)
+        strategy threads:    read(id)             (window + session stats)
+
+    Each symbol has a ring of Buckets time buckets of bucket_ns each; the
+    rolling window is the last Buckets buckets up to the newest timestamp
+    seen, so with the defaults (60 x 1s) it is the last minute. Session
+    totals run from subscribe() or reset() until the next reset().
+
+    A message's trade rows are first grouped by symbol into contiguous
+    price / size columns; high, low and volume of each group are then
+    reduced four rows at a time (AVX2) and notional is summed in 128 bits,
+    so VWAP = sum(px * qty) / sum(qty) is exact in FixedPrice units.
+
+    Only New trade rows with a size count (Change/Delete of a trade are
+    busts and corrections the venue reports separately). Timestamps come
+    from the caller, typically the receive time; they are clamped so the
+    window never moves backwards. Call advance() on a timer to expire
+    buckets of symbols that stopped trading.
+
+    Single writer. subscribe() and reset() must not race apply().
+
+    Usage (typed session hooks):
+        void on_message(MsgTypeTag<'X'>, const ParsedMessage& m) noexcept {
+            trades.apply(m, util::RdtscClock::now_ns());
+        }
+*/
+
+#pragma once
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#if NFX_HAS_AVX2
+    #include <immintrin.h>
+#endif
+
+namespace nfx::store {
+
+// ============================================================================
+// Trade Statistics
+// ============================================================================
+
+/// OHLC, volume and VWAP over some span of trades (zero trades = no data)
+struct TradeStats {
+    FixedPrice open{};
+    FixedPrice high{};
+    FixedPrice low{};
+    FixedPrice close{};
+    FixedPrice vwap{};
+    Qty volume{};
+    uint64_t trades{0};
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return trades == 0; }
+};
+
+/// Published per-symbol aggregates
+struct TradeAggregates {
+    TradeStats window{};          // Rolling window ending at updated_ns
+    TradeStats session{};         // Since subscribe() / reset()
+    uint64_t window_start_ns{0};  // Start of the oldest bucket in the window
+    uint64_t updated_ns{0};       // Timestamp of the last apply()/advance() publish
+    uint32_t msg_seq_num{0};      // MsgSeqNum of the last message with a trade
+};
+
+namespace detail {
+
+__extension__ using TradeInt128 = __int128;   // -Wpedantic: GCC/Clang extension
+
+/// Reduction of one contiguous batch of trades
+struct TradeBatch {
+    int64_t high{std::numeric_limits<int64_t>::min()};
+    int64_t low{std::numeric_limits<int64_t>::max()};
+    int64_t volume{0};
+    TradeInt128 notional{0};      // sum(px.raw * qty.raw)
+};
+
+/// High, low, volume and notional of px[0..n) / qty[0..n)
+[[nodiscard]] NFX_HOT inline TradeBatch reduce_trades(const int64_t* px, const int64_t* qty,
+                                                      size_t n) noexcept {
+    TradeBatch b{};
+    size_t i = 0;
+#if NFX_HAS_AVX2
+    if (n >= 8) {
+        __m256i hi = _mm256_set1_epi64x(b.high);
+        __m256i lo = _mm256_set1_epi64x(b.low);
+        __m256i vol = _mm256_setzero_si256();
+        for (; i + 4 <= n; i += 4) {
+            const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(px + i));
+            const __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(qty + i));
+            hi = _mm256_blendv_epi8(hi, p, _mm256_cmpgt_epi64(p, hi));
+            lo = _mm256_blendv_epi8(lo, p, _mm256_cmpgt_epi64(lo, p));
+            vol = _mm256_add_epi64(vol, q);
+        }
+        alignas(32) std::array<int64_t, 4> h, l, v;
+        _mm256_store_si256(reinterpret_cast<__m256i*>(h.data()), hi);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l.data()), lo);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(v.data()), vol);
+        for (size_t k = 0; k < 4; ++k) {
+            b.high = std::max(b.high, h[k]);
+            b.low = std::min(b.low, l[k]);
+            b.volume += v[k];
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        b.high = std::max(b.high, px[i]);
+        b.low = std::min(b.low, px[i]);
+        b.volume += qty[i];
+    }
+    // No 64x64 -> 128 multiply in AVX2: notional stays scalar
+    for (size_t k = 0; k < n; ++k) {
+        b.notional += static_cast<TradeInt128>(px[k]) * qty[k];
+    }
+    return b;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Trade Aggregate Store
+// ============================================================================
+
+/// Seqlock-published rolling-window trade statistics keyed by symbol
+/// @tparam MaxSymbols Symbol slots
+/// @tparam Buckets Time buckets in the rolling window
+/// @tparam MaxEntries MDEntries decoded from one message
+template <size_t MaxSymbols = 1024, size_t Buckets = 60, size_t MaxEntries = 256>
+class TradeAggregateStore {
+    static_assert(Buckets > 0, "At least one bucket");
+    static_assert(MaxEntries <= UINT16_MAX, "Row offsets are 16-bit");
+
+    using Columns = MDEntryColumns<MaxEntries>;
+    using Int128 = detail::TradeInt128;
+
+public:
+    using SymbolId = store::SymbolId;
+    using Snapshot = typename memory::VersionedValue<TradeAggregates>::Snapshot;
+
+    static constexpr SymbolId INVALID_SYMBOL = store::INVALID_SYMBOL;
+    static constexpr uint64_t DEFAULT_BUCKET_NS = 1'000'000'000ULL;
+
+    /// @param bucket_ns Width of one bucket (window = Buckets * bucket_ns)
+    explicit TradeAggregateStore(uint64_t bucket_ns = DEFAULT_BUCKET_NS) noexcept
+        : bucket_ns_{bucket_ns ? bucket_ns : DEFAULT_BUCKET_NS} {}
+
+    // Non-copyable, non-movable (readers hold references to slots)
+    TradeAggregateStore(const TradeAggregateStore&) = delete;
+    TradeAggregateStore& operator=(const TradeAggregateStore&) = delete;
+
+    // ========================================================================
+    // Subscription (setup / writer thread)
+    // ========================================================================
+
+    /// Assign a slot to symbol (returns the existing slot if already subscribed)
+    /// @return Slot id, or INVALID_SYMBOL if full or the symbol is too long
+    [[nodiscard]] SymbolId subscribe(std::string_view symbol) noexcept {
+        return symbols_.intern(symbol);
+    }
+
+    /// Assign slots to every RelatedSym entry of a MarketDataRequest (35=V)
+    /// @return Number of entries that have a slot
+    size_t subscribe(const ParsedMessage& request) noexcept {
+        return symbols_.subscribe(request);
+    }
+
+    /// Slot of a subscribed symbol (INVALID_SYMBOL if none)
+    [[nodiscard]] SymbolId find(std::string_view symbol) const noexcept {
+        return symbols_.find(symbol);
+    }
+
+    /// Symbol of a slot
+    [[nodiscard]] std::string_view symbol(SymbolId id) const noexcept {
+        return symbols_.symbol(id);
+    }
+
+    /// Number of subscribed symbols
+    [[nodiscard]] size_t size() const noexcept { return symbols_.size(); }
+
+    [[nodiscard]] const SymbolRegistry<MaxSymbols>& registry() const noexcept { return symbols_; }
+
+    [[nodiscard]] uint64_t bucket_ns() const noexcept { return bucket_ns_; }
+    [[nodiscard]] uint64_t window_ns() const noexcept { return bucket_ns_ * Buckets; }
+
+    // ========================================================================
+    // Writer API (market data session thread)
+    // ========================================================================
+
+    /// Fold the trade rows of a 35=X message into their symbols
+    /// @param now_ns Timestamp the trades are bucketed under
+    /// @return Number of symbols updated
+    NFX_HOT size_t apply(const ParsedMessage& msg, uint64_t now_ns) noexcept {
+        if (msg.msg_type() != 'X') return 0;
+        const size_t rows = decode(msg);
+        if (rows == 0) return 0;
+
+        std::array<SymbolId, Columns::MAX_SYMBOLS> ids;
+        symbols_.resolve(columns_, ids);
+
+        // Group trade rows by dictionary symbol, keeping message order
+        std::array<uint16_t, Columns::MAX_SYMBOLS + 1> offset{};
+        for (size_t r = 0; r < rows; ++r) {
+            if (counts(r, ids)) ++offset[columns_.symbol_id[r] + 1];
+        }
+        for (size_t s = 0; s < columns_.symbol_count; ++s) offset[s + 1] += offset[s];
+        std::array<uint16_t, Columns::MAX_SYMBOLS> fill;
+        std::copy_n(offset.begin(), Columns::MAX_SYMBOLS, fill.begin());
+        for (size_t r = 0; r < rows; ++r) {
+            if (!counts(r, ids)) continue;
+            const uint16_t k = fill[columns_.symbol_id[r]]++;
+            px_[k] = columns_.price[r].raw;
+            qty_[k] = columns_.size[r].raw;
+        }
+
+        const uint64_t index = advance_clock(now_ns);
+        size_t updated = 0;
+        for (size_t s = 0; s < columns_.symbol_count; ++s) {
+            const size_t begin = offset[s];
+            const size_t n = offset[s + 1] - begin;
+            if (n == 0) continue;
+
+            const detail::TradeBatch b = detail::reduce_trades(&px_[begin], &qty_[begin], n);
+            const Accum batch{px_[begin], b.high, b.low, px_[begin + n - 1],
+                              b.volume, b.notional, n, index};
+
+            State& st = state_[ids[s]];
+            Accum& bucket = st.buckets[index % Buckets];
+            if (bucket.index != index) bucket = Accum{.index = index};
+            bucket.merge(batch);
+            st.session.merge(batch);
+            st.msg_seq_num = msg.msg_seq_num();
+            publish(ids[s], index);
+            ++updated;
+        }
+        return updated;
+    }
+
+    /// Expire buckets that fell out of the window of symbols with no new trades
+    /// @return Number of symbols republished
+    size_t advance(uint64_t now_ns) noexcept {
+        const uint64_t index = advance_clock(now_ns);
+        size_t updated = 0;
+        for (SymbolId id = 0; id < symbols_.size(); ++id) {
+            const State& st = state_[id];
+            if (st.window_trades != 0 && st.oldest_index + Buckets <= index) {
+                publish(id, index);
+                ++updated;
+            }
+        }
+        return updated;
+    }
+
+    /// Clear a symbol's window and session totals (e.g. at the session roll)
+    void reset(SymbolId id) noexcept {
+        if (!symbols_.contains(id)) return;
+        state_[id] = State{};
+        slots_[id].write(TradeAggregates{});
+    }
+
+    // ========================================================================
+    // Reader API (any thread, wait-free)
+    // ========================================================================
+
+    /// Latest aggregates and their version
+    [[nodiscard]] Snapshot read(SymbolId id) const noexcept {
+        return slots_[id].read();
+    }
+
+    /// Copy the aggregates only if they changed since version (updated on success)
+    [[nodiscard]] bool read_if_changed(SymbolId id, TradeAggregates& out,
+                                       uint64_t& version) const noexcept {
+        return slots_[id].read_if_changed(out, version);
+    }
+
+    /// True if the aggregates changed since version
+    [[nodiscard]] bool changed_since(SymbolId id, uint64_t version) const noexcept {
+        return slots_[id].changed_since(version);
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSymbols; }
+
+private:
+    /// Running OHLC / volume / notional (raw FixedPrice and Qty units)
+    struct Accum {
+        int64_t open{0};
+        int64_t high{std::numeric_limits<int64_t>::min()};
+        int64_t low{std::numeric_limits<int64_t>::max()};
+        int64_t close{0};
+        int64_t volume{0};
+        Int128 notional{0};
+        uint64_t trades{0};
+        uint64_t index{0};        // Bucket index (now_ns / bucket_ns)
+
+        constexpr void merge(const Accum& o) noexcept {
+            if (o.trades == 0) return;
+            if (trades == 0) open = o.open;
+            high = std::max(high, o.high);
+            low = std::min(low, o.low);
+            close = o.close;
+            volume += o.volume;
+            notional += o.notional;
+            trades += o.trades;
+        }
+
+        [[nodiscard]] TradeStats stats() const noexcept {
+            if (trades == 0) return {};
+            return {FixedPrice{open}, FixedPrice{high}, FixedPrice{low}, FixedPrice{close},
+                    FixedPrice{volume ? static_cast<int64_t>(notional / volume) : 0},
+                    Qty{volume}, trades};
+        }
+    };
+
+    struct State {
+        std::array<Accum, Buckets> buckets{};
+        Accum session{};
+        uint64_t oldest_index{0};     // Oldest bucket in the last published window
+        uint64_t window_trades{0};    // Trades in the last published window
+        uint32_t msg_seq_num{0};
+    };
+
+    /// Row r is a New trade with a size for a subscribed symbol
+    [[nodiscard]] bool counts(size_t r, const std::array<SymbolId, Columns::MAX_SYMBOLS>& ids)
+        const noexcept {
+        const uint16_t s = columns_.symbol_id[r];
+        return columns_.entry_type[r] == MDEntryType::Trade &&
+               columns_.update_action[r] == MDUpdateAction::New &&
+               columns_.size[r].raw > 0 &&
+               s != Columns::NO_SYMBOL && ids[s] != INVALID_SYMBOL;
+    }
+
+    /// Bucket index of now_ns, never behind the newest seen
+    uint64_t advance_clock(uint64_t now_ns) noexcept {
+        clock_index_ = std::max(clock_index_, now_ns / bucket_ns_);
+        return clock_index_;
+    }
+
+    /// Merge the live buckets of id (oldest first) and publish
+    void publish(SymbolId id, uint64_t index) noexcept {
+        State& st = state_[id];
+        const uint64_t first = index >= Buckets - 1 ? index - (Buckets - 1) : 0;
+
+        Accum window{};
+        uint64_t oldest = index;
+        for (uint64_t i = first; i <= index; ++i) {
+            const Accum& bucket = st.buckets[i % Buckets];
+            if (bucket.index != i || bucket.trades == 0) continue;
+            if (window.trades == 0) oldest = i;
+            window.merge(bucket);
+        }
+        st.oldest_index = oldest;
+        st.window_trades = window.trades;
+
+        TradeAggregates out{};
+        out.window = window.stats();
+        out.session = st.session.stats();
+        out.window_start_ns = first * bucket_ns_;
+        out.updated_ns = index * bucket_ns_;
+        out.msg_seq_num = st.msg_seq_num;
+        slots_[id].write(out);
+    }
+
+    /// Decode the MDEntry group of msg into columns_
+    size_t decode(const ParsedMessage& msg) noexcept {
+        const auto count = msg.get_int(tag::NoMDEntries::value).value_or(0);
+        if (count <= 0) {
+            columns_.clear();
+            return 0;
+        }
+        return parser::decode_md_entries(msg.raw(), tag::MDUpdateAction::value,
+                                         static_cast<size_t>(count), columns_, {});
+    }
+
+    // Reader-visible: one seqlock slot per symbol
+    std::array<memory::VersionedValue<TradeAggregates>, MaxSymbols> slots_{};
+
+    // Writer-only state
+    std::array<State, MaxSymbols> state_{};
+    SymbolRegistry<MaxSymbols> symbols_{};
+    Columns columns_{};
+    std::array<int64_t, MaxEntries> px_{};      // Trade rows grouped by symbol
+    std::array<int64_t, MaxEntries> qty_{};
+    uint64_t bucket_ns_;
+    uint64_t clock_index_{0};
+};
+
+} // namespace nfx::store
@@ -0,0 +1,256 @@
+/*
+    NexusFIX Async Channel
+
+    co_await-able receive on top of the callback-driven io_uring reactor.
+    The reactor stays the only loop: AsyncChannel is an IReactorHandler
+    whose callbacks resume the coroutine waiting on it, inline, on the
+    reactor thread.
+
+        reactor.run_once()
+          -> on_message(span)      framed in the provided buffer
+          -> AsyncInbox::push()    waiter present: resume it with the span
+          -> coroutine runs        until its next co_await, then back here
+
+    A message is handed over without a copy when a coroutine is already
+    waiting (the usual case for a pump loop). Messages arriving while the
+    consumer is busy are copied into a fixed backlog buffer and returned
+    by the following recv()s in order. A span from recv() is valid until
+    the coroutine awaits again. recv() yields an empty span once the
+    channel has closed and the backlog is drained.
+
+    Usage:
+        AsyncChannel channel{reactor};
+        Task<void> run(AsyncChannel& channel, AsyncSession<App>& session) {
+            if (!co_await channel.connect("10.0.0.1", 9876)) co_return;
+            session.session().on_connect();
+            (void)session.session().initiate_logon();
+            co_await session.pump(channel);
+        }
+        ...
+        auto task = run(channel, session);
+        task.resume();                       // Runs to its first co_await
+        reactor.run(stop);                   // Completions resume it
+*/
+
+#pragma once
+
+#include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/transport/io_uring_reactor.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Async Inbox
+// ============================================================================
+
+/// Messages pushed by transport callbacks, awaited one at a time
+/// One consumer; push() and recv() run on the same thread.
+class AsyncInbox {
+public:
+    /// @param backlog_bytes Buffer for messages that arrive with no waiter
+    explicit AsyncInbox(size_t backlog_bytes = 64 * 1024)
+        : backlog_(backlog_bytes) {}
+
+    AsyncInbox(const AsyncInbox&) = delete;
+    AsyncInbox& operator=(const AsyncInbox&) = delete;
+
+    /// Deliver one complete message
+    /// Resumes the waiting coroutine with it (no copy), else copies it
+    /// into the backlog.
+    /// @return false if the backlog is full (message dropped)
+    bool push(std::span<const char> msg) noexcept {
+        if (waiter_) {
+            auto waiter = std::exchange(waiter_, nullptr);
+            waiter->result = msg;
+            waiter->handle.resume();
+            return true;
+        }
+        return enqueue(msg);
+    }
+
+    /// No more messages; a waiting recv() resumes with an empty span
+    void close() noexcept {
+        closed_ = true;
+        if (waiter_) {
+            auto waiter = std::exchange(waiter_, nullptr);
+            waiter->result = {};
+            waiter->handle.resume();
+        }
+    }
+
+    /// Accept messages again (e.g. on reconnect)
+    void reopen() noexcept { closed_ = false; }
+
+    struct RecvAwaiter {
+        AsyncInbox& inbox;
+        std::coroutine_handle<> handle{};
+        std::span<const char> result{};
+
+        bool await_ready() noexcept { return inbox.count_ != 0 || inbox.closed_; }
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            handle = h;
+            inbox.waiter_ = this;
+        }
+        std::span<const char> await_resume() noexcept {
+            return handle ? result : inbox.dequeue();
+        }
+    };
+
+    /// co_await: next message; empty once closed and drained
+    [[nodiscard]] RecvAwaiter recv() noexcept { return RecvAwaiter{*this}; }
+
+    /// Messages in the backlog
+    [[nodiscard]] size_t pending() const noexcept { return count_; }
+    [[nodiscard]] bool closed() const noexcept { return closed_; }
+    [[nodiscard]] uint64_t dropped() const noexcept { return dropped_; }
+
+private:
+    using Length = uint32_t;
+
+    bool enqueue(std::span<const char> msg) noexcept {
+        const size_t need = sizeof(Length) + msg.size();
+        if (tail_ + need > backlog_.size()) {
+            // Slide the unread bytes to the front (consumer is not holding them)
+            std::memmove(backlog_.data(), backlog_.data() + head_, tail_ - head_);
+            tail_ -= head_;
+            head_ = 0;
+            if (tail_ + need > backlog_.size()) {
+                ++dropped_;
+                return false;
+            }
+        }
+        const auto length = static_cast<Length>(msg.size());
+        std::memcpy(backlog_.data() + tail_, &length, sizeof(Length));
+        std::memcpy(backlog_.data() + tail_ + sizeof(Length), msg.data(), msg.size());
+        tail_ += need;
+        ++count_;
+        return true;
+    }
+
+    /// Oldest backlog message; its bytes stay put until the next push()
+    std::span<const char> dequeue() noexcept {
+        if (count_ == 0) return {};
+        Length length;
+        std::memcpy(&length, backlog_.data() + head_, sizeof(Length));
+        const char* data = backlog_.data() + head_ + sizeof(Length);
+        head_ += sizeof(Length) + length;
+        if (--count_ == 0) head_ = tail_ = 0;
+        return {data, length};
+    }
+
+    std::vector<char> backlog_;
+    size_t head_{0};
+    size_t tail_{0};
+    size_t count_{0};
+    uint64_t dropped_{0};
+    RecvAwaiter* waiter_{nullptr};
+    bool closed_{false};
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Async Channel
+// ============================================================================
+
+/// One reactor channel driven by coroutines
+/// Destroy only after on_closed() (close() and let the reactor finish).
+class AsyncChannel final : public IReactorHandler {
+public:
+    using ChannelId = IoUringReactor::ChannelId;
+
+    explicit AsyncChannel(IoUringReactor& reactor, size_t backlog_bytes = 64 * 1024)
+        : reactor_{reactor}, inbox_{backlog_bytes} {}
+
+    struct ConnectAwaiter {
+        AsyncChannel& channel;
+        std::string_view host;
+        uint16_t port;
+        std::coroutine_handle<> handle{};
+        std::optional<TransportError> error{};
+
+        bool await_ready() noexcept {
+            auto id = channel.reactor_.connect(host, port, channel);
+            if (!id) {
+                error = id.error();
+                return true;
+            }
+            channel.channel_ = *id;
+            channel.inbox_.reopen();
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            handle = h;
+            channel.connect_waiter_ = this;
+        }
+        TransportResult<void> await_resume() noexcept {
+            if (error) return std::unexpected{*error};
+            return {};
+        }
+    };
+
+    /// co_await: connect to host:port (resumes on connect or failure)
+    [[nodiscard]] ConnectAwaiter connect(std::string_view host, uint16_t port) noexcept {
+        return ConnectAwaiter{*this, host, port};
+    }
+
+    /// Adopt a connected socket (e.g. from an acceptor)
+    [[nodiscard]] TransportResult<void> attach(int fd) noexcept {
+        inbox_.reopen();
+        auto id = reactor_.attach(fd, *this);
+        if (!id) return std::unexpected{id.error()};
+        channel_ = *id;
+        return {};
+    }
+
+    /// co_await: next message; empty once the channel has closed
+    [[nodiscard]] AsyncInbox::RecvAwaiter recv() noexcept { return inbox_.recv(); }
+
+    [[nodiscard]] bool send(std::span<const char> data) noexcept {
+        return reactor_.send(channel_, data).has_value();
+    }
+
+    void close() noexcept { reactor_.close(channel_); }
+
+    [[nodiscard]] bool is_open() const noexcept { return reactor_.is_open(channel_); }
+    [[nodiscard]] ChannelId id() const noexcept { return channel_; }
+    [[nodiscard]] size_t pending() const noexcept { return inbox_.pending(); }
+
+    // IReactorHandler
+    void on_connected() noexcept override {
+        if (auto waiter = std::exchange(connect_waiter_, nullptr)) waiter->handle.resume();
+    }
+
+    void on_message(std::span<const char> message) noexcept override { (void)inbox_.push(message); }
+
+    void on_timer() noexcept override {}
+
+    void on_closed(const TransportError& error) noexcept override {
+        channel_ = IoUringReactor::INVALID_CHANNEL;
+        if (auto waiter = std::exchange(connect_waiter_, nullptr)) {
+            waiter->error = error.code == TransportErrorCode::None
+                ? TransportError{TransportErrorCode::ConnectionClosed}
+                : error;
+            waiter->handle.resume();
+        }
+        inbox_.close();
+    }
+
+private:
+    IoUringReactor& reactor_;
+    AsyncInbox inbox_;
+    ChannelId channel_{IoUringReactor::INVALID_CHANNEL};
+    ConnectAwaiter* connect_waiter_{nullptr};
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+}  // namespace nfx
@@ -120,6 +120,26 @@ public:
         return true;
     }
 
+#if NFX_IO_URING_SEND_ZC
+    /// Queue a zero-copy send from registered buffer buf_index
+    /// The buffer stays referenced until the ZeroCopyNotify completion
+    /// with the same user_data; release it only then.
+    [[nodiscard]] NFX_HOT
+    bool queue_send_zc_fixed(int fd, std::span<const char> data, uint16_t buf_index,
+                             void* user_data = nullptr) noexcept {
+        if (count_ >= MaxBatchSize) return false;
+
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) return false;
+
+        io_uring_prep_send_zc_fixed(sqe, fd, data.data(), data.size(), MSG_NOSIGNAL, 0, buf_index);
+        io_uring_sqe_set_data(sqe, user_data);
+
+        ++count_;
+        return true;
+    }
+#endif
+
     /// Queue a recv using registered buffer
     [[nodiscard]] NFX_HOT
     bool queue_recv_fixed(int fd, uint16_t buf_index, size_t len,
@@ -166,19 +186,26 @@ public:
     }
 
     /// Submit and wait for all completions
+    /// Zero-copy sends yield a second, ZeroCopyNotify event once the kernel
+    /// releases their buffer; it is waited for as well.
     /// @param completions Output buffer for completion results
     /// @return Number of completions, or negative error
     [[nodiscard]]
     int submit_and_wait(std::span<IoEvent> completions) noexcept {
-        int submitted = submit();
-        if (submitted <= 0) return submitted;
+        int expected = submit();
+        if (expected <= 0) return expected;
 
         int completed = 0;
-        while (completed < submitted && static_cast<size_t>(completed) < completions.size()) {
+        while (completed < expected && static_cast<size_t>(completed) < completions.size()) {
             struct io_uring_cqe* cqe;
             int ret = ctx_.wait(&cqe);
             if (ret < 0) break;
 
+            const bool notification = is_zero_copy_notification(cqe->flags);
+            if (!notification && ProvidedBufferGroup::has_more(cqe->flags)) ++expected;
+
+            completions[completed].op = notification ? IoOperation::ZeroCopyNotify
+                                                     : IoOperation::None;
             completions[completed].result = cqe->res;
             completions[completed].user_data = io_uring_cqe_get_data(cqe);
             ctx_.seen(cqe);
@@ -299,7 +326,9 @@ public:
     }
 
     /// Submit as a single writev operation
-    [[nodiscard]] bool submit(IoUringContext& ctx, int fd, void* user_data = nullptr) noexcept {
+    /// @param sqe_flags Extra SQE flags (e.g. IOSQE_IO_LINK to order writes)
+    [[nodiscard]] bool submit(IoUringContext& ctx, int fd, void* user_data = nullptr,
+                              unsigned sqe_flags = 0) noexcept {
         if (count_ == 0) return false;
 
         auto* sqe = ctx.get_sqe();
@@ -307,6 +336,7 @@ public:
 
         io_uring_prep_writev(sqe, fd, iovecs_.data(), static_cast<unsigned>(count_), 0);
         io_uring_sqe_set_data(sqe, user_data);
+        sqe->flags |= static_cast<uint8_t>(sqe_flags);
 
         count_ = 0;
         return true;
@@ -332,6 +362,36 @@ private:
     size_t count_;
 };
 
+/// Queue many buffers, in order, as linked writev SQEs of up to
+/// ScatterGatherSend::MAX_IOVECS buffers each (e.g. a resend replay)
+/// The caller submits once. Links keep the writes ordered on the socket;
+/// iovec arrays are read at submission, so sg must outlive the submit.
+/// @param sg One ScatterGatherSend per writev; must hold
+///        ceil(buffers.size() / MAX_IOVECS) entries
+/// @return Number of buffers queued (less than buffers.size() when the
+///         submission queue or sg runs out)
+[[nodiscard]] inline size_t queue_scatter_gather(
+    IoUringContext& ctx, int fd,
+    std::span<const std::span<const char>> buffers,
+    std::span<ScatterGatherSend> sg,
+    void* user_data = nullptr) noexcept
+{
+    size_t queued = 0;
+    size_t group = 0;
+    while (queued < buffers.size() && group < sg.size()) {
+        ScatterGatherSend& send = sg[group];
+        send.reset();
+        size_t n = 0;
+        while (queued + n < buffers.size() && send.add(buffers[queued + n])) ++n;
+
+        const bool last = queued + n == buffers.size() || group + 1 == sg.size();
+        if (!send.submit(ctx, fd, user_data, last ? 0u : IOSQE_IO_LINK)) break;
+        queued += n;
+        ++group;
+    }
+    return queued;
+}
+
 // ============================================================================
 // Linked Operations (SQE Linking)
 // ============================================================================
@@ -378,6 +438,43 @@ public:
         return true;
     }
 
+    /// Add a positional write to the chain (files, e.g. a journal)
+    [[nodiscard]] bool chain_write(int fd, std::span<const char> data, uint64_t offset,
+                                   void* user_data = nullptr) noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) return false;
+
+        io_uring_prep_write(sqe, fd, data.data(), static_cast<unsigned>(data.size()), offset);
+        io_uring_sqe_set_data(sqe, user_data);
+        link(sqe);
+        return true;
+    }
+
+    /// Add a positional write from a registered buffer to the chain
+    [[nodiscard]] bool chain_write_fixed(int fd, std::span<const char> data, uint64_t offset,
+                                         uint16_t buf_index, void* user_data = nullptr) noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) return false;
+
+        io_uring_prep_write_fixed(sqe, fd, data.data(), static_cast<unsigned>(data.size()),
+                                  offset, buf_index);
+        io_uring_sqe_set_data(sqe, user_data);
+        link(sqe);
+        return true;
+    }
+
+    /// Add an fsync to the chain; runs only after the preceding writes
+    /// @param datasync fdatasync semantics (skip metadata not needed to read)
+    [[nodiscard]] bool chain_fsync(int fd, bool datasync = true, void* user_data = nullptr) noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) return false;
+
+        io_uring_prep_fsync(sqe, fd, datasync ? IORING_FSYNC_DATASYNC : 0);
+        io_uring_sqe_set_data(sqe, user_data);
+        link(sqe);
+        return true;
+    }
+
     /// Submit the linked chain
     [[nodiscard]] int submit() noexcept {
         if (count_ == 0) return 0;
@@ -392,6 +489,14 @@ public:
     [[nodiscard]] size_t count() const noexcept { return count_; }
 
 private:
+    void link(struct io_uring_sqe* sqe) noexcept {
+        if (last_sqe_) {
+            last_sqe_->flags |= IOSQE_IO_LINK;
+        }
+        last_sqe_ = sqe;
+        ++count_;
+    }
+
     IoUringContext& ctx_;
     size_t count_;
     struct io_uring_sqe* last_sqe_;
@@ -0,0 +1,401 @@
+/*
+    NexusFIX Kernel-Bypass Transport Adapter
+
+    Plugs a user-space network stack (ef_vi / Onload extensions, AF_XDP
+    with a light TCP, DPDK, ...) in behind ITransport. A stack provides
+    six calls (see UserSpaceStack):
+
+        connect(host, port)   close()   is_connected()
+        send(bytes)           poll(on_frame)   release(frame_id)
+
+    poll() drives the NIC rings without blocking and hands each received
+    payload over as an RxFrame: an id plus a span into ring memory, owned
+    by the stack until release(id).
+
+    BypassTransport<Stack> offers two receive paths:
+    - receive(): the ITransport call, busy-polls and copies out
+    - poll_messages(): frames messages straight out of ring memory with
+      MessageReassembler; a frame goes back to the stack as soon as no
+      message references it. This is the low-latency path.
+    Use one or the other on a connection, not both.
+
+    BusyPollSocketStack is the reference stack: non-blocking kernel TCP
+    polled with MSG_DONTWAIT (plus SO_BUSY_POLL on Linux). Launched under
+    a socket-interception stack (onload, VMA/libvma via LD_PRELOAD) the
+    same calls never enter the kernel.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/parser/message_reassembler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Stack Extension API
+// ============================================================================
+
+/// Received payload in stack-owned (ring) memory
+struct RxFrame {
+    uint16_t id;
+    std::span<const char> data;
+};
+
+namespace detail {
+
+/// Archetype for the frame handler a stack's poll() must accept
+struct RxFrameSink {
+    void operator()(RxFrame) const noexcept {}
+};
+
+} // namespace detail
+
+/// A user-space TCP stack usable by BypassTransport
+template <typename S>
+concept UserSpaceStack = requires(S stack, const S cstack, std::string_view host, uint16_t port,
+                                  std::span<const char> data, uint16_t frame_id) {
+    { stack.connect(host, port) } -> std::same_as<TransportResult<void>>;
+    { stack.close() } noexcept;
+    { cstack.is_connected() } -> std::same_as<bool>;
+    { stack.send(data) } -> std::same_as<TransportResult<size_t>>;
+    { stack.poll(detail::RxFrameSink{}) } -> std::same_as<size_t>;   // Frames delivered
+    { stack.release(frame_id) } noexcept;
+};
+
+// ============================================================================
+// Bypass Transport
+// ============================================================================
+
+/// ITransport over a user-space stack with a polling receive model
+/// @tparam Stack UserSpaceStack implementation
+/// @tparam MaxMessageSize Largest message that can straddle frames
+template <UserSpaceStack Stack, size_t MaxMessageSize = 4096>
+class BypassTransport final : public ITransport {
+public:
+    template <typename... Args>
+    explicit BypassTransport(Args&&... args) noexcept(noexcept(Stack(std::forward<Args>(args)...)))
+        : stack_(std::forward<Args>(args)...) {}
+
+    ~BypassTransport() override { disconnect(); }
+
+    BypassTransport(const BypassTransport&) = delete;
+    BypassTransport& operator=(const BypassTransport&) = delete;
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        disconnect();
+        return stack_.connect(host, port);
+    }
+
+    void disconnect() noexcept override {
+        release_queued();
+        reassembler_.reset([this](uint16_t id) { stack_.release(id); });
+        stack_.close();
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return stack_.is_connected();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        return stack_.send(data);
+    }
+
+    /// Busy-poll until data arrives or the receive timeout expires
+    /// @return Bytes copied, 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (rx_queue_.empty()) {
+            using Clock = std::chrono::steady_clock;
+            const auto deadline = Clock::now() + std::chrono::milliseconds(recv_timeout_ms_);
+            for (uint32_t spins = 0; rx_queue_.empty(); ++spins) {
+                (void)stack_.poll([this](RxFrame frame) noexcept { rx_queue_.push_back(frame); });
+                if (!rx_queue_.empty()) break;
+                if (!stack_.is_connected()) {
+                    return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                }
+                // Clock reads are not free: check the deadline now and then
+                if ((spins & 1023) == 1023 && recv_timeout_ms_ >= 0 && Clock::now() >= deadline) {
+                    return 0;
+                }
+            }
+        }
+
+        size_t copied = 0;
+        while (copied < buffer.size() && rx_head_ < rx_queue_.size()) {
+            RxFrame& frame = rx_queue_[rx_head_];
+            const size_t n = std::min(buffer.size() - copied, frame.data.size() - rx_offset_);
+            std::memcpy(buffer.data() + copied, frame.data.data() + rx_offset_, n);
+            copied += n;
+            rx_offset_ += n;
+            if (rx_offset_ == frame.data.size()) {
+                stack_.release(frame.id);
+                ++rx_head_;
+                rx_offset_ = 0;
+            }
+        }
+        if (rx_head_ == rx_queue_.size()) {
+            rx_queue_.clear();
+            rx_head_ = 0;
+        }
+        return copied;
+    }
+
+    /// Poll the stack once and deliver complete messages in place
+    /// @param on_message Called with each message span (valid during the call)
+    /// @return Number of messages delivered
+    template <typename Handler>
+    size_t poll_messages(Handler&& on_message) noexcept {
+        size_t delivered = 0;
+        auto release = [this](uint16_t id) noexcept { stack_.release(id); };
+        (void)stack_.poll([&](RxFrame frame) noexcept {
+            delivered += reassembler_.feed(frame.id, frame.data, on_message, release);
+        });
+        return delivered;
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        if constexpr (requires { stack_.set_nodelay(enable); }) {
+            return stack_.set_nodelay(enable);
+        }
+        return true;  // User-space stacks send immediately
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        if constexpr (requires { stack_.set_keepalive(enable); }) {
+            return stack_.set_keepalive(enable);
+        }
+        return true;
+    }
+
+    /// Bounds receive()'s busy-poll; -1 polls forever
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        recv_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        if constexpr (requires { stack_.set_send_timeout(milliseconds); }) {
+            return stack_.set_send_timeout(milliseconds);
+        }
+        return true;
+    }
+
+    /// Zero-copy reassembly counters for poll_messages()
+    [[nodiscard]] const ReassemblyStats& reassembly_stats() const noexcept {
+        return reassembler_.stats();
+    }
+
+    [[nodiscard]] Stack& stack() noexcept { return stack_; }
+    [[nodiscard]] const Stack& stack() const noexcept { return stack_; }
+
+private:
+    void release_queued() noexcept {
+        for (size_t i = rx_head_; i < rx_queue_.size(); ++i) stack_.release(rx_queue_[i].id);
+        rx_queue_.clear();
+        rx_head_ = 0;
+        rx_offset_ = 0;
+    }
+
+    Stack stack_;
+    MessageReassembler<MaxMessageSize> reassembler_;
+    std::vector<RxFrame> rx_queue_;     // receive(): frames not yet copied out
+    size_t rx_head_{0};
+    size_t rx_offset_{0};
+    int recv_timeout_ms_{30000};
+};
+
+#if NFX_PLATFORM_POSIX
+
+// ============================================================================
+// Reference Stack: Busy-Polled Kernel Socket
+// ============================================================================
+
+/// Configuration for BusyPollSocketStack
+struct BusyPollSocketConfig {
+    size_t num_frames{64};
+    size_t frame_size{4096};
+    int busy_poll_us{50};       // SO_BUSY_POLL (Linux), 0 = off
+    bool tcp_nodelay{true};
+};
+
+/// Reference UserSpaceStack on non-blocking kernel TCP
+/// poll() reads into a fixed frame pool with MSG_DONTWAIT until EAGAIN
+/// or the pool runs dry; frames return to the pool on release().
+class BusyPollSocketStack {
+public:
+    explicit BusyPollSocketStack(const BusyPollSocketConfig& config = {}) noexcept
+        : config_{config} {}
+
+    ~BusyPollSocketStack() { close(); }
+
+    BusyPollSocketStack(const BusyPollSocketStack&) = delete;
+    BusyPollSocketStack& operator=(const BusyPollSocketStack&) = delete;
+
+    [[nodiscard]] TransportResult<void> connect(std::string_view host, uint16_t port) noexcept {
+        close();
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        char port_str[8];
+        std::snprintf(port_str, sizeof(port_str), "%u", port);
+
+        char host_buf[256];
+        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+        std::memcpy(host_buf, host.data(), host_len);
+        host_buf[host_len] = '\0';
+
+        struct addrinfo* addr = nullptr;
+        if (int ret = ::getaddrinfo(host_buf, port_str, &hints, &addr); ret != 0) {
+            return std::unexpected{make_gai_error(ret)};
+        }
+
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            ::freeaddrinfo(addr);
+            return std::unexpected{make_socket_error()};
+        }
+        const int ret = ::connect(fd, addr->ai_addr, static_cast<SocketLength>(addr->ai_addrlen));
+        ::freeaddrinfo(addr);
+        if (ret != 0) {
+            auto err = make_socket_error();
+            ::close(fd);
+            return std::unexpected{err};
+        }
+        (void)set_tcp_nodelay(fd, config_.tcp_nodelay);
+        return adopt(fd);
+    }
+
+    /// Take over a connected socket
+    [[nodiscard]] TransportResult<void> adopt(int fd) noexcept {
+        close();
+        if (!set_socket_nonblocking(fd, true)) {
+            auto err = make_socket_error();
+            ::close(fd);
+            return std::unexpected{err};
+        }
+        if (config_.busy_poll_us > 0) {
+            (void)set_socket_busy_poll(fd, config_.busy_poll_us, true);  // Best effort
+        }
+        if (!frames_) {
+            frames_.reset(new (std::nothrow) char[config_.num_frames * config_.frame_size]);
+            if (!frames_) {
+                ::close(fd);
+                return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, ENOMEM}};
+            }
+        }
+        free_frames_.clear();
+        for (size_t i = config_.num_frames; i-- > 0;) {
+            free_frames_.push_back(static_cast<uint16_t>(i));
+        }
+        fd_ = fd;
+        connected_ = true;
+        return {};
+    }
+
+    void close() noexcept {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        connected_ = false;
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept { return connected_; }
+
+    /// Send everything, spinning while the socket buffer is full
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept {
+        NFX_NO_ALLOC_REGION("BusyPollSocketStack::send");
+        if (!connected_) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        size_t total = 0;
+        while (total < data.size()) {
+            const ssize_t n = ::send(fd_, data.data() + total, data.size() - total,
+                                     MSG_DONTWAIT | MSG_NOSIGNAL_COMPAT);
+            if (n > 0) {
+                total += static_cast<size_t>(n);
+                continue;
+            }
+            const int err = errno;
+            if (err == EINTR || is_would_block_error(err)) continue;
+            connected_ = false;
+            return std::unexpected{make_socket_error(err)};
+        }
+        return total;
+    }
+
+    /// Read what is available into free frames
+    template <typename OnFrame>
+    size_t poll(OnFrame&& on_frame) noexcept {
+        if (!connected_) return 0;
+        size_t delivered = 0;
+        while (!free_frames_.empty()) {
+            const uint16_t id = free_frames_.back();
+            char* frame = frames_.get() + static_cast<size_t>(id) * config_.frame_size;
+            const ssize_t n = ::recv(fd_, frame, config_.frame_size, MSG_DONTWAIT);
+            if (n > 0) {
+                free_frames_.pop_back();
+                on_frame(RxFrame{id, std::span<const char>{frame, static_cast<size_t>(n)}});
+                ++delivered;
+                if (static_cast<size_t>(n) < config_.frame_size) break;  // Drained
+                continue;
+            }
+            if (n == 0 || !(errno == EINTR || is_would_block_error(errno))) {
+                connected_ = false;  // Peer closed or socket error
+            }
+            break;
+        }
+        return delivered;
+    }
+
+    void release(uint16_t id) noexcept {
+        if (id < config_.num_frames) free_frames_.push_back(id);
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept {
+        config_.tcp_nodelay = enable;
+        return fd_ < 0 || set_tcp_nodelay(fd_, enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept {
+        return fd_ < 0 || set_socket_keepalive(fd_, enable);
+    }
+
+    /// Frames currently available for receive
+    [[nodiscard]] size_t free_frames() const noexcept { return free_frames_.size(); }
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+private:
+    BusyPollSocketConfig config_;
+    int fd_{-1};
+    bool connected_{false};
+    std::unique_ptr<char[]> frames_;
+    std::vector<uint16_t> free_frames_;
+};
+
+static_assert(UserSpaceStack<BusyPollSocketStack>);
+
+/// BypassTransport on the reference stack
+using BusyPollTransport = BypassTransport<BusyPollSocketStack>;
+
+#endif  // NFX_PLATFORM_POSIX
+
+} // namespace nfx
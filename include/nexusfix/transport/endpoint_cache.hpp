@@ -0,0 +1,274 @@
+/*
+    NexusFIX Endpoint Cache and Standby Sockets
+
+    The slow parts of a reconnect, moved off the reconnect path:
+
+    - EndpointCache: getaddrinfo() once per host:port, then cached for
+      ttl. A lookup that fails (resolver down) keeps serving the stale
+      addresses; rotate() moves to the next A record after a failed connect.
+    - StandbySockets: TCP sockets created ahead of time, non-blocking and
+      close-on-exec, with TCP_NODELAY, SO_KEEPALIVE, buffer sizes and busy
+      poll already set (options set before connect() carry over to the
+      connection). take() hands one out; refill() tops the pool up after
+      the connection is up.
+
+    A reconnect then starts with connect() on a ready socket to a cached
+    sockaddr: no DNS, no socket() and no setsockopt() before the SYN.
+    POSIX only; IPv4, as the transports' own resolution.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/types/error.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if NFX_PLATFORM_POSIX
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace nfx {
+
+#if NFX_PLATFORM_POSIX
+
+// ============================================================================
+// Resolved Endpoint
+// ============================================================================
+
+/// A socket address ready for connect()
+struct ResolvedEndpoint {
+    sockaddr_storage addr{};
+    socklen_t addrlen{0};
+
+    [[nodiscard]] bool valid() const noexcept { return addrlen != 0; }
+
+    [[nodiscard]] const sockaddr* sockaddr_ptr() const noexcept {
+        return reinterpret_cast<const sockaddr*>(&addr);
+    }
+
+    [[nodiscard]] uint16_t port() const noexcept {
+        return ntohs(reinterpret_cast<const sockaddr_in*>(&addr)->sin_port);
+    }
+
+    /// Every IPv4 address of host:port (synchronous getaddrinfo)
+    [[nodiscard]] static TransportResult<std::vector<ResolvedEndpoint>> resolve_all(
+        std::string_view host, uint16_t port)
+    {
+        struct addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        char port_str[8];
+        std::snprintf(port_str, sizeof(port_str), "%u", port);
+        char host_buf[256];
+        const size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+        std::memcpy(host_buf, host.data(), host_len);
+        host_buf[host_len] = '\0';
+
+        struct addrinfo* resolved = nullptr;
+        if (::getaddrinfo(host_buf, port_str, &hints, &resolved) != 0) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        std::vector<ResolvedEndpoint> out;
+        for (auto* ai = resolved; ai; ai = ai->ai_next) {
+            if (ai->ai_addrlen > sizeof(sockaddr_storage)) continue;
+            ResolvedEndpoint ep;
+            std::memcpy(&ep.addr, ai->ai_addr, ai->ai_addrlen);
+            ep.addrlen = static_cast<socklen_t>(ai->ai_addrlen);
+            out.push_back(ep);
+        }
+        ::freeaddrinfo(resolved);
+        if (out.empty()) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        return out;
+    }
+
+    /// First IPv4 address of host:port
+    [[nodiscard]] static TransportResult<ResolvedEndpoint> resolve(std::string_view host, uint16_t port) {
+        auto all = resolve_all(host, port);
+        if (!all) return std::unexpected{all.error()};
+        return all->front();
+    }
+};
+
+// ============================================================================
+// Endpoint Cache
+// ============================================================================
+
+/// Resolved addresses per host:port, refreshed after ttl
+class EndpointCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit EndpointCache(std::chrono::seconds ttl = std::chrono::seconds{300}) noexcept
+        : ttl_{ttl} {}
+
+    /// Current address of host:port, resolving if not cached or expired
+    /// An expired entry whose refresh fails is served as is.
+    [[nodiscard]] TransportResult<ResolvedEndpoint> lookup(std::string_view host, uint16_t port) {
+        Entry* entry = find(host, port);
+        const auto now = Clock::now();
+        if (entry && now - entry->resolved_at < ttl_) return entry->current();
+
+        ++lookups_;
+        auto resolved = ResolvedEndpoint::resolve_all(host, port);
+        if (!resolved) {
+            if (entry) return entry->current();
+            return std::unexpected{resolved.error()};
+        }
+        if (!entry) {
+            entries_.push_back(Entry{std::string{host}, port, {}, 0, {}});
+            entry = &entries_.back();
+        }
+        entry->addresses = std::move(*resolved);
+        entry->next = 0;
+        entry->resolved_at = now;
+        return entry->current();
+    }
+
+    /// Move host:port to its next address (after a failed connect)
+    void rotate(std::string_view host, uint16_t port) noexcept {
+        if (Entry* entry = find(host, port); entry && !entry->addresses.empty()) {
+            entry->next = (entry->next + 1) % entry->addresses.size();
+        }
+    }
+
+    /// Drop host:port so the next lookup resolves again
+    void invalidate(std::string_view host, uint16_t port) noexcept {
+        if (Entry* entry = find(host, port)) entry->resolved_at = {};
+    }
+
+    /// getaddrinfo() calls made (cache misses and refreshes)
+    [[nodiscard]] uint64_t lookups() const noexcept { return lookups_; }
+
+private:
+    struct Entry {
+        std::string host;
+        uint16_t port;
+        std::vector<ResolvedEndpoint> addresses;
+        size_t next;
+        Clock::time_point resolved_at;
+
+        [[nodiscard]] ResolvedEndpoint current() const noexcept { return addresses[next]; }
+    };
+
+    [[nodiscard]] Entry* find(std::string_view host, uint16_t port) noexcept {
+        for (auto& entry : entries_) {
+            if (entry.port == port && entry.host == host) return &entry;
+        }
+        return nullptr;
+    }
+
+    std::chrono::seconds ttl_;
+    std::vector<Entry> entries_;
+    uint64_t lookups_{0};
+};
+
+// ============================================================================
+// Standby Sockets
+// ============================================================================
+
+/// Apply the connection options of SocketOptions to an unconnected socket
+/// (timeouts are left out: the async transports do not block)
+inline void apply_standby_options(int fd, const SocketOptions& options) noexcept {
+    const int nodelay = options.tcp_nodelay ? 1 : 0;
+    const int keepalive = options.keep_alive ? 1 : 0;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    ::setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &keepalive, sizeof(keepalive));
+    if (options.recv_buffer_size > 0) {
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &options.recv_buffer_size, sizeof(int));
+    }
+    if (options.send_buffer_size > 0) {
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &options.send_buffer_size, sizeof(int));
+    }
+#if NFX_PLATFORM_LINUX
+    if (options.busy_poll_us > 0) {
+        ::setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &options.busy_poll_us, sizeof(int));
+    #if defined(SO_PREFER_BUSY_POLL)
+        const int prefer = options.prefer_busy_poll ? 1 : 0;
+        ::setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer));
+    #endif
+    }
+#endif
+}
+
+/// Pool of created, configured, unconnected TCP sockets
+class StandbySockets {
+public:
+    explicit StandbySockets(size_t target = 2, const SocketOptions& options = {}) noexcept
+        : target_{target}, options_{options} {}
+
+    ~StandbySockets() {
+        for (int fd : ready_) ::close(fd);
+    }
+
+    StandbySockets(const StandbySockets&) = delete;
+    StandbySockets& operator=(const StandbySockets&) = delete;
+
+    /// A ready socket (owned by the caller); created on the spot if the pool is empty
+    [[nodiscard]] TransportResult<int> take() noexcept {
+        if (!ready_.empty()) {
+            const int fd = ready_.back();
+            ready_.pop_back();
+            return fd;
+        }
+        ++misses_;
+        return create();
+    }
+
+    /// Top the pool up to its target (call off the reconnect path)
+    /// @return Sockets added
+    size_t refill() noexcept {
+        size_t added = 0;
+        while (ready_.size() < target_) {
+            auto fd = create();
+            if (!fd) break;
+            ready_.push_back(*fd);
+            ++added;
+        }
+        return added;
+    }
+
+    [[nodiscard]] size_t available() const noexcept { return ready_.size(); }
+
+    /// take() calls that found the pool empty
+    [[nodiscard]] uint64_t misses() const noexcept { return misses_; }
+
+    [[nodiscard]] const SocketOptions& options() const noexcept { return options_; }
+
+private:
+    [[nodiscard]] TransportResult<int> create() noexcept {
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        apply_standby_options(fd, options_);
+        return fd;
+    }
+
+    size_t target_;
+    SocketOptions options_;
+    std::vector<int> ready_;
+    uint64_t misses_{0};
+};
+
+#endif  // NFX_PLATFORM_POSIX
+
+} // namespace nfx
@@ -0,0 +1,886 @@
+/*
+    NexusFIX io_uring Reactor
+
+    One ring driving many sessions. Each connection is a channel in a
+    fixed slot table; every SQE carries
+
+        user_data = [slot:32 | generation:24 | op:8]
+
+    so a completion is routed to its channel without a lookup, and a CQE
+    that outlives its channel (slot reused) is recognised by generation.
+
+    Per channel the reactor keeps one multishot receive on a shared
+    provided-buffer group (messages framed in place by MessageReassembler),
+    one send in flight with later sends staged behind it, and one periodic
+    IORING_OP_TIMEOUT for the session timer. Callbacks run on the thread
+    calling run_once(), which should be the only thread touching the
+    reactor: the ring is set up SINGLE_ISSUER. Run one reactor per core
+    (pin the thread with util::CpuAffinity) and spread sessions across them.
+
+    Closing cancels the channel's receive and timer, waits for every
+    outstanding completion, then closes the fd; only then is the slot
+    reused.
+
+    Work queued by other threads (e.g. order submissions through a
+    memory::NotifyingQueue) joins the same loop via watch_notifier(): the
+    reactor keeps a READ on the queue's eventfd and announces sleep before
+    blocking, so one thread waits on sockets and queues without spinning.
+
+    accept_on() keeps one multishot accept armed on a listening socket: a
+    burst of connections is a burst of CQEs on this ring, with no SQE per
+    connection (see session/acceptor_engine.hpp).
+
+    connect() with ConnectTargets skips resolution and socket setup: it
+    takes sockets prepared ahead of time (StandbySockets) and cached
+    addresses (EndpointCache), links an IORING_OP_LINK_TIMEOUT to each
+    connect, and with two targets races them (primary and backup): the
+    first to connect becomes the channel and the other is cancelled. See
+    transport/reconnect_manager.hpp.
+*/
+
+#pragma once
+
+#include "nexusfix/transport/endpoint_cache.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string_view>
+
+namespace nfx {
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Reactor Callbacks
+// ============================================================================
+
+/// Events for one reactor channel, delivered on the reactor thread
+class IReactorHandler {
+public:
+    virtual ~IReactorHandler() = default;
+
+    /// Connection established (or fd attached); sends may start
+    virtual void on_connected() noexcept = 0;
+
+    /// One complete FIX message (span valid during the call)
+    virtual void on_message(std::span<const char> message) noexcept = 0;
+
+    /// Every message from one receive completion has been delivered
+    virtual void on_receive_complete() noexcept {}
+
+    /// Periodic timer from set_timer()
+    virtual void on_timer() noexcept = 0;
+
+    /// Channel closed and its slot released; error is None after close()
+    virtual void on_closed(const TransportError& error) noexcept = 0;
+};
+
+/// Cross-thread work for the reactor thread (see watch_notifier())
+class INotifierHandler {
+public:
+    virtual ~INotifierHandler() = default;
+
+    /// Drain the watched queue; also called before the reactor blocks,
+    /// so the queue may be empty
+    virtual void on_notified() noexcept = 0;
+};
+
+/// Connections accepted on a listening socket (see accept_on())
+class IAcceptHandler {
+public:
+    virtual ~IAcceptHandler() = default;
+
+    /// New connection (non-blocking, close-on-exec); the handler owns fd
+    virtual void on_accept(int fd) noexcept = 0;
+
+    /// Accept failed (e.g. EMFILE); the listener stays armed
+    virtual void on_accept_error(const TransportError& /*error*/) noexcept {}
+};
+
+/// Forwards reactor events to a SessionManager
+/// The session's own Handler::on_send writes through IoUringReactor::send().
+template <typename Session>
+class ReactorSessionHandler final : public IReactorHandler {
+public:
+    explicit ReactorSessionHandler(Session& session) noexcept : session_{session} {}
+
+    void on_connected() noexcept override { session_.on_connect(); }
+    void on_message(std::span<const char> message) noexcept override {
+        session_.on_data_received(message);
+    }
+    void on_receive_complete() noexcept override {
+        session_.end_receive_batch();  // Arena reset, coalesced replies sent
+    }
+    void on_timer() noexcept override { session_.on_timer_tick(); }
+    void on_closed(const TransportError&) noexcept override { session_.on_disconnect(); }
+
+private:
+    Session& session_;
+};
+
+// ============================================================================
+// Reactor Configuration
+// ============================================================================
+
+/// One endpoint of a prepared connect: a created socket (the reactor
+/// takes ownership) and the address to connect it to
+struct ConnectTarget {
+    int fd{-1};
+    ResolvedEndpoint endpoint{};
+    bool options_applied{false};   // TCP_NODELAY / SO_KEEPALIVE already set
+};
+
+struct IoUringReactorConfig {
+    /// SQ entries; a channel has at most 4 operations outstanding
+    unsigned queue_depth{1024};
+
+    /// Channel slots
+    uint32_t max_channels{256};
+
+    /// Provided-buffer group shared by every channel's multishot receive
+    uint16_t buffer_group_id{1};
+    size_t num_recv_buffers{1024};
+    size_t recv_buffer_size{4096};
+    bool use_buf_ring{true};          // Ring-mapped group (see ProvidedBufferGroup)
+
+    /// Bytes a channel may stage behind its in-flight send
+    size_t max_pending_send{256 * 1024};
+
+    /// Kernel SQ polling for the reactor's ring
+    SqPollConfig sqpoll{};
+};
+
+/// Counters for one reactor
+struct ReactorStats {
+    uint64_t completions{0};
+    uint64_t messages{0};
+    uint64_t sends{0};
+    uint64_t timer_fires{0};
+    uint64_t stale_completions{0};   // CQE for a slot already reused
+    uint64_t notifications{0};       // Producer wake-ups through a watched notifier
+    uint64_t accepts{0};             // Connections from accept_on() listeners
+    uint64_t connect_timeouts{0};    // Connects cut off by their linked timeout
+    uint64_t race_losses{0};         // Raced connects cancelled after the other won
+};
+
+// ============================================================================
+// io_uring Reactor
+// ============================================================================
+
+class IoUringReactor {
+public:
+    using ChannelId = uint64_t;      // slot | generation << 32
+    static constexpr ChannelId INVALID_CHANNEL = UINT64_MAX;
+
+    explicit IoUringReactor(const IoUringReactorConfig& config = {}) noexcept
+        : config_{config} {}
+
+    ~IoUringReactor() {
+        if (!channels_) return;
+        for (uint32_t slot = 0; slot < config_.max_channels; ++slot) {
+            if (channels_[slot].fd >= 0) ::close(channels_[slot].fd);
+            if (channels_[slot].race_fd >= 0) ::close(channels_[slot].race_fd);
+        }
+    }
+
+    IoUringReactor(const IoUringReactor&) = delete;
+    IoUringReactor& operator=(const IoUringReactor&) = delete;
+
+    /// Create the ring and the shared receive buffers
+    [[nodiscard]] TransportResult<void> init() noexcept {
+        if (config_.max_channels == 0 || config_.max_channels > MAX_SLOTS) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+        if (auto result = ctx_.init(config_.queue_depth, config_.sqpoll); !result) return result;
+        if (!buffers_.init(ctx_, config_.buffer_group_id, config_.recv_buffer_size,
+                           config_.num_recv_buffers,
+                           config_.use_buf_ring ? ProvidedBufferGroup::Mode::Ring
+                                                : ProvidedBufferGroup::Mode::ProvideBuffers)) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, ENOTSUP}};
+        }
+
+        channels_.reset(new (std::nothrow) Channel[config_.max_channels]);
+        if (!channels_) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, ENOMEM}};
+        }
+        free_slots_.reserve(config_.max_channels);
+        for (uint32_t slot = config_.max_channels; slot-- > 0;) free_slots_.push_back(slot);
+        return {};
+    }
+
+    // ========================================================================
+    // Channels
+    // ========================================================================
+
+    /// Start an async connect; handler.on_connected() follows on success
+    /// Name resolution is synchronous, as in IoUringTransport::connect().
+    [[nodiscard]] TransportResult<ChannelId> connect(
+        std::string_view host, uint16_t port, IReactorHandler& handler) noexcept
+    {
+        auto endpoint = ResolvedEndpoint::resolve(host, port);
+        if (!endpoint) return std::unexpected{endpoint.error()};
+
+        const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        }
+        const ConnectTarget target{fd, *endpoint, false};
+        return connect(std::span<const ConnectTarget>{&target, 1}, handler);
+    }
+
+    /// Start an async connect on prepared sockets; handler.on_connected()
+    /// follows once one target connects. Two targets race: the loser's
+    /// connect is cancelled and its socket closed. The reactor owns every
+    /// target fd from here on, also on failure.
+    /// @param timeout_ms Linked timeout per connect (0 = none); expiry fails
+    ///        the target with Timeout
+    [[nodiscard]] TransportResult<ChannelId> connect(
+        std::span<const ConnectTarget> targets, IReactorHandler& handler,
+        uint32_t timeout_ms = 0) noexcept
+    {
+        if (targets.empty() || targets.size() > 2) {
+            for (const auto& target : targets) ::close(target.fd);
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+        auto slot = open_slot(targets[0].fd, handler);
+        if (!slot) {
+            for (const auto& target : targets) ::close(target.fd);
+            return std::unexpected{slot.error()};
+        }
+        Channel& ch = channels_[*slot];
+        ch.options_applied = targets[0].options_applied;
+        ch.addr = targets[0].endpoint.addr;
+        ch.addrlen = targets[0].endpoint.addrlen;
+        if (targets.size() == 2) {
+            ch.race_fd = targets[1].fd;
+            ch.race_addr = targets[1].endpoint.addr;
+            ch.race_addrlen = targets[1].endpoint.addrlen;
+            ch.options_applied = ch.options_applied && targets[1].options_applied;
+        }
+        ch.connect_ts.tv_sec = timeout_ms / 1000;
+        ch.connect_ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1'000'000;
+
+        // Each connect and its timeout must land in the same submission
+        ctx_.submit();
+        ch.state = ChannelState::Connecting;
+        for (uint8_t i = 0; i < targets.size(); ++i) {
+            if (!submit_connect(*slot, i, timeout_ms != 0)) {
+                if (ch.connects == 0) {
+                    release_slot(*slot);
+                    return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+                }
+                ::close(ch.race_fd);   // Only the primary is racing
+                ch.race_fd = -1;
+            }
+        }
+        return channel_id(*slot);
+    }
+
+    /// Adopt a connected socket (e.g. from an acceptor); the reactor owns fd
+    [[nodiscard]] TransportResult<ChannelId> attach(int fd, IReactorHandler& handler) noexcept {
+        auto slot = open_slot(fd, handler);
+        if (!slot) return std::unexpected{slot.error()};
+        on_open(*slot);
+        return channel_id(*slot);
+    }
+
+    /// Queue data on a channel; sent in order, staged while a send is in flight
+    /// @return Bytes accepted (all of data)
+    [[nodiscard]] TransportResult<size_t> send(ChannelId id, std::span<const char> data) noexcept {
+        Channel* ch = find(id);
+        if (!ch || ch->state == ChannelState::Closing) {
+            return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        }
+        if (ch->pending.size() + data.size() > config_.max_pending_send) {
+            return std::unexpected{TransportError{TransportErrorCode::WouldBlock}};
+        }
+        ch->pending.insert(ch->pending.end(), data.begin(), data.end());
+        if (ch->state == ChannelState::Open && !ch->sending) start_send(slot_of(id));
+        return data.size();
+    }
+
+    /// Fire handler.on_timer() every interval_ms (0 stops after the next fire)
+    void set_timer(ChannelId id, uint32_t interval_ms) noexcept {
+        Channel* ch = find(id);
+        if (!ch) return;
+        ch->timer_ms = interval_ms;
+        if (ch->state == ChannelState::Open && !ch->timer_armed) arm_timer(slot_of(id));
+    }
+
+    /// Begin closing; handler.on_closed() follows once the slot is released
+    void close(ChannelId id) noexcept {
+        if (find(id)) begin_close(slot_of(id), TransportError{});
+    }
+
+    [[nodiscard]] bool is_open(ChannelId id) const noexcept {
+        return valid(id) && channels_[slot_of(id)].state == ChannelState::Open;
+    }
+
+    /// Index of the ConnectTarget that became the channel (0 until connected)
+    [[nodiscard]] uint8_t connected_target(ChannelId id) const noexcept {
+        return valid(id) ? channels_[slot_of(id)].target : 0;
+    }
+
+    [[nodiscard]] size_t channel_count() const noexcept {
+        return config_.max_channels - free_slots_.size();
+    }
+
+    // ========================================================================
+    // Cross-Thread Notifiers
+    // ========================================================================
+
+    /// Wake this reactor when producers push to a queue guarded by notifier
+    /// handler.on_notified() runs on the reactor thread after each wake-up
+    /// and before each blocking wait. notifier must be in EventFd mode and
+    /// outlive the reactor.
+    [[nodiscard]] TransportResult<void> watch_notifier(
+        memory::QueueNotifier& notifier, INotifierHandler& handler) noexcept
+    {
+        if (notifier.fd() < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+        auto watch = std::unique_ptr<NotifierWatch>(new (std::nothrow) NotifierWatch{});
+        if (!watch) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, ENOMEM}};
+        }
+        watch->notifier = &notifier;
+        watch->handler = &handler;
+        watches_.push_back(std::move(watch));
+        arm_notifier(static_cast<uint32_t>(watches_.size() - 1));
+        return {};
+    }
+
+    // ========================================================================
+    // Listeners
+    // ========================================================================
+
+    /// Keep an accept armed on listen_fd; handler.on_accept() runs on the
+    /// reactor thread for every connection
+    /// Multishot (kernel 5.19+) when liburing has it, else re-armed per
+    /// accept. listen_fd is not owned and must outlive the reactor.
+    [[nodiscard]] TransportResult<void> accept_on(int listen_fd, IAcceptHandler& handler) noexcept {
+        if (listen_fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EINVAL}};
+        }
+        auto listener = std::unique_ptr<Listener>(new (std::nothrow) Listener{});
+        if (!listener) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, ENOMEM}};
+        }
+        listener->fd = listen_fd;
+        listener->handler = &handler;
+        listeners_.push_back(std::move(listener));
+        arm_accept(static_cast<uint32_t>(listeners_.size() - 1));
+        return {};
+    }
+
+    // ========================================================================
+    // Event Loop
+    // ========================================================================
+
+    /// Submit queued work, wait up to timeout_ms for a completion, then
+    /// dispatch every completion available
+    /// @return Completions processed
+    int run_once(int timeout_ms = -1) noexcept {
+        // Announce sleep, then take anything pushed before the announcement
+        for (auto& watch : watches_) {
+            watch->notifier->prepare_wait();
+            watch->handler->on_notified();
+        }
+        ctx_.submit();
+
+        struct io_uring_cqe* cqe;
+        const int waited = ctx_.wait(&cqe, timeout_ms);
+        for (auto& watch : watches_) watch->notifier->cancel_wait();
+        if (waited != 0) return 0;
+
+        // wait() left its completion in the ring: reap() takes it first
+        const unsigned processed = ctx_.reap(
+            [this](const CqeEntry& c) { dispatch(c.user_data, c.res, c.flags); },
+            [this](const CqeEntry& next) { prefetch_channel(next.user_data); });
+
+        stats_.completions += processed;
+        ctx_.submit();  // Replenished buffers, rearmed operations
+        return static_cast<int>(processed);
+    }
+
+    /// Loop until stop is set (checked at least every poll_ms)
+    void run(const std::atomic<bool>& stop, int poll_ms = 100) noexcept {
+        while (!stop.load(std::memory_order_relaxed)) (void)run_once(poll_ms);
+    }
+
+    [[nodiscard]] const ReactorStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] IoUringContext& context() noexcept { return ctx_; }
+
+private:
+    static constexpr uint32_t MAX_SLOTS = 1u << 24;
+    static constexpr uint32_t GENERATION_MASK = 0xFFFFFF;
+
+    enum class Op : uint8_t {
+        Connect = 1, Recv, Send, Timer, Cancel, Close, Notify, Accept,
+        ConnectRace,        // Second ConnectTarget
+        ConnectTimeout      // LINK_TIMEOUT behind either connect
+    };
+    enum class ChannelState : uint8_t { Free, Connecting, Open, Closing };
+
+    struct Channel {
+        IReactorHandler* handler{nullptr};
+        int fd{-1};
+        uint32_t generation{0};
+        uint32_t outstanding{0};        // SQEs not yet fully completed
+        ChannelState state{ChannelState::Free};
+        bool receiving{false};
+        bool sending{false};
+        bool timer_armed{false};
+        bool close_submitted{false};
+        uint32_t timer_ms{0};
+        struct __kernel_timespec timer_ts{};
+        sockaddr_storage addr{};
+        socklen_t addrlen{0};
+        int race_fd{-1};                // Second ConnectTarget while connecting
+        sockaddr_storage race_addr{};
+        socklen_t race_addrlen{0};
+        struct __kernel_timespec connect_ts{};
+        uint8_t connects{0};            // Bit per ConnectTarget still in flight
+        uint8_t target{0};              // ConnectTarget that won
+        bool options_applied{false};
+        std::vector<char> pending;      // Staged behind the in-flight send
+        std::vector<char> in_flight;
+        size_t in_flight_sent{0};
+        TransportError close_error{};
+        MessageReassembler<> reassembler;
+    };
+
+    struct NotifierWatch {
+        memory::QueueNotifier* notifier{nullptr};
+        INotifierHandler* handler{nullptr};
+        uint64_t counter{0};            // eventfd READ target
+    };
+
+    struct Listener {
+        int fd{-1};
+        IAcceptHandler* handler{nullptr};
+    };
+
+    // ========================================================================
+    // Slots and user_data
+    // ========================================================================
+
+    [[nodiscard]] static uint32_t slot_of(ChannelId id) noexcept {
+        return static_cast<uint32_t>(id);
+    }
+
+    [[nodiscard]] ChannelId channel_id(uint32_t slot) const noexcept {
+        return (static_cast<uint64_t>(channels_[slot].generation) << 32) | slot;
+    }
+
+    [[nodiscard]] bool valid(ChannelId id) const noexcept {
+        const uint32_t slot = slot_of(id);
+        if (!channels_ || slot >= config_.max_channels) return false;
+        const Channel& ch = channels_[slot];
+        return ch.state != ChannelState::Free && ch.generation == static_cast<uint32_t>(id >> 32);
+    }
+
+    [[nodiscard]] Channel* find(ChannelId id) noexcept {
+        return valid(id) ? &channels_[slot_of(id)] : nullptr;
+    }
+
+    [[nodiscard]] uint64_t encode(uint32_t slot, Op op) const noexcept {
+        return (static_cast<uint64_t>(slot) << 32) |
+               ((channels_[slot].generation & GENERATION_MASK) << 8) |
+               static_cast<uint8_t>(op);
+    }
+
+    [[nodiscard]] TransportResult<uint32_t> open_slot(int fd, IReactorHandler& handler) noexcept {
+        if (free_slots_.empty()) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        const uint32_t slot = free_slots_.back();
+        free_slots_.pop_back();
+        Channel& ch = channels_[slot];
+        ch.handler = &handler;
+        ch.fd = fd;
+        ch.state = ChannelState::Open;
+        return slot;
+    }
+
+    void release_slot(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+        if (ch.fd >= 0 && !ch.close_submitted) ::close(ch.fd);
+        if (ch.race_fd >= 0) ::close(ch.race_fd);
+        ch.reassembler.reset([this](uint16_t buf_id) { (void)buffers_.replenish(buf_id); });
+        ch.handler = nullptr;
+        ch.fd = -1;
+        ch.race_fd = -1;
+        ch.connects = 0;
+        ch.target = 0;
+        ch.options_applied = false;
+        ch.generation = (ch.generation + 1) & GENERATION_MASK;
+        ch.outstanding = 0;
+        ch.state = ChannelState::Free;
+        ch.receiving = ch.sending = ch.timer_armed = ch.close_submitted = false;
+        ch.timer_ms = 0;
+        ch.pending.clear();
+        ch.in_flight.clear();
+        ch.in_flight_sent = 0;
+        ch.close_error = {};
+        free_slots_.push_back(slot);
+    }
+
+    /// SQE, flushing the SQ first if it is full
+    [[nodiscard]] struct io_uring_sqe* get_sqe() noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) {
+            ctx_.submit();
+            sqe = ctx_.get_sqe();
+        }
+        return sqe;
+    }
+
+    void submit_op(struct io_uring_sqe* sqe, uint32_t slot, Op op) noexcept {
+        io_uring_sqe_set_data64(sqe, encode(slot, op));
+        ++channels_[slot].outstanding;
+    }
+
+    // ========================================================================
+    // Operations
+    // ========================================================================
+
+    /// IORING_OP_CONNECT for ConnectTarget index, with a linked timeout
+    [[nodiscard]] bool submit_connect(uint32_t slot, uint8_t index, bool timeout) noexcept {
+        Channel& ch = channels_[slot];
+        auto* sqe = get_sqe();
+        if (!sqe) return false;
+        if (index == 0) {
+            io_uring_prep_connect(sqe, ch.fd, reinterpret_cast<const sockaddr*>(&ch.addr), ch.addrlen);
+        } else {
+            io_uring_prep_connect(sqe, ch.race_fd, reinterpret_cast<const sockaddr*>(&ch.race_addr),
+                                  ch.race_addrlen);
+        }
+        submit_op(sqe, slot, index == 0 ? Op::Connect : Op::ConnectRace);
+        ch.connects |= static_cast<uint8_t>(1u << index);
+        if (timeout) {
+            if (auto* link = ctx_.get_sqe()) {
+                sqe->flags |= IOSQE_IO_LINK;
+                io_uring_prep_link_timeout(link, &ch.connect_ts, 0);
+                submit_op(link, slot, Op::ConnectTimeout);
+            }
+        }
+        return true;
+    }
+
+    /// Connect completion of ConnectTarget index
+    void on_connect(uint32_t slot, uint8_t index, int res) noexcept {
+        Channel& ch = channels_[slot];
+        ch.connects &= static_cast<uint8_t>(~(1u << index));
+        if (ch.state != ChannelState::Connecting) {
+            if (ch.state == ChannelState::Open && res == -ECANCELED) ++stats_.race_losses;
+            return;
+        }
+        if (res == -ECANCELED) ++stats_.connect_timeouts;
+
+        if (res >= 0) {
+            if (index == 1) {
+                std::swap(ch.fd, ch.race_fd);
+                std::swap(ch.addr, ch.race_addr);
+                std::swap(ch.addrlen, ch.race_addrlen);
+            }
+            ch.target = index;
+            if (ch.race_fd >= 0) {
+                // The loser's connect holds its own file reference
+                if (ch.connects != 0) cancel(slot, index == 0 ? Op::ConnectRace : Op::Connect);
+                ::close(ch.race_fd);
+                ch.race_fd = -1;
+            }
+            on_open(slot);
+        } else if (ch.connects == 0) {
+            begin_close(slot, res == -ECANCELED
+                ? TransportError{TransportErrorCode::Timeout, ETIMEDOUT}
+                : TransportError{TransportErrorCode::ConnectionFailed, -res});
+        }
+    }
+
+    void on_open(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+        if (!ch.options_applied) {
+            int flag = 1;
+            ::setsockopt(ch.fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+            ::setsockopt(ch.fd, SOL_SOCKET, SO_KEEPALIVE, &flag, sizeof(flag));
+        }
+        ch.state = ChannelState::Open;
+
+        arm_recv(slot);
+        ch.handler->on_connected();
+        if (ch.state != ChannelState::Open) return;  // Closed from the callback
+        if (ch.timer_ms != 0 && !ch.timer_armed) arm_timer(slot);
+        if (!ch.pending.empty() && !ch.sending) start_send(slot);
+    }
+
+    void arm_recv(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+#if defined(IORING_RECV_MULTISHOT)
+        auto* sqe = get_sqe();
+        if (!sqe) {
+            begin_close(slot, TransportError{TransportErrorCode::NoBufferSpace});
+            return;
+        }
+        io_uring_prep_recv(sqe, ch.fd, nullptr, 0, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = buffers_.group_id();
+        sqe->ioprio |= IORING_RECV_MULTISHOT;
+        submit_op(sqe, slot, Op::Recv);
+        ch.receiving = true;
+#else
+        begin_close(slot, TransportError{TransportErrorCode::SocketError, ENOTSUP});
+#endif
+    }
+
+    void arm_timer(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+        auto* sqe = get_sqe();
+        if (!sqe) return;  // Retried on the next set_timer() or fire
+        ch.timer_ts.tv_sec = ch.timer_ms / 1000;
+        ch.timer_ts.tv_nsec = static_cast<long long>(ch.timer_ms % 1000) * 1'000'000;
+        io_uring_prep_timeout(sqe, &ch.timer_ts, 0, 0);
+        submit_op(sqe, slot, Op::Timer);
+        ch.timer_armed = true;
+    }
+
+    void start_send(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+        if (ch.in_flight_sent == ch.in_flight.size()) {
+            if (ch.pending.empty()) return;
+            ch.in_flight.swap(ch.pending);
+            ch.pending.clear();
+            ch.in_flight_sent = 0;
+        }
+        auto* sqe = get_sqe();
+        if (!sqe) {
+            begin_close(slot, TransportError{TransportErrorCode::NoBufferSpace});
+            return;
+        }
+        io_uring_prep_send(sqe, ch.fd, ch.in_flight.data() + ch.in_flight_sent,
+                           ch.in_flight.size() - ch.in_flight_sent, MSG_NOSIGNAL);
+        submit_op(sqe, slot, Op::Send);
+        ch.sending = true;
+    }
+
+    /// READ on a notifier's eventfd; user_data carries the watch index
+    void arm_notifier(uint32_t index) noexcept {
+        NotifierWatch& watch = *watches_[index];
+        auto* sqe = get_sqe();
+        if (!sqe) return;  // Still drained before every wait
+        prep_notifier_read(sqe, *watch.notifier, &watch.counter);
+        io_uring_sqe_set_data64(sqe, (static_cast<uint64_t>(index) << 32) |
+                                     static_cast<uint8_t>(Op::Notify));
+    }
+
+    /// Accept on a listener; user_data carries the listener index
+    void arm_accept(uint32_t index) noexcept {
+        Listener& listener = *listeners_[index];
+        auto* sqe = get_sqe();
+        if (!sqe) {
+            listener.handler->on_accept_error(TransportError{TransportErrorCode::NoBufferSpace});
+            return;
+        }
+#if defined(IORING_ACCEPT_MULTISHOT)
+        io_uring_prep_multishot_accept(sqe, listener.fd, nullptr, nullptr,
+                                       SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        io_uring_prep_accept(sqe, listener.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#endif
+        io_uring_sqe_set_data64(sqe, (static_cast<uint64_t>(index) << 32) |
+                                     static_cast<uint8_t>(Op::Accept));
+    }
+
+    void cancel(uint32_t slot, Op op) noexcept {
+        auto* sqe = get_sqe();
+        if (!sqe) return;
+        io_uring_prep_cancel64(sqe, encode(slot, op), 0);
+        submit_op(sqe, slot, Op::Cancel);
+    }
+
+    void begin_close(uint32_t slot, const TransportError& error) noexcept {
+        Channel& ch = channels_[slot];
+        if (ch.state == ChannelState::Closing || ch.state == ChannelState::Free) return;
+        ch.state = ChannelState::Closing;
+        ch.close_error = error;
+        if (ch.receiving) cancel(slot, Op::Recv);
+        if (ch.timer_armed) cancel(slot, Op::Timer);
+        if (ch.connects & 1) cancel(slot, Op::Connect);
+        if (ch.connects & 2) cancel(slot, Op::ConnectRace);
+        finish_close(slot);
+    }
+
+    /// Close the fd once nothing else references the channel
+    void finish_close(uint32_t slot) noexcept {
+        Channel& ch = channels_[slot];
+        if (ch.state != ChannelState::Closing || ch.outstanding != 0) return;
+
+        if (!ch.close_submitted) {
+            if (auto* sqe = get_sqe()) {
+                io_uring_prep_close(sqe, ch.fd);
+                submit_op(sqe, slot, Op::Close);
+                ch.close_submitted = true;
+                return;
+            }
+        }
+        IReactorHandler* handler = ch.handler;
+        const TransportError error = ch.close_error;
+        release_slot(slot);
+        handler->on_closed(error);
+    }
+
+    // ========================================================================
+    // Completions
+    // ========================================================================
+
+    /// Warm the channel the next completion is routed to
+    void prefetch_channel(uint64_t user_data) const noexcept {
+        const uint32_t slot = static_cast<uint32_t>(user_data >> 32);
+        const auto op = static_cast<Op>(user_data & 0xFF);
+        if (op != Op::Notify && op != Op::Accept && slot < config_.max_channels) {
+            util::prefetch_read(&channels_[slot]);
+        }
+    }
+
+    void dispatch(uint64_t user_data, int res, uint32_t flags) noexcept {
+        const uint32_t slot = static_cast<uint32_t>(user_data >> 32);
+        const auto op = static_cast<Op>(user_data & 0xFF);
+        if (user_data == 0) return;  // PROVIDE_BUFFERS replenish: no channel
+        if (op == Op::Notify) {
+            on_notify(slot, res);
+            return;
+        }
+        if (op == Op::Accept) {
+            on_accept(slot, res, flags);
+            return;
+        }
+        if (slot >= config_.max_channels ||
+            (channels_[slot].generation & GENERATION_MASK) != ((user_data >> 8) & GENERATION_MASK) ||
+            channels_[slot].state == ChannelState::Free) [[unlikely]] {
+            ++stats_.stale_completions;
+            if (ProvidedBufferGroup::has_buffer(flags)) {
+                (void)buffers_.replenish(ProvidedBufferGroup::buffer_id_from_cqe(flags));
+            }
+            return;
+        }
+
+        Channel& ch = channels_[slot];
+        const bool more = op == Op::Recv && ProvidedBufferGroup::has_more(flags);
+        if (!more) --ch.outstanding;
+
+        switch (op) {
+            case Op::Connect:
+            case Op::ConnectRace:
+                on_connect(slot, op == Op::ConnectRace ? 1 : 0, res);
+                break;
+            case Op::Recv:
+                on_recv(slot, res, flags, more);
+                break;
+            case Op::Send:
+                on_send(slot, res);
+                break;
+            case Op::Timer:
+                ch.timer_armed = false;
+                if (ch.state == ChannelState::Open && res == -ETIME) {
+                    ++stats_.timer_fires;
+                    ch.handler->on_timer();
+                    if (ch.state == ChannelState::Open && ch.timer_ms != 0 && !ch.timer_armed) {
+                        arm_timer(slot);
+                    }
+                }
+                break;
+            case Op::Cancel:
+            case Op::ConnectTimeout:
+            case Op::Notify:
+            case Op::Accept:
+                break;
+            case Op::Close:
+                ch.fd = -1;
+                break;
+        }
+        if (ch.state == ChannelState::Closing) finish_close(slot);
+    }
+
+    void on_recv(uint32_t slot, int res, uint32_t flags, bool more) noexcept {
+        Channel& ch = channels_[slot];
+        if (!more) ch.receiving = false;
+
+        if (ProvidedBufferGroup::has_buffer(flags)) {
+            const uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(flags);
+            const char* data = buffers_.buffer(buf_id);
+            if (res > 0 && data && ch.state == ChannelState::Open) {
+                stats_.messages += ch.reassembler.feed(
+                    buf_id, std::span<const char>{data, static_cast<size_t>(res)},
+                    [&ch](std::span<const char> message) {
+                        if (ch.state == ChannelState::Open) ch.handler->on_message(message);
+                    },
+                    [this](uint16_t id) { (void)buffers_.replenish(id); });
+                if (ch.state == ChannelState::Open) ch.handler->on_receive_complete();
+            } else {
+                (void)buffers_.replenish(buf_id);
+            }
+        }
+
+        if (more || ch.state != ChannelState::Open) return;
+        if (res == 0) {
+            begin_close(slot, TransportError{TransportErrorCode::ConnectionClosed});
+        } else if (res < 0 && res != -ENOBUFS) {
+            begin_close(slot, TransportError{TransportErrorCode::ReadError, -res});
+        } else {
+            arm_recv(slot);  // Kernel ended the multishot (e.g. buffers ran out)
+        }
+    }
+
+    void on_notify(uint32_t index, int res) noexcept {
+        if (index >= watches_.size()) return;
+        if (res > 0) {
+            ++stats_.notifications;
+            watches_[index]->handler->on_notified();
+        }
+        if (res != -EBADF) arm_notifier(index);
+    }
+
+    void on_accept(uint32_t index, int res, uint32_t flags) noexcept {
+        if (index >= listeners_.size()) return;
+        Listener& listener = *listeners_[index];
+        if (res >= 0) {
+            ++stats_.accepts;
+            listener.handler->on_accept(res);
+        } else if (res != -ECANCELED) {
+            listener.handler->on_accept_error(TransportError{TransportErrorCode::SocketError, -res});
+        }
+        // Multishot ends on error or overflow; a closed listener is not re-armed
+        if (!ProvidedBufferGroup::has_more(flags) && res != -EBADF && res != -EINVAL &&
+            res != -ECANCELED) {
+            arm_accept(index);
+        }
+    }
+
+    void on_send(uint32_t slot, int res) noexcept {
+        Channel& ch = channels_[slot];
+        ch.sending = false;
+        if (ch.state != ChannelState::Open) return;
+        if (res < 0) {
+            begin_close(slot, TransportError{TransportErrorCode::WriteError, -res});
+            return;
+        }
+        ++stats_.sends;
+        ch.in_flight_sent += static_cast<size_t>(res);
+        start_send(slot);  // Remainder of a short send, then staged data
+    }
+
+    IoUringReactorConfig config_;
+    IoUringContext ctx_;
+    ProvidedBufferGroup buffers_;
+    std::unique_ptr<Channel[]> channels_;
+    std::vector<uint32_t> free_slots_;
+    std::vector<std::unique_ptr<NotifierWatch>> watches_;
+    std::vector<std::unique_ptr<Listener>> listeners_;
+    ReactorStats stats_;
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+} // namespace nfx
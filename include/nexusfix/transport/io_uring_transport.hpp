@@ -2,6 +2,14 @@
 
 #include "nexusfix/transport/socket.hpp"
 #include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/parser/message_reassembler.hpp"
+#include "nexusfix/transport/timestamping.hpp"
+#include "nexusfix/transport/ktls.hpp"
+#include "nexusfix/transport/send_backpressure.hpp"
+#include "nexusfix/memory/numa.hpp"
+#include "nexusfix/memory/queue_notifier.hpp"
+#include "nexusfix/util/working_set.hpp"
+#include "nexusfix/util/prefetch.hpp"
 
 // Only include io_uring on Linux when available
 #if defined(NFX_HAS_IO_URING) && NFX_HAS_IO_URING
@@ -11,18 +19,76 @@
     #define NFX_IO_URING_AVAILABLE 0
 #endif
 
+// Zero-copy send (IORING_OP_SEND_ZC, liburing 2.3+ / kernel 6.0+)
+#if NFX_IO_URING_AVAILABLE && defined(IORING_CQE_F_NOTIF)
+    #define NFX_IO_URING_SEND_ZC 1
+#else
+    #define NFX_IO_URING_SEND_ZC 0
+#endif
+
+// Ring-mapped provided buffers (io_uring_register_buf_ring, kernel 5.19+).
+// IORING_REGISTER_PBUF_RING is an enum; multishot recv's flag ships with it.
+#if NFX_IO_URING_AVAILABLE && defined(IORING_RECV_MULTISHOT)
+    #define NFX_IO_URING_BUF_RING 1
+#else
+    #define NFX_IO_URING_BUF_RING 0
+#endif
+
+// NAPI busy poll registration (io_uring_register_napi, liburing 2.6+ /
+// kernel 6.9+). IORING_REGISTER_NAPI is an enum, so go by liburing version.
+#if NFX_IO_URING_AVAILABLE && defined(IO_URING_CHECK_VERSION)
+    #if !IO_URING_CHECK_VERSION(2, 6)
+        #define NFX_IO_URING_NAPI 1
+    #endif
+#endif
+#if !defined(NFX_IO_URING_NAPI)
+    #define NFX_IO_URING_NAPI 0
+#endif
+
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <unistd.h>
+#include <bit>
+#include <memory_resource>
 #include <vector>
 #include <cstdlib>
 #include <cstring>
 
 namespace nfx {
 
+// ============================================================================
+// SQPOLL Configuration
+// ============================================================================
+
+/// Kernel-side submission polling (IORING_SETUP_SQPOLL)
+/// A kernel thread drains the SQ, so submit() is a ring store with no
+/// io_uring_enter while the poller is awake: one core traded for
+/// syscall-free sends. Pick the core with CpuAffinityConfig::reserve_core()
+/// so sessions are not mapped onto it.
+struct SqPollConfig {
+    bool enabled{false};
+    int cpu{-1};                  // Poller core (IORING_SETUP_SQ_AFF), -1 = unpinned
+    unsigned idle_ms{2000};       // Poller sleeps after this long without SQEs
+    unsigned wait_spin{10000};    // wait(): peeks before blocking in the kernel
+};
+
+// ============================================================================
+// NAPI Busy Poll Configuration
+// ============================================================================
+
+/// Busy-poll the NIC receive queues of the ring's sockets from the ring's
+/// own waits (IORING_REGISTER_NAPI, kernel 6.9+) instead of waiting for
+/// the interrupt and softirq. The ring learns the queues (NAPI ids) from
+/// the sockets it receives on; loopback and unix sockets have none.
+struct NapiConfig {
+    bool enabled{false};
+    unsigned busy_poll_us{50};    // Busy-poll budget per wait
+    bool prefer_busy_poll{true};  // Keep softirq off the queue while busy polling
+};
+
 #if NFX_IO_URING_AVAILABLE
 
 // ============================================================================
@@ -37,7 +103,8 @@ enum class IoOperation : uint8_t {
     Read,
     Write,
     Close,
-    RecvMultishot  // Multishot receive (kernel 5.20+)
+    RecvMultishot,    // Multishot receive (kernel 5.20+)
+    ZeroCopyNotify    // Kernel released a zero-copy send buffer
 };
 
 /// Completion event from io_uring
@@ -47,6 +114,71 @@ struct IoEvent {
     void* user_data;  // User-provided context
 };
 
+/// True for the second CQE of a zero-copy send: the kernel no longer
+/// references the buffer (same user_data as the send's result CQE)
+[[nodiscard]] inline bool is_zero_copy_notification(uint32_t cqe_flags) noexcept {
+#if NFX_IO_URING_SEND_ZC
+    return (cqe_flags & IORING_CQE_F_NOTIF) != 0;
+#else
+    (void)cqe_flags;
+    return false;
+#endif
+}
+
+/// Completion copied out of the CQ ring by IoUringContext::reap()
+struct CqeEntry {
+    uint64_t user_data;
+    int res;
+    uint32_t flags;
+
+    [[nodiscard]] static CqeEntry from(const struct io_uring_cqe* cqe) noexcept {
+        return {cqe->user_data, cqe->res, cqe->flags};
+    }
+
+    [[nodiscard]] void* data() const noexcept {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(user_data));
+    }
+};
+
+/// Default reap() prefetch: user_data is a pointer to the completion's owner
+/// (a stale or tagged value is harmless, prefetch does not fault)
+struct PrefetchUserData {
+    void operator()(const CqeEntry& cqe) const noexcept {
+        util::prefetch_read(cqe.data());
+    }
+};
+
+/// reap() prefetch for rings whose completions all have one owner
+struct NoPrefetch {
+    void operator()(const CqeEntry&) const noexcept {}
+};
+
+// ============================================================================
+// Queue Notifier Registration
+// ============================================================================
+
+/// Read a QueueNotifier's eventfd (EventFd mode): completes with 8 bytes in
+/// *counter once a producer wakes the sleeping consumer. Re-arm after each
+/// completion; the read itself consumes the signal.
+inline void prep_notifier_read(struct io_uring_sqe* sqe, const memory::QueueNotifier& notifier,
+                               uint64_t* counter) noexcept {
+    io_uring_prep_read(sqe, notifier.fd(), counter, sizeof(*counter), 0);
+}
+
+/// Poll a QueueNotifier's eventfd (EventFd mode) for POLLIN; call
+/// notifier.drain() on completion
+/// @param multishot Keep the poll armed across completions (kernel 5.13+)
+inline void prep_notifier_poll(struct io_uring_sqe* sqe, const memory::QueueNotifier& notifier,
+                               [[maybe_unused]] bool multishot = false) noexcept {
+#if defined(IORING_POLL_ADD_MULTI)
+    if (multishot) {
+        io_uring_prep_poll_multishot(sqe, notifier.fd(), POLLIN);
+        return;
+    }
+#endif
+    io_uring_prep_poll_add(sqe, notifier.fd(), POLLIN);
+}
+
 // ============================================================================
 // io_uring Context
 // ============================================================================
@@ -70,7 +202,18 @@ public:
 
     /// Initialize io_uring with modern kernel optimizations (kernel 6.1+)
     /// DEFER_TASKRUN + COOP_TASKRUN + SINGLE_ISSUER provide ~27% throughput improvement
-    [[nodiscard]] TransportResult<void> init(unsigned queue_depth = QUEUE_DEPTH) noexcept {
+    /// With sqpoll.enabled, SQPOLL is tried first (the two are exclusive);
+    /// if the kernel refuses it, initialization falls back as usual.
+    [[nodiscard]] TransportResult<void> init(
+        unsigned queue_depth = QUEUE_DEPTH, const SqPollConfig& sqpoll = {}) noexcept
+    {
+        if (sqpoll.enabled && try_init_sqpoll(queue_depth, sqpoll) == 0) {
+            sqpoll_ = true;
+            wait_spin_ = sqpoll.wait_spin;
+            initialized_ = true;
+            return {};
+        }
+
         int ret = try_init_optimized(queue_depth);
 
         if (ret < 0) {
@@ -93,7 +236,38 @@ public:
         return optimized_;
     }
 
+    /// Check if a kernel thread polls the SQ (SQPOLL enabled)
+    [[nodiscard]] bool is_sqpoll() const noexcept {
+        return sqpoll_;
+    }
+
 private:
+    /// SQPOLL (kernel 5.11+ unprivileged); keeps COOP_TASKRUN and
+    /// SINGLE_ISSUER (the poller is the issuer), never DEFER_TASKRUN
+    [[nodiscard]] int try_init_sqpoll(unsigned queue_depth, const SqPollConfig& sqpoll) noexcept {
+#if defined(IORING_SETUP_SQPOLL)
+        auto init_with = [&](unsigned extra_flags) noexcept {
+            struct io_uring_params params = {};
+            params.flags = IORING_SETUP_SQPOLL | extra_flags;
+#if defined(IORING_SETUP_SQ_AFF)
+            if (sqpoll.cpu >= 0) {
+                params.flags |= IORING_SETUP_SQ_AFF;
+                params.sq_thread_cpu = static_cast<unsigned>(sqpoll.cpu);
+            }
+#endif
+            params.sq_thread_idle = sqpoll.idle_ms;
+            return io_uring_queue_init_params(queue_depth, &ring_, &params);
+        };
+#if defined(IORING_SETUP_SINGLE_ISSUER)
+        if (init_with(IORING_SETUP_COOP_TASKRUN | IORING_SETUP_SINGLE_ISSUER) == 0) return 0;
+#endif
+        return init_with(0);  // Older kernel: plain SQPOLL
+#else
+        (void)queue_depth; (void)sqpoll;
+        return -ENOTSUP;
+#endif
+    }
+
     /// Try to initialize with modern kernel flags (kernel 6.0+)
     /// Returns 0 on success, negative errno on failure
     [[nodiscard]] int try_init_optimized(unsigned queue_depth) noexcept {
@@ -144,7 +318,12 @@ public:
     }
 
     /// Wait for completion
+    /// Under SQPOLL, spins on the CQ first: completions usually land
+    /// without entering the kernel.
     int wait(struct io_uring_cqe** cqe, int timeout_ms = -1) noexcept {
+        for (unsigned spin = 0; spin < wait_spin_; ++spin) {
+            if (io_uring_peek_cqe(&ring_, cqe) == 0) return 0;
+        }
         if (timeout_ms < 0) {
             return io_uring_wait_cqe(&ring_, cqe);
         }
@@ -165,6 +344,59 @@ public:
         return io_uring_peek_cqe(&ring_, cqe);
     }
 
+    /// Post completions the kernel holds back for the next io_uring_enter()
+    /// Under DEFER_TASKRUN, socket completions and zero-copy notifications
+    /// are task work that only runs on entry; a non-blocking poll that
+    /// just peeks the CQ would never see them. No-op on other rings.
+    void get_events() noexcept {
+        if (optimized_) (void)io_uring_get_events(&ring_);
+    }
+
+    /// Completions per reap() batch
+    static constexpr unsigned CQE_BATCH = 32;
+
+    /// Peek up to cqes.size() completions without consuming them
+    [[nodiscard]] unsigned peek_batch(std::span<struct io_uring_cqe*> cqes) noexcept {
+        return io_uring_peek_batch_cqe(&ring_, cqes.data(), static_cast<unsigned>(cqes.size()));
+    }
+
+    /// Consume n peeked completions with one CQ head store
+    void advance(unsigned n) noexcept {
+        io_uring_cq_advance(&ring_, n);
+    }
+
+    /// Deliver every ready completion (non-blocking)
+    /// Completions are taken CQE_BATCH at a time: copied out, consumed with
+    /// one CQ head store instead of one per CQE, then handed to on_cqe in
+    /// order. While one is handled, prefetch(next) warms the next one's
+    /// owner (by default the object user_data points to). Handlers may submit, and even reap: the batch is no
+    /// longer in the ring.
+    /// @param on_cqe Called as on_cqe(const CqeEntry&)
+    /// @return Completions delivered
+    template <typename Handler, typename Prefetch = PrefetchUserData>
+    unsigned reap(Handler&& on_cqe, Prefetch&& prefetch = {}) noexcept {
+        struct io_uring_cqe* cqes[CQE_BATCH];
+        CqeEntry batch[CQE_BATCH];
+        unsigned total = 0;
+
+        for (;;) {
+            const unsigned n = peek_batch(cqes);
+            if (n == 0) break;
+            for (unsigned i = 0; i < n; ++i) {
+                batch[i] = CqeEntry::from(cqes[i]);
+            }
+            advance(n);
+
+            for (unsigned i = 0; i < n; ++i) {
+                if (i + 1 < n) prefetch(batch[i + 1]);
+                on_cqe(batch[i]);
+            }
+            total += n;
+            if (n < CQE_BATCH) break;
+        }
+        return total;
+    }
+
     /// Get underlying ring
     [[nodiscard]] struct io_uring* ring() noexcept {
         return &ring_;
@@ -237,14 +469,126 @@ public:
         return nr_registered_buffers_;
     }
 
+    // ========================================================================
+    // Registered Files (kernel 5.5+)
+    // ========================================================================
+    // A fixed-file slot replaces the fd-table lookup and file refcount the
+    // kernel does for every SQE on a raw fd: the SQE carries the slot index
+    // with IOSQE_FIXED_FILE. IoUringSocket takes a slot on create() when
+    // the ring has a table and returns it on close.
+
+    /// Register a sparse table of slots fixed files (all empty)
+    [[nodiscard]] int register_file_table(unsigned slots) noexcept {
+        if (!initialized_ || slots == 0) return -EINVAL;
+        if (!file_slots_.empty()) return -EBUSY;
+
+        std::vector<int> fds(slots, -1);
+        int ret = io_uring_register_files(&ring_, fds.data(), slots);
+        if (ret == 0) {
+            file_slots_ = std::move(fds);
+        }
+        return ret;
+    }
+
+    /// Put fd in a free fixed-file slot
+    /// @return Slot index, or negative errno (-ENFILE when the table is full)
+    [[nodiscard]] int register_file(int fd) noexcept {
+        for (size_t slot = 0; slot < file_slots_.size(); ++slot) {
+            if (file_slots_[slot] != -1) continue;
+            int ret = io_uring_register_files_update(&ring_, static_cast<unsigned>(slot), &fd, 1);
+            if (ret < 0) return ret;
+            file_slots_[slot] = fd;
+            return static_cast<int>(slot);
+        }
+        return file_slots_.empty() ? -EINVAL : -ENFILE;
+    }
+
+    /// Empty a slot taken by register_file()
+    void unregister_file(int slot) noexcept {
+        if (slot < 0 || static_cast<size_t>(slot) >= file_slots_.size()) return;
+        int empty = -1;
+        (void)io_uring_register_files_update(&ring_, static_cast<unsigned>(slot), &empty, 1);
+        file_slots_[static_cast<size_t>(slot)] = -1;
+    }
+
+    /// Check if a fixed-file table is registered
+    [[nodiscard]] bool has_file_table() const noexcept {
+        return !file_slots_.empty();
+    }
+
+    /// Number of fixed-file slots (0 without a table)
+    [[nodiscard]] size_t file_table_size() const noexcept {
+        return file_slots_.size();
+    }
+
+    // ========================================================================
+    // NAPI Busy Poll (kernel 6.9+)
+    // ========================================================================
+
+    /// Busy-poll the NIC queues of this ring's sockets while waiting
+    /// @return 0, or negative errno (-ENOTSUP without liburing 2.6,
+    ///         -EINVAL on kernels before 6.9)
+    [[nodiscard]] int register_napi(const NapiConfig& napi) noexcept {
+#if NFX_IO_URING_NAPI
+        if (!initialized_) return -EINVAL;
+        struct io_uring_napi arg{};
+        arg.busy_poll_to = napi.busy_poll_us;
+        arg.prefer_busy_poll = napi.prefer_busy_poll ? 1 : 0;
+        int ret = io_uring_register_napi(&ring_, &arg);
+        if (ret == 0) {
+            napi_ = true;
+        }
+        return ret;
+#else
+        (void)napi;
+        return -ENOTSUP;
+#endif
+    }
+
+    /// Check if NAPI busy poll is registered
+    [[nodiscard]] bool has_napi() const noexcept {
+        return napi_;
+    }
+
 private:
     struct io_uring ring_;
     bool initialized_;
     bool optimized_;  // True if DEFER_TASKRUN is enabled (kernel 6.1+)
+    bool sqpoll_{false};
+    unsigned wait_spin_{0};  // Non-zero only under SQPOLL
     bool registered_buffers_{false};
     unsigned nr_registered_buffers_{0};
+    std::vector<int> file_slots_;  // fd per fixed-file slot, -1 = free
+    bool napi_{false};
 };
 
+// ============================================================================
+// Buffer Memory
+// ============================================================================
+
+/// Page-aligned buffer memory from resource, or aligned_alloc() if null
+[[nodiscard]] inline char* allocate_buffer_memory(std::pmr::memory_resource* resource,
+                                                  size_t size) noexcept {
+    if (!resource) {
+        return static_cast<char*>(aligned_alloc(4096, (size + 4095) & ~size_t{4095}));
+    }
+    try {
+        return static_cast<char*>(resource->allocate(size, 4096));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+/// Release memory from allocate_buffer_memory()
+inline void release_buffer_memory(std::pmr::memory_resource* resource,
+                                  char* memory, size_t size) noexcept {
+    if (resource) {
+        resource->deallocate(memory, size, 4096);
+    } else {
+        free(memory);
+    }
+}
+
 // ============================================================================
 // Registered Buffer Pool
 // ============================================================================
@@ -266,15 +610,23 @@ public:
     RegisteredBufferPool(const RegisteredBufferPool&) = delete;
     RegisteredBufferPool& operator=(const RegisteredBufferPool&) = delete;
 
+    /// Take buffer memory from resource instead of aligned_alloc() (e.g. a
+    /// HugePageMemoryResource); must be set before init() and outlive the pool
+    void set_memory_resource(std::pmr::memory_resource* resource) noexcept {
+        if (!initialized_) resource_ = resource;
+    }
+
     /// Initialize and register buffers with io_uring
     /// @param ctx io_uring context to register with
     /// @param buffer_size Size of each buffer
     /// @param num_buffers Number of buffers to allocate
+    /// @param numa_node Place the buffers on this NUMA node (-1 = any)
     /// @return true on success
     [[nodiscard]] bool init(
         IoUringContext& ctx,
         size_t buffer_size = DEFAULT_BUFFER_SIZE,
-        size_t num_buffers = DEFAULT_NUM_BUFFERS) noexcept
+        size_t num_buffers = DEFAULT_NUM_BUFFERS,
+        int numa_node = -1) noexcept
     {
         if (initialized_) return false;
 
@@ -284,9 +636,13 @@ public:
         // Allocate aligned memory for all buffers
         // Page-aligned for optimal kernel mapping
         size_t total_size = buffer_size * num_buffers;
-        memory_ = static_cast<char*>(aligned_alloc(4096, total_size));
+        memory_ = allocate_buffer_memory(resource_, total_size);
         if (!memory_) return false;
 
+        // Before registration pins the pages; migrate any already resident
+        (void)memory::numa_bind(memory_, total_size, numa_node,
+                                memory::NumaPolicy::Preferred, true);
+
         // Build iovec array
         iovecs_.resize(num_buffers);
         for (size_t i = 0; i < num_buffers; ++i) {
@@ -335,6 +691,14 @@ public:
         return static_cast<char*>(iovecs_[index].iov_base);
     }
 
+    /// Index of the buffer containing ptr, or -1 if ptr is not in the pool
+    [[nodiscard]] int index_of(const char* ptr) const noexcept {
+        if (!memory_ || ptr < memory_ || ptr >= memory_ + buffer_size_ * num_buffers_) {
+            return -1;
+        }
+        return static_cast<int>(static_cast<size_t>(ptr - memory_) / buffer_size_);
+    }
+
     /// Get buffer size
     [[nodiscard]] size_t buffer_size() const noexcept { return buffer_size_; }
 
@@ -344,6 +708,12 @@ public:
     /// Get number of available buffers
     [[nodiscard]] size_t available() const noexcept { return free_indices_.size(); }
 
+    /// Buffer memory (registered with the kernel)
+    size_t memory_regions(std::span<util::MemoryRegion> out) const noexcept {
+        return util::write_regions(out, {
+            {"registered_buffers", memory_, buffer_size_ * num_buffers_}});
+    }
+
     /// Check if initialized
     [[nodiscard]] bool is_initialized() const noexcept { return initialized_; }
 
@@ -353,7 +723,7 @@ private:
             (void)ctx_->unregister_buffers();
         }
         if (memory_) {
-            free(memory_);
+            release_buffer_memory(resource_, memory_, buffer_size_ * num_buffers_);
             memory_ = nullptr;
         }
         iovecs_.clear();
@@ -362,6 +732,7 @@ private:
     }
 
     IoUringContext* ctx_{nullptr};
+    std::pmr::memory_resource* resource_{nullptr};
     char* memory_{nullptr};
     std::vector<struct iovec> iovecs_;
     std::vector<uint16_t> free_indices_;
@@ -382,11 +753,23 @@ private:
 /// - Single SQE handles multiple receives (~30% syscall reduction)
 /// - Kernel selects buffer from group (no user-space buffer management per-recv)
 /// - Automatic re-arm until cancelled
+///
+/// Two registration modes:
+/// - ProvideBuffers: IORING_OP_PROVIDE_BUFFERS, one SQE per returned buffer
+/// - Ring: ring-mapped buffer ring shared with the kernel; a buffer is
+///   returned with a userspace store and a tail bump, no SQE or submit
+///   (falls back to ProvideBuffers where registration fails)
 class ProvidedBufferGroup {
 public:
     static constexpr uint16_t DEFAULT_GROUP_ID = 0;
     static constexpr size_t DEFAULT_BUFFER_SIZE = 4096;
     static constexpr size_t DEFAULT_NUM_BUFFERS = 128;
+    static constexpr size_t MAX_RING_ENTRIES = 32768;
+
+    enum class Mode : uint8_t {
+        ProvideBuffers,
+        Ring
+    };
 
     ProvidedBufferGroup() noexcept = default;
 
@@ -398,21 +781,30 @@ public:
     ProvidedBufferGroup(const ProvidedBufferGroup&) = delete;
     ProvidedBufferGroup& operator=(const ProvidedBufferGroup&) = delete;
 
+    /// Take buffer memory from resource instead of aligned_alloc() (e.g. a
+    /// HugePageMemoryResource); must be set before init() and outlive the group
+    void set_memory_resource(std::pmr::memory_resource* resource) noexcept {
+        if (!initialized_) resource_ = resource;
+    }
+
     /// Initialize buffer group and register with io_uring
     /// @param ctx io_uring context
     /// @param group_id Buffer group ID (0 is default)
     /// @param buffer_size Size of each buffer
     /// @param num_buffers Number of buffers in group
+    /// @param mode Registration mode (Ring falls back to ProvideBuffers)
+    /// @param numa_node Place the buffers on this NUMA node (-1 = any)
     /// @return true on success
     [[nodiscard]] bool init(
         IoUringContext& ctx,
         uint16_t group_id = DEFAULT_GROUP_ID,
         size_t buffer_size = DEFAULT_BUFFER_SIZE,
-        size_t num_buffers = DEFAULT_NUM_BUFFERS) noexcept
+        size_t num_buffers = DEFAULT_NUM_BUFFERS,
+        Mode mode = Mode::ProvideBuffers,
+        int numa_node = -1) noexcept
     {
         if (initialized_) return false;
 
-#if defined(IORING_OP_PROVIDE_BUFFERS)
         ctx_ = &ctx;
         group_id_ = group_id;
         buffer_size_ = buffer_size;
@@ -420,8 +812,15 @@ public:
 
         // Allocate contiguous memory for all buffers
         size_t total_size = buffer_size * num_buffers;
-        memory_ = static_cast<char*>(aligned_alloc(4096, total_size));
+        memory_ = allocate_buffer_memory(resource_, total_size);
         if (!memory_) return false;
+        (void)memory::numa_bind(memory_, total_size, numa_node,
+                                memory::NumaPolicy::Preferred, true);
+
+        if (mode == Mode::Ring && init_ring()) {
+            initialized_ = true;
+            return true;
+        }
 
         // Register buffers with kernel using PROVIDE_BUFFERS
         auto* sqe = ctx.get_sqe();
@@ -450,10 +849,6 @@ public:
 
         initialized_ = true;
         return true;
-#else
-        (void)ctx; (void)group_id; (void)buffer_size; (void)num_buffers;
-        return false;  // Kernel too old
-#endif
     }
 
     /// Get buffer pointer from completion buffer ID
@@ -466,9 +861,18 @@ public:
     /// Replenish a consumed buffer back to the group
     /// Must be called after processing data from multishot receive
     [[nodiscard]] bool replenish(uint16_t buf_id) noexcept {
-#if defined(IORING_OP_PROVIDE_BUFFERS)
         if (!initialized_ || !ctx_ || buf_id >= num_buffers_) return false;
 
+#if NFX_IO_URING_BUF_RING
+        if (ring_) {
+            io_uring_buf_ring_add(ring_, memory_ + (buf_id * buffer_size_),
+                                  static_cast<unsigned>(buffer_size_), buf_id,
+                                  io_uring_buf_ring_mask(ring_entries_), 0);
+            io_uring_buf_ring_advance(ring_, 1);  // Visible to the kernel now
+            return true;
+        }
+#endif
+
         auto* sqe = ctx_->get_sqe();
         if (!sqe) return false;
 
@@ -476,10 +880,6 @@ public:
         io_uring_prep_provide_buffers(sqe, buf, static_cast<int>(buffer_size_), 1, group_id_, buf_id);
 
         return true;  // Caller should batch and submit
-#else
-        (void)buf_id;
-        return false;
-#endif
     }
 
     /// Get buffer group ID
@@ -494,14 +894,34 @@ public:
     /// Check if initialized
     [[nodiscard]] bool is_initialized() const noexcept { return initialized_; }
 
+    /// True if registered as a ring-mapped buffer ring
+    [[nodiscard]] bool uses_ring() const noexcept {
+#if NFX_IO_URING_BUF_RING
+        return ring_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /// True if replenish() queues an SQE the caller must submit
+    [[nodiscard]] bool replenish_needs_submit() const noexcept { return !uses_ring(); }
+
+    /// Buffer memory and, when ring-mapped, the buffer ring
+    size_t memory_regions(std::span<util::MemoryRegion> out) const noexcept {
+#if NFX_IO_URING_BUF_RING
+        if (ring_) {
+            return util::write_regions(out, {
+                {"provided_buffers", memory_, buffer_size_ * num_buffers_},
+                {"provided_buffer_ring", ring_, ring_entries_ * sizeof(struct io_uring_buf)}});
+        }
+#endif
+        return util::write_regions(out, {
+            {"provided_buffers", memory_, buffer_size_ * num_buffers_}});
+    }
+
     /// Extract buffer ID from CQE flags
     [[nodiscard]] static uint16_t buffer_id_from_cqe(uint32_t cqe_flags) noexcept {
-#if defined(IORING_CQE_BUFFER_SHIFT)
         return static_cast<uint16_t>(cqe_flags >> IORING_CQE_BUFFER_SHIFT);
-#else
-        (void)cqe_flags;
-        return 0;
-#endif
     }
 
     /// Check if CQE has more completions coming (multishot)
@@ -525,17 +945,64 @@ public:
     }
 
 private:
+    /// Register a buffer ring for group_id_ and publish every buffer
+    [[nodiscard]] bool init_ring() noexcept {
+#if NFX_IO_URING_BUF_RING
+        if (num_buffers_ == 0 || num_buffers_ > MAX_RING_ENTRIES) return false;
+        ring_entries_ = static_cast<unsigned>(std::bit_ceil(num_buffers_));
+
+        const size_t ring_size = ring_entries_ * sizeof(struct io_uring_buf);
+        auto* ring = static_cast<struct io_uring_buf_ring*>(
+            aligned_alloc(4096, (ring_size + 4095) & ~size_t{4095}));
+        if (!ring) return false;
+
+        struct io_uring_buf_reg reg{};
+        reg.ring_addr = reinterpret_cast<uint64_t>(ring);
+        reg.ring_entries = ring_entries_;
+        reg.bgid = group_id_;
+        io_uring_buf_ring_init(ring);
+        if (io_uring_register_buf_ring(ctx_->ring(), &reg, 0) != 0) {
+            free(ring);
+            return false;
+        }
+
+        const int mask = io_uring_buf_ring_mask(ring_entries_);
+        for (size_t i = 0; i < num_buffers_; ++i) {
+            io_uring_buf_ring_add(ring, memory_ + (i * buffer_size_),
+                                  static_cast<unsigned>(buffer_size_),
+                                  static_cast<unsigned short>(i), mask, static_cast<int>(i));
+        }
+        io_uring_buf_ring_advance(ring, static_cast<int>(num_buffers_));
+        ring_ = ring;
+        return true;
+#else
+        return false;
+#endif
+    }
+
     void cleanup() noexcept {
+#if NFX_IO_URING_BUF_RING
+        if (ring_) {
+            (void)io_uring_unregister_buf_ring(ctx_->ring(), group_id_);
+            free(ring_);
+            ring_ = nullptr;
+        }
+#endif
         if (memory_) {
             // Note: kernel automatically cleans up provided buffers on ring exit
-            free(memory_);
+            release_buffer_memory(resource_, memory_, buffer_size_ * num_buffers_);
             memory_ = nullptr;
         }
         initialized_ = false;
     }
 
     IoUringContext* ctx_{nullptr};
+    std::pmr::memory_resource* resource_{nullptr};
     char* memory_{nullptr};
+#if NFX_IO_URING_BUF_RING
+    struct io_uring_buf_ring* ring_{nullptr};
+    unsigned ring_entries_{0};
+#endif
     uint16_t group_id_{0};
     size_t buffer_size_{0};
     size_t num_buffers_{0};
@@ -568,6 +1035,11 @@ public:
         if (fd_ < 0) {
             return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
         }
+        if (ctx_.has_file_table()) {
+            // Table full or unsupported: keep using the raw fd
+            const int slot = ctx_.register_file(fd_);
+            fixed_ = slot >= 0 ? slot : -1;
+        }
         return {};
     }
 
@@ -583,6 +1055,7 @@ public:
         }
 
         io_uring_prep_connect(sqe, fd_, addr, addrlen);
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
         state_ = ConnectionState::Connecting;
 
@@ -600,6 +1073,25 @@ public:
         }
 
         io_uring_prep_recv(sqe, fd_, buffer.data(), buffer.size(), 0);
+        use_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, user_data);
+
+        return {};
+    }
+
+    /// Submit async recvmsg (carries control messages, e.g. timestamps)
+    /// @param msg Message header; must stay valid until completion
+    [[nodiscard]] TransportResult<void> submit_recvmsg(
+        struct msghdr* msg,
+        void* user_data = nullptr) noexcept
+    {
+        auto sqe = ctx_.get_sqe();
+        if (!sqe) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+
+        io_uring_prep_recvmsg(sqe, fd_, msg, 0);
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
@@ -616,6 +1108,7 @@ public:
         }
 
         io_uring_prep_send(sqe, fd_, data.data(), data.size(), 0);
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
@@ -645,6 +1138,7 @@ public:
 
         // Use read_fixed which uses pre-registered buffer
         io_uring_prep_read_fixed(sqe, fd_, nullptr, len, offset, buf_index);
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
@@ -668,9 +1162,63 @@ public:
 
         // Use write_fixed which uses pre-registered buffer
         io_uring_prep_write_fixed(sqe, fd_, nullptr, len, offset, buf_index);
+        use_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, user_data);
+
+        return {};
+    }
+
+    /// Submit async write of data held in a registered buffer
+    /// @param data Bytes to write; must lie inside registered buffer buf_index
+    /// @param buf_index Index of registered buffer
+    /// @param user_data User context
+    [[nodiscard]] TransportResult<void> submit_write_fixed(
+        std::span<const char> data,
+        uint16_t buf_index,
+        void* user_data = nullptr) noexcept
+    {
+        auto sqe = ctx_.get_sqe();
+        if (!sqe) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+
+        io_uring_prep_write_fixed(sqe, fd_, data.data(),
+                                  static_cast<unsigned>(data.size()), 0, buf_index);
+        use_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, user_data);
+
+        return {};
+    }
+
+    // ========================================================================
+    // Zero-Copy Send (kernel 6.0+)
+    // ========================================================================
+    // The kernel sends straight from user pages. Completion posts two CQEs
+    // with the same user_data: the result (IORING_CQE_F_MORE set if a
+    // notification follows), then a notification (IORING_CQE_F_NOTIF) once
+    // the pages are released. The buffer must stay untouched until then.
+
+    /// Submit zero-copy send of data held in registered buffer buf_index
+    [[nodiscard]] TransportResult<void> submit_send_zc_fixed(
+        std::span<const char> data,
+        uint16_t buf_index,
+        void* user_data = nullptr) noexcept
+    {
+#if NFX_IO_URING_SEND_ZC
+        auto sqe = ctx_.get_sqe();
+        if (!sqe) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+
+        io_uring_prep_send_zc_fixed(sqe, fd_, data.data(), data.size(), MSG_NOSIGNAL, 0, buf_index);
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
+#else
+        (void)data; (void)buf_index; (void)user_data;
+        return std::unexpected{TransportError{TransportErrorCode::SocketError, ENOTSUP}};
+#endif
     }
 
     // ========================================================================
@@ -706,6 +1254,7 @@ public:
         sqe->flags |= IOSQE_BUFFER_SELECT;
         sqe->buf_group = buf_group_id;
         sqe->ioprio |= IORING_RECV_MULTISHOT;
+        use_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         multishot_active_ = true;
@@ -748,6 +1297,7 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
+        release_fixed_file();
         io_uring_prep_close(sqe, fd_);
         io_uring_sqe_set_data(sqe, user_data);
         state_ = ConnectionState::Disconnecting;
@@ -758,6 +1308,7 @@ public:
     /// Synchronous close (for cleanup)
     void close_sync() noexcept {
         if (fd_ >= 0) {
+            release_fixed_file();
             ::close(fd_);
             fd_ = -1;
             state_ = ConnectionState::Disconnected;
@@ -795,6 +1346,11 @@ public:
         }
     }
 
+    /// Apply SO_TIMESTAMPING (see timestamping.hpp)
+    [[nodiscard]] bool set_timestamping(const TimestampingConfig& config) noexcept {
+        return fd_ >= 0 && enable_socket_timestamping(fd_, config);
+    }
+
     [[nodiscard]] bool is_connected() const noexcept {
         return state_ == ConnectionState::Connected;
     }
@@ -802,7 +1358,27 @@ public:
     [[nodiscard]] ConnectionState state() const noexcept { return state_; }
     [[nodiscard]] int fd() const noexcept { return fd_; }
 
+    /// True if SQEs address the socket through a registered file slot
+    [[nodiscard]] bool is_fixed_file() const noexcept { return fixed_ >= 0; }
+    [[nodiscard]] int fixed_file() const noexcept { return fixed_; }
+
 private:
+    /// Address the socket by its fixed-file slot (IOSQE_FIXED_FILE)
+    void use_fixed_file(struct io_uring_sqe* sqe) const noexcept {
+        if (fixed_ >= 0) {
+            sqe->fd = fixed_;
+            sqe->flags |= IOSQE_FIXED_FILE;
+        }
+    }
+
+    /// Return the slot before closing; the close itself goes by raw fd
+    void release_fixed_file() noexcept {
+        if (fixed_ >= 0) {
+            ctx_.unregister_file(fixed_);
+            fixed_ = -1;
+        }
+    }
+
     void apply_options() noexcept {
         set_nodelay(true);
         set_keepalive(true);
@@ -810,6 +1386,7 @@ private:
 
     IoUringContext& ctx_;
     int fd_;
+    int fixed_{-1};  // Registered file slot, -1 = raw fd
     ConnectionState state_;
     bool multishot_active_{false};
 };
@@ -840,6 +1417,52 @@ struct IoUringTransportConfig {
 
     /// Buffer group ID for multishot receive
     uint16_t multishot_group_id{0};
+
+    /// Ring-mapped multishot buffers (kernel 5.19+): returning a buffer is
+    /// a userspace store instead of a PROVIDE_BUFFERS SQE
+    bool use_buf_ring{true};
+
+    /// Kernel SQ polling for the transport's ring (applied at ring init:
+    /// ctx.init(depth, config.sqpoll), or TransportFactory::create_io_uring)
+    SqPollConfig sqpoll{};
+
+    /// Zero-copy send (kernel 6.0+) for registered-buffer sends of at least
+    /// zero_copy_threshold bytes; below it the kernel copy is cheaper than
+    /// page pinning. registered_buffer_size bounds the largest such send.
+    bool use_zero_copy_send{true};
+    size_t zero_copy_threshold{4096};
+
+    /// SO_TIMESTAMPING for RX/TX wire timestamps. When on, receive() reads
+    /// with IORING_OP_RECVMSG to get the control message, so multishot
+    /// receive (which carries no cmsg) is not used.
+    TimestampingConfig timestamping{};
+
+    /// NUMA node for registered and multishot buffers (-1 = any); use
+    /// CpuAffinity::get_numa_node() of the core the transport runs on
+    int numa_node{-1};
+
+    /// Source of registered and multishot buffer memory (nullptr =
+    /// aligned_alloc); a HugePageMemoryResource puts each pool on a few
+    /// huge pages. Must outlive the transport.
+    std::pmr::memory_resource* buffer_resource{nullptr};
+
+    /// Fixed-file slots registered on the ring (kernel 5.5+) if it has no
+    /// table yet; the socket then skips the per-SQE fd lookup. 0 = raw fd.
+    unsigned registered_files{0};
+
+    /// NAPI busy poll for the ring (kernel 6.9+), registered on connect
+    /// when enabled and not yet on the ring
+    NapiConfig napi{};
+
+    /// TLS (see ktls.hpp): handshake in userspace on connect, then kernel
+    /// records, so the ring paths above carry plaintext unchanged. A
+    /// direction the kernel did not take goes through OpenSSL instead
+    /// (no multishot receive / fixed-buffer send for it).
+    TlsConfig tls{};
+
+    /// Send queue watch (see send_backpressure.hpp): sampled after each
+    /// send; TCP_NOTSENT_LOWAT applied on connect
+    BackpressureConfig backpressure{};
 };
 
 /// High-performance transport using io_uring
@@ -863,12 +1486,21 @@ public:
         , recv_pending_{false}
         , config_{config}
         , send_buf_idx_{-1}
-        , recv_buf_idx_{-1} {}
+        , recv_buf_idx_{-1}
+        , backpressure_{config.backpressure} {}
 
     [[nodiscard]] TransportResult<void> connect(
         std::string_view host,
         uint16_t port) override
     {
+        // Both are optimizations: on older kernels keep the plain path
+        if (config_.registered_files > 0 && !ctx_.has_file_table()) {
+            (void)ctx_.register_file_table(config_.registered_files);
+        }
+        if (config_.napi.enabled && !ctx_.has_napi()) {
+            (void)ctx_.register_napi(config_.napi);
+        }
+
         auto result = socket_.create();
         if (!result) return result;
 
@@ -911,24 +1543,47 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::ConnectionFailed, -connect_result}};
         }
 
+        if (config_.tls.enabled) {
+            if (auto tls = tls_.handshake(socket_.fd(), host, config_.tls); !tls) {
+                socket_.close_sync();
+                return tls;
+            }
+        }
+        // Ring receives only read records the kernel decrypts
+        const bool kernel_rx = !tls_.is_active() || tls_.rx_offloaded();
+        backpressure_.on_connected(socket_.fd());
+
         // Initialize registered buffers for fixed I/O (~11% improvement)
         if (config_.use_registered_buffers) {
+            registered_pool_.set_memory_resource(config_.buffer_resource);
             if (!registered_pool_.init(ctx_,
                                        config_.registered_buffer_size,
-                                       config_.num_registered_buffers)) {
+                                       config_.num_registered_buffers,
+                                       config_.numa_node)) {
                 // Non-fatal: fall back to regular buffers
                 use_fixed_buffers_ = false;
             } else {
                 use_fixed_buffers_ = true;
             }
         }
+        use_zero_copy_ = NFX_IO_URING_SEND_ZC && config_.use_zero_copy_send && use_fixed_buffers_;
+
+        timestamping_ = config_.timestamping.mode != TimestampingMode::Off &&
+                        socket_.set_timestamping(config_.timestamping);
+        tx_bytes_ = 0;
+        last_tx_id_ = 0;
 
         // Initialize multishot receive buffers (~30% syscall reduction)
-        if (config_.use_multishot_recv) {
+        if (config_.use_multishot_recv && !timestamping_ && kernel_rx) {
+            multishot_buffers_.set_memory_resource(config_.buffer_resource);
             if (!multishot_buffers_.init(ctx_,
                                          config_.multishot_group_id,
                                          config_.multishot_buffer_size,
-                                         config_.num_multishot_buffers)) {
+                                         config_.num_multishot_buffers,
+                                         config_.use_buf_ring
+                                             ? ProvidedBufferGroup::Mode::Ring
+                                             : ProvidedBufferGroup::Mode::ProvideBuffers,
+                                         config_.numa_node)) {
                 // Non-fatal: fall back to regular receive
                 use_multishot_ = false;
             } else {
@@ -938,12 +1593,14 @@ public:
                     multishot_buffers_.group_id(), this);
                 if (!ms_result) {
                     use_multishot_ = false;
+                } else {
+                    ctx_.submit();
                 }
             }
         }
 
         // Start async receive (fallback if multishot not enabled)
-        if (!use_multishot_) {
+        if (!use_multishot_ && !timestamping_ && kernel_rx) {
             submit_recv();
         }
 
@@ -951,7 +1608,11 @@ public:
     }
 
     void disconnect() override {
+        tls_.shutdown();
         socket_.close_sync();
+        reassembler_.reset([this](uint16_t buf_id) {
+            (void)multishot_buffers_.replenish(buf_id);
+        });
     }
 
     [[nodiscard]] bool is_connected() const override {
@@ -959,55 +1620,99 @@ public:
     }
 
     [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) override {
+        NFX_NO_ALLOC_REGION("IoUringTransport::send");
+        auto result = send_data(data);
+        if (timestamping_ && config_.timestamping.tx && result && *result > 0) {
+            tx_bytes_ += static_cast<uint32_t>(*result);
+            last_tx_id_ = tx_bytes_ - 1;
+        }
+        if (result) backpressure_.on_send(socket_.fd());
+        return result;
+    }
+
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) override {
         if (!is_connected()) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
 
-        TransportResult<void> result;
+        // Check if data available in buffer (from multishot or previous recv)
+        if (!recv_buffer_.empty()) {
+            return recv_buffer_.read(buffer);
+        }
 
-        // Use fixed buffer if available (~11% improvement)
-        if (use_fixed_buffers_ && data.size() <= registered_pool_.buffer_size()) {
-            int buf_idx = registered_pool_.acquire();
-            if (buf_idx >= 0) {
-                // Copy data to registered buffer
-                char* buf = registered_pool_.buffer(buf_idx);
-                std::memcpy(buf, data.data(), data.size());
+        if (tls_.is_active() && (!tls_.rx_offloaded() || tls_.pending() > 0)) {
+            return tls_.read(buffer);
+        }
 
-                result = socket_.submit_write_fixed(
-                    static_cast<uint16_t>(buf_idx), data.size());
+        auto result = timestamping_ ? receive_timestamped(buffer) : receive_data(buffer);
+        if (!result && result.error().system_errno == EIO && tls_.rx_offloaded()) {
+            // kTLS RX stopped at a non-data record (session ticket, key
+            // update, alert): OpenSSL consumes it, then reads the data after it
+            return tls_.read(buffer);
+        }
+        return result;
+    }
 
-                if (!result) {
-                    registered_pool_.release(buf_idx);
-                    return std::unexpected{result.error()};
-                }
+private:
+    /// Timestamped receive: recvmsg straight into the caller's buffer
+    [[nodiscard]] TransportResult<size_t> receive_timestamped(std::span<char> buffer) noexcept {
+        auto result = socket_.submit_recvmsg(rx_msg_.prepare(buffer), tag(RECV_TAG));
+        if (!result) return std::unexpected{result.error()};
 
-                ctx_.submit();
+        ctx_.submit();
+        const int recv_result = wait_for(tag(RECV_TAG)).result;
 
-                struct io_uring_cqe* cqe;
-                ctx_.wait(&cqe);
-                int send_result = cqe->res;
-                ctx_.seen(cqe);
+        if (recv_result <= 0) {
+            if (recv_result == 0) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            return std::unexpected{TransportError{TransportErrorCode::ReadError, -recv_result}};
+        }
+        last_rx_timestamp_ = rx_msg_.timestamp();
+        return static_cast<size_t>(recv_result);
+    }
 
-                registered_pool_.release(buf_idx);
+    /// send() body; send() adds TX timestamp keying
+    [[nodiscard]] TransportResult<size_t> send_data(std::span<const char> data) noexcept {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        // TLS records built in userspace: OpenSSL writes the socket
+        if (tls_.is_active() && !tls_.tx_offloaded()) {
+            auto written = tls_.write(data);
+            registered_pool_.release(registered_pool_.index_of(data.data()));
+            return written;
+        }
+
+        TransportResult<void> result;
+
+        // Use fixed buffer if available (~11% improvement)
+        if (use_fixed_buffers_) {
+            // Built in place by acquire_send_buffer(): submit without a copy
+            int buf_idx = registered_pool_.index_of(data.data());
+            if (buf_idx >= 0) {
+                return send_fixed(data, buf_idx);
+            }
 
-                if (send_result < 0) {
-                    return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
+            if (data.size() <= registered_pool_.buffer_size()) {
+                buf_idx = registered_pool_.acquire();
+                if (buf_idx >= 0) {
+                    // Copy data to registered buffer
+                    char* buf = registered_pool_.buffer(buf_idx);
+                    std::memcpy(buf, data.data(), data.size());
+                    return send_fixed(std::span<const char>{buf, data.size()}, buf_idx);
                 }
-                return static_cast<size_t>(send_result);
             }
             // Fall through to regular send if no buffer available
         }
 
         // Regular send (fallback or data too large)
-        result = socket_.submit_write(data);
+        result = socket_.submit_write(data, tag(SEND_TAG));
         if (!result) return std::unexpected{result.error()};
 
         ctx_.submit();
-
-        struct io_uring_cqe* cqe;
-        ctx_.wait(&cqe);
-        int send_result = cqe->res;
-        ctx_.seen(cqe);
+        const int send_result = wait_for(tag(SEND_TAG)).result;
 
         if (send_result < 0) {
             return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
@@ -1016,16 +1721,8 @@ public:
         return static_cast<size_t>(send_result);
     }
 
-    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) override {
-        if (!is_connected()) {
-            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
-        }
-
-        // Check if data available in buffer (from multishot or previous recv)
-        if (!recv_buffer_.empty()) {
-            return recv_buffer_.read(buffer);
-        }
-
+    /// receive() body for untimestamped sockets
+    [[nodiscard]] TransportResult<size_t> receive_data(std::span<char> buffer) noexcept {
         // Multishot receive: data comes via poll(), just wait for completion
         if (use_multishot_) {
             // Process pending completions and check buffer again
@@ -1050,7 +1747,7 @@ public:
             int buf_idx = registered_pool_.acquire();
             if (buf_idx >= 0) {
                 auto result = socket_.submit_read_fixed(
-                    static_cast<uint16_t>(buf_idx), buffer.size());
+                    static_cast<uint16_t>(buf_idx), buffer.size(), 0, tag(RECV_TAG));
 
                 if (!result) {
                     registered_pool_.release(buf_idx);
@@ -1058,11 +1755,7 @@ public:
                 }
 
                 ctx_.submit();
-
-                struct io_uring_cqe* cqe;
-                ctx_.wait(&cqe);
-                int recv_result = cqe->res;
-                ctx_.seen(cqe);
+                const int recv_result = wait_for(tag(RECV_TAG)).result;
 
                 if (recv_result > 0) {
                     // Copy from registered buffer to user buffer
@@ -1083,15 +1776,11 @@ public:
         }
 
         // Regular receive (fallback)
-        auto result = socket_.submit_read(buffer);
+        auto result = socket_.submit_read(buffer, tag(RECV_TAG));
         if (!result) return std::unexpected{result.error()};
 
         ctx_.submit();
-
-        struct io_uring_cqe* cqe;
-        ctx_.wait(&cqe);
-        int recv_result = cqe->res;
-        ctx_.seen(cqe);
+        const int recv_result = wait_for(tag(RECV_TAG)).result;
 
         if (recv_result <= 0) {
             if (recv_result == 0) {
@@ -1103,6 +1792,7 @@ public:
         return static_cast<size_t>(recv_result);
     }
 
+public:
     bool set_nodelay(bool enable) override {
         socket_.set_nodelay(enable);
         return true;
@@ -1125,16 +1815,87 @@ public:
 
     /// Process pending completions (non-blocking)
     int poll() noexcept {
-        struct io_uring_cqe* cqe;
-        int processed = 0;
+        ctx_.get_events();
+        return static_cast<int>(ctx_.reap(
+            [this](const CqeEntry& cqe) { process_cqe(cqe); },
+            NoPrefetch{}));  // Every completion is this transport's
+    }
+
+    /// Process pending completions, delivering complete FIX messages
+    /// straight from the multishot provided buffers (zero-copy).
+    /// A message straddling two buffers is reassembled with one bounded
+    /// copy; each buffer is replenished as soon as nothing references it.
+    /// Only meaningful with multishot receive; otherwise use receive().
+    /// @param on_message Called with each message span (valid during the call)
+    /// @return Number of messages delivered
+    template <typename Handler>
+    size_t poll_messages(Handler&& on_message) noexcept {
+        if (!use_multishot_) {
+            (void)poll();
+            return 0;
+        }
+        ctx_.get_events();
+
+        size_t delivered = 0;
+        bool replenished = false;
+        auto release = [this, &replenished](uint16_t buf_id) {
+            replenished |= multishot_buffers_.replenish(buf_id) &&
+                           multishot_buffers_.replenish_needs_submit();
+        };
+
+        // Prefetch the next completion's provided buffer: its bytes are
+        // what the reassembler reads first
+        auto prefetch_buffer = [this](const CqeEntry& next) noexcept {
+            if (ProvidedBufferGroup::has_buffer(next.flags) && next.res > 0) {
+                util::prefetch_read(multishot_buffers_.buffer(
+                    ProvidedBufferGroup::buffer_id_from_cqe(next.flags)));
+            }
+        };
+
+        (void)ctx_.reap(
+            [&](const CqeEntry& cqe) {
+                if (ProvidedBufferGroup::has_buffer(cqe.flags)) {
+                    if (cqe.res > 0) {
+                        uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(cqe.flags);
+                        const char* data = multishot_buffers_.buffer(buf_id);
+                        if (data) {
+                            delivered += reassembler_.feed(
+                                buf_id,
+                                std::span<const char>{data, static_cast<size_t>(cqe.res)},
+                                on_message, release);
+                        }
+                    }
+                    rearm_multishot(cqe.flags);
+                } else {
+                    process_cqe(cqe);
+                }
+            },
+            prefetch_buffer);
 
-        while (ctx_.peek(&cqe) == 0) {
-            process_cqe(cqe);
-            ctx_.seen(cqe);
-            ++processed;
+        if (replenished) {
+            ctx_.submit();
         }
+        return delivered;
+    }
+
+    /// Zero-copy reassembly counters for poll_messages()
+    [[nodiscard]] const ReassemblyStats& reassembly_stats() const noexcept {
+        return reassembler_.stats();
+    }
 
-        return processed;
+    /// Acquire a registered buffer to serialize an outbound message into
+    /// Passing a span inside it to send() submits it with write_fixed and
+    /// no copy; send() releases the buffer. Empty if none is available.
+    [[nodiscard]] std::span<char> acquire_send_buffer() noexcept {
+        if (!use_fixed_buffers_) return {};
+        int buf_idx = registered_pool_.acquire();
+        if (buf_idx < 0) return {};
+        return {registered_pool_.buffer(buf_idx), registered_pool_.buffer_size()};
+    }
+
+    /// Return a buffer from acquire_send_buffer() that will not be sent
+    void release_send_buffer(std::span<char> buffer) noexcept {
+        registered_pool_.release(registered_pool_.index_of(buffer.data()));
     }
 
     /// Check if using registered buffers
@@ -1147,21 +1908,171 @@ public:
         return use_multishot_;
     }
 
+    /// Check if the socket's SQEs go through a registered file slot
+    [[nodiscard]] bool uses_registered_file() const noexcept {
+        return socket_.is_fixed_file();
+    }
+
+    /// Check if multishot buffers are ring-mapped (no SQE to return one)
+    [[nodiscard]] bool uses_buf_ring() const noexcept {
+        return use_multishot_ && multishot_buffers_.uses_ring();
+    }
+
+    /// Check if large registered-buffer sends go out zero-copy
+    [[nodiscard]] bool uses_zero_copy_send() const noexcept {
+        return use_zero_copy_;
+    }
+
+    /// Registered buffers sent zero-copy and not yet released by the kernel
+    [[nodiscard]] size_t zero_copy_in_flight() const noexcept {
+        return zc_in_flight_;
+    }
+
+    /// Check if SO_TIMESTAMPING is active on the connection
+    [[nodiscard]] bool uses_timestamping() const noexcept {
+        return timestamping_;
+    }
+
+    /// Kernel/NIC timestamp of the data returned by the last receive()
+    [[nodiscard]] WireTimestamp last_receive_timestamp() const noexcept {
+        return last_rx_timestamp_;
+    }
+
+    /// TX timestamp key of the last send(); matches TxTimestamp::id
+    [[nodiscard]] uint32_t last_tx_id() const noexcept { return last_tx_id_; }
+
+    /// Deliver TX timestamps queued on the socket's error queue
+    /// (a non-blocking recvmsg syscall, outside the ring)
+    /// @return Timestamps delivered
+    template <typename Handler>
+    size_t poll_tx_timestamps(Handler&& on_timestamp) noexcept {
+        if (!timestamping_) return 0;
+        return drain_tx_timestamps(socket_.fd(), std::forward<Handler>(on_timestamp));
+    }
+
+    /// Check if the connection is TLS
+    [[nodiscard]] bool uses_tls() const noexcept {
+        return tls_.is_active();
+    }
+
+    /// TLS directions encrypted by the kernel (None if not TLS)
+    [[nodiscard]] TlsOffload tls_offload() const noexcept {
+        return tls_.offload();
+    }
+
+    /// Send queue state at the last sample (Clear unless config.backpressure.enabled)
+    [[nodiscard]] BackpressureState backpressure() const noexcept {
+        return backpressure_.state();
+    }
+
+    /// Sample the send queue now (e.g. each loop iteration while Draining)
+    BackpressureState poll_backpressure() noexcept {
+        return is_connected() ? backpressure_.sample(socket_.fd()) : backpressure_.state();
+    }
+
+    [[nodiscard]] const SendBackpressure& backpressure_monitor() const noexcept {
+        return backpressure_;
+    }
+
     /// Get current configuration
     [[nodiscard]] const IoUringTransportConfig& config() const noexcept {
         return config_;
     }
 
 private:
+    // user_data of synchronous operations; multishot receive uses `this`
+    static constexpr uintptr_t SEND_TAG = 1;
+    static constexpr uintptr_t RECV_TAG = 2;
+    static constexpr uintptr_t ZERO_COPY_TAG = 3;  // | buffer index << 8
+
+    struct Completion {
+        int result;
+        uint32_t flags;
+    };
+
+    [[nodiscard]] static void* tag(uintptr_t value) noexcept {
+        return reinterpret_cast<void*>(value);
+    }
+
+    /// Wait for the completion tagged `expected`, processing any other CQE
+    /// (multishot data, zero-copy notifications) that arrives first
+    [[nodiscard]] Completion wait_for(void* expected) noexcept {
+        for (;;) {
+            struct io_uring_cqe* cqe;
+            if (int ret = ctx_.wait(&cqe); ret < 0) return {ret, 0};
+
+            const Completion completion{cqe->res, cqe->flags};
+            const bool match = io_uring_cqe_get_data(cqe) == expected &&
+                               !is_zero_copy_notification(cqe->flags);
+            if (!match) process_cqe(cqe);
+            ctx_.seen(cqe);
+            if (match) return completion;
+        }
+    }
+
+    /// Write data held in registered buffer buf_idx, then release the buffer
+    /// (on the kernel's notification when it was sent zero-copy)
+    [[nodiscard]] TransportResult<size_t> send_fixed(
+        std::span<const char> data, int buf_idx) noexcept
+    {
+        if (use_zero_copy_ && data.size() >= config_.zero_copy_threshold) {
+            void* zc_tag = tag(ZERO_COPY_TAG | (static_cast<uintptr_t>(buf_idx) << 8));
+            if (socket_.submit_send_zc_fixed(data, static_cast<uint16_t>(buf_idx), zc_tag)) {
+                ctx_.submit();
+                const Completion completion = wait_for(zc_tag);
+                if (ProvidedBufferGroup::has_more(completion.flags)) {
+                    ++zc_in_flight_;  // Released by process_cqe()
+                } else if (completion.result == -EINVAL || completion.result == -EOPNOTSUPP) {
+                    use_zero_copy_ = false;  // Kernel without SEND_ZC: copy from now on
+                    return send_fixed(data, buf_idx);
+                } else {
+                    registered_pool_.release(buf_idx);
+                }
+                if (completion.result < 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::WriteError, -completion.result}};
+                }
+                return static_cast<size_t>(completion.result);
+            }
+        }
+
+        auto result = socket_.submit_write_fixed(data, static_cast<uint16_t>(buf_idx), tag(SEND_TAG));
+        if (!result) {
+            registered_pool_.release(buf_idx);
+            return std::unexpected{result.error()};
+        }
+
+        ctx_.submit();
+        const int send_result = wait_for(tag(SEND_TAG)).result;
+
+        registered_pool_.release(buf_idx);
+
+        if (send_result < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
+        }
+        return static_cast<size_t>(send_result);
+    }
+
     /// Process a single completion queue entry
     void process_cqe(struct io_uring_cqe* cqe) noexcept {
-        int result = cqe->res;
+        process_cqe(CqeEntry::from(cqe));
+    }
+
+    void process_cqe(const CqeEntry& cqe) noexcept {
+        int result = cqe.res;
+
+        // Zero-copy send finished with its buffer
+        if (is_zero_copy_notification(cqe.flags)) {
+            const auto value = reinterpret_cast<uintptr_t>(cqe.data());
+            registered_pool_.release(static_cast<int>(value >> 8));
+            --zc_in_flight_;
+            return;
+        }
 
         // Handle multishot receive completion
-        if (use_multishot_ && ProvidedBufferGroup::has_buffer(cqe->flags)) {
+        if (use_multishot_ && ProvidedBufferGroup::has_buffer(cqe.flags)) {
             if (result > 0) {
                 // Extract buffer ID and copy data to recv_buffer_
-                uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(cqe->flags);
+                uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(cqe.flags);
                 char* data = multishot_buffers_.buffer(buf_id);
                 if (data) {
                     auto write_span = recv_buffer_.write_span();
@@ -1175,13 +2086,29 @@ private:
                 (void)multishot_buffers_.replenish(buf_id);
             }
 
-            // Check if multishot is still active
-            if (!ProvidedBufferGroup::has_more(cqe->flags)) {
-                // Multishot terminated - restart if still connected
-                if (socket_.is_connected()) {
-                    (void)socket_.submit_recv_multishot(multishot_buffers_.group_id(), this);
-                    ctx_.submit();
-                }
+            rearm_multishot(cqe.flags);
+            return;
+        }
+
+        // Multishot ended because every buffer was out: restart it now
+        // that poll() / poll_messages() have returned some
+        if (use_multishot_ && result == -ENOBUFS && cqe.data() == this) {
+            rearm_multishot(cqe.flags);
+            return;
+        }
+
+        // kTLS RX stopped at a non-data record: OpenSSL consumes it, then
+        // the receive is restarted
+        if (result == -EIO && tls_.rx_offloaded() &&
+            ((use_multishot_ && cqe.data() == this) || recv_pending_)) {
+            consume_tls_record();
+            if (use_multishot_) {
+                rearm_multishot(cqe.flags);
+            } else {
+                recv_pending_ = false;
+                registered_pool_.release(recv_buf_idx_);
+                recv_buf_idx_ = -1;
+                submit_recv();
             }
             return;
         }
@@ -1194,6 +2121,26 @@ private:
         }
     }
 
+    /// Let OpenSSL read the record at the head of a kTLS RX socket; any
+    /// application data behind it goes to recv_buffer_
+    void consume_tls_record() noexcept {
+        auto span = recv_buffer_.write_span();
+        if (auto n = tls_.read(span, 0); n && *n > 0) {
+            recv_buffer_.commit_write(*n);
+        }
+    }
+
+    /// Restart multishot receive once the kernel stops it
+    void rearm_multishot(uint32_t cqe_flags) noexcept {
+        if (!ProvidedBufferGroup::has_more(cqe_flags)) {
+            // Multishot terminated - restart if still connected
+            if (socket_.is_connected()) {
+                (void)socket_.submit_recv_multishot(multishot_buffers_.group_id(), this);
+                ctx_.submit();
+            }
+        }
+    }
+
     void submit_recv() noexcept {
         if (recv_pending_ || use_multishot_) return;
 
@@ -1235,6 +2182,25 @@ private:
     // Multishot receive buffers
     ProvidedBufferGroup multishot_buffers_;
     bool use_multishot_{false};
+
+    // Zero-copy sends awaiting their notification CQE
+    bool use_zero_copy_{false};
+    size_t zc_in_flight_{0};
+
+    // Frames messages in place across multishot buffers
+    MessageReassembler<> reassembler_;
+
+    // SO_TIMESTAMPING state
+    bool timestamping_{false};
+    TimestampedRecv rx_msg_;
+    WireTimestamp last_rx_timestamp_{};
+    uint32_t tx_bytes_{0};          // Bytes sent since timestamping was enabled
+    uint32_t last_tx_id_{0};
+
+    // TLS session (kernel records where offloaded)
+    KtlsSession tls_;
+
+    SendBackpressure backpressure_;
 };
 
 #else  // !NFX_IO_URING_AVAILABLE
@@ -1242,7 +2208,7 @@ private:
 // Stub implementation when io_uring is not available
 class IoUringContext {
 public:
-    [[nodiscard]] TransportResult<void> init(unsigned = 256) noexcept {
+    [[nodiscard]] TransportResult<void> init(unsigned = 256, const SqPollConfig& = {}) noexcept {
         return std::unexpected{TransportError{TransportErrorCode::SocketError}};
     }
     [[nodiscard]] bool is_initialized() const noexcept { return false; }
@@ -1266,7 +2232,11 @@ public:
     bool set_nodelay(bool) override { return true; }
     bool set_keepalive(bool) override { return true; }
     bool set_receive_timeout(int) override { return true; }
+    [[nodiscard]] std::span<char> acquire_send_buffer() noexcept { return {}; }
+    void release_send_buffer(std::span<char>) noexcept {}
     bool set_send_timeout(int) override { return true; }
+    [[nodiscard]] BackpressureState backpressure() const noexcept { return BackpressureState::Clear; }
+    BackpressureState poll_backpressure() noexcept { return BackpressureState::Clear; }
 };
 
 #endif  // NFX_IO_URING_AVAILABLE
@@ -0,0 +1,708 @@
+/*
+    NexusFIX IOCP / Registered I/O Transport (Windows)
+
+    Completion-based TCP transport behind ITransport. Every session on a
+    thread shares one IocpContext:
+
+        IocpContext       I/O completion port; with RIO also the RIO
+                          completion queue (notified through the port)
+                          and RioBufferPool, one registered region
+                          sliced per send/receive like RegisteredBufferPool
+        IocpTransport     one outstanding overlapped (or RIO) send and
+                          receive, each on a buffer the transport owns, so
+                          a timed-out call never leaves the kernel writing
+                          into caller memory
+
+    Overlapped sockets use FILE_SKIP_COMPLETION_PORT_ON_SUCCESS: a send or
+    receive that completes inline costs no completion-port round trip.
+    RIO results are dequeued without a syscall; poll() spins on the RIO
+    queue (IocpConfig::rio_spin) before blocking on the port.
+
+    The blocking ITransport calls wait on the shared port, recording
+    completions of other sessions as they arrive. Single-threaded: a
+    context and its transports belong to one thread. RIO needs Windows 8 /
+    Server 2012; without it (or with use_rio off) plain overlapped I/O.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_PLATFORM_WINDOWS
+
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/winsock_init.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// Configuration for IocpContext and its transports
+struct IocpConfig {
+    /// Registered I/O (falls back to overlapped I/O if unavailable)
+    bool use_rio{true};
+
+    /// Registered region: two slices (send + receive) per transport
+    size_t rio_num_buffers{128};
+    size_t rio_buffer_size{65536};
+
+    /// RIO completion queue entries (>= 2 per transport)
+    unsigned rio_queue_depth{1024};
+
+    /// poll(): RIO queue checks before blocking on the port
+    unsigned rio_spin{1000};
+
+    /// Per-transport buffers for overlapped (non-RIO) I/O
+    size_t buffer_size{65536};
+};
+
+/// Counters for one context
+struct IocpStats {
+    uint64_t port_waits{0};         // GetQueuedCompletionStatusEx calls
+    uint64_t completions{0};        // Overlapped completions dequeued
+    uint64_t rio_completions{0};    // RIO results dequeued
+    uint64_t inline_completions{0}; // Completed without a port round trip
+};
+
+// ============================================================================
+// Completion Record
+// ============================================================================
+
+/// One outstanding operation; OVERLAPPED first so the port's pointer
+/// converts back, and the RIO request context points here too
+struct IocpOp {
+    OVERLAPPED overlapped{};
+    SOCKET socket{INVALID_SOCKET};
+    bool pending{false};
+    DWORD bytes{0};
+    int error{0};
+
+    void begin(SOCKET s) noexcept {
+        overlapped = {};
+        socket = s;
+        pending = true;
+        bytes = 0;
+        error = 0;
+    }
+
+    void complete(DWORD transferred, int err) noexcept {
+        bytes = transferred;
+        error = err;
+        pending = false;
+    }
+};
+
+// ============================================================================
+// RIO Buffer Pool
+// ============================================================================
+
+/// One RIORegisterBuffer region sliced into fixed-size buffers
+class RioBufferPool {
+public:
+    RioBufferPool() noexcept = default;
+    ~RioBufferPool() { cleanup(); }
+
+    RioBufferPool(const RioBufferPool&) = delete;
+    RioBufferPool& operator=(const RioBufferPool&) = delete;
+
+    [[nodiscard]] bool init(const RIO_EXTENSION_FUNCTION_TABLE& rio,
+                            size_t buffer_size, size_t num_buffers) noexcept {
+        if (initialized_ || buffer_size == 0 || num_buffers == 0) return false;
+
+        const size_t total = buffer_size * num_buffers;
+        if (total > MAXDWORD) return false;
+        memory_ = static_cast<char*>(::VirtualAlloc(nullptr, total, MEM_COMMIT | MEM_RESERVE,
+                                                   PAGE_READWRITE));
+        if (!memory_) return false;
+
+        id_ = rio.RIORegisterBuffer(memory_, static_cast<DWORD>(total));
+        if (id_ == RIO_INVALID_BUFFERID) {
+            cleanup();
+            return false;
+        }
+
+        rio_ = &rio;
+        buffer_size_ = buffer_size;
+        num_buffers_ = num_buffers;
+        free_indices_.reserve(num_buffers);
+        for (size_t i = num_buffers; i-- > 0;) free_indices_.push_back(static_cast<uint32_t>(i));
+        initialized_ = true;
+        return true;
+    }
+
+    /// @return Buffer index, or -1 if none available
+    [[nodiscard]] int acquire() noexcept {
+        if (free_indices_.empty()) return -1;
+        int idx = static_cast<int>(free_indices_.back());
+        free_indices_.pop_back();
+        return idx;
+    }
+
+    void release(int index) noexcept {
+        if (index >= 0 && static_cast<size_t>(index) < num_buffers_) {
+            free_indices_.push_back(static_cast<uint32_t>(index));
+        }
+    }
+
+    [[nodiscard]] char* buffer(int index) noexcept {
+        if (index < 0 || static_cast<size_t>(index) >= num_buffers_) return nullptr;
+        return memory_ + static_cast<size_t>(index) * buffer_size_;
+    }
+
+    /// RIO descriptor for the first len bytes of buffer index
+    [[nodiscard]] RIO_BUF slice(int index, size_t len) const noexcept {
+        RIO_BUF buf;
+        buf.BufferId = id_;
+        buf.Offset = static_cast<ULONG>(static_cast<size_t>(index) * buffer_size_);
+        buf.Length = static_cast<ULONG>(std::min(len, buffer_size_));
+        return buf;
+    }
+
+    [[nodiscard]] size_t buffer_size() const noexcept { return buffer_size_; }
+    [[nodiscard]] size_t num_buffers() const noexcept { return num_buffers_; }
+    [[nodiscard]] size_t available() const noexcept { return free_indices_.size(); }
+    [[nodiscard]] bool is_initialized() const noexcept { return initialized_; }
+
+private:
+    void cleanup() noexcept {
+        if (rio_ && id_ != RIO_INVALID_BUFFERID) rio_->RIODeregisterBuffer(id_);
+        id_ = RIO_INVALID_BUFFERID;
+        if (memory_) {
+            ::VirtualFree(memory_, 0, MEM_RELEASE);
+            memory_ = nullptr;
+        }
+        free_indices_.clear();
+        initialized_ = false;
+    }
+
+    const RIO_EXTENSION_FUNCTION_TABLE* rio_{nullptr};
+    char* memory_{nullptr};
+    RIO_BUFFERID id_{RIO_INVALID_BUFFERID};
+    std::vector<uint32_t> free_indices_;
+    size_t buffer_size_{0};
+    size_t num_buffers_{0};
+    bool initialized_{false};
+};
+
+// ============================================================================
+// IOCP Context
+// ============================================================================
+
+/// Completion port (+ RIO completion queue) shared by a thread's transports
+class IocpContext {
+public:
+    static constexpr ULONG MAX_EVENTS = 64;
+    static constexpr ULONG MAX_RIO_RESULTS = 128;
+
+    IocpContext() noexcept = default;
+
+    ~IocpContext() {
+        if (rio_cq_ != RIO_INVALID_CQ) rio_.RIOCloseCompletionQueue(rio_cq_);
+        if (port_) ::CloseHandle(port_);
+    }
+
+    IocpContext(const IocpContext&) = delete;
+    IocpContext& operator=(const IocpContext&) = delete;
+
+    [[nodiscard]] TransportResult<void> init(const IocpConfig& config = {}) noexcept {
+        if (port_) return {};
+        if (!WinsockInit::ensure()) {
+            return std::unexpected{WinsockInit::make_init_error()};
+        }
+        config_ = config;
+
+        port_ = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (!port_) {
+            return std::unexpected{TransportError{TransportErrorCode::IocpError,
+                                                  static_cast<int>(::GetLastError())}};
+        }
+        if (config_.use_rio) init_rio();  // Non-fatal: overlapped I/O otherwise
+        return {};
+    }
+
+    [[nodiscard]] bool is_initialized() const noexcept { return port_ != nullptr; }
+
+    /// True if transports on this context use Registered I/O
+    [[nodiscard]] bool uses_rio() const noexcept { return rio_cq_ != RIO_INVALID_CQ; }
+
+    /// Attach an overlapped socket to the port
+    [[nodiscard]] bool associate(SOCKET socket) noexcept {
+        return ::CreateIoCompletionPort(reinterpret_cast<HANDLE>(socket), port_, 0, 0) == port_;
+    }
+
+    /// Dispatch ready completions into their IocpOp records
+    /// @param timeout_ms -1 blocks until a completion arrives
+    /// @return Number of operations completed
+    [[nodiscard]] TransportResult<int> poll(int timeout_ms) noexcept {
+        if (uses_rio()) {
+            for (unsigned i = 0; i <= config_.rio_spin; ++i) {
+                if (int n = drain_rio(); n > 0) return n;
+                if (timeout_ms == 0) break;
+            }
+            if (!rio_armed_) {
+                if (rio_.RIONotify(rio_cq_) != 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::IocpError,
+                                                          ::WSAGetLastError()}};
+                }
+                rio_armed_ = true;
+            }
+        }
+
+        std::array<OVERLAPPED_ENTRY, MAX_EVENTS> entries;
+        ULONG removed = 0;
+        ++stats_.port_waits;
+        if (!::GetQueuedCompletionStatusEx(port_, entries.data(), MAX_EVENTS, &removed,
+                                           timeout_ms < 0 ? INFINITE : static_cast<DWORD>(timeout_ms),
+                                           FALSE)) {
+            const DWORD err = ::GetLastError();
+            if (err == WAIT_TIMEOUT) return 0;
+            return std::unexpected{TransportError{TransportErrorCode::IocpError,
+                                                  static_cast<int>(err)}};
+        }
+
+        int completed = 0;
+        for (ULONG i = 0; i < removed; ++i) {
+            OVERLAPPED* overlapped = entries[i].lpOverlapped;
+            if (overlapped == &rio_notify_) {
+                rio_armed_ = false;
+                completed += drain_rio();
+                continue;
+            }
+            auto* op = reinterpret_cast<IocpOp*>(overlapped);
+            DWORD bytes = 0;
+            DWORD flags = 0;
+            const BOOL ok = ::WSAGetOverlappedResult(op->socket, &op->overlapped, &bytes,
+                                                     FALSE, &flags);
+            op->complete(bytes, ok ? 0 : ::WSAGetLastError());
+            ++stats_.completions;
+            ++completed;
+        }
+        return completed;
+    }
+
+    /// Count an operation that completed inline (skip-on-success)
+    void note_inline_completion() noexcept { ++stats_.inline_completions; }
+
+    [[nodiscard]] const RIO_EXTENSION_FUNCTION_TABLE& rio() const noexcept { return rio_; }
+    [[nodiscard]] RIO_CQ rio_cq() const noexcept { return rio_cq_; }
+    [[nodiscard]] RioBufferPool& rio_buffers() noexcept { return rio_buffers_; }
+    [[nodiscard]] const IocpConfig& config() const noexcept { return config_; }
+    [[nodiscard]] const IocpStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] HANDLE port() const noexcept { return port_; }
+
+private:
+    void init_rio() noexcept {
+        SOCKET probe = ::WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0,
+                                    WSA_FLAG_OVERLAPPED | WSA_FLAG_REGISTERED_IO);
+        if (probe == INVALID_SOCKET) return;
+
+        GUID id = WSAID_MULTIPLE_RIO;
+        DWORD bytes = 0;
+        rio_ = {};
+        rio_.cbSize = sizeof(rio_);
+        const int ret = ::WSAIoctl(probe, SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+                                   &id, sizeof(id), &rio_, sizeof(rio_), &bytes, nullptr, nullptr);
+        ::closesocket(probe);
+        if (ret != 0) return;
+
+        if (!rio_buffers_.init(rio_, config_.rio_buffer_size, config_.rio_num_buffers)) return;
+
+        RIO_NOTIFICATION_COMPLETION notify{};
+        notify.Type = RIO_IOCP_COMPLETION;
+        notify.Iocp.IocpHandle = port_;
+        notify.Iocp.CompletionKey = nullptr;
+        notify.Iocp.Overlapped = &rio_notify_;
+        rio_cq_ = rio_.RIOCreateCompletionQueue(config_.rio_queue_depth, &notify);
+    }
+
+    [[nodiscard]] int drain_rio() noexcept {
+        std::array<RIORESULT, MAX_RIO_RESULTS> results;
+        const ULONG n = rio_.RIODequeueCompletion(rio_cq_, results.data(), MAX_RIO_RESULTS);
+        if (n == 0 || n == RIO_CORRUPT_CQ) return 0;
+        for (ULONG i = 0; i < n; ++i) {
+            auto* op = reinterpret_cast<IocpOp*>(results[i].RequestContext);
+            op->complete(results[i].BytesTransferred, static_cast<int>(results[i].Status));
+        }
+        stats_.rio_completions += n;
+        return static_cast<int>(n);
+    }
+
+    IocpConfig config_{};
+    HANDLE port_{nullptr};
+    RIO_EXTENSION_FUNCTION_TABLE rio_{};
+    RIO_CQ rio_cq_{RIO_INVALID_CQ};
+    OVERLAPPED rio_notify_{};
+    bool rio_armed_{false};
+    RioBufferPool rio_buffers_;
+    IocpStats stats_;
+};
+
+// ============================================================================
+// IOCP Transport
+// ============================================================================
+
+/// Completion-based TCP transport on a shared IocpContext
+class IocpTransport final : public ITransport {
+public:
+    explicit IocpTransport(IocpContext& ctx) noexcept : ctx_{ctx} {}
+
+    ~IocpTransport() override { disconnect(); }
+
+    IocpTransport(const IocpTransport&) = delete;
+    IocpTransport& operator=(const IocpTransport&) = delete;
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        disconnect();
+        state_ = ConnectionState::Connecting;
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+
+        char port_str[8];
+        std::snprintf(port_str, sizeof(port_str), "%u", port);
+
+        char host_buf[256];
+        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+        std::memcpy(host_buf, host.data(), host_len);
+        host_buf[host_len] = '\0';
+
+        struct addrinfo* addr = nullptr;
+        if (int ret = ::getaddrinfo(host_buf, port_str, &hints, &addr); ret != 0) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_gai_error(ret)};
+        }
+
+        const DWORD flags = WSA_FLAG_OVERLAPPED | (ctx_.uses_rio() ? WSA_FLAG_REGISTERED_IO : 0);
+        socket_ = ::WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, flags);
+        if (socket_ == INVALID_SOCKET) {
+            auto err = make_socket_error();
+            ::freeaddrinfo(addr);
+            fail();
+            return std::unexpected{err};
+        }
+
+        // Connecting is once per session: a blocking connect keeps it simple
+        int ret = ::connect(socket_, addr->ai_addr, static_cast<int>(addr->ai_addrlen));
+        ::freeaddrinfo(addr);
+        if (ret == SOCKET_ERROR) {
+            auto err = make_socket_error();
+            fail();
+            return std::unexpected{err};
+        }
+
+        return start();
+    }
+
+    /// Take over an accepted socket (created overlapped, e.g. by WSAAccept)
+    /// Only RIO-capable sockets (WSA_FLAG_REGISTERED_IO) use RIO.
+    [[nodiscard]] TransportResult<void> adopt(SOCKET socket) noexcept {
+        disconnect();
+        socket_ = socket;
+        return start();
+    }
+
+    void disconnect() noexcept override {
+        if (socket_ != INVALID_SOCKET) {
+            state_ = ConnectionState::Disconnecting;
+            if (!rio_) ::CancelIoEx(reinterpret_cast<HANDLE>(socket_), nullptr);
+            close_socket(socket_);  // Also aborts outstanding RIO requests
+            socket_ = INVALID_SOCKET;
+
+            // Records must outlive their operations: drain the aborts
+            for (int i = 0; i < 100 && (send_op_.pending || recv_op_.pending); ++i) {
+                (void)ctx_.poll(10);
+            }
+        }
+        if (rio_) {
+            ctx_.rio_buffers().release(send_idx_);
+            ctx_.rio_buffers().release(recv_idx_);
+            send_idx_ = recv_idx_ = -1;
+            rio_rq_ = RIO_INVALID_RQ;
+            rio_ = false;
+        }
+        rx_offset_ = rx_size_ = 0;
+        state_ = ConnectionState::Disconnected;
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return state_ == ConnectionState::Connected && socket_ != INVALID_SOCKET;
+    }
+
+    /// Send all of data, one buffer-sized overlapped/RIO send at a time
+    /// @return Bytes sent (short only on timeout)
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        NFX_NO_ALLOC_REGION("IocpTransport::send");
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        size_t total = 0;
+        while (total < data.size()) {
+            if (send_op_.pending) {
+                auto waited = wait_for(send_op_, options_.send_timeout_ms);
+                if (!waited) {
+                    if (waited.error().code == TransportErrorCode::Timeout) break;
+                    return std::unexpected{waited.error()};
+                }
+            }
+            if (send_op_.error != 0) {
+                state_ = ConnectionState::Error;
+                return std::unexpected{make_socket_error(send_op_.error)};
+            }
+
+            const size_t chunk = std::min(data.size() - total, buffer_capacity());
+            std::memcpy(send_buffer(), data.data() + total, chunk);
+            if (auto posted = post_send(chunk); !posted) return std::unexpected{posted.error()};
+            total += chunk;
+        }
+
+        // Surface this call's errors now rather than on the next send
+        if (send_op_.pending) {
+            if (auto waited = wait_for(send_op_, options_.send_timeout_ms);
+                !waited && waited.error().code != TransportErrorCode::Timeout) {
+                return std::unexpected{waited.error()};
+            }
+        }
+        if (!send_op_.pending && send_op_.error != 0) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_socket_error(send_op_.error)};
+        }
+        return total;
+    }
+
+    /// Receive available data, waiting up to the receive timeout
+    /// @return Bytes received, 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        if (rx_offset_ < rx_size_) return copy_out(buffer);
+
+        if (!recv_op_.pending) {
+            if (auto posted = post_recv(); !posted) return std::unexpected{posted.error()};
+        }
+        if (recv_op_.pending) {
+            auto waited = wait_for(recv_op_, options_.recv_timeout_ms);
+            if (!waited) {
+                if (waited.error().code == TransportErrorCode::Timeout) return 0;
+                return std::unexpected{waited.error()};
+            }
+        }
+
+        if (recv_op_.error != 0) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_socket_error(recv_op_.error)};
+        }
+        if (recv_op_.bytes == 0) {
+            state_ = ConnectionState::Disconnected;
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        rx_offset_ = 0;
+        rx_size_ = recv_op_.bytes;
+        return copy_out(buffer);
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        options_.tcp_nodelay = enable;
+        return socket_ == INVALID_SOCKET || set_tcp_nodelay(socket_, enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        options_.keep_alive = enable;
+        return socket_ == INVALID_SOCKET || set_socket_keepalive(socket_, enable);
+    }
+
+    /// Bounds the completion wait of receive(); -1 waits forever
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        options_.recv_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// Bounds the completion wait of send(); -1 waits forever
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        options_.send_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// True if this connection sends and receives through RIO
+    [[nodiscard]] bool uses_rio() const noexcept { return rio_; }
+
+    [[nodiscard]] ConnectionState state() const noexcept { return state_; }
+    [[nodiscard]] SOCKET socket() const noexcept { return socket_; }
+    [[nodiscard]] IocpContext& context() noexcept { return ctx_; }
+
+private:
+    [[nodiscard]] TransportResult<void> start() noexcept {
+        (void)set_tcp_nodelay(socket_, options_.tcp_nodelay);
+        (void)set_socket_keepalive(socket_, options_.keep_alive);
+
+        if (ctx_.uses_rio() && start_rio()) {
+            state_ = ConnectionState::Connected;
+            return {};
+        }
+
+        if (!ctx_.associate(socket_)) {
+            auto err = TransportError{TransportErrorCode::IocpError,
+                                      static_cast<int>(::GetLastError())};
+            fail();
+            return std::unexpected{err};
+        }
+        // Inline completions skip the port (off if a non-IFS LSP refuses it)
+        skip_on_success_ = ::SetFileCompletionNotificationModes(
+            reinterpret_cast<HANDLE>(socket_), FILE_SKIP_COMPLETION_PORT_ON_SUCCESS) != 0;
+        send_buf_.resize(ctx_.config().buffer_size);
+        recv_buf_.resize(ctx_.config().buffer_size);
+        state_ = ConnectionState::Connected;
+        return {};
+    }
+
+    /// Request queue on the shared CQ plus a send and a receive slice
+    [[nodiscard]] bool start_rio() noexcept {
+        auto& pool = ctx_.rio_buffers();
+        if (pool.available() < 2) return false;
+
+        rio_rq_ = ctx_.rio().RIOCreateRequestQueue(socket_, 1, 1, 1, 1,
+                                                   ctx_.rio_cq(), ctx_.rio_cq(), this);
+        if (rio_rq_ == RIO_INVALID_RQ) return false;  // e.g. socket not RIO-capable
+
+        send_idx_ = pool.acquire();
+        recv_idx_ = pool.acquire();
+        rio_ = true;
+        return true;
+    }
+
+    [[nodiscard]] size_t buffer_capacity() const noexcept {
+        return rio_ ? ctx_.rio_buffers().buffer_size() : send_buf_.size();
+    }
+
+    [[nodiscard]] char* send_buffer() noexcept {
+        return rio_ ? ctx_.rio_buffers().buffer(send_idx_) : send_buf_.data();
+    }
+
+    [[nodiscard]] char* recv_buffer() noexcept {
+        return rio_ ? ctx_.rio_buffers().buffer(recv_idx_) : recv_buf_.data();
+    }
+
+    [[nodiscard]] TransportResult<void> post_send(size_t len) noexcept {
+        send_op_.begin(socket_);
+        if (rio_) {
+            RIO_BUF buf = ctx_.rio_buffers().slice(send_idx_, len);
+            if (!ctx_.rio().RIOSend(rio_rq_, &buf, 1, 0, &send_op_)) return abort_op(send_op_);
+            return {};
+        }
+
+        WSABUF buf{static_cast<ULONG>(len), send_buf_.data()};
+        DWORD sent = 0;
+        if (::WSASend(socket_, &buf, 1, &sent, 0, &send_op_.overlapped, nullptr) == 0) {
+            if (skip_on_success_) complete_inline(send_op_, sent);
+            return {};
+        }
+        if (::WSAGetLastError() != WSA_IO_PENDING) return abort_op(send_op_);
+        return {};
+    }
+
+    [[nodiscard]] TransportResult<void> post_recv() noexcept {
+        recv_op_.begin(socket_);
+        if (rio_) {
+            RIO_BUF buf = ctx_.rio_buffers().slice(recv_idx_, ctx_.rio_buffers().buffer_size());
+            if (!ctx_.rio().RIOReceive(rio_rq_, &buf, 1, 0, &recv_op_)) return abort_op(recv_op_);
+            return {};
+        }
+
+        WSABUF buf{static_cast<ULONG>(recv_buf_.size()), recv_buf_.data()};
+        DWORD received = 0;
+        DWORD flags = 0;
+        if (::WSARecv(socket_, &buf, 1, &received, &flags, &recv_op_.overlapped, nullptr) == 0) {
+            if (skip_on_success_) complete_inline(recv_op_, received);
+            return {};
+        }
+        if (::WSAGetLastError() != WSA_IO_PENDING) return abort_op(recv_op_);
+        return {};
+    }
+
+    void complete_inline(IocpOp& op, DWORD bytes) noexcept {
+        op.complete(bytes, 0);
+        ctx_.note_inline_completion();
+    }
+
+    [[nodiscard]] TransportResult<void> abort_op(IocpOp& op) noexcept {
+        const int err = ::WSAGetLastError();
+        op.complete(0, err);
+        state_ = ConnectionState::Error;
+        return std::unexpected{make_socket_error(err)};
+    }
+
+    [[nodiscard]] size_t copy_out(std::span<char> buffer) noexcept {
+        const size_t n = std::min(buffer.size(), static_cast<size_t>(rx_size_ - rx_offset_));
+        std::memcpy(buffer.data(), recv_buffer() + rx_offset_, n);
+        rx_offset_ += static_cast<DWORD>(n);
+        return n;
+    }
+
+    /// Poll the shared context until op completes
+    [[nodiscard]] TransportResult<void> wait_for(const IocpOp& op, int timeout_ms) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(std::max(timeout_ms, 0));
+        while (op.pending) {
+            int remaining = -1;
+            if (timeout_ms >= 0) {
+                const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - Clock::now()).count();
+                if (left < 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::Timeout}};
+                }
+                remaining = static_cast<int>(left);
+            }
+            if (auto polled = ctx_.poll(remaining); !polled) {
+                return std::unexpected{polled.error()};
+            }
+        }
+        return {};
+    }
+
+    void fail() noexcept {
+        disconnect();
+        state_ = ConnectionState::Error;
+    }
+
+    IocpContext& ctx_;
+    SOCKET socket_{INVALID_SOCKET};
+    ConnectionState state_{ConnectionState::Disconnected};
+    SocketOptions options_{};
+
+    IocpOp send_op_;
+    IocpOp recv_op_;
+    DWORD rx_offset_{0};
+    DWORD rx_size_{0};
+
+    // Overlapped I/O
+    bool skip_on_success_{false};
+    std::vector<char> send_buf_;
+    std::vector<char> recv_buf_;
+
+    // Registered I/O
+    bool rio_{false};
+    RIO_RQ rio_rq_{RIO_INVALID_RQ};
+    int send_idx_{-1};
+    int recv_idx_{-1};
+};
+
+} // namespace nfx
+
+#endif  // NFX_PLATFORM_WINDOWS
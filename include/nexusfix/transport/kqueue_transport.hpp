@@ -0,0 +1,431 @@
+/*
+    NexusFIX kqueue Transport (macOS / BSD)
+
+    Non-blocking TCP transport behind ITransport, driven by one kqueue
+    shared by every session on a thread:
+
+        KqueueContext     kqueue fd + change list; every registration is
+                          queued and flushed by the next kevent() call,
+                          which also harvests events for all sessions
+        KqueueTransport   edge-triggered EVFILT_READ (EV_CLEAR); a readable
+                          socket is drained until EAGAIN. EVFILT_WRITE is
+                          armed one-shot only when a send would block.
+
+    The blocking ITransport calls wait in the shared kqueue, so a session
+    blocked in receive() marks its peers readable as their data arrives
+    and their next receive() returns without a syscall on the kqueue.
+    Timeouts are enforced by kevent(), not SO_RCVTIMEO/SO_SNDTIMEO.
+
+    Single-threaded: a context and its transports belong to one thread.
+    Built where NFX_ASYNC_IO_KQUEUE is set (macOS); other BSDs opt in with
+    NFX_HAS_KQUEUE=1.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/socket.hpp"
+
+#if NFX_ASYNC_IO_KQUEUE || (defined(NFX_HAS_KQUEUE) && NFX_HAS_KQUEUE)
+    #include <sys/event.h>
+    #include <sys/time.h>
+    #define NFX_KQUEUE_AVAILABLE 1
+#else
+    #define NFX_KQUEUE_AVAILABLE 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace nfx {
+
+#if NFX_KQUEUE_AVAILABLE
+
+// ============================================================================
+// kqueue Context
+// ============================================================================
+
+/// Receives the events registered with its pointer as udata
+class KqueueHandler {
+public:
+    virtual ~KqueueHandler() = default;
+    virtual void on_kevent(const struct kevent& event) noexcept = 0;
+};
+
+/// Counters for one context
+struct KqueueStats {
+    uint64_t kevent_calls{0};
+    uint64_t changes{0};        // Change-list entries flushed
+    uint64_t events{0};         // Events dispatched
+};
+
+/// One kqueue with a batched change list
+class KqueueContext {
+public:
+    static constexpr size_t MAX_EVENTS = 64;
+
+    KqueueContext() noexcept { changes_.reserve(MAX_EVENTS); }
+
+    ~KqueueContext() {
+        if (kq_ >= 0) ::close(kq_);
+    }
+
+    KqueueContext(const KqueueContext&) = delete;
+    KqueueContext& operator=(const KqueueContext&) = delete;
+
+    [[nodiscard]] TransportResult<void> init() noexcept {
+        if (kq_ >= 0) return {};
+        kq_ = ::kqueue();
+        if (kq_ < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::KqueueError, errno}};
+        }
+        return {};
+    }
+
+    [[nodiscard]] bool is_initialized() const noexcept { return kq_ >= 0; }
+
+    /// Queue a registration; applied by the next poll()
+    void add_change(SocketHandle fd, int16_t filter, uint16_t flags,
+                    KqueueHandler* handler) noexcept {
+        struct kevent change;
+        EV_SET(&change, static_cast<uintptr_t>(fd), filter, flags, 0, 0, handler);
+        changes_.push_back(change);
+    }
+
+    /// Drop queued changes of a handler that is going away
+    void discard_changes(const KqueueHandler* handler) noexcept {
+        std::erase_if(changes_, [handler](const struct kevent& change) {
+            return change.udata == handler;
+        });
+    }
+
+    /// Flush the change list and dispatch ready events
+    /// @param timeout_ms -1 blocks until an event arrives
+    /// @return Number of events dispatched
+    [[nodiscard]] TransportResult<int> poll(int timeout_ms) noexcept {
+        struct timespec ts;
+        struct timespec* timeout = nullptr;
+        if (timeout_ms >= 0) {
+            ts.tv_sec = timeout_ms / 1000;
+            ts.tv_nsec = static_cast<long>(timeout_ms % 1000) * 1000000L;
+            timeout = &ts;
+        }
+
+        const int n = ::kevent(kq_, changes_.data(), static_cast<int>(changes_.size()),
+                               events_.data(), static_cast<int>(events_.size()), timeout);
+        ++stats_.kevent_calls;
+        if (n < 0) {
+            if (errno == EINTR) return 0;  // Changes are applied before the wait
+            return std::unexpected{TransportError{TransportErrorCode::KqueueError, errno}};
+        }
+        stats_.changes += changes_.size();
+        changes_.clear();
+
+        for (int i = 0; i < n; ++i) {
+            if (auto* handler = static_cast<KqueueHandler*>(events_[static_cast<size_t>(i)].udata)) {
+                handler->on_kevent(events_[static_cast<size_t>(i)]);
+            }
+        }
+        stats_.events += static_cast<uint64_t>(n);
+        return n;
+    }
+
+    [[nodiscard]] size_t pending_changes() const noexcept { return changes_.size(); }
+    [[nodiscard]] const KqueueStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] int fd() const noexcept { return kq_; }
+
+private:
+    int kq_{-1};
+    std::vector<struct kevent> changes_;
+    std::array<struct kevent, MAX_EVENTS> events_{};
+    KqueueStats stats_;
+};
+
+// ============================================================================
+// kqueue Transport
+// ============================================================================
+
+/// Non-blocking TCP transport on a shared KqueueContext
+class KqueueTransport final : public ITransport, private KqueueHandler {
+public:
+    explicit KqueueTransport(KqueueContext& ctx) noexcept : ctx_{ctx} {}
+
+    ~KqueueTransport() override { disconnect(); }
+
+    KqueueTransport(const KqueueTransport&) = delete;
+    KqueueTransport& operator=(const KqueueTransport&) = delete;
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        disconnect();
+        state_ = ConnectionState::Connecting;
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        char port_str[8];
+        std::snprintf(port_str, sizeof(port_str), "%u", port);
+
+        char host_buf[256];
+        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+        std::memcpy(host_buf, host.data(), host_len);
+        host_buf[host_len] = '\0';
+
+        struct addrinfo* addr = nullptr;
+        if (int ret = ::getaddrinfo(host_buf, port_str, &hints, &addr); ret != 0) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_gai_error(ret)};
+        }
+
+        fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (!is_valid_socket(fd_) || !set_socket_nonblocking(fd_, true)) {
+            auto err = make_socket_error();
+            ::freeaddrinfo(addr);
+            fail();
+            return std::unexpected{err};
+        }
+
+        int ret = ::connect(fd_, addr->ai_addr, static_cast<SocketLength>(addr->ai_addrlen));
+        ::freeaddrinfo(addr);
+        if (ret != 0) {
+            if (!is_in_progress_error(get_last_socket_error())) {
+                auto err = make_socket_error();
+                fail();
+                return std::unexpected{err};
+            }
+            // Writable once the handshake completes (or fails)
+            arm_write();
+            if (auto waited = wait_until(writable_, options_.send_timeout_ms); !waited) {
+                fail();
+                return std::unexpected{waited.error()};
+            }
+            int so_error = 0;
+            SocketLength len = sizeof(so_error);
+            ::getsockopt(fd_, SOL_SOCKET, SO_ERROR, sockopt_ptr_mut(&so_error), &len);
+            if (so_error != 0) {
+                fail();
+                return std::unexpected{make_socket_error(so_error)};
+            }
+        }
+
+        return start();
+    }
+
+    /// Take over an already connected socket (e.g. from TcpAcceptor::accept)
+    [[nodiscard]] TransportResult<void> adopt(SocketHandle fd) noexcept {
+        disconnect();
+        fd_ = fd;
+        if (!set_socket_nonblocking(fd_, true)) {
+            auto err = make_socket_error();
+            fail();
+            return std::unexpected{err};
+        }
+        return start();
+    }
+
+    void disconnect() noexcept override {
+        ctx_.discard_changes(this);
+        if (is_valid_socket(fd_)) {
+            state_ = ConnectionState::Disconnecting;
+            close_socket(fd_);  // Removes its knotes
+            fd_ = INVALID_SOCKET_HANDLE;
+        }
+        state_ = ConnectionState::Disconnected;
+        readable_ = false;
+        writable_ = false;
+        write_armed_ = false;
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return state_ == ConnectionState::Connected && is_valid_socket(fd_);
+    }
+
+    /// Send all of data unless the send timeout expires
+    /// @return Bytes sent (short only on timeout)
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        NFX_NO_ALLOC_REGION("KqueueTransport::send");
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        size_t total = 0;
+        while (total < data.size()) {
+            IoSize sent = ::send(fd_, data.data() + total,
+                                 static_cast<IoSize>(data.size() - total), MSG_NOSIGNAL_COMPAT);
+            if (sent > 0) {
+                total += static_cast<size_t>(sent);
+                continue;
+            }
+            int err = get_last_socket_error();
+            if (sent < 0 && err == EINTR) continue;
+            if (sent < 0 && !is_would_block_error(err)) {
+                state_ = ConnectionState::Error;
+                return std::unexpected{make_socket_error(err)};
+            }
+
+            // Socket buffer full: wait for EVFILT_WRITE
+            arm_write();
+            auto waited = wait_until(writable_, options_.send_timeout_ms);
+            if (!waited) {
+                if (waited.error().code == TransportErrorCode::Timeout) break;
+                return std::unexpected{waited.error()};
+            }
+        }
+        return total;
+    }
+
+    /// Receive available data, waiting up to the receive timeout
+    /// @return Bytes received, 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        for (;;) {
+            if (readable_) {
+                IoSize received = ::recv(fd_, buffer.data(), static_cast<IoSize>(buffer.size()), 0);
+                if (received > 0) {
+                    ++stats_receives_;
+                    return static_cast<size_t>(received);  // Edge-triggered: stay readable
+                }
+                if (received == 0) {
+                    state_ = ConnectionState::Disconnected;
+                    return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                }
+                int err = get_last_socket_error();
+                if (err == EINTR) continue;
+                if (!is_would_block_error(err)) {
+                    state_ = ConnectionState::Error;
+                    return std::unexpected{make_socket_error(err)};
+                }
+                readable_ = false;  // Drained; the next edge sets it again
+            }
+
+            auto waited = wait_until(readable_, options_.recv_timeout_ms);
+            if (!waited) {
+                if (waited.error().code == TransportErrorCode::Timeout) return 0;
+                return std::unexpected{waited.error()};
+            }
+        }
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        options_.tcp_nodelay = enable;
+        return !is_valid_socket(fd_) || set_tcp_nodelay(fd_, enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        options_.keep_alive = enable;
+        return !is_valid_socket(fd_) || set_socket_keepalive(fd_, enable);
+    }
+
+    /// Bounds the kevent() wait of receive(); -1 waits forever
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        options_.recv_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// Bounds each kevent() wait for send buffer space; -1 waits forever
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        options_.send_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// Data (or EOF) is waiting: receive() will not block
+    [[nodiscard]] bool is_readable() const noexcept { return readable_; }
+
+    /// Number of receive() calls that returned data
+    [[nodiscard]] uint64_t receive_count() const noexcept { return stats_receives_; }
+
+    [[nodiscard]] ConnectionState state() const noexcept { return state_; }
+    [[nodiscard]] SocketHandle fd() const noexcept { return fd_; }
+    [[nodiscard]] KqueueContext& context() noexcept { return ctx_; }
+
+private:
+    void on_kevent(const struct kevent& event) noexcept override {
+        if (event.flags & EV_ERROR) {
+            // A queued change failed: let receive()/send() hit the socket error
+            readable_ = true;
+            writable_ = true;
+            return;
+        }
+        if (event.filter == EVFILT_READ) {
+            readable_ = true;  // Also on EV_EOF: recv() returns 0
+        } else if (event.filter == EVFILT_WRITE) {
+            writable_ = true;
+            write_armed_ = false;  // EV_ONESHOT
+        }
+    }
+
+    [[nodiscard]] TransportResult<void> start() noexcept {
+#if defined(SO_NOSIGPIPE)
+        int one = 1;
+        (void)::setsockopt(fd_, SOL_SOCKET, SO_NOSIGPIPE, sockopt_ptr(&one), sizeof(one));
+#endif
+        (void)set_tcp_nodelay(fd_, options_.tcp_nodelay);
+        (void)set_socket_keepalive(fd_, options_.keep_alive);
+        (void)set_socket_recv_buffer(fd_, options_.recv_buffer_size);
+        (void)set_socket_send_buffer(fd_, options_.send_buffer_size);
+
+        // Edge-triggered: one event per arrival burst, receive() drains
+        ctx_.add_change(fd_, EVFILT_READ, EV_ADD | EV_CLEAR, this);
+        readable_ = true;  // Data may predate the registration
+        state_ = ConnectionState::Connected;
+        return {};
+    }
+
+    void arm_write() noexcept {
+        writable_ = false;
+        if (write_armed_) return;
+        ctx_.add_change(fd_, EVFILT_WRITE, EV_ADD | EV_ONESHOT, this);
+        write_armed_ = true;
+    }
+
+    /// Poll the shared context until flag is set (by this or any wait)
+    [[nodiscard]] TransportResult<void> wait_until(const bool& flag, int timeout_ms) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(std::max(timeout_ms, 0));
+        while (!flag) {
+            int remaining = -1;
+            if (timeout_ms >= 0) {
+                const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - Clock::now()).count();
+                if (left < 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::Timeout}};
+                }
+                remaining = static_cast<int>(left);
+            }
+            if (auto polled = ctx_.poll(remaining); !polled) {
+                return std::unexpected{polled.error()};
+            }
+        }
+        return {};
+    }
+
+    void fail() noexcept {
+        disconnect();
+        state_ = ConnectionState::Error;
+    }
+
+    KqueueContext& ctx_;
+    SocketHandle fd_{INVALID_SOCKET_HANDLE};
+    ConnectionState state_{ConnectionState::Disconnected};
+    SocketOptions options_{};
+    bool readable_{false};
+    bool writable_{false};
+    bool write_armed_{false};
+    uint64_t stats_receives_{0};
+};
+
+#endif  // NFX_KQUEUE_AVAILABLE
+
+} // namespace nfx
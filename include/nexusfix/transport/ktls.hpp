@@ -0,0 +1,358 @@
+/*
+    NexusFIX Kernel TLS (kTLS)
+
+    TLS for FIX sessions that keeps the kernel data path: the handshake
+    runs in userspace (OpenSSL), then the negotiated keys are handed to
+    the socket (TCP_ULP "tls", TLS_TX / TLS_RX) and the kernel encrypts
+    and decrypts records. Plain send/recv on the socket carry plaintext,
+    so io_uring send, recv, multishot recv, registered buffers and
+    send_zc keep working on an encrypted session. A NIC with TLS offload
+    (`ethtool -K <dev> tls-hw-tx-offload on tls-hw-rx-offload on`) takes
+    the crypto itself; the kernel picks it without anything here.
+
+    - Ciphers: AES-GCM-128/256 and ChaCha20-Poly1305 (kernel 5.11+); the
+      TLS 1.2 cipher list is limited to those so the kernel can take them.
+    - OpenSSL 3.0/3.1 offload TLS 1.3 in the TX direction only; RX needs
+      OpenSSL 3.2, or max_version = Tls12. A direction the kernel did not
+      take stays in the userspace record layer (read() / write()), unless
+      require_offload rejects the session.
+    - With kTLS RX a receive fails with EIO when the next record is not
+      application data (session ticket, key update, alert): read() lets
+      OpenSSL consume it, then the ring receive can be resubmitted.
+
+    Enabled with -DNFX_ENABLE_KTLS=ON (Linux, OpenSSL 3.0+). Without it
+    handshake() fails and TlsConfig::enabled must stay false.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/error.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#if NFX_PLATFORM_LINUX && defined(NFX_HAS_KTLS) && NFX_HAS_KTLS
+    #include <openssl/err.h>
+    #include <openssl/ssl.h>
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <linux/tls.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <cerrno>
+    #include <chrono>
+    #define NFX_KTLS_AVAILABLE 1
+#else
+    #define NFX_KTLS_AVAILABLE 0
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+enum class TlsVersion : uint8_t {
+    Tls12,
+    Tls13
+};
+
+/// Client-side TLS for a transport connection
+struct TlsConfig {
+    bool enabled{false};
+
+    /// SNI and certificate host name (empty = the host passed to connect)
+    std::string server_name;
+
+    /// PEM trust anchors (empty = system default paths)
+    std::string ca_file;
+
+    /// Client certificate chain and key (PEM) for mutual TLS
+    std::string cert_file;
+    std::string key_file;
+
+    bool verify_peer{true};
+
+    TlsVersion min_version{TlsVersion::Tls12};
+    TlsVersion max_version{TlsVersion::Tls13};
+
+    /// Fail the handshake unless the kernel took both directions; false
+    /// keeps the userspace record layer for a direction it did not take
+    bool require_offload{false};
+
+    int handshake_timeout_ms{5000};
+};
+
+/// Directions handled by the kernel
+enum class TlsOffload : uint8_t {
+    None = 0,
+    Tx = 1,
+    Rx = 2,
+    Both = 3
+};
+
+#if NFX_KTLS_AVAILABLE
+
+// ============================================================================
+// kTLS Session
+// ============================================================================
+
+/// TLS state of one connected socket: userspace handshake, then kernel
+/// records wherever OpenSSL could install the keys (SSL_OP_ENABLE_KTLS)
+class KtlsSession {
+public:
+    KtlsSession() noexcept = default;
+    ~KtlsSession() { reset(); }
+
+    KtlsSession(const KtlsSession&) = delete;
+    KtlsSession& operator=(const KtlsSession&) = delete;
+
+    /// Run the client handshake on a connected socket (blocking or not;
+    /// the fd's flags are restored afterwards)
+    /// @param host Connect host, for SNI and verification if server_name is empty
+    [[nodiscard]] TransportResult<void> handshake(
+        int fd, std::string_view host, const TlsConfig& config) noexcept
+    {
+        reset();
+        fd_ = fd;
+
+        ctx_ = SSL_CTX_new(TLS_client_method());
+        if (!ctx_) return fail(TransportErrorCode::TlsHandshakeFailed);
+
+        SSL_CTX_set_min_proto_version(ctx_, proto_version(config.min_version));
+        SSL_CTX_set_max_proto_version(ctx_, proto_version(config.max_version));
+        SSL_CTX_set_options(ctx_, SSL_OP_ENABLE_KTLS);
+        // AEAD suites only: the kernel has no CBC record layer
+        if (SSL_CTX_set_cipher_list(ctx_, "ECDHE+AESGCM:ECDHE+CHACHA20") != 1) {
+            return fail(TransportErrorCode::TlsHandshakeFailed);
+        }
+
+        if (config.verify_peer) {
+            SSL_CTX_set_verify(ctx_, SSL_VERIFY_PEER, nullptr);
+            const int loaded = config.ca_file.empty()
+                ? SSL_CTX_set_default_verify_paths(ctx_)
+                : SSL_CTX_load_verify_locations(ctx_, config.ca_file.c_str(), nullptr);
+            if (loaded != 1) return fail(TransportErrorCode::TlsHandshakeFailed);
+        }
+        if (!config.cert_file.empty()) {
+            if (SSL_CTX_use_certificate_chain_file(ctx_, config.cert_file.c_str()) != 1 ||
+                SSL_CTX_use_PrivateKey_file(ctx_, config.key_file.c_str(), SSL_FILETYPE_PEM) != 1) {
+                return fail(TransportErrorCode::TlsHandshakeFailed);
+            }
+        }
+
+        ssl_ = SSL_new(ctx_);
+        if (!ssl_ || SSL_set_fd(ssl_, fd) != 1) return fail(TransportErrorCode::TlsHandshakeFailed);
+        // Return after a non-data record instead of blocking for the next one
+        SSL_clear_mode(ssl_, SSL_MODE_AUTO_RETRY);
+
+        const std::string name{config.server_name.empty() ? host : config.server_name};
+        if (!name.empty() && !is_ip_literal(name)) {
+            SSL_set_tlsext_host_name(ssl_, name.c_str());
+        }
+        if (config.verify_peer && !name.empty() && SSL_set1_host(ssl_, name.c_str()) != 1) {
+            return fail(TransportErrorCode::TlsHandshakeFailed);
+        }
+
+        // Handshake non-blocking, bounded by the timeout
+        const int flags = ::fcntl(fd, F_GETFL);
+        if (flags < 0) return fail(TransportErrorCode::TlsHandshakeFailed, errno);
+        ::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds{config.handshake_timeout_ms};
+        int ret;
+        while ((ret = SSL_connect(ssl_)) != 1) {
+            const int err = SSL_get_error(ssl_, ret);
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            if ((err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE) || left <= 0 ||
+                !wait(err == SSL_ERROR_WANT_WRITE ? POLLOUT : POLLIN, static_cast<int>(left))) {
+                ::fcntl(fd, F_SETFL, flags);
+                return fail(left <= 0 ? TransportErrorCode::Timeout
+                                      : TransportErrorCode::TlsHandshakeFailed,
+                            err == SSL_ERROR_SYSCALL ? errno : 0);
+            }
+        }
+        ::fcntl(fd, F_SETFL, flags);
+
+        tx_ = BIO_get_ktls_send(SSL_get_wbio(ssl_));
+        rx_ = BIO_get_ktls_recv(SSL_get_rbio(ssl_));
+        if (config.require_offload && !(tx_ && rx_)) {
+            return fail(TransportErrorCode::TlsOffloadUnavailable);
+        }
+#if defined(TLS_RX_EXPECT_NO_PAD)
+        // TLS 1.3 RX (kernel 6.0+): decrypt straight into the user buffer,
+        // assuming no record padding (the kernel retries if there is)
+        if (rx_ && SSL_version(ssl_) == TLS1_3_VERSION) {
+            const int on = 1;
+            (void)::setsockopt(fd, SOL_TLS, TLS_RX_EXPECT_NO_PAD, &on, sizeof(on));
+        }
+#endif
+        return {};
+    }
+
+    [[nodiscard]] bool is_active() const noexcept { return ssl_ != nullptr; }
+    [[nodiscard]] bool tx_offloaded() const noexcept { return tx_; }
+    [[nodiscard]] bool rx_offloaded() const noexcept { return rx_; }
+
+    [[nodiscard]] TlsOffload offload() const noexcept {
+        return static_cast<TlsOffload>((tx_ ? 1 : 0) | (rx_ ? 2 : 0));
+    }
+
+    /// Negotiated protocol and cipher ("TLSv1.3", "TLS_AES_128_GCM_SHA256")
+    [[nodiscard]] std::string_view version() const noexcept {
+        return ssl_ ? SSL_get_version(ssl_) : std::string_view{};
+    }
+    [[nodiscard]] std::string_view cipher() const noexcept {
+        return ssl_ ? SSL_get_cipher_name(ssl_) : std::string_view{};
+    }
+
+    // ========================================================================
+    // Userspace Record Layer
+    // ========================================================================
+
+    /// Write all of data through OpenSSL (the TX path when not offloaded)
+    [[nodiscard]] TransportResult<size_t> write(std::span<const char> data) noexcept {
+        if (!ssl_) return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        size_t written = 0;
+        while (written < data.size()) {
+            size_t n = 0;
+            const int ret = SSL_write_ex(ssl_, data.data() + written, data.size() - written, &n);
+            if (ret == 1) {
+                written += n;
+                continue;
+            }
+            const int err = SSL_get_error(ssl_, ret);
+            if (err == SSL_ERROR_WANT_WRITE || err == SSL_ERROR_WANT_READ) {
+                if (wait(err == SSL_ERROR_WANT_WRITE ? POLLOUT : POLLIN, -1)) continue;
+            }
+            return std::unexpected{TransportError{TransportErrorCode::WriteError,
+                                                  err == SSL_ERROR_SYSCALL ? errno : 0}};
+        }
+        return written;
+    }
+
+    /// Read application data through OpenSSL: the RX path when not
+    /// offloaded, and after an EIO receive on a kTLS RX socket (a non-data
+    /// record is consumed first)
+    /// @param timeout_ms Wait for data (-1 = until it arrives, 0 = don't)
+    [[nodiscard]] TransportResult<size_t> read(std::span<char> buffer, int timeout_ms = -1) noexcept {
+        if (!ssl_) return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        for (;;) {
+            size_t n = 0;
+            const int ret = SSL_read_ex(ssl_, buffer.data(), buffer.size(), &n);
+            if (ret == 1) return n;
+
+            const int err = SSL_get_error(ssl_, ret);
+            if (err == SSL_ERROR_ZERO_RETURN) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            if (err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) {
+                if (timeout_ms == 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::WouldBlock}};
+                }
+                if (wait(err == SSL_ERROR_WANT_WRITE ? POLLOUT : POLLIN, timeout_ms)) continue;
+                return std::unexpected{TransportError{TransportErrorCode::Timeout}};
+            }
+            if (err == SSL_ERROR_SYSCALL && errno == 0) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            return std::unexpected{TransportError{TransportErrorCode::ReadError,
+                                                  err == SSL_ERROR_SYSCALL ? errno : 0}};
+        }
+    }
+
+    /// Plaintext OpenSSL decrypted past the handshake; read() it before
+    /// the first kernel receive
+    [[nodiscard]] size_t pending() const noexcept {
+        return ssl_ ? static_cast<size_t>(SSL_pending(ssl_)) : 0;
+    }
+
+    // ========================================================================
+    // Teardown
+    // ========================================================================
+
+    /// Send close_notify (best effort) and drop the session
+    void shutdown() noexcept {
+        if (ssl_) (void)SSL_shutdown(ssl_);
+        reset();
+    }
+
+    /// Drop the session without a close_notify; the socket stays open
+    void reset() noexcept {
+        if (ssl_) SSL_free(ssl_);
+        if (ctx_) SSL_CTX_free(ctx_);
+        ssl_ = nullptr;
+        ctx_ = nullptr;
+        fd_ = -1;
+        tx_ = false;
+        rx_ = false;
+    }
+
+private:
+    [[nodiscard]] static int proto_version(TlsVersion v) noexcept {
+        return v == TlsVersion::Tls12 ? TLS1_2_VERSION : TLS1_3_VERSION;
+    }
+
+    [[nodiscard]] static bool is_ip_literal(const std::string& name) noexcept {
+        in6_addr addr{};
+        return ::inet_pton(AF_INET, name.c_str(), &addr) == 1 ||
+               ::inet_pton(AF_INET6, name.c_str(), &addr) == 1;
+    }
+
+    [[nodiscard]] bool wait(short events, int timeout_ms) const noexcept {
+        pollfd pfd{fd_, events, 0};
+        int ret;
+        do {
+            ret = ::poll(&pfd, 1, timeout_ms);
+        } while (ret < 0 && errno == EINTR);
+        return ret > 0;
+    }
+
+    [[nodiscard]] std::unexpected<TransportError> fail(TransportErrorCode code, int err = 0) noexcept {
+        ERR_clear_error();
+        reset();
+        return std::unexpected{TransportError{code, err}};
+    }
+
+    SSL_CTX* ctx_{nullptr};
+    SSL* ssl_{nullptr};
+    int fd_{-1};
+    bool tx_{false};
+    bool rx_{false};
+};
+
+#else  // !NFX_KTLS_AVAILABLE
+
+/// Stub when built without NFX_ENABLE_KTLS: every handshake fails
+class KtlsSession {
+public:
+    [[nodiscard]] TransportResult<void> handshake(int, std::string_view, const TlsConfig&) noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::TlsHandshakeFailed}};
+    }
+    [[nodiscard]] bool is_active() const noexcept { return false; }
+    [[nodiscard]] bool tx_offloaded() const noexcept { return false; }
+    [[nodiscard]] bool rx_offloaded() const noexcept { return false; }
+    [[nodiscard]] TlsOffload offload() const noexcept { return TlsOffload::None; }
+    [[nodiscard]] std::string_view version() const noexcept { return {}; }
+    [[nodiscard]] std::string_view cipher() const noexcept { return {}; }
+    [[nodiscard]] TransportResult<size_t> write(std::span<const char>) noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+    }
+    [[nodiscard]] TransportResult<size_t> read(std::span<char>, int = -1) noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+    }
+    [[nodiscard]] size_t pending() const noexcept { return 0; }
+    void shutdown() noexcept {}
+    void reset() noexcept {}
+};
+
+#endif  // NFX_KTLS_AVAILABLE
+
+} // namespace nfx
@@ -0,0 +1,144 @@
+#pragma once
+
+/// @file metrics_http.hpp
+/// @brief Minimal HTTP/1.1 endpoint serving a MetricsRegistry to Prometheus
+///
+/// One background thread accepts a connection, reads the request line,
+/// answers GET /metrics with MetricsRegistry::render() and closes. The
+/// registry is snapshotted on this thread per scrape; session threads only
+/// ever publish into their slots. Anything else gets a 404.
+///
+/// Usage:
+///     MetricsHttpServer server{registry};
+///     if (server.start(9464)) { ... }        // curl localhost:9464/metrics
+///     server.stop();
+
+#include "nexusfix/session/metrics.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace nfx {
+
+// ============================================================================
+// Metrics HTTP Server
+// ============================================================================
+
+class MetricsHttpServer {
+public:
+    static constexpr std::string_view CONTENT_TYPE =
+        "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+    explicit MetricsHttpServer(const MetricsRegistry& registry,
+                               std::chrono::milliseconds poll_interval = std::chrono::milliseconds{50}) noexcept
+        : registry_{registry}, poll_interval_{poll_interval} {}
+
+    ~MetricsHttpServer() { stop(); }
+
+    MetricsHttpServer(const MetricsHttpServer&) = delete;
+    MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+    /// Listen on port (0 = ephemeral, see port()) and start serving
+    /// @return false if already running or the port could not be bound
+    [[nodiscard]] bool start(uint16_t port) {
+        if (running_.load(std::memory_order_relaxed)) return false;
+        if (!acceptor_.listen(port, 16)) return false;
+        (void)set_socket_nonblocking(acceptor_.fd(), true);
+        running_.store(true, std::memory_order_release);
+        worker_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    void stop() noexcept {
+        if (!running_.exchange(false)) return;
+        if (worker_.joinable()) worker_.join();
+        acceptor_.close();
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint16_t port() const noexcept { return acceptor_.local_port(); }
+
+    /// Scrapes answered with 200
+    [[nodiscard]] uint64_t scrapes() const noexcept {
+        return scrapes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run() noexcept {
+        while (running_.load(std::memory_order_acquire)) {
+            auto fd = acceptor_.accept();
+            if (!fd) {
+                std::this_thread::sleep_for(poll_interval_);
+                continue;
+            }
+            TcpSocket client;
+            client.adopt(*fd);
+            client.set_nonblocking(false);
+            (void)client.set_receive_timeout(1000);
+            serve(client);
+        }
+    }
+
+    void serve(TcpSocket& client) noexcept {
+        // Only the request line matters; headers are read and ignored
+        std::array<char, 2048> request{};
+        size_t received = 0;
+        while (received < request.size()) {
+            auto n = client.receive(std::span<char>{request}.subspan(received));
+            if (!n || *n == 0) break;
+            received += *n;
+            if (std::string_view{request.data(), received}.find("\r\n\r\n") != std::string_view::npos) break;
+        }
+        const std::string_view head{request.data(), received};
+
+        if (head.starts_with("GET /metrics ") || head.starts_with("GET /metrics?")) {
+            body_.clear();
+            registry_.render(body_);
+            respond(client, "200 OK", CONTENT_TYPE, body_);
+            scrapes_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            respond(client, "404 Not Found", "text/plain; charset=utf-8", "Not Found\n");
+        }
+        client.close();
+    }
+
+    void respond(TcpSocket& client, std::string_view status, std::string_view type,
+                 std::string_view body) noexcept {
+        header_.assign("HTTP/1.1 ");
+        header_.append(status);
+        header_.append("\r\nContent-Type: ");
+        header_.append(type);
+        header_.append("\r\nContent-Length: ");
+        header_.append(std::to_string(body.size()));
+        header_.append("\r\nConnection: close\r\n\r\n");
+        if (send_all(client, header_)) (void)send_all(client, body);
+    }
+
+    static bool send_all(TcpSocket& client, std::string_view data) noexcept {
+        while (!data.empty()) {
+            auto n = client.send(std::span<const char>{data.data(), data.size()});
+            if (!n || *n == 0) return false;
+            data.remove_prefix(*n);
+        }
+        return true;
+    }
+
+    const MetricsRegistry& registry_;
+    std::chrono::milliseconds poll_interval_;
+    TcpAcceptor acceptor_;
+    std::thread worker_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> scrapes_{0};
+    std::string body_;                 // Reused across scrapes (worker thread)
+    std::string header_;
+};
+
+} // namespace nfx
@@ -0,0 +1,588 @@
+/*
+    NexusFIX Multicast Market Data Receiver
+
+    UDP market data with A/B line arbitration. Exchanges publish every
+    packet twice, on two multicast groups (lines A and B) routed over
+    separate paths; the receiver keeps the first copy of each packet
+    sequence number and drops the second:
+
+        line A: 1 2 _ 4 5        recvmmsg() batch per line, MSG_DONTWAIT
+        line B: 1 2 3 4 _     -> on_packet(1) (2) (3) (4) (5)
+
+    A packet ahead of the next expected sequence is held (copied into a
+    fixed slot) until the missing one arrives on the other line. The gap
+    is final, and reported with on_gap(), once every line has moved past
+    it, when the packet is beyond the hold window, or on flush(); held
+    packets then go out in order. A single-line feed reports gaps at once.
+
+    Datagrams are read with recvmmsg() into buffers allocated once by
+    open(): one syscall per line per poll() for up to batch packets.
+    The packet layout is a policy:
+
+    - Mdp3Packet: CME MDP 3.0 binary packet, | MsgSeqNum u32 | SendingTime
+      u64 | then messages | MsgSize u16 | SBE header + body |; split with
+      for_each_message() and decode with sbe::dispatch / decode_md_group
+    - FixPacket: FIX tag-value, one message per datagram, sequenced by
+      MsgSeqNum (34); for_each_message() frames with StreamParser
+
+    Gaps feed the snapshot/incremental recovery: on_gap() calls
+    MarketDataRecovery::request_snapshot_all(), which buffers every live
+    symbol until the snapshot feed rebuilds it.
+
+    Handler (duck-typed):
+        void on_packet(uint32_t seq, std::span<const char> payload);
+        void on_gap(uint32_t expected, uint32_t received);   // optional
+
+    Usage:
+        MulticastFeedConfig config;
+        config.line_a = {"224.0.31.1", 14310, "10.1.2.3"};
+        config.line_b = {"224.0.32.1", 15310, "10.1.3.3"};
+        MulticastReceiver<FixPacket> feed;
+        feed.open(config);
+
+        struct Incrementals {
+            void on_packet(uint32_t, std::span<const char> payload) noexcept {
+                FixPacket::for_each_message(payload, [&](std::span<const char> raw) {
+                    if (auto msg = ParsedMessage::parse(raw)) recovery->apply(*msg, books);
+                });
+            }
+            void on_gap(uint32_t, uint32_t) noexcept { recovery->request_snapshot_all(); }
+        } incrementals;
+        while (running) feed.poll(incrementals);
+
+    Linux only (recvmmsg). Single-threaded (market data thread).
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/session/msg_type_filter.hpp"  // peek_header
+#include "nexusfix/util/prefetch.hpp"
+
+#if NFX_PLATFORM_LINUX
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace nfx {
+
+// ============================================================================
+// Packet Layouts
+// ============================================================================
+
+/// CME MDP 3.0 binary packet (little-endian)
+struct Mdp3Packet {
+    static constexpr size_t HEADER_SIZE = 12;       // MsgSeqNum u32 + SendingTime u64
+    static constexpr size_t MSG_SIZE_FIELD = 2;     // Per message, counts itself
+
+    [[nodiscard]] static std::optional<uint32_t> sequence(std::span<const char> datagram) noexcept {
+        if (datagram.size() < HEADER_SIZE) return std::nullopt;
+        uint32_t seq;
+        std::memcpy(&seq, datagram.data(), sizeof(seq));
+        return seq;
+    }
+
+    [[nodiscard]] static uint64_t sending_time(std::span<const char> datagram) noexcept {
+        uint64_t ns = 0;
+        if (datagram.size() >= HEADER_SIZE) std::memcpy(&ns, datagram.data() + 4, sizeof(ns));
+        return ns;
+    }
+
+    /// Messages after the packet header
+    [[nodiscard]] static std::span<const char> payload(std::span<const char> datagram) noexcept {
+        return datagram.size() < HEADER_SIZE ? std::span<const char>{} : datagram.subspan(HEADER_SIZE);
+    }
+
+    /// Call fn(message) for each SBE message (MsgSize stripped)
+    /// @return Messages passed to fn; stops at a truncated message
+    template <typename Fn>
+    static size_t for_each_message(std::span<const char> payload, Fn&& fn) noexcept {
+        size_t pos = 0;
+        size_t n = 0;
+        while (payload.size() - pos >= MSG_SIZE_FIELD) {
+            uint16_t size;
+            std::memcpy(&size, payload.data() + pos, sizeof(size));
+            if (size <= MSG_SIZE_FIELD || size > payload.size() - pos) break;
+            fn(payload.subspan(pos + MSG_SIZE_FIELD, size - MSG_SIZE_FIELD));
+            pos += size;
+            ++n;
+        }
+        return n;
+    }
+};
+
+/// FIX tag-value datagram carrying one message
+struct FixPacket {
+    [[nodiscard]] static std::optional<uint32_t> sequence(std::span<const char> datagram) noexcept {
+        const HeaderPeek peek = peek_header(datagram);
+        if (!peek.ok()) return std::nullopt;
+        return peek.msg_seq_num;
+    }
+
+    [[nodiscard]] static std::span<const char> payload(std::span<const char> datagram) noexcept {
+        return datagram;
+    }
+
+    /// Call fn(message) for each complete FIX message
+    /// @return Messages passed to fn
+    template <typename Fn>
+    static size_t for_each_message(std::span<const char> payload, Fn&& fn) noexcept {
+        StreamParser framer;
+        size_t pos = 0;
+        size_t n = 0;
+        while (pos < payload.size()) {
+            const auto rest = payload.subspan(pos);
+            const size_t consumed = framer.feed(rest);
+            if (!framer.has_message()) break;
+            while (framer.has_message()) {
+                const auto [start, end] = framer.next_message();
+                fn(rest.subspan(start, end - start));
+                ++n;
+            }
+            pos += consumed;
+        }
+        return n;
+    }
+};
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+struct MulticastFeedStats {
+    std::array<uint64_t, 2> packets{};  // Datagrams received per line
+    uint64_t delivered{0};              // Packets passed to the handler
+    uint64_t duplicates{0};             // Second copies (and late packets) dropped
+    uint64_t held{0};                   // Packets parked ahead of a missing one
+    uint64_t gaps{0};                   // on_gap() calls
+    uint64_t lost{0};                   // Sequence numbers neither line delivered
+    uint64_t invalid{0};                // Datagrams without a readable sequence
+    uint64_t truncated{0};              // Datagrams larger than packet_bytes
+};
+
+// ============================================================================
+// Line Arbitration
+// ============================================================================
+
+/// Sequences packets from one or two lines into one gap-checked stream
+/// Hold slots are allocated once by the constructor.
+class LineArbitrator {
+public:
+    static constexpr size_t MAX_LINES = 2;
+
+    /// @param lines Lines feeding the arbitrator (1 or 2)
+    /// @param hold_packets Packets that may wait for a missing one
+    /// @param packet_bytes Largest packet that can be held
+    LineArbitrator(size_t lines, size_t hold_packets, size_t packet_bytes)
+        : lines_{lines < 1 ? 1 : (lines > MAX_LINES ? MAX_LINES : lines)}
+        , packet_bytes_{packet_bytes}
+        , slots_(hold_packets < 2 ? 2 : hold_packets)
+        , bytes_(slots_.size() * packet_bytes) {}
+
+    /// Arbitrate one packet
+    /// @param line 0 (A) or 1 (B)
+    /// @return Packets passed to handler.on_packet()
+    template <typename Handler>
+    NFX_HOT size_t on_packet(size_t line, uint32_t seq, std::span<const char> data,
+                             Handler& handler) noexcept {
+        ++stats_.packets[line];
+        if (seq > high_[line]) high_[line] = seq;
+        if (!synced_) [[unlikely]] {
+            synced_ = true;
+            expected_ = seq;  // First packet sets the baseline
+        }
+
+        if (seq == expected_) [[likely]] {
+            deliver(seq, data, handler);
+            size_t n = 1 + drain(handler);
+            return n + resolve(handler);
+        }
+        if (seq < expected_ || is_held(seq)) {
+            ++stats_.duplicates;
+            return resolve(handler);  // The copy still moves its line forward
+        }
+
+        if (seq - expected_ < slots_.size() && data.size() <= packet_bytes_) {
+            hold(seq, data);
+            return resolve(handler);
+        }
+
+        // Cannot be held: everything before it is final
+        size_t n = 0;
+        while (held_ != 0 && lowest_held() < seq) {
+            n += skip_to_held(handler);
+        }
+        if (expected_ != seq) report_gap(seq, handler);
+        deliver(seq, data, handler);
+        return n + 1 + drain(handler);
+    }
+
+    /// Give up on missing packets: report the gaps and deliver everything held
+    /// (e.g. a line is down and nothing has arrived for a while)
+    template <typename Handler>
+    size_t flush(Handler& handler) noexcept {
+        size_t n = 0;
+        while (held_ != 0) n += skip_to_held(handler);
+        return n;
+    }
+
+    /// Resynchronize on the next packet (e.g. after a feed restart)
+    void reset() noexcept {
+        for (auto& slot : slots_) slot.used = false;
+        high_ = {};
+        held_ = 0;
+        expected_ = 0;
+        synced_ = false;
+    }
+
+    /// Next sequence number due (0 before the first packet)
+    [[nodiscard]] uint32_t expected() const noexcept { return expected_; }
+    [[nodiscard]] size_t held() const noexcept { return held_; }
+    [[nodiscard]] size_t lines() const noexcept { return lines_; }
+
+    [[nodiscard]] const MulticastFeedStats& stats() const noexcept { return stats_; }
+    MulticastFeedStats& stats() noexcept { return stats_; }
+
+private:
+    struct Slot {
+        uint32_t seq{0};
+        uint32_t size{0};
+        bool used{false};
+    };
+
+    [[nodiscard]] size_t index(uint32_t seq) const noexcept { return seq % slots_.size(); }
+
+    [[nodiscard]] bool is_held(uint32_t seq) const noexcept {
+        const Slot& slot = slots_[index(seq)];
+        return slot.used && slot.seq == seq;
+    }
+
+    void hold(uint32_t seq, std::span<const char> data) noexcept {
+        Slot& slot = slots_[index(seq)];
+        std::memcpy(bytes_.data() + index(seq) * packet_bytes_, data.data(), data.size());
+        slot = Slot{seq, static_cast<uint32_t>(data.size()), true};
+        ++held_;
+        ++stats_.held;
+    }
+
+    template <typename Handler>
+    void deliver(uint32_t seq, std::span<const char> data, Handler& handler) noexcept {
+        expected_ = seq + 1;
+        ++stats_.delivered;
+        handler.on_packet(seq, data);
+    }
+
+    /// Deliver held packets that are now in sequence
+    template <typename Handler>
+    size_t drain(Handler& handler) noexcept {
+        size_t n = 0;
+        while (held_ != 0 && is_held(expected_)) {
+            Slot& slot = slots_[index(expected_)];
+            slot.used = false;
+            --held_;
+            deliver(expected_, {bytes_.data() + index(expected_) * packet_bytes_, slot.size}, handler);
+            ++n;
+        }
+        return n;
+    }
+
+    /// Lowest held sequence (held_ != 0)
+    [[nodiscard]] uint32_t lowest_held() const noexcept {
+        for (size_t i = 1; i < slots_.size(); ++i) {
+            const auto seq = static_cast<uint32_t>(expected_ + i);
+            if (is_held(seq)) return seq;
+        }
+        return expected_;
+    }
+
+    /// Every line has moved past the missing packet
+    [[nodiscard]] bool gap_final() const noexcept {
+        for (size_t line = 0; line < lines_; ++line) {
+            if (high_[line] <= expected_) return false;
+        }
+        return true;
+    }
+
+    /// Declare final gaps and deliver what they were holding back
+    template <typename Handler>
+    size_t resolve(Handler& handler) noexcept {
+        size_t n = 0;
+        while (held_ != 0 && gap_final()) n += skip_to_held(handler);
+        return n;
+    }
+
+    template <typename Handler>
+    size_t skip_to_held(Handler& handler) noexcept {
+        report_gap(lowest_held(), handler);
+        return drain(handler);
+    }
+
+    template <typename Handler>
+    void report_gap(uint32_t received, Handler& handler) noexcept {
+        ++stats_.gaps;
+        stats_.lost += received - expected_;
+        if constexpr (requires { handler.on_gap(expected_, received); }) {
+            handler.on_gap(expected_, received);
+        }
+        expected_ = received;
+    }
+
+    size_t lines_;
+    size_t packet_bytes_;
+    std::vector<Slot> slots_;
+    std::vector<char> bytes_;
+    std::array<uint32_t, MAX_LINES> high_{};  // Highest sequence seen per line
+    size_t held_{0};
+    uint32_t expected_{0};
+    bool synced_{false};
+    MulticastFeedStats stats_{};
+};
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// One multicast line
+struct MulticastLine {
+    /// Group to join ("224.0.31.1"); a unicast address binds a plain UDP
+    /// socket instead (replays, tests). Empty: line not used.
+    std::string_view group{};
+    uint16_t port{0};                   // 0: ephemeral (see local_port())
+    std::string_view interface{};       // Local address to join on (empty: any)
+    std::string_view source{};          // Source-specific multicast sender (empty: any)
+};
+
+struct MulticastFeedConfig {
+    MulticastLine line_a{};
+    MulticastLine line_b{};             // Empty group: single-line feed
+
+    size_t batch{32};                   // Datagrams per recvmmsg() call
+    size_t packet_bytes{1500};          // Largest datagram (larger ones are dropped)
+    size_t hold_packets{64};            // Arbitration window
+    int receive_buffer{4 * 1024 * 1024};  // SO_RCVBUF (0: system default)
+};
+
+// ============================================================================
+// Multicast Receiver
+// ============================================================================
+
+/// Batched UDP receive and A/B arbitration
+/// @tparam Packet Mdp3Packet, FixPacket or a policy with sequence() / payload()
+template <typename Packet>
+class MulticastReceiver {
+public:
+    MulticastReceiver() noexcept = default;
+    ~MulticastReceiver() { close(); }
+
+    MulticastReceiver(const MulticastReceiver&) = delete;
+    MulticastReceiver& operator=(const MulticastReceiver&) = delete;
+
+    /// Open, bind and join both lines and allocate the receive buffers
+    [[nodiscard]] TransportResult<void> open(const MulticastFeedConfig& config) {
+        close();
+        const size_t lines = config.line_b.group.empty() ? 1 : 2;
+        for (size_t line = 0; line < lines; ++line) {
+            auto result = open_line(line, line == 0 ? config.line_a : config.line_b,
+                                    config.receive_buffer);
+            if (!result) {
+                close();
+                return result;
+            }
+        }
+
+        const size_t batch = config.batch ? config.batch : 1;
+        packet_bytes_ = config.packet_bytes;
+        buffers_.assign(batch * packet_bytes_, 0);
+        iovecs_.resize(batch);
+        headers_.resize(batch);
+        for (size_t i = 0; i < batch; ++i) {
+            iovecs_[i] = iovec{buffers_.data() + i * packet_bytes_, packet_bytes_};
+            headers_[i] = mmsghdr{};
+            headers_[i].msg_hdr.msg_iov = &iovecs_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+        arbitrator_.emplace(lines, config.hold_packets, packet_bytes_);
+        return {};
+    }
+
+    void close() noexcept {
+        for (int& fd : fds_) {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fds_[0] >= 0; }
+
+    /// Receive one batch per line without blocking and arbitrate it
+    /// @return Packets passed to handler.on_packet()
+    template <typename Handler>
+    NFX_HOT size_t poll(Handler& handler) noexcept {
+        if (!arbitrator_) [[unlikely]] return 0;
+        Payload<Handler> payload{handler};
+        size_t delivered = 0;
+        for (size_t line = 0; line < arbitrator_->lines(); ++line) {
+            const int n = ::recvmmsg(fds_[line], headers_.data(),
+                                     static_cast<unsigned>(headers_.size()), MSG_DONTWAIT, nullptr);
+            for (int i = 0; i < n; ++i) {
+                if (i + 1 < n) util::prefetch_read(iovecs_[i + 1].iov_base);
+                delivered += arbitrate(line, headers_[i], payload);
+            }
+        }
+        return delivered;
+    }
+
+    /// Report outstanding gaps and deliver held packets
+    template <typename Handler>
+    size_t flush(Handler& handler) noexcept {
+        if (!arbitrator_) return 0;
+        Payload<Handler> payload{handler};
+        return arbitrator_->flush(payload);
+    }
+
+    /// Bound port of a line (for port 0 in the config)
+    [[nodiscard]] uint16_t local_port(size_t line) const noexcept {
+        sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        if (line >= fds_.size() || fds_[line] < 0 ||
+            ::getsockname(fds_[line], reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            return 0;
+        }
+        return ntohs(addr.sin_port);
+    }
+
+    [[nodiscard]] int fd(size_t line) const noexcept { return line < fds_.size() ? fds_[line] : -1; }
+
+    /// Arbitration state (nullptr before open())
+    [[nodiscard]] LineArbitrator* arbitrator() noexcept {
+        return arbitrator_ ? &*arbitrator_ : nullptr;
+    }
+
+    [[nodiscard]] MulticastFeedStats stats() const noexcept {
+        return arbitrator_ ? arbitrator_->stats() : MulticastFeedStats{};
+    }
+
+private:
+    /// Strips the packet header before the user handler sees it
+    template <typename Handler>
+    struct Payload {
+        Handler& handler;
+
+        void on_packet(uint32_t seq, std::span<const char> datagram) {
+            handler.on_packet(seq, Packet::payload(datagram));
+        }
+        void on_gap(uint32_t expected, uint32_t received)
+            requires requires(Handler& h) { h.on_gap(0u, 0u); } {
+            handler.on_gap(expected, received);
+        }
+    };
+
+    template <typename Handler>
+    size_t arbitrate(size_t line, mmsghdr& header, Handler& handler) noexcept {
+        const bool truncated = (header.msg_hdr.msg_flags & MSG_TRUNC) != 0;
+        header.msg_hdr.msg_flags = 0;
+        if (truncated) [[unlikely]] {
+            ++arbitrator_->stats().truncated;
+            return 0;
+        }
+        const std::span<const char> datagram{
+            static_cast<const char*>(header.msg_hdr.msg_iov->iov_base), header.msg_len};
+        const auto seq = Packet::sequence(datagram);
+        if (!seq) [[unlikely]] {
+            ++arbitrator_->stats().invalid;
+            return 0;
+        }
+        return arbitrator_->on_packet(line, *seq, datagram, handler);
+    }
+
+    /// inet_pton on a string_view (empty: INADDR_ANY)
+    [[nodiscard]] static bool parse_address(std::string_view text, in_addr& out) noexcept {
+        if (text.empty()) {
+            out.s_addr = htonl(INADDR_ANY);
+            return true;
+        }
+        char buf[INET_ADDRSTRLEN];
+        if (text.size() >= sizeof(buf)) return false;
+        std::memcpy(buf, text.data(), text.size());
+        buf[text.size()] = '\0';
+        return ::inet_pton(AF_INET, buf, &out) == 1;
+    }
+
+    [[nodiscard]] TransportResult<void> open_line(size_t line, const MulticastLine& config,
+                                                  int receive_buffer) noexcept {
+        in_addr group{};
+        in_addr interface{};
+        in_addr source{};
+        if (!parse_address(config.group, group) || !parse_address(config.interface, interface) ||
+            !parse_address(config.source, source)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed, EINVAL}};
+        }
+
+        const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        }
+        fds_[line] = fd;
+
+        // Other processes may listen to the same group
+        const int one = 1;
+        (void)::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (receive_buffer > 0) {
+            (void)::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer, sizeof(receive_buffer));
+        }
+
+        // Binding the group address keeps other groups on this port out
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config.port);
+        addr.sin_addr = group;
+        if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        }
+        if (!IN_MULTICAST(ntohl(group.s_addr))) return {};
+
+        int rc;
+        if (config.source.empty()) {
+            ip_mreq mreq{};
+            mreq.imr_multiaddr = group;
+            mreq.imr_interface = interface;
+            rc = ::setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+        } else {
+            ip_mreq_source mreq{};
+            mreq.imr_multiaddr = group;
+            mreq.imr_interface = interface;
+            mreq.imr_sourceaddr = source;
+            rc = ::setsockopt(fd, IPPROTO_IP, IP_ADD_SOURCE_MEMBERSHIP, &mreq, sizeof(mreq));
+        }
+        if (rc != 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        }
+        return {};
+    }
+
+    std::array<int, LineArbitrator::MAX_LINES> fds_{-1, -1};
+    std::optional<LineArbitrator> arbitrator_;
+    size_t packet_bytes_{0};
+    std::vector<char> buffers_;
+    std::vector<iovec> iovecs_;
+    std::vector<mmsghdr> headers_;
+};
+
+}  // namespace nfx
+
+#endif  // NFX_PLATFORM_LINUX
@@ -0,0 +1,186 @@
+/*
+    NexusFIX Reconnect Manager
+
+    Shortest path from a dropped connection back to a sent Logon. The
+    work a connect would do up front happens ahead of time instead:
+
+        prepare()                      (after each connect, off the hot path)
+          EndpointCache                primary and backup resolved, cached for dns_ttl
+          StandbySockets               sockets created with options applied
+
+        connect()                      (on disconnect)
+          take a socket per endpoint, IORING_OP_CONNECT to the cached
+          address with a linked timeout; race_backup connects to primary
+          and backup at once and keeps the first one up
+
+    Without race_backup, attempts stay on one endpoint until it fails and
+    then move to the other (and to its next DNS address).
+
+    Usage (on the reactor thread):
+        ReconnectManager reconnect{{.primary_host = "10.0.0.1", .primary_port = 9876,
+                                    .backup_host = "10.0.1.1", .backup_port = 9876}};
+        reconnect.prepare();
+        auto channel = reconnect.connect(reactor, handler);
+        ...
+        void on_connected() { reconnect.on_connected(reactor); send_logon(); reconnect.prepare(); }
+        void on_closed(...) { if (!was_up) reconnect.on_connect_failed(); ... }
+*/
+
+#pragma once
+
+#include "nexusfix/transport/endpoint_cache.hpp"
+#include "nexusfix/transport/io_uring_reactor.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace nfx {
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// Standby socket options: what the reactor sets itself, kernel-sized buffers
+[[nodiscard]] inline SocketOptions reactor_socket_options() noexcept {
+    SocketOptions options;
+    options.recv_buffer_size = 0;
+    options.send_buffer_size = 0;
+    return options;
+}
+
+struct ReconnectConfig {
+    std::string primary_host;
+    uint16_t primary_port{0};
+
+    /// Backup endpoint (empty host = none)
+    std::string backup_host;
+    uint16_t backup_port{0};
+
+    /// Connect to primary and backup at once; the first one up wins
+    bool race_backup{false};
+
+    /// Linked timeout on each connect (0 = kernel SYN retries decide)
+    uint32_t connect_timeout_ms{3000};
+
+    /// Sockets kept created and configured
+    size_t standby_sockets{2};
+
+    std::chrono::seconds dns_ttl{300};
+
+    SocketOptions socket_options{reactor_socket_options()};
+};
+
+struct ReconnectStats {
+    uint64_t attempts{0};
+    uint64_t connects{0};
+    uint64_t backup_connects{0};      // Connections that ended up on the backup
+    uint64_t failovers{0};            // Sequential mode: switched endpoint after a failure
+};
+
+// ============================================================================
+// Reconnect Manager
+// ============================================================================
+
+class ReconnectManager {
+public:
+    using ChannelId = IoUringReactor::ChannelId;
+
+    explicit ReconnectManager(ReconnectConfig config)
+        : config_{std::move(config)}
+        , cache_{config_.dns_ttl}
+        , sockets_{config_.standby_sockets, config_.socket_options} {}
+
+    /// Resolve the endpoints and refill the standby sockets
+    /// Call before the first connect and once a connection is up.
+    void prepare() noexcept {
+        (void)cache_.lookup(config_.primary_host, config_.primary_port);
+        if (has_backup()) (void)cache_.lookup(config_.backup_host, config_.backup_port);
+        (void)sockets_.refill();
+    }
+
+    /// Start a connect from cached addresses on standby sockets
+    /// handler.on_connected() or handler.on_closed() follows from the reactor.
+    [[nodiscard]] TransportResult<ChannelId> connect(
+        IoUringReactor& reactor, IReactorHandler& handler) noexcept
+    {
+        ++stats_.attempts;
+        std::array<ConnectTarget, 2> targets{};
+        size_t count = 0;
+        last_endpoints_ = {};
+
+        const bool race = config_.race_backup && has_backup();
+        for (size_t i = 0; i < (race ? 2u : 1u); ++i) {
+            const bool backup = race ? i == 1 : on_backup_;
+            auto target = prepare_target(backup);
+            if (!target) {
+                for (size_t j = 0; j < count; ++j) ::close(targets[j].fd);
+                return std::unexpected{target.error()};
+            }
+            targets[count] = *target;
+            last_endpoints_[count] = backup;
+            ++count;
+        }
+        auto channel = reactor.connect(std::span<const ConnectTarget>{targets.data(), count},
+                                       handler, config_.connect_timeout_ms);
+        if (channel) channel_ = *channel;
+        return channel;
+    }
+
+    /// The connect started by connect() succeeded (call from on_connected())
+    void on_connected(const IoUringReactor& reactor) noexcept {
+        ++stats_.connects;
+        const bool backup = last_endpoints_[reactor.connected_target(channel_)];
+        if (backup) ++stats_.backup_connects;
+        on_backup_ = backup;
+    }
+
+    /// The connect started by connect() failed: the next attempt uses the
+    /// other endpoint (sequential mode) and the next cached address
+    void on_connect_failed() noexcept {
+        cache_.rotate(config_.primary_host, config_.primary_port);
+        if (has_backup()) {
+            cache_.rotate(config_.backup_host, config_.backup_port);
+            if (!config_.race_backup) {
+                on_backup_ = !on_backup_;
+                ++stats_.failovers;
+            }
+        }
+    }
+
+    [[nodiscard]] bool has_backup() const noexcept { return !config_.backup_host.empty(); }
+
+    /// Sequential mode: the endpoint the next connect() goes to
+    [[nodiscard]] bool on_backup() const noexcept { return on_backup_; }
+
+    [[nodiscard]] const ReconnectStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const EndpointCache& endpoints() const noexcept { return cache_; }
+    [[nodiscard]] const StandbySockets& standby() const noexcept { return sockets_; }
+    [[nodiscard]] const ReconnectConfig& config() const noexcept { return config_; }
+
+private:
+    [[nodiscard]] TransportResult<ConnectTarget> prepare_target(bool backup) noexcept {
+        auto endpoint = backup ? cache_.lookup(config_.backup_host, config_.backup_port)
+                               : cache_.lookup(config_.primary_host, config_.primary_port);
+        if (!endpoint) return std::unexpected{endpoint.error()};
+        auto fd = sockets_.take();
+        if (!fd) return std::unexpected{fd.error()};
+        return ConnectTarget{*fd, *endpoint, true};
+    }
+
+    ReconnectConfig config_;
+    EndpointCache cache_;
+    StandbySockets sockets_;
+    ChannelId channel_{IoUringReactor::INVALID_CHANNEL};
+    std::array<bool, 2> last_endpoints_{};   // Per ConnectTarget: is it the backup
+    bool on_backup_{false};
+    ReconnectStats stats_;
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+} // namespace nfx
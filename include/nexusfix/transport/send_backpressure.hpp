@@ -0,0 +1,211 @@
+/*
+    NexusFIX Send Backpressure
+
+    A counterparty that reads slowly closes its receive window; what we
+    send then waits in our socket's send queue and every new order queues
+    behind it. send() keeps succeeding, so nothing tells the session.
+
+    SendBackpressure watches the queue and turns it into a two-state signal
+    with hysteresis:
+
+        unsent > high_watermark   ->  Draining
+        unsent < low_watermark    ->  Clear
+
+    where unsent is SIOCOUTQNSD (bytes not yet on the wire) on Linux and
+    SIOCOUTQ (bytes not yet acknowledged) elsewhere; both are one ioctl.
+    TCP_NOTSENT_LOWAT caps how much unsent data the kernel takes and makes
+    POLLOUT / io_uring poll readiness mean "drained below notsent_lowat",
+    so a writer that waits for writability never parks a deep queue in
+    the kernel.
+
+    TcpTransport and IoUringTransport sample after each send (and on
+    poll_backpressure()); SessionManager picks the state up through the
+    handler's send_backpressure() and can hold non-urgent messages in its
+    throttle queue or let the app conflate quotes until it clears.
+
+    Usage:
+        transport.configure_backpressure({.enabled = true,
+                                          .high_watermark = 64 * 1024,
+                                          .low_watermark = 16 * 1024});
+        ...
+        if (transport.backpressure() == BackpressureState::Draining) conflate();
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#if NFX_PLATFORM_POSIX
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/ioctl.h>
+    #include <sys/socket.h>
+    #if NFX_PLATFORM_LINUX
+        #include <linux/sockios.h>
+    #endif
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// Whether the socket's send queue is draining
+enum class BackpressureState : uint8_t {
+    Clear,      // Sends go out as they are made
+    Draining    // Unsent bytes above high_watermark, until below low_watermark
+};
+
+struct BackpressureConfig {
+    bool enabled{false};
+    uint32_t high_watermark{64 * 1024};   // Unsent bytes that start Draining
+    uint32_t low_watermark{16 * 1024};    // Unsent bytes that end it
+
+    /// TCP_NOTSENT_LOWAT (Linux 3.12+, macOS); 0 = leave the kernel default
+    uint32_t notsent_lowat{0};
+
+    /// Sample every Nth send while Clear (1 = every send); Draining samples every send
+    uint32_t sample_every{1};
+};
+
+/// Send queue of a connected socket
+struct SendQueueDepth {
+    uint32_t queued{0};    // SIOCOUTQ: not yet acknowledged (sent or not)
+    uint32_t unsent{0};    // SIOCOUTQNSD: not yet sent (= queued where unavailable)
+};
+
+// ============================================================================
+// Socket Queries
+// ============================================================================
+
+/// Read the send queue depth of fd
+/// @return false if the platform or socket cannot report it
+[[nodiscard]] inline bool read_send_queue(SocketHandle fd, SendQueueDepth& out) noexcept {
+#if NFX_PLATFORM_LINUX
+    int queued = 0;
+    if (::ioctl(fd, SIOCOUTQ, &queued) != 0) return false;
+    out.queued = static_cast<uint32_t>(std::max(queued, 0));
+    #if defined(SIOCOUTQNSD)
+    int unsent = 0;
+    out.unsent = ::ioctl(fd, SIOCOUTQNSD, &unsent) == 0
+        ? static_cast<uint32_t>(std::max(unsent, 0)) : out.queued;
+    #else
+    out.unsent = out.queued;
+    #endif
+    return true;
+#elif NFX_PLATFORM_MACOS
+    int queued = 0;
+    socklen_t len = sizeof(queued);
+    if (::getsockopt(fd, SOL_SOCKET, SO_NWRITE, &queued, &len) != 0) return false;
+    out.queued = out.unsent = static_cast<uint32_t>(std::max(queued, 0));
+    return true;
+#else
+    (void)fd;
+    (void)out;
+    return false;
+#endif
+}
+
+/// Set TCP_NOTSENT_LOWAT on fd
+/// @return false where the option is not supported
+inline bool set_notsent_lowat(SocketHandle fd, uint32_t bytes) noexcept {
+#if defined(TCP_NOTSENT_LOWAT)
+    const int value = static_cast<int>(std::min<uint32_t>(bytes, INT32_MAX));
+    return ::setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &value, sizeof(value)) == 0;
+#else
+    (void)fd;
+    (void)bytes;
+    return false;
+#endif
+}
+
+// ============================================================================
+// Backpressure Monitor
+// ============================================================================
+
+struct BackpressureStats {
+    uint64_t samples{0};          // Send queue reads
+    uint64_t episodes{0};         // Clear -> Draining transitions
+    uint32_t peak_unsent{0};
+};
+
+/// Send queue watcher with high/low watermark hysteresis
+class SendBackpressure {
+public:
+    SendBackpressure() noexcept = default;
+    explicit SendBackpressure(const BackpressureConfig& config) noexcept { configure(config); }
+
+    void configure(const BackpressureConfig& config) noexcept {
+        config_ = config;
+        config_.low_watermark = std::min(config_.low_watermark, config_.high_watermark);
+        config_.sample_every = std::max<uint32_t>(config_.sample_every, 1);
+        reset();
+    }
+
+    /// Apply socket options to a newly connected fd (TCP_NOTSENT_LOWAT)
+    void on_connected(SocketHandle fd) noexcept {
+        reset();
+        if (config_.enabled && config_.notsent_lowat > 0) {
+            (void)set_notsent_lowat(fd, config_.notsent_lowat);
+        }
+    }
+
+    /// After a send: sample unless Clear and within sample_every
+    /// @return Current state
+    BackpressureState on_send(SocketHandle fd) noexcept {
+        if (!config_.enabled) return state_;
+        if (state_ == BackpressureState::Clear && ++sends_ < config_.sample_every) return state_;
+        sends_ = 0;
+        return sample(fd);
+    }
+
+    /// Read the send queue and update the state
+    BackpressureState sample(SocketHandle fd) noexcept {
+        if (!config_.enabled) return state_;
+        SendQueueDepth depth;
+        if (!read_send_queue(fd, depth)) return state_;
+        ++stats_.samples;
+        depth_ = depth;
+        stats_.peak_unsent = std::max(stats_.peak_unsent, depth.unsent);
+
+        if (state_ == BackpressureState::Clear) {
+            if (depth.unsent > config_.high_watermark) {
+                state_ = BackpressureState::Draining;
+                ++stats_.episodes;
+            }
+        } else if (depth.unsent < config_.low_watermark) {
+            state_ = BackpressureState::Clear;
+        }
+        return state_;
+    }
+
+    /// Back to Clear (new connection)
+    void reset() noexcept {
+        state_ = BackpressureState::Clear;
+        depth_ = {};
+        sends_ = 0;
+    }
+
+    [[nodiscard]] BackpressureState state() const noexcept { return state_; }
+    [[nodiscard]] bool draining() const noexcept { return state_ == BackpressureState::Draining; }
+
+    /// Send queue at the last sample
+    [[nodiscard]] SendQueueDepth depth() const noexcept { return depth_; }
+
+    [[nodiscard]] const BackpressureStats& stats() const noexcept { return stats_; }
+    [[nodiscard]] const BackpressureConfig& config() const noexcept { return config_; }
+
+private:
+    BackpressureConfig config_{};
+    BackpressureState state_{BackpressureState::Clear};
+    SendQueueDepth depth_{};
+    uint32_t sends_{0};
+    BackpressureStats stats_{};
+};
+
+} // namespace nfx
@@ -0,0 +1,537 @@
+/*
+    NexusFIX Shared-Memory Transport
+
+    ITransport between two processes on one host over a pair of SPSC byte
+    rings in one mmap'd file (under /dev/shm for a RAM-backed segment):
+
+        [ header | A->B indices | B->A indices | A->B bytes | B->A bytes ]
+
+    The gateway creates the segment with listen(path) and the strategy
+    process maps it with connect(path, 0); each side writes one ring and
+    reads the other. A send is a memcpy plus a release store of the write
+    index, a receive a memcpy plus a release store of the read index.
+    Indices sit on their own cache lines and each side caches the other's,
+    as in SPSCQueue, so neither enters the kernel while the reader spins.
+
+    Wake-up: a reader that found nothing for spin_us announces sleep on a
+    futex word in the segment and parks (a process-shared futex, not
+    FUTEX_PRIVATE). A writer checks that word after each publish and only
+    then makes the FUTEX_WAKE syscall, as QueueNotifier does within one
+    process. A writer facing a full ring spins until the reader frees
+    room, up to the send timeout.
+
+    The bytes are a stream, as over TCP: SessionManager frames messages
+    from receive() unchanged. disconnect() marks the side closed and wakes
+    the peer, which drains what is left and then gets ConnectionClosed. A
+    crashed peer is not detected here; FIX heartbeats cover that.
+
+    Linux only. One connection per segment: listen() again to reuse a path.
+
+    Usage:
+        // Gateway process
+        ShmTransport gateway;
+        gateway.listen("/dev/shm/nfx-strat1");
+
+        // Strategy process
+        ShmTransport strategy;
+        strategy.connect("/dev/shm/nfx-strat1", 0);   // port unused
+        strategy.send(logon_bytes);
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/memory/buffer_pool.hpp"  // CACHE_LINE_SIZE
+#include "nexusfix/memory/wait_strategy.hpp"
+
+#if NFX_PLATFORM_LINUX
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+struct ShmTransportConfig {
+    /// Bytes per direction (rounded up to a power of two); set by listen(),
+    /// read from the segment by connect()
+    size_t ring_bytes{1 << 20};
+
+    /// Receive spins this long before parking on the futex (0 = park at once)
+    uint32_t spin_us{50};
+
+    /// listen() side removes the file on disconnect()
+    bool unlink_on_close{true};
+};
+
+namespace detail {
+
+// ============================================================================
+// Segment Layout
+// ============================================================================
+
+/// Indices of one direction, each on its own cache line
+struct ShmRingIndices {
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;          // Bytes written (writer)
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;          // Bytes read (reader)
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> reader_state;  // Futex word
+};
+
+/// Start of the mapped file; ring bytes follow it
+struct ShmSegmentHeader {
+    static constexpr uint64_t MAGIC = 0x3130'4D48'5358'464EULL;  // "NFXSHM01"
+    static constexpr uint32_t VERSION = 1;
+
+    // flags
+    static constexpr uint32_t LISTENER_OPEN = 1u << 0;
+    static constexpr uint32_t CLIENT_OPEN = 1u << 1;
+    static constexpr uint32_t LISTENER_CLOSED = 1u << 2;
+    static constexpr uint32_t CLIENT_CLOSED = 1u << 3;
+
+    std::atomic<uint64_t> magic;  // Stored last by listen()
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t ring_bytes;
+    std::atomic<uint32_t> flags;
+    ShmRingIndices rings[2];      // [0] client -> listener, [1] listener -> client
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<uint32_t>::is_always_lock_free,
+              "Shared-memory indices must be lock-free (address-free)");
+
+// ============================================================================
+// Byte Ring (one side's view)
+// ============================================================================
+
+/// SPSC byte ring in shared memory; the writer and the reader each keep
+/// the other's index cached
+class ShmByteRing {
+public:
+    static constexpr uint32_t AWAKE = 0;
+    static constexpr uint32_t SLEEPING = 1;
+
+    ShmByteRing() noexcept = default;
+    ShmByteRing(ShmRingIndices* indices, char* data, size_t capacity) noexcept
+        : indices_{indices}, data_{data}, mask_{capacity - 1} {}
+
+    // ------------------------------------------------------------------------
+    // Writer
+    // ------------------------------------------------------------------------
+
+    /// Copy in as much of bytes as fits and publish it
+    /// @return Bytes written (0 if the ring is full)
+    [[nodiscard]] size_t write(std::span<const char> bytes) noexcept {
+        const uint64_t head = indices_->head.load(std::memory_order_relaxed);
+        size_t room = capacity() - static_cast<size_t>(head - cached_tail_);
+        if (room < bytes.size()) {
+            cached_tail_ = indices_->tail.load(std::memory_order_acquire);
+            room = capacity() - static_cast<size_t>(head - cached_tail_);
+        }
+        const size_t n = std::min(room, bytes.size());
+        if (n == 0) return 0;
+
+        copy_in(head, bytes.data(), n);
+        indices_->head.store(head + n, std::memory_order_release);
+        wake_reader();
+        return n;
+    }
+
+    /// Wake a parked reader (after a publish, or to report a close)
+    void wake_reader() noexcept {
+        // Pairs with the fence in prepare_sleep(): either we see SLEEPING,
+        // or the reader's re-check sees our bytes
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto& state = indices_->reader_state;
+        if (state.load(std::memory_order_relaxed) != SLEEPING) return;
+        if (state.exchange(AWAKE, std::memory_order_acq_rel) != SLEEPING) return;
+        memory::detail::futex_wake(state_word(), true);
+    }
+
+    // ------------------------------------------------------------------------
+    // Reader
+    // ------------------------------------------------------------------------
+
+    /// Copy out up to out.size() bytes
+    /// @return Bytes read (0 if the ring is empty)
+    [[nodiscard]] size_t read(std::span<char> out) noexcept {
+        const uint64_t tail = indices_->tail.load(std::memory_order_relaxed);
+        if (cached_head_ == tail) {
+            cached_head_ = indices_->head.load(std::memory_order_acquire);
+        }
+        const size_t n = std::min(static_cast<size_t>(cached_head_ - tail), out.size());
+        if (n == 0) return 0;
+
+        copy_out(tail, out.data(), n);
+        indices_->tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /// True if the writer has published unread bytes
+    [[nodiscard]] bool readable() noexcept {
+        const uint64_t tail = indices_->tail.load(std::memory_order_relaxed);
+        if (cached_head_ != tail) return true;
+        cached_head_ = indices_->head.load(std::memory_order_acquire);
+        return cached_head_ != tail;
+    }
+
+    /// Announce sleep; re-check readable() before parking
+    void prepare_sleep() noexcept {
+        indices_->reader_state.store(SLEEPING, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /// Park until woken, at most timeout_us; ends the announcement
+    void sleep(uint32_t timeout_us) noexcept {
+        memory::detail::futex_park(state_word(), SLEEPING, timeout_us, true);
+        indices_->reader_state.store(AWAKE, std::memory_order_relaxed);
+    }
+
+    void cancel_sleep() noexcept {
+        indices_->reader_state.store(AWAKE, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+private:
+    void copy_in(uint64_t position, const char* src, size_t n) noexcept {
+        const size_t at = static_cast<size_t>(position) & mask_;
+        const size_t first = std::min(n, capacity() - at);
+        std::memcpy(data_ + at, src, first);
+        std::memcpy(data_, src + first, n - first);
+    }
+
+    void copy_out(uint64_t position, char* dst, size_t n) const noexcept {
+        const size_t at = static_cast<size_t>(position) & mask_;
+        const size_t first = std::min(n, capacity() - at);
+        std::memcpy(dst, data_ + at, first);
+        std::memcpy(dst + first, data_, n - first);
+    }
+
+    [[nodiscard]] uint32_t* state_word() noexcept {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+        return reinterpret_cast<uint32_t*>(&indices_->reader_state);
+    }
+
+    ShmRingIndices* indices_{nullptr};
+    char* data_{nullptr};
+    size_t mask_{0};
+    uint64_t cached_tail_{0};  // Writer's copy of tail
+    uint64_t cached_head_{0};  // Reader's copy of head
+};
+
+} // namespace detail
+
+// ============================================================================
+// Shared-Memory Transport
+// ============================================================================
+
+/// ITransport over a shared-memory ring pair (see file comment)
+class ShmTransport final : public ITransport {
+public:
+    explicit ShmTransport(const ShmTransportConfig& config = {}) noexcept
+        : config_{config} {}
+
+    ~ShmTransport() override { disconnect(); }
+
+    ShmTransport(const ShmTransport&) = delete;
+    ShmTransport& operator=(const ShmTransport&) = delete;
+
+    /// Create the segment at path (replacing any old one) and take the
+    /// listener side; the peer connect()s to the same path
+    [[nodiscard]] TransportResult<void> listen(std::string_view path) noexcept {
+        disconnect();
+        const size_t ring_bytes = std::bit_ceil(std::max<size_t>(config_.ring_bytes, 4096));
+        const size_t size = sizeof(detail::ShmSegmentHeader) + 2 * ring_bytes;
+
+        if (!assign_path(path)) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, ENAMETOOLONG}};
+        }
+        const int fd = ::open(path_, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, err}};
+        }
+        if (auto mapped = map(fd, size); !mapped) return mapped;
+
+        // ftruncate zero-filled the file: construct the header in place
+        auto* header = new (base_) detail::ShmSegmentHeader{};
+        header->version = detail::ShmSegmentHeader::VERSION;
+        header->ring_bytes = ring_bytes;
+        header->flags.store(detail::ShmSegmentHeader::LISTENER_OPEN, std::memory_order_relaxed);
+        header->magic.store(detail::ShmSegmentHeader::MAGIC, std::memory_order_release);
+
+        listener_ = true;
+        attach_rings(ring_bytes);
+        return {};
+    }
+
+    /// Map the segment a listener created at host (a path); port is unused
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t /*port*/) override
+    {
+        disconnect();
+        if (!assign_path(host)) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, ENAMETOOLONG}};
+        }
+        const int fd = ::open(path_, O_RDWR | O_CLOEXEC);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, errno}};
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 ||
+            static_cast<size_t>(st.st_size) < sizeof(detail::ShmSegmentHeader)) {
+            ::close(fd);
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, EINVAL}};
+        }
+        if (auto mapped = map(fd, static_cast<size_t>(st.st_size)); !mapped) return mapped;
+
+        auto* header = segment();
+        const bool valid =
+            header->magic.load(std::memory_order_acquire) == detail::ShmSegmentHeader::MAGIC &&
+            header->version == detail::ShmSegmentHeader::VERSION &&
+            std::has_single_bit(header->ring_bytes) &&
+            sizeof(detail::ShmSegmentHeader) + 2 * header->ring_bytes == size_;
+        if (!valid) {
+            unmap();
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, EINVAL}};
+        }
+
+        // Only a live listener without a client accepts
+        uint32_t flags = header->flags.load(std::memory_order_acquire);
+        do {
+            if (flags != detail::ShmSegmentHeader::LISTENER_OPEN) {
+                unmap();
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, EBUSY}};
+            }
+        } while (!header->flags.compare_exchange_weak(
+            flags, flags | detail::ShmSegmentHeader::CLIENT_OPEN, std::memory_order_acq_rel));
+
+        listener_ = false;
+        attach_rings(static_cast<size_t>(header->ring_bytes));
+        return {};
+    }
+
+    /// Mark this side closed, wake the peer and unmap
+    void disconnect() noexcept override {
+        if (!base_) return;
+        segment()->flags.fetch_or(listener_ ? detail::ShmSegmentHeader::LISTENER_CLOSED
+                                            : detail::ShmSegmentHeader::CLIENT_CLOSED,
+                                  std::memory_order_acq_rel);
+        tx_.wake_reader();
+        unmap();
+        if (listener_ && config_.unlink_on_close) {
+            ::unlink(path_);
+        }
+    }
+
+    /// Mapped and neither side has closed
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return base_ && (segment()->flags.load(std::memory_order_acquire) &
+                         (detail::ShmSegmentHeader::LISTENER_CLOSED |
+                          detail::ShmSegmentHeader::CLIENT_CLOSED)) == 0;
+    }
+
+    /// True once the client side has mapped the segment
+    [[nodiscard]] bool peer_attached() const noexcept {
+        return base_ && (segment()->flags.load(std::memory_order_acquire) &
+                         detail::ShmSegmentHeader::CLIENT_OPEN) != 0;
+    }
+
+    /// Copy everything into the ring, spinning while it is full
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        size_t sent = tx_.write(data);
+        if (sent == data.size()) [[likely]] return sent;
+
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(send_timeout_ms_);
+        for (uint32_t spins = 0; sent < data.size(); ++spins) {
+            const size_t n = tx_.write(data.subspan(sent));
+            sent += n;
+            if (n != 0) continue;
+            if (!is_connected()) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            if ((spins & 1023) == 1023) {
+                if (send_timeout_ms_ >= 0 && Clock::now() >= deadline) {
+                    return std::unexpected{TransportError{TransportErrorCode::Timeout}};
+                }
+                std::this_thread::yield();
+            } else {
+                memory::BusySpinWait::wait();
+            }
+        }
+        return sent;
+    }
+
+    /// Wait for bytes: spin for spin_us, then park on the futex
+    /// @return Bytes copied, 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!base_) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        if (size_t n = rx_.read(buffer); n != 0) [[likely]] return n;
+
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const auto spin_until = start + std::chrono::microseconds(config_.spin_us);
+        const auto deadline = start + std::chrono::milliseconds(recv_timeout_ms_);
+
+        for (uint32_t spins = 0;; ++spins) {
+            if (size_t n = rx_.read(buffer); n != 0) return n;
+            if (!is_connected()) {
+                // Peer closed: its last bytes were published before the flag
+                if (size_t n = rx_.read(buffer); n != 0) return n;
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            if ((spins & 255) != 255) {
+                memory::BusySpinWait::wait();
+                continue;
+            }
+
+            const auto now = Clock::now();
+            if (recv_timeout_ms_ >= 0 && now >= deadline) return 0;
+            if (now < spin_until) continue;
+
+            // Park: announce, re-check, then sleep in bounded slices
+            rx_.prepare_sleep();
+            if (rx_.readable() || !is_connected()) {
+                rx_.cancel_sleep();
+                continue;
+            }
+            uint32_t slice_us = MAX_PARK_US;
+            if (recv_timeout_ms_ >= 0) {
+                const auto left = std::chrono::duration_cast<std::chrono::microseconds>(
+                    deadline - now).count();
+                slice_us = static_cast<uint32_t>(std::clamp<int64_t>(left, 1, MAX_PARK_US));
+            }
+            rx_.sleep(slice_us);
+        }
+    }
+
+    /// Copy out whatever is available without waiting
+    /// @return Bytes copied, 0 if the ring is empty
+    [[nodiscard]] TransportResult<size_t> try_receive(std::span<char> buffer) noexcept {
+        if (!base_) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        if (size_t n = rx_.read(buffer); n != 0) return n;
+        if (!is_connected()) {
+            if (size_t n = rx_.read(buffer); n != 0) return n;
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        return 0;
+    }
+
+    [[nodiscard]] bool set_nodelay(bool /*enable*/) noexcept override {
+        return true;  // Every send is visible at once
+    }
+
+    [[nodiscard]] bool set_keepalive(bool /*enable*/) noexcept override {
+        return true;
+    }
+
+    /// Bounds receive(); -1 waits forever
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        recv_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    /// Bounds how long send() waits for room in a full ring; -1 waits forever
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        send_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    [[nodiscard]] bool is_listener() const noexcept { return listener_; }
+    [[nodiscard]] std::string_view path() const noexcept { return path_; }
+
+    /// Bytes per direction (0 when not mapped)
+    [[nodiscard]] size_t ring_bytes() const noexcept {
+        return base_ ? tx_.capacity() : 0;
+    }
+
+private:
+    static constexpr int64_t MAX_PARK_US = 100'000;  // Bound one futex sleep
+
+    [[nodiscard]] bool assign_path(std::string_view path) noexcept {
+        if (path.empty() || path.size() >= sizeof(path_)) return false;
+        std::memcpy(path_, path.data(), path.size());
+        path_[path.size()] = '\0';
+        return true;
+    }
+
+    /// mmap the whole file; fd is closed either way
+    [[nodiscard]] TransportResult<void> map(int fd, size_t size) noexcept {
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int err = errno;
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, err}};
+        }
+        base_ = static_cast<char*>(ptr);
+        size_ = size;
+        return {};
+    }
+
+    void unmap() noexcept {
+        if (base_) ::munmap(base_, size_);
+        base_ = nullptr;
+        size_ = 0;
+        tx_ = {};
+        rx_ = {};
+    }
+
+    void attach_rings(size_t ring_bytes) noexcept {
+        auto* header = segment();
+        char* data = base_ + sizeof(detail::ShmSegmentHeader);
+        detail::ShmByteRing to_listener{&header->rings[0], data, ring_bytes};
+        detail::ShmByteRing to_client{&header->rings[1], data + ring_bytes, ring_bytes};
+        tx_ = listener_ ? to_client : to_listener;
+        rx_ = listener_ ? to_listener : to_client;
+    }
+
+    [[nodiscard]] detail::ShmSegmentHeader* segment() const noexcept {
+        return reinterpret_cast<detail::ShmSegmentHeader*>(base_);
+    }
+
+    ShmTransportConfig config_;
+    char path_[256]{};
+    char* base_{nullptr};
+    size_t size_{0};
+    bool listener_{false};
+    detail::ShmByteRing tx_;
+    detail::ShmByteRing rx_;
+    int recv_timeout_ms_{30000};
+    int send_timeout_ms_{30000};
+};
+
+} // namespace nfx
+
+#endif  // NFX_PLATFORM_LINUX
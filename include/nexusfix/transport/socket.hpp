@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/util/allocation_tracker.hpp"
 
 namespace nfx {
 
@@ -72,6 +73,8 @@ struct SocketOptions {
     int send_timeout_ms{30000};       // Send timeout in ms
     int recv_buffer_size{65536};      // SO_RCVBUF
     int send_buffer_size{65536};      // SO_SNDBUF
+    int busy_poll_us{0};              // SO_BUSY_POLL, 0 = off (Linux)
+    bool prefer_busy_poll{false};     // SO_PREFER_BUSY_POLL (Linux 5.11+)
 
     constexpr SocketOptions() noexcept = default;
 };
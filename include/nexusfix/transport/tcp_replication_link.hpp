@@ -0,0 +1,79 @@
+#pragma once
+
+/// @file tcp_replication_link.hpp
+/// @brief Cross-host replication link over a non-blocking TCP socket
+///
+/// Frames written by the publisher (or acks by the standby) are queued in
+/// a bounded buffer and sent by flush(); a short send keeps the rest for
+/// the next flush(), so the session thread never blocks on the standby.
+/// See store/replication.hpp for the protocol.
+
+#include "nexusfix/store/replication.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// TCP Replication Link
+// ============================================================================
+
+class TcpReplicationLink final : public store::IReplicationLink {
+public:
+    /// @param socket Connected socket (connect() on one side, adopt() of an
+    ///        accepted fd on the other); switched to non-blocking
+    /// @param max_pending Bytes queued while the peer is not reading
+    explicit TcpReplicationLink(TcpSocket socket, size_t max_pending = 4 * 1024 * 1024)
+        : socket_{std::move(socket)}, max_pending_{max_pending}
+    {
+        socket_.set_nonblocking(true);
+        (void)socket_.set_nodelay(true);
+        pending_.reserve(max_pending_);
+    }
+
+    [[nodiscard]] bool write(std::span<const char> header,
+                             std::span<const char> payload) noexcept override {
+        if (pending_.size() + header.size() + payload.size() > max_pending_) {
+            return false;
+        }
+        pending_.insert(pending_.end(), header.begin(), header.end());
+        pending_.insert(pending_.end(), payload.begin(), payload.end());
+        return true;
+    }
+
+    bool flush() noexcept override {
+        while (sent_ < pending_.size()) {
+            auto n = socket_.send(std::span<const char>{pending_}.subspan(sent_));
+            if (!n) return false;
+            if (*n == 0) return true;      // Socket buffer full: rest next time
+            sent_ += *n;
+        }
+        pending_.clear();
+        sent_ = 0;
+        return true;
+    }
+
+    [[nodiscard]] size_t read(std::span<char> buffer) noexcept override {
+        if (buffer.empty()) return 0;
+        auto n = socket_.try_receive(buffer);
+        return n ? *n : 0;
+    }
+
+    [[nodiscard]] bool connected() const noexcept override { return socket_.is_connected(); }
+
+    /// Bytes queued, not yet accepted by the socket
+    [[nodiscard]] size_t pending() const noexcept { return pending_.size() - sent_; }
+
+    [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
+
+private:
+    TcpSocket socket_;
+    size_t max_pending_;
+    std::vector<char> pending_;
+    size_t sent_{0};               // Prefix of pending_ already sent
+};
+
+} // namespace nfx
@@ -10,10 +10,16 @@
 #include "nexusfix/platform/socket_types.hpp"
 #include "nexusfix/platform/error_mapping.hpp"
 #include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/endpoint_cache.hpp"
+#include "nexusfix/transport/send_backpressure.hpp"
+#include "nexusfix/transport/timestamping.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
 
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
+#include <chrono>
+#include <utility>
 
 // Platform-specific headers
 #if NFX_PLATFORM_POSIX
@@ -25,6 +31,23 @@
 
 namespace nfx {
 
+namespace detail {
+
+/// Wait strategies with per-wait state (BackoffWait, AdaptiveWait)
+template <typename Wait>
+concept StatefulWait = requires(typename Wait::State& state) {
+    { Wait::wait(state) } noexcept;
+    { Wait::reset(state) } noexcept;
+};
+
+template <typename Wait>
+struct WaitStateOf { struct type {}; };
+
+template <StatefulWait Wait>
+struct WaitStateOf<Wait> { using type = typename Wait::State; };
+
+} // namespace detail
+
 // ============================================================================
 // TCP Socket (Cross-platform)
 // ============================================================================
@@ -49,6 +72,10 @@ public:
         : fd_{other.fd_}
         , state_{other.state_}
         , options_{other.options_}
+        , timestamping_{other.timestamping_}
+        , tx_bytes_{other.tx_bytes_}
+        , last_tx_id_{other.last_tx_id_}
+        , last_rx_timestamp_{other.last_rx_timestamp_}
     {
         other.fd_ = INVALID_SOCKET_HANDLE;
         other.state_ = ConnectionState::Disconnected;
@@ -60,6 +87,10 @@ public:
             fd_ = other.fd_;
             state_ = other.state_;
             options_ = other.options_;
+            timestamping_ = other.timestamping_;
+            tx_bytes_ = other.tx_bytes_;
+            last_tx_id_ = other.last_tx_id_;
+            last_rx_timestamp_ = other.last_rx_timestamp_;
             other.fd_ = INVALID_SOCKET_HANDLE;
             other.state_ = ConnectionState::Disconnected;
         }
@@ -128,6 +159,29 @@ public:
         return {};
     }
 
+#if NFX_PLATFORM_POSIX
+    /// Connect to an already resolved address (see EndpointCache)
+    [[nodiscard]] TransportResult<void> connect(const ResolvedEndpoint& endpoint) noexcept {
+        if (!endpoint.valid()) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        if (!is_valid_socket(fd_)) {
+            auto result = create();
+            if (!result) return result;
+        }
+
+        state_ = ConnectionState::Connecting;
+        if (::connect(fd_, endpoint.sockaddr_ptr(), endpoint.addrlen) != 0) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_socket_error()};
+        }
+
+        apply_options();
+        state_ = ConnectionState::Connected;
+        return {};
+    }
+#endif
+
     /// Close socket
     void close() noexcept {
         if (is_valid_socket(fd_)) {
@@ -138,6 +192,14 @@ public:
         }
     }
 
+    /// Take ownership of a connected socket (e.g. from TcpAcceptor::accept())
+    void adopt(SocketHandle fd) noexcept {
+        close();
+        fd_ = fd;
+        apply_options();
+        state_ = ConnectionState::Connected;
+    }
+
     /// Check if connected
     [[nodiscard]] bool is_connected() const noexcept {
         return state_ == ConnectionState::Connected && is_valid_socket(fd_);
@@ -145,6 +207,7 @@ public:
 
     /// Send data
     [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept {
+        NFX_NO_ALLOC_REGION("TcpSocket::send");
         if (!is_connected()) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
@@ -159,6 +222,10 @@ public:
             return std::unexpected{make_socket_error(err)};
         }
 
+        if (sent > 0 && timestamping_.tx && timestamping_.mode != TimestampingMode::Off) {
+            tx_bytes_ += static_cast<uint32_t>(sent);
+            last_tx_id_ = tx_bytes_ - 1;
+        }
         return static_cast<size_t>(sent);
     }
 
@@ -168,7 +235,7 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
 
-        IoSize received = ::recv(fd_, buffer.data(), static_cast<IoSize>(buffer.size()), 0);
+        IoSize received = recv_some(buffer, 0);
         if (received < 0) {
             int err = get_last_socket_error();
             if (is_would_block_error(err)) {
@@ -186,7 +253,64 @@ public:
         return static_cast<size_t>(received);
     }
 
-    /// Poll for read events
+    /// Receive without blocking, regardless of the socket's blocking mode
+    /// @return Bytes received, 0 if nothing is queued
+    [[nodiscard]] TransportResult<size_t> try_receive(std::span<char> buffer) noexcept {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+#if NFX_PLATFORM_POSIX
+        IoSize received = recv_some(buffer, MSG_DONTWAIT);
+#else
+        // No MSG_DONTWAIT on Winsock: only read what poll reports
+        if (!poll_read(0)) return 0;
+        IoSize received = recv_some(buffer, 0);
+#endif
+        if (received < 0) {
+            int err = get_last_socket_error();
+            if (is_would_block_error(err) || err == EINTR) {
+                return 0;
+            }
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_socket_error(err)};
+        }
+
+        if (received == 0) {
+            state_ = ConnectionState::Disconnected;
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        return static_cast<size_t>(received);
+    }
+
+    /// Spin on try_receive() until data arrives or the receive timeout expires
+    /// @tparam Wait Wait strategy between empty reads (memory/wait_strategy.hpp)
+    /// @return Bytes received, 0 on timeout
+    template <memory::WaitStrategy Wait>
+    [[nodiscard]] TransportResult<size_t> receive_polling(std::span<char> buffer) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const bool bounded = options_.recv_timeout_ms > 0;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(options_.recv_timeout_ms);
+
+        [[maybe_unused]] typename detail::WaitStateOf<Wait>::type state{};
+        for (;;) {
+            auto result = try_receive(buffer);
+            if (!result || *result > 0) {
+                if constexpr (detail::StatefulWait<Wait>) {
+                    Wait::reset(state);
+                }
+                return result;
+            }
+            if (bounded && Clock::now() >= deadline) return 0;
+            if constexpr (detail::StatefulWait<Wait>) {
+                Wait::wait(state);
+            } else {
+                Wait::wait();
+            }
+        }
+    }
+
     [[nodiscard]] bool poll_read(int timeout_ms) noexcept {
         if (!is_valid_socket(fd_)) return false;
 
@@ -242,6 +366,47 @@ public:
         return true;
     }
 
+    /// Set SO_BUSY_POLL / SO_PREFER_BUSY_POLL (Linux)
+    /// @param microseconds Kernel busy-poll budget per read, 0 = off
+    [[nodiscard]] bool set_busy_poll(int microseconds, bool prefer) noexcept {
+        options_.busy_poll_us = microseconds;
+        options_.prefer_busy_poll = prefer;
+        if (is_valid_socket(fd_)) {
+            return set_socket_busy_poll(fd_, microseconds, prefer);
+        }
+        return true;
+    }
+
+    /// Configure SO_TIMESTAMPING (applied now if open, else on connect)
+    /// Enabling restarts TX keys: the next send's key counts from 0.
+    [[nodiscard]] bool set_timestamping(const TimestampingConfig& config) noexcept {
+        timestamping_ = config;
+        tx_bytes_ = 0;
+        last_tx_id_ = 0;
+        if (is_valid_socket(fd_)) {
+            return enable_socket_timestamping(fd_, config);
+        }
+        return true;
+    }
+
+    /// Kernel/NIC timestamp of the data returned by the last receive
+    /// Zero unless timestamping is on and the kernel attached one.
+    [[nodiscard]] WireTimestamp last_receive_timestamp() const noexcept {
+        return last_rx_timestamp_;
+    }
+
+    /// TX timestamp key of the last send (offset of its last byte);
+    /// matches TxTimestamp::id from poll_tx_timestamps()
+    [[nodiscard]] uint32_t last_tx_id() const noexcept { return last_tx_id_; }
+
+    /// Deliver TX timestamps queued on the error queue (non-blocking)
+    /// @return Timestamps delivered
+    template <typename Handler>
+    size_t poll_tx_timestamps(Handler&& on_timestamp) noexcept {
+        if (!is_valid_socket(fd_)) return 0;
+        return drain_tx_timestamps(fd_, std::forward<Handler>(on_timestamp));
+    }
+
     /// Set non-blocking mode
     void set_nonblocking(bool enable) noexcept {
         if (is_valid_socket(fd_)) {
@@ -290,11 +455,31 @@ private:
         (void)set_receive_timeout(options_.recv_timeout_ms);
         (void)set_send_timeout(options_.send_timeout_ms);
         set_buffer_sizes(options_.recv_buffer_size, options_.send_buffer_size);
+        if (options_.busy_poll_us > 0) {
+            (void)set_busy_poll(options_.busy_poll_us, options_.prefer_busy_poll);
+        }
+        if (timestamping_.mode != TimestampingMode::Off) {
+            (void)set_timestamping(timestamping_);
+        }
+    }
+
+    /// recv(), through recvmsg() when timestamping so the stamp is kept
+    [[nodiscard]] IoSize recv_some(std::span<char> buffer, int flags) noexcept {
+#if NFX_PLATFORM_LINUX
+        if (timestamping_.mode != TimestampingMode::Off) {
+            return recv_timestamped(fd_, buffer, flags, last_rx_timestamp_);
+        }
+#endif
+        return ::recv(fd_, buffer.data(), static_cast<IoSize>(buffer.size()), flags);
     }
 
     SocketHandle fd_;
     ConnectionState state_;
     SocketOptions options_;
+    TimestampingConfig timestamping_{};
+    uint32_t tx_bytes_{0};              // Bytes sent since timestamping was enabled
+    uint32_t last_tx_id_{0};
+    WireTimestamp last_rx_timestamp_{};
 };
 
 // ============================================================================
@@ -310,7 +495,9 @@ public:
         std::string_view host,
         uint16_t port) override
     {
-        return socket_.connect(host, port);
+        auto result = socket_.connect(host, port);
+        if (result) backpressure_.on_connected(socket_.fd());
+        return result;
     }
 
     void disconnect() noexcept override {
@@ -322,7 +509,9 @@ public:
     }
 
     [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
-        return socket_.send(data);
+        auto result = socket_.send(data);
+        if (result) backpressure_.on_send(socket_.fd());
+        return result;
     }
 
     [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
@@ -349,8 +538,53 @@ public:
     [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
     [[nodiscard]] const TcpSocket& socket() const noexcept { return socket_; }
 
-private:
+    // ========================================================================
+    // Send Backpressure (see send_backpressure.hpp)
+    // ========================================================================
+
+    /// Watch the send queue; TCP_NOTSENT_LOWAT is applied now if connected,
+    /// else on connect
+    void configure_backpressure(const BackpressureConfig& config) noexcept {
+        backpressure_.configure(config);
+        if (socket_.is_connected()) backpressure_.on_connected(socket_.fd());
+    }
+
+    /// State at the last sample (taken after sends)
+    [[nodiscard]] BackpressureState backpressure() const noexcept { return backpressure_.state(); }
+
+    /// Sample the send queue now (e.g. from the event loop while Draining)
+    BackpressureState poll_backpressure() noexcept {
+        return socket_.is_connected() ? backpressure_.sample(socket_.fd()) : backpressure_.state();
+    }
+
+    [[nodiscard]] const SendBackpressure& backpressure_monitor() const noexcept { return backpressure_; }
+
+protected:
     TcpSocket socket_;
+    SendBackpressure backpressure_;
+};
+
+// ============================================================================
+// Polling TCP Transport
+// ============================================================================
+
+/// TcpTransport whose receive() spins on non-blocking reads
+/// Latency-critical sessions use BusySpinWait with kernel busy polling;
+/// drop-copy sessions can use SleepingWait or BackoffWait to give the
+/// core back. The receive timeout still bounds each receive() call.
+/// @tparam Wait Wait strategy between empty reads
+template <memory::WaitStrategy Wait = memory::BusySpinWait>
+class PollingTcpTransport final : public TcpTransport {
+public:
+    /// @param busy_poll_us SO_BUSY_POLL budget, 0 = off
+    /// @param prefer_busy_poll Also set SO_PREFER_BUSY_POLL
+    explicit PollingTcpTransport(int busy_poll_us = 50, bool prefer_busy_poll = true) noexcept {
+        (void)socket_.set_busy_poll(busy_poll_us, prefer_busy_poll);
+    }
+
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        return socket_.receive_polling<Wait>(buffer);
+    }
 };
 
 // ============================================================================
@@ -370,10 +604,14 @@ public:
     TcpAcceptor(const TcpAcceptor&) = delete;
     TcpAcceptor& operator=(const TcpAcceptor&) = delete;
 
-    /// Bind and listen on port
+    /// Bind and listen on port (0 = ephemeral, see local_port())
+    /// @param dual_stack Listen on [::] with IPV6_V6ONLY off so IPv4 peers
+    ///        arrive as v4-mapped addresses; falls back to IPv4 when the
+    ///        host has no IPv6
     [[nodiscard]] TransportResult<void> listen(
         uint16_t port,
-        int backlog = 128) noexcept
+        int backlog = 128,
+        bool dual_stack = false) noexcept
     {
 #if NFX_PLATFORM_WINDOWS
         // Ensure Winsock is initialized before any socket operations
@@ -381,6 +619,10 @@ public:
             return std::unexpected{WinsockInit::make_init_error()};
         }
 #endif
+        if (dual_stack && bind_dual_stack(port)) {
+            return listen_bound(backlog);
+        }
+
         fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
         if (!is_valid_socket(fd_)) {
             return std::unexpected{make_socket_error()};
@@ -400,13 +642,21 @@ public:
             return std::unexpected{err};
         }
 
-        if (::listen(fd_, backlog) < 0) {
-            auto err = make_socket_error();
-            close();
-            return std::unexpected{err};
-        }
+        return listen_bound(backlog);
+    }
 
-        return {};
+    /// Port actually bound (resolves port 0); 0 when not listening
+    [[nodiscard]] uint16_t local_port() const noexcept {
+        if (!is_valid_socket(fd_)) return 0;
+        struct sockaddr_storage addr{};
+        SocketLength len = sizeof(addr);
+        if (::getsockname(fd_, reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) {
+            return 0;
+        }
+        if (addr.ss_family == AF_INET6) {
+            return ntohs(reinterpret_cast<const struct sockaddr_in6*>(&addr)->sin6_port);
+        }
+        return ntohs(reinterpret_cast<const struct sockaddr_in*>(&addr)->sin_port);
     }
 
     /// Accept a connection
@@ -415,7 +665,7 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
-        struct sockaddr_in client_addr{};
+        struct sockaddr_storage client_addr{};
         SocketLength addr_len = sizeof(client_addr);
 
         SocketHandle client_fd = ::accept(fd_,
@@ -446,6 +696,39 @@ public:
     [[nodiscard]] SocketHandle fd() const noexcept { return fd_; }
 
 private:
+    /// [::]:port with IPV6_V6ONLY cleared; false leaves fd_ closed
+    [[nodiscard]] bool bind_dual_stack(uint16_t port) noexcept {
+        fd_ = ::socket(AF_INET6, SOCK_STREAM, 0);
+        if (!is_valid_socket(fd_)) return false;
+
+        (void)set_socket_reuseaddr(fd_, true);
+        int v6only = 0;
+        if (::setsockopt(fd_, IPPROTO_IPV6, IPV6_V6ONLY,
+                         reinterpret_cast<const char*>(&v6only), sizeof(v6only)) < 0) {
+            close();
+            return false;
+        }
+
+        struct sockaddr_in6 addr{};
+        addr.sin6_family = AF_INET6;
+        addr.sin6_addr = in6addr_any;
+        addr.sin6_port = htons(port);
+        if (::bind(fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] TransportResult<void> listen_bound(int backlog) noexcept {
+        if (::listen(fd_, backlog) < 0) {
+            auto err = make_socket_error();
+            close();
+            return std::unexpected{err};
+        }
+        return {};
+    }
+
     SocketHandle fd_;
 };
 
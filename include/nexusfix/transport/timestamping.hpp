@@ -0,0 +1,270 @@
+/*
+    NexusFIX Socket Timestamping (SO_TIMESTAMPING)
+
+    Kernel and NIC timestamps for packets on a socket, to separate wire
+    latency from engine latency:
+
+    - RX: recvmsg() returns an SCM_TIMESTAMPING control message with the
+      software (driver entry) and raw hardware (NIC PHC) time of the
+      segment carrying the data.
+    - TX: with SOF_TIMESTAMPING_OPT_ID each send is keyed; the kernel
+      queues one timestamp per key on the socket's error queue when the
+      data is handed to the NIC (and optionally when the peer ACKs it).
+      drain_tx_timestamps() reads them with MSG_ERRQUEUE.
+
+    For TCP the key of a send is the stream offset of its last byte,
+    counted from when timestamping was enabled: a transport that counts
+    bytes written hands that key back from send() (see TcpSocket::
+    last_tx_id()).
+
+    Hardware stamps additionally need the NIC switched on
+    (enable_nic_hw_timestamping, or `hwstamp_ctl` / `ethtool`); without it
+    only the software fields are filled. Linux only: elsewhere every call
+    reports "not supported" and timestamps stay zero.
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/types/wire_timestamp.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#if NFX_PLATFORM_LINUX
+    #include <sys/socket.h>
+    #include <sys/ioctl.h>
+    #include <net/if.h>
+    #include <netinet/in.h>
+    #include <linux/errqueue.h>
+    #include <linux/net_tstamp.h>
+    #include <linux/sockios.h>
+    #include <cerrno>
+    #include <ctime>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// Which clock stamps packets
+enum class TimestampingMode : uint8_t {
+    Off,
+    Software,   // Kernel stamps at driver entry / exit
+    Hardware    // NIC PHC stamps, with software stamps alongside
+};
+
+/// SO_TIMESTAMPING configuration for a socket
+struct TimestampingConfig {
+    TimestampingMode mode{TimestampingMode::Off};
+    bool tx{true};          // Queue TX timestamps on the error queue
+    bool tx_ack{false};     // Also stamp when the peer ACKs the data (TCP)
+};
+
+/// Point in the TX path a timestamp was taken
+enum class TxTimestampKind : uint8_t {
+    Scheduled,  // Entered the qdisc (SCM_TSTAMP_SCHED)
+    Sent,       // Handed to / sent by the NIC (SCM_TSTAMP_SND)
+    Acked       // Acknowledged by the peer (SCM_TSTAMP_ACK)
+};
+
+/// TX timestamp for one keyed send
+struct TxTimestamp {
+    uint32_t id{0};                 // OPT_ID key (TCP: offset of last byte)
+    TxTimestampKind kind{TxTimestampKind::Sent};
+    WireTimestamp time{};
+};
+
+#if NFX_PLATFORM_LINUX
+
+// ============================================================================
+// Socket Setup
+// ============================================================================
+
+/// SOF_TIMESTAMPING_* flags for a configuration (0 when off)
+[[nodiscard]] inline uint32_t timestamping_flags(const TimestampingConfig& config) noexcept {
+    if (config.mode == TimestampingMode::Off) return 0;
+
+    uint32_t flags = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE;
+    if (config.mode == TimestampingMode::Hardware) {
+        flags |= SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_RX_HARDWARE;
+    }
+    if (config.tx) {
+        flags |= SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_OPT_ID |
+                 SOF_TIMESTAMPING_OPT_TSONLY;
+        if (config.mode == TimestampingMode::Hardware) flags |= SOF_TIMESTAMPING_TX_HARDWARE;
+        if (config.tx_ack) flags |= SOF_TIMESTAMPING_TX_ACK;
+#if defined(SOF_TIMESTAMPING_OPT_ID_TCP)
+        // Key from write_seq, so bytes still unacked at enable time count
+        flags |= SOF_TIMESTAMPING_OPT_ID_TCP;
+#endif
+    }
+    return flags;
+}
+
+/// Apply SO_TIMESTAMPING to a socket; restarts TX keys at 0
+/// @return false if the kernel rejected the flags
+[[nodiscard]] inline bool enable_socket_timestamping(
+    int fd, const TimestampingConfig& config) noexcept
+{
+    const int flags = static_cast<int>(timestamping_flags(config));
+    return ::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0;
+}
+
+/// Turn on NIC hardware timestamping of all RX packets and TX on request
+/// (SIOCSHWTSTAMP). Device-wide and needs CAP_NET_ADMIN.
+/// @param fd Any socket, used for the ioctl
+/// @param ifname Interface name, e.g. "eth0"
+[[nodiscard]] inline bool enable_nic_hw_timestamping(int fd, std::string_view ifname) noexcept {
+    struct hwtstamp_config hw{};
+    hw.tx_type = HWTSTAMP_TX_ON;
+    hw.rx_filter = HWTSTAMP_FILTER_ALL;
+
+    struct ifreq ifr{};
+    if (ifname.empty() || ifname.size() >= sizeof(ifr.ifr_name)) return false;
+    std::memcpy(ifr.ifr_name, ifname.data(), ifname.size());
+    ifr.ifr_data = reinterpret_cast<char*>(&hw);
+    return ::ioctl(fd, SIOCSHWTSTAMP, &ifr) == 0;
+}
+
+// ============================================================================
+// Control Messages
+// ============================================================================
+
+namespace detail {
+
+[[nodiscard]] inline int64_t timespec_to_ns(const struct timespec& ts) noexcept {
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+} // namespace detail
+
+/// recvmsg() state for reading one buffer plus its timestamp
+/// Owns the msghdr, iovec and control buffer so the same object can be
+/// handed to recvmsg() or to an io_uring IORING_OP_RECVMSG and parsed
+/// once the call completes.
+class TimestampedRecv {
+public:
+    /// Control space for SCM_TIMESTAMPING plus an extended error
+    static constexpr size_t CONTROL_SIZE = 256;
+
+    /// Point the message at buffer; call before every recvmsg
+    [[nodiscard]] struct msghdr* prepare(std::span<char> buffer) noexcept {
+        iov_.iov_base = buffer.data();
+        iov_.iov_len = buffer.size();
+        msg_ = {};
+        msg_.msg_iov = &iov_;
+        msg_.msg_iovlen = 1;
+        msg_.msg_control = control_;
+        msg_.msg_controllen = sizeof(control_);
+        return &msg_;
+    }
+
+    /// Timestamp carried by the last completed recvmsg (zero if none)
+    [[nodiscard]] WireTimestamp timestamp() const noexcept {
+        WireTimestamp ts{};
+        for (auto* cmsg = CMSG_FIRSTHDR(&msg_); cmsg; cmsg = CMSG_NXTHDR(
+                 const_cast<struct msghdr*>(&msg_), cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPING) {
+                struct scm_timestamping stamps;
+                std::memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+                ts.software_ns = detail::timespec_to_ns(stamps.ts[0]);
+                ts.hardware_ns = detail::timespec_to_ns(stamps.ts[2]);
+            }
+        }
+        return ts;
+    }
+
+    [[nodiscard]] struct msghdr* msg() noexcept { return &msg_; }
+
+private:
+    struct msghdr msg_{};
+    struct iovec iov_{};
+    alignas(struct cmsghdr) char control_[CONTROL_SIZE]{};
+};
+
+/// recv() that also reports the timestamp of the data
+/// @param flags recv flags (e.g. MSG_DONTWAIT)
+/// @param out Receives the timestamp; zero if none was attached
+/// @return recvmsg() result
+[[nodiscard]] inline ssize_t recv_timestamped(
+    int fd, std::span<char> buffer, int flags, WireTimestamp& out) noexcept
+{
+    TimestampedRecv recv;
+    const ssize_t n = ::recvmsg(fd, recv.prepare(buffer), flags);
+    out = n > 0 ? recv.timestamp() : WireTimestamp{};
+    return n;
+}
+
+/// Read every queued TX timestamp from the socket's error queue
+/// @param on_timestamp Called with each TxTimestamp
+/// @return Timestamps delivered
+template <typename Handler>
+size_t drain_tx_timestamps(int fd, Handler&& on_timestamp) noexcept {
+    size_t delivered = 0;
+    TimestampedRecv recv;
+    char payload[64];  // OPT_TSONLY: no payload is looped back
+
+    for (;;) {
+        if (::recvmsg(fd, recv.prepare(payload), MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+            if (errno == EINTR) continue;
+            break;  // EAGAIN: queue empty
+        }
+
+        TxTimestamp tx{};
+        bool keyed = false;
+        struct msghdr* msg = recv.msg();
+        for (auto* cmsg = CMSG_FIRSTHDR(msg); cmsg; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+            const bool ip_err = (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                                (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+            if (!ip_err) continue;
+
+            struct sock_extended_err err;
+            std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+            if (err.ee_errno != ENOMSG || err.ee_origin != SO_EE_ORIGIN_TIMESTAMPING) continue;
+
+            tx.id = err.ee_data;
+            tx.kind = err.ee_info == SCM_TSTAMP_SCHED ? TxTimestampKind::Scheduled
+                    : err.ee_info == SCM_TSTAMP_ACK   ? TxTimestampKind::Acked
+                                                      : TxTimestampKind::Sent;
+            keyed = true;
+        }
+        if (!keyed) continue;
+
+        tx.time = recv.timestamp();
+        on_timestamp(tx);
+        ++delivered;
+    }
+    return delivered;
+}
+
+#else  // !NFX_PLATFORM_LINUX
+
+[[nodiscard]] inline uint32_t timestamping_flags(const TimestampingConfig&) noexcept {
+    return 0;
+}
+
+[[nodiscard]] inline bool enable_socket_timestamping(
+    SocketHandle, const TimestampingConfig& config) noexcept
+{
+    return config.mode == TimestampingMode::Off;
+}
+
+[[nodiscard]] inline bool enable_nic_hw_timestamping(SocketHandle, std::string_view) noexcept {
+    return false;
+}
+
+template <typename Handler>
+size_t drain_tx_timestamps(SocketHandle, Handler&&) noexcept {
+    return 0;
+}
+
+#endif  // NFX_PLATFORM_LINUX
+
+} // namespace nfx
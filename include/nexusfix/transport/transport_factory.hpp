@@ -6,8 +6,8 @@
 /// Provides a unified interface for creating transports that automatically
 /// selects the best implementation for the current platform:
 /// - Linux: TcpTransport (POSIX) or IoUringTransport (if available)
-/// - Windows: WinsockTransport or IocpTransport (future)
-/// - macOS: TcpTransport (POSIX) or KqueueTransport (future)
+/// - Windows: WinsockTransport or IocpTransport (IOCP + Registered I/O)
+/// - macOS: TcpTransport (POSIX) or KqueueTransport
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/transport/socket.hpp"
@@ -24,6 +24,15 @@
 // Include async transport if available
 #if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
     #include "nexusfix/transport/io_uring_transport.hpp"
+    #include "nexusfix/transport/io_uring_reactor.hpp"
+#endif
+
+#if NFX_PLATFORM_WINDOWS && NFX_ASYNC_IO_IOCP
+    #include "nexusfix/transport/iocp_transport.hpp"
+#endif
+
+#if NFX_PLATFORM_MACOS && NFX_ASYNC_IO_KQUEUE
+    #include "nexusfix/transport/kqueue_transport.hpp"
 #endif
 
 namespace nfx {
@@ -47,8 +56,8 @@ enum class TransportPreference : uint8_t {
     TcpPosix,       // POSIX TCP (Linux/macOS)
     IoUring,        // Linux io_uring
     Winsock,        // Windows Winsock2
-    Iocp,           // Windows IOCP (future)
-    Kqueue          // macOS kqueue (future)
+    Iocp,           // Windows IOCP / Registered I/O
+    Kqueue          // macOS kqueue
 };
 
 // ============================================================================
@@ -120,11 +129,13 @@ public:
     }
 
     /// Create io_uring transport (Linux only)
+    /// Transports created on one thread share that thread's ring (rings are
+    /// SINGLE_ISSUER); use IoUringReactor to multiplex many sessions on one.
     /// Returns simple transport on other platforms or if io_uring unavailable
     [[nodiscard]] static std::unique_ptr<ITransport> create_io_uring() noexcept {
 #if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
-        // Create or get shared io_uring context
-        static IoUringContext ctx;
+        // Create or get this thread's io_uring context
+        thread_local IoUringContext ctx;
         if (!ctx.is_initialized()) {
             if (auto result = ctx.init(); !result) {
                 // io_uring init failed, fall back to simple transport
@@ -138,30 +149,80 @@ public:
 #endif
     }
 
+#if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
+    /// Create io_uring transport with explicit configuration
+    /// The thread's ring is set up (SQPOLL or not) by the first transport
+    /// created on it.
+    [[nodiscard]] static std::unique_ptr<ITransport> create_io_uring(
+        const IoUringTransportConfig& config) noexcept
+    {
+        thread_local IoUringContext ctx;
+        if (!ctx.is_initialized()) {
+            if (auto result = ctx.init(IoUringContext::QUEUE_DEPTH, config.sqpoll); !result) {
+                return create_simple();
+            }
+        }
+        return std::make_unique<IoUringTransport>(ctx, config);
+    }
+
+    /// Create io_uring transport on a caller-owned ring (e.g. one per core)
+    [[nodiscard]] static std::unique_ptr<ITransport> create_io_uring(IoUringContext& ctx) noexcept {
+        if (!ctx.is_initialized()) return create_simple();
+        return std::make_unique<IoUringTransport>(ctx);
+    }
+#endif
+
     /// Create IOCP transport (Windows only)
+    /// Transports created on one thread share that thread's completion port
+    /// (and RIO completion queue where Registered I/O is available).
     /// Returns simple transport on other platforms or if IOCP unavailable
     [[nodiscard]] static std::unique_ptr<ITransport> create_iocp() noexcept {
 #if NFX_PLATFORM_WINDOWS && NFX_ASYNC_IO_IOCP
-        // TODO: Implement IOCP transport in Phase 3
-        // For now, fall back to Winsock
-        return create_simple();
+        thread_local IocpContext ctx;
+        if (!ctx.is_initialized()) {
+            if (auto result = ctx.init(); !result) {
+                return create_simple();
+            }
+        }
+        return std::make_unique<IocpTransport>(ctx);
 #else
         return create_simple();
 #endif
     }
 
+#if NFX_PLATFORM_WINDOWS && NFX_ASYNC_IO_IOCP
+    /// Create IOCP transport on a caller-owned context
+    [[nodiscard]] static std::unique_ptr<ITransport> create_iocp(IocpContext& ctx) noexcept {
+        if (!ctx.is_initialized()) return create_simple();
+        return std::make_unique<IocpTransport>(ctx);
+    }
+#endif
+
     /// Create kqueue transport (macOS only)
+    /// Transports created on one thread share that thread's kqueue.
     /// Returns simple transport on other platforms or if kqueue unavailable
     [[nodiscard]] static std::unique_ptr<ITransport> create_kqueue() noexcept {
 #if NFX_PLATFORM_MACOS && NFX_ASYNC_IO_KQUEUE
-        // TODO: Implement kqueue transport in Phase 4
-        // For now, fall back to POSIX TCP
-        return create_simple();
+        thread_local KqueueContext ctx;
+        if (!ctx.is_initialized()) {
+            if (auto result = ctx.init(); !result) {
+                return create_simple();
+            }
+        }
+        return std::make_unique<KqueueTransport>(ctx);
 #else
         return create_simple();
 #endif
     }
 
+#if NFX_PLATFORM_MACOS && NFX_ASYNC_IO_KQUEUE
+    /// Create kqueue transport on a caller-owned kqueue
+    [[nodiscard]] static std::unique_ptr<ITransport> create_kqueue(KqueueContext& ctx) noexcept {
+        if (!ctx.is_initialized()) return create_simple();
+        return std::make_unique<KqueueTransport>(ctx);
+    }
+#endif
+
     /// Create best available transport for current platform
     [[nodiscard]] static std::unique_ptr<ITransport> create_best() noexcept {
 #if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
@@ -214,9 +275,9 @@ public:
 #if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
         return "IoUringTransport";
 #elif NFX_PLATFORM_WINDOWS
-        return "WinsockTransport";
+        return "IocpTransport";
 #elif NFX_PLATFORM_MACOS
-        return "TcpTransport (POSIX)";
+        return "KqueueTransport";
 #else
         return "TcpTransport (POSIX)";
 #endif
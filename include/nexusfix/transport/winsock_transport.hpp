@@ -143,6 +143,7 @@ public:
 
     /// Send data
     [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept {
+        NFX_NO_ALLOC_REGION("WinsockSocket::send");
         if (!is_connected()) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
@@ -37,10 +37,11 @@ enum class ParseErrorCode : uint8_t {
     DuplicateTag,
     UnterminatedField,
     InvalidMsgType,
-    GarbledMessage
+    GarbledMessage,
+    TooManyFields
 };
 
-inline constexpr size_t PARSE_ERROR_COUNT = 12;
+inline constexpr size_t PARSE_ERROR_COUNT = 13;
 
 // ============================================================================
 // Compile-time ParseError Info (TICKET_023)
@@ -101,6 +102,10 @@ template<> struct ParseErrorInfo<ParseErrorCode::GarbledMessage> {
     static constexpr std::string_view message = "Garbled message";
 };
 
+template<> struct ParseErrorInfo<ParseErrorCode::TooManyFields> {
+    static constexpr std::string_view message = "Too many fields";
+};
+
 /// Generate ParseError lookup table at compile time
 consteval std::array<std::string_view, PARSE_ERROR_COUNT> create_parse_error_table() {
     std::array<std::string_view, PARSE_ERROR_COUNT> table{};
@@ -116,6 +121,7 @@ consteval std::array<std::string_view, PARSE_ERROR_COUNT> create_parse_error_tab
     table[9]  = ParseErrorInfo<ParseErrorCode::UnterminatedField>::message;
     table[10] = ParseErrorInfo<ParseErrorCode::InvalidMsgType>::message;
     table[11] = ParseErrorInfo<ParseErrorCode::GarbledMessage>::message;
+    table[12] = ParseErrorInfo<ParseErrorCode::TooManyFields>::message;
     return table;
 }
 
@@ -187,10 +193,13 @@ enum class SessionErrorCode : uint8_t {
     HeartbeatTimeout,
     SequenceGap,
     InvalidState,
-    Disconnected
+    Disconnected,
+    Throttled,
+    RiskRejected,
+    MalformedMessage
 };
 
-inline constexpr size_t SESSION_ERROR_COUNT = 9;
+inline constexpr size_t SESSION_ERROR_COUNT = 12;
 
 // ============================================================================
 // Compile-time SessionError Info (TICKET_023)
@@ -239,6 +248,18 @@ template<> struct SessionErrorInfo<SessionErrorCode::Disconnected> {
     static constexpr std::string_view message = "Disconnected";
 };
 
+template<> struct SessionErrorInfo<SessionErrorCode::Throttled> {
+    static constexpr std::string_view message = "Outbound rate limit reached";
+};
+
+template<> struct SessionErrorInfo<SessionErrorCode::RiskRejected> {
+    static constexpr std::string_view message = "Pre-trade risk check failed";
+};
+
+template<> struct SessionErrorInfo<SessionErrorCode::MalformedMessage> {
+    static constexpr std::string_view message = "Malformed message";
+};
+
 /// Generate SessionError lookup table at compile time
 consteval std::array<std::string_view, SESSION_ERROR_COUNT> create_session_error_table() {
     std::array<std::string_view, SESSION_ERROR_COUNT> table{};
@@ -251,6 +272,9 @@ consteval std::array<std::string_view, SESSION_ERROR_COUNT> create_session_error
     table[6] = SessionErrorInfo<SessionErrorCode::SequenceGap>::message;
     table[7] = SessionErrorInfo<SessionErrorCode::InvalidState>::message;
     table[8] = SessionErrorInfo<SessionErrorCode::Disconnected>::message;
+    table[9] = SessionErrorInfo<SessionErrorCode::Throttled>::message;
+    table[10] = SessionErrorInfo<SessionErrorCode::RiskRejected>::message;
+    table[11] = SessionErrorInfo<SessionErrorCode::MalformedMessage>::message;
     return table;
 }
 
@@ -336,10 +360,14 @@ enum class TransportErrorCode : uint8_t {
     // Platform-specific errors
     WinsockInitFailed,    // WSAStartup failed (Windows)
     IocpError,            // IOCP operation failed (Windows)
-    KqueueError           // kqueue operation failed (macOS)
+    KqueueError,          // kqueue operation failed (macOS)
+
+    // TLS errors
+    TlsHandshakeFailed,
+    TlsOffloadUnavailable // Kernel did not take the session keys (kTLS)
 };
 
-inline constexpr size_t TRANSPORT_ERROR_COUNT = 20;
+inline constexpr size_t TRANSPORT_ERROR_COUNT = 22;
 
 // ============================================================================
 // Compile-time TransportError Info (TICKET_023)
@@ -437,6 +465,15 @@ template<> struct TransportErrorInfo<TransportErrorCode::KqueueError> {
     static constexpr std::string_view message = "kqueue operation failed";
 };
 
+// TLS errors
+template<> struct TransportErrorInfo<TransportErrorCode::TlsHandshakeFailed> {
+    static constexpr std::string_view message = "TLS handshake failed";
+};
+
+template<> struct TransportErrorInfo<TransportErrorCode::TlsOffloadUnavailable> {
+    static constexpr std::string_view message = "Kernel TLS offload unavailable";
+};
+
 /// Generate TransportError lookup table at compile time
 consteval std::array<std::string_view, TRANSPORT_ERROR_COUNT> create_transport_error_table() {
     std::array<std::string_view, TRANSPORT_ERROR_COUNT> table{};
@@ -460,6 +497,8 @@ consteval std::array<std::string_view, TRANSPORT_ERROR_COUNT> create_transport_e
     table[17] = TransportErrorInfo<TransportErrorCode::WinsockInitFailed>::message;
     table[18] = TransportErrorInfo<TransportErrorCode::IocpError>::message;
     table[19] = TransportErrorInfo<TransportErrorCode::KqueueError>::message;
+    table[20] = TransportErrorInfo<TransportErrorCode::TlsHandshakeFailed>::message;
+    table[21] = TransportErrorInfo<TransportErrorCode::TlsOffloadUnavailable>::message;
     return table;
 }
 
@@ -608,6 +608,34 @@ template<TimeInForce T>
     return "Unknown";
 }
 
+// ============================================================================
+// Mass Cancel Request Type
+// ============================================================================
+
+/// Scope of an OrderMassCancelRequest (530)
+enum class MassCancelRequestType : char {
+    Security            = '1',   // Orders for Symbol (55)
+    UnderlyingSecurity  = '2',
+    Product             = '3',
+    CfiCode             = '4',
+    SecurityType        = '5',
+    TradingSession      = '6',
+    AllOrders           = '7'
+};
+
+// ============================================================================
+// Order Fields
+// ============================================================================
+
+/// What pre-trade checks read from an outbound order builder
+struct OrderFields {
+    std::string_view symbol;
+    Side side{Side::Buy};
+    Qty order_qty{};
+    FixedPrice price{};   // Zero for market orders
+    OrdType ord_type{OrdType::Limit};
+};
+
 // ============================================================================
 // User-defined Literals
 // ============================================================================
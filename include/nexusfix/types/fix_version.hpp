@@ -321,6 +321,63 @@ static_assert(detail::VersionInfo<FixVersion::FIX_4_2>::is_fix4 == true);
 static_assert(detail::VERSION_TABLE[5].string == "FIX.4.4");
 static_assert(detail::VERSION_TABLE[6].is_fixt == true);
 
+// ============================================================================
+// Session Version (compile-time specialization)
+// ============================================================================
+
+namespace detail {
+
+/// "8=<BeginString>|" as the first bytes of every message
+template<FixVersion Ver>
+inline constexpr auto BEGIN_STRING_FIELD = [] {
+    constexpr std::string_view begin = VersionInfo<Ver>::is_fixt
+        ? fix_version::FIXT_1_1 : VersionInfo<Ver>::string;
+    std::array<char, 16> field{};
+    field[0] = '8';
+    field[1] = '=';
+    for (size_t i = 0; i < begin.size(); ++i) field[i + 2] = begin[i];
+    field[begin.size() + 2] = '\x01';
+    return field;
+}();
+
+} // namespace detail
+
+/// What a session fixed to one FIX version knows at compile time
+/// FixVersion::Unknown is the runtime case: BeginString comes from the
+/// session config and is not checked on receipt. Every FIX 5.x version
+/// travels as FIXT.1.1 with its DefaultApplVerID on Logon; FIXT_1_1 on
+/// its own means FIX 5.0 SP2.
+template<FixVersion Ver>
+struct SessionVersion {
+    static constexpr FixVersion version = Ver;
+    static constexpr bool is_fixed = Ver != FixVersion::Unknown;
+    static constexpr bool is_fixt = detail::VersionInfo<Ver>::is_fixt;
+
+    /// BeginString (tag 8) on the wire; empty when not fixed
+    static constexpr std::string_view begin_string = !is_fixed ? std::string_view{}
+        : is_fixt ? fix_version::FIXT_1_1 : detail::VersionInfo<Ver>::string;
+
+    /// DefaultApplVerID (tag 1137) sent on Logon; '\0' when not FIXT
+    static constexpr char default_appl_ver_id =
+        Ver == FixVersion::FIX_5_0 ? appl_ver_id::FIX_5_0
+        : Ver == FixVersion::FIX_5_0_SP1 ? appl_ver_id::FIX_5_0_SP1
+        : is_fixt ? appl_ver_id::FIX_5_0_SP2 : '\0';
+
+    /// "8=<BeginString>|"; empty when not fixed
+    static constexpr std::string_view begin_string_field = is_fixed
+        ? std::string_view{detail::BEGIN_STRING_FIELD<Ver>.data(), begin_string.size() + 3}
+        : std::string_view{};
+};
+
+using Fix44Version = SessionVersion<FixVersion::FIX_4_4>;
+using Fix50Sp2Version = SessionVersion<FixVersion::FIX_5_0_SP2>;
+
+static_assert(Fix44Version::begin_string_field == "8=FIX.4.4\x01");
+static_assert(Fix50Sp2Version::begin_string_field == "8=FIXT.1.1\x01");
+static_assert(Fix50Sp2Version::default_appl_ver_id == appl_ver_id::FIX_5_0_SP2);
+static_assert(Fix44Version::default_appl_ver_id == '\0');
+static_assert(!SessionVersion<FixVersion::Unknown>::is_fixed);
+
 // ============================================================================
 // FIX 5.0 Specific Tags
 // ============================================================================
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 
+#include "nexusfix/types/field_types.hpp"
+
 namespace nfx {
 
 // ============================================================================
@@ -403,6 +406,81 @@ struct MDEntry {
     }
 };
 
+// ============================================================================
+// Market Data Entry Row (one decoded column row, no views)
+// ============================================================================
+
+/// Self-contained copy of one MDEntryColumns row (safe to keep after the
+/// message buffer is reused, e.g. while buffering for recovery)
+struct MDEntryRow {
+    FixedPrice price{};
+    Qty size{};
+    uint32_t rpt_seq{0};            // RptSeq (0 = absent)
+    uint32_t number_of_orders{0};
+    uint16_t position_no{0};
+    MDUpdateAction update_action{MDUpdateAction::New};
+    MDEntryType entry_type{MDEntryType::Bid};
+};
+
+// ============================================================================
+// Market Data Entry Columns (struct-of-arrays group decode)
+// ============================================================================
+
+/// NoMDEntries group decoded column-wise: row i of every array is entry i.
+/// Prices and sizes are contiguous FixedPrice/Qty (int64 raw) so a book
+/// builder can apply a whole refresh with vector loads. Symbols are
+/// dictionary-encoded per message: symbol_id indexes symbols[].
+/// @tparam Capacity Maximum entries decoded from one message
+template <size_t Capacity = 256>
+struct MDEntryColumns {
+    static constexpr size_t CAPACITY = Capacity;
+    static constexpr size_t MAX_SYMBOLS = 32;
+    static constexpr uint16_t NO_SYMBOL = 0xFFFF;
+
+    std::array<MDUpdateAction, Capacity> update_action;
+    std::array<MDEntryType, Capacity> entry_type;
+    std::array<FixedPrice, Capacity> price;
+    std::array<Qty, Capacity> size;
+    std::array<uint16_t, Capacity> symbol_id;
+    std::array<uint16_t, Capacity> position_no;        // MDEntryPositionNo (0 = absent)
+    std::array<uint32_t, Capacity> number_of_orders;   // NumberOfOrders (0 = absent)
+    std::array<uint32_t, Capacity> rpt_seq;            // RptSeq (0 = absent)
+
+    std::array<std::string_view, MAX_SYMBOLS> symbols{};
+    size_t symbol_count{0};
+    size_t count{0};
+    bool truncated{false};        // Group had more than Capacity entries
+
+    constexpr void clear() noexcept {
+        count = 0;
+        symbol_count = 0;
+        truncated = false;
+    }
+
+    /// Dictionary id for sym, adding it if new (NO_SYMBOL when full)
+    [[nodiscard]] constexpr uint16_t intern_symbol(std::string_view sym) noexcept {
+        for (size_t i = 0; i < symbol_count; ++i) {
+            if (symbols[i] == sym) return static_cast<uint16_t>(i);
+        }
+        if (symbol_count == MAX_SYMBOLS) [[unlikely]] return NO_SYMBOL;
+        symbols[symbol_count] = sym;
+        return static_cast<uint16_t>(symbol_count++);
+    }
+
+    /// Symbol of row i (empty if none)
+    [[nodiscard]] constexpr std::string_view symbol(size_t i) const noexcept {
+        return symbol_id[i] == NO_SYMBOL ? std::string_view{} : symbols[symbol_id[i]];
+    }
+
+    /// Copy of row i
+    [[nodiscard]] constexpr MDEntryRow row(size_t i) const noexcept {
+        return MDEntryRow{price[i], size[i], rpt_seq[i], number_of_orders[i],
+                          position_no[i], update_action[i], entry_type[i]};
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+};
+
 // ============================================================================
 // Related Symbol Entry (for subscription requests)
 // ============================================================================
@@ -421,5 +499,6 @@ static_assert(sizeof(MDEntryType) == 1, "MDEntryType should be 1 byte");
 static_assert(sizeof(MDUpdateAction) == 1, "MDUpdateAction should be 1 byte");
 static_assert(sizeof(SubscriptionRequestType) == 1, "SubscriptionRequestType should be 1 byte");
 static_assert(sizeof(MDReqRejReason) == 1, "MDReqRejReason should be 1 byte");
+static_assert(sizeof(MDEntryRow) == 32, "MDEntryRow should stay 32 bytes");
 
 } // namespace nfx
@@ -36,6 +36,8 @@ using SendingTime   = Tag<52>;   // Time of message transmission
 using PossDupFlag   = Tag<43>;   // Possible duplicate
 using PossResend    = Tag<97>;   // Possible resend
 using OrigSendingTime = Tag<122>; // Original sending time
+using OnBehalfOfCompID = Tag<115>; // Originating firm, set by a forwarding hub
+using DeliverToCompID  = Tag<128>; // Final recipient behind a hub
 
 // ============================================================================
 // FIX 4.4 Standard Trailer Tags
@@ -53,6 +55,10 @@ using ResetSeqNumFlag  = Tag<141>;  // Reset sequence numbers
 using TestReqID        = Tag<112>;  // Test request ID
 using RefSeqNum        = Tag<45>;   // Reference sequence number
 using Text             = Tag<58>;   // Free format text
+using BeginSeqNo       = Tag<7>;    // First seqnum of a ResendRequest
+using EndSeqNo         = Tag<16>;   // Last seqnum of a ResendRequest (0 = infinity)
+using NewSeqNo         = Tag<36>;   // SequenceReset next seqnum
+using GapFillFlag      = Tag<123>;  // SequenceReset is a gap fill
 
 // ============================================================================
 // Order Tags (NewOrderSingle 35=D)
@@ -97,6 +103,7 @@ using ExecRestatementReason = Tag<378>; // Exec restatement reason
 using OrigClOrdID      = Tag<41>;   // Original client order ID
 using CxlRejReason     = Tag<102>;  // Cancel reject reason
 using CxlRejResponseTo = Tag<434>;  // Cancel reject response to
+using MassCancelRequestType = Tag<530>; // Scope of an OrderMassCancelRequest (35=q)
 
 // ============================================================================
 // Market Data Tags
@@ -125,6 +132,22 @@ using QuoteCondition   = Tag<276>;  // Quote condition
 using TradeCondition   = Tag<277>;  // Trade condition
 using NumberOfOrders   = Tag<346>;  // Number of orders at price level
 using TotalVolumeTraded = Tag<387>; // Total volume traded
+using RptSeq           = Tag<83>;   // Per-instrument update sequence
+using LastMsgSeqNumProcessed = Tag<369>; // Last MsgSeqNum reflected in a snapshot
+
+// ============================================================================
+// Repeating Group Tags (Parties, Legs)
+// ============================================================================
+
+using NoPartyIDs       = Tag<453>;  // Number of Parties entries
+using PartyID          = Tag<448>;  // Party identifier (delimiter)
+using PartyIDSource    = Tag<447>;  // Party identifier source
+using PartyRole        = Tag<452>;  // Party role
+using NoLegs           = Tag<555>;  // Number of legs
+using LegSymbol        = Tag<600>;  // Leg instrument symbol (delimiter)
+using LegSide          = Tag<624>;  // Leg side
+using LegRatioQty      = Tag<623>;  // Leg ratio quantity
+using LegPrice         = Tag<566>;  // Leg price
 
 // ============================================================================
 // Compile-time Tag Metadata (TICKET_023)
@@ -0,0 +1,182 @@
+/*
+    NexusFIX Known-Tag Perfect Hash
+
+    Maps every tag NexusFIX names (tag.hpp, fix_version.hpp) to a unique
+    slot in a 128-entry table, so HashedFieldTable can index a parsed
+    message in 2KB instead of a 512-wide FieldTable:
+
+        tag --h1--> bucket --seed--> slot   (keys[slot] == tag ? hit : unknown)
+
+    The table is a two-level hash-and-displace built at compile time; a
+    KNOWN_TAGS entry that cannot be placed fails the build. Tags outside
+    KNOWN_TAGS return UNKNOWN_TAG_SLOT and go to HashedFieldTable's
+    overflow list, which holds OVERFLOW_CAPACITY of them per message.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/fix_version.hpp"
+
+namespace nfx::tag {
+
+// ============================================================================
+// Known Tag Set
+// ============================================================================
+
+/// Every tag defined in tag.hpp and fix_version.hpp
+/// Keys of the perfect hash below; add new tag aliases here too.
+inline constexpr std::array<int, 81> KNOWN_TAGS = {
+    // Header / trailer
+    BeginString::value, BodyLength::value, MsgType::value, SenderCompID::value,
+    TargetCompID::value, MsgSeqNum::value, SendingTime::value, PossDupFlag::value,
+    PossResend::value, OrigSendingTime::value, CheckSum::value,
+    // Session
+    EncryptMethod::value, HeartBtInt::value, ResetSeqNumFlag::value,
+    TestReqID::value, RefSeqNum::value, Text::value, BeginSeqNo::value,
+    EndSeqNo::value, NewSeqNo::value, GapFillFlag::value,
+    // Order
+    ClOrdID::value, Symbol::value, Side::value, OrderQty::value, OrdType::value,
+    Price::value, StopPx::value, TimeInForce::value, TransactTime::value,
+    Account::value, HandlInst::value, ExDestination::value, SecurityType::value,
+    MaturityMonthYear::value, SecurityExchange::value,
+    // Execution
+    OrderID::value, ExecID::value, ExecType::value, OrdStatus::value,
+    LeavesQty::value, CumQty::value, AvgPx::value, LastPx::value, LastQty::value,
+    OrdRejReason::value, ExecRestatementReason::value,
+    // Cancel
+    OrigClOrdID::value, CxlRejReason::value, CxlRejResponseTo::value,
+    // Market data
+    MDReqID::value, SubscriptionRequestType::value, MarketDepth::value,
+    MDUpdateType::value, AggregatedBook::value, NoMDEntryTypes::value,
+    NoMDEntries::value, MDEntryType::value, MDEntryPx::value, MDEntrySize::value,
+    MDEntryDate::value, MDEntryTime::value, MDUpdateAction::value,
+    MDEntryID::value, MDReqRejReason::value, MDEntryPositionNo::value,
+    NoRelatedSym::value, SecurityID::value, TradingSessionID::value,
+    QuoteCondition::value, TradeCondition::value, NumberOfOrders::value,
+    TotalVolumeTraded::value, RptSeq::value, LastMsgSeqNumProcessed::value,
+    // FIX 5.0 application versioning
+    ApplVerID::value, CstmApplVerID::value, DefaultApplVerID::value,
+    ApplExtID::value, DefaultApplExtID::value, DefaultCstmApplVerID::value
+};
+
+// ============================================================================
+// Compile-time Perfect Hash (two-level, hash-and-displace)
+// ============================================================================
+
+namespace detail {
+
+inline constexpr size_t TAG_HASH_SLOTS = 128;     // Power of 2 >= KNOWN_TAGS
+inline constexpr size_t TAG_HASH_BUCKETS = 32;    // First-level buckets
+inline constexpr uint32_t TAG_HASH_MUL1 = 0x9E3779B1u;
+inline constexpr uint32_t TAG_HASH_MUL2 = 0x85EBCA77u;
+inline constexpr uint32_t TAG_HASH_SEED_MUL = 0x27D4EB2Du;
+
+/// First-level hash; top bits pick the bucket
+[[nodiscard]] constexpr uint32_t tag_hash1(int tag_num) noexcept {
+    return static_cast<uint32_t>(tag_num) * TAG_HASH_MUL1;
+}
+
+[[nodiscard]] constexpr size_t tag_bucket(uint32_t h1) noexcept {
+    return h1 >> 27;  // log2(TAG_HASH_BUCKETS) = 5
+}
+
+/// Second-level hash displaced by the bucket seed
+[[nodiscard]] constexpr size_t tag_slot(uint32_t h1, uint32_t seed) noexcept {
+    return ((h1 ^ seed) * TAG_HASH_MUL2) >> 25;  // log2(TAG_HASH_SLOTS) = 7
+}
+
+/// Generated hash tables: one seed per bucket, key per slot (0 = empty)
+struct TagHashTable {
+    std::array<uint32_t, TAG_HASH_BUCKETS> seeds;
+    std::array<uint16_t, TAG_HASH_SLOTS> keys;
+    bool ok;
+};
+
+/// Build the perfect hash: place largest buckets first, search a seed
+/// per bucket until all its tags land on free, distinct slots
+consteval TagHashTable create_tag_hash() {
+    TagHashTable table{};
+    table.ok = true;
+
+    std::array<std::array<int, KNOWN_TAGS.size()>, TAG_HASH_BUCKETS> buckets{};
+    std::array<size_t, TAG_HASH_BUCKETS> sizes{};
+    for (int t : KNOWN_TAGS) {
+        size_t b = tag_bucket(tag_hash1(t));
+        buckets[b][sizes[b]++] = t;
+    }
+
+    std::array<size_t, TAG_HASH_BUCKETS> order{};
+    for (size_t i = 0; i < TAG_HASH_BUCKETS; ++i) order[i] = i;
+    for (size_t i = 0; i < TAG_HASH_BUCKETS; ++i) {
+        for (size_t j = i + 1; j < TAG_HASH_BUCKETS; ++j) {
+            if (sizes[order[j]] > sizes[order[i]]) {
+                size_t tmp = order[i]; order[i] = order[j]; order[j] = tmp;
+            }
+        }
+    }
+
+    for (size_t b : order) {
+        if (sizes[b] == 0) continue;
+        bool placed = false;
+        for (uint32_t s = 0; s < 65536 && !placed; ++s) {
+            const uint32_t seed = s * TAG_HASH_SEED_MUL;
+            std::array<size_t, KNOWN_TAGS.size()> slots{};
+            placed = true;
+            for (size_t k = 0; k < sizes[b] && placed; ++k) {
+                slots[k] = tag_slot(tag_hash1(buckets[b][k]), seed);
+                if (table.keys[slots[k]] != 0) placed = false;
+                for (size_t m = 0; m < k && placed; ++m) {
+                    if (slots[m] == slots[k]) placed = false;
+                }
+            }
+            if (placed) {
+                table.seeds[b] = seed;
+                for (size_t k = 0; k < sizes[b]; ++k) {
+                    table.keys[slots[k]] = static_cast<uint16_t>(buckets[b][k]);
+                }
+            }
+        }
+        if (!placed) table.ok = false;
+    }
+
+    return table;
+}
+
+inline constexpr TagHashTable TAG_HASH = create_tag_hash();
+
+static_assert(TAG_HASH.ok, "No perfect hash seed found for KNOWN_TAGS");
+static_assert(KNOWN_TAGS.size() <= TAG_HASH_SLOTS);
+
+} // namespace detail
+
+// ============================================================================
+// Runtime Tag Slot Query
+// ============================================================================
+
+/// Number of slots in the known-tag hash (valid slot indices)
+inline constexpr size_t KNOWN_TAG_SLOTS = detail::TAG_HASH_SLOTS;
+
+/// Returned by known_tag_slot() for tags outside KNOWN_TAGS
+inline constexpr size_t UNKNOWN_TAG_SLOT = KNOWN_TAG_SLOTS;
+
+/// Map tag to its unique slot in [0, KNOWN_TAG_SLOTS), or UNKNOWN_TAG_SLOT
+/// Two multiplies, two small-table loads (seeds: 128B, keys: 256B).
+[[nodiscard]] inline constexpr size_t known_tag_slot(int tag_num) noexcept {
+    const uint32_t h1 = detail::tag_hash1(tag_num);
+    const size_t slot = detail::tag_slot(h1, detail::TAG_HASH.seeds[detail::tag_bucket(h1)]);
+    return (tag_num > 0 && detail::TAG_HASH.keys[slot] == tag_num)
+        ? slot : UNKNOWN_TAG_SLOT;
+}
+
+// Static assertions for the perfect hash
+static_assert(known_tag_slot(BeginString::value) != UNKNOWN_TAG_SLOT);
+static_assert(known_tag_slot(DefaultApplVerID::value) != UNKNOWN_TAG_SLOT);
+static_assert(known_tag_slot(0) == UNKNOWN_TAG_SLOT);
+static_assert(known_tag_slot(9999) == UNKNOWN_TAG_SLOT);
+
+} // namespace nfx::tag
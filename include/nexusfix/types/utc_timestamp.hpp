@@ -0,0 +1,166 @@
+/*
+    NexusFIX UTCTimestamp Conversion
+
+    FIX UTCTimestamp text <-> nfx::Timestamp (nanoseconds since epoch),
+    allocation-free and constexpr:
+
+        "20240115-10:30:00.123"       -> 1705314600123000000
+        "20240115-10:30:00.123456789" -> 1705314600123456789
+
+    Accepts 0-9 fractional digits. Calendar math is the days-from-civil
+    algorithm (H. Hinnant), no <chrono> calendar types or time zones.
+
+    Usage:
+        Timestamp ts;
+        if (parse_utc_timestamp(field.as_string(), ts)) { ... }
+
+        UtcTimestampText text;
+        std::string_view s = format_utc_timestamp(ts, text, 6);
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "nexusfix/types/field_types.hpp"
+
+namespace nfx {
+
+/// Longest UTCTimestamp: "YYYYMMDD-HH:MM:SS.nnnnnnnnn"
+inline constexpr size_t UTC_TIMESTAMP_MAX_LEN = 27;
+
+/// Caller-owned storage for a formatted UTCTimestamp
+using UtcTimestampText = std::array<char, UTC_TIMESTAMP_MAX_LEN>;
+
+namespace detail {
+
+inline constexpr int64_t NANOS_PER_SECOND = 1'000'000'000;
+inline constexpr int64_t SECONDS_PER_DAY = 86'400;
+
+/// Days since 1970-01-01 for a proleptic Gregorian date
+[[nodiscard]] constexpr int64_t days_from_civil(int64_t y, unsigned m, unsigned d) noexcept {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const auto yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+struct CivilDate {
+    int64_t year;
+    unsigned month;
+    unsigned day;
+};
+
+/// Inverse of days_from_civil
+[[nodiscard]] constexpr CivilDate civil_from_days(int64_t z) noexcept {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    return {static_cast<int64_t>(yoe) + era * 400 + (m <= 2), m, d};
+}
+
+/// n ASCII digits at s, or -1 if any is not a digit
+[[nodiscard]] constexpr int64_t utc_digits(const char* s, size_t n) noexcept {
+    int64_t v = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const auto c = static_cast<unsigned>(s[i] - '0');
+        if (c > 9) [[unlikely]] return -1;
+        v = v * 10 + c;
+    }
+    return v;
+}
+
+constexpr void utc_put(char* out, int64_t v, size_t n) noexcept {
+    for (size_t i = n; i-- > 0;) {
+        out[i] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    }
+}
+
+}  // namespace detail
+
+/// Parse "YYYYMMDD-HH:MM:SS[.fraction]" (fraction 1-9 digits)
+/// @return false (out untouched) if malformed
+[[nodiscard]] constexpr bool parse_utc_timestamp(std::string_view s, Timestamp& out) noexcept {
+    if (s.size() < 17 || s[8] != '-' || s[11] != ':' || s[14] != ':') [[unlikely]] {
+        return false;
+    }
+    const char* p = s.data();
+    const int64_t year = detail::utc_digits(p, 4);
+    const int64_t month = detail::utc_digits(p + 4, 2);
+    const int64_t day = detail::utc_digits(p + 6, 2);
+    const int64_t hour = detail::utc_digits(p + 9, 2);
+    const int64_t minute = detail::utc_digits(p + 12, 2);
+    const int64_t second = detail::utc_digits(p + 15, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || day > 31 ||
+        hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
+        second < 0 || second > 60) [[unlikely]] {  // 60: leap second
+        return false;
+    }
+
+    int64_t nanos = 0;
+    if (s.size() > 17) {
+        const size_t digits = s.size() - 18;
+        if (s[17] != '.' || digits == 0 || digits > 9) [[unlikely]] return false;
+        nanos = detail::utc_digits(p + 18, digits);
+        if (nanos < 0) [[unlikely]] return false;
+        for (size_t i = digits; i < 9; ++i) nanos *= 10;
+    }
+
+    const int64_t days = detail::days_from_civil(year, static_cast<unsigned>(month),
+                                                 static_cast<unsigned>(day));
+    const int64_t secs = days * detail::SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+    out = Timestamp{secs * detail::NANOS_PER_SECOND + nanos};
+    return true;
+}
+
+/// Format ts as a UTCTimestamp with 0, 3, 6 or 9 fractional digits
+/// @return View into out
+constexpr std::string_view format_utc_timestamp(
+    Timestamp ts, UtcTimestampText& out, int fraction_digits = 3) noexcept {
+    int64_t secs = ts.nanos / detail::NANOS_PER_SECOND;
+    int64_t nanos = ts.nanos % detail::NANOS_PER_SECOND;
+    if (nanos < 0) {
+        nanos += detail::NANOS_PER_SECOND;
+        --secs;
+    }
+    int64_t days = secs / detail::SECONDS_PER_DAY;
+    int64_t tod = secs % detail::SECONDS_PER_DAY;
+    if (tod < 0) {
+        tod += detail::SECONDS_PER_DAY;
+        --days;
+    }
+    const detail::CivilDate date = detail::civil_from_days(days);
+
+    char* p = out.data();
+    detail::utc_put(p, date.year, 4);
+    detail::utc_put(p + 4, date.month, 2);
+    detail::utc_put(p + 6, date.day, 2);
+    p[8] = '-';
+    detail::utc_put(p + 9, tod / 3600, 2);
+    p[11] = ':';
+    detail::utc_put(p + 12, (tod / 60) % 60, 2);
+    p[14] = ':';
+    detail::utc_put(p + 15, tod % 60, 2);
+
+    const size_t digits = fraction_digits >= 9 ? 9 : fraction_digits >= 6 ? 6
+                        : fraction_digits >= 3 ? 3 : 0;
+    if (digits == 0) return {p, 17};
+    p[17] = '.';
+    int64_t frac = nanos;
+    for (size_t i = digits; i < 9; ++i) frac /= 10;
+    detail::utc_put(p + 18, frac, digits);
+    return {p, 18 + digits};
+}
+
+}  // namespace nfx
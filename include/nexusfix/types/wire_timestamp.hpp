@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nfx {
+
+// ============================================================================
+// Wire Timestamp
+// ============================================================================
+
+/// Time a packet crossed the wire, as reported by the kernel
+/// (SO_TIMESTAMPING). Both clocks are nanoseconds since the epoch;
+/// 0 means not reported.
+/// - software_ns: kernel CLOCK_REALTIME at the driver / socket layer
+/// - hardware_ns: NIC PTP hardware clock (raw, not converted)
+struct WireTimestamp {
+    int64_t software_ns{0};
+    int64_t hardware_ns{0};
+
+    [[nodiscard]] constexpr bool has_software() const noexcept { return software_ns != 0; }
+    [[nodiscard]] constexpr bool has_hardware() const noexcept { return hardware_ns != 0; }
+    [[nodiscard]] constexpr bool valid() const noexcept {
+        return has_software() || has_hardware();
+    }
+
+    /// Hardware time when the NIC reported one, else software time
+    [[nodiscard]] constexpr int64_t best_ns() const noexcept {
+        return has_hardware() ? hardware_ns : software_ns;
+    }
+};
+
+} // namespace nfx
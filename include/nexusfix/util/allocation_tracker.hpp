@@ -0,0 +1,369 @@
+/*
+    NexusFIX Allocation Tracker
+
+    Proves hot paths allocation-free. Code marks its steady-state paths with
+    NFX_NO_ALLOC_REGION("name"); a build that defines NFX_TRACK_ALLOCATIONS
+    turns each marker into an RAII region, and any heap allocation made by
+    the same thread while a region is open is recorded as a violation.
+
+    Allocations are observed by interposition. Exactly one translation unit
+    (a test or benchmark main) defines NFX_ALLOCATION_TRACKER_HOOKS before
+    including this header, which defines:
+    - the replaceable global operator new (all forms), and
+    - on glibc, malloc / calloc / realloc / posix_memalign / aligned_alloc /
+      memalign, forwarding to the __libc_* entry points, so C allocations
+      and third-party code are caught too.
+    PMR upstreams that bypass malloc (SessionHeap, huge pages) are covered by
+    wrapping them in TrackedResource.
+
+    Without NFX_TRACK_ALLOCATIONS the markers compile to nothing. Not
+    compatible with sanitizers that replace malloc themselves.
+
+    Usage:
+        #define NFX_ALLOCATION_TRACKER_HOOKS
+        #include <nexusfix/util/allocation_tracker.hpp>
+
+        nfx::util::AllocationTracker::reset();
+        session.on_data_received(msg);
+        REQUIRE(nfx::util::AllocationTracker::violations() == 0);
+
+    Thread-safety: regions and counts are per thread; the violation log is
+    shared and lock-free.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+
+namespace nfx::util {
+
+// ============================================================================
+// Allocation Tracker
+// ============================================================================
+
+/// An allocation made inside a no-allocation region
+struct AllocationViolation {
+    const char* region{nullptr};   ///< Outermost open region
+    size_t size{0};                ///< Requested bytes
+};
+
+namespace detail {
+
+struct AllocationThreadState {
+    uint32_t depth{0};
+    uint32_t allowed{0};          ///< Open AllowAllocRegion exemptions
+    const char* region{nullptr};
+    uint64_t allocations{0};
+};
+
+}  // namespace detail
+
+class AllocationTracker {
+public:
+    static constexpr size_t MAX_RECORDED = 32;
+
+    /// Called for every violation (after it is recorded); must not allocate
+    using ViolationHandler = void (*)(const AllocationViolation&) noexcept;
+
+    static void enter(const char* region) noexcept {
+        if (state_.depth++ == 0) state_.region = region;
+    }
+
+    static void leave() noexcept {
+        if (--state_.depth == 0) state_.region = nullptr;
+    }
+
+    [[nodiscard]] static bool in_region() noexcept {
+        return state_.depth != 0 && state_.allowed == 0;
+    }
+
+    /// Name of the outermost open region on this thread, or nullptr
+    [[nodiscard]] static const char* current_region() noexcept {
+        return state_.region;
+    }
+
+    /// Report an allocation made by this thread (called by the hooks and
+    /// TrackedResource). Must not allocate.
+    static void on_allocation(size_t size) noexcept {
+        ++state_.allocations;
+        if (!in_region()) [[likely]] return;
+
+        const AllocationViolation v{state_.region, size};
+        const uint64_t n = violations_.fetch_add(1, std::memory_order_relaxed);
+        if (n < MAX_RECORDED) recorded_[n] = v;
+        if (auto* handler = handler_.load(std::memory_order_acquire)) {
+            ++state_.allowed;  // Handler may log through the allocator
+            handler(v);
+            --state_.allowed;
+        }
+    }
+
+    /// Violations since the last reset(), across all threads
+    [[nodiscard]] static uint64_t violations() noexcept {
+        return violations_.load(std::memory_order_acquire);
+    }
+
+    /// The first MAX_RECORDED violations since the last reset()
+    [[nodiscard]] static std::span<const AllocationViolation> recorded() noexcept {
+        const uint64_t n = violations();
+        return {recorded_.data(), n < MAX_RECORDED ? static_cast<size_t>(n) : MAX_RECORDED};
+    }
+
+    static void reset() noexcept {
+        violations_.store(0, std::memory_order_release);
+        recorded_.fill(AllocationViolation{});
+    }
+
+    /// Allocations made by this thread so far (inside regions or not)
+    [[nodiscard]] static uint64_t thread_allocations() noexcept {
+        return state_.allocations;
+    }
+
+    /// Allocations made by this thread while running fn
+    template <typename Fn>
+    [[nodiscard]] static uint64_t count(Fn&& fn) {
+        const uint64_t before = state_.allocations;
+        static_cast<Fn&&>(fn)();
+        return state_.allocations - before;
+    }
+
+    static void set_violation_handler(ViolationHandler handler) noexcept {
+        handler_.store(handler, std::memory_order_release);
+    }
+
+    /// True when a translation unit defined NFX_ALLOCATION_TRACKER_HOOKS;
+    /// without hooks nothing is observed and violations() stays 0
+    [[nodiscard]] static bool hooks_installed() noexcept {
+        return hooks_installed_.load(std::memory_order_relaxed);
+    }
+
+    static void mark_hooks_installed() noexcept {
+        hooks_installed_.store(true, std::memory_order_relaxed);
+    }
+
+private:
+    friend class AllowAllocRegion;
+
+    // Trivially constructed: safe to touch from inside malloc
+    static constinit inline thread_local detail::AllocationThreadState state_{};
+    static constinit inline std::atomic<uint64_t> violations_{0};
+    static constinit inline std::array<AllocationViolation, MAX_RECORDED> recorded_{};
+    static constinit inline std::atomic<ViolationHandler> handler_{nullptr};
+    static constinit inline std::atomic<bool> hooks_installed_{false};
+};
+
+// ============================================================================
+// Regions
+// ============================================================================
+
+/// RAII no-allocation region; nests, the outermost name is reported
+class NoAllocRegion {
+public:
+    explicit NoAllocRegion(const char* name) noexcept { AllocationTracker::enter(name); }
+    ~NoAllocRegion() { AllocationTracker::leave(); }
+
+    NoAllocRegion(const NoAllocRegion&) = delete;
+    NoAllocRegion& operator=(const NoAllocRegion&) = delete;
+};
+
+/// RAII exemption inside a region (cold paths such as session setup that
+/// run under a hot entry point)
+class AllowAllocRegion {
+public:
+    AllowAllocRegion() noexcept { ++AllocationTracker::state_.allowed; }
+    ~AllowAllocRegion() { --AllocationTracker::state_.allowed; }
+
+    AllowAllocRegion(const AllowAllocRegion&) = delete;
+    AllowAllocRegion& operator=(const AllowAllocRegion&) = delete;
+};
+
+#define NFX_ALLOC_CONCAT_IMPL(a, b) a##b
+#define NFX_ALLOC_CONCAT(a, b) NFX_ALLOC_CONCAT_IMPL(a, b)
+
+#if defined(NFX_TRACK_ALLOCATIONS)
+    #define NFX_NO_ALLOC_REGION(name) \
+        ::nfx::util::NoAllocRegion NFX_ALLOC_CONCAT(nfx_no_alloc_, __LINE__){name}
+    #define NFX_ALLOW_ALLOC_REGION() \
+        ::nfx::util::AllowAllocRegion NFX_ALLOC_CONCAT(nfx_allow_alloc_, __LINE__){}
+#else
+    #define NFX_NO_ALLOC_REGION(name) ((void)0)
+    #define NFX_ALLOW_ALLOC_REGION() ((void)0)
+#endif
+
+// ============================================================================
+// PMR Upstream Tracking
+// ============================================================================
+
+/// Forwards to an upstream resource, reporting each allocation to the
+/// tracker. Wrap upstreams that do not go through malloc.
+class TrackedResource final : public std::pmr::memory_resource {
+public:
+    explicit TrackedResource(
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_{upstream} {}
+
+    [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept { return upstream_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        AllocationTracker::on_allocation(bytes);
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+}  // namespace nfx::util
+
+// ============================================================================
+// Interposition Hooks (one translation unit only)
+// ============================================================================
+
+#if defined(NFX_ALLOCATION_TRACKER_HOOKS) && !defined(NFX_ALLOCATION_TRACKER_HOOKS_DEFINED)
+#define NFX_ALLOCATION_TRACKER_HOOKS_DEFINED
+
+#if defined(_MSC_VER)
+    #error "NFX_ALLOCATION_TRACKER_HOOKS is not supported on MSVC"
+#endif
+
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+}
+#endif
+
+namespace nfx::util::detail {
+
+inline void* tracked_malloc(size_t size) noexcept {
+    AllocationTracker::on_allocation(size);
+#if defined(__GLIBC__)
+    return __libc_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+}
+
+inline void* tracked_aligned_alloc(size_t alignment, size_t size) noexcept {
+    AllocationTracker::on_allocation(size);
+#if defined(__GLIBC__)
+    return __libc_memalign(alignment, size);
+#else
+    // aligned_alloc wants a size that is a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+inline void* operator_new(size_t size) {
+    void* p = tracked_malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc{};
+    return p;
+}
+
+inline void* operator_new(size_t size, std::align_val_t al) {
+    void* p = tracked_aligned_alloc(static_cast<size_t>(al), size ? size : 1);
+    if (!p) throw std::bad_alloc{};
+    return p;
+}
+
+inline const bool hooks_registered = (AllocationTracker::mark_hooks_installed(), true);
+
+}  // namespace nfx::util::detail
+
+// Replaceable global allocation functions. Deletes go straight to free():
+// every tracked allocation comes from the same underlying allocator.
+void* operator new(size_t size) { return nfx::util::detail::operator_new(size); }
+void* operator new[](size_t size) { return nfx::util::detail::operator_new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return nfx::util::detail::tracked_malloc(size ? size : 1);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return nfx::util::detail::tracked_malloc(size ? size : 1);
+}
+void* operator new(size_t size, std::align_val_t al) {
+    return nfx::util::detail::operator_new(size, al);
+}
+void* operator new[](size_t size, std::align_val_t al) {
+    return nfx::util::detail::operator_new(size, al);
+}
+void* operator new(size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return nfx::util::detail::tracked_aligned_alloc(static_cast<size_t>(al), size ? size : 1);
+}
+void* operator new[](size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return nfx::util::detail::tracked_aligned_alloc(static_cast<size_t>(al), size ? size : 1);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#if defined(__GLIBC__)
+// C allocation entry points; operator new above bypasses these, so nothing
+// is counted twice
+extern "C" {
+void* malloc(size_t size) noexcept { return nfx::util::detail::tracked_malloc(size); }
+
+void* calloc(size_t n, size_t size) noexcept {
+    nfx::util::AllocationTracker::on_allocation(n * size);
+    return __libc_calloc(n, size);
+}
+
+void* realloc(void* p, size_t size) noexcept {
+    nfx::util::AllocationTracker::on_allocation(size);
+    return __libc_realloc(p, size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept {
+    return nfx::util::detail::tracked_aligned_alloc(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+    return nfx::util::detail::tracked_aligned_alloc(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) noexcept {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) return EINVAL;
+    void* p = nfx::util::detail::tracked_aligned_alloc(alignment, size);
+    if (!p) return ENOMEM;
+    *out = p;
+    return 0;
+}
+}
+#endif
+
+#endif  // NFX_ALLOCATION_TRACKER_HOOKS
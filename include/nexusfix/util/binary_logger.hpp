@@ -0,0 +1,490 @@
+/*
+    NexusFIX Binary Message Logger
+
+    Logs every FIX message a process sends and receives at full rate by
+    not formatting anything on the way: the session thread appends
+    {length, session id, direction, rdtsc} and the raw bytes to an SPSC
+    byte ring of its own; one backend thread copies the rings to a
+    binary file; an offline decoder (BinaryLogReader, examples/
+    binlog_decode) turns the file into text.
+
+        session thread A --> [ring A] --+
+        session thread B --> [ring B] --+--> backend thread --> file.nfxlog
+                                                                  |
+                                            binlog_decode  <------+
+
+    Record (ring and file, 8-byte aligned):
+        uint32 length | uint16 session_id | uint8 direction | uint8 0 | uint64 tsc | bytes | pad
+
+    The file starts with a BinaryLogFileHeader. The backend writes a
+    calibration record (direction 'C', payload TscCalibration) before
+    the first message and again whenever RdtscClock recalibrates, so the
+    decoder turns each tsc into wall-clock time with the calibration in
+    force when it was taken.
+
+    A full ring drops the message and counts it: logging never blocks
+    the session thread. Records of one thread are in order; records of
+    different threads are interleaved in the order the backend drained
+    them (sort on the timestamp if a merged order is needed).
+
+    Usage:
+        BinaryLogger logger{"fix.nfxlog"};
+        logger.start();
+        session.set_binary_logger(&logger, 1);   // Session id 1
+        ...
+        logger.stop();                           // Drains and closes
+
+        BinaryLogReader reader{"fix.nfxlog"};
+        BinaryLogEntry entry;
+        std::string line;
+        while (reader.next(entry)) {
+            format_log_entry(entry, line);       // "20260122-14:30:45.123456789 I 1 8=FIX.4.4|..."
+        }
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/utc_timestamp.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx::util {
+
+// ============================================================================
+// Record Layout
+// ============================================================================
+
+enum class LogDirection : uint8_t {
+    Inbound = 'I',
+    Outbound = 'O',
+    Calibration = 'C'     // Backend only: payload is a TscCalibration
+};
+
+struct BinaryLogRecord {
+    uint32_t length;      // Payload bytes (not counting padding)
+    uint16_t session_id;
+    uint8_t direction;    // LogDirection
+    uint8_t reserved;
+    uint64_t tsc;
+};
+
+static_assert(sizeof(BinaryLogRecord) == 16);
+
+struct BinaryLogFileHeader {
+    static constexpr std::array<char, 8> MAGIC{'N', 'F', 'X', 'B', 'L', 'O', 'G', '1'};
+    static constexpr uint32_t VERSION = 1;
+
+    std::array<char, 8> magic{MAGIC};
+    uint32_t version{VERSION};
+    uint32_t record_header_size{sizeof(BinaryLogRecord)};
+};
+
+static_assert(sizeof(BinaryLogFileHeader) == 16);
+
+namespace detail {
+
+[[nodiscard]] constexpr size_t log_record_size(size_t payload) noexcept {
+    return sizeof(BinaryLogRecord) + ((payload + 7) & ~size_t{7});
+}
+
+} // namespace detail
+
+// ============================================================================
+// SPSC Byte Ring
+// ============================================================================
+
+/// Variable-length records between one producer and one consumer
+/// A record never wraps: one that would is preceded by a wrap marker
+/// (length WRAP) and starts at offset 0.
+class BinaryLogRing {
+public:
+    static constexpr uint32_t WRAP = UINT32_MAX;
+
+    /// @param capacity Bytes, rounded up to a power of two (>= 4 KiB)
+    explicit BinaryLogRing(size_t capacity)
+        : capacity_{std::bit_ceil(std::max<size_t>(capacity, 4096))}
+        , mask_{capacity_ - 1}
+        , buffer_{std::make_unique<char[]>(capacity_)} {}
+
+    BinaryLogRing(const BinaryLogRing&) = delete;
+    BinaryLogRing& operator=(const BinaryLogRing&) = delete;
+
+    // ========================================================================
+    // Producer
+    // ========================================================================
+
+    /// @return false if the ring is full or the record larger than half of it
+    NFX_HOT bool try_write(LogDirection direction, uint16_t session_id, uint64_t tsc,
+                           std::span<const char> bytes) noexcept {
+        const size_t need = detail::log_record_size(bytes.size());
+        if (need > capacity_ / 2) [[unlikely]] return fail();
+
+        const size_t offset = head_ & mask_;
+        const size_t pad = capacity_ - offset < need ? capacity_ - offset : 0;
+        const uint64_t end = head_ + pad + need;
+        if (end - cached_tail_ > capacity_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (end - cached_tail_ > capacity_) [[unlikely]] return fail();
+        }
+
+        char* dst = buffer_.get() + offset;
+        if (pad) {
+            std::memcpy(dst, &WRAP, sizeof(WRAP));
+            dst = buffer_.get();
+        }
+        const BinaryLogRecord record{static_cast<uint32_t>(bytes.size()), session_id,
+                                     static_cast<uint8_t>(direction), 0, tsc};
+        std::memcpy(dst, &record, sizeof(record));
+        std::memcpy(dst + sizeof(record), bytes.data(), bytes.size());
+
+        head_ = end;
+        published_.store(end, std::memory_order_release);
+        written_.store(written_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // ========================================================================
+    // Consumer
+    // ========================================================================
+
+    /// Call fn(const BinaryLogRecord&, std::span<const char> payload) on
+    /// up to max records; the payload is valid during the call only
+    /// @return Records consumed
+    template <typename Fn>
+    size_t drain(Fn&& fn, size_t max = SIZE_MAX) noexcept {
+        const uint64_t head = published_.load(std::memory_order_acquire);
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        size_t n = 0;
+        while (tail != head && n < max) {
+            const size_t offset = tail & mask_;
+            uint32_t length;
+            std::memcpy(&length, buffer_.get() + offset, sizeof(length));
+            if (length == WRAP) {
+                tail += capacity_ - offset;
+                continue;
+            }
+            BinaryLogRecord record;
+            std::memcpy(&record, buffer_.get() + offset, sizeof(record));
+            fn(record, std::span<const char>{buffer_.get() + offset + sizeof(record), record.length});
+            tail += detail::log_record_size(record.length);
+            ++n;
+        }
+        tail_.store(tail, std::memory_order_release);
+        return n;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return tail_.load(std::memory_order_acquire) == published_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint64_t written() const noexcept { return written_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    bool fail() noexcept {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<char[]> buffer_;
+
+    // Producer
+    alignas(CACHE_LINE_SIZE) uint64_t head_{0};
+    uint64_t cached_tail_{0};
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    // Consumer
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail_{0};
+};
+
+// ============================================================================
+// Binary Logger
+// ============================================================================
+
+/// Per-thread rings plus the backend thread writing them to one file
+class BinaryLogger {
+public:
+    struct Config {
+        size_t ring_bytes{4 * 1024 * 1024};               // Per producing thread
+        std::chrono::microseconds idle_sleep{100};        // Backend, nothing to write
+        size_t file_buffer_bytes{1 << 20};                // stdio buffer
+    };
+
+    struct Stats {
+        uint64_t logged{0};
+        uint64_t dropped{0};       // Ring full or record too large
+        uint64_t bytes_written{0}; // To the file, headers included
+        size_t rings{0};
+    };
+
+    explicit BinaryLogger(const char* path) : BinaryLogger{path, Config{}} {}
+
+    BinaryLogger(const char* path, Config config)
+        : config_{config}
+        , id_{next_id_.fetch_add(1, std::memory_order_relaxed) + 1}
+        , file_{std::fopen(path, "wb")}
+    {
+        if (!file_) return;
+        file_buffer_ = std::make_unique<char[]>(config_.file_buffer_bytes);
+        std::setvbuf(file_, file_buffer_.get(), _IOFBF, config_.file_buffer_bytes);
+        const BinaryLogFileHeader header{};
+        write_bytes(&header, sizeof(header));
+    }
+
+    ~BinaryLogger() {
+        stop();
+        if (file_) std::fclose(file_);
+    }
+
+    BinaryLogger(const BinaryLogger&) = delete;
+    BinaryLogger& operator=(const BinaryLogger&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return file_ != nullptr; }
+
+    /// Start the backend thread
+    /// @return false if already running or the file did not open
+    bool start() {
+        if (!file_ || running_.exchange(true)) return false;
+        RdtscClock::initialize();
+        worker_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    /// Stop the backend after writing everything logged so far
+    void stop() noexcept {
+        if (!running_.exchange(false)) return;
+        if (worker_.joinable()) worker_.join();
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // Producer (any thread; each gets a ring of its own)
+    // ========================================================================
+
+    /// Log one message: a rdtscp and two memcpys into this thread's ring
+    /// @return false if dropped
+    NFX_HOT bool log(LogDirection direction, uint16_t session_id,
+                     std::span<const char> bytes) noexcept {
+        return ring().try_write(direction, session_id, detail::rdtscp(), bytes);
+    }
+
+    /// This thread's ring, registered on first use
+    [[nodiscard]] BinaryLogRing& ring() noexcept {
+        thread_local ThreadRing cached;
+        if (cached.owner != id_) [[unlikely]] {
+            cached.ring = register_ring();
+            cached.owner = id_;
+        }
+        return *cached.ring;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] Stats stats() const {
+        std::lock_guard lock{rings_mutex_};
+        Stats s;
+        for (const auto& r : rings_) {
+            s.logged += r->written();
+            s.dropped += r->dropped();
+        }
+        s.bytes_written = bytes_written_.load(std::memory_order_relaxed);
+        s.rings = rings_.size();
+        return s;
+    }
+
+private:
+    struct ThreadRing {
+        uint64_t owner{0};
+        BinaryLogRing* ring{nullptr};
+    };
+
+    BinaryLogRing* register_ring() {
+        std::lock_guard lock{rings_mutex_};
+        return rings_.emplace_back(std::make_unique<BinaryLogRing>(config_.ring_bytes)).get();
+    }
+
+    void run() noexcept {
+        std::vector<BinaryLogRing*> rings;
+        while (running_.load(std::memory_order_acquire)) {
+            if (drain_all(rings) == 0) {
+                std::fflush(file_);
+                std::this_thread::sleep_for(config_.idle_sleep);
+            }
+        }
+        while (drain_all(rings) != 0) {}
+        std::fflush(file_);
+    }
+
+    size_t drain_all(std::vector<BinaryLogRing*>& rings) noexcept {
+        {
+            std::lock_guard lock{rings_mutex_};
+            if (rings.size() != rings_.size()) {
+                rings.clear();
+                for (const auto& r : rings_) rings.push_back(r.get());
+            }
+        }
+
+        const TscCalibration cal = RdtscClock::calibration();
+        size_t n = 0;
+        for (BinaryLogRing* r : rings) {
+            n += r->drain([&](const BinaryLogRecord& record, std::span<const char> payload) {
+                if (cal.base_tsc != written_calibration_.base_tsc) write_calibration(cal);
+                write_record(record, payload);
+            }, 1024);
+        }
+        return n;
+    }
+
+    void write_calibration(const TscCalibration& cal) noexcept {
+        const BinaryLogRecord record{sizeof(cal), 0,
+                                     static_cast<uint8_t>(LogDirection::Calibration), 0, 0};
+        write_record(record, std::span<const char>{reinterpret_cast<const char*>(&cal), sizeof(cal)});
+        written_calibration_ = cal;
+    }
+
+    void write_record(const BinaryLogRecord& record, std::span<const char> payload) noexcept {
+        static constexpr char ZEROS[8]{};
+        write_bytes(&record, sizeof(record));
+        write_bytes(payload.data(), payload.size());
+        write_bytes(ZEROS, detail::log_record_size(payload.size()) - sizeof(record) - payload.size());
+    }
+
+    void write_bytes(const void* data, size_t size) noexcept {
+        if (size == 0) return;
+        const size_t n = std::fwrite(data, 1, size, file_);
+        bytes_written_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    inline static std::atomic<uint64_t> next_id_{0};
+
+    Config config_;
+    const uint64_t id_;                   // Keys the thread_local ring cache
+    std::FILE* file_;
+    std::unique_ptr<char[]> file_buffer_;
+
+    mutable std::mutex rings_mutex_;      // Registration and stats only
+    std::vector<std::unique_ptr<BinaryLogRing>> rings_;
+
+    std::thread worker_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> bytes_written_{0};
+    TscCalibration written_calibration_{};  // Backend thread
+};
+
+// ============================================================================
+// Offline Decoder
+// ============================================================================
+
+/// One decoded message
+struct BinaryLogEntry {
+    LogDirection direction{LogDirection::Inbound};
+    uint16_t session_id{0};
+    uint64_t tsc{0};
+    Timestamp time{};            // From the calibration in force at tsc
+    std::string bytes;
+};
+
+/// Reads a file written by BinaryLogger (calibration records consumed)
+class BinaryLogReader {
+public:
+    explicit BinaryLogReader(const char* path) noexcept
+        : file_{std::fopen(path, "rb")}
+    {
+        BinaryLogFileHeader header;
+        valid_ = file_ && std::fread(&header, sizeof(header), 1, file_) == 1 &&
+                 header.magic == BinaryLogFileHeader::MAGIC &&
+                 header.version == BinaryLogFileHeader::VERSION &&
+                 header.record_header_size == sizeof(BinaryLogRecord);
+    }
+
+    ~BinaryLogReader() {
+        if (file_) std::fclose(file_);
+    }
+
+    BinaryLogReader(const BinaryLogReader&) = delete;
+    BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+    /// Header read and recognized
+    [[nodiscard]] bool is_valid() const noexcept { return valid_; }
+
+    /// @return false at end of file or on a truncated record
+    bool next(BinaryLogEntry& entry) {
+        while (valid_) {
+            BinaryLogRecord record;
+            if (std::fread(&record, sizeof(record), 1, file_) != 1) return false;
+            const size_t padded = detail::log_record_size(record.length) - sizeof(record);
+            entry.bytes.resize(padded);
+            if (padded && std::fread(entry.bytes.data(), 1, padded, file_) != padded) return false;
+            entry.bytes.resize(record.length);
+
+            if (record.direction == static_cast<uint8_t>(LogDirection::Calibration)) {
+                if (record.length == sizeof(calibration_)) {
+                    std::memcpy(&calibration_, entry.bytes.data(), sizeof(calibration_));
+                }
+                continue;
+            }
+
+            entry.direction = static_cast<LogDirection>(record.direction);
+            entry.session_id = record.session_id;
+            entry.tsc = record.tsc;
+            entry.time = Timestamp{calibration_.mult
+                ? static_cast<int64_t>(RdtscClock::to_ns(calibration_, record.tsc)) : 0};
+            return true;
+        }
+        return false;
+    }
+
+private:
+    std::FILE* file_;
+    bool valid_{false};
+    TscCalibration calibration_{};
+};
+
+/// Render entry as one line, replacing out:
+/// "<UTC timestamp, ns> <I|O> <session id> <message, SOH as '|'>"
+inline void format_log_entry(const BinaryLogEntry& entry, std::string& out) {
+    UtcTimestampText text;
+    out.assign(format_utc_timestamp(entry.time, text, 9));
+    out += ' ';
+    out += static_cast<char>(entry.direction);
+    out += ' ';
+    out += std::to_string(entry.session_id);
+    out += ' ';
+    const size_t start = out.size();
+    out += entry.bytes;
+    std::replace(out.begin() + static_cast<std::ptrdiff_t>(start), out.end(), '\x01', '|');
+}
+
+} // namespace nfx::util
@@ -18,19 +18,26 @@
 
         // Get available cores for FIX processing
         auto cores = nfx::util::CpuAffinity::get_available_cores();
+
+        // NUMA node of a core (bind its memory with memory/numa.hpp)
+        int node = nfx::util::CpuAffinity::get_numa_node(core);
 */
 
 #pragma once
 
 #include <cstdint>
+#include <cstdio>
 #include <vector>
 #include <thread>
 #include <optional>
+#include <string_view>
 
 #if defined(__linux__)
     #include <sched.h>
     #include <pthread.h>
     #include <unistd.h>
+    #include <fcntl.h>
+    #include <dirent.h>
     #define NFX_HAS_CPU_AFFINITY 1
 #elif defined(__APPLE__)
     #include <pthread.h>
@@ -74,6 +81,20 @@ struct CpuAffinityConfig {
 
         return config;
     }
+
+    /// Default config restricted to the cores of one NUMA node
+    /// Falls back to default_config() when the node has no usable cores
+    static CpuAffinityConfig for_numa_node(int node) noexcept;
+
+    /// Take a core out of allowed_cores for a dedicated poller (e.g. an
+    /// io_uring SQPOLL thread), so sessions are never mapped onto it
+    /// @return The highest allowed core, or -1 if only one is left
+    [[nodiscard]] int reserve_core() noexcept {
+        if (allowed_cores.size() < 2) return -1;
+        int core = allowed_cores.back();
+        allowed_cores.pop_back();
+        return core;
+    }
 };
 
 // ============================================================================
@@ -240,26 +261,100 @@ public:
     // ========================================================================
 
     /// Get NUMA node for a given CPU core
+    /// @return Node number, or -1 if unknown / not supported
     [[nodiscard]] static int get_numa_node([[maybe_unused]] int core_id) noexcept {
 #if defined(__linux__)
-        // Read from /sys/devices/system/cpu/cpuN/node*
-        // For simplicity, return -1 (unknown)
-        // In production, parse /sys/devices/system/node/nodeN/cpulist
-        return -1;
+        // sysfs lists the node as a "nodeN" entry in the core's directory
+        char path[64];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", core_id);
+        DIR* dir = ::opendir(path);
+        if (!dir) return -1;
+
+        int node = -1;
+        while (auto* entry = ::readdir(dir)) {
+            int n = parse_node_name(entry->d_name);
+            if (n >= 0) {
+                node = n;
+                break;
+            }
+        }
+        ::closedir(dir);
+        return node;
 #else
         return -1;
 #endif
     }
 
+    /// NUMA node of the core the calling thread is running on
+    [[nodiscard]] static int current_numa_node() noexcept {
+        return get_numa_node(current_core());
+    }
+
+    /// Number of NUMA nodes (1 when the topology is not exposed)
+    [[nodiscard]] static int numa_node_count() noexcept {
+#if defined(__linux__)
+        DIR* dir = ::opendir("/sys/devices/system/node");
+        if (!dir) return 1;
+
+        int count = 0;
+        while (auto* entry = ::readdir(dir)) {
+            if (parse_node_name(entry->d_name) >= 0) ++count;
+        }
+        ::closedir(dir);
+        return count > 0 ? count : 1;
+#else
+        return 1;
+#endif
+    }
+
     /// Get cores on a specific NUMA node
     [[nodiscard]] static std::vector<int> cores_on_numa_node(
         [[maybe_unused]] int node_id) noexcept
     {
         std::vector<int> cores;
-        // In production, parse /sys/devices/system/node/nodeN/cpulist
+#if defined(__linux__)
+        char path[64];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node_id);
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return cores;
+
+        char buf[4096];
+        ssize_t n = ::read(fd, buf, sizeof(buf) - 1);
+        ::close(fd);
+        if (n <= 0) return cores;
+
+        parse_cpu_list(std::string_view{buf, static_cast<size_t>(n)}, cores);
+#endif
         return cores;
     }
 
+    /// Parse a kernel cpulist ("0-3,8,10-11") into core IDs
+    static void parse_cpu_list(std::string_view list, std::vector<int>& out) noexcept {
+        size_t i = 0;
+        auto read_int = [&](int& value) {
+            if (i >= list.size() || list[i] < '0' || list[i] > '9') return false;
+            value = 0;
+            while (i < list.size() && list[i] >= '0' && list[i] <= '9') {
+                value = value * 10 + (list[i++] - '0');
+            }
+            return true;
+        };
+
+        while (i < list.size()) {
+            int first = 0;
+            if (!read_int(first)) break;
+            int last = first;
+            if (i < list.size() && list[i] == '-') {
+                ++i;
+                if (!read_int(last)) break;
+            }
+            for (int core = first; core <= last; ++core) {
+                out.push_back(core);
+            }
+            if (i < list.size() && list[i] == ',') ++i;
+        }
+    }
+
     // ========================================================================
     // Thread Priority
     // ========================================================================
@@ -288,8 +383,41 @@ public:
         return false;
 #endif
     }
+
+private:
+    /// "node12" -> 12, anything else -> -1
+    [[nodiscard]] static int parse_node_name(const char* name) noexcept {
+        std::string_view sv{name};
+        if (sv.size() < 5 || sv.substr(0, 4) != "node") return -1;
+        int node = 0;
+        for (char c : sv.substr(4)) {
+            if (c < '0' || c > '9') return -1;
+            node = node * 10 + (c - '0');
+        }
+        return node;
+    }
 };
 
+inline CpuAffinityConfig CpuAffinityConfig::for_numa_node(int node) noexcept {
+    CpuAffinityConfig config = default_config();
+    std::vector<int> on_node = CpuAffinity::cores_on_numa_node(node);
+
+    std::vector<int> cores;
+    for (int core : config.allowed_cores) {
+        for (int c : on_node) {
+            if (c == core) {
+                cores.push_back(core);
+                break;
+            }
+        }
+    }
+    if (cores.empty()) return config;
+
+    config.allowed_cores = std::move(cores);
+    config.numa_node = node;
+    return config;
+}
+
 // ============================================================================
 // Session Core Mapper
 // ============================================================================
@@ -322,6 +450,17 @@ public:
         return config_.allowed_cores[index];
     }
 
+    /// NUMA node of the core a session maps to (-1 if unknown)
+    /// Use it to place the session's store pool and buffers, e.g. with
+    /// memory::NumaMemoryResource.
+    [[nodiscard]] int numa_node_for_session(
+        std::string_view sender_comp_id,
+        std::string_view target_comp_id) const noexcept
+    {
+        int core = core_for_session(sender_comp_id, target_comp_id);
+        return core < 0 ? -1 : CpuAffinity::get_numa_node(core);
+    }
+
     /// Pin current thread for session
     [[nodiscard]] AffinityResult pin_for_session(
         std::string_view sender_comp_id,
@@ -32,19 +32,39 @@
 
         // Shutdown
         processor.stop();
+
+    Fixed slots copy and reserve MaxSize bytes per message: the default
+    DeferredFIXProcessor preallocates 65536 x 4 KiB = 256 MiB, and a
+    90-byte heartbeat still occupies a 4 KiB slot. DeferredByteProcessor
+    packs variable-length records into a byte ring instead, so memory
+    scales with the bytes actually queued:
+
+        DeferredByteProcessor processor{16 * 1024 * 1024};   // 16 MiB ring
+        processor.start([](const DeferredRecordView& msg) {
+            full_parse(msg.span());
+        });
+        processor.submit(message_data);
+
+    Work that needs more than one background core: DeferredWorkerPool
+    (deferred_worker_pool.hpp).
 */
 
 #pragma once
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/util/sharded_counter.hpp"
 
 #include <thread>
 #include <atomic>
+#include <algorithm>
+#include <bit>
 #include <functional>
 #include <cstring>
 #include <chrono>
+#include <memory>
 #include <span>
+#include <vector>
 
 namespace nfx::util {
 
@@ -163,10 +183,16 @@ public:
             timestamp = rdtsc();
         }
 
-        BufferType buffer;
-        buffer.set(data, timestamp);
-
-        return queue_.try_push(std::move(buffer));
+        // Serialize straight into the ring slot: no BufferType-sized copy
+        auto slot = queue_.try_claim();
+        if (!slot) {
+            counters_.add(QUEUE_FULL);
+            return false;
+        }
+        slot->set(data, timestamp);
+        queue_.commit(slot);
+        counters_.add(SUBMITTED);
+        return true;
     }
 
     /// Submit with spin wait (guaranteed delivery, may block)
@@ -176,31 +202,37 @@ public:
             timestamp = rdtsc();
         }
 
-        BufferType buffer;
-        buffer.set(data, timestamp);
-
-        queue_.push(std::move(buffer));
+        auto slot = queue_.claim();
+        slot->set(data, timestamp);
+        queue_.commit(slot);
+        counters_.add(SUBMITTED);
     }
 
-    /// Get slot for in-place construction (advanced usage)
-    /// Must call publish() after filling the slot
+    /// Get a queue slot for in-place construction (advanced usage)
+    /// The pointer is into the ring itself, so builders can serialize
+    /// directly into it. Must call publish_slot() after filling the slot.
+    /// @return nullptr if a slot is already reserved or the queue is full
     [[nodiscard]] NFX_HOT
     BufferType* try_reserve_slot() noexcept {
-        // For in-place construction, caller fills buffer directly
-        // This avoids one copy on hot path
-        return reserved_slot_.has_value() ? nullptr : &reserved_slot_.emplace();
+        if (reserved_slot_) {
+            return nullptr;
+        }
+        reserved_slot_ = queue_.try_claim();
+        return reserved_slot_.slot;
     }
 
-    /// Publish reserved slot
+    /// Publish reserved slot to the background thread
+    /// @return false if no slot was reserved
     NFX_HOT
     bool publish_slot() noexcept {
-        if (!reserved_slot_.has_value()) {
+        if (!reserved_slot_) {
             return false;
         }
 
-        bool ok = queue_.try_push(std::move(*reserved_slot_));
-        reserved_slot_.reset();
-        return ok;
+        queue_.commit(reserved_slot_);
+        reserved_slot_ = {};
+        counters_.add(SUBMITTED);
+        return true;
     }
 
     // ========================================================================
@@ -216,8 +248,15 @@ public:
         uint64_t total_latency_cycles{0};  // Sum of processing latencies
     };
 
+    /// Snapshot of the counters (any thread, lock-free)
     [[nodiscard]] Stats stats() const noexcept {
-        return stats_;
+        return Stats{
+            .messages_submitted = counters_.value(SUBMITTED),
+            .messages_processed = counters_.value(PROCESSED),
+            .queue_full_count = counters_.value(QUEUE_FULL),
+            .max_queue_depth = max_queue_depth_.load(std::memory_order_relaxed),
+            .total_latency_cycles = 0
+        };
     }
 
     [[nodiscard]] size_t queue_depth() const noexcept {
@@ -245,17 +284,19 @@ private:
 
     void process_loop() noexcept {
         while (running_.load(std::memory_order_relaxed) || drain_on_stop_) {
-            BufferType buffer;
-            if (queue_.try_pop(buffer)) {
+            // Process in place; the slot is released after the callback
+            const bool consumed = queue_.try_consume([this](const BufferType& buffer) {
                 if (callback_) {
                     callback_(buffer);
                 }
-                ++stats_.messages_processed;
-
-                // Track max queue depth
-                size_t depth = queue_.size_approx();
-                if (depth > stats_.max_queue_depth) {
-                    stats_.max_queue_depth = depth;
+            });
+            if (consumed) {
+                counters_.add(PROCESSED);
+
+                // Track max queue depth (written by this thread only)
+                const uint64_t depth = queue_.size_approx();
+                if (depth > max_queue_depth_.load(std::memory_order_relaxed)) {
+                    max_queue_depth_.store(depth, std::memory_order_relaxed);
                 }
             } else {
                 if (!running_.load(std::memory_order_relaxed)) {
@@ -284,7 +325,7 @@ private:
                 if (batch_callback_) {
                     batch_callback_(batch);
                 }
-                stats_.messages_processed += batch.size();
+                counters_.add(PROCESSED, batch.size());
             } else {
                 if (!running_.load(std::memory_order_relaxed)) {
                     break;
@@ -307,9 +348,12 @@ private:
     size_t max_batch_size_{64};
 
     std::thread worker_;
-    std::optional<BufferType> reserved_slot_;
+    memory::SlotClaim<BufferType> reserved_slot_;
 
-    mutable Stats stats_;
+    // Submitting and worker threads each bump their own shard
+    enum : size_t { SUBMITTED, PROCESSED, QUEUE_FULL, COUNTERS };
+    ShardedCounters<COUNTERS> counters_;
+    std::atomic<uint64_t> max_queue_depth_{0};
 };
 
 // ============================================================================
@@ -325,6 +369,423 @@ using HighThroughputProcessor = DeferredProcessor<DeferredMessageBuffer<4096>, 2
 /// Compact processor for low-latency scenarios
 using CompactProcessor = DeferredProcessor<DeferredMessageBuffer<512>, 16384>;
 
+// ============================================================================
+// Deferred Byte Ring
+// ============================================================================
+
+/// Record header in a DeferredByteRing
+struct DeferredRecordHeader {
+    uint32_t size;        // Payload bytes (WRAP marks the rest of the ring unused)
+    uint32_t reserved;
+    uint64_t timestamp;   // RDTSC timestamp when submitted
+};
+
+static_assert(sizeof(DeferredRecordHeader) == 16);
+
+/// One record as seen by the consumer; data is valid during the callback only
+struct DeferredRecordView {
+    uint64_t timestamp;
+    uint32_t size;
+    const char* data;
+
+    [[nodiscard]] std::span<const char> span() const noexcept {
+        return {data, size};
+    }
+};
+
+/// SPSC ring of variable-length [header | payload] records
+/// Records are packed contiguously and padded to a cache line, so the
+/// producer writing one record never shares a line with the consumer
+/// reading the previous one. A record never wraps: one that would is
+/// preceded by a WRAP marker and starts at offset 0.
+class DeferredByteRing {
+public:
+    static constexpr uint32_t WRAP = UINT32_MAX;
+
+    /// @param capacity Bytes, rounded up to a power of two (>= 4 KiB)
+    explicit DeferredByteRing(size_t capacity)
+        : capacity_{std::bit_ceil(std::max<size_t>(capacity, 4096))}
+        , mask_{capacity_ - 1}
+        , lines_{std::make_unique<CacheLine[]>(capacity_ / CACHE_LINE_SIZE)}
+        , buffer_{reinterpret_cast<char*>(lines_.get())} {}
+
+    DeferredByteRing(const DeferredByteRing&) = delete;
+    DeferredByteRing& operator=(const DeferredByteRing&) = delete;
+
+    /// Ring bytes a record with this payload occupies
+    [[nodiscard]] static constexpr size_t record_size(size_t payload) noexcept {
+        return (sizeof(DeferredRecordHeader) + payload + CACHE_LINE_SIZE - 1) &
+               ~(CACHE_LINE_SIZE - 1);
+    }
+
+    // ========================================================================
+    // Producer
+    // ========================================================================
+
+    /// Reserve room for a payload of up to max_size bytes, written in place
+    /// @return Payload start, nullptr if the ring is full or max_size
+    ///         larger than half of it
+    [[nodiscard]] NFX_HOT char* try_reserve(size_t max_size) noexcept {
+        const size_t need = record_size(max_size);
+        if (need > capacity_ / 2) [[unlikely]] return nullptr;
+
+        const size_t offset = head_ & mask_;
+        const size_t pad = capacity_ - offset < need ? capacity_ - offset : 0;
+        const uint64_t end = head_ + pad + need;
+        if (end - cached_tail_ > capacity_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (end - cached_tail_ > capacity_) return nullptr;
+        }
+
+        if (pad) {
+            std::memcpy(buffer_ + offset, &WRAP, sizeof(WRAP));
+            head_ += pad;
+        }
+        return buffer_ + (head_ & mask_) + sizeof(DeferredRecordHeader);
+    }
+
+    /// Publish the record reserved by try_reserve()
+    /// @param size Payload bytes written (at most the reserved max_size)
+    NFX_HOT void publish(size_t size, uint64_t timestamp) noexcept {
+        const DeferredRecordHeader header{static_cast<uint32_t>(size), 0, timestamp};
+        std::memcpy(buffer_ + (head_ & mask_), &header, sizeof(header));
+        head_ += record_size(size);
+        published_.store(head_, std::memory_order_release);
+    }
+
+    /// Copy one message in and publish it
+    /// @return false if the ring is full or the message larger than half of it
+    [[nodiscard]] NFX_HOT bool try_write(std::span<const char> data, uint64_t timestamp) noexcept {
+        char* dest = try_reserve(data.size());
+        if (!dest) return false;
+        std::memcpy(dest, data.data(), data.size());
+        publish(data.size(), timestamp);
+        return true;
+    }
+
+    // ========================================================================
+    // Consumer
+    // ========================================================================
+
+    /// Call fn(const DeferredRecordView&) on up to max records, then
+    /// release them all at once
+    /// @return Records consumed
+    template <typename Fn>
+    size_t consume(Fn&& fn, size_t max = SIZE_MAX) noexcept {
+        const uint64_t head = published_.load(std::memory_order_acquire);
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        size_t n = 0;
+        while (tail != head && n < max) {
+            const size_t offset = tail & mask_;
+            DeferredRecordHeader header;
+            std::memcpy(&header, buffer_ + offset, sizeof(header));
+            if (header.size == WRAP) {
+                tail += capacity_ - offset;
+                continue;
+            }
+            fn(DeferredRecordView{header.timestamp, header.size,
+                                  buffer_ + offset + sizeof(header)});
+            tail += record_size(header.size);
+            ++n;
+        }
+        if (tail != tail_.load(std::memory_order_relaxed)) {
+            tail_.store(tail, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+
+    /// Bytes queued, padding and wrap markers included (approximate)
+    [[nodiscard]] size_t bytes_used() const noexcept {
+        return static_cast<size_t>(published_.load(std::memory_order_acquire) -
+                                   tail_.load(std::memory_order_acquire));
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return tail_.load(std::memory_order_acquire) == published_.load(std::memory_order_acquire);
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) CacheLine {
+        char bytes[CACHE_LINE_SIZE];
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<CacheLine[]> lines_;
+    char* const buffer_;
+
+    // Producer
+    alignas(CACHE_LINE_SIZE) uint64_t head_{0};
+    uint64_t cached_tail_{0};
+    std::atomic<uint64_t> published_{0};
+
+    // Consumer
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail_{0};
+};
+
+// ============================================================================
+// Deferred Byte Processor
+// ============================================================================
+
+/// DeferredProcessor over a DeferredByteRing: same lifecycle and hot path,
+/// but each message costs its own size rounded up to a cache line instead
+/// of a fixed slot. Messages larger than half the ring are rejected.
+class DeferredByteProcessor {
+public:
+    static constexpr size_t DEFAULT_RING_BYTES = 16 * 1024 * 1024;
+
+    using ProcessCallback = std::function<void(const DeferredRecordView&)>;
+    using BatchCallback = std::function<void(std::span<const DeferredRecordView>)>;
+
+    explicit DeferredByteProcessor(size_t ring_bytes = DEFAULT_RING_BYTES)
+        : ring_{ring_bytes} {}
+
+    ~DeferredByteProcessor() {
+        stop();
+    }
+
+    // Non-copyable, non-movable
+    DeferredByteProcessor(const DeferredByteProcessor&) = delete;
+    DeferredByteProcessor& operator=(const DeferredByteProcessor&) = delete;
+    DeferredByteProcessor(DeferredByteProcessor&&) = delete;
+    DeferredByteProcessor& operator=(DeferredByteProcessor&&) = delete;
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Start background processing thread
+    /// @param callback Function to call for each deferred message
+    /// @return true if started, false if already running
+    bool start(ProcessCallback callback) noexcept {
+        if (running_.exchange(true)) {
+            return false;
+        }
+
+        callback_ = std::move(callback);
+        worker_ = std::thread([this] { process_loop(); });
+        return true;
+    }
+
+    /// Start with batch processing; the views point into the ring and are
+    /// released after the callback returns (no copy out)
+    /// @param batch_callback Function to call with batch of messages
+    /// @param max_batch_size Maximum messages per batch
+    bool start_batch(BatchCallback batch_callback, size_t max_batch_size = 64) {
+        if (running_.exchange(true)) {
+            return false;
+        }
+
+        batch_callback_ = std::move(batch_callback);
+        max_batch_size_ = max_batch_size;
+        batch_.reserve(max_batch_size);
+        worker_ = std::thread([this] { process_loop_batch(); });
+        return true;
+    }
+
+    /// Stop background processing
+    /// @param drain If true, process remaining messages before stopping
+    void stop(bool drain = true) noexcept {
+        if (!running_.exchange(false)) {
+            return;
+        }
+
+        drain_on_stop_ = drain;
+
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // Hot Path Interface
+    // ========================================================================
+
+    /// Submit message for deferred processing (HOT PATH)
+    /// @param data Message data to defer
+    /// @param timestamp Optional RDTSC timestamp (0 = auto)
+    /// @return true if submitted, false if the ring is full
+    [[nodiscard]] NFX_HOT
+    bool submit(std::span<const char> data, uint64_t timestamp = 0) noexcept {
+        if (timestamp == 0) {
+            timestamp = rdtsc();
+        }
+        if (!ring_.try_write(data, timestamp)) [[unlikely]] {
+            counters_.add(QUEUE_FULL);
+            return false;
+        }
+        counters_.add(SUBMITTED);
+        return true;
+    }
+
+    /// Submit with spin wait (may block; a message larger than half the
+    /// ring is dropped)
+    NFX_HOT
+    void submit_blocking(std::span<const char> data, uint64_t timestamp = 0) noexcept {
+        if (timestamp == 0) {
+            timestamp = rdtsc();
+        }
+        if (DeferredByteRing::record_size(data.size()) > ring_.capacity() / 2) [[unlikely]] {
+            counters_.add(QUEUE_FULL);
+            return;
+        }
+        while (!ring_.try_write(data, timestamp)) {
+            // Spin until the consumer frees room
+        }
+        counters_.add(SUBMITTED);
+    }
+
+    /// Reserve up to max_size payload bytes in the ring for in-place
+    /// serialization; must call publish() after writing
+    /// @return nullptr if a record is already reserved or the ring is full
+    [[nodiscard]] NFX_HOT
+    char* try_reserve(size_t max_size) noexcept {
+        if (reserved_) {
+            return nullptr;
+        }
+        char* dest = ring_.try_reserve(max_size);
+        reserved_ = dest != nullptr;
+        return dest;
+    }
+
+    /// Publish the reserved record
+    /// @param size Payload bytes actually written
+    /// @return false if no record was reserved
+    NFX_HOT
+    bool publish(size_t size, uint64_t timestamp = 0) noexcept {
+        if (!reserved_) {
+            return false;
+        }
+        ring_.publish(size, timestamp ? timestamp : rdtsc());
+        reserved_ = false;
+        counters_.add(SUBMITTED);
+        return true;
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    /// Statistics for monitoring
+    struct Stats {
+        uint64_t messages_submitted{0};    // Total submitted
+        uint64_t messages_processed{0};    // Total processed
+        uint64_t queue_full_count{0};      // Ring full or message too large
+    };
+
+    /// Snapshot of the counters (any thread, lock-free)
+    [[nodiscard]] Stats stats() const noexcept {
+        return Stats{
+            .messages_submitted = counters_.value(SUBMITTED),
+            .messages_processed = counters_.value(PROCESSED),
+            .queue_full_count = counters_.value(QUEUE_FULL)
+        };
+    }
+
+    /// Bytes queued (records rounded to cache lines)
+    [[nodiscard]] size_t queue_bytes() const noexcept {
+        return ring_.bytes_used();
+    }
+
+    [[nodiscard]] size_t ring_capacity() const noexcept {
+        return ring_.capacity();
+    }
+
+    [[nodiscard]] bool queue_empty() const noexcept {
+        return ring_.empty();
+    }
+
+private:
+    static uint64_t rdtsc() noexcept {
+        uint64_t lo, hi;
+        asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
+        return (hi << 32) | lo;
+    }
+
+    // ========================================================================
+    // Background Processing
+    // ========================================================================
+
+    void process_loop() noexcept {
+        while (running_.load(std::memory_order_relaxed) || drain_on_stop_) {
+            const size_t consumed = ring_.consume([this](const DeferredRecordView& record) {
+                if (callback_) {
+                    callback_(record);
+                }
+            }, max_batch_size_);
+            if (consumed != 0) {
+                counters_.add(PROCESSED, consumed);
+            } else {
+                if (!running_.load(std::memory_order_relaxed)) {
+                    break;  // Stopped and ring empty
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void process_loop_batch() noexcept {
+        while (running_.load(std::memory_order_relaxed) || drain_on_stop_) {
+            // Records stay in the ring until the batch callback returns
+            batch_.clear();
+            const size_t consumed = ring_.consume([this](const DeferredRecordView& record) {
+                batch_.push_back(record);
+                if (batch_.size() == max_batch_size_) {
+                    flush_batch();
+                }
+            }, SIZE_MAX);
+            if (!batch_.empty()) {
+                flush_batch();
+            }
+
+            if (consumed == 0) {
+                if (!running_.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void flush_batch() noexcept {
+        if (batch_callback_) {
+            batch_callback_(batch_);
+        }
+        counters_.add(PROCESSED, batch_.size());
+        batch_.clear();
+    }
+
+    // ========================================================================
+    // Member Variables
+    // ========================================================================
+
+    DeferredByteRing ring_;
+    std::atomic<bool> running_{false};
+    bool drain_on_stop_{true};
+    bool reserved_{false};
+
+    ProcessCallback callback_;
+    BatchCallback batch_callback_;
+    size_t max_batch_size_{64};
+    std::vector<DeferredRecordView> batch_;
+
+    std::thread worker_;
+
+    // Submitting and worker threads each bump their own shard
+    enum : size_t { SUBMITTED, PROCESSED, QUEUE_FULL, COUNTERS };
+    ShardedCounters<COUNTERS> counters_;
+};
+
 // ============================================================================
 // Deferred Callback Helper
 // ============================================================================
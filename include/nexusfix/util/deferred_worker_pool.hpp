@@ -0,0 +1,302 @@
+/*
+    NexusFIX Deferred Worker Pool
+
+    Multi-worker variant of DeferredProcessor for non-critical work that
+    outgrows one background core in bursts (analytics, risk recalculation,
+    persistence). A fixed pool of optionally pinned workers, each with a
+    Chase-Lev deque; idle workers steal from busy ones.
+
+    Architecture:
+                          +--> [inbox 0] -> [deque 0] -> worker 0 (core a)
+        hot path ---------+--> [inbox 1] -> [deque 1] -> worker 1 (core b)
+        submit(task)      |        ...          ^  steal
+        submit_keyed(k,t) +--> [keyed k % n] ---+--> FIFO, never stolen
+
+    - submit(): round-robin into the workers' SPSC inboxes. Each worker
+      moves its inbox into its own deque, pops newest first, and steals
+      oldest first from the others when it runs dry. No ordering.
+    - submit_keyed(): tasks with the same key (symbol, session id) go to
+      one worker's keyed queue and run in submission order; they are never
+      stolen, so per-key order holds.
+
+    The handler is a template parameter, not a std::function: it is
+    called as handler(task, worker_index) from every worker at once and
+    must be safe to run concurrently. Tasks are trivially copyable (a
+    pointer, an index, a small POD); submission is single-producer.
+
+    Usage:
+        struct RiskJob { uint32_t account; uint32_t instrument; };
+        auto recalc = [](const RiskJob& job, size_t) { risk.update(job); };
+
+        std::array cores{4, 5, 6, 7};
+        DeferredWorkerPool<RiskJob, decltype(recalc)> pool{recalc, 4, cores};
+        pool.start();
+
+        pool.submit(RiskJob{account, instrument});          // Any worker
+        pool.submit_keyed(symbol_hash, RiskJob{...});       // Ordered per symbol
+
+        pool.stop();                                        // Drains
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/memory/work_stealing_deque.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nfx::util {
+
+// ============================================================================
+// Deferred Worker Pool
+// ============================================================================
+
+/// Fixed pool of work-stealing workers behind a single-producer hot path
+/// @tparam Task Trivially copyable work item
+/// @tparam Handler Callable as handler(const Task&, size_t worker)
+/// @tparam QueueCapacity Per-worker inbox, keyed queue and deque capacity
+///         (must be power of 2)
+template<typename Task, typename Handler, size_t QueueCapacity = 4096>
+class DeferredWorkerPool {
+    static_assert(std::is_invocable_v<Handler&, const Task&, size_t>,
+                  "Handler must be callable as handler(const Task&, size_t worker)");
+
+public:
+    /// Statistics for monitoring (summed over workers)
+    struct Stats {
+        uint64_t messages_submitted{0};    // Total submitted
+        uint64_t messages_processed{0};    // Total processed
+        uint64_t messages_stolen{0};       // Processed by a worker that stole them
+        uint64_t queue_full_count{0};      // Submits rejected
+    };
+
+    /// @param handler Called for every task, from all workers concurrently
+    /// @param workers Worker threads (at least 1)
+    /// @param cores Core per worker (worker i pins to cores[i % size]);
+    ///        empty leaves the workers unpinned
+    DeferredWorkerPool(Handler handler, size_t workers, std::span<const int> cores = {})
+        : handler_{std::move(handler)}
+        , worker_count_{workers ? workers : 1}
+        , workers_{std::make_unique<Worker[]>(worker_count_)}
+        , cores_{cores.begin(), cores.end()} {}
+
+    ~DeferredWorkerPool() {
+        stop();
+    }
+
+    // Non-copyable, non-movable
+    DeferredWorkerPool(const DeferredWorkerPool&) = delete;
+    DeferredWorkerPool& operator=(const DeferredWorkerPool&) = delete;
+    DeferredWorkerPool(DeferredWorkerPool&&) = delete;
+    DeferredWorkerPool& operator=(DeferredWorkerPool&&) = delete;
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Start the worker threads
+    /// @return true if started, false if already running
+    bool start() {
+        if (running_.exchange(true)) {
+            return false;
+        }
+
+        for (size_t i = 0; i < worker_count_; ++i) {
+            workers_[i].thread = std::thread([this, i] { run(i); });
+        }
+        return true;
+    }
+
+    /// Stop the workers
+    /// @param drain If true, process everything submitted before stopping
+    void stop(bool drain = true) noexcept {
+        if (!running_.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        drain_on_stop_.store(drain, std::memory_order_relaxed);
+        running_.store(false, std::memory_order_release);
+
+        for (size_t i = 0; i < worker_count_; ++i) {
+            if (workers_[i].thread.joinable()) {
+                workers_[i].thread.join();
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // Hot Path Interface (single producer)
+    // ========================================================================
+
+    /// Submit an unordered task; any worker may run it
+    /// @return false if every worker's inbox is full
+    [[nodiscard]] NFX_HOT
+    bool submit(const Task& task) noexcept {
+        for (size_t attempt = 0; attempt < worker_count_; ++attempt) {
+            Worker& worker = workers_[next_];
+            next_ = next_ + 1 == worker_count_ ? 0 : next_ + 1;
+            if (worker.inbox.try_push(task)) {
+                ++submitted_;
+                return true;
+            }
+        }
+        ++rejected_;
+        return false;
+    }
+
+    /// Submit a task ordered with every other task of the same key
+    /// @param key Symbol hash, session id, ... (mapped to key % workers)
+    /// @return false if that worker's keyed queue is full
+    [[nodiscard]] NFX_HOT
+    bool submit_keyed(uint64_t key, const Task& task) noexcept {
+        if (!workers_[worker_for(key)].keyed.try_push(task)) {
+            ++rejected_;
+            return false;
+        }
+        ++submitted_;
+        return true;
+    }
+
+    /// Worker that runs the keyed tasks of key
+    [[nodiscard]] size_t worker_for(uint64_t key) const noexcept {
+        return static_cast<size_t>(key % worker_count_);
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] Stats stats() const noexcept {
+        Stats stats{submitted_, 0, 0, rejected_};
+        for (size_t i = 0; i < worker_count_; ++i) {
+            stats.messages_processed += workers_[i].processed.load(std::memory_order_relaxed);
+            stats.messages_stolen += workers_[i].stolen.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    /// Tasks processed by one worker
+    [[nodiscard]] uint64_t processed_by(size_t worker) const noexcept {
+        return workers_[worker].processed.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t worker_count() const noexcept {
+        return worker_count_;
+    }
+
+private:
+    struct Worker {
+        memory::SPSCQueue<Task, QueueCapacity> inbox;          // Unordered, moved into deque
+        memory::SPSCQueue<Task, QueueCapacity> keyed;          // Ordered, never stolen
+        memory::WorkStealingDeque<Task, QueueCapacity> deque;  // Stealable
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> stolen{0};
+        std::thread thread;
+    };
+
+    static constexpr size_t BATCH = 64;
+
+    // ========================================================================
+    // Background Processing
+    // ========================================================================
+
+    void run(size_t id) noexcept {
+        if (!cores_.empty()) {
+            (void)CpuAffinity::pin_to_core(cores_[id % cores_.size()]);
+        }
+
+        Worker& self = workers_[id];
+        size_t victim = id;
+        while (true) {
+            if (!running_.load(std::memory_order_acquire) &&
+                !drain_on_stop_.load(std::memory_order_relaxed)) {
+                break;
+            }
+            size_t done = 0;
+
+            // Keyed tasks first, in order
+            while (done < BATCH && self.keyed.try_consume([&](const Task& task) {
+                handler_(task, id);
+            })) {
+                ++done;
+            }
+
+            // Inbox into the deque, where idle workers can steal it
+            Task task;
+            while (!self.deque.full() && self.inbox.try_pop(task)) {
+                (void)self.deque.push(task);
+            }
+
+            size_t popped = 0;
+            while (popped < BATCH && self.deque.pop(task)) {
+                handler_(task, id);
+                ++popped;
+            }
+            done += popped;
+
+            // Out of work: steal the oldest task of another worker
+            if (done == 0 && worker_count_ > 1) {
+                for (size_t i = 1; i < worker_count_; ++i) {
+                    victim = victim + 1 == worker_count_ ? 0 : victim + 1;
+                    if (victim == id) {
+                        victim = victim + 1 == worker_count_ ? 0 : victim + 1;
+                    }
+                    if (workers_[victim].deque.steal(task)) {
+                        handler_(task, id);
+                        self.stolen.store(self.stolen.load(std::memory_order_relaxed) + 1,
+                                          std::memory_order_relaxed);
+                        done = 1;
+                        break;
+                    }
+                }
+            }
+
+            if (done != 0) {
+                self.processed.store(self.processed.load(std::memory_order_relaxed) + done,
+                                     std::memory_order_relaxed);
+                continue;
+            }
+
+            if (!running_.load(std::memory_order_acquire)) {
+                // Everything submitted before stop() is visible now: one
+                // more empty pass means this worker's queues are drained
+                if (self.keyed.empty() && self.inbox.empty() && self.deque.empty()) {
+                    break;
+                }
+                continue;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // ========================================================================
+    // Member Variables
+    // ========================================================================
+
+    Handler handler_;
+    const size_t worker_count_;
+    std::unique_ptr<Worker[]> workers_;
+    std::vector<int> cores_;
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> drain_on_stop_{true};
+
+    // Producer
+    size_t next_{0};
+    uint64_t submitted_{0};
+    uint64_t rejected_{0};
+};
+
+} // namespace nfx::util
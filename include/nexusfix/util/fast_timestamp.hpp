@@ -3,11 +3,18 @@
 
     Optimized for hot path usage:
     - Caches date/hour/minute/second portion
-    - Only updates milliseconds on fast path (~10ns)
+    - Only updates the fraction on fast path (~10ns)
     - Full update only when second changes (~200ns)
 
-    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm
+    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm (default)
     Example: 20260122-14:30:45.123
+
+    Microsecond and nanosecond precision (MiFID II RTS 25, venues that
+    require them) extend the fraction to 6 or 9 digits:
+        20260122-14:30:45.123456
+        20260122-14:30:45.123456789
+    The fraction is written in digit pairs from a lookup table, so each
+    precision is a fixed sequence of divides and 2-byte copies.
 */
 
 #pragma once
@@ -19,21 +26,96 @@
 
 namespace nfx::util {
 
+// ============================================================================
+// Precision
+// ============================================================================
+
+/// Fractional-second digits of a generated UTCTimestamp
+enum class TimestampPrecision : uint8_t {
+    Milliseconds = 3,
+    Microseconds = 6,
+    Nanoseconds = 9
+};
+
+/// Formatted length at precision ("YYYYMMDD-HH:MM:SS." + digits)
+[[nodiscard]] constexpr size_t timestamp_length(TimestampPrecision precision) noexcept {
+    return 18 + static_cast<size_t>(precision);
+}
+
+namespace detail {
+
+inline constexpr char TIMESTAMP_TEMPLATE[] = "00000000-00:00:00.000000000";
+
+inline constexpr char TIMESTAMP_DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline void put_digit_pair(char* out, uint32_t value) noexcept {
+    std::memcpy(out, TIMESTAMP_DIGIT_PAIRS + value * 2, 2);
+}
+
+/// Fraction of nanos (< 1e9) at out, precision digits
+inline void write_fraction(char* out, uint32_t nanos, TimestampPrecision precision) noexcept {
+    switch (precision) {
+        case TimestampPrecision::Milliseconds: {
+            const uint32_t ms = nanos / 1'000'000;
+            out[0] = static_cast<char>('0' + ms / 100);
+            put_digit_pair(out + 1, ms % 100);
+            return;
+        }
+        case TimestampPrecision::Microseconds: {
+            const uint32_t us = nanos / 1'000;
+            put_digit_pair(out, us / 10'000);
+            put_digit_pair(out + 2, us / 100 % 100);
+            put_digit_pair(out + 4, us % 100);
+            return;
+        }
+        case TimestampPrecision::Nanoseconds: {
+            const uint32_t low = nanos % 100'000'000;
+            out[0] = static_cast<char>('0' + nanos / 100'000'000);
+            put_digit_pair(out + 1, low / 1'000'000);
+            put_digit_pair(out + 3, low / 10'000 % 100);
+            put_digit_pair(out + 5, low / 100 % 100);
+            put_digit_pair(out + 7, low % 100);
+            return;
+        }
+    }
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Fast Timestamp (system_clock)
+// ============================================================================
+
 class FastTimestamp {
 public:
-    static constexpr size_t TIMESTAMP_LEN = 21;  // "YYYYMMDD-HH:MM:SS.mmm"
+    static constexpr size_t TIMESTAMP_LEN = 21;      // "YYYYMMDD-HH:MM:SS.mmm"
+    static constexpr size_t MAX_TIMESTAMP_LEN = 27;  // "YYYYMMDD-HH:MM:SS.nnnnnnnnn"
 
-    FastTimestamp() noexcept {
+    explicit FastTimestamp(TimestampPrecision precision = TimestampPrecision::Milliseconds) noexcept
+        : length_{timestamp_length(precision)}
+        , precision_{precision}
+    {
         // Initialize buffer with template
-        std::memcpy(buffer_, "00000000-00:00:00.000", TIMESTAMP_LEN);
-        buffer_[TIMESTAMP_LEN] = '\0';
+        std::memcpy(buffer_, detail::TIMESTAMP_TEMPLATE, MAX_TIMESTAMP_LEN);
+        buffer_[MAX_TIMESTAMP_LEN] = '\0';
 
         // Force initial update
         cached_second_ = std::chrono::sys_seconds{};
     }
 
+    [[nodiscard]] TimestampPrecision precision() const noexcept { return precision_; }
+    [[nodiscard]] size_t length() const noexcept { return length_; }
+
+    void set_precision(TimestampPrecision precision) noexcept {
+        precision_ = precision;
+        length_ = timestamp_length(precision);
+    }
+
     // Get current FIX-formatted timestamp
-    // Fast path: ~10ns (milliseconds only)
+    // Fast path: ~10ns (fraction only)
     // Slow path: ~200ns (full date/time update)
     [[nodiscard]] std::string_view get() noexcept {
         using namespace std::chrono;
@@ -47,11 +129,11 @@ public:
             cached_second_ = now_sec;
         }
 
-        // Fast path: only update milliseconds
-        auto ms = duration_cast<milliseconds>(now - now_sec).count();
-        update_milliseconds(static_cast<int>(ms));
+        // Fast path: only update the fraction
+        auto ns = duration_cast<nanoseconds>(now - now_sec).count();
+        detail::write_fraction(buffer_ + 18, static_cast<uint32_t>(ns), precision_);
 
-        return {buffer_, TIMESTAMP_LEN};
+        return {buffer_, length_};
     }
 
     // Get timestamp for a specific time point
@@ -65,21 +147,13 @@ public:
             cached_second_ = tp_sec;
         }
 
-        auto ms = duration_cast<milliseconds>(tp - tp_sec).count();
-        update_milliseconds(static_cast<int>(ms));
+        auto ns = duration_cast<nanoseconds>(tp - tp_sec).count();
+        detail::write_fraction(buffer_ + 18, static_cast<uint32_t>(ns), precision_);
 
-        return {buffer_, TIMESTAMP_LEN};
+        return {buffer_, length_};
     }
 
 private:
-    // Update milliseconds only (fast path)
-    // Buffer positions 18, 19, 20 = "mmm"
-    void update_milliseconds(int ms) noexcept {
-        buffer_[18] = '0' + static_cast<char>(ms / 100);
-        buffer_[19] = '0' + static_cast<char>((ms / 10) % 10);
-        buffer_[20] = '0' + static_cast<char>(ms % 10);
-    }
-
     // Update full timestamp (slow path)
     void update_full(std::chrono::sys_seconds tp) noexcept {
         using namespace std::chrono;
@@ -137,12 +211,14 @@ private:
         buffer_[16] = '0' + static_cast<char>(second % 10);
 
         // Position 17 is '.' (already set)
-        // Positions 18-20 are milliseconds (updated in fast path)
+        // Positions 18+ are the fraction (updated in fast path)
     }
 
     // Cache line aligned buffer for optimal performance
     alignas(64) char buffer_[32];  // Extra space for alignment padding
     std::chrono::sys_seconds cached_second_;
+    size_t length_;
+    TimestampPrecision precision_;
 };
 
 // Global instance for convenience (thread-local for thread safety)
@@ -14,6 +14,9 @@
         // Call before market open (e.g., during pre-trading session)
         nfx::util::warm_icache();
 
+    This covers the parser only; session/session_warmup.hpp drives a
+    whole SessionManager (routing, builders, store, send path).
+
     Implementation:
     - Executes parser hot paths with realistic message data
     - Uses atomic fence to prevent compiler from optimizing away
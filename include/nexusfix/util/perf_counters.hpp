@@ -0,0 +1,346 @@
+/*
+    NexusFIX Runtime Hardware Performance Counters
+
+    Per-thread perf_event counter groups read from userspace with rdpmc,
+    cheap enough to bracket individual regions (parse, dispatch, build)
+    on a live session thread.
+
+    open() creates the group for the calling thread and mmaps each
+    counter's perf_event_mmap_page. sample() then reads every counter
+    with one rdpmc each (~20-40 cycles), using the page's seqlock, index
+    and offset so values stay monotonic across context switches. When
+    the kernel does not allow rdpmc (cap_user_rdpmc = 0, e.g.
+    /sys/bus/event_source/devices/cpu/rdpmc = 0, or a VM without a vPMU)
+    sample() falls back to one read() of the whole group: correct, but
+    a syscall per sample.
+
+    Counters count user space only (exclude_kernel), which is also what
+    rdpmc needs under the default perf_event_paranoid.
+
+    Usage:
+        // On the session worker thread
+        util::ThreadPerfCounters counters;
+        if (counters.open(util::DEFAULT_PERF_EVENTS)) {
+            util::PerfSample before, after;
+            counters.sample(before);
+            parse();
+            counters.sample(after);             // after[i] - before[i] per event
+        }
+
+    See session/perf_profile.hpp for per-message-type aggregation.
+    The benchmark harness (benchmarks/include/perf_counters.hpp) uses the
+    same event definitions.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define NFX_HAS_PERF_EVENTS 1
+#else
+#define NFX_HAS_PERF_EVENTS 0
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// Performance Event Types
+// ============================================================================
+
+enum class PerfEvent : uint32_t {
+    // Hardware events
+    CpuCycles,
+    Instructions,
+    CacheReferences,
+    CacheMisses,
+    BranchInstructions,
+    BranchMisses,
+
+    // Cache events
+    L1dReadMiss,
+    L1dWriteMiss,
+    L1iReadMiss,
+    LLCReadMiss,
+    LLCWriteMiss,
+
+    // TLB events
+    DTlbReadMiss,
+    DTlbWriteMiss,
+    ITlbReadMiss
+};
+
+/// Get human-readable name for event
+[[nodiscard]] inline const char* event_name(PerfEvent event) noexcept {
+    switch (event) {
+        case PerfEvent::CpuCycles:          return "cpu-cycles";
+        case PerfEvent::Instructions:       return "instructions";
+        case PerfEvent::CacheReferences:    return "cache-references";
+        case PerfEvent::CacheMisses:        return "cache-misses";
+        case PerfEvent::BranchInstructions: return "branch-instructions";
+        case PerfEvent::BranchMisses:       return "branch-misses";
+        case PerfEvent::L1dReadMiss:        return "L1-dcache-read-misses";
+        case PerfEvent::L1dWriteMiss:       return "L1-dcache-write-misses";
+        case PerfEvent::L1iReadMiss:        return "L1-icache-read-misses";
+        case PerfEvent::LLCReadMiss:        return "LLC-read-misses";
+        case PerfEvent::LLCWriteMiss:       return "LLC-write-misses";
+        case PerfEvent::DTlbReadMiss:       return "dTLB-read-misses";
+        case PerfEvent::DTlbWriteMiss:      return "dTLB-write-misses";
+        case PerfEvent::ITlbReadMiss:       return "iTLB-read-misses";
+    }
+    return "unknown";
+}
+
+/// Counters one runtime group holds (PMUs have 4+ general counters)
+inline constexpr size_t MAX_PERF_EVENTS = 4;
+
+/// Default runtime set: IPC, cache and TLB misses
+inline constexpr std::array<PerfEvent, MAX_PERF_EVENTS> DEFAULT_PERF_EVENTS{
+    PerfEvent::CpuCycles, PerfEvent::Instructions,
+    PerfEvent::CacheMisses, PerfEvent::DTlbReadMiss};
+
+/// One reading of every counter in a group (unused slots stay 0)
+using PerfSample = std::array<uint64_t, MAX_PERF_EVENTS>;
+
+#if NFX_HAS_PERF_EVENTS
+
+namespace detail {
+
+/// Fill attr.type / attr.config for event
+/// @return false for events this kernel interface cannot express
+[[nodiscard]] inline bool configure_perf_event(PerfEvent event, perf_event_attr& attr) noexcept {
+    constexpr auto cache = [](uint64_t id, uint64_t op) {
+        return id | (op << 8) | (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+    };
+    switch (event) {
+        case PerfEvent::CpuCycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PerfEvent::Instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PerfEvent::CacheReferences:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_REFERENCES;
+            break;
+        case PerfEvent::CacheMisses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PerfEvent::BranchInstructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+            break;
+        case PerfEvent::BranchMisses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PerfEvent::L1dReadMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case PerfEvent::L1dWriteMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_WRITE);
+            break;
+        case PerfEvent::L1iReadMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_L1I, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case PerfEvent::LLCReadMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case PerfEvent::LLCWriteMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_WRITE);
+            break;
+        case PerfEvent::DTlbReadMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case PerfEvent::DTlbWriteMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_WRITE);
+            break;
+        case PerfEvent::ITlbReadMiss:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_ITLB, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+[[nodiscard]] inline int perf_event_open(perf_event_attr& attr, int group_fd) noexcept {
+    // This thread, any CPU
+    return static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+[[nodiscard]] inline uint64_t rdpmc(uint32_t counter) noexcept {
+    uint32_t lo, hi;
+    asm volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(counter));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+#define NFX_HAS_RDPMC 1
+#else
+#define NFX_HAS_RDPMC 0
+#endif
+
+} // namespace detail
+
+#endif // NFX_HAS_PERF_EVENTS
+
+// ============================================================================
+// Thread Performance Counters
+// ============================================================================
+
+/// Counter group for the thread that opened it
+/// sample() must be called on that thread (rdpmc reads the current CPU's
+/// PMU, which the kernel has loaded with this thread's counters).
+class ThreadPerfCounters {
+public:
+    ThreadPerfCounters() noexcept = default;
+    ~ThreadPerfCounters() { close(); }
+
+    ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+    ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+    /// Open a group counting events on the calling thread
+    /// Events beyond MAX_PERF_EVENTS are ignored.
+    /// @return false if perf_event_open failed for any event (no PMU
+    ///         access, perf_event_paranoid too strict, unsupported event)
+    bool open(std::span<const PerfEvent> events) noexcept {
+        close();
+#if NFX_HAS_PERF_EVENTS
+        for (const PerfEvent event : events) {
+            if (count_ == MAX_PERF_EVENTS) break;
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            if (!detail::configure_perf_event(event, attr)) {
+                close();
+                return false;
+            }
+            const int fd = detail::perf_event_open(attr, count_ == 0 ? -1 : fds_[0]);
+            if (fd < 0) {
+                close();
+                return false;
+            }
+            fds_[count_] = fd;
+            events_[count_] = event;
+            void* page = ::mmap(nullptr, static_cast<size_t>(::sysconf(_SC_PAGESIZE)),
+                                PROT_READ, MAP_SHARED, fd, 0);
+            pages_[count_] = page == MAP_FAILED ? nullptr
+                                                : static_cast<const perf_event_mmap_page*>(page);
+            ++count_;
+        }
+        userspace_ = NFX_HAS_RDPMC && count_ != 0;
+        for (size_t i = 0; i < count_; ++i) {
+            if (!pages_[i] || !pages_[i]->cap_user_rdpmc) userspace_ = false;
+        }
+        return count_ != 0;
+#else
+        (void)events;
+        return false;
+#endif
+    }
+
+    void close() noexcept {
+#if NFX_HAS_PERF_EVENTS
+        for (size_t i = 0; i < count_; ++i) {
+            if (pages_[i]) {
+                ::munmap(const_cast<perf_event_mmap_page*>(pages_[i]),
+                         static_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+            }
+            ::close(fds_[i]);
+            pages_[i] = nullptr;
+            fds_[i] = -1;
+        }
+#endif
+        count_ = 0;
+        userspace_ = false;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return count_ != 0; }
+
+    /// True if sample() reads with rdpmc (no syscall)
+    [[nodiscard]] bool userspace() const noexcept { return userspace_; }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+
+    [[nodiscard]] PerfEvent event(size_t i) const noexcept { return events_[i]; }
+
+    /// Read every counter; out[i] is the running count of event(i)
+    NFX_HOT void sample(PerfSample& out) const noexcept {
+#if NFX_HAS_PERF_EVENTS
+#if NFX_HAS_RDPMC
+        if (userspace_) [[likely]] {
+            for (size_t i = 0; i < count_; ++i) out[i] = read_rdpmc(*pages_[i]);
+            return;
+        }
+#endif
+        if (count_ != 0) read_group(out);
+#else
+        (void)out;
+#endif
+    }
+
+private:
+#if NFX_HAS_PERF_EVENTS
+#if NFX_HAS_RDPMC
+    /// Userspace read protocol of perf_event_mmap_page
+    [[nodiscard]] NFX_HOT static uint64_t read_rdpmc(const perf_event_mmap_page& pc) noexcept {
+        uint32_t seq;
+        uint64_t value;
+        do {
+            seq = pc.lock;
+            asm volatile("" ::: "memory");
+            const uint32_t index = pc.index;
+            value = static_cast<uint64_t>(pc.offset);
+            if (index != 0) [[likely]] {
+                const uint16_t width = pc.pmc_width;
+                int64_t count = static_cast<int64_t>(detail::rdpmc(index - 1));
+                count <<= 64 - width;      // Sign-extend the pmc_width-bit counter
+                count >>= 64 - width;
+                value += static_cast<uint64_t>(count);
+            }
+            asm volatile("" ::: "memory");
+        } while (pc.lock != seq);
+        return value;
+    }
+#endif
+
+    void read_group(PerfSample& out) const noexcept {
+        // PERF_FORMAT_GROUP: { nr, value[nr] }
+        std::array<uint64_t, 1 + MAX_PERF_EVENTS> buffer{};
+        const auto want = static_cast<ssize_t>((1 + count_) * sizeof(uint64_t));
+        if (::read(fds_[0], buffer.data(), static_cast<size_t>(want)) != want) return;
+        for (size_t i = 0; i < count_ && i < buffer[0]; ++i) out[i] = buffer[1 + i];
+    }
+
+    std::array<int, MAX_PERF_EVENTS> fds_{-1, -1, -1, -1};
+    std::array<const perf_event_mmap_page*, MAX_PERF_EVENTS> pages_{};
+#endif
+    std::array<PerfEvent, MAX_PERF_EVENTS> events_{};
+    size_t count_{0};
+    bool userspace_{false};
+};
+
+} // namespace nfx::util
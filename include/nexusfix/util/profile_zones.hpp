@@ -0,0 +1,147 @@
+/*
+    NexusFIX Profiling Zones
+
+    The engine is header-only and inlined into the handler, so a sampling
+    profiler attributes all of it to one frame. Named zones mark the engine
+    stages so sampled profiles can be split without turning off inlining:
+
+        parse     ParsedMessage::parse of an inbound message
+        dispatch  session handling and the handler callback
+        build     serializing an outbound message
+        store     persisting an outbound message for resend
+        submit    handing bytes to the transport (on_send)
+
+    Zones compile to nothing unless one backend is selected (CMake
+    NFX_PROFILE_ZONES=TRACY|ITT|USDT, or define the macro directly):
+
+        NFX_PROFILE_TRACY  Tracy zones (tracy/Tracy.hpp, link TracyClient)
+        NFX_PROFILE_ITT    Intel ITT tasks for VTune (ittnotify.h, link
+                           ittnotify); one "nexusfix" domain
+        NFX_PROFILE_USDT   USDT probes nexusfix:<zone>_begin / _end
+                           (sys/sdt.h, no runtime library). A disarmed
+                           probe is a single nop; perf and bpftrace arm them:
+                             perf probe -x ./app sdt_nexusfix:parse_begin
+                             perf record -e sdt_nexusfix:* -p <pid>
+                             bpftrace -e 'usdt:./app:nexusfix:parse_begin { ... }'
+
+    Usage (zone names are tokens, not strings):
+        NFX_ZONE_SCOPED(dispatch);   // until the end of the enclosing scope
+                                     // (one per scope)
+        NFX_ZONE_BEGIN(parse);       // explicit pair; both in one scope
+        auto result = ParsedMessage::parse(data);
+        NFX_ZONE_END(parse);
+*/
+
+#pragma once
+
+#if defined(NFX_PROFILE_TRACY)
+    #include <tracy/Tracy.hpp>
+    #include <tracy/TracyC.h>
+#elif defined(NFX_PROFILE_ITT)
+    #include <ittnotify.h>
+#elif defined(NFX_PROFILE_USDT)
+    #include <sys/sdt.h>
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// Backend Selection
+// ============================================================================
+
+#if defined(NFX_PROFILE_TRACY) || defined(NFX_PROFILE_ITT) || defined(NFX_PROFILE_USDT)
+inline constexpr bool PROFILE_ZONES_ENABLED = true;
+#else
+inline constexpr bool PROFILE_ZONES_ENABLED = false;
+#endif
+
+#if defined(NFX_PROFILE_ITT)
+
+namespace detail {
+
+inline __itt_domain* itt_domain() noexcept {
+    static __itt_domain* domain = __itt_domain_create("nexusfix");
+    return domain;
+}
+
+/// RAII task for NFX_ZONE_SCOPED
+struct IttScopedZone {
+    explicit IttScopedZone(__itt_string_handle* name) noexcept {
+        __itt_task_begin(itt_domain(), __itt_null, __itt_null, name);
+    }
+    ~IttScopedZone() { __itt_task_end(itt_domain()); }
+
+    IttScopedZone(const IttScopedZone&) = delete;
+    IttScopedZone& operator=(const IttScopedZone&) = delete;
+};
+
+}  // namespace detail
+
+#elif defined(NFX_PROFILE_USDT)
+
+namespace detail {
+
+/// RAII pair of probes for NFX_ZONE_SCOPED; the probe sites stay in the
+/// caller because the macros expand there
+template <typename Begin, typename End>
+struct UsdtScopedZone {
+    explicit UsdtScopedZone(Begin begin, End end) noexcept : end_{end} { begin(); }
+    ~UsdtScopedZone() { end_(); }
+
+    UsdtScopedZone(const UsdtScopedZone&) = delete;
+    UsdtScopedZone& operator=(const UsdtScopedZone&) = delete;
+
+private:
+    End end_;
+};
+
+}  // namespace detail
+
+#endif
+
+}  // namespace nfx::util
+
+// ============================================================================
+// Zone Macros
+// ============================================================================
+
+#define NFX_ZONE_CONCAT_IMPL(a, b) a##b
+#define NFX_ZONE_CONCAT(a, b) NFX_ZONE_CONCAT_IMPL(a, b)
+
+#if defined(NFX_PROFILE_TRACY)
+
+    #define NFX_ZONE_BEGIN(zone) TracyCZoneN(nfx_zone_##zone, #zone, 1)
+    #define NFX_ZONE_END(zone) TracyCZoneEnd(nfx_zone_##zone)
+    #define NFX_ZONE_SCOPED(zone) ZoneScopedN(#zone)
+
+#elif defined(NFX_PROFILE_ITT)
+
+    // One string handle per zone site, created on first use
+    #define NFX_ZONE_HANDLE(zone)                                                  \
+        [] {                                                                       \
+            static __itt_string_handle* handle = __itt_string_handle_create(#zone); \
+            return handle;                                                         \
+        }()
+    #define NFX_ZONE_BEGIN(zone)                                                   \
+        __itt_task_begin(::nfx::util::detail::itt_domain(), __itt_null, __itt_null, \
+                         NFX_ZONE_HANDLE(zone))
+    #define NFX_ZONE_END(zone) __itt_task_end(::nfx::util::detail::itt_domain())
+    #define NFX_ZONE_SCOPED(zone)                                                  \
+        ::nfx::util::detail::IttScopedZone NFX_ZONE_CONCAT(nfx_zone_, __LINE__){   \
+            NFX_ZONE_HANDLE(zone)}
+
+#elif defined(NFX_PROFILE_USDT)
+
+    #define NFX_ZONE_BEGIN(zone) DTRACE_PROBE(nexusfix, zone##_begin)
+    #define NFX_ZONE_END(zone) DTRACE_PROBE(nexusfix, zone##_end)
+    #define NFX_ZONE_SCOPED(zone)                                                  \
+        ::nfx::util::detail::UsdtScopedZone NFX_ZONE_CONCAT(nfx_zone_, __LINE__){  \
+            [] { NFX_ZONE_BEGIN(zone); }, [] { NFX_ZONE_END(zone); }}
+
+#else
+
+    #define NFX_ZONE_BEGIN(zone) ((void)0)
+    #define NFX_ZONE_END(zone) ((void)0)
+    #define NFX_ZONE_SCOPED(zone) ((void)0)
+
+#endif
@@ -28,6 +28,8 @@
 #include <span>
 #include <cstdint>
 
+#include "nexusfix/parser/tag_decoder.hpp"
+
 namespace nfx::util {
 
 // ============================================================================
@@ -250,12 +252,9 @@ public:
             auto eq_pos = data_.find('=');
             if (eq_pos == std::string_view::npos) return {0, {}};
 
-            int tag = 0;
-            for (auto i = 0uz; i < eq_pos; ++i) {
-                char c = data_[i];
-                if (c < '0' || c > '9') return {0, {}};
-                tag = tag * 10 + (c - '0');
-            }
+            int tag = parser::decode_tag(
+                std::span<const char>{data_.data(), data_.size()}, 0, eq_pos);
+            if (tag == parser::INVALID_TAG) return {0, {}};
 
             auto soh_pos = data_.find('\x01', eq_pos + 1);
             if (soh_pos == std::string_view::npos) soh_pos = data_.size();
@@ -3,10 +3,12 @@
 
     Inspired by Quill logging library's approach:
     - Uses RDTSC for minimal latency (~10ns vs ~50ns for chrono)
-    - Periodic calibration to maintain accuracy
+    - Fixed-point mult/shift conversion, calibration behind a seqlock
+    - Periodic calibration to maintain accuracy (start_recalibration())
     - Zero syscall on hot path
 
-    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm
+    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm, or .uuuuuu / .nnnnnnnnn
+    at TimestampPrecision::Microseconds / Nanoseconds (fast_timestamp.hpp)
     Example: 20260122-14:30:45.123
 */
 
@@ -17,8 +19,21 @@
 #include <string_view>
 #include <chrono>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/fast_timestamp.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define NFX_RDTSC_HAS_CPUID 1
+#else
+#define NFX_RDTSC_HAS_CPUID 0
+#endif
+
 namespace nfx::util {
 
 // ============================================================================
@@ -45,60 +60,212 @@ inline void compiler_barrier() noexcept {
 // RDTSC Clock (calibrated)
 // ============================================================================
 
-/// High-performance clock using RDTSC with periodic calibration
+/// TSC capabilities reported by CPUID
+struct TscFeatures {
+    bool invariant{false};     // CPUID.80000007H:EDX[8]: constant rate, runs in all C/P-states
+    bool constant{false};      // Constant rate across P-states (Linux constant_tsc)
+    uint64_t nominal_hz{0};    // CPUID.15H crystal ratio, 0 if not enumerated
+};
+
+/// TSC-to-ns conversion, shared by RdtscClock through a seqlock
+struct TscCalibration {
+    uint64_t base_tsc{0};
+    uint64_t base_ns{0};     // system_clock ns since epoch at base_tsc
+    uint64_t mult{0};        // ns per cycle << RdtscClock::SHIFT; 0 = not calibrated
+};
+
+namespace detail {
+
+[[nodiscard]] inline TscFeatures detect_tsc_features() noexcept {
+    TscFeatures f;
+#if NFX_RDTSC_HAS_CPUID
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        f.invariant = (edx & (1u << 8)) != 0;
+    }
+    // Invariant implies constant; without it, family 6 (Core and later)
+    // and family 15 model >= 3 still tick at a constant rate (the
+    // kernel's constant_tsc rule)
+    f.constant = f.invariant;
+    if (!f.constant && __get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        const unsigned family = (eax >> 8) & 0xF;
+        const unsigned model = ((eax >> 4) & 0xF) | (((eax >> 16) & 0xF) << 4);
+        unsigned vendor_ebx = 0;
+        __get_cpuid(0, &eax, &vendor_ebx, &ecx, &edx);
+        const bool intel = vendor_ebx == 0x756e6547;   // "Genu"
+        f.constant = intel && (family == 6 || (family == 15 && model >= 3));
+    }
+    if (__get_cpuid_count(0x15, 0, &eax, &ebx, &ecx, &edx) && eax != 0 && ebx != 0 && ecx != 0) {
+        f.nominal_hz = static_cast<uint64_t>(ecx) * ebx / eax;
+    }
+#endif
+    return f;
+}
+
+} // namespace detail
+
+/// High-performance clock using RDTSC
+///
+/// now_ns() = base_ns + ((tsc - base_tsc) * mult) >> SHIFT, one multiply
+/// on calibration read from a seqlock, so readers on any thread see a
+/// consistent (base, mult) pair without locking.
+///
+/// Frequency: CPUID leaf 15H when enumerated, else measured over 10ms,
+/// then refined by every calibrate() against steady_clock over the whole
+/// window since initialize(), so its error shrinks as the process runs.
+/// Each calibrate() also rebases onto system_clock; drift_ns() reports
+/// how far the clock had wandered from it since the previous rebase.
+///
+/// Writers (calibrate(), the recalibration thread) are serialized by a
+/// mutex; now_ns() never takes it. On a CPU without invariant TSC the
+/// rate changes with frequency scaling: keep the recalibration period
+/// short or use chrono instead.
 class RdtscClock {
 public:
+    static constexpr uint32_t SHIFT = 32;
+
+    using Calibration = TscCalibration;
+
     /// Initialize and calibrate the clock
-    /// Should be called once at startup
+    /// Should be called once at startup (now_ns() does it on first use)
     static void initialize() noexcept {
-        calibrate();
+        std::lock_guard lock{writer_mutex_};
+        if (calibration_.read().mult == 0) calibrate_locked();
     }
 
     /// Get current nanoseconds since epoch (fast path)
-    /// ~10ns latency, no syscall
-    [[nodiscard]] static uint64_t now_ns() noexcept {
-        uint64_t tsc = detail::rdtscp();
-        uint64_t base_ns = base_ns_.load(std::memory_order_relaxed);
-        uint64_t base_tsc = base_tsc_.load(std::memory_order_relaxed);
-        double freq = freq_ghz_.load(std::memory_order_relaxed);
-
-        // Calculate nanoseconds from TSC delta
-        int64_t delta_tsc = static_cast<int64_t>(tsc - base_tsc);
-        int64_t delta_ns = static_cast<int64_t>(static_cast<double>(delta_tsc) / freq);
+    /// No syscall, no division
+    [[nodiscard]] NFX_HOT static uint64_t now_ns() noexcept {
+        const Calibration cal = calibration_.read();
+        if (cal.mult == 0) [[unlikely]] {
+            initialize();
+            return now_ns();
+        }
+        return to_ns(cal, detail::rdtscp());
+    }
 
-        return base_ns + delta_ns;
+    /// Convert a TSC reading with the given calibration
+    [[nodiscard]] static constexpr uint64_t to_ns(const Calibration& cal, uint64_t tsc) noexcept {
+        const int64_t delta = static_cast<int64_t>(tsc - cal.base_tsc);
+#if defined(__SIZEOF_INT128__)
+        __extension__ using Int128 = __int128;   // -Wpedantic: GCC/Clang extension
+        const Int128 scaled = (static_cast<Int128>(delta) * cal.mult) >> SHIFT;
+        return cal.base_ns + static_cast<uint64_t>(static_cast<int64_t>(scaled));
+#else
+        const long double scaled = static_cast<long double>(delta) * cal.mult / (1ULL << SHIFT);
+        return cal.base_ns + static_cast<uint64_t>(static_cast<int64_t>(scaled));
+#endif
     }
 
-    /// Recalibrate (call periodically, e.g., every second)
-    /// This syncs with system clock to prevent drift
+    /// Rebase onto system_clock and refine the frequency
+    /// Cheap enough for once a second; prefer start_recalibration()
     static void calibrate() noexcept {
-        using namespace std::chrono;
+        std::lock_guard lock{writer_mutex_};
+        calibrate_locked();
+    }
 
-        // Get system time and TSC together
-        auto sys_time = system_clock::now();
-        uint64_t tsc = detail::rdtscp();
+    /// Get CPU frequency in GHz
+    [[nodiscard]] static double frequency_ghz() noexcept {
+        const uint64_t mult = calibration_.read().mult;
+        return mult ? static_cast<double>(1ULL << SHIFT) / static_cast<double>(mult) : 0.0;
+    }
 
-        // Convert to nanoseconds since epoch
-        auto ns = duration_cast<nanoseconds>(sys_time.time_since_epoch()).count();
+    [[nodiscard]] static Calibration calibration() noexcept { return calibration_.read(); }
 
-        base_ns_.store(static_cast<uint64_t>(ns), std::memory_order_relaxed);
-        base_tsc_.store(tsc, std::memory_order_relaxed);
+    /// now_ns() minus system_clock at the last calibrate(), before rebasing
+    [[nodiscard]] static int64_t drift_ns() noexcept {
+        return drift_ns_.load(std::memory_order_relaxed);
+    }
 
-        // Estimate frequency if not done yet
-        if (freq_ghz_.load(std::memory_order_relaxed) == 0.0) {
-            estimate_frequency();
+    [[nodiscard]] static const TscFeatures& features() noexcept {
+        static const TscFeatures f = detail::detect_tsc_features();
+        return f;
+    }
+
+    // ========================================================================
+    // Background Recalibration
+    // ========================================================================
+
+    /// Recalibrate every period on a thread of its own, bounding drift to
+    /// what accumulates in one period
+    /// @return false if already running
+    static bool start_recalibration(std::chrono::milliseconds period = std::chrono::seconds{1}) {
+        std::lock_guard lock{thread_mutex_};
+        if (recalibrating_.exchange(true)) return false;
+        initialize();
+        recalibrator_.thread = std::thread([period] {
+            std::unique_lock wait_lock{thread_mutex_};
+            while (!stop_cv_.wait_for(wait_lock, period,
+                                      [] { return !recalibrating_.load(std::memory_order_relaxed); })) {
+                calibrate();
+            }
+        });
+        return true;
+    }
+
+    static void stop_recalibration() noexcept {
+        {
+            std::lock_guard lock{thread_mutex_};
+            if (!recalibrating_.exchange(false)) return;
         }
+        stop_cv_.notify_all();
+        if (recalibrator_.thread.joinable()) recalibrator_.thread.join();
     }
 
-    /// Get CPU frequency in GHz
-    [[nodiscard]] static double frequency_ghz() noexcept {
-        return freq_ghz_.load(std::memory_order_relaxed);
+    /// True while the recalibration thread runs (callers can skip their own)
+    [[nodiscard]] static bool recalibrating() noexcept {
+        return recalibrating_.load(std::memory_order_relaxed);
     }
 
 private:
-    static void estimate_frequency() noexcept {
+    static void calibrate_locked() noexcept {
+        using namespace std::chrono;
+
+        // Pair system_clock with the TSC: keep the tightest of a few
+        // bracketed samples, taking the midpoint
+        uint64_t tsc = 0;
+        uint64_t best_window = UINT64_MAX;
+        int64_t sys_ns = 0;
+        int64_t steady_ns = 0;
+        for (int i = 0; i < 3; ++i) {
+            const uint64_t t0 = detail::rdtscp();
+            const auto sys = system_clock::now();
+            const auto steady = steady_clock::now();
+            const uint64_t t1 = detail::rdtscp();
+            if (t1 - t0 < best_window) {
+                best_window = t1 - t0;
+                tsc = t0 + (t1 - t0) / 2;
+                sys_ns = duration_cast<nanoseconds>(sys.time_since_epoch()).count();
+                steady_ns = duration_cast<nanoseconds>(steady.time_since_epoch()).count();
+            }
+        }
+
+        Calibration cal = calibration_.read();
+        if (cal.mult == 0) {
+            anchor_tsc_ = tsc;
+            anchor_steady_ns_ = steady_ns;
+            cal.mult = initial_mult();
+        } else {
+            drift_ns_.store(static_cast<int64_t>(to_ns(cal, tsc) - static_cast<uint64_t>(sys_ns)),
+                            std::memory_order_relaxed);
+            // Refine over the whole window; steady_clock is not stepped by NTP
+            const int64_t elapsed = steady_ns - anchor_steady_ns_;
+            if (elapsed >= MIN_REFINE_WINDOW_NS && tsc > anchor_tsc_) {
+                cal.mult = mult_for(tsc - anchor_tsc_, static_cast<uint64_t>(elapsed));
+            }
+        }
+        cal.base_tsc = tsc;
+        cal.base_ns = static_cast<uint64_t>(sys_ns);
+        calibration_.write(cal);
+    }
+
+    static uint64_t initial_mult() noexcept {
         using namespace std::chrono;
 
+        if (features().nominal_hz != 0) {
+            return mult_for(features().nominal_hz, 1'000'000'000ULL);
+        }
+
         auto start_time = steady_clock::now();
         uint64_t start_tsc = detail::rdtscp();
 
@@ -108,17 +275,42 @@ private:
         uint64_t end_tsc = detail::rdtscp();
         auto end_time = steady_clock::now();
 
-        double elapsed_ns = static_cast<double>(
-            duration_cast<nanoseconds>(end_time - start_time).count());
-        double cycles = static_cast<double>(end_tsc - start_tsc);
+        const auto elapsed = duration_cast<nanoseconds>(end_time - start_time).count();
+        return mult_for(end_tsc - start_tsc, static_cast<uint64_t>(elapsed));
+    }
 
-        freq_ghz_.store(cycles / elapsed_ns, std::memory_order_relaxed);
+    /// (ns << SHIFT) / cycles
+    static constexpr uint64_t mult_for(uint64_t cycles, uint64_t ns) noexcept {
+        if (cycles == 0) return 1;
+#if defined(__SIZEOF_INT128__)
+        __extension__ using UInt128 = unsigned __int128;
+        return static_cast<uint64_t>((static_cast<UInt128>(ns) << SHIFT) / cycles);
+#else
+        return static_cast<uint64_t>(static_cast<long double>(ns) * (1ULL << SHIFT) / cycles);
+#endif
     }
 
-    // Calibration data (atomic for thread safety)
-    inline static std::atomic<uint64_t> base_ns_{0};
-    inline static std::atomic<uint64_t> base_tsc_{0};
-    inline static std::atomic<double> freq_ghz_{0.0};
+    static constexpr int64_t MIN_REFINE_WINDOW_NS = 100'000'000;
+
+    inline static memory::Seqlock<Calibration> calibration_;
+    inline static std::atomic<int64_t> drift_ns_{0};
+
+    // Writer side (under writer_mutex_)
+    inline static std::mutex writer_mutex_;
+    inline static uint64_t anchor_tsc_{0};
+    inline static int64_t anchor_steady_ns_{0};
+
+    // Recalibration thread
+    inline static std::mutex thread_mutex_;
+    inline static std::condition_variable stop_cv_;
+    inline static std::atomic<bool> recalibrating_{false};
+
+    /// Stops the thread at exit if the application did not
+    struct Recalibrator {
+        std::thread thread;
+        ~Recalibrator() { RdtscClock::stop_recalibration(); }
+    };
+    inline static Recalibrator recalibrator_;
 };
 
 // ============================================================================
@@ -130,12 +322,16 @@ private:
 /// Calibration: ~200ns (periodic, once per second)
 class RdtscTimestamp {
 public:
-    static constexpr size_t TIMESTAMP_LEN = 21;  // "YYYYMMDD-HH:MM:SS.mmm"
+    static constexpr size_t TIMESTAMP_LEN = 21;      // "YYYYMMDD-HH:MM:SS.mmm"
+    static constexpr size_t MAX_TIMESTAMP_LEN = 27;  // "YYYYMMDD-HH:MM:SS.nnnnnnnnn"
 
-    RdtscTimestamp() noexcept {
+    explicit RdtscTimestamp(TimestampPrecision precision = TimestampPrecision::Milliseconds) noexcept
+        : length_{timestamp_length(precision)}
+        , precision_{precision}
+    {
         // Initialize buffer with template
-        std::memcpy(buffer_, "00000000-00:00:00.000", TIMESTAMP_LEN);
-        buffer_[TIMESTAMP_LEN] = '\0';
+        std::memcpy(buffer_, detail::TIMESTAMP_TEMPLATE, MAX_TIMESTAMP_LEN);
+        buffer_[MAX_TIMESTAMP_LEN] = '\0';
 
         // Force initial calibration
         cached_second_ = 0;
@@ -144,8 +340,16 @@ public:
         RdtscClock::initialize();
     }
 
+    [[nodiscard]] TimestampPrecision precision() const noexcept { return precision_; }
+    [[nodiscard]] size_t length() const noexcept { return length_; }
+
+    void set_precision(TimestampPrecision precision) noexcept {
+        precision_ = precision;
+        length_ = timestamp_length(precision);
+    }
+
     /// Get current FIX-formatted timestamp
-    /// Fast path: ~10ns (milliseconds only, using RDTSC)
+    /// Fast path: ~10ns (fraction only, using RDTSC)
     /// Slow path: ~200ns (full date/time update + recalibration)
     [[nodiscard]] std::string_view get() noexcept {
         uint64_t now_ns = RdtscClock::now_ns();
@@ -156,25 +360,19 @@ public:
             update_full(now_ns);
             cached_second_ = now_sec;
 
-            // Recalibrate once per second to prevent drift
-            RdtscClock::calibrate();
+            // Recalibrate once per second to prevent drift, unless the
+            // background thread already does
+            if (!RdtscClock::recalibrating()) RdtscClock::calibrate();
         }
 
-        // Fast path: only update milliseconds
-        uint64_t ms = (now_ns % 1'000'000'000ULL) / 1'000'000ULL;
-        update_milliseconds(static_cast<int>(ms));
+        // Fast path: only update the fraction
+        detail::write_fraction(buffer_ + 18, static_cast<uint32_t>(now_ns % 1'000'000'000ULL),
+                               precision_);
 
-        return {buffer_, TIMESTAMP_LEN};
+        return {buffer_, length_};
     }
 
 private:
-    /// Update milliseconds only (fast path)
-    void update_milliseconds(int ms) noexcept {
-        buffer_[18] = '0' + static_cast<char>(ms / 100);
-        buffer_[19] = '0' + static_cast<char>((ms / 10) % 10);
-        buffer_[20] = '0' + static_cast<char>(ms % 10);
-    }
-
     /// Update full timestamp (slow path)
     void update_full(uint64_t ns_since_epoch) noexcept {
         using namespace std::chrono;
@@ -238,6 +436,8 @@ private:
     // Cache line aligned buffer for optimal performance
     alignas(64) char buffer_[32];
     uint64_t cached_second_;
+    size_t length_;
+    TimestampPrecision precision_;
 };
 
 // ============================================================================
@@ -0,0 +1,160 @@
+/*
+    NexusFIX Sharded Counters
+
+    Statistics bumped from several threads (store readers, submitters and
+    workers) without a lock and without the threads trading one cache
+    line back and forth:
+
+        thread A  ->  shard 0   [c0 c1 c2 c3]   own cache line
+        thread B  ->  shard 1   [c0 c1 c2 c3]   own cache line
+        others    ->  overflow  [c0 c1 c2 c3]   fetch_add
+        value(c)  =   sum over shards - baseline
+
+    Each thread takes a shard index from a process-wide registry on first
+    use and hands it back at thread exit, so a shard has one writer at a
+    time and add() is a relaxed load and store - no lock prefix, no line
+    shared with another writer. Threads beyond MAX_THREAD_SHARDS share
+    the overflow shard through fetch_add. Readers sum the shards with
+    relaxed loads from any thread; nothing they read can be torn.
+
+    A counter set takes MAX_THREAD_SHARDS + 1 cache lines per 8 counters
+    (about 4 KB): meant for long-lived objects such as stores and
+    processors, not one per message.
+
+    reset() records the current sums as the baseline rather than zeroing
+    the shards, so it never loses a writer's increment mid-flight.
+
+    Usage:
+        enum : size_t { RETRIEVED, FAILURES, COUNTERS };
+        util::ShardedCounters<COUNTERS> counters;
+        counters.add(RETRIEVED);                    // Any thread
+        uint64_t n = counters.value(RETRIEVED);     // Any thread
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "nexusfix/util/prefetch.hpp"   // CACHE_LINE_SIZE
+
+namespace nfx::util {
+
+// ============================================================================
+// Thread Shard Registry
+// ============================================================================
+
+/// Threads that can hold a shard index at once; later ones use overflow
+inline constexpr size_t MAX_THREAD_SHARDS = 64;
+
+namespace detail {
+
+inline std::atomic<uint64_t> thread_shard_bits{0};
+
+/// A thread's shard index, claimed on first use and released at exit
+/// Releasing and claiming through the same atomic orders a dead thread's
+/// counter stores before those of the thread that reuses its index.
+struct ThreadShard {
+    size_t index{MAX_THREAD_SHARDS};
+
+    ThreadShard() noexcept {
+        uint64_t bits = thread_shard_bits.load(std::memory_order_relaxed);
+        while (~bits != 0) {
+            const size_t i = static_cast<size_t>(std::countr_one(bits));
+            if (thread_shard_bits.compare_exchange_weak(bits, bits | (uint64_t{1} << i),
+                    std::memory_order_acquire, std::memory_order_relaxed)) {
+                index = i;
+                return;
+            }
+        }
+    }
+
+    ~ThreadShard() {
+        if (index < MAX_THREAD_SHARDS) {
+            thread_shard_bits.fetch_and(~(uint64_t{1} << index), std::memory_order_release);
+        }
+    }
+
+    ThreadShard(const ThreadShard&) = delete;
+    ThreadShard& operator=(const ThreadShard&) = delete;
+};
+
+} // namespace detail
+
+/// Shard index of the calling thread (MAX_THREAD_SHARDS if none was free)
+[[nodiscard]] inline size_t this_thread_shard() noexcept {
+    thread_local detail::ThreadShard shard;
+    return shard.index;
+}
+
+// ============================================================================
+// Sharded Counters
+// ============================================================================
+
+/// Counters with one cache-line-padded shard per writing thread
+/// @tparam Counters Number of counters (indexed 0..Counters-1)
+template <size_t Counters>
+class ShardedCounters {
+    static_assert(Counters > 0, "Counters must be positive");
+
+    static constexpr size_t OVERFLOW_SHARD = MAX_THREAD_SHARDS;
+
+public:
+    ShardedCounters() noexcept = default;
+
+    ShardedCounters(const ShardedCounters&) = delete;
+    ShardedCounters& operator=(const ShardedCounters&) = delete;
+
+    /// Add n to counter (any thread)
+    void add(size_t counter, uint64_t n = 1) noexcept {
+        const size_t shard = this_thread_shard();
+        if (shard != OVERFLOW_SHARD) [[likely]] {
+            std::atomic<uint64_t>& value = shards_[shard].values[counter];
+            value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        } else {
+            shards_[OVERFLOW_SHARD].values[counter].fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+
+    /// Sum over all shards since the last reset() (any thread)
+    [[nodiscard]] uint64_t value(size_t counter) const noexcept {
+        return sum(counter) - baseline_[counter].load(std::memory_order_relaxed);
+    }
+
+    /// Every counter, in index order
+    [[nodiscard]] std::array<uint64_t, Counters> snapshot() const noexcept {
+        std::array<uint64_t, Counters> out{};
+        for (size_t c = 0; c < Counters; ++c) out[c] = value(c);
+        return out;
+    }
+
+    /// Start every counter again from zero (any thread)
+    void reset() noexcept {
+        for (size_t c = 0; c < Counters; ++c) {
+            baseline_[c].store(sum(c), std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] static constexpr size_t counters() noexcept { return Counters; }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::array<std::atomic<uint64_t>, Counters> values{};
+    };
+
+    [[nodiscard]] uint64_t sum(size_t counter) const noexcept {
+        uint64_t total = 0;
+        for (const Shard& shard : shards_) {
+            total += shard.values[counter].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    std::array<Shard, MAX_THREAD_SHARDS + 1> shards_{};   // Last: overflow
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<uint64_t>, Counters> baseline_{};
+};
+
+} // namespace nfx::util
@@ -0,0 +1,275 @@
+/*
+    NexusFIX Timer Wheel
+
+    Hierarchical timing wheel for the deadlines of many sessions on one
+    thread: heartbeats, test requests, logon timeouts, reconnects.
+
+        level 0:  64 slots x 1 tick
+        level 1:  64 slots x 64 ticks          (cascaded into level 0)
+        level 2:  64 slots x 4096 ticks
+        level 3:  64 slots x 262144 ticks      (~46 h at 10 ms)
+
+    Timers are intrusive TimerNodes owned by the caller, so scheduling,
+    re-scheduling and cancelling are a few pointer writes with no
+    allocation. advance() reads the clock once per call (the caller's
+    'now') and costs O(expired + slots crossed), not O(timers): an idle
+    session whose heartbeat is 30 s away is not looked at until then.
+
+    Callbacks run inside advance(); they may schedule or cancel any node,
+    including their own. A node rescheduled to a deadline already passed
+    fires on the next tick. One thread owns a wheel and all its nodes.
+
+    Usage:
+        util::TimerWheel wheel{std::chrono::milliseconds{10}};
+        util::TimerNode hb{[](void* ctx) noexcept { static_cast<Session*>(ctx)->heartbeat(); },
+                           &session};
+        wheel.schedule_after(hb, std::chrono::seconds{30});
+        ...
+        wheel.schedule_after(hb, std::chrono::seconds{30});   // Activity: push it back
+        ...
+        wheel.advance(std::chrono::steady_clock::now());     // Worker loop
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace nfx::util {
+
+class TimerWheel;
+
+// ============================================================================
+// Timer Node
+// ============================================================================
+
+/// Intrusive timer; unlinks itself on destruction
+class TimerNode {
+public:
+    using Callback = void (*)(void* context) noexcept;
+
+    TimerNode() noexcept = default;
+    TimerNode(Callback callback, void* context) noexcept
+        : callback_{callback}, context_{context} {}
+
+    ~TimerNode();
+
+    // Linked into a wheel by address
+    TimerNode(const TimerNode&) = delete;
+    TimerNode& operator=(const TimerNode&) = delete;
+
+    /// Set what fires (not while armed)
+    void bind(Callback callback, void* context) noexcept {
+        callback_ = callback;
+        context_ = context;
+    }
+
+    [[nodiscard]] bool armed() const noexcept { return wheel_ != nullptr; }
+
+    /// Tick the node fires at (meaningful while armed)
+    [[nodiscard]] uint64_t expires() const noexcept { return expires_; }
+
+private:
+    friend class TimerWheel;
+
+    void unlink() noexcept {
+        prev_->next_ = next_;
+        next_->prev_ = prev_;
+        prev_ = next_ = nullptr;
+    }
+
+    Callback callback_{nullptr};
+    void* context_{nullptr};
+    uint64_t expires_{0};
+    TimerNode* prev_{nullptr};
+    TimerNode* next_{nullptr};
+    TimerWheel* wheel_{nullptr};
+};
+
+// ============================================================================
+// Timer Wheel
+// ============================================================================
+
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = Clock::duration;
+
+    static constexpr size_t LEVELS = 4;
+    static constexpr unsigned SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+
+    /// Furthest deadline kept exactly; later ones are parked at the top and re-filed
+    static constexpr uint64_t MAX_SPAN = (uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;
+
+    /// @param resolution Length of one tick (deadlines round up to it)
+    /// @param origin Time of tick 0
+    explicit TimerWheel(Duration resolution = std::chrono::milliseconds{10},
+                        TimePoint origin = Clock::now()) noexcept
+        : resolution_{resolution.count() > 0 ? resolution : Duration{1}}
+        , origin_{origin}
+        , now_{origin} {
+        for (auto& level : slots_) {
+            for (auto& head : level) head.prev_ = head.next_ = &head;
+        }
+    }
+
+    ~TimerWheel() {
+        for (auto& level : slots_) {
+            for (auto& head : level) {
+                while (head.next_ != &head) {
+                    TimerNode* node = head.next_;
+                    node->unlink();
+                    node->wheel_ = nullptr;
+                }
+            }
+        }
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // ========================================================================
+    // Scheduling
+    // ========================================================================
+
+    /// Arm node for deadline, replacing any earlier schedule
+    void schedule(TimerNode& node, TimePoint deadline) noexcept {
+        const auto offset = deadline - origin_;
+        const uint64_t tick = offset.count() <= 0
+            ? 0
+            : static_cast<uint64_t>((offset + resolution_ - Duration{1}) / resolution_);
+        schedule_tick(node, tick);
+    }
+
+    /// Arm node for delay after now() (the time of the last advance())
+    void schedule_after(TimerNode& node, Duration delay) noexcept {
+        schedule(node, now_ + delay);
+    }
+
+    /// Disarm node (no-op if it is not armed)
+    void cancel(TimerNode& node) noexcept {
+        if (node.wheel_ != this) return;
+        node.unlink();
+        node.wheel_ = nullptr;
+        --size_;
+    }
+
+    // ========================================================================
+    // Time
+    // ========================================================================
+
+    /// Fire everything due at or before now
+    /// @return Timers fired
+    size_t advance(TimePoint now) noexcept {
+        if (now > now_) now_ = now;
+        const auto elapsed = now_ - origin_;
+        const uint64_t target = static_cast<uint64_t>(elapsed / resolution_);
+
+        size_t fired = 0;
+        while (current_ <= target) {
+            if (size_ == 0) {  // Nothing to cascade or fire: jump
+                current_ = target + 1;
+                break;
+            }
+            const uint64_t index = current_ & SLOT_MASK;
+            if (index == 0) cascade(1);
+
+            TimerNode& head = slots_[0][index];
+            firing_ = true;
+            while (head.next_ != &head) {
+                TimerNode* node = head.next_;
+                node->unlink();
+                node->wheel_ = nullptr;
+                --size_;
+                ++fired;
+                if (node->callback_) node->callback_(node->context_);
+            }
+            firing_ = false;
+            ++current_;
+        }
+        return fired;
+    }
+
+    /// Time of the last advance() (or the origin); deadlines are relative to it
+    [[nodiscard]] TimePoint now() const noexcept { return now_; }
+
+    /// Next tick advance() will process
+    [[nodiscard]] uint64_t current_tick() const noexcept { return current_; }
+
+    [[nodiscard]] Duration resolution() const noexcept { return resolution_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+private:
+    void schedule_tick(TimerNode& node, uint64_t tick) noexcept {
+        cancel(node);
+        // The tick being fired is closed: past deadlines go to the next one
+        const uint64_t earliest = firing_ ? current_ + 1 : current_;
+        node.expires_ = tick < earliest ? earliest : tick;
+        node.wheel_ = this;
+        ++size_;
+        file(node);
+    }
+
+    /// Link node into the slot its expiry maps to from current_
+    void file(TimerNode& node) noexcept {
+        uint64_t expires = node.expires_;
+        uint64_t delta = expires - current_;
+        if (delta > MAX_SPAN) {
+            delta = MAX_SPAN;  // Parked; re-filed when its slot cascades
+            expires = current_ + MAX_SPAN;
+        }
+
+        size_t level = 0;
+        while (level + 1 < LEVELS && delta >= (uint64_t{1} << (SLOT_BITS * (level + 1)))) ++level;
+        const size_t index = (expires >> (SLOT_BITS * level)) & SLOT_MASK;
+
+        TimerNode& head = slots_[level][index];
+        node.prev_ = head.prev_;
+        node.next_ = &head;
+        head.prev_->next_ = &node;
+        head.prev_ = &node;
+    }
+
+    /// Re-file the slot of level that current_ has just entered
+    void cascade(size_t level) noexcept {
+        if (level >= LEVELS) return;
+        const size_t index = (current_ >> (SLOT_BITS * level)) & SLOT_MASK;
+        if (index == 0) cascade(level + 1);  // Higher level first: its nodes may land here
+
+        TimerNode& head = slots_[level][index];
+        TimerNode pending;
+        pending.prev_ = pending.next_ = &pending;
+        if (head.next_ != &head) {  // Detach the whole list
+            pending.next_ = head.next_;
+            pending.prev_ = head.prev_;
+            pending.next_->prev_ = &pending;
+            pending.prev_->next_ = &pending;
+            head.prev_ = head.next_ = &head;
+        }
+        while (pending.next_ != &pending) {
+            TimerNode* node = pending.next_;
+            node->unlink();
+            file(*node);
+        }
+    }
+
+    Duration resolution_;
+    TimePoint origin_;
+    TimePoint now_;
+    uint64_t current_{0};
+    size_t size_{0};
+    bool firing_{false};
+    std::array<std::array<TimerNode, SLOTS>, LEVELS> slots_;
+};
+
+inline TimerNode::~TimerNode() {
+    if (wheel_) wheel_->cancel(*this);
+}
+
+} // namespace nfx::util
@@ -0,0 +1,75 @@
+/*
+    NexusFIX Token Bucket
+
+    Outbound pacing against venue message-rate limits. Implemented as
+    GCRA (generic cell rate algorithm): instead of a token count refilled
+    by a timer, the bucket keeps one "theoretical arrival time" and
+    compares it with the caller's clock - no floating point, no refill
+    loop, one subtraction and compare per request.
+
+        rate = 50/s, burst = 10:
+        up to 10 requests at once, then one every 20ms
+
+    Time is whatever monotonic nanosecond clock the caller uses
+    (steady_clock, rdtsc-derived); the bucket never reads a clock itself.
+
+    Usage:
+        TokenBucket bucket{50, 10};
+        if (bucket.try_acquire(now_ns)) send(request);
+        else schedule(bucket.next_available(now_ns));
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nfx::util {
+
+/// GCRA rate limiter: `rate` events per second, `burst` at once
+class TokenBucket {
+public:
+    /// @param rate_per_second Sustained events per second (> 0)
+    /// @param burst Events allowed back to back (>= 1)
+    constexpr TokenBucket(uint64_t rate_per_second, uint64_t burst) noexcept
+        : interval_ns_{NS_PER_SECOND / std::max<uint64_t>(rate_per_second, 1)}
+        , tolerance_ns_{interval_ns_ * (std::max<uint64_t>(burst, 1) - 1)} {}
+
+    /// Take n tokens if available at now_ns
+    /// @return false (and nothing taken) if the bucket is short
+    [[nodiscard]] constexpr bool try_acquire(uint64_t now_ns, uint64_t n = 1) noexcept {
+        const uint64_t tat = std::max(tat_, now_ns);
+        const uint64_t next = tat + interval_ns_ * n;
+        if (next - now_ns > tolerance_ns_ + interval_ns_) return false;
+        tat_ = next;
+        return true;
+    }
+
+    /// Tokens that could be taken at now_ns
+    [[nodiscard]] constexpr uint64_t available(uint64_t now_ns) const noexcept {
+        const uint64_t tat = std::max(tat_, now_ns);
+        const uint64_t used = tat - now_ns;
+        const uint64_t limit = tolerance_ns_ + interval_ns_;
+        return used >= limit ? 0 : (limit - used) / interval_ns_;
+    }
+
+    /// Earliest time a single token is available (now_ns if one is)
+    [[nodiscard]] constexpr uint64_t next_available(uint64_t now_ns) const noexcept {
+        const uint64_t earliest = tat_ > tolerance_ns_ ? tat_ - tolerance_ns_ : 0;
+        return std::max(earliest, now_ns);
+    }
+
+    /// Forget past usage (full burst available)
+    constexpr void reset() noexcept { tat_ = 0; }
+
+    [[nodiscard]] constexpr uint64_t interval_ns() const noexcept { return interval_ns_; }
+
+private:
+    static constexpr uint64_t NS_PER_SECOND = 1'000'000'000;
+
+    uint64_t interval_ns_;    // Emission interval (1 / rate)
+    uint64_t tolerance_ns_;   // How far ahead of the clock tat_ may run
+    uint64_t tat_{0};         // Theoretical arrival time of the next event
+};
+
+} // namespace nfx::util
@@ -0,0 +1,174 @@
+/*
+    NexusFIX Working Set Preparation
+
+    The first touch of a message store ring, a registered buffer pool or a
+    resend arena costs a page fault (~10-100us) and a TLB miss. Engine
+    components that own such memory describe it as MemoryRegions;
+    WorkingSet gathers them and prepare() takes every fault before the
+    session goes live:
+
+        lock_memory()          mlock - pages stay resident (needs
+                               CAP_IPC_LOCK or enough RLIMIT_MEMLOCK)
+        prefault_memory_write  write-touch every page - no first-write
+                               or copy-on-write fault later
+        prefetch_region()      MADV_WILLNEED on the page-aligned range
+
+    A region that cannot be locked is still pre-faulted; the report tells
+    which ones are locked so operators can raise RLIMIT_MEMLOCK instead of
+    learning about it from a latency spike.
+
+    Regions of file mappings must not be passed in: pre-faulting for write
+    dirties every page.
+
+    Usage:
+        util::WorkingSet ws;
+        ws.add(store);                  // Anything with memory_regions(span)
+        ws.add(pool);
+        ws.add({"orders", orders.data(), orders.size() * sizeof(Order)});
+
+        const util::WorkingSetReport report = ws.prepare();
+        if (!report.fully_locked()) log(report.lock_failures, "regions not locked");
+*/
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/util/memory_lock.hpp"
+
+namespace nfx::util {
+
+// ============================================================================
+// Memory Region
+// ============================================================================
+
+/// Memory an engine component owns and touches on the hot path
+struct MemoryRegion {
+    std::string_view name;     // Static string, for reports
+    void* addr{nullptr};
+    size_t size{0};
+};
+
+/// Copy regions into out, as many as fit (for memory_regions() overrides)
+/// @return Number of regions written
+inline size_t write_regions(std::span<MemoryRegion> out,
+                            std::initializer_list<MemoryRegion> regions) noexcept {
+    size_t n = 0;
+    for (const MemoryRegion& r : regions) {
+        if (n == out.size()) break;
+        out[n++] = r;
+    }
+    return n;
+}
+
+/// Component that can describe its memory
+/// memory_regions() writes at most out.size() regions and returns the count.
+template <typename T>
+concept HasMemoryRegions = requires(const T& owner, std::span<MemoryRegion> out) {
+    { owner.memory_regions(out) } -> std::convertible_to<size_t>;
+};
+
+// ============================================================================
+// Report
+// ============================================================================
+
+struct PrepareOptions {
+    bool lock{true};           // mlock each region
+    bool prefault{true};       // Write-touch each page
+    bool prefetch{true};       // MADV_WILLNEED each region
+};
+
+struct PreparedRegion {
+    MemoryRegion region;
+    bool locked{false};
+    MemoryLockError lock_error{};  // Why it is not locked (when lock was requested)
+};
+
+struct WorkingSetReport {
+    std::vector<PreparedRegion> regions;
+    size_t total_bytes{0};
+    size_t locked_bytes{0};
+    size_t lock_failures{0};
+
+    [[nodiscard]] bool fully_locked() const noexcept {
+        return lock_failures == 0 && locked_bytes == total_bytes;
+    }
+
+    /// Entry for the region called name, nullptr if none
+    [[nodiscard]] const PreparedRegion* find(std::string_view name) const noexcept {
+        for (const auto& r : regions) {
+            if (r.region.name == name) return &r;
+        }
+        return nullptr;
+    }
+};
+
+// ============================================================================
+// Working Set
+// ============================================================================
+
+class WorkingSet {
+public:
+    static constexpr size_t MAX_REGIONS_PER_OWNER = 16;
+
+    /// Add one region (empty regions are ignored)
+    void add(const MemoryRegion& region) {
+        if (region.addr && region.size) regions_.push_back(region);
+    }
+
+    /// Add every region owner reports
+    template <HasMemoryRegions Owner>
+    void add(const Owner& owner) {
+        std::array<MemoryRegion, MAX_REGIONS_PER_OWNER> buf{};
+        const size_t n = owner.memory_regions(buf);
+        for (size_t i = 0; i < n && i < buf.size(); ++i) add(buf[i]);
+    }
+
+    [[nodiscard]] std::span<const MemoryRegion> regions() const noexcept { return regions_; }
+    [[nodiscard]] size_t size() const noexcept { return regions_.size(); }
+
+    /// Lock, pre-fault and prefetch every region (before logon)
+    [[nodiscard]] WorkingSetReport prepare(const PrepareOptions& options = {}) const {
+        WorkingSetReport report;
+        report.regions.reserve(regions_.size());
+        for (const MemoryRegion& region : regions_) {
+            PreparedRegion& out = report.regions.emplace_back(PreparedRegion{region});
+            report.total_bytes += region.size;
+
+            if (options.lock) {
+                auto locked = lock_memory(region.addr, region.size);
+                out.locked = locked.has_value();
+                if (out.locked) {
+                    report.locked_bytes += region.size;
+                } else {
+                    out.lock_error = locked.error();
+                    ++report.lock_failures;
+                }
+            }
+            if (options.prefault) prefault_memory_write(region.addr, region.size);
+#ifndef _WIN32
+            if (options.prefetch) {
+                // madvise() wants a page-aligned start
+                const auto begin = reinterpret_cast<uintptr_t>(region.addr) & ~(PAGE_BYTES - 1);
+                const auto end = reinterpret_cast<uintptr_t>(region.addr) + region.size;
+                prefetch_region(reinterpret_cast<void*>(begin), end - begin);
+            }
+#endif
+        }
+        return report;
+    }
+
+private:
+    static constexpr uintptr_t PAGE_BYTES = 4096;
+
+    std::vector<MemoryRegion> regions_;
+};
+
+} // namespace nfx::util
@@ -7,7 +7,9 @@
     - Type-safe logging with C++20 Concepts
     - std::format / std::source_location for context
     - std::print / std::println (C++23) with fallback for console output
-    - Async logging with lock-free queue
+    - Async logging on lock-free MPSC queues (one per channel) with
+      preallocated record slots; formatting and file I/O happen on the
+      writer thread, producers only copy fields into a slot
     - Daily log rotation with YYYYMMDD naming
     - JSON structured logging for trade channel
     - Thread-safe, high-performance design
@@ -25,8 +27,6 @@
 #include <mutex>
 #include <atomic>
 #include <thread>
-#include <queue>
-#include <condition_variable>
 #include <source_location>
 #include <functional>
 #include <memory>
@@ -39,6 +39,9 @@
 #include <set>
 #include <unordered_set>
 
+#include "nexusfix/memory/mpsc_queue.hpp"
+#include "nexusfix/memory/queue_notifier.hpp"
+
 // ============================================================================
 // C++23 <print> Header Detection
 // ============================================================================
@@ -271,56 +274,58 @@ std::string dumps(const std::pair<T1, T2>& p) {
     return result;
 }
 
-// Get current date string (YYYYMMDD)
-[[nodiscard]] inline std::string get_date_string() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
+// Local calendar time of a time point
+[[nodiscard]] inline std::tm to_local_tm(std::chrono::system_clock::time_point tp) {
+    auto time_t = std::chrono::system_clock::to_time_t(tp);
     std::tm tm_buf{};
 #if defined(_WIN32)
     localtime_s(&tm_buf, &time_t);
 #else
     localtime_r(&time_t, &tm_buf);
 #endif
+    return tm_buf;
+}
+
+// Date string (YYYYMMDD) of a time point
+[[nodiscard]] inline std::string get_date_string(std::chrono::system_clock::time_point tp) {
+    const std::tm tm_buf = to_local_tm(tp);
     return std::format("{:04d}{:02d}{:02d}",
         tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday);
 }
 
+// Get current date string (YYYYMMDD)
+[[nodiscard]] inline std::string get_date_string() {
+    return get_date_string(std::chrono::system_clock::now());
+}
+
 // Get current timestamp string
 [[nodiscard]] inline std::string get_timestamp_string() {
     auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()) % 1000;
-    std::tm tm_buf{};
-#if defined(_WIN32)
-    localtime_s(&tm_buf, &time_t);
-#else
-    localtime_r(&time_t, &tm_buf);
-#endif
+    const std::tm tm_buf = to_local_tm(now);
     return std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:03d}",
         tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday,
         tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec,
         static_cast<int>(ms.count()));
 }
 
-// Get ISO8601 timestamp for JSON
-[[nodiscard]] inline std::string get_iso_timestamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
+// ISO8601 timestamp of a time point, for JSON
+[[nodiscard]] inline std::string format_iso_timestamp(std::chrono::system_clock::time_point tp) {
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-    std::tm tm_buf{};
-#if defined(_WIN32)
-    localtime_s(&tm_buf, &time_t);
-#else
-    localtime_r(&time_t, &tm_buf);
-#endif
+        tp.time_since_epoch()) % 1000;
+    const std::tm tm_buf = to_local_tm(tp);
     return std::format("{:04d}-{:02d}-{:02d}T{:02d}:{:02d}:{:02d}.{:03d}Z",
         tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday,
         tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec,
         static_cast<int>(ms.count()));
 }
 
+// Get ISO8601 timestamp for JSON
+[[nodiscard]] inline std::string get_iso_timestamp() {
+    return format_iso_timestamp(std::chrono::system_clock::now());
+}
+
 // ============================================================================
 // Channel Writer (handles one log channel)
 // ============================================================================
@@ -332,30 +337,96 @@ public:
         std::filesystem::create_directories(dir_);
     }
 
-    void write(std::string_view content) {
+    // The file stays open between writes; it is reopened when the date of
+    // the entry being written differs from the open file's
+    void write(std::string_view content,
+               std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now()) {
         std::lock_guard lock(mutex_);
 
         // Check if we need to rotate (new day)
-        std::string today = get_date_string();
-        if (today != current_date_) {
-            current_date_ = today;
-            // Close old file, new one will be opened on next write
+        std::string today = get_date_string(timestamp);
+        if (today != current_date_ || !file_.is_open()) {
+            current_date_ = std::move(today);
+            file_.close();
+            file_.clear();
+            file_.open(dir_ / std::format("{}_{}.log", prefix_, current_date_), std::ios::app);
         }
 
-        std::filesystem::path log_path = dir_ / std::format("{}_{}.log", prefix_, current_date_);
-        std::ofstream file(log_path, std::ios::app);
-        if (file) {
-            file << content << '\n';
+        if (file_) {
+            file_ << content << '\n';
         }
     }
 
+    void flush() {
+        std::lock_guard lock(mutex_);
+        if (file_.is_open()) file_.flush();
+    }
+
 private:
     std::string prefix_;
     std::filesystem::path dir_;
     std::string current_date_;
-    std::mutex mutex_;
+    std::ofstream file_;
+    std::mutex mutex_;     // Uncontended while the async writer owns the channel
 };
 
+// ============================================================================
+// Record Formatting (writer thread, or caller when not running)
+// ============================================================================
+
+[[nodiscard]] inline std::string format_ops_line(Level level, std::string_view file, uint32_t line,
+                                                 std::chrono::system_clock::time_point timestamp,
+                                                 std::string_view message) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        timestamp.time_since_epoch()) % 1000;
+    const std::tm tm_buf = to_local_tm(timestamp);
+
+    // Extract just filename from path
+    std::string_view filename = file;
+    if (auto pos = filename.rfind('/'); pos != std::string_view::npos) {
+        filename = filename.substr(pos + 1);
+    } else if (auto pos2 = filename.rfind('\\'); pos2 != std::string_view::npos) {
+        filename = filename.substr(pos2 + 1);
+    }
+
+    return std::format("{} | {:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:03d} | {:>20}:{:<5} | {}",
+        level_to_string(level),
+        tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday,
+        tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec,
+        static_cast<int>(ms.count()),
+        filename, line,
+        message);
+}
+
+[[nodiscard]] inline std::string format_trade_json(const TradeEvent& event,
+                                                   std::chrono::system_clock::time_point timestamp) {
+    return std::format(
+        R"({{"ts":"{}","task":"{}","strategy":"{}","symbol":"{}","action":"{}","price":{},"qty":{},"pnl":{},"duration_us":{}}})",
+        format_iso_timestamp(timestamp),
+        escape_json(event.task_id),
+        escape_json(event.strategy_id),
+        escape_json(event.symbol),
+        escape_json(event.action),
+        event.price,
+        event.quantity,
+        event.pnl,
+        event.duration.count()
+    );
+}
+
+[[nodiscard]] inline std::string format_plugin_json(const LogPluginEvent& event,
+                                                    std::chrono::system_clock::time_point timestamp) {
+    return std::format(
+        R"({{"ts":"{}","plugin":"{}","action":"{}","state":"{}","details":"{}","duration_us":{}}})",
+        format_iso_timestamp(timestamp),
+        escape_json(event.plugin_id),
+        escape_json(event.action),
+        escape_json(event.state),
+        escape_json(event.details),
+        event.duration.count()
+    );
+}
+
 // ============================================================================
 // Log Entry (for OPS channel)
 // ============================================================================
@@ -370,33 +441,35 @@ struct LogEntry {
     std::thread::id thread_id;
 
     [[nodiscard]] std::string format() const {
-        auto time_t = std::chrono::system_clock::to_time_t(timestamp);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            timestamp.time_since_epoch()) % 1000;
+        return format_ops_line(level, file, line, timestamp, message);
+    }
+};
 
-        std::tm tm_buf{};
-#if defined(_WIN32)
-        localtime_s(&tm_buf, &time_t);
-#else
-        localtime_r(&time_t, &tm_buf);
-#endif
+// ============================================================================
+// Queued Records (one ring slot each)
+// ============================================================================
+//
+// Slots are default-constructed once with the ring and reused. Producers
+// copy-assign into a slot's strings, which reuses their capacity, so a
+// warmed-up channel does not allocate on the logging thread. Nothing is
+// formatted until the writer thread picks the record up.
 
-        // Extract just filename from path
-        std::string_view filename = file;
-        if (auto pos = filename.rfind('/'); pos != std::string_view::npos) {
-            filename = filename.substr(pos + 1);
-        } else if (auto pos2 = filename.rfind('\\'); pos2 != std::string_view::npos) {
-            filename = filename.substr(pos2 + 1);
-        }
+struct OpsRecord {
+    Level level{Level::INFO};
+    uint32_t line{0};
+    const char* file{""};          // std::source_location strings are static
+    std::chrono::system_clock::time_point timestamp{};
+    std::string message;
+};
 
-        return std::format("{} | {:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:03d} | {:>20}:{:<5} | {}",
-            level_to_string(level),
-            tm_buf.tm_year + 1900, tm_buf.tm_mon + 1, tm_buf.tm_mday,
-            tm_buf.tm_hour, tm_buf.tm_min, tm_buf.tm_sec,
-            static_cast<int>(ms.count()),
-            filename, line,
-            message);
-    }
+struct TradeRecord {
+    std::chrono::system_clock::time_point timestamp{};
+    TradeEvent event;
+};
+
+struct PluginRecord {
+    std::chrono::system_clock::time_point timestamp{};
+    LogPluginEvent event;
 };
 
 // ============================================================================
@@ -405,6 +478,16 @@ struct LogEntry {
 
 class MultiChannelLogger {
 public:
+    static constexpr size_t OPS_QUEUE_CAPACITY = 4096;
+    static constexpr size_t TRADE_QUEUE_CAPACITY = 4096;
+    static constexpr size_t PLUGIN_QUEUE_CAPACITY = 1024;
+    static constexpr int WRITER_IDLE_TIMEOUT_MS = 100;    // Bounds stop() latency
+
+    // A full ring makes producers yield until the writer frees a slot
+    using OpsQueue = nfx::memory::MPSCQueue<OpsRecord, OPS_QUEUE_CAPACITY, nfx::memory::YieldingWait>;
+    using TradeQueue = nfx::memory::MPSCQueue<TradeRecord, TRADE_QUEUE_CAPACITY, nfx::memory::YieldingWait>;
+    using PluginQueue = nfx::memory::MPSCQueue<PluginRecord, PLUGIN_QUEUE_CAPACITY, nfx::memory::YieldingWait>;
+
     // Singleton access
     static MultiChannelLogger& instance() {
         static MultiChannelLogger logger;
@@ -449,21 +532,41 @@ public:
 
     void stop() {
         if (!running_.exchange(false)) return;
-        queue_cv_.notify_all();
         if (writer_thread_.joinable()) {
             writer_thread_.request_stop();
+            notifier_.notify();
             writer_thread_.join();
         }
+        // Records committed by producers that saw running_ before the
+        // exchange; the writer is gone, so this thread is the consumer now
         flush();
     }
 
-    // Synchronous flush
+    // Synchronous flush: returns once everything logged so far is on disk
     void flush() {
-        std::lock_guard lock(queue_mutex_);
-        while (!ops_queue_.empty()) {
-            write_ops_entry(ops_queue_.front());
-            ops_queue_.pop();
+        if (running_) {
+            // Queues empty means the writer has finished with every record;
+            // then wait for one idle pass, which flushes the files
+            while (running_ && !queues_empty()) std::this_thread::yield();
+            const uint64_t pass = idle_passes_.load(std::memory_order_acquire);
+            notifier_.notify();
+            while (running_ && idle_passes_.load(std::memory_order_acquire) == pass) {
+                std::this_thread::yield();
+            }
+            return;
         }
+        drain_queues();
+        flush_writers();
+    }
+
+    /// Records written by the async writer (diagnostics)
+    [[nodiscard]] uint64_t records_written() const noexcept {
+        return records_written_.load(std::memory_order_relaxed);
+    }
+
+    /// Times a producer waited for a free slot (diagnostics)
+    [[nodiscard]] uint64_t queue_full_waits() const noexcept {
+        return queue_full_waits_.load(std::memory_order_relaxed);
     }
 
     // ========================================================================
@@ -473,24 +576,14 @@ public:
     void log_ops(Level level, std::string message,
                  const std::source_location& loc = std::source_location::current()) {
         if (!ops_enabled_ || level < min_level_) return;
+        enqueue_ops(level, std::chrono::system_clock::now(), message, loc);
+    }
 
-        LogEntry entry{
-            .level = level,
-            .message = std::move(message),
-            .file = loc.file_name(),
-            .function = loc.function_name(),
-            .line = loc.line(),
-            .timestamp = std::chrono::system_clock::now(),
-            .thread_id = std::this_thread::get_id()
-        };
-
-        if (running_) {
-            std::lock_guard lock(queue_mutex_);
-            ops_queue_.push(std::move(entry));
-            queue_cv_.notify_one();
-        } else {
-            write_ops_entry(entry);
-        }
+    // Entry stamped by the caller (replaying a recorded log)
+    void log_ops(Level level, std::chrono::system_clock::time_point timestamp, std::string message,
+                 const std::source_location& loc = std::source_location::current()) {
+        if (!ops_enabled_ || level < min_level_) return;
+        enqueue_ops(level, timestamp, message, loc);
     }
 
     template<typename... Args>
@@ -512,31 +605,19 @@ public:
 
     void log_trade(const TradeEvent& event) {
         if (!trade_enabled_) return;
+        log_trade(event, std::chrono::system_clock::now());
+    }
 
-        std::string json = std::format(
-            R"({{"ts":"{}","task":"{}","strategy":"{}","symbol":"{}","action":"{}","price":{},"qty":{},"pnl":{},"duration_us":{}}})",
-            get_iso_timestamp(),
-            escape_json(event.task_id),
-            escape_json(event.strategy_id),
-            escape_json(event.symbol),
-            escape_json(event.action),
-            event.price,
-            event.quantity,
-            event.pnl,
-            event.duration.count()
-        );
-
-        if (console_output_) {
-            std::lock_guard lock(console_mutex_);
-#if LOGDUMP_HAS_STD_PRINT
-            std::println("[TRADE] {}", json);
-#else
-            std::cout << "[TRADE] " << json << '\n';
-#endif
-        }
+    void log_trade(const TradeEvent& event, std::chrono::system_clock::time_point timestamp) {
+        if (!trade_enabled_) return;
 
-        if (trade_writer_) {
-            trade_writer_->write(json);
+        if (running_) {
+            auto slot = claim(*trade_queue_);
+            slot->timestamp = timestamp;
+            slot->event = event;           // Reuses the slot's string capacity
+            commit(*trade_queue_, slot);
+        } else {
+            write_trade(event, timestamp);
         }
     }
 
@@ -546,36 +627,19 @@ public:
 
     void log_plugin(const LogPluginEvent& event) {
         if (!plugin_enabled_) return;
+        log_plugin(event, std::chrono::system_clock::now());
+    }
 
-        std::string json = std::format(
-            R"({{"ts":"{}","plugin":"{}","action":"{}","state":"{}","details":"{}","duration_us":{}}})",
-            get_iso_timestamp(),
-            escape_json(event.plugin_id),
-            escape_json(event.action),
-            escape_json(event.state),
-            escape_json(event.details),
-            event.duration.count()
-        );
-
-        if (console_output_) {
-            std::lock_guard lock(console_mutex_);
-#if LOGDUMP_HAS_STD_PRINT
-            if (event.action == "ERROR") {
-                std::println(stderr, "[PLUGIN] {}", json);
-            } else {
-                std::println("[PLUGIN] {}", json);
-            }
-#else
-            if (event.action == "ERROR") {
-                std::cerr << "[PLUGIN] " << json << '\n';
-            } else {
-                std::cout << "[PLUGIN] " << json << '\n';
-            }
-#endif
-        }
+    void log_plugin(const LogPluginEvent& event, std::chrono::system_clock::time_point timestamp) {
+        if (!plugin_enabled_) return;
 
-        if (plugin_writer_) {
-            plugin_writer_->write(json);
+        if (running_) {
+            auto slot = claim(*plugin_queue_);
+            slot->timestamp = timestamp;
+            slot->event = event;
+            commit(*plugin_queue_, slot);
+        } else {
+            write_plugin(event, timestamp);
         }
     }
 
@@ -586,7 +650,10 @@ public:
     MultiChannelLogger& operator=(MultiChannelLogger&&) = delete;
 
 private:
-    MultiChannelLogger() {
+    MultiChannelLogger()
+        : ops_queue_(std::make_unique<OpsQueue>())
+        , trade_queue_(std::make_unique<TradeQueue>())
+        , plugin_queue_(std::make_unique<PluginQueue>()) {
         // Initialize default writers
         ops_writer_ = std::make_unique<ChannelWriter>("core", ops_dir_);
         trade_writer_ = std::make_unique<ChannelWriter>("trade", trade_dir_);
@@ -597,36 +664,112 @@ private:
         stop();
     }
 
+    // ========================================================================
+    // Producer side
+    // ========================================================================
+
+    void enqueue_ops(Level level, std::chrono::system_clock::time_point timestamp,
+                     std::string& message, const std::source_location& loc) {
+        if (running_) {
+            auto slot = claim(*ops_queue_);
+            slot->level = level;
+            slot->line = loc.line();
+            slot->file = loc.file_name();
+            slot->timestamp = timestamp;
+            slot->message.swap(message);   // Old slot buffer leaves with `message`
+            commit(*ops_queue_, slot);
+        } else {
+            write_ops(level, loc.file_name(), loc.line(), timestamp, message);
+        }
+    }
+
+    template<typename Queue>
+    [[nodiscard]] nfx::memory::SlotClaim<typename Queue::value_type> claim(Queue& queue) noexcept {
+        auto slot = queue.try_claim();
+        if (!slot) [[unlikely]] {
+            queue_full_waits_.fetch_add(1, std::memory_order_relaxed);
+            notifier_.notify();
+            slot = queue.claim();
+        }
+        return slot;
+    }
+
+    /// Publish the slot; a syscall only if the writer is asleep
+    template<typename Queue, typename Claim>
+    void commit(Queue& queue, const Claim& slot) noexcept {
+        queue.commit(slot);
+        notifier_.notify();
+    }
+
+    // ========================================================================
+    // Writer side (single consumer)
+    // ========================================================================
+
     void write_loop(std::stop_token st) {
-        while (!st.stop_requested() || !ops_queue_.empty()) {
-            std::unique_lock lock(queue_mutex_);
-            queue_cv_.wait(lock, [this, &st] {
-                return st.stop_requested() || !ops_queue_.empty();
-            });
-
-            while (!ops_queue_.empty()) {
-                auto entry = std::move(ops_queue_.front());
-                ops_queue_.pop();
-                lock.unlock();
-                write_ops_entry(entry);
-                lock.lock();
+        while (!st.stop_requested()) {
+            if (drain_queues() != 0) continue;
+
+            // Idle: push what we wrote to disk before sleeping
+            flush_writers();
+            idle_passes_.fetch_add(1, std::memory_order_release);
+
+            notifier_.prepare_wait();
+            if (!queues_empty() || st.stop_requested()) {
+                notifier_.cancel_wait();
+                continue;
             }
+            (void)notifier_.wait(WRITER_IDLE_TIMEOUT_MS);
+        }
+    }
+
+    /// Write every published record
+    /// @return Number of records written
+    size_t drain_queues() {
+        std::lock_guard lock(config_mutex_);
+        size_t count = 0;
+        while (ops_queue_->try_consume([this](OpsRecord& r) {
+                   write_ops(r.level, r.file, r.line, r.timestamp, r.message);
+               })) {
+            ++count;
+        }
+        while (trade_queue_->try_consume([this](TradeRecord& r) {
+                   write_trade(r.event, r.timestamp);
+               })) {
+            ++count;
         }
+        while (plugin_queue_->try_consume([this](PluginRecord& r) {
+                   write_plugin(r.event, r.timestamp);
+               })) {
+            ++count;
+        }
+        records_written_.fetch_add(count, std::memory_order_relaxed);
+        return count;
     }
 
-    void write_ops_entry(const LogEntry& entry) {
-        std::string formatted = entry.format();
+    [[nodiscard]] bool queues_empty() const noexcept {
+        return ops_queue_->empty() && trade_queue_->empty() && plugin_queue_->empty();
+    }
+
+    void flush_writers() {
+        if (ops_writer_) ops_writer_->flush();
+        if (trade_writer_) trade_writer_->flush();
+        if (plugin_writer_) plugin_writer_->flush();
+    }
+
+    void write_ops(Level level, std::string_view file, uint32_t line,
+                   std::chrono::system_clock::time_point timestamp, std::string_view message) {
+        std::string formatted = format_ops_line(level, file, line, timestamp, message);
 
         if (console_output_) {
             std::lock_guard lock(console_mutex_);
 #if LOGDUMP_HAS_STD_PRINT
-            if (entry.level >= Level::WARN) {
+            if (level >= Level::WARN) {
                 std::println(stderr, "{}", formatted);
             } else {
                 std::println("{}", formatted);
             }
 #else
-            if (entry.level >= Level::WARN) {
+            if (level >= Level::WARN) {
                 std::cerr << formatted << '\n';
             } else {
                 std::cout << formatted << '\n';
@@ -635,7 +778,49 @@ private:
         }
 
         if (ops_writer_) {
-            ops_writer_->write(formatted);
+            ops_writer_->write(formatted, timestamp);
+        }
+    }
+
+    void write_trade(const TradeEvent& event, std::chrono::system_clock::time_point timestamp) {
+        std::string json = format_trade_json(event, timestamp);
+
+        if (console_output_) {
+            std::lock_guard lock(console_mutex_);
+#if LOGDUMP_HAS_STD_PRINT
+            std::println("[TRADE] {}", json);
+#else
+            std::cout << "[TRADE] " << json << '\n';
+#endif
+        }
+
+        if (trade_writer_) {
+            trade_writer_->write(json, timestamp);
+        }
+    }
+
+    void write_plugin(const LogPluginEvent& event, std::chrono::system_clock::time_point timestamp) {
+        std::string json = format_plugin_json(event, timestamp);
+
+        if (console_output_) {
+            std::lock_guard lock(console_mutex_);
+#if LOGDUMP_HAS_STD_PRINT
+            if (event.action == "ERROR") {
+                std::println(stderr, "[PLUGIN] {}", json);
+            } else {
+                std::println("[PLUGIN] {}", json);
+            }
+#else
+            if (event.action == "ERROR") {
+                std::cerr << "[PLUGIN] " << json << '\n';
+            } else {
+                std::cout << "[PLUGIN] " << json << '\n';
+            }
+#endif
+        }
+
+        if (plugin_writer_) {
+            plugin_writer_->write(json, timestamp);
         }
     }
 
@@ -649,21 +834,25 @@ private:
     std::filesystem::path ops_dir_{"logs"};
     std::filesystem::path trade_dir_{"logs/trade"};
     std::filesystem::path plugin_dir_{"logs/plugin"};
-    std::mutex config_mutex_;
+    std::mutex config_mutex_;      // Held by the writer per drain pass, never by producers
 
     // Channel writers
     std::unique_ptr<ChannelWriter> ops_writer_;
     std::unique_ptr<ChannelWriter> trade_writer_;
     std::unique_ptr<ChannelWriter> plugin_writer_;
 
-    // Async queue (for OPS channel)
+    // Async path: one ring per channel, one writer draining all three
     std::atomic<bool> running_{false};
-    std::queue<LogEntry> ops_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
+    std::unique_ptr<OpsQueue> ops_queue_;
+    std::unique_ptr<TradeQueue> trade_queue_;
+    std::unique_ptr<PluginQueue> plugin_queue_;
+    nfx::memory::QueueNotifier notifier_;
+    std::atomic<uint64_t> idle_passes_{0};
+    std::atomic<uint64_t> records_written_{0};
+    std::atomic<uint64_t> queue_full_waits_{0};
     std::jthread writer_thread_;
 
-    // Console mutex
+    // Console mutex (the sync path may print from several threads)
     std::mutex console_mutex_;
 };
 
@@ -139,10 +139,17 @@ void test_tcp_acceptor() {
     auto result = acceptor.listen(0);  // Port 0 = let OS choose
     TEST_ASSERT(result.has_value());
     TEST_ASSERT(acceptor.is_listening());
+    TEST_ASSERT(acceptor.local_port() != 0);
 
     // Close
     acceptor.close();
     TEST_ASSERT(!acceptor.is_listening());
+    TEST_ASSERT(acceptor.local_port() == 0);
+
+    // Dual-stack (falls back to IPv4 without IPv6)
+    TEST_ASSERT(acceptor.listen(0, 16, true).has_value());
+    TEST_ASSERT(acceptor.local_port() != 0);
+    acceptor.close();
 
     std::cout << "TCP acceptor: PASS\n";
 }
@@ -0,0 +1,368 @@
+// Allocation-tracking tests: hot paths marked with NFX_NO_ALLOC_REGION must
+// not touch the heap once warm. Built as its own executable with
+// NFX_TRACK_ALLOCATIONS, since the hooks replace the global allocator.
+
+#define NFX_ALLOCATION_TRACKER_HOOKS
+#include "nexusfix/util/allocation_tracker.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/store/mmap_message_store.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+using namespace nfx;
+using util::AllocationTracker;
+
+namespace {
+
+std::string make_message(std::string_view msg_type, uint32_t seq, std::string_view body = {}) {
+    std::string fields = "35=" + std::string{msg_type} + "\x01" "49=BROKER\x01" "56=CLIENT\x01"
+                         "34=" + std::to_string(seq) + "\x01" "52=20240102-09:30:00.000\x01";
+    fields += body;
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(fields.size()) + "\x01" + fields;
+    auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+/// Handler that only counts and copies into fixed storage
+struct CountingHandler {
+    std::array<char, 1024> last_sent{};
+    size_t last_size{0};
+    size_t sends{0};
+    size_t app_messages{0};
+    size_t errors{0};
+
+    void on_app_message(const ParsedMessage&) noexcept { ++app_messages; }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char> data) noexcept {
+        last_size = std::min(data.size(), last_sent.size());
+        std::memcpy(last_sent.data(), data.data(), last_size);
+        ++sends;
+        return true;
+    }
+    void on_error(const SessionError&) noexcept { ++errors; }
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+SessionConfig client_config() {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "BROKER";
+    return config;
+}
+
+/// Keeps the compiler from eliding a new/delete pair
+void* volatile escape_sink = nullptr;
+
+std::string describe_violations() {
+    std::string out;
+    for (const auto& v : AllocationTracker::recorded()) {
+        out += std::string{v.region ? v.region : "?"} + " (" + std::to_string(v.size) + " bytes); ";
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST_CASE("Allocation tracker observes regions", "[alloc]") {
+    REQUIRE(AllocationTracker::hooks_installed());
+    AllocationTracker::reset();
+
+    SECTION("Allocations outside a region are counted, not flagged") {
+        const uint64_t n = AllocationTracker::count([] {
+            std::vector<int> v(100);
+            void* p = std::malloc(64);
+            std::free(p);
+        });
+        REQUIRE(n == 2);
+        REQUIRE(AllocationTracker::violations() == 0);
+    }
+
+    SECTION("Allocations inside a region are flagged with the region name") {
+        {
+            util::NoAllocRegion outer{"outer"};
+            util::NoAllocRegion inner{"inner"};
+            auto p = std::make_unique<std::array<char, 256>>();
+            escape_sink = p.get();
+        }
+        REQUIRE(AllocationTracker::violations() == 1);
+        REQUIRE(std::string_view{AllocationTracker::recorded()[0].region} == "outer");
+        REQUIRE(AllocationTracker::recorded()[0].size == 256);
+    }
+
+    SECTION("C allocations and aligned new are caught") {
+        {
+            util::NoAllocRegion region{"c"};
+            void* p = std::calloc(4, 16);
+            p = std::realloc(p, 128);
+            std::free(p);
+            void* aligned = nullptr;
+            REQUIRE(::posix_memalign(&aligned, 64, 64) == 0);
+            std::free(aligned);
+            struct alignas(128) Wide { char bytes[128]; };
+            auto* wide = new Wide{};
+            escape_sink = wide;
+            delete wide;
+        }
+        REQUIRE(AllocationTracker::violations() == 4);
+    }
+
+    SECTION("Exempt sub-regions are not flagged") {
+        {
+            util::NoAllocRegion region{"hot"};
+            util::AllowAllocRegion cold;
+            std::string s(100, 'x');
+        }
+        REQUIRE(AllocationTracker::violations() == 0);
+    }
+
+    SECTION("PMR upstreams are tracked through TrackedResource") {
+        std::array<std::byte, 256> local{};
+        std::pmr::monotonic_buffer_resource arena{local.data(), local.size(),
+                                                  std::pmr::null_memory_resource()};
+        util::TrackedResource tracked{&arena};
+        {
+            util::NoAllocRegion region{"pmr"};
+            std::pmr::vector<int> v{&tracked};
+            v.reserve(8);
+        }
+        REQUIRE(AllocationTracker::violations() == 1);
+    }
+}
+
+TEST_CASE("Allocation tracker flags known allocating helpers", "[alloc]") {
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    for (uint32_t seq = 1; seq <= 4; ++seq) {
+        const std::string msg = make_message("D", seq, "11=ORD1\x01");
+        REQUIRE(message_store.store(seq, msg));
+    }
+    AllocationTracker::reset();
+
+    SECTION("retrieve_range copies into vectors") {
+        {
+            util::NoAllocRegion region{"resend"};
+            auto msgs = message_store.retrieve_range(1, 4);
+            REQUIRE(msgs.size() == 4);
+        }
+        REQUIRE(AllocationTracker::violations() >= 5);
+        REQUIRE(std::string_view{AllocationTracker::recorded()[0].region} == "resend");
+    }
+
+    SECTION("visit_range does not") {
+        size_t visited = 0;
+        {
+            util::NoAllocRegion region{"resend"};
+            visited = message_store.visit_range(1, 4,
+                [](void* ctx, uint32_t, std::span<const char>) noexcept {
+                    ++*static_cast<size_t*>(ctx);
+                    return true;
+                }, &visited);
+        }
+        REQUIRE(visited == 4);
+        REQUIRE(AllocationTracker::violations() == 0);
+    }
+
+    SECTION("std::function with a capture beyond the small buffer") {
+        std::array<char, 64> state{};
+        {
+            util::NoAllocRegion region{"callback"};
+            std::function<size_t()> fn = [state] { return state.size(); };
+            REQUIRE(fn() == 64);
+        }
+        REQUIRE(AllocationTracker::violations() == 1);
+    }
+}
+
+TEST_CASE("Session steady state is allocation-free", "[alloc][session]") {
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    SessionManager<CountingHandler> session{client_config()};
+    session.set_message_store(&message_store);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+    session.on_data_received(logon);
+    REQUIRE(session.state() == SessionState::Active);
+
+    // Pre-rendered inbound traffic: heartbeats, a TestRequest (answered with
+    // a Heartbeat through send_message) and ExecutionReports
+    std::vector<std::string> inbound;
+    for (uint32_t seq = 2; seq < 200; ++seq) {
+        if (seq % 50 == 0) inbound.push_back(make_message("1", seq, "112=PING\x01"));
+        else if (seq % 10 == 0) inbound.push_back(make_message("0", seq));
+        else inbound.push_back(make_message("8", seq, "37=O1\x01" "11=ORD1\x01" "150=F\x01" "39=2\x01"));
+    }
+
+    fix44::NewOrderSingle::Builder order;
+    order.cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25));
+
+    // Warm up lazily created state (batches, store window) on the first pass
+    const auto run = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            session.on_data_received(inbound[i]);
+            if (i % 4 == 0) REQUIRE(session.send_app_message(order).has_value());
+        }
+    };
+    run(0, 60);
+    AllocationTracker::reset();
+    run(60, inbound.size());
+
+    INFO(describe_violations());
+    REQUIRE(AllocationTracker::violations() == 0);
+    REQUIRE(session.handler().errors == 0);
+    REQUIRE(session.handler().app_messages > 100);
+    REQUIRE(session.stats().heartbeats_received > 0);
+}
+
+TEST_CASE("Inbound gap tracking is allocation-free", "[alloc][session]") {
+    SessionManager<CountingHandler> session{client_config()};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+    session.on_data_received(logon);
+
+    // Every other seqnum missing: one new range (and ResendRequest) each,
+    // past the reserved ranges into grow()'s exempt growth
+    const uint32_t ranges = GapTracker::DEFAULT_CAPACITY + 64;
+    std::vector<std::string> inbound;
+    for (uint32_t seq = 3; seq <= 2 * ranges + 1; seq += 2) inbound.push_back(make_message("0", seq));
+    session.on_data_received(inbound[0]);
+
+    AllocationTracker::reset();
+    for (size_t i = 1; i < inbound.size(); ++i) session.on_data_received(inbound[i]);
+
+    INFO(describe_violations());
+    REQUIRE(AllocationTracker::violations() == 0);
+    REQUIRE(session.inbound_gaps().gap_count() == ranges);
+    REQUIRE(session.inbound_gaps().capacity() >= ranges);
+}
+
+TEST_CASE("Handler allocations are attributed to the session region", "[alloc][session]") {
+    struct AllocatingHandler : CountingHandler {
+        std::vector<std::string> seen;
+        void on_app_message(const ParsedMessage& msg) noexcept {
+            seen.emplace_back(msg.get_string(tag::ClOrdID::value));
+        }
+    };
+
+    SessionManager<AllocatingHandler> session{client_config()};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+    session.on_data_received(logon);
+    const std::string exec = make_message("8", 2, "11=A-CLORDID-LONGER-THAN-SSO\x01");
+
+    AllocationTracker::reset();
+    session.on_data_received(exec);
+    REQUIRE(AllocationTracker::violations() >= 1);
+    REQUIRE(std::string_view{AllocationTracker::recorded()[0].region} ==
+            "SessionManager::on_data_received");
+}
+
+TEST_CASE("Message builders are allocation-free", "[alloc][messages]") {
+    MessageAssembler assembler;
+    AllocationTracker::reset();
+
+    fix44::NewOrderSingle::Builder order;
+    auto nos = order.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(7)
+        .sending_time("20240102-09:30:00.000").cl_ord_id("ORD1").symbol("AAPL")
+        .side(Side::Buy).transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25)).build(assembler);
+    REQUIRE(ParsedMessage::parse(nos).has_value());
+
+    fix44::Heartbeat::Builder heartbeat;
+    auto hb = heartbeat.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(8)
+        .sending_time("20240102-09:30:00.000").test_req_id("PING").build(assembler);
+    REQUIRE(ParsedMessage::parse(hb).has_value());
+
+    INFO(describe_violations());
+    REQUIRE(AllocationTracker::violations() == 0);
+}
+
+TEST_CASE("Message stores are allocation-free once warm", "[alloc][store]") {
+    std::vector<std::string> messages;
+    for (uint32_t seq = 1; seq <= 512; ++seq) {
+        messages.push_back(make_message("D", seq, "11=ORD" + std::to_string(seq) + "\x01"));
+    }
+
+    SECTION("MemoryMessageStore") {
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 128, .max_bytes = 64 * 1024}};
+        REQUIRE(s.store(1, messages[0]));
+        AllocationTracker::reset();
+        for (uint32_t seq = 2; seq <= messages.size(); ++seq) {
+            REQUIRE(s.store(seq, messages[seq - 1]));
+        }
+        INFO(describe_violations());
+        REQUIRE(AllocationTracker::violations() == 0);
+    }
+
+    SECTION("MmapMessageStore") {
+        namespace fs = std::filesystem;
+        const fs::path dir = fs::temp_directory_path() / ("nfx_alloc_store_" + std::to_string(::getpid()));
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        {
+            auto opened = store::MmapMessageStore::open(store::MmapMessageStore::Config{
+                .session_id = "S", .directory = dir.string(), .journal_size = 1024 * 1024,
+                .max_seq = 4096, .async_flush = false});
+            REQUIRE(opened.has_value());
+            auto& s = **opened;
+            REQUIRE(s.store(1, messages[0]));
+            AllocationTracker::reset();
+            for (uint32_t seq = 2; seq <= messages.size(); ++seq) {
+                REQUIRE(s.store(seq, messages[seq - 1]));
+            }
+            INFO(describe_violations());
+            REQUIRE(AllocationTracker::violations() == 0);
+        }
+        fs::remove_all(dir);
+    }
+}
+
+TEST_CASE("TcpSocket send is allocation-free", "[alloc][transport]") {
+    TcpAcceptor acceptor;
+    REQUIRE(acceptor.listen(0).has_value());
+    TcpSocket client;
+    REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+    auto accepted = acceptor.accept();
+    REQUIRE(accepted.has_value());
+    TcpSocket server;
+    server.adopt(*accepted);
+
+    const std::string msg = make_message("D", 1, "11=ORD1\x01");
+    std::array<char, 4096> buffer{};
+    AllocationTracker::reset();
+    for (int i = 0; i < 16; ++i) {
+        auto sent = client.send(msg);
+        REQUIRE(sent.has_value());
+        REQUIRE(*sent == msg.size());
+        auto received = server.receive(buffer);
+        REQUIRE(received.has_value());
+    }
+    INFO(describe_violations());
+    REQUIRE(AllocationTracker::violations() == 0);
+}
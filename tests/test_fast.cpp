@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/fast/decoder.hpp"
+#include "nexusfix/fast/md_entry_decode.hpp"
+#include "nexusfix/fast/stop_bit.hpp"
+
+using namespace nfx;
+using namespace nfx::fast;
+
+namespace {
+
+// Minimal FAST encoder for building test input
+struct Encoder {
+    std::string bytes;
+
+    Encoder& uint(uint64_t v) {
+        char groups[10];
+        size_t n = 0;
+        do {
+            groups[n++] = static_cast<char>(v & 0x7F);
+            v >>= 7;
+        } while (v != 0);
+        for (size_t i = n; i-- > 0;) {
+            bytes.push_back(static_cast<char>(groups[i] | (i == 0 ? 0x80 : 0)));
+        }
+        return *this;
+    }
+
+    Encoder& sint(int64_t v) {
+        char groups[10];
+        size_t n = 0;
+        for (;;) {
+            groups[n++] = static_cast<char>(v & 0x7F);
+            const bool sign = (v & 0x40) != 0;
+            v >>= 7;  // Arithmetic shift
+            if ((v == 0 && !sign) || (v == -1 && sign)) break;
+        }
+        for (size_t i = n; i-- > 0;) {
+            bytes.push_back(static_cast<char>(groups[i] | (i == 0 ? 0x80 : 0)));
+        }
+        return *this;
+    }
+
+    Encoder& null() { return uint(0); }
+    Encoder& nullable_uint(uint64_t v) { return uint(v + 1); }
+    Encoder& nullable_int(int64_t v) { return sint(v >= 0 ? v + 1 : v); }
+
+    Encoder& ascii(std::string_view s) {
+        if (s.empty()) {
+            bytes.push_back(static_cast<char>(0x80));
+            return *this;
+        }
+        bytes.append(s.substr(0, s.size() - 1));
+        bytes.push_back(static_cast<char>(s.back() | 0x80));
+        return *this;
+    }
+
+    /// Presence map from '1'/'0' characters
+    Encoder& pmap(std::string_view bits) {
+        std::string padded{bits};
+        while (padded.empty() || padded.size() % 7 != 0) padded.push_back('0');
+        // Trailing all-zero groups may be dropped (but keep one)
+        while (padded.size() > 7 && padded.substr(padded.size() - 7) == "0000000") {
+            padded.resize(padded.size() - 7);
+        }
+        for (size_t i = 0; i < padded.size(); i += 7) {
+            char byte = 0;
+            for (size_t b = 0; b < 7; ++b) byte = static_cast<char>((byte << 1) | (padded[i + b] == '1'));
+            if (i + 7 == padded.size()) byte = static_cast<char>(byte | 0x80);
+            bytes.push_back(byte);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] std::span<const char> span() const { return {bytes.data(), bytes.size()}; }
+};
+
+}  // namespace
+
+// ============================================================================
+// Stop-Bit Primitives
+// ============================================================================
+
+TEST_CASE("FAST stop-bit integers", "[fast][stop_bit]") {
+    SECTION("Specification examples") {
+        const char uint_bytes[] = {0x39, 0x45, static_cast<char>(0xA3)};
+        FastReader r{uint_bytes, sizeof(uint_bytes)};
+        REQUIRE(r.uint32() == 942755);
+        REQUIRE(r.at_end());
+
+        const char neg_bytes[] = {0x46, 0x3A, static_cast<char>(0xDD)};
+        FastReader n{neg_bytes, sizeof(neg_bytes)};
+        REQUIRE(n.int32() == -942755);
+
+        // 64 needs a leading 0 group so bit 6 does not read as a sign
+        const char pos_bytes[] = {0x00, static_cast<char>(0xC0)};
+        FastReader p{pos_bytes, sizeof(pos_bytes)};
+        REQUIRE(p.int32() == 64);
+    }
+
+    SECTION("Round trip over every length, with and without slack after the field") {
+        const std::vector<uint64_t> unsigned_values = {
+            0, 1, 127, 128, 16383, 16384, 942755, UINT32_MAX,
+            (1ULL << 49) - 1, 1ULL << 49, (1ULL << 56) - 1, 1ULL << 56, (1ULL << 63) + 12345, UINT64_MAX};
+        const std::vector<int64_t> signed_values = {
+            0, 1, -1, 63, 64, -64, -65, 8191, -8192, -942755, INT32_MIN, INT32_MAX,
+            (1LL << 55) - 1, -(1LL << 55), INT64_MIN, INT64_MAX};
+
+        for (size_t slack : {size_t{0}, size_t{32}}) {
+            Encoder e;
+            for (uint64_t v : unsigned_values) e.uint(v);
+            for (int64_t v : signed_values) e.sint(v);
+            e.bytes.append(slack, '\x01');   // No stop bits: never read as data
+
+            FastReader r{e.bytes.data(), e.bytes.size()};
+            for (uint64_t v : unsigned_values) REQUIRE(r.uint64() == v);
+            for (int64_t v : signed_values) REQUIRE(r.int64() == v);
+            REQUIRE(r.ok());
+            REQUIRE(r.remaining() == slack);
+        }
+    }
+
+    SECTION("Nullable values") {
+        Encoder e;
+        e.null().nullable_uint(0).nullable_uint(41).null().nullable_int(0).nullable_int(-5);
+        FastReader r{e.bytes.data(), e.bytes.size()};
+        REQUIRE_FALSE(r.nullable_uint64().has_value());
+        REQUIRE(r.nullable_uint64() == 0u);
+        REQUIRE(r.nullable_uint64() == 41u);
+        REQUIRE_FALSE(r.nullable_int64().has_value());
+        REQUIRE(r.nullable_int64() == 0);
+        REQUIRE(r.nullable_int64() == -5);
+    }
+
+    SECTION("Errors are sticky") {
+        const char truncated[] = {0x01, 0x02};
+        FastReader r{truncated, sizeof(truncated)};
+        REQUIRE(r.uint32() == 0);
+        REQUIRE(r.error() == FastError::Truncated);
+        REQUIRE(r.at_end());
+
+        Encoder big;
+        big.uint(1ULL << 40);
+        FastReader o{big.bytes.data(), big.bytes.size()};
+        (void)o.uint32();
+        REQUIRE(o.error() == FastError::Overflow);
+    }
+}
+
+TEST_CASE("FAST strings and presence maps", "[fast][stop_bit]") {
+    Encoder e;
+    e.ascii("ESZ5").ascii("").pmap("1011").pmap("00000001");
+    e.bytes += std::string{"\x00\x80", 2};   // Nullable empty string
+    e.bytes.push_back(static_cast<char>(0x80));   // Nullable NULL
+
+    FastReader r{e.bytes.data(), e.bytes.size()};
+    char buf[8];
+    auto n = r.ascii(buf, sizeof(buf), false);
+    REQUIRE(n == 4u);
+    REQUIRE(std::string_view{buf, *n} == "ESZ5");
+    REQUIRE(r.ascii(buf, sizeof(buf), false) == 0u);
+
+    PresenceMap pm = r.pmap();
+    REQUIRE(pm.next());
+    REQUIRE_FALSE(pm.next());
+    REQUIRE(pm.next());
+    REQUIRE(pm.next());
+    for (int i = 0; i < 60; ++i) REQUIRE_FALSE(pm.next());   // Past the end reads 0
+
+    PresenceMap two = r.pmap();
+    for (int i = 0; i < 7; ++i) REQUIRE_FALSE(two.next());
+    REQUIRE(two.next());
+
+    REQUIRE(r.ascii(buf, sizeof(buf), true) == 0u);
+    REQUIRE_FALSE(r.ascii(buf, sizeof(buf), true).has_value());
+    REQUIRE(r.ok());
+
+    Encoder longer;
+    longer.ascii("TOO-LONG-SYMBOL");
+    FastReader l{longer.bytes.data(), longer.bytes.size()};
+    REQUIRE_FALSE(l.ascii(buf, sizeof(buf), false).has_value());
+    REQUIRE(l.error() == FastError::LengthExceeded);
+}
+
+// ============================================================================
+// Templates
+// ============================================================================
+
+namespace {
+
+using IncRefresh = Template<32,
+    Ascii<35, Op::Constant, Presence::Mandatory, "X">,
+    UInt32<34, Op::Increment>,
+    UInt64<52, Op::Delta>,
+    Sequence<UInt32<268>,
+        UInt32<279, Op::Copy>,
+        Ascii<269, Op::Copy>,
+        Ascii<55, Op::Copy>,
+        UInt32<83, Op::Increment>,
+        Decimal<270, Op::Delta>,
+        Int64<271, Op::Delta>,
+        UInt32<346, Op::Default, Presence::Optional>,
+        UInt32<1023, Op::Copy, Presence::Optional>>>;
+
+using Snapshot = Template<33,
+    Ascii<35, Op::Constant, Presence::Mandatory, "W">,
+    UInt32<34>,
+    Ascii<55>,
+    UInt64<48, Op::None, Presence::Optional>,
+    Sequence<UInt32<268>,
+        Ascii<269, Op::Default, Presence::Mandatory, "0">,
+        Decimal<270>,
+        Decimal<271, Op::Copy, Presence::Mandatory, 1, 0>>>;
+
+/// Records every callback
+struct Trace {
+    std::vector<std::string> events;
+
+    void on_template(uint32_t id) { events.push_back("T" + std::to_string(id)); }
+    void on_end(uint32_t id) { events.push_back("E" + std::to_string(id)); }
+    template <int Tag> void on_uint(uint64_t v) { events.push_back(std::to_string(Tag) + "=" + std::to_string(v)); }
+    template <int Tag> void on_int(int64_t v) { events.push_back(std::to_string(Tag) + "=" + std::to_string(v)); }
+    template <int Tag> void on_decimal(int64_t m, int32_t e) {
+        events.push_back(std::to_string(Tag) + "=" + std::to_string(m) + "e" + std::to_string(e));
+    }
+    template <int Tag> void on_string(std::string_view v) {
+        events.push_back(std::to_string(Tag) + "=" + std::string{v});
+    }
+    template <int Tag> void on_sequence(uint32_t n) { events.push_back("#" + std::to_string(Tag) + "=" + std::to_string(n)); }
+    template <int Tag> void on_element(uint32_t) {}
+};
+
+// Pmap bits of one IncRefresh element: 279, 269, 55, 83, 346, 1023
+Encoder& inc_header(Encoder& e, bool with_template, uint32_t seq, int64_t time_delta, uint32_t entries) {
+    if (with_template) {
+        e.pmap("11").uint(32).uint(seq);    // Template ID, MsgSeqNum
+    } else {
+        e.pmap("00");                       // Same template, MsgSeqNum + 1
+    }
+    return e.sint(time_delta).uint(entries);
+}
+
+}  // namespace
+
+TEST_CASE("FAST decoder operators", "[fast][decoder]") {
+    Decoder<IncRefresh, Snapshot> decoder;
+
+    SECTION("Copy, increment, delta and default carry across messages") {
+        Encoder e;
+        // Message 1: two entries, every copy field sent
+        inc_header(e, true, 100, 1'700'000'000'000, 2);
+        e.pmap("111111").uint(0).ascii("0").ascii("ESZ5").uint(7)
+            .sint(-2).sint(450025)          // 4500.25
+            .sint(10)
+            .nullable_uint(3)               // NumberOfOrders
+            .nullable_uint(1);              // MDPriceLevel
+        e.pmap("1001").uint(1).uint(50)     // Change; 269 / 55 copied; RptSeq 50
+            .sint(0).sint(25)               // 4500.50
+            .sint(5);                       // Size 15; 346 absent (no default); 1023 copied
+        // Message 2: template and MsgSeqNum implied, everything copied or incremented
+        inc_header(e, false, 0, 250, 1);
+        e.pmap("0").sint(0).sint(-50).sint(-14);
+
+        Trace trace;
+        FastError error{};
+        REQUIRE(decoder.decode(e.span(), trace, &error) == 2);
+        REQUIRE(error == FastError::None);
+        REQUIRE(trace.events == std::vector<std::string>{
+            "T32", "35=X", "34=100", "52=1700000000000", "#268=2",
+            "279=0", "269=0", "55=ESZ5", "83=7", "270=450025e-2", "271=10", "346=3", "1023=1",
+            "279=1", "269=0", "55=ESZ5", "83=50", "270=450050e-2", "271=15", "1023=1",
+            "E32",
+            "T32", "35=X", "34=101", "52=1700000000250", "#268=1",
+            "279=1", "269=0", "55=ESZ5", "83=51", "270=450000e-2", "271=1", "1023=1",
+            "E32"});
+    }
+
+    SECTION("Second template keeps its own dictionary; reset() restores initial values") {
+        Encoder e;
+        e.pmap("1").uint(33).uint(7).ascii("NQH6").nullable_uint(123).uint(2);
+        e.pmap("01").sint(-2).sint(1000).sint(0).sint(3);     // 269 default "0", size sent
+        e.pmap("10").ascii("1").sint(-2).sint(1001);          // size copied
+        Trace trace;
+        REQUIRE(decoder.decode(e.span(), trace) == 1);
+        REQUIRE(trace.events == std::vector<std::string>{
+            "T33", "35=W", "34=7", "55=NQH6", "48=123", "#268=2",
+            "269=0", "270=1000e-2", "271=3e0",
+            "269=1", "270=1001e-2", "271=3e0", "E33"});
+
+        // Copy falls back to the initial value after reset
+        decoder.reset();
+        Encoder again;
+        again.pmap("1").uint(33).uint(8).ascii("NQH6").null().uint(1);
+        again.pmap("00").sint(-2).sint(999);
+        Trace second;
+        REQUIRE(decoder.decode(again.span(), second) == 1);
+        REQUIRE(second.events.back() == "E33");
+        REQUIRE(second.events[second.events.size() - 2] == "271=1e0");
+    }
+
+    SECTION("Errors stop decoding") {
+        Encoder unknown;
+        unknown.pmap("1").uint(99);
+        Trace trace;
+        FastError error{};
+        REQUIRE(decoder.decode(unknown.span(), trace, &error) == 0);
+        REQUIRE(error == FastError::UnknownTemplate);
+
+        // Copy field with no previous value and no pmap bit
+        Encoder missing;
+        inc_header(missing, true, 1, 0, 1);
+        missing.pmap("0").sint(0).sint(1).sint(1);
+        Decoder<IncRefresh> fresh;
+        REQUIRE(fresh.decode(missing.span(), trace, &error) == 0);
+        REQUIRE(error == FastError::MissingValue);
+
+        Encoder cut;
+        inc_header(cut, true, 1, 0, 1);
+        REQUIRE(fresh.decode(cut.span(), trace, &error) == 0);
+        REQUIRE(error == FastError::Truncated);
+    }
+}
+
+TEST_CASE("FAST decode into MDEntryColumns", "[fast][market_data]") {
+    Decoder<IncRefresh, Snapshot> decoder;
+    MDEntryColumns<2> cols;
+    std::array<int64_t, 2> security_ids{};
+    MDEntrySink sink{cols, security_ids};
+
+    Encoder e;
+    inc_header(e, true, 5, 1000, 3);
+    e.pmap("111111").uint(2).ascii("1").ascii("ESZ5").uint(9).sint(-2).sint(450025).sint(4)
+        .nullable_uint(2).nullable_uint(3);
+    e.pmap("001").ascii("NQH6").sint(0).sint(-25).sint(0);
+    e.pmap("0").sint(0).sint(0).sint(0);
+    e.pmap("1").uint(33).uint(6).ascii("CLF6").nullable_uint(42).uint(1);
+    e.pmap("01").sint(-3).sint(71250).sint(0).sint(20);
+
+    FastReader reader{e.bytes.data(), e.bytes.size()};
+    REQUIRE(decoder.decode_message(reader, sink));
+    REQUIRE(sink.template_id() == 32);
+    REQUIRE(sink.msg_type() == 'X');
+    REQUIRE(sink.msg_seq_num() == 5);
+    REQUIRE(cols.count == 2);
+    REQUIRE(cols.truncated);                // Third entry past Capacity
+
+    const MDEntryRow first = cols.row(0);
+    REQUIRE(first.update_action == MDUpdateAction::Delete);
+    REQUIRE(first.entry_type == MDEntryType::Offer);
+    REQUIRE(first.price.raw == FixedPrice::from_string("4500.25").raw);
+    REQUIRE(first.size.raw == 4 * Qty::SCALE);
+    REQUIRE(first.rpt_seq == 9);
+    REQUIRE(first.number_of_orders == 2);
+    REQUIRE(first.position_no == 3);
+    REQUIRE(cols.symbol(0) == "ESZ5");
+
+    const MDEntryRow second = cols.row(1);
+    REQUIRE(second.update_action == MDUpdateAction::Delete);    // Copied
+    REQUIRE(second.rpt_seq == 10);                              // Incremented
+    REQUIRE(second.price.raw == FixedPrice::from_string("4500.00").raw);
+    REQUIRE(second.number_of_orders == 0);                      // Optional default, absent
+    REQUIRE(cols.symbol(1) == "NQH6");
+    REQUIRE(cols.symbol_count == 2);
+
+    // Snapshot: message-level symbol and SecurityID apply to every row
+    REQUIRE(decoder.decode_message(reader, sink));
+    REQUIRE(reader.at_end());
+    REQUIRE(sink.msg_type() == 'W');
+    REQUIRE(sink.security_id() == 42);
+    REQUIRE(cols.count == 1);
+    REQUIRE_FALSE(cols.truncated);
+    REQUIRE(cols.symbol(0) == "CLF6");
+    REQUIRE(security_ids[0] == 42);
+    REQUIRE(cols.row(0).entry_type == MDEntryType::Bid);
+    REQUIRE(cols.row(0).price.raw == FixedPrice::from_string("71.25").raw);
+    REQUIRE(cols.row(0).size.raw == 20 * Qty::SCALE);
+}
@@ -0,0 +1,1349 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/store/io_uring_journal_store.hpp"
+#include "nexusfix/transport/batch_submitter.hpp"
+#include "nexusfix/transport/io_uring_reactor.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/transport/reconnect_manager.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+using namespace nfx;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+/// Fresh per-test directory under the system temp dir
+fs::path scratch_dir(const std::string& name) {
+    const fs::path dir = fs::temp_directory_path() /
+                         ("nfx_" + name + "_" + std::to_string(::getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+std::string order_message(uint32_t seq) {
+    return "8=FIX.4.4\x01" "35=D\x01" "34=" + std::to_string(seq) + "\x01" +
+           "11=ORD" + std::to_string(100000 + seq) + "\x01" "55=AAPL\x01" "38=100\x01";
+}
+
+std::string read_file(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+void write_file(const fs::path& path, const std::string& content) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+std::string as_string(const std::optional<std::vector<char>>& msg) {
+    return msg ? std::string(msg->begin(), msg->end()) : std::string{};
+}
+
+/// Complete heartbeat with body length and checksum
+std::string heartbeat(uint32_t seq) {
+    const std::string body = "35=0\x01" "49=CLIENT\x01" "56=BROKER\x01" "34=" +
+                             std::to_string(seq) + "\x01" "52=20260102-09:30:00.000\x01";
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+    const auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), cs.size()} + "\x01";
+}
+
+/// Records every reactor callback
+struct ReactorProbe final : IReactorHandler {
+    std::vector<std::string> messages;
+    int connected{0};
+    int timers{0};
+    int receive_batches{0};
+    bool closed{false};
+    TransportError close_error{};
+
+    void on_connected() noexcept override { ++connected; }
+    void on_message(std::span<const char> message) noexcept override {
+        messages.emplace_back(message.begin(), message.end());
+    }
+    void on_receive_complete() noexcept override { ++receive_batches; }
+    void on_timer() noexcept override { ++timers; }
+    void on_closed(const TransportError& error) noexcept override {
+        closed = true;
+        close_error = error;
+    }
+};
+
+/// Drive the reactor until done() or five seconds pass
+template <typename Done>
+bool run_until(IoUringReactor& reactor, Done&& done) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done() && std::chrono::steady_clock::now() < deadline) (void)reactor.run_once(10);
+    return done();
+}
+
+/// Read exactly size bytes from a non-blocking fd, running the reactor
+/// while the data is on its way
+std::string read_exactly(IoUringReactor& reactor, int fd, size_t size) {
+    std::string data;
+    char buffer[4096];
+    (void)run_until(reactor, [&] {
+        const ssize_t n = ::recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (n > 0) data.append(buffer, static_cast<size_t>(n));
+        return data.size() >= size;
+    });
+    return data;
+}
+
+/// One eventfd write through the ring; returns the CQE result
+int ring_write(IoUringContext& ctx, int efd, const uint64_t& value) {
+    auto* sqe = ctx.get_sqe();
+    if (!sqe) return -EBUSY;
+    io_uring_prep_write(sqe, efd, &value, sizeof(value), 0);
+    if (ctx.submit() < 0) return -EIO;
+    struct io_uring_cqe* cqe;
+    if (ctx.wait(&cqe, 2000) != 0) return -ETIME;
+    const int res = cqe->res;
+    ctx.seen(cqe);
+    return res;
+}
+
+void write_all(int fd, const std::string& data) {
+    REQUIRE(::send(fd, data.data(), data.size(), MSG_NOSIGNAL) ==
+            static_cast<ssize_t>(data.size()));
+}
+
+} // namespace
+
+// ============================================================================
+// IoUringJournalStore
+// ============================================================================
+
+TEST_CASE("IoUringJournalStore round trip and reopen", "[io_uring][store]") {
+    const fs::path dir = scratch_dir("uring_journal");
+    IoUringContext ring;
+    REQUIRE(ring.init().has_value());
+
+    // Small blocks and a short window: records cross into blocks that are
+    // no longer in memory and must be read back from the file
+    store::IoUringJournalStore::Config config{
+        .session_id = "CLIENT-BROKER",
+        .directory = dir.string(),
+        .block_size = 8192,
+        .num_blocks = 2};
+    constexpr uint32_t COUNT = 400;
+
+    {
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        auto& s = **opened;
+        REQUIRE(s.message_count() == 0);
+
+        for (uint32_t seq = 1; seq <= COUNT; ++seq) {
+            REQUIRE(s.store(seq, order_message(seq)));
+            if (seq % 25 == 0) {
+                (void)s.commit();
+                (void)s.poll();
+            }
+        }
+        REQUIRE_FALSE(s.store(COUNT, order_message(COUNT)));  // Not increasing
+        s.flush();
+        REQUIRE(s.pending_bytes() == 0);
+        REQUIRE_FALSE(s.commit_in_flight());
+        REQUIRE(s.write_errors() == 0);
+        REQUIRE(s.commits() >= 1);
+
+        REQUIRE(s.message_count() == COUNT);
+        for (uint32_t seq = 1; seq <= COUNT; ++seq) {
+            INFO(seq);
+            REQUIRE(as_string(s.retrieve(seq)) == order_message(seq));
+        }
+        REQUIRE_FALSE(s.retrieve(COUNT + 1).has_value());
+    }
+
+    SECTION("Reopen recovers every durable record") {
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        auto& s = **opened;
+        REQUIRE(s.message_count() == COUNT);
+        REQUIRE(s.get_next_sender_seq_num() == COUNT + 1);
+        REQUIRE(as_string(s.retrieve(1)) == order_message(1));
+        REQUIRE(as_string(s.retrieve(COUNT / 2)) == order_message(COUNT / 2));
+        REQUIRE(as_string(s.retrieve(COUNT)) == order_message(COUNT));
+
+        // Appends continue after the recovered tail
+        REQUIRE(s.store(COUNT + 1, order_message(COUNT + 1)));
+        s.flush();
+        REQUIRE(as_string(s.retrieve(COUNT + 1)) == order_message(COUNT + 1));
+    }
+
+    SECTION("Reset starts an epoch that hides the old records") {
+        {
+            auto opened = store::IoUringJournalStore::open(ring, config);
+            REQUIRE(opened.has_value());
+            auto& s = **opened;
+            s.reset();
+            REQUIRE(s.message_count() == 0);
+            REQUIRE(s.store(1, order_message(7)));
+            s.flush();
+        }
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        REQUIRE((*opened)->message_count() == 1);
+        REQUIRE(as_string((*opened)->retrieve(1)) == order_message(7));
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("IoUringJournalStore resend range", "[io_uring][store]") {
+    const fs::path dir = scratch_dir("uring_journal_range");
+    IoUringContext ring;
+    REQUIRE(ring.init().has_value());
+
+    store::IoUringJournalStore::Config config{
+        .session_id = "CLIENT-BROKER",
+        .directory = dir.string(),
+        .block_size = 8192,
+        .num_blocks = 2};
+    auto opened = store::IoUringJournalStore::open(ring, config);
+    REQUIRE(opened.has_value());
+    auto& s = **opened;
+
+    // 1..200 with 101..109 never stored (sent as a gap fill)
+    for (uint32_t seq = 1; seq <= 200; ++seq) {
+        if (seq > 100 && seq < 110) continue;
+        REQUIRE(s.store(seq, order_message(seq)));
+    }
+    s.flush();
+
+    struct Visit {
+        std::vector<uint32_t> seqs;
+        bool all_match{true};
+        size_t stop_after{SIZE_MAX};
+    };
+    auto visitor = [](void* ctx, uint32_t seq, std::span<const char> msg) noexcept {
+        auto& visit = *static_cast<Visit*>(ctx);
+        visit.seqs.push_back(seq);
+        visit.all_match &= std::string(msg.begin(), msg.end()) == order_message(seq);
+        return visit.seqs.size() < visit.stop_after;
+    };
+
+    SECTION("Range read back from the file, skipping the gap") {
+        Visit visit;
+        REQUIRE(s.visit_range(95, 115, visitor, &visit) == 12);
+        REQUIRE(visit.all_match);
+        REQUIRE(visit.seqs.front() == 95);
+        REQUIRE(visit.seqs[6] == 110);
+        REQUIRE(visit.seqs.back() == 115);
+    }
+
+    SECTION("End 0 means through the last stored message") {
+        Visit visit;
+        REQUIRE(s.visit_range(190, 0, visitor, &visit) == 11);
+        REQUIRE(visit.all_match);
+        REQUIRE(visit.seqs.back() == 200);
+    }
+
+    SECTION("Visitor stops the walk") {
+        Visit visit;
+        visit.stop_after = 3;
+        REQUIRE(s.visit_range(1, 0, visitor, &visit) == 3);
+        REQUIRE(visit.seqs == std::vector<uint32_t>{1, 2, 3});
+    }
+
+    SECTION("Same range after reopen") {
+        opened->reset();  // Close: commits and waits for the chain
+        auto reopened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(reopened.has_value());
+        Visit visit;
+        REQUIRE((*reopened)->visit_range(95, 115, visitor, &visit) == 12);
+        REQUIRE(visit.all_match);
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("IoUringJournalStore corruption recovery", "[io_uring][store]") {
+    const fs::path dir = scratch_dir("uring_journal_corrupt");
+    const fs::path path = dir / "CLIENT-BROKER.ujournal";
+    IoUringContext ring;
+    REQUIRE(ring.init().has_value());
+
+    store::IoUringJournalStore::Config config{
+        .session_id = "CLIENT-BROKER",
+        .directory = dir.string(),
+        .block_size = 8192,
+        .num_blocks = 2};
+    {
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        for (uint32_t seq = 1; seq <= 100; ++seq) REQUIRE((*opened)->store(seq, order_message(seq)));
+        (*opened)->flush();
+    }
+
+    SECTION("Recovery stops at the first record that fails its checksum") {
+        std::string content = read_file(path);
+        const size_t at = content.find("11=ORD100060\x01");
+        REQUIRE(at != std::string::npos);
+        content[at + 6] ^= 0x01;
+        write_file(path, content);
+
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        auto& s = **opened;
+        REQUIRE(s.message_count() == 59);
+        REQUIRE(s.get_next_sender_seq_num() == 60);
+        REQUIRE(as_string(s.retrieve(59)) == order_message(59));
+        REQUIRE_FALSE(s.retrieve(60).has_value());
+        REQUIRE_FALSE(s.retrieve(61).has_value());
+
+        // The damaged tail is overwritten by new appends
+        REQUIRE(s.store(60, order_message(60)));
+        s.flush();
+        opened->reset();
+        auto reopened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(reopened.has_value());
+        REQUIRE((*reopened)->message_count() == 60);
+        REQUIRE(as_string((*reopened)->retrieve(60)) == order_message(60));
+    }
+
+    SECTION("Truncated tail record is dropped") {
+        const std::string content = read_file(path);
+        const size_t at = content.find("11=ORD100100\x01");
+        REQUIRE(at != std::string::npos);
+        fs::resize_file(path, at);
+
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE(opened.has_value());
+        REQUIRE((*opened)->message_count() == 99);
+        REQUIRE((*opened)->get_next_sender_seq_num() == 100);
+    }
+
+    SECTION("Bad header is reported as Corrupt") {
+        std::string content = read_file(path);
+        content[0] ^= 0x5A;
+        write_file(path, content);
+
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE_FALSE(opened.has_value());
+        REQUIRE(opened.error().code == store::StoreErrorCode::Corrupt);
+    }
+
+    SECTION("Block size mismatch is reported as Corrupt") {
+        config.block_size = 16384;
+        auto opened = store::IoUringJournalStore::open(ring, config);
+        REQUIRE_FALSE(opened.has_value());
+        REQUIRE(opened.error().code == store::StoreErrorCode::Corrupt);
+    }
+
+    fs::remove_all(dir);
+}
+
+// ============================================================================
+// IoUringReactor
+// ============================================================================
+
+namespace {
+
+/// Framing, sends, timer and close on one channel, in either buffer mode
+void exercise_attached_channel(const IoUringReactorConfig& config) {
+    IoUringReactor reactor{config};
+    REQUIRE(reactor.init().has_value());
+
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+    const int peer = fds[1];
+
+    ReactorProbe probe;
+    auto id = reactor.attach(fds[0], probe);
+    REQUIRE(id.has_value());
+    REQUIRE(probe.connected == 1);
+    REQUIRE(reactor.is_open(*id));
+    REQUIRE(reactor.channel_count() == 1);
+
+    // Three messages in one write, then one split mid-field
+    const std::string burst = heartbeat(1) + heartbeat(2) + heartbeat(3);
+    write_all(peer, burst);
+    REQUIRE(run_until(reactor, [&] { return probe.messages.size() == 3; }));
+    const std::string split = heartbeat(4);
+    write_all(peer, split.substr(0, 30));
+    (void)reactor.run_once(10);
+    REQUIRE(probe.messages.size() == 3);
+    write_all(peer, split.substr(30));
+    REQUIRE(run_until(reactor, [&] { return probe.messages.size() == 4; }));
+    REQUIRE(probe.messages[0] == heartbeat(1));
+    REQUIRE(probe.messages[2] == heartbeat(3));
+    REQUIRE(probe.messages[3] == split);
+    REQUIRE(probe.receive_batches >= 2);
+
+    // Enough traffic to recycle every receive buffer several times
+    std::string expected;
+    for (uint32_t seq = 5; seq < 200; ++seq) {
+        write_all(peer, heartbeat(seq));
+        expected += heartbeat(seq);
+        if (seq % 10 == 0) (void)reactor.run_once(0);
+    }
+    REQUIRE(run_until(reactor, [&] { return probe.messages.size() == 199; }));
+    REQUIRE(probe.messages.back() == heartbeat(199));
+
+    // Sends go out in order, later ones staged behind the one in flight
+    const std::string out = heartbeat(500) + heartbeat(501);
+    REQUIRE(reactor.send(*id, heartbeat(500)).has_value());
+    REQUIRE(reactor.send(*id, heartbeat(501)).has_value());
+    REQUIRE(read_exactly(reactor, peer, out.size()) == out);
+
+    reactor.set_timer(*id, 5);
+    REQUIRE(run_until(reactor, [&] { return probe.timers >= 2; }));
+    REQUIRE(reactor.stats().timer_fires >= 2);
+
+    SECTION("close() cancels everything and releases the slot") {
+        reactor.close(*id);
+        REQUIRE_FALSE(reactor.send(*id, heartbeat(9)).has_value());
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        REQUIRE(probe.close_error.code == TransportErrorCode::None);
+        REQUIRE(reactor.channel_count() == 0);
+        REQUIRE_FALSE(reactor.is_open(*id));
+    }
+
+    SECTION("Peer close ends the channel") {
+        ::close(peer);
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        REQUIRE(probe.close_error.code == TransportErrorCode::ConnectionClosed);
+        REQUIRE(reactor.channel_count() == 0);
+    }
+
+    REQUIRE(reactor.stats().stale_completions == 0);
+    ::close(peer);
+}
+
+} // namespace
+
+TEST_CASE("IoUringReactor channel on an attached socket", "[io_uring][reactor]") {
+    IoUringReactorConfig config;
+    config.max_channels = 4;
+    config.queue_depth = 64;
+    config.num_recv_buffers = 16;
+    config.recv_buffer_size = 256;  // Messages straddle buffers
+
+    SECTION("Ring-mapped buffer group") {
+        config.use_buf_ring = true;
+        exercise_attached_channel(config);
+    }
+    SECTION("PROVIDE_BUFFERS group") {
+        config.use_buf_ring = false;
+        exercise_attached_channel(config);
+    }
+}
+
+TEST_CASE("IoUringReactor many channels on one ring", "[io_uring][reactor]") {
+    constexpr int PAIRS = 32;
+    constexpr int ROUND_TRIPS = 50;
+
+    IoUringReactorConfig config;
+    config.max_channels = PAIRS * 2;
+    config.queue_depth = 512;
+    config.num_recv_buffers = 256;
+    IoUringReactor reactor{config};
+    REQUIRE(reactor.init().has_value());
+
+    // Each pair echoes one heartbeat back and forth over a socketpair
+    struct Echo final : IReactorHandler {
+        IoUringReactor* reactor{nullptr};
+        IoUringReactor::ChannelId id{IoUringReactor::INVALID_CHANNEL};
+        int received{0};
+        int limit{0};
+        bool closed{false};
+
+        void on_connected() noexcept override {}
+        void on_message(std::span<const char> message) noexcept override {
+            if (++received < limit) (void)reactor->send(id, message);
+        }
+        void on_timer() noexcept override {}
+        void on_closed(const TransportError&) noexcept override { closed = true; }
+    };
+
+    std::vector<std::unique_ptr<Echo>> echoes;
+    for (int i = 0; i < PAIRS; ++i) {
+        int fds[2];
+        REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+        for (int fd : fds) {
+            auto echo = std::make_unique<Echo>();
+            echo->reactor = &reactor;
+            echo->limit = ROUND_TRIPS;
+            auto id = reactor.attach(fd, *echo);
+            REQUIRE(id.has_value());
+            echo->id = *id;
+            echoes.push_back(std::move(echo));
+        }
+        REQUIRE(reactor.send(echoes[echoes.size() - 2]->id, heartbeat(static_cast<uint32_t>(i))));
+    }
+    REQUIRE(reactor.channel_count() == PAIRS * 2);
+
+    // The side that did not start stops echoing at its limit
+    const uint64_t expected = static_cast<uint64_t>(PAIRS) * (2 * ROUND_TRIPS - 1);
+    REQUIRE(run_until(reactor, [&] { return reactor.stats().messages == expected; }));
+    for (size_t i = 0; i < echoes.size(); i += 2) {
+        REQUIRE(echoes[i]->received == ROUND_TRIPS - 1);
+        REQUIRE(echoes[i + 1]->received == ROUND_TRIPS);
+    }
+
+    for (auto& echo : echoes) reactor.close(echo->id);
+    REQUIRE(run_until(reactor, [&] { return reactor.channel_count() == 0; }));
+    REQUIRE(std::all_of(echoes.begin(), echoes.end(), [](const auto& e) { return e->closed; }));
+    REQUIRE(reactor.stats().stale_completions == 0);
+}
+
+// ============================================================================
+// SQPOLL
+// ============================================================================
+
+TEST_CASE("IoUringContext SQPOLL", "[io_uring][sqpoll]") {
+    const int efd = ::eventfd(0, EFD_NONBLOCK);
+    REQUIRE(efd >= 0);
+    const uint64_t one = 1;
+    uint64_t counter = 0;
+
+    SECTION("Disabled by default") {
+        IoUringContext ctx;
+        REQUIRE(ctx.init().has_value());
+        REQUIRE_FALSE(ctx.is_sqpoll());
+        REQUIRE(ring_write(ctx, efd, one) == sizeof(one));
+    }
+
+    SECTION("Poller drains the SQ, also after it went idle") {
+        IoUringContext ctx;
+        const SqPollConfig sqpoll{.enabled = true, .cpu = -1, .idle_ms = 10};
+        REQUIRE(ctx.init(64, sqpoll).has_value());
+        if (!ctx.is_sqpoll()) {
+            WARN("SQPOLL refused by the kernel; fell back to the default ring");
+        } else {
+            REQUIRE_FALSE(ctx.is_optimized());  // Never combined with DEFER_TASKRUN
+        }
+        for (int i = 0; i < 100; ++i) REQUIRE(ring_write(ctx, efd, one) == sizeof(one));
+
+        // Past idle_ms the poller sleeps; submit() must wake it
+        ::usleep(50 * 1000);
+        REQUIRE(ring_write(ctx, efd, one) == sizeof(one));
+        REQUIRE(::read(efd, &counter, sizeof(counter)) == sizeof(counter));
+        REQUIRE(counter == 101);
+    }
+
+    SECTION("Pinned poller") {
+        auto affinity = util::CpuAffinityConfig::default_config();
+        const size_t cores = affinity.allowed_cores.size();
+        const int cpu = affinity.reserve_core();
+        if (cores < 2) {
+            REQUIRE(cpu == -1);
+        } else {
+            REQUIRE(cpu >= 0);
+            REQUIRE(affinity.allowed_cores.size() == cores - 1);
+            REQUIRE(std::find(affinity.allowed_cores.begin(), affinity.allowed_cores.end(), cpu) ==
+                    affinity.allowed_cores.end());
+        }
+
+        IoUringContext ctx;
+        REQUIRE(ctx.init(64, SqPollConfig{.enabled = true, .cpu = cpu}).has_value());
+        REQUIRE(ring_write(ctx, efd, one) == sizeof(one));
+    }
+
+    SECTION("Reactor on an SQPOLL ring") {
+        IoUringReactorConfig config;
+        config.max_channels = 2;
+        config.queue_depth = 64;
+        config.num_recv_buffers = 16;
+        config.sqpoll = SqPollConfig{.enabled = true, .idle_ms = 10};
+        IoUringReactor reactor{config};
+        REQUIRE(reactor.init().has_value());
+
+        int fds[2];
+        REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0);
+        ReactorProbe probe;
+        auto id = reactor.attach(fds[0], probe);
+        REQUIRE(id.has_value());
+        REQUIRE(reactor.send(*id, heartbeat(1)).has_value());
+        REQUIRE(read_exactly(reactor, fds[1], heartbeat(1).size()) == heartbeat(1));
+        write_all(fds[1], heartbeat(2));
+        REQUIRE(run_until(reactor, [&] { return probe.messages.size() == 1; }));
+        REQUIRE(probe.messages[0] == heartbeat(2));
+
+        reactor.close(*id);
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        ::close(fds[1]);
+    }
+
+    ::close(efd);
+}
+
+// ============================================================================
+// Zero-copy send
+// ============================================================================
+
+namespace {
+
+/// Listening loopback TCP socket on an ephemeral port
+struct LoopbackListener {
+    int fd{-1};
+    uint16_t port{0};
+
+    LoopbackListener() {
+        fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), len) == 0 &&
+            ::listen(fd, 8) == 0 &&
+            ::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) == 0) {
+            port = ntohs(addr.sin_port);
+        }
+    }
+    ~LoopbackListener() { ::close(fd); }
+
+    [[nodiscard]] int accept() const { return ::accept4(fd, nullptr, nullptr, SOCK_NONBLOCK); }
+};
+
+std::string pattern(size_t size, uint32_t seed) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; ++i) data[i] = static_cast<char>('A' + (i * 7 + seed) % 26);
+    return data;
+}
+
+/// Read size bytes from a non-blocking fd, polling the transport meanwhile
+std::string read_exactly(IoUringTransport& transport, int fd, size_t size) {
+    std::string data;
+    char buffer[16384];
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (data.size() < size && std::chrono::steady_clock::now() < deadline) {
+        const ssize_t n = ::recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (n > 0) data.append(buffer, static_cast<size_t>(n));
+        else (void)transport.poll();
+    }
+    return data;
+}
+
+/// Poll until every zero-copy buffer is back (notification CQEs)
+bool drain_zero_copy(IoUringTransport& transport) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (transport.zero_copy_in_flight() > 0 && std::chrono::steady_clock::now() < deadline) {
+        (void)transport.poll();
+    }
+    return transport.zero_copy_in_flight() == 0;
+}
+
+} // namespace
+
+TEST_CASE("IoUringTransport zero-copy send", "[io_uring][send_zc]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+    LoopbackListener listener;
+    REQUIRE(listener.port != 0);
+
+    IoUringTransportConfig config;
+    config.use_multishot_recv = false;
+    config.num_registered_buffers = 4;
+    config.registered_buffer_size = 65536;
+    IoUringTransport transport{ctx, config};
+    REQUIRE(transport.connect("127.0.0.1", listener.port).has_value());
+    const int peer = listener.accept();
+    REQUIRE(peer >= 0);
+    REQUIRE(transport.uses_fixed_buffers());
+    REQUIRE(transport.uses_zero_copy_send() == static_cast<bool>(NFX_IO_URING_SEND_ZC));
+
+    SECTION("Large sends arrive intact and their buffers come back") {
+        // More sends than buffers: each must be released on its notification
+        for (uint32_t i = 0; i < 16; ++i) {
+            const std::string data = pattern(32768, i);
+            auto sent = transport.send(data);
+            REQUIRE(sent.has_value());
+            REQUIRE(*sent == data.size());
+            REQUIRE(read_exactly(transport, peer, data.size()) == data);
+        }
+        REQUIRE(drain_zero_copy(transport));
+    }
+
+    SECTION("Message built in a send buffer goes out without a copy") {
+        auto buffer = transport.acquire_send_buffer();
+        REQUIRE(buffer.size() == 65536);
+        const std::string data = pattern(20000, 3);
+        std::copy(data.begin(), data.end(), buffer.begin());
+        REQUIRE(transport.send(buffer.first(data.size())) == data.size());
+        REQUIRE(read_exactly(transport, peer, data.size()) == data);
+        REQUIRE(drain_zero_copy(transport));
+    }
+
+    SECTION("Below the threshold the copying send is used") {
+        const std::string data = heartbeat(1);
+        REQUIRE(data.size() < config.zero_copy_threshold);
+        REQUIRE(transport.send(data) == data.size());
+        REQUIRE(transport.zero_copy_in_flight() == 0);
+        REQUIRE(read_exactly(transport, peer, data.size()) == data);
+    }
+
+    // Every send buffer is back; the pending receive holds the fourth
+    std::vector<std::span<char>> buffers;
+    while (buffers.size() < 4) {
+        auto buffer = transport.acquire_send_buffer();
+        if (buffer.empty()) break;
+        buffers.push_back(buffer);
+    }
+    CHECK(buffers.size() == 3);
+    for (auto& buffer : buffers) transport.release_send_buffer(buffer);
+
+    transport.disconnect();
+    ::close(peer);
+}
+
+#if NFX_IO_URING_SEND_ZC
+TEST_CASE("BatchSubmitter zero-copy sends", "[io_uring][send_zc]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+    RegisteredBufferPool pool;
+    REQUIRE(pool.init(ctx, 16384, 4));
+
+    LoopbackListener listener;
+    const int client = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(listener.port);
+    REQUIRE(::connect(client, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+    const int peer = listener.accept();
+    REQUIRE(peer >= 0);
+
+    BatchSubmitter<8> batch{ctx};
+    std::string expected;
+    for (int i = 0; i < 3; ++i) {
+        const std::string data = pattern(8000, static_cast<uint32_t>(i));
+        std::copy(data.begin(), data.end(), pool.buffer(i));
+        expected += data;
+        REQUIRE(batch.queue_send_zc_fixed(client, {pool.buffer(i), data.size()},
+                                          static_cast<uint16_t>(i),
+                                          reinterpret_cast<void*>(uintptr_t{100} + i)));
+    }
+
+    // Three sends, then a notification per send
+    std::array<IoEvent, 8> events{};
+    const int completed = batch.submit_and_wait(events);
+    REQUIRE(completed == 6);
+    int sends = 0;
+    int notifications = 0;
+    for (int i = 0; i < completed; ++i) {
+        const auto id = reinterpret_cast<uintptr_t>(events[static_cast<size_t>(i)].user_data);
+        CHECK((id >= 100 && id < 103));
+        if (events[static_cast<size_t>(i)].op == IoOperation::ZeroCopyNotify) {
+            ++notifications;
+        } else {
+            CHECK(events[static_cast<size_t>(i)].result == 8000);
+            ++sends;
+        }
+    }
+    CHECK(sends == 3);
+    CHECK(notifications == 3);
+
+    std::string received;
+    char buffer[8192];
+    while (received.size() < expected.size()) {
+        const ssize_t n = ::recv(peer, buffer, sizeof(buffer), 0);
+        REQUIRE(n > 0);
+        received.append(buffer, static_cast<size_t>(n));
+    }
+    REQUIRE(received == expected);
+
+    ::close(client);
+    ::close(peer);
+}
+#endif
+
+// ============================================================================
+// Ring-mapped multishot receive
+// ============================================================================
+
+namespace {
+
+/// Connected transport and its accepted peer
+struct TransportPair {
+    IoUringContext ctx;
+    LoopbackListener listener;
+    IoUringTransport transport;
+    int peer{-1};
+
+    explicit TransportPair(const IoUringTransportConfig& config) : transport{ctx, config} {
+        REQUIRE(ctx.init(64).has_value());
+        REQUIRE(transport.connect("127.0.0.1", listener.port).has_value());
+        peer = listener.accept();
+        REQUIRE(peer >= 0);
+    }
+    ~TransportPair() {
+        transport.disconnect();
+        ::close(peer);
+    }
+};
+
+void exercise_multishot_transport(bool buf_ring) {
+    IoUringTransportConfig config;
+    config.use_registered_buffers = false;
+    config.use_buf_ring = buf_ring;
+    config.num_multishot_buffers = 4;
+    config.multishot_buffer_size = 256;
+    TransportPair pair{config};
+    REQUIRE(pair.transport.uses_multishot_recv());
+    REQUIRE(pair.transport.uses_buf_ring() == (buf_ring && NFX_IO_URING_BUF_RING));
+
+    SECTION("poll_messages() frames messages across buffers and refills") {
+        // Far more than the four buffers hold: the kernel runs out,
+        // ends the multishot and the transport re-arms it
+        std::string burst;
+        std::vector<std::string> expected;
+        for (uint32_t seq = 1; seq <= 300; ++seq) {
+            expected.push_back(heartbeat(seq));
+            burst += expected.back();
+        }
+        write_all(pair.peer, burst);
+
+        std::vector<std::string> received;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received.size() < expected.size() &&
+               std::chrono::steady_clock::now() < deadline) {
+            (void)pair.transport.poll_messages([&](std::span<const char> message) {
+                received.emplace_back(message.begin(), message.end());
+            });
+        }
+        REQUIRE(received == expected);
+        const auto& stats = pair.transport.reassembly_stats();
+        CHECK(stats.zero_copy_messages > 0);
+        CHECK(stats.copied_messages > 0);
+        CHECK(stats.garbled_bytes == 0);
+    }
+
+    SECTION("receive() copies out of the provided buffers") {
+        const std::string data = pattern(3000, 5);
+        write_all(pair.peer, data);
+        std::string received;
+        char buffer[1024];
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received.size() < data.size() && std::chrono::steady_clock::now() < deadline) {
+            auto n = pair.transport.receive(buffer);
+            if (n) received.append(buffer, *n);
+        }
+        REQUIRE(received == data);
+    }
+}
+
+} // namespace
+
+TEST_CASE("ProvidedBufferGroup modes", "[io_uring][buf_ring]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+
+    SECTION("Ring-mapped group") {
+        ProvidedBufferGroup group;
+        REQUIRE(group.init(ctx, 3, 512, 6, ProvidedBufferGroup::Mode::Ring));
+        REQUIRE(group.uses_ring() == static_cast<bool>(NFX_IO_URING_BUF_RING));
+        REQUIRE(group.replenish_needs_submit() == !group.uses_ring());
+        std::array<util::MemoryRegion, 4> regions{};
+        REQUIRE(group.memory_regions(regions) == (group.uses_ring() ? 2u : 1u));
+        CHECK(regions[0].size == 512 * 6);
+        REQUIRE(group.replenish(5));
+        REQUIRE(!group.replenish(6));
+    }
+
+    SECTION("PROVIDE_BUFFERS group") {
+        ProvidedBufferGroup group;
+        REQUIRE(group.init(ctx, 3, 512, 6, ProvidedBufferGroup::Mode::ProvideBuffers));
+        REQUIRE(!group.uses_ring());
+        REQUIRE(group.replenish_needs_submit());
+        std::array<util::MemoryRegion, 4> regions{};
+        REQUIRE(group.memory_regions(regions) == 1);
+    }
+}
+
+TEST_CASE("IoUringTransport multishot receive", "[io_uring][buf_ring]") {
+    SECTION("Ring-mapped buffers") { exercise_multishot_transport(true); }
+    SECTION("PROVIDE_BUFFERS") { exercise_multishot_transport(false); }
+}
+
+// ============================================================================
+// Registered files and NAPI
+// ============================================================================
+
+TEST_CASE("IoUringContext fixed-file table", "[io_uring][files]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+
+    int fds[4];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds + 2) == 0);
+
+    SECTION("No table: nothing to register into") {
+        REQUIRE(!ctx.has_file_table());
+        REQUIRE(ctx.register_file(fds[0]) == -EINVAL);
+    }
+
+    SECTION("Slots are handed out, exhausted and reused") {
+        REQUIRE(ctx.register_file_table(3) == 0);
+        REQUIRE(ctx.register_file_table(3) == -EBUSY);
+        REQUIRE(ctx.file_table_size() == 3);
+        REQUIRE(ctx.register_file(fds[0]) == 0);
+        REQUIRE(ctx.register_file(fds[1]) == 1);
+        REQUIRE(ctx.register_file(fds[2]) == 2);
+        REQUIRE(ctx.register_file(fds[3]) == -ENFILE);
+        ctx.unregister_file(1);
+        REQUIRE(ctx.register_file(fds[3]) == 1);
+
+        // A write addressed by slot reaches the registered socket
+        const std::string data = heartbeat(1);
+        auto* sqe = ctx.get_sqe();
+        REQUIRE(sqe != nullptr);
+        io_uring_prep_send(sqe, 1, data.data(), data.size(), 0);
+        sqe->flags |= IOSQE_FIXED_FILE;
+        REQUIRE(ctx.submit() == 1);
+        struct io_uring_cqe* cqe;
+        REQUIRE(ctx.wait(&cqe, 2000) == 0);
+        REQUIRE(cqe->res == static_cast<int>(data.size()));
+        ctx.seen(cqe);
+        char buffer[256];
+        REQUIRE(::recv(fds[2], buffer, sizeof(buffer), 0) == static_cast<ssize_t>(data.size()));
+        REQUIRE(std::string(buffer, data.size()) == data);
+    }
+
+    for (int fd : fds) ::close(fd);
+}
+
+TEST_CASE("IoUringTransport on a registered file", "[io_uring][files]") {
+    IoUringTransportConfig config;
+    config.registered_files = 4;
+    config.napi.enabled = true;  // Optional: connect succeeds either way
+    TransportPair pair{config};
+    REQUIRE(pair.ctx.has_file_table());
+    REQUIRE(pair.transport.uses_registered_file());
+    REQUIRE(pair.transport.uses_multishot_recv());
+
+    // Copying, fixed-buffer and zero-copy sends all address the slot
+    for (size_t size : {size_t{80}, size_t{2000}, size_t{6000}}) {
+        const std::string data = pattern(size, static_cast<uint32_t>(size));
+        REQUIRE(pair.transport.send(data) == size);
+        REQUIRE(read_exactly(pair.transport, pair.peer, size) == data);
+    }
+
+    write_all(pair.peer, heartbeat(7));
+    std::vector<std::string> received;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+        (void)pair.transport.poll_messages([&](std::span<const char> message) {
+            received.emplace_back(message.begin(), message.end());
+        });
+    }
+    REQUIRE(received == std::vector<std::string>{heartbeat(7)});
+    REQUIRE(drain_zero_copy(pair.transport));
+
+    // disconnect() hands the slot back
+    pair.transport.disconnect();
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    CHECK(pair.ctx.register_file(fds[0]) == 0);
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST_CASE("IoUringContext NAPI registration", "[io_uring][files]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+    const int ret = ctx.register_napi(NapiConfig{.enabled = true});
+    if (!NFX_IO_URING_NAPI) {
+        REQUIRE(ret == -ENOTSUP);
+    }
+    REQUIRE(ctx.has_napi() == (ret == 0));
+}
+
+// ============================================================================
+// Batched CQE reaping
+// ============================================================================
+
+namespace {
+
+/// Queue count NOPs tagged first, first + 1, ... and submit them
+void submit_nops(IoUringContext& ctx, uint64_t first, unsigned count) {
+    for (unsigned i = 0; i < count; ++i) {
+        auto* sqe = ctx.get_sqe();
+        REQUIRE(sqe != nullptr);
+        io_uring_prep_nop(sqe);
+        sqe->user_data = first + i;
+    }
+    REQUIRE(ctx.submit() == static_cast<int>(count));
+}
+
+} // namespace
+
+TEST_CASE("IoUringContext::reap", "[io_uring][reap]") {
+    IoUringContext ctx;
+    REQUIRE(ctx.init(128).has_value());
+    REQUIRE(ctx.reap([](const CqeEntry&) {}) == 0);
+
+    SECTION("Every completion in order, across several batches") {
+        constexpr unsigned N = 2 * IoUringContext::CQE_BATCH + 5;
+        submit_nops(ctx, 1, N);
+
+        std::vector<uint64_t> seen;
+        std::vector<uint64_t> prefetched;
+        const unsigned n = ctx.reap(
+            [&](const CqeEntry& cqe) {
+                CHECK(cqe.res == 0);
+                seen.push_back(cqe.user_data);
+            },
+            [&](const CqeEntry& next) { prefetched.push_back(next.user_data); });
+        REQUIRE(n == N);
+        REQUIRE(seen.size() == N);
+        for (unsigned i = 0; i < N; ++i) CHECK(seen[i] == i + 1);
+
+        // The hook sees each entry before it is handled, except the
+        // first of each batch
+        REQUIRE(prefetched.size() == N - 3);
+        for (uint64_t id : prefetched) CHECK((id - 1) % IoUringContext::CQE_BATCH != 0);
+
+        struct io_uring_cqe* cqe;
+        REQUIRE(ctx.peek(&cqe) != 0);  // Ring left empty
+    }
+
+    SECTION("Handlers may submit and reap again") {
+        submit_nops(ctx, 1, 10);
+        std::vector<uint64_t> seen;
+        unsigned nested = 0;
+        const unsigned n = ctx.reap(
+            [&](const CqeEntry& cqe) {
+                seen.push_back(cqe.user_data);
+                if (cqe.user_data == 3) {
+                    submit_nops(ctx, 100, 2);
+                    nested = ctx.reap([&](const CqeEntry& inner) {
+                        seen.push_back(inner.user_data);
+                    });
+                }
+            },
+            NoPrefetch{});
+        REQUIRE(n == 10);
+        REQUIRE(nested == 2);
+        REQUIRE(seen == std::vector<uint64_t>{1, 2, 3, 100, 101, 4, 5, 6, 7, 8, 9, 10});
+    }
+}
+
+// ============================================================================
+// TLS (kTLS where the kernel takes the records, OpenSSL otherwise)
+// ============================================================================
+
+#if NFX_KTLS_AVAILABLE
+
+namespace {
+
+/// Self-signed P-256 server identity
+struct TlsServerIdentity {
+    EVP_PKEY* key{EVP_EC_gen("P-256")};
+    X509* cert{X509_new()};
+
+    TlsServerIdentity() {
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+        X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+        X509_set_pubkey(cert, key);
+        X509_set_issuer_name(cert, X509_get_subject_name(cert));
+        X509_sign(cert, key, EVP_sha256());
+    }
+    ~TlsServerIdentity() {
+        X509_free(cert);
+        EVP_PKEY_free(key);
+    }
+};
+
+/// Accept one connection and echo its records until close_notify
+void run_tls_echo(const LoopbackListener& listener, const TlsServerIdentity& id) {
+    const int fd = ::accept(listener.fd, nullptr, nullptr);
+    if (fd < 0) return;
+    SSL_CTX* ctx = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_use_certificate(ctx, id.cert);
+    SSL_CTX_use_PrivateKey(ctx, id.key);
+    SSL* ssl = SSL_new(ctx);
+    SSL_set_fd(ssl, fd);
+    if (SSL_accept(ssl) == 1) {
+        char buffer[16384];
+        for (int n; (n = SSL_read(ssl, buffer, sizeof(buffer))) > 0;) {
+            if (SSL_write(ssl, buffer, n) != n) break;
+        }
+    }
+    SSL_free(ssl);
+    SSL_CTX_free(ctx);
+    ::close(fd);
+}
+
+} // namespace
+
+TEST_CASE("IoUringTransport TLS session", "[io_uring][tls]") {
+    const TlsServerIdentity id;
+    LoopbackListener listener;
+    std::thread server{[&] { run_tls_echo(listener, id); }};
+
+    IoUringContext ctx;
+    REQUIRE(ctx.init(64).has_value());
+    IoUringTransportConfig config;
+    config.tls.enabled = true;
+    config.tls.verify_peer = false;
+
+    SECTION("Records round trip on whichever layer took each direction") {
+        config.tls.max_version = TlsVersion::Tls12;  // Both directions offloadable
+        IoUringTransport transport{ctx, config};
+        REQUIRE(transport.connect("127.0.0.1", listener.port).has_value());
+        REQUIRE(transport.uses_tls());
+        // Ring receives only where the kernel decrypts
+        CHECK(transport.uses_multishot_recv() ==
+              ((static_cast<unsigned>(transport.tls_offload()) & 2u) != 0));
+
+        std::string expected;
+        for (uint32_t seq = 1; seq <= 20; ++seq) expected += heartbeat(seq);
+        expected += pattern(6000, 1);  // Zero-copy size when the kernel sends
+        for (size_t pos = 0; pos < expected.size();) {
+            const size_t len = std::min<size_t>(expected.size() - pos, pos < 1000 ? 97 : 6000);
+            REQUIRE(transport.send({expected.data() + pos, len}) == len);
+            pos += len;
+        }
+
+        std::string received;
+        char buffer[4096];
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received.size() < expected.size() && std::chrono::steady_clock::now() < deadline) {
+            auto n = transport.receive(buffer);
+            if (n) received.append(buffer, *n);
+        }
+        REQUIRE(received == expected);
+        REQUIRE(drain_zero_copy(transport));
+        transport.disconnect();  // close_notify ends the echo loop
+    }
+
+    SECTION("require_offload refuses a session the kernel did not take") {
+        config.tls.max_version = TlsVersion::Tls12;
+        config.tls.require_offload = true;
+        IoUringTransport transport{ctx, config};
+        auto result = transport.connect("127.0.0.1", listener.port);
+        if (result) {
+            CHECK(transport.tls_offload() == TlsOffload::Both);
+            transport.disconnect();
+        } else {
+            CHECK(result.error().code == TransportErrorCode::TlsOffloadUnavailable);
+            CHECK(!transport.is_connected());
+        }
+    }
+
+    server.join();
+}
+
+#endif  // NFX_KTLS_AVAILABLE
+
+// ============================================================================
+// Prepared connects, linked timeouts and reconnects
+// ============================================================================
+
+namespace {
+
+/// Loopback port with nothing listening (connect is refused)
+uint16_t closed_port() {
+    LoopbackListener probe;
+    return probe.port;  // Closed when probe goes out of scope
+}
+
+/// Listener whose accept queue is full: further SYNs are dropped, so a
+/// connect to it hangs until its timeout
+struct BlackholeListener {
+    LoopbackListener listener;
+    int fillers[2]{-1, -1};
+
+    BlackholeListener() {
+        ::listen(listener.fd, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(listener.port);
+        for (int& fd : fillers) {
+            fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            (void)::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        }
+    }
+    ~BlackholeListener() {
+        for (int fd : fillers) ::close(fd);
+    }
+};
+
+ConnectTarget loopback_target(uint16_t port) {
+    auto endpoint = ResolvedEndpoint::resolve("127.0.0.1", port);
+    REQUIRE(endpoint.has_value());
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    REQUIRE(fd >= 0);
+    return ConnectTarget{fd, *endpoint, false};
+}
+
+IoUringReactorConfig small_reactor_config() {
+    IoUringReactorConfig config;
+    config.max_channels = 4;
+    config.queue_depth = 64;
+    config.num_recv_buffers = 16;
+    return config;
+}
+
+/// Accept the reactor's connection, then exchange a message both ways
+void check_connected(IoUringReactor& reactor, IoUringReactor::ChannelId id,
+                     ReactorProbe& probe, const LoopbackListener& listener) {
+    REQUIRE(run_until(reactor, [&] { return probe.connected == 1 || probe.closed; }));
+    REQUIRE(probe.connected == 1);
+    REQUIRE(reactor.is_open(id));
+    const int peer = listener.accept();
+    REQUIRE(peer >= 0);
+    REQUIRE(reactor.send(id, heartbeat(1)).has_value());
+    REQUIRE(read_exactly(reactor, peer, heartbeat(1).size()) == heartbeat(1));
+    write_all(peer, heartbeat(2));
+    REQUIRE(run_until(reactor, [&] { return probe.messages.size() == 1; }));
+    REQUIRE(probe.messages[0] == heartbeat(2));
+    ::close(peer);
+}
+
+} // namespace
+
+TEST_CASE("IoUringReactor prepared connects", "[io_uring][reconnect]") {
+    IoUringReactor reactor{small_reactor_config()};
+    REQUIRE(reactor.init().has_value());
+    ReactorProbe probe;
+
+    SECTION("Single target") {
+        LoopbackListener listener;
+        const ConnectTarget target = loopback_target(listener.port);
+        auto id = reactor.connect(std::span{&target, 1}, probe, 2000);
+        REQUIRE(id.has_value());
+        check_connected(reactor, *id, probe, listener);
+        CHECK(reactor.connected_target(*id) == 0);
+        reactor.close(*id);
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        CHECK(reactor.stats().connect_timeouts == 0);
+    }
+
+    SECTION("Refused connect closes the channel") {
+        const ConnectTarget target = loopback_target(closed_port());
+        REQUIRE(reactor.connect(std::span{&target, 1}, probe, 2000).has_value());
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        CHECK(probe.connected == 0);
+        CHECK(probe.close_error.code == TransportErrorCode::ConnectionFailed);
+        CHECK(probe.close_error.system_errno == ECONNREFUSED);
+        CHECK(reactor.channel_count() == 0);
+    }
+
+    SECTION("Linked timeout cuts off a hanging connect") {
+        BlackholeListener blackhole;
+        const ConnectTarget target = loopback_target(blackhole.listener.port);
+        const auto start = std::chrono::steady_clock::now();
+        REQUIRE(reactor.connect(std::span{&target, 1}, probe, 200).has_value());
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(2));
+        CHECK(probe.connected == 0);
+        CHECK(probe.close_error.code == TransportErrorCode::Timeout);
+        CHECK(reactor.stats().connect_timeouts == 1);
+        CHECK(reactor.channel_count() == 0);
+    }
+
+    SECTION("Raced targets: the reachable one wins, the other is cancelled") {
+        BlackholeListener blackhole;
+        LoopbackListener listener;
+        const std::array targets{loopback_target(blackhole.listener.port),
+                                 loopback_target(listener.port)};
+        auto id = reactor.connect(targets, probe, 3000);
+        REQUIRE(id.has_value());
+        check_connected(reactor, *id, probe, listener);
+        CHECK(reactor.connected_target(*id) == 1);
+        REQUIRE(run_until(reactor, [&] { return reactor.stats().race_losses == 1; }));
+        CHECK(reactor.stats().connect_timeouts == 0);
+        reactor.close(*id);
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        CHECK(probe.close_error.code == TransportErrorCode::None);
+    }
+
+    SECTION("Raced targets that both fail close once") {
+        const std::array targets{loopback_target(closed_port()), loopback_target(closed_port())};
+        REQUIRE(reactor.connect(targets, probe, 2000).has_value());
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+        CHECK(probe.close_error.code == TransportErrorCode::ConnectionFailed);
+        (void)reactor.run_once(50);
+        CHECK(reactor.channel_count() == 0);
+    }
+
+    SECTION("More than two targets is rejected") {
+        const std::array targets{loopback_target(closed_port()), loopback_target(closed_port()),
+                                 loopback_target(closed_port())};
+        auto id = reactor.connect(targets, probe);
+        REQUIRE(!id.has_value());
+        CHECK(id.error().system_errno == EINVAL);
+    }
+}
+
+TEST_CASE("ReconnectManager", "[io_uring][reconnect]") {
+    IoUringReactor reactor{small_reactor_config()};
+    REQUIRE(reactor.init().has_value());
+    LoopbackListener backup;
+
+    SECTION("Sequential: a failed primary fails over to the backup") {
+        ReconnectManager reconnect{{.primary_host = "127.0.0.1", .primary_port = closed_port(),
+                                    .backup_host = "127.0.0.1", .backup_port = backup.port,
+                                    .connect_timeout_ms = 2000}};
+        reconnect.prepare();
+        CHECK(reconnect.standby().available() == 2);
+
+        ReactorProbe first;
+        REQUIRE(reconnect.connect(reactor, first).has_value());
+        REQUIRE(run_until(reactor, [&] { return first.closed; }));
+        CHECK(first.connected == 0);
+        reconnect.on_connect_failed();
+        CHECK(reconnect.on_backup());
+
+        ReactorProbe second;
+        auto id = reconnect.connect(reactor, second);
+        REQUIRE(id.has_value());
+        check_connected(reactor, *id, second, backup);
+        reconnect.on_connected(reactor);
+        CHECK(reconnect.stats().attempts == 2);
+        CHECK(reconnect.stats().connects == 1);
+        CHECK(reconnect.stats().backup_connects == 1);
+        CHECK(reconnect.stats().failovers == 1);
+
+        // Standby sockets came from the pool; prepare() refills it
+        CHECK(reconnect.standby().available() == 0);
+        reconnect.prepare();
+        CHECK(reconnect.standby().available() == 2);
+        reactor.close(*id);
+        REQUIRE(run_until(reactor, [&] { return second.closed; }));
+    }
+
+    SECTION("Racing: the backup wins while the primary hangs") {
+        BlackholeListener primary;
+        ReconnectManager reconnect{{.primary_host = "127.0.0.1", .primary_port = primary.listener.port,
+                                    .backup_host = "127.0.0.1", .backup_port = backup.port,
+                                    .race_backup = true, .connect_timeout_ms = 3000}};
+        reconnect.prepare();
+        ReactorProbe probe;
+        auto id = reconnect.connect(reactor, probe);
+        REQUIRE(id.has_value());
+        check_connected(reactor, *id, probe, backup);
+        reconnect.on_connected(reactor);
+        CHECK(reconnect.stats().backup_connects == 1);
+        CHECK(reconnect.on_backup());
+        REQUIRE(run_until(reactor, [&] { return reactor.stats().race_losses == 1; }));
+        reactor.close(*id);
+        REQUIRE(run_until(reactor, [&] { return probe.closed; }));
+    }
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/logdump.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace quantnexus::logging;
+
+namespace {
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::system_clock;
+
+struct OpsLine {
+    Level level;
+    std::string message;
+};
+
+struct LoggedEntry {
+    Clock::time_point timestamp;
+    std::variant<OpsLine, TradeEvent, LogPluginEvent> record;
+};
+
+/// Known log: all three channels, JSON escapes, and a day change so the
+/// writers rotate files mid-run
+std::vector<LoggedEntry> known_log(size_t count) {
+    using namespace std::chrono;
+    const Clock::time_point day1 = sys_days{year{2026} / March / 14} + hours{11};
+    const Clock::time_point day2 = day1 + hours{24};
+
+    std::vector<LoggedEntry> log;
+    log.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto ts = (i < count / 2 ? day1 : day2) + milliseconds{static_cast<int64_t>(i) * 7};
+        switch (i % 4) {
+            case 0:
+                log.push_back({ts, OpsLine{Level::INFO, "session up #" + std::to_string(i)}});
+                break;
+            case 1:
+                log.push_back({ts, OpsLine{Level::WARN, "gap fill \"34=" + std::to_string(i) + "\""}});
+                break;
+            case 2:
+                log.push_back({ts, TradeEvent{
+                    "task-" + std::to_string(i), "mm\\v2", "AAPL", (i & 1) ? "SELL" : "BUY",
+                    187.25 + static_cast<double>(i), 100.0, -3.5, microseconds{static_cast<int64_t>(i)}}});
+                break;
+            default:
+                log.push_back({ts, LogPluginEvent{
+                    "plugin-" + std::to_string(i % 3), "HEARTBEAT", "ready",
+                    "line1\nline2\t\"quoted\"", microseconds{42}}});
+                break;
+        }
+    }
+    return log;
+}
+
+void replay(MultiChannelLogger& logger, const std::vector<LoggedEntry>& log,
+            size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        const LoggedEntry& entry = log[i];
+        if (const auto* ops = std::get_if<OpsLine>(&entry.record)) {
+            logger.log_ops(ops->level, entry.timestamp, ops->message);
+        } else if (const auto* trade = std::get_if<TradeEvent>(&entry.record)) {
+            logger.log_trade(*trade, entry.timestamp);
+        } else {
+            logger.log_plugin(std::get<LogPluginEvent>(entry.record), entry.timestamp);
+        }
+    }
+}
+
+void point_at(MultiChannelLogger& logger, const fs::path& dir) {
+    logger.set_ops_directory(dir / "ops");
+    logger.set_trade_directory(dir / "trade");
+    logger.set_plugin_directory(dir / "plugin");
+}
+
+/// Every log file under dir, keyed by its path relative to dir
+std::map<std::string, std::string> read_logs(const fs::path& dir) {
+    std::map<std::string, std::string> files;
+    for (const auto& entry : fs::recursive_directory_iterator(dir)) {
+        if (!entry.is_regular_file()) continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        files[fs::relative(entry.path(), dir).string()] = content.str();
+    }
+    return files;
+}
+
+std::vector<std::string> sorted_lines(const std::string& content) {
+    std::vector<std::string> lines;
+    std::istringstream in(content);
+    for (std::string line; std::getline(in, line);) lines.push_back(line);
+    std::sort(lines.begin(), lines.end());
+    return lines;
+}
+
+} // namespace
+
+// ============================================================================
+// Async pipeline vs synchronous path
+// ============================================================================
+
+TEST_CASE("logdump async pipeline writes what the synchronous path writes", "[logdump]") {
+    const fs::path root = fs::temp_directory_path() / ("nfx_logdump_" + std::to_string(::getpid()));
+    fs::remove_all(root);
+
+    auto& logger = MultiChannelLogger::instance();
+    logger.stop();
+    logger.set_console_output(false);
+    logger.set_level(Level::DEBUG);
+
+    constexpr size_t ENTRIES = 512;
+    const auto log = known_log(ENTRIES);
+
+    // Reference: logger not started, every record formatted and written inline
+    point_at(logger, root / "sync");
+    replay(logger, log, 0, log.size());
+    logger.flush();
+    const auto expected = read_logs(root / "sync");
+    REQUIRE(expected.size() == 6);  // 3 channels x 2 days
+
+    SECTION("One producer: byte-for-byte") {
+        point_at(logger, root / "async");
+        const uint64_t written_before = logger.records_written();
+        logger.start();
+        replay(logger, log, 0, log.size());
+        logger.stop();
+
+        REQUIRE(logger.records_written() - written_before == ENTRIES);
+        const auto actual = read_logs(root / "async");
+        REQUIRE(actual.size() == expected.size());
+        for (const auto& [name, content] : expected) {
+            INFO(name);
+            REQUIRE(actual.count(name) == 1);
+            REQUIRE(actual.at(name) == content);
+        }
+    }
+
+    SECTION("Several producers: same lines, interleaved") {
+        point_at(logger, root / "async_mp");
+        const uint64_t written_before = logger.records_written();
+        logger.start();
+        {
+            constexpr size_t PRODUCERS = 4;
+            std::vector<std::jthread> producers;
+            for (size_t p = 0; p < PRODUCERS; ++p) {
+                producers.emplace_back([&, p] {
+                    replay(logger, log, p * ENTRIES / PRODUCERS, (p + 1) * ENTRIES / PRODUCERS);
+                });
+            }
+        }
+        logger.flush();
+        logger.stop();
+
+        REQUIRE(logger.records_written() - written_before == ENTRIES);
+        const auto actual = read_logs(root / "async_mp");
+        REQUIRE(actual.size() == expected.size());
+        for (const auto& [name, content] : expected) {
+            INFO(name);
+            REQUIRE(actual.count(name) == 1);
+            REQUIRE(sorted_lines(actual.at(name)) == sorted_lines(content));
+        }
+    }
+
+    point_at(logger, root / "done");
+    fs::remove_all(root);
+}
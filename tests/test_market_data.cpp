@@ -4,6 +4,15 @@
 
 #include "nexusfix/messages/fix44/market_data.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/session/md_subscriptions.hpp"
+#include "nexusfix/store/md_recovery.hpp"
+#include "nexusfix/store/order_book.hpp"
+#include "nexusfix/store/order_book_l3.hpp"
+#include "nexusfix/store/symbol_registry.hpp"
+#include "nexusfix/transport/multicast_receiver.hpp"
+#include "nexusfix/util/token_bucket.hpp"
+
+#include <vector>
 
 using namespace nfx;
 using namespace nfx::fix44;
@@ -17,6 +26,18 @@ static std::string make_fix_message(std::string_view msg) {
     return result;
 }
 
+// Helper to frame a body ('|' as SOH) with a valid BodyLength and CheckSum
+static std::string frame_fix_message(std::string_view msg_type, uint32_t seq,
+                                     std::string_view body) {
+    std::string fields = "35=" + std::string{msg_type} + "|49=SERVER|56=CLIENT|34=" +
+                         std::to_string(seq) + "|52=20260122-10:00:00.000|" + std::string{body};
+    fields = make_fix_message(fields);
+    std::string msg = make_fix_message("8=FIX.4.4|9=" + std::to_string(fields.size()) + "|") + fields;
+    auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + fix::SOH;
+}
+
 // ============================================================================
 // MarketDataRequest Tests
 // ============================================================================
@@ -156,6 +177,65 @@ TEST_CASE("MarketDataSnapshotFullRefresh Parser - Iterate entries", "[market_dat
     REQUIRE_FALSE(iter.has_next());
 }
 
+TEST_CASE("RepeatingGroupIndex - Indexed entry access", "[market_data][snapshot][index]") {
+    std::string raw_msg = make_fix_message(
+        "8=FIX.4.4|9=180|35=W|49=SERVER|56=CLIENT|34=1|52=20260122-10:00:00.000|"
+        "262=MD002|55=GOOGL|268=3|"
+        "269=0|270=2800.50|271=200|290=1|"
+        "269=1|270=2801.00|271=150|290=1|346=4|"
+        "269=2|270=2800.75|271=50|"
+        "10=060|"
+    );
+    std::span<const char> data{raw_msg.data(), raw_msg.size()};
+
+    MonotonicPool<4096> pool;
+    parser::RepeatingGroupIndex index{&pool};
+    REQUIRE(index.build(data, tag::MDEntryType::value, 3, parser::MD_ENTRY_TAGS));
+    REQUIRE(index.size() == 3);
+
+    SECTION("Matches RepeatingGroupIterator field by field") {
+        parser::RepeatingGroupIterator iter{data, tag::MDEntryType::value, 3};
+        for (size_t i = 0; i < index.size(); ++i) {
+            REQUIRE(iter.has_next());
+            auto scanned = iter.next();
+            auto indexed = index.entry(i);
+            REQUIRE(indexed.data().size() == scanned.data.size());
+            for (int t : parser::MD_ENTRY_TAGS) {
+                REQUIRE(indexed.get_string(t) == scanned.get_string(t));
+            }
+        }
+    }
+
+    SECTION("Typed accessors and missing fields") {
+        REQUIRE(index[0].get_char(tag::MDEntryType::value) == '0');
+        REQUIRE(index[1].get_int(tag::NumberOfOrders::value) == 4);
+        REQUIRE_FALSE(index[0].get_int(tag::NumberOfOrders::value).has_value());
+        REQUIRE_FALSE(index[2].get(tag::MDEntryPositionNo::value).is_valid());
+        REQUIRE(index[2].get_qty(tag::MDEntrySize::value).raw ==
+                Qty::from_string("50").raw);
+
+        MDEntry md = parser::parse_md_entry(index[1]);
+        REQUIRE(md.entry_type == MDEntryType::Offer);
+        REQUIRE(md.number_of_orders == 4);
+    }
+
+    SECTION("Unindexed tags fall back to an entry scan") {
+        const int price_only[] = {tag::MDEntryPx::value};
+        REQUIRE(index.build(data, tag::MDEntryType::value, 3, price_only));
+        REQUIRE(index[1].get_string(tag::MDEntrySize::value) == "150");
+        REQUIRE(index[1].get_string(tag::MDEntryPx::value) == "2801.00");
+        // Last entry stops at the trailer
+        REQUIRE_FALSE(index[2].get(tag::CheckSum::value).is_valid());
+    }
+
+    SECTION("Exhausted arena is reported, not thrown") {
+        MonotonicPool<64> tiny;
+        parser::RepeatingGroupIndex small{&tiny};
+        REQUIRE_FALSE(small.build(data, tag::MDEntryType::value, 3, parser::MD_ENTRY_TAGS));
+        REQUIRE(small.size() == 0);
+    }
+}
+
 // ============================================================================
 // MarketDataIncrementalRefresh Tests
 // ============================================================================
@@ -220,6 +300,788 @@ TEST_CASE("MarketDataIncrementalRefresh Parser - Update actions", "[market_data]
     REQUIRE(e3.entry_type == MDEntryType::Offer);
 }
 
+TEST_CASE("MarketDataIncrementalRefresh - Columnar decode", "[market_data][incremental][columns]") {
+    std::string raw_msg = make_fix_message(
+        "8=FIX.4.4|9=150|35=X|49=SERVER|56=CLIENT|34=3|52=20260122-10:00:02.000|"
+        "268=4|"
+        "279=0|269=0|55=MSFT|270=400.00|271=100|"
+        "279=1|269=0|55=MSFT|270=399.95|271=150|"
+        "279=2|269=1|55=AAPL|270=150.10|"
+        "279=0|269=2|270=401.5|271=7|"
+        "10=132|"
+    );
+
+    auto result = MarketDataIncrementalRefresh::from_buffer(
+        std::span<const char>{raw_msg.data(), raw_msg.size()});
+    REQUIRE(result.has_value());
+
+    MDEntryColumns<8> cols;
+    REQUIRE(result->decode_entries(cols) == 4);
+    REQUIRE_FALSE(cols.truncated);
+
+    SECTION("Columns match the row iterator") {
+        auto iter = result->entries();
+        for (size_t i = 0; i < cols.count; ++i) {
+            REQUIRE(iter.has_next());
+            MDEntry e = iter.next();
+            REQUIRE(cols.update_action[i] == e.update_action);
+            REQUIRE(cols.entry_type[i] == e.entry_type);
+            REQUIRE(cols.price[i].raw == e.price_raw);
+            REQUIRE(cols.size[i].raw == e.size_raw);
+            REQUIRE(cols.symbol(i) == e.symbol);
+        }
+    }
+
+    SECTION("Symbols are dictionary encoded") {
+        REQUIRE(cols.symbol_count == 2);
+        REQUIRE(cols.symbol_id[0] == cols.symbol_id[1]);
+        REQUIRE(cols.symbol(2) == "AAPL");
+        REQUIRE(cols.symbol_id[3] == MDEntryColumns<8>::NO_SYMBOL);
+        REQUIRE(cols.size[2].raw == 0);  // Delete without size
+    }
+
+    SECTION("Capacity overflow is flagged") {
+        MDEntryColumns<2> small;
+        REQUIRE(result->decode_entries(small) == 2);
+        REQUIRE(small.truncated);
+        REQUIRE(small.price[1].raw == FixedPrice::from_string("399.95").raw);
+    }
+}
+
+TEST_CASE("MarketDataSnapshotFullRefresh - Columnar decode", "[market_data][snapshot][columns]") {
+    std::string raw_msg = make_fix_message(
+        "8=FIX.4.4|9=180|35=W|49=SERVER|56=CLIENT|34=1|52=20260122-10:00:00.000|"
+        "262=MD002|55=GOOGL|268=2|"
+        "269=0|270=2800.50|271=200|290=1|"
+        "269=1|270=2801.00|271=150|290=1|"
+        "10=060|"
+    );
+
+    auto result = MarketDataSnapshotFullRefresh::from_buffer(
+        std::span<const char>{raw_msg.data(), raw_msg.size()});
+    REQUIRE(result.has_value());
+
+    MDEntryColumns<> cols;
+    REQUIRE(result->decode_entries(cols) == 2);
+    REQUIRE(cols.entry_type[0] == MDEntryType::Bid);
+    REQUIRE(cols.entry_type[1] == MDEntryType::Offer);
+    REQUIRE(cols.update_action[1] == MDUpdateAction::New);
+    REQUIRE(cols.price[1].raw == FixedPrice::from_string("2801.00").raw);
+    // Message-level symbol applies to every row
+    REQUIRE(cols.symbol(0) == "GOOGL");
+    REQUIRE(cols.symbol(1) == "GOOGL");
+}
+
+TEST_CASE("MDEntryColumns - Position and order count", "[market_data][columns]") {
+    std::string raw_msg = frame_fix_message("X", 4,
+        "268=2|"
+        "279=0|269=0|55=MSFT|270=400.00|271=100|290=2|346=7|"
+        "279=2|269=1|55=MSFT|270=400.10|");
+    auto result = MarketDataIncrementalRefresh::from_buffer(
+        std::span<const char>{raw_msg.data(), raw_msg.size()});
+    REQUIRE(result.has_value());
+
+    MDEntryColumns<8> cols;
+    REQUIRE(result->decode_entries(cols) == 2);
+    REQUIRE(cols.position_no[0] == 2);
+    REQUIRE(cols.number_of_orders[0] == 7);
+    REQUIRE(cols.position_no[1] == 0);       // Absent
+    REQUIRE(cols.number_of_orders[1] == 0);
+}
+
+// ============================================================================
+// OrderBook Tests
+// ============================================================================
+
+TEST_CASE("OrderBook - L2 maintenance", "[market_data][order_book]") {
+    using store::BookSide;
+    using store::BookEvent;
+    auto book = std::make_unique<store::OrderBook<4>>("MSFT");
+    std::vector<store::BookChange> changes;
+    auto listener = [&](const store::BookChange& c) { changes.push_back(c); };
+
+    auto apply = [&](const char* type, uint32_t seq, const char* body) {
+        std::string raw = frame_fix_message(type, seq, body);
+        auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(msg.has_value());
+        changes.clear();
+        return book->apply(*msg, listener);
+    };
+    auto px = [](const char* s) { return FixedPrice::from_string(s).raw; };
+
+    // Snapshot out of order: sides are sorted best first
+    REQUIRE(apply("W", 10, "55=MSFT|268=5|"
+                  "269=0|270=399.98|271=300|"
+                  "269=0|270=400.00|271=100|"
+                  "269=1|270=400.05|271=200|"
+                  "269=0|270=399.99|271=200|"
+                  "269=2|270=400.01|271=5|") == 4);
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes[0].event == BookEvent::Snapshot);
+    REQUIRE(book->depth(BookSide::Bid) == 3);
+    REQUIRE(book->depth(BookSide::Ask) == 1);
+    REQUIRE(book->best_bid().price.raw == px("400.00"));
+    REQUIRE(book->level(BookSide::Bid, 2).price.raw == px("399.98"));
+    REQUIRE(book->msg_seq_num() == 10);
+    REQUIRE_FALSE(book->crossed());
+
+    SECTION("Price-keyed New / Change / Delete") {
+        REQUIRE(apply("X", 11, "268=4|"
+                      "279=0|269=0|55=MSFT|270=400.01|271=50|"
+                      "279=1|269=0|55=MSFT|270=399.99|271=250|"
+                      "279=2|269=1|55=MSFT|270=400.05|"
+                      "279=0|269=0|55=IBM|270=1|271=1|") == 3);
+        REQUIRE(changes.size() == 3);
+        REQUIRE(changes[0].event == BookEvent::Insert);
+        REQUIRE(changes[0].level == 0);
+        REQUIRE(changes[1].event == BookEvent::Update);
+        REQUIRE(changes[1].level == 2);
+        REQUIRE(changes[2].event == BookEvent::Remove);
+        REQUIRE(changes[2].side == BookSide::Ask);
+
+        REQUIRE(book->depth(BookSide::Bid) == 4);
+        REQUIRE(book->best_bid().price.raw == px("400.01"));
+        REQUIRE(book->level(BookSide::Bid, 2).size.raw == Qty::from_int(250).raw);
+        REQUIRE(book->depth(BookSide::Ask) == 0);
+
+        // Fifth bid level falls off a 4-deep book
+        REQUIRE(apply("X", 12, "268=1|"
+                      "279=0|269=0|55=MSFT|270=399.97|271=1|") == 0);
+        REQUIRE(book->dropped_levels() == 1);
+        REQUIRE(book->level(BookSide::Bid, 3).price.raw == px("399.98"));
+    }
+
+    SECTION("Position-indexed updates") {
+        REQUIRE(apply("X", 11, "268=3|"
+                      "279=0|269=1|55=MSFT|270=400.02|271=10|290=1|346=2|"
+                      "279=1|269=0|55=MSFT|270=399.99|271=999|290=2|"
+                      "279=2|269=0|290=3|") == 3);
+        REQUIRE(book->best_ask().price.raw == px("400.02"));
+        REQUIRE(book->best_ask().orders == 2);
+        REQUIRE(book->level(BookSide::Ask, 1).price.raw == px("400.05"));
+        REQUIRE(book->level(BookSide::Bid, 1).size.raw == Qty::from_int(999).raw);
+        REQUIRE(book->depth(BookSide::Bid) == 2);
+        REQUIRE(changes[2].event == BookEvent::Remove);
+        REQUIRE(changes[2].level == 2);
+    }
+
+    SECTION("DeleteThru and DeleteFrom") {
+        REQUIRE(apply("X", 11, "268=1|"
+                      "279=3|269=0|290=2|") == 1);
+        REQUIRE(book->depth(BookSide::Bid) == 1);
+        REQUIRE(book->best_bid().price.raw == px("399.98"));
+        REQUIRE(changes[0].count == 2);
+
+        REQUIRE(apply("X", 12, "268=1|"
+                      "279=4|269=1|290=1|") == 1);
+        REQUIRE(book->depth(BookSide::Ask) == 0);
+
+        // Price-keyed DeleteFrom: everything at or behind 399.98
+        REQUIRE(apply("X", 13, "268=1|"
+                      "279=4|269=0|270=399.98|") == 1);
+        REQUIRE(book->depth(BookSide::Bid) == 0);
+    }
+
+    SECTION("Snapshot for another symbol is ignored") {
+        REQUIRE(apply("W", 11, "55=AAPL|268=1|"
+                      "269=0|270=1|271=1|") == 0);
+        REQUIRE(book->depth(BookSide::Bid) == 3);
+        REQUIRE(changes.empty());
+    }
+}
+
+TEST_CASE("L3OrderBook - Order-level maintenance", "[market_data][order_book][l3]") {
+    using store::BookSide;
+    auto book = std::make_unique<store::L3OrderBook<64, 16>>("MSFT");
+    auto px = [](const char* s) { return FixedPrice::from_string(s); };
+    auto qty = [](int64_t n) { return Qty::from_int(n); };
+
+    REQUIRE(book->add(1, BookSide::Bid, px("100.00"), qty(100)));
+    REQUIRE(book->add(2, BookSide::Bid, px("100.00"), qty(200)));
+    REQUIRE(book->add(3, BookSide::Bid, px("99.99"), qty(50)));
+    REQUIRE(book->add(4, BookSide::Ask, px("100.02"), qty(10)));
+    REQUIRE_FALSE(book->add(1, BookSide::Bid, px("100.00"), qty(1)));  // Duplicate id
+
+    REQUIRE(book->best_bid().price == px("100.00"));
+    REQUIRE(book->best_bid().size == qty(300));
+    REQUIRE(book->best_bid().orders == 2);
+    REQUIRE(book->best_ask().price == px("100.02"));
+    REQUIRE(book->queue_ahead(2) == qty(100));
+
+    SECTION("Modify keeps or loses time priority") {
+        REQUIRE(book->modify(1, px("100.00"), qty(60)));   // Reduce: stays first
+        REQUIRE(book->queue_ahead(2) == qty(60));
+        REQUIRE(book->modify(1, px("100.00"), qty(80)));   // Increase: to the back
+        REQUIRE(book->queue_ahead(1) == qty(200));
+        REQUIRE(book->level_at(BookSide::Bid, px("100.00")).size == qty(280));
+
+        REQUIRE(book->modify(2, px("100.01"), qty(200)));  // New best level
+        REQUIRE(book->best_bid().price == px("100.01"));
+        REQUIRE(book->level_count(BookSide::Bid) == 3);
+        REQUIRE_FALSE(book->modify(99, px("1"), qty(1)));
+    }
+
+    SECTION("Emptying the best level re-derives the best lazily") {
+        REQUIRE(book->remove(1));
+        REQUIRE(book->execute(2, qty(150)));
+        REQUIRE(book->best_bid().size == qty(50));
+        REQUIRE(book->execute(2, qty(50)));
+        REQUIRE_FALSE(book->contains(2));
+        REQUIRE(book->best_bid().price == px("99.99"));
+        REQUIRE(book->order_count() == 2);
+
+        std::array<store::PriceLevel, 4> depth{};
+        REQUIRE(book->add(5, BookSide::Bid, px("99.98"), qty(5)));
+        REQUIRE(book->depth(BookSide::Bid, depth) == 2);
+        REQUIRE(depth[0].price == px("99.99"));
+        REQUIRE(depth[1].price == px("99.98"));
+    }
+
+    SECTION("Churn through the hash tables and pools") {
+        // Far more events than capacity: deletion must leave probes intact
+        for (uint64_t id = 100; id < 5100; ++id) {
+            REQUIRE(book->add(id, BookSide::Ask, px("100.05"), qty(1)));
+            REQUIRE(book->contains(id));
+            if (id >= 140) REQUIRE(book->remove(id - 40));
+        }
+        REQUIRE(book->order_count() == 44);
+        REQUIRE(book->level_at(BookSide::Ask, px("100.05")).orders == 40);
+        REQUIRE(book->queue_ahead(5099) == qty(39));
+        book->clear();
+        REQUIRE(book->order_count() == 0);
+        REQUIRE(book->best_ask().orders == 0);
+    }
+
+    SECTION("35=W / 35=X keyed by MDEntryID") {
+        auto apply = [&](const char* type, uint32_t seq, const char* body) {
+            std::string raw = frame_fix_message(type, seq, body);
+            auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+            REQUIRE(msg.has_value());
+            return book->apply(*msg);
+        };
+
+        REQUIRE(apply("W", 10, "55=MSFT|268=3|"
+                      "269=0|270=50.00|271=10|278=A1|"
+                      "269=0|270=50.00|271=20|278=A2|"
+                      "269=1|270=50.10|271=5|278=17|") == 3);
+        REQUIRE(book->order_count() == 3);
+        REQUIRE(book->contains(17));
+        REQUIRE(book->queue_ahead(store::l3_order_key("A2")) == qty(10));
+
+        REQUIRE(apply("X", 11, "268=3|"
+                      "279=2|269=0|55=MSFT|278=A1|"
+                      "279=1|269=1|55=MSFT|270=50.09|271=5|278=17|"
+                      "279=0|269=0|55=IBM|270=1|271=1|278=X9|") == 2);
+        REQUIRE(book->queue_ahead(store::l3_order_key("A2")) == qty(0));
+        REQUIRE(book->best_ask().price == px("50.09"));
+        REQUIRE(book->msg_seq_num() == 11);
+    }
+}
+
+TEST_CASE("SymbolRegistry - Interning and resolution", "[market_data][symbols]") {
+    auto symbols = std::make_unique<store::SymbolRegistry<16, 2>>();
+
+    SECTION("Builder symbols get dense ids") {
+        MarketDataRequest::Builder builder;
+        builder.add_symbol("AAPL").add_symbol("GOOGL").add_symbol("AAPL");
+        REQUIRE(builder.symbols().size() == 3);
+
+        REQUIRE(symbols->subscribe(builder.symbols()) == 3);
+        REQUIRE(symbols->size() == 2);
+        REQUIRE(symbols->find("AAPL") == 0);
+        REQUIRE(symbols->find("GOOGL") == 1);
+        REQUIRE(symbols->symbol(1) == "GOOGL");
+        REQUIRE(symbols->symbol(2).empty());
+
+        // Prefixes and unknown / oversized values never match
+        REQUIRE(symbols->find("AAP") == store::INVALID_SYMBOL);
+        REQUIRE(symbols->find("AAPLX") == store::INVALID_SYMBOL);
+        REQUIRE(symbols->intern("") == store::INVALID_SYMBOL);
+        REQUIRE(symbols->intern(std::string(32, 'X')) == store::INVALID_SYMBOL);
+        REQUIRE(symbols->intern(std::string(31, 'X')) == 2);
+    }
+
+    SECTION("RelatedSym group binds SecurityID to the symbol's id") {
+        std::string raw = frame_fix_message("V", 1, "262=MD1|263=1|264=1|146=3|"
+                                                    "55=AAPL|48=US0378331005|"
+                                                    "55=MSFT|48=US5949181045|"
+                                                    "55=ESZ6|");
+        auto request = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(request.has_value());
+
+        REQUIRE(symbols->subscribe(*request) == 3);
+        REQUIRE(symbols->find_security_id("US5949181045") == symbols->find("MSFT"));
+        REQUIRE(symbols->find_security_id("US0378331005") == 0);
+        REQUIRE(symbols->find_security_id("ESZ6") == store::INVALID_SYMBOL);
+
+        // A SecurityID keeps its first binding
+        REQUIRE_FALSE(symbols->alias(2, "US0378331005"));
+        REQUIRE(symbols->alias(2, "ESZ6-ID"));
+
+        std::string by_id = frame_fix_message("W", 2, "48=US5949181045|268=0|");
+        auto msg = ParsedMessage::parse(std::span<const char>{by_id.data(), by_id.size()});
+        REQUIRE(msg.has_value());
+        REQUIRE(symbols->resolve(*msg) == 1);
+    }
+
+    SECTION("Hot cache answers repeated lookups") {
+        REQUIRE(symbols->intern("AAPL") == 0);
+        REQUIRE(symbols->intern("MSFT") == 1);
+        REQUIRE(symbols->intern("IBM") == 2);
+
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(symbols->resolve("AAPL") == 0);
+            REQUIRE(symbols->resolve("MSFT") == 1);
+        }
+        REQUIRE(symbols->cache_hits() == 18);
+
+        // Evicting through a two-entry cache still resolves correctly
+        REQUIRE(symbols->resolve("IBM") == 2);
+        REQUIRE(symbols->resolve("AAPL") == 0);
+        REQUIRE(symbols->resolve("NFLX") == store::INVALID_SYMBOL);
+        REQUIRE(symbols->cache_hits() == 18);
+    }
+
+    SECTION("Columnar symbol dictionary maps to registry ids") {
+        REQUIRE(symbols->intern("MSFT") == 0);
+        REQUIRE(symbols->intern("AAPL") == 1);
+
+        std::string raw = frame_fix_message("X", 3, "268=3|"
+                                                    "279=0|269=0|55=AAPL|270=1|271=1|"
+                                                    "279=0|269=0|55=TSLA|270=1|271=1|"
+                                                    "279=0|269=1|55=MSFT|270=2|271=1|");
+        MDEntryColumns<8> cols;
+        auto count = parser::decode_md_entries(std::span<const char>{raw.data(), raw.size()},
+                                               tag::MDUpdateAction::value, 3, cols);
+        REQUIRE(count == 3);
+
+        std::array<store::SymbolId, MDEntryColumns<8>::MAX_SYMBOLS> ids{};
+        REQUIRE(symbols->resolve(cols, ids) == 3);
+        REQUIRE(ids[cols.symbol_id[0]] == 1);
+        REQUIRE(ids[cols.symbol_id[1]] == store::INVALID_SYMBOL);
+        REQUIRE(ids[cols.symbol_id[2]] == 0);
+    }
+}
+
+TEST_CASE("MarketDataRecovery - Snapshot/incremental arbitration", "[market_data][recovery]") {
+    using store::RecoveryState;
+    using store::BookSide;
+
+    struct Books {
+        std::vector<std::unique_ptr<store::OrderBook<8>>> books;
+        std::vector<std::pair<store::SymbolId, uint32_t>> gaps;
+
+        void on_snapshot(store::SymbolId id, const MDEntryColumns<256>& cols) {
+            books[id]->rebuild(cols);
+        }
+        void on_entry(store::SymbolId id, const MDEntryRow& row) {
+            books[id]->apply_entry(row);
+        }
+        void on_gap(store::SymbolId id, uint32_t expected, uint32_t) {
+            gaps.emplace_back(id, expected);
+        }
+    };
+
+    auto symbols = std::make_unique<store::SymbolRegistry<16>>();
+    auto recovery = std::make_unique<store::MarketDataRecovery<16, 4>>(*symbols);
+    Books books;
+    const auto aapl = symbols->intern("AAPL");
+    const auto msft = symbols->intern("MSFT");
+    books.books.push_back(std::make_unique<store::OrderBook<8>>("AAPL"));
+    books.books.push_back(std::make_unique<store::OrderBook<8>>("MSFT"));
+
+    uint32_t seq = 1;
+    auto feed = [&](const char* type, const std::string& body) {
+        std::string raw = frame_fix_message(type, seq++, body);
+        auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(msg.has_value());
+        return recovery->apply(*msg, books);
+    };
+    auto bid = [](const char* sym, int rpt, const char* px) {
+        return std::string{"279=0|269=0|55="} + sym + "|83=" + std::to_string(rpt) +
+               "|270=" + px + "|271=100|";
+    };
+    auto best_bid = [&](store::SymbolId id) { return books.books[id]->best_bid().price.raw; };
+    auto px = [](const char* s) { return FixedPrice::from_string(s).raw; };
+
+    SECTION("Incrementals before the snapshot are buffered, stale ones dropped on replay") {
+        REQUIRE(feed("X", "268=2|" + bid("AAPL", 10, "100.00") + bid("AAPL", 11, "100.01")) == 0);
+        REQUIRE(recovery->pending(aapl) == 2);
+        REQUIRE(recovery->state(aapl) == RecoveryState::AwaitingSnapshot);
+
+        // Snapshot reflects RptSeq 10: row 10 is stale, row 11 replays
+        REQUIRE(feed("W", "55=AAPL|83=10|268=1|269=0|270=99.99|271=100|") == 2);
+        REQUIRE(recovery->state(aapl) == RecoveryState::Live);
+        REQUIRE(recovery->pending(aapl) == 0);
+        REQUIRE(recovery->last_rpt_seq(aapl) == 11);
+        REQUIRE(best_bid(aapl) == px("100.01"));
+        REQUIRE(books.books[aapl]->depth(BookSide::Bid) == 2);
+        REQUIRE(recovery->stats().stale == 1);
+        REQUIRE(recovery->stats().replayed == 1);
+
+        // Live: in-order rows apply, duplicates are dropped
+        REQUIRE(feed("X", "268=2|" + bid("AAPL", 12, "100.02") + bid("AAPL", 12, "100.02")) == 1);
+        REQUIRE(books.books[aapl]->depth(BookSide::Bid) == 3);
+    }
+
+    SECTION("A gap recovers one symbol while the other stays live") {
+        REQUIRE(feed("W", "55=AAPL|83=1|268=0|") == 0);
+        REQUIRE(feed("W", "55=MSFT|83=1|268=0|") == 0);
+        REQUIRE(recovery->recovering() == 0);
+
+        REQUIRE(feed("X", "268=2|" + bid("AAPL", 3, "100.00") + bid("MSFT", 2, "50.00")) == 1);
+        REQUIRE(recovery->state(aapl) == RecoveryState::Recovering);
+        REQUIRE(recovery->state(msft) == RecoveryState::Live);
+        REQUIRE(books.gaps.size() == 1);
+        REQUIRE(books.gaps[0] == std::pair<store::SymbolId, uint32_t>{aapl, 2});
+        REQUIRE(best_bid(msft) == px("50.00"));
+        REQUIRE(recovery->recovering() == 1);
+
+        REQUIRE(feed("X", "268=2|" + bid("AAPL", 4, "100.01") + bid("MSFT", 3, "50.01")) == 1);
+        REQUIRE(recovery->pending(aapl) == 2);
+        REQUIRE(books.books[aapl]->depth(BookSide::Bid) == 0);
+
+        // Snapshot at 3: row 3 is covered, row 4 replays
+        REQUIRE(feed("W", "55=AAPL|83=3|268=1|269=0|270=100.00|271=100|") == 2);
+        REQUIRE(recovery->state(aapl) == RecoveryState::Live);
+        REQUIRE(best_bid(aapl) == px("100.01"));
+
+        // An older snapshot does not roll a live book back
+        REQUIRE(feed("W", "55=AAPL|83=2|268=1|269=0|270=1|271=1|") == 0);
+        REQUIRE(best_bid(aapl) == px("100.01"));
+    }
+
+    SECTION("Buffer overflow keeps the newest rows and waits for a later snapshot") {
+        REQUIRE(feed("W", "55=AAPL|83=1|268=0|") == 0);
+        recovery->request_snapshot(aapl);
+        for (int r = 2; r <= 7; ++r) {
+            (void)feed("X", "268=1|" + bid("AAPL", r, r % 2 ? "100.01" : "100.02"));
+        }
+        REQUIRE(recovery->pending(aapl) == 4);
+        REQUIRE(recovery->stats().overflowed == 2);
+
+        // Snapshot at 2 cannot bridge to the oldest buffered row (4)
+        REQUIRE(feed("W", "55=AAPL|83=2|268=0|") == 0);
+        REQUIRE(recovery->state(aapl) == RecoveryState::Recovering);
+        REQUIRE(recovery->pending(aapl) == 4);
+
+        REQUIRE(feed("W", "55=AAPL|83=5|268=0|") == 2);
+        REQUIRE(recovery->state(aapl) == RecoveryState::Live);
+        REQUIRE(recovery->last_rpt_seq(aapl) == 7);
+    }
+
+    SECTION("Rows without RptSeq use LastMsgSeqNumProcessed") {
+        seq = 20;
+        REQUIRE(feed("X", "268=1|279=0|269=0|55=MSFT|270=49.00|271=1|") == 0);   // MsgSeqNum 20
+        REQUIRE(feed("X", "268=1|279=0|269=0|55=MSFT|270=49.50|271=1|") == 0);   // MsgSeqNum 21
+        REQUIRE(feed("W", "55=MSFT|369=20|268=0|") == 1);
+        REQUIRE(best_bid(msft) == px("49.50"));
+        REQUIRE(books.books[msft]->depth(BookSide::Bid) == 1);
+    }
+
+    SECTION("reset() returns a symbol to AwaitingSnapshot") {
+        REQUIRE(feed("W", "55=AAPL|83=1|268=0|") == 0);
+        recovery->reset(aapl);
+        REQUIRE(recovery->state(aapl) == RecoveryState::AwaitingSnapshot);
+        REQUIRE(feed("X", "268=1|" + bid("AAPL", 2, "1")) == 0);
+        REQUIRE(recovery->pending(aapl) == 1);
+    }
+}
+
+TEST_CASE("LineArbitrator - A/B arbitration and gaps", "[market_data][multicast]") {
+    struct Sink {
+        std::vector<uint32_t> packets;
+        std::vector<std::pair<uint32_t, uint32_t>> gaps;
+
+        void on_packet(uint32_t seq, std::span<const char> data) {
+            REQUIRE(data.size() == 1);
+            REQUIRE(data[0] == static_cast<char>('a' + seq % 26));
+            packets.push_back(seq);
+        }
+        void on_gap(uint32_t expected, uint32_t received) { gaps.emplace_back(expected, received); }
+    };
+    constexpr size_t A = 0;
+    constexpr size_t B = 1;
+
+    Sink sink;
+    auto send = [&](LineArbitrator& arb, size_t line, uint32_t seq) {
+        const char byte = static_cast<char>('a' + seq % 26);
+        return arb.on_packet(line, seq, std::span<const char>{&byte, 1}, sink);
+    };
+
+    SECTION("The first copy wins, the other line fills a hole") {
+        LineArbitrator arb{2, 8, 64};
+        REQUIRE(send(arb, A, 1) == 1);
+        REQUIRE(send(arb, B, 1) == 0);
+        REQUIRE(send(arb, A, 2) == 1);
+        REQUIRE(send(arb, A, 4) == 0);       // 3 lost on A: held, B has not passed 3
+        REQUIRE(send(arb, A, 5) == 0);
+        REQUIRE(arb.held() == 2);
+        REQUIRE(send(arb, B, 2) == 0);
+        REQUIRE(send(arb, B, 3) == 3);       // 3, then held 4 and 5
+        REQUIRE(send(arb, B, 4) == 0);
+        REQUIRE(send(arb, B, 5) == 0);
+        REQUIRE(sink.packets == std::vector<uint32_t>{1, 2, 3, 4, 5});
+        REQUIRE(sink.gaps.empty());
+        REQUIRE(arb.stats().duplicates == 4);
+        REQUIRE(arb.stats().packets[A] == 4);
+        REQUIRE(arb.stats().packets[B] == 5);
+    }
+
+    SECTION("A gap is final once both lines have passed it") {
+        LineArbitrator arb{2, 8, 64};
+        REQUIRE(send(arb, A, 10) == 1);
+        REQUIRE(send(arb, B, 10) == 0);
+        REQUIRE(send(arb, A, 13) == 0);
+        REQUIRE(send(arb, B, 12) == 2);      // Neither line has 11: report it, deliver 12, 13
+        REQUIRE(sink.gaps == std::vector<std::pair<uint32_t, uint32_t>>{{11, 12}});
+        REQUIRE(sink.packets == std::vector<uint32_t>{10, 12, 13});
+        REQUIRE(send(arb, A, 11) == 0);      // Late copy
+        REQUIRE(arb.stats().lost == 1);
+        REQUIRE(arb.expected() == 14);
+    }
+
+    SECTION("A single line reports gaps at once") {
+        LineArbitrator arb{1, 8, 64};
+        REQUIRE(send(arb, A, 1) == 1);
+        REQUIRE(send(arb, A, 4) == 1);
+        REQUIRE(sink.gaps == std::vector<std::pair<uint32_t, uint32_t>>{{2, 4}});
+        REQUIRE(arb.stats().lost == 2);
+    }
+
+    SECTION("Packets beyond the hold window and flush() end the wait") {
+        LineArbitrator arb{2, 4, 64};
+        REQUIRE(send(arb, A, 1) == 1);
+        REQUIRE(send(arb, A, 3) == 0);
+        REQUIRE(send(arb, A, 9) == 2);       // Too far ahead: 2 and 4-8 are given up
+        REQUIRE(sink.gaps == std::vector<std::pair<uint32_t, uint32_t>>{{2, 3}, {4, 9}});
+        REQUIRE(sink.packets == std::vector<uint32_t>{1, 3, 9});
+
+        REQUIRE(send(arb, B, 11) == 0);
+        REQUIRE(arb.held() == 1);
+        REQUIRE(arb.flush(sink) == 1);
+        REQUIRE(sink.gaps.back() == std::pair<uint32_t, uint32_t>{10, 11});
+        REQUIRE(arb.held() == 0);
+
+        arb.reset();
+        REQUIRE(send(arb, B, 500) == 1);
+        REQUIRE(arb.expected() == 501);
+    }
+}
+
+TEST_CASE("MulticastReceiver - Loopback A/B feed into recovery", "[market_data][multicast]") {
+    auto symbols = std::make_unique<store::SymbolRegistry<16>>();
+    auto recovery = std::make_unique<store::MarketDataRecovery<16, 4>>(*symbols);
+    const auto aapl = symbols->intern("AAPL");
+
+    struct Books {
+        size_t entries{0};
+        void on_snapshot(store::SymbolId, const MDEntryColumns<256>&) {}
+        void on_entry(store::SymbolId, const MDEntryRow&) { ++entries; }
+    } books;
+
+    struct Incrementals {
+        store::MarketDataRecovery<16, 4>* recovery;
+        Books* books;
+        size_t messages{0};
+        size_t gaps{0};
+
+        void on_packet(uint32_t, std::span<const char> payload) {
+            messages += FixPacket::for_each_message(payload, [&](std::span<const char> raw) {
+                auto msg = ParsedMessage::parse(raw);
+                REQUIRE(msg.has_value());
+                recovery->apply(*msg, *books);
+            });
+        }
+        void on_gap(uint32_t, uint32_t) {
+            ++gaps;
+            recovery->request_snapshot_all();
+        }
+    } incrementals{recovery.get(), &books};
+
+    // Unicast loopback stands in for the two groups
+    MulticastFeedConfig config;
+    config.line_a = {"127.0.0.1", 0};
+    config.line_b = {"127.0.0.1", 0};
+    config.batch = 4;
+    MulticastReceiver<FixPacket> feed;
+    REQUIRE(feed.open(config).has_value());
+    REQUIRE(feed.local_port(0) != 0);
+    REQUIRE(feed.local_port(1) != 0);
+
+    const int out = ::socket(AF_INET, SOCK_DGRAM, 0);
+    REQUIRE(out >= 0);
+    auto publish = [&](size_t line, uint32_t seq, int rpt) {
+        std::string raw = frame_fix_message("X", seq, "268=1|279=0|269=0|55=AAPL|83=" +
+                                            std::to_string(rpt) + "|270=100|271=1|");
+        sockaddr_in to{};
+        to.sin_family = AF_INET;
+        to.sin_port = htons(feed.local_port(line));
+        to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        REQUIRE(::sendto(out, raw.data(), raw.size(), 0,
+                         reinterpret_cast<const sockaddr*>(&to), sizeof(to)) ==
+                static_cast<ssize_t>(raw.size()));
+    };
+    auto drain = [&] {
+        size_t n = 0;
+        for (int i = 0; i < 8; ++i) n += feed.poll(incrementals);
+        return n;
+    };
+
+    std::string snapshot = frame_fix_message("W", 1, "55=AAPL|83=1|268=0|");
+    recovery->apply(*ParsedMessage::parse(std::span<const char>{snapshot.data(), snapshot.size()}), books);
+    REQUIRE(recovery->state(aapl) == store::RecoveryState::Live);
+
+    // Packets 1-6 on both lines, 3 missing from A and 5 from both
+    for (uint32_t seq = 1; seq <= 6; ++seq) {
+        if (seq != 3 && seq != 5) publish(0, seq, static_cast<int>(seq + 1));
+    }
+    for (uint32_t seq = 1; seq <= 6; ++seq) {
+        if (seq != 5) publish(1, seq, static_cast<int>(seq + 1));
+    }
+    REQUIRE(drain() == 5);
+    REQUIRE(incrementals.messages == 5);
+    REQUIRE(incrementals.gaps == 1);
+    REQUIRE(books.entries == 4);        // RptSeq 2-5 live; the gap stops AAPL before 7
+    REQUIRE(recovery->state(aapl) == store::RecoveryState::Recovering);
+
+    const auto stats = feed.stats();
+    REQUIRE(stats.packets[0] == 4);
+    REQUIRE(stats.packets[1] == 5);
+    REQUIRE(stats.duplicates == 4);
+    REQUIRE(stats.lost == 1);
+
+    ::close(out);
+    feed.close();
+    REQUIRE_FALSE(feed.is_open());
+}
+
+TEST_CASE("TokenBucket - GCRA pacing", "[market_data][subscriptions]") {
+    constexpr uint64_t MS = 1'000'000;
+    util::TokenBucket bucket{50, 3};  // One token per 20ms, three at once
+
+    REQUIRE(bucket.available(0) == 3);
+    REQUIRE(bucket.try_acquire(0));
+    REQUIRE(bucket.try_acquire(0, 2));
+    REQUIRE_FALSE(bucket.try_acquire(0));
+    REQUIRE(bucket.next_available(0) == 20 * MS);
+
+    REQUIRE_FALSE(bucket.try_acquire(19 * MS));
+    REQUIRE(bucket.try_acquire(20 * MS));
+    REQUIRE_FALSE(bucket.try_acquire(20 * MS));
+
+    // Idle time refills up to the burst, no further
+    REQUIRE(bucket.available(1000 * MS) == 3);
+    REQUIRE_FALSE(bucket.try_acquire(1000 * MS, 4));
+    REQUIRE(bucket.try_acquire(1000 * MS, 3));
+}
+
+TEST_CASE("MarketDataSubscriptions - Batching, pacing and rejects", "[market_data][subscriptions]") {
+    constexpr uint64_t MS = 1'000'000;
+    auto symbols = std::make_unique<store::SymbolRegistry<256>>();
+
+    SubscriptionConfig config;
+    config.batch_size = 16;
+    config.requests_per_second = 10;
+    config.burst = 2;
+    config.max_retries = 1;
+    config.retry_delay_ns = 500 * MS;
+    config.md_req_id_prefix = "S";
+    MarketDataSubscriptions<256> subs{*symbols, config};
+
+    std::vector<std::string> names;
+    for (int i = 0; i < 40; ++i) names.push_back("SYM" + std::to_string(i));
+    for (const auto& n : names) REQUIRE(subs.add(n) != store::INVALID_SYMBOL);
+    REQUIRE(subs.add("SYM0") == 0);  // Already queued
+    REQUIRE(subs.waiting() == 40);
+
+    std::vector<std::string> wire;
+    MessageAssembler asm_;
+    auto send = [&](MarketDataRequest::Builder& b) {
+        auto msg = b.sender_comp_id("C").target_comp_id("V").sending_time("x").build(asm_);
+        wire.emplace_back(msg.data(), msg.size());
+        return true;
+    };
+    auto reject = [&](std::string_view id, MDReqRejReason reason, uint64_t now) {
+        MarketDataRequestReject r;
+        r.md_req_id = id;
+        r.md_req_rej_reason = reason;
+        return subs.on_reject(r, now);
+    };
+
+    // 40 symbols -> 16 + 16 + 8; burst of two, then one per 100ms
+    REQUIRE(subs.poll(0, send) == 2);
+    REQUIRE(wire.size() == 2);
+    REQUIRE(wire[0].contains("262=S1"));
+    REQUIRE(wire[0].contains("146=16"));
+    REQUIRE(wire[0].contains("55=SYM0\x01"));
+    REQUIRE(wire[0].contains("267=2"));
+    REQUIRE(subs.next_poll(0) == 100 * MS);
+    REQUIRE(subs.poll(50 * MS, send) == 0);
+    REQUIRE(subs.poll(100 * MS, send) == 1);
+    REQUIRE(wire[2].contains("146=8"));
+    REQUIRE(subs.idle());
+    REQUIRE(subs.stats().symbols_sent == 40);
+
+    const auto sym5 = symbols->find("SYM5");
+    REQUIRE(subs.status(sym5) == SubscriptionStatus::Sent);
+    REQUIRE(subs.md_req_id(sym5) == "S1");
+    REQUIRE(subs.symbols_of("S3").size() == 8);
+    subs.on_market_data(sym5);
+    REQUIRE(subs.status(sym5) == SubscriptionStatus::Active);
+
+    SECTION("Unknown symbol is isolated by bisection") {
+        const auto bad = symbols->find("SYM37");   // In S3 (SYM32..SYM39)
+        uint64_t now = 1000 * MS;
+        std::string id = "S3";
+        size_t rounds = 0;
+        while (subs.status(bad) != SubscriptionStatus::Failed) {
+            REQUIRE(reject(id, MDReqRejReason::UnknownSymbol, now));
+            REQUIRE_FALSE(reject(id, MDReqRejReason::UnknownSymbol, now));  // Handled once
+            if (subs.status(bad) == SubscriptionStatus::Failed) break;
+            now += 1000 * MS;
+            REQUIRE(subs.poll(now, send) == 2);
+            id = std::string{subs.md_req_id(bad)};
+            REQUIRE(subs.symbols_of(id).size() == 8u >> ++rounds);
+        }
+        REQUIRE(rounds == 3);
+        REQUIRE(subs.stats().failed_symbols == 1);
+        REQUIRE(subs.status(symbols->find("SYM36")) == SubscriptionStatus::Sent);
+        REQUIRE(subs.idle());
+    }
+
+    SECTION("Transient rejects retry after a delay, then fail") {
+        REQUIRE(reject("S2", MDReqRejReason::Other, 1000 * MS));
+        REQUIRE(subs.status(symbols->find("SYM16")) == SubscriptionStatus::Queued);
+        REQUIRE(subs.waiting() == 16);
+        REQUIRE(subs.next_poll(1000 * MS) == 1500 * MS);
+        REQUIRE(subs.poll(1400 * MS, send) == 0);
+        REQUIRE(subs.poll(1500 * MS, send) == 1);
+        REQUIRE(wire.back().contains("262=S4"));
+        REQUIRE(subs.stats().retries == 1);
+
+        REQUIRE(reject("S4", MDReqRejReason::InsufficientCredit, 2000 * MS));
+        REQUIRE(subs.status(symbols->find("SYM16")) == SubscriptionStatus::Failed);
+        REQUIRE(subs.stats().failed_symbols == 16);
+    }
+
+    SECTION("Unsupported request contents fail without retry") {
+        REQUIRE(reject("S1", MDReqRejReason::UnsupportedMarketDepth, 1000 * MS));
+        REQUIRE(subs.status(symbols->find("SYM0")) == SubscriptionStatus::Failed);
+        REQUIRE(subs.idle());
+        REQUIRE_FALSE(reject("X1", MDReqRejReason::Other, 1000 * MS));
+        REQUIRE_FALSE(reject("S99", MDReqRejReason::Other, 1000 * MS));
+    }
+
+    SECTION("A session that cannot send keeps the request") {
+        subs.add("LATE");
+        REQUIRE(subs.poll(2000 * MS, [](MarketDataRequest::Builder&) { return false; }) == 0);
+        REQUIRE(subs.waiting() == 1);
+        REQUIRE(subs.poll(3000 * MS, send) == 1);
+        REQUIRE(wire.back().contains("55=LATE"));
+    }
+}
+
 // ============================================================================
 // MarketDataRequestReject Tests
 // ============================================================================
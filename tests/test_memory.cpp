@@ -1,6 +1,29 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/memory/mpsc_queue.hpp"
+#include "nexusfix/memory/broadcast_ring.hpp"
+#include "nexusfix/memory/conflating_queue.hpp"
+#include "nexusfix/memory/concurrent_pool.hpp"
+#include "nexusfix/memory/huge_page_resource.hpp"
+#include "nexusfix/memory/numa_memory_resource.hpp"
+#include "nexusfix/memory/queue_notifier.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/memory/work_stealing_deque.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/deferred_processor.hpp"
+#include "nexusfix/util/deferred_worker_pool.hpp"
+#include "nexusfix/util/sharded_counter.hpp"
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace nfx;
 
@@ -244,6 +267,159 @@ TEST_CASE("MonotonicPool", "[memory][pmr]") {
     }
 }
 
+// ============================================================================
+// ConcurrentFixedPool Tests
+// ============================================================================
+
+TEST_CASE("ConcurrentFixedPool cross-cache free", "[memory][pool][concurrent]") {
+    using Pool = memory::ConcurrentFixedPool<64, 40, 8>;
+    auto pool = std::make_unique<Pool>();
+    REQUIRE(pool->depot_blocks() == 40);
+
+    SECTION("Blocks freed on another cache return through the depot") {
+        std::vector<void*> blocks;
+        {
+            Pool::LocalCache network{*pool};
+            while (void* p = network.allocate()) {
+                REQUIRE(pool->owns(p));
+                blocks.push_back(p);
+            }
+        }
+        REQUIRE(blocks.size() == 40);
+        REQUIRE(std::set<void*>(blocks.begin(), blocks.end()).size() == 40);
+        REQUIRE(pool->depot_blocks() == 0);
+
+        {
+            Pool::LocalCache strategy{*pool};
+            for (void* p : blocks) {
+                strategy.deallocate(p);
+            }
+            // Two magazines stay cached; the rest went to the depot
+            REQUIRE(strategy.cached() <= 16);
+            REQUIRE(pool->depot_blocks() + strategy.cached() == 40);
+        }
+        REQUIRE(pool->depot_blocks() == 40);
+    }
+
+    SECTION("Producer and consumer threads") {
+        auto queue = std::make_unique<memory::SPSCQueue<void*, 16>>();
+        constexpr int N = 10000;
+
+        std::thread consumer([&] {
+            Pool::LocalCache cache{*pool};
+            void* p = nullptr;
+            for (int freed = 0; freed < N;) {
+                if (queue->try_pop(p)) {
+                    cache.deallocate(p);
+                    ++freed;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        {
+            Pool::LocalCache cache{*pool};
+            for (int i = 0; i < N;) {
+                void* p = cache.allocate();
+                if (!p) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                while (!queue->try_push(p)) {
+                    std::this_thread::yield();
+                }
+                ++i;
+            }
+        }
+        consumer.join();
+        REQUIRE(pool->depot_blocks() == 40);
+    }
+
+    SECTION("Uncached allocate and deallocate") {
+        void* p = pool->allocate();
+        REQUIRE(p != nullptr);
+        REQUIRE(pool->depot_blocks() == 39);
+        pool->deallocate(p);
+        REQUIRE(pool->depot_blocks() == 40);
+    }
+}
+
+// ============================================================================
+// NUMA Tests
+// ============================================================================
+
+TEST_CASE("NUMA topology and memory resource", "[memory][numa]") {
+    SECTION("cpulist parsing") {
+        std::vector<int> cores;
+        util::CpuAffinity::parse_cpu_list("0-2,8,10-11\n", cores);
+        REQUIRE(cores == std::vector<int>{0, 1, 2, 8, 10, 11});
+    }
+
+    SECTION("Resource maps on the core's node") {
+        int node = util::CpuAffinity::get_numa_node(0);
+        REQUIRE(node >= -1);
+        REQUIRE(util::CpuAffinity::numa_node_count() >= 1);
+
+        memory::NumaMemoryResource numa{node};
+        {
+            std::pmr::monotonic_buffer_resource pool{&numa};
+            auto* p = static_cast<char*>(pool.allocate(64 * 1024, CACHE_LINE_SIZE));
+            REQUIRE(p != nullptr);
+            std::memset(p, 0x5A, 64 * 1024);
+            REQUIRE(numa.bytes_mapped() >= 64 * 1024);
+            if (node >= 0) {
+                REQUIRE(memory::numa_node_of(p) == node);
+            }
+        }
+        REQUIRE(numa.bytes_mapped() == 0);
+    }
+
+    SECTION("Negative node leaves memory unbound") {
+        char buf[64];
+        REQUIRE(memory::numa_bind(buf, sizeof(buf), -1));
+    }
+}
+
+// ============================================================================
+// Huge Page Resource Tests
+// ============================================================================
+
+TEST_CASE("HugePageMemoryResource", "[memory][hugepage]") {
+    constexpr size_t HUGE_2MB = static_cast<size_t>(memory::HugePageSize::Huge2MB);
+
+    SECTION("Mappings are 2MB aligned and page-rounded") {
+        memory::HugePageMemoryResource huge{{.prefault = true}};
+        void* p = huge.allocate(HUGE_2MB + 1, CACHE_LINE_SIZE);
+        REQUIRE(p != nullptr);
+        REQUIRE(reinterpret_cast<uintptr_t>(p) % HUGE_2MB == 0);
+        REQUIRE(huge.bytes_mapped() == 2 * HUGE_2MB);
+        REQUIRE(huge.allocations(memory::HugePageBacking::HugeTLB) +
+                huge.allocations(memory::HugePageBacking::Transparent) == 1);
+
+        std::memset(p, 0x5A, HUGE_2MB + 1);
+        huge.deallocate(p, HUGE_2MB + 1, CACHE_LINE_SIZE);
+        REQUIRE(huge.bytes_mapped() == 0);
+    }
+
+    SECTION("Upstream of a monotonic pool") {
+        memory::HugePageMemoryResource huge;
+        {
+            std::pmr::monotonic_buffer_resource pool{&huge};
+            std::pmr::vector<int> v{&pool};
+            v.resize(1000, 7);
+            REQUIRE(v.back() == 7);
+            REQUIRE(huge.bytes_mapped() >= HUGE_2MB);
+        }
+        REQUIRE(huge.bytes_mapped() == 0);
+    }
+
+    SECTION("Over-aligned requests are rejected") {
+        memory::HugePageMemoryResource huge{{.page_size = memory::HugePageSize::Standard}};
+        REQUIRE_THROWS_AS(huge.allocate(64, HUGE_2MB), std::bad_alloc);
+    }
+}
+
 // ============================================================================
 // Cache Line Tests
 // ============================================================================
@@ -259,3 +435,861 @@ TEST_CASE("Cache line alignment", "[memory][cache]") {
     // First allocation should be aligned
     REQUIRE((addr % CACHE_LINE_SIZE) == 0);
 }
+
+// ============================================================================
+// Queue Batch Tests
+// ============================================================================
+
+TEST_CASE("SPSCQueue batch claim/publish and drain", "[memory][queue]") {
+    auto queue = std::make_unique<memory::SPSCQueue<int, 8>>();
+    std::array<int, 8> out{};
+
+    SECTION("Claimed slots are invisible until published") {
+        auto range = queue->try_claim(3);
+        REQUIRE(range.size() == 3);
+        for (size_t i = 0; i < range.size(); ++i) {
+            queue->slot(range, i) = static_cast<int>(i) + 10;
+        }
+        REQUIRE(queue->drain(out) == 0);
+
+        queue->publish(range);
+        REQUIRE(queue->drain(out) == 3);
+        REQUIRE(out[0] == 10);
+        REQUIRE(out[2] == 12);
+        REQUIRE(queue->empty());
+    }
+
+    SECTION("Claim is all or nothing") {
+        REQUIRE_FALSE(queue->try_claim(8));
+        auto range = queue->try_claim(7);
+        REQUIRE(range);
+        queue->publish(range);
+        REQUIRE_FALSE(queue->try_claim(1));
+    }
+
+    SECTION("Batch push wraps around the ring") {
+        const std::array<int, 5> items{1, 2, 3, 4, 5};
+        REQUIRE(queue->try_push_batch(items) == 5);
+        REQUIRE(queue->drain(std::span<int>(out).first(4)) == 4);
+        REQUIRE(queue->try_push_batch(items) == 5);
+        REQUIRE(queue->drain(out) == 6);
+        REQUIRE(out[0] == 5);
+        REQUIRE(out[5] == 5);
+    }
+}
+
+TEST_CASE("MPSCQueue batch claim/publish and drain", "[memory][queue]") {
+    auto queue = std::make_unique<memory::MPSCQueue<int, 8>>();
+    std::array<int, 8> out{};
+
+    SECTION("Drain stops at the first unpublished range") {
+        auto first = queue->try_claim(2);
+        auto second = queue->try_claim(3);
+        REQUIRE(first.size() == 2);
+        REQUIRE(second.first == first.first + 2);
+
+        queue->slot(second, 0) = 30;
+        queue->publish(second);
+        REQUIRE(queue->drain(out) == 0);
+
+        queue->slot(first, 0) = 10;
+        queue->slot(first, 1) = 11;
+        queue->publish(first);
+        REQUIRE(queue->drain(out) == 5);
+        REQUIRE(out[1] == 11);
+        REQUIRE(out[2] == 30);
+    }
+
+    SECTION("Claim fails when the run does not fit") {
+        REQUIRE_FALSE(queue->try_claim(9));
+        const std::array<int, 6> items{1, 2, 3, 4, 5, 6};
+        REQUIRE(queue->try_push_batch(items));
+        REQUIRE_FALSE(queue->try_claim(3));
+        REQUIRE(queue->drain(std::span<int>(out).first(2)) == 2);
+        REQUIRE(queue->try_claim(4));
+    }
+
+    SECTION("Readable slots stay claimed until released") {
+        const std::array<int, 6> items{1, 2, 3, 4, 5, 6};
+        REQUIRE(queue->try_push_batch(items));
+        REQUIRE(queue->readable(4) == 4);
+        REQUIRE(queue->peek(0) == 1);
+        REQUIRE(queue->peek(3) == 4);
+        REQUIRE_FALSE(queue->try_claim(3));
+
+        queue->release(4);
+        REQUIRE(queue->readable(8) == 2);
+        REQUIRE(queue->peek(0) == 5);
+        REQUIRE(queue->try_claim(6));
+    }
+}
+
+TEST_CASE("Queue in-place slot claim and consume", "[memory][queue]") {
+    struct Payload {
+        uint32_t size;
+        char data[256];
+    };
+
+    SECTION("SPSCQueue") {
+        auto queue = std::make_unique<memory::SPSCQueue<Payload, 4>>();
+
+        auto slot = queue->try_claim();
+        REQUIRE(slot);
+        slot->size = 3;
+        std::memcpy(slot->data, "abc", 3);
+        REQUIRE(queue->empty());
+
+        queue->commit(slot);
+        REQUIRE(queue->front() == slot.slot);
+
+        bool seen = false;
+        REQUIRE(queue->try_consume([&](Payload& p) {
+            seen = p.size == 3 && std::memcmp(p.data, "abc", 3) == 0;
+        }));
+        REQUIRE(seen);
+        REQUIRE_FALSE(queue->try_consume([](Payload&) {}));
+    }
+
+    SECTION("MPSCQueue") {
+        auto queue = std::make_unique<memory::MPSCQueue<Payload, 2>>();
+
+        auto first = queue->try_claim();
+        auto second = queue->try_claim();
+        REQUIRE(first);
+        REQUIRE(second);
+        REQUIRE_FALSE(queue->try_claim());
+
+        second->size = 2;
+        queue->commit(second);
+        REQUIRE_FALSE(queue->try_consume([](Payload&) {}));
+
+        first->size = 1;
+        queue->commit(first);
+
+        uint32_t sizes[2]{};
+        size_t n = 0;
+        while (queue->try_consume([&](Payload& p) { sizes[n++] = p.size; })) {}
+        REQUIRE(n == 2);
+        REQUIRE(sizes[0] == 1);
+        REQUIRE(sizes[1] == 2);
+        REQUIRE(queue->try_claim());
+    }
+}
+
+// ============================================================================
+// Broadcast Ring Tests
+// ============================================================================
+
+TEST_CASE("BroadcastRing fan-out", "[memory][queue][broadcast]") {
+    SECTION("Every consumer sees every message; slowest consumer holds the producer") {
+        auto ring = std::make_unique<memory::BroadcastRing<uint64_t, 8, 4>>();
+        auto fast = ring->subscribe();
+        auto slow = ring->subscribe();
+        REQUIRE(fast);
+        REQUIRE(slow);
+
+        for (uint64_t i = 0; i < 8; ++i) {
+            REQUIRE(ring->try_publish(i));
+        }
+        REQUIRE_FALSE(ring->try_publish(8));  // Both consumers 8 behind
+
+        uint64_t v = 0;
+        for (uint64_t i = 0; i < 8; ++i) {
+            REQUIRE(ring->try_read(fast, v));
+            REQUIRE(v == i);
+        }
+        REQUIRE_FALSE(ring->try_read(fast, v));
+        REQUIRE_FALSE(ring->try_publish(8));  // slow still 8 behind
+        REQUIRE(ring->max_lag() == 8);
+
+        // In-place consume frees a slot for the producer
+        const uint64_t* seen = nullptr;
+        REQUIRE(ring->try_consume(slow, [&](const uint64_t& x) { seen = &x; }));
+        REQUIRE(*seen == 0);
+        REQUIRE(ring->try_publish(8));
+
+        ring->unsubscribe(slow);
+        REQUIRE_FALSE(slow);
+        for (uint64_t i = 9; i < 16; ++i) {
+            REQUIRE(ring->try_publish(i));  // Only fast is tracked now
+        }
+        REQUIRE(ring->lag(fast) == 8);
+    }
+
+    SECTION("Consumer slots are bounded") {
+        auto ring = std::make_unique<memory::BroadcastRing<uint64_t, 8, 2>>();
+        auto a = ring->subscribe();
+        auto b = ring->subscribe();
+        REQUIRE(a);
+        REQUIRE(b);
+        REQUIRE_FALSE(ring->subscribe());
+        ring->unsubscribe(a);
+        REQUIRE(ring->subscribe());
+    }
+
+    SECTION("Overwrite mode skips lapped messages and counts them") {
+        using Ring = memory::BroadcastRing<uint64_t, 8, 2, memory::BroadcastMode::Overwrite>;
+        auto ring = std::make_unique<Ring>();
+        auto reader = ring->subscribe();
+
+        for (uint64_t i = 0; i < 20; ++i) {
+            REQUIRE(ring->try_publish(i));  // Never blocks
+        }
+
+        uint64_t v = 0;
+        REQUIRE(ring->try_read(reader, v));
+        REQUIRE(v == 12);                 // Oldest message still in the ring
+        REQUIRE(reader.lost == 12);
+
+        size_t count = 1;
+        while (ring->try_consume(reader, [&](const uint64_t& x) { REQUIRE(x == 12 + count); })) {
+            ++count;
+        }
+        REQUIRE(count == 8);
+    }
+
+    SECTION("Concurrent consumers receive the stream in order") {
+        constexpr uint64_t N = 20000;
+        auto ring = std::make_unique<memory::BroadcastRing<uint64_t, 64, 4,
+                                                   memory::BroadcastMode::Backpressure, memory::YieldingWait>>();
+        std::array<memory::BroadcastReader, 3> readers{};
+        for (auto& r : readers) r = ring->subscribe();
+
+        std::array<uint64_t, 3> sums{};
+        std::vector<std::thread> consumers;
+        for (size_t c = 0; c < readers.size(); ++c) {
+            consumers.emplace_back([&, c] {
+                for (uint64_t expected = 0; expected < N; ++expected) {
+                    const uint64_t v = ring->read(readers[c]);
+                    if (v != expected) return;
+                    sums[c] += v;
+                }
+            });
+        }
+        for (uint64_t i = 0; i < N; ++i) {
+            ring->publish(i);
+        }
+        for (auto& t : consumers) t.join();
+
+        for (uint64_t sum : sums) {
+            REQUIRE(sum == N * (N - 1) / 2);
+        }
+    }
+}
+
+TEST_CASE("ConflatingQueue keeps the latest value per key", "[memory][queue][conflating]") {
+    struct Quote {
+        uint64_t seq;
+        int64_t px;
+    };
+
+    SECTION("Bursts collapse to one delivery per key, in first-dirty order") {
+        auto q = std::make_unique<memory::ConflatingQueue<Quote, 8>>();
+
+        for (uint64_t i = 1; i <= 100; ++i) {
+            REQUIRE(q->publish(5, Quote{i, static_cast<int64_t>(i * 10)}));
+        }
+        REQUIRE(q->publish(2, Quote{1, 7}));
+        REQUIRE(q->update(5, [](Quote& v) noexcept { v.px += 1; }));
+        REQUIRE_FALSE(q->publish(8, Quote{}));
+
+        REQUIRE(q->pending() == 2);
+        REQUIRE(q->published() == 102);
+        REQUIRE(q->conflated() == 100);
+
+        std::vector<std::pair<uint32_t, Quote>> seen;
+        REQUIRE(q->drain([&](uint32_t key, const Quote& v) { seen.emplace_back(key, v); }) == 2);
+        REQUIRE(seen.size() == 2);
+        REQUIRE(seen[0].first == 5);
+        REQUIRE(seen[0].second.seq == 100);
+        REQUIRE(seen[0].second.px == 1001);
+        REQUIRE(seen[1].first == 2);
+        REQUIRE(seen[1].second.px == 7);
+        REQUIRE(q->empty());
+
+        // Keys are re-queued after the consumer took them
+        REQUIRE(q->publish(5, Quote{101, 1}));
+        Quote v{};
+        REQUIRE(q->try_consume([&](uint32_t key, const Quote& x) { REQUIRE(key == 5); v = x; }));
+        REQUIRE(v.seq == 101);
+        REQUIRE_FALSE(q->try_consume([](uint32_t, const Quote&) {}));
+
+        REQUIRE(q->read(2, v));
+        REQUIRE(v.px == 7);
+    }
+
+    SECTION("Slow consumer sees monotonic values and ends on the last one") {
+        constexpr uint32_t KEYS = 16;
+        constexpr uint64_t N = 50000;
+        auto q = std::make_unique<memory::ConflatingQueue<Quote, KEYS>>();
+
+        std::atomic<bool> done{false};
+        std::array<uint64_t, KEYS> last{};
+        bool ordered = true;
+        std::thread consumer([&] {
+            auto take = [&](uint32_t key, const Quote& v) {
+                if (v.seq <= last[key] || v.px != static_cast<int64_t>(v.seq)) ordered = false;
+                last[key] = v.seq;
+            };
+            while (!done.load(std::memory_order_acquire)) {
+                if (!q->try_consume(take)) std::this_thread::yield();
+            }
+            q->drain(take);
+        });
+
+        for (uint64_t i = 1; i <= N; ++i) {
+            (void)q->publish(static_cast<uint32_t>(i % KEYS), Quote{i, static_cast<int64_t>(i)});
+            if (i % 1024 == 0) std::this_thread::yield();
+        }
+        done.store(true, std::memory_order_release);
+        consumer.join();
+
+        REQUIRE(ordered);
+        for (uint32_t k = 0; k < KEYS; ++k) {
+            REQUIRE(last[k] == N - ((N - k) % KEYS));
+        }
+        REQUIRE(q->published() == N);
+    }
+}
+
+// ============================================================================
+// AdaptiveWait Tests
+// ============================================================================
+
+TEST_CASE("AdaptiveWait phase selection", "[memory][wait]") {
+    // 1k-cycle spin window, park after 200k cycles, 50us max park
+    using Wait = memory::AdaptiveWait<1'000, 200'000, 50>;
+
+    SECTION("Immediate arrivals only spin") {
+        Wait::counters() = {};
+        Wait::State state{};
+        for (int i = 0; i < 100; ++i) {
+            Wait::wait(state);
+            Wait::reset(state);
+        }
+        auto& c = Wait::counters();
+        REQUIRE(c.arrivals == 100);
+        REQUIRE(c.spins == 100);
+        REQUIRE(c.parks == 0);
+        REQUIRE(c.last_mode == Wait::Mode::Spin);
+        REQUIRE(state.start == 0);
+    }
+
+    SECTION("Long waits escalate to pause and park") {
+        Wait::counters() = {};
+        std::atomic<bool> ready{false};
+        std::thread producer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            ready.store(true, std::memory_order_release);
+        });
+        Wait::wait_until([&] { return ready.load(std::memory_order_acquire); });
+        producer.join();
+
+        auto& c = Wait::counters();
+        REQUIRE(c.arrivals == 1);
+        REQUIRE(c.parks > 0);
+        REQUIRE(c.pauses > 0);
+        REQUIRE(c.avg_wait_cycles > 0);
+        REQUIRE(c.last_mode == Wait::Mode::Park);
+    }
+
+    SECTION("Sequence wait returns once the target is reached") {
+        Wait::counters() = {};
+        std::atomic<size_t> seq{0};
+        std::thread producer([&] {
+            for (size_t i = 1; i <= 5; ++i) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                seq.store(i, std::memory_order_release);
+            }
+        });
+        Wait::wait_for_sequence(seq, 5);
+        producer.join();
+
+        REQUIRE(seq.load() == 5);
+        REQUIRE(Wait::counters().arrivals == 1);
+    }
+
+    SECTION("Counters are per thread") {
+        Wait::counters() = {};
+        std::thread other([] {
+            Wait::State s{};
+            Wait::wait(s);
+            Wait::reset(s);
+        });
+        other.join();
+        REQUIRE(Wait::counters().arrivals == 0);
+    }
+}
+
+// ============================================================================
+// QueueNotifier Tests
+// ============================================================================
+
+TEST_CASE("NotifyingQueue sleeping consumer wake-up", "[memory][queue][notifier]") {
+    using Queue = memory::NotifyingQueue<memory::MPSCQueue<uint64_t, 64>>;
+    constexpr std::array modes{memory::QueueNotifier::Mode::Futex,
+                               memory::QueueNotifier::Mode::EventFd};
+
+    SECTION("No signal while the consumer is awake") {
+        for (auto mode : modes) {
+            auto q = std::make_unique<Queue>(mode);
+            for (uint64_t i = 0; i < 10; ++i) {
+                REQUIRE(q->try_push(i));
+            }
+            REQUIRE(q->notifier().signals() == 0);
+
+            uint64_t v = 0;
+            REQUIRE(q->pop_wait(v, 0));
+            REQUIRE(v == 0);
+        }
+    }
+
+    SECTION("Timeout on an empty queue") {
+        for (auto mode : modes) {
+            auto q = std::make_unique<Queue>(mode);
+            uint64_t v = 0;
+            REQUIRE_FALSE(q->pop_wait(v, 5));
+            REQUIRE_FALSE(q->notifier().sleeping());
+        }
+    }
+
+    SECTION("Producer wakes a sleeping consumer") {
+        for (auto mode : modes) {
+            auto q = std::make_unique<Queue>(mode);
+            std::thread producer([&] {
+                while (!q->notifier().sleeping()) {
+                    std::this_thread::yield();
+                }
+                (void)q->try_push(42);
+            });
+
+            uint64_t v = 0;
+            const bool got = q->pop_wait(v, 5000);
+            producer.join();
+
+            REQUIRE(got);
+            REQUIRE(v == 42);
+            REQUIRE(q->notifier().signals() == 1);
+            REQUIRE_FALSE(q->notifier().sleeping());
+        }
+    }
+
+    SECTION("Stream of items across sleeps") {
+        constexpr uint64_t N = 2000;
+        for (auto mode : modes) {
+            auto q = std::make_unique<Queue>(mode);
+            std::thread producer([&] {
+                for (uint64_t i = 0; i < N; ++i) {
+                    while (!q->try_push(i)) std::this_thread::yield();
+                    if (i % 100 == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            });
+
+            uint64_t sum = 0;
+            size_t received = 0;
+            for (uint64_t i = 0; i < N; ++i) {
+                uint64_t v = 0;
+                if (!q->pop_wait(v, 5000)) break;
+                sum += v;
+                ++received;
+            }
+            producer.join();
+            REQUIRE(received == N);
+            REQUIRE(sum == N * (N - 1) / 2);
+        }
+    }
+}
+
+TEST_CASE("QueueNotifier eventfd is pollable", "[memory][notifier]") {
+    memory::QueueNotifier notifier{memory::QueueNotifier::Mode::EventFd};
+#if defined(__linux__)
+    REQUIRE(notifier.mode() == memory::QueueNotifier::Mode::EventFd);
+    REQUIRE(notifier.fd() >= 0);
+#endif
+    REQUIRE_FALSE(notifier.drain());
+
+    notifier.prepare_wait();
+    notifier.notify();
+    REQUIRE_FALSE(notifier.sleeping());
+    REQUIRE(notifier.signals() == 1);
+#if defined(__linux__)
+    REQUIRE(notifier.drain());       // What an io_uring POLL_ADD completion would consume
+#endif
+    REQUIRE_FALSE(notifier.drain());
+
+    notifier.notify();               // Not sleeping: no signal
+    REQUIRE(notifier.signals() == 1);
+}
+
+// ============================================================================
+// Deferred Byte Ring Tests
+// ============================================================================
+
+TEST_CASE("DeferredByteRing variable-length records", "[memory][queue][deferred]") {
+    util::DeferredByteRing ring{4096};
+    REQUIRE(ring.capacity() == 4096);
+
+    std::array<char, 400> payload{};
+    for (size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<char>(i);
+
+    SECTION("Records cost their size rounded to a cache line") {
+        REQUIRE(util::DeferredByteRing::record_size(90) == 128);
+        REQUIRE(ring.try_write({payload.data(), 90}, 7));
+        REQUIRE(ring.bytes_used() == 128);
+
+        size_t seen = 0;
+        REQUIRE(ring.consume([&](const util::DeferredRecordView& record) {
+            REQUIRE(record.timestamp == 7);
+            REQUIRE(record.size == 90);
+            REQUIRE(std::memcmp(record.data, payload.data(), 90) == 0);
+            ++seen;
+        }) == 1);
+        REQUIRE(seen == 1);
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Wrap-around keeps every record contiguous and in order") {
+        uint64_t written = 0;
+        uint64_t read = 0;
+        for (uint64_t round = 0; round < 2000; ++round) {
+            const size_t size = (round * 37) % payload.size();
+            if (ring.try_write({payload.data(), size}, written)) ++written;
+            ring.consume([&](const util::DeferredRecordView& record) {
+                REQUIRE(record.timestamp == read);
+                REQUIRE(std::memcmp(record.data, payload.data(), record.size) == 0);
+                ++read;
+            }, round % 3);
+        }
+        ring.consume([&](const util::DeferredRecordView&) { ++read; });
+        REQUIRE(written > 1000);
+        REQUIRE(read == written);
+    }
+
+    SECTION("Full ring and oversized records are rejected") {
+        std::array<char, 2048> large{};
+        REQUIRE_FALSE(ring.try_write(large, 0));
+
+        size_t accepted = 0;
+        while (ring.try_write({payload.data(), 100}, 0)) ++accepted;
+        REQUIRE(accepted == 4096 / util::DeferredByteRing::record_size(100));
+    }
+
+    SECTION("In-place reserve and publish") {
+        char* dest = ring.try_reserve(256);
+        REQUIRE(dest != nullptr);
+        std::memcpy(dest, "8=FIX.4.4", 9);
+        ring.publish(9, 42);
+        REQUIRE(ring.consume([](const util::DeferredRecordView& record) {
+            REQUIRE(std::string_view{record.data, record.size} == "8=FIX.4.4");
+        }) == 1);
+    }
+}
+
+TEST_CASE("DeferredByteProcessor drains on stop", "[memory][queue][deferred]") {
+    util::DeferredByteProcessor processor{64 * 1024};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> messages{0};
+    REQUIRE(processor.start_batch([&](std::span<const util::DeferredRecordView> batch) {
+        for (const auto& record : batch) bytes += record.size;
+        messages += batch.size();
+    }, 16));
+
+    std::array<char, 300> payload{};
+    uint64_t sent = 0;
+    for (size_t i = 0; i < 20000; ++i) {
+        processor.submit_blocking({payload.data(), i % payload.size()});
+        sent += i % payload.size();
+    }
+    processor.stop();
+
+    REQUIRE(messages == 20000);
+    REQUIRE(bytes == sent);
+    REQUIRE(processor.stats().messages_processed == 20000);
+    REQUIRE(processor.queue_empty());
+}
+
+// ============================================================================
+// Sharded Counter Tests
+// ============================================================================
+
+TEST_CASE("ShardedCounters sum per-thread shards", "[memory][counters]") {
+    enum : size_t { EVENTS, BYTES, COUNTERS };
+    auto counters = std::make_unique<util::ShardedCounters<COUNTERS>>();
+
+    SECTION("Concurrent writers and a reader") {
+        constexpr size_t THREADS = 4;
+        constexpr uint64_t ADDS = 100000;
+        std::atomic<bool> done{false};
+        bool monotonic = true;
+        std::thread reader([&] {
+            uint64_t last = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                const uint64_t now = counters->value(EVENTS);
+                monotonic = monotonic && now >= last;   // Never torn or going backwards
+                last = now;
+            }
+        });
+        std::vector<std::thread> writers;
+        for (size_t t = 0; t < THREADS; ++t) {
+            writers.emplace_back([&] {
+                for (uint64_t i = 0; i < ADDS; ++i) {
+                    counters->add(EVENTS);
+                    counters->add(BYTES, 3);
+                }
+            });
+        }
+        for (auto& w : writers) w.join();
+        done = true;
+        reader.join();
+
+        REQUIRE(monotonic);
+        const auto totals = counters->snapshot();
+        REQUIRE(totals[EVENTS] == THREADS * ADDS);
+        REQUIRE(totals[BYTES] == 3 * THREADS * ADDS);
+    }
+
+    SECTION("Reset keeps counting from zero") {
+        counters->add(EVENTS, 5);
+        counters->reset();
+        REQUIRE(counters->value(EVENTS) == 0);
+        counters->add(EVENTS, 2);
+        REQUIRE(counters->value(EVENTS) == 2);
+        REQUIRE(counters->value(BYTES) == 0);
+    }
+
+    SECTION("Threads past MAX_THREAD_SHARDS share the overflow shard") {
+        constexpr size_t THREADS = util::MAX_THREAD_SHARDS + 8;
+        std::atomic<size_t> started{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> writers;
+        for (size_t t = 0; t < THREADS; ++t) {
+            writers.emplace_back([&] {
+                (void)util::this_thread_shard();   // Hold a shard while others start
+                ++started;
+                while (!go.load()) std::this_thread::yield();
+                for (int i = 0; i < 1000; ++i) counters->add(EVENTS);
+            });
+        }
+        while (started.load() < THREADS) std::this_thread::yield();
+        go = true;
+        for (auto& w : writers) w.join();
+        REQUIRE(counters->value(EVENTS) == THREADS * 1000);
+    }
+}
+
+// ============================================================================
+// Work-Stealing Tests
+// ============================================================================
+
+TEST_CASE("WorkStealingDeque owner and thief ends", "[memory][queue][steal]") {
+    memory::WorkStealingDeque<uint32_t, 8> deque;
+    uint32_t v = 0;
+    REQUIRE_FALSE(deque.pop(v));
+    REQUIRE_FALSE(deque.steal(v));
+
+    for (uint32_t i = 0; i < 8; ++i) REQUIRE(deque.push(i));
+    REQUIRE(deque.full());
+    REQUIRE_FALSE(deque.push(8));
+
+    REQUIRE(deque.pop(v));       // Owner: newest
+    REQUIRE(v == 7);
+    REQUIRE(deque.steal(v));     // Thief: oldest
+    REQUIRE(v == 0);
+    REQUIRE(deque.size_approx() == 6);
+
+    SECTION("Concurrent thieves take every element exactly once") {
+        auto big = std::make_unique<memory::WorkStealingDeque<uint32_t, 1024>>();
+        constexpr uint32_t N = 100000;
+        std::atomic<bool> done{false};
+        std::atomic<uint64_t> stolen_sum{0};
+        std::atomic<uint64_t> stolen_count{0};
+
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < 2; ++t) {
+            thieves.emplace_back([&] {
+                uint32_t item = 0;
+                while (!done.load(std::memory_order_acquire) || !big->empty()) {
+                    if (big->steal(item)) {
+                        stolen_sum += item;
+                        ++stolen_count;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        uint64_t own_sum = 0;
+        uint64_t own_count = 0;
+        uint32_t item = 0;
+        for (uint32_t i = 0; i < N; ++i) {
+            while (!big->push(i)) {
+                if (big->pop(item)) {
+                    own_sum += item;
+                    ++own_count;
+                }
+            }
+            if (i % 3 == 0 && big->pop(item)) {
+                own_sum += item;
+                ++own_count;
+            }
+        }
+        while (big->pop(item)) {
+            own_sum += item;
+            ++own_count;
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& t : thieves) t.join();
+
+        REQUIRE(own_count + stolen_count == N);
+        REQUIRE(own_sum + stolen_sum == uint64_t{N} * (N - 1) / 2);
+    }
+}
+
+TEST_CASE("DeferredWorkerPool keyed ordering and stealing", "[memory][queue][steal]") {
+    struct Job {
+        uint32_t key;
+        uint32_t seq;
+    };
+
+    constexpr uint32_t KEYS = 8;
+    constexpr uint32_t PER_KEY = 2000;
+    std::array<std::atomic<uint32_t>, KEYS> next_seq{};
+    std::atomic<uint32_t> out_of_order{0};
+    std::atomic<uint64_t> unkeyed{0};
+
+    auto handler = [&](const Job& job, size_t) {
+        if (job.key == UINT32_MAX) {
+            ++unkeyed;
+            return;
+        }
+        if (next_seq[job.key].load(std::memory_order_relaxed) != job.seq) ++out_of_order;
+        next_seq[job.key].store(job.seq + 1, std::memory_order_relaxed);
+    };
+
+    util::DeferredWorkerPool<Job, decltype(handler), 1024> pool{handler, 3};
+    REQUIRE(pool.worker_count() == 3);
+    REQUIRE(pool.start());
+
+    for (uint32_t seq = 0; seq < PER_KEY; ++seq) {
+        for (uint32_t key = 0; key < KEYS; ++key) {
+            while (!pool.submit_keyed(key, Job{key, seq})) std::this_thread::yield();
+            while (!pool.submit(Job{UINT32_MAX, 0})) std::this_thread::yield();
+        }
+    }
+    pool.stop();
+
+    const auto stats = pool.stats();
+    REQUIRE(out_of_order == 0);
+    REQUIRE(unkeyed == KEYS * PER_KEY);
+    for (uint32_t key = 0; key < KEYS; ++key) REQUIRE(next_seq[key] == PER_KEY);
+    REQUIRE(stats.messages_processed == 2 * KEYS * PER_KEY);
+    REQUIRE(stats.messages_submitted == stats.messages_processed);
+}
+
+// ============================================================================
+// Shared-Memory Transport Tests
+// ============================================================================
+
+#if NFX_PLATFORM_LINUX
+
+namespace {
+
+std::string shm_test_path(const char* name) {
+    const std::filesystem::path dir =
+        std::filesystem::exists("/dev/shm") ? "/dev/shm" : std::filesystem::temp_directory_path();
+    return (dir / ("nfx-test-" + std::to_string(::getpid()) + "-" + name)).string();
+}
+
+}  // namespace
+
+TEST_CASE("ShmTransport connects and exchanges bytes", "[transport][shm]") {
+    const std::string path = shm_test_path("basic");
+    ShmTransport gateway{ShmTransportConfig{.ring_bytes = 4096}};
+    ShmTransport strategy;
+
+    REQUIRE_FALSE(strategy.connect(path, 0).has_value());  // No listener yet
+    REQUIRE(gateway.listen(path).has_value());
+    REQUIRE_FALSE(gateway.peer_attached());
+    REQUIRE(strategy.connect(path, 0).has_value());
+    REQUIRE(gateway.peer_attached());
+    REQUIRE(strategy.ring_bytes() == 4096);
+    REQUIRE(strategy.is_connected());
+
+    ShmTransport second;
+    REQUIRE_FALSE(second.connect(path, 0).has_value());   // One client per segment
+
+    const std::string_view logon = "8=FIX.4.4\x01" "9=5\x01" "35=A\x01" "10=000\x01";
+    REQUIRE(strategy.send(logon).value() == logon.size());
+
+    char buf[256];
+    auto n = gateway.receive(buf);
+    REQUIRE(n.has_value());
+    REQUIRE(std::string_view{buf, *n} == logon);
+    REQUIRE(gateway.try_receive(buf).value() == 0);
+
+    REQUIRE(gateway.send(std::string_view{"reply"}).has_value());
+    n = strategy.receive(buf);
+    REQUIRE(std::string_view{buf, *n} == "reply");
+
+    SECTION("Peer close drains, then reports ConnectionClosed") {
+        REQUIRE(strategy.send(std::string_view{"last"}).has_value());
+        strategy.disconnect();
+        REQUIRE_FALSE(gateway.is_connected());
+        n = gateway.receive(buf);
+        REQUIRE(std::string_view{buf, *n} == "last");
+        n = gateway.receive(buf);
+        REQUIRE_FALSE(n.has_value());
+        REQUIRE(n.error().code == TransportErrorCode::ConnectionClosed);
+        REQUIRE_FALSE(gateway.send(std::string_view{"x"}).has_value());
+    }
+
+    SECTION("Receive times out empty") {
+        REQUIRE(gateway.set_receive_timeout(5));
+        REQUIRE(gateway.receive(buf).value() == 0);
+    }
+
+    gateway.disconnect();
+    REQUIRE_FALSE(std::filesystem::exists(path));  // unlink_on_close
+}
+
+TEST_CASE("ShmTransport streams through a wrapping ring", "[transport][shm]") {
+    const std::string path = shm_test_path("stream");
+    // spin_us = 0: the reader parks on the futex whenever the ring is empty
+    ShmTransport gateway{ShmTransportConfig{.ring_bytes = 4096, .spin_us = 0}};
+    ShmTransport strategy{ShmTransportConfig{.spin_us = 0}};
+    REQUIRE(gateway.listen(path).has_value());
+    REQUIRE(strategy.connect(path, 0).has_value());
+
+    constexpr size_t TOTAL = 1 << 20;   // 256 laps of the ring
+    std::thread writer([&] {
+        std::array<char, 1000> chunk;
+        size_t sent = 0;
+        while (sent < TOTAL) {
+            const size_t len = std::min(chunk.size(), TOTAL - sent);
+            for (size_t i = 0; i < len; ++i) chunk[i] = static_cast<char>((sent + i) * 31 % 251);
+            auto r = strategy.send(std::span<const char>{chunk.data(), len});
+            if (!r) break;
+            sent += *r;
+            if (sent % 100'000 < 1000) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    size_t received = 0;
+    size_t mismatches = 0;
+    char buf[1500];
+    while (received < TOTAL) {
+        auto n = gateway.receive(buf);
+        if (!n || *n == 0) break;
+        for (size_t i = 0; i < *n; ++i) {
+            if (buf[i] != static_cast<char>((received + i) * 31 % 251)) ++mismatches;
+        }
+        received += *n;
+    }
+    writer.join();
+
+    REQUIRE(received == TOTAL);
+    REQUIRE(mismatches == 0);
+}
+
+#endif  // NFX_PLATFORM_LINUX
@@ -2,12 +2,24 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <string>
 #include <cstring>
+#include <vector>
 
 #include "nexusfix/parser/field_view.hpp"
 #include "nexusfix/parser/simd_scanner.hpp"
 #include "nexusfix/parser/consteval_parser.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
 #include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/tag_decoder.hpp"
+#include "nexusfix/parser/decimal_decoder.hpp"
+#include "nexusfix/parser/schema_parser.hpp"
+#include "nexusfix/parser/data_dictionary.hpp"
+#include "nexusfix/parser/message_reassembler.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/serializer/exec_report_template.hpp"
+#include "nexusfix/serializer/order_template.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 
 using namespace nfx;
@@ -110,6 +122,113 @@ TEST_CASE("FieldView basic operations", "[parser][field_view]") {
     }
 }
 
+// ============================================================================
+// Tag Decoder Tests
+// ============================================================================
+
+TEST_CASE("Tag decoder variants", "[parser][tag_decoder]") {
+    SECTION("All variants agree on 1-8 digit tags") {
+        const std::string buf = "8=35=150=9030=10001=123456=1234567=12345678=";
+        std::span<const char> data{buf.data(), buf.size()};
+        const int expected[] = {8, 35, 150, 9030, 10001, 123456, 1234567, 12345678};
+
+        size_t start = 0;
+        size_t n = 0;
+        for (size_t i = 0; i < buf.size(); ++i) {
+            if (buf[i] != '=') continue;
+            const size_t len = i - start;
+            REQUIRE(parser::decode_tag_scalar(buf.data() + start, len) == expected[n]);
+            REQUIRE(parser::decode_tag_swar(data, start, len) == expected[n]);
+#if defined(NFX_SSE41_TAG_DECODE)
+            REQUIRE(parser::decode_tag_sse41(data, start, len) == expected[n]);
+#endif
+            REQUIRE(parser::decode_tag(data, start, len) == expected[n]);
+            start = i + 1;
+            ++n;
+        }
+        REQUIRE(n == 8);
+    }
+
+    SECTION("Tag at end of buffer does not overread") {
+        const std::string buf = "xxxxxxxx9030";
+        std::span<const char> data{buf.data(), buf.size()};
+        REQUIRE(parser::decode_tag_swar(data, 8, 4) == 9030);
+        REQUIRE(parser::decode_tag(data, 8, 4) == 9030);
+
+        const std::string tiny = "5001";
+        REQUIRE(parser::decode_tag(std::span<const char>{tiny.data(), tiny.size()}, 0, 4) == 5001);
+    }
+
+    SECTION("Invalid digits rejected") {
+        const std::string buf = "12a4=1:=9/=";
+        std::span<const char> data{buf.data(), buf.size()};
+        REQUIRE(parser::decode_tag_swar(data, 0, 4) == parser::INVALID_TAG);
+        REQUIRE(parser::decode_tag(data, 0, 4) == parser::INVALID_TAG);
+        REQUIRE(parser::decode_tag(data, 5, 2) == parser::INVALID_TAG);
+        REQUIRE(parser::decode_tag(data, 8, 2) == parser::INVALID_TAG);
+        REQUIRE(parser::decode_tag_scalar("1234567890", 10) == parser::INVALID_TAG);
+    }
+
+    SECTION("Usable in constant expressions") {
+        constexpr std::string_view tag = "9030";
+        static_assert(parser::decode_tag(std::span<const char>{tag.data(), tag.size()}, 0, 4) == 9030);
+    }
+}
+
+// ============================================================================
+// Batch Decimal Decoder Tests
+// ============================================================================
+
+TEST_CASE("Batch decimal decoder", "[parser][decimal_decoder]") {
+    const std::vector<std::string> texts = {
+        "0", "1", "150.25", "150.2575", "-42.5", "99999999", "12345678.87654321",
+        ".5", "7.", "-", "", "0.00000001", "1.123456789", "123456789012.3456",
+        "1234567890123456", "12a.5", "1.2.3", "1e5", "00000000000000001.5"
+    };
+    std::vector<FieldView> fields;
+    for (const auto& t : texts) fields.emplace_back(270, t.data(), t.size());
+
+    SECTION("Prices match as_price() for every input") {
+        std::vector<FixedPrice> out(fields.size());
+        REQUIRE(parser::decode_prices(fields, out) == fields.size());
+        for (size_t i = 0; i < fields.size(); ++i) {
+            INFO(texts[i]);
+            REQUIRE(out[i] == fields[i].as_price());
+        }
+        REQUIRE(out[2].raw == 15025000000LL);
+        REQUIRE(out[4].raw == -4250000000LL);
+    }
+
+    SECTION("Quantities match as_qty() for every input") {
+        std::vector<std::span<const char>> values;
+        for (const auto& f : fields) values.push_back(f.value);
+        std::vector<Qty> out(values.size());
+        REQUIRE(parser::decode_qtys(values, out) == values.size());
+        for (size_t i = 0; i < fields.size(); ++i) {
+            INFO(texts[i]);
+            REQUIRE(out[i] == fields[i].as_qty());
+        }
+        REQUIRE(out[13].raw == 1234567890123456LL);
+    }
+
+    SECTION("Output size bounds the batch") {
+        std::array<FixedPrice, 3> out{};
+        REQUIRE(parser::decode_prices(fields, out) == 3);
+        REQUIRE(out[1].raw == 100000000LL);
+    }
+
+    SECTION("Value at the end of a page is not over-read") {
+        alignas(4096) static char page[2 * 4096];
+        std::memset(page, '9', sizeof(page));
+        char* tail = page + 4096 - 6;
+        std::memcpy(tail, "101.25", 6);
+        const std::array<FieldView, 1> one{FieldView{270, tail, 6}};
+        std::array<FixedPrice, 1> out{};
+        REQUIRE(parser::decode_prices(one, out) == 1);
+        REQUIRE(out[0].raw == 10125000000LL);
+    }
+}
+
 // ============================================================================
 // FieldIterator Tests
 // ============================================================================
@@ -166,6 +285,59 @@ TEST_CASE("FieldTable O(1) lookup", "[parser][field_view]") {
     }
 }
 
+TEST_CASE("HashedFieldTable perfect-hash lookup", "[parser][field_view]") {
+    SECTION("Known tags map to distinct slots") {
+        std::array<bool, tag::KNOWN_TAG_SLOTS> used{};
+        for (int t : tag::KNOWN_TAGS) {
+            size_t slot = tag::known_tag_slot(t);
+            REQUIRE(slot < tag::KNOWN_TAG_SLOTS);
+            REQUIRE(!used[slot]);
+            used[slot] = true;
+        }
+        REQUIRE(tag::known_tag_slot(0) == tag::UNKNOWN_TAG_SLOT);
+        REQUIRE(tag::known_tag_slot(-5) == tag::UNKNOWN_TAG_SLOT);
+        REQUIRE(tag::known_tag_slot(9001) == tag::UNKNOWN_TAG_SLOT);
+    }
+
+    HashedFieldTable table;
+    const char* sym = "AAPL";
+    const char* qty = "100";
+    const char* custom = "VENUE";
+
+    REQUIRE(table.set(55, std::span<const char>{sym, 4}));
+    REQUIRE(table.set(38, std::span<const char>{qty, 3}));
+    REQUIRE(table.set(9001, std::span<const char>{custom, 5}));
+
+    SECTION("Known and overflow tags") {
+        REQUIRE(table.get_string(55) == "AAPL");
+        REQUIRE(table.get_int(38) == 100);
+        REQUIRE(table.get_string(9001) == "VENUE");
+        REQUIRE(table.overflow_count() == 1);
+    }
+
+    SECTION("Absent tags") {
+        REQUIRE(!table.has(11));
+        REQUIRE(!table.has(999));
+        REQUIRE(table.get_string(0) == "");
+        REQUIRE(!table.set(0, std::span<const char>{sym, 4}));
+    }
+
+    SECTION("Repeated tag overwrites") {
+        REQUIRE(table.set(55, std::span<const char>{custom, 5}));
+        REQUIRE(table.set(9001, std::span<const char>{sym, 4}));
+        REQUIRE(table.get_string(55) == "VENUE");
+        REQUIRE(table.get_string(9001) == "AAPL");
+        REQUIRE(table.overflow_count() == 1);
+    }
+
+    SECTION("Clear") {
+        table.clear();
+        REQUIRE(!table.has(55));
+        REQUIRE(!table.has(9001));
+        REQUIRE(table.overflow_count() == 0);
+    }
+}
+
 // ============================================================================
 // SIMD Scanner Tests
 // ============================================================================
@@ -204,6 +376,25 @@ TEST_CASE("SIMD SOH scanning", "[parser][simd]") {
 
         REQUIRE(count == 19);  // Number of fields
     }
+
+#if NFX_NEON_AVAILABLE
+    SECTION("NEON scanner matches scalar") {
+        std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+        auto expected = simd::scan_soh_scalar(data);
+        auto neon = simd::scan_soh_neon(data);
+
+        REQUIRE(neon.count == expected.count);
+        REQUIRE(neon.positions == expected.positions);
+        REQUIRE(simd::find_soh_neon(data, 10) == simd::find_soh_scalar(data, 10));
+        REQUIRE(simd::find_equals_neon(data, 10) == simd::find_equals_scalar(data, 10));
+        REQUIRE(simd::count_soh_neon(data) == 19);
+#if NFX_SVE_AVAILABLE
+        REQUIRE(simd::find_soh_sve(data, 10) == simd::find_soh_scalar(data, 10));
+        REQUIRE(simd::find_equals_sve(data, 10) == simd::find_equals_scalar(data, 10));
+        REQUIRE(simd::count_soh_sve(data) == 19);
+#endif
+    }
+#endif
 }
 
 // ============================================================================
@@ -242,6 +433,103 @@ TEST_CASE("Header parsing", "[parser][consteval]") {
         REQUIRE(!result.ok());
         REQUIRE(result.error.code == ParseErrorCode::BufferTooShort);
     }
+
+    SECTION("Version fixed at compile time") {
+        const std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+
+        auto fix44 = parse_header<FixVersion::FIX_4_4>(data);
+        REQUIRE(fix44.ok());
+        REQUIRE(fix44.header.begin_string == "FIX.4.4");
+        REQUIRE(fix44.header.msg_seq_num == 1);
+        REQUIRE(fix44.header.sender_comp_id == parse_header(data).header.sender_comp_id);
+
+        auto fixt = parse_header<FixVersion::FIX_5_0_SP2>(data);
+        REQUIRE(!fixt.ok());
+        REQUIRE(fixt.error.code == ParseErrorCode::InvalidBeginString);
+
+        ParsedMessage msg;
+        REQUIRE(ParsedMessage::parse_into<FixVersion::FIX_4_4>(data, msg).code == ParseErrorCode::None);
+        REQUIRE(msg.get_string(37) == "ORDER123");
+    }
+}
+
+TEST_CASE("HeaderLayoutPredictor speculative header", "[parser][header]") {
+    auto build = [](std::string_view type, std::string_view sender, int64_t seq,
+                    std::string_view extra_tag_43 = {}) {
+        MessageAssembler assembler;
+        assembler.start()
+            .field(tag::MsgType::value, type)
+            .field(tag::SenderCompID::value, sender)
+            .field(tag::TargetCompID::value, "CLIENT")
+            .field(tag::MsgSeqNum::value, seq);
+        if (!extra_tag_43.empty()) assembler.field(tag::PossDupFlag::value, extra_tag_43);
+        auto msg = assembler
+            .field(tag::SendingTime::value, "20231215-10:30:00.000")
+            .field(tag::Symbol::value, "AAPL")
+            .finish();
+        return std::string{msg.data(), msg.size()};
+    };
+
+    auto same_as_generic = [](HeaderLayoutPredictor& predictor, const std::string& msg) {
+        std::span<const char> data{msg.data(), msg.size()};
+        auto fast = predictor.parse(data);
+        auto slow = parse_header(data);
+        REQUIRE(fast.error.code == slow.error.code);
+        REQUIRE(fast.error.tag == slow.error.tag);
+        REQUIRE(fast.body_start == slow.body_start);
+        REQUIRE(fast.header.begin_string == slow.header.begin_string);
+        REQUIRE(fast.header.body_length == slow.header.body_length);
+        REQUIRE(fast.header.msg_type == slow.header.msg_type);
+        REQUIRE(fast.header.sender_comp_id == slow.header.sender_comp_id);
+        REQUIRE(fast.header.target_comp_id == slow.header.target_comp_id);
+        REQUIRE(fast.header.msg_seq_num == slow.header.msg_seq_num);
+        REQUIRE(fast.header.sending_time == slow.header.sending_time);
+    };
+
+    HeaderLayoutPredictor predictor;
+
+    SECTION("Hits after the first message") {
+        same_as_generic(predictor, build("8", "BROKER", 1));
+        REQUIRE(predictor.has_layout());
+        same_as_generic(predictor, build("8", "BROKER", 99));
+        same_as_generic(predictor, build("AE", "BROKER", 123456));
+        same_as_generic(predictor, build("0", "BROKER", 7));
+        REQUIRE(predictor.misses() == 1);
+        REQUIRE(predictor.hits() == 3);
+    }
+
+    SECTION("Mismatch falls back and re-learns") {
+        same_as_generic(predictor, build("8", "BROKER", 1));
+        same_as_generic(predictor, build("8", "OTHER", 2));   // CompID changed
+        same_as_generic(predictor, build("8", "OTHER", 3));
+        REQUIRE(predictor.hits() == 1);
+
+        // 43 inside the header block: generic parse, layout kept
+        same_as_generic(predictor, build("8", "OTHER", 4, "Y"));
+        REQUIRE(predictor.misses() == 3);
+        same_as_generic(predictor, build("8", "OTHER", 5));
+        REQUIRE(predictor.hits() == 2);
+    }
+
+    SECTION("Malformed input matches parse_header errors") {
+        same_as_generic(predictor, build("8", "BROKER", 1));
+        std::string bad_seq = build("8", "BROKER", 5);
+        bad_seq[bad_seq.find("\x01" "34=") + 4] = 'X';
+        same_as_generic(predictor, bad_seq);
+        same_as_generic(predictor, build("8", "BROKER", 0));
+        same_as_generic(predictor, std::string{"8=FIX"});
+    }
+
+    SECTION("ParsedMessage with predictor") {
+        std::string msg = build("8", "BROKER", 42);
+        for (int i = 0; i < 2; ++i) {
+            auto result = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()}, predictor);
+            REQUIRE(result.has_value());
+            REQUIRE(result->msg_seq_num() == 42);
+            REQUIRE(result->get_string(tag::Symbol::value) == "AAPL");
+        }
+        REQUIRE(predictor.hits() == 1);
+    }
 }
 
 // ============================================================================
@@ -283,6 +571,352 @@ TEST_CASE("ParsedMessage", "[parser][runtime]") {
     }
 }
 
+TEST_CASE("ParsedMessage single-pass structural parse", "[parser][runtime][structural]") {
+    SECTION("Matches generic parse") {
+        for (const std::string* m : {&EXEC_REPORT, &LOGON, &HEARTBEAT}) {
+            std::span<const char> data{m->data(), m->size()};
+            auto generic = ParsedMessage::parse(data);
+            auto fused = ParsedMessage::parse_structural(data);
+
+            REQUIRE(generic.has_value());
+            REQUIRE(fused.has_value());
+            REQUIRE(fused->field_count() == generic->field_count());
+            for (size_t i = 0; i < generic->field_count(); ++i) {
+                REQUIRE(fused->field_at(i).tag == generic->field_at(i).tag);
+                REQUIRE(fused->field_at(i).as_string() == generic->field_at(i).as_string());
+            }
+            REQUIRE(fused->msg_type() == generic->msg_type());
+            REQUIRE(fused->msg_seq_num() == generic->msg_seq_num());
+            REQUIRE(fused->sender_comp_id() == generic->sender_comp_id());
+            REQUIRE(fused->sending_time() == generic->sending_time());
+        }
+    }
+
+    SECTION("Equals sign inside value") {
+        std::string body =
+            "8=FIX.4.4\x01" "9=40\x01" "35=8\x01" "49=SENDER\x01" "56=TARGET\x01"
+            "34=2\x01" "52=20231215-10:30:00\x01" "58=a=b=c\x01" "55=AAPL\x01";
+        auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+        std::string msg = body + "10=" + std::string{cs.data(), 3} + "\x01";
+
+        auto result = ParsedMessage::parse_structural(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(result.has_value());
+        REQUIRE(result->get_string(58) == "a=b=c");
+        REQUIRE(result->get_string(55) == "AAPL");
+    }
+
+    SECTION("Bad checksum rejected") {
+        std::string bad = EXEC_REPORT;
+        bad[bad.size() - 2] = (bad[bad.size() - 2] == '9') ? '0' : '9';
+        auto result = ParsedMessage::parse_structural(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidChecksum);
+    }
+
+    SECTION("Checksum taken from the index") {
+        // 110= and 210= end in "10=" like the trailer the index looks for
+        std::string body =
+            "8=FIX.4.4\x01" "9=50\x01" "35=8\x01" "49=SENDER\x01" "56=TARGET\x01"
+            "34=2\x01" "52=20231215-10:30:00\x01" "110=100\x01" "55=AAPL\x01" "210=5\x01";
+        auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+        std::string msg = body + "10=" + std::string{cs.data(), 3} + "\x01";
+        const std::span<const char> data{msg.data(), msg.size()};
+
+        auto idx = simd::build_index_with_checksum(data);
+        REQUIRE(idx.checksum_start == body.size());
+        REQUIRE(idx.computed_checksum == fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+
+        auto result = ParsedMessage::parse_structural(data);
+        REQUIRE(result.has_value());
+        REQUIRE(result->get_string(110) == "100");
+        REQUIRE(validate_checksum_indexed(data, body.size(), idx).code == ParseErrorCode::None);
+
+        // A body byte changed after framing is caught by the indexed sum
+        std::string bad = msg;
+        bad[bad.find("AAPL")] = 'B';
+        auto rejected = ParsedMessage::parse_structural(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!rejected.has_value());
+        REQUIRE(rejected.error().code == ParseErrorCode::InvalidChecksum);
+    }
+
+    SECTION("Invalid tag rejected") {
+        std::string bad = EXEC_REPORT;
+        bad[bad.find("55=")] = 'X';
+        auto result = ParsedMessage::parse_structural(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidTagNumber);
+    }
+}
+
+TEST_CASE("Parsing into caller-owned messages", "[parser][runtime]") {
+    const std::span<const char> exec{EXEC_REPORT.data(), EXEC_REPORT.size()};
+    const std::span<const char> heartbeat{HEARTBEAT.data(), HEARTBEAT.size()};
+
+    SECTION("ParsedMessage::parse_into reuses one message") {
+        ParsedMessage msg;
+        REQUIRE(ParsedMessage::parse_into(exec, msg).code == ParseErrorCode::None);
+        REQUIRE(msg.msg_type() == '8');
+        REQUIRE(msg.get_string(17) == "EXEC456");
+
+        REQUIRE(ParsedMessage::parse_into(heartbeat, msg).code == ParseErrorCode::None);
+        REQUIRE(msg.msg_type() == '0');
+        REQUIRE(msg.raw().data() == heartbeat.data());
+        REQUIRE_FALSE(msg.has_field(17));
+        REQUIRE(msg.field_count() == ParsedMessage::parse(heartbeat)->field_count());
+
+        std::string corrupt = HEARTBEAT;
+        corrupt[corrupt.size() - 2] = corrupt[corrupt.size() - 2] == '0' ? '1' : '0';
+        REQUIRE(ParsedMessage::parse_into(
+                    std::span<const char>{corrupt.data(), corrupt.size()}, msg).code ==
+                ParseErrorCode::InvalidChecksum);
+    }
+
+    SECTION("IndexedParser::parse_into clears the previous fields") {
+        IndexedParser parser;
+        REQUIRE(IndexedParser::parse_into(exec, parser).code == ParseErrorCode::None);
+        REQUIRE(parser.get_string(17) == "EXEC456");
+
+        REQUIRE(IndexedParser::parse_into(heartbeat, parser).code == ParseErrorCode::None);
+        REQUIRE(parser.msg_type() == '0');
+        REQUIRE_FALSE(parser.has_field(17));
+    }
+}
+
+TEST_CASE("CompactParsedMessage 16-bit field entries", "[parser][runtime][compact]") {
+    SECTION("Matches ParsedMessage field for field") {
+        for (const std::string* m : {&EXEC_REPORT, &LOGON, &HEARTBEAT}) {
+            std::span<const char> data{m->data(), m->size()};
+            auto full = ParsedMessage::parse(data);
+            auto compact = CompactParsedMessage::parse(data);
+            REQUIRE(full.has_value());
+            REQUIRE(compact.has_value());
+
+            REQUIRE(compact->field_count() == full->field_count());
+            REQUIRE(compact->msg_type() == full->msg_type());
+            REQUIRE(compact->msg_seq_num() == full->msg_seq_num());
+            REQUIRE(compact->sender_comp_id() == full->sender_comp_id());
+            REQUIRE(compact->sending_time() == full->sending_time());
+
+            size_t i = 0;
+            for (FieldView field : *compact) {
+                REQUIRE(field.tag == full->field_at(i).tag);
+                REQUIRE(field.value.data() == full->field_at(i).value.data());
+                REQUIRE(field.value.size() == full->field_at(i).value.size());
+                ++i;
+            }
+            REQUIRE(i == full->field_count());
+        }
+    }
+
+    SECTION("Typed accessors") {
+        auto msg = parse_compact(std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
+        REQUIRE(msg.has_value());
+        REQUIRE(msg->get_string(37) == "ORDER123");
+        REQUIRE(msg->get_char(54) == '1');
+        REQUIRE(msg->get_int(38) == 100);
+        REQUIRE(msg->get_price(44) == FixedPrice::from_double(150.50));
+        REQUIRE(msg->get_qty(151) == Qty::from_int(100));
+        REQUIRE_FALSE(msg->has_field(9999));
+        REQUIRE(msg->fields().size() * sizeof(CompactParsedMessage::Field) <= 4 * CACHE_LINE_SIZE);
+    }
+
+    SECTION("Compact copy of a ParsedMessage") {
+        auto full = ParsedMessage::parse(std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
+        REQUIRE(full.has_value());
+        CompactParsedMessage msg;
+        REQUIRE(CompactParsedMessage::from(*full, msg));
+        REQUIRE(msg.field_count() == full->field_count());
+        REQUIRE(msg.get_string(17) == "EXEC456");
+        REQUIRE(msg.header().msg_seq_num == 1);
+    }
+
+    SECTION("Tags beyond 16 bits are rejected") {
+        std::string body = "35=0\x01" "49=S\x01" "56=T\x01" "34=1\x01"
+                           "52=20231215-10:30:00\x01" "70000=X\x01";
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+        auto cs = fix::format_checksum(fix::calculate_checksum(std::span<const char>{msg.data(), msg.size()}));
+        msg += "10=" + std::string{cs.data(), 3} + "\x01";
+        std::span<const char> data{msg.data(), msg.size()};
+
+        REQUIRE(ParsedMessage::parse(data).has_value());
+        auto compact = CompactParsedMessage::parse(data);
+        REQUIRE_FALSE(compact.has_value());
+        REQUIRE(compact.error().code == ParseErrorCode::InvalidTagNumber);
+    }
+}
+
+TEST_CASE("LazyParsedMessage on-demand decoding", "[parser][runtime][lazy]") {
+    std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+
+    SECTION("Header decoded eagerly, body on demand") {
+        auto result = LazyParsedMessage::parse(data);
+        REQUIRE(result.has_value());
+        REQUIRE(result->msg_type() == '8');
+        REQUIRE(result->msg_seq_num() == 1);
+        REQUIRE(result->sender_comp_id() == "SENDER");
+        REQUIRE(result->field_count() == 19);
+        REQUIRE(result->decoded_count() == 7);
+
+        REQUIRE(result->get_char(39) == '0');
+        REQUIRE(result->decoded_count() == 11);
+
+        // Cached lookup does not decode further
+        REQUIRE(result->get_string(39) == "0");
+        REQUIRE(result->decoded_count() == 11);
+
+        REQUIRE(result->get_string(37) == "ORDER123");
+        REQUIRE(result->decoded_count() == 11);
+    }
+
+    SECTION("Matches generic parse") {
+        for (const std::string* m : {&EXEC_REPORT, &LOGON, &HEARTBEAT}) {
+            std::span<const char> d{m->data(), m->size()};
+            auto generic = ParsedMessage::parse(d);
+            auto lazy = LazyParsedMessage::parse(d);
+
+            REQUIRE(generic.has_value());
+            REQUIRE(lazy.has_value());
+            REQUIRE(lazy->field_count() == generic->field_count());
+            for (const auto& field : *generic) {
+                REQUIRE(lazy->get_string(field.tag) == field.as_string());
+            }
+            for (size_t i = 0; i < generic->field_count(); ++i) {
+                REQUIRE(lazy->field_at(i).tag == generic->field_at(i).tag);
+            }
+        }
+    }
+
+    SECTION("Missing tag decodes once and is cached") {
+        auto result = LazyParsedMessage::parse(data);
+        REQUIRE(result.has_value());
+        REQUIRE_FALSE(result->has_field(9999));
+        REQUIRE(result->decoded_count() == result->field_count());
+        REQUIRE(result->get_field(9999).tag == 0);
+    }
+
+    SECTION("Bad checksum rejected up front") {
+        std::string bad = EXEC_REPORT;
+        bad[bad.size() - 2] = (bad[bad.size() - 2] == '9') ? '0' : '9';
+        auto result = LazyParsedMessage::parse(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidChecksum);
+    }
+
+    SECTION("Unterminated message rejected") {
+        std::string bad = EXEC_REPORT.substr(0, EXEC_REPORT.size() - 1);
+        auto result = LazyParsedMessage::parse(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::UnterminatedField);
+    }
+
+    SECTION("Malformed body tag is skipped, not matched") {
+        std::string body =
+            "8=FIX.4.4\x01" "9=40\x01" "35=8\x01" "49=SENDER\x01" "56=TARGET\x01"
+            "34=2\x01" "52=20231215-10:30:00\x01" "5X=bad\x01" "55=AAPL\x01";
+        auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+        std::string msg = body + "10=" + std::string{cs.data(), 3} + "\x01";
+
+        auto result = LazyParsedMessage::parse(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(result.has_value());
+        REQUIRE(result->get_string(55) == "AAPL");
+        REQUIRE_FALSE(result->field_at(7).is_valid());
+    }
+}
+
+TEST_CASE("Schema-projected parse_as", "[parser][runtime][schema]") {
+    using FillSchema = MessageSchema<
+        FieldSpec<tag::OrderID::value>,
+        FieldSpec<tag::OrdStatus::value>,
+        FieldSpec<tag::Symbol::value>,
+        FieldSpec<tag::Price::value, FieldRequirement::Optional>,
+        FieldSpec<tag::LastPx::value, FieldRequirement::Optional>
+    >;
+    std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+
+    SECTION("Listed tags land in fixed slots") {
+        auto result = parse_as<FillSchema>(data);
+        REQUIRE(result.has_value());
+        REQUIRE(result->msg_type() == '8');
+        REQUIRE(result->sender_comp_id() == "SENDER");
+        REQUIRE(result->get_string<tag::OrderID::value>() == "ORDER123");
+        REQUIRE(result->get_char<tag::OrdStatus::value>() == '0');
+        REQUIRE(result->get_string<tag::Symbol::value>() == "AAPL");
+        REQUIRE(result->get_price<tag::Price::value>().to_double() == 150.50);
+        REQUIRE(result->has<tag::Price::value>());
+        REQUIRE_FALSE(result->has<tag::LastPx::value>());
+        REQUIRE_FALSE(result->get<tag::LastPx::value>().is_valid());
+    }
+
+    SECTION("Missing required field rejected") {
+        using StrictSchema = MessageSchema<
+            FieldSpec<tag::OrderID::value>,
+            FieldSpec<tag::LastQty::value>
+        >;
+        auto result = parse_as<StrictSchema>(data);
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(result.error().tag == tag::LastQty::value);
+    }
+
+    SECTION("Unexpected MsgType rejected before required fields") {
+        std::span<const char> hb{HEARTBEAT.data(), HEARTBEAT.size()};
+        auto result = parse_as<FillSchema>(hb, '8');
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidMsgType);
+    }
+
+    SECTION("Tags beyond the dense table use the compare chain") {
+        using CustomSchema = MessageSchema<
+            FieldSpec<tag::Symbol::value>,
+            FieldSpec<9001, FieldRequirement::Optional>
+        >;
+        std::string body =
+            "8=FIX.4.4\x01" "9=40\x01" "35=8\x01" "49=SENDER\x01" "56=TARGET\x01"
+            "34=2\x01" "52=20231215-10:30:00\x01" "55=AAPL\x01" "9001=VENUE\x01";
+        auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+        std::string msg = body + "10=" + std::string{cs.data(), 3} + "\x01";
+
+        auto result = parse_as<CustomSchema>(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(result.has_value());
+        REQUIRE(result->get_string<9001>() == "VENUE");
+    }
+
+    SECTION("Bad checksum rejected") {
+        std::string bad = EXEC_REPORT;
+        bad[bad.size() - 2] = (bad[bad.size() - 2] == '9') ? '0' : '9';
+        auto result = parse_as<FillSchema>(std::span<const char>{bad.data(), bad.size()});
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidChecksum);
+    }
+
+    SECTION("ExecutionReport::from_buffer uses its schema") {
+        auto result = fix44::ExecutionReport::from_buffer(data);
+        REQUIRE(result.has_value());
+        REQUIRE(result->order_id == "ORDER123");
+        REQUIRE(result->exec_id == "EXEC456");
+        REQUIRE(result->symbol == "AAPL");
+        REQUIRE(result->side == Side::Buy);
+        REQUIRE(result->header.msg_seq_num == 1);
+
+        std::span<const char> logon{LOGON.data(), LOGON.size()};
+        auto wrong = fix44::ExecutionReport::from_buffer(logon);
+        REQUIRE(!wrong.has_value());
+        REQUIRE(wrong.error().code == ParseErrorCode::InvalidMsgType);
+    }
+}
+
 TEST_CASE("IndexedParser O(1) lookup", "[parser][runtime]") {
     auto result = IndexedParser::parse(
         std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
@@ -305,6 +939,53 @@ TEST_CASE("IndexedParser O(1) lookup", "[parser][runtime]") {
 
         REQUIRE(!parser.has_field(999));
     }
+
+    SECTION("Tags above 512 are kept") {
+        MessageAssembler assembler;
+        auto msg = assembler.start()
+            .field(tag::MsgType::value, 'A')
+            .field(tag::SenderCompID::value, "SENDER")
+            .field(tag::TargetCompID::value, "TARGET")
+            .field(tag::MsgSeqNum::value, int64_t{1})
+            .field(tag::SendingTime::value, "20231215-10:30:00.000")
+            .field(tag::DefaultApplVerID::value, "9")
+            .field(5001, "X")
+            .finish();
+        auto logon = IndexedParser::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(logon.has_value());
+        REQUIRE(logon->get_string(1137) == "9");
+        REQUIRE(logon->get_string(5001) == "X");
+    }
+
+    SECTION("More unknown tags than the overflow list holds") {
+        auto build = [](int unknown_tags) {
+            MessageAssembler assembler;
+            auto& builder = assembler.start()
+                .field(tag::MsgType::value, '8')
+                .field(tag::SenderCompID::value, "SENDER")
+                .field(tag::TargetCompID::value, "TARGET")
+                .field(tag::MsgSeqNum::value, int64_t{1})
+                .field(tag::SendingTime::value, "20231215-10:30:00.000");
+            for (int i = 0; i < unknown_tags; ++i) {
+                builder.field(5000 + i, "X");
+            }
+            auto msg = builder.finish();
+            return std::string{msg.data(), msg.size()};
+        };
+        constexpr int full = static_cast<int>(HashedFieldTable::OVERFLOW_CAPACITY);
+
+        auto fits = build(full);
+        auto at_capacity = IndexedParser::parse(std::span<const char>{fits.data(), fits.size()});
+        REQUIRE(at_capacity.has_value());
+        REQUIRE(at_capacity->get_string(5000 + full - 1) == "X");
+
+        auto spills = build(full + 1);
+        auto over = IndexedParser::parse(std::span<const char>{spills.data(), spills.size()});
+        REQUIRE(!over.has_value());
+        REQUIRE(over.error().code == ParseErrorCode::TooManyFields);
+        REQUIRE(over.error().tag == 5000 + full);
+        REQUIRE(parse_error_message(ParseErrorCode::TooManyFields) == "Too many fields");
+    }
 }
 
 // ============================================================================
@@ -384,6 +1065,181 @@ TEST_CASE("StreamParser message framing", "[parser][stream]") {
         REQUIRE(start == 0);
         REQUIRE(end == HEARTBEAT.size());
     }
+
+    SECTION("Burst beyond pending capacity is not dropped") {
+        std::string stream;
+        for (int i = 0; i < 20; ++i) stream += HEARTBEAT;
+
+        size_t consumed = parser.feed(std::span<const char>{stream.data(), stream.size()});
+        REQUIRE(consumed == 16 * HEARTBEAT.size());
+
+        for (size_t i = 0; i < 16; ++i) {
+            REQUIRE(parser.has_message());
+            auto [start, end] = parser.next_message();
+            REQUIRE(start == i * HEARTBEAT.size());
+            REQUIRE(end == (i + 1) * HEARTBEAT.size());
+        }
+        REQUIRE(!parser.has_message());
+
+        auto rest = std::span<const char>{stream.data() + consumed, stream.size() - consumed};
+        REQUIRE(parser.feed(rest) == 4 * HEARTBEAT.size());
+        auto [start, end] = parser.next_message();
+        REQUIRE(start == 0);
+        REQUIRE(end == HEARTBEAT.size());
+    }
+}
+
+// ============================================================================
+// Batch Parsing Tests
+// ============================================================================
+
+TEST_CASE("parse_batch frames and parses a receive buffer", "[parser][stream]") {
+    std::string stream;
+    std::vector<size_t> ends;
+    for (int seq = 1; seq <= 5; ++seq) {
+        MessageAssembler assembler;
+        auto msg = assembler.start()
+            .field(tag::MsgType::value, 'D')
+            .field(tag::SenderCompID::value, "CLIENT")
+            .field(tag::TargetCompID::value, "BROKER")
+            .field(tag::MsgSeqNum::value, int64_t{seq})
+            .field(tag::SendingTime::value, "20231215-10:30:00.000")
+            .field(tag::ClOrdID::value, "ORD-" + std::to_string(seq))
+            .field(tag::Symbol::value, "AAPL")
+            .finish();
+        stream.append(msg.data(), msg.size());
+        ends.push_back(stream.size());
+    }
+    std::array<ParsedMessage, 8> out;
+
+    SECTION("All complete messages") {
+        auto result = parse_batch(std::span<const char>{stream.data(), stream.size()}, out);
+        REQUIRE(result.ok());
+        REQUIRE(result.count == 5);
+        REQUIRE(result.consumed == stream.size());
+        for (size_t i = 0; i < 5; ++i) {
+            REQUIRE(out[i].msg_seq_num() == i + 1);
+            REQUIRE(out[i].get_string(tag::ClOrdID::value) == "ORD-" + std::to_string(i + 1));
+        }
+    }
+
+    SECTION("Partial trailing message is left unconsumed") {
+        auto partial = std::span<const char>{stream.data(), ends[3] + 10};
+        auto result = parse_batch(partial, out);
+        REQUIRE(result.ok());
+        REQUIRE(result.count == 4);
+        REQUIRE(result.consumed == ends[3]);
+    }
+
+    SECTION("Output capacity limits the batch") {
+        auto result = parse_batch(std::span<const char>{stream.data(), stream.size()},
+                                  std::span<ParsedMessage>{out.data(), 2});
+        REQUIRE(result.count == 2);
+        REQUIRE(result.consumed == ends[1]);
+    }
+
+    SECTION("Malformed message stops the batch after it") {
+        stream[ends[2] - 2] = stream[ends[2] - 2] == '9' ? '0' : '9';  // Corrupt checksum
+        auto result = parse_batch(std::span<const char>{stream.data(), stream.size()}, out);
+        REQUIRE(!result.ok());
+        REQUIRE(result.error.code == ParseErrorCode::InvalidChecksum);
+        REQUIRE(result.count == 2);
+        REQUIRE(result.consumed == ends[2]);
+        REQUIRE(result.error.offset >= ends[1]);
+    }
+
+    SECTION("Leading garbage is skipped") {
+        std::string noisy = "XX\x01" + stream;
+        auto result = parse_batch(std::span<const char>{noisy.data(), noisy.size()}, out);
+        REQUIRE(result.ok());
+        REQUIRE(result.count == 5);
+        REQUIRE(result.consumed == noisy.size());
+    }
+}
+
+// ============================================================================
+// Message Reassembly Tests
+// ============================================================================
+
+TEST_CASE("MessageReassembler across buffer boundaries", "[parser][stream]") {
+    std::vector<std::string> messages;
+    std::string stream;
+    for (int seq = 1; seq <= 6; ++seq) {
+        MessageAssembler assembler;
+        auto msg = assembler.start()
+            .field(tag::MsgType::value, '8')
+            .field(tag::SenderCompID::value, "BROKER")
+            .field(tag::TargetCompID::value, "CLIENT")
+            .field(tag::MsgSeqNum::value, int64_t{seq})
+            .field(tag::SendingTime::value, "20231215-10:30:00.000")
+            .field(tag::Text::value, std::string(static_cast<size_t>(seq * 7), 'x'))
+            .finish();
+        messages.emplace_back(msg.data(), msg.size());
+        stream += messages.back();
+    }
+
+    // Split the stream into provided-buffer sized chunks and feed in order
+    auto run = [&](size_t chunk_size, const std::string& input) {
+        std::vector<std::string> buffers;
+        for (size_t off = 0; off < input.size(); off += chunk_size) {
+            buffers.push_back(input.substr(off, chunk_size));
+        }
+
+        MessageReassembler<> reassembler;
+        std::vector<std::string> delivered;
+        std::vector<int> released(buffers.size(), 0);
+        size_t zero_copy_checked = 0;
+
+        for (size_t id = 0; id < buffers.size(); ++id) {
+            const std::string& buf = buffers[id];
+            (void)reassembler.feed(
+                static_cast<uint16_t>(id), std::span<const char>{buf.data(), buf.size()},
+                [&](std::span<const char> msg) {
+                    if (msg.data() >= buf.data() && msg.data() < buf.data() + buf.size()) {
+                        ++zero_copy_checked;
+                    }
+                    delivered.emplace_back(msg.data(), msg.size());
+                },
+                [&](uint16_t released_id) { ++released[released_id]; });
+
+            // Only the newest buffer may still be held
+            if (id > 0) {
+                REQUIRE(released[id - 1] == 1);
+            }
+        }
+
+        REQUIRE(!reassembler.has_partial());
+        REQUIRE(released.back() == 1);
+        REQUIRE(zero_copy_checked == reassembler.stats().zero_copy_messages);
+        return std::pair{delivered, reassembler.stats()};
+    };
+
+    SECTION("Single buffer is fully zero-copy") {
+        auto [delivered, stats] = run(stream.size(), stream);
+        REQUIRE(delivered == messages);
+        REQUIRE(stats.zero_copy_messages == messages.size());
+        REQUIRE(stats.copied_bytes == 0);
+    }
+
+    SECTION("Every chunk size reassembles the same messages") {
+        for (size_t chunk : {3, 17, 64, 101, 150, 257}) {
+            auto [delivered, stats] = run(chunk, stream);
+            REQUIRE(delivered == messages);
+            REQUIRE(stats.zero_copy_messages + stats.copied_messages == messages.size());
+            REQUIRE(stats.garbled_bytes == 0);
+            // Straddling messages are copied once, never more than their size
+            REQUIRE(stats.copied_bytes <= stats.copied_messages * messages.back().size());
+        }
+    }
+
+    SECTION("Garbage between messages is skipped") {
+        std::string noisy = messages[0] + "GARBAGE\x01" + messages[1];
+        auto [delivered, stats] = run(40, noisy);
+        REQUIRE(delivered.size() == 2);
+        REQUIRE(delivered[0] == messages[0]);
+        REQUIRE(delivered[1] == messages[1]);
+        REQUIRE(stats.garbled_bytes > 0);
+    }
 }
 
 // ============================================================================
@@ -475,6 +1331,96 @@ TEST_CASE("FIXStructuralIndex runtime dispatch", "[parser][simd][structural]") {
         REQUIRE(idx.soh_count == 19);
         REQUIRE(idx.equals_count == 19);
     }
+
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+    SECTION("VBMI2 compress extraction matches the bit loop") {
+        if (__builtin_cpu_supports("avx512vbmi2")) {
+            // Dense (many SOH per 64-byte block) and long messages
+            std::string dense = "8=FIX.4.4\x01" "9=9999\x01";
+            for (int i = 0; i < 100; ++i) dense += "1=A\x01";
+            dense += EXEC_REPORT;
+
+            for (const std::string* msg : {&EXEC_REPORT, static_cast<const std::string*>(&dense)}) {
+                std::span<const char> data{msg->data(), msg->size()};
+                auto bitloop = simd::build_index_with_checksum_avx512(data);
+                auto compress = simd::build_index_with_checksum_avx512_vbmi2(data);
+                REQUIRE(compress.soh_count == bitloop.soh_count);
+                REQUIRE(compress.equals_count == bitloop.equals_count);
+                REQUIRE(compress.soh_positions == bitloop.soh_positions);
+                REQUIRE(compress.equals_positions == bitloop.equals_positions);
+                REQUIRE(compress.computed_checksum == bitloop.computed_checksum);
+                REQUIRE(compress.checksum_start == bitloop.checksum_start);
+            }
+        }
+    }
+#endif
+}
+
+TEST_CASE("FIXStructuralIndex fused checksum", "[parser][simd][structural]") {
+    simd::init_simd_dispatch();
+    std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+
+    SECTION("Matches calculate_checksum for every implementation") {
+        auto plain = simd::build_index_scalar(data);
+        uint8_t expected = fix::calculate_checksum(data.subspan(0, plain.checksum_start));
+
+        auto scalar = simd::build_index_with_checksum_scalar(data);
+        REQUIRE(scalar.checksum_computed);
+        REQUIRE(scalar.computed_checksum == expected);
+        REQUIRE(scalar.checksum_matches(data));
+        REQUIRE(scalar.soh_count == plain.soh_count);
+        REQUIRE(scalar.checksum_start == plain.checksum_start);
+
+#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
+        auto avx2 = simd::build_index_with_checksum_avx2(data);
+        REQUIRE(avx2.computed_checksum == expected);
+        REQUIRE(avx2.checksum_matches(data));
+        REQUIRE(avx2.soh_count == simd::build_index_avx2(data).soh_count);
+#endif
+
+#if NFX_NEON_AVAILABLE
+        auto neon = simd::build_index_with_checksum_neon(data);
+        REQUIRE(neon.computed_checksum == expected);
+        REQUIRE(neon.checksum_matches(data));
+        REQUIRE(neon.soh_positions == plain.soh_positions);
+        REQUIRE(neon.checksum_start == plain.checksum_start);
+#endif
+
+        auto dispatched = simd::build_index_with_checksum(data);
+        REQUIRE(dispatched.computed_checksum == expected);
+        REQUIRE(dispatched.checksum_matches(data));
+    }
+
+    SECTION("Tail bytes past the last full SIMD block are indexed") {
+        // 8=FIX.4.4|9=5|35=0|10=NNN| is shorter than one 32-byte block
+        std::string small = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01";
+        uint8_t cs = fix::calculate_checksum(std::span<const char>{small.data(), small.size()});
+        auto digits = fix::format_checksum(cs);
+        small += "10=";
+        small.append(digits.data(), 3);
+        small += '\x01';
+
+        std::span<const char> s{small.data(), small.size()};
+        auto idx = simd::build_index_with_checksum(s);
+        REQUIRE(idx.soh_count == 4);
+        REQUIRE(idx.equals_count == 4);
+        REQUIRE(idx.computed_checksum == cs);
+        REQUIRE(idx.checksum_matches(s));
+    }
+
+    SECTION("Detects corrupted checksum") {
+        std::string bad = EXEC_REPORT;
+        bad[bad.size() - 2] = (bad[bad.size() - 2] == '0') ? '1' : '0';
+        auto idx = simd::build_index_with_checksum(
+            std::span<const char>{bad.data(), bad.size()});
+        REQUIRE_FALSE(idx.checksum_matches(std::span<const char>{bad.data(), bad.size()}));
+    }
+
+    SECTION("Plain build does not claim a checksum") {
+        auto idx = simd::build_index(data);
+        REQUIRE_FALSE(idx.checksum_computed);
+        REQUIRE_FALSE(idx.checksum_matches(data));
+    }
 }
 
 TEST_CASE("IndexedFieldAccessor", "[parser][simd][structural]") {
@@ -545,3 +1491,742 @@ TEST_CASE("PaddedMessageBuffer", "[parser][simd][structural]") {
         REQUIRE(idx.soh_count == 19);
     }
 }
+
+// ============================================================================
+// Data Dictionary Validation Tests
+// ============================================================================
+
+namespace {
+
+constexpr std::string_view TEST_DICTIONARY = R"(<?xml version="1.0" encoding="UTF-8"?>
+<!-- Reduced FIX 4.4 dictionary in QuickFIX format -->
+<fix type="FIX" major="4" minor="4">
+  <header>
+    <field name="BeginString" required="Y"/>
+    <field name="BodyLength" required="Y"/>
+    <field name="MsgType" required="Y"/>
+    <field name="SenderCompID" required="Y"/>
+    <field name="TargetCompID" required="Y"/>
+    <field name="MsgSeqNum" required="Y"/>
+    <field name="SendingTime" required="Y"/>
+  </header>
+  <trailer>
+    <field name="CheckSum" required="Y"/>
+  </trailer>
+  <messages>
+    <message name="Heartbeat" msgtype="0" msgcat="admin">
+      <field name="TestReqID" required="N"/>
+    </message>
+    <message name="NewOrderSingle" msgtype="D" msgcat="app">
+      <field name="ClOrdID" required="Y"/>
+      <component name="Instrument" required="Y"/>
+      <group name="NoAllocs" required="N">
+        <field name="AllocAccount" required="Y"/>
+      </group>
+      <field name="Side" required="Y"/>
+      <field name="OrderQty" required="Y"/>
+      <field name="OrdType" required="Y"/>
+      <field name="Price" required="N"/>
+      <field name="ExecInst" required="N"/>
+    </message>
+  </messages>
+  <components>
+    <component name="Instrument">
+      <field name="Symbol" required="Y"/>
+    </component>
+  </components>
+  <fields>
+    <field number="8" name="BeginString" type="STRING"/>
+    <field number="9" name="BodyLength" type="LENGTH"/>
+    <field number="35" name="MsgType" type="STRING">
+      <value enum="0" description="HEARTBEAT"/>
+      <value enum="D" description="ORDER_SINGLE"/>
+      <value enum="AE" description="TRADE_CAPTURE_REPORT"/>
+    </field>
+    <field number="49" name="SenderCompID" type="STRING"/>
+    <field number="56" name="TargetCompID" type="STRING"/>
+    <field number="34" name="MsgSeqNum" type="SEQNUM"/>
+    <field number="52" name="SendingTime" type="UTCTIMESTAMP"/>
+    <field number="10" name="CheckSum" type="STRING"/>
+    <field number="112" name="TestReqID" type="STRING"/>
+    <field number="11" name="ClOrdID" type="STRING"/>
+    <field number="55" name="Symbol" type="STRING"/>
+    <field number="78" name="NoAllocs" type="NUMINGROUP"/>
+    <field number="79" name="AllocAccount" type="STRING"/>
+    <field number="54" name="Side" type="CHAR">
+      <value enum="1" description="BUY"/>
+      <value enum="2" description="SELL"/>
+    </field>
+    <field number="38" name="OrderQty" type="QTY"/>
+    <field number="40" name="OrdType" type="CHAR">
+      <value enum="1" description="MARKET"/>
+      <value enum="2" description="LIMIT"/>
+    </field>
+    <field number="44" name="Price" type="PRICE"/>
+    <field number="18" name="ExecInst" type="MULTIPLECHARVALUE">
+      <value enum="G" description="ALL_OR_NONE"/>
+    </field>
+  </fields>
+</fix>
+)";
+
+std::string dictionary_message(std::string_view body) {
+    std::string msg = "8=FIX.4.4\x01" "9=100\x01";
+    msg += body;
+    msg += "10=000\x01";
+    return msg;
+}
+
+constexpr std::string_view ORDER_HEADER =
+    "35=D\x01" "49=CLIENT\x01" "56=BROKER\x01" "34=7\x01" "52=20240102-09:30:00\x01";
+
+}  // namespace
+
+TEST_CASE("DataDictionary validation", "[parser][data_dictionary]") {
+    auto dict = DataDictionary::from_xml(TEST_DICTIONARY);
+    REQUIRE(dict.has_value());
+    REQUIRE(dict->field_count() == 18);
+    REQUIRE(dict->message_count() == 2);
+
+    auto check = [&](std::string_view body) {
+        const std::string msg = dictionary_message(body);
+        return dict->validate(std::span<const char>{msg.data(), msg.size()});
+    };
+    const std::string order = std::string{ORDER_HEADER};
+
+    SECTION("Compiled tables") {
+        REQUIRE(dict->is_required("D", 8));
+        REQUIRE(dict->is_required("D", 55));      // Required component
+        REQUIRE_FALSE(dict->is_required("D", 79)); // Inside a group
+        REQUIRE(dict->is_allowed("D", 79));
+        REQUIRE_FALSE(dict->is_allowed("0", 11));
+        REQUIRE_FALSE(dict->has_message("8"));
+    }
+
+    SECTION("Valid messages pass") {
+        REQUIRE(check(order + "11=A1\x01" "55=MSFT\x01" "54=1\x01" "38=100\x01" "40=1\x01").ok());
+        REQUIRE(check(order + "11=A2\x01" "55=MSFT\x01" "78=2\x01" "79=X\x01" "79=Y\x01"
+                      "54=2\x01" "38=5\x01" "40=2\x01" "44=10.5\x01" "18=G H\x01").ok());
+        REQUIRE(check("35=0\x01" "49=A\x01" "56=B\x01" "34=1\x01" "52=20240102-09:30:00\x01").ok());
+    }
+
+    SECTION("Missing required field") {
+        auto error = check(order + "11=A1\x01" "54=1\x01" "38=100\x01" "40=1\x01");
+        REQUIRE(error.code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(error.tag == 55);
+    }
+
+    SECTION("Invalid enum value") {
+        auto error = check(order + "11=A1\x01" "55=MSFT\x01" "54=7\x01" "38=100\x01" "40=1\x01");
+        REQUIRE(error.code == ParseErrorCode::InvalidFieldFormat);
+        REQUIRE(error.tag == 54);
+        REQUIRE(error.offset > 0);
+    }
+
+    SECTION("Field not defined for message or dictionary") {
+        auto error = check("35=0\x01" "49=A\x01" "56=B\x01" "34=1\x01" "52=x\x01" "11=A1\x01");
+        REQUIRE(error.code == ParseErrorCode::InvalidTagNumber);
+        REQUIRE(error.tag == 11);
+
+        error = check("35=0\x01" "49=A\x01" "56=B\x01" "34=1\x01" "52=x\x01" "999=1\x01");
+        REQUIRE(error.code == ParseErrorCode::InvalidTagNumber);
+        REQUIRE(error.tag == 999);
+
+        // User-defined tags are accepted by default
+        REQUIRE(check("35=0\x01" "49=A\x01" "56=B\x01" "34=1\x01" "52=x\x01" "5001=1\x01").ok());
+    }
+
+    SECTION("Unknown message type") {
+        auto error = check("35=AE\x01" "49=A\x01" "56=B\x01" "34=1\x01" "52=x\x01");
+        REQUIRE(error.code == ParseErrorCode::InvalidMsgType);
+    }
+
+    SECTION("Conditional requirement") {
+        REQUIRE(dict->add_conditional("D", 40, '2', 44));
+        REQUIRE_FALSE(dict->add_conditional("D", 40, '2', 12345));
+
+        const std::string market = order + "11=A1\x01" "55=MSFT\x01" "54=1\x01" "38=1\x01" "40=1\x01";
+        const std::string limit = order + "11=A1\x01" "55=MSFT\x01" "54=1\x01" "38=1\x01" "40=2\x01";
+        REQUIRE(check(market).ok());
+        auto error = check(limit);
+        REQUIRE(error.code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(error.tag == 44);
+        REQUIRE(check(limit + "44=10\x01").ok());
+    }
+
+    SECTION("Parsed message path") {
+        std::string body = "8=FIX.4.4\x01" "9=40\x01" + order +
+                           "11=A1\x01" "55=MSFT\x01" "54=1\x01" "38=100\x01" "40=1\x01";
+        auto cs = fix::format_checksum(fix::calculate_checksum(
+            std::span<const char>{body.data(), body.size()}));
+        std::string msg = body + "10=" + std::string{cs.data(), 3} + "\x01";
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(dict->validate(*parsed).ok());
+    }
+
+    SECTION("Malformed dictionaries are rejected") {
+        REQUIRE_FALSE(DataDictionary::from_xml("<fix><fields></fix>").has_value());
+        REQUIRE_FALSE(DataDictionary::from_xml("<fix><fields/><messages/>").has_value());
+        auto undefined = DataDictionary::from_xml(
+            "<fix><fields/><messages><message msgtype='0'><field name='Nope' required='Y'/>"
+            "</message></messages></fix>");
+        REQUIRE_FALSE(undefined.has_value());
+        REQUIRE(undefined.error().detail == "Nope");
+        REQUIRE_FALSE(DataDictionary::load("/nonexistent/FIX44.xml").has_value());
+    }
+}
+
+// ============================================================================
+// Order Template Tests
+// ============================================================================
+
+TEST_CASE("OrderTemplate in-place patching", "[parser][serializer]") {
+    serializer::OrderTemplateFields fields;
+    fields.sender_comp_id = "CLIENT";
+    fields.target_comp_id = "BROKER";
+    fields.symbol = "AAPL";
+    fields.cl_ord_id_prefix = "NFX";
+    fields.account = "ACC1";
+    fields.side = Side::Sell;
+    fields.ord_type = OrdType::Limit;
+
+    serializer::OrderTemplate<> order{fields};
+    REQUIRE(order.valid());
+    const size_t size = order.size();
+
+    auto check = [&](uint32_t seq, uint64_t id, double px, int64_t qty, std::string_view ts) {
+        auto msg = order.render(seq, id, FixedPrice::from_double(px), Qty::from_int(qty), ts);
+        REQUIRE(msg.size() == size);
+        REQUIRE(parser::validate_fix_checksum(std::string_view{msg.data(), msg.size()}));
+
+        auto parsed = fix44::NewOrderSingle::from_buffer(msg);
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->header.msg_seq_num == seq);
+        CHECK(parsed->header.sending_time == ts);
+        CHECK(parsed->cl_ord_id == "NFX" + std::string(12 - std::to_string(id).size(), '0') +
+                                   std::to_string(id));
+        CHECK(parsed->symbol == "AAPL");
+        CHECK(parsed->side == Side::Sell);
+        CHECK(parsed->transact_time == ts);
+        CHECK(parsed->order_qty.whole() == qty);
+        CHECK(parsed->price == FixedPrice::from_double(px));
+        CHECK(parsed->account == "ACC1");
+    };
+
+    check(1, 1, 150.25, 100, "20260123-10:30:00.123");
+    check(42, 987654321, 0.00012345, 2500, "20260123-10:30:01.456");
+    check(999999999, 999999999999, 99999999.5, 9999999999, "20260123-23:59:59.999");
+
+    SECTION("Values wider than their slot are rejected") {
+        const std::string before{order.data().data(), order.data().size()};
+        CHECK(order.render(1000000000, 1, FixedPrice::from_double(1.0), Qty::from_int(1),
+                           "20260123-10:30:00.123").empty());
+        CHECK(order.render(1, 1, FixedPrice::from_double(-1.0), Qty::from_int(1),
+                           "20260123-10:30:00.123").empty());
+        CHECK(order.render(1, 1, FixedPrice::from_double(1.0), Qty::from_int(1),
+                           "20260123-10:30:00").empty());
+        CHECK(std::string{order.data().data(), order.data().size()} == before);
+    }
+
+    SECTION("Market orders carry no price slot") {
+        fields.ord_type = OrdType::Market;
+        serializer::OrderTemplate<> market{fields};
+        auto msg = market.render(7, 7, FixedPrice{0}, Qty::from_int(10), "20260123-10:30:00.123");
+        REQUIRE(parser::validate_fix_checksum(std::string_view{msg.data(), msg.size()}));
+        CHECK(std::string_view{msg.data(), msg.size()}.find("\x01" "44=") == std::string_view::npos);
+    }
+}
+
+TEST_CASE("ExecReportTemplate in-place patching", "[parser][serializer]") {
+    serializer::ExecReportTemplate<> report{{
+        .sender_comp_id = "EXCH",
+        .target_comp_id = "CLIENT",
+        .order_id_prefix = "O",
+        .exec_id_prefix = "X",
+    }};
+    REQUIRE(report.valid());
+
+    auto check = [&](uint32_t seq, const serializer::ExecReportValues& v, std::string_view ts) {
+        auto msg = report.render(seq, v, ts);
+        REQUIRE_FALSE(msg.empty());
+        const std::string_view wire{msg.data(), msg.size()};
+        INFO(wire);
+        REQUIRE(parser::validate_fix_checksum(wire));
+
+        auto parsed = fix44::ExecutionReport::from_buffer(msg);
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->header.msg_seq_num == seq);
+        CHECK(parsed->header.sending_time == ts);
+        CHECK(static_cast<size_t>(parsed->header.body_length) == wire.size() - wire.find("35=") - 7);
+        CHECK(parsed->order_id == "O" + std::string(12 - std::to_string(v.order_id).size(), '0') +
+                                  std::to_string(v.order_id));
+        CHECK(parsed->exec_type == v.exec_type);
+        CHECK(parsed->ord_status == v.ord_status);
+        CHECK(parsed->side == v.side);
+        CHECK(parsed->order_qty == v.order_qty);
+        CHECK(parsed->price == v.price);
+        CHECK(parsed->last_qty == v.last_qty);
+        CHECK(parsed->last_px == v.last_px);
+        CHECK(parsed->leaves_qty == v.leaves_qty);
+        CHECK(parsed->cum_qty == v.cum_qty);
+        CHECK(parsed->avg_px == v.avg_px);
+        CHECK(parsed->transact_time == ts);
+        CHECK(parsed->symbol == v.symbol);
+        CHECK(parsed->cl_ord_id == v.cl_ord_id);
+        CHECK(parsed->orig_cl_ord_id == v.orig_cl_ord_id);
+    };
+
+    // Echoed strings of different lengths move only the tail and trailer
+    check(1, {.order_id = 1, .exec_id = 1, .exec_type = ExecType::New, .ord_status = OrdStatus::New,
+              .side = Side::Buy, .order_qty = Qty::from_int(100), .price = FixedPrice::from_double(150.25),
+              .leaves_qty = Qty::from_int(100), .symbol = "AAPL", .cl_ord_id = "CL-1"},
+          "20260123-10:30:00.123");
+    check(42, {.order_id = 987654321, .exec_id = 2, .exec_type = ExecType::Trade,
+               .ord_status = OrdStatus::PartiallyFilled, .side = Side::Sell,
+               .order_qty = Qty::from_int(100), .price = FixedPrice::from_double(150.25),
+               .last_qty = Qty::from_int(40), .last_px = FixedPrice::from_double(150.5),
+               .leaves_qty = Qty::from_int(60), .cum_qty = Qty::from_int(40),
+               .avg_px = FixedPrice::from_double(150.5), .symbol = "BRK.B",
+               .cl_ord_id = "A-MUCH-LONGER-CLIENT-ORDER-ID", .orig_cl_ord_id = "CL-0"},
+          "20260123-10:30:01.456");
+    check(7, {.order_id = 3, .exec_id = 3, .exec_type = ExecType::Canceled,
+              .ord_status = OrdStatus::Canceled, .side = Side::Buy, .symbol = "X", .cl_ord_id = "C"},
+          "20260123-23:59:59.999");
+
+    SECTION("Values that do not fit are rejected") {
+        const serializer::ExecReportValues ok{.order_id = 1, .exec_id = 1, .symbol = "AAPL", .cl_ord_id = "C"};
+        auto with = [ok](auto change) { auto v = ok; change(v); return v; };
+        const std::string_view ts = "20260123-10:30:00.123";
+        CHECK_FALSE(report.render(1, ok, ts).empty());
+        CHECK(report.render(1000000000, ok, ts).empty());
+        CHECK(report.render(1, ok, "20260123-10:30:00").empty());
+        CHECK(report.render(1, with([](auto& v) { v.exec_id = 1000000000000ULL; }), ts).empty());
+        CHECK(report.render(1, with([](auto& v) { v.last_px = FixedPrice::from_double(-1.0); }), ts).empty());
+        CHECK(report.render(1, with([](auto& v) { v.cl_ord_id = "BAD=ID"; }), ts).empty());
+        CHECK(report.render(1, with([](auto& v) { v.symbol = "BAD\x01"; }), ts).empty());
+        const std::string huge(600, 'C');
+        CHECK(report.render(1, with([&](auto& v) { v.cl_ord_id = huge; }), ts).empty());
+    }
+}
+
+TEST_CASE("Decimal serializer", "[parser][serializer]") {
+    char buf[serializer::MAX_DECIMAL_CHARS];
+    auto u32 = [&](uint32_t v) { return std::string(buf, serializer::write_u32(buf, v)); };
+    auto u64 = [&](uint64_t v) { return std::string(buf, serializer::write_u64(buf, v)); };
+    auto i64 = [&](int64_t v) { return std::string(buf, serializer::write_i64(buf, v)); };
+    auto price = [&](int64_t raw) {
+        return std::string(buf, serializer::write_decimal<FixedPrice::DECIMAL_PLACES>(buf, raw));
+    };
+    auto qty = [&](int64_t raw) {
+        return std::string(buf, serializer::write_decimal<Qty::DECIMAL_PLACES>(buf, raw));
+    };
+
+    SECTION("Integers at every digit-count boundary") {
+        uint64_t pow = 1;
+        for (int digits = 1; digits <= 20; ++digits) {
+            CHECK(u64(pow) == std::to_string(pow));
+            CHECK(u64(pow - 1) == std::to_string(pow - 1));
+            if (pow <= UINT32_MAX) {
+                CHECK(u32(static_cast<uint32_t>(pow)) == std::to_string(pow));
+                CHECK(u32(static_cast<uint32_t>(pow - 1)) == std::to_string(pow - 1));
+            }
+            if (digits < 20) pow *= 10;
+        }
+        CHECK(u32(UINT32_MAX) == "4294967295");
+        CHECK(u64(UINT64_MAX) == "18446744073709551615");
+        CHECK(i64(0) == "0");
+        CHECK(i64(-42) == "-42");
+        CHECK(i64(INT64_MIN) == "-9223372036854775808");
+        CHECK(i64(INT64_MAX) == "9223372036854775807");
+    }
+
+    SECTION("Fixed-point values are exact with trailing zeros trimmed") {
+        CHECK(price(FixedPrice::from_double(150.25).raw) == "150.25");
+        CHECK(price(FixedPrice::from_double(150.0).raw) == "150");
+        CHECK(price(0) == "0");
+        CHECK(price(1) == "0.00000001");
+        CHECK(price(-250000000) == "-2.5");
+        CHECK(price(1234567891234567LL) == "12345678.91234567");  // %.8g lost these
+        CHECK(qty(Qty::from_int(100).raw) == "100");
+        CHECK(qty(Qty::from_double(12.5).raw) == "12.5");
+        CHECK(qty(1) == "0.0001");
+    }
+
+    SECTION("Fixed-width output is zero-padded") {
+        serializer::write_fixed_digits(buf, 42, 9);
+        CHECK(std::string_view{buf, 9} == "000000042");
+        serializer::write_fixed_digits(buf, 987654321012ULL, 12);
+        CHECK(std::string_view{buf, 12} == "987654321012");
+        serializer::write_decimal_fixed<8, 8>(buf, 15025000000ULL);
+        CHECK(std::string_view{buf, 17} == "00000150.25000000");
+    }
+
+    SECTION("Builders emit exact prices and fractional quantities") {
+        MessageAssembler assembler;
+        auto msg = fix44::NewOrderSingle::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .msg_seq_num(1)
+            .sending_time("20260123-10:30:00.123")
+            .cl_ord_id("ORD1")
+            .symbol("BTC-USD")
+            .side(Side::Buy)
+            .transact_time("20260123-10:30:00.123")
+            .order_qty(Qty::from_double(0.5))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice{1234567891234567LL})
+            .build(assembler);
+        const std::string_view text{msg.data(), msg.size()};
+        CHECK(text.find("\x01" "38=0.5\x01") != std::string_view::npos);
+        CHECK(text.find("\x01" "44=12345678.91234567\x01") != std::string_view::npos);
+
+        auto parsed = fix44::NewOrderSingle::from_buffer(msg);
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->order_qty == Qty::from_double(0.5));
+        CHECK(parsed->price == FixedPrice{1234567891234567LL});
+    }
+}
+
+namespace {
+
+template <typename B>
+concept Buildable = requires(const B& builder, MessageAssembler& assembler) { builder.build(assembler); };
+
+template <typename B>
+concept CanSetSymbol = requires(const B& builder) { builder.symbol("AAPL"); };
+
+}  // namespace
+
+TEST_CASE("Typestate builders check required fields at compile time", "[parser][serializer]") {
+    using Typed = fix44::NewOrderSingle::TypedBuilder<>;
+    constexpr auto header = Typed{}.sender_comp_id("CLIENT").target_comp_id("BROKER")
+        .msg_seq_num(42).sending_time("20260123-10:30:00.123");
+    constexpr auto body = header.cl_ord_id("ORD1").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260123-10:30:00.123").order_qty(Qty::from_int(100));
+
+    static_assert(!decltype(header)::COMPLETE);
+    static_assert(!Buildable<decltype(body)>);  // OrdType missing
+    static_assert(!CanSetSymbol<decltype(body)>);  // Each field once
+    static_assert(Buildable<decltype(body.ord_type(OrdType::Limit))>);
+
+    SECTION("Same bytes as Builder") {
+        fix44::NewOrderSingle::Builder builder;
+        builder.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(42)
+            .sending_time("20260123-10:30:00.123").cl_ord_id("ORD1").symbol("AAPL")
+            .side(Side::Buy).transact_time("20260123-10:30:00.123")
+            .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25)).text("typed");
+
+        MessageAssembler a;
+        MessageAssembler b;
+        auto reference = builder.build(a);
+        auto typed = body.ord_type(OrdType::Limit).price(FixedPrice::from_double(150.25))
+            .text("typed").build(b);
+        REQUIRE(std::string_view{typed.data(), typed.size()} ==
+                std::string_view{reference.data(), reference.size()});
+    }
+
+    SECTION("OrderCancelRequest") {
+        using Cancel = fix44::OrderCancelRequest::TypedBuilder<>;
+        auto cancel = Cancel{}.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(7)
+            .sending_time("20260123-10:30:00.123").orig_cl_ord_id("ORD1").cl_ord_id("ORD2")
+            .symbol("AAPL").side(Side::Buy);
+        static_assert(!Buildable<decltype(cancel)>);  // TransactTime missing
+
+        MessageAssembler assembler;
+        auto msg = cancel.transact_time("20260123-10:30:00.123").order_id("X1").build(assembler);
+        auto parsed = fix44::OrderCancelRequest::from_buffer(msg);
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->orig_cl_ord_id == "ORD1");
+        CHECK(parsed->order_id == "X1");
+        CHECK(parsed->order_qty.raw == 0);
+    }
+}
+
+TEST_CASE("MessageAssembler header back-fill", "[parser][serializer]") {
+    fix44::NewOrderSingle::Builder builder;
+    builder.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(42)
+        .sending_time("20260123-10:30:00.123").cl_ord_id("ORD1").symbol("AAPL")
+        .side(Side::Buy).transact_time("20260123-10:30:00.123")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25));
+
+    MessageAssembler padded;
+    auto reference = builder.build(padded);
+
+    MessageAssembler assembler;
+    assembler.set_header_backfill(true);
+    REQUIRE(assembler.header_backfill());
+
+    SECTION("Same message with an unpadded BodyLength") {
+        auto built = builder.build(assembler);
+        std::string msg{built.data(), built.size()};
+        REQUIRE(msg.starts_with("8=FIX.4.4\x01" "9="));
+        REQUIRE(msg.find("\x01" "9=0") == std::string::npos);
+        REQUIRE(parser::validate_fix_checksum(msg));
+
+        // Only the BodyLength digits differ from the placeholder layout
+        std::string expected{reference.data(), reference.size()};
+        const size_t digits = expected.find("9=") + 2;
+        expected.erase(digits, expected.find_first_not_of('0', digits) - digits);
+        REQUIRE(msg.substr(0, msg.size() - 7) == expected.substr(0, expected.size() - 7));
+
+        auto parsed = fix44::NewOrderSingle::from_buffer(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->header.msg_seq_num == 42);
+        const size_t body = msg.find('\x01', 10) + 1;
+        CHECK(static_cast<size_t>(parsed->header.body_length) == msg.size() - 7 - body);
+    }
+
+    SECTION("Span starts inside the destination, right before the body") {
+        std::array<char, 512> dest{};
+        auto built = builder.build(assembler.into(dest));
+        REQUIRE(built.data() > dest.data());
+        REQUIRE(built.data() < dest.data() + MessageAssembler::HEADER_HEADROOM);
+        REQUIRE(built.data() + built.size() <= dest.data() + dest.size());
+        REQUIRE(parser::validate_fix_checksum(std::string_view{built.data(), built.size()}));
+    }
+
+    SECTION("FIXT.1.1 and bodies of every digit count") {
+        for (size_t text : {0u, 5u, 80u, 900u}) {
+            assembler.start_fixt11()
+                .field(tag::MsgType::value, "0")
+                .field(tag::MsgSeqNum::value, int64_t{7});
+            if (text) assembler.field(tag::Text::value, std::string(text, 'x'));
+            auto built = assembler.finish();
+            std::string_view msg{built.data(), built.size()};
+            REQUIRE(msg.starts_with("8=FIXT.1.1\x01" "9="));
+            REQUIRE(parser::validate_fix_checksum(msg));
+
+            const size_t body = msg.find('\x01', 11) + 1;
+            const size_t trailer = msg.size() - 7;
+            REQUIRE(std::to_string(trailer - body) == msg.substr(13, body - 14));
+        }
+    }
+}
+
+TEST_CASE("MessageAssembler session header cache", "[parser][serializer]") {
+    fix44::NewOrderSingle::Builder builder;
+    builder.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(42)
+        .sending_time("20260123-10:30:00.123").cl_ord_id("ORD1").symbol("AAPL")
+        .side(Side::Buy).transact_time("20260123-10:30:00.123")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25));
+
+    auto render = [&](MessageAssembler& assembler) {
+        auto built = builder.build(assembler);
+        return std::string{built.data(), built.size()};
+    };
+
+    for (bool backfill : {false, true}) {
+        MessageAssembler plain;
+        plain.set_header_backfill(backfill);
+        const std::string expected = render(plain);
+
+        MessageAssembler cached;
+        cached.set_header_backfill(backfill);
+        REQUIRE(cached.set_session_header(fix::FIX_4_4, "CLIENT", "BROKER"));
+        REQUIRE(cached.has_session_header());
+
+        // Same bytes and checksum, twice in a row
+        CHECK(render(cached) == expected);
+        CHECK(render(cached) == expected);
+
+        // Other comp IDs or BeginString fall back to field-by-field
+        builder.target_comp_id("OTHER");
+        const std::string other = render(plain);
+        CHECK(render(cached) == other);
+        CHECK(parser::validate_fix_checksum(other));
+        builder.target_comp_id("BROKER");
+
+        auto fixt = cached.start_fixt11()
+            .field(tag::MsgType::value, "0")
+            .comp_ids("CLIENT", "BROKER")
+            .finish();
+        CHECK(parser::validate_fix_checksum(std::string_view{fixt.data(), fixt.size()}));
+    }
+
+    MessageAssembler too_long;
+    REQUIRE_FALSE(too_long.set_session_header(fix::FIX_4_4, std::string(200, 'S'), "T"));
+    REQUIRE_FALSE(too_long.has_session_header());
+}
+
+TEST_CASE("Value validation while serializing", "[parser][serializer]") {
+    SECTION("Every length and position is checked") {
+        for (size_t n = 0; n <= 80; ++n) {
+            std::string value(n, 'A');
+            for (size_t i = 0; i < n; ++i) value[i] = static_cast<char>('A' + i % 26);
+            std::string out(n, '\0');
+            REQUIRE(serializer::copy_value_checked(out.data(), value.data(), n));
+            REQUIRE(out == value);
+
+            for (size_t at = 0; at < n; ++at) {
+                for (char bad : {'\x01', '='}) {
+                    std::string dirty = value;
+                    dirty[at] = bad;
+                    std::string copy(n, '\0');
+                    REQUIRE_FALSE(serializer::copy_value_checked(copy.data(), dirty.data(), n));
+                    REQUIRE(copy == dirty);
+                }
+            }
+        }
+        static_assert(serializer::is_valid_value("ORD-1/A:B"));
+        static_assert(!serializer::is_valid_value("A=B"));
+    }
+
+    SECTION("MessageAssembler names the first bad field") {
+        fix44::NewOrderSingle::Builder builder;
+        builder.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(1)
+            .sending_time("20260123-10:30:00.123").cl_ord_id("ORD1").symbol("AAPL")
+            .side(Side::Buy).transact_time("20260123-10:30:00.123")
+            .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit);
+
+        MessageAssembler plain;
+        const auto expected = builder.build(plain);
+        const std::string expected_str{expected.data(), expected.size()};
+        REQUIRE(plain.invalid_field() == 0);   // Not tracked when off
+
+        MessageAssembler checked;
+        checked.set_value_validation(true);
+        auto clean = builder.build(checked);
+        REQUIRE(std::string{clean.data(), clean.size()} == expected_str);
+        REQUIRE(checked.invalid_field() == 0);
+
+        builder.cl_ord_id("ORD\x01" "1").symbol("A=B");
+        (void)builder.build(checked);
+        REQUIRE(checked.invalid_field() == tag::ClOrdID::value);
+
+        builder.cl_ord_id("ORD1");
+        (void)builder.build(checked);
+        REQUIRE(checked.invalid_field() == tag::Symbol::value);   // Cleared by start()
+    }
+
+    SECTION("FastMessageBuilder") {
+        serializer::FastMessageBuilder<256> fast;
+        fast.set_value_validation(true);
+        fast.field<11>(std::string_view{"ORD1"}).field<58>(std::string_view{"a long free-text note, no bad bytes"});
+        REQUIRE(fast.invalid_field() == 0);
+        REQUIRE(fast.view() == "11=ORD1\x01" "58=a long free-text note, no bad bytes\x01");
+        fast.field<58>(std::string_view{"qty=100 please fill it quickly"});
+        REQUIRE(fast.invalid_field() == 58);
+        fast.reset();
+        REQUIRE(fast.invalid_field() == 0);
+    }
+}
+
+TEST_CASE("Repeating group writer", "[parser][serializer]") {
+    static_assert(groups::Parties::delimiter == tag::PartyID::value);
+    static_assert(groups::Parties::position(tag::PartyRole::value) == 2);
+    static_assert(groups::Parties::position(tag::Symbol::value) == groups::Parties::NOT_IN_GROUP);
+
+    MessageAssembler assembler;
+    auto body = [](std::span<const char> built) {
+        std::string_view msg{built.data(), built.size()};
+        const size_t begin = msg.find("\x01" "35=");
+        return std::string{msg.substr(begin + 1, msg.size() - 7 - begin - 1)};
+    };
+
+    SECTION("Entries in definition order, optional fields skipped") {
+        assembler.start().field(tag::MsgType::value, "D");
+        auto parties = assembler.group<groups::Parties>();
+        parties.entry("BROKER1").field<tag::PartyIDSource::value>('D').field<tag::PartyRole::value>(1);
+        parties.entry(std::string_view{"TRADER7"}).field<tag::PartyRole::value>(11);
+        REQUIRE(parties.count() == 2);
+        parties.close().field(tag::Symbol::value, "AAPL");
+        auto built = assembler.finish();
+
+        REQUIRE(body(built) == "35=D\x01" "453=2\x01" "448=BROKER1\x01" "447=D\x01" "452=1\x01"
+                               "448=TRADER7\x01" "452=11\x01" "55=AAPL\x01");
+        REQUIRE(parser::validate_fix_checksum(std::string_view{built.data(), built.size()}));
+    }
+
+    SECTION("Empty groups are omitted") {
+        assembler.start().field(tag::MsgType::value, "D");
+        assembler.group<groups::Legs>().close().field(tag::Symbol::value, "AAPL");
+        REQUIRE(body(assembler.finish()) == "35=D\x01" "55=AAPL\x01");
+    }
+
+    SECTION("Counts of ten or more move the entries") {
+        assembler.start().field(tag::MsgType::value, "V");
+        auto legs = assembler.group<groups::Legs>();
+        std::string expected = "35=V\x01" "555=12\x01";
+        for (int i = 0; i < 12; ++i) {
+            legs.entry("L" + std::to_string(i)).field<tag::LegSide::value>(Side::Sell)
+                .field<tag::LegPrice::value>(FixedPrice::from_double(1.5));
+            expected += "600=L" + std::to_string(i) + "\x01" "624=2\x01" "566=1.5\x01";
+        }
+        legs.close();
+        auto built = assembler.finish();
+        REQUIRE(body(built) == expected);
+        REQUIRE(parser::validate_fix_checksum(std::string_view{built.data(), built.size()}));
+    }
+
+    SECTION("FastMessageBuilder takes the same groups") {
+        serializer::FastMessageBuilder<256> fast;
+        fast.msg_type('D');
+        auto parties = fast.group<groups::Parties>();
+        parties.entry("BROKER1").field<tag::PartyRole::value>(1);
+        parties.close();
+        REQUIRE(fast.view() == "35=D\x01" "453=1\x01" "448=BROKER1\x01" "452=1\x01");
+    }
+
+    SECTION("MarketDataRequest groups are byte-identical to field-by-field output") {
+        fix44::MarketDataRequest::Builder request;
+        request.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(3)
+            .sending_time("20260123-10:30:00.123").md_req_id("MD1")
+            .add_entry_type(MDEntryType::Bid).add_entry_type(MDEntryType::Offer)
+            .add_symbol("AAPL");
+        const std::string msg = body(request.build(assembler));
+        REQUIRE(msg.ends_with("267=2\x01" "269=0\x01" "269=1\x01" "146=1\x01" "55=AAPL\x01"));
+    }
+}
+
+TEST_CASE("Checksum patching", "[parser][serializer][checksum]") {
+    fix44::NewOrderSingle::Builder builder;
+    builder.sender_comp_id("CLIENT").target_comp_id("BROKER").msg_seq_num(42)
+        .sending_time("20260123-10:30:00.123").cl_ord_id("ORD1").symbol("AAPL")
+        .side(Side::Buy).transact_time("20260123-10:30:00.123")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25));
+    MessageAssembler assembler;
+    auto built = builder.build(assembler);
+    std::string msg{built.data(), built.size()};
+    std::span<char> span{msg.data(), msg.size()};
+
+    SECTION("Delta matches a full re-sum") {
+        const size_t ts = msg.find("52=") + 3;
+        REQUIRE(parser::patch_field(span, ts, "20260123-10:31:59.999"));
+        REQUIRE(parser::validate_fix_checksum(msg));
+        REQUIRE(msg.substr(ts, 21) == "20260123-10:31:59.999");
+
+        const size_t seq = msg.find("34=") + 3;
+        REQUIRE(parser::patch_field(span, seq, "97"));
+        REQUIRE(parser::validate_fix_checksum(msg));
+        auto parsed = fix44::NewOrderSingle::from_buffer(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        CHECK(parsed->header.msg_seq_num == 97);
+    }
+
+    SECTION("Delta, adjust and IncrementalChecksum::replace agree") {
+        const uint8_t before = parser::checksum(msg.data(), msg.size() - 7);
+        const uint8_t after = parser::adjust_checksum(before, "ORD1", "ORD9");
+        const size_t id = msg.find("11=") + 3;
+        msg.replace(id, 4, "ORD9");
+        CHECK(after == parser::checksum(msg.data(), msg.size() - 7));
+        CHECK(static_cast<uint8_t>(before + parser::checksum_delta("ORD1", "ORD9")) == after);
+
+        parser::IncrementalChecksum sum;
+        sum.update("11=ORD1\x01", 8);
+        sum.replace("ORD1", "ORD9");
+        CHECK(sum.finalize() == parser::checksum("11=ORD9\x01", 8));
+    }
+
+    SECTION("Ranges reaching the trailer are rejected") {
+        const std::string before = msg;
+        CHECK_FALSE(parser::patch_field(span, msg.size() - 7, "X"));
+        CHECK_FALSE(parser::patch_field(span, msg.size() - 8, "XY"));
+        CHECK_FALSE(parser::patch_field(span.first(msg.size() - 1), 0, "8"));
+        CHECK(msg == before);
+    }
+}
@@ -3,8 +3,10 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <cstring>
 #include <string_view>
+#include <vector>
 
 #include "nexusfix/sbe/sbe.hpp"
 
@@ -572,3 +574,354 @@ TEST_CASE("NewOrderSingleCodec edge cases", "[sbe][nos][edge]") {
         REQUIRE(decoder.price().raw == negative.raw);
     }
 }
+
+// ============================================================================
+// Repeating Group / Var-Data Tests
+// ============================================================================
+
+namespace {
+
+// MDP3-style incremental refresh: 11-byte root, NoMDEntries (groupSize),
+// NoOrderIDEntries (groupSize8Byte), then one var-data field.
+// entry_block > 32 simulates a newer sender that appended fields.
+std::size_t build_book_refresh(char* buf, std::size_t entry_block) {
+    auto header = MessageHeader::wrapForEncode(buf, 512);
+    header.encodeHeader(11, 46);
+    std::size_t pos = MessageHeader::SIZE + 11;
+
+    GroupSize::encode(buf + pos, entry_block, 3);
+    pos += GroupSize::SIZE;
+    for (int i = 0; i < 3; ++i) {
+        char* e = buf + pos;
+        std::memset(e, 0, entry_block);
+        write_int64(e + 0, 4'500'250'000'000LL + i * 250'000'000LL);   // PRICE9
+        write_int32(e + 8, 10 * (i + 1));                              // MDEntrySize
+        write_int32(e + 12, 5000);                                     // SecurityID
+        write_uint32(e + 16, static_cast<SbeUint32>(100 + i));         // RptSeq
+        write_int32(e + 20, i == 1 ? INT32_MAX : i + 1);               // NumberOfOrders (MDP3 null)
+        write_uint8(e + 24, static_cast<SbeUint8>(i + 1));             // MDPriceLevel
+        write_uint8(e + 25, static_cast<SbeUint8>(i));                 // MDUpdateAction
+        e[26] = i == 2 ? '1' : '0';                                    // MDEntryType
+        pos += entry_block;
+    }
+
+    GroupSize8Byte::encode(buf + pos, 24, 1);
+    pos += GroupSize8Byte::SIZE;
+    std::memset(buf + pos, 0, 24);
+    write_uint64(buf + pos, 77);
+    pos += 24;
+
+    pos += VarStringEncoding::encode(buf + pos, "end of event");
+    return pos;
+}
+
+}  // namespace
+
+TEST_CASE("SBE group dimension encodings", "[sbe][group]") {
+    alignas(8) char buffer[16]{};
+
+    GroupSizeEncoding::encode(buffer, 32, 300);
+    REQUIRE(GroupSizeEncoding::blockLength(buffer) == 32);
+    REQUIRE(GroupSizeEncoding::numInGroup(buffer) == 300);
+
+    GroupSize8Byte::encode(buffer, 24, 5);
+    REQUIRE(GroupSize8Byte::blockLength(buffer) == 24);
+    REQUIRE(GroupSize8Byte::numInGroup(buffer) == 5);
+    REQUIRE(buffer[7] == 5);
+
+    std::string_view out;
+    REQUIRE(VarStringEncoding::encode(buffer, "abc") == 5);
+    REQUIRE(VarStringEncoding::decode(buffer, 5, out) == 5);
+    REQUIRE(out == "abc");
+    REQUIRE(VarStringEncoding::decode(buffer, 4, out) == 0);
+}
+
+TEST_CASE("SBE MessageCursor walks groups and var-data", "[sbe][group]") {
+    alignas(8) char buffer[512]{};
+
+    // Same decode for the compiled 32-byte entry and a newer 40-byte one
+    const std::size_t blocks[] = {32, 40};
+    for (std::size_t block : blocks) {
+        const std::size_t length = build_book_refresh(buffer, block);
+
+        MessageCursor cursor{buffer, length};
+        REQUIRE(cursor.position() == MessageHeader::SIZE + 11);
+
+        auto entries = cursor.group<GroupSize>();
+        REQUIRE(entries.size() == 3);
+        REQUIRE(entries.blockLength() == block);
+        REQUIRE_FALSE(entries.truncated());
+
+        SbeUint32 expected_seq = 100;
+        for (GroupEntry e : entries) {
+            REQUIRE(e.read<SbeUint32>(16) == expected_seq++);
+        }
+        REQUIRE(entries[2].read<char>(26) == '1');
+
+        auto orders = cursor.group<GroupSize8Byte>();
+        REQUIRE(orders.size() == 1);
+        REQUIRE(orders[0].read<SbeUint64>(0) == 77);
+
+        REQUIRE(cursor.var_data<VarStringEncoding>() == "end of event");
+        REQUIRE(cursor.ok());
+        REQUIRE(cursor.remaining() == 0);
+    }
+
+    SECTION("Truncated buffer") {
+        const std::size_t length = build_book_refresh(buffer, 32);
+        const std::size_t cut = MessageHeader::SIZE + 11 + GroupSize::SIZE + 2 * 32 + 5;
+
+        MessageCursor cursor{buffer, cut};
+        auto entries = cursor.group<GroupSize>();
+        REQUIRE(entries.size() == 2);
+        REQUIRE(entries.truncated());
+        REQUIRE_FALSE(cursor.ok());
+        REQUIRE(cursor.var_data().empty());
+        REQUIRE(length > cut);
+    }
+
+    SECTION("Sequential reader for nested content") {
+        const std::size_t length = build_book_refresh(buffer, 32);
+        MessageCursor cursor{buffer, length};
+
+        auto reader = cursor.begin_group<GroupSize>();
+        REQUIRE(reader.count() == 3);
+        int n = 0;
+        while (reader.has_next()) {
+            GroupEntry e = reader.next();
+            REQUIRE(e.read<SbeInt32>(12) == 5000);
+            ++n;
+        }
+        REQUIRE(n == 3);
+        REQUIRE(cursor.group<GroupSize8Byte>().size() == 1);
+        REQUIRE(cursor.var_data() == "end of event");
+    }
+}
+
+TEST_CASE("SBE group decodes into MDEntryColumns", "[sbe][group]") {
+    alignas(8) char buffer[512]{};
+    std::array<int32_t, 16> security_ids{};
+
+    const std::size_t length = build_book_refresh(buffer, 40);
+    MessageCursor cursor{buffer, length};
+    auto entries = cursor.group<GroupSize>();
+
+    MDEntryColumns<16> cols;
+    REQUIRE(decode_md_group<MDP3_BOOK_ENTRY>(entries, cols, security_ids) == 3);
+    REQUIRE(cols.count == 3);
+    REQUIRE_FALSE(cols.truncated);
+
+    REQUIRE(cols.price[0].raw == 450'025'000'000LL);   // 4500.25
+    REQUIRE(cols.price[2].raw == 450'075'000'000LL);
+    REQUIRE(cols.size[1].raw == 20 * Qty::SCALE);
+    REQUIRE(cols.rpt_seq[2] == 102);
+    REQUIRE(cols.number_of_orders[0] == 1);
+    REQUIRE(cols.number_of_orders[1] == 0);              // Null -> absent
+    REQUIRE(cols.position_no[2] == 3);
+    REQUIRE(cols.update_action[0] == MDUpdateAction::New);
+    REQUIRE(cols.update_action[2] == MDUpdateAction::Delete);
+    REQUIRE(cols.entry_type[2] == MDEntryType::Offer);
+    REQUIRE(cols.symbol(0).empty());
+    REQUIRE(security_ids[1] == 5000);
+
+    SECTION("Older sender: fields past its blockLength are absent") {
+        const std::size_t old_length = build_book_refresh(buffer, 20);
+        MessageCursor old_cursor{buffer, old_length};
+        auto old_entries = old_cursor.group<GroupSize>();
+        REQUIRE_FALSE(old_entries[0].has(20, 4));
+        REQUIRE(old_entries[0].get<SbeInt32>(20, -1) == -1);
+
+        REQUIRE(decode_md_group<MDP3_BOOK_ENTRY>(old_entries, cols) == 3);
+        REQUIRE(cols.rpt_seq[1] == 101);
+        REQUIRE(cols.number_of_orders[0] == 0);
+        REQUIRE(cols.position_no[0] == 0);
+        REQUIRE(cols.entry_type[2] == MDEntryType::Bid);
+    }
+
+    SECTION("Capacity") {
+        MDEntryColumns<2> small;
+        REQUIRE(decode_md_group<MDP3_BOOK_ENTRY>(entries, small) == 2);
+        REQUIRE(small.truncated);
+    }
+}
+
+// ============================================================================
+// SOFH Framing Tests
+// ============================================================================
+
+namespace {
+
+// Three NewOrderSingles and one ExecutionReport, framed back to back
+std::size_t build_frame_batch(SbeFrameWriter<>& writer) {
+    const char* ids[] = {"ORD1", "ORD2", "ORD3"};
+    for (const char* id : ids) {
+        auto nos = writer.add<NewOrderSingleCodec>();
+        REQUIRE(nos.has_value());
+        nos->clOrdId(id).symbol("ESZ5").side(Side::Buy).orderQty(Qty::from_int(1));
+    }
+    auto er = writer.add<ExecutionReportCodec>();
+    REQUIRE(er.has_value());
+    er->orderId("EX1").symbol("ESZ5");
+    return writer.size();
+}
+
+}  // namespace
+
+TEST_CASE("SOFH header encodings", "[sbe][sofh]") {
+    alignas(8) char buf[8]{};
+
+    Sofh::encode(buf, 70);
+    REQUIRE(static_cast<unsigned char>(buf[0]) == 0x00);   // big-endian length
+    REQUIRE(static_cast<unsigned char>(buf[3]) == 70);
+    REQUIRE(static_cast<unsigned char>(buf[4]) == 0xEB);   // 0xEB50
+    REQUIRE(static_cast<unsigned char>(buf[5]) == 0x50);
+    REQUIRE(Sofh::frameLength(buf) == 70);
+    REQUIRE(Sofh::encodingType(buf) == SofhEncoding::SbeLittleEndian);
+
+    CompactSofh::encode(buf, 0x0142);
+    REQUIRE(static_cast<unsigned char>(buf[0]) == 0x42);   // little-endian length
+    REQUIRE(static_cast<unsigned char>(buf[1]) == 0x01);
+    REQUIRE(CompactSofh::frameLength(buf) == 0x0142);
+    REQUIRE(CompactSofh::encodingType(buf) == SofhEncoding::CmeSbe);
+}
+
+TEST_CASE("SbeFrameWriter packs a batch into one buffer", "[sbe][sofh]") {
+    alignas(8) char buffer[512]{};
+    SbeFrameWriter<> writer{buffer};
+    REQUIRE(writer.empty());
+
+    const std::size_t size = build_frame_batch(writer);
+    REQUIRE(writer.message_count() == 4);
+    REQUIRE(size == 3 * (Sofh::SIZE + NewOrderSingleCodec::TOTAL_SIZE) +
+                    Sofh::SIZE + ExecutionReportCodec::TOTAL_SIZE);
+    REQUIRE(writer.frame().data() == buffer);
+
+    // Walk the frames by hand
+    std::size_t pos = 0;
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(Sofh::frameLength(buffer + pos) == Sofh::SIZE + NewOrderSingleCodec::TOTAL_SIZE);
+        auto nos = NewOrderSingleCodec::wrapForDecode(buffer + pos + Sofh::SIZE,
+                                                      NewOrderSingleCodec::TOTAL_SIZE);
+        REQUIRE(nos.isValid());
+        REQUIRE(nos.clOrdId() == std::string_view{i == 0 ? "ORD1" : i == 1 ? "ORD2" : "ORD3"});
+        pos += Sofh::frameLength(buffer + pos);
+    }
+    REQUIRE(ExecutionReportCodec::wrapForDecode(buffer + pos + Sofh::SIZE,
+                                                ExecutionReportCodec::TOTAL_SIZE).isValid());
+
+    SECTION("Full buffer rejects further frames") {
+        SbeFrameWriter<> small{std::span<char>{buffer, Sofh::SIZE + NewOrderSingleCodec::TOTAL_SIZE + 10}};
+        REQUIRE(small.add<NewOrderSingleCodec>().has_value());
+        REQUIRE_FALSE(small.add<NewOrderSingleCodec>().has_value());
+        REQUIRE_FALSE(small.append(std::span<const char>{buffer, 8}));
+        REQUIRE(small.message_count() == 1);
+        REQUIRE(small.remaining() == 10);
+    }
+
+    SECTION("Variable-length reserve/commit") {
+        writer.reset();
+        auto payload = writer.reserve(100);
+        REQUIRE(payload.size() == 100);
+        std::memset(payload.data(), 'x', 40);
+        writer.commit(40);
+        REQUIRE(writer.size() == Sofh::SIZE + 40);
+        REQUIRE(Sofh::frameLength(buffer) == Sofh::SIZE + 40);
+
+        writer.commit(10);  // Nothing reserved: ignored
+        REQUIRE(writer.message_count() == 1);
+    }
+}
+
+TEST_CASE("SofhDeframer splits frames across recv completions", "[sbe][sofh]") {
+    alignas(8) char buffer[512]{};
+    SbeFrameWriter<> writer{buffer};
+    const std::size_t size = build_frame_batch(writer);
+    std::span<const char> stream = writer.frame();
+
+    auto check = [](const std::vector<std::vector<char>>& msgs) {
+        REQUIRE(msgs.size() == 4);
+        for (std::size_t i = 0; i < 3; ++i) {
+            auto nos = NewOrderSingleCodec::wrapForDecode(msgs[i].data(), msgs[i].size());
+            REQUIRE(nos.isValid());
+            REQUIRE(nos.clOrdId().back() == static_cast<char>('1' + i));
+        }
+        auto er = ExecutionReportCodec::wrapForDecode(msgs[3].data(), msgs[3].size());
+        REQUIRE(er.isValid());
+        REQUIRE(er.orderId() == "EX1");
+    };
+
+    SECTION("Single completion is zero-copy") {
+        SofhDeframer<> deframer;
+        std::vector<std::vector<char>> msgs;
+        int released = 0;
+        REQUIRE(deframer.feed(7, stream, [&](std::span<const char> m) {
+            msgs.emplace_back(m.begin(), m.end());
+        }, [&](std::uint16_t id) { REQUIRE(id == 7); ++released; }) == 4);
+        check(msgs);
+        REQUIRE(released == 1);
+        REQUIRE(deframer.stats().zero_copy_messages == 4);
+        REQUIRE_FALSE(deframer.has_partial());
+    }
+
+    SECTION("Every two-way split, pinned buffers") {
+        for (std::size_t split = 1; split < size; ++split) {
+            SofhDeframer<> deframer;
+            std::vector<std::vector<char>> msgs;
+            std::vector<std::uint16_t> released;
+            auto on_msg = [&](std::span<const char> m) { msgs.emplace_back(m.begin(), m.end()); };
+            auto on_release = [&](std::uint16_t id) { released.push_back(id); };
+
+            deframer.feed(1, stream.first(split), on_msg, on_release);
+            deframer.feed(2, stream.subspan(split), on_msg, on_release);
+            check(msgs);
+            REQUIRE(released.size() == 2);
+            REQUIRE_FALSE(deframer.has_partial());
+            REQUIRE(deframer.pinned_buffer() == SofhDeframer<>::NO_BUFFER);
+        }
+    }
+
+    SECTION("Byte-at-a-time, copying feed") {
+        SofhDeframer<> deframer;
+        std::vector<std::vector<char>> msgs;
+        for (std::size_t i = 0; i < size; ++i) {
+            deframer.feed(stream.subspan(i, 1), [&](std::span<const char> m) {
+                msgs.emplace_back(m.begin(), m.end());
+            });
+        }
+        check(msgs);
+        REQUIRE(deframer.stats().copied_messages == 4);
+        REQUIRE_FALSE(deframer.has_partial());
+    }
+
+    SECTION("Bad header stops the stream until reset") {
+        std::vector<char> bad(stream.begin(), stream.end());
+        const std::size_t second = Sofh::SIZE + NewOrderSingleCodec::TOTAL_SIZE;
+        bad[second + 4] = 0x12;  // Corrupt Encoding_Type of frame 2
+
+        SofhDeframer<> deframer;
+        int delivered = 0;
+        int released = 0;
+        auto on_msg = [&](std::span<const char>) { ++delivered; };
+        auto on_release = [&](std::uint16_t) { ++released; };
+        deframer.feed(1, bad, on_msg, on_release);
+        REQUIRE(delivered == 1);
+        REQUIRE(deframer.failed());
+        REQUIRE(released == 1);
+
+        deframer.feed(2, stream, on_msg, on_release);
+        REQUIRE(delivered == 1);
+        REQUIRE(released == 2);
+
+        deframer.reset();
+        deframer.feed(3, stream, on_msg, on_release);
+        REQUIRE(delivered == 5);
+    }
+
+    SECTION("Oversized frame rejected") {
+        alignas(8) char big[16]{};
+        Sofh::encode(big, 8192);
+        SofhDeframer<Sofh, 4096> deframer;
+        deframer.feed(std::span<const char>{big, sizeof(big)}, [](std::span<const char>) {});
+        REQUIRE(deframer.failed());
+    }
+}
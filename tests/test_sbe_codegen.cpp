@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string_view>
+#include <type_traits>
+
+#include "md_test.hpp"  // Generated from tests/schemas/md_test.xml
+
+using namespace nfx::sbe::mdtest;
+
+// ============================================================================
+// Generated Codec Tests (schema md_test.xml)
+// ============================================================================
+
+TEST_CASE("Generated SBE codec layout constants", "[sbe][codegen]") {
+    REQUIRE(Schema::ID == 42);
+    REQUIRE(Schema::VERSION == 3);
+    REQUIRE(MessageHeader::SIZE == 8);
+    REQUIRE(GroupSize8Byte::SIZE == 8);
+    REQUIRE(PRICE9::SIZE == 8);
+
+    REQUIRE(MDIncrementalRefreshBookCodec::TEMPLATE_ID == 46);
+    REQUIRE(MDIncrementalRefreshBookCodec::BLOCK_LENGTH == 11);
+    REQUIRE(MDIncrementalRefreshBookCodec::Offset::MatchEventIndicator == 8);
+    REQUIRE(MDIncrementalRefreshBookCodec::NoMDEntries::BLOCK_LENGTH == 32);
+    REQUIRE(MDIncrementalRefreshBookCodec::NoMDEntries::Offset::MDEntryType == 26);
+    REQUIRE(MDIncrementalRefreshBookCodec::NoOrderIDEntries::DIMENSION_SIZE == 8);
+    REQUIRE(MDIncrementalRefreshBookCodec::NoOrderIDEntries::Offset::ReferenceID == 20);
+
+    // Constant fields take no space
+    REQUIRE(SecurityDefinitionCodec::BLOCK_LENGTH == 24);
+    REQUIRE(SecurityDefinitionCodec::securityExchange() == "XCME");
+    REQUIRE(SecurityDefinitionCodec::mdUpdateAction() == MDUpdateAction::New);
+}
+
+TEST_CASE("Generated SBE codec groups roundtrip", "[sbe][codegen]") {
+    alignas(8) char buffer[256]{};
+
+    auto enc = MDIncrementalRefreshBookCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .transactTime(1'700'000'000'000'000'000ULL);
+    enc.matchEventIndicator().lastQuoteMsg(true).endOfEvent(true);
+
+    auto entries = enc.noMDEntriesCount(2);
+    for (int i = 0; i < 2; ++i) {
+        entries.next()
+            .mdEntrySize(100 + i)
+            .securityID(5000)
+            .rptSeq(static_cast<SbeUint32>(10 + i))
+            .numberOfOrders(entries.numberOfOrdersNullValue())
+            .mdPriceLevel(static_cast<SbeUint8>(i + 1))
+            .mdUpdateAction(MDUpdateAction::Change)
+            .mdEntryType(i == 0 ? MDEntryTypeBook::Bid : MDEntryTypeBook::Offer);
+        entries.mdEntryPx().mantissa(4'500'250'000'000LL + i);
+    }
+    auto orders = enc.noOrderIDEntriesCount(1);
+    orders.next().orderID(77).mdOrderPriority(3).mdDisplayQty(5).referenceID(1);
+
+    const std::size_t size = enc.encodedLength();
+    REQUIRE(size == 8 + 11 + 3 + 2 * 32 + 8 + 24);
+
+    auto dec = MDIncrementalRefreshBookCodec::wrapForDecode(buffer, size);
+    REQUIRE(dec.isValid());
+    REQUIRE(dec.header().schemaId() == Schema::ID);
+    REQUIRE(dec.transactTime() == 1'700'000'000'000'000'000ULL);
+    REQUIRE(dec.matchEventIndicator().lastQuoteMsg());
+    REQUIRE(dec.matchEventIndicator().endOfEvent());
+    REQUIRE_FALSE(dec.matchEventIndicator().lastTradeMsg());
+
+    auto md = dec.noMDEntries();
+    REQUIRE(md.count() == 2);
+    int seen = 0;
+    md.forEach([&](auto& e) {
+        REQUIRE(e.mdEntryPx().mantissa() == 4'500'250'000'000LL + seen);
+        REQUIRE(e.mdEntryPx().exponent() == -9);
+        REQUIRE(e.hasMDEntrySize());
+        REQUIRE(e.mdEntrySize() == 100 + seen);
+        REQUIRE_FALSE(e.hasNumberOfOrders());
+        REQUIRE(e.rptSeq() == static_cast<SbeUint32>(10 + seen));
+        REQUIRE(e.mdUpdateAction() == MDUpdateAction::Change);
+        REQUIRE(e.mdEntryType() == (seen == 0 ? MDEntryTypeBook::Bid : MDEntryTypeBook::Offer));
+        ++seen;
+    });
+    REQUIRE(seen == 2);
+
+    auto ord = dec.noOrderIDEntries();
+    REQUIRE(ord.count() == 1);
+    REQUIRE(ord.hasNext());
+    ord.next();
+    REQUIRE(ord.orderID() == 77);
+    REQUIRE(ord.mdDisplayQty() == 5);
+    REQUIRE(ord.referenceID() == 1);
+    REQUIRE_FALSE(ord.hasNext());
+    REQUIRE(dec.encodedLength() == size);
+}
+
+TEST_CASE("Generated SBE codec nested groups and var-data", "[sbe][codegen]") {
+    alignas(8) char buffer[256]{};
+
+    auto enc = SecurityDefinitionCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .securityID(123)
+        .symbol("ESZ5");
+    auto events = enc.noEventsCount(2);
+    for (int i = 0; i < 2; ++i) {
+        events.next().eventType(static_cast<SbeUint8>(i + 5)).eventTime(1000U + static_cast<unsigned>(i));
+        auto legs = events.noLegsCount(static_cast<std::size_t>(i + 1));
+        for (int l = 0; l <= i; ++l) {
+            legs.next().legSecurityID(900 + l);
+            legs.legNote(l == 0 ? "front" : "back");
+        }
+    }
+    enc.text("E-mini S&P 500");
+
+    auto dec = SecurityDefinitionCodec::wrapForDecode(buffer, enc.encodedLength());
+    REQUIRE(dec.isValid());
+    REQUIRE(dec.securityID() == 123);
+    REQUIRE(dec.symbol() == "ESZ5");
+
+    auto ev = dec.noEvents();
+    REQUIRE(ev.count() == 2);
+    int legs_seen = 0;
+    while (ev.hasNext()) {
+        ev.next();
+        const int i = static_cast<int>(ev.index()) - 1;
+        REQUIRE(ev.eventType() == i + 5);
+        auto legs = ev.noLegs();
+        REQUIRE(legs.count() == static_cast<std::size_t>(i + 1));
+        while (legs.hasNext()) {
+            legs.next();
+            REQUIRE(legs.legSecurityID() == 900 + static_cast<int>(legs.index()) - 1);
+            REQUIRE(legs.legNote() == (legs.index() == 1 ? "front" : "back"));
+            ++legs_seen;
+        }
+    }
+    REQUIRE(legs_seen == 3);
+    REQUIRE(dec.text() == "E-mini S&P 500");
+    REQUIRE(dec.encodedLength() == enc.encodedLength());
+
+    // Truncated var-data decodes as empty rather than reading past the end
+    auto cut = SecurityDefinitionCodec::wrapForDecode(buffer, enc.encodedLength() - 1);
+    auto cut_ev = cut.noEvents();
+    cut_ev.forEach([](auto& e) { e.noLegs().forEach([](auto& l) { (void)l.legNote(); }); });
+    REQUIRE(cut.text().empty());
+}
+
+TEST_CASE("Generated SBE dispatch jump table", "[sbe][codegen][dispatch]") {
+    alignas(8) char buffer[64]{};
+
+    ChannelResetCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .transactTime(99);
+
+    int hits = 0;
+    dispatch(buffer, sizeof(buffer), [&](auto& codec) {
+        using T = std::decay_t<decltype(codec)>;
+        if constexpr (std::is_same_v<T, ChannelResetCodec>) {
+            REQUIRE(codec.transactTime() == 99);
+            ++hits;
+        }
+    });
+    REQUIRE(hits == 1);
+
+    // Gap in the table (templateId 5), out of range and foreign schema
+    const SbeUint16 unknown_ids[] = {5, 3, 47, 1000};
+    for (SbeUint16 id : unknown_ids) {
+        MessageHeader{buffer}.templateId(id);
+        SbeUint16 reported = 0;
+        dispatch(buffer, sizeof(buffer), [&](auto& codec) {
+            using T = std::decay_t<decltype(codec)>;
+            if constexpr (std::is_same_v<T, UnknownMessage>) reported = codec.templateId;
+        });
+        REQUIRE(reported == id);
+    }
+
+    MessageHeader{buffer}.templateId(ChannelResetCodec::TEMPLATE_ID).schemaId(7);
+    bool unknown = false;
+    dispatch(buffer, sizeof(buffer), [&](auto& codec) {
+        unknown = std::is_same_v<std::decay_t<decltype(codec)>, UnknownMessage>;
+    });
+    REQUIRE(unknown);
+}
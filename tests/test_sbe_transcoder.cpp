@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <span>
+#include <string_view>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/sbe/transcoder.hpp"
+
+using namespace nfx;
+using sbe::ExecutionReportCodec;
+using sbe::NewOrderSingleCodec;
+
+// ============================================================================
+// FIX <-> SBE Transcoder Tests
+// ============================================================================
+
+TEST_CASE("UTCTimestamp parse/format", "[sbe][transcode][timestamp]") {
+    Timestamp ts;
+
+    SECTION("Fraction precisions") {
+        REQUIRE(parse_utc_timestamp("20240115-10:30:00", ts));
+        REQUIRE(ts.nanos == 1'705'314'600'000'000'000LL);
+        REQUIRE(parse_utc_timestamp("20240115-10:30:00.123", ts));
+        REQUIRE(ts.nanos == 1'705'314'600'123'000'000LL);
+        REQUIRE(parse_utc_timestamp("20240115-10:30:00.123456789", ts));
+        REQUIRE(ts.nanos == 1'705'314'600'123'456'789LL);
+        REQUIRE(parse_utc_timestamp("19700101-00:00:00.000001", ts));
+        REQUIRE(ts.nanos == 1'000);
+        REQUIRE(parse_utc_timestamp("20000229-23:59:59", ts));
+        REQUIRE(ts.nanos == 951'868'799'000'000'000LL);
+    }
+
+    SECTION("Malformed input leaves value untouched") {
+        ts = Timestamp{42};
+        const std::string_view bad[] = {
+            "", "20240115", "20240115 10:30:00", "20241315-10:30:00",
+            "20240115-24:00:00", "20240115-10:30:00.", "20240115-10:30:00.1234567890",
+            "2024O115-10:30:00", "20240115-10:30:00,123"};
+        for (auto s : bad) {
+            REQUIRE_FALSE(parse_utc_timestamp(s, ts));
+        }
+        REQUIRE(ts.nanos == 42);
+    }
+
+    SECTION("Format round trip") {
+        UtcTimestampText text;
+        Timestamp t{1'705'314'600'123'456'789LL};
+        REQUIRE(format_utc_timestamp(t, text) == "20240115-10:30:00.123");
+        REQUIRE(format_utc_timestamp(t, text, 0) == "20240115-10:30:00");
+        REQUIRE(format_utc_timestamp(t, text, 6) == "20240115-10:30:00.123456");
+        REQUIRE(format_utc_timestamp(t, text, 9) == "20240115-10:30:00.123456789");
+        REQUIRE(format_utc_timestamp(Timestamp{-1}, text, 9) == "19691231-23:59:59.999999999");
+
+        Timestamp back;
+        REQUIRE(parse_utc_timestamp(format_utc_timestamp(t, text, 9), back));
+        REQUIRE(back.nanos == t.nanos);
+    }
+
+    static_assert([] {
+        Timestamp t;
+        return parse_utc_timestamp("20240115-10:30:00.5", t) &&
+               t.nanos == 1'705'314'600'500'000'000LL;
+    }());
+}
+
+TEST_CASE("Transcode NewOrderSingle FIX -> SBE -> FIX", "[sbe][transcode][nos]") {
+    MessageAssembler asm_;
+    auto fix_msg = fix44::NewOrderSingle::Builder{}
+        .sender_comp_id("CLIENT")
+        .target_comp_id("GW")
+        .msg_seq_num(7)
+        .sending_time("20240115-10:30:00.125")
+        .cl_ord_id("ORD-0001")
+        .symbol("AAPL")
+        .side(Side::Sell)
+        .transact_time("20240115-10:30:00.123")
+        .order_qty(Qty::from_int(250))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25))
+        .build(asm_);
+
+    auto parsed = IndexedParser::parse(fix_msg);
+    REQUIRE(parsed.has_value());
+
+    alignas(8) char sbe_buf[NewOrderSingleCodec::TOTAL_SIZE];
+    auto encoded = sbe::transcode_to_sbe(*parsed, sbe_buf);
+    REQUIRE(encoded.has_value());
+    REQUIRE(encoded->size() == NewOrderSingleCodec::TOTAL_SIZE);
+
+    auto codec = NewOrderSingleCodec::wrapForDecode(sbe_buf, sizeof(sbe_buf));
+    REQUIRE(codec.isValid());
+    REQUIRE(codec.clOrdId() == "ORD-0001");
+    REQUIRE(codec.symbol() == "AAPL");
+    REQUIRE(codec.side() == Side::Sell);
+    REQUIRE(codec.ordType() == OrdType::Limit);
+    REQUIRE(codec.price().raw == 15'025'000'000LL);
+    REQUIRE(codec.orderQty().whole() == 250);
+    REQUIRE(codec.transactTime().nanos == 1'705'314'600'123'000'000LL);
+
+    // Outbound: SBE -> FIX builder, then re-parse the text
+    fix44::NewOrderSingle::Builder out;
+    UtcTimestampText ts_text;
+    REQUIRE(sbe::transcode_to_fix(codec, out, ts_text));
+    MessageAssembler out_asm;
+    auto out_msg = out.sender_comp_id("GW").target_comp_id("VENUE").msg_seq_num(3)
+        .sending_time("20240115-10:30:00.130").build(out_asm);
+
+    auto back = fix44::NewOrderSingle::from_buffer(out_msg);
+    REQUIRE(back.has_value());
+    REQUIRE(back->cl_ord_id == "ORD-0001");
+    REQUIRE(back->symbol == "AAPL");
+    REQUIRE(back->side == Side::Sell);
+    REQUIRE(back->order_qty.whole() == 250);
+    REQUIRE(back->price.raw == 15'025'000'000LL);
+    REQUIRE(back->transact_time == "20240115-10:30:00.123");
+}
+
+TEST_CASE("Transcode ExecutionReport from schema-projected parse", "[sbe][transcode][execrpt]") {
+    MessageAssembler asm_;
+    auto fix_msg = fix44::ExecutionReport::Builder{}
+        .sender_comp_id("VENUE")
+        .target_comp_id("GW")
+        .msg_seq_num(11)
+        .sending_time("20240115-10:30:00.200")
+        .order_id("EX001")
+        .exec_id("EXEC001")
+        .exec_type(ExecType::PartialFill)
+        .ord_status(OrdStatus::PartiallyFilled)
+        .symbol("MSFT")
+        .side(Side::Buy)
+        .leaves_qty(Qty::from_int(50))
+        .cum_qty(Qty::from_int(50))
+        .avg_px(FixedPrice::from_double(410.5))
+        .cl_ord_id("ORD-0002")
+        .order_qty(Qty::from_int(100))
+        .last_px(FixedPrice::from_double(410.5))
+        .last_qty(Qty::from_int(50))
+        .transact_time("20240115-10:30:00.199123")
+        .build(asm_);
+
+    using FillSchema = MessageSchema<
+        FieldSpec<tag::OrderID::value>,
+        FieldSpec<tag::ExecID::value>,
+        FieldSpec<tag::ExecType::value>,
+        FieldSpec<tag::OrdStatus::value>,
+        FieldSpec<tag::Symbol::value>,
+        FieldSpec<tag::Side::value>,
+        FieldSpec<tag::LeavesQty::value>,
+        FieldSpec<tag::CumQty::value>,
+        FieldSpec<tag::AvgPx::value>,
+        FieldSpec<tag::LastPx::value, FieldRequirement::Optional>,
+        FieldSpec<tag::LastQty::value, FieldRequirement::Optional>,
+        FieldSpec<tag::TransactTime::value, FieldRequirement::Optional>
+    >;
+
+    auto parsed = parse_as<FillSchema>(fix_msg, '8');
+    REQUIRE(parsed.has_value());
+
+    alignas(8) char sbe_buf[ExecutionReportCodec::TOTAL_SIZE];
+    auto encoded = sbe::transcode_execution_report(*parsed, sbe_buf);
+    REQUIRE(encoded.has_value());
+
+    auto codec = ExecutionReportCodec::wrapForDecode(sbe_buf, sizeof(sbe_buf));
+    REQUIRE(codec.isValid());
+    REQUIRE(codec.orderId() == "EX001");
+    REQUIRE(codec.execId() == "EXEC001");
+    REQUIRE(codec.clOrdId().empty());       // not in the schema
+    REQUIRE(codec.orderQty().raw == 0);     // not in the schema
+    REQUIRE(codec.symbol() == "MSFT");
+    REQUIRE(codec.execType() == ExecType::PartialFill);
+    REQUIRE(codec.ordStatus() == OrdStatus::PartiallyFilled);
+    REQUIRE(codec.lastPx().raw == 41'050'000'000LL);
+    REQUIRE(codec.lastQty().whole() == 50);
+    REQUIRE(codec.leavesQty().whole() == 50);
+    REQUIRE(codec.avgPx().raw == 41'050'000'000LL);
+    REQUIRE(codec.transactTime().nanos == 1'705'314'600'199'123'000LL);
+
+    fix44::ExecutionReport::Builder out;
+    UtcTimestampText ts_text;
+    REQUIRE(sbe::transcode_to_fix(codec, out, ts_text));
+    MessageAssembler out_asm;
+    auto back = fix44::ExecutionReport::from_buffer(
+        out.sender_comp_id("GW").target_comp_id("CLIENT").msg_seq_num(4)
+            .sending_time("20240115-10:30:00.201").build(out_asm));
+    REQUIRE(back.has_value());
+    REQUIRE(back->order_id == "EX001");
+    REQUIRE(back->exec_type == ExecType::PartialFill);
+    REQUIRE(back->last_qty.whole() == 50);
+    REQUIRE(back->avg_px.raw == 41'050'000'000LL);
+    REQUIRE(back->transact_time == "20240115-10:30:00.199");
+}
+
+TEST_CASE("Transcode rejects bad input", "[sbe][transcode]") {
+    MessageAssembler asm_;
+    auto builder = fix44::NewOrderSingle::Builder{}
+        .sender_comp_id("CLIENT")
+        .target_comp_id("GW")
+        .msg_seq_num(1)
+        .sending_time("20240115-10:30:00.000")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .order_qty(Qty::from_int(1))
+        .ord_type(OrdType::Market);
+    alignas(8) char sbe_buf[ExecutionReportCodec::TOTAL_SIZE];
+
+    SECTION("Missing required field") {
+        auto parsed = IndexedParser::parse(builder.build(asm_));
+        REQUIRE(parsed.has_value());
+        auto result = sbe::transcode_to_sbe(*parsed, sbe_buf);
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(result.error().tag == tag::ClOrdID::value);
+    }
+
+    SECTION("Identifier wider than the SBE field") {
+        auto parsed = IndexedParser::parse(
+            builder.cl_ord_id("THIS-CLORDID-IS-TOO-LONG").build(asm_));
+        REQUIRE(parsed.has_value());
+        auto result = sbe::transcode_to_sbe(*parsed, sbe_buf);
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidFieldFormat);
+        REQUIRE(result.error().tag == tag::ClOrdID::value);
+    }
+
+    SECTION("Malformed TransactTime") {
+        auto parsed = IndexedParser::parse(
+            builder.cl_ord_id("ORD").transact_time("2024-01-15T10:30").build(asm_));
+        REQUIRE(parsed.has_value());
+        auto result = sbe::transcode_to_sbe(*parsed, sbe_buf);
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().tag == tag::TransactTime::value);
+    }
+
+    SECTION("Wrong MsgType and short buffer") {
+        auto parsed = IndexedParser::parse(builder.cl_ord_id("ORD").build(asm_));
+        REQUIRE(parsed.has_value());
+        REQUIRE(sbe::transcode_execution_report(*parsed, sbe_buf).error().code ==
+                ParseErrorCode::InvalidMsgType);
+        REQUIRE(sbe::transcode_new_order_single(*parsed, std::span<char>{sbe_buf, 16}).error().code ==
+                ParseErrorCode::BufferTooShort);
+        REQUIRE(sbe::transcode_new_order_single(*parsed, sbe_buf).has_value());
+    }
+}
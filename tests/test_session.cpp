@@ -0,0 +1,5051 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/session/acceptor_engine.hpp"
+#include "nexusfix/session/async_session.hpp"
+#include "nexusfix/session/sharded_runtime.hpp"
+#include "nexusfix/session/duplicate_filter.hpp"
+#include "nexusfix/session/exchange_simulator.hpp"
+#include "nexusfix/session/fixp_session.hpp"
+#include "nexusfix/session/kill_switch.hpp"
+#include "nexusfix/session/message_router.hpp"
+#include "nexusfix/session/risk_check.hpp"
+#include "nexusfix/session/rtt_probe.hpp"
+#include "nexusfix/session/session_warmup.hpp"
+#include "nexusfix/session/session_replay.hpp"
+#include "nexusfix/session/submission_gateway.hpp"
+#include "nexusfix/sbe/codecs/new_order_single.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/memory/hibernation_pool.hpp"
+#include "nexusfix/store/audit_tap.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/async_channel.hpp"
+#include "nexusfix/transport/endpoint_cache.hpp"
+#include "nexusfix/transport/send_backpressure.hpp"
+#include "nexusfix/transport/ktls.hpp"
+#include "nexusfix/transport/metrics_http.hpp"
+#include "nexusfix/transport/tcp_replication_link.hpp"
+#include "nexusfix/store/mmap_message_store.hpp"
+#include "nexusfix/store/order_table.hpp"
+#include "nexusfix/store/replication.hpp"
+#include "nexusfix/store/session_control_block.hpp"
+#include "nexusfix/store/store_recovery.hpp"
+#include "nexusfix/store/tiered_message_store.hpp"
+#include "nexusfix/store/top_of_book_store.hpp"
+#include "nexusfix/store/trade_aggregates.hpp"
+#include "nexusfix/types/utc_timestamp.hpp"
+
+using namespace nfx;
+
+namespace {
+
+/// Build a complete FIX 4.4 message with correct BodyLength and CheckSum
+std::string make_message(std::string_view msg_type, uint32_t seq, std::string_view body = {},
+                         std::string_view begin_string = "FIX.4.4") {
+    std::string fields = "35=" + std::string{msg_type} + "\x01" "49=BROKER\x01" "56=CLIENT\x01"
+                         "34=" + std::to_string(seq) + "\x01" "52=20240102-09:30:00.000\x01";
+    fields += body;
+    std::string msg = "8=" + std::string{begin_string} + "\x01" "9=" +
+                      std::to_string(fields.size()) + "\x01" + fields;
+    auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+/// Handler with typed hooks for ExecutionReport and TradeCaptureReport
+struct RecordingHandler {
+    std::vector<std::string>* sent{nullptr};
+    std::string routed;
+    int logons{0};
+
+    void on_app_message(const ParsedMessage& msg) noexcept {
+        routed += "app:" + std::string{msg.get_string(tag::MsgType::value)} + ";";
+    }
+    void on_message(MsgTypeTag<'8'>, const ParsedMessage&) noexcept { routed += "exec;"; }
+    void on_message(MsgTypeTag<'A', 'E'>, const ParsedMessage&) noexcept { routed += "tcr;"; }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char> data) noexcept {
+        if (sent) sent->emplace_back(data.data(), data.size());
+        return true;
+    }
+    void on_error(const SessionError&) noexcept { routed += "error;"; }
+    void on_logon() noexcept { ++logons; }
+    void on_logout(std::string_view) noexcept {}
+};
+
+static_assert(SessionHandler<RecordingHandler>);
+static_assert(HasOnMsgType<RecordingHandler, '8'>);
+static_assert(HasOnMsgType<RecordingHandler, 'A', 'E'>);
+static_assert(!HasOnMsgType<RecordingHandler, 'D'>);
+
+SessionConfig client_config() {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "BROKER";
+    return config;
+}
+
+template <typename Session>
+void feed(Session& session, const std::string& msg) {
+    session.on_data_received(std::span<const char>{msg.data(), msg.size()});
+}
+
+}  // namespace
+
+TEST_CASE("SessionManager compile-time MsgType dispatch", "[session][dispatch]") {
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    REQUIRE(sent.size() == 1);
+    REQUIRE(sent[0].find("\x01" "35=A\x01") != std::string::npos);
+
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+    REQUIRE(session.handler().logons == 1);
+
+    SECTION("Typed hooks, generic fallback and two-character types") {
+        feed(session, make_message("8", 2));
+        feed(session, make_message("D", 3));
+        feed(session, make_message("AE", 4));
+        feed(session, make_message("AF", 5));
+        feed(session, make_message("U1", 6));
+        REQUIRE(session.handler().routed == "exec;app:D;tcr;app:AF;app:U1;");
+    }
+
+    SECTION("Admin messages stay in the session") {
+        feed(session, make_message("0", 2));
+        REQUIRE(session.stats().heartbeats_received == 1);
+
+        feed(session, make_message("1", 3, "112=PING\x01"));
+        REQUIRE(sent.size() == 2);
+        REQUIRE(sent[1].find("\x01" "35=0\x01") != std::string::npos);
+        REQUIRE(sent[1].find("112=PING\x01") != std::string::npos);
+        REQUIRE(session.handler().routed.empty());
+    }
+}
+
+TEST_CASE("SessionManager std::function adapter", "[session][callbacks]") {
+    SessionManager session{client_config()};
+    static_assert(std::is_same_v<decltype(session), SessionManager<CallbackSessionHandler>>);
+
+    session.on_connect();
+    REQUIRE_FALSE(session.initiate_logon().has_value());  // No on_send yet
+
+    std::vector<std::string> routed;
+    int sends = 0;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [&](std::span<const char>) { ++sends; return true; };
+    callbacks.on_app_message = [&](const ParsedMessage& msg) {
+        routed.emplace_back(msg.get_string(tag::MsgType::value));
+    };
+    session.set_callbacks(std::move(callbacks));
+
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    feed(session, make_message("8", 2));
+    feed(session, make_message("AE", 3));
+    REQUIRE(routed == std::vector<std::string>{"8", "AE"});
+    REQUIRE(sends == 1);
+}
+
+TEST_CASE("SessionManager fixed to one FIX version", "[session][version]") {
+    std::vector<std::string> sent;
+
+    SECTION("FIXT.1.1 / FIX 5.0 SP2") {
+        Fix50Sp2SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+        static_assert(std::is_same_v<decltype(session)::Admin::Logon, fixt11::Logon>);
+        REQUIRE(session.session_id().begin_string == "FIXT.1.1");
+
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        REQUIRE(sent[0].starts_with("8=FIXT.1.1\x01"));
+        REQUIRE(sent[0].find("\x01" "1137=9\x01") != std::string::npos);
+
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01" "1137=9\x01", "FIXT.1.1"));
+        REQUIRE(session.state() == SessionState::Active);
+        REQUIRE(session.counterparty_appl_ver_id() == appl_ver_id::FIX_5_0_SP2);
+
+        feed(session, make_message("1", 2, "112=PING\x01", "FIXT.1.1"));
+        REQUIRE(sent.size() == 2);
+        REQUIRE(sent[1].starts_with("8=FIXT.1.1\x01"));
+
+        // A FIX 4.4 message on a FIXT session is refused with a Logout
+        feed(session, make_message("0", 3, {}, "FIX.4.4"));
+        REQUIRE(session.state() == SessionState::LogoutPending);
+        REQUIRE(sent.back().find("58=Incorrect BeginString\x01") != std::string::npos);
+    }
+
+    SECTION("FIX 4.4 ignores the configured BeginString") {
+        SessionConfig config = client_config();
+        config.begin_string = "FIX.4.2";
+        Fix44SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        REQUIRE(sent[0].starts_with("8=FIX.4.4\x01"));
+        REQUIRE(sent[0].find("1137=") == std::string::npos);
+
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+        REQUIRE(session.counterparty_appl_ver_id() == '\0');
+    }
+}
+
+namespace {
+
+/// Handler that lends a caller-owned buffer, like a registered io_uring slot
+struct BufferLendingHandler {
+    std::span<char> slot;
+    std::vector<std::string>* sent{nullptr};
+    int leased{0};
+    int sent_in_place{0};
+
+    std::span<char> acquire_send_buffer() noexcept {
+        ++leased;
+        return slot;
+    }
+    bool on_send(std::span<const char> data) noexcept {
+        if (data.data() == slot.data()) ++sent_in_place;
+        sent->emplace_back(data.data(), data.size());
+        return true;
+    }
+    void on_app_message(const ParsedMessage&) noexcept {}
+    void on_state_change(SessionState, SessionState) noexcept {}
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+static_assert(HasSendBuffer<BufferLendingHandler>);
+static_assert(!HasSendBuffer<RecordingHandler>);
+
+}  // namespace
+
+TEST_CASE("SessionManager builds app messages into handler buffers", "[session][zero-copy]") {
+    std::array<char, 512> slot{};
+    std::vector<std::string> sent;
+    SessionManager<BufferLendingHandler> session{
+        client_config(), BufferLendingHandler{slot, &sent, 0, 0}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+    REQUIRE(session.handler().leased == 0);  // Admin messages use the session buffer
+
+    fix44::NewOrderSingle::Builder order;
+    order.cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25));
+    REQUIRE(session.send_app_message(order).has_value());
+
+    REQUIRE(session.handler().leased == 1);
+    REQUIRE(session.handler().sent_in_place == 1);
+    REQUIRE(sent.size() == 2);
+
+    // Same bytes the internal buffer would have produced
+    MessageAssembler assembler;
+    auto expected = order.sender_comp_id("CLIENT").target_comp_id("BROKER")
+        .msg_seq_num(2).sending_time(sent[1].substr(sent[1].find("52=") + 3, 21))
+        .build(assembler);
+    REQUIRE(sent[1] == std::string(expected.data(), expected.size()));
+
+    auto parsed = ParsedMessage::parse(std::span<const char>{slot.data(), sent[1].size()});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get_string(tag::ClOrdID::value) == "ORD1");
+}
+
+
+namespace {
+
+/// Handler that keeps per-message state in the session's inbound arena
+struct ArenaHandler {
+    struct Fill {
+        std::string_view symbol;
+        int64_t qty;
+    };
+
+    memory::InboundArena* arena{nullptr};
+    std::vector<const Fill*> fills;
+
+    void bind_inbound_arena(memory::InboundArena& a) noexcept { arena = &a; }
+    void on_app_message(const ParsedMessage& msg) noexcept {
+        fills.push_back(arena->make<Fill>(arena->copy(msg.get_string(tag::Symbol::value)),
+                                          msg.get_int(tag::OrderQty::value).value_or(0)));
+    }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char>) noexcept { return true; }
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+static_assert(HasInboundArena<ArenaHandler>);
+static_assert(!HasInboundArena<RecordingHandler>);
+
+}  // namespace
+
+TEST_CASE("SessionManager per-batch inbound arena", "[session][arena]") {
+    SessionManager<ArenaHandler> session{client_config()};
+    REQUIRE(session.handler().arena == &session.inbound_arena());
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    session.end_receive_batch();
+    const uint64_t epoch = session.inbound_arena().epoch();
+
+    // One receive completion carrying two messages; the receive buffers
+    // (temporaries here) are gone before the fills are read
+    feed(session, make_message("8", 2, "55=AAPL\x01" "38=100\x01"));
+    feed(session, make_message("8", 3, "55=MSFT\x01" "38=250\x01"));
+
+    const auto& fills = session.handler().fills;
+    REQUIRE(fills.size() == 2);
+    REQUIRE(fills[0]->symbol == "AAPL");
+    REQUIRE(fills[0]->qty == 100);
+    REQUIRE(fills[1]->symbol == "MSFT");
+    REQUIRE(fills[1]->qty == 250);
+    REQUIRE(session.inbound_arena().bytes_allocated() > 0);
+
+    session.end_receive_batch();
+    REQUIRE(session.inbound_arena().epoch() == epoch + 1);
+    REQUIRE(session.inbound_arena().bytes_allocated() == 0);
+}
+
+namespace {
+
+/// Handler that feeds the session another message from inside a callback
+struct ReentrantHandler {
+    std::function<void()> reenter;
+    std::string routed;
+
+    void on_app_message(const ParsedMessage& msg) noexcept {
+        const auto seq = msg.msg_seq_num();
+        if (reenter) std::exchange(reenter, nullptr)();
+        // The outer message must survive the nested parse
+        routed += std::to_string(seq) + ":" + std::string{msg.get_string(tag::Symbol::value)} + ";";
+    }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char>) noexcept { return true; }
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+}  // namespace
+
+TEST_CASE("SessionManager reuses one inbound message", "[session][parse]") {
+    SessionManager<ReentrantHandler> session{client_config()};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    feed(session, make_message("D", 2, "55=AAPL\x01"));
+    feed(session, make_message("D", 3, "55=MSFT\x01"));
+    REQUIRE(session.handler().routed == "2:AAPL;3:MSFT;");
+
+    SECTION("A nested on_data_received does not overwrite the outer message") {
+        const std::string nested = make_message("D", 5, "55=IBM\x01");
+        session.handler().reenter = [&] { feed(session, nested); };
+        feed(session, make_message("D", 4, "55=GOOG\x01"));
+        REQUIRE(session.handler().routed == "2:AAPL;3:MSFT;5:IBM;4:GOOG;");
+
+        feed(session, make_message("D", 6, "55=TSLA\x01"));
+        REQUIRE(session.handler().routed == "2:AAPL;3:MSFT;5:IBM;4:GOOG;6:TSLA;");
+    }
+}
+
+namespace {
+
+/// Handler taking application messages a receive batch at a time
+struct BatchedDeliveryHandler {
+    std::string log;
+
+    void on_app_messages(std::span<const ParsedMessage> msgs) noexcept {
+        log += "batch:";
+        for (const auto& msg : msgs) {
+            log += std::to_string(msg.msg_seq_num()) + "=" +
+                   std::string{msg.get_string(tag::Symbol::value)} + ",";
+        }
+        log += ";";
+    }
+    void on_app_message(const ParsedMessage& msg) noexcept {
+        log += "single:" + std::to_string(msg.msg_seq_num()) + ";";
+    }
+    void on_message(MsgTypeTag<'8'>, const ParsedMessage&) noexcept { log += "typed;"; }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char> data) noexcept {
+        if (std::string_view{data.data(), data.size()}.find("\x01" "35=0\x01") != std::string_view::npos) {
+            log += "heartbeat;";
+        }
+        return true;
+    }
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+static_assert(HasBatchedDelivery<BatchedDeliveryHandler>);
+static_assert(!HasBatchedDelivery<RecordingHandler>);
+
+}  // namespace
+
+TEST_CASE("SessionManager delivers application messages in batches", "[session][batch]") {
+    SessionConfig config = client_config();
+    config.inbound_batch_messages = 3;
+    SessionManager<BatchedDeliveryHandler> session{config};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    session.end_receive_batch();
+    REQUIRE(session.state() == SessionState::Active);
+    auto& log = session.handler().log;
+
+    SECTION("One call per receive batch; the receive buffers are gone by then") {
+        feed(session, make_message("8", 2, "55=AAPL\x01"));
+        feed(session, make_message("D", 3, "55=MSFT\x01"));
+        REQUIRE(log.empty());
+        session.end_receive_batch();
+        REQUIRE(log == "batch:2=AAPL,3=MSFT,;");
+        REQUIRE(session.sequences().expected_inbound() == 4);
+
+        session.end_receive_batch();  // Nothing pending
+        REQUIRE(log == "batch:2=AAPL,3=MSFT,;");
+    }
+
+    SECTION("Session-level messages are handled after the messages before them") {
+        feed(session, make_message("8", 2, "55=AAPL\x01"));
+        feed(session, make_message("1", 3, "112=PING\x01"));
+        feed(session, make_message("8", 4, "55=IBM\x01"));
+        session.end_receive_batch();
+        REQUIRE(log == "batch:2=AAPL,;heartbeat;batch:4=IBM,;");
+    }
+
+    SECTION("A full batch is delivered before the next message is staged") {
+        for (uint32_t seq = 2; seq <= 6; ++seq) {
+            feed(session, make_message("8", seq, "55=X\x01"));
+        }
+        REQUIRE(log == "batch:2=X,3=X,4=X,;");
+        session.end_receive_batch();
+        REQUIRE(log == "batch:2=X,3=X,4=X,;batch:5=X,6=X,;");
+    }
+
+    SECTION("Rejected seqnums are not delivered") {
+        feed(session, make_message("8", 2, "55=AAPL\x01"));
+        feed(session, make_message("8", 2, "55=AAPL\x01"));  // Too low, no PossDup
+        session.end_receive_batch();
+        REQUIRE(log == "batch:2=AAPL,;");
+    }
+}
+
+TEST_CASE("MsgType filter skips ignored inbound messages", "[session][filter]") {
+    MsgTypeFilter filter;
+    REQUIRE(filter.empty());
+    REQUIRE(filter.ignore("B"));
+    REQUIRE(filter.ignore("BE"));
+    REQUIRE_FALSE(filter.ignore("0"));    // Session-level types always dispatch
+    REQUIRE_FALSE(filter.ignore("A"));
+    REQUIRE_FALSE(filter.ignore("ABC"));  // Not representable
+    REQUIRE(filter.ignores("B"));
+    REQUIRE(filter.ignores("BE"));
+    REQUIRE_FALSE(filter.ignores("BF"));
+    filter.allow("BE");
+    REQUIRE_FALSE(filter.ignores("BE"));
+
+    const std::string news = make_message("B", 7, "148=Headline\x01");
+    const HeaderPeek peek = peek_header(std::span<const char>{news.data(), news.size()});
+    REQUIRE(peek.ok());
+    REQUIRE(peek.msg_type == "B");
+    REQUIRE(peek.msg_seq_num == 7);
+    REQUIRE_FALSE(peek_header(std::span<const char>{news.data(), 20}).ok());
+
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.msg_type_filter.ignore("B");
+    config.msg_type_filter.ignore("h");
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    SECTION("In-sequence ignored types advance the sequence without dispatch") {
+        feed(session, make_message("B", 2, "148=Headline\x01"));
+        feed(session, make_message("h", 3, "340=2\x01"));
+        feed(session, make_message("8", 4));
+        REQUIRE(session.handler().routed == "exec;");
+        REQUIRE(session.stats().messages_filtered == 2);
+        REQUIRE(session.sequences().expected_inbound() == 5);
+    }
+
+    SECTION("A gap still takes the full path and requests a resend") {
+        feed(session, make_message("B", 4, "148=Headline\x01"));
+        REQUIRE(sent.size() == 2);
+        REQUIRE(sent[1].find("\x01" "35=2\x01") != std::string::npos);
+        REQUIRE(session.handler().routed.empty());
+        REQUIRE(session.stats().messages_filtered == 1);
+    }
+
+    SECTION("Admin messages are never filtered") {
+        feed(session, make_message("0", 2));
+        REQUIRE(session.stats().heartbeats_received == 1);
+        REQUIRE(session.stats().messages_filtered == 0);
+    }
+}
+
+TEST_CASE("PossDup rewrite for resend", "[session][resend]") {
+    const std::string original = make_message("D", 7, "11=ORD7\x01" "55=AAPL\x01");
+    const std::string_view now = "20240102-10:00:00.000";
+
+    std::vector<char> out(resend_rewrite_capacity(original.size(), now.size()));
+    const size_t n = rewrite_for_resend(original, now, out);
+    REQUIRE(n > original.size());
+    const std::string rewritten{out.data(), n};
+
+    REQUIRE(rewritten.find("\x01" "52=20240102-10:00:00.000\x01" "43=Y\x01"
+                           "122=20240102-09:30:00.000\x01" "11=ORD7\x01") != std::string::npos);
+    REQUIRE(parser::validate_fix_checksum(rewritten));
+
+    auto parsed = ParsedMessage::parse(std::span<const char>{rewritten.data(), n});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get_string(tag::ClOrdID::value) == "ORD7");
+
+    // Resending a resend keeps the first OrigSendingTime and one 43=Y
+    const std::string_view later = "20240102-11:00:00.000";
+    std::vector<char> again(resend_rewrite_capacity(n, later.size()));
+    const size_t m = rewrite_for_resend(rewritten, later, again);
+    REQUIRE(m == n);
+    const std::string twice{again.data(), m};
+    REQUIRE(twice.find("\x01" "52=20240102-11:00:00.000\x01" "43=Y\x01"
+                       "122=20240102-09:30:00.000\x01" "11=ORD7\x01") != std::string::npos);
+    REQUIRE(twice.find("43=", twice.find("43=") + 1) == std::string::npos);
+    REQUIRE(parser::validate_fix_checksum(twice));
+
+    // Malformed, or no room
+    REQUIRE_FALSE(can_rewrite_for_resend(std::string_view{original}.substr(0, original.size() - 1)));
+    REQUIRE(rewrite_for_resend(std::string_view{original}.substr(0, original.size() - 1), now, out) == 0);
+}
+
+TEST_CASE("PossDup rewrite replaces a stored 43=N", "[session][resend]") {
+    const std::string original = make_message("D", 7, "43=N\x01" "11=ORD7\x01" "55=AAPL\x01");
+    const std::string_view now = "20240102-10:00:00.000";
+
+    std::vector<char> out(resend_rewrite_capacity(original.size(), now.size()));
+    const size_t n = rewrite_for_resend(original, now, out);
+    REQUIRE(n > 0);
+    const std::string rewritten{out.data(), n};
+
+    REQUIRE(rewritten.find("\x01" "52=20240102-10:00:00.000\x01" "43=Y\x01"
+                           "122=20240102-09:30:00.000\x01" "11=ORD7\x01") != std::string::npos);
+    REQUIRE(rewritten.find("43=N") == std::string::npos);
+    REQUIRE(parser::validate_fix_checksum(rewritten));
+    auto parsed = ParsedMessage::parse(std::span<const char>{rewritten.data(), n});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get_string(43) == "Y");
+    REQUIRE(rewrite_for_resend(original, now, std::span<char>{out.data(), original.size()}) == 0);
+}
+
+namespace {
+
+/// Handler that takes a whole resend replay in one call
+struct BatchHandler {
+    std::vector<std::string>* sent{nullptr};
+    std::vector<size_t> batches;
+    std::string_view skip;  // Stored messages containing this are not resent
+
+    bool on_send(std::span<const char> data) noexcept {
+        sent->emplace_back(data.data(), data.size());
+        return true;
+    }
+    bool on_send_batch(std::span<const std::span<const char>> msgs) noexcept {
+        batches.push_back(msgs.size());
+        for (auto m : msgs) sent->emplace_back(m.data(), m.size());
+        return true;
+    }
+    bool should_resend(std::span<const char> stored) noexcept {
+        return skip.empty() ||
+               std::string_view{stored.data(), stored.size()}.find(skip) == std::string_view::npos;
+    }
+    void on_app_message(const ParsedMessage&) noexcept {}
+    void on_state_change(SessionState, SessionState) noexcept {}
+    void on_error(const SessionError&) noexcept {}
+    void on_logon() noexcept {}
+    void on_logout(std::string_view) noexcept {}
+};
+
+static_assert(HasOnSendBatch<BatchHandler>);
+static_assert(HasResendFilter<BatchHandler>);
+static_assert(!HasOnSendBatch<RecordingHandler>);
+
+}  // namespace
+
+TEST_CASE("SessionManager answers ResendRequest from the store", "[session][resend]") {
+    std::vector<std::string> sent;
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    SessionManager<BatchHandler> session{client_config(), BatchHandler{&sent, {}, {}}};
+    session.set_message_store(&message_store);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    for (int i = 0; i < 3; ++i) {
+        const std::string cl_ord_id = "ORD" + std::to_string(i + 2);
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25));
+        REQUIRE(session.send_app_message(order).has_value());
+    }
+    REQUIRE(sent.size() == 4);
+    REQUIRE(message_store.retrieve(2).has_value());  // Stored under its own seq
+
+    feed(session, make_message("2", 2, "7=2\x01" "16=4\x01"));
+    REQUIRE(session.handler().batches == std::vector<size_t>{3});
+    REQUIRE(sent.size() == 7);
+    REQUIRE(session.stats().messages_resent == 3);
+
+    for (size_t i = 0; i < 3; ++i) {
+        const std::string& msg = sent[4 + i];
+        REQUIRE(parser::validate_fix_checksum(msg));
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->get_string(tag::ClOrdID::value) == "ORD" + std::to_string(i + 2));
+        REQUIRE(parsed->get_string(43) == "Y");
+        REQUIRE(parsed->get_string(122) == sent[1 + i].substr(sent[1 + i].find("52=") + 3, 21));
+        REQUIRE(msg.find("\x01" "34=" + std::to_string(i + 2) + "\x01") != std::string::npos);
+    }
+}
+
+TEST_CASE("Resend coalesces skipped seqnums into gap fills", "[session][resend]") {
+    std::vector<std::string> sent;
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    SessionManager<BatchHandler> session{client_config(), BatchHandler{&sent, {}, {}}};
+    session.set_message_store(&message_store);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());                     // 1: Logon
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+    auto send_order = [&session](const std::string& cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order).has_value();
+    };
+    REQUIRE(send_order("ORD2"));                                        // 2: D
+    feed(session, make_message("1", 2, "112=A\x01"));                   // 3: Heartbeat
+    feed(session, make_message("1", 3, "112=B\x01"));                   // 4: Heartbeat
+    REQUIRE(send_order("ORD5"));                                        // 5: D
+    REQUIRE(send_order("ORD6"));                                        // 6: D
+    REQUIRE(sent.size() == 6);
+
+    auto seq_of = [](const std::string& msg) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        return parsed ? parsed->get_int(tag::MsgSeqNum::value).value_or(0) : -1;
+    };
+    auto is_gap_fill = [](const std::string& msg, int64_t new_seq_no) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        return parsed && parsed->get_string(tag::MsgType::value) == "4" &&
+               parsed->get_string(123) == "Y" && parsed->get_string(43) == "Y" &&
+               parsed->get_int(36).value_or(0) == new_seq_no;
+    };
+
+    SECTION("Admin runs and the leading Logon become gap fills") {
+        feed(session, make_message("2", 4, "7=1\x01" "16=0\x01"));
+        REQUIRE(session.handler().batches == std::vector<size_t>{5});
+        REQUIRE(sent.size() == 11);
+
+        REQUIRE(is_gap_fill(sent[6], 2));
+        REQUIRE(seq_of(sent[6]) == 1);
+        REQUIRE(seq_of(sent[7]) == 2);
+        REQUIRE(sent[7].find("11=ORD2\x01") != std::string::npos);
+        REQUIRE(is_gap_fill(sent[8], 5));
+        REQUIRE(seq_of(sent[8]) == 3);
+        REQUIRE(seq_of(sent[9]) == 5);
+        REQUIRE(seq_of(sent[10]) == 6);
+        for (size_t i = 6; i < 11; ++i) REQUIRE(parser::validate_fix_checksum(sent[i]));
+
+        REQUIRE(session.stats().gap_fills_sent == 2);
+        REQUIRE(session.stats().messages_resent == 5);
+    }
+
+    SECTION("Filtered messages extend the gap; trailing gap ends the range") {
+        session.handler().skip = "11=ORD5\x01";
+        feed(session, make_message("2", 4, "7=3\x01" "16=5\x01"));
+        REQUIRE(sent.size() == 7);
+        REQUIRE(is_gap_fill(sent[6], 6));
+        REQUIRE(seq_of(sent[6]) == 3);
+        REQUIRE(session.stats().gap_fills_sent == 1);
+    }
+
+    SECTION("Seqnums missing from the store are gap-filled") {
+        message_store.reset();
+        feed(session, make_message("2", 4, "7=2\x01" "16=6\x01"));
+        REQUIRE(sent.size() == 7);
+        REQUIRE(is_gap_fill(sent[6], 7));
+        REQUIRE(seq_of(sent[6]) == 2);
+    }
+}
+
+TEST_CASE("Resend never sends a stored message without 43=Y", "[session][resend]") {
+    std::vector<std::string> sent;
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    SessionManager<BatchHandler> session{client_config(), BatchHandler{&sent, {}, {}}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());                     // 1: Logon
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    for (int i = 0; i < 3; ++i) {                                       // 2-4: D
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("ORD" + std::to_string(i + 2))
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Market);
+        REQUIRE(session.send_app_message(order).has_value());
+    }
+    REQUIRE(sent.size() == 4);
+
+    // Stored as 43=N, larger than the resend arena, and a plain order
+    const std::string big_text(ResendBatch::DEFAULT_ARENA_SIZE, 'x');
+    REQUIRE(message_store.store(2, make_message("D", 2, "43=N\x01" "11=ORD2\x01")));
+    REQUIRE(message_store.store(3, make_message("D", 3, "11=ORD3\x01" "58=" + big_text + "\x01")));
+    REQUIRE(message_store.store(4, make_message("D", 4, "11=ORD4\x01")));
+    session.set_message_store(&message_store);
+
+    feed(session, make_message("2", 2, "7=2\x01" "16=4\x01"));
+    REQUIRE(sent.size() == 7);
+    for (size_t i = 4; i < sent.size(); ++i) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{sent[i].data(), sent[i].size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->get_string(43) == "Y");
+        REQUIRE(parser::validate_fix_checksum(sent[i]));
+        REQUIRE(sent[i].find("43=N") == std::string::npos);
+        REQUIRE(sent[i].find(big_text) == std::string::npos);
+    }
+    REQUIRE(sent[4].find("11=ORD2\x01") != std::string::npos);
+    REQUIRE(sent[5].find("\x01" "35=4\x01") != std::string::npos);    // Gap fill for 3
+    REQUIRE(sent[5].find("\x01" "34=3\x01") != std::string::npos);
+    REQUIRE(sent[5].find("\x01" "36=4\x01") != std::string::npos);
+    REQUIRE(sent[6].find("11=ORD4\x01") != std::string::npos);
+    REQUIRE(session.stats().gap_fills_sent == 1);
+}
+
+TEST_CASE("SessionManager coalesces app sends until flush", "[session][coalesce]") {
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.coalesce_sends = true;
+    SessionManager<BatchHandler> session{config, BatchHandler{&sent, {}, {}}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());                     // 1: Logon
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(sent.size() == 1);
+
+    auto send_order = [&session](const std::string& cl_ord_id, bool urgent = false) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order, urgent).has_value();
+    };
+    auto seq_of = [](const std::string& msg) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        return parsed ? parsed->get_int(tag::MsgSeqNum::value).value_or(0) : -1;
+    };
+
+    // Basket: queued, then one batch
+    REQUIRE(send_order("ORD2"));
+    REQUIRE(send_order("ORD3"));
+    REQUIRE(send_order("ORD4"));
+    REQUIRE(sent.size() == 1);
+    REQUIRE(session.pending_sends() == 3);
+    REQUIRE(session.flush_sends());
+    REQUIRE(session.handler().batches == std::vector<size_t>{3});
+    REQUIRE(session.pending_sends() == 0);
+
+    // Urgent with nothing queued goes straight out
+    REQUIRE(send_order("ORD5", true));
+    REQUIRE(session.handler().batches.size() == 1);
+    REQUIRE(sent.size() == 5);
+
+    // Urgent behind queued messages flushes them, itself last
+    REQUIRE(send_order("ORD6"));
+    REQUIRE(send_order("ORD7", true));
+    REQUIRE(session.handler().batches == std::vector<size_t>{3, 2});
+
+    // A session-level reply joins the queue so seqnums stay in order
+    REQUIRE(send_order("ORD8"));
+    feed(session, make_message("1", 2, "112=T\x01"));                   // Heartbeat reply
+    REQUIRE(session.handler().batches == std::vector<size_t>{3, 2, 2});
+    REQUIRE(sent.size() == 9);
+
+    for (size_t i = 0; i < sent.size(); ++i) REQUIRE(seq_of(sent[i]) == static_cast<int64_t>(i + 1));
+    REQUIRE(session.stats().messages_sent == 9);
+    REQUIRE(session.stats().send_batches == 3);
+}
+
+TEST_CASE("MemoryMessageStore zero-copy access", "[session][store]") {
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    const std::string messages[] = {make_message("D", 2), make_message("0", 3), make_message("D", 5)};
+    REQUIRE(message_store.store(2, messages[0]));
+    REQUIRE(message_store.store(3, messages[1]));
+    REQUIRE(message_store.store(5, messages[2]));
+
+    std::vector<uint32_t> seqs;
+    std::vector<const char*> views;
+    const size_t visited = message_store.for_each_in_range(1, 0,
+        [&](uint32_t seq, std::span<const char> msg) {
+            seqs.push_back(seq);
+            views.push_back(msg.data());
+        });
+    REQUIRE(visited == 3);
+    REQUIRE(seqs == std::vector<uint32_t>{2, 3, 5});
+
+    // Early stop
+    REQUIRE(message_store.for_each_in_range(2, 5,
+        [](uint32_t, std::span<const char>) { return false; }) == 1);
+
+    {
+        auto pinned = message_store.pin(3);
+        REQUIRE(pinned);
+        REQUIRE(pinned.data().data() == views[1]);  // Same bytes, no copy
+        REQUIRE(std::string_view{pinned.data().data(), pinned.size()} == messages[1]);
+    }
+    REQUIRE_FALSE(message_store.pin(4));
+
+    // Compatibility wrapper still copies
+    auto copies = message_store.retrieve_range(3, 5);
+    REQUIRE(copies.size() == 2);
+    REQUIRE(std::string(copies[1].begin(), copies[1].end()) == messages[2]);
+}
+
+TEST_CASE("MemoryMessageStore circular log", "[session][store]") {
+    auto message = [](uint32_t seq) {
+        return make_message("D", seq, "11=ORD" + std::to_string(seq) + "\x01");
+    };
+    auto stored_as = [](const store::MemoryMessageStore& s, uint32_t seq) {
+        auto msg = s.retrieve(seq);
+        return msg ? std::string(msg->begin(), msg->end()) : std::string{};
+    };
+
+    SECTION("Count limit evicts the oldest message") {
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 4, .pool_size_bytes = 4096}};
+        for (uint32_t seq = 1; seq <= 6; ++seq) REQUIRE(s.store(seq, message(seq)));
+        REQUIRE(s.message_count() == 4);
+        REQUIRE_FALSE(s.contains(2));
+        for (uint32_t seq = 3; seq <= 6; ++seq) REQUIRE(stored_as(s, seq) == message(seq));
+    }
+
+    SECTION("Byte ring wraps without splitting messages") {
+        const size_t size = message(1).size();
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 64, .pool_size_bytes = size * 3 + size / 2}};
+        for (uint32_t seq = 10; seq < 30; ++seq) {
+            REQUIRE(s.store(seq, message(seq)));
+            REQUIRE(stored_as(s, seq) == message(seq));
+        }
+        REQUIRE(s.message_count() == 3);
+        REQUIRE(stored_as(s, 27) == message(27));
+        REQUIRE(s.pool_metrics().bytes_allocated <= s.pool_metrics().pool_capacity);
+    }
+
+    SECTION("Gaps, duplicates and ordering") {
+        store::MemoryMessageStore s{"S"};
+        REQUIRE(s.store(1, message(1)));
+        REQUIRE(s.store(4, message(4)));          // 2-3 gap-filled, never stored
+        REQUIRE_FALSE(s.store(4, message(4)));    // Duplicate
+        REQUIRE_FALSE(s.store(3, message(3)));    // Behind the log tail
+        REQUIRE_FALSE(s.contains(2));
+
+        std::vector<uint32_t> seqs;
+        s.for_each_in_range(0, 0, [&](uint32_t seq, std::span<const char>) { seqs.push_back(seq); });
+        REQUIRE(seqs == std::vector<uint32_t>{1, 4});
+        REQUIRE(s.stats().store_failures == 1);
+    }
+
+    SECTION("No eviction when disabled") {
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 2, .evict_oldest = false, .pool_size_bytes = 4096}};
+        REQUIRE(s.store(1, message(1)));
+        REQUIRE(s.store(2, message(2)));
+        REQUIRE_FALSE(s.store(3, message(3)));
+        REQUIRE(stored_as(s, 1) == message(1));
+
+        s.reset();
+        REQUIRE(s.message_count() == 0);
+        REQUIRE(s.store(1, message(1)));           // Seq restarts after reset
+        REQUIRE(stored_as(s, 1) == message(1));
+    }
+}
+
+TEST_CASE("MemoryMessageStore single-writer mode", "[session][store]") {
+    auto message = [](uint32_t seq) {
+        return make_message("D", seq, "11=ORD" + std::to_string(seq) + "\x01");
+    };
+
+    SECTION("Same log semantics without the lock") {
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 4, .pool_size_bytes = 4096, .single_writer = true}};
+        for (uint32_t seq = 1; seq <= 6; ++seq) REQUIRE(s.store(seq, message(seq)));
+        REQUIRE_FALSE(s.store(6, message(6)));
+        REQUIRE(s.message_count() == 4);
+        REQUIRE_FALSE(s.contains(2));
+        REQUIRE_FALSE(s.retrieve(2).has_value());
+
+        auto msg = s.retrieve(5);
+        REQUIRE(msg.has_value());
+        REQUIRE(std::string(msg->begin(), msg->end()) == message(5));
+
+        std::vector<uint32_t> seqs;
+        s.for_each_in_range(0, 0, [&](uint32_t seq, std::span<const char> bytes) {
+            REQUIRE(std::string(bytes.begin(), bytes.end()) == message(seq));
+            seqs.push_back(seq);
+        });
+        REQUIRE(seqs == std::vector<uint32_t>{3, 4, 5, 6});
+
+        s.reset();
+        REQUIRE(s.message_count() == 0);
+        REQUIRE_FALSE(s.retrieve(5).has_value());
+        REQUIRE(s.store(1, message(1)));
+        REQUIRE(s.contains(1));
+    }
+
+    SECTION("Concurrent reader never sees torn or recycled bytes") {
+        // Small ring: the writer keeps evicting what the reader is copying
+        const size_t size = message(1).size();
+        store::MemoryMessageStore s{store::MemoryMessageStore::Config{
+            .session_id = "S", .max_messages = 64, .pool_size_bytes = size * 8,
+            .single_writer = true}};
+        constexpr uint32_t LAST = 20000;
+        std::atomic<bool> done{false};
+        std::atomic<size_t> mismatches{0};
+        std::atomic<size_t> hits{0};
+
+        std::thread reader([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                const uint32_t last = static_cast<uint32_t>(s.get_next_sender_seq_num());
+                for (uint32_t seq = last > 8 ? last - 8 : 1; seq <= last; ++seq) {
+                    if (auto msg = s.retrieve(seq)) {
+                        hits.fetch_add(1, std::memory_order_relaxed);
+                        if (std::string(msg->begin(), msg->end()) != message(seq)) {
+                            mismatches.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+        });
+
+        // Keep writing until the reader has had a fair share of lookups
+        size_t failed_stores = 0;
+        for (uint32_t seq = 1; seq <= LAST || (hits.load() < 1000 && seq < 50 * LAST); ++seq) {
+            if (!s.store(seq, message(seq))) ++failed_stores;
+            s.set_next_sender_seq_num(seq);
+        }
+        done.store(true, std::memory_order_release);
+        reader.join();
+
+        REQUIRE(failed_stores == 0);
+        REQUIRE(mismatches.load() == 0);
+        REQUIRE(hits.load() > 0);
+        REQUIRE(s.message_count() <= 8);
+    }
+}
+
+TEST_CASE("MemoryMessageStore hibernates into a shared pool", "[session][store]") {
+    memory::HibernationPool pool;
+    store::MemoryMessageStore a{{.session_id = "A", .max_messages = 512, .pool_size_bytes = 8192,
+                                 .upstream_resource = &pool}};
+    store::MemoryMessageStore b{{.session_id = "B", .max_messages = 512, .pool_size_bytes = 8192,
+                                 .upstream_resource = &pool}};
+    auto bytes = [](std::string_view s) { return std::span<const char>{s.data(), s.size()}; };
+
+    REQUIRE(a.store(1, bytes("first")));
+    REQUIRE(a.store(3, bytes("third")));
+    const size_t in_use = pool.stats().in_use_bytes;
+
+    REQUIRE(a.hibernate() > 16000);              // 8 KB ring + 512-entry index
+    REQUIRE(a.hibernated());
+    REQUIRE(a.hibernate() == 0);
+    REQUIRE_FALSE(a.retrieve(1).has_value());                    // Empty until rehydrated
+    REQUIRE(pool.stats().cached_bytes >= 8192);
+    REQUIRE(pool.stats().in_use_bytes < in_use);
+
+    // Another store's ring and index come back out of the cache
+    REQUIRE(b.hibernate() > 0);
+    const uint64_t hits = pool.stats().hits;
+    b.rehydrate();
+    REQUIRE(pool.stats().hits == hits + 2);
+
+    // store() rehydrates: earlier messages keep their seqnums
+    REQUIRE(a.store(4, bytes("fourth")));
+    REQUIRE_FALSE(a.hibernated());
+    REQUIRE(a.retrieve(1) == std::vector<char>{'f', 'i', 'r', 's', 't'});
+    REQUIRE_FALSE(a.retrieve(2).has_value());
+    REQUIRE(a.retrieve(3) == std::vector<char>{'t', 'h', 'i', 'r', 'd'});
+    REQUIRE(a.message_count() == 3);
+    REQUIRE(a.visit_range(1, 0, [](void*, uint32_t, std::span<const char>) noexcept { return true; },
+                          nullptr) == 3);
+}
+
+TEST_CASE("TopOfBookStore publishes market data to readers", "[session][store][market_data]") {
+    using Books = store::TopOfBookStore<64>;
+    auto books = std::make_unique<Books>();
+    const auto aapl = books->subscribe("AAPL");
+    const auto msft = books->subscribe("MSFT");
+    REQUIRE(aapl != Books::INVALID_SYMBOL);
+    REQUIRE(msft != Books::INVALID_SYMBOL);
+    REQUIRE(books->subscribe("AAPL") == aapl);
+    REQUIRE(books->find("IBM") == Books::INVALID_SYMBOL);
+    REQUIRE(books->symbol(msft) == "MSFT");
+
+    auto apply = [&](const std::string& raw) {
+        auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(msg.has_value());
+        return books->apply(*msg);
+    };
+
+    // Snapshot: best of two bid levels, one offer, one trade
+    REQUIRE(apply(make_message("W", 5, "262=MD1\x01" "55=AAPL\x01" "268=4\x01"
+                               "269=0\x01" "270=150.20\x01" "271=300\x01"
+                               "269=0\x01" "270=150.25\x01" "271=1000\x01"
+                               "269=1\x01" "270=150.30\x01" "271=500\x01"
+                               "269=2\x01" "270=150.27\x01" "271=100\x01")) == 1);
+
+    auto snap = books->read(aapl);
+    REQUIRE(snap.value.bid_px.raw == FixedPrice::from_double(150.25).raw);
+    REQUIRE(snap.value.bid_size.raw == Qty::from_int(1000).raw);
+    REQUIRE(snap.value.ask_px.raw == FixedPrice::from_double(150.30).raw);
+    REQUIRE(snap.value.last_px.raw == FixedPrice::from_double(150.27).raw);
+    REQUIRE(snap.value.msg_seq_num == 5);
+    uint64_t version = snap.version;
+    REQUIRE_FALSE(books->changed_since(aapl, version));
+
+    // Incremental: AAPL bid change + offer delete, MSFT trade, unsubscribed IBM
+    REQUIRE(apply(make_message("X", 6, "262=MD1\x01" "268=4\x01"
+                               "279=1\x01" "269=0\x01" "55=AAPL\x01" "270=150.26\x01" "271=800\x01"
+                               "279=2\x01" "269=1\x01" "55=AAPL\x01" "270=150.30\x01"
+                               "279=0\x01" "269=2\x01" "55=MSFT\x01" "270=400.10\x01" "271=50\x01"
+                               "279=0\x01" "269=0\x01" "55=IBM\x01" "270=1\x01" "271=1\x01")) == 2);
+
+    store::TopOfBook book{};
+    REQUIRE(books->read_if_changed(aapl, book, version));
+    REQUIRE(book.bid_px.raw == FixedPrice::from_double(150.26).raw);
+    REQUIRE(book.bid_size.raw == Qty::from_int(800).raw);
+    REQUIRE_FALSE(book.has_ask());
+    REQUIRE(book.last_px.raw == FixedPrice::from_double(150.27).raw);  // Unchanged
+    REQUIRE(version == snap.version + 1);                              // One publish per symbol
+    REQUIRE_FALSE(books->read_if_changed(aapl, book, version));
+
+    REQUIRE(books->read(msft).value.last_size.raw == Qty::from_int(50).raw);
+    REQUIRE(apply(make_message("D", 7)) == 0);
+
+    SECTION("Readers never see a torn book") {
+        std::atomic<bool> done{false};
+        std::atomic<int> torn{0};
+        std::thread reader([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                const auto b = books->read(msft).value;
+                if (b.bid_px.raw != b.ask_px.raw || b.bid_size.raw != b.ask_size.raw) ++torn;
+            }
+        });
+        for (int64_t i = 1; i <= 20000; ++i) {
+            store::TopOfBook b{};
+            b.bid_px = b.ask_px = FixedPrice{i};
+            b.bid_size = b.ask_size = Qty{i};
+            books->publish(msft, b);
+        }
+        done.store(true, std::memory_order_release);
+        reader.join();
+        REQUIRE(torn.load() == 0);
+    }
+}
+
+TEST_CASE("TradeAggregateStore keeps rolling trade statistics", "[session][store][market_data]") {
+    using Trades = store::TradeAggregateStore<16, 4>;
+    constexpr uint64_t SEC = 1'000'000'000ULL;
+    auto trades = std::make_unique<Trades>(SEC);     // 4-second window
+    const auto aapl = trades->subscribe("AAPL");
+    const auto msft = trades->subscribe("MSFT");
+    REQUIRE(trades->window_ns() == 4 * SEC);
+
+    auto apply = [&](const std::string& raw, uint64_t now_ns) {
+        auto msg = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(msg.has_value());
+        return trades->apply(*msg, now_ns);
+    };
+    auto px = [](double d) { return FixedPrice::from_double(d).raw; };
+
+    // Quotes, non-New trades, zero sizes and unknown symbols are skipped
+    REQUIRE(apply(make_message("X", 5, "262=MD1\x01" "268=6\x01"
+                               "279=0\x01" "269=2\x01" "55=AAPL\x01" "270=150.00\x01" "271=100\x01"
+                               "279=0\x01" "269=0\x01" "55=AAPL\x01" "270=149.00\x01" "271=900\x01"
+                               "279=0\x01" "269=2\x01" "55=MSFT\x01" "270=400.00\x01" "271=10\x01"
+                               "279=0\x01" "269=2\x01" "55=AAPL\x01" "270=151.00\x01" "271=300\x01"
+                               "279=2\x01" "269=2\x01" "55=AAPL\x01" "270=999.00\x01" "271=5\x01"
+                               "279=0\x01" "269=2\x01" "55=IBM\x01" "270=1\x01" "271=1\x01"),
+                  10 * SEC) == 2);
+
+    auto snap = trades->read(aapl).value;
+    REQUIRE(snap.window.trades == 2);
+    REQUIRE(snap.window.open.raw == px(150.00));
+    REQUIRE(snap.window.close.raw == px(151.00));
+    REQUIRE(snap.window.high.raw == px(151.00));
+    REQUIRE(snap.window.low.raw == px(150.00));
+    REQUIRE(snap.window.volume.raw == Qty::from_int(400).raw);
+    REQUIRE(snap.window.vwap.raw == px(150.75));           // (150*100 + 151*300) / 400
+    REQUIRE(snap.msg_seq_num == 5);
+    REQUIRE(trades->read(msft).value.session.volume.raw == Qty::from_int(10).raw);
+
+    // A batch long enough for the vector path, two seconds later
+    std::string body = "262=MD1\x01" "268=20\x01";
+    for (int i = 0; i < 20; ++i) {
+        body += "279=0\x01" "269=2\x01" "55=AAPL\x01" "270=" + std::to_string(140 + i) +
+                "\x01" "271=10\x01";
+    }
+    REQUIRE(apply(make_message("X", 6, body), 12 * SEC) == 1);
+    snap = trades->read(aapl).value;
+    REQUIRE(snap.window.trades == 22);
+    REQUIRE(snap.window.open.raw == px(150.00));
+    REQUIRE(snap.window.close.raw == px(159.00));
+    REQUIRE(snap.window.high.raw == px(159.00));
+    REQUIRE(snap.window.low.raw == px(140.00));
+    REQUIRE(snap.window.volume.raw == Qty::from_int(600).raw);
+    // (15000 + 45300 + 10 * (140 + ... + 159)) / 600 = 150.33...
+    REQUIRE(snap.window.vwap.raw == px(150.0) + px(1.0) / 3);
+
+    // The first bucket expires; the session keeps it
+    REQUIRE(trades->advance(13 * SEC) == 0);
+    REQUIRE(trades->advance(14 * SEC) == 2);     // AAPL's and MSFT's 10s buckets age out
+    snap = trades->read(aapl).value;
+    REQUIRE(snap.window.trades == 20);
+    REQUIRE(snap.window.open.raw == px(140.00));
+    REQUIRE(snap.window.volume.raw == Qty::from_int(200).raw);
+    REQUIRE(snap.window_start_ns == 11 * SEC);
+    REQUIRE(snap.session.trades == 22);
+    REQUIRE(snap.session.open.raw == px(150.00));
+    REQUIRE(trades->read(msft).value.window.empty());
+    REQUIRE(trades->advance(20 * SEC) == 1);
+    REQUIRE(trades->advance(21 * SEC) == 0);
+
+    // Time never runs backwards: a stale timestamp lands in the newest bucket
+    REQUIRE(apply(make_message("X", 7, "262=MD1\x01" "268=1\x01"
+                               "279=0\x01" "269=2\x01" "55=AAPL\x01" "270=150\x01" "271=1\x01"),
+                  5 * SEC) == 1);
+    snap = trades->read(aapl).value;
+    REQUIRE(snap.window.trades == 1);
+    REQUIRE(snap.updated_ns == 21 * SEC);
+
+    uint64_t version = trades->read(aapl).version;
+    trades->reset(aapl);
+    REQUIRE(trades->changed_since(aapl, version));
+    REQUIRE(trades->read(aapl).value.session.empty());
+    REQUIRE(apply(make_message("D", 8), 22 * SEC) == 0);
+}
+
+TEST_CASE("TieredMessageStore hot and cold tiers", "[session][store]") {
+    // ExecutionReports with the fields that vary in real traffic
+    auto message = [](uint32_t seq) {
+        const char* symbols[] = {"AAPL", "MSFT", "NVDA", "AMZN"};
+        return make_message("8", seq,
+            "37=O" + std::to_string(700000 + seq) + "\x01" "11=ORD" + std::to_string(seq) +
+            "\x01" "17=E" + std::to_string(seq * 7) + "\x01" "150=F\x01" "39=2\x01"
+            "55=" + symbols[seq % 4] + "\x01" "54=" + std::to_string(1 + seq % 2) + "\x01"
+            "38=" + std::to_string(100 * (1 + seq % 9)) + "\x01" "44=" +
+            std::to_string(150 + seq % 37) + "." + std::to_string(seq % 100) + "\x01"
+            "60=20240102-09:30:" + std::to_string(10 + seq % 50) + ".123\x01");
+    };
+    auto stored_as = [](const store::TieredMessageStore& s, uint32_t seq) {
+        auto msg = s.retrieve(seq);
+        return msg ? std::string(msg->begin(), msg->end()) : std::string{};
+    };
+
+    store::TieredMessageStore s{store::TieredMessageStore::Config{
+        .session_id = "S", .segment_messages = 256, .hot_segments = 2}};
+    constexpr uint32_t LAST = 4000;
+    size_t raw_bytes = 0;
+    for (uint32_t seq = 1; seq <= LAST; ++seq) {
+        if (seq % 1000 == 500) continue;  // Gap-filled, never stored
+        const std::string msg = message(seq);
+        raw_bytes += msg.size();
+        REQUIRE(s.store(seq, msg));
+    }
+    REQUIRE_FALSE(s.store(LAST, message(LAST)));
+
+    SECTION("Compaction moves old segments to the cold tier") {
+        REQUIRE(s.pending_compaction() > 0);
+        REQUIRE(s.compact() > 0);
+        REQUIRE(s.pending_compaction() == 0);
+
+        const auto metrics = s.tier_metrics();
+        REQUIRE(metrics.hot_segments == 3);   // Two sealed + the open segment
+        REQUIRE(metrics.cold_segments > 0);
+        REQUIRE(metrics.cold_raw_bytes >= 4 * metrics.cold_bytes);
+        REQUIRE(metrics.cold_raw_bytes + metrics.hot_bytes == raw_bytes);
+        REQUIRE(s.dictionary().size() > store::lz::FIX_DICTIONARY.size());
+        REQUIRE(s.message_count() == LAST - 4);
+
+        for (uint32_t seq : {1u, 255u, 256u, 257u, 1777u, LAST}) {
+            REQUIRE(stored_as(s, seq) == message(seq));
+        }
+        REQUIRE_FALSE(s.retrieve(1500).has_value());
+
+        // A cold hit decompresses its segment once
+        const auto before = s.tier_metrics().decompressions;
+        for (uint32_t seq = 1025; seq < 1100; ++seq) REQUIRE(stored_as(s, seq) == message(seq));
+        REQUIRE(s.tier_metrics().decompressions == before + 1);
+    }
+
+    SECTION("Resend range spans both tiers") {
+        (void)s.compact();
+        std::vector<uint32_t> seqs;
+        bool bytes_ok = true;
+        s.for_each_in_range(3400, 3600, [&](uint32_t seq, std::span<const char> bytes) {
+            bytes_ok = bytes_ok && std::string(bytes.begin(), bytes.end()) == message(seq);
+            seqs.push_back(seq);
+        });
+        REQUIRE(bytes_ok);
+        REQUIRE(seqs.size() == 201 - 1);   // 3500 was never stored
+        REQUIRE(seqs.front() == 3400);
+        REQUIRE(seqs.back() == 3600);
+    }
+
+    SECTION("Cold budget drops the oldest segments") {
+        store::TieredMessageStore small{store::TieredMessageStore::Config{
+            .session_id = "S", .segment_messages = 256, .hot_segments = 1,
+            .max_cold_bytes = 16 * 1024}};
+        for (uint32_t seq = 1; seq <= LAST; ++seq) REQUIRE(small.store(seq, message(seq)));
+        (void)small.compact();
+
+        const auto metrics = small.tier_metrics();
+        REQUIRE(metrics.cold_evictions > 0);
+        REQUIRE(metrics.cold_bytes <= 16 * 1024);
+        REQUIRE_FALSE(small.retrieve(1).has_value());
+        REQUIRE(stored_as(small, LAST) == message(LAST));
+
+        small.reset();
+        REQUIRE(small.message_count() == 0);
+        REQUIRE(small.store(1, message(1)));
+        REQUIRE(stored_as(small, 1) == message(1));
+    }
+
+    SECTION("Codec round trip and corruption") {
+        const std::string raw = message(1) + message(2) + message(3);
+        std::vector<char> packed(store::lz::compress_bound(raw.size()));
+        packed.resize(store::lz::compress(store::lz::FIX_DICTIONARY, raw, packed));
+        REQUIRE(packed.size() < raw.size() / 2);
+
+        std::vector<char> window;
+        REQUIRE(store::lz::decompress(store::lz::FIX_DICTIONARY, packed, raw.size(), window));
+        REQUIRE(std::string(window.begin() + store::lz::FIX_DICTIONARY.size(), window.end()) == raw);
+        REQUIRE_FALSE(store::lz::decompress(store::lz::FIX_DICTIONARY, packed, raw.size() + 1, window));
+        packed.resize(packed.size() / 2);
+        REQUIRE_FALSE(store::lz::decompress(store::lz::FIX_DICTIONARY, packed, raw.size(), window));
+    }
+}
+
+TEST_CASE("GapTracker sorted ranges", "[session][sequence]") {
+    GapTracker gaps;
+
+    SECTION("Ranges merge, split and trim") {
+        REQUIRE(gaps.add_gap(20, 30));
+        REQUIRE(gaps.add_gap(5, 9));
+        REQUIRE(gaps.add_gap(10, 12));          // Touches [5,9]: merged
+        REQUIRE_FALSE(gaps.add_gap(3, 2));
+        REQUIRE(gaps.gap_count() == 2);
+        REQUIRE(gaps.get_gap(0)->begin == 5);
+        REQUIRE(gaps.get_gap(0)->end == 12);
+
+        gaps.fill(25);
+        REQUIRE(gaps.gap_count() == 3);
+        REQUIRE_FALSE(gaps.contains(25));
+        REQUIRE(gaps.contains(24));
+        REQUIRE(gaps.contains(26));
+
+        REQUIRE(gaps.add_gap(11, 24));          // Bridges up to [26,30]
+        REQUIRE(gaps.gap_count() == 2);
+        REQUIRE(gaps.get_gap(0)->end == 24);
+
+        gaps.fill_below(27);
+        REQUIRE(gaps.gap_count() == 1);
+        REQUIRE(gaps.get_gap(0)->begin == 27);
+        REQUIRE(gaps.get_gap(0)->end == 30);
+    }
+
+    SECTION("No cap on fragmentation") {
+        // A bad reconnect: every other seqnum missing
+        for (uint32_t seq = 1; seq < 20000; seq += 2) REQUIRE(gaps.add_gap(seq, seq));
+        REQUIRE(gaps.gap_count() == 10000);
+        gaps.add_gap(1, 100);                    // Swallows 50 ranges, touches [101,101]
+        REQUIRE(gaps.gap_count() == 9950);
+
+        for (uint32_t seq = 1; seq <= 100; ++seq) gaps.fill(seq);
+        for (uint32_t seq = 101; seq < 20000; seq += 2) gaps.fill(seq);
+        REQUIRE_FALSE(gaps.has_gaps());
+    }
+
+    SECTION("Reserved ranges grow when a split outgrows them") {
+        GapTracker reserved{2};
+        REQUIRE(reserved.capacity() == 2);
+        REQUIRE(reserved.add_gap(1, 10));
+        REQUIRE(reserved.add_gap(20, 30));
+        reserved.fill(5);                        // Third range: grows
+        REQUIRE(reserved.gap_count() == 3);
+        REQUIRE(reserved.capacity() >= GapTracker::DEFAULT_CAPACITY);
+        REQUIRE(reserved.get_gap(0)->end == 4);
+        REQUIRE(reserved.get_gap(1)->begin == 6);
+        REQUIRE(reserved.get_gap(2)->begin == 20);
+    }
+}
+
+TEST_CASE("SessionManager tracks fragmented inbound gaps", "[session][sequence]") {
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    REQUIRE(session.inbound_gaps().capacity() == GapTracker::DEFAULT_CAPACITY);
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+    feed(session, make_message("8", 3));         // 2 missing
+    feed(session, make_message("8", 5));         // 4 missing
+    feed(session, make_message("8", 6));
+    REQUIRE(session.inbound_gaps().gap_count() == 2);
+    REQUIRE(sent.size() == 3);                   // Logon + one ResendRequest per new range
+    REQUIRE(sent[1].find("\x01" "7=2\x01" "16=2\x01") != std::string::npos);
+    REQUIRE(sent[2].find("\x01" "7=4\x01" "16=4\x01") != std::string::npos);
+
+    // Already received past the gap: a duplicate, not a new gap
+    session.handler().routed.clear();
+    feed(session, make_message("8", 5));
+    REQUIRE(session.handler().routed == "error;");
+    REQUIRE(sent.size() == 3);
+
+    // Filling the gaps skips the seqnums received meanwhile
+    feed(session, make_message("8", 2, "43=Y\x01"));
+    REQUIRE(session.sequences().expected_inbound() == 4);
+    feed(session, make_message("8", 4, "43=Y\x01"));
+    REQUIRE_FALSE(session.inbound_gaps().has_gaps());
+    REQUIRE(session.sequences().expected_inbound() == 7);
+}
+
+TEST_CASE("SessionControlBlock restores session state", "[session][store]") {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("nfx_control_block_" + std::to_string(::getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    const store::SessionControlBlock::Config config{.session_id = "CLIENT-BROKER",
+                                                    .directory = dir.string()};
+
+    SECTION("Fields and gap list survive reopen") {
+        {
+            auto opened = store::SessionControlBlock::open(config);
+            REQUIRE(opened.has_value());
+            auto& block = **opened;
+            REQUIRE_FALSE(block.recovered());
+            REQUIRE(block.next_sender_seq() == 1);
+
+            block.set_next_sender_seq(42);
+            block.set_next_target_seq(17);
+            block.set_last_logon_ns(1'700'000'000'000'000'000);
+            GapTracker gaps;
+            REQUIRE(gaps.add_gap(10, 12));
+            REQUIRE(gaps.add_gap(15, 15));
+            block.save_gaps(gaps);
+        }
+
+        auto reopened = store::SessionControlBlock::open(config);
+        REQUIRE(reopened.has_value());
+        auto& block = **reopened;
+        REQUIRE(block.recovered());
+        REQUIRE(block.next_sender_seq() == 42);
+        REQUIRE(block.next_target_seq() == 17);
+        REQUIRE(block.last_logon_ns() == 1'700'000'000'000'000'000);
+
+        GapTracker gaps;
+        block.restore_gaps(gaps);
+        REQUIRE(gaps.gap_count() == 2);
+        REQUIRE(gaps.get_gap(0)->begin == 10);
+        REQUIRE(gaps.get_gap(1)->end == 15);
+
+        block.reset();
+        REQUIRE(block.next_sender_seq() == 1);
+        block.restore_gaps(gaps);
+        REQUIRE_FALSE(gaps.has_gaps());
+    }
+
+    SECTION("Restarted session resumes its sequence") {
+        std::vector<std::string> sent;
+        {
+            auto opened = store::SessionControlBlock::open(config);
+            REQUIRE(opened.has_value());
+            SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+            session.set_control_block(opened->get());
+
+            session.on_connect();
+            REQUIRE(session.initiate_logon().has_value());
+            feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+            feed(session, make_message("8", 2));
+            feed(session, make_message("8", 5));     // 3-4 missing: ResendRequest
+            REQUIRE(session.inbound_gaps().gap_count() == 1);
+            REQUIRE((*opened)->last_logon_ns() > 0);
+            REQUIRE((*opened)->next_sender_seq() == 3);   // Logon + ResendRequest
+            REQUIRE((*opened)->next_target_seq() == 3);
+        }
+
+        auto reopened = store::SessionControlBlock::open(config);
+        REQUIRE(reopened.has_value());
+        SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+        session.set_control_block(reopened->get());
+        REQUIRE(session.sequences().current_outbound() == 3);
+        REQUIRE(session.sequences().expected_inbound() == 3);
+        REQUIRE(session.inbound_gaps().gap_count() == 1);
+        REQUIRE(session.inbound_gaps().get_gap(0)->begin == 3);
+        REQUIRE(session.inbound_gaps().get_gap(0)->end == 4);
+
+        // Gap fill to 6 clears the gap and is mirrored immediately
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        feed(session, make_message("A", 3, "98=0\x01" "108=30\x01"));
+        feed(session, make_message("4", 4, "123=Y\x01" "36=6\x01"));
+        REQUIRE_FALSE(session.inbound_gaps().has_gaps());
+        GapTracker gaps;
+        (*reopened)->restore_gaps(gaps);
+        REQUIRE_FALSE(gaps.has_gaps());
+        REQUIRE((*reopened)->next_target_seq() == 6);
+        REQUIRE((*reopened)->next_sender_seq() == 4);
+    }
+
+    SECTION("Ranges past the slot count coalesce") {
+        auto opened = store::SessionControlBlock::open(config);
+        REQUIRE(opened.has_value());
+        GapTracker gaps;
+        for (uint32_t seq = 1; seq < 2000; seq += 2) REQUIRE(gaps.add_gap(seq, seq));
+        (*opened)->save_gaps(gaps);
+
+        GapTracker restored;
+        (*opened)->restore_gaps(restored);
+        REQUIRE(restored.gap_count() == store::detail::CONTROL_MAX_GAPS);
+        REQUIRE(restored.ranges().back().begin == 999);
+        REQUIRE(restored.ranges().back().end == 1999);
+    }
+
+    SECTION("Foreign files are rejected") {
+        std::ofstream{dir / "BAD.ctl", std::ios::binary} << std::string(4096, 'x');
+        auto opened = store::SessionControlBlock::open({.session_id = "BAD", .directory = dir.string()});
+        REQUIRE_FALSE(opened.has_value());
+        REQUIRE(opened.error().code == store::StoreErrorCode::Corrupt);
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("MmapMessageStore persistence and recovery", "[session][store]") {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("nfx_mmap_store_" + std::to_string(::getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    store::MmapMessageStore::Config config{
+        .session_id = "CLIENT-BROKER",
+        .directory = dir.string(),
+        .journal_size = 1024 * 1024,
+        .max_seq = 4096,
+        .async_flush = false};
+    auto message = [](uint32_t seq) {
+        return make_message("D", seq, "11=ORD" + std::to_string(1000 + seq) + "\x01");
+    };
+    auto stored_as = [](const store::MmapMessageStore& s, uint32_t seq) {
+        auto msg = s.retrieve(seq);
+        return msg ? std::string(msg->begin(), msg->end()) : std::string{};
+    };
+
+    // Child process stores, syncs the first 100, then dies without
+    // running destructors: the last 10 exist only in the page cache
+    const pid_t child = ::fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        auto opened = store::MmapMessageStore::open(config);
+        if (!opened) ::_exit(1);
+        auto& s = **opened;
+        bool ok = true;
+        for (uint32_t seq = 1; seq <= 100; ++seq) ok &= s.store(seq, message(seq));
+        s.flush();
+        ok &= s.unsynced_bytes() == 0;
+        for (uint32_t seq = 101; seq <= 110; ++seq) ok &= s.store(seq, message(seq));
+        ok &= !s.store(110, message(110));
+        s.set_next_sender_seq_num(111);
+        ::_exit(ok ? 0 : 2);
+    }
+    int status = 0;
+    REQUIRE(::waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    size_t journal_end = store::detail::JOURNAL_DATA_START;
+    for (uint32_t seq = 1; seq <= 110; ++seq) {
+        journal_end += store::detail::record_span(message(seq).size());
+    }
+
+    SECTION("Reopen recovers synced messages and the unsynced tail") {
+        auto opened = store::MmapMessageStore::open(config);
+        REQUIRE(opened.has_value());
+        auto& s = **opened;
+        REQUIRE(s.message_count() == 110);
+        REQUIRE(s.recovered_tail() == 10);
+        REQUIRE(s.journal_used() == journal_end);
+        REQUIRE(s.get_next_sender_seq_num() == 111);
+        REQUIRE(stored_as(s, 1) == message(1));
+        REQUIRE(stored_as(s, 105) == message(105));
+
+        std::vector<uint32_t> seqs;
+        s.for_each_in_range(99, 0, [&](uint32_t seq, std::span<const char>) { seqs.push_back(seq); });
+        REQUIRE(seqs.size() == 12);
+        REQUIRE(s.store(111, message(111)));
+
+        s.reset();
+        REQUIRE(s.message_count() == 0);
+        REQUIRE_FALSE(s.retrieve(5).has_value());
+    }
+
+    SECTION("A torn record ends recovery") {
+        {
+            // Corrupt the first payload byte of the last record
+            const size_t span = store::detail::record_span(message(110).size());
+            std::fstream file(dir / "CLIENT-BROKER.journal", std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(static_cast<std::streamoff>(journal_end - span + sizeof(store::detail::RecordHeader)));
+            file.put('X');
+        }
+        auto opened = store::MmapMessageStore::open(config);
+        REQUIRE(opened.has_value());
+        REQUIRE((*opened)->message_count() == 109);
+        REQUIRE((*opened)->recovered_tail() == 9);
+        REQUIRE_FALSE((*opened)->retrieve(110).has_value());
+    }
+
+    SECTION("Background flusher advances the durable watermark") {
+        auto async = config;
+        async.async_flush = true;
+        async.flush_interval = std::chrono::milliseconds{1};
+        auto opened = store::MmapMessageStore::open(async);
+        REQUIRE(opened.has_value());
+        auto& s = **opened;
+        REQUIRE(s.store(111, message(111)));
+        for (int i = 0; i < 1000 && s.unsynced_bytes() != 0; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        REQUIRE(s.unsynced_bytes() == 0);
+        REQUIRE(s.flush_count() >= 1);
+    }
+
+    SECTION("Layout mismatch is rejected") {
+        auto other = config;
+        other.max_seq = 8192;
+        auto opened = store::MmapMessageStore::open(other);
+        REQUIRE_FALSE(opened.has_value());
+        REQUIRE(opened.error().code == store::StoreErrorCode::Corrupt);
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("StoreRecovery opens session stores in parallel", "[session][store]") {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("nfx_store_recovery_" + std::to_string(::getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    constexpr size_t SESSIONS = 12;
+    std::vector<store::MmapMessageStore::Config> configs;
+    for (size_t i = 0; i < SESSIONS; ++i) {
+        configs.push_back({.session_id = "S" + std::to_string(i), .directory = dir.string(),
+                           .journal_size = 256 * 1024, .max_seq = 1024, .async_flush = false});
+        auto opened = store::MmapMessageStore::open(configs.back());
+        REQUIRE(opened.has_value());
+        for (uint32_t seq = 1; seq <= i + 1; ++seq) REQUIRE((*opened)->store(seq, make_message("D", seq)));
+        (*opened)->set_next_sender_seq_num(static_cast<uint32_t>(i + 2));
+    }
+    configs.push_back({.session_id = "", .directory = dir.string()});  // Fails to open
+
+    // A child leaves an unsynced tail record in S3 whose FIX CheckSum is
+    // wrong; the journal record itself is intact, so only 10= catches it
+    const pid_t child = ::fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        auto opened = store::MmapMessageStore::open(configs[3]);
+        std::string bad = make_message("D", 5);
+        bad[bad.size() - 2] = bad[bad.size() - 2] == '0' ? '1' : '0';
+        ::_exit(opened && (*opened)->store(5, bad) ? 0 : 1);
+    }
+    int status = 0;
+    REQUIRE(::waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    store::StoreRecovery recovery{configs, {.threads = 4}};
+    std::atomic<size_t> callbacks{0};
+    REQUIRE(recovery.start([&](size_t i, const store::StoreRecovery::Result& r) {
+        if (i < SESSIONS && r.has_value()) callbacks.fetch_add(1, std::memory_order_relaxed);
+    }));
+    recovery.wait();
+
+    REQUIRE(recovery.done());
+    REQUIRE(callbacks.load() == SESSIONS);
+    for (size_t i = 0; i < SESSIONS; ++i) {
+        REQUIRE(recovery.ready(i));
+        auto& store = *recovery.result(i);
+        REQUIRE(store->message_count() == i + 1);
+        REQUIRE(store->get_next_sender_seq_num() == i + 2);
+    }
+    REQUIRE_FALSE(recovery.result(SESSIONS).has_value());
+    REQUIRE_FALSE(recovery.result(3).value()->retrieve(5).has_value());
+
+    const auto stats = recovery.stats();
+    REQUIRE(stats.recovered == SESSIONS);
+    REQUIRE(stats.failed == 1);
+
+    fs::remove_all(dir);
+}
+
+// ============================================================================
+// FIXP Session
+// ============================================================================
+
+namespace {
+
+/// FIXP handler recording outbound frames and delivered orders
+struct FixpRecorder {
+    struct Received {
+        uint32_t seq;
+        bool retransmitted;
+        std::string cl_ord_id;
+    };
+
+    std::vector<std::vector<char>> outbox;
+    std::vector<Received> received;
+    std::vector<SessionErrorCode> errors;
+    bool link_up{true};
+
+    void on_app_message(const FixpAppMessage& msg) noexcept {
+        auto nos = sbe::NewOrderSingleCodec::wrapForDecode(msg.data.data(), msg.data.size());
+        received.push_back({msg.seq_num, msg.retransmitted,
+                            nos.isValid() ? std::string{nos.clOrdId()} : std::string{}});
+    }
+    void on_state_change(SessionState, SessionState) noexcept {}
+    bool on_send(std::span<const char> frame) noexcept {
+        if (link_up) outbox.emplace_back(frame.begin(), frame.end());
+        return true;  // A dying connection still accepts the write
+    }
+    void on_error(const SessionError& err) noexcept { errors.push_back(err.code); }
+};
+
+using FixpTestSession = FixpSession<FixpRecorder>;
+
+/// Deliver frames both ways until neither side has anything to say
+void fixp_exchange(FixpTestSession& a, FixpTestSession& b) {
+    while (!a.handler().outbox.empty() || !b.handler().outbox.empty()) {
+        for (auto* from : {&a, &b}) {
+            auto& to = from == &a ? b : a;
+            auto frames = std::move(from->handler().outbox);
+            from->handler().outbox.clear();
+            for (const auto& frame : frames) to.on_data_received(frame);
+        }
+    }
+}
+
+SessionResult<void> fixp_send_order(FixpTestSession& session, std::string_view id) {
+    return session.send<sbe::NewOrderSingleCodec>([&](sbe::NewOrderSingleCodec& nos) {
+        nos.clOrdId(id).symbol("ESZ5").side(Side::Buy);
+    });
+}
+
+FixpSessionConfig fixp_config() {
+    FixpSessionConfig config;
+    config.session_id = 0xC0FFEE;
+    config.keepalive_interval_ms = 1000;
+    return config;
+}
+
+void fixp_handshake(FixpTestSession& client, FixpTestSession& server) {
+    client.on_connect();
+    server.on_connect();
+    REQUIRE(client.establish().has_value());
+    fixp_exchange(client, server);
+    REQUIRE(client.state() == SessionState::Active);
+    REQUIRE(server.state() == SessionState::Active);
+}
+
+}  // namespace
+
+TEST_CASE("FIXP session message codecs", "[session][fixp]") {
+    alignas(8) std::array<char, sbe::EstablishCodec::TOTAL_SIZE> buffer{};
+    (void)sbe::EstablishCodec::wrapForEncode(buffer.data(), buffer.size())
+        .encodeHeader()
+        .sessionId(42)
+        .timestamp(Timestamp{123})
+        .nextSeqNo(7)
+        .keepaliveInterval(500);
+
+    auto establish = sbe::EstablishCodec::wrapForDecode(buffer.data(), buffer.size());
+    REQUIRE(establish.isValid());
+    REQUIRE(establish.header().templateId() == 503);
+    REQUIRE(establish.sessionId() == 42);
+    REQUIRE(establish.timestamp() == Timestamp{123});
+    REQUIRE(establish.nextSeqNo() == 7);
+    REQUIRE(establish.keepaliveInterval() == 500);
+
+    REQUIRE_FALSE(sbe::EstablishmentAckCodec::wrapForDecode(buffer.data(), buffer.size()).isValid());
+    REQUIRE_FALSE(sbe::EstablishCodec::wrapForDecode(buffer.data(), buffer.size() - 1).isValid());
+    REQUIRE(sbe::is_fixp_session_message(sbe::SequenceCodec::TEMPLATE_ID));
+    REQUIRE_FALSE(sbe::is_fixp_session_message(sbe::NewOrderSingleCodec::TEMPLATE_ID));
+}
+
+TEST_CASE("FIXP session negotiates, establishes and sequences", "[session][fixp]") {
+    FixpTestSession client{fixp_config()};
+    FixpTestSession server{fixp_config()};
+    fixp_handshake(client, server);
+    REQUIRE(client.negotiated());
+    REQUIRE(server.negotiated());
+
+    REQUIRE(fixp_send_order(client, "ORD1").has_value());
+    REQUIRE(fixp_send_order(client, "ORD2").has_value());
+    REQUIRE(fixp_send_order(server, "ACK1").has_value());
+
+    // One SOFH frame per message: 6-byte header + 64-byte NewOrderSingle
+    REQUIRE(client.handler().outbox.back().size() ==
+            sbe::Sofh::SIZE + sbe::NewOrderSingleCodec::TOTAL_SIZE);
+    fixp_exchange(client, server);
+
+    const auto& orders = server.handler().received;
+    REQUIRE(orders.size() == 2);
+    REQUIRE(orders[0].seq == 1);
+    REQUIRE(orders[0].cl_ord_id == "ORD1");
+    REQUIRE(orders[1].seq == 2);
+    REQUIRE_FALSE(orders[1].retransmitted);
+    REQUIRE(client.handler().received.size() == 1);
+    REQUIRE(client.handler().received[0].cl_ord_id == "ACK1");
+    REQUIRE(client.sequences().current_outbound() == 3);
+    REQUIRE(server.sequences().expected_inbound() == 3);
+    REQUIRE(client.handler().errors.empty());
+    REQUIRE(server.handler().errors.empty());
+
+    SECTION("Coalesced sends go out as one frame") {
+        auto config = fixp_config();
+        config.coalesce_sends = true;
+        FixpTestSession batching{config};
+        FixpTestSession peer{fixp_config()};
+        fixp_handshake(batching, peer);
+
+        REQUIRE(fixp_send_order(batching, "B1").has_value());
+        REQUIRE(fixp_send_order(batching, "B2").has_value());
+        REQUIRE(batching.pending_sends() == 2);
+        REQUIRE(batching.handler().outbox.empty());
+        REQUIRE(batching.flush_sends());
+        REQUIRE(batching.handler().outbox.size() == 1);
+        fixp_exchange(batching, peer);
+        REQUIRE(peer.handler().received.size() == 2);
+        REQUIRE(peer.handler().received[1].cl_ord_id == "B2");
+    }
+}
+
+TEST_CASE("FIXP session recovers messages lost across a reconnect", "[session][fixp]") {
+    store::MemoryMessageStore server_store{"FIXP"};
+    FixpTestSession client{fixp_config()};
+    FixpTestSession server{fixp_config()};
+    server.set_message_store(&server_store);
+    fixp_handshake(client, server);
+
+    REQUIRE(fixp_send_order(server, "E1").has_value());
+    fixp_exchange(client, server);
+
+    // E2 / E3 are written into a connection that is already gone
+    server.handler().link_up = false;
+    REQUIRE(fixp_send_order(server, "E2").has_value());
+    REQUIRE(fixp_send_order(server, "E3").has_value());
+    client.on_disconnect();
+    server.on_disconnect();
+    REQUIRE(client.state() == SessionState::Reconnecting);
+    server.handler().link_up = true;
+
+    // Already negotiated: Establish goes out directly
+    fixp_handshake(client, server);
+    REQUIRE_FALSE(client.retransmit_pending());
+    REQUIRE_FALSE(client.inbound_gaps().has_gaps());
+    REQUIRE(client.stats().resend_requests_sent == 1);
+    REQUIRE(server.stats().messages_resent == 2);
+
+    const auto& reports = client.handler().received;
+    REQUIRE(reports.size() == 3);
+    REQUIRE(reports[1].seq == 2);
+    REQUIRE(reports[1].retransmitted);
+    REQUIRE(reports[1].cl_ord_id == "E2");
+    REQUIRE(reports[2].seq == 3);
+    REQUIRE(reports[2].cl_ord_id == "E3");
+
+    REQUIRE(fixp_send_order(server, "E4").has_value());
+    fixp_exchange(client, server);
+    REQUIRE(reports.size() == 4);
+    REQUIRE(reports[3].seq == 4);
+    REQUIRE_FALSE(reports[3].retransmitted);
+    REQUIRE(client.handler().errors.empty());
+
+    SECTION("Without a store the range is rejected and dropped") {
+        FixpTestSession lossy_client{fixp_config()};
+        FixpTestSession lossy_server{fixp_config()};
+        fixp_handshake(lossy_client, lossy_server);
+        lossy_server.handler().link_up = false;
+        REQUIRE(fixp_send_order(lossy_server, "LOST").has_value());
+        lossy_client.on_disconnect();
+        lossy_server.on_disconnect();
+        lossy_server.handler().link_up = true;
+
+        fixp_handshake(lossy_client, lossy_server);
+        REQUIRE_FALSE(lossy_client.retransmit_pending());
+        REQUIRE_FALSE(lossy_client.inbound_gaps().has_gaps());
+        REQUIRE(lossy_client.sequences().expected_inbound() == 2);
+        REQUIRE(lossy_client.handler().errors == std::vector{SessionErrorCode::SequenceGap});
+    }
+}
+
+TEST_CASE("FIXP session keepalive, timeout and terminate", "[session][fixp]") {
+    FixpTestSession client{fixp_config()};
+    FixpTestSession server{fixp_config()};
+    fixp_handshake(client, server);
+    const auto now = FixpTestSession::Clock::now();
+
+    SECTION("Idle side sends a Sequence keepalive") {
+        client.on_timer_tick(now + std::chrono::milliseconds{1100});
+        REQUIRE(client.stats().heartbeats_sent == 1);
+        REQUIRE(client.handler().outbox.size() == 1);
+        fixp_exchange(client, server);
+        REQUIRE(server.stats().heartbeats_received == 1);
+        REQUIRE(server.handler().errors.empty());
+    }
+
+    SECTION("Silent peer times out") {
+        server.on_timer_tick(now + std::chrono::seconds{5});
+        REQUIRE(server.state() == SessionState::Error);
+        REQUIRE(server.handler().errors == std::vector{SessionErrorCode::HeartbeatTimeout});
+    }
+
+    SECTION("Terminate is answered and closes both sides") {
+        REQUIRE(client.terminate().has_value());
+        REQUIRE(client.state() == SessionState::LogoutPending);
+        fixp_exchange(client, server);
+        REQUIRE(client.state() == SessionState::Disconnected);
+        REQUIRE(server.state() == SessionState::Disconnected);
+        REQUIRE_FALSE(fixp_send_order(client, "LATE").has_value());
+    }
+}
+
+TEST_CASE("FIXP acceptor rejects Establish before Negotiate", "[session][fixp]") {
+    FixpTestSession server{fixp_config()};
+    server.on_connect();
+
+    std::array<char, 64> frame{};
+    sbe::SbeFrameWriter<> writer{frame};
+    writer.add<sbe::EstablishCodec>()->sessionId(0xC0FFEE).nextSeqNo(1).keepaliveInterval(1000);
+    server.on_data_received(writer.frame());
+
+    REQUIRE(server.state() == SessionState::SocketConnected);
+    REQUIRE(server.handler().errors == std::vector{SessionErrorCode::LogonRejected});
+    REQUIRE(server.handler().outbox.size() == 1);
+
+    const auto& reply = server.handler().outbox[0];
+    auto reject = sbe::EstablishmentRejectCodec::wrapForDecode(
+        reply.data() + sbe::Sofh::SIZE, reply.size() - sbe::Sofh::SIZE);
+    REQUIRE(reject.isValid());
+    REQUIRE(reject.code() == sbe::FixpRejectCode::Unnegotiated);
+}
+
+// ============================================================================
+// Acceptor Engine
+// ============================================================================
+
+TEST_CASE("CompIdIndex routes CompID pairs to sessions", "[session][acceptor]") {
+    CompIdIndex<8> index;
+
+    REQUIRE(index.insert("EXCH", "CLIENT1", 0));
+    REQUIRE(index.insert("EXCH", "CLIENT2", 1));
+    REQUIRE(index.insert("CLIENT1", "EXCH", 2));  // Direction matters
+    REQUIRE(index.size() == 3);
+
+    REQUIRE(index.find("EXCH", "CLIENT1") == 0);
+    REQUIRE(index.find("EXCH", "CLIENT2") == 1);
+    REQUIRE(index.find("CLIENT1", "EXCH") == 2);
+    REQUIRE(index.find("EXCH", "CLIENT3") == CompIdIndex<8>::NOT_FOUND);
+    REQUIRE(index.find("", "") == CompIdIndex<8>::NOT_FOUND);
+
+    SECTION("Duplicate pair is refused") {
+        REQUIRE_FALSE(index.insert("EXCH", "CLIENT1", 7));
+        REQUIRE(index.find("EXCH", "CLIENT1") == 0);
+    }
+
+    SECTION("Keys are owned by the index") {
+        std::string sender = "EXCH";
+        std::string target = "CLIENT9";
+        REQUIRE(index.insert(sender, target, 3));
+        sender = "XXXX";
+        target = "XXXXXXX";
+        REQUIRE(index.find("EXCH", "CLIENT9") == 3);
+    }
+
+    SECTION("Full index refuses new pairs") {
+        for (uint32_t i = 3; i < 8; ++i) {
+            REQUIRE(index.insert("EXCH", "C" + std::to_string(i), i));
+        }
+        REQUIRE_FALSE(index.insert("EXCH", "OVERFLOW", 8));
+        for (uint32_t i = 3; i < 8; ++i) {
+            REQUIRE(index.find("EXCH", "C" + std::to_string(i)) == i);
+        }
+    }
+}
+
+// ============================================================================
+// Sharded Runtime
+// ============================================================================
+
+TEST_CASE("ShardMessage carries a bounded payload", "[session][shard]") {
+    ShardMessage msg{.kind = 7, .tag = 42};
+    REQUIRE(msg.data().empty());
+
+    const std::string_view order = "ORD-1|BUY|100@50.25";
+    REQUIRE(msg.set_payload(order));
+    REQUIRE(msg.length == order.size());
+    REQUIRE(std::string_view{msg.data().data(), msg.data().size()} == order);
+
+    const std::string oversized(ShardMessage::PAYLOAD_SIZE + 1, 'x');
+    REQUIRE_FALSE(msg.set_payload(oversized));
+    REQUIRE(msg.length == order.size());  // Unchanged
+
+    REQUIRE(msg.set_payload(std::string(ShardMessage::PAYLOAD_SIZE, 'y')));
+    REQUIRE(msg.data().size() == ShardMessage::PAYLOAD_SIZE);
+
+    ShardSessionRef none;
+    REQUIRE_FALSE(none.valid());
+    REQUIRE(ShardSessionRef{0, 3}.valid());
+    REQUIRE(ShardSessionRef{1, 3} != ShardSessionRef{0, 3});
+}
+
+// ============================================================================
+// Timer Wheel
+// ============================================================================
+
+TEST_CASE("TimerWheel fires due timers across levels", "[session][timer]") {
+    using namespace std::chrono_literals;
+    const auto t0 = util::TimerWheel::Clock::time_point{};
+    util::TimerWheel wheel{10ms, t0};
+
+    std::vector<int> fired;
+    struct Probe {
+        std::vector<int>* fired;
+        int id;
+        static void fire(void* ctx) noexcept {
+            auto* p = static_cast<Probe*>(ctx);
+            p->fired->push_back(p->id);
+        }
+    };
+    Probe near{&fired, 1}, mid{&fired, 2}, far{&fired, 3}, parked{&fired, 4};
+    util::TimerNode a{&Probe::fire, &near}, b{&Probe::fire, &mid};
+    util::TimerNode c{&Probe::fire, &far}, d{&Probe::fire, &parked};
+
+    wheel.schedule_after(a, 50ms);         // Level 0
+    wheel.schedule_after(b, 3s);           // Level 1
+    wheel.schedule_after(c, 30min);        // Level 3
+    wheel.schedule_after(d, 24h * 3);      // Beyond the span: parked
+    REQUIRE(wheel.size() == 4);
+
+    REQUIRE(wheel.advance(t0 + 40ms) == 0);
+    REQUIRE(wheel.advance(t0 + 50ms) == 1);
+    REQUIRE(fired == std::vector{1});
+
+    REQUIRE(wheel.advance(t0 + 2990ms) == 0);
+    REQUIRE(wheel.advance(t0 + 3s) == 1);
+    REQUIRE(wheel.advance(t0 + 30min - 10ms) == 0);
+    REQUIRE(wheel.advance(t0 + 30min) == 1);
+    REQUIRE(fired == std::vector{1, 2, 3});
+
+    REQUIRE(wheel.advance(t0 + 24h * 3 - 10ms) == 0);
+    REQUIRE(wheel.advance(t0 + 24h * 3) == 1);
+    REQUIRE(fired == std::vector{1, 2, 3, 4});
+    REQUIRE(wheel.empty());
+
+    SECTION("Reschedule and cancel") {
+        wheel.schedule_after(a, 100ms);
+        wheel.schedule_after(a, 200ms);    // Replaces the first deadline
+        wheel.schedule_after(b, 100ms);
+        wheel.cancel(b);
+        REQUIRE(wheel.size() == 1);
+        REQUIRE_FALSE(b.armed());
+
+        REQUIRE(wheel.advance(wheel.now() + 150ms) == 0);
+        REQUIRE(wheel.advance(wheel.now() + 50ms) == 1);
+        REQUIRE(fired.back() == 1);
+    }
+
+    SECTION("Past deadline scheduled from a callback fires next tick") {
+        struct Rearm {
+            util::TimerWheel* wheel;
+            util::TimerNode* node;
+            int count{0};
+            static void fire(void* ctx) noexcept {
+                auto* r = static_cast<Rearm*>(ctx);
+                if (++r->count < 3) r->wheel->schedule(*r->node, util::TimerWheel::TimePoint{});
+            }
+        };
+        util::TimerNode node;
+        Rearm rearm{&wheel, &node};
+        node.bind(&Rearm::fire, &rearm);
+
+        wheel.schedule_after(node, 10ms);
+        REQUIRE(wheel.advance(wheel.now() + 10ms) == 1);
+        REQUIRE(rearm.count == 1);
+        REQUIRE(wheel.advance(wheel.now() + 20ms) == 2);
+        REQUIRE(rearm.count == 3);
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("Destroyed node leaves the wheel") {
+        {
+            util::TimerNode temp{&Probe::fire, &near};
+            wheel.schedule_after(temp, 1s);
+            REQUIRE(wheel.size() == 1);
+        }
+        REQUIRE(wheel.empty());
+    }
+}
+
+TEST_CASE("SessionManager heartbeats from a timer wheel", "[session][timer]") {
+    using namespace std::chrono_literals;
+    const auto t0 = util::TimerWheel::Clock::now();
+    util::TimerWheel wheel{10ms, t0};
+
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.logon_timeout = 10;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.set_timer_wheel(&wheel);
+
+    auto sent_type = [&](size_t i) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{sent[i].data(), sent[i].size()});
+        return parsed ? parsed->msg_type() : '\0';
+    };
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    REQUIRE(wheel.size() == 1);  // Logon timeout
+
+    SECTION("Logon timeout") {
+        wheel.advance(t0 + 9s);
+        REQUIRE(session.state() == SessionState::LogonSent);
+        wheel.advance(t0 + 10s);
+        REQUIRE(session.state() == SessionState::Disconnected);
+        REQUIRE(session.handler().routed == "error;");
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("Heartbeat, test request, timeout") {
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+        REQUIRE(wheel.size() == 2);  // Heartbeat + test request
+
+        wheel.advance(t0 + 29s);
+        REQUIRE(sent.size() == 1);
+        wheel.advance(t0 + 30s);
+        REQUIRE(sent.size() == 2);
+        REQUIRE(sent_type(1) == '0');
+
+        // Inbound traffic pushes the test request back from 45 s to 85 s
+        wheel.advance(t0 + 40s);
+        feed(session, make_message("0", 2));
+        wheel.advance(t0 + 84s);
+        REQUIRE(sent.size() == 3);
+        REQUIRE(sent_type(2) == '0');  // Heartbeat at 60 s
+        wheel.advance(t0 + 85s);
+        REQUIRE(sent.size() == 4);
+        REQUIRE(sent_type(3) == '1');  // TestRequest
+
+        SECTION("Answered") {
+            feed(session, make_message("0", 3, "112=TEST1\x01"));
+            wheel.advance(t0 + 110s);
+            REQUIRE(session.state() == SessionState::Active);
+        }
+
+        SECTION("Unanswered") {
+            wheel.advance(t0 + 99s);
+            REQUIRE(session.state() == SessionState::Active);
+            wheel.advance(t0 + 100s);
+            REQUIRE(session.state() == SessionState::Error);
+            REQUIRE(wheel.empty());
+        }
+    }
+
+    SECTION("Disconnect cancels everything") {
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        session.on_disconnect();
+        REQUIRE(wheel.empty());
+    }
+}
+
+TEST_CASE("RttProbe times TestRequests and SessionGroup routes to the fastest gateway", "[session][rtt]") {
+    using Session = SessionManager<RecordingHandler>;
+    std::vector<std::string> sent_a, sent_b;
+    Session a{client_config(), RecordingHandler{&sent_a, {}, 0}};
+    Session b{client_config(), RecordingHandler{&sent_b, {}, 0}};
+    RttProbe probe_a, probe_b;
+    a.set_rtt_probe(&probe_a);
+    b.set_rtt_probe(&probe_b);
+
+    SessionGroup<Session, 2> group;
+    REQUIRE(group.add(a, probe_a));
+    REQUIRE(group.add(b, probe_b));
+    REQUIRE_FALSE(group.add(a, probe_a));
+    REQUIRE(group.select() == group.NONE);               // Nobody logged on
+
+    auto test_req_id = [](const std::string& raw) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{raw.data(), raw.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == '1');
+        return std::string{parsed->get_string(tag::TestReqID::value)};
+    };
+    auto send_order = [&group] {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("ORD1")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return group.send_app_message(order);
+    };
+
+    for (Session* s : {&a, &b}) {
+        s->on_connect();
+        REQUIRE(s->initiate_logon().has_value());
+        feed(*s, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(s->state() == SessionState::Active);
+    }
+    REQUIRE(group.select() == 0);                         // Unmeasured fallback
+
+    // First tick probes; the id carries the send tsc
+    const uint64_t before = util::detail::rdtscp();
+    a.on_timer_tick();
+    REQUIRE(sent_a.size() == 2);
+    const std::string id = test_req_id(sent_a[1]);
+    REQUIRE(id.size() == RttProbe::ID_LENGTH);
+    REQUIRE(RttProbe::decode_id(id) >= before);
+    REQUIRE(probe_a.stats().outstanding_tsc == RttProbe::decode_id(id));
+    a.on_timer_tick();
+    REQUIRE(sent_a.size() == 2);                          // One probe outstanding
+
+    // Foreign and stale ids are ignored; the echo is a sample
+    feed(a, make_message("0", 2, "112=TEST1\x01"));
+    feed(a, make_message("0", 3, "112=RTT0000000000000001\x01"));
+    REQUIRE_FALSE(probe_a.stats().measured());
+    feed(a, make_message("0", 4, "112=" + id + "\x01"));
+    RttStats stats = probe_a.stats();
+    REQUIRE(stats.samples == 1);
+    REQUIRE(stats.outstanding_tsc == 0);
+    REQUIRE(stats.ewma_ns == stats.last_ns);
+    REQUIRE(a.stats().heartbeats_received == 3);
+
+    // EWMA, extremes and percentiles from recorded samples
+    RttProbe meter{RttProbeConfig{.ewma_shift = 1}};
+    meter.record(100'000);
+    meter.record(300'000);
+    stats = meter.stats();
+    REQUIRE(stats.ewma_ns == 200'000);
+    REQUIRE(stats.min_ns == 100'000);
+    REQUIRE(stats.max_ns == 300'000);
+    REQUIRE(stats.p99_ns >= 300'000 * 15 / 16);
+    (void)meter.next_id(1);
+    (void)meter.next_id(2);
+    meter.reset();
+    REQUIRE(meter.stats().lost == 2);
+
+    // Route by EWMA, with hysteresis
+    probe_a.record(500'000);
+    probe_b.record(10'000);
+    REQUIRE(group.select() == 1);
+    REQUIRE(group.switches() == 1);
+    for (int i = 0; i < 40; ++i) probe_a.record(9'500);     // Within the 10% margin
+    REQUIRE(group.select() == 1);
+    for (int i = 0; i < 40; ++i) probe_a.record(8'000);
+    REQUIRE(group.select() == 0);
+    REQUIRE(group.switches() == 2);
+
+    const size_t before_a = sent_a.size();
+    REQUIRE(send_order().has_value());
+    REQUIRE(sent_a.size() == before_a + 1);
+
+    // A session that drops out is skipped
+    a.on_disconnect();
+    REQUIRE(probe_a.stats().outstanding_tsc == 0);
+    const size_t before_b = sent_b.size();
+    REQUIRE(send_order().has_value());
+    REQUIRE(sent_b.size() == before_b + 1);
+    REQUIRE(group.current() == 1);
+
+    b.on_disconnect();
+    REQUIRE(send_order().error().code == SessionErrorCode::NotConnected);
+}
+
+TEST_CASE("Queued messages are restamped with their real sequence", "[session][throttle]") {
+    fix44::NewOrderSingle::Builder order;
+    order.sender_comp_id("CLIENT")
+        .target_comp_id("BROKER")
+        .cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit);
+
+    MessageAssembler assembler;
+    const auto placeholder = order.msg_seq_num(0).sending_time("20240102-09:30:00.000").build(assembler);
+    const std::string queued{placeholder.data(), placeholder.size()};
+    const auto real = order.msg_seq_num(12345).sending_time("20240102-09:30:01.250").build(assembler);
+    const std::string expected{real.data(), real.size()};
+
+    std::array<char, 512> out{};
+    const size_t size = restamp_queued(std::span<const char>{queued.data(), queued.size()}, 12345,
+                                       "20240102-09:30:01.250", out);
+    REQUIRE(std::string{out.data(), size} == expected);
+
+    REQUIRE(restamp_queued(std::span<const char>{queued.data(), 10}, 1, "x", out) == 0);
+    REQUIRE(is_cancel_message(std::span<const char>{queued.data(), queued.size()}) == false);
+}
+
+TEST_CASE("OutboundThrottle releases cancels ahead of orders", "[session][throttle]") {
+    OutboundThrottle throttle{{.rate_per_second = 10, .burst = 2, .queue_capacity = 3, .slot_size = 16}};
+
+    REQUIRE(throttle.try_acquire(0));
+    REQUIRE(throttle.try_acquire(0));
+    REQUIRE_FALSE(throttle.try_acquire(0));
+    REQUIRE(throttle.next_available(0) == 100'000'000);
+
+    auto bytes = [](std::string_view s) { return std::span<const char>{s.data(), s.size()}; };
+    REQUIRE(throttle.push(bytes("D1"), false));
+    REQUIRE(throttle.push(bytes("D2"), false));
+    REQUIRE(throttle.push(bytes("F1"), true));
+    REQUIRE_FALSE(throttle.push(bytes("D3"), false));                  // Pool exhausted
+    REQUIRE(throttle.size() == 3);
+
+    std::string order;
+    while (!throttle.empty()) {
+        const auto msg = throttle.front();
+        order.append(msg.data(), msg.size()).push_back(' ');
+        throttle.pop();
+    }
+    REQUIRE(order == "F1 D1 D2 ");
+
+    REQUIRE_FALSE(throttle.push(bytes("0123456789ABCDEFG"), false));  // Larger than a slot
+    REQUIRE(throttle.push(bytes("D4"), false));
+    throttle.clear();
+    REQUIRE(throttle.empty());
+}
+
+TEST_CASE("SessionManager throttles app messages", "[session][throttle]") {
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.throttle_burst = 2;
+
+    auto send_order = [](auto& session, const std::string& cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order);
+    };
+    auto send_cancel = [](auto& session) {
+        fix44::OrderCancelRequest::Builder cancel;
+        cancel.orig_cl_ord_id("ORD1")
+            .cl_ord_id("CXL1")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000");
+        return session.send_app_message(cancel);
+    };
+    auto parse = [&sent](size_t i) {
+        return ParsedMessage::parse(std::span<const char>{sent[i].data(), sent[i].size()});
+    };
+    auto logon = [](auto& session) {
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());                    // 1: Logon
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+    };
+
+    SECTION("Reject") {
+        config.throttle_rate = 1;
+        config.throttle_mode = ThrottleMode::Reject;
+        SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());
+        REQUIRE(send_order(session, "ORD2").has_value());
+        auto rejected = send_order(session, "ORD3");
+        REQUIRE_FALSE(rejected.has_value());
+        REQUIRE(rejected.error().code == SessionErrorCode::Throttled);
+        REQUIRE(sent.size() == 3);
+        REQUIRE(session.stats().throttle_rejects == 1);
+        REQUIRE(session.stats().throttled);
+        REQUIRE(session.sequences().current_outbound() == 4);   // Nothing sequenced for ORD3
+    }
+
+    SECTION("Queue: cancels first, sequenced on release") {
+        config.throttle_rate = 50;                               // One token per 20 ms
+        SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());
+        REQUIRE(send_order(session, "ORD2").has_value());
+        REQUIRE(send_order(session, "ORD3").has_value());        // Queued
+        REQUIRE(send_cancel(session).has_value());               // Queued ahead of ORD3
+        REQUIRE(sent.size() == 3);
+        REQUIRE(session.throttled_sends() == 2);
+        REQUIRE(session.stats().throttle_queue_depth == 2);
+        REQUIRE(session.stats().throttle_queued == 2);
+        REQUIRE(session.sequences().current_outbound() == 4);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{30});
+        session.on_timer_tick();
+        REQUIRE(sent.size() >= 4);
+        auto cancel = parse(3);
+        REQUIRE(cancel.has_value());                             // CheckSum still valid
+        REQUIRE(cancel->msg_type() == 'F');
+        REQUIRE(cancel->get_int(tag::MsgSeqNum::value) == 4);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        session.on_timer_tick();
+        REQUIRE(sent.size() == 5);
+        auto order = parse(4);
+        REQUIRE(order.has_value());
+        REQUIRE(order->get_string(tag::ClOrdID::value) == "ORD3");
+        REQUIRE(order->get_int(tag::MsgSeqNum::value) == 5);
+        REQUIRE(session.stats().throttle_queue_depth == 0);
+        REQUIRE(session.stats().throttle_queue_peak == 2);
+        REQUIRE_FALSE(session.stats().throttled);
+    }
+
+    SECTION("Queue: disconnect drops unsent messages") {
+        config.throttle_rate = 1;
+        SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());
+        REQUIRE(send_order(session, "ORD2").has_value());
+        REQUIRE(send_order(session, "ORD3").has_value());
+        session.on_disconnect();
+        REQUIRE(session.throttled_sends() == 0);
+        REQUIRE(session.stats().throttle_dropped == 1);
+    }
+
+    SECTION("Delay") {
+        config.throttle_rate = 1000;
+        config.throttle_burst = 1;
+        config.throttle_mode = ThrottleMode::Delay;
+        config.throttle_max_delay_us = 5000;
+        SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());
+        REQUIRE(send_order(session, "ORD2").has_value());
+        REQUIRE(send_order(session, "ORD3").has_value());
+        REQUIRE(sent.size() == 4);
+        REQUIRE(session.stats().throttle_delayed >= 1);
+        REQUIRE(session.stats().throttle_rejects == 0);
+    }
+}
+
+namespace {
+
+/// RecordingHandler whose transport reports a scripted send queue state
+struct BackpressureHandler : RecordingHandler {
+    BackpressureState transport{BackpressureState::Clear};
+    std::vector<BackpressureState> changes;
+
+    BackpressureState send_backpressure() noexcept { return transport; }
+    void on_backpressure(BackpressureState state) noexcept { changes.push_back(state); }
+};
+
+static_assert(HasSendBackpressure<BackpressureHandler>);
+static_assert(HasOnBackpressure<BackpressureHandler>);
+static_assert(!HasSendBackpressure<RecordingHandler>);
+
+}  // namespace
+
+TEST_CASE("SessionManager holds low-priority messages while the transport drains", "[session][backpressure]") {
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.throttle_rate = 100000;
+    config.throttle_burst = 100;
+    config.hold_on_backpressure = true;
+    SessionManager<BackpressureHandler> session{config, BackpressureHandler{{&sent, {}, 0}, {}, {}}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    auto order = [](std::string_view cl_ord_id) {   // Literals: the builder keeps views
+        fix44::NewOrderSingle::Builder builder;
+        builder.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return builder;
+    };
+
+    // The send that fills the socket is reported after it
+    session.handler().transport = BackpressureState::Draining;
+    auto first = order("ORD1");
+    REQUIRE(session.send_app_message(first).has_value());
+    REQUIRE(sent.size() == 2);
+    REQUIRE(session.send_backpressure() == BackpressureState::Draining);
+    REQUIRE(session.stats().backpressured);
+    REQUIRE(session.stats().backpressure_episodes == 1);
+    REQUIRE(session.handler().changes == std::vector{BackpressureState::Draining});
+
+    // Non-urgent messages wait unsequenced; urgent ones and cancels go now
+    auto held = order("ORD2");
+    REQUIRE(session.send_app_message(held).has_value());
+    REQUIRE(sent.size() == 2);
+    REQUIRE(session.throttled_sends() == 1);
+    REQUIRE(session.stats().backpressure_held == 1);
+    REQUIRE(session.sequences().current_outbound() == 3);
+
+    auto urgent = order("ORD3");
+    REQUIRE(session.send_app_message(urgent, true).has_value());
+    REQUIRE(sent.size() == 3);
+
+    fix44::OrderCancelRequest::Builder cancel;
+    cancel.orig_cl_ord_id("ORD1")
+        .cl_ord_id("CXL1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240102-09:30:00.000");
+    REQUIRE(session.send_app_message(cancel).has_value());
+    REQUIRE(sent.size() == 4);
+    REQUIRE(sent.back().find("\x01" "35=F\x01") != std::string::npos);
+    REQUIRE(session.throttled_sends() == 1);
+
+    // Drained: the next tick sees it and releases ORD2 with the next seqnum
+    session.handler().transport = BackpressureState::Clear;
+    session.on_timer_tick();
+    REQUIRE(session.send_backpressure() == BackpressureState::Clear);
+    REQUIRE(sent.size() == 5);
+    REQUIRE(session.throttled_sends() == 0);
+    auto released = ParsedMessage::parse(std::span<const char>{sent[4].data(), sent[4].size()});
+    REQUIRE(released.has_value());
+    REQUIRE(released->get_string(tag::ClOrdID::value) == "ORD2");
+    REQUIRE(released->get_int(tag::MsgSeqNum::value) == 5);
+    REQUIRE(session.handler().changes.size() == 2);
+    REQUIRE_FALSE(session.stats().backpressured);
+}
+
+TEST_CASE("TcpTransport reports backpressure from the send queue", "[session][backpressure]") {
+    TcpAcceptor acceptor;
+    REQUIRE(acceptor.listen(0).has_value());
+
+    TcpTransport client;
+    client.configure_backpressure({.enabled = true, .high_watermark = 32 * 1024,
+                                   .low_watermark = 1024, .notsent_lowat = 16 * 1024});
+    REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+    REQUIRE(client.set_send_timeout(200));
+    auto accepted = acceptor.accept();
+    REQUIRE(accepted.has_value());
+    TcpSocket peer;
+    peer.adopt(*accepted);
+
+    SendQueueDepth depth;
+    if (!read_send_queue(client.socket().fd(), depth)) return;  // Not reported on this platform
+
+    // The peer does not read: its window closes and our sends pile up
+    const std::string chunk(4096, 'x');
+    size_t written = 0;
+    for (int i = 0; i < 4096 && client.backpressure() == BackpressureState::Clear; ++i) {
+        auto n = client.send(std::span<const char>{chunk.data(), chunk.size()});
+        if (!n || *n == 0) break;
+        written += *n;
+    }
+    REQUIRE(client.backpressure() == BackpressureState::Draining);
+    REQUIRE(client.backpressure_monitor().stats().episodes == 1);
+    REQUIRE(client.backpressure_monitor().depth().unsent > 32 * 1024);
+
+    // The peer catches up: the queue drains below the low watermark
+    std::vector<char> sink(64 * 1024);
+    size_t drained = 0;
+    for (int i = 0; i < 1000 && client.poll_backpressure() == BackpressureState::Draining; ++i) {
+        auto n = peer.receive(std::span<char>{sink.data(), sink.size()});
+        if (n) drained += *n;
+    }
+    REQUIRE(client.backpressure() == BackpressureState::Clear);
+    REQUIRE(drained > 0);
+    REQUIRE(drained <= written);
+}
+
+namespace {
+
+/// 8=FIX.4.4|9=<len>|<fields>10=<checksum>|
+std::string frame_fields(std::string_view fields) {
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(fields.size()) + "\x01" + std::string{fields};
+    auto cs = fix::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+/// Session of HUB to target, logged on
+template <typename Session>
+void log_on(Session& session, std::string_view target) {
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, frame_fields("35=A\x01" "49=" + std::string{target} + "\x01" "56=HUB\x01"
+                               "34=1\x01" "52=20240102-09:30:00.000\x01" "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+}
+
+SessionConfig hub_config(std::string_view target) {
+    SessionConfig config;
+    config.sender_comp_id = "HUB";
+    config.target_comp_id = target;
+    return config;
+}
+
+std::string_view view(std::span<const char> bytes) {
+    return {bytes.data(), bytes.size()};
+}
+
+}  // namespace
+
+TEST_CASE("Forwarded messages keep their body and patch the header", "[session][router]") {
+    constexpr std::string_view body = "11=ORD1\x01" "55=AAPL\x01" "54=1\x01" "38=100\x01" "40=1\x01";
+    const std::string received = frame_fields(
+        std::string{"35=D\x01" "49=CLIENT\x01" "56=HUB\x01" "34=17\x01"
+                    "52=20240102-09:30:00.000\x01" "128=BROKER\x01" "43=Y\x01"} + std::string{body});
+
+    const ForwardHeader header{
+        .sender_comp_id = "HUB",
+        .target_comp_id = "BROKER",
+        .msg_seq_num = 42,
+        .sending_time = "20240102-09:30:01.000",
+        .on_behalf_of_comp_id = "CLIENT",
+    };
+    const std::span<const char> raw{received.data(), received.size()};
+    std::vector<char> scratch(forward_capacity(received.size(), header));
+
+    // Three runs: the body is the received bytes themselves
+    const ForwardedMessage parts = forward_parts(raw, header, scratch);
+    REQUIRE_FALSE(parts.empty());
+    REQUIRE(parts.body.data() == received.data() + received.find("11=ORD1"));
+    REQUIRE(view(parts.body) == body);
+
+    // 49/56/34/52 rewritten, 115 added, 128 dropped, 43 kept; CheckSum
+    // patched from the received one equals one computed from scratch
+    const std::string expected = frame_fields(
+        std::string{"35=D\x01" "49=HUB\x01" "56=BROKER\x01" "34=42\x01"
+                    "52=20240102-09:30:01.000\x01" "115=CLIENT\x01" "43=Y\x01"} + std::string{body});
+    REQUIRE(std::string{view(parts.header)} + std::string{view(parts.body)} +
+            std::string{view(parts.trailer)} == expected);
+
+    std::vector<char> out(forward_capacity(received.size(), header));
+    const size_t size = rewrite_forwarded(raw, header, out);
+    REQUIRE(std::string_view{out.data(), size} == expected);
+    auto parsed = ParsedMessage::parse(std::span<const char>{out.data(), size});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get_string(tag::OnBehalfOfCompID::value) == "CLIENT");
+
+    // Malformed or too little room
+    const std::string truncated = received.substr(0, received.size() - 2);
+    REQUIRE(rewrite_forwarded(std::span<const char>{truncated.data(), truncated.size()},
+                              header, out) == 0);
+    REQUIRE(rewrite_forwarded(raw, header, std::span<char>{out.data(), 32}) == 0);
+}
+
+TEST_CASE("MessageRouter forwards between sessions by CompID and MsgType", "[session][router]") {
+    std::vector<std::string> to_broker, to_md, to_client, to_late;
+    SessionManager<RecordingHandler> broker{hub_config("BROKER"), RecordingHandler{&to_broker, {}, 0}};
+    SessionManager<RecordingHandler> md{hub_config("MDVENDOR"), RecordingHandler{&to_md, {}, 0}};
+    SessionManager<RecordingHandler> client{hub_config("CLIENT"), RecordingHandler{&to_client, {}, 0}};
+    SessionManager<RecordingHandler> late{hub_config("LATE"), RecordingHandler{&to_late, {}, 0}};
+    log_on(broker, "BROKER");
+    log_on(md, "MDVENDOR");
+    log_on(client, "CLIENT");
+
+    MessageRouter<16> router;
+    const uint32_t to_broker_id = router.add_destination(broker);
+    const uint32_t to_md_id = router.add_destination(md);
+    const uint32_t to_client_id = router.add_destination(client);
+    const uint32_t to_late_id = router.add_destination(late);
+    REQUIRE(router.add_route({.sender_comp_id = "CLIENT", .destination = to_broker_id}));
+    REQUIRE(router.add_route({.sender_comp_id = "CLIENT", .msg_type = "V", .destination = to_md_id}));
+    REQUIRE(router.add_route({.sender_comp_id = "BROKER", .deliver_to = "CLIENT",
+                              .destination = to_client_id}));
+    REQUIRE(router.add_route({.sender_comp_id = "OTHER", .destination = to_late_id,
+                              .on_behalf_of = false}));
+    REQUIRE_FALSE(router.add_route({.sender_comp_id = "CLIENT", .destination = to_md_id}));
+    REQUIRE_FALSE(router.add_route({.sender_comp_id = "X", .destination = 9}));
+    REQUIRE(router.routes().size() == 4);
+
+    auto route = [&router](const std::string& msg) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        return router.route(*parsed);
+    };
+    auto from = [](std::string_view sender, std::string_view type, std::string_view rest) {
+        return frame_fields("35=" + std::string{type} + "\x01" "49=" + std::string{sender} +
+                            "\x01" "56=HUB\x01" "34=5\x01" "52=20240102-09:30:00.000\x01" +
+                            std::string{rest});
+    };
+
+    // CLIENT's order to the broker under the broker session's header
+    REQUIRE(route(from("CLIENT", "D", "11=ORD1\x01" "55=AAPL\x01" "54=1\x01")) == RouteOutcome::Forwarded);
+    REQUIRE(to_broker.size() == 2);
+    auto order = ParsedMessage::parse(std::span<const char>{to_broker[1].data(), to_broker[1].size()});
+    REQUIRE(order.has_value());
+    REQUIRE(order->sender_comp_id() == "HUB");
+    REQUIRE(order->target_comp_id() == "BROKER");
+    REQUIRE(order->msg_seq_num() == 2);
+    REQUIRE(order->get_string(tag::OnBehalfOfCompID::value) == "CLIENT");
+    REQUIRE(order->get_string(tag::ClOrdID::value) == "ORD1");
+    REQUIRE(broker.stats().messages_forwarded == 1);
+
+    // The more specific MsgType rule wins for market data requests
+    REQUIRE(route(from("CLIENT", "V", "262=MD1\x01")) == RouteOutcome::Forwarded);
+    REQUIRE(to_md.size() == 2);
+    REQUIRE(to_broker.size() == 2);
+
+    // The reply goes by DeliverToCompID; 128 is not passed on
+    REQUIRE(route(from("BROKER", "8", "128=CLIENT\x01" "37=X1\x01" "11=ORD1\x01" "39=0\x01")) ==
+            RouteOutcome::Forwarded);
+    REQUIRE(to_client.size() == 2);
+    auto report = ParsedMessage::parse(std::span<const char>{to_client[1].data(), to_client[1].size()});
+    REQUIRE(report.has_value());
+    REQUIRE(report->target_comp_id() == "CLIENT");
+    REQUIRE(report->get_string(tag::OnBehalfOfCompID::value) == "BROKER");
+    REQUIRE(report->get_string(tag::DeliverToCompID::value).empty());
+
+    // No rule; a destination that is not logged on
+    REQUIRE(route(from("BROKER", "8", "37=X2\x01")) == RouteOutcome::NoRoute);
+    REQUIRE(route(from("OTHER", "D", "11=ORD2\x01")) == RouteOutcome::Failed);
+    REQUIRE(to_late.empty());
+
+    REQUIRE(router.stats().forwarded == 3);
+    REQUIRE(router.stats().unroutable == 1);
+    REQUIRE(router.stats().failed == 1);
+}
+
+TEST_CASE("DuplicateFilter remembers exactly the last window keys", "[session][dedup]") {
+    DuplicateFilter seen{1000};
+    REQUIRE(seen.window() == 1000);
+
+    auto exec_id = [](size_t i) { return "EXEC" + std::to_string(i); };
+    for (size_t i = 0; i < 1000; ++i) REQUIRE_FALSE(seen.check_and_insert(exec_id(i)));
+    REQUIRE(seen.size() == 1000);
+    REQUIRE(seen.check_and_insert("EXEC17"));
+    REQUIRE(seen.stats().hits == 1);
+
+    // Each new key evicts the oldest; the index stays exact across evictions
+    for (size_t i = 1000; i < 5000; ++i) REQUIRE_FALSE(seen.check_and_insert(exec_id(i)));
+    REQUIRE(seen.size() == 1000);
+    REQUIRE(seen.stats().evictions == 4000);
+    for (size_t i = 0; i < 4000; ++i) REQUIRE_FALSE(seen.contains(exec_id(i)));
+    for (size_t i = 4000; i < 5000; ++i) REQUIRE(seen.contains(exec_id(i)));
+
+    // Long keys: compared on prefix, length and hash
+    const std::string long_a(80, 'a');
+    std::string long_b = long_a;
+    long_b.back() = 'b';
+    REQUIRE_FALSE(seen.check_and_insert(long_a));
+    REQUIRE(seen.contains(long_a));
+    REQUIRE_FALSE(seen.contains(long_b));
+
+    seen.clear();
+    REQUIRE(seen.size() == 0);
+    REQUIRE_FALSE(seen.contains("EXEC4999"));
+}
+
+TEST_CASE("SessionManager drops PossDup repeats by ExecID and ClOrdID", "[session][dedup]") {
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.duplicate_window = 64;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    feed(session, make_message("8", 2, "37=O1\x01" "17=E1\x01" "11=ORD1\x01" "39=0\x01"));
+    REQUIRE(session.handler().routed == "exec;");
+
+    // Resent after a reconnect: already booked
+    feed(session, make_message("8", 3, "43=Y\x01" "37=O1\x01" "17=E1\x01" "11=ORD1\x01" "39=0\x01"));
+    REQUIRE(session.handler().routed == "exec;");
+    REQUIRE(session.stats().duplicates_dropped == 1);
+    REQUIRE(session.sequences().expected_inbound() == 4);
+
+    // PossDup but never seen: delivered
+    feed(session, make_message("8", 4, "43=Y\x01" "37=O1\x01" "17=E2\x01" "11=ORD1\x01" "39=2\x01"));
+    REQUIRE(session.handler().routed == "exec;exec;");
+
+    // Orders by ClOrdID with PossResend
+    feed(session, make_message("D", 5, "11=ORD9\x01" "55=AAPL\x01" "54=1\x01"));
+    feed(session, make_message("D", 6, "97=Y\x01" "11=ORD9\x01" "55=AAPL\x01" "54=1\x01"));
+    REQUIRE(session.handler().routed == "exec;exec;app:D;");
+    REQUIRE(session.stats().duplicates_dropped == 2);
+}
+
+TEST_CASE("KillSwitch fires pre-built cancels in one batch", "[session][killswitch]") {
+    std::vector<std::string> sent;
+    store::MemoryMessageStore message_store{"CLIENT-BROKER"};
+    const SessionConfig config = client_config();
+    SessionManager<BatchHandler> session{config, BatchHandler{&sent, {}, {}}};
+    session.set_message_store(&message_store);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    KillSwitch kill{config, {.capacity = 4, .slot_size = 256, .cancel_id_prefix = "KS"}};
+    const auto h1 = kill.arm("ORD1", "AAPL", Side::Buy, Qty::from_int(100));
+    const auto h2 = kill.arm("ORD2", "MSFT", Side::Sell, Qty::from_int(200));
+    const auto h3 = kill.arm("ORD3", "IBM", Side::Buy);
+    REQUIRE(h1 != KillSwitch::INVALID_HANDLE);
+    REQUIRE(kill.armed() == 3);
+
+    // ORD2 filled: its cancel is dropped, a stale handle is refused
+    REQUIRE(kill.disarm(h2));
+    REQUIRE_FALSE(kill.disarm(h2));
+    REQUIRE(kill.armed() == 2);
+
+    const size_t before = sent.size();
+    REQUIRE(kill.fire(session) == 2);
+    REQUIRE(session.handler().batches == std::vector<size_t>{2});
+    REQUIRE(sent.size() == before + 2);
+
+    std::vector<std::string> orig_ids;
+    for (size_t i = before; i < sent.size(); ++i) {
+        const std::string& wire = sent[i];
+        INFO(wire);
+        REQUIRE(parser::validate_fix_checksum(wire));
+        auto parsed = ParsedMessage::parse(std::span<const char>{wire.data(), wire.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->get_string(tag::MsgType::value) == "F");
+        REQUIRE(parsed->msg_seq_num() == 2 + (i - before));
+        REQUIRE(parsed->get_string(tag::TransactTime::value) == parsed->sending_time());
+        REQUIRE(message_store.retrieve(parsed->msg_seq_num()).has_value());
+        orig_ids.emplace_back(parsed->get_string(tag::OrigClOrdID::value));
+    }
+    std::sort(orig_ids.begin(), orig_ids.end());
+    REQUIRE(orig_ids == std::vector<std::string>{"ORD1", "ORD3"});
+    REQUIRE(kill.stats().cancels_sent == 2);
+
+    // Slots are reused, full is reported
+    REQUIRE(kill.disarm(h1));
+    REQUIRE(kill.disarm(h3));
+    for (int i = 0; i < 4; ++i) REQUIRE(kill.arm("ORD", "AAPL", Side::Buy) != KillSwitch::INVALID_HANDLE);
+    REQUIRE(kill.arm("ORD", "AAPL", Side::Buy) == KillSwitch::INVALID_HANDLE);
+    REQUIRE(kill.stats().arm_failures == 1);
+
+    // Venue with OrderMassCancelRequest: one 35=q
+    KillSwitch mass{config, {.mass_cancel = true}};
+    REQUIRE(mass.fire(session) == 1);
+    const std::string& wire = sent.back();
+    REQUIRE(wire.find("\x01" "35=q\x01") != std::string::npos);
+    REQUIRE(wire.find("\x01" "530=7\x01") != std::string::npos);
+    REQUIRE(parser::validate_fix_checksum(wire));
+}
+
+TEST_CASE("ExchangeSimulator matches orders and delays its reports", "[session][simulator]") {
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    using Simulator = ExchangeSimulator<SessionManager<RecordingHandler>>;
+    Simulator sim{session, {
+        .fill_ratio = 0.0,
+        .ack_latency = {.distribution = LatencyDistribution::Fixed, .min_ns = 1000},
+        .max_orders = 16,
+        .max_pending = 8,
+    }};
+
+    uint32_t seq = 2;
+    auto request = [&](Simulator& s, std::string_view type, std::string_view body, uint64_t now) {
+        const std::string msg = make_message(type, seq++, body);
+        auto parsed = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        s.on_app_message(*parsed, now);
+    };
+    std::vector<std::string> reports;
+    auto take = [&](Simulator& s, uint64_t now) {
+        const size_t before = sent.size();
+        s.poll(now);
+        reports.assign(sent.begin() + static_cast<std::ptrdiff_t>(before), sent.end());
+        for (const std::string& wire : reports) REQUIRE(parser::validate_fix_checksum(wire));
+        return reports.size();
+    };
+    auto field = [&](size_t i, int tag) {
+        auto parsed = ParsedMessage::parse(std::span<const char>{reports[i].data(), reports[i].size()});
+        REQUIRE(parsed.has_value());
+        return std::string{parsed->get_string(tag)};
+    };
+
+    // Resting buy: acknowledged once its latency has passed
+    request(sim, "D", "11=B1\x01" "55=AAPL\x01" "54=1\x01" "38=100\x01" "40=2\x01" "44=10\x01", 0);
+    REQUIRE(take(sim, 999) == 0);
+    REQUIRE(take(sim, 1000) == 1);
+    CHECK(field(0, tag::MsgType::value) == "8");
+    CHECK(field(0, tag::ExecType::value) == "0");
+    CHECK(field(0, tag::ClOrdID::value) == "B1");
+    CHECK(field(0, tag::LeavesQty::value) == "0000000100");
+    CHECK(sim.book().size() == 1);
+
+    // Crossing sell trades at the resting price; both sides get a report
+    request(sim, "D", "11=S1\x01" "55=AAPL\x01" "54=2\x01" "38=60\x01" "40=2\x01" "44=9.5\x01", 2000);
+    REQUIRE(take(sim, 3000) == 3);
+    CHECK(field(0, tag::ClOrdID::value) == "S1");
+    CHECK(field(1, tag::ClOrdID::value) == "B1");
+    CHECK(field(1, tag::ExecType::value) == "F");
+    CHECK(field(1, tag::OrdStatus::value) == "1");
+    CHECK(field(1, tag::LastPx::value) == "00000010.00000000");
+    CHECK(field(2, tag::ClOrdID::value) == "S1");
+    CHECK(field(2, tag::OrdStatus::value) == "2");
+    CHECK(field(2, tag::LastQty::value) == "0000000060");
+    CHECK(sim.book().size() == 1);
+    CHECK(sim.stats().trades == 2);
+
+    // Sequenced by the session, in order
+    for (size_t i = 1; i < reports.size(); ++i) {
+        CHECK(std::stoul(field(i, tag::MsgSeqNum::value)) == std::stoul(field(i - 1, tag::MsgSeqNum::value)) + 1);
+    }
+
+    // Replace re-keys the order; cancel takes it off the book
+    request(sim, "G", "11=B2\x01" "41=B1\x01" "55=AAPL\x01" "54=1\x01" "38=80\x01" "40=2\x01" "44=9\x01", 4000);
+    request(sim, "F", "11=C1\x01" "41=B2\x01" "55=AAPL\x01" "54=1\x01", 4000);
+    REQUIRE(take(sim, 5000) == 2);
+    CHECK(field(0, tag::ExecType::value) == "5");
+    CHECK(field(0, tag::OrigClOrdID::value) == "B1");
+    CHECK(field(0, tag::LeavesQty::value) == "0000000020");
+    CHECK(field(1, tag::ExecType::value) == "4");
+    CHECK(field(1, tag::ClOrdID::value) == "C1");
+    CHECK(field(1, tag::OrigClOrdID::value) == "B2");
+    CHECK(sim.book().size() == 0);
+
+    // Unknown orders: OrderCancelReject; bad orders: Rejected
+    request(sim, "F", "11=C2\x01" "41=B2\x01", 6000);
+    request(sim, "G", "11=B3\x01" "41=NOPE\x01" "38=5\x01", 6000);
+    request(sim, "D", "11=Z1\x01" "55=AAPL\x01" "54=1\x01" "38=0\x01" "40=2\x01" "44=10\x01", 6000);
+    REQUIRE(take(sim, 7000) == 3);
+    CHECK(field(0, tag::MsgType::value) == "9");
+    CHECK(field(0, 434) == "1");
+    CHECK(field(1, 434) == "2");
+    CHECK(field(2, tag::ExecType::value) == "8");
+    CHECK(sim.stats().cancel_rejects == 2);
+    CHECK(sim.stats().rejects == 1);
+
+    SECTION("Simulated liquidity fills after the fill latency") {
+        Simulator venue{session, {
+            .fill_ratio = 1.0,
+            .partial_fill_ratio = 1.0,
+            .ack_latency = {.min_ns = 100},
+            .fill_latency = {.min_ns = 5000},
+        }};
+        request(venue, "D", "11=P1\x01" "55=MSFT\x01" "54=2\x01" "38=10\x01" "40=2\x01" "44=5\x01", 0);
+        REQUIRE(take(venue, 100) == 1);
+        CHECK(field(0, tag::ExecType::value) == "0");
+        REQUIRE(take(venue, 5100) == 1);
+        CHECK(field(0, tag::ExecType::value) == "F");
+        CHECK(field(0, tag::LastQty::value) == "0000000005");
+        CHECK(field(0, tag::LeavesQty::value) == "0000000005");
+        CHECK(venue.book().size() == 1);
+
+        // A later ack is not sent ahead of an earlier fill
+        request(venue, "D", "11=P2\x01" "55=MSFT\x01" "54=1\x01" "38=8\x01" "40=1\x01" "59=3\x01", 6000);
+        request(venue, "D", "11=P3\x01" "55=MSFT\x01" "54=1\x01" "38=1\x01" "40=2\x01" "44=1\x01", 6000);
+        CHECK(venue.next_due_ns() == 6100);
+        REQUIRE(take(venue, 6100) == 3);   // P2 New, Trade for P1, Trade for P2
+        CHECK(field(1, tag::ClOrdID::value) == "P1");
+        CHECK(field(1, tag::OrdStatus::value) == "2");
+        CHECK(field(2, tag::ClOrdID::value) == "P2");
+        CHECK(field(2, tag::LastQty::value) == "0000000005");
+        REQUIRE(take(venue, 11099) == 0);  // Everything after P2's simulated fill waits for it
+        REQUIRE(take(venue, 11100) == 4);
+        CHECK(field(0, tag::ExecType::value) == "F");
+        CHECK(field(0, tag::LastQty::value) == "0000000001");
+        CHECK(field(1, tag::ExecType::value) == "4");   // Market remainder
+        CHECK(field(1, tag::ClOrdID::value) == "P2");
+        CHECK(field(2, tag::ClOrdID::value) == "P3");
+        CHECK(field(3, tag::ExecType::value) == "F");
+        CHECK(venue.book().size() == 0);
+    }
+
+    SECTION("Full pending slots release the oldest early") {
+        const size_t before = sent.size();
+        for (int i = 0; i < 10; ++i) {
+            request(sim, "D", "11=Q" + std::to_string(i) + "\x01" "55=IBM\x01" "54=1\x01" "38=1\x01"
+                              "40=2\x01" "44=1\x01", 10000);
+        }
+        CHECK(sent.size() == before + 2);
+        CHECK(sim.stats().early_releases == 2);
+        CHECK(sim.pending() == 8);
+        sim.clear_pending();
+        CHECK(take(sim, UINT64_MAX) == 0);
+    }
+}
+
+TEST_CASE("Simulator latency models", "[session][simulator]") {
+    SimRandom rng{42};
+    const LatencyModel uniform{.distribution = LatencyDistribution::Uniform, .min_ns = 100, .max_ns = 200};
+    const LatencyModel exponential{.distribution = LatencyDistribution::Exponential,
+                                   .min_ns = 1000, .max_ns = 50000, .mean_ns = 4000};
+    uint64_t sum = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const uint64_t u = uniform.sample(rng);
+        REQUIRE((u >= 100 && u <= 200));
+        const uint64_t e = exponential.sample(rng);
+        REQUIRE((e >= 1000 && e <= 50000));
+        sum += e - 1000;
+    }
+    CHECK((sum / 100000 > 3800 && sum / 100000 < 4200));
+    CHECK(LatencyModel{.min_ns = 7}.sample(rng) == 7);
+}
+
+namespace {
+
+Task<int> frame_child(int value) {
+    co_return value * 2;
+}
+
+Task<int> frame_parent(int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) sum += co_await frame_child(i);
+    co_return sum;
+}
+
+/// Place an order, then follow it until it is filled or the session drops
+Task<void> async_order_flow(AsyncSession<RecordingHandler>& session, std::string& log) {
+    fix44::NewOrderSingle::Builder order;
+    order.cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit);
+    auto sent = co_await session.send(order);
+    if (!sent) {
+        log += "send-failed;";
+        co_return;
+    }
+    log += "sent;";
+    for (;;) {
+        const ParsedMessage* report = co_await session.next_execution("ORD1");
+        if (!report) {
+            log += "lost;";
+            co_return;
+        }
+        const char status = report->get_char(tag::OrdStatus::value);
+        log += std::string{"er:"} + status + ";";
+        if (status == '2') co_return;
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Coroutine frames are recycled by the frame pool", "[session][coroutine]") {
+    REQUIRE(frame_parent(4).get() == 12);   // Warm the size classes
+    const auto before = memory::CoroutineFramePool::stats();
+
+    REQUIRE(frame_parent(100).get() == 9900);
+    const auto after = memory::CoroutineFramePool::stats();
+    REQUIRE(after.allocations - before.allocations == 101);
+    REQUIRE(after.reused - before.reused == 101);
+    REQUIRE(after.chunks == before.chunks);
+    REQUIRE(after.oversized == before.oversized);
+}
+
+TEST_CASE("Coroutine frame pool reports size classes", "[session][coroutine]") {
+    using Pool = memory::CoroutineFramePool;
+    static_assert(Pool::class_size(0) == Pool::CLASS_SIZE);
+
+    Pool::reserve(Pool::CLASS_SIZE * 3, 4);         // Pre-warmed: no chunk on first use
+    const auto& cls = Pool::class_stats(Pool::CLASS_SIZE * 3);
+    REQUIRE(cls.free >= 4);
+    REQUIRE(&cls == &Pool::all_class_stats()[2]);
+
+    Pool::reset_stats();
+    void* a = Pool::allocate(150);
+    void* b = Pool::allocate(170);
+    REQUIRE(cls.allocations == 2);
+    REQUIRE(cls.reused == 2);
+    REQUIRE(cls.in_use == 2);
+    REQUIRE(Pool::stats().chunks == 0);
+
+    Pool::deallocate(a, 150);
+    Pool::deallocate(b, 170);
+    REQUIRE(cls.in_use == 0);
+    REQUIRE(cls.peak == 2);
+
+    void* big = Pool::allocate(Pool::MAX_POOLED + 1);
+    REQUIRE(Pool::stats().oversized == 1);
+    Pool::deallocate(big, Pool::MAX_POOLED + 1);
+
+    auto counter = []() -> Generator<int> {
+        for (int i = 0; i < 3; ++i) co_yield i;
+    }();
+    int total = 0;
+    while (auto value = counter.next()) total += *value;
+    REQUIRE(total == 3);
+    REQUIRE(Pool::stats().allocations == 3);        // Two above plus the generator
+}
+
+TEST_CASE("AsyncSession resumes coroutines from session callbacks", "[session][coroutine]") {
+    std::vector<std::string> sent;
+    AsyncSession<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    std::string log;
+
+    auto flow = async_order_flow(session, log);
+    flow.resume();
+    REQUIRE(log.empty());                   // Not logged on: send() waits
+    REQUIRE(session.has_waiters());
+
+    session.session().on_connect();
+    REQUIRE(session.session().initiate_logon().has_value());
+    REQUIRE(sent.size() == 1);
+
+    feed(session.session(), make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.logged_on());
+    REQUIRE(log == "sent;");                // Resumed by on_logon()
+    REQUIRE(sent.size() == 2);
+    REQUIRE(sent[1].find("\x01" "35=D\x01") != std::string::npos);
+
+    SECTION("Executions are matched on ClOrdID") {
+        feed(session.session(), make_message("8", 2, "11=OTHER\x01" "39=0\x01"));
+        REQUIRE(session.inner().routed == "exec;");   // Unclaimed: inner's hook
+        feed(session.session(), make_message("8", 3, "11=ORD1\x01" "39=0\x01"));
+        feed(session.session(), make_message("8", 4, "11=ORD1\x01" "39=2\x01"));
+        REQUIRE(log == "sent;er:0;er:2;");
+        REQUIRE(flow.done());
+        REQUIRE_FALSE(session.has_waiters());
+        REQUIRE(session.inner().routed == "exec;");
+    }
+
+    SECTION("Session loss fails the waiter") {
+        session.session().on_disconnect();
+        REQUIRE(log == "sent;lost;");
+        REQUIRE(flow.done());
+    }
+}
+
+TEST_CASE("AsyncSession send fails once the session is lost", "[session][coroutine]") {
+    std::vector<std::string> sent;
+    AsyncSession<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    std::string log;
+
+    session.session().on_connect();
+    REQUIRE(session.session().initiate_logon().has_value());
+    auto flow = async_order_flow(session, log);
+    flow.resume();
+    REQUIRE(log.empty());
+
+    session.session().on_disconnect();
+    REQUIRE(log == "send-failed;");
+    REQUIRE(flow.done());
+    REQUIRE(sent.size() == 1);              // Only the Logon
+}
+
+TEST_CASE("AsyncInbox hands messages to an awaiting pump", "[session][coroutine]") {
+    std::vector<std::string> sent;
+    AsyncSession<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    AsyncInbox inbox{256};
+    std::string log;
+
+    auto push = [&inbox](const std::string& msg) {
+        return inbox.push(std::span<const char>{msg.data(), msg.size()});
+    };
+
+    session.session().on_connect();
+    REQUIRE(session.session().initiate_logon().has_value());
+    const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+    const std::string report = make_message("8", 2, "11=ORD1\x01" "39=2\x01");
+
+    SECTION("Direct hand-off and close") {
+        auto pump = session.pump(inbox);
+        pump.resume();                      // Parked in recv()
+        auto flow = async_order_flow(session, log);
+        flow.resume();
+
+        REQUIRE(push(logon));
+        REQUIRE(log == "sent;");
+        REQUIRE(push(report));
+        REQUIRE(log == "sent;er:2;");
+        REQUIRE(inbox.pending() == 0);
+
+        inbox.close();
+        REQUIRE(pump.done());
+        REQUIRE_FALSE(is_connected(session.session().state()));
+    }
+
+    SECTION("Backlog drains in order and overflows") {
+        auto flow = async_order_flow(session, log);
+        flow.resume();
+        REQUIRE(push(logon));
+        REQUIRE(push(report));
+        REQUIRE(inbox.pending() == 2);
+        REQUIRE_FALSE(push(std::string(200, 'x')));   // Past the 256-byte backlog
+        REQUIRE(inbox.dropped() == 1);
+
+        auto pump = session.pump(inbox);
+        pump.resume();
+        REQUIRE(log == "sent;er:2;");
+        REQUIRE(inbox.pending() == 0);
+        REQUIRE_FALSE(pump.done());
+
+        inbox.close();
+        REQUIRE(pump.done());
+    }
+}
+
+TEST_CASE("OrderTable mints decodable ClOrdIDs", "[session][orders]") {
+    auto orders = std::make_unique<store::OrderTable<64>>("NX");
+
+    fix44::NewOrderSingle::Builder order;
+    order.sender_comp_id("CLIENT")
+        .target_comp_id("BROKER")
+        .sending_time("20240102-09:30:00.000")
+        .symbol("AAPL")
+        .side(Side::Sell)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_double(150.25))
+        .mint_cl_ord_id(*orders);
+
+    MessageAssembler assembler;
+    auto wire = order.build(assembler);
+    auto parsed = ParsedMessage::parse(wire);
+    REQUIRE(parsed.has_value());
+    const std::string id{parsed->get_string(tag::ClOrdID::value)};
+    REQUIRE(id == "NX00000000000");
+    REQUIRE(orders->size() == 1);
+
+    const uint32_t slot = orders->find(id);
+    REQUIRE(slot == 0);
+    REQUIRE((*orders)[slot].side == Side::Sell);
+    REQUIRE((*orders)[slot].leaves_qty == Qty::from_int(100));
+    REQUIRE(orders->stats().decoded == 1);
+
+    auto report = [](const std::string& body) {
+        return make_message("8", 2, body);
+    };
+    auto apply = [&orders](const std::string& msg) {
+        auto er = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(er.has_value());
+        return orders->apply(*er);
+    };
+
+    const auto* entry = apply(report("11=" + id + "\x01" "39=1\x01" "14=40\x01" "151=60\x01" "6=150.25\x01"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->status == OrdStatus::PartiallyFilled);
+    REQUIRE(entry->cum_qty == Qty::from_int(40));
+    REQUIRE(entry->leaves_qty == Qty::from_int(60));
+    REQUIRE(entry->avg_px == FixedPrice::from_double(150.25));
+    REQUIRE(entry->open);
+
+    entry = apply(report("11=" + id + "\x01" "39=2\x01" "14=100\x01" "151=0\x01"));
+    REQUIRE(entry != nullptr);
+    REQUIRE_FALSE(entry->open);                     // Filled: closed
+    REQUIRE(orders->size() == 0);
+
+    // The slot's next order gets a new generation; the old id is dead
+    const std::string next{orders->open(Side::Buy, Qty::from_int(5))};
+    REQUIRE(next == "NX00000000001");
+    REQUIRE(orders->find(id) == store::INVALID_ORDER);
+    REQUIRE(apply(report("11=" + id + "\x01" "39=2\x01")) == nullptr);
+    REQUIRE(orders->find("NX0000G000001") == store::INVALID_ORDER);   // Not hex
+    REQUIRE(orders->find("NX00040000000") == store::INVALID_ORDER);   // Past capacity
+}
+
+TEST_CASE("OrderTable tracks external ClOrdIDs in a Swiss table", "[session][orders]") {
+    auto orders = std::make_unique<store::OrderTable<64>>("NX");
+
+    std::vector<std::string> ids;
+    for (int i = 0; i < 64; ++i) ids.push_back("EXT-" + std::to_string(i * 7919));
+    for (const auto& id : ids) REQUIRE(orders->track(id, Side::Buy, Qty::from_int(1)) != store::INVALID_ORDER);
+    REQUIRE(orders->size() == 64);
+    REQUIRE(orders->open(Side::Buy, Qty::from_int(1)).empty());              // Full
+    REQUIRE(orders->track("EXT-x", Side::Buy, Qty::from_int(1)) == store::INVALID_ORDER);
+
+    for (const auto& id : ids) {
+        const uint32_t slot = orders->find(id);
+        REQUIRE(slot != store::INVALID_ORDER);
+        REQUIRE((*orders)[slot].id() == id);
+    }
+    REQUIRE(orders->stats().hashed == 64);
+    REQUIRE(orders->find("EXT-unknown") == store::INVALID_ORDER);
+
+    // Churn: closing and re-tracking many times exercises tombstone rebuilds
+    for (int round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < ids.size(); i += 2) orders->close(orders->find(ids[i]));
+        REQUIRE(orders->size() == 32);
+        for (size_t i = 0; i < ids.size(); i += 2) {
+            ids[i] = "R" + std::to_string(round) + "-" + std::to_string(i);
+            REQUIRE(orders->track(ids[i], Side::Sell, Qty::from_int(2)) != store::INVALID_ORDER);
+        }
+        for (const auto& id : ids) REQUIRE(orders->find(id) != store::INVALID_ORDER);
+    }
+    REQUIRE(orders->track(ids[1], Side::Buy, Qty::from_int(1)) == store::INVALID_ORDER);   // Open already
+    REQUIRE(orders->track("NX00000000000", Side::Buy, Qty::from_int(1)) == store::INVALID_ORDER);
+
+    // Cancel reports name the cancel's ClOrdID; OrigClOrdID finds the order
+    const std::string msg = make_message("8", 2, "11=CXL-1\x01" "41=" + ids[1] + "\x01" "39=4\x01");
+    auto er = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+    REQUIRE(er.has_value());
+    const auto* entry = orders->apply(*er);
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->status == OrdStatus::Canceled);
+    REQUIRE(orders->find(ids[1]) == store::INVALID_ORDER);
+
+    size_t open = 0;
+    orders->for_each_open([&open](const store::OrderEntry&) { ++open; });
+    REQUIRE(open == 63);
+}
+
+namespace {
+
+/// RecordingHandler plus a pre-trade risk stage
+struct RiskHandler : RecordingHandler {
+    PreTradeRisk<>* risk{nullptr};
+
+    bool pre_trade_check(const OrderFields& order) noexcept { return risk->check(order); }
+    void pre_trade_release(const OrderFields& order) noexcept { risk->release(order); }
+};
+
+static_assert(HasPreTradeRisk<RiskHandler>);
+static_assert(HasPreTradeRelease<RiskHandler>);
+static_assert(!HasPreTradeRisk<RecordingHandler>);
+static_assert(HasOrderFields<fix44::NewOrderSingle::Builder>);
+static_assert(!HasOrderFields<fix44::OrderCancelRequest::Builder>);
+
+}  // namespace
+
+TEST_CASE("RiskChecks report the first failing check", "[session][risk]") {
+    SymbolRisk limits;
+    limits.max_order_qty = Qty::from_int(1000);
+    limits.price_floor = FixedPrice::from_double(90.0);
+    limits.price_cap = FixedPrice::from_double(110.0);
+    limits.max_notional = FixedPrice::from_double(50'000.0);
+    limits.max_position = Qty::from_int(800);
+
+    OrderFields order{"AAPL", Side::Buy, Qty::from_int(100), FixedPrice::from_double(100.0), OrdType::Limit};
+    REQUIRE(StandardRiskChecks::evaluate(order, limits) == RiskReject::None);
+
+    order.order_qty = Qty::from_int(1001);                  // Also over notional and position
+    REQUIRE(StandardRiskChecks::evaluate(order, limits) == RiskReject::MaxQty);
+    REQUIRE(RiskChecks<PositionLimitCheck, MaxQtyCheck>::evaluate(order, limits) == RiskReject::PositionLimit);
+    REQUIRE(RiskChecks<>::evaluate(order, limits) == RiskReject::None);
+
+    order.order_qty = Qty::from_int(600);                   // 60,000 notional
+    REQUIRE(StandardRiskChecks::evaluate(order, limits) == RiskReject::MaxNotional);
+
+    order.order_qty = Qty::from_int(100);
+    order.price = FixedPrice::from_double(111.0);
+    REQUIRE(StandardRiskChecks::evaluate(order, limits) == RiskReject::PriceCollar);
+    order.price = FixedPrice{};                             // Market: no collar, no notional
+    REQUIRE(StandardRiskChecks::evaluate(order, limits) == RiskReject::None);
+
+    // Large prices and quantities do not overflow the notional product
+    SymbolRisk wide;
+    OrderFields big{"BRK", Side::Sell, Qty::from_int(100'000), FixedPrice::from_double(600'000.0), OrdType::Limit};
+    REQUIRE(MaxNotionalCheck::violated(big, wide) == false);
+    wide.max_notional = FixedPrice::from_double(1e9);
+    REQUIRE(MaxNotionalCheck::violated(big, wide));
+
+    // Sells are limited on the short side
+    limits.position = Qty::from_int(500);
+    OrderFields sell{"AAPL", Side::Sell, Qty::from_int(1000), FixedPrice::from_double(100.0), OrdType::Limit};
+    REQUIRE_FALSE(PositionLimitCheck::violated(sell, limits));   // Ends 500 short
+    sell.order_qty = Qty::from_int(1301);
+    REQUIRE(PositionLimitCheck::violated(sell, limits));
+}
+
+TEST_CASE("SessionManager runs the pre-trade risk stage before sending", "[session][risk]") {
+    auto risk = std::make_unique<PreTradeRisk<>>();
+    SymbolRisk* aapl = risk->limits("AAPL");
+    REQUIRE(aapl != nullptr);
+    aapl->max_order_qty = Qty::from_int(500);
+    aapl->max_position = Qty::from_int(600);
+
+    std::vector<std::string> sent;
+    RiskHandler handler;
+    handler.sent = &sent;
+    handler.risk = risk.get();
+    SessionManager<RiskHandler> session{client_config(), handler};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+    auto send_order = [&session](std::string_view symbol, int64_t qty) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("ORD")
+            .symbol(symbol)
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(qty))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(100.0));
+        return session.send_app_message(order);
+    };
+
+    REQUIRE(send_order("AAPL", 400).has_value());
+    REQUIRE(sent.size() == 2);
+    REQUIRE((*risk)[risk->symbol_id("AAPL")].open_buy == Qty::from_int(400));
+
+    auto too_big = send_order("AAPL", 501);
+    REQUIRE_FALSE(too_big.has_value());
+    REQUIRE(too_big.error().code == SessionErrorCode::RiskRejected);
+    REQUIRE(risk->last_reject() == RiskReject::MaxQty);
+
+    REQUIRE_FALSE(send_order("AAPL", 300).has_value());    // 400 open + 300 > 600
+    REQUIRE(risk->last_reject() == RiskReject::PositionLimit);
+    REQUIRE_FALSE(send_order("MSFT", 1).has_value());
+    REQUIRE(risk->last_reject() == RiskReject::UnknownSymbol);
+    REQUIRE(sent.size() == 2);                              // Nothing left the session
+    REQUIRE(session.sequences().current_outbound() == 3);
+    REQUIRE(session.stats().risk_rejects == 3);
+
+    // Partial fill of 100, then the rest canceled: exposure is 100 long
+    const std::string fill = make_message("8", 2, "55=AAPL\x01" "54=1\x01" "38=400\x01" "32=100\x01" "14=100\x01" "39=1\x01");
+    const std::string cancel = make_message("8", 3, "55=AAPL\x01" "54=1\x01" "38=400\x01" "32=0\x01" "14=100\x01" "39=4\x01");
+    for (const auto* msg : {&fill, &cancel}) {
+        auto er = ParsedMessage::parse(std::span<const char>{msg->data(), msg->size()});
+        REQUIRE(er.has_value());
+        risk->on_execution(*er);
+    }
+    const SymbolRisk& state = (*risk)[risk->symbol_id("AAPL")];
+    REQUIRE(state.position == Qty::from_int(100));
+    REQUIRE(state.open_buy == Qty{});
+    REQUIRE(send_order("AAPL", 500).has_value());           // 100 + 500 <= 600
+    REQUIRE(risk->accepted() == 2);
+    REQUIRE(risk->rejected(RiskReject::MaxQty) == 1);
+}
+
+TEST_CASE("SessionManager gives back orders refused after the pre-trade check", "[session][risk]") {
+    auto risk = std::make_unique<PreTradeRisk<>>();
+    SymbolRisk* aapl = risk->limits("AAPL");
+    REQUIRE(aapl != nullptr);
+    aapl->max_position = Qty::from_int(250);
+    const store::SymbolId id = risk->symbol_id("AAPL");
+
+    std::vector<std::string> sent;
+    RiskHandler handler;
+    handler.sent = &sent;
+    handler.risk = risk.get();
+    SessionConfig config = client_config();
+    config.throttle_rate = 1;
+    config.throttle_burst = 1;
+
+    auto send_order = [](auto& session, std::string_view cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(100.0));
+        return session.send_app_message(order);
+    };
+    auto logon = [](auto& session) {
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+    };
+
+    SECTION("Throttle reject") {
+        config.throttle_mode = ThrottleMode::Reject;
+        SessionManager<RiskHandler> session{config, handler};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());
+        for (int i = 0; i < 5; ++i) {                          // Would pass 250 if kept open
+            auto rejected = send_order(session, "ORD2");
+            REQUIRE_FALSE(rejected.has_value());
+            REQUIRE(rejected.error().code == SessionErrorCode::Throttled);
+        }
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(100));
+        REQUIRE(risk->released() == 5);
+        REQUIRE(session.stats().risk_rejects == 0);
+    }
+
+    SECTION("Throttle queue full, then dropped on disconnect") {
+        config.throttle_queue_size = 1;
+        aapl->max_position = Qty::from_int(300);
+        SessionManager<RiskHandler> session{config, handler};
+        logon(session);
+
+        REQUIRE(send_order(session, "ORD1").has_value());      // Sent
+        REQUIRE(send_order(session, "ORD2").has_value());      // Queued
+        auto full = send_order(session, "ORD3");
+        REQUIRE_FALSE(full.has_value());
+        REQUIRE(full.error().code == SessionErrorCode::Throttled);
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(200));
+
+        session.on_disconnect();
+        REQUIRE(session.stats().throttle_dropped == 1);
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(100));
+        REQUIRE(risk->released() == 2);
+    }
+
+    SECTION("Invalid value") {
+        config.throttle_rate = 0;
+        config.validate_outbound_values = true;
+        SessionManager<RiskHandler> session{config, handler};
+        logon(session);
+
+        auto bad = send_order(session, "ORD\x01" "1");
+        REQUIRE_FALSE(bad.has_value());
+        REQUIRE(bad.error().code == SessionErrorCode::MalformedMessage);
+        REQUIRE((*risk)[id].open_buy == Qty{});
+        REQUIRE(send_order(session, "ORD1").has_value());
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(100));
+    }
+}
+
+TEST_CASE("SessionManager refuses values that would break framing", "[session][serializer]") {
+    std::vector<std::string> sent;
+    SessionConfig config = client_config();
+    config.validate_outbound_values = true;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+    auto send_order = [&session](std::string_view cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order);
+    };
+
+    const uint32_t next = session.sequences().current_outbound();
+    auto refused = send_order("ORD\x01" "10=000");
+    REQUIRE_FALSE(refused.has_value());
+    REQUIRE(refused.error().code == SessionErrorCode::MalformedMessage);
+    REQUIRE(session.stats().invalid_values == 1);
+    REQUIRE(sent.size() == 1);                                      // Logon only
+    REQUIRE(session.sequences().current_outbound() == next);        // Seqnum given back
+
+    REQUIRE(send_order("ORD-2").has_value());
+    REQUIRE(sent.size() == 2);
+    auto parsed = ParsedMessage::parse(std::span<const char>{sent[1].data(), sent[1].size()});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->msg_seq_num() == next);
+}
+
+TEST_CASE("MemoryBudget throttles a session over its hard limit", "[session][memory]") {
+    struct FakeHeap {
+        size_t bytes{0};
+        int purges{0};
+        int resets{0};
+    } heap;
+    auto usage = [](const void* c) noexcept -> size_t { return static_cast<const FakeHeap*>(c)->bytes; };
+    auto reclaim = [](void* c, bool full) noexcept {
+        auto* h = static_cast<FakeHeap*>(c);
+        ++h->purges;
+        if (full) {
+            ++h->resets;
+            h->bytes = 0;
+        }
+    };
+
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+
+    // Limits above the session's own buffers, so the heap decides
+    memory::MemoryBudget probe;
+    session.set_memory_budget(&probe);
+    const size_t base = probe.total();
+    REQUIRE(probe.stats().buffer_bytes >= sizeof(session));
+    REQUIRE(probe.level() == memory::BudgetLevel::Ok);
+
+    memory::MemoryBudget budget{{.soft_limit = base + 1000, .hard_limit = base + 2000}};
+    REQUIRE(budget.track(memory::BudgetCategory::Heap, usage, reclaim, &heap));
+    MetricsRegistry registry;
+    session.set_memory_budget(&budget, registry.add<memory::MemoryBudgetStats>(
+        metric_labels({{"session", "CLIENT->SERVER"}})));
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    auto send_order = [&session] {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("ORD-1")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order);
+    };
+
+    heap.bytes = 1500;                              // Soft: purged, still sending
+    session.on_timer_tick();
+    REQUIRE(budget.level() == memory::BudgetLevel::Soft);
+    REQUIRE(heap.purges == 1);
+    REQUIRE(budget.stats().soft_breaches == 1);
+    REQUIRE(send_order().has_value());
+
+    heap.bytes = 2500;                              // Hard: refused
+    session.on_timer_tick();
+    REQUIRE(budget.level() == memory::BudgetLevel::Hard);
+    REQUIRE(budget.stats().hard_breaches == 1);
+    const size_t before = sent.size();
+    auto refused = send_order();
+    REQUIRE_FALSE(refused.has_value());
+    REQUIRE(refused.error().code == SessionErrorCode::Throttled);
+    REQUIRE(session.stats().budget_rejects == 1);
+    REQUIRE(sent.size() == before);
+
+    heap.bytes = 1500;                              // Under hard, over soft: still Hard
+    session.on_timer_tick();
+    REQUIRE(budget.level() == memory::BudgetLevel::Hard);
+    heap.bytes = 500;
+    session.on_timer_tick();
+    REQUIRE(budget.level() == memory::BudgetLevel::Ok);
+    REQUIRE(send_order().has_value());
+
+    const std::string text = registry.render();
+    REQUIRE(text.find("nfx_memory_heap_bytes{session=\"CLIENT->SERVER\"} 500") != std::string::npos);
+    REQUIRE(text.find("nfx_memory_hard_breaches_total") != std::string::npos);
+
+    heap.bytes = 2500;                              // Logout: full reclaim
+    session.on_disconnect();
+    REQUIRE(heap.resets == 1);
+    REQUIRE(budget.stats().heap_bytes == 0);
+    REQUIRE(budget.stats().reclaimed_bytes >= 2500);
+    REQUIRE(budget.level() == memory::BudgetLevel::Ok);
+}
+
+TEST_CASE("SessionManager hibernates when idle and wakes on traffic", "[session][store]") {
+    std::vector<std::string> sent;
+    memory::HibernationPool pool;
+    store::MemoryMessageStore message_store{{.session_id = "CLIENT-BROKER", .max_messages = 1024,
+                                             .pool_size_bytes = 64 * 1024, .upstream_resource = &pool}};
+    SessionConfig config = client_config();
+    config.hibernate_after_ms = 1;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.set_message_store(&message_store);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    auto send_order = [&session](std::string_view cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit);
+        return session.send_app_message(order);
+    };
+    REQUIRE(send_order("ORD-1").has_value());                      // Seq 2
+
+    auto idle = [&session] {
+        session.on_timer_tick();                                    // Notes the last activity
+        std::this_thread::sleep_for(std::chrono::milliseconds{3});
+        session.on_timer_tick();
+    };
+    idle();
+    REQUIRE(session.hibernated());
+    REQUIRE(message_store.hibernated());
+    REQUIRE(session.stats().hibernations == 1);
+    REQUIRE(pool.stats().cached_bytes >= 64 * 1024);
+
+    // Heartbeats and TestRequests are handled asleep; the answer is not stored
+    feed(session, make_message("0", 2, ""));
+    feed(session, make_message("1", 3, "112=PING\x01"));
+    REQUIRE(session.hibernated());
+    REQUIRE(sent.back().find("112=PING") != std::string::npos);     // Seq 3
+    REQUIRE(session.sequences().expected_inbound() == 4);
+
+    // An application send wakes it; the order stored before is still there
+    REQUIRE(send_order("ORD-2").has_value());                      // Seq 4
+    REQUIRE_FALSE(session.hibernated());
+    REQUIRE(session.stats().wakeups == 1);
+    REQUIRE(message_store.retrieve(2).has_value());
+    REQUIRE_FALSE(message_store.retrieve(3).has_value());
+
+    // So does a ResendRequest: the heartbeat is gap-filled, the orders replayed
+    idle();
+    REQUIRE(session.hibernated());
+    const size_t before = sent.size();
+    feed(session, make_message("2", 4, "7=2\x01" "16=0\x01"));
+    REQUIRE_FALSE(session.hibernated());
+    REQUIRE(session.stats().wakeups == 2);
+    REQUIRE(sent.size() == before + 3);
+    REQUIRE(sent[before].find("ORD-1") != std::string::npos);
+    REQUIRE(sent[before + 1].find("\x01" "35=4\x01") != std::string::npos);
+    REQUIRE(sent[before + 2].find("ORD-2") != std::string::npos);
+}
+
+TEST_CASE("SubmissionGateway sequences orders from several threads", "[session][gateway]") {
+    auto risk = std::make_unique<PreTradeRisk<>>();
+    SymbolRisk* aapl = risk->limits("AAPL");
+    REQUIRE(aapl != nullptr);
+    aapl->max_order_qty = Qty::from_int(500);
+
+    std::vector<std::string> sent;
+    RiskHandler handler;
+    handler.sent = &sent;
+    handler.risk = risk.get();
+    const SessionConfig config = client_config();
+    SessionManager<RiskHandler> session{config, handler};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(session.state() == SessionState::Active);
+
+    using Gateway = SubmissionGateway<256>;
+    auto gateway = std::make_unique<Gateway>(config);
+    constexpr int THREADS = 4;
+    constexpr int ORDERS = 200;
+
+    std::atomic<int> done{0};
+    std::vector<std::thread> strategies;
+    for (int t = 0; t < THREADS; ++t) {
+        strategies.emplace_back([&gateway, &done, t] {
+            Gateway::Producer producer{*gateway};
+            for (int i = 0; i < ORDERS; ++i) {
+                const std::string cl_ord_id = "S" + std::to_string(t) + "-" + std::to_string(i);
+                fix44::NewOrderSingle::Builder order;
+                order.cl_ord_id(cl_ord_id)
+                    .symbol("AAPL")
+                    .side(Side::Buy)
+                    .transact_time("20240102-09:30:00.000")
+                    .order_qty(Qty::from_int(t == 0 && i == 0 ? 501 : 1))   // One over the limit
+                    .ord_type(OrdType::Limit)
+                    .price(FixedPrice::from_double(100.0));
+                while (!producer.submit(order)) std::this_thread::yield();
+            }
+            done.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    // Session thread: drain a batch per loop iteration
+    while (done.load(std::memory_order_acquire) < THREADS || gateway->pending() != 0) {
+        (void)gateway->drain(session);
+    }
+    for (auto& thread : strategies) thread.join();
+
+    constexpr size_t TOTAL = THREADS * ORDERS;
+    REQUIRE(gateway->stats().drained == TOTAL);
+    REQUIRE(gateway->stats().risk_rejects == 1);
+    REQUIRE(gateway->stats().accepted == TOTAL - 1);
+    REQUIRE(sent.size() == 1 + TOTAL - 1);   // Logon, then the orders
+    for (size_t i = 1; i < sent.size(); ++i) {
+        const std::string& wire = sent[i];
+        REQUIRE(parser::validate_fix_checksum(wire));
+        auto parsed = ParsedMessage::parse(std::span<const char>{wire.data(), wire.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_seq_num() == i + 1);
+        REQUIRE(parsed->sender_comp_id() == "CLIENT");
+    }
+    REQUIRE(session.sequences().current_outbound() == TOTAL + 1);
+}
+
+TEST_CASE("SubmissionGateway keeps what a throttled session did not take", "[session][gateway]") {
+    auto risk = std::make_unique<PreTradeRisk<>>();
+    SymbolRisk* aapl = risk->limits("AAPL");
+    REQUIRE(aapl != nullptr);
+    aapl->max_position = Qty::from_int(300);
+    const store::SymbolId id = risk->symbol_id("AAPL");
+
+    std::vector<std::string> sent;
+    RiskHandler handler;
+    handler.sent = &sent;
+    handler.risk = risk.get();
+    SessionConfig config = client_config();
+    config.throttle_rate = 1;
+    config.throttle_burst = 1;
+
+    using Gateway = SubmissionGateway<16>;
+    auto gateway = std::make_unique<Gateway>(config);
+    Gateway::Producer producer{*gateway};
+    auto submit = [&producer](std::string_view cl_ord_id) {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id(cl_ord_id)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(100.0));
+        return producer.submit(order);
+    };
+    auto logon = [](auto& session) {
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+    };
+
+    SECTION("Reject mode: the rest wait, unbooked") {
+        config.throttle_mode = ThrottleMode::Reject;
+        SessionManager<RiskHandler> session{config, handler};
+        logon(session);
+
+        for (const char* id_str : {"ORD1", "ORD2", "ORD3"}) REQUIRE(submit(id_str));
+        for (int i = 0; i < 4; ++i) (void)gateway->drain(session);   // Would pass 300 if kept booked
+        REQUIRE(sent.size() == 2);                                    // Logon, ORD1
+        REQUIRE(gateway->pending() == 2);
+        REQUIRE(gateway->stats().drained == 1);
+        REQUIRE(gateway->stats().accepted == 1);
+        REQUIRE(gateway->stats().deferred == 8);
+        REQUIRE(gateway->stats().dropped == 0);
+        REQUIRE(gateway->stats().risk_rejects == 0);
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(100));
+        REQUIRE(session.sequences().current_outbound() == 3);
+    }
+
+    SECTION("Queue mode: queue full, then dropped on disconnect") {
+        config.throttle_queue_size = 1;
+        SessionManager<RiskHandler> session{config, handler};
+        logon(session);
+
+        for (const char* id_str : {"ORD1", "ORD2", "ORD3"}) REQUIRE(submit(id_str));
+        REQUIRE(gateway->drain(session) == 2);                        // ORD1 sent, ORD2 queued
+        REQUIRE(gateway->pending() == 1);                             // ORD3: throttle queue full
+        REQUIRE(session.throttled_sends() == 1);
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(200));
+
+        session.on_disconnect();
+        REQUIRE(session.stats().throttle_dropped == 1);
+        REQUIRE((*risk)[id].open_buy == Qty::from_int(100));          // ORD2 given back
+        REQUIRE(gateway->pending() == 1);                             // ORD3 waits for the next logon
+    }
+}
+
+TEST_CASE("AuditTap reclaims capture space behind the slowest sink", "[session][audit]") {
+    store::AuditTap tap{256};
+    auto fast = tap.subscribe();
+    auto slow = tap.subscribe();
+    REQUIRE(fast.valid());
+    REQUIRE(slow.valid());
+
+    const std::string msg(100, 'x');
+    REQUIRE(tap.capture(store::AuditDirection::Inbound, 1, msg, 10));
+    REQUIRE(tap.capture(store::AuditDirection::Inbound, 2, msg, 20));
+    REQUIRE_FALSE(tap.capture(store::AuditDirection::Inbound, 3, msg, 30));   // Would wrap onto seq 1
+    REQUIRE(tap.stats().dropped == 1);
+
+    std::vector<uint32_t> seen;
+    auto collect = [&seen](const store::AuditRecord& r) {
+        REQUIRE(r.captured);
+        REQUIRE(std::string_view{r.data, r.length} == std::string(100, 'x'));
+        seen.push_back(r.seq);
+    };
+    REQUIRE(tap.drain(fast, collect) == 2);
+    REQUIRE_FALSE(tap.capture(store::AuditDirection::Inbound, 3, msg, 30));   // slow still holds seq 1
+    REQUIRE(tap.drain(slow, collect, 1) == 1);
+    REQUIRE(tap.capture(store::AuditDirection::Inbound, 3, msg, 30));         // Wrapped to offset 0
+    REQUIRE(tap.backlog() == 2);
+
+    // Published records point at the caller's bytes
+    const std::string journal = "8=FIX.4.4\x01";
+    REQUIRE(tap.publish(store::AuditDirection::Outbound, 7, journal, 40));
+    const char* where = nullptr;
+    REQUIRE(tap.drain(fast, [&](const store::AuditRecord& r) {
+        if (r.seq == 7) where = r.data;
+    }) == 2);
+    REQUIRE(where == journal.data());
+    REQUIRE(tap.stats().published == 4);
+    REQUIRE(tap.stats().captured == 3);
+}
+
+TEST_CASE("SessionManager mirrors messages to an audit tap", "[session][audit]") {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / ("nfx_audit_" + std::to_string(::getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    auto opened = store::MmapMessageStore::open(store::MmapMessageStore::Config{
+        .session_id = "CLIENT-BROKER",
+        .directory = dir.string(),
+        .journal_size = 1024 * 1024,
+        .max_seq = 4096,
+        .async_flush = false});
+    REQUIRE(opened.has_value());
+    auto& journal = **opened;
+
+    auto tap = std::make_unique<store::AuditTap>();
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    session.set_message_store(&journal);
+    session.set_audit_tap(tap.get());
+
+    // In-thread sink: outbound records point into the mapped journal
+    auto reader = tap->subscribe();
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    std::vector<store::AuditRecord> records;
+    REQUIRE(tap->drain(reader, [&records](const store::AuditRecord& r) { records.push_back(r); }) == 1);
+    REQUIRE(records[0].direction == store::AuditDirection::Outbound);
+    REQUIRE(records[0].seq == 1);
+    REQUIRE_FALSE(records[0].captured);
+    REQUIRE(records[0].data == journal.last_stored().data());
+    REQUIRE(std::string_view{records[0].data, records[0].length} == sent[0]);
+    tap->unsubscribe(reader);
+
+    // Sink thread writing an audit log
+    const fs::path log = dir / "audit.bin";
+    {
+        store::AuditFileSink file{log.c_str()};
+        REQUIRE(file.is_open());
+        store::AuditWriter writer{*tap};
+        REQUIRE(writer.start([&file](const store::AuditRecord& r) { (void)file.write(r); }));
+
+        const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+        const std::string exec = make_message("8", 2, "11=ORD1\x01");
+        feed(session, logon);
+        feed(session, exec);
+        writer.stop();
+        REQUIRE(writer.written() == 2);
+    }
+
+    std::ifstream in{log, std::ios::binary};
+    std::string bytes{std::istreambuf_iterator<char>{in}, {}};
+    std::vector<std::pair<char, uint32_t>> logged;
+    for (size_t pos = 0; pos + sizeof(store::AuditFileSink::Header) <= bytes.size();) {
+        store::AuditFileSink::Header h;
+        std::memcpy(&h, bytes.data() + pos, sizeof(h));
+        logged.emplace_back(h.direction, h.seq);
+        pos += sizeof(h) + h.length;
+    }
+    REQUIRE(logged == std::vector<std::pair<char, uint32_t>>{{'I', 1}, {'I', 2}});
+    REQUIRE(tap->stats().captured == 2);
+    REQUIRE(tap->stats().dropped == 0);
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("ReplicationStandby mirrors the primary over shared memory", "[session][replication]") {
+    namespace fs = std::filesystem;
+    const fs::path path = fs::temp_directory_path() / ("nfx_repl_" + std::to_string(::getpid()));
+    fs::remove(path);
+
+    auto primary_link = store::ShmReplicationLink::open({path.string(), 1 << 16, store::ReplicationRole::Primary});
+    auto standby_link = store::ShmReplicationLink::open({path.string(), 1 << 16, store::ReplicationRole::Standby});
+    REQUIRE(primary_link.has_value());
+    REQUIRE(standby_link.has_value());
+    REQUIRE_FALSE(store::ShmReplicationLink::open({path.string(), 1 << 12, store::ReplicationRole::Standby}));
+
+    store::ReplicationPublisher publisher{**primary_link};
+    store::MemoryMessageStore replica{"CLIENT-BROKER"};
+    store::ReplicationStandby standby{**standby_link, replica};
+
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    session.set_replicator(&publisher);
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+    feed(session, make_message("8", 2, "11=ORD1\x01"));
+    session.end_receive_batch();
+
+    fix44::NewOrderSingle::Builder order;
+    order.cl_ord_id("ORD2").symbol("AAPL").side(Side::Buy)
+        .transact_time("20240102-09:30:00.000")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Market);
+    REQUIRE(session.send_app_message(order).has_value());     // Shipped on send
+
+    REQUIRE(standby.poll() == 3);          // Logon, sequences, order
+    REQUIRE_FALSE(standby.stale());
+    REQUIRE(standby.next_sender_seq() == 3);
+    REQUIRE(standby.next_target_seq() == 3);
+    auto order_copy = replica.retrieve(2);
+    REQUIRE(order_copy.has_value());
+    REQUIRE(std::string(order_copy->begin(), order_copy->end()) == sent.back());
+
+    REQUIRE(publisher.poll_acks() == 1);
+    REQUIRE(publisher.acked() == publisher.position());
+    REQUIRE(publisher.lag() == 0);
+
+    // Failover: a new session resumes at the replicated seqnums
+    std::vector<std::string> backup_sent;
+    SessionManager<RecordingHandler> backup{client_config(), RecordingHandler{&backup_sent, {}, 0}};
+    REQUIRE(standby.take_over(backup));
+    REQUIRE(backup.message_store() == &replica);
+    REQUIRE(backup.sequences().current_outbound() == 3);
+    REQUIRE(backup.sequences().expected_inbound() == 3);
+
+    fs::remove(path);
+}
+
+TEST_CASE("ReplicationStandby goes stale on a dropped frame until resync", "[session][replication]") {
+    namespace fs = std::filesystem;
+    const fs::path path = fs::temp_directory_path() / ("nfx_repl_drop_" + std::to_string(::getpid()));
+    fs::remove(path);
+
+    auto primary_link = store::ShmReplicationLink::open({path.string(), 1024, store::ReplicationRole::Primary});
+    auto standby_link = store::ShmReplicationLink::open({path.string(), 1024, store::ReplicationRole::Standby});
+    REQUIRE(primary_link.has_value());
+    REQUIRE(standby_link.has_value());
+
+    store::ReplicationPublisher publisher{**primary_link};
+    store::MemoryMessageStore primary_store{"CLIENT-BROKER"};
+    store::MemoryMessageStore replica{"CLIENT-BROKER"};
+    store::ReplicationStandby standby{**standby_link, replica};
+
+    const std::string msg(400, 'x');
+    for (uint32_t seq = 1; seq <= 3; ++seq) {
+        REQUIRE(primary_store.store(seq, msg));
+        publisher.on_append(seq, msg, seq + 1);            // Third does not fit
+    }
+    REQUIRE(publisher.stats().dropped == 1);
+    REQUIRE_FALSE(publisher.in_sync());
+    REQUIRE(publisher.flush());
+    REQUIRE(standby.poll() == 2);
+
+    publisher.on_append(4, msg, 5);                        // Position 4 after the lost 3
+    REQUIRE(publisher.flush());
+    REQUIRE(standby.poll() == 1);
+    REQUIRE(standby.stale());
+    SessionManager<RecordingHandler> backup{client_config(), RecordingHandler{}};
+    REQUIRE_FALSE(standby.take_over(backup));
+
+    // Resync through a larger window: drained as it goes
+    store::MemoryMessageStore small{"CLIENT-BROKER"};
+    REQUIRE(small.store(1, msg));
+    REQUIRE(publisher.resync(small, 2, 7));
+    REQUIRE(publisher.in_sync());
+    REQUIRE(standby.poll() == 3);                          // Reset, append, sequences
+    REQUIRE_FALSE(standby.stale());
+    REQUIRE(standby.next_sender_seq() == 2);
+    REQUIRE(standby.next_target_seq() == 7);
+    REQUIRE(replica.retrieve(1).has_value());
+    REQUIRE_FALSE(replica.retrieve(2).has_value());
+    REQUIRE(standby.take_over(backup));
+
+    fs::remove(path);
+}
+
+TEST_CASE("TcpReplicationLink ships frames and acks across a socket", "[session][replication]") {
+    TcpAcceptor acceptor;
+    REQUIRE(acceptor.listen(0).has_value());
+
+    TcpSocket client;
+    REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+    auto accepted = acceptor.accept();
+    REQUIRE(accepted.has_value());
+    TcpSocket server;
+    server.adopt(*accepted);
+    REQUIRE(server.is_connected());
+
+    TcpReplicationLink primary_link{std::move(client)};
+    TcpReplicationLink standby_link{std::move(server)};
+    store::ReplicationPublisher publisher{primary_link};
+    store::MemoryMessageStore replica{"CLIENT-BROKER"};
+    store::ReplicationStandby standby{standby_link, replica};
+
+    const std::string msg = make_message("D", 1, "11=ORD1\x01");
+    publisher.on_append(1, msg, 2);
+    publisher.on_sequences(2, 5);
+    REQUIRE(publisher.flush());
+    REQUIRE(primary_link.pending() == 0);
+
+    size_t applied = 0;
+    for (int i = 0; i < 1000 && applied < 2; ++i) {
+        applied += standby.poll();
+        if (applied < 2) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(applied == 2);
+    REQUIRE(standby.next_target_seq() == 5);
+    REQUIRE(replica.retrieve(1).has_value());
+
+    for (int i = 0; i < 1000 && publisher.acked() < 2; ++i) {
+        (void)publisher.poll_acks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(publisher.acked() == 2);
+}
+
+#if NFX_KTLS_AVAILABLE
+
+#include <openssl/pem.h>
+
+namespace {
+
+/// Self-signed P-256 certificate for CN=localhost
+struct TestTlsIdentity {
+    EVP_PKEY* key{EVP_EC_gen("P-256")};
+    X509* cert{X509_new()};
+
+    TestTlsIdentity() {
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+        X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+        X509_set_pubkey(cert, key);
+        X509_NAME* name = X509_get_subject_name(cert);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                   reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+        X509_set_issuer_name(cert, name);
+        X509_sign(cert, key, EVP_sha256());
+    }
+    ~TestTlsIdentity() {
+        X509_free(cert);
+        EVP_PKEY_free(key);
+    }
+
+    void write_pem(const std::string& path) const {
+        FILE* f = std::fopen(path.c_str(), "w");
+        PEM_write_X509(f, cert);
+        std::fclose(f);
+    }
+};
+
+/// Accept one connection, run a TLS server on it and echo one record back
+void run_echo_server(TcpAcceptor& acceptor, const TestTlsIdentity& id, std::atomic<bool>& echoed) {
+    auto fd = acceptor.accept();
+    if (!fd) return;
+    SSL_CTX* ctx = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_use_certificate(ctx, id.cert);
+    SSL_CTX_use_PrivateKey(ctx, id.key);
+    SSL* ssl = SSL_new(ctx);
+    SSL_set_fd(ssl, *fd);
+    if (SSL_accept(ssl) == 1) {
+        char buf[256];
+        const int n = SSL_read(ssl, buf, sizeof(buf));
+        if (n > 0 && SSL_write(ssl, buf, n) == n) echoed = true;
+        while (SSL_read(ssl, buf, sizeof(buf)) > 0) {}   // Until close_notify
+    }
+    SSL_free(ssl);
+    SSL_CTX_free(ctx);
+    ::close(*fd);
+}
+
+}  // namespace
+
+TEST_CASE("KtlsSession handshakes and moves records through the kernel where it can", "[session][tls]") {
+    const TestTlsIdentity id;
+    const auto ca_path = std::filesystem::temp_directory_path() / "nfx_ktls_test_ca.pem";
+    id.write_pem(ca_path.string());
+
+    auto handshake = [&](TlsConfig config, std::atomic<bool>& echoed, KtlsSession& session) {
+        TcpAcceptor acceptor;
+        REQUIRE(acceptor.listen(0).has_value());
+        std::thread server{[&] { run_echo_server(acceptor, id, echoed); }};
+        TcpSocket client;
+        REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+        auto result = session.handshake(client.fd(), "127.0.0.1", config);
+        if (result) {
+            const std::string_view msg = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+            REQUIRE(session.write({msg.data(), msg.size()}) == msg.size());
+            std::array<char, 256> buf{};
+            auto n = session.read(buf, 5000);
+            REQUIRE(n.has_value());
+            CHECK(std::string_view{buf.data(), *n} == msg);
+            session.shutdown();
+        }
+        client.close();
+        server.join();
+        return result;
+    };
+
+    SECTION("verified against the CA and host name") {
+        TlsConfig config;
+        config.enabled = true;
+        config.server_name = "localhost";
+        config.ca_file = ca_path.string();
+        std::atomic<bool> echoed{false};
+        KtlsSession session;
+        auto result = handshake(config, echoed, session);
+        REQUIRE(result.has_value());
+        CHECK(echoed);
+        CHECK_FALSE(session.is_active());
+    }
+
+    SECTION("TLS 1.2 reports the offloaded directions") {
+        TlsConfig config;
+        config.enabled = true;
+        config.verify_peer = false;
+        config.max_version = TlsVersion::Tls12;
+        std::atomic<bool> echoed{false};
+        KtlsSession session;
+
+        TcpAcceptor acceptor;
+        REQUIRE(acceptor.listen(0).has_value());
+        std::thread server{[&] { run_echo_server(acceptor, id, echoed); }};
+        TcpSocket client;
+        REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+        REQUIRE(session.handshake(client.fd(), "127.0.0.1", config).has_value());
+        CHECK(session.version() == "TLSv1.2");
+        CHECK_FALSE(session.cipher().empty());
+
+        // With a kernel TLS module the socket itself carries plaintext
+        const std::string_view msg = "35=0\x01";
+        if (session.tx_offloaded()) {
+            CHECK(::send(client.fd(), msg.data(), msg.size(), 0) == static_cast<ssize_t>(msg.size()));
+        } else {
+            CHECK(session.write({msg.data(), msg.size()}) == msg.size());
+        }
+        std::array<char, 64> buf{};
+        auto n = session.read(buf, 5000);
+        REQUIRE(n.has_value());
+        CHECK(std::string_view{buf.data(), *n} == msg);
+        CHECK(session.offload() == static_cast<TlsOffload>(
+            (session.tx_offloaded() ? 1 : 0) | (session.rx_offloaded() ? 2 : 0)));
+        session.shutdown();
+        client.close();
+        server.join();
+    }
+
+    SECTION("wrong host name fails verification") {
+        TlsConfig config;
+        config.enabled = true;
+        config.server_name = "venue.example";
+        config.ca_file = ca_path.string();
+        std::atomic<bool> echoed{false};
+        KtlsSession session;
+        auto result = handshake(config, echoed, session);
+        REQUIRE_FALSE(result.has_value());
+        CHECK(result.error().code == TransportErrorCode::TlsHandshakeFailed);
+        CHECK_FALSE(echoed);
+    }
+
+    SECTION("required offload is enforced") {
+        TlsConfig config;
+        config.enabled = true;
+        config.verify_peer = false;
+        config.max_version = TlsVersion::Tls12;
+        config.require_offload = true;
+        std::atomic<bool> echoed{false};
+        KtlsSession session;
+        auto result = handshake(config, echoed, session);
+        if (!result) {
+            CHECK(result.error().code == TransportErrorCode::TlsOffloadUnavailable);
+        }
+    }
+
+    std::filesystem::remove(ca_path);
+}
+
+#endif  // NFX_KTLS_AVAILABLE
+
+TEST_CASE("EndpointCache and StandbySockets take resolution and setup off the reconnect path", "[session][reconnect]") {
+    SECTION("Lookups are served from the cache until invalidated") {
+        EndpointCache cache;
+        auto first = cache.lookup("127.0.0.1", 9876);
+        REQUIRE(first.has_value());
+        REQUIRE(first->valid());
+        CHECK(first->port() == 9876);
+        CHECK(cache.lookups() == 1);
+
+        auto again = cache.lookup("127.0.0.1", 9876);
+        REQUIRE(again.has_value());
+        CHECK(cache.lookups() == 1);
+        CHECK(std::memcmp(&first->addr, &again->addr, first->addrlen) == 0);
+
+        cache.rotate("127.0.0.1", 9876);   // Single address: stays put
+        CHECK(cache.lookup("127.0.0.1", 9876)->port() == 9876);
+        CHECK(cache.lookups() == 1);
+
+        (void)cache.lookup("127.0.0.1", 9877);
+        CHECK(cache.lookups() == 2);
+
+        cache.invalidate("127.0.0.1", 9876);
+        REQUIRE(cache.lookup("127.0.0.1", 9876).has_value());
+        CHECK(cache.lookups() == 3);
+    }
+
+    SECTION("Unresolvable hosts fail") {
+        EndpointCache cache;
+        auto missing = cache.lookup("host.invalid", 9876);
+        REQUIRE_FALSE(missing.has_value());
+        CHECK(missing.error().code == TransportErrorCode::AddressResolutionFailed);
+    }
+
+    SECTION("Standby sockets are created configured and handed out") {
+        SocketOptions options;
+        options.tcp_nodelay = true;
+        options.recv_buffer_size = 0;
+        options.send_buffer_size = 0;
+        StandbySockets sockets{2, options};
+        CHECK(sockets.refill() == 2);
+        CHECK(sockets.available() == 2);
+        CHECK(sockets.refill() == 0);
+
+        auto fd = sockets.take();
+        REQUIRE(fd.has_value());
+        CHECK(sockets.available() == 1);
+        CHECK(sockets.misses() == 0);
+
+        int nodelay = 0;
+        socklen_t len = sizeof(nodelay);
+        REQUIRE(::getsockopt(*fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, &len) == 0);
+        CHECK(nodelay != 0);
+        CHECK((::fcntl(*fd, F_GETFL) & O_NONBLOCK) != 0);
+        CHECK((::fcntl(*fd, F_GETFD) & FD_CLOEXEC) != 0);
+        ::close(*fd);
+
+        auto second = sockets.take();
+        auto third = sockets.take();   // Pool empty: created on the spot
+        REQUIRE(second.has_value());
+        REQUIRE(third.has_value());
+        CHECK(sockets.misses() == 1);
+        ::close(*second);
+        ::close(*third);
+    }
+
+    SECTION("TcpSocket connects to a cached endpoint") {
+        TcpAcceptor acceptor;
+        REQUIRE(acceptor.listen(0).has_value());
+
+        EndpointCache cache;
+        auto endpoint = cache.lookup("127.0.0.1", acceptor.local_port());
+        REQUIRE(endpoint.has_value());
+
+        TcpSocket client;
+        REQUIRE(client.connect(*endpoint).has_value());
+        CHECK(client.is_connected());
+        auto accepted = acceptor.accept();
+        REQUIRE(accepted.has_value());
+        ::close(*accepted);
+
+        TcpSocket unresolved;
+        CHECK_FALSE(unresolved.connect(ResolvedEndpoint{}).has_value());
+    }
+}
+
+TEST_CASE("Timestamp generators format microsecond and nanosecond fractions", "[session][timestamp]") {
+    using namespace std::chrono;
+    const auto tp = sys_days{year{2026} / 1 / 22} + hours{14} + minutes{30} + seconds{45} +
+                    nanoseconds{123'456'789};
+    const auto at = time_point_cast<system_clock::duration>(tp);
+
+    util::FastTimestamp ms;
+    util::FastTimestamp us{util::TimestampPrecision::Microseconds};
+    util::FastTimestamp ns{util::TimestampPrecision::Nanoseconds};
+    REQUIRE(ms.get(at) == "20260122-14:30:45.123");
+    REQUIRE(us.get(at) == "20260122-14:30:45.123456");
+    if constexpr (std::ratio_less_equal_v<system_clock::period, std::nano>) {
+        REQUIRE(ns.get(at) == "20260122-14:30:45.123456789");
+    }
+    ns.set_precision(util::TimestampPrecision::Milliseconds);
+    REQUIRE(ns.get(at) == "20260122-14:30:45.123");
+
+    util::RdtscTimestamp rdtsc{util::TimestampPrecision::Nanoseconds};
+    const std::string_view now = rdtsc.get();
+    REQUIRE(now.size() == 27);
+    Timestamp parsed;
+    REQUIRE(parse_utc_timestamp(now, parsed));
+
+    // Per-session SendingTime precision
+    SessionConfig config = client_config();
+    config.timestamp_precision = util::TimestampPrecision::Microseconds;
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    auto logon = ParsedMessage::parse(std::span<const char>{sent[0].data(), sent[0].size()});
+    REQUIRE(logon.has_value());
+    const std::string_view sending_time = logon->get_string(52);
+    REQUIRE(sending_time.size() == 24);
+    REQUIRE(parse_utc_timestamp(sending_time, parsed));
+}
+
+TEST_CASE("RdtscClock converts with a fixed-point mult and recalibrates in the background", "[session][timestamp]") {
+    using util::RdtscClock;
+
+    // 2 GHz: 0.5 ns per cycle
+    const util::TscCalibration cal{1'000, 5'000'000'000ULL, 1ULL << (RdtscClock::SHIFT - 1)};
+    REQUIRE(RdtscClock::to_ns(cal, 1'000) == 5'000'000'000ULL);
+    REQUIRE(RdtscClock::to_ns(cal, 1'000 + 2'000'000'000ULL) == 6'000'000'000ULL);
+    REQUIRE(RdtscClock::to_ns(cal, 0) == 5'000'000'000ULL - 500);     // TSC read before the base
+
+    RdtscClock::initialize();
+    REQUIRE(RdtscClock::calibration().mult != 0);
+    REQUIRE(RdtscClock::frequency_ghz() > 0.1);
+
+    auto system_ns = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    };
+    auto close_to_system = [&] {
+        const int64_t diff = static_cast<int64_t>(RdtscClock::now_ns() - system_ns());
+        return diff > -20'000'000 && diff < 20'000'000;
+    };
+    REQUIRE(close_to_system());
+
+    REQUIRE(RdtscClock::start_recalibration(std::chrono::milliseconds{10}));
+    REQUIRE_FALSE(RdtscClock::start_recalibration());
+    REQUIRE(RdtscClock::recalibrating());
+    const uint64_t base = RdtscClock::calibration().base_ns;
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    REQUIRE(RdtscClock::calibration().base_ns > base);
+    REQUIRE(close_to_system());
+    RdtscClock::stop_recalibration();
+    REQUIRE_FALSE(RdtscClock::recalibrating());
+}
+
+TEST_CASE("Latency histograms bucket log-linearly and publish snapshots", "[session][latency]") {
+    using H = LatencyHistogram;
+
+    SECTION("Buckets are exact below 16, then 16 per power of two") {
+        REQUIRE(H::bucket_of(0) == 0);
+        REQUIRE(H::bucket_of(15) == 15);
+        REQUIRE(H::bucket_of(16) == 16);
+        REQUIRE(H::bucket_of(31) == 31);
+        REQUIRE(H::bucket_of(32) == 32);
+        REQUIRE(H::bucket_of(33) == 32);
+        REQUIRE(H::bucket_of(UINT64_MAX) == H::BUCKETS - 1);
+        for (uint64_t v : {1ULL, 17ULL, 100ULL, 1'000ULL, 123'456ULL, 3'000'000'000ULL}) {
+            const size_t b = H::bucket_of(v);
+            REQUIRE(H::bucket_floor(b) <= v);
+            REQUIRE(H::bucket_floor(b + 1) > v);
+            REQUIRE(static_cast<double>(v - H::bucket_floor(b)) <= static_cast<double>(v) / 16.0);
+        }
+    }
+
+    SECTION("Percentiles") {
+        H h;
+        for (uint64_t v = 1; v <= 100; ++v) h.record(v * 100);
+        REQUIRE(h.count() == 100);
+        REQUIRE(h.max() == 10'000);
+        REQUIRE(h.mean() == 5'050.0);
+        const uint64_t p50 = h.percentile(50.0);
+        REQUIRE(p50 <= 5'000);
+        REQUIRE(p50 > 5'000 - 5'000 / 16);
+        REQUIRE(h.percentile(100.0) <= 10'000);
+        REQUIRE(h.percentile(100.0) > 10'000 - 10'000 / 16);
+    }
+
+    SECTION("Merge adds per-thread histograms") {
+        H a, b;
+        for (uint64_t v = 1; v <= 50; ++v) a.record(v * 100);
+        for (uint64_t v = 51; v <= 100; ++v) b.record(v * 100);
+        a.merge(b);
+        REQUIRE(a.count() == 100);
+        REQUIRE(a.max() == 10'000);
+        REQUIRE(a.mean() == 5'050.0);
+        REQUIRE(a.percentile(50.0) <= 5'000);
+    }
+
+    SECTION("Recorder publishes on demand and every PUBLISH_EVERY samples") {
+        LatencyRecorder<true> recorder;
+        recorder.record(LatencyStage::RecvToParse, 100, 150);
+        REQUIRE(recorder.snapshot()[LatencyStage::RecvToParse].count() == 0);
+        recorder.publish();
+        REQUIRE(recorder.snapshot()[LatencyStage::RecvToParse].count() == 1);
+        REQUIRE(recorder.snapshot()[LatencyStage::RecvToParse].max() == 50);
+
+        for (uint64_t i = 0; i < LatencyRecorder<true>::PUBLISH_EVERY; ++i) {
+            recorder.record(LatencyStage::SendToWire, 0, i);
+        }
+        REQUIRE(recorder.snapshot()[LatencyStage::SendToWire].count() ==
+                LatencyRecorder<true>::PUBLISH_EVERY);
+
+        recorder.reset();
+        REQUIRE(recorder.snapshot()[LatencyStage::SendToWire].count() == 0);
+    }
+
+    SECTION("Session records each stage when built with NFX_HAS_LATENCY_HISTOGRAMS") {
+        static_assert(std::is_empty_v<LatencyRecorder<false>>);
+
+        std::vector<std::string> sent;
+        SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        REQUIRE(session.state() == SessionState::Active);
+
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("L1").symbol("AAPL").side(Side::Buy)
+             .order_qty(Qty::from_int(100)).ord_type(OrdType::Market)
+             .transact_time("20260122-14:30:45.123");
+        REQUIRE(session.send_app_message(order).has_value());
+        session.on_timer_tick();
+
+        const LatencySnapshot snap = session.latency().snapshot();
+        if constexpr (LATENCY_HISTOGRAMS_ENABLED) {
+            REQUIRE(snap[LatencyStage::RecvToParse].count() == 1);
+            REQUIRE(snap[LatencyStage::ParseToHandler].count() == 1);
+            REQUIRE(snap[LatencyStage::HandlerToSend].count() == 1);
+            REQUIRE(snap[LatencyStage::SendToWire].count() == 2);     // Logon, order
+        } else {
+            for (const auto& h : snap.stages) REQUIRE(h.count() == 0);
+        }
+    }
+}
+
+TEST_CASE("Metrics registry renders published stats as OpenMetrics", "[session][metrics]") {
+    MetricsRegistry registry;
+    const std::string labels = metric_labels({{"session", "CLIENT->\"BROKER\""}});
+    REQUIRE(labels == "session=\"CLIENT->\\\"BROKER\\\"\"");
+
+    store::MemoryMessageStore store{store::MemoryMessageStore::Config{}};
+    std::vector<std::string> sent;
+    SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+    session.set_message_store(&store);
+    session.set_metrics(registry.add<SessionStats>(labels),
+                        registry.add<store::IMessageStore::Stats>(labels));
+    registry.add_latency(labels, session.latency());
+    auto* pool = registry.add<store::MemoryMessageStore::PoolMetrics>(labels);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+    // Nothing new is visible until the session thread publishes
+    std::string text = registry.render();
+    REQUIRE(text.find("nfx_session_messages_sent_total{" + labels + "} 0\n") != std::string::npos);
+
+    session.on_timer_tick();
+    pool->publish(store.pool_metrics());
+    text = registry.render();
+    REQUIRE(text.find("# TYPE nfx_session_messages_sent counter\n") != std::string::npos);
+    REQUIRE(text.find("nfx_session_messages_sent_total{" + labels + "} 1\n") != std::string::npos);
+    REQUIRE(text.find("nfx_session_messages_received_total{" + labels + "} 1\n") != std::string::npos);
+    REQUIRE(text.find("# TYPE nfx_session_throttle_queue_depth gauge\n") != std::string::npos);
+    REQUIRE(text.find("nfx_store_messages_stored_total{" + labels + "} 1\n") != std::string::npos);
+    REQUIRE(text.find("nfx_store_pool_capacity_bytes{" + labels + "} ") != std::string::npos);
+    REQUIRE(text.ends_with("# EOF\n"));
+    if constexpr (LATENCY_HISTOGRAMS_ENABLED) {
+        REQUIRE(text.find("# TYPE nfx_session_latency_seconds histogram\n") != std::string::npos);
+        REQUIRE(text.find("nfx_session_latency_seconds_count{" + labels +
+                          ",stage=\"recv->parse\"} 1\n") != std::string::npos);
+    } else {
+        REQUIRE(text.find("latency") == std::string::npos);
+    }
+
+    // A second session lands in the same families
+    auto* other = registry.add<SessionStats>(metric_labels({{"session", "OTHER"}}));
+    SessionStats stats;
+    stats.messages_sent = 7;
+    other->publish(stats);
+    text = registry.render();
+    const size_t first = text.find("nfx_session_messages_sent_total{" + labels);
+    const size_t second = text.find("nfx_session_messages_sent_total{session=\"OTHER\"} 7\n");
+    REQUIRE(second != std::string::npos);
+    REQUIRE(second > first);
+    REQUIRE(text.find("# TYPE nfx_session_messages_received", first) > second);
+
+    SECTION("Served over HTTP") {
+        MetricsHttpServer server{registry, std::chrono::milliseconds{5}};
+        REQUIRE(server.start(0));
+        REQUIRE_FALSE(server.start(0));
+
+        auto scrape = [&](std::string_view request) {
+            TcpSocket client;
+            REQUIRE(client.connect("127.0.0.1", server.port()).has_value());
+            REQUIRE(client.send(std::span<const char>{request.data(), request.size()}).has_value());
+            std::string response;
+            std::array<char, 4096> buffer{};
+            while (true) {
+                auto n = client.receive(buffer);
+                if (!n || *n == 0) break;
+                response.append(buffer.data(), *n);
+            }
+            return response;
+        };
+
+        const std::string ok = scrape("GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        REQUIRE(ok.starts_with("HTTP/1.1 200 OK\r\n"));
+        REQUIRE(ok.find("Content-Type: application/openmetrics-text") != std::string::npos);
+        REQUIRE(ok.find("nfx_session_messages_sent_total{session=\"OTHER\"} 7\n") != std::string::npos);
+        REQUIRE(ok.ends_with("# EOF\n"));
+        REQUIRE(scrape("GET / HTTP/1.1\r\n\r\n").starts_with("HTTP/1.1 404"));
+        REQUIRE(server.scrapes() == 1);
+        server.stop();
+        REQUIRE_FALSE(server.is_running());
+    }
+}
+
+TEST_CASE("Binary logger writes raw messages for offline decoding", "[session][binlog]") {
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("nfx_binlog_" + std::to_string(::getpid()) + ".nfxlog");
+
+    SECTION("Ring wraps and drops when full") {
+        util::BinaryLogRing ring{4096};
+        const std::string msg(100, 'x');
+        size_t written = 0;
+        while (ring.try_write(util::LogDirection::Outbound, 1, written, msg)) ++written;
+        REQUIRE(written == 4096 / util::detail::log_record_size(msg.size()));
+        REQUIRE(ring.dropped() == 1);
+
+        // Drain half, then the next records wrap past the end
+        size_t seen = 0;
+        REQUIRE(ring.drain([&](const util::BinaryLogRecord& r, std::span<const char> p) {
+            REQUIRE(r.tsc == seen++);
+            REQUIRE(std::string_view{p.data(), p.size()} == msg);
+        }, written / 2) == written / 2);
+        for (size_t i = 0; i < written / 2; ++i) {
+            REQUIRE(ring.try_write(util::LogDirection::Outbound, 1, written + i, msg));
+        }
+        REQUIRE(ring.drain([&](const util::BinaryLogRecord& r, std::span<const char>) {
+            REQUIRE(r.tsc == seen++);
+        }) == written - written / 2 + written / 2);
+        REQUIRE(ring.empty());
+        REQUIRE_FALSE(ring.try_write(util::LogDirection::Inbound, 1, 0, std::string(4096, 'y')));
+    }
+
+    SECTION("Session traffic round-trips through the file") {
+        {
+            util::BinaryLogger logger{path.c_str()};
+            REQUIRE(logger.is_open());
+            REQUIRE(logger.start());
+
+            std::vector<std::string> sent;
+            SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+            session.set_binary_logger(&logger, 7);
+            session.on_connect();
+            REQUIRE(session.initiate_logon().has_value());
+            feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+
+            // A second thread gets a ring of its own
+            std::thread other{[&] {
+                REQUIRE(logger.log(util::LogDirection::Inbound, 9, std::string_view{"8=FIX.4.4\x01" "35=0\x01"}));
+            }};
+            other.join();
+
+            logger.stop();
+            const auto stats = logger.stats();
+            REQUIRE(stats.logged == 3);
+            REQUIRE(stats.dropped == 0);
+            REQUIRE(stats.rings == 2);
+        }
+
+        util::BinaryLogReader reader{path.c_str()};
+        REQUIRE(reader.is_valid());
+        std::vector<util::BinaryLogEntry> entries;
+        util::BinaryLogEntry entry;
+        while (reader.next(entry)) entries.push_back(entry);
+        REQUIRE(entries.size() == 3);
+
+        REQUIRE(entries[0].direction == util::LogDirection::Outbound);
+        REQUIRE(entries[0].session_id == 7);
+        REQUIRE(entries[0].bytes.find("35=A\x01") != std::string::npos);
+        REQUIRE(entries[1].direction == util::LogDirection::Inbound);
+        REQUIRE(entries[1].bytes.find("35=A\x01") != std::string::npos);
+        REQUIRE(entries[2].session_id == 9);
+
+        // Timestamps come from the calibration record, close to now
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        REQUIRE(std::abs(now - entries[0].time.nanos) < 10'000'000'000LL);
+
+        std::string line;
+        util::format_log_entry(entries[2], line);
+        REQUIRE(line.size() > 27);
+        REQUIRE(line.substr(27) == " I 9 8=FIX.4.4|35=0|");
+        std::filesystem::remove(path);
+    }
+
+    REQUIRE_FALSE(util::BinaryLogReader{"/nonexistent/nfx.nfxlog"}.is_valid());
+}
+
+namespace {
+
+/// Classic pcap (microseconds) of Ethernet/IPv4/TCP frames
+struct PcapBuilder {
+    std::string bytes;
+
+    PcapBuilder() { put32(0xa1b2c3d4); put16(2); put16(4); put32(0); put32(0); put32(65535); put32(1); }
+
+    void tcp(uint16_t src_port, uint16_t dst_port, uint32_t seq, std::string_view payload, uint32_t usec) {
+        std::string frame(14, '\0');
+        frame[12] = '\x08';                                   // IPv4
+        const size_t ip_len = 40 + payload.size();
+        const uint8_t ip[20] = {0x45, 0, uint8_t(ip_len >> 8), uint8_t(ip_len), 0, 0, 0x40, 0, 64, 6, 0, 0,
+                                10, 0, 0, uint8_t(src_port == 9876 ? 2 : 1), 10, 0, 0, uint8_t(src_port == 9876 ? 1 : 2)};
+        const uint8_t tcp[20] = {uint8_t(src_port >> 8), uint8_t(src_port), uint8_t(dst_port >> 8), uint8_t(dst_port),
+                                 uint8_t(seq >> 24), uint8_t(seq >> 16), uint8_t(seq >> 8), uint8_t(seq),
+                                 0, 0, 0, 0, 0x50, 0x18, 0xff, 0xff, 0, 0, 0, 0};
+        frame.append(reinterpret_cast<const char*>(ip), 20);
+        frame.append(reinterpret_cast<const char*>(tcp), 20);
+        frame.append(payload);
+        put32(1); put32(usec); put32(static_cast<uint32_t>(frame.size())); put32(static_cast<uint32_t>(frame.size()));
+        bytes += frame;
+    }
+
+    void put16(uint16_t v) { bytes.append(reinterpret_cast<const char*>(&v), 2); }
+    void put32(uint32_t v) { bytes.append(reinterpret_cast<const char*>(&v), 4); }
+};
+
+/// Accepts at most max_write bytes per send(); one canned response
+struct MirrorTestSocket {
+    std::string written;
+    size_t max_write{50};
+    size_t responses{1};
+
+    TransportResult<size_t> send(std::span<const char> data) {
+        const size_t n = std::min(data.size(), max_write);
+        written.append(data.data(), n);
+        return n;
+    }
+    TransportResult<size_t> try_receive(std::span<char> buffer) {
+        if (responses == 0) return size_t{0};
+        --responses;
+        return std::min<size_t>(buffer.size(), 10);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Session replay from captures and binary logs", "[session][replay]") {
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("nfx_replay_" + std::to_string(::getpid()));
+
+    // Client side of a session: broker (port 9876) -> client (port 40000)
+    const std::string logon = make_message("A", 1, "98=0\x01" "108=30\x01");
+    const std::string exec = make_message("8", 2);
+    const std::string order = make_message("D", 3);
+    const std::string heartbeat = make_message("0", 2);
+
+    PcapBuilder pcap;
+    const std::string first = logon + exec.substr(0, 20);
+    pcap.tcp(9876, 40000, 5000, first, 1000);
+    pcap.tcp(40000, 9876, 100, heartbeat, 1500);
+    pcap.tcp(9876, 40000, 5000, first, 1600);                   // Retransmission
+    pcap.tcp(9876, 40000, 5000 + static_cast<uint32_t>(first.size()), exec.substr(20) + order, 2000);
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << pcap.bytes;
+    }
+    const auto open_capture = [&] { return PcapReplaySource::open(path.c_str(), {.local_port = 40000}); };
+
+    SECTION("Capture: TCP reassembly, retransmissions and directions") {
+        auto source = open_capture();
+        REQUIRE(source.has_value());
+
+        std::vector<ReplayMessage> messages;
+        std::vector<std::string> bytes;
+        ReplayMessage msg;
+        while (source->next(msg)) {
+            messages.push_back(msg);
+            bytes.emplace_back(msg.bytes.data(), msg.bytes.size());
+        }
+        REQUIRE(bytes == std::vector<std::string>{logon, heartbeat, exec, order});
+        REQUIRE(messages[0].direction == ReplayDirection::Inbound);
+        REQUIRE(messages[1].direction == ReplayDirection::Outbound);
+        REQUIRE(messages[2].direction == ReplayDirection::Inbound);
+        REQUIRE(messages[0].stream == 0);
+        REQUIRE(messages[1].stream == 1);
+        REQUIRE(messages[0].time_ns == 1'000'000'000 + 1'000'000);
+        REQUIRE(messages[3].time_ns == 1'000'000'000 + 2'000'000);
+
+        REQUIRE(source->stats().frames == 4);
+        REQUIRE(source->stats().retransmitted == first.size());
+        REQUIRE(source->stats().reassembled == 1);
+        REQUIRE(source->stats().gaps == 0);
+    }
+
+    SECTION("Messages survive any segmentation of the stream") {
+        std::string stream;
+        std::vector<std::string> expected;
+        for (uint32_t seq = 1; seq <= 40; ++seq) {
+            expected.push_back(make_message(seq % 3 ? "8" : "0", seq));
+            stream += expected.back();
+        }
+        for (uint32_t round = 0; round < 20; ++round) {
+            PcapBuilder split;
+            uint32_t state = round * 2654435761u + 1;
+            for (size_t at = 0; at < stream.size();) {
+                state = state * 1103515245u + 12345u;
+                const size_t n = std::min<size_t>(stream.size() - at, 1 + (state >> 16) % 150);
+                split.tcp(9876, 40000, 7000 + static_cast<uint32_t>(at), std::string_view{stream}.substr(at, n), 0);
+                at += n;
+            }
+            {
+                std::ofstream out{path, std::ios::binary | std::ios::trunc};
+                out << split.bytes;
+            }
+            auto source = PcapReplaySource::open(path.c_str());
+            REQUIRE(source.has_value());
+            std::vector<std::string> bytes;
+            ReplayMessage msg;
+            while (source->next(msg)) bytes.emplace_back(msg.bytes.data(), msg.bytes.size());
+            REQUIRE(bytes == expected);
+        }
+    }
+
+    SECTION("Original pacing follows capture timestamps") {
+        auto source = open_capture();
+        ReplayOptions options;
+        options.pacing = ReplayPacing::Original;
+        options.direction = ReplayDirection::Inbound;
+        size_t seen = 0;
+        const ReplayStats stats = replay(*source, options, [&](const ReplayMessage&) { ++seen; });
+        REQUIRE(seen == 3);
+        REQUIRE(stats.messages == 3);
+        REQUIRE(stats.skipped == 1);
+        REQUIRE(stats.elapsed_ns >= 900'000);                   // Capture spans 1ms
+    }
+
+    SECTION("Replay into a session and a StreamParser") {
+        std::vector<std::string> sent;
+        SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+
+        auto source = open_capture();
+        ReplayOptions options;
+        options.direction = ReplayDirection::Inbound;
+        const ReplayStats stats = replay_into(*source, session, options);
+        REQUIRE(stats.messages == 3);
+        REQUIRE(session.state() == SessionState::Active);
+        REQUIRE(session.handler().routed == "exec;app:D;");
+
+        auto again = open_capture();
+        StreamParser parser;
+        size_t framed = 0;
+        replay(*again, ReplayOptions{}, [&](const ReplayMessage& msg) {
+            REQUIRE(parser.feed(msg.bytes) == msg.bytes.size());
+            while (parser.has_message()) {
+                (void)parser.next_message();
+                ++framed;
+            }
+        });
+        REQUIRE(framed == 4);
+    }
+
+    SECTION("Mirror writes every selected message to the acceptor") {
+        auto source = open_capture();
+        MirrorTestSocket socket;
+        ReplayOptions options;
+        options.direction = ReplayDirection::Inbound;
+        const MirrorStats stats = mirror(*source, socket, options);
+        REQUIRE(socket.written == logon + exec + order);
+        REQUIRE(stats.replay.messages == 3);
+        REQUIRE(stats.send_failures == 0);
+        REQUIRE(stats.bytes_received == 10);
+    }
+
+    SECTION("Binary log records replay without copying") {
+        const auto log_path = path.string() + ".nfxlog";
+        {
+            util::BinaryLogger logger{log_path.c_str()};
+            REQUIRE(logger.start());
+            REQUIRE(logger.log(util::LogDirection::Outbound, 1, std::string_view{heartbeat}));
+            REQUIRE(logger.log(util::LogDirection::Inbound, 1, std::string_view{exec}));
+            REQUIRE(logger.log(util::LogDirection::Inbound, 2, std::string_view{order}));
+            logger.stop();
+        }
+
+        auto source = BinaryLogReplaySource::open(log_path.c_str());
+        REQUIRE(source.has_value());
+        ReplayOptions options;
+        options.stream = 1;
+        std::vector<std::string> bytes;
+        std::vector<ReplayDirection> directions;
+        const ReplayStats stats = replay(*source, options, [&](const ReplayMessage& msg) {
+            REQUIRE(msg.time_ns > 0);
+            bytes.emplace_back(msg.bytes.data(), msg.bytes.size());
+            directions.push_back(msg.direction);
+        });
+        REQUIRE(bytes == std::vector<std::string>{heartbeat, exec});
+        REQUIRE(directions == std::vector<ReplayDirection>{ReplayDirection::Outbound, ReplayDirection::Inbound});
+        REQUIRE(stats.skipped == 1);
+
+        REQUIRE_FALSE(BinaryLogReplaySource::open(path.c_str()).has_value());   // A pcap
+        std::filesystem::remove(log_path);
+    }
+
+    REQUIRE_FALSE(PcapReplaySource::open("/nonexistent/nfx.pcap").has_value());
+    std::filesystem::remove(path);
+}
+
+namespace {
+
+/// Market data session handler that sends an order on another session
+struct TickToTradeHandler : RecordingHandler {
+    SessionManager<RecordingHandler>* orders{nullptr};
+
+    void on_app_message(const ParsedMessage&) noexcept {
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("T2T1")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20240102-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25));
+        (void)orders->send_app_message(order);
+    }
+};
+
+} // namespace
+
+TEST_CASE("Flight recorder correlates a tick with the order it triggered", "[session][flight]") {
+    FlightRecorder recorder{8};
+    REQUIRE(recorder.capacity() == 8);
+
+    SECTION("Ring keeps the newest records") {
+        for (uint32_t i = 0; i < 20; ++i) recorder.trace(TracePoint::Submit, i + 1, 3, i);
+        std::vector<TraceRecord> records;
+        REQUIRE(recorder.recorded() == 20);
+        REQUIRE(recorder.snapshot(records) == 8);
+        REQUIRE(records.front().seq_num == 12);
+        REQUIRE(records.back().seq_num == 19);
+        REQUIRE(records.back().session_id == 3);
+    }
+
+    SECTION("Replies on another session carry the inbound trace id") {
+        FlightRecorder shared{256};
+        std::vector<std::string> sent;
+        SessionManager<RecordingHandler> order_session{client_config(), RecordingHandler{&sent, {}, 0}};
+        SessionManager<TickToTradeHandler> md_session{client_config(), TickToTradeHandler{}};
+        md_session.handler().orders = &order_session;
+        order_session.set_flight_recorder(&shared, 2);
+        md_session.set_flight_recorder(&shared, 1);
+
+        order_session.on_connect();
+        REQUIRE(order_session.initiate_logon().has_value());
+        feed(order_session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        md_session.on_connect();
+        REQUIRE(md_session.initiate_logon().has_value());
+        feed(md_session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        sent.clear();
+
+        feed(md_session, make_message("W", 2, "55=AAPL\x01"));
+        REQUIRE(sent.size() == 1);
+
+        std::vector<TraceRecord> records;
+        shared.snapshot(records);
+        const uint64_t tick = records.back().trace_id;
+        std::vector<std::pair<TracePoint, uint16_t>> path;
+        for (const auto& r : records) {
+            if (r.trace_id == tick) path.emplace_back(r.point, r.session_id);
+        }
+        const std::vector<std::pair<TracePoint, uint16_t>> expected{
+            {TracePoint::RecvCqe, 1}, {TracePoint::ParseDone, 1}, {TracePoint::HandlerEntry, 1},
+            {TracePoint::BuildDone, 2}, {TracePoint::Submit, 2}, {TracePoint::SendComplete, 2},
+            {TracePoint::HandlerExit, 1}};
+        REQUIRE(path == expected);
+        REQUIRE(FlightRecorder::active_trace() == 0);
+
+        // Sends outside a handler open a trace of their own
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("ORD2").symbol("AAPL").side(Side::Buy)
+            .transact_time("20240102-09:30:00.000").order_qty(Qty::from_int(1)).ord_type(OrdType::Market);
+        REQUIRE(order_session.send_app_message(order).has_value());
+        shared.snapshot(records);
+        REQUIRE(records.back().point == TracePoint::SendComplete);
+        REQUIRE(records.back().trace_id > tick);
+
+        // Text dump, one line per record
+        char tmpl[] = "/tmp/nfx_flight_XXXXXX";
+        const int fd = ::mkstemp(tmpl);
+        REQUIRE(fd >= 0);
+        shared.dump(fd);
+        ::close(fd);
+        std::ifstream in{tmpl};
+        std::string line, last;
+        size_t lines = 0;
+        while (std::getline(in, line)) {
+            last = line;
+            ++lines;
+        }
+        REQUIRE(lines == records.size());
+        REQUIRE(last.find(" sent session=2 seq=3 ") != std::string::npos);
+        std::filesystem::remove(tmpl);
+    }
+}
+
+TEST_CASE("Perf profile aggregates counter deltas per message type", "[session][perf]") {
+    util::ThreadPerfCounters counters;
+    const bool available = counters.open(util::DEFAULT_PERF_EVENTS);
+    if (!available) {
+        REQUIRE_FALSE(counters.is_open());
+        REQUIRE_FALSE(counters.userspace());
+    }
+
+    MsgTypePerfProfile profile{counters};
+
+    SECTION("Rows are keyed by MsgType, overflow folds into '?'") {
+        util::PerfSample start{};
+        profile.begin(start);
+        profile.end(PerfRegion::Parse, "8", start);
+        profile.end(PerfRegion::Parse, "8", start);
+        profile.end(PerfRegion::Build, "AE", start);
+        for (char c = 'a'; c <= 'z'; ++c) {
+            for (char d = 'a'; d <= 'b'; ++d) profile.end(PerfRegion::Dispatch, std::string{c, d}, start);
+        }
+        REQUIRE(profile.snapshot().find("8") == nullptr);   // Not published yet
+        profile.publish();
+
+        const PerfProfileSnapshot snap = profile.snapshot();
+        REQUIRE(snap.event_count == counters.size());
+        REQUIRE(snap.find("8") != nullptr);
+        REQUIRE((*snap.find("8"))[PerfRegion::Parse].samples == 2);
+        REQUIRE((*snap.find("AE"))[PerfRegion::Build].samples == 1);
+        REQUIRE(snap.find("zb") == nullptr);
+        REQUIRE((*snap.find("?"))[PerfRegion::Dispatch].samples > 0);
+    }
+
+    SECTION("Session samples parse, dispatch and build") {
+        std::vector<std::string> sent;
+        SessionManager<RecordingHandler> session{client_config(), RecordingHandler{&sent, {}, 0}};
+        session.set_perf_profile(&profile);
+        REQUIRE((session.perf_profile() != nullptr) == available);
+        if (!available) return;   // No PMU access here (VM, perf_event_paranoid)
+
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        feed(session, make_message("A", 1, "98=0\x01" "108=30\x01"));
+        feed(session, make_message("8", 2, "37=O1\x01"));
+        fix44::NewOrderSingle::Builder order;
+        order.cl_ord_id("P1").symbol("AAPL").side(Side::Buy)
+            .transact_time("20240102-09:30:00.000").order_qty(Qty::from_int(1)).ord_type(OrdType::Market);
+        REQUIRE(session.send_app_message(order).has_value());
+        session.on_timer_tick();
+
+        const PerfProfileSnapshot snap = profile.snapshot();
+        REQUIRE((*snap.find("8"))[PerfRegion::Parse].samples == 1);
+        REQUIRE((*snap.find("8"))[PerfRegion::Dispatch].samples == 1);
+        REQUIRE((*snap.find("D"))[PerfRegion::Build].samples == 1);
+        REQUIRE((*snap.find("8"))[PerfRegion::Dispatch].values[1] > 0);   // Instructions
+    }
+}
+
+TEST_CASE("Session warmup drives a throwaway session of the handler type", "[session][warmup]") {
+    std::vector<std::string> sent;
+    const auto stats = warm_session(client_config(), RecordingHandler{&sent, {}, 0},
+                                    SessionWarmupOptions{.iterations = 3});
+    REQUIRE(stats.success());
+    REQUIRE(stats.iterations == 3);
+    REQUIRE(stats.messages_received == 1 + 3 * 8 + 1);   // Logon, 8 per pass, Logout
+    REQUIRE(stats.messages_resent == 3 * 3);             // Each pass replays its 3 messages
+    REQUIRE(stats.total_cycles > 0);
+
+    // The handler saw real sends: logon, orders, heartbeat replies, logout
+    auto count = [&](std::string_view type) {
+        size_t n = 0;
+        for (const auto& m : sent) n += m.find("\x01" "35=" + std::string{type} + "\x01") != std::string::npos;
+        return n;
+    };
+    REQUIRE(count("A") == 1);
+    REQUIRE(count("D") >= 3);
+    REQUIRE(count("F") >= 3);
+    REQUIRE(count("V") >= 3);
+    REQUIRE(count("5") == 1);
+
+    // Without orders only the inbound mix runs
+    const auto quiet = warm_session(client_config(), RecordingHandler{},
+                                    SessionWarmupOptions{.iterations = 2, .send_orders = false});
+    REQUIRE(quiet.success());
+    REQUIRE(quiet.messages_resent == 0);
+}
+
+TEST_CASE("Session prepare pre-faults every engine-owned region", "[session][prepare]") {
+    store::MemoryMessageStore store{store::MemoryMessageStore::Config{
+        .session_id = "prep", .max_messages = 256, .pool_size_bytes = 64 * 1024}};
+    std::vector<std::string> sent;
+    auto config = client_config();
+    config.coalesce_sends = true;
+    SessionManager<RecordingHandler> session{config, RecordingHandler{&sent, {}, 0}};
+    session.set_message_store(&store);
+
+    // Batches are allocated by prepare(), not on first use
+    std::array<util::MemoryRegion, util::WorkingSet::MAX_REGIONS_PER_OWNER> before{};
+    REQUIRE(session.memory_regions(before) == 3);        // Session, store ring, store index
+
+    std::vector<char> orders(8192);
+    util::WorkingSet working_set;
+    working_set.add({"orders", orders.data(), orders.size()});
+    working_set.add({"empty", nullptr, 0});              // Ignored
+
+    const util::WorkingSetReport report = session.prepare(working_set);
+    REQUIRE(report.regions.size() == 8);
+    for (std::string_view name : {"orders", "session", "session.resend_arena", "session.resend_spans",
+                                  "session.send_arena", "session.send_spans", "store.ring", "store.index"}) {
+        REQUIRE(report.find(name) != nullptr);
+    }
+    REQUIRE(report.find("store.ring")->region.size == 64 * 1024);
+    REQUIRE(report.find("session.resend_arena")->region.size == ResendBatch::DEFAULT_ARENA_SIZE);
+    REQUIRE(report.find("session.send_arena")->region.size == config.coalesce_buffer_size);
+
+    // Locking depends on CAP_IPC_LOCK / RLIMIT_MEMLOCK; the report must add up either way
+    size_t total = 0, locked = 0, failures = 0;
+    for (const auto& r : report.regions) {
+        total += r.region.size;
+        if (r.locked) locked += r.region.size;
+        else failures += !r.lock_error.ok();
+        REQUIRE(r.locked == r.lock_error.ok());
+    }
+    REQUIRE(report.total_bytes == total);
+    REQUIRE(report.locked_bytes == locked);
+    REQUIRE(report.lock_failures == failures);
+    REQUIRE(report.fully_locked() == (failures == 0));
+
+    // Without locking nothing is reported as locked, and the session still works
+    const auto unlocked = session.prepare(util::PrepareOptions{.lock = false});
+    REQUIRE(unlocked.regions.size() == 7);
+    REQUIRE(unlocked.locked_bytes == 0);
+    REQUIRE(unlocked.lock_failures == 0);
+    REQUIRE_FALSE(unlocked.fully_locked());
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    session.flush_sends();
+    REQUIRE(sent.size() == 1);
+
+    // Unlock what was locked so the test leaves RLIMIT_MEMLOCK as it found it
+    for (const auto& r : report.regions) {
+        if (r.locked) util::unlock_memory(r.region.addr, r.region.size);
+    }
+}
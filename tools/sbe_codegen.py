@@ -0,0 +1,1145 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 SilverstreamsAI
+"""
+NexusFIX SBE codec generator
+
+Turns an SBE 1.0 XML message schema (CME MDP3, iLink3, venue or in-house
+schemas) into one header-only C++ file of flyweight codecs in the style of
+the hand-written nfx::sbe::NewOrderSingleCodec:
+
+    - hard-coded Offset/Size structs per message and per repeating group
+    - wrapForDecode/isValid/field accessors, wrapForEncode/encodeHeader/
+      fluent field setters
+    - repeating groups (nested) and var-data, consumed in schema order
+    - enums as enum class, sets and composites as flyweight views
+    - dispatch() over a constexpr jump table indexed by templateId
+
+Only little-endian schemas are supported (sbe_types.hpp read_le/write_le).
+sinceVersion is not acted on: decode honours the acting blockLength from the
+message header, so newer senders with longer blocks still decode.
+
+Usage:
+    sbe_codegen.py schema.xml -o out/mdp3.hpp --namespace nfx::sbe::mdp3
+
+Normally invoked through nfx_sbe_generate() in cmake/NfxSbeCodegen.cmake.
+"""
+
+import argparse
+import keyword
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+# ============================================================================
+# Primitive types
+# ============================================================================
+
+# primitiveType -> (C++ type, size, default null literal)
+PRIMITIVES = {
+    "char":   ("SbeChar",   1, "null_value::CHAR"),
+    "int8":   ("SbeInt8",   1, "null_value::INT8"),
+    "int16":  ("SbeInt16",  2, "null_value::INT16"),
+    "int32":  ("SbeInt32",  4, "null_value::INT32"),
+    "int64":  ("SbeInt64",  8, "null_value::INT64"),
+    "uint8":  ("SbeUint8",  1, "null_value::UINT8"),
+    "uint16": ("SbeUint16", 2, "null_value::UINT16"),
+    "uint32": ("SbeUint32", 4, "null_value::UINT32"),
+    "uint64": ("SbeUint64", 8, "null_value::UINT64"),
+    "float":  ("float",     4, "std::numeric_limits<float>::quiet_NaN()"),
+    "double": ("double",    8, "std::numeric_limits<double>::quiet_NaN()"),
+}
+
+CPP_KEYWORDS = {
+    "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case",
+    "catch", "char", "class", "const", "constexpr", "continue", "decltype",
+    "default", "delete", "do", "double", "else", "enum", "explicit",
+    "export", "extern", "false", "float", "for", "friend", "goto", "if",
+    "inline", "int", "long", "mutable", "namespace", "new", "noexcept",
+    "not", "nullptr", "operator", "or", "private", "protected", "public",
+    "register", "return", "short", "signed", "sizeof", "static", "struct",
+    "switch", "template", "this", "throw", "true", "try", "typedef",
+    "typeid", "typename", "union", "unsigned", "using", "virtual", "void",
+    "volatile", "while", "xor",
+}
+
+# Names the generated classes define themselves
+RESERVED_MEMBERS = {
+    "body", "header", "encoded", "encodedLength", "isValid", "wrapForDecode",
+    "wrapForEncode", "encodeHeader", "mutableBody", "mutableBuffer", "count",
+    "hasNext", "next", "index", "buffer", "raw", "clear", "toDouble",
+}
+
+
+class SchemaError(Exception):
+    pass
+
+
+def local(tag):
+    """Strip the XML namespace: '{http://...}message' -> 'message'"""
+    return tag.rsplit("}", 1)[-1]
+
+
+def safe(name):
+    if name in CPP_KEYWORDS or keyword.iskeyword(name):
+        return name + "_"
+    return name
+
+
+def pascal(name):
+    return safe(name[:1].upper() + name[1:])
+
+
+def camel(name):
+    """MDEntryPx -> mdEntryPx, SecurityID -> securityID, TransactTime -> transactTime"""
+    run = 0
+    while run < len(name) and name[run].isupper():
+        run += 1
+    if run == 0:
+        out = name
+    elif run == 1 or run == len(name):
+        out = name[:run].lower() + name[run:]
+    elif not name[run].isalpha():
+        out = name[:run].lower() + name[run:]
+    else:
+        out = name[:run - 1].lower() + name[run - 1:]
+    out = safe(out)
+    return out + "_" if out in RESERVED_MEMBERS else out
+
+
+def upper_snake(name):
+    s = re.sub(r"([a-z0-9])([A-Z])", r"\1_\2", name)
+    return s.upper()
+
+
+def char_literal(text):
+    if len(text) != 1:
+        raise SchemaError(f"char value must be one character, got {text!r}")
+    if text == "'" or text == "\\":
+        return "'\\" + text + "'"
+    return f"'{text}'"
+
+
+def string_literal(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def int_attr(elem, name, default=None):
+    value = elem.get(name)
+    return int(value) if value is not None else default
+
+
+# ============================================================================
+# Schema model
+# ============================================================================
+
+class Type:
+    """Encoded primitive type (possibly an array, possibly constant)"""
+
+    def __init__(self, name, primitive, length=1, presence="required",
+                 null=None, const=None):
+        if primitive not in PRIMITIVES:
+            raise SchemaError(f"type {name}: unknown primitiveType {primitive}")
+        self.kind = "type"
+        self.name = name
+        self.primitive = primitive
+        self.length = length
+        self.presence = presence
+        self.null = null
+        self.const = const
+
+    @property
+    def cpp(self):
+        return PRIMITIVES[self.primitive][0]
+
+    @property
+    def size(self):
+        if self.presence == "constant":
+            return 0
+        return PRIMITIVES[self.primitive][1] * self.length
+
+    @property
+    def is_string(self):
+        return self.primitive == "char" and self.length != 1
+
+    def null_literal(self):
+        if self.null is None:
+            return PRIMITIVES[self.primitive][2]
+        if self.primitive == "char":
+            return char_literal(self.null) if len(self.null) == 1 else self.null
+        return f"static_cast<{self.cpp}>({self.null})"
+
+    def const_literal(self):
+        if self.is_string:
+            return string_literal(self.const)
+        if self.primitive == "char":
+            return char_literal(self.const)
+        return f"static_cast<{self.cpp}>({self.const})"
+
+
+class Enum:
+    def __init__(self, name, encoding, values):
+        self.kind = "enum"
+        self.name = name
+        self.encoding = encoding  # Type
+        self.values = values      # [(name, literal text)]
+
+    @property
+    def size(self):
+        return self.encoding.size
+
+    def value_literal(self, text):
+        if self.encoding.primitive == "char":
+            return char_literal(text)
+        return text
+
+
+class Set:
+    def __init__(self, name, encoding, choices):
+        self.kind = "set"
+        self.name = name
+        self.encoding = encoding  # Type
+        self.choices = choices    # [(name, bit)]
+
+    @property
+    def size(self):
+        return self.encoding.size
+
+
+class Member:
+    """Composite member or message/group field"""
+
+    def __init__(self, name, type_, offset, presence=None, const=None, id_=None):
+        self.name = name
+        self.type = type_
+        self.offset = offset
+        self.presence = presence or getattr(type_, "presence", "required")
+        self.const = const  # valueRef / constant text for fields
+        self.id = id_
+
+    @property
+    def is_constant(self):
+        return self.presence == "constant"
+
+    @property
+    def size(self):
+        return 0 if self.is_constant else self.type.size
+
+
+class Composite:
+    def __init__(self, name):
+        self.kind = "composite"
+        self.name = name
+        self.members = []
+        self.size = 0
+
+    def member(self, name):
+        for m in self.members:
+            if m.name == name:
+                return m
+        raise SchemaError(f"composite {self.name} has no member {name}")
+
+
+class Group:
+    def __init__(self, name, id_, dimension, block_length):
+        self.name = name
+        self.id = id_
+        self.dimension = dimension  # Composite
+        self.block_length = block_length
+        self.fields = []
+        self.groups = []
+        self.datas = []
+
+
+class Data:
+    def __init__(self, name, id_, encoding):
+        self.name = name
+        self.id = id_
+        self.encoding = encoding  # Composite with length + varData
+
+
+class Message:
+    def __init__(self, name, id_, block_length, description):
+        self.name = name
+        self.id = id_
+        self.block_length = block_length
+        self.description = description
+        self.fields = []
+        self.groups = []
+        self.datas = []
+
+
+class Schema:
+    def __init__(self, root):
+        if local(root.tag) != "messageSchema":
+            raise SchemaError("root element must be messageSchema")
+        self.package = root.get("package", "")
+        self.id = int_attr(root, "id", 0)
+        self.version = int_attr(root, "version", 0)
+        byte_order = root.get("byteOrder", "littleEndian")
+        if byte_order != "littleEndian":
+            raise SchemaError(f"byteOrder={byte_order} not supported (little-endian only)")
+        self.header_type = root.get("headerType", "messageHeader")
+
+        self.types = {}     # name -> Type | Enum | Set | Composite
+        self.order = []     # declaration order of enums/sets/composites
+        self.messages = []
+
+        type_elems = {}
+        for types in root:
+            if local(types.tag) != "types":
+                continue
+            for elem in types:
+                if elem.get("name"):
+                    type_elems[elem.get("name")] = elem
+        self._type_elems = type_elems
+        for name in type_elems:
+            self.resolve(name)
+
+        for elem in root:
+            if local(elem.tag) == "message":
+                self.messages.append(self.parse_message(elem))
+
+        self.header = self.resolve(self.header_type)
+        if not isinstance(self.header, Composite):
+            raise SchemaError(f"headerType {self.header_type} must be a composite")
+        for required in ("blockLength", "templateId", "schemaId", "version"):
+            self.header.member(required)
+
+    # ------------------------------------------------------------------------
+    # Types
+    # ------------------------------------------------------------------------
+
+    def resolve(self, name):
+        if name in self.types:
+            return self.types[name]
+        if name in PRIMITIVES:
+            return Type(name, name)
+        elem = self._type_elems.get(name)
+        if elem is None:
+            raise SchemaError(f"unknown type {name}")
+        return self.parse_type(elem)
+
+    def parse_type(self, elem, register=True):
+        kind = local(elem.tag)
+        name = elem.get("name")
+        if kind == "type":
+            t = self.parse_encoded(elem)
+        elif kind == "enum":
+            encoding = self.encoding_of(elem, "enum")
+            values = []
+            for v in elem:
+                if local(v.tag) == "validValue":
+                    values.append((v.get("name"), (v.text or "").strip()))
+            t = Enum(name, encoding, values)
+        elif kind == "set":
+            encoding = self.encoding_of(elem, "set")
+            choices = []
+            for c in elem:
+                if local(c.tag) == "choice":
+                    choices.append((c.get("name"), int((c.text or "0").strip())))
+            t = Set(name, encoding, choices)
+        elif kind == "composite":
+            t = self.parse_composite(elem)
+        elif kind == "ref":
+            t = self.resolve(elem.get("type"))
+        else:
+            raise SchemaError(f"unsupported type element <{kind}>")
+
+        if register and kind != "ref":
+            self.types[name] = t
+            if kind in ("enum", "set", "composite"):
+                self.order.append(t)
+        return t
+
+    def parse_encoded(self, elem):
+        presence = elem.get("presence", "required")
+        const = (elem.text or "").strip() if presence == "constant" else None
+        return Type(elem.get("name"), elem.get("primitiveType"),
+                    int_attr(elem, "length", 1), presence,
+                    elem.get("nullValue"), const)
+
+    def encoding_of(self, elem, what):
+        encoding = elem.get("encodingType")
+        if encoding in PRIMITIVES:
+            return Type(encoding, encoding)
+        t = self.resolve(encoding)
+        if not isinstance(t, Type):
+            raise SchemaError(f"{what} {elem.get('name')}: encodingType must be a primitive type")
+        return t
+
+    def parse_composite(self, elem):
+        c = Composite(elem.get("name"))
+        offset = 0
+        for m in elem:
+            kind = local(m.tag)
+            if kind not in ("type", "enum", "set", "composite", "ref"):
+                continue
+            if kind == "type":
+                t = self.parse_encoded(m)
+            elif kind == "ref":
+                t = self.resolve(m.get("type"))
+            else:
+                if m.get("name") in self.types:
+                    t = self.types[m.get("name")]
+                else:
+                    t = self.parse_type(m)
+            offset = int_attr(m, "offset", offset)
+            member = Member(m.get("name"), t, offset,
+                            presence=getattr(t, "presence", "required"),
+                            const=getattr(t, "const", None))
+            c.members.append(member)
+            offset += member.size
+        c.size = offset
+        return c
+
+    # ------------------------------------------------------------------------
+    # Messages
+    # ------------------------------------------------------------------------
+
+    def parse_field(self, elem, offset):
+        name = elem.get("name")
+        t = self.resolve(elem.get("type"))
+        presence = elem.get("presence") or getattr(t, "presence", "required")
+        const = None
+        if presence == "constant":
+            if isinstance(t, Enum):
+                value_ref = elem.get("valueRef")
+                if not value_ref:
+                    raise SchemaError(f"constant enum field {name} needs valueRef")
+                const = value_ref.split(".", 1)[1]
+            elif isinstance(t, Type):
+                const = t.const if t.const is not None else (elem.text or "").strip()
+            else:
+                raise SchemaError(f"field {name}: constant {t.kind} not supported")
+        offset = int_attr(elem, "offset", offset)
+        return Member(name, t, offset, presence, const, int_attr(elem, "id"))
+
+    def parse_body(self, owner, elem):
+        offset = 0
+        for child in elem:
+            kind = local(child.tag)
+            if kind == "field":
+                if owner.groups or owner.datas:
+                    raise SchemaError(f"{owner.name}: fields must precede groups and data")
+                f = self.parse_field(child, offset)
+                owner.fields.append(f)
+                offset = f.offset + f.size
+            elif kind == "group":
+                if owner.datas:
+                    raise SchemaError(f"{owner.name}: groups must precede data")
+                dim = self.resolve(child.get("dimensionType", "groupSizeEncoding"))
+                if not isinstance(dim, Composite):
+                    raise SchemaError(f"group {child.get('name')}: dimensionType must be a composite")
+                dim.member("blockLength")
+                dim.member("numInGroup")
+                g = Group(child.get("name"), int_attr(child, "id"), dim,
+                          int_attr(child, "blockLength"))
+                self.parse_body(g, child)
+                owner.groups.append(g)
+            elif kind == "data":
+                enc = self.resolve(child.get("type"))
+                if not isinstance(enc, Composite):
+                    raise SchemaError(f"data {child.get('name')}: type must be a composite")
+                enc.member("length")
+                enc.member("varData")
+                owner.datas.append(Data(child.get("name"), int_attr(child, "id"), enc))
+        computed = offset
+        if owner.block_length is None:
+            owner.block_length = computed
+        elif owner.block_length < computed:
+            raise SchemaError(f"{owner.name}: blockLength {owner.block_length} < fields ({computed})")
+
+    def parse_message(self, elem):
+        m = Message(elem.get("name"), int_attr(elem, "id"), int_attr(elem, "blockLength"),
+                    elem.get("description", ""))
+        if m.id is None:
+            raise SchemaError(f"message {m.name} has no id")
+        self.parse_body(m, elem)
+        return m
+
+
+# ============================================================================
+# C++ emission
+# ============================================================================
+
+class Writer:
+    def __init__(self):
+        self.lines = []
+        self.depth = 0
+
+    def __call__(self, text=""):
+        if text:
+            self.lines.append("    " * self.depth + text)
+        else:
+            self.lines.append("")
+
+    def indent(self):
+        self.depth += 1
+
+    def dedent(self):
+        self.depth -= 1
+
+    def banner(self, title):
+        self("// " + "=" * (76 - 4 * self.depth))
+        self("// " + title)
+        self("// " + "=" * (76 - 4 * self.depth))
+
+    def text(self):
+        return "\n".join(self.lines) + "\n"
+
+
+def cpp_value_type(t):
+    """C++ type a field getter returns"""
+    if isinstance(t, Enum):
+        return pascal(t.name)
+    if isinstance(t, (Set, Composite)):
+        return pascal(t.name)
+    return t.cpp
+
+
+def emit_enum(w, e):
+    w(f"enum class {pascal(e.name)} : {e.encoding.cpp} {{")
+    w.indent()
+    for name, value in e.values:
+        w(f"{safe(name)} = {e.value_literal(value)},")
+    w(f"NULL_VALUE = {e.encoding.null_literal()},")
+    w.dedent()
+    w("};")
+    w()
+
+
+def emit_set(w, s):
+    cls = pascal(s.name)
+    cpp = s.encoding.cpp
+    w(f"// Bit set over {s.encoding.primitive} (flyweight view)")
+    w(f"class {cls} {{")
+    w("public:")
+    w.indent()
+    w(f"static constexpr std::size_t SIZE = {s.size};")
+    w()
+    w("struct Bit {")
+    w.indent()
+    for name, bit in s.choices:
+        w(f"static constexpr unsigned {pascal(name)} = {bit};")
+    w.dedent()
+    w("};")
+    w()
+    w(f"explicit {cls}(char* buffer) noexcept : buffer_{{buffer}} {{}}")
+    w()
+    w(f"[[nodiscard]] NFX_FORCE_INLINE {cpp} raw() const noexcept {{")
+    w(f"    return read_le<{cpp}>(buffer_);")
+    w("}")
+    w()
+    w(f"NFX_FORCE_INLINE {cls}& raw({cpp} value) noexcept {{")
+    w("    write_le(buffer_, value);")
+    w("    return *this;")
+    w("}")
+    w()
+    w(f"NFX_FORCE_INLINE {cls}& clear() noexcept {{ return raw(0); }}")
+    for name, bit in s.choices:
+        fn = camel(name)
+        w()
+        w(f"[[nodiscard]] NFX_FORCE_INLINE bool {fn}() const noexcept {{")
+        w(f"    return (raw() >> Bit::{pascal(name)}) & 1U;")
+        w("}")
+        w()
+        w(f"NFX_FORCE_INLINE {cls}& {fn}(bool value) noexcept {{")
+        w(f"    const auto mask = static_cast<{cpp}>({cpp}{{1}} << Bit::{pascal(name)});")
+        w(f"    return raw(static_cast<{cpp}>(value ? (raw() | mask) : (raw() & ~mask)));")
+        w("}")
+    w.dedent()
+    w()
+    w("private:")
+    w("    char* buffer_;")
+    w("};")
+    w()
+
+
+def emit_accessors(w, cls, members, base, mutable_base):
+    """Getters/setters for fixed-offset members; base/mutable_base are
+    expressions yielding const char* / char* to the start of the block"""
+    for m in members:
+        t = m.type
+        fn = camel(m.name)
+        off = f"Offset::{pascal(m.name)}"
+        w()
+        if m.is_constant:
+            if isinstance(t, Enum):
+                w(f"[[nodiscard]] static constexpr {pascal(t.name)} {fn}() noexcept {{")
+                w(f"    return {pascal(t.name)}::{safe(m.const)};")
+                w("}")
+            elif t.is_string:
+                w(f"[[nodiscard]] static constexpr std::string_view {fn}() noexcept {{")
+                w(f"    return {string_literal(m.const)};")
+                w("}")
+            else:
+                lit = char_literal(m.const) if t.primitive == "char" else f"static_cast<{t.cpp}>({m.const})"
+                w(f"[[nodiscard]] static constexpr {t.cpp} {fn}() noexcept {{")
+                w(f"    return {lit};")
+                w("}")
+            continue
+
+        if isinstance(t, (Composite, Set)):
+            view = pascal(t.name)
+            w(f"[[nodiscard]] NFX_FORCE_INLINE {view} {fn}() const noexcept {{")
+            w(f"    return {view}{{const_cast<char*>({base}) + {off}}};")
+            w("}")
+            continue
+
+        if isinstance(t, Enum):
+            enc = t.encoding.cpp
+            ty = pascal(t.name)
+            w(f"[[nodiscard]] NFX_HOT NFX_FORCE_INLINE {ty} {fn}() const noexcept {{")
+            w(f"    return static_cast<{ty}>(read_le<{enc}>({base} + {off}));")
+            w("}")
+            w()
+            w(f"NFX_FORCE_INLINE {cls}& {fn}({ty} value) noexcept {{")
+            w(f"    write_le({mutable_base} + {off}, static_cast<{enc}>(value));")
+            w("    return *this;")
+            w("}")
+            continue
+
+        if t.length == 0:
+            continue
+
+        if t.is_string:
+            w(f"[[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::string_view {fn}() const noexcept {{")
+            w(f"    const char* p = {base} + {off};")
+            w(f"    const void* end = std::memchr(p, '\\0', Size::{pascal(m.name)});")
+            w(f"    return std::string_view{{p, end ? static_cast<std::size_t>(static_cast<const char*>(end) - p) : Size::{pascal(m.name)}}};")
+            w("}")
+            w()
+            w(f"NFX_FORCE_INLINE {cls}& {fn}(std::string_view value) noexcept {{")
+            w(f"    const std::size_t n = std::min(value.size(), Size::{pascal(m.name)});")
+            w(f"    char* p = {mutable_base} + {off};")
+            w("    std::memcpy(p, value.data(), n);")
+            w(f"    std::memset(p + n, 0, Size::{pascal(m.name)} - n);")
+            w("    return *this;")
+            w("}")
+            continue
+
+        if t.length > 1:
+            elem = PRIMITIVES[t.primitive][1]
+            w(f"static constexpr std::size_t {upper_snake(m.name)}_LENGTH = {t.length};")
+            w()
+            w(f"[[nodiscard]] NFX_FORCE_INLINE {t.cpp} {fn}(std::size_t i) const noexcept {{")
+            w(f"    return read_le<{t.cpp}>({base} + {off} + i * {elem});")
+            w("}")
+            w()
+            w(f"NFX_FORCE_INLINE {cls}& {fn}(std::size_t i, {t.cpp} value) noexcept {{")
+            w(f"    write_le({mutable_base} + {off} + i * {elem}, value);")
+            w("    return *this;")
+            w("}")
+            continue
+
+        w(f"[[nodiscard]] NFX_HOT NFX_FORCE_INLINE {t.cpp} {fn}() const noexcept {{")
+        w(f"    return read_le<{t.cpp}>({base} + {off});")
+        w("}")
+        w()
+        w(f"NFX_FORCE_INLINE {cls}& {fn}({t.cpp} value) noexcept {{")
+        w(f"    write_le({mutable_base} + {off}, value);")
+        w("    return *this;")
+        w("}")
+        if m.presence == "optional":
+            has = "has" + pascal(m.name).rstrip("_")
+            w()
+            w(f"[[nodiscard]] static constexpr {t.cpp} {fn.rstrip('_')}NullValue() noexcept {{")
+            w(f"    return {t.null_literal()};")
+            w("}")
+            w()
+            w(f"[[nodiscard]] NFX_FORCE_INLINE bool {has}() const noexcept {{")
+            if t.primitive in ("float", "double"):
+                w(f"    return !std::isnan({fn}());")
+            else:
+                w(f"    return {fn}() != {fn.rstrip('_')}NullValue();")
+            w("}")
+
+
+def emit_offsets(w, members, trailing=None):
+    w("// Field offsets within the block")
+    w("struct Offset {")
+    w.indent()
+    for m in members:
+        if not m.is_constant:
+            w(f"static constexpr std::size_t {pascal(m.name)} = {m.offset};")
+    w.dedent()
+    w("};")
+    w()
+    w("// Field sizes")
+    w("struct Size {")
+    w.indent()
+    for m in members:
+        if not m.is_constant:
+            w(f"static constexpr std::size_t {pascal(m.name)} = {m.size};")
+    w.dedent()
+    w("};")
+
+
+def emit_composite(w, c):
+    cls = pascal(c.name)
+    w(f"// Composite {c.name} ({c.size} bytes, flyweight view)")
+    w(f"class {cls} {{")
+    w("public:")
+    w.indent()
+    w(f"static constexpr std::size_t SIZE = {c.size};")
+    w()
+    emit_offsets(w, c.members)
+    w()
+    w(f"explicit {cls}(char* buffer) noexcept : buffer_{{buffer}} {{}}")
+    emit_accessors(w, cls, c.members, "buffer_", "buffer_")
+    names = {m.name for m in c.members}
+    if {"mantissa", "exponent"} <= names:
+        w()
+        w("// Decimal value (mantissa * 10^exponent); not for the hot path")
+        w("[[nodiscard]] double toDouble() const noexcept {")
+        w("    return static_cast<double>(mantissa()) * std::pow(10.0, static_cast<double>(exponent()));")
+        w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE const char* buffer() const noexcept { return buffer_; }")
+    w.dedent()
+    w()
+    w("private:")
+    w("    char* buffer_;")
+    w("};")
+    w()
+
+
+def dim_rw(dim, member):
+    m = dim.member(member)
+    return m.type.cpp, m.offset
+
+
+def emit_data_accessors(w, owner_cls, datas, limit):
+    """Var-data: length prefix + bytes at the running position"""
+    for d in datas:
+        fn = camel(d.name)
+        len_cpp, len_off = d.encoding.member("length").type.cpp, d.encoding.member("length").offset
+        hdr = d.encoding.member("varData").offset
+        w()
+        w(f"// Var-data {d.name}: read in schema order after groups")
+        w(f"[[nodiscard]] NFX_FORCE_INLINE std::string_view {fn}() const noexcept {{")
+        w(f"    const std::size_t pos = {limit};")
+        w(f"    if (pos + {hdr} > length_) return {{}};")
+        w(f"    const std::size_t n = read_le<{len_cpp}>(buffer_ + pos + {len_off});")
+        w(f"    if (pos + {hdr} + n > length_) return {{}};")
+        w(f"    {limit} = pos + {hdr} + n;")
+        w(f"    return std::string_view{{buffer_ + pos + {hdr}, n}};")
+        w("}")
+        w()
+        w(f"NFX_FORCE_INLINE {owner_cls}& {fn}(std::string_view value) noexcept {{")
+        w(f"    const std::size_t pos = {limit};")
+        w(f"    write_le(mutableBuffer() + pos + {len_off}, static_cast<{len_cpp}>(value.size()));")
+        w(f"    std::memcpy(mutableBuffer() + pos + {hdr}, value.data(), value.size());")
+        w(f"    {limit} = pos + {hdr} + value.size();")
+        w("    return *this;")
+        w("}")
+
+
+def emit_group_accessors(w, groups, limit):
+    for g in groups:
+        cls = pascal(g.name)
+        fn = camel(g.name)
+        w()
+        w(f"// Repeating group {g.name}: decode, then iterate with hasNext()/next()")
+        w(f"[[nodiscard]] NFX_FORCE_INLINE {cls} {fn}() const noexcept {{")
+        w(f"    return {cls}::wrapForDecode(buffer_, length_, &{limit});")
+        w("}")
+        w()
+        w(f"// Start encoding count entries of {g.name}")
+        w(f"[[nodiscard]] NFX_FORCE_INLINE {cls} {fn}Count(std::size_t count) noexcept {{")
+        w(f"    return {cls}::wrapForEncode(mutableBuffer(), length_, &{limit}, count);")
+        w("}")
+
+
+def emit_group(w, g):
+    cls = pascal(g.name)
+    dim = g.dimension
+    bl_cpp, bl_off = dim_rw(dim, "blockLength")
+    n_cpp, n_off = dim_rw(dim, "numInGroup")
+    w(f"// Repeating group {g.name}" + (f" (id={g.id})" if g.id is not None else ""))
+    w(f"class {cls} {{")
+    w("public:")
+    w.indent()
+    w(f"static constexpr std::size_t BLOCK_LENGTH = {g.block_length};")
+    w(f"static constexpr std::size_t DIMENSION_SIZE = {dim.size};  // {dim.name}")
+    w()
+    for sub in g.groups:
+        emit_group(w, sub)
+    emit_offsets(w, g.fields)
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE static " + cls + " wrapForDecode(")
+    w("    const char* buffer, std::size_t length, std::size_t* position) noexcept {")
+    w(f"    {cls} group{{buffer, length, position}};")
+    w(f"    if (*position + DIMENSION_SIZE <= length) {{")
+    w(f"        group.blockLength_ = read_le<{bl_cpp}>(buffer + *position + {bl_off});")
+    w(f"        group.count_ = read_le<{n_cpp}>(buffer + *position + {n_off});")
+    w("        *position += DIMENSION_SIZE;")
+    w("    }")
+    w("    return group;")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE static " + cls + " wrapForEncode(")
+    w("    char* buffer, std::size_t length, std::size_t* position, std::size_t count) noexcept {")
+    w(f"    {cls} group{{buffer, length, position}};")
+    w("    group.blockLength_ = BLOCK_LENGTH;")
+    w("    group.count_ = count;")
+    w(f"    write_le(buffer + *position + {bl_off}, static_cast<{bl_cpp}>(BLOCK_LENGTH));")
+    w(f"    write_le(buffer + *position + {n_off}, static_cast<{n_cpp}>(count));")
+    w("    *position += DIMENSION_SIZE;")
+    w("    return group;")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE std::size_t count() const noexcept { return count_; }")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE std::size_t index() const noexcept { return index_; }")
+    w()
+    w("// More entries left (and the next block fits the buffer)")
+    w("[[nodiscard]] NFX_HOT NFX_FORCE_INLINE bool hasNext() const noexcept {")
+    w("    return index_ < count_ && *position_ + blockLength_ <= length_;")
+    w("}")
+    w()
+    w("// Advance to the next entry (decode) or start the next entry (encode)")
+    w(f"NFX_HOT NFX_FORCE_INLINE {cls}& next() noexcept {{")
+    w("    offset_ = *position_;")
+    w("    *position_ += blockLength_;")
+    w("    ++index_;")
+    w("    return *this;")
+    w("}")
+    w()
+    w("// Iterate remaining entries: fn(Group&)")
+    w("template <typename Fn>")
+    w("NFX_FORCE_INLINE void forEach(Fn&& fn) noexcept {")
+    w("    while (hasNext()) {")
+    w("        fn(next());")
+    w("    }")
+    w("}")
+    emit_accessors(w, cls, g.fields, "(buffer_ + offset_)",
+                   "(mutableBuffer() + offset_)")
+    emit_group_accessors(w, g.groups, "*position_")
+    emit_data_accessors(w, cls, g.datas, "*position_")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {")
+    w("    return const_cast<char*>(buffer_);")
+    w("}")
+    w.dedent()
+    w()
+    w("private:")
+    w.indent()
+    w(f"{cls}(const char* buffer, std::size_t length, std::size_t* position) noexcept")
+    w("    : buffer_{buffer}, length_{length}, position_{position} {}")
+    w()
+    w("const char* buffer_;")
+    w("std::size_t length_;")
+    w("std::size_t* position_;   // Parent message's running position")
+    w("std::size_t blockLength_{0};")
+    w("std::size_t count_{0};")
+    w("std::size_t index_{0};")
+    w("std::size_t offset_{0};")
+    w.dedent()
+    w("};")
+    w()
+
+
+def emit_layout_comment(w, m):
+    w("//")
+    w(f"// Body ({m.block_length} bytes):")
+    width = max([len(f.name) for f in m.fields] + [4])
+    for f in m.fields:
+        if f.is_constant:
+            continue
+        span = f"{f.offset}" if f.size == 1 else f"{f.offset}-{f.offset + f.size - 1}"
+        w(f"//   Offset {span:>7}: {f.name:<{width}}  {f.type.name}")
+    for g in m.groups:
+        w(f"//   group {g.name} ({g.dimension.name}, {g.block_length}-byte entries)")
+    for d in m.datas:
+        w(f"//   data  {d.name} ({d.encoding.name})")
+
+
+def emit_message(w, m, schema):
+    cls = pascal(m.name) + "Codec"
+    hdr = schema.header
+    w.banner(f"{cls}: SBE Flyweight Codec for {m.name} (templateId={m.id})")
+    if m.description:
+        w(f"// {m.description}")
+    emit_layout_comment(w, m)
+    w()
+    w(f"class {cls} {{")
+    w("public:")
+    w.indent()
+    w("// Message constants")
+    w(f"static constexpr SbeUint16 TEMPLATE_ID = {m.id};")
+    w(f"static constexpr std::size_t BLOCK_LENGTH = {m.block_length};")
+    w(f"static constexpr std::size_t TOTAL_SIZE = MessageHeader::SIZE + BLOCK_LENGTH;  // Without groups/data")
+    w()
+    for g in m.groups:
+        emit_group(w, g)
+    emit_offsets(w, m.fields)
+    w()
+    w("// " + "=" * 72)
+    w("// Decode API (Zero-Copy Flyweight)")
+    w("// " + "=" * 72)
+    w()
+    w(f"[[nodiscard]] NFX_FORCE_INLINE static {cls} wrapForDecode(")
+    w("    const char* buffer, std::size_t length) noexcept {")
+    w(f"    {cls} codec{{buffer, length}};")
+    w("    if (length >= MessageHeader::SIZE) {")
+    w("        // Acting block length: newer schema versions may append fields")
+    w("        codec.position_ = MessageHeader::SIZE + codec.header().blockLength();")
+    w("    }")
+    w("    return codec;")
+    w("}")
+    w()
+    w("// Template matches and the (possibly extended) root block fits")
+    w("[[nodiscard]] NFX_FORCE_INLINE bool isValid() const noexcept {")
+    w("    if (buffer_ == nullptr || length_ < TOTAL_SIZE) {")
+    w("        return false;")
+    w("    }")
+    w("    const auto h = header();")
+    w("    return h.templateId() == TEMPLATE_ID &&")
+    w("           h.blockLength() >= BLOCK_LENGTH &&")
+    w("           MessageHeader::SIZE + h.blockLength() <= length_;")
+    w("}")
+    emit_accessors(w, cls, m.fields, "body()", "mutableBody()")
+    emit_group_accessors(w, m.groups, "position_")
+    emit_data_accessors(w, cls, m.datas, "position_")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE const char* body() const noexcept {")
+    w("    return buffer_ + MessageHeader::SIZE;")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE MessageHeader header() const noexcept {")
+    w("    return MessageHeader{const_cast<char*>(buffer_)};")
+    w("}")
+    w()
+    w("// " + "=" * 72)
+    w("// Encode API (Fluent Builder)")
+    w("// " + "=" * 72)
+    w()
+    w(f"[[nodiscard]] NFX_FORCE_INLINE static {cls} wrapForEncode(")
+    w("    char* buffer, std::size_t length) noexcept {")
+    w(f"    {cls} codec{{buffer, length}};")
+    w("    codec.position_ = TOTAL_SIZE;")
+    w("    return codec;")
+    w("}")
+    w()
+    w("// Encode header and zero the root block (call first)")
+    w(f"NFX_FORCE_INLINE {cls}& encodeHeader() noexcept {{")
+    w("    header()")
+    w("        .blockLength(static_cast<" + hdr.member("blockLength").type.cpp + ">(BLOCK_LENGTH))")
+    w("        .templateId(TEMPLATE_ID)")
+    w("        .schemaId(Schema::ID)")
+    w("        .version(Schema::VERSION);")
+    w("    std::memset(mutableBody(), 0, BLOCK_LENGTH);")
+    w("    return *this;")
+    w("}")
+    w()
+    w("// Bytes consumed so far (decode) or written so far (encode)")
+    w("[[nodiscard]] NFX_FORCE_INLINE std::size_t encodedLength() const noexcept {")
+    w("    return position_;")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {")
+    w("    return std::span<const char>{buffer_, position_};")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE char* mutableBody() noexcept {")
+    w("    return mutableBuffer() + MessageHeader::SIZE;")
+    w("}")
+    w()
+    w("[[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {")
+    w("    return const_cast<char*>(buffer_);")
+    w("}")
+    w.dedent()
+    w()
+    w("private:")
+    w.indent()
+    w(f"{cls}(const char* buffer, std::size_t length) noexcept")
+    w("    : buffer_{buffer}, length_{length} {}")
+    w()
+    w("const char* buffer_{nullptr};")
+    w("std::size_t length_{0};")
+    w("// Running position for groups/var-data, advanced by reads")
+    w("mutable std::size_t position_{TOTAL_SIZE};")
+    w.dedent()
+    w("};")
+    w()
+    for f in m.fields:
+        if not f.is_constant:
+            w(f"static_assert({cls}::Offset::{pascal(f.name)} + {cls}::Size::{pascal(f.name)} <= {cls}::BLOCK_LENGTH);")
+    w()
+
+
+def emit_dispatch(w, schema):
+    msgs = sorted(schema.messages, key=lambda m: m.id)
+    w.banner("Message Dispatch by Template ID (jump table)")
+    w()
+    w("struct UnknownMessage {")
+    w("    SbeUint16 templateId;")
+    w("    const char* buffer;")
+    w("    std::size_t length;")
+    w("};")
+    w()
+    if not msgs:
+        w("template <typename Handler>")
+        w("NFX_FORCE_INLINE void dispatch(const char* buffer, std::size_t length, Handler&& handler) noexcept {")
+        w("    UnknownMessage unknown{0, buffer, length};")
+        w("    handler(unknown);")
+        w("}")
+        return
+    lo, hi = msgs[0].id, msgs[-1].id
+    by_id = {m.id: m for m in msgs}
+    w(f"inline constexpr SbeUint16 MIN_TEMPLATE_ID = {lo};")
+    w(f"inline constexpr SbeUint16 MAX_TEMPLATE_ID = {hi};")
+    w()
+    w("namespace detail {")
+    w()
+    w("template <typename Handler>")
+    w("using DispatchFn = void (*)(const char*, std::size_t, Handler&);")
+    w()
+    w("template <typename Codec, typename Handler>")
+    w("void dispatch_codec(const char* buffer, std::size_t length, Handler& handler) {")
+    w("    auto codec = Codec::wrapForDecode(buffer, length);")
+    w("    handler(codec);")
+    w("}")
+    w()
+    w("template <typename Handler>")
+    w("void dispatch_unknown(const char* buffer, std::size_t length, Handler& handler) {")
+    w("    UnknownMessage unknown{MessageHeader{const_cast<char*>(buffer)}.templateId(), buffer, length};")
+    w("    handler(unknown);")
+    w("}")
+    w()
+    w("// Indexed by templateId - MIN_TEMPLATE_ID; gaps go to dispatch_unknown")
+    w("template <typename Handler>")
+    w(f"inline constexpr std::array<DispatchFn<Handler>, {hi - lo + 1}> DISPATCH_TABLE = {{")
+    w.indent()
+    for i in range(lo, hi + 1):
+        if i in by_id:
+            w(f"&dispatch_codec<{pascal(by_id[i].name)}Codec, Handler>,")
+        else:
+            w("&dispatch_unknown<Handler>,")
+    w.dedent()
+    w("};")
+    w()
+    w("}  // namespace detail")
+    w()
+    w("// Dispatch to the codec for the header's templateId")
+    w("// Handler signature: void(auto& codec), codec is one of the *Codec types")
+    w("// or UnknownMessage (short buffer, other schema, unknown templateId)")
+    w("template <typename Handler>")
+    w("NFX_HOT NFX_FORCE_INLINE void dispatch(")
+    w("    const char* buffer, std::size_t length, Handler&& handler) {")
+    w("    using H = std::remove_reference_t<Handler>;")
+    w("    if (length < MessageHeader::SIZE) [[unlikely]] {")
+    w("        UnknownMessage unknown{0, buffer, length};")
+    w("        handler(unknown);")
+    w("        return;")
+    w("    }")
+    w("    const MessageHeader header{const_cast<char*>(buffer)};")
+    w("    const SbeUint16 templateId = header.templateId();")
+    w("    if (header.schemaId() != Schema::ID ||")
+    w("        templateId < MIN_TEMPLATE_ID || templateId > MAX_TEMPLATE_ID) [[unlikely]] {")
+    w("        UnknownMessage unknown{templateId, buffer, length};")
+    w("        handler(unknown);")
+    w("        return;")
+    w("    }")
+    w("    detail::DISPATCH_TABLE<H>[templateId - MIN_TEMPLATE_ID](buffer, length, handler);")
+    w("}")
+    w()
+    w("template <typename Handler>")
+    w("NFX_FORCE_INLINE void dispatch(std::span<const char> buffer, Handler&& handler) {")
+    w("    dispatch(buffer.data(), buffer.size(), std::forward<Handler>(handler));")
+    w("}")
+    w()
+
+
+def generate(schema, namespace, source):
+    w = Writer()
+    w("// SPDX-License-Identifier: MIT")
+    w("// Copyright (c) 2025 SilverstreamsAI")
+    w("//")
+    w(f"// Generated by tools/sbe_codegen.py from {source}. Do not edit.")
+    w()
+    w("#pragma once")
+    w()
+    for inc in ("algorithm", "array", "cmath", "cstddef", "cstring", "limits",
+                "span", "string_view", "type_traits", "utility"):
+        w(f"#include <{inc}>")
+    w()
+    w('#include "nexusfix/platform/platform.hpp"')
+    w('#include "nexusfix/sbe/types/sbe_types.hpp"')
+    w()
+    w(f"namespace {namespace} {{")
+    w()
+    w("using namespace ::nfx::sbe;")
+    w()
+    w.banner(f"Schema {schema.package or '(unnamed)'}")
+    w()
+    w("struct Schema {")
+    w(f"    static constexpr SbeUint16 ID = {schema.id};")
+    w(f"    static constexpr SbeUint16 VERSION = {schema.version};")
+    w(f"    static constexpr std::string_view PACKAGE = {string_literal(schema.package)};")
+    w("};")
+    w()
+
+    enums = [t for t in schema.order if isinstance(t, Enum)]
+    sets = [t for t in schema.order if isinstance(t, Set)]
+    composites = [t for t in schema.order if isinstance(t, Composite)]
+    if enums:
+        w.banner("Enums")
+        w()
+        for e in enums:
+            emit_enum(w, e)
+    if sets:
+        w.banner("Sets")
+        w()
+        for s in sets:
+            emit_set(w, s)
+    w.banner("Composites")
+    w()
+    for c in composites:
+        emit_composite(w, c)
+    if pascal(schema.header.name) != "MessageHeader":
+        w(f"using MessageHeader = {pascal(schema.header.name)};")
+        w()
+    for m in schema.messages:
+        emit_message(w, m, schema)
+    emit_dispatch(w, schema)
+    w(f"}}  // namespace {namespace}")
+    # Drop the blank placeholder lines emitted where nothing was needed
+    text = w.text()
+    return re.sub(r"\n{3,}", "\n\n", text)
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Generate NexusFIX SBE codecs from an XML schema")
+    ap.add_argument("schema", help="SBE XML message schema")
+    ap.add_argument("-o", "--output", required=True, help="Header to write")
+    ap.add_argument("--namespace", help="C++ namespace (default nfx::sbe::<package>)")
+    args = ap.parse_args(argv)
+
+    try:
+        root = ET.parse(args.schema).getroot()
+        schema = Schema(root)
+        ns = args.namespace or "nfx::sbe::" + re.sub(r"\W", "_", schema.package or "generated")
+        text = generate(schema, ns, os.path.basename(args.schema))
+    except (SchemaError, ET.ParseError) as e:
+        print(f"{args.schema}: error: {e}", file=sys.stderr)
+        return 1
+
+    # Only touch the output when it changes, so dependents don't rebuild
+    try:
+        with open(args.output, encoding="utf-8") as f:
+            if f.read() == text:
+                return 0
+    except OSError:
+        pass
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())